@@ -0,0 +1,33 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__b = __sn__arr_clone(&__sn__a);
+    __sn__arr_push(&__sn__a, 3LL);
+    
+    __sn__arr_push(&__sn__b, 4LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__a->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__b->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,33 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("hello") });
+            sn_array_push(__al__, &(char *){ strdup("world") });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__b = __sn__arr_clone(&__sn__a);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((((char * *)__sn__b->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })]));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_strdup((((char * *)__sn__b->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })]));
+            sn_auto_str char *__is_p3__ = sn_strdup("\n");
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__b)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 2);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 2);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__c = __sn__arr_concat(&__sn__a, __sn__b);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__c)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(((((bool *)__sn__c->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c->len : __ai__; })])) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_strdup(((((bool *)__sn__c->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__c->len : __ai__; })])) ? "true" : "false");
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_strdup(((((bool *)__sn__c->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__c->len : __ai__; })])) ? "true" : "false");
+            sn_auto_str char *__is_p5__ = sn_strdup(" ");
+            sn_auto_str char *__is_p6__ = sn_strdup(((((bool *)__sn__c->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__c->len : __ai__; })])) ? "true" : "false");
+            sn_auto_str char *__is_p7__ = sn_strdup("\n");
+            sn_str_concat_multi(8, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
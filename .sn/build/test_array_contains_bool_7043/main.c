@@ -0,0 +1,29 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 3);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__arr_contains(&__sn__arr, true)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__arr_contains(&__sn__arr, false)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,29 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 3);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.5 });
+            sn_array_push(__al__, &(double){ 2.5 });
+            sn_array_push(__al__, &(double){ 3.5 });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__arr_contains(&__sn__arr, 2.5)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__arr_contains(&__sn__arr, 9.9000000000000004)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
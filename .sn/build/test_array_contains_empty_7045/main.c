@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__arr_contains(&__sn__arr, 1LL)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,30 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("hello") });
+            sn_array_push(__al__, &(char *){ strdup("world") });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__arr_contains(&__sn__arr, "world")) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__arr_contains(&__sn__arr, "foo")) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
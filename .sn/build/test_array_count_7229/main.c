@@ -0,0 +1,73 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 7);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            __al__;
+        });
+    printf("%lld\n", (long long)(__sn__arr_int_count(&__sn__a, 7LL)));
+    
+    printf("%lld\n", (long long)(__sn__arr_int_count(&__sn__a, 99LL)));
+    
+    sn_auto_arr SnArray * __sn__d = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 4);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 0.5 });
+            sn_array_push(__al__, &(double){ 1.0 });
+            sn_array_push(__al__, &(double){ 0.5 });
+            sn_array_push(__al__, &(double){ 2.0 });
+            __al__;
+        });
+    printf("%lld\n", (long long)(__sn__arr_double_count(&__sn__d, 0.5)));
+    
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 5);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 1LL });
+            sn_array_push(__al__, &(unsigned char){ 2LL });
+            sn_array_push(__al__, &(unsigned char){ 1LL });
+            sn_array_push(__al__, &(unsigned char){ 1LL });
+            sn_array_push(__al__, &(unsigned char){ 3LL });
+            __al__;
+        });
+    printf("%lld\n", (long long)(__sn__arr_byte_count(&__sn__b, 1LL)));
+    
+    sn_auto_arr SnArray * __sn__flags = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 5);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            __al__;
+        });
+    printf("%lld\n", (long long)(__sn__arr_bool_count(&__sn__flags, true)));
+    
+    printf("%lld\n", (long long)(__sn__arr_bool_count(&__sn__flags, false)));
+    
+    sn_auto_arr SnArray * __sn__empty = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    printf("%lld\n", (long long)(__sn__arr_int_count(&__sn__empty, 1LL)));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        });
+    __sn__arr_int_fill(&__sn__a, 9LL);
+    
+    { sn_auto_str char *__ps__ = __sn__arr_join(&__sn__a, ", "); sn_println(__ps__); };
+    
+    printf("%lld\n", (long long)(sn_array_length(__sn__a)));
+    
+    sn_auto_arr SnArray * __sn__d = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 3);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.0 });
+            sn_array_push(__al__, &(double){ 2.0 });
+            sn_array_push(__al__, &(double){ 3.0 });
+            __al__;
+        });
+    __sn__arr_double_fill(&__sn__d, 0.25);
+    
+    printf("%.5f\n", (double)(__sn__arr_double_sum(&__sn__d)));
+    
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 3);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 1LL });
+            sn_array_push(__al__, &(unsigned char){ 2LL });
+            sn_array_push(__al__, &(unsigned char){ 3LL });
+            __al__;
+        });
+    __sn__arr_byte_fill(&__sn__b, 255LL);
+    
+    printf("%lld\n", (long long)(__sn__arr_byte_sum(&__sn__b)));
+    
+    sn_auto_arr SnArray * __sn__flags = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 3);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        });
+    __sn__arr_bool_fill(&__sn__flags, true);
+    
+    printf("%lld\n", (long long)(__sn__arr_bool_count(&__sn__flags, true)));
+    
+    sn_auto_arr SnArray * __sn__empty = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    __sn__arr_int_fill(&__sn__empty, 1LL);
+    
+    printf("%lld\n", (long long)(sn_array_length(__sn__empty)));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,55 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 6);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__evens = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__x = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if ((sn_mod_long(__sn__x, 2LL) == 0LL)) {
+                    __sn__arr_push(&__sn__evens, __sn__x);
+                    
+                }
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__evens)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__evens->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__evens->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__evens->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__evens->len : __ai__; })])));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__evens->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__evens->len : __ai__; })])));
+            sn_auto_str char *__is_p5__ = sn_strdup("\n");
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
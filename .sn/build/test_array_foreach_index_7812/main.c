@@ -0,0 +1,41 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("a") });
+            sn_array_push(__al__, &(char *){ strdup("b") });
+            sn_array_push(__al__, &(char *){ strdup("c") });
+            __al__;
+        });
+    long long __sn__i = 0LL;
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            char * __sn__s = ((char * *)__arr_0__->data)[__idx_0__];
+            {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                        sn_auto_str char *__is_p1__ = sn_strdup(":");
+                        sn_auto_str char *__is_p2__ = sn_strdup(__sn__s);
+                        sn_auto_str char *__is_p3__ = sn_strdup(" ");
+                        sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                    }); sn_print(__ps__); };
+                
+                (__sn__i = sn_add_long(__sn__i, 1LL));
+                
+            }
+        }
+    }
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            __al__;
+        });
+    long long __sn__sum = 0LL;
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__x = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                (__sn__sum = sn_add_long(__sn__sum, __sn__x));
+                
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("hello") });
+            sn_array_push(__al__, &(char *){ strdup("world") });
+            sn_array_push(__al__, &(char *){ strdup("foo") });
+            __al__;
+        });
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            char * __sn__s = ((char * *)__arr_0__->data)[__idx_0__];
+            {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup(__sn__s);
+                        sn_auto_str char *__is_p1__ = sn_strdup("\n");
+                        sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,25 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+    if (sn_gt_long(sn_array_length(__sn__arr), 0LL)) {
+        sn_print("nonempty\n");
+        
+    }
+    if (__sn__arr_contains(&__sn__arr, 2LL)) {
+        sn_print("has two\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
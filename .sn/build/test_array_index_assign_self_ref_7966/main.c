@@ -0,0 +1,39 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__headers = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("  name  ") });
+            sn_array_push(__al__, &(char *){ strdup("  age  ") });
+            sn_array_push(__al__, &(char *){ strdup("  city  ") });
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__headers)); __sn__i++) {
+            ({
+                long long __ai__ = __sn__i; if (__ai__ < 0) __ai__ += __sn__headers->len;
+                char * __new__ = __sn___trim(&(((char * *)__sn__headers->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__headers->len : __ai__; })]));
+                free(((char * *)__sn__headers->data)[__ai__]);
+                ((char * *)__sn__headers->data)[__ai__] = __new__;
+            });
+            
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((((char * *)__sn__headers->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__headers->len : __ai__; })]));
+            sn_auto_str char *__is_p1__ = sn_strdup(",");
+            sn_auto_str char *__is_p2__ = sn_strdup((((char * *)__sn__headers->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__headers->len : __ai__; })]));
+            sn_auto_str char *__is_p3__ = sn_strdup(",");
+            sn_auto_str char *__is_p4__ = sn_strdup((((char * *)__sn__headers->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__headers->len : __ai__; })]));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            sn_array_push(__al__, &(long long){ 40LL });
+            sn_array_push(__al__, &(long long){ 50LL });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr->data)[({ long long __ai__ = (-1LL); __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr->data)[({ long long __ai__ = (-2LL); __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr->data)[({ long long __ai__ = (-5LL); __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,30 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 4);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)97 });
+            sn_array_push(__al__, &(char){ (char)98 });
+            sn_array_push(__al__, &(char){ (char)99 });
+            sn_array_push(__al__, &(char){ (char)100 });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__arr_indexOf(&__sn__arr, (char)99)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__arr_indexOf(&__sn__arr, (char)122)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
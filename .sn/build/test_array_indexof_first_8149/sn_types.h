@@ -0,0 +1,24 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+
+
+
+
+#endif
@@ -0,0 +1,33 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 3);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 0LL });
+            sn_array_push(__al__, &(unsigned char){ 127LL });
+            sn_array_push(__al__, &(unsigned char){ 255LL });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__arr)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%u", (unsigned)((((unsigned char *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%u", (unsigned)((((unsigned char *)__sn__arr->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%u", (unsigned)((((unsigned char *)__sn__arr->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            sn_auto_str char *__is_p5__ = sn_strdup("\n");
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 5);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)104 });
+            sn_array_push(__al__, &(char){ (char)101 });
+            sn_array_push(__al__, &(char){ (char)108 });
+            sn_array_push(__al__, &(char){ (char)108 });
+            sn_array_push(__al__, &(char){ (char)111 });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__arr, "");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__arr, "-");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include "sn_types.h"
+__sn__Tracker * tracker_create(long long);
+long long tracker_alive_count();
+void takes_trackers(SnArray *);
+
+
+
+
+int main() {
+    ({ sn_auto_arr SnArray *__al_tmp_0__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Tracker *), 3);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Tracker_release_elem;
+            __al__->elem_copy = __sn__Tracker_retain_into;
+            sn_array_push(__al__, &(__sn__Tracker *){ tracker_create(1LL) });
+            sn_array_push(__al__, &(__sn__Tracker *){ tracker_create(2LL) });
+            sn_array_push(__al__, &(__sn__Tracker *){ tracker_create(3LL) });
+            __al__;
+        }); takes_trackers(__al_tmp_0__); });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("leaked array literal: alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tracker_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((tracker_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    sn_println("test_array_literal_arg_leak: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
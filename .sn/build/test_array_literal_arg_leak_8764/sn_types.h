@@ -0,0 +1,59 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Tracker (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__id;
+} __sn__Tracker;
+
+
+static inline __sn__Tracker *__sn__Tracker__new(void) {
+    __sn__Tracker *p = calloc(1, sizeof(__sn__Tracker));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Tracker *__sn__Tracker_retain(__sn__Tracker *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+void tracker_dispose(__sn__Tracker *);
+static inline void __sn__Tracker_release(__sn__Tracker **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        tracker_dispose(*p);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Tracker __attribute__((cleanup(__sn__Tracker_release)))
+#define sn_auto_ref_Tracker __attribute__((cleanup(__sn__Tracker_release)))
+
+static inline void __sn__Tracker_release_elem(void *p) { __sn__Tracker_release((__sn__Tracker **)p); }
+static inline void __sn__Tracker_retain_into(const void *src, void *dst) { *(__sn__Tracker **)dst = __sn__Tracker_retain(*(__sn__Tracker *const *)src); }
+
+
+
+void tracker_dispose(__sn__Tracker *);
+
+
+
+#endif
@@ -0,0 +1,51 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Record __sn__makeRecord(char * __sn__id, char * __sn__src, long long __sn__ts) {
+
+    return (__sn__Record){ .__sn__id = strdup(__sn__id), .__sn__source = strdup(__sn__src), .__sn__timestamp = __sn__ts, .__sn__features = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Feature), 1);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Feature_cleanup_elem;
+            __al__->elem_copy = __sn__Feature_copy_into;
+            sn_array_push(__al__, &((__sn__Feature){ .__sn__key = strdup("temp"), .__sn__value = 23.5 }));
+            __al__;
+        }) };}
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__records = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Record), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Record_cleanup_elem;
+            __al__->elem_copy = __sn__Record_copy_into;
+            { __sn__Record __st__ = __sn__makeRecord("r1", "a", 1000LL); sn_array_push(__al__, &__st__); }
+            { __sn__Record __st__ = __sn__makeRecord("r2", "b", 2000LL); sn_array_push(__al__, &__st__); }
+            __al__;
+        });
+    sn_assert((sn_array_length(__sn__records) == 2LL), "array should have 2 elements");
+    
+    sn_assert((strcmp((((__sn__Record *)__sn__records->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__records->len : __ai__; })]).__sn__id, "r1") == 0), "records[0].id");
+    
+    sn_assert((strcmp((((__sn__Record *)__sn__records->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__records->len : __ai__; })]).__sn__source, "a") == 0), "records[0].source");
+    
+    sn_assert(((((__sn__Record *)__sn__records->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__records->len : __ai__; })]).__sn__timestamp == 1000LL), "records[0].timestamp");
+    
+    sn_assert((strcmp((((__sn__Feature *)(((__sn__Record *)__sn__records->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__records->len : __ai__; })]).__sn__features->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Record *)__sn__records->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__records->len : __ai__; })]).__sn__features->len : __ai__; })]).__sn__key, "temp") == 0), "records[0].features[0].key");
+    
+    sn_assert((strcmp((((__sn__Record *)__sn__records->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__records->len : __ai__; })]).__sn__id, "r2") == 0), "records[1].id");
+    
+    sn_assert((strcmp((((__sn__Record *)__sn__records->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__records->len : __ai__; })]).__sn__source, "b") == 0), "records[1].source");
+    
+    sn_assert(((((__sn__Record *)__sn__records->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__records->len : __ai__; })]).__sn__timestamp == 2000LL), "records[1].timestamp");
+    
+    sn_println("test_array_literal_func_call: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,149 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Feature (as val) */
+typedef struct {
+    char * __sn__key;
+    double __sn__value;
+} __sn__Feature;
+/* Value operations */
+static inline __sn__Feature __sn__Feature_copy(const __sn__Feature *src) {
+    __sn__Feature dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Feature_cleanup(__sn__Feature *p) {
+    free(p->__sn__key);
+
+}
+
+#define sn_auto_Feature __attribute__((cleanup(__sn__Feature_cleanup)))
+
+static inline void __sn__Feature_cleanup_elem(void *p) { __sn__Feature_cleanup((__sn__Feature *)p); }
+static inline void __sn__Feature_copy_into(const void *src, void *dst) { *(__sn__Feature *)dst = __sn__Feature_copy((const __sn__Feature *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Feature *__sn__Feature_alloc(void) {
+    return calloc(1, sizeof(__sn__Feature));
+}
+
+static inline void __sn__Feature_release(__sn__Feature **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Feature __attribute__((cleanup(__sn__Feature_release)))
+
+static inline void __sn__Feature_release_elem(void *p) { __sn__Feature_release((__sn__Feature **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Feature_to_string(const __sn__Feature *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Feature { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Record (as val) */
+typedef struct {
+    char * __sn__id;
+    char * __sn__source;
+    long long __sn__timestamp;
+    SnArray * __sn__features;
+} __sn__Record;
+/* Value operations */
+static inline __sn__Record __sn__Record_copy(const __sn__Record *src) {
+    __sn__Record dst;
+    dst.__sn__id = src->__sn__id ? strdup(src->__sn__id) : NULL;
+    dst.__sn__source = src->__sn__source ? strdup(src->__sn__source) : NULL;
+    dst.__sn__timestamp = src->__sn__timestamp;
+    dst.__sn__features = sn_array_copy(src->__sn__features);
+    return dst;
+}
+
+static inline void __sn__Record_cleanup(__sn__Record *p) {
+    free(p->__sn__id);
+    free(p->__sn__source);
+    sn_cleanup_array(&p->__sn__features);
+
+}
+
+#define sn_auto_Record __attribute__((cleanup(__sn__Record_cleanup)))
+
+static inline void __sn__Record_cleanup_elem(void *p) { __sn__Record_cleanup((__sn__Record *)p); }
+static inline void __sn__Record_copy_into(const void *src, void *dst) { *(__sn__Record *)dst = __sn__Record_copy((const __sn__Record *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Record *__sn__Record_alloc(void) {
+    return calloc(1, sizeof(__sn__Record));
+}
+
+static inline void __sn__Record_release(__sn__Record **p) {
+    if (*p) {
+        free((*p)->__sn__id);
+        free((*p)->__sn__source);
+        sn_cleanup_array(&(*p)->__sn__features);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Record __attribute__((cleanup(__sn__Record_release)))
+
+static inline void __sn__Record_release_elem(void *p) { __sn__Record_release((__sn__Record **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Record_to_string(const __sn__Record *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Record { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__id ? p->__sn__id : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "source: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__source ? p->__sn__source : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "timestamp: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__timestamp);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "features: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__features); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Record __sn__makeRecord(char *, char *, long long);
+
+
+
+
+#endif
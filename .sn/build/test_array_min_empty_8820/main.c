@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    sn_println("before");
+    
+    printf("%lld\n", (long long)(__sn__arr_int_min(&__sn__a)));
+    
+    sn_println("This should not be printed");
+    
+    fflush(stdout);
+    return 0;
+}
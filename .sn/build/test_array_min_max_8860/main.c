@@ -0,0 +1,75 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 9);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ (-3LL) });
+            sn_array_push(__al__, &(long long){ 12LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 0LL });
+            sn_array_push(__al__, &(long long){ 11LL });
+            sn_array_push(__al__, &(long long){ (-2LL) });
+            sn_array_push(__al__, &(long long){ 9LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        });
+    printf("%lld\n", (long long)(__sn__arr_int_min(&__sn__a)));
+    
+    printf("%lld\n", (long long)(__sn__arr_int_max(&__sn__a)));
+    
+    sn_auto_arr SnArray * __sn__one = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 42LL });
+            __al__;
+        });
+    printf("%lld\n", (long long)(__sn__arr_int_min(&__sn__one)));
+    
+    printf("%lld\n", (long long)(__sn__arr_int_max(&__sn__one)));
+    
+    sn_auto_arr SnArray * __sn__big = sn_array_range(1LL, 1001LL);
+    printf("%lld\n", (long long)(__sn__arr_int_min(&__sn__big)));
+    
+    printf("%lld\n", (long long)(__sn__arr_int_max(&__sn__big)));
+    
+    sn_auto_arr SnArray * __sn__d = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 5);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.5 });
+            sn_array_push(__al__, &(double){ (-2.25) });
+            sn_array_push(__al__, &(double){ 8.0 });
+            sn_array_push(__al__, &(double){ 3.5 });
+            sn_array_push(__al__, &(double){ 0.5 });
+            __al__;
+        });
+    printf("%.5f\n", (double)(__sn__arr_double_min(&__sn__d)));
+    
+    printf("%.5f\n", (double)(__sn__arr_double_max(&__sn__d)));
+    
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 5);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 200LL });
+            sn_array_push(__al__, &(unsigned char){ 100LL });
+            sn_array_push(__al__, &(unsigned char){ 3LL });
+            sn_array_push(__al__, &(unsigned char){ 255LL });
+            sn_array_push(__al__, &(unsigned char){ 17LL });
+            __al__;
+        });
+    unsigned char __sn__lo = __sn__arr_byte_min(&__sn__b);
+    unsigned char __sn__hi = __sn__arr_byte_max(&__sn__b);
+    printf("%lld\n", (long long)(__sn__byte_toInt(__sn__lo)));
+    
+    printf("%lld\n", (long long)(__sn__byte_toInt(__sn__hi)));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            __sn__arr_push(&__sn__arr, sn_mul_long(__sn__i, 10LL));
+            
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__arr)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__x = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__x));
+                        sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                        sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
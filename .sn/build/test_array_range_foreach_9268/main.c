@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__sum = 0LL;
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(1LL, 6LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__x = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                (__sn__sum = sn_add_long(__sn__sum, __sn__x));
+                
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
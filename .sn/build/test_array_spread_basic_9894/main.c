@@ -0,0 +1,49 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 4);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 0LL });
+            sn_array_extend(__al__, __sn__a);
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__b)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__b->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__b->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__b->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])));
+            sn_auto_str char *__is_p5__ = sn_strdup(" ");
+            sn_auto_str char *__is_p6__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__b->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])));
+            sn_auto_str char *__is_p7__ = sn_strdup(" ");
+            sn_auto_str char *__is_p8__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__b->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])));
+            sn_auto_str char *__is_p9__ = sn_strdup(" ");
+            sn_auto_str char *__is_p10__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__b->data)[({ long long __ai__ = 5LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])));
+            sn_auto_str char *__is_p11__ = sn_strdup("\n");
+            sn_str_concat_multi(12, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__, __is_p9__, __is_p10__, __is_p11__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
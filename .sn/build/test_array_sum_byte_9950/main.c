@@ -0,0 +1,35 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 4);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 200LL });
+            sn_array_push(__al__, &(unsigned char){ 100LL });
+            sn_array_push(__al__, &(unsigned char){ 3LL });
+            sn_array_push(__al__, &(unsigned char){ 255LL });
+            __al__;
+        });
+    long long __sn__total = __sn__arr_byte_sum(&__sn__b);
+    printf("%lld\n", (long long)(__sn__total));
+    
+    sn_auto_arr SnArray * __sn__many = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 0);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 1000LL); __sn__i = __sn__i + 1LL) {
+            __sn__arr_push(&__sn__many, 255LL);
+            
+        }
+    }
+    printf("%lld\n", (long long)(__sn__arr_byte_sum(&__sn__many)));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__d = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 5);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.5 });
+            sn_array_push(__al__, &(double){ (-2.25) });
+            sn_array_push(__al__, &(double){ 8.0 });
+            sn_array_push(__al__, &(double){ 3.5 });
+            sn_array_push(__al__, &(double){ 0.5 });
+            __al__;
+        });
+    printf("%.5f\n", (double)(__sn__arr_double_sum(&__sn__d)));
+    
+    sn_auto_arr SnArray * __sn__empty = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 0);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            __al__;
+        });
+    printf("%.5f\n", (double)(__sn__arr_double_sum(&__sn__empty)));
+    
+    sn_auto_arr SnArray * __sn__halves = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 0);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 1000LL); __sn__i = __sn__i + 1LL) {
+            __sn__arr_push(&__sn__halves, 0.5);
+            
+        }
+    }
+    printf("%.5f\n", (double)(__sn__arr_double_sum(&__sn__halves)));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ (-3LL) });
+            sn_array_push(__al__, &(long long){ 12LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 0LL });
+            __al__;
+        });
+    printf("%lld\n", (long long)(__sn__arr_int_sum_checked(&__sn__a)));
+    
+    sn_auto_arr SnArray * __sn__empty = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    printf("%lld\n", (long long)(__sn__arr_int_sum_checked(&__sn__empty)));
+    
+    sn_auto_arr SnArray * __sn__big = sn_array_range(1LL, 1001LL);
+    printf("%lld\n", (long long)(__sn__arr_int_sum_checked(&__sn__big)));
+    
+    sn_auto_arr SnArray * __sn__neg = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ (-9223372036854775807LL) });
+            sn_array_push(__al__, &(long long){ 9223372036854775807LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            __al__;
+        });
+    printf("%lld\n", (long long)(__sn__arr_int_sum_checked(&__sn__neg)));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 9223372036854775807LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            __al__;
+        });
+    sn_println("before");
+    
+    printf("%lld\n", (long long)(__sn__arr_int_sum_checked(&__sn__a)));
+    
+    sn_println("This should not be printed");
+    
+    fflush(stdout);
+    return 0;
+}
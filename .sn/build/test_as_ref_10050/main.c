@@ -0,0 +1,59 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 42LL;
+    double __sn__y = 3.1400000000000001;
+    bool __sn__flag = true;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("x = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("y = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__y));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("flag = ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__flag) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    (__sn__x = 100LL);
+    
+    (__sn__y = 2.71);
+    
+    (__sn__flag = false);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Modified x = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Modified y = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__y));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Modified flag = ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__flag) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Item * __sn__lookup(SnArray * __sn__items, long long __sn__idx) {
+
+    return __sn__Item_retain((((__sn__Item * *)__sn__items->data)[({ long long __ai__ = __sn__idx; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]));}
+
+
+long long __sn__readId(SnArray * __sn__items, long long __sn__idx) {
+
+    sn_auto_Item __sn__Item * __sn__it = __sn__lookup(__sn__items, __sn__idx);
+
+    return __sn__it->__sn__id;}
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item *), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_release_elem;
+            __al__->elem_copy = __sn__Item_retain_into;
+            __al__;
+        });
+    __sn__arr_push(&__sn__items, ({
+        __sn__Item *__tmp__ = __sn__Item__new();
+        __tmp__->__sn__id = 100LL;
+        __tmp__;
+    }));
+    
+    __sn__arr_push(&__sn__items, ({
+        __sn__Item *__tmp__ = __sn__Item__new();
+        __tmp__->__sn__id = 200LL;
+        __tmp__;
+    }));
+    
+    __sn__arr_push(&__sn__items, ({
+        __sn__Item *__tmp__ = __sn__Item__new();
+        __tmp__->__sn__id = 300LL;
+        __tmp__;
+    }));
+    
+    long long __sn__count = 0LL;
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 200LL); __sn__i++) {
+            long long __sn__idx = sn_mod_long(__sn__i, 3LL);
+            long long __sn__got = __sn__readId(__sn__items, __sn__idx);
+            if ((__sn__idx == 0LL)) {
+                ({ char *__assert_msg__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                        sn_auto_str char *__is_p2__ = sn_strdup(": expected 100, got ");
+                        sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__got));
+                        sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                    }); sn_assert((__sn__got == 100LL), __assert_msg__); free(__assert_msg__); (void)0; });
+                
+            }
+            if ((__sn__idx == 1LL)) {
+                ({ char *__assert_msg__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                        sn_auto_str char *__is_p2__ = sn_strdup(": expected 200, got ");
+                        sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__got));
+                        sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                    }); sn_assert((__sn__got == 200LL), __assert_msg__); free(__assert_msg__); (void)0; });
+                
+            }
+            if ((__sn__idx == 2LL)) {
+                ({ char *__assert_msg__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                        sn_auto_str char *__is_p2__ = sn_strdup(": expected 300, got ");
+                        sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__got));
+                        sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                    }); sn_assert((__sn__got == 300LL), __assert_msg__); free(__assert_msg__); (void)0; });
+                
+            }
+            (__sn__count = sn_add_long(__sn__count, 1LL));
+            
+        }
+    }
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("expected 200 iterations, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__count));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__count == 200LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("array corrupted: len=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__items)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((sn_array_length(__sn__items) == 3LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    sn_print("PASS\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,74 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Item (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__id;
+} __sn__Item;
+
+
+static inline __sn__Item *__sn__Item__new(void) {
+    __sn__Item *p = calloc(1, sizeof(__sn__Item));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Item *__sn__Item_retain(__sn__Item *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Item_release(__sn__Item **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Item *__sn__Item_copy(const __sn__Item *src) {
+    __sn__Item *dst = calloc(1, sizeof(__sn__Item));
+    dst->__rc__ = 1;
+    dst->__sn__id = src->__sn__id;
+    return dst;
+}
+
+#define sn_auto_Item __attribute__((cleanup(__sn__Item_release)))
+#define sn_auto_ref_Item __attribute__((cleanup(__sn__Item_release)))
+
+static inline void __sn__Item_release_elem(void *p) { __sn__Item_release((__sn__Item **)p); }
+static inline void __sn__Item_retain_into(const void *src, void *dst) { *(__sn__Item **)dst = __sn__Item_retain(*(__sn__Item *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Item_to_string(const __sn__Item *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Item { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__id);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+__sn__Item * __sn__lookup(SnArray *, long long);
+long long __sn__readId(SnArray *, long long);
+
+
+
+
+#endif
@@ -0,0 +1,123 @@
+#include "sn_types.h"
+
+
+
+
+
+__sn__Catalog * __sn__Catalog_create() {
+
+    return ({
+        __sn__Catalog *__tmp__ = __sn__Catalog__new();
+        __tmp__->__sn__entries = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Entry *), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Entry_release_elem;
+            __al__->elem_copy = __sn__Entry_retain_into;
+            __al__;
+        });
+        __tmp__;
+    });}
+
+void __sn__Catalog_add(__sn__Catalog *__sn__self, char * __sn__tag, long long __sn__kind) {
+
+    __sn__arr_push(&__sn__self->__sn__entries, ({
+        __sn__Entry *__tmp__ = __sn__Entry__new();
+        __tmp__->__sn__tag = strdup(__sn__tag);
+        __tmp__->__sn__kind = __sn__kind;
+        __tmp__;
+    }));
+    
+}
+
+__sn__Entry * __sn__Catalog_find(__sn__Catalog *__sn__self, char * __sn__tag) {
+
+    {
+        SnArray *__arr_0__ = __sn__self->__sn__entries;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            __sn__Entry * __sn__entry = ((__sn__Entry * *)__arr_0__->data)[__idx_0__];
+            {
+                if ((strcmp(__sn__entry->__sn__tag, __sn__tag) == 0)) {
+                    return __sn__Entry_retain(__sn__entry);}
+            }
+        }
+    }
+
+    return ({
+        __sn__Entry *__tmp__ = __sn__Entry__new();
+        __tmp__->__sn__tag = strdup("");
+        __tmp__->__sn__kind = (-1LL);
+        __tmp__;
+    });}
+
+int main() {
+    sn_auto_Catalog __sn__Catalog * __sn__cat = __sn__Catalog_create();
+    __sn__Catalog_add(__sn__cat, "alpha", 1LL);
+    
+    __sn__Catalog_add(__sn__cat, "beta", 2LL);
+    
+    __sn__Catalog_add(__sn__cat, "gamma", 3LL);
+    
+    {
+        for (long long __sn__iter = 0LL; sn_lt_long(__sn__iter, 50LL); __sn__iter++) {
+            sn_auto_Entry __sn__Entry * __sn__e1 = __sn__Catalog_find(__sn__cat, "beta");
+            ({ char *__assert_msg__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__iter));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": e1.tag wrong (likely UAF), got '");
+                    sn_auto_str char *__is_p3__ = sn_strdup(__sn__e1->__sn__tag);
+                    sn_auto_str char *__is_p4__ = sn_strdup("'");
+                    sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                }); sn_assert((strcmp(__sn__e1->__sn__tag, "beta") == 0), __assert_msg__); free(__assert_msg__); (void)0; });
+            
+            ({ char *__assert_msg__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__iter));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": e1.kind wrong, got ");
+                    sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__e1->__sn__kind));
+                    sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                }); sn_assert((__sn__e1->__sn__kind == 2LL), __assert_msg__); free(__assert_msg__); (void)0; });
+            
+            sn_auto_Entry __sn__Entry * __sn__e2 = __sn__Catalog_find(__sn__cat, "gamma");
+            ({ char *__assert_msg__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__iter));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": e2.tag wrong (likely UAF), got '");
+                    sn_auto_str char *__is_p3__ = sn_strdup(__sn__e2->__sn__tag);
+                    sn_auto_str char *__is_p4__ = sn_strdup("'");
+                    sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                }); sn_assert((strcmp(__sn__e2->__sn__tag, "gamma") == 0), __assert_msg__); free(__assert_msg__); (void)0; });
+            
+            ({ char *__assert_msg__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__iter));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": e2.kind wrong, got ");
+                    sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__e2->__sn__kind));
+                    sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                }); sn_assert((__sn__e2->__sn__kind == 3LL), __assert_msg__); free(__assert_msg__); (void)0; });
+            
+            sn_auto_Entry __sn__Entry * __sn__e3 = __sn__Catalog_find(__sn__cat, "alpha");
+            ({ char *__assert_msg__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__iter));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": e3.tag wrong (likely UAF), got '");
+                    sn_auto_str char *__is_p3__ = sn_strdup(__sn__e3->__sn__tag);
+                    sn_auto_str char *__is_p4__ = sn_strdup("'");
+                    sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                }); sn_assert((strcmp(__sn__e3->__sn__tag, "alpha") == 0), __assert_msg__); free(__assert_msg__); (void)0; });
+            
+            ({ char *__assert_msg__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__iter));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": e3.kind wrong, got ");
+                    sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__e3->__sn__kind));
+                    sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                }); sn_assert((__sn__e3->__sn__kind == 1LL), __assert_msg__); free(__assert_msg__); (void)0; });
+            
+        }
+    }
+    sn_print("PASS\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,130 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Entry (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    char * __sn__tag;
+    long long __sn__kind;
+} __sn__Entry;
+
+
+static inline __sn__Entry *__sn__Entry__new(void) {
+    __sn__Entry *p = calloc(1, sizeof(__sn__Entry));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Entry *__sn__Entry_retain(__sn__Entry *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Entry_release(__sn__Entry **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free((*p)->__sn__tag);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Entry *__sn__Entry_copy(const __sn__Entry *src) {
+    __sn__Entry *dst = calloc(1, sizeof(__sn__Entry));
+    dst->__rc__ = 1;
+    dst->__sn__tag = src->__sn__tag ? strdup(src->__sn__tag) : NULL;
+    dst->__sn__kind = src->__sn__kind;
+    return dst;
+}
+
+#define sn_auto_Entry __attribute__((cleanup(__sn__Entry_release)))
+#define sn_auto_ref_Entry __attribute__((cleanup(__sn__Entry_release)))
+
+static inline void __sn__Entry_release_elem(void *p) { __sn__Entry_release((__sn__Entry **)p); }
+static inline void __sn__Entry_retain_into(const void *src, void *dst) { *(__sn__Entry **)dst = __sn__Entry_retain(*(__sn__Entry *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Entry_to_string(const __sn__Entry *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Entry { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tag: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__tag ? p->__sn__tag : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "kind: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__kind);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+/* Struct: Catalog (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    SnArray * __sn__entries;
+} __sn__Catalog;
+
+
+static inline __sn__Catalog *__sn__Catalog__new(void) {
+    __sn__Catalog *p = calloc(1, sizeof(__sn__Catalog));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Catalog *__sn__Catalog_retain(__sn__Catalog *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Catalog_release(__sn__Catalog **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_cleanup_array(&(*p)->__sn__entries);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Catalog *__sn__Catalog_copy(const __sn__Catalog *src) {
+    __sn__Catalog *dst = calloc(1, sizeof(__sn__Catalog));
+    dst->__rc__ = 1;
+    dst->__sn__entries = sn_array_copy(src->__sn__entries);
+    return dst;
+}
+
+#define sn_auto_Catalog __attribute__((cleanup(__sn__Catalog_release)))
+#define sn_auto_ref_Catalog __attribute__((cleanup(__sn__Catalog_release)))
+
+static inline void __sn__Catalog_release_elem(void *p) { __sn__Catalog_release((__sn__Catalog **)p); }
+static inline void __sn__Catalog_retain_into(const void *src, void *dst) { *(__sn__Catalog **)dst = __sn__Catalog_retain(*(__sn__Catalog *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Catalog_to_string(const __sn__Catalog *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Catalog { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "entries: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__entries); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+__sn__Catalog * __sn__Catalog_create();
+void __sn__Catalog_add(__sn__Catalog *, char *, long long);
+__sn__Entry * __sn__Catalog_find(__sn__Catalog *, char *);
+
+
+
+#endif
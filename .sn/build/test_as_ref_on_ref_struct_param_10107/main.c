@@ -0,0 +1,104 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__compute(__sn__Worker * __sn__w) {
+
+    return sn_mul_long(__sn__w->__sn__value, 2LL);}
+
+
+void __sn__mutate(__sn__Worker * __sn__w) {
+
+    (__sn__w->__sn__value = 100LL);
+    
+}
+
+
+long long __sn__threadWork(__sn__Worker * __sn__w) {
+
+    return sn_add_long(__sn__w->__sn__value, 1LL);}
+
+
+long long __sn__Worker_bumpSelf(__sn__Worker *__sn__self, __sn__Worker * __sn__other) {
+
+    (__sn__other->__sn__value = sn_add_long(__sn__other->__sn__value, 1LL));
+    
+
+    return sn_add_long(__sn__self->__sn__value, __sn__other->__sn__value);}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__threadWork(args->arg0);
+    __sn__Worker_release(&args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_auto_Worker __sn__Worker * __sn__w = ({
+        __sn__Worker *__tmp__ = __sn__Worker__new();
+        __tmp__->__sn__value = 21LL;
+        __tmp__;
+    });
+    if ((__sn__compute(__sn__w) != 42LL)) {
+        sn_print("compute: FAIL\n");
+        
+        return 1LL;}
+    sn_print("compute: PASS\n");
+    
+    __sn__mutate(__sn__w);
+    
+    if ((__sn__w->__sn__value != 100LL)) {
+        sn_print("mutate: FAIL\n");
+        
+        return 1LL;}
+    sn_print("mutate: PASS\n");
+    
+    sn_auto_Worker __sn__Worker * __sn__other = ({
+        __sn__Worker *__tmp__ = __sn__Worker__new();
+        __tmp__->__sn__value = 5LL;
+        __tmp__;
+    });
+    (__sn__w->__sn__value = 10LL);
+    
+    long long __sn__s = __sn__Worker_bumpSelf(__sn__w, __sn__other);
+    if ((__sn__s != 16LL)) {
+        sn_print("bumpSelf return: FAIL\n");
+        
+        return 1LL;}
+    if ((__sn__other->__sn__value != 6LL)) {
+        sn_print("bumpSelf mutation: FAIL\n");
+        
+        return 1LL;}
+    sn_print("bumpSelf: PASS\n");
+    
+    long long __sn__h = 0; sn_auto_thread SnThread * __sn__h__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = __sn__Worker_retain(__sn__w);
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    if ((({
+        sn_auto_thread SnThread *__sync_th__ = __sn__h__th__; __sn__h__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__h = *(long long *)__sync_th__->result; }
+        __sn__h; })
+     != 11LL)) {
+        sn_print("threadWork: FAIL\n");
+        
+        return 1LL;}
+    sn_print("threadWork: PASS\n");
+    
+    sn_print("All as-ref-on-ref-struct tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
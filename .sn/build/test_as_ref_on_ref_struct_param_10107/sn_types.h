@@ -0,0 +1,81 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Worker (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__value;
+} __sn__Worker;
+
+
+static inline __sn__Worker *__sn__Worker__new(void) {
+    __sn__Worker *p = calloc(1, sizeof(__sn__Worker));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Worker *__sn__Worker_retain(__sn__Worker *p) {
+    if (p) sn_rc_inc_atomic(&p->__rc__);
+    return p;
+}
+
+static inline void __sn__Worker_release(__sn__Worker **p) {
+    if (*p && sn_rc_dec_atomic(&(*p)->__rc__)) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Worker *__sn__Worker_copy(const __sn__Worker *src) {
+    __sn__Worker *dst = calloc(1, sizeof(__sn__Worker));
+    dst->__rc__ = 1;
+    dst->__sn__value = src->__sn__value;
+    return dst;
+}
+
+#define sn_auto_Worker __attribute__((cleanup(__sn__Worker_release)))
+#define sn_auto_ref_Worker __attribute__((cleanup(__sn__Worker_release)))
+
+static inline void __sn__Worker_release_elem(void *p) { __sn__Worker_release((__sn__Worker **)p); }
+static inline void __sn__Worker_retain_into(const void *src, void *dst) { *(__sn__Worker **)dst = __sn__Worker_retain(*(__sn__Worker *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Worker_to_string(const __sn__Worker *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Worker { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+long long __sn__compute(__sn__Worker *);
+void __sn__mutate(__sn__Worker *);
+long long __sn__threadWork(__sn__Worker *);
+
+long long __sn__Worker_bumpSelf(__sn__Worker *, __sn__Worker *);
+
+typedef struct {
+    __sn__Worker * arg0;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+
+
+#endif
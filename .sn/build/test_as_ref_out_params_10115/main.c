@@ -0,0 +1,166 @@
+#include "sn_types.h"
+
+
+
+void get_dimensions(long long *__sn__width, long long *__sn__height) {
+
+    (*__sn__width = 1920LL);
+    
+
+    (*__sn__height = 1080LL);
+    
+}
+
+void double_num(long long *__sn__num) {
+
+    (*__sn__num = sn_mul_long((*__sn__num), 2LL));
+    
+}
+
+void compute_sum_and_product(long long __sn__a, long long __sn__b, long long *__sn__sum, long long *__sn__product) {
+
+    (*__sn__sum = sn_add_long(__sn__a, __sn__b));
+    
+
+    (*__sn__product = sn_mul_long(__sn__a, __sn__b));
+    
+}
+
+void compute_pi(double *__sn__result) {
+
+    (*__sn__result = 3.1415926535900001);
+    
+}
+
+void check_positive(long long __sn__n, bool *__sn__is_positive) {
+
+    (*__sn__is_positive = sn_gt_long(__sn__n, 0LL));
+    
+}
+
+int main() {
+    sn_print("Testing 'as ref' out-parameter semantics:\n\n");
+    
+    long long __sn__w = 0LL;
+    long long __sn__h = 0LL;
+    get_dimensions(&__sn__w, &__sn__h);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("1. Dimensions: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__w));
+            sn_auto_str char *__is_p2__ = sn_strdup("x");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__h));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__w != 1920LL)) {
+        sn_print("FAIL: Expected w=1920\n");
+        
+        return 1LL;}
+    if ((__sn__h != 1080LL)) {
+        sn_print("FAIL: Expected h=1080\n");
+        
+        return 1LL;}
+    long long __sn__num = 21LL;
+    double_num(&__sn__num);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("2. Doubled value: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__num));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__num != 42LL)) {
+        sn_print("FAIL: Expected 42\n");
+        
+        return 1LL;}
+    long long __sn__s = 0LL;
+    long long __sn__p = 0LL;
+    compute_sum_and_product(7LL, 6LL, &__sn__s, &__sn__p);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("3. Sum: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__s));
+            sn_auto_str char *__is_p2__ = sn_strdup(", Product: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__s != 13LL)) {
+        sn_print("FAIL: Expected sum=13\n");
+        
+        return 1LL;}
+    if ((__sn__p != 42LL)) {
+        sn_print("FAIL: Expected product=42\n");
+        
+        return 1LL;}
+    double __sn__pi = 0.0;
+    compute_pi(&__sn__pi);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("4. Pi: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (sn_lt_double(__sn__pi, 3.1400000000000001)) {
+        sn_print("FAIL: Expected pi >= 3.14\n");
+        
+        return 1LL;}
+    if (sn_gt_double(__sn__pi, 3.1499999999999999)) {
+        sn_print("FAIL: Expected pi <= 3.15\n");
+        
+        return 1LL;}
+    bool __sn__is_pos = false;
+    check_positive(42LL, &__sn__is_pos);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("5. Is 42 positive: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__is_pos) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__is_pos)) {
+        sn_print("FAIL: Expected true\n");
+        
+        return 1LL;}
+    check_positive((-5LL), &__sn__is_pos);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("6. Is -5 positive: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__is_pos) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (__sn__is_pos) {
+        sn_print("FAIL: Expected false\n");
+        
+        return 1LL;}
+    long long __sn__a = 5LL;
+    double_num(&__sn__a);
+    
+    double_num(&__sn__a);
+    
+    double_num(&__sn__a);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("7. Chained double: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__a));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__a != 40LL)) {
+        sn_print("FAIL: Expected 40\n");
+        
+        return 1LL;}
+    sn_print("\nAll 'as ref' out-parameter tests PASSED!\n");
+    
+    return 0LL;    fflush(stdout);
+}
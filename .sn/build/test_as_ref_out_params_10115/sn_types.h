@@ -0,0 +1,29 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+void get_dimensions(long long *, long long *);
+void double_num(long long *);
+void compute_sum_and_product(long long, long long, long long *, long long *);
+void compute_pi(double *);
+void check_positive(long long, bool *);
+
+
+
+
+#endif
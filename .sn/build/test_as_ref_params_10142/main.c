@@ -0,0 +1,381 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__increment(long long *__sn__x) {
+
+    (*__sn__x = sn_add_long((*__sn__x), 1LL));
+    
+}
+
+
+void __sn__test_basic_as_ref() {
+
+    sn_print("Test 1: Basic as ref parameter\n");
+    
+
+    long long __sn__count = 0LL;
+
+    __sn__increment(&__sn__count);
+    
+
+    sn_assert((__sn__count == 1LL), "basic increment");
+    
+
+    __sn__increment(&__sn__count);
+    
+
+    sn_assert((__sn__count == 2LL), "second increment");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__swap(long long *__sn__a, long long *__sn__b) {
+
+    long long __sn__temp = (*__sn__a);
+
+    (*__sn__a = (*__sn__b));
+    
+
+    (*__sn__b = __sn__temp);
+    
+}
+
+
+void __sn__test_multiple_as_ref() {
+
+    sn_print("Test 2: Multiple as ref parameters\n");
+    
+
+    long long __sn__x = 10LL;
+
+    long long __sn__y = 20LL;
+
+    __sn__swap(&__sn__x, &__sn__y);
+    
+
+    sn_assert((__sn__x == 20LL), "x swapped");
+    
+
+    sn_assert((__sn__y == 10LL), "y swapped");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__negate_double(double *__sn__x) {
+
+    (*__sn__x = (-(*__sn__x)));
+    
+}
+
+
+void __sn__toggle_bool(bool *__sn__x) {
+
+    (*__sn__x = (!(*__sn__x)));
+    
+}
+
+
+void __sn__test_different_types() {
+
+    sn_print("Test 3: Different primitive types\n");
+    
+
+    double __sn__d = 3.1400000000000001;
+
+    __sn__negate_double(&__sn__d);
+    
+
+    sn_assert(sn_lt_double(__sn__d, 0.0), "double negated");
+    
+
+    bool __sn__b = true;
+
+    __sn__toggle_bool(&__sn__b);
+    
+
+    sn_assert((__sn__b == false), "bool toggled");
+    
+
+    __sn__toggle_bool(&__sn__b);
+    
+
+    sn_assert((__sn__b == true), "bool toggled back");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+long long __sn__thread_increment(long long *__sn__counter) {
+
+    (*__sn__counter = sn_add_long((*__sn__counter), 1LL));
+    
+
+    return 0LL;}
+
+
+void __sn__test_threaded_as_ref() {
+
+    sn_print("Test 4: Threaded as ref modification\n");
+    
+
+    long long __sn__count = 0LL;
+
+    long long __sn__r1 = 0; sn_auto_thread SnThread * __sn__r1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = &__sn__count;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__r1__th__; __sn__r1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r1 = *(long long *)__sync_th__->result; }
+        __sn__r1; })
+    ;
+    
+
+    sn_assert((__sn__count == 1LL), "after first thread");
+    
+
+    long long __sn__r2 = 0; sn_auto_thread SnThread * __sn__r2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+        __args__->arg0 = &__sn__count;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__r2__th__; __sn__r2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r2 = *(long long *)__sync_th__->result; }
+        __sn__r2; })
+    ;
+    
+
+    sn_assert((__sn__count == 2LL), "after second thread");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+long long __sn__delayed_set(long long *__sn__x) {
+
+    (*__sn__x = 42LL);
+    
+
+    return 0LL;}
+
+
+void __sn__test_modify_after_sync() {
+
+    sn_print("Test 5: Modification after sync\n");
+    
+
+    long long __sn__value = 0LL;
+
+    long long __sn__r = 0; sn_auto_thread SnThread * __sn__r__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+        __args__->arg0 = &__sn__value;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+        __th__;
+    });
+
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__r__th__; __sn__r__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r = *(long long *)__sync_th__->result; }
+        __sn__r; })
+    ;
+    
+
+    (__sn__value = 100LL);
+    
+
+    sn_assert((__sn__value == 100LL), "can modify after sync");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__add_to_first(long long *__sn__target, long long __sn__amount) {
+
+    (*__sn__target = sn_add_long((*__sn__target), __sn__amount));
+    
+}
+
+
+void __sn__test_mixed_params() {
+
+    sn_print("Test 6: Mixed as ref and regular params\n");
+    
+
+    long long __sn__total = 0LL;
+
+    __sn__add_to_first(&__sn__total, 10LL);
+    
+
+    sn_assert((__sn__total == 10LL), "first add");
+    
+
+    __sn__add_to_first(&__sn__total, 25LL);
+    
+
+    sn_assert((__sn__total == 35LL), "second add");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__increment_byte(unsigned char *__sn__b) {
+
+    (*__sn__b = sn_add_long((*__sn__b), 1LL));
+    
+}
+
+
+void __sn__next_char(char *__sn__c) {
+
+    (*__sn__c)++;
+    
+}
+
+
+void __sn__test_byte_char_as_ref() {
+
+    sn_print("Test 7: Byte and char as ref\n");
+    
+
+    unsigned char __sn__b = 0LL;
+
+    __sn__increment_byte(&__sn__b);
+    
+
+    sn_assert((__sn__b == 1LL), "byte incremented");
+    
+
+    char __sn__c = (char)65;
+
+    __sn__next_char(&__sn__c);
+    
+
+    sn_assert((__sn__c == (char)66), "char incremented");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__outer_modify(long long *__sn__x) {
+
+    __sn__increment(&(*__sn__x));
+    
+
+    __sn__increment(&(*__sn__x));
+    
+}
+
+
+void __sn__test_nested_as_ref() {
+
+    sn_print("Test 8: Nested as ref calls\n");
+    
+
+    long long __sn__n = 0LL;
+
+    __sn__outer_modify(&__sn__n);
+    
+
+    sn_assert((__sn__n == 2LL), "nested increments");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__thread_increment(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__thread_increment(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__delayed_set(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_print("=== Parameter-level 'as ref' Tests ===\n\n");
+    
+    __sn__test_basic_as_ref();
+    
+    __sn__test_multiple_as_ref();
+    
+    __sn__test_different_types();
+    
+    __sn__test_threaded_as_ref();
+    
+    __sn__test_modify_after_sync();
+    
+    __sn__test_mixed_params();
+    
+    __sn__test_byte_char_as_ref();
+    
+    __sn__test_nested_as_ref();
+    
+    sn_print("\n=== All 'as ref' parameter tests passed! ===\n");
+    
+    fflush(stdout);
+    return 0;
+}
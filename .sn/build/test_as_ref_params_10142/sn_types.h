@@ -0,0 +1,57 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+void __sn__increment(long long *);
+void __sn__test_basic_as_ref();
+void __sn__swap(long long *, long long *);
+void __sn__test_multiple_as_ref();
+void __sn__negate_double(double *);
+void __sn__toggle_bool(bool *);
+void __sn__test_different_types();
+long long __sn__thread_increment(long long *);
+void __sn__test_threaded_as_ref();
+long long __sn__delayed_set(long long *);
+void __sn__test_modify_after_sync();
+void __sn__add_to_first(long long *, long long);
+void __sn__test_mixed_params();
+void __sn__increment_byte(unsigned char *);
+void __sn__next_char(char *);
+void __sn__test_byte_char_as_ref();
+void __sn__outer_modify(long long *);
+void __sn__test_nested_as_ref();
+
+
+typedef struct {
+    long long *arg0;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+typedef struct {
+    long long *arg0;
+    int _padding;
+} __ThreadArgs_1__;
+void *__thread_wrapper_1__(void *arg);
+typedef struct {
+    long long *arg0;
+    int _padding;
+} __ThreadArgs_2__;
+void *__thread_wrapper_2__(void *arg);
+
+
+#endif
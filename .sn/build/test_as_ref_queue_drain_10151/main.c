@@ -0,0 +1,105 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__drainAll(__sn__Holder * __sn__holder, long long __sn__max) {
+
+    sn_auto_arr SnArray * __sn__out = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item *), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_release_elem;
+            __al__->elem_copy = __sn__Item_retain_into;
+            __al__;
+        });
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, __sn__max); __sn__i++) {
+            __sn__Item * __sn____chain_tmp_0 = __sn__Holder_take(__sn__holder);
+            __sn__arr_push(&__sn__out, __sn____chain_tmp_0);
+            
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__out;
+        __sn__out = NULL;
+        return __ret__;
+    }}
+
+
+char * __sn__readTag(__sn__Item * __sn__item) {
+
+    return strdup(__sn__item->__sn__tag);}
+
+
+
+__sn__Item * __sn__Holder_take(__sn__Holder *__sn__self) {
+
+    sn_auto_Item __sn__Item * __sn__v = __sn__Item_retain((((__sn__Item * *)__sn__self->__sn__items->data)[({ long long __ai__ = __sn__self->__sn__head; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]));
+
+    (__sn__self->__sn__head = sn_add_long(__sn__self->__sn__head, 1LL));
+    
+
+    {
+        __sn__Item * __ret__ = __sn__v;
+        __sn__v = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_Holder __sn__Holder * __sn__holder = ({
+        __sn__Holder *__tmp__ = __sn__Holder__new();
+        __tmp__->__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item *), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_release_elem;
+            __al__->elem_copy = __sn__Item_retain_into;
+            __al__;
+        });
+        __tmp__->__sn__head = 0LL;
+        __tmp__;
+    });
+    __sn__arr_push(&__sn__holder->__sn__items, ({
+        __sn__Item *__tmp__ = __sn__Item__new();
+        __tmp__->__sn__tag = strdup("alpha");
+        __tmp__;
+    }));
+    
+    __sn__arr_push(&__sn__holder->__sn__items, ({
+        __sn__Item *__tmp__ = __sn__Item__new();
+        __tmp__->__sn__tag = strdup("beta");
+        __tmp__;
+    }));
+    
+    __sn__arr_push(&__sn__holder->__sn__items, ({
+        __sn__Item *__tmp__ = __sn__Item__new();
+        __tmp__->__sn__tag = strdup("gamma");
+        __tmp__;
+    }));
+    
+    sn_auto_arr SnArray * __sn__batch = __sn__drainAll(__sn__holder, 3LL);
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("expected batch of 3, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__batch)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((sn_array_length(__sn__batch) == 3LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__batch)); __sn__i++) {
+            sn_auto_str char * __sn__label = __sn__readTag((((__sn__Item * *)__sn__batch->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__batch->len : __ai__; })]));
+            ({ char *__assert_msg__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": label empty (likely UAF)");
+                    sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                }); sn_assert(sn_gt_long(sn_str_length(__sn__label), 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+            
+        }
+    }
+    sn_print("PASS\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,130 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Item (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    char * __sn__tag;
+} __sn__Item;
+
+
+static inline __sn__Item *__sn__Item__new(void) {
+    __sn__Item *p = calloc(1, sizeof(__sn__Item));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Item *__sn__Item_retain(__sn__Item *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Item_release(__sn__Item **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free((*p)->__sn__tag);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Item *__sn__Item_copy(const __sn__Item *src) {
+    __sn__Item *dst = calloc(1, sizeof(__sn__Item));
+    dst->__rc__ = 1;
+    dst->__sn__tag = src->__sn__tag ? strdup(src->__sn__tag) : NULL;
+    return dst;
+}
+
+#define sn_auto_Item __attribute__((cleanup(__sn__Item_release)))
+#define sn_auto_ref_Item __attribute__((cleanup(__sn__Item_release)))
+
+static inline void __sn__Item_release_elem(void *p) { __sn__Item_release((__sn__Item **)p); }
+static inline void __sn__Item_retain_into(const void *src, void *dst) { *(__sn__Item **)dst = __sn__Item_retain(*(__sn__Item *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Item_to_string(const __sn__Item *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Item { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tag: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__tag ? p->__sn__tag : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+/* Struct: Holder (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    SnArray * __sn__items;
+    long long __sn__head;
+} __sn__Holder;
+
+
+static inline __sn__Holder *__sn__Holder__new(void) {
+    __sn__Holder *p = calloc(1, sizeof(__sn__Holder));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Holder *__sn__Holder_retain(__sn__Holder *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Holder_release(__sn__Holder **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Holder *__sn__Holder_copy(const __sn__Holder *src) {
+    __sn__Holder *dst = calloc(1, sizeof(__sn__Holder));
+    dst->__rc__ = 1;
+    dst->__sn__items = sn_array_copy(src->__sn__items);
+    dst->__sn__head = src->__sn__head;
+    return dst;
+}
+
+#define sn_auto_Holder __attribute__((cleanup(__sn__Holder_release)))
+#define sn_auto_ref_Holder __attribute__((cleanup(__sn__Holder_release)))
+
+static inline void __sn__Holder_release_elem(void *p) { __sn__Holder_release((__sn__Holder **)p); }
+static inline void __sn__Holder_retain_into(const void *src, void *dst) { *(__sn__Holder **)dst = __sn__Holder_retain(*(__sn__Holder *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Holder_to_string(const __sn__Holder *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Holder { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "head: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__head);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+SnArray * __sn__drainAll(__sn__Holder *, long long);
+char * __sn__readTag(__sn__Item *);
+
+__sn__Item * __sn__Holder_take(__sn__Holder *);
+
+
+
+#endif
@@ -0,0 +1,79 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Item * __sn__lookup(SnArray * __sn__items, long long __sn__i) {
+
+    return __sn__Item_retain((((__sn__Item * *)__sn__items->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]));}
+
+
+__sn__Item * __sn__caller(SnArray * __sn__items, long long __sn__i) {
+
+    return __sn__lookup(__sn__items, __sn__i);}
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item *), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_release_elem;
+            __al__->elem_copy = __sn__Item_retain_into;
+            __al__;
+        });
+    __sn__arr_push(&__sn__items, ({
+        __sn__Item *__tmp__ = __sn__Item__new();
+        __tmp__->__sn__tag = strdup("a");
+        __tmp__->__sn__value = 1LL;
+        __tmp__;
+    }));
+    
+    __sn__arr_push(&__sn__items, ({
+        __sn__Item *__tmp__ = __sn__Item__new();
+        __tmp__->__sn__tag = strdup("b");
+        __tmp__->__sn__value = 2LL;
+        __tmp__;
+    }));
+    
+    __sn__arr_push(&__sn__items, ({
+        __sn__Item *__tmp__ = __sn__Item__new();
+        __tmp__->__sn__tag = strdup("c");
+        __tmp__->__sn__value = 3LL;
+        __tmp__;
+    }));
+    
+    {
+        for (long long __sn__iter = 0LL; sn_lt_long(__sn__iter, 20LL); __sn__iter++) {
+            {
+                for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__items)); __sn__i++) {
+                    sn_auto_Item __sn__Item * __sn__picked = __sn__caller(__sn__items, __sn__i);
+                    ({ char *__assert_msg__ = ({
+                            sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__iter));
+                            sn_auto_str char *__is_p2__ = sn_strdup(" i ");
+                            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                            sn_auto_str char *__is_p4__ = sn_strdup(": expected value ");
+                            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(sn_add_long(__sn__i, 1LL)));
+                            sn_auto_str char *__is_p6__ = sn_strdup(", got ");
+                            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__picked->__sn__value));
+                            sn_str_concat_multi(8, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__);
+                        }); sn_assert((__sn__picked->__sn__value == sn_add_long(__sn__i, 1LL)), __assert_msg__); free(__assert_msg__); (void)0; });
+                    
+                    ({ char *__assert_msg__ = ({
+                            sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__iter));
+                            sn_auto_str char *__is_p2__ = sn_strdup(" i ");
+                            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                            sn_auto_str char *__is_p4__ = sn_strdup(": tag length wrong (likely UAF)");
+                            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                        }); sn_assert((sn_str_length(__sn__picked->__sn__tag) == 1LL), __assert_msg__); free(__assert_msg__); (void)0; });
+                    
+                }
+            }
+        }
+    }
+    sn_print("PASS\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,83 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Inner * __sn__make(long long __sn__base) {
+
+    return ({
+        __sn__Inner *__tmp__ = __sn__Inner__new();
+        __tmp__->__sn__value = __sn__base;
+        __tmp__;
+    });}
+
+
+__sn__Inner * __sn__Inner_multiply(__sn__Inner *__sn__self, long long __sn__factor) {
+
+    return ({
+        __sn__Inner *__tmp__ = __sn__Inner__new();
+        __tmp__->__sn__value = sn_mul_long(__sn__self->__sn__value, __sn__factor);
+        __tmp__;
+    });}
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__outers = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Outer *), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Outer_release_elem;
+            __al__->elem_copy = __sn__Outer_retain_into;
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            sn_auto_Inner __sn__Inner * __sn____chain_tmp_0 = __sn__make(__sn__i);
+            sn_auto_Outer __sn__Outer * __sn__o = ({
+                __sn__Outer *__tmp__ = __sn__Outer__new();
+                __tmp__->__sn__inner = __sn__Inner_multiply(__sn____chain_tmp_0, 10LL);
+                __tmp__->__sn__label = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("outer-");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                });
+                __tmp__;
+            });
+            __sn__arr_push(&__sn__outers, ({ __sn__Outer * __mv__ = __sn__o; __sn__o = NULL; __mv__; }));
+            
+        }
+    }
+    {
+        for (long long __sn__iter = 0LL; sn_lt_long(__sn__iter, 10LL); __sn__iter++) {
+            {
+                for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__outers)); __sn__i++) {
+                    sn_auto_Outer __sn__Outer * __sn__outer = __sn__Outer_retain((((__sn__Outer * *)__sn__outers->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__outers->len : __ai__; })]));
+                    ({ char *__assert_msg__ = ({
+                            sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__iter));
+                            sn_auto_str char *__is_p2__ = sn_strdup(" i ");
+                            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                            sn_auto_str char *__is_p4__ = sn_strdup(": expected ");
+                            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(sn_mul_long(__sn__i, 10LL)));
+                            sn_auto_str char *__is_p6__ = sn_strdup(", got ");
+                            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__outer->__sn__inner->__sn__value));
+                            sn_str_concat_multi(8, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__);
+                        }); sn_assert((__sn__outer->__sn__inner->__sn__value == sn_mul_long(__sn__i, 10LL)), __assert_msg__); free(__assert_msg__); (void)0; });
+                    
+                    ({ char *__assert_msg__ = ({
+                            sn_auto_str char *__is_p0__ = sn_strdup("iter ");
+                            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__iter));
+                            sn_auto_str char *__is_p2__ = sn_strdup(" i ");
+                            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                            sn_auto_str char *__is_p4__ = sn_strdup(": label empty (likely UAF)");
+                            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                        }); sn_assert(sn_gt_long(sn_str_length(__sn__outer->__sn__label), 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+                    
+                }
+            }
+        }
+    }
+    sn_print("PASS\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,129 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Inner (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__value;
+} __sn__Inner;
+
+
+static inline __sn__Inner *__sn__Inner__new(void) {
+    __sn__Inner *p = calloc(1, sizeof(__sn__Inner));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Inner *__sn__Inner_retain(__sn__Inner *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Inner_release(__sn__Inner **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Inner *__sn__Inner_copy(const __sn__Inner *src) {
+    __sn__Inner *dst = calloc(1, sizeof(__sn__Inner));
+    dst->__rc__ = 1;
+    dst->__sn__value = src->__sn__value;
+    return dst;
+}
+
+#define sn_auto_Inner __attribute__((cleanup(__sn__Inner_release)))
+#define sn_auto_ref_Inner __attribute__((cleanup(__sn__Inner_release)))
+
+static inline void __sn__Inner_release_elem(void *p) { __sn__Inner_release((__sn__Inner **)p); }
+static inline void __sn__Inner_retain_into(const void *src, void *dst) { *(__sn__Inner **)dst = __sn__Inner_retain(*(__sn__Inner *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Inner_to_string(const __sn__Inner *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Inner { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+/* Struct: Outer (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    __sn__Inner * __sn__inner;
+    char * __sn__label;
+} __sn__Outer;
+
+
+static inline __sn__Outer *__sn__Outer__new(void) {
+    __sn__Outer *p = calloc(1, sizeof(__sn__Outer));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Outer *__sn__Outer_retain(__sn__Outer *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Outer_release(__sn__Outer **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        __sn__Inner_release(&(*p)->__sn__inner);
+        free((*p)->__sn__label);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Outer *__sn__Outer_copy(const __sn__Outer *src) {
+    __sn__Outer *dst = calloc(1, sizeof(__sn__Outer));
+    dst->__rc__ = 1;
+    dst->__sn__inner = __sn__Inner_retain(src->__sn__inner);
+    dst->__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    return dst;
+}
+
+#define sn_auto_Outer __attribute__((cleanup(__sn__Outer_release)))
+#define sn_auto_ref_Outer __attribute__((cleanup(__sn__Outer_release)))
+
+static inline void __sn__Outer_release_elem(void *p) { __sn__Outer_release((__sn__Outer **)p); }
+static inline void __sn__Outer_retain_into(const void *src, void *dst) { *(__sn__Outer **)dst = __sn__Outer_retain(*(__sn__Outer *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Outer_to_string(const __sn__Outer *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Outer { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "inner: ");
+    { char *__fs__ = __sn__Inner_to_string(p->__sn__inner); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+__sn__Inner * __sn__make(long long);
+
+__sn__Inner * __sn__Inner_multiply(__sn__Inner *, long long);
+
+
+
+#endif
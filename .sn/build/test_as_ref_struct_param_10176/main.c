@@ -0,0 +1,162 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__increment(__sn__Counter *__sn__c) {
+
+    ((*__sn__c).__sn__count = sn_add_long((*__sn__c).__sn__count, 1LL));
+    
+}
+
+
+void __sn__resetCounter(__sn__Counter *__sn__c) {
+
+    ((*__sn__c).__sn__count = 0LL);
+    
+}
+
+
+void __sn__addAmount(__sn__Counter *__sn__c, long long __sn__amount) {
+
+    ((*__sn__c).__sn__count = sn_add_long((*__sn__c).__sn__count, __sn__amount));
+    
+}
+
+
+void __sn__scale(__sn__Point *__sn__p, long long __sn__factor) {
+
+    ((*__sn__p).__sn__x = sn_mul_long((*__sn__p).__sn__x, __sn__factor));
+    
+
+    ((*__sn__p).__sn__y = sn_mul_long((*__sn__p).__sn__y, __sn__factor));
+    
+}
+
+
+void __sn__translate(__sn__Point *__sn__p, long long __sn__dx, long long __sn__dy) {
+
+    ((*__sn__p).__sn__x = sn_add_long((*__sn__p).__sn__x, __sn__dx));
+    
+
+    ((*__sn__p).__sn__y = sn_add_long((*__sn__p).__sn__y, __sn__dy));
+    
+}
+
+
+char * __sn__readName(__sn__Counter *__sn__c) {
+
+    return strdup((*__sn__c).__sn__name);}
+
+
+
+int main() {
+    sn_auto_Counter __sn__Counter __sn__c = (__sn__Counter){ .__sn__count = 0LL, .__sn__name = strdup("test") };
+    __sn__increment(&__sn__c);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 1: after increment: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((__sn__c.__sn__count == 1LL), "count should be 1 after increment");
+    
+    __sn__increment(&__sn__c);
+    
+    __sn__increment(&__sn__c);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 1: after 2 more increments: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((__sn__c.__sn__count == 3LL), "count should be 3");
+    
+    __sn__addAmount(&__sn__c, 10LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 2: after addAmount(10): ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((__sn__c.__sn__count == 13LL), "count should be 13");
+    
+    __sn__resetCounter(&__sn__c);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 3: after reset: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((__sn__c.__sn__count == 0LL), "count should be 0 after reset");
+    
+    sn_auto_str char * __sn__name = __sn__readName(&__sn__c);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 4: name = ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((strcmp(__sn__name, "test") == 0), "name should be test");
+    
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 2LL, .__sn__y = 3LL };
+    __sn__scale(&__sn__p, 4LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 5: after scale(4): (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((__sn__p.__sn__x == 8LL), "p.x should be 8");
+    
+    sn_assert((__sn__p.__sn__y == 12LL), "p.y should be 12");
+    
+    __sn__translate(&__sn__p, 1LL, 2LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 6: after translate(1,2): (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((__sn__p.__sn__x == 9LL), "p.x should be 9");
+    
+    sn_assert((__sn__p.__sn__y == 14LL), "p.y should be 14");
+    
+    sn_auto_Counter __sn__Counter __sn__c2 = (__sn__Counter){ .__sn__count = 5LL, .__sn__name = strdup("nested") };
+    __sn__increment(&__sn__c2);
+    
+    __sn__addAmount(&__sn__c2, 3LL);
+    
+    __sn__resetCounter(&__sn__c2);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 7: after increment+addAmount+reset: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c2.__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((__sn__c2.__sn__count == 0LL), "c2.count should be 0");
+    
+    sn_print("\nAll as-ref-struct-param tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__original = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__copy = sn_array_copy(__sn__original);
+    __sn__arr_push(&__sn__original, 4LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Original length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__original)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Copy length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__copy)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Original[0]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__original->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__original->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Copy[0]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__copy->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_println("Testing assert");
+    
+    sn_assert(true, "This should not fail");
+    
+    sn_println("First assert passed");
+    
+    sn_assert((sn_add_long(1LL, 1LL) == 2LL), "Math works");
+    
+    sn_println("Second assert passed");
+    
+    sn_assert(false, "Assertion failed: expected condition to be true");
+    
+    sn_println("This should not be printed");
+    
+    fflush(stdout);
+    return 0;
+}
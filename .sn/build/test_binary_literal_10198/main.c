@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = 10LL;
+    long long __sn__b = 255LL;
+    long long __sn__c = 0LL;
+    long long __sn__d = 256LL;
+    printf("%lld\n", (long long)(__sn__a));
+    
+    printf("%lld\n", (long long)(__sn__b));
+    
+    printf("%lld\n", (long long)(__sn__c));
+    
+    printf("%lld\n", (long long)(__sn__d));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_bits __sn__bits * __sn__b = ({
+        __sn__bits *__tmp__ = __sn__bits__new();
+        __tmp__;
+    });
+    printf("%lld\n", (long long)(__sn__bits_length(__sn__b)));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__bits_to_string(__sn__b);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    __sn__bits_resize(__sn__b, 70LL);
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__b)));
+    
+    __sn__bits_set(__sn__b, 0LL, true);
+    
+    __sn__bits_set(__sn__b, 63LL, true);
+    
+    __sn__bits_set(__sn__b, 64LL, true);
+    
+    __sn__bits_set(__sn__b, (-1LL), true);
+    
+    printf("%s\n", (__sn__bits_get(__sn__b, 63LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__bits_get(__sn__b, 62LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__bits_get(__sn__b, 69LL)) ? "true" : "false");
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__b)));
+    
+    __sn__bits_set(__sn__b, 63LL, false);
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__b)));
+    
+    __sn__bits_fill(__sn__b, true);
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__b)));
+    
+    __sn__bits_resize(__sn__b, 65LL);
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__b)));
+    
+    __sn__bits_resize(__sn__b, 130LL);
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__b)));
+    
+    printf("%s\n", (__sn__bits_get(__sn__b, 100LL)) ? "true" : "false");
+    
+    __sn__bits_fill(__sn__b, false);
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__b)));
+    
+    sn_auto_bits __sn__bits * __sn__small = ({
+        __sn__bits *__tmp__ = __sn__bits__new();
+        __tmp__;
+    });
+    sn_auto_arr SnArray * __sn__flags = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 3);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        });
+    {
+        SnArray *__arr_0__ = __sn__flags;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            bool __sn__f = ((bool *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__bits_push(__sn__small, __sn__f);
+                
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__bits_to_string(__sn__small);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_array_to_string(__sn__flags);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__arr = __sn__bits_toArray(__sn__small);
+    printf("%lld\n", (long long)(sn_array_length(__sn__arr)));
+    
+    printf("%s\n", ((((bool *)__sn__arr->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])) ? "true" : "false");
+    
+    long long __sn__trues = 0LL;
+    {
+        sn_auto_BitsIter __sn__BitsIter __sn_iter__ = __sn__bits_iter(__sn__small);
+        while (__sn__BitsIter_hasNext(&__sn_iter__)) {
+            bool __sn__x = __sn__BitsIter_next(&__sn_iter__);
+            {
+                if (__sn__x) {
+                    (__sn__trues = sn_add_long(__sn__trues, 1LL));
+                    
+                }
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__trues));
+    
+    sn_auto_bits __sn__bits * __sn__c = __sn__bits_clone(__sn__small);
+    __sn__bits_set(__sn__c, 1LL, true);
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__small)));
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__c)));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,18 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_bits __sn__bits * __sn__b = ({
+        __sn__bits *__tmp__ = __sn__bits__new();
+        __tmp__;
+    });
+    __sn__bits_resize(__sn__b, 8LL);
+    
+    printf("%s\n", (__sn__bits_get(__sn__b, 7LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__bits_get(__sn__b, 8LL)) ? "true" : "false");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__sieve(long long __sn__n) {
+
+    sn_auto_bits __sn__bits * __sn__is_prime = ({
+        __sn__bits *__tmp__ = __sn__bits__new();
+        __tmp__;
+    });
+
+    __sn__bits_resize(__sn__is_prime, sn_add_long(__sn__n, 1LL));
+    
+
+    __sn__bits_fill(__sn__is_prime, true);
+    
+
+    __sn__bits_set(__sn__is_prime, 0LL, false);
+    
+
+    __sn__bits_set(__sn__is_prime, 1LL, false);
+    
+
+    long long __sn__p = 2LL;
+
+    while ((sn_mul_long(__sn__p, __sn__p) <= __sn__n)) {
+        if (__sn__bits_get(__sn__is_prime, __sn__p)) {
+            long long __sn__mult = sn_mul_long(__sn__p, __sn__p);
+            while ((__sn__mult <= __sn__n)) {
+                __sn__bits_set(__sn__is_prime, __sn__mult, false);
+                
+                (__sn__mult = sn_add_long(__sn__mult, __sn__p));
+                
+            }
+        }
+        __sn__p++;
+        
+    }
+
+    return __sn__bits_count(__sn__is_prime);}
+
+int main() {
+    printf("%lld\n", (long long)(__sn__sieve(100LL)));
+    
+    printf("%lld\n", (long long)(__sn__sieve(1000000LL)));
+    
+    sn_auto_bits __sn__bits * __sn__a = ({
+        __sn__bits *__tmp__ = __sn__bits__new();
+        __tmp__;
+    });
+    sn_auto_bits __sn__bits * __sn__b = ({
+        __sn__bits *__tmp__ = __sn__bits__new();
+        __tmp__;
+    });
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 200LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__bits_push(__sn__a, (sn_mod_long(__sn__i, 2LL) == 0LL));
+                
+            }
+        }
+    }
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 100LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__bits_push(__sn__b, (sn_mod_long(__sn__i, 3LL) == 0LL));
+                
+            }
+        }
+    }
+    sn_auto_bits __sn__bits * __sn__x = ({
+        __sn__bits *__bi_snap_0__ = __sn__b;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__bits *__bi_result__ = __sn__bits_and(__sn__a, __sn__b);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__bits_retain(__bi_result__);
+        __bi_result__;
+    });
+    sn_auto_bits __sn__bits * __sn__o = ({
+        __sn__bits *__bi_snap_0__ = __sn__b;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__bits *__bi_result__ = __sn__bits_or(__sn__a, __sn__b);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__bits_retain(__bi_result__);
+        __bi_result__;
+    });
+    sn_auto_bits __sn__bits * __sn__e = ({
+        __sn__bits *__bi_snap_0__ = __sn__b;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__bits *__bi_result__ = __sn__bits_xor(__sn__a, __sn__b);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__bits_retain(__bi_result__);
+        __bi_result__;
+    });
+    printf("%lld\n", (long long)(__sn__bits_length(__sn__x)));
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__x)));
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__o)));
+    
+    printf("%lld\n", (long long)(__sn__bits_count(__sn__e)));
+    
+    sn_auto_bits __sn__bits * __sn____chain_tmp_0 = ({
+        __sn__bits *__bi_snap_0__ = __sn__a;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__bits *__bi_result__ = __sn__bits_and(__sn__b, __sn__a);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__bits_retain(__bi_result__);
+        __bi_result__;
+    });
+    printf("%lld\n", (long long)(__sn__bits_count(__sn____chain_tmp_0)));
+    
+    printf("%s\n", (__sn__bits_get(__sn__o, 150LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__bits_get(__sn__x, 150LL)) ? "true" : "false");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,174 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Bits: bits (built-in packed bool sequence, refcounted — see sn_bits.h) */
+typedef SnBits __sn__bits;
+
+static inline __sn__bits *__sn__bits__new(void) {
+    return sn_bits_new(0);
+}
+
+static inline __sn__bits *__sn__bits_retain(__sn__bits *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__bits_release(__sn__bits **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_bits_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__bits *__sn__bits_copy(const __sn__bits *src) {
+    return sn_bits_clone(src);
+}
+
+#define sn_auto_bits __attribute__((cleanup(__sn__bits_release)))
+#define sn_auto_ref_bits __attribute__((cleanup(__sn__bits_release)))
+
+static inline void __sn__bits_release_elem(void *p) { __sn__bits_release((__sn__bits **)p); }
+static inline void __sn__bits_retain_into(const void *src, void *dst) { *(__sn__bits **)dst = __sn__bits_retain(*(__sn__bits *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__bits_to_string(const __sn__bits *p) {
+    return sn_bits_to_string(p);
+}
+
+/* Methods */
+static inline void __sn__bits_resize(__sn__bits *b, long long length) {
+    sn_bits_resize(b, length);
+}
+
+static inline bool __sn__bits_get(__sn__bits *b, long long index) {
+    return sn_bits_get(b, index);
+}
+
+static inline void __sn__bits_set(__sn__bits *b, long long index, bool value) {
+    sn_bits_set(b, index, value);
+}
+
+static inline void __sn__bits_push(__sn__bits *b, bool value) {
+    sn_bits_push(b, value);
+}
+
+static inline long long __sn__bits_length(__sn__bits *b) {
+    return b->len;
+}
+
+static inline long long __sn__bits_count(__sn__bits *b) {
+    return sn_bits_count(b);
+}
+
+static inline void __sn__bits_fill(__sn__bits *b, bool value) {
+    sn_bits_fill(b, value);
+}
+
+static inline __sn__bits *__sn__bits_and(__sn__bits *b, __sn__bits *other) {
+    return sn_bits_and(b, other);
+}
+
+static inline __sn__bits *__sn__bits_or(__sn__bits *b, __sn__bits *other) {
+    return sn_bits_or(b, other);
+}
+
+static inline __sn__bits *__sn__bits_xor(__sn__bits *b, __sn__bits *other) {
+    return sn_bits_xor(b, other);
+}
+
+static inline SnArray *__sn__bits_toArray(__sn__bits *b) {
+    return sn_bits_to_array(b);
+}
+
+static inline __sn__bits *__sn__bits_clone(__sn__bits *b) {
+    return sn_bits_clone(b);
+}
+/* Struct: BitsIter (as val) */
+typedef struct {
+    __sn__bits * __sn___bits;
+    long long __sn___pos;
+} __sn__BitsIter;
+/* Value operations */
+static inline __sn__BitsIter __sn__BitsIter_copy(const __sn__BitsIter *src) {
+    __sn__BitsIter dst;
+    dst.__sn___bits = __sn__bits_retain(src->__sn___bits);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__BitsIter_cleanup(__sn__BitsIter *p) {
+    __sn__bits_release(&p->__sn___bits);
+
+}
+
+#define sn_auto_BitsIter __attribute__((cleanup(__sn__BitsIter_cleanup)))
+
+static inline void __sn__BitsIter_cleanup_elem(void *p) { __sn__BitsIter_cleanup((__sn__BitsIter *)p); }
+static inline void __sn__BitsIter_copy_into(const void *src, void *dst) { *(__sn__BitsIter *)dst = __sn__BitsIter_copy((const __sn__BitsIter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__BitsIter *__sn__BitsIter_alloc(void) {
+    return calloc(1, sizeof(__sn__BitsIter));
+}
+
+static inline void __sn__BitsIter_release(__sn__BitsIter **p) {
+    if (*p) {
+        __sn__bits_release(&(*p)->__sn___bits);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_BitsIter __attribute__((cleanup(__sn__BitsIter_release)))
+
+static inline void __sn__BitsIter_release_elem(void *p) { __sn__BitsIter_release((__sn__BitsIter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__BitsIter_to_string(const __sn__BitsIter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "BitsIter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_bits: ");
+    { char *__fs__ = __sn__bits_to_string(p->__sn___bits); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Bits iteration: bits → bool */
+static inline __sn__BitsIter __sn__bits_iter(__sn__bits *b) {
+    return (__sn__BitsIter){ .__sn___bits = __sn__bits_retain(b), .__sn___pos = 0 };
+}
+
+static inline bool __sn__BitsIter_hasNext(__sn__BitsIter *it) {
+    return it->__sn___pos < it->__sn___bits->len;
+}
+
+static inline bool __sn__BitsIter_next(__sn__BitsIter *it) {
+    return sn_bits_get(it->__sn___bits, it->__sn___pos++);
+}
+
+long long __sn__sieve(long long);
+
+
+
+
+#endif
@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = 255LL;
+    long long __sn__b = 15LL;
+    printf("%lld\n", (long long)((__sn__a & __sn__b)));
+    
+    printf("%lld\n", (long long)((171LL & 240LL)));
+    
+    printf("%lld\n", (long long)((7LL & 3LL)));
+    
+    fflush(stdout);
+    return 0;
+}
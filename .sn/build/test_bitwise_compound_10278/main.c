@@ -0,0 +1,29 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 255LL;
+    __sn__x = __sn__x & 15LL;
+    
+    printf("%lld\n", (long long)(__sn__x));
+    
+    __sn__x = __sn__x | 240LL;
+    
+    printf("%lld\n", (long long)(__sn__x));
+    
+    __sn__x = __sn__x ^ 170LL;
+    
+    printf("%lld\n", (long long)(__sn__x));
+    
+    __sn__x = __sn__x << 2LL;
+    
+    printf("%lld\n", (long long)(__sn__x));
+    
+    __sn__x = __sn__x >> 1LL;
+    
+    printf("%lld\n", (long long)(__sn__x));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    printf("%lld\n", (long long)((~0LL)));
+    
+    printf("%lld\n", (long long)((~1LL)));
+    
+    printf("%lld\n", (long long)((~(-1LL))));
+    
+    long long __sn__x = 255LL;
+    printf("%lld\n", (long long)(((~__sn__x) & 255LL)));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = 15LL;
+    long long __sn__b = 240LL;
+    printf("%lld\n", (long long)((__sn__a | __sn__b)));
+    
+    printf("%lld\n", (long long)((1LL | 2LL)));
+    
+    printf("%lld\n", (long long)((0LL | 0LL)));
+    
+    fflush(stdout);
+    return 0;
+}
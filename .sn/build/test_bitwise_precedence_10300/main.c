@@ -0,0 +1,19 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    printf("%lld\n", (long long)(((255LL & 15LL) | 240LL)));
+    
+    printf("%lld\n", (long long)(((15LL & 255LL) ^ 15LL)));
+    
+    printf("%lld\n", (long long)(((1LL << 4LL) & 255LL)));
+    
+    printf("%lld\n", (long long)((1LL << (3LL & 7LL))));
+    
+    bool __sn__ok = ((255LL & 15LL) == 15LL);
+    printf("%s\n", (__sn__ok) ? "true" : "false");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,19 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    printf("%lld\n", (long long)((1LL << 4LL)));
+    
+    printf("%lld\n", (long long)((256LL >> 4LL)));
+    
+    printf("%lld\n", (long long)((1LL << 0LL)));
+    
+    long long __sn__x = (1LL << 32LL);
+    printf("%lld\n", (long long)(__sn__x));
+    
+    printf("%lld\n", (long long)((__sn__x >> 16LL)));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,14 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    printf("%lld\n", (long long)((170LL ^ 85LL)));
+    
+    printf("%lld\n", (long long)((255LL ^ 255LL)));
+    
+    printf("%lld\n", (long long)((5LL ^ 3LL)));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = 5LL;
+    long long __sn__b = 10LL;
+    if ((sn_gt_long(__sn__a, 0LL) && sn_gt_long(__sn__b, 0LL))) {
+        sn_print("Both positive\n");
+        
+    }
+    if ((sn_gt_long(__sn__a, 10LL) && sn_gt_long(__sn__b, 0LL))) {
+        sn_print("Should not print\n");
+        
+    } else {
+        sn_print("First condition failed\n");
+        
+    }
+    if ((sn_gt_long(__sn__a, 10LL) || sn_gt_long(__sn__b, 5LL))) {
+        sn_print("At least one true\n");
+        
+    }
+    if ((sn_gt_long(__sn__a, 10LL) || sn_gt_long(__sn__b, 20LL))) {
+        sn_print("Should not print\n");
+        
+    } else {
+        sn_print("Both conditions failed\n");
+        
+    }
+    if (((sn_gt_long(__sn__a, 0LL) && sn_gt_long(__sn__b, 0LL)) || sn_gt_long(__sn__a, 100LL))) {
+        sn_print("Complex condition passed\n");
+        
+    }
+    bool __sn__x = sn_gt_long(__sn__a, 3LL);
+    bool __sn__y = sn_lt_long(__sn__b, 20LL);
+    if ((__sn__x && __sn__y)) {
+        sn_print("x and y both true\n");
+        
+    }
+    if ((__sn__x || __sn__y)) {
+        sn_print("x or y true\n");
+        
+    }
+    if (((!__sn__x) || __sn__y)) {
+        sn_print("Not x or y\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("Testing break:\n");
+    
+    long long __sn__i = 0LL;
+    while (sn_lt_long(__sn__i, 10LL)) {
+        if ((__sn__i == 5LL)) {
+            break;
+        }
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                sn_str_concat_multi(2, __is_p0__, __is_p1__);
+            }); sn_print(__ps__); };
+        
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+    sn_print("\n");
+    
+    sn_print("Testing continue:\n");
+    
+    (__sn__i = 0LL);
+    
+    while (sn_lt_long(__sn__i, 10LL)) {
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+        if ((sn_mod_long(__sn__i, 2LL) == 0LL)) {
+            continue;
+        }
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                sn_str_concat_multi(2, __is_p0__, __is_p1__);
+            }); sn_print(__ps__); };
+        
+    }
+    sn_print("\n");
+    
+    sn_print("Testing break in for:\n");
+    
+    {
+        for (long long __sn__j = 0LL; sn_lt_long(__sn__j, 10LL); __sn__j++) {
+            if ((__sn__j == 3LL)) {
+                break;
+            }
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__j));
+                    sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                    sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+    sn_print("\n");
+    
+    sn_print("Testing continue in for-each:\n");
+    
+    sn_auto_arr SnArray * __sn__nums = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        });
+    {
+        SnArray *__arr_0__ = __sn__nums;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__n = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if ((__sn__n == 3LL)) {
+                    continue;
+                }
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__n));
+                        sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                        sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+    sn_print("\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,67 @@
+#include "sn_types.h"
+unsigned char * get_buffer_ptr();
+
+
+
+unsigned char * mock_get_buffer() {
+
+    return NULL;}
+
+long long get_buffer_length() {
+
+    return 5LL;}
+
+
+void __sn__test_pointer_slice_codegen() {
+
+    long long __sn__len = get_buffer_length();
+
+    sn_auto_arr SnArray * __sn__data = sn_array_from_ptr(mock_get_buffer(), 0LL, __sn__len);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Array created successfully with length parameter: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__len));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    long long __sn__arr_len = sn_array_length(__sn__data);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Array length property: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__arr_len));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_slice_patterns() {
+
+    long long __sn__len = 10LL;
+
+    sn_auto_arr SnArray * __sn__data1 = sn_array_from_ptr(mock_get_buffer(), 0LL, __sn__len);
+
+    sn_print("Pattern 1 (ptr[0..len] as val): OK\n");
+    
+
+    sn_auto_arr SnArray * __sn__data3 = sn_array_from_ptr(mock_get_buffer(), 0LL, get_buffer_length());
+
+    sn_print("Pattern 3 (fn()[0..fn2()] as val): OK\n");
+    
+}
+
+int main() {
+    sn_print("Testing buffer unwrap code generation...\n");
+    
+    __sn__test_pointer_slice_codegen();
+    
+    __sn__test_slice_patterns();
+    
+    sn_print("Buffer unwrap code generation test complete!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+unsigned char * mock_get_buffer();
+long long get_buffer_length();
+void __sn__test_pointer_slice_codegen();
+void __sn__test_slice_patterns();
+
+
+
+
+#endif
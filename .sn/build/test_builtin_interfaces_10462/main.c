@@ -0,0 +1,138 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__acceptComparable(void * __sn__a) {
+
+    return;}
+
+
+void __sn__acceptHashable(void * __sn__x) {
+
+    return;}
+
+
+void __sn__acceptStringable(void * __sn__x) {
+
+    return;}
+
+
+void __sn__acceptCopyable(void * __sn__x) {
+
+    return;}
+
+
+long long __sn__Score_compare(__sn__Score *__sn__self, __sn__Score __sn__other) {
+
+    if (sn_lt_long(__sn__self->__sn__value, __sn__other.__sn__value)) {
+        return (-1LL);}
+
+    if (sn_gt_long(__sn__self->__sn__value, __sn__other.__sn__value)) {
+        return 1LL;}
+
+    return 0LL;}
+
+long long __sn__Score_hash(__sn__Score *__sn__self) {
+
+    return sn_mul_long(__sn__self->__sn__value, 31LL);}
+
+bool __sn__Score_equals(__sn__Score *__sn__self, __sn__Score __sn__other) {
+
+    return (__sn__self->__sn__value == __sn__other.__sn__value);}
+
+char * __sn__Score_toString(__sn__Score *__sn__self) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Score(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(")");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });}
+
+__sn__Score __sn__Score_copy(__sn__Score *__sn__self) {
+
+    return (__sn__Score){ .__sn__value = __sn__self->__sn__value };}
+
+int main() {
+    __sn__Score __sn__s1 = (__sn__Score){ .__sn__value = 10LL };
+    __sn__Score __sn__s2 = (__sn__Score){ .__sn__value = 20LL };
+    __sn__Score __sn__s3 = (__sn__Score){ .__sn__value = 10LL };
+    long long __sn__cmp1 = __sn__Score_compare(&__sn__s1, __sn__s2);
+    if ((__sn__cmp1 != (-1LL))) {
+        sn_print("FAIL: s1.compare(s2) should be -1\n");
+        
+        return 1LL;}
+    long long __sn__cmp2 = __sn__Score_compare(&__sn__s2, __sn__s1);
+    if ((__sn__cmp2 != 1LL)) {
+        sn_print("FAIL: s2.compare(s1) should be 1\n");
+        
+        return 1LL;}
+    long long __sn__cmp3 = __sn__Score_compare(&__sn__s1, __sn__s3);
+    if ((__sn__cmp3 != 0LL)) {
+        sn_print("FAIL: s1.compare(s3) should be 0\n");
+        
+        return 1LL;}
+    __sn__acceptComparable(&__sn__s1);
+    
+    sn_print("Test 1 passed: Comparable\n");
+    
+    long long __sn__h1 = __sn__Score_hash(&__sn__s1);
+    if ((__sn__h1 != 310LL)) {
+        sn_print("FAIL: s1.hash() should be 310\n");
+        
+        return 1LL;}
+    long long __sn__h2 = __sn__Score_hash(&__sn__s2);
+    if ((__sn__h2 != 620LL)) {
+        sn_print("FAIL: s2.hash() should be 620\n");
+        
+        return 1LL;}
+    __sn__acceptHashable(&__sn__s1);
+    
+    sn_print("Test 2 passed: Hashable hash()\n");
+    
+    bool __sn__eq1 = __sn__Score_equals(&__sn__s1, __sn__s3);
+    if ((!__sn__eq1)) {
+        sn_print("FAIL: s1.equals(s3) should be true\n");
+        
+        return 1LL;}
+    bool __sn__eq2 = __sn__Score_equals(&__sn__s1, __sn__s2);
+    if (__sn__eq2) {
+        sn_print("FAIL: s1.equals(s2) should be false\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: Hashable equals()\n");
+    
+    sn_auto_str char * __sn__str1 = __sn__Score_toString(&__sn__s1);
+    if ((strcmp(__sn__str1, "Score(10)") != 0)) {
+        sn_print("FAIL: s1.toString() should be Score(10)\n");
+        
+        return 1LL;}
+    sn_auto_str char * __sn__str2 = __sn__Score_toString(&__sn__s2);
+    if ((strcmp(__sn__str2, "Score(20)") != 0)) {
+        sn_print("FAIL: s2.toString() should be Score(20)\n");
+        
+        return 1LL;}
+    __sn__acceptStringable(&__sn__s1);
+    
+    sn_print("Test 4 passed: Stringable\n");
+    
+    __sn__Score __sn__copied = __sn__Score_copy(&__sn__s1);
+    if ((__sn__copied.__sn__value != 10LL)) {
+        sn_print("FAIL: copied.value should be 10\n");
+        
+        return 1LL;}
+    __sn__Score __sn__s1b = (__sn__Score){ .__sn__value = 99LL };
+    __sn__Score __sn__copiedB = __sn__Score_copy(&__sn__s1b);
+    if ((__sn__copiedB.__sn__value != 99LL)) {
+        sn_print("FAIL: copiedB.value should be 99\n");
+        
+        return 1LL;}
+    __sn__acceptCopyable(&__sn__s1);
+    
+    sn_print("Test 5 passed: Copyable\n");
+    
+    sn_print("All builtin interface tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
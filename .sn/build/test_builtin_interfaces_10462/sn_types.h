@@ -0,0 +1,75 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Score (as val) */
+typedef struct {
+    long long __sn__value;
+} __sn__Score;
+/* Value operations */
+
+static inline void __sn__Score_cleanup(__sn__Score *p) {
+
+}
+
+#define sn_auto_Score __attribute__((cleanup(__sn__Score_cleanup)))
+
+static inline void __sn__Score_cleanup_elem(void *p) { __sn__Score_cleanup((__sn__Score *)p); }
+
+/* Ref/pointer operations */
+static inline __sn__Score *__sn__Score_alloc(void) {
+    return calloc(1, sizeof(__sn__Score));
+}
+
+static inline void __sn__Score_release(__sn__Score **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Score __attribute__((cleanup(__sn__Score_release)))
+
+static inline void __sn__Score_release_elem(void *p) { __sn__Score_release((__sn__Score **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Score_to_string(const __sn__Score *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Score { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__acceptComparable(void *);
+void __sn__acceptHashable(void *);
+void __sn__acceptStringable(void *);
+void __sn__acceptCopyable(void *);
+
+long long __sn__Score_compare(__sn__Score *, __sn__Score);
+long long __sn__Score_hash(__sn__Score *);
+bool __sn__Score_equals(__sn__Score *, __sn__Score);
+char * __sn__Score_toString(__sn__Score *);
+__sn__Score __sn__Score_copy(__sn__Score *);
+
+
+
+#endif
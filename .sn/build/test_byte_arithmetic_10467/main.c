@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    unsigned char __sn__a = 100LL;
+    unsigned char __sn__b = 50LL;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%u", (unsigned)(sn_add_byte(__sn__a, __sn__b)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%u", (unsigned)(sn_sub_byte(__sn__a, __sn__b)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
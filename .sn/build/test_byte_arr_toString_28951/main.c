@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 5);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 72LL });
+            sn_array_push(__al__, &(unsigned char){ 101LL });
+            sn_array_push(__al__, &(unsigned char){ 108LL });
+            sn_array_push(__al__, &(unsigned char){ 108LL });
+            sn_array_push(__al__, &(unsigned char){ 111LL });
+            __al__;
+        });
+    sn_auto_str char * __sn__s = __sn__arr_toString(&__sn__b);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__s);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    unsigned char __sn__b1 = 255LL;
+    unsigned char __sn__b2 = 0LL;
+    unsigned char __sn__b3 = 128LL;
+    sn_print("Byte values: ");
+    
+    printf("0x%02X", (unsigned)(__sn__b1));
+    
+    sn_print(", ");
+    
+    printf("0x%02X", (unsigned)(__sn__b2));
+    
+    sn_print(", ");
+    
+    printf("0x%02X", (unsigned)(__sn__b3));
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__bytes = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 3);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 0LL });
+            sn_array_push(__al__, &(unsigned char){ 127LL });
+            sn_array_push(__al__, &(unsigned char){ 255LL });
+            __al__;
+        });
+    sn_print("Byte array: ");
+    
+    { char *__ps__ = sn_array_to_string(__sn__bytes); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_print("Length: ");
+    
+    printf("%lld", (long long)(sn_array_length(__sn__bytes)));
+    
+    sn_print("\n");
+    
+    __sn__arr_push(&__sn__bytes, 64LL);
+    
+    sn_print("After push(64): ");
+    
+    { char *__ps__ = sn_array_to_string(__sn__bytes); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_print("bytes[0]: ");
+    
+    printf("0x%02X", (unsigned)((((unsigned char *)__sn__bytes->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__bytes->len : __ai__; })])));
+    
+    sn_print("\n");
+    
+    sn_print("bytes[1]: ");
+    
+    printf("0x%02X", (unsigned)((((unsigned char *)__sn__bytes->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__bytes->len : __ai__; })])));
+    
+    sn_print("\n");
+    
+    unsigned char __sn__popped = *(unsigned char *)__sn___pop(&__sn__bytes);
+    sn_print("Popped: ");
+    
+    printf("0x%02X", (unsigned)(__sn__popped));
+    
+    sn_print("\n");
+    
+    sn_print("After pop: ");
+    
+    { char *__ps__ = sn_array_to_string(__sn__bytes); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    long long __sn__idx = __sn__arr_indexOf(&__sn__bytes, 127LL);
+    sn_print("indexOf(127): ");
+    
+    printf("%lld", (long long)(__sn__idx));
+    
+    sn_print("\n");
+    
+    if (__sn__arr_contains(&__sn__bytes, 127LL)) {
+        sn_print("Contains 127: true\n");
+        
+    } else {
+        sn_print("Contains 127: false\n");
+        
+    }
+    sn_auto_arr SnArray * __sn__cloned = __sn__arr_clone(&__sn__bytes);
+    sn_print("Cloned: ");
+    
+    { char *__ps__ = sn_array_to_string(__sn__cloned); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_print("Iteration: ");
+    
+    {
+        SnArray *__arr_0__ = __sn__bytes;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            unsigned char __sn__b = ((unsigned char *)__arr_0__->data)[__idx_0__];
+            {
+                printf("0x%02X", (unsigned)(__sn__b));
+                
+                sn_print(" ");
+                
+            }
+        }
+    }
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__hello = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 5);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 72LL });
+            sn_array_push(__al__, &(unsigned char){ 101LL });
+            sn_array_push(__al__, &(unsigned char){ 108LL });
+            sn_array_push(__al__, &(unsigned char){ 108LL });
+            sn_array_push(__al__, &(unsigned char){ 111LL });
+            __al__;
+        });
+    sn_auto_str char * __sn__hex = __sn__arr_toHex(&__sn__hello);
+    sn_print("Hex of Hello: ");
+    
+    sn_print(__sn__hex);
+    
+    sn_print("\n");
+    
+    sn_auto_str char * __sn__str_result = __sn__arr_toString(&__sn__hello);
+    sn_print("toString of Hello: ");
+    
+    sn_print(__sn__str_result);
+    
+    sn_print("\n");
+    
+    sn_auto_str char * __sn__b64 = __sn__arr_toBase64(&__sn__hello);
+    sn_print("Base64 of Hello: ");
+    
+    sn_print(__sn__b64);
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__man = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 3);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 77LL });
+            sn_array_push(__al__, &(unsigned char){ 97LL });
+            sn_array_push(__al__, &(unsigned char){ 110LL });
+            __al__;
+        });
+    sn_print("Base64 of Man: ");
+    
+    { sn_auto_str char *__ps__ = __sn__arr_toBase64(&__sn__man); sn_print(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__ma = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 2);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 77LL });
+            sn_array_push(__al__, &(unsigned char){ 97LL });
+            __al__;
+        });
+    sn_print("Base64 of Ma: ");
+    
+    { sn_auto_str char *__ps__ = __sn__arr_toBase64(&__sn__ma); sn_print(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__m = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 1);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 77LL });
+            __al__;
+        });
+    sn_print("Base64 of M: ");
+    
+    { sn_auto_str char *__ps__ = __sn__arr_toBase64(&__sn__m); sn_print(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__single = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 1);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 171LL });
+            __al__;
+        });
+    sn_print("Hex of 0xAB: ");
+    
+    { sn_auto_str char *__ps__ = __sn__arr_toHex(&__sn__single); sn_print(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__empty = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 0);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            __al__;
+        });
+    sn_print("Hex of empty: '");
+    
+    { sn_auto_str char *__ps__ = __sn__arr_toHex(&__sn__empty); sn_print(__ps__); };
+    
+    sn_print("'\n");
+    
+    sn_print("Base64 of empty: '");
+    
+    { sn_auto_str char *__ps__ = __sn__arr_toBase64(&__sn__empty); sn_print(__ps__); };
+    
+    sn_print("'\n");
+    
+    sn_auto_arr SnArray * __sn__latin1_bytes = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 4);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 99LL });
+            sn_array_push(__al__, &(unsigned char){ 97LL });
+            sn_array_push(__al__, &(unsigned char){ 102LL });
+            sn_array_push(__al__, &(unsigned char){ 233LL });
+            __al__;
+        });
+    sn_auto_str char * __sn__latin1_str = __sn__arr_toStringLatin1(&__sn__latin1_bytes);
+    sn_print("Latin1 string: ");
+    
+    sn_print(__sn__latin1_str);
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__png_header = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 4);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 137LL });
+            sn_array_push(__al__, &(unsigned char){ 80LL });
+            sn_array_push(__al__, &(unsigned char){ 78LL });
+            sn_array_push(__al__, &(unsigned char){ 71LL });
+            __al__;
+        });
+    sn_print("PNG header hex: ");
+    
+    { sn_auto_str char *__ps__ = __sn__arr_toHex(&__sn__png_header); sn_print(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_print("All byte encoding tests completed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
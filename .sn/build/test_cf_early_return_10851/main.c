@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__classify(long long __sn__n) {
+
+    if (sn_gt_long(__sn__n, 90LL)) {
+        return strdup("excellent");}
+
+    if (sn_gt_long(__sn__n, 40LL)) {
+        return strdup("ok");}
+
+    return strdup("poor");}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__classify(95LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__classify(42LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__classify((-5LL));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    {
+        for (long long __sn__i = 5LL; sn_gt_long(__sn__i, 0LL); __sn__i--) {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                    sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
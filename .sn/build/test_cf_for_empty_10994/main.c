@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 0LL); __sn__i++) {
+            sn_print("nope");
+            
+        }
+    }
+    sn_print("done\n");
+    
+    fflush(stdout);
+    return 0;
+}
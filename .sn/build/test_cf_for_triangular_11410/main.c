@@ -0,0 +1,25 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__sum = 0LL;
+    {
+        for (long long __sn__i = 1LL; (__sn__i <= 10LL); __sn__i++) {
+            __sn__sum = __sn__sum + __sn__i;
+            
+            if ((sn_mod_long(__sn__i, 5LL) == 0LL)) {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+                        sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                        sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
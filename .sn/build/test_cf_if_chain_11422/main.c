@@ -0,0 +1,31 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    {
+        for (long long __sn__i = 1LL; (__sn__i <= 5LL); __sn__i++) {
+            if ((__sn__i == 1LL)) {
+                sn_print("one ");
+                
+            } else {
+                if ((__sn__i == 2LL)) {
+                    sn_print("two ");
+                    
+                } else {
+                    if ((__sn__i == 3LL)) {
+                        sn_print("three ");
+                        
+                    } else {
+                        sn_print("other ");
+                        
+                    }
+                }
+            }
+        }
+    }
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
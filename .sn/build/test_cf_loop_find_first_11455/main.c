@@ -0,0 +1,35 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        });
+    long long __sn__first_even = (-1LL);
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__arr)); __sn__i++) {
+            if ((sn_mod_long((((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]), 2LL) == 0LL)) {
+                (__sn__first_even = (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]));
+                
+                break;
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__first_even));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,21 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__prod = 1LL;
+    {
+        for (long long __sn__i = 1LL; (__sn__i <= 6LL); __sn__i++) {
+            __sn__prod = __sn__prod * __sn__i;
+            
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__prod));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 10LL;
+    ({
+            bool __match_subject__ = sn_gt_long(__sn__x, 5LL);
+            if (__match_subject__ == true) {
+                sn_print("big\n");
+    
+    
+            } else if (__match_subject__ == false) {
+                sn_print("small\n");
+    
+    
+            }
+        });
+    
+    fflush(stdout);
+    return 0;
+}
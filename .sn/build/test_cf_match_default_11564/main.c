@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 99LL;
+    ({
+            long long __match_subject__ = __sn__x;
+            if (__match_subject__ == 1LL) {
+                sn_print("one\n");
+    
+    
+            } else if (__match_subject__ == 2LL) {
+                sn_print("two\n");
+    
+    
+            } else {
+                sn_print("other\n");
+    
+    
+            }
+        });
+    
+    fflush(stdout);
+    return 0;
+}
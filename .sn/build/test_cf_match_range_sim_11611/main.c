@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__score = 85LL;
+    if ((__sn__score >= 90LL)) {
+        sn_print("A\n");
+        
+    } else {
+        if ((__sn__score >= 80LL)) {
+            sn_print("B\n");
+            
+        } else {
+            if ((__sn__score >= 70LL)) {
+                sn_print("C\n");
+                
+            } else {
+                sn_print("F\n");
+                
+            }
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
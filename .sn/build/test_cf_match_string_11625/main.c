@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__day = strdup("Mon");
+    ({
+            char * __match_subject__ = __sn__day;
+            if (strcmp(__match_subject__, "Mon") == 0) {
+                sn_print("Monday\n");
+    
+    
+            } else if (strcmp(__match_subject__, "Tue") == 0) {
+                sn_print("Tuesday\n");
+    
+    
+            } else {
+                sn_print("Other\n");
+    
+    
+            }
+        });
+    
+    fflush(stdout);
+    return 0;
+}
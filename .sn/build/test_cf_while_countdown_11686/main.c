@@ -0,0 +1,19 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__n = 10LL;
+    while (sn_gt_long(__sn__n, 0LL)) {
+        __sn__n = __sn__n - 3LL;
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__n));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
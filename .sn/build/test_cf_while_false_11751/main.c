@@ -0,0 +1,14 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    while (false) {
+        sn_print("nope");
+        
+    }
+    sn_print("done\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    char __sn__c = (char)97;
+    sn_auto_str char * __sn__s = __sn__char_toString(&__sn__c);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("toString 'a': ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__s);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_0 = (char)120;
+    char __sn__upper = __sn__char_toUpper(&__sn____chain_tmp_0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("toUpper 'x': ");
+            sn_auto_str char *__is_p1__ = __sn__char_toString(&__sn__upper);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_1 = (char)90;
+    char __sn__lower = __sn__char_toLower(&__sn____chain_tmp_1);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("toLower 'Z': ");
+            sn_auto_str char *__is_p1__ = __sn__char_toString(&__sn__lower);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_2 = (char)65;
+    long long __sn__ascii = __sn__char_toInt(__sn____chain_tmp_2);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("toInt 'A': ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__ascii));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_3 = (char)53;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isDigit '5': ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__char_isDigit(&__sn____chain_tmp_3)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_4 = (char)97;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isDigit 'a': ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__char_isDigit(&__sn____chain_tmp_4)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_5 = (char)120;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isAlpha 'x': ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__char_isAlpha(&__sn____chain_tmp_5)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_6 = (char)57;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isAlpha '9': ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__char_isAlpha(&__sn____chain_tmp_6)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_7 = (char)32;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isWhitespace ' ': ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__char_isWhitespace(&__sn____chain_tmp_7)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_8 = (char)122;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isWhitespace 'z': ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__char_isWhitespace(&__sn____chain_tmp_8)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_9 = (char)65;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isAlnum 'A': ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__char_isAlnum(&__sn____chain_tmp_9)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_10 = (char)51;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isAlnum '3': ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__char_isAlnum(&__sn____chain_tmp_10)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_11 = (char)64;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isAlnum '@': ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__char_isAlnum(&__sn____chain_tmp_11)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char __sn____chain_tmp_12 = (char)97;
+    char __sn____chain_tmp_13 = __sn__char_toUpper(&__sn____chain_tmp_12);
+    sn_auto_str char * __sn__result = __sn__char_toString(&__sn____chain_tmp_13);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("'a'.toUpper().toString(): ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__result);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
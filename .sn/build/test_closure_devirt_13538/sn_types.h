@@ -0,0 +1,58 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+SnArray * __sn__map_ints(SnArray *, void *);
+SnArray * __sn__filter_ints(SnArray *, void *);
+long long __sn__fold(SnArray *, long long, void *);
+void __sn__sort_by(SnArray *, long long, long long, void *);
+SnArray * __sn__square_all(SnArray *, void *);
+long long __sn__triple(long long);
+void __sn__show(SnArray *);
+
+
+
+static long long __lambda_0__(void *__closure__, long long __sn__x);
+typedef struct __closure_1__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    long long k;
+} __closure_1__;
+static long long __lambda_1__(void *__closure__, long long __sn__x);
+static long long __lambda_2__(void *__closure__, long long __sn__x);
+typedef struct __closure_3__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    long long k;
+} __closure_3__;
+static long long __lambda_3__(void *__closure__, long long __sn__x);
+static bool __lambda_4__(void *__closure__, long long __sn__x);
+static long long __lambda_5__(void *__closure__, long long __sn__a, long long __sn__b);
+static long long __lambda_6__(void *__closure__, long long __sn__a, long long __sn__b);
+static bool __lambda_7__(void *__closure__, long long __sn__a, long long __sn__b);
+static bool __lambda_8__(void *__closure__, long long __sn__a, long long __sn__b);
+static long long __lambda_9__(void *__closure__, long long __sn__x);
+static long long __lambda_10__(void *__closure__, long long __sn__x);
+long long __fn_wrap_0__(void *__closure__, long long __p0__);
+extern __Closure__ __fn_closure_0__;
+
+#endif
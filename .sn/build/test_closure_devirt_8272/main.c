@@ -0,0 +1,347 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__map_ints(SnArray * __sn__arr, void * __sn__f) {
+
+    sn_auto_arr SnArray * __sn__out = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__v = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__arr_push(&__sn__out, ((long long (*)(void *, long long))((__Closure__ *)__sn__f)->fn)(__sn__f, __sn__v));
+                
+            }
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__out;
+        __sn__out = NULL;
+        return __ret__;
+    }}
+
+
+SnArray * __sn__filter_ints(SnArray * __sn__arr, void * __sn__keep) {
+
+    sn_auto_arr SnArray * __sn__out = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__v = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if (((bool (*)(void *, long long))((__Closure__ *)__sn__keep)->fn)(__sn__keep, __sn__v)) {
+                    __sn__arr_push(&__sn__out, __sn__v);
+                    
+                }
+            }
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__out;
+        __sn__out = NULL;
+        return __ret__;
+    }}
+
+
+long long __sn__fold(SnArray * __sn__arr, long long __sn__init, void * __sn__f) {
+
+    long long __sn__acc = __sn__init;
+
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__v = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                (__sn__acc = ((long long (*)(void *, long long, long long))((__Closure__ *)__sn__f)->fn)(__sn__f, __sn__acc, __sn__v));
+                
+            }
+        }
+    }
+
+    return __sn__acc;}
+
+
+void __sn__sort_by(SnArray * __sn__arr, long long __sn__lo, long long __sn__hi, void * __sn__less) {
+
+    if ((__sn__lo >= __sn__hi)) {
+        return;}
+
+    long long __sn__pivot = (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__hi; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+
+    long long __sn__i = __sn__lo;
+
+    {
+        for (long long __sn__j = __sn__lo; sn_lt_long(__sn__j, __sn__hi); __sn__j = __sn__j + 1LL) {
+            if (((bool (*)(void *, long long, long long))((__Closure__ *)__sn__less)->fn)(__sn__less, (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]), __sn__pivot)) {
+                long long __sn__t = (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+                ((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })] = (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+                
+                ((long long *)__sn__arr->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })] = __sn__t;
+                
+                __sn__i = __sn__i + 1LL;
+                
+            }
+        }
+    }
+
+    long long __sn__t2 = (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+
+    ((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })] = (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__hi; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+    
+
+    ((long long *)__sn__arr->data)[({ long long __ai__ = __sn__hi; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })] = __sn__t2;
+    
+
+    __sn__sort_by(__sn__arr, __sn__lo, sn_sub_long(__sn__i, 1LL), __sn__less);
+    
+
+    __sn__sort_by(__sn__arr, sn_add_long(__sn__i, 1LL), __sn__hi, __sn__less);
+    
+}
+
+
+SnArray * __sn__square_all(SnArray * __sn__arr, void * __sn__f) {
+
+    return __sn__map_ints(__sn__arr, __sn__f);}
+
+
+long long __sn__triple(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 3LL);}
+
+
+void __sn__show(SnArray * __sn__arr) {
+
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__v = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__v));
+                        sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                        sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+
+    sn_print("\n");
+    
+}
+
+long long __fn_wrap_0__(void *__closure__, long long __p0__) {
+    (void)__closure__;
+    return __sn__triple(__p0__);
+ }
+__Closure__ __fn_closure_0__ = { (void *)__fn_wrap_0__, sizeof(__Closure__), NULL, SN_CLOSURE_STATIC_RC };
+int main() {
+    long long __sn__k = 10LL;
+    sn_auto_fn void * __sn__sq = ({
+        __Closure__ *__cl__ = sn_sys_malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    sn_auto_fn void * __sn__addk = ({
+        __closure_1__ *__cl__ = sn_sys_malloc(sizeof(__closure_1__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__closure_1__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->k = __sn__k;
+        __cl__;
+    });
+    long long __sn__total = 0LL;
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 1000LL); __sn__i = __sn__i + 1LL) {
+            __sn__total = __sn__total + sn_add_long(((long long (*)(void *, long long))((__Closure__ *)__sn__sq)->fn)(__sn__sq, __sn__i), ((long long (*)(void *, long long))((__Closure__ *)__sn__addk)->fn)(__sn__addk, __sn__i));
+            
+        }
+    }
+    printf("%lld\n", (long long)(__sn__total));
+    
+    printf("%lld\n", (long long)(__sn__(6LL)));
+    
+    sn_auto_arr SnArray * __sn__nums = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 6);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 9LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn____chain_tmp_0 = __sn__map_ints(__sn__nums, __sn__sq);
+    __sn__show(__sn____chain_tmp_0);
+    
+    sn_auto_arr SnArray * __sn____chain_tmp_1 = __sn__map_ints(__sn__nums, __sn__addk);
+    __sn__show(__sn____chain_tmp_1);
+    
+    sn_auto_arr SnArray * __sn____chain_tmp_2 = ({ sn_auto_fn void *__fn_tmp_1__ = (void *)&__fn_closure_0__; __sn__map_ints(__sn__nums, __fn_tmp_1__); });
+    __sn__show(__sn____chain_tmp_2);
+    
+    sn_auto_arr SnArray * __sn____chain_tmp_3 = ({ sn_auto_fn void *__fn_tmp_1__ = ({
+        __closure_3__ *__cl__ = sn_sys_malloc(sizeof(__closure_3__));
+        __cl__->fn = (void *)__lambda_3__;
+        __cl__->size = sizeof(__closure_3__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->k = __sn__k;
+        __cl__;
+    }); __sn__square_all(__sn__nums, __fn_tmp_1__); });
+    __sn__show(__sn____chain_tmp_3);
+    
+    sn_auto_arr SnArray * __sn____chain_tmp_4 = ({ sn_auto_fn void *__fn_tmp_1__ = ({
+        __Closure__ *__cl__ = sn_sys_malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_4__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__filter_ints(__sn__nums, __fn_tmp_1__); });
+    __sn__show(__sn____chain_tmp_4);
+    
+    printf("%lld\n", (long long)(({ sn_auto_fn void *__fn_tmp_2__ = ({
+        __Closure__ *__cl__ = sn_sys_malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_5__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__fold(__sn__nums, 0LL, __fn_tmp_2__); })));
+    
+    printf("%lld\n", (long long)(({ sn_auto_fn void *__fn_tmp_2__ = ({
+        __Closure__ *__cl__ = sn_sys_malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_6__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__fold(__sn__nums, 1LL, __fn_tmp_2__); })));
+    
+    ({ sn_auto_fn void *__fn_tmp_3__ = ({
+        __Closure__ *__cl__ = sn_sys_malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_7__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__sort_by(__sn__nums, 0LL, sn_sub_long(sn_array_length(__sn__nums), 1LL), __fn_tmp_3__); });
+    
+    __sn__show(__sn__nums);
+    
+    ({ sn_auto_fn void *__fn_tmp_3__ = ({
+        __Closure__ *__cl__ = sn_sys_malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_8__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__sort_by(__sn__nums, 0LL, sn_sub_long(sn_array_length(__sn__nums), 1LL), __fn_tmp_3__); });
+    
+    __sn__show(__sn__nums);
+    
+    sn_auto_fn void * __sn__g = ({
+        __Closure__ *__cl__ = sn_sys_malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_9__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    printf("%lld\n", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__g)->fn)(__sn__g, 1LL)));
+    
+    ({
+        void *__old_cl__ = __sn__g;
+        __sn__g = ({
+        __Closure__ *__cl__ = sn_sys_malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_10__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+        sn_closure_release(&__old_cl__);
+        __sn__g;
+    });
+    
+    printf("%lld\n", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__g)->fn)(__sn__g, 1LL)));
+    
+    fflush(stdout);
+    return 0;
+}
+
+static long long __lambda_0__(void *__closure__, long long __sn__x) {
+    return sn_mul_long(__sn__x, __sn__x);
+}
+
+static long long __lambda_1__(void *__closure__, long long __sn__x) {
+
+    long long __sn__k = ((__closure_1__ *)__closure__)->k;
+    return sn_add_long(__sn__x, __sn__k);
+}
+
+static long long __lambda_2__(void *__closure__, long long __sn__x) {
+    return sn_mul_long(__sn__x, 7LL);
+}
+
+static long long __lambda_3__(void *__closure__, long long __sn__x) {
+
+    long long __sn__k = ((__closure_3__ *)__closure__)->k;
+    return sn_add_long(sn_mul_long(__sn__x, __sn__x), __sn__k);
+}
+
+static bool __lambda_4__(void *__closure__, long long __sn__x) {
+    return sn_gt_long(__sn__x, 4LL);
+}
+
+static long long __lambda_5__(void *__closure__, long long __sn__a, long long __sn__b) {
+    return sn_add_long(__sn__a, __sn__b);
+}
+
+static long long __lambda_6__(void *__closure__, long long __sn__a, long long __sn__b) {
+    return sn_mul_long(__sn__a, __sn__b);
+}
+
+static bool __lambda_7__(void *__closure__, long long __sn__a, long long __sn__b) {
+    return sn_lt_long(__sn__a, __sn__b);
+}
+
+static bool __lambda_8__(void *__closure__, long long __sn__a, long long __sn__b) {
+    return sn_gt_long(__sn__a, __sn__b);
+}
+
+static long long __lambda_9__(void *__closure__, long long __sn__x) {
+    return sn_add_long(__sn__x, 1LL);
+}
+
+static long long __lambda_10__(void *__closure__, long long __sn__x) {
+    return sn_add_long(__sn__x, 2LL);
+}
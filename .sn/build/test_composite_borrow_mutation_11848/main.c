@@ -0,0 +1,68 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__addIfNew(__sn__Window *__sn__window, long long __sn__value, long long __sn__time) {
+
+    if (__sn__Window_contains(&(*__sn__window), __sn__value)) {
+        return false;}
+
+    __sn__Window_add(&(*__sn__window), __sn__value, __sn__time);
+    
+
+    return true;}
+
+
+
+void __sn__Window_add(__sn__Window *__sn__self, long long __sn__value, long long __sn__time) {
+
+    __sn__arr_push(&__sn__self->__sn__entries, (__sn__Entry){ .__sn__value = __sn__value, .__sn__addedAt = __sn__time });
+    
+
+    (__sn__self->__sn__count = sn_add_long(__sn__self->__sn__count, 1LL));
+    
+}
+
+bool __sn__Window_contains(__sn__Window *__sn__self, long long __sn__value) {
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__self->__sn__entries)); __sn__i++) {
+            if (((((__sn__Entry *)__sn__self->__sn__entries->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__self->__sn__entries->len : __ai__; })]).__sn__value == __sn__value)) {
+                return true;}
+        }
+    }
+
+    return false;}
+
+int main() {
+    sn_auto_Window __sn__Window __sn__win = (__sn__Window){ .__sn__entries = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Entry), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__;
+        }), .__sn__maxSize = 100LL, .__sn__count = 0LL };
+    bool __sn__r1 = __sn__addIfNew(&__sn__win, 42LL, 1000LL);
+    sn_assert((__sn__r1 == true), "first add should succeed");
+    
+    sn_assert((__sn__win.__sn__count == 1LL), "count should be 1 after first add");
+    
+    sn_assert((sn_array_length(__sn__win.__sn__entries) == 1LL), "entries should have 1 element");
+    
+    bool __sn__r2 = __sn__addIfNew(&__sn__win, 42LL, 2000LL);
+    sn_assert((__sn__r2 == false), "duplicate add should be rejected");
+    
+    sn_assert((__sn__win.__sn__count == 1LL), "count should still be 1");
+    
+    bool __sn__r3 = __sn__addIfNew(&__sn__win, 99LL, 3000LL);
+    sn_assert((__sn__r3 == true), "new value add should succeed");
+    
+    sn_assert((__sn__win.__sn__count == 2LL), "count should be 2");
+    
+    sn_assert((sn_array_length(__sn__win.__sn__entries) == 2LL), "entries should have 2 elements");
+    
+    sn_println("test_composite_borrow_mutation: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,140 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Entry (as val) */
+typedef struct {
+    long long __sn__value;
+    long long __sn__addedAt;
+} __sn__Entry;
+/* Value operations */
+static inline __sn__Entry __sn__Entry_copy(const __sn__Entry *src) {
+    __sn__Entry dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__addedAt = src->__sn__addedAt;
+    return dst;
+}
+
+static inline void __sn__Entry_cleanup(__sn__Entry *p) {
+
+}
+
+#define sn_auto_Entry __attribute__((cleanup(__sn__Entry_cleanup)))
+
+static inline void __sn__Entry_cleanup_elem(void *p) { __sn__Entry_cleanup((__sn__Entry *)p); }
+static inline void __sn__Entry_copy_into(const void *src, void *dst) { *(__sn__Entry *)dst = __sn__Entry_copy((const __sn__Entry *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Entry *__sn__Entry_alloc(void) {
+    return calloc(1, sizeof(__sn__Entry));
+}
+
+static inline void __sn__Entry_release(__sn__Entry **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Entry __attribute__((cleanup(__sn__Entry_release)))
+
+static inline void __sn__Entry_release_elem(void *p) { __sn__Entry_release((__sn__Entry **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Entry_to_string(const __sn__Entry *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Entry { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "addedAt: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__addedAt);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Window (as val) */
+typedef struct {
+    SnArray * __sn__entries;
+    long long __sn__maxSize;
+    long long __sn__count;
+} __sn__Window;
+/* Value operations */
+static inline __sn__Window __sn__Window_copy(const __sn__Window *src) {
+    __sn__Window dst;
+    dst.__sn__entries = sn_array_copy(src->__sn__entries);
+    dst.__sn__maxSize = src->__sn__maxSize;
+    dst.__sn__count = src->__sn__count;
+    return dst;
+}
+
+static inline void __sn__Window_cleanup(__sn__Window *p) {
+    sn_cleanup_array(&p->__sn__entries);
+
+}
+
+#define sn_auto_Window __attribute__((cleanup(__sn__Window_cleanup)))
+
+static inline void __sn__Window_cleanup_elem(void *p) { __sn__Window_cleanup((__sn__Window *)p); }
+static inline void __sn__Window_copy_into(const void *src, void *dst) { *(__sn__Window *)dst = __sn__Window_copy((const __sn__Window *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Window *__sn__Window_alloc(void) {
+    return calloc(1, sizeof(__sn__Window));
+}
+
+static inline void __sn__Window_release(__sn__Window **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__entries);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Window __attribute__((cleanup(__sn__Window_release)))
+
+static inline void __sn__Window_release_elem(void *p) { __sn__Window_release((__sn__Window **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Window_to_string(const __sn__Window *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Window { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "entries: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__entries); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "maxSize: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__maxSize);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "count: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__count);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+bool __sn__addIfNew(__sn__Window *, long long, long long);
+
+void __sn__Window_add(__sn__Window *, long long, long long);
+bool __sn__Window_contains(__sn__Window *, long long);
+
+
+
+#endif
@@ -0,0 +1,96 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Item __sn__makeItem(char * __sn__id, char * __sn__label, double __sn__score) {
+
+    return (__sn__Item){ .__sn__id = strdup(__sn__id), .__sn__label = strdup(__sn__label), .__sn__score = __sn__score, .__sn__tags = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Tag), 1);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Tag_cleanup_elem;
+            __al__->elem_copy = __sn__Tag_copy_into;
+            sn_array_push(__al__, &((__sn__Tag){ .__sn__name = strdup("default"), .__sn__weight = 1.0 }));
+            __al__;
+        }) };}
+
+
+char * __sn__checkItem(__sn__Item *__sn__item, double __sn__minScore) {
+
+    if (((*__sn__item).__sn__score >= __sn__minScore)) {
+        return ({
+                sn_auto_str char *__is_p0__ = sn_strdup("PASS:");
+                sn_auto_str char *__is_p1__ = sn_strdup((*__sn__item).__sn__id);
+                sn_auto_str char *__is_p2__ = sn_strdup(":");
+                sn_auto_str char *__is_p3__ = sn_strdup((*__sn__item).__sn__label);
+                sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+            });}
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("FAIL:");
+            sn_auto_str char *__is_p1__ = sn_strdup((*__sn__item).__sn__id);
+            sn_auto_str char *__is_p2__ = sn_strdup(":");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)((*__sn__item).__sn__score));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        });}
+
+
+
+int main() {
+    sn_auto_str char * __sn__r1 = ({ sn_auto_Item __sn__Item __bt_0__ = __sn__makeItem("i1", "alpha", 0.90000000000000002); __sn__checkItem(&__bt_0__, 0.5); });
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("direct pass: expected PASS:i1:alpha, got ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__r1);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((strcmp(__sn__r1, "PASS:i1:alpha") == 0), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test1 direct pass: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__r1);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Item __sn__Item __sn__item = __sn__makeItem("i2", "beta", 0.29999999999999999);
+    sn_auto_str char * __sn__r2 = __sn__checkItem(&__sn__item, 0.5);
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("local var: expected FAIL:i2:0.30000, got ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__r2);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((strcmp(__sn__r2, "FAIL:i2:0.30000") == 0), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test2 local var: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__r2);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_str char * __sn__r3 = ({ sn_auto_Item __sn__Item __bt_0__ = __sn__makeItem("i3", "gamma", 0.69999999999999996); __sn__checkItem(&__bt_0__, 0.69999999999999996); });
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("direct pass 2: expected PASS:i3:gamma, got ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__r3);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((strcmp(__sn__r3, "PASS:i3:gamma") == 0), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test3 direct pass 2: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__r3);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Item __sn__Item __sn__temp = __sn__makeItem("i4", "delta", 0.80000000000000004);
+    sn_assert((sn_array_length(__sn__temp.__sn__tags) == 1LL), "tags should have 1 element");
+    
+    sn_assert((strcmp((((__sn__Tag *)__sn__temp.__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__temp.__sn__tags->len : __ai__; })]).__sn__name, "default") == 0), "tag name should be default");
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test4 tags: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((__sn__Tag *)__sn__temp.__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__temp.__sn__tags->len : __ai__; })]).__sn__name);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_println("test_composite_temp_arg: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,150 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Tag (as val) */
+typedef struct {
+    char * __sn__name;
+    double __sn__weight;
+} __sn__Tag;
+/* Value operations */
+static inline __sn__Tag __sn__Tag_copy(const __sn__Tag *src) {
+    __sn__Tag dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__weight = src->__sn__weight;
+    return dst;
+}
+
+static inline void __sn__Tag_cleanup(__sn__Tag *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Tag __attribute__((cleanup(__sn__Tag_cleanup)))
+
+static inline void __sn__Tag_cleanup_elem(void *p) { __sn__Tag_cleanup((__sn__Tag *)p); }
+static inline void __sn__Tag_copy_into(const void *src, void *dst) { *(__sn__Tag *)dst = __sn__Tag_copy((const __sn__Tag *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Tag *__sn__Tag_alloc(void) {
+    return calloc(1, sizeof(__sn__Tag));
+}
+
+static inline void __sn__Tag_release(__sn__Tag **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Tag __attribute__((cleanup(__sn__Tag_release)))
+
+static inline void __sn__Tag_release_elem(void *p) { __sn__Tag_release((__sn__Tag **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Tag_to_string(const __sn__Tag *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Tag { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "weight: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__weight);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Item (as val) */
+typedef struct {
+    char * __sn__id;
+    char * __sn__label;
+    double __sn__score;
+    SnArray * __sn__tags;
+} __sn__Item;
+/* Value operations */
+static inline __sn__Item __sn__Item_copy(const __sn__Item *src) {
+    __sn__Item dst;
+    dst.__sn__id = src->__sn__id ? strdup(src->__sn__id) : NULL;
+    dst.__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    dst.__sn__score = src->__sn__score;
+    dst.__sn__tags = sn_array_copy(src->__sn__tags);
+    return dst;
+}
+
+static inline void __sn__Item_cleanup(__sn__Item *p) {
+    free(p->__sn__id);
+    free(p->__sn__label);
+    sn_cleanup_array(&p->__sn__tags);
+
+}
+
+#define sn_auto_Item __attribute__((cleanup(__sn__Item_cleanup)))
+
+static inline void __sn__Item_cleanup_elem(void *p) { __sn__Item_cleanup((__sn__Item *)p); }
+static inline void __sn__Item_copy_into(const void *src, void *dst) { *(__sn__Item *)dst = __sn__Item_copy((const __sn__Item *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Item *__sn__Item_alloc(void) {
+    return calloc(1, sizeof(__sn__Item));
+}
+
+static inline void __sn__Item_release(__sn__Item **p) {
+    if (*p) {
+        free((*p)->__sn__id);
+        free((*p)->__sn__label);
+        sn_cleanup_array(&(*p)->__sn__tags);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Item __attribute__((cleanup(__sn__Item_release)))
+
+static inline void __sn__Item_release_elem(void *p) { __sn__Item_release((__sn__Item **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Item_to_string(const __sn__Item *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Item { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__id ? p->__sn__id : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "score: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__score);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tags: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__tags); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Item __sn__makeItem(char *, char *, double);
+char * __sn__checkItem(__sn__Item *, double);
+
+
+
+
+#endif
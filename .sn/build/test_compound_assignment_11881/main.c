@@ -0,0 +1,169 @@
+#include "sn_types.h"
+
+
+
+
+int main() {
+    long long __sn__a = 10LL;
+    __sn__a = __sn__a + 5LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("10 += 5 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__a));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__b = 20LL;
+    __sn__b = __sn__b - 8LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("20 -= 8 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__b));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__c = 7LL;
+    __sn__c = __sn__c * 3LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("7 *= 3 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__d = 24LL;
+    __sn__d = __sn__d / 4LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("24 /= 4 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__d));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__e = 17LL;
+    __sn__e = __sn__e % 5LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("17 %= 5 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__e));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    double __sn__f = 3.5;
+    __sn__f = __sn__f + 2.5;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("3.5 += 2.5 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__f));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    double __sn__g = 10.0;
+    __sn__g = __sn__g * 1.5;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("10.0 *= 1.5 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__g));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        });
+    (((long long *)__sn__arr->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]) = (((long long *)__sn__arr->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]) + 10LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("arr[2] after += 10: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    (((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]) = (((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]) * 5LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("arr[0] after *= 5: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 10LL, .__sn__y = 20LL };
+    __sn__p.__sn__x = __sn__p.__sn__x + 5LL;
+    
+    __sn__p.__sn__y = __sn__p.__sn__y - 10LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Point after compound ops: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__h = 100LL;
+    __sn__h = __sn__h + 10LL;
+    
+    __sn__h = __sn__h - 5LL;
+    
+    __sn__h = __sn__h * 2LL;
+    
+    __sn__h = __sn__h / 3LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Chained: 100 +10 -5 *2 /3 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__h));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__s = strdup("Hello");
+    ({
+        char *__old__ = __sn__s;
+        __sn__s = sn_str_concat(__sn__s, " World");
+        free(__old__);
+        __sn__s;
+    });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("String concat: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__s);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    ({
+        char *__old__ = __sn__s;
+        __sn__s = sn_str_concat(__sn__s, "!");
+        free(__old__);
+        __sn__s;
+    });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After another +=: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__s);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("All compound assignment tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
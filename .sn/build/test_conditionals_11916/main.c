@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__my_abs(long long __sn__n) {
+
+    if (sn_lt_long(__sn__n, 0LL)) {
+        return sn_sub_long(0LL, __sn__n);}
+
+    return __sn__n;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("my_abs(-5) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__my_abs((-5LL))));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("my_abs(3) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__my_abs(3LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("my_abs(0) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__my_abs(0LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
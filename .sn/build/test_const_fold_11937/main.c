@@ -0,0 +1,144 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = sn_add_long(2LL, 3LL);
+    long long __sn__b = sn_sub_long(10LL, 4LL);
+    long long __sn__c = sn_mul_long(7LL, 8LL);
+    long long __sn__d = sn_div_long(100LL, 5LL);
+    long long __sn__e = sn_mod_long(17LL, 5LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("a = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__a));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("b = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__b));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("c = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("d = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__d));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("e = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__e));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__nested = sn_mul_long(sn_add_long(2LL, 3LL), sn_sub_long(4LL, 1LL));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("nested = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__nested));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__x = 10LL;
+    long long __sn__mixed = sn_add_long(__sn__x, sn_mul_long(2LL, 3LL));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("mixed = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__mixed));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    bool __sn__cmp1 = sn_lt_long(5LL, 10LL);
+    bool __sn__cmp2 = (10LL == 10LL);
+    bool __sn__cmp3 = sn_gt_long(5LL, 10LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("cmp1 = ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__cmp1) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("cmp2 = ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__cmp2) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("cmp3 = ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__cmp3) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    bool __sn__log1 = (true && true);
+    bool __sn__log2 = (true && false);
+    bool __sn__log3 = (false || true);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("log1 = ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__log1) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("log2 = ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__log2) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("log3 = ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__log3) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__neg = (-42LL);
+    long long __sn__neg2 = (-(-42LL));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("neg = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__neg));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("neg2 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__neg2));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    double __sn__da = sn_add_double(3.0, 2.0);
+    double __sn__db = sn_div_double(10.0, 4.0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("da = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__da));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("db = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__db));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
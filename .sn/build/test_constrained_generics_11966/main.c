@@ -0,0 +1,218 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Score __sn__maxOf_Score(__sn__Score __sn__a, __sn__Score __sn__b) {
+
+    if (sn_gt_long(__sn__Score_compare(&__sn__a, __sn__b), 0LL)) {
+        return __sn__a;}
+
+    return __sn__b;}
+
+
+long long __sn__Score_compare(__sn__Score *__sn__self, __sn__Score __sn__other) {
+
+    if (sn_lt_long(__sn__self->__sn__value, __sn__other.__sn__value)) {
+        return (-1LL);}
+
+    if (sn_gt_long(__sn__self->__sn__value, __sn__other.__sn__value)) {
+        return 1LL;}
+
+    return 0LL;}
+
+
+long long __sn__UserId_hash(__sn__UserId *__sn__self) {
+
+    return sn_mul_long(__sn__self->__sn__id, 31LL);}
+
+bool __sn__UserId_equals(__sn__UserId *__sn__self, __sn__UserId __sn__other) {
+
+    return (__sn__self->__sn__id == __sn__other.__sn__id);}
+
+
+long long __sn__Player_compare(__sn__Player *__sn__self, __sn__Player *__sn__other) {
+
+    if (sn_lt_long(__sn__self->__sn__score, (*__sn__other).__sn__score)) {
+        return (-1LL);}
+
+    if (sn_gt_long(__sn__self->__sn__score, (*__sn__other).__sn__score)) {
+        return 1LL;}
+
+    return 0LL;}
+
+long long __sn__Player_hash(__sn__Player *__sn__self) {
+
+    return sn_mul_long(__sn__self->__sn__score, 31LL);}
+
+bool __sn__Player_equals(__sn__Player *__sn__self, __sn__Player *__sn__other) {
+
+    return (__sn__self->__sn__score == (*__sn__other).__sn__score);}
+
+
+void __sn__SortedList_Score_add(__sn__SortedList_Score *__sn__self, __sn__Score __sn__item) {
+
+    __sn__arr_push(&__sn__self->__sn__items, __sn__item);
+    
+
+    (__sn__self->__sn__size = sn_add_long(__sn__self->__sn__size, 1LL));
+    
+}
+
+long long __sn__SortedList_Score_getSize(__sn__SortedList_Score *__sn__self) {
+
+    return __sn__self->__sn__size;}
+
+
+void __sn__SortedList_int_add(__sn__SortedList_int *__sn__self, long long __sn__item) {
+
+    __sn__arr_push(&__sn__self->__sn__items, __sn__item);
+    
+
+    (__sn__self->__sn__size = sn_add_long(__sn__self->__sn__size, 1LL));
+    
+}
+
+long long __sn__SortedList_int_getSize(__sn__SortedList_int *__sn__self) {
+
+    return __sn__self->__sn__size;}
+
+
+void __sn__SortedList_str_add(__sn__SortedList_str *__sn__self, char * __sn__item) {
+
+    __sn__arr_push(&__sn__self->__sn__items, strdup(__sn__item));
+    
+
+    (__sn__self->__sn__size = sn_add_long(__sn__self->__sn__size, 1LL));
+    
+}
+
+long long __sn__SortedList_str_getSize(__sn__SortedList_str *__sn__self) {
+
+    return __sn__self->__sn__size;}
+
+
+void __sn__IndexedSet_Player_add(__sn__IndexedSet_Player *__sn__self, __sn__Player *__sn__item) {
+
+    __sn__arr_push(&__sn__self->__sn__items, __sn__Player_copy(&((*__sn__item))));
+    
+}
+
+long long __sn__IndexedSet_Player_getCount(__sn__IndexedSet_Player *__sn__self) {
+
+    return sn_array_length(__sn__self->__sn__items);}
+
+
+
+int main() {
+    sn_auto_SortedList_Score __sn__SortedList_Score __sn__sl = (__sn__SortedList_Score){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Score), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__;
+        }), .__sn__size = 0LL };
+    __sn__SortedList_Score_add(&__sn__sl, (__sn__Score){ .__sn__value = 30LL });
+    
+    __sn__SortedList_Score_add(&__sn__sl, (__sn__Score){ .__sn__value = 10LL });
+    
+    __sn__SortedList_Score_add(&__sn__sl, (__sn__Score){ .__sn__value = 20LL });
+    
+    if ((__sn__SortedList_Score_getSize(&__sn__sl) != 3LL)) {
+        sn_print("FAIL: SortedList<Score> size should be 3\n");
+        
+        return 1LL;}
+    sn_print("Test 1 passed: SortedList<Score>\n");
+    
+    sn_auto_SortedList_int __sn__SortedList_int __sn__si = (__sn__SortedList_int){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        }), .__sn__size = 0LL };
+    __sn__SortedList_int_add(&__sn__si, 5LL);
+    
+    __sn__SortedList_int_add(&__sn__si, 3LL);
+    
+    __sn__SortedList_int_add(&__sn__si, 1LL);
+    
+    if ((__sn__SortedList_int_getSize(&__sn__si) != 3LL)) {
+        sn_print("FAIL: SortedList<int> size should be 3\n");
+        
+        return 1LL;}
+    sn_print("Test 2 passed: SortedList<int> (primitive auto-satisfies)\n");
+    
+    sn_auto_SortedList_str __sn__SortedList_str __sn__ss = (__sn__SortedList_str){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 0);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            __al__;
+        }), .__sn__size = 0LL };
+    __sn__SortedList_str_add(&__sn__ss, "charlie");
+    
+    __sn__SortedList_str_add(&__sn__ss, "alice");
+    
+    __sn__SortedList_str_add(&__sn__ss, "bob");
+    
+    if ((__sn__SortedList_str_getSize(&__sn__ss) != 3LL)) {
+        sn_print("FAIL: SortedList<str> size should be 3\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: SortedList<str> (primitive auto-satisfies)\n");
+    
+    sn_auto_IndexedSet_Player __sn__IndexedSet_Player __sn__iset = (__sn__IndexedSet_Player){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Player), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Player_cleanup_elem;
+            __al__->elem_copy = __sn__Player_copy_into;
+            __al__;
+        }) };
+    sn_auto_Player __sn__Player __sn__p1 = (__sn__Player){ .__sn__name = strdup("Alice"), .__sn__score = 100LL };
+    sn_auto_Player __sn__Player __sn__p2 = (__sn__Player){ .__sn__name = strdup("Bob"), .__sn__score = 200LL };
+    __sn__IndexedSet_Player_add(&__sn__iset, &__sn__p1);
+    
+    __sn__IndexedSet_Player_add(&__sn__iset, &__sn__p2);
+    
+    if ((__sn__IndexedSet_Player_getCount(&__sn__iset) != 2LL)) {
+        sn_print("FAIL: IndexedSet<Player> count should be 2\n");
+        
+        return 1LL;}
+    sn_print("Test 4 passed: IndexedSet<Player> (multi-constraint)\n");
+    
+    sn_auto_KeyValue_UserId_str __sn__KeyValue_UserId_str __sn__kv = (__sn__KeyValue_UserId_str){ .__sn__key = (__sn__UserId){ .__sn__id = 42LL }, .__sn__value = strdup("hello") };
+    if ((__sn__kv.__sn__key.__sn__id != 42LL)) {
+        sn_print("FAIL: KeyValue key.id should be 42\n");
+        
+        return 1LL;}
+    if ((strcmp(__sn__kv.__sn__value, "hello") != 0)) {
+        sn_print("FAIL: KeyValue value should be hello\n");
+        
+        return 1LL;}
+    sn_print("Test 5 passed: KeyValue<UserId, str> (mixed constraints)\n");
+    
+    sn_auto_KeyValue_str_int __sn__KeyValue_str_int __sn__kv2 = (__sn__KeyValue_str_int){ .__sn__key = strdup("answer"), .__sn__value = 42LL };
+    if ((strcmp(__sn__kv2.__sn__key, "answer") != 0)) {
+        sn_print("FAIL: KeyValue key should be answer\n");
+        
+        return 1LL;}
+    if ((__sn__kv2.__sn__value != 42LL)) {
+        sn_print("FAIL: KeyValue value should be 42\n");
+        
+        return 1LL;}
+    sn_print("Test 6 passed: KeyValue<str, int> (primitive auto-satisfies)\n");
+    
+    __sn__Score __sn__s1 = (__sn__Score){ .__sn__value = 10LL };
+    __sn__Score __sn__s2 = (__sn__Score){ .__sn__value = 20LL };
+    __sn__Score __sn__bigger = __sn__maxOf_Score(__sn__s1, __sn__s2);
+    if ((__sn__bigger.__sn__value != 20LL)) {
+        sn_print("FAIL: maxOf should return score 20\n");
+        
+        return 1LL;}
+    sn_print("Test 7 passed: maxOf<Score> (constrained generic function)\n");
+    
+    sn_print("All constrained generics tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
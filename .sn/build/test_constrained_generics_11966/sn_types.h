@@ -0,0 +1,515 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Score (as val) */
+typedef struct {
+    long long __sn__value;
+} __sn__Score;
+/* Value operations */
+static inline __sn__Score __sn__Score_copy(const __sn__Score *src) {
+    __sn__Score dst;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Score_cleanup(__sn__Score *p) {
+
+}
+
+#define sn_auto_Score __attribute__((cleanup(__sn__Score_cleanup)))
+
+static inline void __sn__Score_cleanup_elem(void *p) { __sn__Score_cleanup((__sn__Score *)p); }
+static inline void __sn__Score_copy_into(const void *src, void *dst) { *(__sn__Score *)dst = __sn__Score_copy((const __sn__Score *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Score *__sn__Score_alloc(void) {
+    return calloc(1, sizeof(__sn__Score));
+}
+
+static inline void __sn__Score_release(__sn__Score **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Score __attribute__((cleanup(__sn__Score_release)))
+
+static inline void __sn__Score_release_elem(void *p) { __sn__Score_release((__sn__Score **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Score_to_string(const __sn__Score *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Score { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: UserId (as val) */
+typedef struct {
+    long long __sn__id;
+} __sn__UserId;
+/* Value operations */
+static inline __sn__UserId __sn__UserId_copy(const __sn__UserId *src) {
+    __sn__UserId dst;
+    dst.__sn__id = src->__sn__id;
+    return dst;
+}
+
+static inline void __sn__UserId_cleanup(__sn__UserId *p) {
+
+}
+
+#define sn_auto_UserId __attribute__((cleanup(__sn__UserId_cleanup)))
+
+static inline void __sn__UserId_cleanup_elem(void *p) { __sn__UserId_cleanup((__sn__UserId *)p); }
+static inline void __sn__UserId_copy_into(const void *src, void *dst) { *(__sn__UserId *)dst = __sn__UserId_copy((const __sn__UserId *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__UserId *__sn__UserId_alloc(void) {
+    return calloc(1, sizeof(__sn__UserId));
+}
+
+static inline void __sn__UserId_release(__sn__UserId **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_UserId __attribute__((cleanup(__sn__UserId_release)))
+
+static inline void __sn__UserId_release_elem(void *p) { __sn__UserId_release((__sn__UserId **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__UserId_to_string(const __sn__UserId *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "UserId { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__id);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Player (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__score;
+} __sn__Player;
+/* Value operations */
+static inline __sn__Player __sn__Player_copy(const __sn__Player *src) {
+    __sn__Player dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__score = src->__sn__score;
+    return dst;
+}
+
+static inline void __sn__Player_cleanup(__sn__Player *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Player __attribute__((cleanup(__sn__Player_cleanup)))
+
+static inline void __sn__Player_cleanup_elem(void *p) { __sn__Player_cleanup((__sn__Player *)p); }
+static inline void __sn__Player_copy_into(const void *src, void *dst) { *(__sn__Player *)dst = __sn__Player_copy((const __sn__Player *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Player *__sn__Player_alloc(void) {
+    return calloc(1, sizeof(__sn__Player));
+}
+
+static inline void __sn__Player_release(__sn__Player **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Player __attribute__((cleanup(__sn__Player_release)))
+
+static inline void __sn__Player_release_elem(void *p) { __sn__Player_release((__sn__Player **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Player_to_string(const __sn__Player *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Player { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "score: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__score);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: SortedList_Score (as val) */
+typedef struct {
+    SnArray * __sn__items;
+    long long __sn__size;
+} __sn__SortedList_Score;
+/* Value operations */
+static inline __sn__SortedList_Score __sn__SortedList_Score_copy(const __sn__SortedList_Score *src) {
+    __sn__SortedList_Score dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    dst.__sn__size = src->__sn__size;
+    return dst;
+}
+
+static inline void __sn__SortedList_Score_cleanup(__sn__SortedList_Score *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_SortedList_Score __attribute__((cleanup(__sn__SortedList_Score_cleanup)))
+
+static inline void __sn__SortedList_Score_cleanup_elem(void *p) { __sn__SortedList_Score_cleanup((__sn__SortedList_Score *)p); }
+static inline void __sn__SortedList_Score_copy_into(const void *src, void *dst) { *(__sn__SortedList_Score *)dst = __sn__SortedList_Score_copy((const __sn__SortedList_Score *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SortedList_Score *__sn__SortedList_Score_alloc(void) {
+    return calloc(1, sizeof(__sn__SortedList_Score));
+}
+
+static inline void __sn__SortedList_Score_release(__sn__SortedList_Score **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SortedList_Score __attribute__((cleanup(__sn__SortedList_Score_release)))
+
+static inline void __sn__SortedList_Score_release_elem(void *p) { __sn__SortedList_Score_release((__sn__SortedList_Score **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SortedList_Score_to_string(const __sn__SortedList_Score *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SortedList_Score { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "size: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__size);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: SortedList_int (as val) */
+typedef struct {
+    SnArray * __sn__items;
+    long long __sn__size;
+} __sn__SortedList_int;
+/* Value operations */
+static inline __sn__SortedList_int __sn__SortedList_int_copy(const __sn__SortedList_int *src) {
+    __sn__SortedList_int dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    dst.__sn__size = src->__sn__size;
+    return dst;
+}
+
+static inline void __sn__SortedList_int_cleanup(__sn__SortedList_int *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_SortedList_int __attribute__((cleanup(__sn__SortedList_int_cleanup)))
+
+static inline void __sn__SortedList_int_cleanup_elem(void *p) { __sn__SortedList_int_cleanup((__sn__SortedList_int *)p); }
+static inline void __sn__SortedList_int_copy_into(const void *src, void *dst) { *(__sn__SortedList_int *)dst = __sn__SortedList_int_copy((const __sn__SortedList_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SortedList_int *__sn__SortedList_int_alloc(void) {
+    return calloc(1, sizeof(__sn__SortedList_int));
+}
+
+static inline void __sn__SortedList_int_release(__sn__SortedList_int **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SortedList_int __attribute__((cleanup(__sn__SortedList_int_release)))
+
+static inline void __sn__SortedList_int_release_elem(void *p) { __sn__SortedList_int_release((__sn__SortedList_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SortedList_int_to_string(const __sn__SortedList_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SortedList_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "size: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__size);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: SortedList_str (as val) */
+typedef struct {
+    SnArray * __sn__items;
+    long long __sn__size;
+} __sn__SortedList_str;
+/* Value operations */
+static inline __sn__SortedList_str __sn__SortedList_str_copy(const __sn__SortedList_str *src) {
+    __sn__SortedList_str dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    dst.__sn__size = src->__sn__size;
+    return dst;
+}
+
+static inline void __sn__SortedList_str_cleanup(__sn__SortedList_str *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_SortedList_str __attribute__((cleanup(__sn__SortedList_str_cleanup)))
+
+static inline void __sn__SortedList_str_cleanup_elem(void *p) { __sn__SortedList_str_cleanup((__sn__SortedList_str *)p); }
+static inline void __sn__SortedList_str_copy_into(const void *src, void *dst) { *(__sn__SortedList_str *)dst = __sn__SortedList_str_copy((const __sn__SortedList_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SortedList_str *__sn__SortedList_str_alloc(void) {
+    return calloc(1, sizeof(__sn__SortedList_str));
+}
+
+static inline void __sn__SortedList_str_release(__sn__SortedList_str **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SortedList_str __attribute__((cleanup(__sn__SortedList_str_release)))
+
+static inline void __sn__SortedList_str_release_elem(void *p) { __sn__SortedList_str_release((__sn__SortedList_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SortedList_str_to_string(const __sn__SortedList_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SortedList_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "size: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__size);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: IndexedSet_Player (as val) */
+typedef struct {
+    SnArray * __sn__items;
+} __sn__IndexedSet_Player;
+/* Value operations */
+static inline __sn__IndexedSet_Player __sn__IndexedSet_Player_copy(const __sn__IndexedSet_Player *src) {
+    __sn__IndexedSet_Player dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    return dst;
+}
+
+static inline void __sn__IndexedSet_Player_cleanup(__sn__IndexedSet_Player *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_IndexedSet_Player __attribute__((cleanup(__sn__IndexedSet_Player_cleanup)))
+
+static inline void __sn__IndexedSet_Player_cleanup_elem(void *p) { __sn__IndexedSet_Player_cleanup((__sn__IndexedSet_Player *)p); }
+static inline void __sn__IndexedSet_Player_copy_into(const void *src, void *dst) { *(__sn__IndexedSet_Player *)dst = __sn__IndexedSet_Player_copy((const __sn__IndexedSet_Player *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__IndexedSet_Player *__sn__IndexedSet_Player_alloc(void) {
+    return calloc(1, sizeof(__sn__IndexedSet_Player));
+}
+
+static inline void __sn__IndexedSet_Player_release(__sn__IndexedSet_Player **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_IndexedSet_Player __attribute__((cleanup(__sn__IndexedSet_Player_release)))
+
+static inline void __sn__IndexedSet_Player_release_elem(void *p) { __sn__IndexedSet_Player_release((__sn__IndexedSet_Player **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__IndexedSet_Player_to_string(const __sn__IndexedSet_Player *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "IndexedSet_Player { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: KeyValue_UserId_str (as val) */
+typedef struct {
+    __sn__UserId __sn__key;
+    char * __sn__value;
+} __sn__KeyValue_UserId_str;
+/* Value operations */
+static inline __sn__KeyValue_UserId_str __sn__KeyValue_UserId_str_copy(const __sn__KeyValue_UserId_str *src) {
+    __sn__KeyValue_UserId_str dst;
+    dst.__sn__key = __sn__UserId_copy(&src->__sn__key);
+    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    return dst;
+}
+
+static inline void __sn__KeyValue_UserId_str_cleanup(__sn__KeyValue_UserId_str *p) {
+    free(p->__sn__value);
+
+}
+
+#define sn_auto_KeyValue_UserId_str __attribute__((cleanup(__sn__KeyValue_UserId_str_cleanup)))
+
+static inline void __sn__KeyValue_UserId_str_cleanup_elem(void *p) { __sn__KeyValue_UserId_str_cleanup((__sn__KeyValue_UserId_str *)p); }
+static inline void __sn__KeyValue_UserId_str_copy_into(const void *src, void *dst) { *(__sn__KeyValue_UserId_str *)dst = __sn__KeyValue_UserId_str_copy((const __sn__KeyValue_UserId_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__KeyValue_UserId_str *__sn__KeyValue_UserId_str_alloc(void) {
+    return calloc(1, sizeof(__sn__KeyValue_UserId_str));
+}
+
+static inline void __sn__KeyValue_UserId_str_release(__sn__KeyValue_UserId_str **p) {
+    if (*p) {
+        free((*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_KeyValue_UserId_str __attribute__((cleanup(__sn__KeyValue_UserId_str_release)))
+
+static inline void __sn__KeyValue_UserId_str_release_elem(void *p) { __sn__KeyValue_UserId_str_release((__sn__KeyValue_UserId_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__KeyValue_UserId_str_to_string(const __sn__KeyValue_UserId_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "KeyValue_UserId_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    { char *__fs__ = __sn__UserId_to_string(&p->__sn__key); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: KeyValue_str_int (as val) */
+typedef struct {
+    char * __sn__key;
+    long long __sn__value;
+} __sn__KeyValue_str_int;
+/* Value operations */
+static inline __sn__KeyValue_str_int __sn__KeyValue_str_int_copy(const __sn__KeyValue_str_int *src) {
+    __sn__KeyValue_str_int dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__KeyValue_str_int_cleanup(__sn__KeyValue_str_int *p) {
+    free(p->__sn__key);
+
+}
+
+#define sn_auto_KeyValue_str_int __attribute__((cleanup(__sn__KeyValue_str_int_cleanup)))
+
+static inline void __sn__KeyValue_str_int_cleanup_elem(void *p) { __sn__KeyValue_str_int_cleanup((__sn__KeyValue_str_int *)p); }
+static inline void __sn__KeyValue_str_int_copy_into(const void *src, void *dst) { *(__sn__KeyValue_str_int *)dst = __sn__KeyValue_str_int_copy((const __sn__KeyValue_str_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__KeyValue_str_int *__sn__KeyValue_str_int_alloc(void) {
+    return calloc(1, sizeof(__sn__KeyValue_str_int));
+}
+
+static inline void __sn__KeyValue_str_int_release(__sn__KeyValue_str_int **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_KeyValue_str_int __attribute__((cleanup(__sn__KeyValue_str_int_release)))
+
+static inline void __sn__KeyValue_str_int_release_elem(void *p) { __sn__KeyValue_str_int_release((__sn__KeyValue_str_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__KeyValue_str_int_to_string(const __sn__KeyValue_str_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "KeyValue_str_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Score __sn__maxOf_Score(__sn__Score, __sn__Score);
+
+long long __sn__Score_compare(__sn__Score *, __sn__Score);
+long long __sn__UserId_hash(__sn__UserId *);
+bool __sn__UserId_equals(__sn__UserId *, __sn__UserId);
+long long __sn__Player_compare(__sn__Player *, __sn__Player *);
+long long __sn__Player_hash(__sn__Player *);
+bool __sn__Player_equals(__sn__Player *, __sn__Player *);
+void __sn__SortedList_Score_add(__sn__SortedList_Score *, __sn__Score);
+long long __sn__SortedList_Score_getSize(__sn__SortedList_Score *);
+void __sn__SortedList_int_add(__sn__SortedList_int *, long long);
+long long __sn__SortedList_int_getSize(__sn__SortedList_int *);
+void __sn__SortedList_str_add(__sn__SortedList_str *, char *);
+long long __sn__SortedList_str_getSize(__sn__SortedList_str *);
+void __sn__IndexedSet_Player_add(__sn__IndexedSet_Player *, __sn__Player *);
+long long __sn__IndexedSet_Player_getCount(__sn__IndexedSet_Player *);
+
+
+
+#endif
@@ -0,0 +1,209 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_string_array_deep_copy() {
+
+    sn_print("Test 1: Deep copy struct with string array\n");
+    
+
+    sn_auto_UserProfile __sn__UserProfile __sn__p1 = (__sn__UserProfile){ .__sn__name = strdup("Alice"), .__sn__tags = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("admin") });
+            sn_array_push(__al__, &(char *){ strdup("user") });
+            sn_array_push(__al__, &(char *){ strdup("editor") });
+            __al__;
+        }) };
+
+    sn_auto_UserProfile __sn__UserProfile __sn__p2 = __sn__UserProfile_copy(&(__sn__p1));
+
+    ({
+        long long __ai__ = 0LL; if (__ai__ < 0) __ai__ += __sn__p2.__sn__tags->len;
+        char * __new__ = strdup("guest");
+        free(((char * *)__sn__p2.__sn__tags->data)[__ai__]);
+        ((char * *)__sn__p2.__sn__tags->data)[__ai__] = __new__;
+    });
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  p1.tags[0]: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__p1.__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__p1.__sn__tags->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  p2.tags[0]: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__p2.__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__p2.__sn__tags->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    if ((strcmp((((char * *)__sn__p1.__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__p1.__sn__tags->len : __ai__; })]), "admin") != 0)) {
+        sn_print("FAIL: p1.tags[0] should be unchanged\n");
+        
+        return;}
+
+    if ((strcmp((((char * *)__sn__p2.__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__p2.__sn__tags->len : __ai__; })]), "guest") != 0)) {
+        sn_print("FAIL: p2.tags[0] should be 'guest'\n");
+        
+        return;}
+
+    sn_print("  OK\n");
+    
+}
+
+
+void __sn__test_multi_array_deep_copy() {
+
+    sn_print("Test 2: Deep copy struct with multiple arrays\n");
+    
+
+    sn_auto_Matrix __sn__Matrix __sn__m1 = (__sn__Matrix){ .__sn__label = strdup("identity"), .__sn__rows = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 0LL });
+            sn_array_push(__al__, &(long long){ 0LL });
+            __al__;
+        }), .__sn__cols = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 0LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 0LL });
+            __al__;
+        }) };
+
+    sn_auto_Matrix __sn__Matrix __sn__m2 = __sn__Matrix_copy(&(__sn__m1));
+
+    ((long long *)__sn__m2.__sn__rows->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__m2.__sn__rows->len : __ai__; })] = 99LL;
+    
+
+    ((long long *)__sn__m2.__sn__cols->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__m2.__sn__cols->len : __ai__; })] = 88LL;
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  m1.rows[0]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__m1.__sn__rows->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__m1.__sn__rows->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", m1.cols[1]: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__m1.__sn__cols->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__m1.__sn__cols->len : __ai__; })])));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  m2.rows[0]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__m2.__sn__rows->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__m2.__sn__rows->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", m2.cols[1]: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__m2.__sn__cols->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__m2.__sn__cols->len : __ai__; })])));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    if (((((long long *)__sn__m1.__sn__rows->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__m1.__sn__rows->len : __ai__; })]) != 1LL)) {
+        sn_print("FAIL: m1.rows should be unchanged\n");
+        
+        return;}
+
+    if (((((long long *)__sn__m1.__sn__cols->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__m1.__sn__cols->len : __ai__; })]) != 1LL)) {
+        sn_print("FAIL: m1.cols should be unchanged\n");
+        
+        return;}
+
+    if (((((long long *)__sn__m2.__sn__rows->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__m2.__sn__rows->len : __ai__; })]) != 99LL)) {
+        sn_print("FAIL: m2.rows[0] should be 99\n");
+        
+        return;}
+
+    if (((((long long *)__sn__m2.__sn__cols->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__m2.__sn__cols->len : __ai__; })]) != 88LL)) {
+        sn_print("FAIL: m2.cols[1] should be 88\n");
+        
+        return;}
+
+    sn_print("  OK\n");
+    
+}
+
+
+void __sn__test_string_field_independence() {
+
+    sn_print("Test 3: Deep copy string field independence\n");
+    
+
+    sn_auto_UserProfile __sn__UserProfile __sn__p1 = (__sn__UserProfile){ .__sn__name = strdup("Bob"), .__sn__tags = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 1);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("reader") });
+            __al__;
+        }) };
+
+    sn_auto_UserProfile __sn__UserProfile __sn__p2 = __sn__UserProfile_copy(&(__sn__p1));
+
+    ({
+        char *__ma_str_tmp__ = strdup("Charlie");
+        free(__sn__p2.__sn__name);
+        __sn__p2.__sn__name = __ma_str_tmp__;
+        __sn__p2.__sn__name;
+    });
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  p1.name: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__p1.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  p2.name: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__p2.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    if ((strcmp(__sn__p1.__sn__name, "Bob") != 0)) {
+        sn_print("FAIL: p1.name should be unchanged\n");
+        
+        return;}
+
+    sn_print("  OK\n");
+    
+}
+
+
+
+int main() {
+    sn_print("=== copyOf() String Array Tests ===\n\n");
+    
+    __sn__test_string_array_deep_copy();
+    
+    sn_print("\n");
+    
+    __sn__test_multi_array_deep_copy();
+    
+    sn_print("\n");
+    
+    __sn__test_string_field_independence();
+    
+    sn_print("\nPASS\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,148 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: UserProfile (as val) */
+typedef struct {
+    char * __sn__name;
+    SnArray * __sn__tags;
+} __sn__UserProfile;
+/* Value operations */
+static inline __sn__UserProfile __sn__UserProfile_copy(const __sn__UserProfile *src) {
+    __sn__UserProfile dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__tags = sn_array_copy(src->__sn__tags);
+    return dst;
+}
+
+static inline void __sn__UserProfile_cleanup(__sn__UserProfile *p) {
+    free(p->__sn__name);
+    sn_cleanup_array(&p->__sn__tags);
+
+}
+
+#define sn_auto_UserProfile __attribute__((cleanup(__sn__UserProfile_cleanup)))
+
+static inline void __sn__UserProfile_cleanup_elem(void *p) { __sn__UserProfile_cleanup((__sn__UserProfile *)p); }
+static inline void __sn__UserProfile_copy_into(const void *src, void *dst) { *(__sn__UserProfile *)dst = __sn__UserProfile_copy((const __sn__UserProfile *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__UserProfile *__sn__UserProfile_alloc(void) {
+    return calloc(1, sizeof(__sn__UserProfile));
+}
+
+static inline void __sn__UserProfile_release(__sn__UserProfile **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        sn_cleanup_array(&(*p)->__sn__tags);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_UserProfile __attribute__((cleanup(__sn__UserProfile_release)))
+
+static inline void __sn__UserProfile_release_elem(void *p) { __sn__UserProfile_release((__sn__UserProfile **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__UserProfile_to_string(const __sn__UserProfile *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "UserProfile { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tags: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__tags); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Matrix (as val) */
+typedef struct {
+    char * __sn__label;
+    SnArray * __sn__rows;
+    SnArray * __sn__cols;
+} __sn__Matrix;
+/* Value operations */
+static inline __sn__Matrix __sn__Matrix_copy(const __sn__Matrix *src) {
+    __sn__Matrix dst;
+    dst.__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    dst.__sn__rows = sn_array_copy(src->__sn__rows);
+    dst.__sn__cols = sn_array_copy(src->__sn__cols);
+    return dst;
+}
+
+static inline void __sn__Matrix_cleanup(__sn__Matrix *p) {
+    free(p->__sn__label);
+    sn_cleanup_array(&p->__sn__rows);
+    sn_cleanup_array(&p->__sn__cols);
+
+}
+
+#define sn_auto_Matrix __attribute__((cleanup(__sn__Matrix_cleanup)))
+
+static inline void __sn__Matrix_cleanup_elem(void *p) { __sn__Matrix_cleanup((__sn__Matrix *)p); }
+static inline void __sn__Matrix_copy_into(const void *src, void *dst) { *(__sn__Matrix *)dst = __sn__Matrix_copy((const __sn__Matrix *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Matrix *__sn__Matrix_alloc(void) {
+    return calloc(1, sizeof(__sn__Matrix));
+}
+
+static inline void __sn__Matrix_release(__sn__Matrix **p) {
+    if (*p) {
+        free((*p)->__sn__label);
+        sn_cleanup_array(&(*p)->__sn__rows);
+        sn_cleanup_array(&(*p)->__sn__cols);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Matrix __attribute__((cleanup(__sn__Matrix_release)))
+
+static inline void __sn__Matrix_release_elem(void *p) { __sn__Matrix_release((__sn__Matrix **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Matrix_to_string(const __sn__Matrix *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Matrix { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "rows: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__rows); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "cols: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__cols); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__test_string_array_deep_copy();
+void __sn__test_multi_array_deep_copy();
+void __sn__test_string_field_independence();
+
+
+
+
+#endif
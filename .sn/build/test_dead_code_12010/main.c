@@ -0,0 +1,65 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__early_return(long long __sn__x) {
+
+    if (sn_gt_long(__sn__x, 0LL)) {
+        return __sn__x;    long long __sn__dead = 99LL;
+        sn_print("This should never print\n");
+        
+    }
+
+    return 0LL;}
+
+
+long long __sn__unused_variables() {
+
+    long long __sn__used = 10LL;
+
+    return __sn__used;}
+
+
+long long __sn__noop_operations() {
+
+    long long __sn__x = 5LL;
+
+    long long __sn__y = sn_add_long(__sn__x, 0LL);
+
+    long long __sn__z = sn_mul_long(__sn__y, 1LL);
+
+    return __sn__z;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("early_return(5) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__early_return(5LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("early_return(-1) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__early_return((-1LL))));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("unused_variables() = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__unused_variables()));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("noop_operations() = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__noop_operations()));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__L1__level_02__L3__level_04__L5__getStaticCounter() {
+
+    return __sn__level_05__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__incrementStatic() {
+
+    (__sn__level_05__staticCounter = sn_add_long(__sn__level_05__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__getLevelId() {
+
+    return 5LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__computeChainValue(sn_add_long(__sn__base, 5LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__getRootValue() {
+
+    return __sn__L1__level_02__L3__level_04__L5__rootNode.__sn__value;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__setRootValue(long long __sn__v) {
+
+    (__sn__L1__level_02__L3__level_04__L5__rootNode.__sn__value = __sn__v);
+    
+}
+
+
+char * __sn__L1__level_02__L3__level_04__L5__getDeepMessage() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__getStaticMessage();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__getStaticCounter() {
+
+    return __sn__level_05__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__incrementStatic() {
+
+    (__sn__level_05__staticCounter = sn_add_long(__sn__level_05__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__getLevelId() {
+
+    return 5LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__computeChainValue(sn_add_long(__sn__base, 5LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__getRootValue() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__rootNode.__sn__value;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__setRootValue(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__L3__level_04__L5__rootNode.__sn__value = __sn__v);
+    
+}
+
+
+char * __sn__L1_alias__level_02__L3__level_04__L5__getDeepMessage() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__getStaticMessage();}
+
+
+long long __sn__MainL5__getStaticCounter() {
+
+    return __sn__level_05__staticCounter;}
+
+
+void __sn__MainL5__incrementStatic() {
+
+    (__sn__level_05__staticCounter = sn_add_long(__sn__level_05__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__getInstanceCounter() {
+
+    return __sn__MainL5__instanceCounter;}
+
+
+long long __sn__MainL5__getDeepStatic() {
+
+    return __sn__MainL5__level_06__getStaticCounter();}
+
+
+long long __sn__MainL5__getLevelId() {
+
+    return 5LL;}
+
+
+long long __sn__MainL5__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__computeChainValue(sn_add_long(__sn__base, 5LL));}
+
+
+long long __sn__MainL5__getRootValue() {
+
+    return __sn__MainL5__rootNode.__sn__value;}
+
+
+void __sn__MainL5__setRootValue(long long __sn__v) {
+
+    (__sn__MainL5__rootNode.__sn__value = __sn__v);
+    
+}
+
+
+char * __sn__MainL5__getDeepMessage() {
+
+    return __sn__MainL5__level_06__getStaticMessage();}
+
+
@@ -0,0 +1,380 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getStaticCounter() {
+
+    return __sn__level_10__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__incrementStatic() {
+
+    (__sn__level_10__staticCounter = sn_add_long(__sn__level_10__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getDirectDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getLevelId() {
+
+    return 10LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__computeChainValue(sn_add_long(__sn__base, 10LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getBundleId() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__createBundle().__sn__id;}
+
+
+bool __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__verifyDirectAccess() {
+
+    return (__sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getLevelId() == 15LL);}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__getStaticCounter() {
+
+    return __sn__level_10__staticCounter;}
+
+
+void __sn__L1__level_02__JumpL9__level_10__incrementStatic() {
+
+    (__sn__level_10__staticCounter = sn_add_long(__sn__level_10__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__getInstanceCounter() {
+
+    return __sn__L1__level_02__JumpL9__level_10__instanceCounter;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__getDeepStatic() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__getStaticCounter();}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__getDirectDeepStatic() {
+
+    return __sn__L1__level_02__JumpL9__level_10__DirectL15__getStaticCounter();}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__getLevelId() {
+
+    return 10LL;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__computeChainValue(sn_add_long(__sn__base, 10LL));}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__getBundleId() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__createBundle().__sn__id;}
+
+
+bool __sn__L1__level_02__JumpL9__level_10__verifyDirectAccess() {
+
+    return (__sn__L1__level_02__JumpL9__level_10__DirectL15__getLevelId() == 15LL);}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__getStaticCounter() {
+
+    return __sn__level_10__staticCounter;}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__incrementStatic() {
+
+    (__sn__level_10__staticCounter = sn_add_long(__sn__level_10__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__instanceCounter;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__getDeepStatic() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__getDirectDeepStatic() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__getLevelId() {
+
+    return 10LL;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__computeChainValue(sn_add_long(__sn__base, 10LL));}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__getBundleId() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__createBundle().__sn__id;}
+
+
+bool __sn__L1__AliasL7__level_08__L9__level_10__verifyDirectAccess() {
+
+    return (__sn__L1__AliasL7__level_08__L9__level_10__DirectL15__getLevelId() == 15LL);}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getStaticCounter() {
+
+    return __sn__level_10__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__incrementStatic() {
+
+    (__sn__level_10__staticCounter = sn_add_long(__sn__level_10__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getDirectDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getLevelId() {
+
+    return 10LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__computeChainValue(sn_add_long(__sn__base, 10LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getBundleId() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__createBundle().__sn__id;}
+
+
+bool __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__verifyDirectAccess() {
+
+    return (__sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getLevelId() == 15LL);}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__getStaticCounter() {
+
+    return __sn__level_10__staticCounter;}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__incrementStatic() {
+
+    (__sn__level_10__staticCounter = sn_add_long(__sn__level_10__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__getDirectDeepStatic() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__getLevelId() {
+
+    return 10LL;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__computeChainValue(sn_add_long(__sn__base, 10LL));}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__getBundleId() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__createBundle().__sn__id;}
+
+
+bool __sn__L1_alias__level_02__JumpL9__level_10__verifyDirectAccess() {
+
+    return (__sn__L1_alias__level_02__JumpL9__level_10__DirectL15__getLevelId() == 15LL);}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getStaticCounter() {
+
+    return __sn__level_10__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__incrementStatic() {
+
+    (__sn__level_10__staticCounter = sn_add_long(__sn__level_10__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getDirectDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getLevelId() {
+
+    return 10LL;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__computeChainValue(sn_add_long(__sn__base, 10LL));}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getBundleId() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__createBundle().__sn__id;}
+
+
+bool __sn__L1_alias__AliasL7__level_08__L9__level_10__verifyDirectAccess() {
+
+    return (__sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__getLevelId() == 15LL);}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getStaticCounter() {
+
+    return __sn__level_10__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__incrementStatic() {
+
+    (__sn__level_10__staticCounter = sn_add_long(__sn__level_10__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__instanceCounter;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getDirectDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getLevelId() {
+
+    return 10LL;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__computeChainValue(sn_add_long(__sn__base, 10LL));}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getBundleId() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__createBundle().__sn__id;}
+
+
+bool __sn__MainL5__level_06__L7__level_08__L9__level_10__verifyDirectAccess() {
+
+    return (__sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__getLevelId() == 15LL);}
+
+
+long long __sn__MainL10__getStaticCounter() {
+
+    return __sn__level_10__staticCounter;}
+
+
+void __sn__MainL10__incrementStatic() {
+
+    (__sn__level_10__staticCounter = sn_add_long(__sn__level_10__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL10__getInstanceCounter() {
+
+    return __sn__MainL10__instanceCounter;}
+
+
+long long __sn__MainL10__getDeepStatic() {
+
+    return __sn__MainL10__L11__getStaticCounter();}
+
+
+long long __sn__MainL10__getDirectDeepStatic() {
+
+    return __sn__MainL10__DirectL15__getStaticCounter();}
+
+
+long long __sn__MainL10__getLevelId() {
+
+    return 10LL;}
+
+
+long long __sn__MainL10__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL10__L11__computeChainValue(sn_add_long(__sn__base, 10LL));}
+
+
+long long __sn__MainL10__getBundleId() {
+
+    return __sn__MainL10__L11__createBundle().__sn__id;}
+
+
+bool __sn__MainL10__verifyDirectAccess() {
+
+    return (__sn__MainL10__DirectL15__getLevelId() == 15LL);}
+
@@ -0,0 +1,584 @@
+#include "sn_types.h"
+
+long long __sn__level_01__staticCounter = 100LL;
+long long __sn__L1__instanceCounter = 1LL;
+long long __sn__level_02__staticCounter = 200LL;
+long long __sn__L1__level_02__instanceCounter = 2LL;
+long long __sn__level_03__staticCounter = 300LL;
+SnArray * __sn__level_03__staticArray = NULL;
+long long __sn__L1__level_02__L3__instanceCounter = 3LL;
+long long __sn__level_04__staticCounter = 400LL;
+long long __sn__L1__level_02__L3__level_04__instanceCounter = 4LL;
+long long __sn__level_05__staticCounter = 500LL;
+long long __sn__L1__level_02__L3__level_04__L5__instanceCounter = 5LL;
+__sn__TreeNode __sn__L1__level_02__L3__level_04__L5__rootNode = {0};
+long long __sn__level_06__staticCounter = 600LL;
+char * __sn__level_06__staticMessage = NULL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__instanceCounter = 6LL;
+long long __sn__level_07__staticCounter = 700LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__instanceCounter = 7LL;
+long long __sn__level_08__staticCounter = 800LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__instanceCounter = 8LL;
+__sn__Counter __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter = {0};
+long long __sn__level_09__staticCounter = 900LL;
+bool __sn__level_09__staticFlag = true;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__instanceCounter = 9LL;
+long long __sn__level_10__staticCounter = 1000LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__instanceCounter = 10LL;
+long long __sn__level_11__staticCounter = 1100LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__instanceCounter = 11LL;
+long long __sn__level_12__staticCounter = 1200LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__instanceCounter = 12LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel = 0;
+long long __sn__level_13__staticCounter = 1300LL;
+char * __sn__level_13__staticName = NULL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter = 13LL;
+long long __sn__level_14__staticCounter = 1400LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__level_15__staticCounter = 1500LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter = 15LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__instanceCounter = 12LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__holderLevel = 0;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__instanceCounter = 13LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1__level_02__L3__level_04__DirectL14__instanceCounter = 14LL;
+long long __sn__L1__level_02__L3__level_04__DirectL14__L15__instanceCounter = 15LL;
+long long __sn__L1__level_02__JumpL9__instanceCounter = 9LL;
+long long __sn__L1__level_02__JumpL9__level_10__instanceCounter = 10LL;
+long long __sn__L1__level_02__JumpL9__level_10__L11__instanceCounter = 11LL;
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__instanceCounter = 12LL;
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__holderLevel = 0;
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__instanceCounter = 13LL;
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1__level_02__JumpL9__level_10__DirectL15__instanceCounter = 15LL;
+long long __sn__L1__level_02__DirectL15__instanceCounter = 15LL;
+long long __sn__L1__AliasL7__instanceCounter = 7LL;
+long long __sn__L1__AliasL7__level_08__instanceCounter = 8LL;
+__sn__Counter __sn__L1__AliasL7__level_08__sharedCounter = {0};
+long long __sn__L1__AliasL7__level_08__L9__instanceCounter = 9LL;
+long long __sn__L1__AliasL7__level_08__L9__level_10__instanceCounter = 10LL;
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__instanceCounter = 11LL;
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__instanceCounter = 12LL;
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__holderLevel = 0;
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__instanceCounter = 13LL;
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__instanceCounter = 15LL;
+long long __sn__L1__AliasL7__JumpL12__instanceCounter = 12LL;
+long long __sn__L1__AliasL7__JumpL12__holderLevel = 0;
+long long __sn__L1__AliasL7__JumpL12__L13__instanceCounter = 13LL;
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1__AliasL11__instanceCounter = 11LL;
+long long __sn__L1__AliasL11__level_12__instanceCounter = 12LL;
+long long __sn__L1__AliasL11__level_12__holderLevel = 0;
+long long __sn__L1__AliasL11__level_12__L13__instanceCounter = 13LL;
+long long __sn__L1__AliasL11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1__AliasL11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1__AliasL15__instanceCounter = 15LL;
+long long __sn__L1_alias__instanceCounter = 1LL;
+long long __sn__L1_alias__level_02__instanceCounter = 2LL;
+long long __sn__L1_alias__level_02__L3__instanceCounter = 3LL;
+long long __sn__L1_alias__level_02__L3__level_04__instanceCounter = 4LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__instanceCounter = 5LL;
+__sn__TreeNode __sn__L1_alias__level_02__L3__level_04__L5__rootNode = {0};
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__instanceCounter = 6LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__instanceCounter = 7LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__instanceCounter = 8LL;
+__sn__Counter __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter = {0};
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__instanceCounter = 9LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__instanceCounter = 10LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__instanceCounter = 11LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__instanceCounter = 12LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel = 0;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter = 13LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter = 15LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__instanceCounter = 12LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__holderLevel = 0;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__instanceCounter = 13LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__instanceCounter = 14LL;
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__instanceCounter = 15LL;
+long long __sn__L1_alias__level_02__JumpL9__instanceCounter = 9LL;
+long long __sn__L1_alias__level_02__JumpL9__level_10__instanceCounter = 10LL;
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__instanceCounter = 11LL;
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__instanceCounter = 12LL;
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__holderLevel = 0;
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__instanceCounter = 13LL;
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__instanceCounter = 15LL;
+long long __sn__L1_alias__level_02__DirectL15__instanceCounter = 15LL;
+long long __sn__L1_alias__AliasL7__instanceCounter = 7LL;
+long long __sn__L1_alias__AliasL7__level_08__instanceCounter = 8LL;
+__sn__Counter __sn__L1_alias__AliasL7__level_08__sharedCounter = {0};
+long long __sn__L1_alias__AliasL7__level_08__L9__instanceCounter = 9LL;
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__instanceCounter = 10LL;
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__instanceCounter = 11LL;
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__instanceCounter = 12LL;
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__holderLevel = 0;
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__instanceCounter = 13LL;
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__instanceCounter = 15LL;
+long long __sn__L1_alias__AliasL7__JumpL12__instanceCounter = 12LL;
+long long __sn__L1_alias__AliasL7__JumpL12__holderLevel = 0;
+long long __sn__L1_alias__AliasL7__JumpL12__L13__instanceCounter = 13LL;
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1_alias__AliasL11__instanceCounter = 11LL;
+long long __sn__L1_alias__AliasL11__level_12__instanceCounter = 12LL;
+long long __sn__L1_alias__AliasL11__level_12__holderLevel = 0;
+long long __sn__L1_alias__AliasL11__level_12__L13__instanceCounter = 13LL;
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__L1_alias__AliasL15__instanceCounter = 15LL;
+long long __sn__MainL5__instanceCounter = 5LL;
+__sn__TreeNode __sn__MainL5__rootNode = {0};
+long long __sn__MainL5__level_06__instanceCounter = 6LL;
+long long __sn__MainL5__level_06__L7__instanceCounter = 7LL;
+long long __sn__MainL5__level_06__L7__level_08__instanceCounter = 8LL;
+__sn__Counter __sn__MainL5__level_06__L7__level_08__sharedCounter = {0};
+long long __sn__MainL5__level_06__L7__level_08__L9__instanceCounter = 9LL;
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__instanceCounter = 10LL;
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__instanceCounter = 11LL;
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__instanceCounter = 12LL;
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel = 0;
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter = 13LL;
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter = 15LL;
+long long __sn__MainL5__level_06__L7__JumpL12__instanceCounter = 12LL;
+long long __sn__MainL5__level_06__L7__JumpL12__holderLevel = 0;
+long long __sn__MainL5__level_06__L7__JumpL12__L13__instanceCounter = 13LL;
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__instanceCounter = 14LL;
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__MainL10__instanceCounter = 10LL;
+long long __sn__MainL10__L11__instanceCounter = 11LL;
+long long __sn__MainL10__L11__level_12__instanceCounter = 12LL;
+long long __sn__MainL10__L11__level_12__holderLevel = 0;
+long long __sn__MainL10__L11__level_12__L13__instanceCounter = 13LL;
+long long __sn__MainL10__L11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__MainL10__L11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__MainL10__DirectL15__instanceCounter = 15LL;
+long long __sn__MainL15__instanceCounter = 15LL;
+long long __sn__MainL15_alias__instanceCounter = 15LL;
+
+
+
+void __sn__test_basic_level_ids() {
+
+    sn_print("test_basic_level_ids: ");
+    
+
+    sn_assert((__sn__L1__getLevelId() == 1LL), "L1 should have level id 1");
+    
+
+    sn_assert((__sn__MainL5__getLevelId() == 5LL), "L5 should have level id 5");
+    
+
+    sn_assert((__sn__MainL10__getLevelId() == 10LL), "L10 should have level id 10");
+    
+
+    sn_assert((__sn__MainL15__getLevelId() == 15LL), "L15 should have level id 15");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_static_counters_initial() {
+
+    sn_print("test_static_counters_initial: ");
+    
+
+    sn_assert((__sn__L1__getStaticCounter() == 100LL), "L1 static counter should be 100");
+    
+
+    sn_assert((__sn__MainL5__getStaticCounter() == 500LL), "L5 static counter should be 500");
+    
+
+    sn_assert((__sn__MainL10__getStaticCounter() == 1000LL), "L10 static counter should be 1000");
+    
+
+    sn_assert((__sn__MainL15__getStaticCounter() == 1500LL), "L15 static counter should be 1500");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_static_shared_across_aliases() {
+
+    sn_print("test_static_shared_across_aliases: ");
+    
+
+    long long __sn__initial = __sn__MainL15__getStaticCounter();
+
+    __sn__MainL15__incrementStatic();
+    
+
+    sn_assert((__sn__MainL15_alias__getStaticCounter() == sn_add_long(__sn__initial, 1LL)), "L15_alias should see L15's static increment");
+    
+
+    __sn__MainL15_alias__incrementStatic();
+    
+
+    sn_assert((__sn__MainL15__getStaticCounter() == sn_add_long(__sn__initial, 2LL)), "L15 should see L15_alias's static increment");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_instance_counters_separate() {
+
+    sn_print("test_instance_counters_separate: ");
+    
+
+    long long __sn__l1_inst = __sn__L1__getInstanceCounter();
+
+    long long __sn__l1_alias_inst = __sn__L1_alias__getInstanceCounter();
+
+    sn_assert((__sn__l1_inst == 1LL), "L1 instance counter should be 1");
+    
+
+    sn_assert((__sn__l1_alias_inst == 1LL), "L1_alias instance counter should be 1");
+    
+
+    __sn__L1__setInstanceCounter(999LL);
+    
+
+    sn_assert((__sn__L1__getInstanceCounter() == 999LL), "L1 instance counter should be 999");
+    
+
+    sn_assert((__sn__L1_alias__getInstanceCounter() == 1LL), "L1_alias instance counter should still be 1");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_chain_computation() {
+
+    sn_print("test_chain_computation: ");
+    
+
+    long long __sn__result = __sn__L1__computeChainValue(0LL);
+
+    sn_assert((__sn__result == 120LL), "Chain computation should sum 1..15 = 120");
+    
+
+    long long __sn__resultFrom5 = __sn__MainL5__computeChainValue(0LL);
+
+    sn_assert((__sn__resultFrom5 == 110LL), "Chain from L5 should sum 5..15 = 110");
+    
+
+    long long __sn__resultFrom10 = __sn__MainL10__computeChainValue(0LL);
+
+    sn_assert((__sn__resultFrom10 == 75LL), "Chain from L10 should sum 10..15 = 75");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_deep_static_access() {
+
+    sn_print("test_deep_static_access: ");
+    
+
+    sn_assert((__sn__L1__getDeepStatic() == 200LL), "L1.getDeepStatic should return L2's static (200)");
+    
+
+    sn_assert((__sn__L1__getAliasL7Static() == 700LL), "L1.getAliasL7Static should return 700");
+    
+
+    sn_assert((__sn__L1__getAliasL11Static() == 1100LL), "L1.getAliasL11Static should return 1100");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_struct_creation_across_levels() {
+
+    sn_print("test_struct_creation_across_levels: ");
+    
+
+    sn_assert((__sn__L1__createSummary().__sn__level1Static == 100LL), "Summary level1Static should be 100");
+    
+
+    sn_assert((__sn__L1__createSummary().__sn__level2Static == 200LL), "Summary level2Static should be 200");
+    
+
+    sn_assert((__sn__L1__createSummary().__sn__level7Static == 700LL), "Summary level7Static should be 700");
+    
+
+    sn_assert((__sn__L1__createSummary().__sn__level11Static == 1100LL), "Summary level11Static should be 1100");
+    
+
+    sn_assert((__sn__L1__createSummary().__sn__chainValue == 120LL), "Summary chainValue should be 120");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_aggregate_state() {
+
+    sn_print("test_aggregate_state: ");
+    
+
+    long long __sn__aggLocal = __sn__L1__getAggregateLocalVal();
+
+    sn_assert((__sn__aggLocal == 200LL), "Aggregate localVal should be 200");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_flag_toggle_across_chain() {
+
+    sn_print("test_flag_toggle_across_chain: ");
+    
+
+    bool __sn__initial = __sn__L1__getL9FlagViaL2();
+
+    sn_assert((__sn__initial == true), "L9 flag should initially be true");
+    
+
+    __sn__L1__toggleL9FlagViaL2();
+    
+
+    sn_assert((__sn__L1__getL9FlagViaL2() == false), "L9 flag should be false after toggle");
+    
+
+    __sn__L1__toggleL9FlagViaL2();
+    
+
+    sn_assert((__sn__L1__getL9FlagViaL2() == true), "L9 flag should be true after second toggle");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_direct_vs_chain_access() {
+
+    sn_print("test_direct_vs_chain_access: ");
+    
+
+    sn_assert((__sn__MainL10__verifyDirectAccess() == true), "L10 direct access to L15 should work");
+    
+
+    long long __sn__directStatic = __sn__MainL10__getDirectDeepStatic();
+
+    sn_assert((__sn__directStatic == __sn__MainL15__getStaticCounter()), "Direct and aliased access should see same static");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_module_struct_instances() {
+
+    sn_print("test_module_struct_instances: ");
+    
+
+    long long __sn__rootVal = __sn__MainL5__getRootValue();
+
+    sn_assert((__sn__rootVal == 50LL), "L5 root value should be 50");
+    
+
+    __sn__MainL5__setRootValue(555LL);
+    
+
+    sn_assert((__sn__MainL5__getRootValue() == 555LL), "L5 root value should be 555 after set");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_string_static_vars() {
+
+    sn_print("test_string_static_vars: ");
+    
+
+    sn_auto_str char * __sn__msg = __sn__MainL5__getDeepMessage();
+
+    sn_assert((strcmp(__sn__msg, "level6") == 0), "L6 static message should be 'level6'");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_array_static_vars() {
+
+    sn_print("test_array_static_vars: ");
+    
+
+    long long __sn__sum = __sn__L1__level_02__getStaticArraySumViaL3();
+
+    sn_assert((__sn__sum == 93LL), "L3 static array sum should be 30+31+32=93");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_multiple_increment_chain() {
+
+    sn_print("test_multiple_increment_chain: ");
+    
+
+    long long __sn__initial = __sn__L1__getStaticCounter();
+
+    __sn__L1__incrementStatic();
+    
+
+    __sn__L1__incrementStatic();
+    
+
+    __sn__L1__incrementStatic();
+    
+
+    sn_assert((__sn__L1__getStaticCounter() == sn_add_long(__sn__initial, 3LL)), "L1 static should increase by 3");
+    
+
+    sn_assert((__sn__L1_alias__getStaticCounter() == sn_add_long(__sn__initial, 3LL)), "L1_alias should see same static");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_cross_level_struct_creation() {
+
+    sn_print("test_cross_level_struct_creation: ");
+    
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_17__ = __sn__MainL15__createState(42LL, "test"); __mtmp_17__.__sn__value; });
+
+    sn_assert((__sn__stateValue == 42LL), "State value should be 42");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+
+void __sn__test_bundle_creation() {
+
+    sn_print("test_bundle_creation: ");
+    
+
+    long long __sn__bundleId = __sn__MainL10__getBundleId();
+
+    sn_assert((__sn__bundleId == 11LL), "Bundle id should be 11");
+    
+
+    sn_print("PASS\n");
+    
+}
+
+int main() {
+    __sn__level_03__staticArray = ({
+        SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+        __al__->elem_tag = SN_TAG_INT;
+
+        sn_array_push(__al__, &(long long){ 30LL });
+        sn_array_push(__al__, &(long long){ 31LL });
+        sn_array_push(__al__, &(long long){ 32LL });
+        __al__;
+    });
+    __sn__L1__level_02__L3__level_04__L5__rootNode = (__sn__TreeNode){ .__sn__value = 50LL, .__sn__depth = 5LL };
+    __sn__level_06__staticMessage = strdup("level6");
+    __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter = (__sn__Counter){ .__sn__current = 0LL, .__sn__max = 100LL };
+    __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel = __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(120LL);
+    __sn__level_13__staticName = strdup("level13_static");
+    __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__holderLevel = __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__createDeepHolder(120LL);
+    __sn__L1__level_02__JumpL9__level_10__L11__level_12__holderLevel = __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__createDeepHolder(120LL);
+    __sn__L1__AliasL7__level_08__sharedCounter = (__sn__Counter){ .__sn__current = 0LL, .__sn__max = 100LL };
+    __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__holderLevel = __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(120LL);
+    __sn__L1__AliasL7__JumpL12__holderLevel = __sn__L1__AliasL7__JumpL12__L13__createDeepHolder(120LL);
+    __sn__L1__AliasL11__level_12__holderLevel = __sn__L1__AliasL11__level_12__L13__createDeepHolder(120LL);
+    __sn__L1_alias__level_02__L3__level_04__L5__rootNode = (__sn__TreeNode){ .__sn__value = 50LL, .__sn__depth = 5LL };
+    __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter = (__sn__Counter){ .__sn__current = 0LL, .__sn__max = 100LL };
+    __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel = __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(120LL);
+    __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__holderLevel = __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__createDeepHolder(120LL);
+    __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__holderLevel = __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__createDeepHolder(120LL);
+    __sn__L1_alias__AliasL7__level_08__sharedCounter = (__sn__Counter){ .__sn__current = 0LL, .__sn__max = 100LL };
+    __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__holderLevel = __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(120LL);
+    __sn__L1_alias__AliasL7__JumpL12__holderLevel = __sn__L1_alias__AliasL7__JumpL12__L13__createDeepHolder(120LL);
+    __sn__L1_alias__AliasL11__level_12__holderLevel = __sn__L1_alias__AliasL11__level_12__L13__createDeepHolder(120LL);
+    __sn__MainL5__rootNode = (__sn__TreeNode){ .__sn__value = 50LL, .__sn__depth = 5LL };
+    __sn__MainL5__level_06__L7__level_08__sharedCounter = (__sn__Counter){ .__sn__current = 0LL, .__sn__max = 100LL };
+    __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel = __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(120LL);
+    __sn__MainL5__level_06__L7__JumpL12__holderLevel = __sn__MainL5__level_06__L7__JumpL12__L13__createDeepHolder(120LL);
+    __sn__MainL10__L11__level_12__holderLevel = __sn__MainL10__L11__level_12__L13__createDeepHolder(120LL);
+    sn_print("=== Deep Module Chain Tests (15 levels) ===\n\n");
+    
+    __sn__test_basic_level_ids();
+    
+    __sn__test_static_counters_initial();
+    
+    __sn__test_static_shared_across_aliases();
+    
+    __sn__test_instance_counters_separate();
+    
+    __sn__test_chain_computation();
+    
+    __sn__test_deep_static_access();
+    
+    __sn__test_struct_creation_across_levels();
+    
+    __sn__test_aggregate_state();
+    
+    __sn__test_flag_toggle_across_chain();
+    
+    __sn__test_direct_vs_chain_access();
+    
+    __sn__test_module_struct_instances();
+    
+    __sn__test_string_static_vars();
+    
+    __sn__test_array_static_vars();
+    
+    __sn__test_multiple_increment_chain();
+    
+    __sn__test_cross_level_struct_creation();
+    
+    __sn__test_bundle_creation();
+    
+    sn_print("\nAll deep module chain tests passed!\n");
+    
+    sn_cleanup_array(&__sn__level_03__staticArray);
+    free(__sn__level_06__staticMessage);
+    free(__sn__level_13__staticName);
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__L1__level_02__L3__getStaticCounter() {
+
+    return __sn__level_03__staticCounter;}
+
+
+long long __sn__L1__level_02__L3__getStaticArraySum() {
+
+    return sn_add_long(sn_add_long((((long long *)__sn__level_03__staticArray->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__level_03__staticArray->len : __ai__; })]), (((long long *)__sn__level_03__staticArray->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__level_03__staticArray->len : __ai__; })])), (((long long *)__sn__level_03__staticArray->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__level_03__staticArray->len : __ai__; })]));}
+
+
+void __sn__L1__level_02__L3__incrementStatic() {
+
+    (__sn__level_03__staticCounter = sn_add_long(__sn__level_03__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__getLevelId() {
+
+    return 3LL;}
+
+
+long long __sn__L1__level_02__L3__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__computeChainValue(sn_add_long(__sn__base, 3LL));}
+
+
+long long __sn__L1__level_02__L3__getDirectL14ViaL4() {
+
+    return __sn__L1__level_02__L3__level_04__getDirectL14Static();}
+
+
+long long __sn__L1__level_02__L3__getHolderLevelViaL4(long long __sn__n) {
+
+    return __sn__L1__level_02__L3__level_04__createDirectHolder(__sn__n);}
+
+
+long long __sn__L1_alias__level_02__L3__getStaticCounter() {
+
+    return __sn__level_03__staticCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__getStaticArraySum() {
+
+    return sn_add_long(sn_add_long((((long long *)__sn__level_03__staticArray->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__level_03__staticArray->len : __ai__; })]), (((long long *)__sn__level_03__staticArray->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__level_03__staticArray->len : __ai__; })])), (((long long *)__sn__level_03__staticArray->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__level_03__staticArray->len : __ai__; })]));}
+
+
+void __sn__L1_alias__level_02__L3__incrementStatic() {
+
+    (__sn__level_03__staticCounter = sn_add_long(__sn__level_03__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__getLevelId() {
+
+    return 3LL;}
+
+
+long long __sn__L1_alias__level_02__L3__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__computeChainValue(sn_add_long(__sn__base, 3LL));}
+
+
+long long __sn__L1_alias__level_02__L3__getDirectL14ViaL4() {
+
+    return __sn__L1_alias__level_02__L3__level_04__getDirectL14Static();}
+
+
+long long __sn__L1_alias__level_02__L3__getHolderLevelViaL4(long long __sn__n) {
+
+    return __sn__L1_alias__level_02__L3__level_04__createDirectHolder(__sn__n);}
+
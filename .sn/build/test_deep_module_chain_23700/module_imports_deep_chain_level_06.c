@@ -0,0 +1,178 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__getStaticCounter() {
+
+    return __sn__level_06__staticCounter;}
+
+
+char * __sn__L1__level_02__L3__level_04__L5__level_06__getStaticMessage() {
+
+    {
+        char * __ret__ = __sn__level_06__staticMessage;
+        __sn__level_06__staticMessage = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__setStaticMessage(char * __sn__msg) {
+
+    ({
+        char *__sn_tmp__ = strdup(__sn__msg);
+        free(__sn__level_06__staticMessage);
+        __sn__level_06__staticMessage = __sn_tmp__;
+        __sn__level_06__staticMessage;
+    });
+    
+}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__incrementStatic() {
+
+    (__sn__level_06__staticCounter = sn_add_long(__sn__level_06__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__getLevelId() {
+
+    return 6LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__computeChainValue(sn_add_long(__sn__base, 6LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__getJumpStaticViaL7() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__getJumpStatic();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__getStaticCounter() {
+
+    return __sn__level_06__staticCounter;}
+
+
+char * __sn__L1_alias__level_02__L3__level_04__L5__level_06__getStaticMessage() {
+
+    {
+        char * __ret__ = __sn__level_06__staticMessage;
+        __sn__level_06__staticMessage = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__setStaticMessage(char * __sn__msg) {
+
+    ({
+        char *__sn_tmp__ = strdup(__sn__msg);
+        free(__sn__level_06__staticMessage);
+        __sn__level_06__staticMessage = __sn_tmp__;
+        __sn__level_06__staticMessage;
+    });
+    
+}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__incrementStatic() {
+
+    (__sn__level_06__staticCounter = sn_add_long(__sn__level_06__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__getLevelId() {
+
+    return 6LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__computeChainValue(sn_add_long(__sn__base, 6LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__getJumpStaticViaL7() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getJumpStatic();}
+
+
+long long __sn__MainL5__level_06__getStaticCounter() {
+
+    return __sn__level_06__staticCounter;}
+
+
+char * __sn__MainL5__level_06__getStaticMessage() {
+
+    {
+        char * __ret__ = __sn__level_06__staticMessage;
+        __sn__level_06__staticMessage = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__MainL5__level_06__setStaticMessage(char * __sn__msg) {
+
+    ({
+        char *__sn_tmp__ = strdup(__sn__msg);
+        free(__sn__level_06__staticMessage);
+        __sn__level_06__staticMessage = __sn_tmp__;
+        __sn__level_06__staticMessage;
+    });
+    
+}
+
+
+void __sn__MainL5__level_06__incrementStatic() {
+
+    (__sn__level_06__staticCounter = sn_add_long(__sn__level_06__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__instanceCounter;}
+
+
+long long __sn__MainL5__level_06__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__getLevelId() {
+
+    return 6LL;}
+
+
+long long __sn__MainL5__level_06__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__computeChainValue(sn_add_long(__sn__base, 6LL));}
+
+
+long long __sn__MainL5__level_06__getJumpStaticViaL7() {
+
+    return __sn__MainL5__level_06__L7__getJumpStatic();}
+
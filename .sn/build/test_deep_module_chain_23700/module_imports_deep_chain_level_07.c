@@ -0,0 +1,249 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getStaticCounter() {
+
+    return __sn__level_07__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__incrementStatic() {
+
+    (__sn__level_07__staticCounter = sn_add_long(__sn__level_07__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getJumpStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getLevelId() {
+
+    return 7LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__computeChainValue(sn_add_long(__sn__base, 7LL));}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__incrementSharedViaChain() {
+
+    __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__incrementSharedCounter();
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getSharedViaChain() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getSharedCounterValue();}
+
+
+long long __sn__L1__AliasL7__getStaticCounter() {
+
+    return __sn__level_07__staticCounter;}
+
+
+void __sn__L1__AliasL7__incrementStatic() {
+
+    (__sn__level_07__staticCounter = sn_add_long(__sn__level_07__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__instanceCounter;}
+
+
+long long __sn__L1__AliasL7__getDeepStatic() {
+
+    return __sn__L1__AliasL7__level_08__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__getJumpStatic() {
+
+    return __sn__L1__AliasL7__JumpL12__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__getLevelId() {
+
+    return 7LL;}
+
+
+long long __sn__L1__AliasL7__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__level_08__computeChainValue(sn_add_long(__sn__base, 7LL));}
+
+
+void __sn__L1__AliasL7__incrementSharedViaChain() {
+
+    __sn__L1__AliasL7__level_08__incrementSharedCounter();
+    
+}
+
+
+long long __sn__L1__AliasL7__getSharedViaChain() {
+
+    return __sn__L1__AliasL7__level_08__getSharedCounterValue();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getStaticCounter() {
+
+    return __sn__level_07__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__incrementStatic() {
+
+    (__sn__level_07__staticCounter = sn_add_long(__sn__level_07__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getJumpStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getLevelId() {
+
+    return 7LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__computeChainValue(sn_add_long(__sn__base, 7LL));}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__incrementSharedViaChain() {
+
+    __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__incrementSharedCounter();
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getSharedViaChain() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getSharedCounterValue();}
+
+
+long long __sn__L1_alias__AliasL7__getStaticCounter() {
+
+    return __sn__level_07__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__incrementStatic() {
+
+    (__sn__level_07__staticCounter = sn_add_long(__sn__level_07__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL7__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__level_08__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__getJumpStatic() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__getLevelId() {
+
+    return 7LL;}
+
+
+long long __sn__L1_alias__AliasL7__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__level_08__computeChainValue(sn_add_long(__sn__base, 7LL));}
+
+
+void __sn__L1_alias__AliasL7__incrementSharedViaChain() {
+
+    __sn__L1_alias__AliasL7__level_08__incrementSharedCounter();
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__getSharedViaChain() {
+
+    return __sn__L1_alias__AliasL7__level_08__getSharedCounterValue();}
+
+
+long long __sn__MainL5__level_06__L7__getStaticCounter() {
+
+    return __sn__level_07__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__incrementStatic() {
+
+    (__sn__level_07__staticCounter = sn_add_long(__sn__level_07__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__instanceCounter;}
+
+
+long long __sn__MainL5__level_06__L7__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__level_08__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__getJumpStatic() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__getLevelId() {
+
+    return 7LL;}
+
+
+long long __sn__MainL5__level_06__L7__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__level_08__computeChainValue(sn_add_long(__sn__base, 7LL));}
+
+
+void __sn__MainL5__level_06__L7__incrementSharedViaChain() {
+
+    __sn__MainL5__level_06__L7__level_08__incrementSharedCounter();
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__getSharedViaChain() {
+
+    return __sn__MainL5__level_06__L7__level_08__getSharedCounterValue();}
+
@@ -0,0 +1,634 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter()), __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic()), __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getHolderLevel() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticCounter()), __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepStatic()), __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getHolderLevel() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__holderLevel;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getInstanceCounter() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__instanceCounter;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getDeepStatic() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getStaticCounter()), __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getDeepStatic()), __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getHolderLevel() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__holderLevel;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__instanceCounter;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getDeepStatic() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter()), __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic()), __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getHolderLevel() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__holderLevel;}
+
+
+long long __sn__L1__AliasL7__JumpL12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1__AliasL7__JumpL12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__JumpL12__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__JumpL12__instanceCounter;}
+
+
+long long __sn__L1__AliasL7__JumpL12__getDeepStatic() {
+
+    return __sn__L1__AliasL7__JumpL12__L13__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__JumpL12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1__AliasL7__JumpL12__L13__getStaticCounter()), __sn__L1__AliasL7__JumpL12__L13__getDeepStatic()), __sn__L1__AliasL7__JumpL12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1__AliasL7__JumpL12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1__AliasL7__JumpL12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__JumpL12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1__AliasL7__JumpL12__getHolderLevel() {
+
+    return __sn__L1__AliasL7__JumpL12__holderLevel;}
+
+
+long long __sn__L1__AliasL11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1__AliasL11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL11__level_12__getInstanceCounter() {
+
+    return __sn__L1__AliasL11__level_12__instanceCounter;}
+
+
+long long __sn__L1__AliasL11__level_12__getDeepStatic() {
+
+    return __sn__L1__AliasL11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__L1__AliasL11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1__AliasL11__level_12__L13__getStaticCounter()), __sn__L1__AliasL11__level_12__L13__getDeepStatic()), __sn__L1__AliasL11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1__AliasL11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1__AliasL11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1__AliasL11__level_12__getHolderLevel() {
+
+    return __sn__L1__AliasL11__level_12__holderLevel;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter()), __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic()), __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getHolderLevel() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticCounter()), __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepStatic()), __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getHolderLevel() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__holderLevel;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getStaticCounter()), __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getDeepStatic()), __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getHolderLevel() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__holderLevel;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter()), __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic()), __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getHolderLevel() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__holderLevel;}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__JumpL12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1_alias__AliasL7__JumpL12__L13__getStaticCounter()), __sn__L1_alias__AliasL7__JumpL12__L13__getDeepStatic()), __sn__L1_alias__AliasL7__JumpL12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__getHolderLevel() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__holderLevel;}
+
+
+long long __sn__L1_alias__AliasL11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__L1_alias__AliasL11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL11__level_12__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL11__level_12__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL11__level_12__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__L1_alias__AliasL11__level_12__L13__getStaticCounter()), __sn__L1_alias__AliasL11__level_12__L13__getDeepStatic()), __sn__L1_alias__AliasL11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__L1_alias__AliasL11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__L1_alias__AliasL11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__L1_alias__AliasL11__level_12__getHolderLevel() {
+
+    return __sn__L1_alias__AliasL11__level_12__holderLevel;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__instanceCounter;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter()), __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic()), __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getHolderLevel() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel;}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__JumpL12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__instanceCounter;}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__MainL5__level_06__L7__JumpL12__L13__getStaticCounter()), __sn__MainL5__level_06__L7__JumpL12__L13__getDeepStatic()), __sn__MainL5__level_06__L7__JumpL12__L13__getDeepDeepStatic());}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__getHolderLevel() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__holderLevel;}
+
+
+long long __sn__MainL10__L11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__MainL10__L11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL10__L11__level_12__getInstanceCounter() {
+
+    return __sn__MainL10__L11__level_12__instanceCounter;}
+
+
+long long __sn__MainL10__L11__level_12__getDeepStatic() {
+
+    return __sn__MainL10__L11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__MainL10__L11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__MainL10__L11__level_12__L13__getStaticCounter()), __sn__MainL10__L11__level_12__L13__getDeepStatic()), __sn__MainL10__L11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__MainL10__L11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__MainL10__L11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL10__L11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__MainL10__L11__level_12__getHolderLevel() {
+
+    return __sn__MainL10__L11__level_12__holderLevel;}
+
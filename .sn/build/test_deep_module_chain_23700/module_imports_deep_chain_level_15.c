@@ -0,0 +1,1214 @@
+#include "sn_types.h"
+
+
+
+
+__sn__State __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__level_02__L3__level_04__DirectL14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__level_02__L3__level_04__DirectL14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__DirectL14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__DirectL14__L15__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__DirectL14__L15__instanceCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__DirectL14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__level_02__L3__level_04__DirectL14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__DirectL14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__DirectL14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__level_02__JumpL9__level_10__DirectL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__DirectL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__level_02__JumpL9__level_10__DirectL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__DirectL15__getInstanceCounter() {
+
+    return __sn__L1__level_02__JumpL9__level_10__DirectL15__instanceCounter;}
+
+
+void __sn__L1__level_02__JumpL9__level_10__DirectL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__level_02__JumpL9__level_10__DirectL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__DirectL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__DirectL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__level_02__DirectL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__level_02__DirectL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__level_02__DirectL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__DirectL15__getInstanceCounter() {
+
+    return __sn__L1__level_02__DirectL15__instanceCounter;}
+
+
+void __sn__L1__level_02__DirectL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__level_02__DirectL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__DirectL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__level_02__DirectL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__instanceCounter;}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__AliasL7__level_08__L9__level_10__DirectL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__AliasL7__JumpL12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__AliasL7__JumpL12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__JumpL12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1__AliasL7__JumpL12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__AliasL7__JumpL12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__AliasL11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__AliasL11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__AliasL11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1__AliasL11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1__AliasL11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__AliasL11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__AliasL11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__AliasL11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1__AliasL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1__AliasL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1__AliasL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL15__getInstanceCounter() {
+
+    return __sn__L1__AliasL15__instanceCounter;}
+
+
+void __sn__L1__AliasL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__AliasL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__AliasL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1__AliasL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__instanceCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__L3__level_04__DirectL14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__instanceCounter;}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__JumpL9__level_10__DirectL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__level_02__DirectL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__level_02__DirectL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__level_02__DirectL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__DirectL15__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__DirectL15__instanceCounter;}
+
+
+void __sn__L1_alias__level_02__DirectL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__DirectL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__DirectL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__level_02__DirectL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__instanceCounter;}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__AliasL11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__L1_alias__AliasL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__L1_alias__AliasL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__L1_alias__AliasL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL15__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL15__instanceCounter;}
+
+
+void __sn__L1_alias__AliasL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__AliasL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__AliasL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__L1_alias__AliasL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter;}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__MainL10__L11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__MainL10__L11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__MainL10__L11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL10__L11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__MainL10__L11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__MainL10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MainL10__L11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MainL10__L11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__MainL10__L11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__MainL10__DirectL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__MainL10__DirectL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__MainL10__DirectL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL10__DirectL15__getInstanceCounter() {
+
+    return __sn__MainL10__DirectL15__instanceCounter;}
+
+
+void __sn__MainL10__DirectL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MainL10__DirectL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MainL10__DirectL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__MainL10__DirectL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__MainL15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__MainL15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__MainL15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL15__getInstanceCounter() {
+
+    return __sn__MainL15__instanceCounter;}
+
+
+void __sn__MainL15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MainL15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MainL15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__MainL15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__MainL15_alias__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__MainL15_alias__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__MainL15_alias__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL15_alias__getInstanceCounter() {
+
+    return __sn__MainL15_alias__instanceCounter;}
+
+
+void __sn__MainL15_alias__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MainL15_alias__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MainL15_alias__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__MainL15_alias__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
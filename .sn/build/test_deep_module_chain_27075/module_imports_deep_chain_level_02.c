@@ -0,0 +1,133 @@
+#include "sn_types.h"
+
+
+
+
+__sn__AggregateState __sn__L1__level_02__createAggregate() {
+
+    return (__sn__AggregateState){ .__sn__localVal = __sn__level_02__staticCounter, .__sn__deepVal = __sn__L1__level_02__L3__getStaticCounter(), .__sn__directVal = __sn__L1__level_02__DirectL15__getStaticCounter() };}
+
+
+long long __sn__L1__level_02__getStaticCounter() {
+
+    return __sn__level_02__staticCounter;}
+
+
+void __sn__L1__level_02__incrementStatic() {
+
+    (__sn__level_02__staticCounter = sn_add_long(__sn__level_02__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__getInstanceCounter() {
+
+    return __sn__L1__level_02__instanceCounter;}
+
+
+long long __sn__L1__level_02__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__getStaticCounter();}
+
+
+long long __sn__L1__level_02__getJumpL9Static() {
+
+    return __sn__L1__level_02__JumpL9__getStaticCounter();}
+
+
+long long __sn__L1__level_02__getDirectL15Static() {
+
+    return __sn__L1__level_02__DirectL15__getStaticCounter();}
+
+
+long long __sn__L1__level_02__getLevelId() {
+
+    return 2LL;}
+
+
+long long __sn__L1__level_02__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__computeChainValue(sn_add_long(__sn__base, 2LL));}
+
+
+long long __sn__L1__level_02__getStaticArraySumViaL3() {
+
+    return __sn__L1__level_02__L3__getStaticArraySum();}
+
+
+void __sn__L1__level_02__toggleL9Flag() {
+
+    __sn__L1__level_02__JumpL9__toggleStaticFlag();
+    
+}
+
+
+bool __sn__L1__level_02__getL9Flag() {
+
+    return __sn__L1__level_02__JumpL9__getStaticFlag();}
+
+
+__sn__AggregateState __sn__L1_alias__level_02__createAggregate() {
+
+    return (__sn__AggregateState){ .__sn__localVal = __sn__level_02__staticCounter, .__sn__deepVal = __sn__L1_alias__level_02__L3__getStaticCounter(), .__sn__directVal = __sn__L1_alias__level_02__DirectL15__getStaticCounter() };}
+
+
+long long __sn__L1_alias__level_02__getStaticCounter() {
+
+    return __sn__level_02__staticCounter;}
+
+
+void __sn__L1_alias__level_02__incrementStatic() {
+
+    (__sn__level_02__staticCounter = sn_add_long(__sn__level_02__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__getJumpL9Static() {
+
+    return __sn__L1_alias__level_02__JumpL9__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__getDirectL15Static() {
+
+    return __sn__L1_alias__level_02__DirectL15__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__getLevelId() {
+
+    return 2LL;}
+
+
+long long __sn__L1_alias__level_02__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__computeChainValue(sn_add_long(__sn__base, 2LL));}
+
+
+long long __sn__L1_alias__level_02__getStaticArraySumViaL3() {
+
+    return __sn__L1_alias__level_02__L3__getStaticArraySum();}
+
+
+void __sn__L1_alias__level_02__toggleL9Flag() {
+
+    __sn__L1_alias__level_02__JumpL9__toggleStaticFlag();
+    
+}
+
+
+bool __sn__L1_alias__level_02__getL9Flag() {
+
+    return __sn__L1_alias__level_02__JumpL9__getStaticFlag();}
+
+
@@ -0,0 +1,874 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__instanceCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getInstanceCounter() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__instanceCounter;}
+
+
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getDeepStatic() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__instanceCounter;}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1__AliasL7__JumpL12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1__AliasL7__JumpL12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__JumpL12__L13__instanceCounter;}
+
+
+void __sn__L1__AliasL7__JumpL12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__AliasL7__JumpL12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__getDeepStatic() {
+
+    return __sn__L1__AliasL7__JumpL12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__getDeepDeepStatic() {
+
+    return __sn__L1__AliasL7__JumpL12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__JumpL12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1__AliasL7__JumpL12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1__AliasL11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1__AliasL11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1__AliasL11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL11__level_12__L13__getInstanceCounter() {
+
+    return __sn__L1__AliasL11__level_12__L13__instanceCounter;}
+
+
+void __sn__L1__AliasL11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__AliasL11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__AliasL11__level_12__L13__getDeepStatic() {
+
+    return __sn__L1__AliasL11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1__AliasL11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__L1__AliasL11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1__AliasL11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1__AliasL11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1__AliasL11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1__AliasL11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__instanceCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__instanceCounter;}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__instanceCounter;}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1_alias__AliasL7__JumpL12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1_alias__AliasL7__JumpL12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__instanceCounter;}
+
+
+void __sn__L1_alias__AliasL7__JumpL12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__AliasL7__JumpL12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__getDeepDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__L1_alias__AliasL11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__L1_alias__AliasL11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__instanceCounter;}
+
+
+void __sn__L1_alias__AliasL11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__AliasL11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter;}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__MainL5__level_06__L7__JumpL12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__MainL5__level_06__L7__JumpL12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__instanceCounter;}
+
+
+void __sn__MainL5__level_06__L7__JumpL12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MainL5__level_06__L7__JumpL12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__getDeepDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__MainL10__L11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__MainL10__L11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__MainL10__L11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL10__L11__level_12__L13__getInstanceCounter() {
+
+    return __sn__MainL10__L11__level_12__L13__instanceCounter;}
+
+
+void __sn__MainL10__L11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MainL10__L11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MainL10__L11__level_12__L13__getDeepStatic() {
+
+    return __sn__MainL10__L11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__MainL10__L11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__MainL10__L11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__MainL10__L11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__MainL10__L11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL10__L11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__MainL10__L11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__MainL10__L11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
@@ -0,0 +1,1695 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Summary (as val) */
+typedef struct {
+    long long __sn__level1Static;
+    long long __sn__level2Static;
+    long long __sn__level7Static;
+    long long __sn__level11Static;
+    long long __sn__level15Static;
+    long long __sn__chainValue;
+} __sn__Summary;
+/* Value operations */
+static inline __sn__Summary __sn__Summary_copy(const __sn__Summary *src) {
+    __sn__Summary dst;
+    dst.__sn__level1Static = src->__sn__level1Static;
+    dst.__sn__level2Static = src->__sn__level2Static;
+    dst.__sn__level7Static = src->__sn__level7Static;
+    dst.__sn__level11Static = src->__sn__level11Static;
+    dst.__sn__level15Static = src->__sn__level15Static;
+    dst.__sn__chainValue = src->__sn__chainValue;
+    return dst;
+}
+
+static inline void __sn__Summary_cleanup(__sn__Summary *p) {
+
+}
+
+#define sn_auto_Summary __attribute__((cleanup(__sn__Summary_cleanup)))
+
+static inline void __sn__Summary_cleanup_elem(void *p) { __sn__Summary_cleanup((__sn__Summary *)p); }
+static inline void __sn__Summary_copy_into(const void *src, void *dst) { *(__sn__Summary *)dst = __sn__Summary_copy((const __sn__Summary *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Summary *__sn__Summary_alloc(void) {
+    return calloc(1, sizeof(__sn__Summary));
+}
+
+static inline void __sn__Summary_release(__sn__Summary **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Summary __attribute__((cleanup(__sn__Summary_release)))
+
+static inline void __sn__Summary_release_elem(void *p) { __sn__Summary_release((__sn__Summary **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Summary_to_string(const __sn__Summary *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Summary { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "level1Static: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__level1Static);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "level2Static: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__level2Static);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "level7Static: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__level7Static);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "level11Static: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__level11Static);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "level15Static: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__level15Static);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "chainValue: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__chainValue);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+/* Struct: AggregateState (as val) */
+typedef struct {
+    long long __sn__localVal;
+    long long __sn__deepVal;
+    long long __sn__directVal;
+} __sn__AggregateState;
+/* Value operations */
+static inline __sn__AggregateState __sn__AggregateState_copy(const __sn__AggregateState *src) {
+    __sn__AggregateState dst;
+    dst.__sn__localVal = src->__sn__localVal;
+    dst.__sn__deepVal = src->__sn__deepVal;
+    dst.__sn__directVal = src->__sn__directVal;
+    return dst;
+}
+
+static inline void __sn__AggregateState_cleanup(__sn__AggregateState *p) {
+
+}
+
+#define sn_auto_AggregateState __attribute__((cleanup(__sn__AggregateState_cleanup)))
+
+static inline void __sn__AggregateState_cleanup_elem(void *p) { __sn__AggregateState_cleanup((__sn__AggregateState *)p); }
+static inline void __sn__AggregateState_copy_into(const void *src, void *dst) { *(__sn__AggregateState *)dst = __sn__AggregateState_copy((const __sn__AggregateState *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__AggregateState *__sn__AggregateState_alloc(void) {
+    return calloc(1, sizeof(__sn__AggregateState));
+}
+
+static inline void __sn__AggregateState_release(__sn__AggregateState **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_AggregateState __attribute__((cleanup(__sn__AggregateState_release)))
+
+static inline void __sn__AggregateState_release_elem(void *p) { __sn__AggregateState_release((__sn__AggregateState **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__AggregateState_to_string(const __sn__AggregateState *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "AggregateState { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "localVal: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__localVal);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "deepVal: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__deepVal);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "directVal: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__directVal);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+/* Struct: TreeNode (as val) */
+typedef struct {
+    long long __sn__value;
+    long long __sn__depth;
+} __sn__TreeNode;
+/* Value operations */
+static inline __sn__TreeNode __sn__TreeNode_copy(const __sn__TreeNode *src) {
+    __sn__TreeNode dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__depth = src->__sn__depth;
+    return dst;
+}
+
+static inline void __sn__TreeNode_cleanup(__sn__TreeNode *p) {
+
+}
+
+#define sn_auto_TreeNode __attribute__((cleanup(__sn__TreeNode_cleanup)))
+
+static inline void __sn__TreeNode_cleanup_elem(void *p) { __sn__TreeNode_cleanup((__sn__TreeNode *)p); }
+static inline void __sn__TreeNode_copy_into(const void *src, void *dst) { *(__sn__TreeNode *)dst = __sn__TreeNode_copy((const __sn__TreeNode *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__TreeNode *__sn__TreeNode_alloc(void) {
+    return calloc(1, sizeof(__sn__TreeNode));
+}
+
+static inline void __sn__TreeNode_release(__sn__TreeNode **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_TreeNode __attribute__((cleanup(__sn__TreeNode_release)))
+
+static inline void __sn__TreeNode_release_elem(void *p) { __sn__TreeNode_release((__sn__TreeNode **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__TreeNode_to_string(const __sn__TreeNode *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "TreeNode { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "depth: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__depth);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+/* Struct: Counter (as val) */
+typedef struct {
+    long long __sn__current;
+    long long __sn__max;
+} __sn__Counter;
+/* Value operations */
+static inline __sn__Counter __sn__Counter_copy(const __sn__Counter *src) {
+    __sn__Counter dst;
+    dst.__sn__current = src->__sn__current;
+    dst.__sn__max = src->__sn__max;
+    return dst;
+}
+
+static inline void __sn__Counter_cleanup(__sn__Counter *p) {
+
+}
+
+#define sn_auto_Counter __attribute__((cleanup(__sn__Counter_cleanup)))
+
+static inline void __sn__Counter_cleanup_elem(void *p) { __sn__Counter_cleanup((__sn__Counter *)p); }
+static inline void __sn__Counter_copy_into(const void *src, void *dst) { *(__sn__Counter *)dst = __sn__Counter_copy((const __sn__Counter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Counter *__sn__Counter_alloc(void) {
+    return calloc(1, sizeof(__sn__Counter));
+}
+
+static inline void __sn__Counter_release(__sn__Counter **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Counter __attribute__((cleanup(__sn__Counter_release)))
+
+static inline void __sn__Counter_release_elem(void *p) { __sn__Counter_release((__sn__Counter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Counter_to_string(const __sn__Counter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Counter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "current: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__current);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "max: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__max);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+/* Struct: DataBundle (as val) */
+typedef struct {
+    long long __sn__id;
+    long long __sn__sum;
+} __sn__DataBundle;
+/* Value operations */
+static inline __sn__DataBundle __sn__DataBundle_copy(const __sn__DataBundle *src) {
+    __sn__DataBundle dst;
+    dst.__sn__id = src->__sn__id;
+    dst.__sn__sum = src->__sn__sum;
+    return dst;
+}
+
+static inline void __sn__DataBundle_cleanup(__sn__DataBundle *p) {
+
+}
+
+#define sn_auto_DataBundle __attribute__((cleanup(__sn__DataBundle_cleanup)))
+
+static inline void __sn__DataBundle_cleanup_elem(void *p) { __sn__DataBundle_cleanup((__sn__DataBundle *)p); }
+static inline void __sn__DataBundle_copy_into(const void *src, void *dst) { *(__sn__DataBundle *)dst = __sn__DataBundle_copy((const __sn__DataBundle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__DataBundle *__sn__DataBundle_alloc(void) {
+    return calloc(1, sizeof(__sn__DataBundle));
+}
+
+static inline void __sn__DataBundle_release(__sn__DataBundle **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_DataBundle __attribute__((cleanup(__sn__DataBundle_release)))
+
+static inline void __sn__DataBundle_release_elem(void *p) { __sn__DataBundle_release((__sn__DataBundle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__DataBundle_to_string(const __sn__DataBundle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "DataBundle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__id);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "sum: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__sum);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+/* Struct: StateHolder (as val) */
+typedef struct {
+    long long __sn__level;
+    long long __sn__nestedValue;
+} __sn__StateHolder;
+/* Value operations */
+static inline __sn__StateHolder __sn__StateHolder_copy(const __sn__StateHolder *src) {
+    __sn__StateHolder dst;
+    dst.__sn__level = src->__sn__level;
+    dst.__sn__nestedValue = src->__sn__nestedValue;
+    return dst;
+}
+
+static inline void __sn__StateHolder_cleanup(__sn__StateHolder *p) {
+
+}
+
+#define sn_auto_StateHolder __attribute__((cleanup(__sn__StateHolder_cleanup)))
+
+static inline void __sn__StateHolder_cleanup_elem(void *p) { __sn__StateHolder_cleanup((__sn__StateHolder *)p); }
+static inline void __sn__StateHolder_copy_into(const void *src, void *dst) { *(__sn__StateHolder *)dst = __sn__StateHolder_copy((const __sn__StateHolder *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__StateHolder *__sn__StateHolder_alloc(void) {
+    return calloc(1, sizeof(__sn__StateHolder));
+}
+
+static inline void __sn__StateHolder_release(__sn__StateHolder **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_StateHolder __attribute__((cleanup(__sn__StateHolder_release)))
+
+static inline void __sn__StateHolder_release_elem(void *p) { __sn__StateHolder_release((__sn__StateHolder **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__StateHolder_to_string(const __sn__StateHolder *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "StateHolder { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "level: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__level);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "nestedValue: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__nestedValue);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+/* Struct: State (as val) */
+typedef struct {
+    long long __sn__value;
+    char * __sn__name;
+} __sn__State;
+/* Value operations */
+static inline __sn__State __sn__State_copy(const __sn__State *src) {
+    __sn__State dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__State_cleanup(__sn__State *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_State __attribute__((cleanup(__sn__State_cleanup)))
+
+static inline void __sn__State_cleanup_elem(void *p) { __sn__State_cleanup((__sn__State *)p); }
+static inline void __sn__State_copy_into(const void *src, void *dst) { *(__sn__State *)dst = __sn__State_copy((const __sn__State *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__State *__sn__State_alloc(void) {
+    return calloc(1, sizeof(__sn__State));
+}
+
+static inline void __sn__State_release(__sn__State **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_State __attribute__((cleanup(__sn__State_release)))
+
+static inline void __sn__State_release_elem(void *p) { __sn__State_release((__sn__State **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__State_to_string(const __sn__State *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "State { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+extern /* static */ long long __sn__level_01__staticCounter;
+extern long long __sn__L1__instanceCounter;
+extern /* static */ long long __sn__level_02__staticCounter;
+extern long long __sn__L1__level_02__instanceCounter;
+extern /* static */ long long __sn__level_03__staticCounter;
+extern /* static */ SnArray * __sn__level_03__staticArray;
+extern long long __sn__L1__level_02__L3__instanceCounter;
+extern /* static */ long long __sn__level_04__staticCounter;
+extern long long __sn__L1__level_02__L3__level_04__instanceCounter;
+extern /* static */ long long __sn__level_05__staticCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__instanceCounter;
+extern __sn__TreeNode __sn__L1__level_02__L3__level_04__L5__rootNode;
+extern /* static */ long long __sn__level_06__staticCounter;
+extern /* static */ char * __sn__level_06__staticMessage;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__instanceCounter;
+extern /* static */ long long __sn__level_07__staticCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__instanceCounter;
+extern /* static */ long long __sn__level_08__staticCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__instanceCounter;
+extern __sn__Counter __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter;
+extern /* static */ long long __sn__level_09__staticCounter;
+extern /* static */ bool __sn__level_09__staticFlag;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__instanceCounter;
+extern /* static */ long long __sn__level_10__staticCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__instanceCounter;
+extern /* static */ long long __sn__level_11__staticCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__instanceCounter;
+extern /* static */ long long __sn__level_12__staticCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__instanceCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel;
+extern /* static */ long long __sn__level_13__staticCounter;
+extern /* static */ char * __sn__level_13__staticName;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter;
+extern /* static */ long long __sn__level_14__staticCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter;
+extern /* static */ long long __sn__level_15__staticCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__instanceCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__holderLevel;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__instanceCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__instanceCounter;
+extern long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1__level_02__L3__level_04__DirectL14__instanceCounter;
+extern long long __sn__L1__level_02__L3__level_04__DirectL14__L15__instanceCounter;
+extern long long __sn__L1__level_02__JumpL9__instanceCounter;
+extern long long __sn__L1__level_02__JumpL9__level_10__instanceCounter;
+extern long long __sn__L1__level_02__JumpL9__level_10__L11__instanceCounter;
+extern long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__instanceCounter;
+extern long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__holderLevel;
+extern long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__instanceCounter;
+extern long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__instanceCounter;
+extern long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1__level_02__JumpL9__level_10__DirectL15__instanceCounter;
+extern long long __sn__L1__level_02__DirectL15__instanceCounter;
+extern long long __sn__L1__AliasL7__instanceCounter;
+extern long long __sn__L1__AliasL7__level_08__instanceCounter;
+extern __sn__Counter __sn__L1__AliasL7__level_08__sharedCounter;
+extern long long __sn__L1__AliasL7__level_08__L9__instanceCounter;
+extern long long __sn__L1__AliasL7__level_08__L9__level_10__instanceCounter;
+extern long long __sn__L1__AliasL7__level_08__L9__level_10__L11__instanceCounter;
+extern long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__instanceCounter;
+extern long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__holderLevel;
+extern long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__instanceCounter;
+extern long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter;
+extern long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__instanceCounter;
+extern long long __sn__L1__AliasL7__JumpL12__instanceCounter;
+extern long long __sn__L1__AliasL7__JumpL12__holderLevel;
+extern long long __sn__L1__AliasL7__JumpL12__L13__instanceCounter;
+extern long long __sn__L1__AliasL7__JumpL12__L13__level_14__instanceCounter;
+extern long long __sn__L1__AliasL7__JumpL12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1__AliasL11__instanceCounter;
+extern long long __sn__L1__AliasL11__level_12__instanceCounter;
+extern long long __sn__L1__AliasL11__level_12__holderLevel;
+extern long long __sn__L1__AliasL11__level_12__L13__instanceCounter;
+extern long long __sn__L1__AliasL11__level_12__L13__level_14__instanceCounter;
+extern long long __sn__L1__AliasL11__level_12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1__AliasL15__instanceCounter;
+extern long long __sn__L1_alias__instanceCounter;
+extern long long __sn__L1_alias__level_02__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__instanceCounter;
+extern __sn__TreeNode __sn__L1_alias__level_02__L3__level_04__L5__rootNode;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__instanceCounter;
+extern __sn__Counter __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__holderLevel;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__DirectL14__instanceCounter;
+extern long long __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__instanceCounter;
+extern long long __sn__L1_alias__level_02__JumpL9__instanceCounter;
+extern long long __sn__L1_alias__level_02__JumpL9__level_10__instanceCounter;
+extern long long __sn__L1_alias__level_02__JumpL9__level_10__L11__instanceCounter;
+extern long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__instanceCounter;
+extern long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__holderLevel;
+extern long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__instanceCounter;
+extern long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__instanceCounter;
+extern long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__instanceCounter;
+extern long long __sn__L1_alias__level_02__DirectL15__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__level_08__instanceCounter;
+extern __sn__Counter __sn__L1_alias__AliasL7__level_08__sharedCounter;
+extern long long __sn__L1_alias__AliasL7__level_08__L9__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__level_08__L9__level_10__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__holderLevel;
+extern long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__JumpL12__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__JumpL12__holderLevel;
+extern long long __sn__L1_alias__AliasL7__JumpL12__L13__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__instanceCounter;
+extern long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1_alias__AliasL11__instanceCounter;
+extern long long __sn__L1_alias__AliasL11__level_12__instanceCounter;
+extern long long __sn__L1_alias__AliasL11__level_12__holderLevel;
+extern long long __sn__L1_alias__AliasL11__level_12__L13__instanceCounter;
+extern long long __sn__L1_alias__AliasL11__level_12__L13__level_14__instanceCounter;
+extern long long __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__instanceCounter;
+extern long long __sn__L1_alias__AliasL15__instanceCounter;
+extern long long __sn__MainL5__instanceCounter;
+extern __sn__TreeNode __sn__MainL5__rootNode;
+extern long long __sn__MainL5__level_06__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__level_08__instanceCounter;
+extern __sn__Counter __sn__MainL5__level_06__L7__level_08__sharedCounter;
+extern long long __sn__MainL5__level_06__L7__level_08__L9__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__level_08__L9__level_10__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__holderLevel;
+extern long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__JumpL12__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__JumpL12__holderLevel;
+extern long long __sn__MainL5__level_06__L7__JumpL12__L13__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__instanceCounter;
+extern long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__instanceCounter;
+extern long long __sn__MainL10__instanceCounter;
+extern long long __sn__MainL10__L11__instanceCounter;
+extern long long __sn__MainL10__L11__level_12__instanceCounter;
+extern long long __sn__MainL10__L11__level_12__holderLevel;
+extern long long __sn__MainL10__L11__level_12__L13__instanceCounter;
+extern long long __sn__MainL10__L11__level_12__L13__level_14__instanceCounter;
+extern long long __sn__MainL10__L11__level_12__L13__level_14__L15__instanceCounter;
+extern long long __sn__MainL10__DirectL15__instanceCounter;
+extern long long __sn__MainL15__instanceCounter;
+extern long long __sn__MainL15_alias__instanceCounter;
+
+__sn__Summary __sn__L1__createSummary();
+long long __sn__L1__getStaticCounter();
+void __sn__L1__incrementStatic();
+long long __sn__L1__getInstanceCounter();
+void __sn__L1__setInstanceCounter(long long);
+long long __sn__L1__getDeepStatic();
+long long __sn__L1__getLevelId();
+long long __sn__L1__computeChainValue(long long);
+long long __sn__L1__getAliasL7Static();
+long long __sn__L1__getAliasL11Static();
+long long __sn__L1__getAliasL15Static();
+void __sn__L1__incrementL15Static();
+long long __sn__L1__getAggregateLocalVal();
+bool __sn__L1__getL9FlagViaL2();
+void __sn__L1__toggleL9FlagViaL2();
+__sn__AggregateState __sn__L1__level_02__createAggregate();
+long long __sn__L1__level_02__getStaticCounter();
+void __sn__L1__level_02__incrementStatic();
+long long __sn__L1__level_02__getInstanceCounter();
+long long __sn__L1__level_02__getDeepStatic();
+long long __sn__L1__level_02__getJumpL9Static();
+long long __sn__L1__level_02__getDirectL15Static();
+long long __sn__L1__level_02__getLevelId();
+long long __sn__L1__level_02__computeChainValue(long long);
+long long __sn__L1__level_02__getStaticArraySumViaL3();
+void __sn__L1__level_02__toggleL9Flag();
+bool __sn__L1__level_02__getL9Flag();
+long long __sn__L1__level_02__L3__getStaticCounter();
+long long __sn__L1__level_02__L3__getStaticArraySum();
+void __sn__L1__level_02__L3__incrementStatic();
+long long __sn__L1__level_02__L3__getInstanceCounter();
+long long __sn__L1__level_02__L3__getDeepStatic();
+long long __sn__L1__level_02__L3__getLevelId();
+long long __sn__L1__level_02__L3__computeChainValue(long long);
+long long __sn__L1__level_02__L3__getDirectL14ViaL4();
+long long __sn__L1__level_02__L3__getHolderLevelViaL4(long long);
+long long __sn__L1__level_02__L3__level_04__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__getDirectL14Static();
+long long __sn__L1__level_02__L3__level_04__getLevelId();
+long long __sn__L1__level_02__L3__level_04__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__getRootViaChain();
+void __sn__L1__level_02__L3__level_04__setRootViaChain(long long);
+long long __sn__L1__level_02__L3__level_04__createDirectHolder(long long);
+long long __sn__L1__level_02__L3__level_04__L5__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__getRootValue();
+void __sn__L1__level_02__L3__level_04__L5__setRootValue(long long);
+char * __sn__L1__level_02__L3__level_04__L5__getDeepMessage();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__getStaticCounter();
+char * __sn__L1__level_02__L3__level_04__L5__level_06__getStaticMessage();
+void __sn__L1__level_02__L3__level_04__L5__level_06__setStaticMessage(char *);
+void __sn__L1__level_02__L3__level_04__L5__level_06__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__getJumpStaticViaL7();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getJumpStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__computeChainValue(long long);
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__incrementSharedViaChain();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__getSharedViaChain();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__computeChainValue(long long);
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__incrementSharedCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getSharedCounterValue();
+bool __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getDeepFlag();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticCounter();
+bool __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticFlag();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__toggleStaticFlag();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__computeChainValue(long long);
+bool __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__verifyDeepDirectAccess();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getDirectDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getBundleId();
+bool __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__verifyDirectAccess();
+__sn__DataBundle __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__createBundle();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getAllStaticSum();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getHolderLevel();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter();
+char * __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticName();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getInstanceCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__setInstanceCounter(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long);
+__sn__State __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__createState(long long, char *);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getInstanceCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__setInstanceCounter(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getAllStaticSum();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__getHolderLevel();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticCounter();
+char * __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticName();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getInstanceCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__setInstanceCounter(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__createHolder(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getDeepStatic();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__incrementDeepStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getLevelId();
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__computeChainValue(long long);
+__sn__StateHolder __sn__L1__level_02__L3__level_04__DirectL14__createHolder(long long);
+long long __sn__L1__level_02__L3__level_04__DirectL14__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__DirectL14__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__DirectL14__getInstanceCounter();
+long long __sn__L1__level_02__L3__level_04__DirectL14__getDeepStatic();
+void __sn__L1__level_02__L3__level_04__DirectL14__incrementDeepStatic();
+long long __sn__L1__level_02__L3__level_04__DirectL14__getLevelId();
+long long __sn__L1__level_02__L3__level_04__DirectL14__computeChainValue(long long);
+long long __sn__L1__level_02__L3__level_04__DirectL14__getDeepLevelId();
+__sn__State __sn__L1__level_02__L3__level_04__DirectL14__L15__createState(long long, char *);
+long long __sn__L1__level_02__L3__level_04__DirectL14__L15__getStaticCounter();
+void __sn__L1__level_02__L3__level_04__DirectL14__L15__incrementStatic();
+long long __sn__L1__level_02__L3__level_04__DirectL14__L15__getInstanceCounter();
+void __sn__L1__level_02__L3__level_04__DirectL14__L15__setInstanceCounter(long long);
+long long __sn__L1__level_02__L3__level_04__DirectL14__L15__getLevelId();
+long long __sn__L1__level_02__L3__level_04__DirectL14__L15__computeChainValue(long long);
+long long __sn__L1__level_02__JumpL9__getStaticCounter();
+bool __sn__L1__level_02__JumpL9__getStaticFlag();
+void __sn__L1__level_02__JumpL9__toggleStaticFlag();
+void __sn__L1__level_02__JumpL9__incrementStatic();
+long long __sn__L1__level_02__JumpL9__getInstanceCounter();
+long long __sn__L1__level_02__JumpL9__getDeepStatic();
+long long __sn__L1__level_02__JumpL9__getLevelId();
+long long __sn__L1__level_02__JumpL9__computeChainValue(long long);
+bool __sn__L1__level_02__JumpL9__verifyDeepDirectAccess();
+long long __sn__L1__level_02__JumpL9__level_10__getStaticCounter();
+void __sn__L1__level_02__JumpL9__level_10__incrementStatic();
+long long __sn__L1__level_02__JumpL9__level_10__getInstanceCounter();
+long long __sn__L1__level_02__JumpL9__level_10__getDeepStatic();
+long long __sn__L1__level_02__JumpL9__level_10__getDirectDeepStatic();
+long long __sn__L1__level_02__JumpL9__level_10__getLevelId();
+long long __sn__L1__level_02__JumpL9__level_10__computeChainValue(long long);
+long long __sn__L1__level_02__JumpL9__level_10__getBundleId();
+bool __sn__L1__level_02__JumpL9__level_10__verifyDirectAccess();
+__sn__DataBundle __sn__L1__level_02__JumpL9__level_10__L11__createBundle();
+long long __sn__L1__level_02__JumpL9__level_10__L11__getStaticCounter();
+void __sn__L1__level_02__JumpL9__level_10__L11__incrementStatic();
+long long __sn__L1__level_02__JumpL9__level_10__L11__getInstanceCounter();
+long long __sn__L1__level_02__JumpL9__level_10__L11__getDeepStatic();
+long long __sn__L1__level_02__JumpL9__level_10__L11__getLevelId();
+long long __sn__L1__level_02__JumpL9__level_10__L11__computeChainValue(long long);
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getStaticCounter();
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__incrementStatic();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getInstanceCounter();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getDeepStatic();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getAllStaticSum();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getLevelId();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__computeChainValue(long long);
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__getHolderLevel();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getStaticCounter();
+char * __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getStaticName();
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__incrementStatic();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getInstanceCounter();
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__setInstanceCounter(long long);
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getDeepStatic();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getDeepDeepStatic();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__getLevelId();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__computeChainValue(long long);
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__createHolder(long long);
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getStaticCounter();
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__incrementStatic();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getDeepStatic();
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getLevelId();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long);
+__sn__State __sn__L1__level_02__JumpL9__level_10__DirectL15__createState(long long, char *);
+long long __sn__L1__level_02__JumpL9__level_10__DirectL15__getStaticCounter();
+void __sn__L1__level_02__JumpL9__level_10__DirectL15__incrementStatic();
+long long __sn__L1__level_02__JumpL9__level_10__DirectL15__getInstanceCounter();
+void __sn__L1__level_02__JumpL9__level_10__DirectL15__setInstanceCounter(long long);
+long long __sn__L1__level_02__JumpL9__level_10__DirectL15__getLevelId();
+long long __sn__L1__level_02__JumpL9__level_10__DirectL15__computeChainValue(long long);
+__sn__State __sn__L1__level_02__DirectL15__createState(long long, char *);
+long long __sn__L1__level_02__DirectL15__getStaticCounter();
+void __sn__L1__level_02__DirectL15__incrementStatic();
+long long __sn__L1__level_02__DirectL15__getInstanceCounter();
+void __sn__L1__level_02__DirectL15__setInstanceCounter(long long);
+long long __sn__L1__level_02__DirectL15__getLevelId();
+long long __sn__L1__level_02__DirectL15__computeChainValue(long long);
+long long __sn__L1__AliasL7__getStaticCounter();
+void __sn__L1__AliasL7__incrementStatic();
+long long __sn__L1__AliasL7__getInstanceCounter();
+long long __sn__L1__AliasL7__getDeepStatic();
+long long __sn__L1__AliasL7__getJumpStatic();
+long long __sn__L1__AliasL7__getLevelId();
+long long __sn__L1__AliasL7__computeChainValue(long long);
+void __sn__L1__AliasL7__incrementSharedViaChain();
+long long __sn__L1__AliasL7__getSharedViaChain();
+long long __sn__L1__AliasL7__level_08__getStaticCounter();
+void __sn__L1__AliasL7__level_08__incrementStatic();
+long long __sn__L1__AliasL7__level_08__getInstanceCounter();
+long long __sn__L1__AliasL7__level_08__getDeepStatic();
+long long __sn__L1__AliasL7__level_08__getLevelId();
+long long __sn__L1__AliasL7__level_08__computeChainValue(long long);
+void __sn__L1__AliasL7__level_08__incrementSharedCounter();
+long long __sn__L1__AliasL7__level_08__getSharedCounterValue();
+bool __sn__L1__AliasL7__level_08__getDeepFlag();
+long long __sn__L1__AliasL7__level_08__L9__getStaticCounter();
+bool __sn__L1__AliasL7__level_08__L9__getStaticFlag();
+void __sn__L1__AliasL7__level_08__L9__toggleStaticFlag();
+void __sn__L1__AliasL7__level_08__L9__incrementStatic();
+long long __sn__L1__AliasL7__level_08__L9__getInstanceCounter();
+long long __sn__L1__AliasL7__level_08__L9__getDeepStatic();
+long long __sn__L1__AliasL7__level_08__L9__getLevelId();
+long long __sn__L1__AliasL7__level_08__L9__computeChainValue(long long);
+bool __sn__L1__AliasL7__level_08__L9__verifyDeepDirectAccess();
+long long __sn__L1__AliasL7__level_08__L9__level_10__getStaticCounter();
+void __sn__L1__AliasL7__level_08__L9__level_10__incrementStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__getInstanceCounter();
+long long __sn__L1__AliasL7__level_08__L9__level_10__getDeepStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__getDirectDeepStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__getLevelId();
+long long __sn__L1__AliasL7__level_08__L9__level_10__computeChainValue(long long);
+long long __sn__L1__AliasL7__level_08__L9__level_10__getBundleId();
+bool __sn__L1__AliasL7__level_08__L9__level_10__verifyDirectAccess();
+__sn__DataBundle __sn__L1__AliasL7__level_08__L9__level_10__L11__createBundle();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__getStaticCounter();
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__incrementStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__getInstanceCounter();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__getDeepStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__getLevelId();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__computeChainValue(long long);
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getStaticCounter();
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__incrementStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getInstanceCounter();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getDeepStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getAllStaticSum();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getLevelId();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__computeChainValue(long long);
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getHolderLevel();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter();
+char * __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticName();
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__incrementStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getInstanceCounter();
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__setInstanceCounter(long long);
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__getLevelId();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(long long);
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(long long);
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter();
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic();
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getLevelId();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long);
+__sn__State __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__createState(long long, char *);
+long long __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__getStaticCounter();
+void __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__incrementStatic();
+long long __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__getInstanceCounter();
+void __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__setInstanceCounter(long long);
+long long __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__getLevelId();
+long long __sn__L1__AliasL7__level_08__L9__level_10__DirectL15__computeChainValue(long long);
+long long __sn__L1__AliasL7__JumpL12__getStaticCounter();
+void __sn__L1__AliasL7__JumpL12__incrementStatic();
+long long __sn__L1__AliasL7__JumpL12__getInstanceCounter();
+long long __sn__L1__AliasL7__JumpL12__getDeepStatic();
+long long __sn__L1__AliasL7__JumpL12__getAllStaticSum();
+long long __sn__L1__AliasL7__JumpL12__getLevelId();
+long long __sn__L1__AliasL7__JumpL12__computeChainValue(long long);
+long long __sn__L1__AliasL7__JumpL12__getHolderLevel();
+long long __sn__L1__AliasL7__JumpL12__L13__getStaticCounter();
+char * __sn__L1__AliasL7__JumpL12__L13__getStaticName();
+void __sn__L1__AliasL7__JumpL12__L13__incrementStatic();
+long long __sn__L1__AliasL7__JumpL12__L13__getInstanceCounter();
+void __sn__L1__AliasL7__JumpL12__L13__setInstanceCounter(long long);
+long long __sn__L1__AliasL7__JumpL12__L13__getDeepStatic();
+long long __sn__L1__AliasL7__JumpL12__L13__getDeepDeepStatic();
+long long __sn__L1__AliasL7__JumpL12__L13__getLevelId();
+long long __sn__L1__AliasL7__JumpL12__L13__computeChainValue(long long);
+long long __sn__L1__AliasL7__JumpL12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1__AliasL7__JumpL12__L13__level_14__createHolder(long long);
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__getStaticCounter();
+void __sn__L1__AliasL7__JumpL12__L13__level_14__incrementStatic();
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__getInstanceCounter();
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__getDeepStatic();
+void __sn__L1__AliasL7__JumpL12__L13__level_14__incrementDeepStatic();
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__getLevelId();
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__computeChainValue(long long);
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1__AliasL7__JumpL12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__L15__getStaticCounter();
+void __sn__L1__AliasL7__JumpL12__L13__level_14__L15__incrementStatic();
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1__AliasL7__JumpL12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__L15__getLevelId();
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__L15__computeChainValue(long long);
+__sn__DataBundle __sn__L1__AliasL11__createBundle();
+long long __sn__L1__AliasL11__getStaticCounter();
+void __sn__L1__AliasL11__incrementStatic();
+long long __sn__L1__AliasL11__getInstanceCounter();
+long long __sn__L1__AliasL11__getDeepStatic();
+long long __sn__L1__AliasL11__getLevelId();
+long long __sn__L1__AliasL11__computeChainValue(long long);
+long long __sn__L1__AliasL11__level_12__getStaticCounter();
+void __sn__L1__AliasL11__level_12__incrementStatic();
+long long __sn__L1__AliasL11__level_12__getInstanceCounter();
+long long __sn__L1__AliasL11__level_12__getDeepStatic();
+long long __sn__L1__AliasL11__level_12__getAllStaticSum();
+long long __sn__L1__AliasL11__level_12__getLevelId();
+long long __sn__L1__AliasL11__level_12__computeChainValue(long long);
+long long __sn__L1__AliasL11__level_12__getHolderLevel();
+long long __sn__L1__AliasL11__level_12__L13__getStaticCounter();
+char * __sn__L1__AliasL11__level_12__L13__getStaticName();
+void __sn__L1__AliasL11__level_12__L13__incrementStatic();
+long long __sn__L1__AliasL11__level_12__L13__getInstanceCounter();
+void __sn__L1__AliasL11__level_12__L13__setInstanceCounter(long long);
+long long __sn__L1__AliasL11__level_12__L13__getDeepStatic();
+long long __sn__L1__AliasL11__level_12__L13__getDeepDeepStatic();
+long long __sn__L1__AliasL11__level_12__L13__getLevelId();
+long long __sn__L1__AliasL11__level_12__L13__computeChainValue(long long);
+long long __sn__L1__AliasL11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1__AliasL11__level_12__L13__level_14__createHolder(long long);
+long long __sn__L1__AliasL11__level_12__L13__level_14__getStaticCounter();
+void __sn__L1__AliasL11__level_12__L13__level_14__incrementStatic();
+long long __sn__L1__AliasL11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__L1__AliasL11__level_12__L13__level_14__getDeepStatic();
+void __sn__L1__AliasL11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__L1__AliasL11__level_12__L13__level_14__getLevelId();
+long long __sn__L1__AliasL11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__L1__AliasL11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1__AliasL11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1__AliasL11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__L1__AliasL11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__L1__AliasL11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1__AliasL11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1__AliasL11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__L1__AliasL11__level_12__L13__level_14__L15__computeChainValue(long long);
+__sn__State __sn__L1__AliasL15__createState(long long, char *);
+long long __sn__L1__AliasL15__getStaticCounter();
+void __sn__L1__AliasL15__incrementStatic();
+long long __sn__L1__AliasL15__getInstanceCounter();
+void __sn__L1__AliasL15__setInstanceCounter(long long);
+long long __sn__L1__AliasL15__getLevelId();
+long long __sn__L1__AliasL15__computeChainValue(long long);
+__sn__Summary __sn__L1_alias__createSummary();
+long long __sn__L1_alias__getStaticCounter();
+void __sn__L1_alias__incrementStatic();
+long long __sn__L1_alias__getInstanceCounter();
+void __sn__L1_alias__setInstanceCounter(long long);
+long long __sn__L1_alias__getDeepStatic();
+long long __sn__L1_alias__getLevelId();
+long long __sn__L1_alias__computeChainValue(long long);
+long long __sn__L1_alias__getAliasL7Static();
+long long __sn__L1_alias__getAliasL11Static();
+long long __sn__L1_alias__getAliasL15Static();
+void __sn__L1_alias__incrementL15Static();
+long long __sn__L1_alias__getAggregateLocalVal();
+bool __sn__L1_alias__getL9FlagViaL2();
+void __sn__L1_alias__toggleL9FlagViaL2();
+__sn__AggregateState __sn__L1_alias__level_02__createAggregate();
+long long __sn__L1_alias__level_02__getStaticCounter();
+void __sn__L1_alias__level_02__incrementStatic();
+long long __sn__L1_alias__level_02__getInstanceCounter();
+long long __sn__L1_alias__level_02__getDeepStatic();
+long long __sn__L1_alias__level_02__getJumpL9Static();
+long long __sn__L1_alias__level_02__getDirectL15Static();
+long long __sn__L1_alias__level_02__getLevelId();
+long long __sn__L1_alias__level_02__computeChainValue(long long);
+long long __sn__L1_alias__level_02__getStaticArraySumViaL3();
+void __sn__L1_alias__level_02__toggleL9Flag();
+bool __sn__L1_alias__level_02__getL9Flag();
+long long __sn__L1_alias__level_02__L3__getStaticCounter();
+long long __sn__L1_alias__level_02__L3__getStaticArraySum();
+void __sn__L1_alias__level_02__L3__incrementStatic();
+long long __sn__L1_alias__level_02__L3__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__getLevelId();
+long long __sn__L1_alias__level_02__L3__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__getDirectL14ViaL4();
+long long __sn__L1_alias__level_02__L3__getHolderLevelViaL4(long long);
+long long __sn__L1_alias__level_02__L3__level_04__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__getDirectL14Static();
+long long __sn__L1_alias__level_02__L3__level_04__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__getRootViaChain();
+void __sn__L1_alias__level_02__L3__level_04__setRootViaChain(long long);
+long long __sn__L1_alias__level_02__L3__level_04__createDirectHolder(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__getRootValue();
+void __sn__L1_alias__level_02__L3__level_04__L5__setRootValue(long long);
+char * __sn__L1_alias__level_02__L3__level_04__L5__getDeepMessage();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__getStaticCounter();
+char * __sn__L1_alias__level_02__L3__level_04__L5__level_06__getStaticMessage();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__setStaticMessage(char *);
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__getJumpStaticViaL7();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getJumpStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__computeChainValue(long long);
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__incrementSharedViaChain();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__getSharedViaChain();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__computeChainValue(long long);
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__incrementSharedCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getSharedCounterValue();
+bool __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getDeepFlag();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticCounter();
+bool __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticFlag();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__toggleStaticFlag();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__computeChainValue(long long);
+bool __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__verifyDeepDirectAccess();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getDirectDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getBundleId();
+bool __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__verifyDirectAccess();
+__sn__DataBundle __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__createBundle();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getAllStaticSum();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getHolderLevel();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter();
+char * __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticName();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getInstanceCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__setInstanceCounter(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long);
+__sn__State __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__createState(long long, char *);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getInstanceCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__setInstanceCounter(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__DirectL15__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getAllStaticSum();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__getHolderLevel();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticCounter();
+char * __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getStaticName();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getInstanceCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__setInstanceCounter(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getDeepDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__createHolder(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getDeepStatic();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__incrementDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__computeChainValue(long long);
+__sn__StateHolder __sn__L1_alias__level_02__L3__level_04__DirectL14__createHolder(long long);
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__DirectL14__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__getInstanceCounter();
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__getDeepStatic();
+void __sn__L1_alias__level_02__L3__level_04__DirectL14__incrementDeepStatic();
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__computeChainValue(long long);
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__getDeepLevelId();
+__sn__State __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__createState(long long, char *);
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__getStaticCounter();
+void __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__incrementStatic();
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__getInstanceCounter();
+void __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__setInstanceCounter(long long);
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__getLevelId();
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__computeChainValue(long long);
+long long __sn__L1_alias__level_02__JumpL9__getStaticCounter();
+bool __sn__L1_alias__level_02__JumpL9__getStaticFlag();
+void __sn__L1_alias__level_02__JumpL9__toggleStaticFlag();
+void __sn__L1_alias__level_02__JumpL9__incrementStatic();
+long long __sn__L1_alias__level_02__JumpL9__getInstanceCounter();
+long long __sn__L1_alias__level_02__JumpL9__getDeepStatic();
+long long __sn__L1_alias__level_02__JumpL9__getLevelId();
+long long __sn__L1_alias__level_02__JumpL9__computeChainValue(long long);
+bool __sn__L1_alias__level_02__JumpL9__verifyDeepDirectAccess();
+long long __sn__L1_alias__level_02__JumpL9__level_10__getStaticCounter();
+void __sn__L1_alias__level_02__JumpL9__level_10__incrementStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__getInstanceCounter();
+long long __sn__L1_alias__level_02__JumpL9__level_10__getDeepStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__getDirectDeepStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__getLevelId();
+long long __sn__L1_alias__level_02__JumpL9__level_10__computeChainValue(long long);
+long long __sn__L1_alias__level_02__JumpL9__level_10__getBundleId();
+bool __sn__L1_alias__level_02__JumpL9__level_10__verifyDirectAccess();
+__sn__DataBundle __sn__L1_alias__level_02__JumpL9__level_10__L11__createBundle();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__getStaticCounter();
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__incrementStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__getInstanceCounter();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__getDeepStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__getLevelId();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__computeChainValue(long long);
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getStaticCounter();
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__incrementStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getInstanceCounter();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getDeepStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getAllStaticSum();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getLevelId();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__computeChainValue(long long);
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getHolderLevel();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getStaticCounter();
+char * __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getStaticName();
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__incrementStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getInstanceCounter();
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__setInstanceCounter(long long);
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getDeepStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getDeepDeepStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__getLevelId();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__computeChainValue(long long);
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__createHolder(long long);
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getStaticCounter();
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__incrementStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getDeepStatic();
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getLevelId();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long);
+__sn__State __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__createState(long long, char *);
+long long __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__getStaticCounter();
+void __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__incrementStatic();
+long long __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__getInstanceCounter();
+void __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__setInstanceCounter(long long);
+long long __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__getLevelId();
+long long __sn__L1_alias__level_02__JumpL9__level_10__DirectL15__computeChainValue(long long);
+__sn__State __sn__L1_alias__level_02__DirectL15__createState(long long, char *);
+long long __sn__L1_alias__level_02__DirectL15__getStaticCounter();
+void __sn__L1_alias__level_02__DirectL15__incrementStatic();
+long long __sn__L1_alias__level_02__DirectL15__getInstanceCounter();
+void __sn__L1_alias__level_02__DirectL15__setInstanceCounter(long long);
+long long __sn__L1_alias__level_02__DirectL15__getLevelId();
+long long __sn__L1_alias__level_02__DirectL15__computeChainValue(long long);
+long long __sn__L1_alias__AliasL7__getStaticCounter();
+void __sn__L1_alias__AliasL7__incrementStatic();
+long long __sn__L1_alias__AliasL7__getInstanceCounter();
+long long __sn__L1_alias__AliasL7__getDeepStatic();
+long long __sn__L1_alias__AliasL7__getJumpStatic();
+long long __sn__L1_alias__AliasL7__getLevelId();
+long long __sn__L1_alias__AliasL7__computeChainValue(long long);
+void __sn__L1_alias__AliasL7__incrementSharedViaChain();
+long long __sn__L1_alias__AliasL7__getSharedViaChain();
+long long __sn__L1_alias__AliasL7__level_08__getStaticCounter();
+void __sn__L1_alias__AliasL7__level_08__incrementStatic();
+long long __sn__L1_alias__AliasL7__level_08__getInstanceCounter();
+long long __sn__L1_alias__AliasL7__level_08__getDeepStatic();
+long long __sn__L1_alias__AliasL7__level_08__getLevelId();
+long long __sn__L1_alias__AliasL7__level_08__computeChainValue(long long);
+void __sn__L1_alias__AliasL7__level_08__incrementSharedCounter();
+long long __sn__L1_alias__AliasL7__level_08__getSharedCounterValue();
+bool __sn__L1_alias__AliasL7__level_08__getDeepFlag();
+long long __sn__L1_alias__AliasL7__level_08__L9__getStaticCounter();
+bool __sn__L1_alias__AliasL7__level_08__L9__getStaticFlag();
+void __sn__L1_alias__AliasL7__level_08__L9__toggleStaticFlag();
+void __sn__L1_alias__AliasL7__level_08__L9__incrementStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__getInstanceCounter();
+long long __sn__L1_alias__AliasL7__level_08__L9__getDeepStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__getLevelId();
+long long __sn__L1_alias__AliasL7__level_08__L9__computeChainValue(long long);
+bool __sn__L1_alias__AliasL7__level_08__L9__verifyDeepDirectAccess();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getStaticCounter();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__incrementStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getInstanceCounter();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getDeepStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getDirectDeepStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getLevelId();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__computeChainValue(long long);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__getBundleId();
+bool __sn__L1_alias__AliasL7__level_08__L9__level_10__verifyDirectAccess();
+__sn__DataBundle __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__createBundle();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__getStaticCounter();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__incrementStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__getInstanceCounter();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__getDeepStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__getLevelId();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__computeChainValue(long long);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getStaticCounter();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__incrementStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getInstanceCounter();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getDeepStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getAllStaticSum();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getLevelId();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__computeChainValue(long long);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getHolderLevel();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter();
+char * __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getStaticName();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__incrementStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getInstanceCounter();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__setInstanceCounter(long long);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__getLevelId();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(long long);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(long long);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getLevelId();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long);
+__sn__State __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__createState(long long, char *);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__getStaticCounter();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__incrementStatic();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__getInstanceCounter();
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__setInstanceCounter(long long);
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__getLevelId();
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__DirectL15__computeChainValue(long long);
+long long __sn__L1_alias__AliasL7__JumpL12__getStaticCounter();
+void __sn__L1_alias__AliasL7__JumpL12__incrementStatic();
+long long __sn__L1_alias__AliasL7__JumpL12__getInstanceCounter();
+long long __sn__L1_alias__AliasL7__JumpL12__getDeepStatic();
+long long __sn__L1_alias__AliasL7__JumpL12__getAllStaticSum();
+long long __sn__L1_alias__AliasL7__JumpL12__getLevelId();
+long long __sn__L1_alias__AliasL7__JumpL12__computeChainValue(long long);
+long long __sn__L1_alias__AliasL7__JumpL12__getHolderLevel();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__getStaticCounter();
+char * __sn__L1_alias__AliasL7__JumpL12__L13__getStaticName();
+void __sn__L1_alias__AliasL7__JumpL12__L13__incrementStatic();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__getInstanceCounter();
+void __sn__L1_alias__AliasL7__JumpL12__L13__setInstanceCounter(long long);
+long long __sn__L1_alias__AliasL7__JumpL12__L13__getDeepStatic();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__getDeepDeepStatic();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__getLevelId();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__computeChainValue(long long);
+long long __sn__L1_alias__AliasL7__JumpL12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1_alias__AliasL7__JumpL12__L13__level_14__createHolder(long long);
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getStaticCounter();
+void __sn__L1_alias__AliasL7__JumpL12__L13__level_14__incrementStatic();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getInstanceCounter();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getDeepStatic();
+void __sn__L1_alias__AliasL7__JumpL12__L13__level_14__incrementDeepStatic();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getLevelId();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__computeChainValue(long long);
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__getStaticCounter();
+void __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__incrementStatic();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__getLevelId();
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__computeChainValue(long long);
+__sn__DataBundle __sn__L1_alias__AliasL11__createBundle();
+long long __sn__L1_alias__AliasL11__getStaticCounter();
+void __sn__L1_alias__AliasL11__incrementStatic();
+long long __sn__L1_alias__AliasL11__getInstanceCounter();
+long long __sn__L1_alias__AliasL11__getDeepStatic();
+long long __sn__L1_alias__AliasL11__getLevelId();
+long long __sn__L1_alias__AliasL11__computeChainValue(long long);
+long long __sn__L1_alias__AliasL11__level_12__getStaticCounter();
+void __sn__L1_alias__AliasL11__level_12__incrementStatic();
+long long __sn__L1_alias__AliasL11__level_12__getInstanceCounter();
+long long __sn__L1_alias__AliasL11__level_12__getDeepStatic();
+long long __sn__L1_alias__AliasL11__level_12__getAllStaticSum();
+long long __sn__L1_alias__AliasL11__level_12__getLevelId();
+long long __sn__L1_alias__AliasL11__level_12__computeChainValue(long long);
+long long __sn__L1_alias__AliasL11__level_12__getHolderLevel();
+long long __sn__L1_alias__AliasL11__level_12__L13__getStaticCounter();
+char * __sn__L1_alias__AliasL11__level_12__L13__getStaticName();
+void __sn__L1_alias__AliasL11__level_12__L13__incrementStatic();
+long long __sn__L1_alias__AliasL11__level_12__L13__getInstanceCounter();
+void __sn__L1_alias__AliasL11__level_12__L13__setInstanceCounter(long long);
+long long __sn__L1_alias__AliasL11__level_12__L13__getDeepStatic();
+long long __sn__L1_alias__AliasL11__level_12__L13__getDeepDeepStatic();
+long long __sn__L1_alias__AliasL11__level_12__L13__getLevelId();
+long long __sn__L1_alias__AliasL11__level_12__L13__computeChainValue(long long);
+long long __sn__L1_alias__AliasL11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__L1_alias__AliasL11__level_12__L13__level_14__createHolder(long long);
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__getStaticCounter();
+void __sn__L1_alias__AliasL11__level_12__L13__level_14__incrementStatic();
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__getDeepStatic();
+void __sn__L1_alias__AliasL11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__getLevelId();
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__computeChainValue(long long);
+__sn__State __sn__L1_alias__AliasL15__createState(long long, char *);
+long long __sn__L1_alias__AliasL15__getStaticCounter();
+void __sn__L1_alias__AliasL15__incrementStatic();
+long long __sn__L1_alias__AliasL15__getInstanceCounter();
+void __sn__L1_alias__AliasL15__setInstanceCounter(long long);
+long long __sn__L1_alias__AliasL15__getLevelId();
+long long __sn__L1_alias__AliasL15__computeChainValue(long long);
+long long __sn__MainL5__getStaticCounter();
+void __sn__MainL5__incrementStatic();
+long long __sn__MainL5__getInstanceCounter();
+long long __sn__MainL5__getDeepStatic();
+long long __sn__MainL5__getLevelId();
+long long __sn__MainL5__computeChainValue(long long);
+long long __sn__MainL5__getRootValue();
+void __sn__MainL5__setRootValue(long long);
+char * __sn__MainL5__getDeepMessage();
+long long __sn__MainL5__level_06__getStaticCounter();
+char * __sn__MainL5__level_06__getStaticMessage();
+void __sn__MainL5__level_06__setStaticMessage(char *);
+void __sn__MainL5__level_06__incrementStatic();
+long long __sn__MainL5__level_06__getInstanceCounter();
+long long __sn__MainL5__level_06__getDeepStatic();
+long long __sn__MainL5__level_06__getLevelId();
+long long __sn__MainL5__level_06__computeChainValue(long long);
+long long __sn__MainL5__level_06__getJumpStaticViaL7();
+long long __sn__MainL5__level_06__L7__getStaticCounter();
+void __sn__MainL5__level_06__L7__incrementStatic();
+long long __sn__MainL5__level_06__L7__getInstanceCounter();
+long long __sn__MainL5__level_06__L7__getDeepStatic();
+long long __sn__MainL5__level_06__L7__getJumpStatic();
+long long __sn__MainL5__level_06__L7__getLevelId();
+long long __sn__MainL5__level_06__L7__computeChainValue(long long);
+void __sn__MainL5__level_06__L7__incrementSharedViaChain();
+long long __sn__MainL5__level_06__L7__getSharedViaChain();
+long long __sn__MainL5__level_06__L7__level_08__getStaticCounter();
+void __sn__MainL5__level_06__L7__level_08__incrementStatic();
+long long __sn__MainL5__level_06__L7__level_08__getInstanceCounter();
+long long __sn__MainL5__level_06__L7__level_08__getDeepStatic();
+long long __sn__MainL5__level_06__L7__level_08__getLevelId();
+long long __sn__MainL5__level_06__L7__level_08__computeChainValue(long long);
+void __sn__MainL5__level_06__L7__level_08__incrementSharedCounter();
+long long __sn__MainL5__level_06__L7__level_08__getSharedCounterValue();
+bool __sn__MainL5__level_06__L7__level_08__getDeepFlag();
+long long __sn__MainL5__level_06__L7__level_08__L9__getStaticCounter();
+bool __sn__MainL5__level_06__L7__level_08__L9__getStaticFlag();
+void __sn__MainL5__level_06__L7__level_08__L9__toggleStaticFlag();
+void __sn__MainL5__level_06__L7__level_08__L9__incrementStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__getInstanceCounter();
+long long __sn__MainL5__level_06__L7__level_08__L9__getDeepStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__getLevelId();
+long long __sn__MainL5__level_06__L7__level_08__L9__computeChainValue(long long);
+bool __sn__MainL5__level_06__L7__level_08__L9__verifyDeepDirectAccess();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getStaticCounter();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__incrementStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getInstanceCounter();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getDeepStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getDirectDeepStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getLevelId();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__computeChainValue(long long);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__getBundleId();
+bool __sn__MainL5__level_06__L7__level_08__L9__level_10__verifyDirectAccess();
+__sn__DataBundle __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__createBundle();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__getStaticCounter();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__incrementStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__getInstanceCounter();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__getDeepStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__getLevelId();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__computeChainValue(long long);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getStaticCounter();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__incrementStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getInstanceCounter();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getDeepStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getAllStaticSum();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getLevelId();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__computeChainValue(long long);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getHolderLevel();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticCounter();
+char * __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getStaticName();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__incrementStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getInstanceCounter();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__setInstanceCounter(long long);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getDeepDeepStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__getLevelId();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__computeChainValue(long long);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(long long);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getLevelId();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(long long);
+__sn__State __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__createState(long long, char *);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__getStaticCounter();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__incrementStatic();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__getInstanceCounter();
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__setInstanceCounter(long long);
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__getLevelId();
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__DirectL15__computeChainValue(long long);
+long long __sn__MainL5__level_06__L7__JumpL12__getStaticCounter();
+void __sn__MainL5__level_06__L7__JumpL12__incrementStatic();
+long long __sn__MainL5__level_06__L7__JumpL12__getInstanceCounter();
+long long __sn__MainL5__level_06__L7__JumpL12__getDeepStatic();
+long long __sn__MainL5__level_06__L7__JumpL12__getAllStaticSum();
+long long __sn__MainL5__level_06__L7__JumpL12__getLevelId();
+long long __sn__MainL5__level_06__L7__JumpL12__computeChainValue(long long);
+long long __sn__MainL5__level_06__L7__JumpL12__getHolderLevel();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__getStaticCounter();
+char * __sn__MainL5__level_06__L7__JumpL12__L13__getStaticName();
+void __sn__MainL5__level_06__L7__JumpL12__L13__incrementStatic();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__getInstanceCounter();
+void __sn__MainL5__level_06__L7__JumpL12__L13__setInstanceCounter(long long);
+long long __sn__MainL5__level_06__L7__JumpL12__L13__getDeepStatic();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__getDeepDeepStatic();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__getLevelId();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__computeChainValue(long long);
+long long __sn__MainL5__level_06__L7__JumpL12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__MainL5__level_06__L7__JumpL12__L13__level_14__createHolder(long long);
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getStaticCounter();
+void __sn__MainL5__level_06__L7__JumpL12__L13__level_14__incrementStatic();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getInstanceCounter();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getDeepStatic();
+void __sn__MainL5__level_06__L7__JumpL12__L13__level_14__incrementDeepStatic();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getLevelId();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__computeChainValue(long long);
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getDeepLevelId();
+__sn__State __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__createState(long long, char *);
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__getStaticCounter();
+void __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__incrementStatic();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__getInstanceCounter();
+void __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__getLevelId();
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__computeChainValue(long long);
+long long __sn__MainL10__getStaticCounter();
+void __sn__MainL10__incrementStatic();
+long long __sn__MainL10__getInstanceCounter();
+long long __sn__MainL10__getDeepStatic();
+long long __sn__MainL10__getDirectDeepStatic();
+long long __sn__MainL10__getLevelId();
+long long __sn__MainL10__computeChainValue(long long);
+long long __sn__MainL10__getBundleId();
+bool __sn__MainL10__verifyDirectAccess();
+__sn__DataBundle __sn__MainL10__L11__createBundle();
+long long __sn__MainL10__L11__getStaticCounter();
+void __sn__MainL10__L11__incrementStatic();
+long long __sn__MainL10__L11__getInstanceCounter();
+long long __sn__MainL10__L11__getDeepStatic();
+long long __sn__MainL10__L11__getLevelId();
+long long __sn__MainL10__L11__computeChainValue(long long);
+long long __sn__MainL10__L11__level_12__getStaticCounter();
+void __sn__MainL10__L11__level_12__incrementStatic();
+long long __sn__MainL10__L11__level_12__getInstanceCounter();
+long long __sn__MainL10__L11__level_12__getDeepStatic();
+long long __sn__MainL10__L11__level_12__getAllStaticSum();
+long long __sn__MainL10__L11__level_12__getLevelId();
+long long __sn__MainL10__L11__level_12__computeChainValue(long long);
+long long __sn__MainL10__L11__level_12__getHolderLevel();
+long long __sn__MainL10__L11__level_12__L13__getStaticCounter();
+char * __sn__MainL10__L11__level_12__L13__getStaticName();
+void __sn__MainL10__L11__level_12__L13__incrementStatic();
+long long __sn__MainL10__L11__level_12__L13__getInstanceCounter();
+void __sn__MainL10__L11__level_12__L13__setInstanceCounter(long long);
+long long __sn__MainL10__L11__level_12__L13__getDeepStatic();
+long long __sn__MainL10__L11__level_12__L13__getDeepDeepStatic();
+long long __sn__MainL10__L11__level_12__L13__getLevelId();
+long long __sn__MainL10__L11__level_12__L13__computeChainValue(long long);
+long long __sn__MainL10__L11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__MainL10__L11__level_12__L13__level_14__createHolder(long long);
+long long __sn__MainL10__L11__level_12__L13__level_14__getStaticCounter();
+void __sn__MainL10__L11__level_12__L13__level_14__incrementStatic();
+long long __sn__MainL10__L11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__MainL10__L11__level_12__L13__level_14__getDeepStatic();
+void __sn__MainL10__L11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__MainL10__L11__level_12__L13__level_14__getLevelId();
+long long __sn__MainL10__L11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__MainL10__L11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__MainL10__L11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__MainL10__L11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__MainL10__L11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__MainL10__L11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__MainL10__L11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__MainL10__L11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__MainL10__L11__level_12__L13__level_14__L15__computeChainValue(long long);
+__sn__State __sn__MainL10__DirectL15__createState(long long, char *);
+long long __sn__MainL10__DirectL15__getStaticCounter();
+void __sn__MainL10__DirectL15__incrementStatic();
+long long __sn__MainL10__DirectL15__getInstanceCounter();
+void __sn__MainL10__DirectL15__setInstanceCounter(long long);
+long long __sn__MainL10__DirectL15__getLevelId();
+long long __sn__MainL10__DirectL15__computeChainValue(long long);
+__sn__State __sn__MainL15__createState(long long, char *);
+long long __sn__MainL15__getStaticCounter();
+void __sn__MainL15__incrementStatic();
+long long __sn__MainL15__getInstanceCounter();
+void __sn__MainL15__setInstanceCounter(long long);
+long long __sn__MainL15__getLevelId();
+long long __sn__MainL15__computeChainValue(long long);
+__sn__State __sn__MainL15_alias__createState(long long, char *);
+long long __sn__MainL15_alias__getStaticCounter();
+void __sn__MainL15_alias__incrementStatic();
+long long __sn__MainL15_alias__getInstanceCounter();
+void __sn__MainL15_alias__setInstanceCounter(long long);
+long long __sn__MainL15_alias__getLevelId();
+long long __sn__MainL15_alias__computeChainValue(long long);
+void __sn__test_basic_level_ids();
+void __sn__test_static_counters_initial();
+void __sn__test_static_shared_across_aliases();
+void __sn__test_instance_counters_separate();
+void __sn__test_chain_computation();
+void __sn__test_deep_static_access();
+void __sn__test_struct_creation_across_levels();
+void __sn__test_aggregate_state();
+void __sn__test_flag_toggle_across_chain();
+void __sn__test_direct_vs_chain_access();
+void __sn__test_module_struct_instances();
+void __sn__test_string_static_vars();
+void __sn__test_array_static_vars();
+void __sn__test_multiple_increment_chain();
+void __sn__test_cross_level_struct_creation();
+void __sn__test_bundle_creation();
+
+
+
+
+#endif
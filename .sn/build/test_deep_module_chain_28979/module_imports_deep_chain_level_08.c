@@ -0,0 +1,250 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getStaticCounter() {
+
+    return __sn__level_08__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__incrementStatic() {
+
+    (__sn__level_08__staticCounter = sn_add_long(__sn__level_08__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getLevelId() {
+
+    return 8LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__computeChainValue(sn_add_long(__sn__base, 8LL));}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__incrementSharedCounter() {
+
+    (__sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter.__sn__current = sn_add_long(__sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter.__sn__current, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getSharedCounterValue() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter.__sn__current;}
+
+
+bool __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__getDeepFlag() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticFlag();}
+
+
+long long __sn__L1__AliasL7__level_08__getStaticCounter() {
+
+    return __sn__level_08__staticCounter;}
+
+
+void __sn__L1__AliasL7__level_08__incrementStatic() {
+
+    (__sn__level_08__staticCounter = sn_add_long(__sn__level_08__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__level_08__instanceCounter;}
+
+
+long long __sn__L1__AliasL7__level_08__getDeepStatic() {
+
+    return __sn__L1__AliasL7__level_08__L9__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__level_08__getLevelId() {
+
+    return 8LL;}
+
+
+long long __sn__L1__AliasL7__level_08__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__level_08__L9__computeChainValue(sn_add_long(__sn__base, 8LL));}
+
+
+void __sn__L1__AliasL7__level_08__incrementSharedCounter() {
+
+    (__sn__L1__AliasL7__level_08__sharedCounter.__sn__current = sn_add_long(__sn__L1__AliasL7__level_08__sharedCounter.__sn__current, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__getSharedCounterValue() {
+
+    return __sn__L1__AliasL7__level_08__sharedCounter.__sn__current;}
+
+
+bool __sn__L1__AliasL7__level_08__getDeepFlag() {
+
+    return __sn__L1__AliasL7__level_08__L9__getStaticFlag();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getStaticCounter() {
+
+    return __sn__level_08__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__incrementStatic() {
+
+    (__sn__level_08__staticCounter = sn_add_long(__sn__level_08__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getLevelId() {
+
+    return 8LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__computeChainValue(sn_add_long(__sn__base, 8LL));}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__incrementSharedCounter() {
+
+    (__sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter.__sn__current = sn_add_long(__sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter.__sn__current, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getSharedCounterValue() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__sharedCounter.__sn__current;}
+
+
+bool __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__getDeepFlag() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticFlag();}
+
+
+long long __sn__L1_alias__AliasL7__level_08__getStaticCounter() {
+
+    return __sn__level_08__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__level_08__incrementStatic() {
+
+    (__sn__level_08__staticCounter = sn_add_long(__sn__level_08__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__level_08__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__level_08__getLevelId() {
+
+    return 8LL;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__computeChainValue(sn_add_long(__sn__base, 8LL));}
+
+
+void __sn__L1_alias__AliasL7__level_08__incrementSharedCounter() {
+
+    (__sn__L1_alias__AliasL7__level_08__sharedCounter.__sn__current = sn_add_long(__sn__L1_alias__AliasL7__level_08__sharedCounter.__sn__current, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__getSharedCounterValue() {
+
+    return __sn__L1_alias__AliasL7__level_08__sharedCounter.__sn__current;}
+
+
+bool __sn__L1_alias__AliasL7__level_08__getDeepFlag() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__getStaticFlag();}
+
+
+long long __sn__MainL5__level_06__L7__level_08__getStaticCounter() {
+
+    return __sn__level_08__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__level_08__incrementStatic() {
+
+    (__sn__level_08__staticCounter = sn_add_long(__sn__level_08__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__level_08__instanceCounter;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__level_08__getLevelId() {
+
+    return 8LL;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__computeChainValue(sn_add_long(__sn__base, 8LL));}
+
+
+void __sn__MainL5__level_06__L7__level_08__incrementSharedCounter() {
+
+    (__sn__MainL5__level_06__L7__level_08__sharedCounter.__sn__current = sn_add_long(__sn__MainL5__level_06__L7__level_08__sharedCounter.__sn__current, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__getSharedCounterValue() {
+
+    return __sn__MainL5__level_06__L7__level_08__sharedCounter.__sn__current;}
+
+
+bool __sn__MainL5__level_06__L7__level_08__getDeepFlag() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__getStaticFlag();}
+
+
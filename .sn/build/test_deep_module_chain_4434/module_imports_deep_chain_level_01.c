@@ -0,0 +1,171 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Summary __sn__L1__createSummary() {
+
+    return (__sn__Summary){ .__sn__level1Static = __sn__level_01__staticCounter, .__sn__level2Static = __sn__L1__level_02__getStaticCounter(), .__sn__level7Static = __sn__L1__AliasL7__getStaticCounter(), .__sn__level11Static = __sn__L1__AliasL11__getStaticCounter(), .__sn__level15Static = __sn__L1__AliasL15__getStaticCounter(), .__sn__chainValue = __sn__L1__computeChainValue(0LL) };}
+
+
+long long __sn__L1__getStaticCounter() {
+
+    return __sn__level_01__staticCounter;}
+
+
+void __sn__L1__incrementStatic() {
+
+    (__sn__level_01__staticCounter = sn_add_long(__sn__level_01__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__getInstanceCounter() {
+
+    return __sn__L1__instanceCounter;}
+
+
+void __sn__L1__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1__getDeepStatic() {
+
+    return __sn__L1__level_02__getStaticCounter();}
+
+
+long long __sn__L1__getLevelId() {
+
+    return 1LL;}
+
+
+long long __sn__L1__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__computeChainValue(sn_add_long(__sn__base, 1LL));}
+
+
+long long __sn__L1__getAliasL7Static() {
+
+    return __sn__L1__AliasL7__getStaticCounter();}
+
+
+long long __sn__L1__getAliasL11Static() {
+
+    return __sn__L1__AliasL11__getStaticCounter();}
+
+
+long long __sn__L1__getAliasL15Static() {
+
+    return __sn__L1__AliasL15__getStaticCounter();}
+
+
+void __sn__L1__incrementL15Static() {
+
+    __sn__L1__AliasL15__incrementStatic();
+    
+}
+
+
+long long __sn__L1__getAggregateLocalVal() {
+
+    return __sn__L1__level_02__createAggregate().__sn__localVal;}
+
+
+bool __sn__L1__getL9FlagViaL2() {
+
+    return __sn__L1__level_02__getL9Flag();}
+
+
+void __sn__L1__toggleL9FlagViaL2() {
+
+    __sn__L1__level_02__toggleL9Flag();
+    
+}
+
+
+__sn__Summary __sn__L1_alias__createSummary() {
+
+    return (__sn__Summary){ .__sn__level1Static = __sn__level_01__staticCounter, .__sn__level2Static = __sn__L1_alias__level_02__getStaticCounter(), .__sn__level7Static = __sn__L1_alias__AliasL7__getStaticCounter(), .__sn__level11Static = __sn__L1_alias__AliasL11__getStaticCounter(), .__sn__level15Static = __sn__L1_alias__AliasL15__getStaticCounter(), .__sn__chainValue = __sn__L1_alias__computeChainValue(0LL) };}
+
+
+long long __sn__L1_alias__getStaticCounter() {
+
+    return __sn__level_01__staticCounter;}
+
+
+void __sn__L1_alias__incrementStatic() {
+
+    (__sn__level_01__staticCounter = sn_add_long(__sn__level_01__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__getInstanceCounter() {
+
+    return __sn__L1_alias__instanceCounter;}
+
+
+void __sn__L1_alias__setInstanceCounter(long long __sn__v) {
+
+    (__sn__L1_alias__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__L1_alias__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__getStaticCounter();}
+
+
+long long __sn__L1_alias__getLevelId() {
+
+    return 1LL;}
+
+
+long long __sn__L1_alias__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__computeChainValue(sn_add_long(__sn__base, 1LL));}
+
+
+long long __sn__L1_alias__getAliasL7Static() {
+
+    return __sn__L1_alias__AliasL7__getStaticCounter();}
+
+
+long long __sn__L1_alias__getAliasL11Static() {
+
+    return __sn__L1_alias__AliasL11__getStaticCounter();}
+
+
+long long __sn__L1_alias__getAliasL15Static() {
+
+    return __sn__L1_alias__AliasL15__getStaticCounter();}
+
+
+void __sn__L1_alias__incrementL15Static() {
+
+    __sn__L1_alias__AliasL15__incrementStatic();
+    
+}
+
+
+long long __sn__L1_alias__getAggregateLocalVal() {
+
+    return __sn__L1_alias__level_02__createAggregate().__sn__localVal;}
+
+
+bool __sn__L1_alias__getL9FlagViaL2() {
+
+    return __sn__L1_alias__level_02__getL9Flag();}
+
+
+void __sn__L1_alias__toggleL9FlagViaL2() {
+
+    __sn__L1_alias__level_02__toggleL9Flag();
+    
+}
+
+
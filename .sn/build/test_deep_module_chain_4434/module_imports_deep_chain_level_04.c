@@ -0,0 +1,112 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__L1__level_02__L3__level_04__getStaticCounter() {
+
+    return __sn__level_04__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__incrementStatic() {
+
+    (__sn__level_04__staticCounter = sn_add_long(__sn__level_04__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__getDirectL14Static() {
+
+    return __sn__L1__level_02__L3__level_04__DirectL14__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__getLevelId() {
+
+    return 4LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__computeChainValue(sn_add_long(__sn__base, 4LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__getRootViaChain() {
+
+    return __sn__L1__level_02__L3__level_04__L5__getRootValue();}
+
+
+void __sn__L1__level_02__L3__level_04__setRootViaChain(long long __sn__v) {
+
+    __sn__L1__level_02__L3__level_04__L5__setRootValue(__sn__v);
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__createDirectHolder(long long __sn__n) {
+
+    return __sn__L1__level_02__L3__level_04__DirectL14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__getStaticCounter() {
+
+    return __sn__level_04__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__incrementStatic() {
+
+    (__sn__level_04__staticCounter = sn_add_long(__sn__level_04__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__getDirectL14Static() {
+
+    return __sn__L1_alias__level_02__L3__level_04__DirectL14__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__getLevelId() {
+
+    return 4LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__computeChainValue(sn_add_long(__sn__base, 4LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__getRootViaChain() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__getRootValue();}
+
+
+void __sn__L1_alias__level_02__L3__level_04__setRootViaChain(long long __sn__v) {
+
+    __sn__L1_alias__level_02__L3__level_04__L5__setRootValue(__sn__v);
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__createDirectHolder(long long __sn__n) {
+
+    return __sn__L1_alias__level_02__L3__level_04__DirectL14__createHolder(__sn__n).__sn__level;}
+
@@ -0,0 +1,347 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticCounter() {
+
+    return __sn__level_09__staticCounter;}
+
+
+bool __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticFlag() {
+
+    return __sn__level_09__staticFlag;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__toggleStaticFlag() {
+
+    (__sn__level_09__staticFlag = (!__sn__level_09__staticFlag));
+    
+}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__incrementStatic() {
+
+    (__sn__level_09__staticCounter = sn_add_long(__sn__level_09__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getLevelId() {
+
+    return 9LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__computeChainValue(sn_add_long(__sn__base, 9LL));}
+
+
+bool __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__verifyDeepDirectAccess() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__verifyDirectAccess();}
+
+
+long long __sn__L1__level_02__JumpL9__getStaticCounter() {
+
+    return __sn__level_09__staticCounter;}
+
+
+bool __sn__L1__level_02__JumpL9__getStaticFlag() {
+
+    return __sn__level_09__staticFlag;}
+
+
+void __sn__L1__level_02__JumpL9__toggleStaticFlag() {
+
+    (__sn__level_09__staticFlag = (!__sn__level_09__staticFlag));
+    
+}
+
+
+void __sn__L1__level_02__JumpL9__incrementStatic() {
+
+    (__sn__level_09__staticCounter = sn_add_long(__sn__level_09__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__getInstanceCounter() {
+
+    return __sn__L1__level_02__JumpL9__instanceCounter;}
+
+
+long long __sn__L1__level_02__JumpL9__getDeepStatic() {
+
+    return __sn__L1__level_02__JumpL9__level_10__getStaticCounter();}
+
+
+long long __sn__L1__level_02__JumpL9__getLevelId() {
+
+    return 9LL;}
+
+
+long long __sn__L1__level_02__JumpL9__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__JumpL9__level_10__computeChainValue(sn_add_long(__sn__base, 9LL));}
+
+
+bool __sn__L1__level_02__JumpL9__verifyDeepDirectAccess() {
+
+    return __sn__L1__level_02__JumpL9__level_10__verifyDirectAccess();}
+
+
+long long __sn__L1__AliasL7__level_08__L9__getStaticCounter() {
+
+    return __sn__level_09__staticCounter;}
+
+
+bool __sn__L1__AliasL7__level_08__L9__getStaticFlag() {
+
+    return __sn__level_09__staticFlag;}
+
+
+void __sn__L1__AliasL7__level_08__L9__toggleStaticFlag() {
+
+    (__sn__level_09__staticFlag = (!__sn__level_09__staticFlag));
+    
+}
+
+
+void __sn__L1__AliasL7__level_08__L9__incrementStatic() {
+
+    (__sn__level_09__staticCounter = sn_add_long(__sn__level_09__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__level_08__L9__instanceCounter;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__getDeepStatic() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__level_08__L9__getLevelId() {
+
+    return 9LL;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__computeChainValue(sn_add_long(__sn__base, 9LL));}
+
+
+bool __sn__L1__AliasL7__level_08__L9__verifyDeepDirectAccess() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__verifyDirectAccess();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticCounter() {
+
+    return __sn__level_09__staticCounter;}
+
+
+bool __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getStaticFlag() {
+
+    return __sn__level_09__staticFlag;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__toggleStaticFlag() {
+
+    (__sn__level_09__staticFlag = (!__sn__level_09__staticFlag));
+    
+}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__incrementStatic() {
+
+    (__sn__level_09__staticCounter = sn_add_long(__sn__level_09__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__getLevelId() {
+
+    return 9LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__computeChainValue(sn_add_long(__sn__base, 9LL));}
+
+
+bool __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__verifyDeepDirectAccess() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__verifyDirectAccess();}
+
+
+long long __sn__L1_alias__level_02__JumpL9__getStaticCounter() {
+
+    return __sn__level_09__staticCounter;}
+
+
+bool __sn__L1_alias__level_02__JumpL9__getStaticFlag() {
+
+    return __sn__level_09__staticFlag;}
+
+
+void __sn__L1_alias__level_02__JumpL9__toggleStaticFlag() {
+
+    (__sn__level_09__staticFlag = (!__sn__level_09__staticFlag));
+    
+}
+
+
+void __sn__L1_alias__level_02__JumpL9__incrementStatic() {
+
+    (__sn__level_09__staticCounter = sn_add_long(__sn__level_09__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__JumpL9__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__JumpL9__getLevelId() {
+
+    return 9LL;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__computeChainValue(sn_add_long(__sn__base, 9LL));}
+
+
+bool __sn__L1_alias__level_02__JumpL9__verifyDeepDirectAccess() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__verifyDirectAccess();}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__getStaticCounter() {
+
+    return __sn__level_09__staticCounter;}
+
+
+bool __sn__L1_alias__AliasL7__level_08__L9__getStaticFlag() {
+
+    return __sn__level_09__staticFlag;}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__toggleStaticFlag() {
+
+    (__sn__level_09__staticFlag = (!__sn__level_09__staticFlag));
+    
+}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__incrementStatic() {
+
+    (__sn__level_09__staticCounter = sn_add_long(__sn__level_09__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__getLevelId() {
+
+    return 9LL;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__computeChainValue(sn_add_long(__sn__base, 9LL));}
+
+
+bool __sn__L1_alias__AliasL7__level_08__L9__verifyDeepDirectAccess() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__verifyDirectAccess();}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__getStaticCounter() {
+
+    return __sn__level_09__staticCounter;}
+
+
+bool __sn__MainL5__level_06__L7__level_08__L9__getStaticFlag() {
+
+    return __sn__level_09__staticFlag;}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__toggleStaticFlag() {
+
+    (__sn__level_09__staticFlag = (!__sn__level_09__staticFlag));
+    
+}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__incrementStatic() {
+
+    (__sn__level_09__staticCounter = sn_add_long(__sn__level_09__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__instanceCounter;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__getLevelId() {
+
+    return 9LL;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__computeChainValue(sn_add_long(__sn__base, 9LL));}
+
+
+bool __sn__MainL5__level_06__L7__level_08__L9__verifyDeepDirectAccess() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__verifyDirectAccess();}
+
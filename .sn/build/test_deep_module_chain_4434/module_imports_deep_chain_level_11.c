@@ -0,0 +1,375 @@
+#include "sn_types.h"
+
+
+
+
+__sn__DataBundle __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getAllStaticSum() };}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getStaticCounter();}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
+__sn__DataBundle __sn__L1__level_02__JumpL9__level_10__L11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__L1__level_02__JumpL9__level_10__L11__level_12__getAllStaticSum() };}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__L1__level_02__JumpL9__level_10__L11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__getInstanceCounter() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__instanceCounter;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__getDeepStatic() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__getStaticCounter();}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
+__sn__DataBundle __sn__L1__AliasL7__level_08__L9__level_10__L11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getAllStaticSum() };}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__instanceCounter;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__getDeepStatic() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__getStaticCounter();}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
+__sn__DataBundle __sn__L1__AliasL11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__L1__AliasL11__level_12__getAllStaticSum() };}
+
+
+long long __sn__L1__AliasL11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__L1__AliasL11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL11__getInstanceCounter() {
+
+    return __sn__L1__AliasL11__instanceCounter;}
+
+
+long long __sn__L1__AliasL11__getDeepStatic() {
+
+    return __sn__L1__AliasL11__level_12__getStaticCounter();}
+
+
+long long __sn__L1__AliasL11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__L1__AliasL11__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
+__sn__DataBundle __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getAllStaticSum() };}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
+__sn__DataBundle __sn__L1_alias__level_02__JumpL9__level_10__L11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getAllStaticSum() };}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__getStaticCounter();}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
+__sn__DataBundle __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getAllStaticSum() };}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
+__sn__DataBundle __sn__L1_alias__AliasL11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__L1_alias__AliasL11__level_12__getAllStaticSum() };}
+
+
+long long __sn__L1_alias__AliasL11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__L1_alias__AliasL11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL11__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL11__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL11__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL11__level_12__getStaticCounter();}
+
+
+long long __sn__L1_alias__AliasL11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__L1_alias__AliasL11__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
+__sn__DataBundle __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getAllStaticSum() };}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__instanceCounter;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__getStaticCounter();}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
+__sn__DataBundle __sn__MainL10__L11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__MainL10__L11__level_12__getAllStaticSum() };}
+
+
+long long __sn__MainL10__L11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__MainL10__L11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL10__L11__getInstanceCounter() {
+
+    return __sn__MainL10__L11__instanceCounter;}
+
+
+long long __sn__MainL10__L11__getDeepStatic() {
+
+    return __sn__MainL10__L11__level_12__getStaticCounter();}
+
+
+long long __sn__MainL10__L11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__MainL10__L11__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL10__L11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
@@ -0,0 +1,872 @@
+#include "sn_types.h"
+
+
+
+
+__sn__StateHolder __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_0__ = __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_0__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_1__ = __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_1__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1__level_02__L3__level_04__DirectL14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_2__ = __sn__L1__level_02__L3__level_04__DirectL14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_2__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1__level_02__L3__level_04__DirectL14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1__level_02__L3__level_04__DirectL14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__DirectL14__getInstanceCounter() {
+
+    return __sn__L1__level_02__L3__level_04__DirectL14__instanceCounter;}
+
+
+long long __sn__L1__level_02__L3__level_04__DirectL14__getDeepStatic() {
+
+    return __sn__L1__level_02__L3__level_04__DirectL14__L15__getStaticCounter();}
+
+
+void __sn__L1__level_02__L3__level_04__DirectL14__incrementDeepStatic() {
+
+    __sn__L1__level_02__L3__level_04__DirectL14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1__level_02__L3__level_04__DirectL14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1__level_02__L3__level_04__DirectL14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__L3__level_04__DirectL14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1__level_02__L3__level_04__DirectL14__getDeepLevelId() {
+
+    return __sn__L1__level_02__L3__level_04__DirectL14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_3__ = __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_3__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_4__ = __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_4__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1__AliasL7__JumpL12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_5__ = __sn__L1__AliasL7__JumpL12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_5__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1__AliasL7__JumpL12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1__AliasL7__JumpL12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1__AliasL7__JumpL12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1__AliasL7__JumpL12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1__AliasL7__JumpL12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL7__JumpL12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1__AliasL7__JumpL12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1__AliasL7__JumpL12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1__AliasL11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_6__ = __sn__L1__AliasL11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_6__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1__AliasL11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1__AliasL11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1__AliasL11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1__AliasL11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1__AliasL11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1__AliasL11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1__AliasL11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1__AliasL11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1__AliasL11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1__AliasL11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1__AliasL11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1__AliasL11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1__AliasL11__level_12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_7__ = __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_7__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_8__ = __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_8__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1_alias__level_02__L3__level_04__L5__level_06__L7__JumpL12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1_alias__level_02__L3__level_04__DirectL14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_9__ = __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_9__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1_alias__level_02__L3__level_04__DirectL14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__L3__level_04__DirectL14__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__getStaticCounter();}
+
+
+void __sn__L1_alias__level_02__L3__level_04__DirectL14__incrementDeepStatic() {
+
+    __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1_alias__level_02__L3__level_04__DirectL14__getDeepLevelId() {
+
+    return __sn__L1_alias__level_02__L3__level_04__DirectL14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_10__ = __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_10__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1_alias__level_02__JumpL9__level_10__L11__level_12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_11__ = __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_11__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1_alias__AliasL7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1_alias__AliasL7__JumpL12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_12__ = __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_12__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1_alias__AliasL7__JumpL12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1_alias__AliasL7__JumpL12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1_alias__AliasL7__JumpL12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1_alias__AliasL7__JumpL12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__L1_alias__AliasL11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_13__ = __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_13__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__L1_alias__AliasL11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__L1_alias__AliasL11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__L1_alias__AliasL11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__L1_alias__AliasL11__level_12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_14__ = __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_14__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__MainL5__level_06__L7__level_08__L9__level_10__L11__level_12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__MainL5__level_06__L7__JumpL12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_15__ = __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_15__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__MainL5__level_06__L7__JumpL12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getInstanceCounter() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__level_14__instanceCounter;}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getDeepStatic() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__MainL5__level_06__L7__JumpL12__L13__level_14__incrementDeepStatic() {
+
+    __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__MainL5__level_06__L7__JumpL12__L13__level_14__getDeepLevelId() {
+
+    return __sn__MainL5__level_06__L7__JumpL12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__MainL10__L11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_16__ = __sn__MainL10__L11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_16__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__MainL10__L11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__MainL10__L11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MainL10__L11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__MainL10__L11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__MainL10__L11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__MainL10__L11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__MainL10__L11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__MainL10__L11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__MainL10__L11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__MainL10__L11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__MainL10__L11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__MainL10__L11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__MainL10__L11__level_12__L13__level_14__L15__getLevelId();}
+
+
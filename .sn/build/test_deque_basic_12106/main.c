@@ -0,0 +1,134 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_deque_int __sn__deque_int * __sn__q = ({
+        __sn__deque_int *__tmp__ = __sn__deque_int__new();
+        __tmp__;
+    });
+    __sn__deque_int_pushBack(__sn__q, 1LL);
+    
+    __sn__deque_int_pushBack(__sn__q, 2LL);
+    
+    __sn__deque_int_pushFront(__sn__q, 0LL);
+    
+    __sn__deque_int_pushFront(__sn__q, (-1LL));
+    
+    printf("%lld\n", (long long)(__sn__deque_int_length(__sn__q)));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__deque_int_to_string(__sn__q);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    printf("%lld\n", (long long)(__sn__deque_int_front(__sn__q)));
+    
+    printf("%lld\n", (long long)(__sn__deque_int_back(__sn__q)));
+    
+    printf("%lld\n", (long long)(__sn__deque_int_get(__sn__q, 1LL)));
+    
+    printf("%lld\n", (long long)(__sn__deque_int_get(__sn__q, (-1LL))));
+    
+    __sn__deque_int_set(__sn__q, 0LL, 10LL);
+    
+    printf("%lld\n", (long long)(__sn__deque_int_popFront(__sn__q)));
+    
+    printf("%lld\n", (long long)(__sn__deque_int_popBack(__sn__q)));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__deque_int_to_string(__sn__q);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_deque_int __sn__deque_int * __sn__r = ({
+        __sn__deque_int *__tmp__ = __sn__deque_int__new();
+        __tmp__;
+    });
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 6LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__deque_int_pushBack(__sn__r, __sn__i);
+                
+            }
+        }
+    }
+    long long __sn__total = 0LL;
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(6LL, 1000LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                (__sn__total = sn_add_long(__sn__total, __sn__deque_int_popFront(__sn__r)));
+                
+                __sn__deque_int_pushBack(__sn__r, __sn__i);
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__total));
+    
+    printf("%lld\n", (long long)(__sn__deque_int_length(__sn__r)));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__deque_int_to_string(__sn__r);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_deque_int __sn__deque_int * __sn__g = ({
+        __sn__deque_int *__tmp__ = __sn__deque_int__new();
+        __tmp__;
+    });
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 100LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if ((sn_mod_long(__sn__i, 2LL) == 0LL)) {
+                    __sn__deque_int_pushBack(__sn__g, __sn__i);
+                    
+                } else {
+                    __sn__deque_int_pushFront(__sn__g, __sn__i);
+                    
+                }
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__deque_int_length(__sn__g)));
+    
+    printf("%lld\n", (long long)(__sn__deque_int_front(__sn__g)));
+    
+    printf("%lld\n", (long long)(__sn__deque_int_back(__sn__g)));
+    
+    printf("%lld\n", (long long)(__sn__deque_int_get(__sn__g, 50LL)));
+    
+    long long __sn__sum = 0LL;
+    {
+        sn_auto_DequeIter_int __sn__DequeIter_int __sn_iter__ = __sn__deque_int_iter(__sn__g);
+        while (__sn__DequeIter_int_hasNext(&__sn_iter__)) {
+            long long __sn__x = __sn__DequeIter_int_next(&__sn_iter__);
+            {
+                (__sn__sum = sn_add_long(__sn__sum, __sn__x));
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__sum));
+    
+    sn_auto_arr SnArray * __sn__arr = __sn__deque_int_toArray(__sn__g);
+    printf("%lld\n", (long long)((((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+    
+    printf("%lld\n", (long long)(sn_array_length(__sn__arr)));
+    
+    __sn__deque_int_clear(__sn__g);
+    
+    printf("%lld\n", (long long)(__sn__deque_int_length(__sn__g)));
+    
+    fflush(stdout);
+    return 0;
+}
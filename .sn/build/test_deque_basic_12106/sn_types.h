@@ -0,0 +1,190 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Deque: deque_int (built-in ring buffer deque, refcounted — see sn_deque.h) */
+typedef SnDeque __sn__deque_int;
+
+static inline __sn__deque_int *__sn__deque_int__new(void) {
+    SnDeque *d = sn_deque_new(sizeof(long long), SN_TAG_INT, NULL, NULL);
+    return d;
+}
+
+static inline __sn__deque_int *__sn__deque_int_retain(__sn__deque_int *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__deque_int_release(__sn__deque_int **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_deque_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__deque_int *__sn__deque_int_copy(const __sn__deque_int *src) {
+    return sn_deque_clone(src);
+}
+
+#define sn_auto_deque_int __attribute__((cleanup(__sn__deque_int_release)))
+#define sn_auto_ref_deque_int __attribute__((cleanup(__sn__deque_int_release)))
+
+static inline void __sn__deque_int_release_elem(void *p) { __sn__deque_int_release((__sn__deque_int **)p); }
+static inline void __sn__deque_int_retain_into(const void *src, void *dst) { *(__sn__deque_int **)dst = __sn__deque_int_retain(*(__sn__deque_int *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__deque_int_to_string(const __sn__deque_int *p) {
+    return sn_deque_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the deque;
+ * composite val-struct arguments are owned by the callee and moved in.
+ * Popped elements are moved out to the caller. */
+static inline void __sn__deque_int_pushBack(__sn__deque_int *d, long long value) {
+    sn_deque_push_back(d, &value, false);
+}
+
+static inline void __sn__deque_int_pushFront(__sn__deque_int *d, long long value) {
+    sn_deque_push_front(d, &value, false);
+}
+
+static inline long long __sn__deque_int_popBack(__sn__deque_int *d) {
+    long long r;
+    sn_deque_pop_back(d, &r);
+    return r;
+}
+
+static inline long long __sn__deque_int_popFront(__sn__deque_int *d) {
+    long long r;
+    sn_deque_pop_front(d, &r);
+    return r;
+}
+
+static inline long long __sn__deque_int_front(__sn__deque_int *d) {
+    long long r;
+    sn_deque_get(d, 0, &r);
+    return r;
+}
+
+static inline long long __sn__deque_int_back(__sn__deque_int *d) {
+    long long r;
+    sn_deque_get(d, -1, &r);
+    return r;
+}
+
+static inline long long __sn__deque_int_get(__sn__deque_int *d, long long index) {
+    long long r;
+    sn_deque_get(d, index, &r);
+    return r;
+}
+
+static inline void __sn__deque_int_set(__sn__deque_int *d, long long index, long long value) {
+    sn_deque_set(d, index, &value, false);
+}
+
+static inline long long __sn__deque_int_length(__sn__deque_int *d) {
+    return d->len;
+}
+
+static inline void __sn__deque_int_clear(__sn__deque_int *d) {
+    sn_deque_clear(d);
+}
+
+static inline SnArray *__sn__deque_int_toArray(__sn__deque_int *d) {
+    return sn_deque_to_array(d);
+}
+
+static inline __sn__deque_int *__sn__deque_int_clone(__sn__deque_int *d) {
+    return sn_deque_clone(d);
+}
+/* Struct: DequeIter_int (as val) */
+typedef struct {
+    __sn__deque_int * __sn___deque;
+    long long __sn___pos;
+} __sn__DequeIter_int;
+/* Value operations */
+static inline __sn__DequeIter_int __sn__DequeIter_int_copy(const __sn__DequeIter_int *src) {
+    __sn__DequeIter_int dst;
+    dst.__sn___deque = __sn__deque_int_retain(src->__sn___deque);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__DequeIter_int_cleanup(__sn__DequeIter_int *p) {
+    __sn__deque_int_release(&p->__sn___deque);
+
+}
+
+#define sn_auto_DequeIter_int __attribute__((cleanup(__sn__DequeIter_int_cleanup)))
+
+static inline void __sn__DequeIter_int_cleanup_elem(void *p) { __sn__DequeIter_int_cleanup((__sn__DequeIter_int *)p); }
+static inline void __sn__DequeIter_int_copy_into(const void *src, void *dst) { *(__sn__DequeIter_int *)dst = __sn__DequeIter_int_copy((const __sn__DequeIter_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__DequeIter_int *__sn__DequeIter_int_alloc(void) {
+    return calloc(1, sizeof(__sn__DequeIter_int));
+}
+
+static inline void __sn__DequeIter_int_release(__sn__DequeIter_int **p) {
+    if (*p) {
+        __sn__deque_int_release(&(*p)->__sn___deque);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_DequeIter_int __attribute__((cleanup(__sn__DequeIter_int_release)))
+
+static inline void __sn__DequeIter_int_release_elem(void *p) { __sn__DequeIter_int_release((__sn__DequeIter_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__DequeIter_int_to_string(const __sn__DequeIter_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "DequeIter_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_deque: ");
+    { char *__fs__ = __sn__deque_int_to_string(p->__sn___deque); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Deque iteration: deque_int → long long (front to back) */
+static inline __sn__DequeIter_int __sn__deque_int_iter(__sn__deque_int *d) {
+    return (__sn__DequeIter_int){ .__sn___deque = __sn__deque_int_retain(d), .__sn___pos = 0 };
+}
+
+static inline bool __sn__DequeIter_int_hasNext(__sn__DequeIter_int *it) {
+    return it->__sn___pos < it->__sn___deque->len;
+}
+
+static inline long long __sn__DequeIter_int_next(__sn__DequeIter_int *it) {
+    SnDeque *d = it->__sn___deque;
+    long long r;
+    sn_deque_get(d, it->__sn___pos, &r);
+    it->__sn___pos++;
+    return r;
+}
+
+
+
+
+
+#endif
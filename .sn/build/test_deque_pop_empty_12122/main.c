@@ -0,0 +1,18 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_deque_int __sn__deque_int * __sn__q = ({
+        __sn__deque_int *__tmp__ = __sn__deque_int__new();
+        __tmp__;
+    });
+    __sn__deque_int_pushBack(__sn__q, 1LL);
+    
+    printf("%lld\n", (long long)(__sn__deque_int_popFront(__sn__q)));
+    
+    printf("%lld\n", (long long)(__sn__deque_int_popFront(__sn__q)));
+    
+    fflush(stdout);
+    return 0;
+}
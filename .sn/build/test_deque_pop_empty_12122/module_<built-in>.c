@@ -0,0 +1,6 @@
+#include "sn_types.h"
+
+
+
+
+
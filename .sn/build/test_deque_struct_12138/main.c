@@ -0,0 +1,73 @@
+#include "sn_types.h"
+
+
+
+
+int main() {
+    sn_auto_deque_str __sn__deque_str * __sn__words = ({
+        __sn__deque_str *__tmp__ = __sn__deque_str__new();
+        __tmp__;
+    });
+    __sn__deque_str_pushBack(__sn__words, "b");
+    
+    __sn__deque_str_pushFront(__sn__words, "a");
+    
+    __sn__deque_str_pushBack(__sn__words, "c");
+    
+    sn_auto_str char * __sn__w = __sn__deque_str_popFront(__sn__words);
+    sn_println(__sn__w);
+    
+    __sn__deque_str_set(__sn__words, 0LL, "B");
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__deque_str_to_string(__sn__words);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_deque_str __sn__deque_str * __sn__c = __sn__deque_str_clone(__sn__words);
+    __sn__deque_str_pushBack(__sn__c, "d");
+    
+    printf("%lld\n", (long long)(__sn__deque_str_length(__sn__words)));
+    
+    printf("%lld\n", (long long)(__sn__deque_str_length(__sn__c)));
+    
+    {
+        sn_auto_DequeIter_str __sn__DequeIter_str __sn_iter__ = __sn__deque_str_iter(__sn__c);
+        while (__sn__DequeIter_str_hasNext(&__sn_iter__)) {
+            sn_auto_str char * __sn__s = __sn__DequeIter_str_next(&__sn_iter__);
+            {
+                sn_print(__sn__s);
+                
+            }
+        }
+    }
+    sn_print("\n");
+    
+    sn_auto_deque_Job __sn__deque_Job * __sn__jobs = ({
+        __sn__deque_Job *__tmp__ = __sn__deque_Job__new();
+        __tmp__;
+    });
+    sn_auto_Job __sn__Job __sn__first = (__sn__Job){ .__sn__name = strdup("build"), .__sn__cost = 3LL };
+    __sn__deque_Job_pushBack(__sn__jobs, __sn__Job_copy(&(__sn__first)));
+    
+    __sn__deque_Job_pushBack(__sn__jobs, (__sn__Job){ .__sn__name = strdup("test"), .__sn__cost = 5LL });
+    
+    __sn__deque_Job_pushFront(__sn__jobs, (__sn__Job){ .__sn__name = strdup("fetch"), .__sn__cost = 1LL });
+    
+    long long __sn__spent = 0LL;
+    while (sn_gt_long(__sn__deque_Job_length(__sn__jobs), 0LL)) {
+        sn_auto_Job __sn__Job __sn__j = __sn__deque_Job_popFront(__sn__jobs);
+        (__sn__spent = sn_add_long(__sn__spent, __sn__j.__sn__cost));
+        
+        if ((strcmp(__sn__j.__sn__name, "test") == 0)) {
+            __sn__deque_Job_pushBack(__sn__jobs, (__sn__Job){ .__sn__name = strdup("report"), .__sn__cost = 2LL });
+            
+        }
+    }
+    printf("%lld\n", (long long)(__sn__spent));
+    
+    printf("%lld\n", (long long)(__sn__first.__sn__cost));
+    
+    fflush(stdout);
+    return 0;
+}
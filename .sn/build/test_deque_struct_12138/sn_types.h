@@ -0,0 +1,416 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Job (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__cost;
+} __sn__Job;
+/* Value operations */
+static inline __sn__Job __sn__Job_copy(const __sn__Job *src) {
+    __sn__Job dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__cost = src->__sn__cost;
+    return dst;
+}
+
+static inline void __sn__Job_cleanup(__sn__Job *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Job __attribute__((cleanup(__sn__Job_cleanup)))
+
+static inline void __sn__Job_cleanup_elem(void *p) { __sn__Job_cleanup((__sn__Job *)p); }
+static inline void __sn__Job_copy_into(const void *src, void *dst) { *(__sn__Job *)dst = __sn__Job_copy((const __sn__Job *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Job *__sn__Job_alloc(void) {
+    return calloc(1, sizeof(__sn__Job));
+}
+
+static inline void __sn__Job_release(__sn__Job **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Job __attribute__((cleanup(__sn__Job_release)))
+
+static inline void __sn__Job_release_elem(void *p) { __sn__Job_release((__sn__Job **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Job_to_string(const __sn__Job *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Job { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "cost: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__cost);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Deque: deque_str (built-in ring buffer deque, refcounted — see sn_deque.h) */
+typedef SnDeque __sn__deque_str;
+
+static inline __sn__deque_str *__sn__deque_str__new(void) {
+    SnDeque *d = sn_deque_new(sizeof(char *), SN_TAG_STRING, sn_copy_str, (void (*)(void *))sn_cleanup_str);
+    return d;
+}
+
+static inline __sn__deque_str *__sn__deque_str_retain(__sn__deque_str *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__deque_str_release(__sn__deque_str **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_deque_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__deque_str *__sn__deque_str_copy(const __sn__deque_str *src) {
+    return sn_deque_clone(src);
+}
+
+#define sn_auto_deque_str __attribute__((cleanup(__sn__deque_str_release)))
+#define sn_auto_ref_deque_str __attribute__((cleanup(__sn__deque_str_release)))
+
+static inline void __sn__deque_str_release_elem(void *p) { __sn__deque_str_release((__sn__deque_str **)p); }
+static inline void __sn__deque_str_retain_into(const void *src, void *dst) { *(__sn__deque_str **)dst = __sn__deque_str_retain(*(__sn__deque_str *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__deque_str_to_string(const __sn__deque_str *p) {
+    return sn_deque_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the deque;
+ * composite val-struct arguments are owned by the callee and moved in.
+ * Popped elements are moved out to the caller. */
+static inline void __sn__deque_str_pushBack(__sn__deque_str *d, char * value) {
+    sn_deque_push_back(d, &value, false);
+}
+
+static inline void __sn__deque_str_pushFront(__sn__deque_str *d, char * value) {
+    sn_deque_push_front(d, &value, false);
+}
+
+static inline char * __sn__deque_str_popBack(__sn__deque_str *d) {
+    char * r;
+    sn_deque_pop_back(d, &r);
+    return r;
+}
+
+static inline char * __sn__deque_str_popFront(__sn__deque_str *d) {
+    char * r;
+    sn_deque_pop_front(d, &r);
+    return r;
+}
+
+static inline char * __sn__deque_str_front(__sn__deque_str *d) {
+    char * r;
+    sn_deque_get(d, 0, &r);
+    return r;
+}
+
+static inline char * __sn__deque_str_back(__sn__deque_str *d) {
+    char * r;
+    sn_deque_get(d, -1, &r);
+    return r;
+}
+
+static inline char * __sn__deque_str_get(__sn__deque_str *d, long long index) {
+    char * r;
+    sn_deque_get(d, index, &r);
+    return r;
+}
+
+static inline void __sn__deque_str_set(__sn__deque_str *d, long long index, char * value) {
+    sn_deque_set(d, index, &value, false);
+}
+
+static inline long long __sn__deque_str_length(__sn__deque_str *d) {
+    return d->len;
+}
+
+static inline void __sn__deque_str_clear(__sn__deque_str *d) {
+    sn_deque_clear(d);
+}
+
+static inline SnArray *__sn__deque_str_toArray(__sn__deque_str *d) {
+    return sn_deque_to_array(d);
+}
+
+static inline __sn__deque_str *__sn__deque_str_clone(__sn__deque_str *d) {
+    return sn_deque_clone(d);
+}
+/* Struct: DequeIter_str (as val) */
+typedef struct {
+    __sn__deque_str * __sn___deque;
+    long long __sn___pos;
+} __sn__DequeIter_str;
+/* Value operations */
+static inline __sn__DequeIter_str __sn__DequeIter_str_copy(const __sn__DequeIter_str *src) {
+    __sn__DequeIter_str dst;
+    dst.__sn___deque = __sn__deque_str_retain(src->__sn___deque);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__DequeIter_str_cleanup(__sn__DequeIter_str *p) {
+    __sn__deque_str_release(&p->__sn___deque);
+
+}
+
+#define sn_auto_DequeIter_str __attribute__((cleanup(__sn__DequeIter_str_cleanup)))
+
+static inline void __sn__DequeIter_str_cleanup_elem(void *p) { __sn__DequeIter_str_cleanup((__sn__DequeIter_str *)p); }
+static inline void __sn__DequeIter_str_copy_into(const void *src, void *dst) { *(__sn__DequeIter_str *)dst = __sn__DequeIter_str_copy((const __sn__DequeIter_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__DequeIter_str *__sn__DequeIter_str_alloc(void) {
+    return calloc(1, sizeof(__sn__DequeIter_str));
+}
+
+static inline void __sn__DequeIter_str_release(__sn__DequeIter_str **p) {
+    if (*p) {
+        __sn__deque_str_release(&(*p)->__sn___deque);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_DequeIter_str __attribute__((cleanup(__sn__DequeIter_str_release)))
+
+static inline void __sn__DequeIter_str_release_elem(void *p) { __sn__DequeIter_str_release((__sn__DequeIter_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__DequeIter_str_to_string(const __sn__DequeIter_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "DequeIter_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_deque: ");
+    { char *__fs__ = __sn__deque_str_to_string(p->__sn___deque); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Deque iteration: deque_str → char * (front to back) */
+static inline __sn__DequeIter_str __sn__deque_str_iter(__sn__deque_str *d) {
+    return (__sn__DequeIter_str){ .__sn___deque = __sn__deque_str_retain(d), .__sn___pos = 0 };
+}
+
+static inline bool __sn__DequeIter_str_hasNext(__sn__DequeIter_str *it) {
+    return it->__sn___pos < it->__sn___deque->len;
+}
+
+static inline char * __sn__DequeIter_str_next(__sn__DequeIter_str *it) {
+    SnDeque *d = it->__sn___deque;
+    char * r;
+    sn_deque_get(d, it->__sn___pos, &r);
+    it->__sn___pos++;
+    return r;
+}
+/* Deque: deque_Job (built-in ring buffer deque, refcounted — see sn_deque.h) */
+typedef SnDeque __sn__deque_Job;
+
+static char *__sn__deque_Job__elem_str(const void *p) {
+    return __sn__Job_to_string((const __sn__Job *)p);
+}
+
+static inline __sn__deque_Job *__sn__deque_Job__new(void) {
+    SnDeque *d = sn_deque_new(sizeof(__sn__Job), SN_TAG_STRUCT, __sn__Job_copy_into, __sn__Job_cleanup_elem);
+    d->elem_str = __sn__deque_Job__elem_str;
+    return d;
+}
+
+static inline __sn__deque_Job *__sn__deque_Job_retain(__sn__deque_Job *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__deque_Job_release(__sn__deque_Job **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_deque_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__deque_Job *__sn__deque_Job_copy(const __sn__deque_Job *src) {
+    return sn_deque_clone(src);
+}
+
+#define sn_auto_deque_Job __attribute__((cleanup(__sn__deque_Job_release)))
+#define sn_auto_ref_deque_Job __attribute__((cleanup(__sn__deque_Job_release)))
+
+static inline void __sn__deque_Job_release_elem(void *p) { __sn__deque_Job_release((__sn__deque_Job **)p); }
+static inline void __sn__deque_Job_retain_into(const void *src, void *dst) { *(__sn__deque_Job **)dst = __sn__deque_Job_retain(*(__sn__deque_Job *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__deque_Job_to_string(const __sn__deque_Job *p) {
+    return sn_deque_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the deque;
+ * composite val-struct arguments are owned by the callee and moved in.
+ * Popped elements are moved out to the caller. */
+static inline void __sn__deque_Job_pushBack(__sn__deque_Job *d, __sn__Job value) {
+    sn_deque_push_back(d, &value, true);
+}
+
+static inline void __sn__deque_Job_pushFront(__sn__deque_Job *d, __sn__Job value) {
+    sn_deque_push_front(d, &value, true);
+}
+
+static inline __sn__Job __sn__deque_Job_popBack(__sn__deque_Job *d) {
+    __sn__Job r;
+    sn_deque_pop_back(d, &r);
+    return r;
+}
+
+static inline __sn__Job __sn__deque_Job_popFront(__sn__deque_Job *d) {
+    __sn__Job r;
+    sn_deque_pop_front(d, &r);
+    return r;
+}
+
+static inline __sn__Job __sn__deque_Job_front(__sn__deque_Job *d) {
+    __sn__Job r;
+    sn_deque_get(d, 0, &r);
+    return r;
+}
+
+static inline __sn__Job __sn__deque_Job_back(__sn__deque_Job *d) {
+    __sn__Job r;
+    sn_deque_get(d, -1, &r);
+    return r;
+}
+
+static inline __sn__Job __sn__deque_Job_get(__sn__deque_Job *d, long long index) {
+    __sn__Job r;
+    sn_deque_get(d, index, &r);
+    return r;
+}
+
+static inline void __sn__deque_Job_set(__sn__deque_Job *d, long long index, __sn__Job value) {
+    sn_deque_set(d, index, &value, true);
+}
+
+static inline long long __sn__deque_Job_length(__sn__deque_Job *d) {
+    return d->len;
+}
+
+static inline void __sn__deque_Job_clear(__sn__deque_Job *d) {
+    sn_deque_clear(d);
+}
+
+static inline SnArray *__sn__deque_Job_toArray(__sn__deque_Job *d) {
+    return sn_deque_to_array(d);
+}
+
+static inline __sn__deque_Job *__sn__deque_Job_clone(__sn__deque_Job *d) {
+    return sn_deque_clone(d);
+}
+/* Struct: DequeIter_Job (as val) */
+typedef struct {
+    __sn__deque_Job * __sn___deque;
+    long long __sn___pos;
+} __sn__DequeIter_Job;
+/* Value operations */
+static inline __sn__DequeIter_Job __sn__DequeIter_Job_copy(const __sn__DequeIter_Job *src) {
+    __sn__DequeIter_Job dst;
+    dst.__sn___deque = __sn__deque_Job_retain(src->__sn___deque);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__DequeIter_Job_cleanup(__sn__DequeIter_Job *p) {
+    __sn__deque_Job_release(&p->__sn___deque);
+
+}
+
+#define sn_auto_DequeIter_Job __attribute__((cleanup(__sn__DequeIter_Job_cleanup)))
+
+static inline void __sn__DequeIter_Job_cleanup_elem(void *p) { __sn__DequeIter_Job_cleanup((__sn__DequeIter_Job *)p); }
+static inline void __sn__DequeIter_Job_copy_into(const void *src, void *dst) { *(__sn__DequeIter_Job *)dst = __sn__DequeIter_Job_copy((const __sn__DequeIter_Job *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__DequeIter_Job *__sn__DequeIter_Job_alloc(void) {
+    return calloc(1, sizeof(__sn__DequeIter_Job));
+}
+
+static inline void __sn__DequeIter_Job_release(__sn__DequeIter_Job **p) {
+    if (*p) {
+        __sn__deque_Job_release(&(*p)->__sn___deque);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_DequeIter_Job __attribute__((cleanup(__sn__DequeIter_Job_release)))
+
+static inline void __sn__DequeIter_Job_release_elem(void *p) { __sn__DequeIter_Job_release((__sn__DequeIter_Job **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__DequeIter_Job_to_string(const __sn__DequeIter_Job *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "DequeIter_Job { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_deque: ");
+    { char *__fs__ = __sn__deque_Job_to_string(p->__sn___deque); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Deque iteration: deque_Job → __sn__Job (front to back) */
+static inline __sn__DequeIter_Job __sn__deque_Job_iter(__sn__deque_Job *d) {
+    return (__sn__DequeIter_Job){ .__sn___deque = __sn__deque_Job_retain(d), .__sn___pos = 0 };
+}
+
+static inline bool __sn__DequeIter_Job_hasNext(__sn__DequeIter_Job *it) {
+    return it->__sn___pos < it->__sn___deque->len;
+}
+
+static inline __sn__Job __sn__DequeIter_Job_next(__sn__DequeIter_Job *it) {
+    SnDeque *d = it->__sn___deque;
+    __sn__Job r;
+    sn_deque_get(d, it->__sn___pos, &r);
+    it->__sn___pos++;
+    return r;
+}
+
+
+
+
+
+#endif
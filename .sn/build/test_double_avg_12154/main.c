@@ -0,0 +1,18 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    double __sn__a = 10.0;
+    double __sn__b = 20.0;
+    double __sn__c = 30.0;
+    double __sn__avg = sn_div_double(sn_add_double(sn_add_double(__sn__a, __sn__b), __sn__c), 3.0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%.5f", (double)(__sn__avg));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
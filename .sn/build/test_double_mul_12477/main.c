@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    double __sn__a = 2.5;
+    double __sn__b = 4.0;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%.5f", (double)(sn_mul_double(__sn__a, __sn__b)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
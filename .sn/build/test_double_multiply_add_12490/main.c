@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    double __sn__x = 2.0;
+    double __sn__y = 3.0;
+    double __sn__z = sn_add_double(sn_mul_double(__sn__x, __sn__y), 1.0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%.5f", (double)(__sn__z));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,251 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_large_numbers() {
+
+    long long __sn__large1 = 1000000000LL;
+
+    long long __sn__large2 = 2000000000LL;
+
+    long long __sn__sum = sn_add_long(__sn__large1, __sn__large2);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("1B + 2B = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    long long __sn__a = 100000LL;
+
+    long long __sn__b = 100000LL;
+
+    long long __sn__product = sn_mul_long(__sn__a, __sn__b);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("100000 * 100000 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__product));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_negative_edge_cases() {
+
+    long long __sn__neg = (-100LL);
+
+    long long __sn__double_neg = (-__sn__neg);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("-(-100) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__double_neg));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    long long __sn__small = 5LL;
+
+    long long __sn__large = 10LL;
+
+    long long __sn__diff = sn_sub_long(__sn__small, __sn__large);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("5 - 10 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__diff));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_division_edge_cases() {
+
+    long long __sn__quot1 = sn_div_long(17LL, 5LL);
+
+    long long __sn__rem1 = sn_mod_long(17LL, 5LL);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("17 / 5 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__quot1));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("17 % 5 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__rem1));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    long long __sn__neg_div = sn_div_long((-20LL), 4LL);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("-20 / 4 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__neg_div));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    long long __sn__neg_mod = sn_mod_long((-17LL), 5LL);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("-17 % 5 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__neg_mod));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_double_precision() {
+
+    double __sn__tiny = 9.9999999999999995e-07;
+
+    double __sn__result = sn_mul_double(__sn__tiny, 1000000.0);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("0.000001 * 1000000 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__result));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    double __sn__a = 1.0;
+
+    double __sn__b = 0.90000000000000002;
+
+    double __sn__diff = sn_sub_double(__sn__a, __sn__b);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("1.0 - 0.9 approximately = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__diff));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_boolean_logic() {
+
+    bool __sn__t = true;
+
+    bool __sn__f = false;
+
+    bool __sn__expr1 = (!(__sn__t && __sn__f));
+
+    bool __sn__expr2 = ((!__sn__t) || (!__sn__f));
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("!(true && false) = ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__expr1) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("!true || !false = ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__expr2) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_zero_operations() {
+
+    long long __sn__x = 42LL;
+
+    long long __sn__add_zero = sn_add_long(__sn__x, 0LL);
+
+    long long __sn__sub_zero = sn_sub_long(__sn__x, 0LL);
+
+    long long __sn__mul_zero = sn_mul_long(__sn__x, 0LL);
+
+    long long __sn__mul_one = sn_mul_long(__sn__x, 1LL);
+
+    long long __sn__div_one = sn_div_long(__sn__x, 1LL);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("42 + 0 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__add_zero));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("42 - 0 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sub_zero));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("42 * 0 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__mul_zero));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("42 * 1 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__mul_one));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("42 / 1 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__div_one));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+int main() {
+    sn_print("=== Large Numbers ===\n");
+    
+    __sn__test_large_numbers();
+    
+    sn_print("=== Negative Edge Cases ===\n");
+    
+    __sn__test_negative_edge_cases();
+    
+    sn_print("=== Division Edge Cases ===\n");
+    
+    __sn__test_division_edge_cases();
+    
+    sn_print("=== Double Precision ===\n");
+    
+    __sn__test_double_precision();
+    
+    sn_print("=== Boolean Logic ===\n");
+    
+    __sn__test_boolean_logic();
+    
+    sn_print("=== Zero Operations ===\n");
+    
+    __sn__test_zero_operations();
+    
+    return 0LL;    fflush(stdout);
+}
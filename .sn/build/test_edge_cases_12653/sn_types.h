@@ -0,0 +1,30 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+void __sn__test_large_numbers();
+void __sn__test_negative_edge_cases();
+void __sn__test_division_edge_cases();
+void __sn__test_double_precision();
+void __sn__test_boolean_logic();
+void __sn__test_zero_operations();
+
+
+
+
+#endif
@@ -0,0 +1,606 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_int_equality() {
+
+    sn_print("Test: int equality\n");
+    
+
+    long long __sn__a = 42LL;
+
+    long long __sn__b = 42LL;
+
+    long long __sn__c = 100LL;
+
+    sn_assert((__sn__a == __sn__b), "int ==");
+    
+
+    sn_assert((__sn__a != __sn__c), "int !=");
+    
+
+    sn_assert(sn_lt_long(__sn__a, __sn__c), "int <");
+    
+
+    sn_assert((__sn__a <= __sn__b), "int <=");
+    
+
+    sn_assert(sn_gt_long(__sn__c, __sn__a), "int >");
+    
+
+    sn_assert((__sn__b >= __sn__a), "int >=");
+    
+
+    sn_assert((42LL == 42LL), "int literal ==");
+    
+
+    sn_assert((42LL != 100LL), "int literal !=");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_long_equality() {
+
+    sn_print("Test: long equality\n");
+    
+
+    long long __sn__a = 9223372036854775807LL;
+
+    long long __sn__b = 9223372036854775807LL;
+
+    long long __sn__c = 0LL;
+
+    sn_assert((__sn__a == __sn__b), "long ==");
+    
+
+    sn_assert((__sn__a != __sn__c), "long !=");
+    
+
+    sn_assert(sn_lt_long(__sn__c, __sn__a), "long <");
+    
+
+    sn_assert((__sn__c <= __sn__a), "long <=");
+    
+
+    sn_assert(sn_gt_long(__sn__a, __sn__c), "long >");
+    
+
+    sn_assert((__sn__a >= __sn__b), "long >=");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_double_equality() {
+
+    sn_print("Test: double equality\n");
+    
+
+    double __sn__a = 3.1415899999999999;
+
+    double __sn__b = 3.1415899999999999;
+
+    double __sn__c = 2.71828;
+
+    sn_assert((__sn__a == __sn__b), "double ==");
+    
+
+    sn_assert((__sn__a != __sn__c), "double !=");
+    
+
+    sn_assert(sn_lt_double(__sn__c, __sn__a), "double <");
+    
+
+    sn_assert((__sn__c <= __sn__a), "double <=");
+    
+
+    sn_assert(sn_gt_double(__sn__a, __sn__c), "double >");
+    
+
+    sn_assert((__sn__a >= __sn__b), "double >=");
+    
+
+    sn_assert((3.1400000000000001 == 3.1400000000000001), "double literal ==");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_float_equality() {
+
+    sn_print("Test: float equality\n");
+    
+
+    float __sn__a = 3.1400000000000001;
+
+    float __sn__b = 3.1400000000000001;
+
+    float __sn__c = 2.71;
+
+    sn_assert((__sn__a == __sn__b), "float ==");
+    
+
+    sn_assert((__sn__a != __sn__c), "float !=");
+    
+
+    sn_assert(sn_lt_float(__sn__c, __sn__a), "float <");
+    
+
+    sn_assert((__sn__c <= __sn__a), "float <=");
+    
+
+    sn_assert(sn_gt_float(__sn__a, __sn__c), "float >");
+    
+
+    sn_assert((__sn__a >= __sn__b), "float >=");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_bool_equality() {
+
+    sn_print("Test: bool equality\n");
+    
+
+    bool __sn__t = true;
+
+    bool __sn__f = false;
+
+    bool __sn__t2 = true;
+
+    sn_assert((__sn__t == __sn__t2), "bool var == var");
+    
+
+    sn_assert((__sn__t != __sn__f), "bool var != var");
+    
+
+    sn_assert((__sn__t == true), "bool var == true");
+    
+
+    sn_assert((__sn__f == false), "bool var == false");
+    
+
+    sn_assert((__sn__t != false), "bool var != false");
+    
+
+    sn_assert((__sn__f != true), "bool var != true");
+    
+
+    sn_assert((true == true), "bool true == true");
+    
+
+    sn_assert((false == false), "bool false == false");
+    
+
+    sn_assert((true != false), "bool true != false");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_char_equality() {
+
+    sn_print("Test: char equality\n");
+    
+
+    char __sn__a = (char)65;
+
+    char __sn__b = (char)65;
+
+    char __sn__c = (char)90;
+
+    sn_assert((__sn__a == __sn__b), "char ==");
+    
+
+    sn_assert((__sn__a != __sn__c), "char !=");
+    
+
+    sn_assert(sn_lt_char(__sn__a, __sn__c), "char <");
+    
+
+    sn_assert((__sn__a <= __sn__b), "char <=");
+    
+
+    sn_assert(sn_gt_char(__sn__c, __sn__a), "char >");
+    
+
+    sn_assert((__sn__b >= __sn__a), "char >=");
+    
+
+    sn_assert(((char)88 == (char)88), "char literal ==");
+    
+
+    sn_assert(((char)88 != (char)89), "char literal !=");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_byte_equality() {
+
+    sn_print("Test: byte equality\n");
+    
+
+    unsigned char __sn__a = 255LL;
+
+    unsigned char __sn__b = 255LL;
+
+    unsigned char __sn__c = 0LL;
+
+    sn_assert((__sn__a == __sn__b), "byte ==");
+    
+
+    sn_assert((__sn__a != __sn__c), "byte !=");
+    
+
+    sn_assert(sn_lt_byte(__sn__c, __sn__a), "byte <");
+    
+
+    sn_assert((__sn__c <= __sn__a), "byte <=");
+    
+
+    sn_assert(sn_gt_byte(__sn__a, __sn__c), "byte >");
+    
+
+    sn_assert((__sn__a >= __sn__b), "byte >=");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_string_equality() {
+
+    sn_print("Test: string equality\n");
+    
+
+    sn_auto_str char * __sn__a = strdup("hello");
+
+    sn_auto_str char * __sn__b = strdup("hello");
+
+    sn_auto_str char * __sn__c = strdup("world");
+
+    sn_assert((strcmp(__sn__a, __sn__b) == 0), "str ==");
+    
+
+    sn_assert((strcmp(__sn__a, __sn__c) != 0), "str !=");
+    
+
+    sn_assert((strcmp(__sn__a, __sn__c) < 0), "str < (lexicographic)");
+    
+
+    sn_assert((strcmp(__sn__a, __sn__b) <= 0), "str <=");
+    
+
+    sn_assert((strcmp(__sn__c, __sn__a) > 0), "str >");
+    
+
+    sn_assert((strcmp(__sn__b, __sn__a) >= 0), "str >=");
+    
+
+    sn_assert((strcmp("test", "test") == 0), "str literal ==");
+    
+
+    sn_assert((strcmp("test", "other") != 0), "str literal !=");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_int32_equality() {
+
+    sn_print("Test: int32 equality\n");
+    
+
+    int32_t __sn__a = 2147483647LL;
+
+    int32_t __sn__b = 2147483647LL;
+
+    int32_t __sn__c = 0LL;
+
+    sn_assert((__sn__a == __sn__b), "int32 ==");
+    
+
+    sn_assert((__sn__a != __sn__c), "int32 !=");
+    
+
+    sn_assert(sn_lt_int32(__sn__c, __sn__a), "int32 <");
+    
+
+    sn_assert((__sn__c <= __sn__a), "int32 <=");
+    
+
+    sn_assert(sn_gt_int32(__sn__a, __sn__c), "int32 >");
+    
+
+    sn_assert((__sn__a >= __sn__b), "int32 >=");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_uint_equality() {
+
+    sn_print("Test: uint equality\n");
+    
+
+    uint64_t __sn__a = 9223372036854775807LL;
+
+    uint64_t __sn__b = 9223372036854775807LL;
+
+    uint64_t __sn__c = 0LL;
+
+    sn_assert((__sn__a == __sn__b), "uint ==");
+    
+
+    sn_assert((__sn__a != __sn__c), "uint !=");
+    
+
+    sn_assert(sn_lt_uint(__sn__c, __sn__a), "uint <");
+    
+
+    sn_assert((__sn__c <= __sn__a), "uint <=");
+    
+
+    sn_assert(sn_gt_uint(__sn__a, __sn__c), "uint >");
+    
+
+    sn_assert((__sn__a >= __sn__b), "uint >=");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_uint32_equality() {
+
+    sn_print("Test: uint32 equality\n");
+    
+
+    uint32_t __sn__a = 4294967295LL;
+
+    uint32_t __sn__b = 4294967295LL;
+
+    uint32_t __sn__c = 0LL;
+
+    sn_assert((__sn__a == __sn__b), "uint32 ==");
+    
+
+    sn_assert((__sn__a != __sn__c), "uint32 !=");
+    
+
+    sn_assert(sn_lt_uint32(__sn__c, __sn__a), "uint32 <");
+    
+
+    sn_assert((__sn__c <= __sn__a), "uint32 <=");
+    
+
+    sn_assert(sn_gt_uint32(__sn__a, __sn__c), "uint32 >");
+    
+
+    sn_assert((__sn__a >= __sn__b), "uint32 >=");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_array_equality() {
+
+    sn_print("Test: array equality\n");
+    
+
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__c = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__d = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        });
+
+    sn_assert(sn_array_equals(__sn__a, __sn__b), "int[] ==");
+    
+
+    sn_assert(!sn_array_equals(__sn__a, __sn__c), "int[] != (different element)");
+    
+
+    sn_assert(!sn_array_equals(__sn__a, __sn__d), "int[] != (different length)");
+    
+
+    sn_auto_arr SnArray * __sn__s1 = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("hello") });
+            sn_array_push(__al__, &(char *){ strdup("world") });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__s2 = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("hello") });
+            sn_array_push(__al__, &(char *){ strdup("world") });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__s3 = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("hello") });
+            sn_array_push(__al__, &(char *){ strdup("there") });
+            __al__;
+        });
+
+    sn_assert(sn_array_equals_string(__sn__s1, __sn__s2), "str[] ==");
+    
+
+    sn_assert(!sn_array_equals_string(__sn__s1, __sn__s3), "str[] !=");
+    
+
+    sn_auto_arr SnArray * __sn__b1 = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 3);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__b2 = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 3);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__b3 = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 3);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        });
+
+    sn_assert(sn_array_equals(__sn__b1, __sn__b2), "bool[] ==");
+    
+
+    sn_assert(!sn_array_equals(__sn__b1, __sn__b3), "bool[] !=");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_mixed_comparisons() {
+
+    sn_print("Test: mixed type comparisons\n");
+    
+
+    long long __sn__i = 42LL;
+
+    long long __sn__l = 42LL;
+
+    sn_assert((__sn__i == __sn__l), "int == long");
+    
+
+    double __sn__d = 42.0;
+
+    sn_assert((__sn__i == __sn__d), "int == double");
+    
+
+    sn_assert((sn_add_long(2LL, 2LL) == 4LL), "expr == literal");
+    
+
+    sn_assert((sn_sub_long(10LL, 5LL) != 6LL), "expr != literal");
+    
+
+    sn_assert(sn_gt_long(sn_mul_long(3LL, 4LL), 10LL), "expr > literal");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+int main() {
+    sn_print("=== Comprehensive Equality Tests ===\n\n");
+    
+    __sn__test_int_equality();
+    
+    __sn__test_long_equality();
+    
+    __sn__test_double_equality();
+    
+    __sn__test_float_equality();
+    
+    __sn__test_bool_equality();
+    
+    __sn__test_char_equality();
+    
+    __sn__test_byte_equality();
+    
+    __sn__test_string_equality();
+    
+    __sn__test_int32_equality();
+    
+    __sn__test_uint_equality();
+    
+    __sn__test_uint32_equality();
+    
+    __sn__test_array_equality();
+    
+    __sn__test_mixed_comparisons();
+    
+    sn_print("\n=== All equality tests passed! ===\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,37 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+void __sn__test_int_equality();
+void __sn__test_long_equality();
+void __sn__test_double_equality();
+void __sn__test_float_equality();
+void __sn__test_bool_equality();
+void __sn__test_char_equality();
+void __sn__test_byte_equality();
+void __sn__test_string_equality();
+void __sn__test_int32_equality();
+void __sn__test_uint_equality();
+void __sn__test_uint32_equality();
+void __sn__test_array_equality();
+void __sn__test_mixed_comparisons();
+
+
+
+
+#endif
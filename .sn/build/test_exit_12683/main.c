@@ -0,0 +1,14 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_println("Before exit");
+    
+    sn_exit(1LL);
+    
+    sn_println("This should not be printed");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,13 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__say_hello() {
+
+    sn_println("hello");}
+
+int main() {
+    __sn__say_hello();    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,209 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__Z_OK() {
+
+    return 0LL;}
+
+
+long long __sn__Z_BEST_SPEED() {
+
+    return 1LL;}
+
+
+long long __sn__Z_DATA_ERROR() {
+
+    return (-3LL);}
+
+
+double __sn__PI() {
+
+    return 3.1415899999999999;}
+
+
+uint64_t __sn__DEFAULT_PORT() {
+
+    return 8080LL;}
+
+
+unsigned char __sn__MAX_BYTE() {
+
+    return 255LL;}
+
+
+char __sn__NEWLINE() {
+
+    return (char)10;}
+
+
+bool __sn__IS_DEBUG() {
+
+    return false;}
+
+
+char * __sn__GREETING() {
+
+    return strdup("Hello");}
+
+
+long long __sn__square(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, __sn__x);}
+
+
+long long __sn__negate(long long __sn__x) {
+
+    return (-__sn__x);}
+
+
+bool __sn__is_positive(long long __sn__x) {
+
+    return sn_gt_long(__sn__x, 0LL);}
+
+
+bool __sn__is_zero(long long __sn__x) {
+
+    return (__sn__x == 0LL);}
+
+
+long long __sn__increment(long long __sn__x) {
+
+    return sn_add_long(__sn__x, 1LL);}
+
+
+long long __sn__decrement(long long __sn__x) {
+
+    return sn_sub_long(__sn__x, 1LL);}
+
+
+long long __sn__add(long long __sn__a, long long __sn__b) {
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+long long __sn__multiply(long long __sn__a, long long __sn__b) {
+
+    return sn_mul_long(__sn__a, __sn__b);}
+
+
+long long __sn__max(long long __sn__a, long long __sn__b) {
+
+    return __sn__a;}
+
+
+long long __sn__min(long long __sn__a, long long __sn__b) {
+
+    return __sn__b;}
+
+
+double __sn__average(double __sn__a, double __sn__b) {
+
+    return sn_div_double(sn_add_double(__sn__a, __sn__b), 2.0);}
+
+
+double __sn__area_circle(double __sn__radius) {
+
+    return sn_mul_double(sn_mul_double(3.1415899999999999, __sn__radius), __sn__radius);}
+
+
+long long __sn__area_rect(long long __sn__w, long long __sn__h) {
+
+    return sn_mul_long(__sn__w, __sn__h);}
+
+
+long long __sn__hypotenuse_sq(long long __sn__x, long long __sn__y) {
+
+    return sn_add_long(sn_mul_long(__sn__x, __sn__x), sn_mul_long(__sn__y, __sn__y));}
+
+
+long long __sn__cube(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, __sn__square(__sn__x));}
+
+
+long long __sn__double_add(long long __sn__a, long long __sn__b) {
+
+    return sn_mul_long(__sn__add(__sn__a, __sn__b), 2LL);}
+
+long long native_const() {
+
+    return 42LL;}
+
+long long native_compute(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 10LL);}
+
+int main() {
+    sn_print("=== Expression-Bodied Function Tests ===\n\n");
+    
+    sn_assert((__sn__Z_OK() == 0LL), "Z_OK");
+    
+    sn_assert((__sn__Z_BEST_SPEED() == 1LL), "Z_BEST_SPEED");
+    
+    sn_assert((__sn__Z_DATA_ERROR() == (-3LL)), "Z_DATA_ERROR");
+    
+    sn_assert((sn_gt_double(__sn__PI(), 3.1400000000000001) && sn_lt_double(__sn__PI(), 3.1499999999999999)), "PI");
+    
+    sn_assert((__sn__DEFAULT_PORT() == 8080LL), "DEFAULT_PORT");
+    
+    sn_assert((__sn__MAX_BYTE() == 255LL), "MAX_BYTE");
+    
+    sn_assert((__sn__NEWLINE() == (char)10), "NEWLINE");
+    
+    sn_assert((!__sn__IS_DEBUG()), "IS_DEBUG");
+    
+    sn_assert(({char *__sct0__=__sn__GREETING();bool __scr__=(strcmp(__sct0__,"Hello")==0);free(__sct0__);__scr__;}), "GREETING");
+    
+    sn_print("test_constant_functions: PASS\n");
+    
+    sn_assert((__sn__square(5LL) == 25LL), "square");
+    
+    sn_assert((__sn__negate(10LL) == (-10LL)), "negate");
+    
+    sn_assert(__sn__is_positive(5LL), "is_positive true");
+    
+    sn_assert((!__sn__is_positive((-5LL))), "is_positive false");
+    
+    sn_assert(__sn__is_zero(0LL), "is_zero true");
+    
+    sn_assert((!__sn__is_zero(1LL)), "is_zero false");
+    
+    sn_assert((__sn__increment(41LL) == 42LL), "increment");
+    
+    sn_assert((__sn__decrement(43LL) == 42LL), "decrement");
+    
+    sn_print("test_single_param_functions: PASS\n");
+    
+    sn_assert((__sn__add(10LL, 32LL) == 42LL), "add");
+    
+    sn_assert((__sn__multiply(6LL, 7LL) == 42LL), "multiply");
+    
+    sn_assert((__sn__average(40.0, 44.0) == 42.0), "average");
+    
+    sn_print("test_multi_param_functions: PASS\n");
+    
+    sn_assert((__sn__area_rect(6LL, 7LL) == 42LL), "area_rect");
+    
+    sn_assert((__sn__hypotenuse_sq(3LL, 4LL) == 25LL), "hypotenuse_sq");
+    
+    sn_print("test_expression_functions: PASS\n");
+    
+    sn_assert((__sn__cube(3LL) == 27LL), "cube");
+    
+    sn_assert((__sn__double_add(10LL, 11LL) == 42LL), "double_add");
+    
+    sn_print("test_nested_calls: PASS\n");
+    
+    sn_assert((native_const() == 42LL), "native_const");
+    
+    sn_assert((native_compute(5LL) == 50LL), "native_compute");
+    
+    sn_print("test_native_expression_bodied: PASS\n");
+    
+    sn_print("\nAll expression-bodied function tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
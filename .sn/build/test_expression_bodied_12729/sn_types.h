@@ -0,0 +1,51 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long __sn__Z_OK();
+long long __sn__Z_BEST_SPEED();
+long long __sn__Z_DATA_ERROR();
+double __sn__PI();
+uint64_t __sn__DEFAULT_PORT();
+unsigned char __sn__MAX_BYTE();
+char __sn__NEWLINE();
+bool __sn__IS_DEBUG();
+char * __sn__GREETING();
+long long __sn__square(long long);
+long long __sn__negate(long long);
+bool __sn__is_positive(long long);
+bool __sn__is_zero(long long);
+long long __sn__increment(long long);
+long long __sn__decrement(long long);
+long long __sn__add(long long, long long);
+long long __sn__multiply(long long, long long);
+long long __sn__max(long long, long long);
+long long __sn__min(long long, long long);
+double __sn__average(double, double);
+double __sn__area_circle(double);
+long long __sn__area_rect(long long, long long);
+long long __sn__hypotenuse_sq(long long, long long);
+long long __sn__cube(long long);
+long long __sn__double_add(long long, long long);
+long long native_const();
+long long native_compute(long long);
+
+
+
+
+#endif
@@ -0,0 +1,76 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__all_match(SnArray * __sn__arr, void * __sn__pred) {
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__arr)); __sn__i++) {
+            if ((!((bool (*)(void *, long long))((__Closure__ *)__sn__pred)->fn)(__sn__pred, (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])))) {
+                return false;}
+        }
+    }
+
+    return true;}
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 4);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            __al__;
+        });
+    bool __sn__r1 = ({ sn_auto_fn void *__fn_tmp_1__ = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__all_match(__sn__arr, __fn_tmp_1__); });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__r1) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__arr2 = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 4);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            __al__;
+        });
+    bool __sn__r2 = ({ sn_auto_fn void *__fn_tmp_1__ = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__all_match(__sn__arr2, __fn_tmp_1__); });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__r2) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
+
+static bool __lambda_0__(void *__closure__, long long __sn__x) {
+    return (sn_mod_long(__sn__x, 2LL) == 0LL);
+}
+
+static bool __lambda_1__(void *__closure__, long long __sn__x) {
+    return (sn_mod_long(__sn__x, 2LL) == 0LL);
+}
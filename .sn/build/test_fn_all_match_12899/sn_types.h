@@ -0,0 +1,27 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+bool __sn__all_match(SnArray *, void *);
+
+
+
+static bool __lambda_0__(void *__closure__, long long __sn__x);
+static bool __lambda_1__(void *__closure__, long long __sn__x);
+
+#endif
@@ -0,0 +1,49 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__reverse_arr(SnArray * __sn__arr) {
+
+    sn_auto_arr SnArray * __sn__result = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+
+    {
+        for (long long __sn__i = sn_sub_long(sn_array_length(__sn__arr), 1LL); (__sn__i >= 0LL); __sn__i--) {
+            __sn__arr_push(&__sn__result, (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]));
+            
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__rev = __sn__reverse_arr(__sn__arr);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__rev, " ");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
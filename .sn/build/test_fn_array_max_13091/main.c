@@ -0,0 +1,40 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__array_max(SnArray * __sn__arr) {
+
+    long long __sn__m = (((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+
+    {
+        for (long long __sn__i = 1LL; sn_lt_long(__sn__i, sn_array_length(__sn__arr)); __sn__i++) {
+            if (sn_gt_long((((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]), __sn__m)) {
+                (__sn__m = (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]));
+                
+            }
+        }
+    }
+
+    return __sn__m;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(({ sn_auto_arr SnArray *__al_tmp_0__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 9LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        }); __sn__array_max(__al_tmp_0__); })));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__make_range(long long __sn__start, long long __sn__count) {
+
+    sn_auto_arr SnArray * __sn__result = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, __sn__count); __sn__i++) {
+            __sn__arr_push(&__sn__result, sn_add_long(__sn__start, __sn__i));
+            
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = __sn__make_range(1LL, 5LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__arr, ", ");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__take(SnArray * __sn__arr, long long __sn__n) {
+
+    sn_auto_arr SnArray * __sn__result = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+
+    {
+        for (long long __sn__i = 0LL; (sn_lt_long(__sn__i, __sn__n) && sn_lt_long(__sn__i, sn_array_length(__sn__arr))); __sn__i++) {
+            __sn__arr_push(&__sn__result, (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]));
+            
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 8);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__first3 = __sn__take(__sn__arr, 3LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__first3, " ");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
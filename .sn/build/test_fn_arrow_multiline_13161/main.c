@@ -0,0 +1,29 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__add(long long __sn__a, long long __sn__b) {
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+long long __sn__apply(void * __sn__f, long long __sn__x, long long __sn__y) {
+
+    return ((long long (*)(void *, long long, long long))((__Closure__ *)__sn__f)->fn)(__sn__f, __sn__x, __sn__y);}
+
+long long __fn_wrap_0__(void *__closure__, long long __p0__, long long __p1__) {
+    (void)__closure__;
+    return __sn__add(__p0__, __p1__);
+ }
+int main() {
+    long long __sn__result = ({ sn_auto_fn void *__fn_tmp_0__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_0__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__apply(__fn_tmp_0__, 3LL, 4LL); });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,29 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__double_fn(long long __sn__n) {
+
+    return sn_mul_long(__sn__n, 2LL);}
+
+
+long long __sn__apply(long long __sn__x, void * __sn__f) {
+
+    return ((long long (*)(void *, long long))((__Closure__ *)__sn__f)->fn)(__sn__f, __sn__x);}
+
+long long __fn_wrap_0__(void *__closure__, long long __p0__) {
+    (void)__closure__;
+    return __sn__double_fn(__p0__);
+ }
+int main() {
+    long long __sn__result = ({ sn_auto_fn void *__fn_tmp_1__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_0__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__apply(5LL, __fn_tmp_1__); });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__greet() {
+
+    sn_print("hello\n");
+    
+}
+
+int main() {
+    __sn__greet();
+    
+    fflush(stdout);
+    return 0;
+}
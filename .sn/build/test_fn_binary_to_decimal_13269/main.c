@@ -0,0 +1,57 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__bin_to_dec(SnArray * __sn__bits) {
+
+    long long __sn__result = 0LL;
+
+    {
+        SnArray *__arr_0__ = __sn__bits;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__b = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                (__sn__result = sn_add_long(sn_mul_long(__sn__result, 2LL), __sn__b));
+                
+            }
+        }
+    }
+
+    return __sn__result;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(({ sn_auto_arr SnArray *__al_tmp_0__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 4);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 0LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            __al__;
+        }); __sn__bin_to_dec(__al_tmp_0__); })));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(({ sn_auto_arr SnArray *__al_tmp_0__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 4);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            __al__;
+        }); __sn__bin_to_dec(__al_tmp_0__); })));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
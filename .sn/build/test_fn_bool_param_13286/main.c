@@ -0,0 +1,24 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__show_flag(bool __sn__b) {
+
+    if (__sn__b) {
+        sn_print("on\n");
+        
+    } else {
+        sn_print("off\n");
+        
+    }
+}
+
+int main() {
+    __sn__show_flag(true);
+    
+    __sn__show_flag(false);
+    
+    fflush(stdout);
+    return 0;
+}
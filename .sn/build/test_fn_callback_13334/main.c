@@ -0,0 +1,31 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__say_hello() {
+
+    sn_print("hello\n");
+    
+}
+
+
+void __sn__do_twice(void * __sn__f) {
+
+    ((void (*)(void *))((__Closure__ *)__sn__f)->fn)(__sn__f);
+    
+
+    ((void (*)(void *))((__Closure__ *)__sn__f)->fn)(__sn__f);
+    
+}
+
+void __fn_wrap_0__(void *__closure__) {
+    (void)__closure__;
+    __sn__say_hello();
+ }
+int main() {
+    ({ sn_auto_fn void *__fn_tmp_0__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_0__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__do_twice(__fn_tmp_0__); });
+    
+    fflush(stdout);
+    return 0;
+}
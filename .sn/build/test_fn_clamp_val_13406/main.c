@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__clamp(long long __sn__v, long long __sn__lo, long long __sn__hi) {
+
+    if (sn_lt_long(__sn__v, __sn__lo)) {
+        return __sn__lo;}
+
+    if (sn_gt_long(__sn__v, __sn__hi)) {
+        return __sn__hi;}
+
+    return __sn__v;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__clamp(5LL, 0LL, 10LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__clamp((-5LL), 0LL, 10LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__clamp(15LL, 0LL, 10LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
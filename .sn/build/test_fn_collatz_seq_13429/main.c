@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    long long __sn__n = 10LL;
+    __sn__arr_push(&__sn__arr, __sn__n);
+    
+    while ((__sn__n != 1LL)) {
+        if ((sn_mod_long(__sn__n, 2LL) == 0LL)) {
+            __sn__n = __sn__n / 2LL;
+            
+        } else {
+            (__sn__n = sn_add_long(sn_mul_long(3LL, __sn__n), 1LL));
+            
+        }
+        __sn__arr_push(&__sn__arr, __sn__n);
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__arr, " ");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
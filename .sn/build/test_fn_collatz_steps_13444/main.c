@@ -0,0 +1,39 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__collatz(long long __sn__n) {
+
+    long long __sn__steps = 0LL;
+
+    while ((__sn__n != 1LL)) {
+        if ((sn_mod_long(__sn__n, 2LL) == 0LL)) {
+            __sn__n = __sn__n / 2LL;
+            
+        } else {
+            (__sn__n = sn_add_long(sn_mul_long(3LL, __sn__n), 1LL));
+            
+        }
+        __sn__steps++;
+        
+    }
+
+    return __sn__steps;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__collatz(1LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__collatz(6LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__double_fn(long long __sn__n) {
+
+    return sn_mul_long(__sn__n, 2LL);}
+
+
+long long __sn__add1(long long __sn__n) {
+
+    return sn_add_long(__sn__n, 1LL);}
+
+int main() {
+    long long __sn__x = 5LL;
+    long long __sn__result = __sn__add1(__sn__double_fn(__sn__x));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
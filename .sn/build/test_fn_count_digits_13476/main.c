@@ -0,0 +1,50 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__count_digits(long long __sn__n) {
+
+    if ((__sn__n == 0LL)) {
+        return 1LL;}
+
+    long long __sn__count = 0LL;
+
+    long long __sn__x = __sn__n;
+
+    if (sn_lt_long(__sn__x, 0LL)) {
+        (__sn__x = (-__sn__x));
+        
+    }
+
+    while (sn_gt_long(__sn__x, 0LL)) {
+        (__sn__x = sn_div_long(__sn__x, 10LL));
+        
+        __sn__count++;
+        
+    }
+
+    return __sn__count;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__count_digits(12345LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__count_digits(1LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__count_digits(1000000LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__count_divisors(long long __sn__n) {
+
+    long long __sn__count = 0LL;
+
+    {
+        for (long long __sn__i = 1LL; (__sn__i <= __sn__n); __sn__i++) {
+            if ((sn_mod_long(__sn__n, __sn__i) == 0LL)) {
+                __sn__count++;
+                
+            }
+        }
+    }
+
+    return __sn__count;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__count_divisors(12LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__count_divisors(7LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
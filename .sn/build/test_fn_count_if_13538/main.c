@@ -0,0 +1,58 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__count_if(SnArray * __sn__arr, void * __sn__pred) {
+
+    long long __sn__count = 0LL;
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__arr)); __sn__i++) {
+            if (((bool (*)(void *, long long))((__Closure__ *)__sn__pred)->fn)(__sn__pred, (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]))) {
+                __sn__count++;
+                
+            }
+        }
+    }
+
+    return __sn__count;}
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 10);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            sn_array_push(__al__, &(long long){ 9LL });
+            sn_array_push(__al__, &(long long){ 10LL });
+            __al__;
+        });
+    long long __sn__c = ({ sn_auto_fn void *__fn_tmp_1__ = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__count_if(__sn__arr, __fn_tmp_1__); });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__c));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
+
+static bool __lambda_0__(void *__closure__, long long __sn__x) {
+    return sn_gt_long(__sn__x, 5LL);
+}
@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__digital_root(long long __sn__n) {
+
+    while ((__sn__n >= 10LL)) {
+        long long __sn__sum = 0LL;
+        while (sn_gt_long(__sn__n, 0LL)) {
+            __sn__sum = __sn__sum + sn_mod_long(__sn__n, 10LL);
+            
+            __sn__n = __sn__n / 10LL;
+            
+        }
+        (__sn__n = __sn__sum);
+        
+    }
+
+    return __sn__n;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__digital_root(9875LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__digital_root(493LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include "sn_types.h"
+
+
+
+
+double __sn__sum_doubles(SnArray * __sn__arr) {
+
+    double __sn__total = 0.0;
+
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            double __sn__x = ((double *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__total = __sn__total + __sn__x;
+                
+            }
+        }
+    }
+
+    return __sn__total;}
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 4);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.0 });
+            sn_array_push(__al__, &(double){ 2.0 });
+            sn_array_push(__al__, &(double){ 3.0 });
+            sn_array_push(__al__, &(double){ 4.0 });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%.5f", (double)(__sn__sum_doubles(__sn__arr)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,19 @@
+#include "sn_types.h"
+
+
+
+
+double __sn__circle_area(double __sn__r) {
+
+    return sn_mul_double(sn_mul_double(3.1415899999999999, __sn__r), __sn__r);}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%.5f", (double)(__sn__circle_area(2.0)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
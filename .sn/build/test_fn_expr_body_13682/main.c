@@ -0,0 +1,30 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__double_it(long long __sn__n) {
+
+    return sn_mul_long(__sn__n, 2LL);}
+
+
+long long __sn__triple_it(long long __sn__n) {
+
+    return sn_mul_long(__sn__n, 3LL);}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__double_it(7LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__triple_it(3LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__factorial(long long __sn__n) {
+
+    long long __sn__result = 1LL;
+
+    {
+        for (long long __sn__i = 2LL; (__sn__i <= __sn__n); __sn__i++) {
+            __sn__result = __sn__result * __sn__i;
+            
+        }
+    }
+
+    return __sn__result;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__factorial(5LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__factorial(10LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,40 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__gen_fib(long long __sn__n) {
+
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 0LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            __al__;
+        });
+
+    {
+        for (long long __sn__i = 2LL; sn_lt_long(__sn__i, __sn__n); __sn__i++) {
+            __sn__arr_push(&__sn__arr, sn_add_long((((long long *)__sn__arr->data)[({ long long __ai__ = sn_sub_long(__sn__i, 1LL); __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]), (((long long *)__sn__arr->data)[({ long long __ai__ = sn_sub_long(__sn__i, 2LL); __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__arr;
+        __sn__arr = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_arr SnArray * __sn__result = __sn__gen_fib(10LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__result, " ");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__fib(long long __sn__n) {
+
+    if ((__sn__n <= 1LL)) {
+        return __sn__n;}
+
+    long long __sn__a = 0LL;
+
+    long long __sn__b = 1LL;
+
+    {
+        for (long long __sn__i = 2LL; (__sn__i <= __sn__n); __sn__i++) {
+            long long __sn__c = sn_add_long(__sn__a, __sn__b);
+            (__sn__a = __sn__b);
+            
+            (__sn__b = __sn__c);
+            
+        }
+    }
+
+    return __sn__b;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__fib(0LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__fib(1LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__fib(10LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__multiply(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 2LL);}
+
+
+long long __sn__add10(long long __sn__x) {
+
+    return sn_add_long(__sn__x, 10LL);}
+
+
+long long __fn_wrap_0__(void *__closure__, long long __p0__) {
+    (void)__closure__;
+    return __sn__multiply(__p0__);
+ }
+long long __fn_wrap_1__(void *__closure__, long long __p0__) {
+    (void)__closure__;
+    return __sn__add10(__p0__);
+ }
+long long __fn_wrap_2__(void *__closure__, long long __p0__) {
+    (void)__closure__;
+    return __sn__add10(__p0__);
+ }
+int main() {
+    sn_auto_Handler __sn__Handler __sn__h1 = (__sn__Handler){ .__sn__callback = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_0__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }) };
+    long long __sn__result1 = ((long long (*)(void *, long long))((__Closure__ *)(__sn__h1.__sn__callback))->fn)(__sn__h1.__sn__callback, 5LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("multiply(5) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result1));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Handler __sn__Handler __sn__h2 = (__sn__Handler){ .__sn__callback = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_1__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }) };
+    long long __sn__result2 = ((long long (*)(void *, long long))((__Closure__ *)(__sn__h2.__sn__callback))->fn)(__sn__h2.__sn__callback, 5LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("add10(5) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result2));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    ({
+        void *__old_cl__ = __sn__h1.__sn__callback;
+        __sn__h1.__sn__callback = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_2__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; });
+        sn_closure_release(&__old_cl__);
+        __sn__h1.__sn__callback;
+    });
+    
+    long long __sn__result3 = ((long long (*)(void *, long long))((__Closure__ *)(__sn__h1.__sn__callback))->fn)(__sn__h1.__sn__callback, 7LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("add10(7) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result3));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__chained = ((long long (*)(void *, long long))((__Closure__ *)(__sn__h1.__sn__callback))->fn)(__sn__h1.__sn__callback, ((long long (*)(void *, long long))((__Closure__ *)(__sn__h2.__sn__callback))->fn)(__sn__h2.__sn__callback, 3LL));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("add10(add10(3)) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__chained));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
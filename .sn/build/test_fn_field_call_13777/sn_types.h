@@ -0,0 +1,79 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Handler (as val) */
+typedef struct {
+    void * __sn__callback;
+} __sn__Handler;
+/* Value operations */
+static inline __sn__Handler __sn__Handler_copy(const __sn__Handler *src) {
+    __sn__Handler dst;
+    dst.__sn__callback = sn_closure_retain(src->__sn__callback);
+    return dst;
+}
+
+static inline void __sn__Handler_cleanup(__sn__Handler *p) {
+    sn_closure_release((void **)&p->__sn__callback);
+
+}
+
+#define sn_auto_Handler __attribute__((cleanup(__sn__Handler_cleanup)))
+
+static inline void __sn__Handler_cleanup_elem(void *p) { __sn__Handler_cleanup((__sn__Handler *)p); }
+static inline void __sn__Handler_copy_into(const void *src, void *dst) { *(__sn__Handler *)dst = __sn__Handler_copy((const __sn__Handler *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Handler *__sn__Handler_alloc(void) {
+    return calloc(1, sizeof(__sn__Handler));
+}
+
+static inline void __sn__Handler_release(__sn__Handler **p) {
+    if (*p) {
+        sn_closure_release((void **)&(*p)->__sn__callback);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Handler __attribute__((cleanup(__sn__Handler_release)))
+
+static inline void __sn__Handler_release_elem(void *p) { __sn__Handler_release((__sn__Handler **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Handler_to_string(const __sn__Handler *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Handler { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "callback: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__callback);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+long long __sn__multiply(long long);
+long long __sn__add10(long long);
+
+
+
+long long __fn_wrap_0__(void *__closure__, long long __p0__);
+long long __fn_wrap_1__(void *__closure__, long long __p0__);
+long long __fn_wrap_2__(void *__closure__, long long __p0__);
+
+#endif
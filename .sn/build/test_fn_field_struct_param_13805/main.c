@@ -0,0 +1,189 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Point __sn__scale(__sn__Point __sn__p) {
+
+    return (__sn__Point){ .__sn__x = sn_mul_long(__sn__p.__sn__x, 2LL), .__sn__y = sn_mul_long(__sn__p.__sn__y, 2LL) };}
+
+
+__sn__Point __sn__translate(__sn__Point __sn__p) {
+
+    return (__sn__Point){ .__sn__x = sn_add_long(__sn__p.__sn__x, 10LL), .__sn__y = sn_add_long(__sn__p.__sn__y, 10LL) };}
+
+
+char * __sn__describePositive(__sn__Point __sn__p) {
+
+    if ((sn_gt_long(__sn__p.__sn__x, 0LL) && sn_gt_long(__sn__p.__sn__y, 0LL))) {
+        return strdup("positive");}
+
+    return strdup("other");}
+
+
+char * __sn__describeOrigin(__sn__Point __sn__p) {
+
+    if (((__sn__p.__sn__x == 0LL) && (__sn__p.__sn__y == 0LL))) {
+        return strdup("origin");}
+
+    return strdup("nonzero");}
+
+
+
+__sn__Point __fn_wrap_0__(void *__closure__, __sn__Point __p0__) {
+    (void)__closure__;
+    return __sn__scale(__p0__);
+ }
+char * __fn_wrap_1__(void *__closure__, __sn__Point __p0__) {
+    (void)__closure__;
+    return __sn__describePositive(__p0__);
+ }
+__sn__Point __fn_wrap_2__(void *__closure__, __sn__Point __p0__) {
+    (void)__closure__;
+    return __sn__translate(__p0__);
+ }
+char * __fn_wrap_3__(void *__closure__, __sn__Point __p0__) {
+    (void)__closure__;
+    return __sn__describeOrigin(__p0__);
+ }
+__sn__Point __fn_wrap_4__(void *__closure__, __sn__Point __p0__) {
+    (void)__closure__;
+    return __sn__scale(__p0__);
+ }
+int main() {
+    sn_auto_Processor __sn__Processor __sn__proc = (__sn__Processor){ .__sn__transform = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_0__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }), .__sn__describe = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_1__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }) };
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 3LL, .__sn__y = 4LL };
+    __sn__Point __sn__scaled = ((__sn__Point (*)(void *, __sn__Point))((__Closure__ *)(__sn__proc.__sn__transform))->fn)(__sn__proc.__sn__transform, __sn__p);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 1: scale(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(") = (");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__scaled.__sn__x));
+            sn_auto_str char *__is_p6__ = sn_strdup(",");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__scaled.__sn__y));
+            sn_auto_str char *__is_p8__ = sn_strdup(")\n");
+            sn_str_concat_multi(9, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((__sn__scaled.__sn__x == 6LL), "scaled.x should be 6");
+    
+    sn_assert((__sn__scaled.__sn__y == 8LL), "scaled.y should be 8");
+    
+    sn_auto_str char * __sn__desc = ((char * (*)(void *, __sn__Point))((__Closure__ *)(__sn__proc.__sn__describe))->fn)(__sn__proc.__sn__describe, __sn__p);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 1: describe(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(") = ");
+            sn_auto_str char *__is_p5__ = sn_strdup(__sn__desc);
+            sn_auto_str char *__is_p6__ = sn_strdup("\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((strcmp(__sn__desc, "positive") == 0), "desc should be positive");
+    
+    ({
+        void *__old_cl__ = __sn__proc.__sn__transform;
+        __sn__proc.__sn__transform = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_2__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; });
+        sn_closure_release(&__old_cl__);
+        __sn__proc.__sn__transform;
+    });
+    
+    __sn__Point __sn__translated = ((__sn__Point (*)(void *, __sn__Point))((__Closure__ *)(__sn__proc.__sn__transform))->fn)(__sn__proc.__sn__transform, __sn__p);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 2: translate(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(") = (");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__translated.__sn__x));
+            sn_auto_str char *__is_p6__ = sn_strdup(",");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__translated.__sn__y));
+            sn_auto_str char *__is_p8__ = sn_strdup(")\n");
+            sn_str_concat_multi(9, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((__sn__translated.__sn__x == 13LL), "translated.x should be 13");
+    
+    sn_assert((__sn__translated.__sn__y == 14LL), "translated.y should be 14");
+    
+    ({
+        void *__old_cl__ = __sn__proc.__sn__describe;
+        __sn__proc.__sn__describe = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_3__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; });
+        sn_closure_release(&__old_cl__);
+        __sn__proc.__sn__describe;
+    });
+    
+    __sn__Point __sn__origin = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+    sn_auto_str char * __sn__originDesc = ((char * (*)(void *, __sn__Point))((__Closure__ *)(__sn__proc.__sn__describe))->fn)(__sn__proc.__sn__describe, __sn__origin);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 3: describeOrigin(0,0) = ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__originDesc);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((strcmp(__sn__originDesc, "origin") == 0), "should be origin");
+    
+    sn_auto_str char * __sn__nonzeroDesc = ((char * (*)(void *, __sn__Point))((__Closure__ *)(__sn__proc.__sn__describe))->fn)(__sn__proc.__sn__describe, __sn__p);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 3: describeOrigin(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(") = ");
+            sn_auto_str char *__is_p5__ = sn_strdup(__sn__nonzeroDesc);
+            sn_auto_str char *__is_p6__ = sn_strdup("\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((strcmp(__sn__nonzeroDesc, "nonzero") == 0), "should be nonzero");
+    
+    __sn__Point __sn__p2 = (__sn__Point){ .__sn__x = 1LL, .__sn__y = 1LL };
+    ({
+        void *__old_cl__ = __sn__proc.__sn__transform;
+        __sn__proc.__sn__transform = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_4__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; });
+        sn_closure_release(&__old_cl__);
+        __sn__proc.__sn__transform;
+    });
+    
+    __sn__Point __sn__s1 = ((__sn__Point (*)(void *, __sn__Point))((__Closure__ *)(__sn__proc.__sn__transform))->fn)(__sn__proc.__sn__transform, __sn__p);
+    __sn__Point __sn__s2 = ((__sn__Point (*)(void *, __sn__Point))((__Closure__ *)(__sn__proc.__sn__transform))->fn)(__sn__proc.__sn__transform, __sn__p2);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 4: scale(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(") = (");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__s1.__sn__x));
+            sn_auto_str char *__is_p6__ = sn_strdup(",");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__s1.__sn__y));
+            sn_auto_str char *__is_p8__ = sn_strdup(")\n");
+            sn_str_concat_multi(9, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 4: scale(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p2.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p2.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(") = (");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__s2.__sn__x));
+            sn_auto_str char *__is_p6__ = sn_strdup(",");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__s2.__sn__y));
+            sn_auto_str char *__is_p8__ = sn_strdup(")\n");
+            sn_str_concat_multi(9, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__);
+        }); sn_print(__ps__); };
+    
+    sn_assert((__sn__s1.__sn__x == 6LL), "s1.x should be 6");
+    
+    sn_assert((__sn__s2.__sn__x == 2LL), "s2.x should be 2");
+    
+    sn_print("\nAll fn-field-struct-param tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
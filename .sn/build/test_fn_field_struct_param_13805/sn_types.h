@@ -0,0 +1,143 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Processor (as val) */
+typedef struct {
+    void * __sn__transform;
+    void * __sn__describe;
+} __sn__Processor;
+/* Value operations */
+static inline __sn__Processor __sn__Processor_copy(const __sn__Processor *src) {
+    __sn__Processor dst;
+    dst.__sn__transform = sn_closure_retain(src->__sn__transform);
+    dst.__sn__describe = sn_closure_retain(src->__sn__describe);
+    return dst;
+}
+
+static inline void __sn__Processor_cleanup(__sn__Processor *p) {
+    sn_closure_release((void **)&p->__sn__transform);
+    sn_closure_release((void **)&p->__sn__describe);
+
+}
+
+#define sn_auto_Processor __attribute__((cleanup(__sn__Processor_cleanup)))
+
+static inline void __sn__Processor_cleanup_elem(void *p) { __sn__Processor_cleanup((__sn__Processor *)p); }
+static inline void __sn__Processor_copy_into(const void *src, void *dst) { *(__sn__Processor *)dst = __sn__Processor_copy((const __sn__Processor *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Processor *__sn__Processor_alloc(void) {
+    return calloc(1, sizeof(__sn__Processor));
+}
+
+static inline void __sn__Processor_release(__sn__Processor **p) {
+    if (*p) {
+        sn_closure_release((void **)&(*p)->__sn__transform);
+        sn_closure_release((void **)&(*p)->__sn__describe);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Processor __attribute__((cleanup(__sn__Processor_release)))
+
+static inline void __sn__Processor_release_elem(void *p) { __sn__Processor_release((__sn__Processor **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Processor_to_string(const __sn__Processor *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Processor { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "transform: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__transform);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "describe: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__describe);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Point __sn__scale(__sn__Point);
+__sn__Point __sn__translate(__sn__Point);
+char * __sn__describePositive(__sn__Point);
+char * __sn__describeOrigin(__sn__Point);
+
+
+
+__sn__Point __fn_wrap_0__(void *__closure__, __sn__Point __p0__);
+char * __fn_wrap_1__(void *__closure__, __sn__Point __p0__);
+__sn__Point __fn_wrap_2__(void *__closure__, __sn__Point __p0__);
+char * __fn_wrap_3__(void *__closure__, __sn__Point __p0__);
+__sn__Point __fn_wrap_4__(void *__closure__, __sn__Point __p0__);
+
+#endif
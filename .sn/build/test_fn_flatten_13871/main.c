@@ -0,0 +1,65 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__grid = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 3);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            sn_array_push(__al__, &(long long){ 9LL });
+            __al__;
+        }) });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__flat = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 3LL); __sn__i++) {
+            {
+                for (long long __sn__j = 0LL; sn_lt_long(__sn__j, 3LL); __sn__j++) {
+                    __sn__arr_push(&__sn__flat, (((long long *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })]));
+                    
+                }
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__flat, " ");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    double __sn__sum = 0.0;
+    {
+        for (long long __sn__i = 1LL; (__sn__i <= 4LL); __sn__i++) {
+            double __sn__d = sn_mul_double(__sn__i, 1.0);
+            __sn__sum = __sn__sum + sn_div_double(1.0, __sn__d);
+            
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%.5f", (double)(__sn__sum));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
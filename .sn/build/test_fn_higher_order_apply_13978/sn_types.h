@@ -0,0 +1,29 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long __sn__apply_twice(void *, long long);
+long long __sn__double_val(long long);
+long long __sn__add_ten(long long);
+
+
+
+long long __fn_wrap_0__(void *__closure__, long long __p0__);
+long long __fn_wrap_1__(void *__closure__, long long __p0__);
+
+#endif
@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__is_armstrong(long long __sn__n) {
+
+    long long __sn__sum = 0LL;
+
+    long long __sn__tmp = __sn__n;
+
+    while (sn_gt_long(__sn__tmp, 0LL)) {
+        long long __sn__d = sn_mod_long(__sn__tmp, 10LL);
+        __sn__sum = __sn__sum + sn_mul_long(sn_mul_long(__sn__d, __sn__d), __sn__d);
+        
+        __sn__tmp = __sn__tmp / 10LL;
+        
+    }
+
+    return (__sn__sum == __sn__n);}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__is_armstrong(153LL)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__is_armstrong(123LL)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__is_palindrome(long long __sn__n) {
+
+    long long __sn__original = __sn__n;
+
+    long long __sn__reversed = 0LL;
+
+    while (sn_gt_long(__sn__n, 0LL)) {
+        (__sn__reversed = sn_add_long(sn_mul_long(__sn__reversed, 10LL), sn_mod_long(__sn__n, 10LL)));
+        
+        (__sn__n = sn_div_long(__sn__n, 10LL));
+        
+    }
+
+    return (__sn__original == __sn__reversed);}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__is_palindrome(121LL)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__is_palindrome(123LL)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__is_palindrome(12321LL)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
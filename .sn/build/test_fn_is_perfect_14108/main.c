@@ -0,0 +1,42 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__is_perfect(long long __sn__n) {
+
+    long long __sn__sum = 0LL;
+
+    {
+        for (long long __sn__i = 1LL; sn_lt_long(__sn__i, __sn__n); __sn__i++) {
+            if ((sn_mod_long(__sn__n, __sn__i) == 0LL)) {
+                __sn__sum = __sn__sum + __sn__i;
+                
+            }
+        }
+    }
+
+    return (__sn__sum == __sn__n);}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__is_perfect(6LL)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__is_perfect(28LL)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__is_perfect(12LL)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__lcm(long long __sn__a, long long __sn__b) {
+
+    return sn_mul_long(sn_div_long(__sn__a, __sn__gcd2(__sn__a, __sn__b)), __sn__b);}
+
+
+long long __sn__gcd2(long long __sn__a, long long __sn__b) {
+
+    while ((__sn__b != 0LL)) {
+        long long __sn__t = __sn__b;
+        (__sn__b = sn_mod_long(__sn__a, __sn__b));
+        
+        (__sn__a = __sn__t);
+        
+    }
+
+    return __sn__a;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__lcm(4LL, 6LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__lcm(7LL, 5LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        }) });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            __al__;
+        }) });
+            __al__;
+        });
+    long long __sn__c00 = sn_add_long(sn_mul_long((((long long *)(((SnArray * *)__sn__a->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__a->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->len : __ai__; })]), (((long long *)(((SnArray * *)__sn__b->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__b->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->len : __ai__; })])), sn_mul_long((((long long *)(((SnArray * *)__sn__a->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__a->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->len : __ai__; })]), (((long long *)(((SnArray * *)__sn__b->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__b->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->len : __ai__; })])));
+    long long __sn__c01 = sn_add_long(sn_mul_long((((long long *)(((SnArray * *)__sn__a->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__a->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->len : __ai__; })]), (((long long *)(((SnArray * *)__sn__b->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__b->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->len : __ai__; })])), sn_mul_long((((long long *)(((SnArray * *)__sn__a->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__a->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->len : __ai__; })]), (((long long *)(((SnArray * *)__sn__b->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__b->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->len : __ai__; })])));
+    long long __sn__c10 = sn_add_long(sn_mul_long((((long long *)(((SnArray * *)__sn__a->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__a->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->len : __ai__; })]), (((long long *)(((SnArray * *)__sn__b->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__b->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->len : __ai__; })])), sn_mul_long((((long long *)(((SnArray * *)__sn__a->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__a->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->len : __ai__; })]), (((long long *)(((SnArray * *)__sn__b->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__b->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->len : __ai__; })])));
+    long long __sn__c11 = sn_add_long(sn_mul_long((((long long *)(((SnArray * *)__sn__a->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__a->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->len : __ai__; })]), (((long long *)(((SnArray * *)__sn__b->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__b->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->len : __ai__; })])), sn_mul_long((((long long *)(((SnArray * *)__sn__a->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__a->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })])->len : __ai__; })]), (((long long *)(((SnArray * *)__sn__b->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__b->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })])->len : __ai__; })])));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__c00));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__c01));
+            sn_auto_str char *__is_p3__ = sn_strdup("\n");
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__c10));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__c11));
+            sn_auto_str char *__is_p3__ = sn_strdup("\n");
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__max3(long long __sn__a, long long __sn__b, long long __sn__c) {
+
+    long long __sn__m = __sn__a;
+
+    if (sn_gt_long(__sn__b, __sn__m)) {
+        (__sn__m = __sn__b);
+        
+    }
+
+    if (sn_gt_long(__sn__c, __sn__m)) {
+        (__sn__m = __sn__c);
+        
+    }
+
+    return __sn__m;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__max3(1LL, 2LL, 3LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__max3(3LL, 1LL, 2LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__max3(2LL, 3LL, 1LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
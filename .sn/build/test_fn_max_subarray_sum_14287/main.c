@@ -0,0 +1,54 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__max_subarray(SnArray * __sn__arr) {
+
+    long long __sn__maxSum = (((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+
+    long long __sn__curSum = (((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+
+    {
+        for (long long __sn__i = 1LL; sn_lt_long(__sn__i, sn_array_length(__sn__arr)); __sn__i++) {
+            if (sn_gt_long(sn_add_long(__sn__curSum, (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])), (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]))) {
+                (__sn__curSum = sn_add_long(__sn__curSum, (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+                
+            } else {
+                (__sn__curSum = (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]));
+                
+            }
+            if (sn_gt_long(__sn__curSum, __sn__maxSum)) {
+                (__sn__maxSum = __sn__curSum);
+                
+            }
+        }
+    }
+
+    return __sn__maxSum;}
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 9);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ (-2LL) });
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ (-3LL) });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ (-1LL) });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ (-5LL) });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__max_subarray(__sn__arr)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__merge(SnArray * __sn__a, SnArray * __sn__b) {
+
+    sn_auto_arr SnArray * __sn__result = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+
+    long long __sn__i = 0LL;
+
+    long long __sn__j = 0LL;
+
+    while ((sn_lt_long(__sn__i, sn_array_length(__sn__a)) && sn_lt_long(__sn__j, sn_array_length(__sn__b)))) {
+        if (((((long long *)__sn__a->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })]) <= (((long long *)__sn__b->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })]))) {
+            __sn__arr_push(&__sn__result, (((long long *)__sn__a->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })]));
+            
+            __sn__i++;
+            
+        } else {
+            __sn__arr_push(&__sn__result, (((long long *)__sn__b->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })]));
+            
+            __sn__j++;
+            
+        }
+    }
+
+    while (sn_lt_long(__sn__i, sn_array_length(__sn__a))) {
+        __sn__arr_push(&__sn__result, (((long long *)__sn__a->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__a->len : __ai__; })]));
+        
+        __sn__i++;
+        
+    }
+
+    while (sn_lt_long(__sn__j, sn_array_length(__sn__b))) {
+        __sn__arr_push(&__sn__result, (((long long *)__sn__b->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__b->len : __ai__; })]));
+        
+        __sn__j++;
+        
+    }
+
+    {
+        SnArray * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 4);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 4);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__merged = __sn__merge(__sn__a, __sn__b);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__merged, " ");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__is_positive(long long __sn__n) {
+
+    return sn_gt_long(__sn__n, 0LL);}
+
+
+bool __sn__is_negative(long long __sn__n) {
+
+    return sn_lt_long(__sn__n, 0LL);}
+
+
+char * __sn__sign_str(long long __sn__n) {
+
+    if (__sn__is_positive(__sn__n)) {
+        return strdup("+");} else {
+        if (__sn__is_negative(__sn__n)) {
+            return strdup("-");} else {
+            return strdup("0");}
+    }
+}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__sign_str(5LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__sign_str((-3LL));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__sign_str(0LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,25 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__add(long long __sn__a, long long __sn__b) {
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+long long __sn__mul(long long __sn__a, long long __sn__b) {
+
+    return sn_mul_long(__sn__a, __sn__b);}
+
+int main() {
+    long long __sn__result = __sn__add(__sn__mul(2LL, 3LL), __sn__mul(4LL, 5LL));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__get_magic() {
+
+    return 42LL;}
+
+int main() {
+    long long __sn__x = __sn__get_magic();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
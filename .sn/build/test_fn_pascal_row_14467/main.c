@@ -0,0 +1,32 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__pascal(long long __sn__n, long long __sn__k) {
+
+    if (((__sn__k == 0LL) || (__sn__k == __sn__n))) {
+        return 1LL;}
+
+    return sn_add_long(__sn__pascal(sn_sub_long(__sn__n, 1LL), sn_sub_long(__sn__k, 1LL)), __sn__pascal(sn_sub_long(__sn__n, 1LL), __sn__k));}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__pascal(5LL, 0LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__pascal(5LL, 1LL)));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)(__sn__pascal(5LL, 2LL)));
+            sn_auto_str char *__is_p5__ = sn_strdup(" ");
+            sn_auto_str char *__is_p6__ = sn_str_fmt("%lld", (long long)(__sn__pascal(5LL, 3LL)));
+            sn_auto_str char *__is_p7__ = sn_strdup(" ");
+            sn_auto_str char *__is_p8__ = sn_str_fmt("%lld", (long long)(__sn__pascal(5LL, 4LL)));
+            sn_auto_str char *__is_p9__ = sn_strdup(" ");
+            sn_auto_str char *__is_p10__ = sn_str_fmt("%lld", (long long)(__sn__pascal(5LL, 5LL)));
+            sn_auto_str char *__is_p11__ = sn_strdup("\n");
+            sn_str_concat_multi(12, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__, __is_p9__, __is_p10__, __is_p11__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__popcount(long long __sn__n) {
+
+    long long __sn__count = 0LL;
+
+    while (sn_gt_long(__sn__n, 0LL)) {
+        if ((sn_mod_long(__sn__n, 2LL) == 1LL)) {
+            __sn__count++;
+            
+        }
+        __sn__n = __sn__n / 2LL;
+        
+    }
+
+    return __sn__count;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__popcount(0LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__popcount(7LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__popcount(255LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
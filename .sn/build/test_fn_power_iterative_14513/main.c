@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__pow_iter(long long __sn__base, long long __sn__exp) {
+
+    long long __sn__result = 1LL;
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, __sn__exp); __sn__i++) {
+            __sn__result = __sn__result * __sn__base;
+            
+        }
+    }
+
+    return __sn__result;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__pow_iter(2LL, 10LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__pow_iter(3LL, 4LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__get_primes(long long __sn__limit) {
+
+    sn_auto_arr SnArray * __sn__result = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+
+    {
+        for (long long __sn__n = 2LL; (__sn__n <= __sn__limit); __sn__n++) {
+            bool __sn__is_prime = true;
+            {
+                for (long long __sn__i = 2LL; (sn_mul_long(__sn__i, __sn__i) <= __sn__n); __sn__i++) {
+                    if ((sn_mod_long(__sn__n, __sn__i) == 0LL)) {
+                        (__sn__is_prime = false);
+                        
+                        break;
+                    }
+                }
+            }
+            if (__sn__is_prime) {
+                __sn__arr_push(&__sn__result, __sn__n);
+                
+            }
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_arr SnArray * __sn__primes = __sn__get_primes(30LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__primes, " ");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
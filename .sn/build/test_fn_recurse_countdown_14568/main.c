@@ -0,0 +1,29 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__countdown(long long __sn__n) {
+
+    if ((__sn__n <= 0LL)) {
+        sn_print("done\n");
+        
+        return;}
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__n));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+
+    __sn__countdown(sn_sub_long(__sn__n, 1LL));
+    
+}
+
+int main() {
+    __sn__countdown(5LL);
+    
+    fflush(stdout);
+    return 0;
+}
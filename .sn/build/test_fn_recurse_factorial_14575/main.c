@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__factorial(long long __sn__n) {
+
+    if ((__sn__n <= 1LL)) {
+        return 1LL;}
+
+    return sn_mul_long(__sn__n, __sn__factorial(sn_sub_long(__sn__n, 1LL)));}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__factorial(5LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__factorial(0LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
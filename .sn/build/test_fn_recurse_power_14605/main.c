@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__power(long long __sn__base, long long __sn__exp) {
+
+    if ((__sn__exp == 0LL)) {
+        return 1LL;}
+
+    return sn_mul_long(__sn__base, __sn__power(__sn__base, sn_sub_long(__sn__exp, 1LL)));}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__power(2LL, 10LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
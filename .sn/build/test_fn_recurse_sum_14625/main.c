@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__sum_to(long long __sn__n) {
+
+    if ((__sn__n <= 0LL)) {
+        return 0LL;}
+
+    return sn_add_long(__sn__n, __sn__sum_to(sn_sub_long(__sn__n, 1LL)));}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum_to(10LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__gcd_rec(long long __sn__a, long long __sn__b) {
+
+    if ((__sn__b == 0LL)) {
+        return __sn__a;}
+
+    return __sn__gcd_rec(__sn__b, sn_mod_long(__sn__a, __sn__b));}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__gcd_rec(48LL, 18LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__gcd_rec(100LL, 75LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
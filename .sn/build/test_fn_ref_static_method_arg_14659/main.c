@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__produce() {
+
+    return strdup("world");}
+
+
+__sn__Box __sn__Box_make(void * __sn__f) {
+
+    return (__sn__Box){ .__sn__fnField = __sn__f };}
+
+char * __fn_wrap_0__(void *__closure__) {
+    (void)__closure__;
+    return __sn__produce();
+ }
+int main() {
+    sn_auto_Box __sn__Box __sn__b = ({ __sn__Box_make(({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_0__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; })); });
+    sn_auto_Box __sn__Box __sn__b2 = __sn__Box_copy(&__sn__b);
+    { sn_auto_str char *__ps__ = ((char * (*)(void *))((__Closure__ *)(__sn__b2.__sn__fnField))->fn)(__sn__b2.__sn__fnField); sn_print(__ps__); };
+    
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,77 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Box (as val) */
+typedef struct {
+    void * __sn__fnField;
+} __sn__Box;
+/* Value operations */
+static inline __sn__Box __sn__Box_copy(const __sn__Box *src) {
+    __sn__Box dst;
+    dst.__sn__fnField = sn_closure_retain(src->__sn__fnField);
+    return dst;
+}
+
+static inline void __sn__Box_cleanup(__sn__Box *p) {
+    sn_closure_release((void **)&p->__sn__fnField);
+
+}
+
+#define sn_auto_Box __attribute__((cleanup(__sn__Box_cleanup)))
+
+static inline void __sn__Box_cleanup_elem(void *p) { __sn__Box_cleanup((__sn__Box *)p); }
+static inline void __sn__Box_copy_into(const void *src, void *dst) { *(__sn__Box *)dst = __sn__Box_copy((const __sn__Box *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Box *__sn__Box_alloc(void) {
+    return calloc(1, sizeof(__sn__Box));
+}
+
+static inline void __sn__Box_release(__sn__Box **p) {
+    if (*p) {
+        sn_closure_release((void **)&(*p)->__sn__fnField);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Box __attribute__((cleanup(__sn__Box_release)))
+
+static inline void __sn__Box_release_elem(void *p) { __sn__Box_release((__sn__Box **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Box_to_string(const __sn__Box *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Box { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "fnField: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__fnField);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+char * __sn__produce();
+
+__sn__Box __sn__Box_make(void *);
+
+
+char * __fn_wrap_0__(void *__closure__);
+
+#endif
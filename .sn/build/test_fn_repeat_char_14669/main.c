@@ -0,0 +1,24 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__repeat_print(long long __sn__n) {
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, __sn__n); __sn__i++) {
+            sn_print("*");
+            
+        }
+    }
+
+    sn_print("\n");
+    
+}
+
+int main() {
+    __sn__repeat_print(5LL);
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+
+double __sn__average(double __sn__a, double __sn__b) {
+
+    return sn_div_double(sn_add_double(__sn__a, __sn__b), 2.0);}
+
+int main() {
+    double __sn__avg = __sn__average(10.0, 20.0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%.5f", (double)(__sn__avg));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,24 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__greeting(char * __sn__name) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("hello ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });}
+
+int main() {
+    sn_auto_str char * __sn__s = __sn__greeting("world");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__s);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
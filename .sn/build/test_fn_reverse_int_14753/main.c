@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__reverse_int(long long __sn__n) {
+
+    long long __sn__rev = 0LL;
+
+    while (sn_gt_long(__sn__n, 0LL)) {
+        (__sn__rev = sn_add_long(sn_mul_long(__sn__rev, 10LL), sn_mod_long(__sn__n, 10LL)));
+        
+        __sn__n = __sn__n / 10LL;
+        
+    }
+
+    return __sn__rev;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__reverse_int(123LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__reverse_int(9000LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__safe_div(long long __sn__a, long long __sn__b) {
+
+    if ((__sn__b == 0LL)) {
+        return 0LL;}
+
+    return sn_div_long(__sn__a, __sn__b);}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__safe_div(10LL, 2LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__safe_div(10LL, 0LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
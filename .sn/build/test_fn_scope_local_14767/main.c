@@ -0,0 +1,31 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__outer_fn() {
+
+    long long __sn__a = 10LL;
+
+    long long __sn__b = __sn__inner_fn(__sn__a);
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+long long __sn__inner_fn(long long __sn__n) {
+
+    long long __sn__local = sn_mul_long(__sn__n, 2LL);
+
+    return __sn__local;}
+
+int main() {
+    long long __sn__x = __sn__outer_fn();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
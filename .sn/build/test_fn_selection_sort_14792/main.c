@@ -0,0 +1,49 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 9LL });
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_sub_long(sn_array_length(__sn__arr), 1LL)); __sn__i++) {
+            long long __sn__minIdx = __sn__i;
+            {
+                for (long long __sn__j = sn_add_long(__sn__i, 1LL); sn_lt_long(__sn__j, sn_array_length(__sn__arr)); __sn__j++) {
+                    if (sn_lt_long((((long long *)__sn__arr->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]), (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__minIdx; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]))) {
+                        (__sn__minIdx = __sn__j);
+                        
+                    }
+                }
+            }
+            long long __sn__tmp = (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+            ((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })] = (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__minIdx; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+            
+            ((long long *)__sn__arr->data)[({ long long __ai__ = __sn__minIdx; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })] = __sn__tmp;
+            
+        }
+    }
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__arr)); __sn__i++) {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+                    sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                    sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
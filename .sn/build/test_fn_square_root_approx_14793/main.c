@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    double __sn__n = 25.0;
+    double __sn__guess = sn_div_double(__sn__n, 2.0);
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 10LL); __sn__i++) {
+            (__sn__guess = sn_div_double(sn_add_double(__sn__guess, sn_div_double(__sn__n, __sn__guess)), 2.0));
+            
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%.5f", (double)(__sn__guess));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__wrap(char * __sn__s, char * __sn__prefix, char * __sn__suffix) {
+
+    return ({
+        sn_str_concat_multi(3, __sn__prefix, __sn__s, __sn__suffix);
+    });}
+
+int main() {
+    sn_auto_str char * __sn__result = __sn__wrap("hello", "[", "]");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__result);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
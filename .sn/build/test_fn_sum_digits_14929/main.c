@@ -0,0 +1,36 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__sum_digits(long long __sn__n) {
+
+    long long __sn__sum = 0LL;
+
+    long long __sn__x = __sn__n;
+
+    while (sn_gt_long(__sn__x, 0LL)) {
+        __sn__sum = __sn__sum + sn_mod_long(__sn__x, 10LL);
+        
+        (__sn__x = sn_div_long(__sn__x, 10LL));
+        
+    }
+
+    return __sn__sum;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum_digits(123LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum_digits(9999LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__sum_odd(long long __sn__n) {
+
+    long long __sn__sum = 0LL;
+
+    {
+        for (long long __sn__i = 1LL; (__sn__i <= __sn__n); __sn__i = __sn__i + 2LL) {
+            __sn__sum = __sn__sum + __sn__i;
+            
+        }
+    }
+
+    return __sn__sum;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum_odd(10LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__sum_range(long long __sn__lo, long long __sn__hi) {
+
+    long long __sn__sum = 0LL;
+
+    {
+        for (long long __sn__i = __sn__lo; (__sn__i <= __sn__hi); __sn__i++) {
+            __sn__sum = __sn__sum + __sn__i;
+            
+        }
+    }
+
+    return __sn__sum;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum_range(1LL, 100LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
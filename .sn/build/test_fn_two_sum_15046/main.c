@@ -0,0 +1,44 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 4);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 11LL });
+            sn_array_push(__al__, &(long long){ 15LL });
+            __al__;
+        });
+    long long __sn__target = 9LL;
+    bool __sn__found = false;
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__arr)); __sn__i++) {
+            {
+                for (long long __sn__j = sn_add_long(__sn__i, 1LL); sn_lt_long(__sn__j, sn_array_length(__sn__arr)); __sn__j++) {
+                    if ((sn_add_long((((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]), (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])) == __sn__target)) {
+                        { sn_auto_str char *__ps__ = ({
+                                sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                                sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                                sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__j));
+                                sn_auto_str char *__is_p3__ = sn_strdup("\n");
+                                sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                            }); sn_print(__ps__); };
+                        
+                        (__sn__found = true);
+                        
+                    }
+                }
+            }
+        }
+    }
+    if ((!__sn__found)) {
+        sn_print("not found\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,25 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__print_n_times(char * __sn__s, long long __sn__n) {
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, __sn__n); __sn__i++) {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup(__sn__s);
+                    sn_auto_str char *__is_p1__ = sn_strdup("\n");
+                    sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+}
+
+int main() {
+    __sn__print_n_times("hello", 3LL);
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__day_name(long long __sn__n) {
+
+    return ({
+            char * __match_result__;
+            long long __match_subject__ = __sn__n;
+            if (__match_subject__ == 1LL) {
+                __match_result__ = strdup("Mon");
+            } else if (__match_subject__ == 2LL) {
+                __match_result__ = strdup("Tue");
+            } else if (__match_subject__ == 3LL) {
+                __match_result__ = strdup("Wed");
+            } else if (__match_subject__ == 4LL) {
+                __match_result__ = strdup("Thu");
+            } else if (__match_subject__ == 5LL) {
+                __match_result__ = strdup("Fri");
+            } else {
+                __match_result__ = strdup("?");
+            }
+            __match_result__;
+        });}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__day_name(1LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__day_name(5LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__day_name(9LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    bool __sn__found = false;
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            {
+                for (long long __sn__j = 0LL; sn_lt_long(__sn__j, 5LL); __sn__j++) {
+                    if (((__sn__i == 2LL) && (__sn__j == 3LL))) {
+                        (__sn__found = true);
+                        
+                        break;
+                    }
+                }
+            }
+            if (__sn__found) {
+                break;
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__found) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
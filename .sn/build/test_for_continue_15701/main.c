@@ -0,0 +1,24 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__sum = 0LL;
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 10LL); __sn__i++) {
+            if ((sn_mod_long(__sn__i, 3LL) == 0LL)) {
+                continue;
+            }
+            __sn__sum = __sn__sum + __sn__i;
+            
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,24 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    {
+        for (long long __sn__i = 1LL; (__sn__i <= 3LL); __sn__i++) {
+            {
+                for (long long __sn__j = 1LL; (__sn__j <= 3LL); __sn__j++) {
+                    { sn_auto_str char *__ps__ = ({
+                            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_mul_long(__sn__i, __sn__j)));
+                            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                        }); sn_print(__ps__); };
+                    
+                }
+            }
+            sn_print("\n");
+            
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
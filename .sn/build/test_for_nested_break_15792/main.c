@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__total = 0LL;
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            {
+                for (long long __sn__j = 0LL; sn_lt_long(__sn__j, 5LL); __sn__j++) {
+                    if ((__sn__j >= 3LL)) {
+                        break;
+                    }
+                    __sn__total++;
+                    
+                }
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__total));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
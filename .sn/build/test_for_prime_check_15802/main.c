@@ -0,0 +1,25 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__n = 17LL;
+    bool __sn__isPrime = true;
+    {
+        for (long long __sn__i = 2LL; (sn_mul_long(__sn__i, __sn__i) <= __sn__n); __sn__i++) {
+            if ((sn_mod_long(__sn__n, __sn__i) == 0LL)) {
+                (__sn__isPrime = false);
+                
+                break;
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((__sn__isPrime) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    {
+        for (long long __sn__i = 1LL; (__sn__i <= 4LL); __sn__i++) {
+            {
+                for (long long __sn__j = 0LL; sn_lt_long(__sn__j, __sn__i); __sn__j++) {
+                    sn_print("*");
+                    
+                }
+            }
+            sn_print("\n");
+            
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
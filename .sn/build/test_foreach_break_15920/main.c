@@ -0,0 +1,29 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__found = (-1LL);
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(1LL, 100LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__x = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if (sn_gt_long(sn_mul_long(__sn__x, __sn__x), 50LL)) {
+                    (__sn__found = __sn__x);
+                    
+                    break;
+                }
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__found));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
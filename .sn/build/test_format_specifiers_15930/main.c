@@ -0,0 +1,96 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 42LL;
+    double __sn__pi = 3.1415926500000002;
+    sn_auto_str char * __sn__name = strdup("Alice");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Padded: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%05lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hex lower: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llx", (long long)(255LL));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hex upper: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llX", (long long)(255LL));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Octal: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llo", (long long)(64LL));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pi 2 decimals: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.2f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pi 4 decimals: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.4f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Scientific: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%e", (double)(1234.5));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Right aligned: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%10s", __sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Left aligned: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%-10s", __sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Width+precision: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%8.2f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Mixed: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%05lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(" and ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.2f", (double)(__sn__pi));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Expr: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%04lld", (long long)(sn_mul_long(__sn__x, 2LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
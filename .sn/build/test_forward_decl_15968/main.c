@@ -0,0 +1,61 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__add(long long __sn__a, long long __sn__b) {
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+long long __sn__multiply(long long __sn__a, long long __sn__b) {
+
+    long long __sn__result = 0LL;
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, __sn__b); __sn__i++) {
+            (__sn__result = __sn__add(__sn__result, __sn__a));
+            
+        }
+    }
+
+    return __sn__result;}
+
+
+long long __sn__calc_sum_of_products() {
+
+    long long __sn__total = 0LL;
+
+    (__sn__total = __sn__add(__sn__total, __sn__multiply(3LL, 4LL)));
+    
+
+    (__sn__total = __sn__add(__sn__total, __sn__multiply(5LL, 2LL)));
+    
+
+    return __sn__total;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("add(5, 3) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__add(5LL, 3LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("multiply(4, 3) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__multiply(4LL, 3LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("calc_sum_of_products() = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__calc_sum_of_products()));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
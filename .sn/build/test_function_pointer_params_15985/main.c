@@ -0,0 +1,205 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__add(long long __sn__a, long long __sn__b) {
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+long long __sn__multiply(long long __sn__a, long long __sn__b) {
+
+    return sn_mul_long(__sn__a, __sn__b);}
+
+
+void __sn__doNothing() {
+
+    long long __sn__x = 0LL;
+}
+
+
+long long __sn__applyOp(long long __sn__a, long long __sn__b, void * __sn__op) {
+
+    return ((long long (*)(void *, long long, long long))((__Closure__ *)__sn__op)->fn)(__sn__op, __sn__a, __sn__b);}
+
+
+void __sn__runCallback(void * __sn__f) {
+
+    ((void (*)(void *))((__Closure__ *)__sn__f)->fn)(__sn__f);
+    
+}
+
+
+void __sn__test_basic() {
+
+    sn_print("Test 1: Basic function pointer parameter\n");
+    
+
+    long long __sn__result = ({ sn_auto_fn void *__fn_tmp_2__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_0__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__applyOp(3LL, 4LL, __fn_tmp_2__); });
+
+    sn_assert((__sn__result == 7LL), "add(3, 4) should be 7");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_different_functions() {
+
+    sn_print("Test 2: Different functions with same signature\n");
+    
+
+    long long __sn__r1 = ({ sn_auto_fn void *__fn_tmp_2__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_1__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__applyOp(3LL, 4LL, __fn_tmp_2__); });
+
+    long long __sn__r2 = ({ sn_auto_fn void *__fn_tmp_2__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_2__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__applyOp(3LL, 4LL, __fn_tmp_2__); });
+
+    sn_assert((__sn__r1 == 7LL), "add should give 7");
+    
+
+    sn_assert((__sn__r2 == 12LL), "multiply should give 12");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_void_callback() {
+
+    sn_print("Test 3: Void function parameter\n");
+    
+
+    ({ sn_auto_fn void *__fn_tmp_0__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_3__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__runCallback(__fn_tmp_0__); });
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_loop_calls() {
+
+    sn_print("Test 4: Function passed in loop\n");
+    
+
+    long long __sn__sum = 0LL;
+
+    long long __sn__i = 0LL;
+
+    while (sn_lt_long(__sn__i, 5LL)) {
+        (__sn__sum = sn_add_long(__sn__sum, ({ sn_auto_fn void *__fn_tmp_2__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_4__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__applyOp(__sn__i, 2LL, __fn_tmp_2__); })));
+        
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+
+    sn_assert((__sn__sum == 20LL), "loop sum should be 20");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_mixed_lambda() {
+
+    sn_print("Test 5: Mixed lambda and named function\n");
+    
+
+    long long __sn__r1 = ({ sn_auto_fn void *__fn_tmp_2__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_5__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__applyOp(10LL, 3LL, __fn_tmp_2__); });
+
+    sn_auto_fn void * __sn__subtractLambda = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__r2 = __sn__applyOp(10LL, 3LL, __sn__subtractLambda);
+
+    sn_assert((__sn__r1 == 13LL), "named function result");
+    
+
+    sn_assert((__sn__r2 == 7LL), "lambda result");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+long long __sn__outer(long long __sn__a, long long __sn__b, void * __sn__op) {
+
+    return sn_add_long(__sn__applyOp(__sn__a, __sn__b, __sn__op), 1LL);}
+
+
+void __sn__test_nested() {
+
+    sn_print("Test 6: Nested function calls with function params\n");
+    
+
+    long long __sn__result = ({ sn_auto_fn void *__fn_tmp_2__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_6__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__outer(5LL, 3LL, __fn_tmp_2__); });
+
+    sn_assert((__sn__result == 9LL), "nested call should give 9");
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+long long __fn_wrap_0__(void *__closure__, long long __p0__, long long __p1__) {
+    (void)__closure__;
+    return __sn__add(__p0__, __p1__);
+ }
+long long __fn_wrap_1__(void *__closure__, long long __p0__, long long __p1__) {
+    (void)__closure__;
+    return __sn__add(__p0__, __p1__);
+ }
+long long __fn_wrap_2__(void *__closure__, long long __p0__, long long __p1__) {
+    (void)__closure__;
+    return __sn__multiply(__p0__, __p1__);
+ }
+void __fn_wrap_3__(void *__closure__) {
+    (void)__closure__;
+    __sn__doNothing();
+ }
+long long __fn_wrap_4__(void *__closure__, long long __p0__, long long __p1__) {
+    (void)__closure__;
+    return __sn__add(__p0__, __p1__);
+ }
+long long __fn_wrap_5__(void *__closure__, long long __p0__, long long __p1__) {
+    (void)__closure__;
+    return __sn__add(__p0__, __p1__);
+ }
+long long __fn_wrap_6__(void *__closure__, long long __p0__, long long __p1__) {
+    (void)__closure__;
+    return __sn__add(__p0__, __p1__);
+ }
+int main() {
+    sn_print("=== Function Pointer Parameter Tests ===\n\n");
+    
+    __sn__test_basic();
+    
+    __sn__test_different_functions();
+    
+    __sn__test_void_callback();
+    
+    __sn__test_loop_calls();
+    
+    __sn__test_mixed_lambda();
+    
+    __sn__test_nested();
+    
+    sn_print("\n=== All function pointer tests passed! ===\n");
+    
+    fflush(stdout);
+    return 0;
+}
+
+static long long __lambda_0__(void *__closure__, long long __sn__a, long long __sn__b) {
+    return sn_sub_long(__sn__a, __sn__b);
+}
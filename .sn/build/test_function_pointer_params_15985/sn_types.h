@@ -0,0 +1,44 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long __sn__add(long long, long long);
+long long __sn__multiply(long long, long long);
+void __sn__doNothing();
+long long __sn__applyOp(long long, long long, void *);
+void __sn__runCallback(void *);
+void __sn__test_basic();
+void __sn__test_different_functions();
+void __sn__test_void_callback();
+void __sn__test_loop_calls();
+void __sn__test_mixed_lambda();
+long long __sn__outer(long long, long long, void *);
+void __sn__test_nested();
+
+
+
+static long long __lambda_0__(void *__closure__, long long __sn__a, long long __sn__b);
+long long __fn_wrap_0__(void *__closure__, long long __p0__, long long __p1__);
+long long __fn_wrap_1__(void *__closure__, long long __p0__, long long __p1__);
+long long __fn_wrap_2__(void *__closure__, long long __p0__, long long __p1__);
+void __fn_wrap_3__(void *__closure__);
+long long __fn_wrap_4__(void *__closure__, long long __p0__, long long __p1__);
+long long __fn_wrap_5__(void *__closure__, long long __p0__, long long __p1__);
+long long __fn_wrap_6__(void *__closure__, long long __p0__, long long __p1__);
+
+#endif
@@ -0,0 +1,64 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__matchPath(char * __sn__pattern, char * __sn__path) {
+
+    sn_auto_str char * __sn__p = strdup(__sn__pattern);
+
+    sn_auto_str char * __sn__r = strdup(__sn__path);
+
+    if ((strcmp(__sn__p, __sn__r) == 0)) {
+        return true;}
+
+    if (__sn___endsWith(&__sn__p, "/*")) {
+        sn_auto_str char * __sn__prefix = __sn___substring(&__sn__p, 0LL, sn_sub_long(sn_str_length(__sn__p), 2LL));
+        if ((!__sn___startsWith(&__sn__r, __sn__prefix))) {
+            return false;}
+        return true;}
+
+    sn_auto_arr SnArray * __sn__patternParts = __sn___split(&__sn__p, "/");
+
+    sn_auto_arr SnArray * __sn__pathParts = __sn___split(&__sn__r, "/");
+
+    if ((sn_array_length(__sn__patternParts) != sn_array_length(__sn__pathParts))) {
+        return false;}
+
+    long long __sn__i = 0LL;
+
+    while (sn_lt_long(__sn__i, sn_array_length(__sn__patternParts))) {
+        if ((strcmp((((char * *)__sn__patternParts->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__patternParts->len : __ai__; })]), (((char * *)__sn__pathParts->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__pathParts->len : __ai__; })])) != 0)) {
+            return false;}
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+
+    return true;}
+
+int main() {
+    long long __sn__i = 0LL;
+    while (sn_lt_long(__sn__i, 100LL)) {
+        bool __sn__result = __sn__matchPath("/items", "/items");
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+    (__sn__i = 0LL);
+    
+    while (sn_lt_long(__sn__i, 100LL)) {
+        bool __sn__result = __sn__matchPath("/items/*", "/items/1");
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+    (__sn__i = 0LL);
+    
+    while (sn_lt_long(__sn__i, 100LL)) {
+        bool __sn__result = __sn__matchPath("/items/list", "/items/list");
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+    sn_print("PASS\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,229 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__SimpleMap_int_int_put(__sn__SimpleMap_int_int *__sn__self, long long __sn__key, long long __sn__value) {
+
+    __sn__arr_push(&__sn__self->__sn__keys, __sn__key);
+    
+
+    __sn__arr_push(&__sn__self->__sn__values, __sn__value);
+    
+}
+
+long long __sn__SimpleMap_int_int_size(__sn__SimpleMap_int_int *__sn__self) {
+
+    return sn_array_length(__sn__self->__sn__keys);}
+
+__sn__EntryIter_int_int __sn__SimpleMap_int_int_iter(__sn__SimpleMap_int_int *__sn__self) {
+
+    return (__sn__EntryIter_int_int){ .__sn__keys = sn_array_copy(__sn__self->__sn__keys), .__sn__values = sn_array_copy(__sn__self->__sn__values), .__sn__index = 0LL };}
+
+
+bool __sn__EntryIter_int_int_hasNext(__sn__EntryIter_int_int *__sn__self) {
+
+    return sn_lt_long(__sn__self->__sn__index, sn_array_length(__sn__self->__sn__keys));}
+
+__sn__Entry_int_int __sn__EntryIter_int_int_next(__sn__EntryIter_int_int *__sn__self) {
+
+    long long __sn__k = (((long long *)__sn__self->__sn__keys->data)[({ long long __ai__ = __sn__self->__sn__index; __ai__ < 0 ? __ai__ + __sn__self->__sn__keys->len : __ai__; })]);
+
+    long long __sn__v = (((long long *)__sn__self->__sn__values->data)[({ long long __ai__ = __sn__self->__sn__index; __ai__ < 0 ? __ai__ + __sn__self->__sn__values->len : __ai__; })]);
+
+    (__sn__self->__sn__index = sn_add_long(__sn__self->__sn__index, 1LL));
+    
+
+    return (__sn__Entry_int_int){ .__sn__key = __sn__k, .__sn__value = __sn__v };}
+
+
+
+void __sn__SimpleMap_str_int_put(__sn__SimpleMap_str_int *__sn__self, char * __sn__key, long long __sn__value) {
+
+    __sn__arr_push(&__sn__self->__sn__keys, strdup(__sn__key));
+    
+
+    __sn__arr_push(&__sn__self->__sn__values, __sn__value);
+    
+}
+
+long long __sn__SimpleMap_str_int_size(__sn__SimpleMap_str_int *__sn__self) {
+
+    return sn_array_length(__sn__self->__sn__keys);}
+
+__sn__EntryIter_str_int __sn__SimpleMap_str_int_iter(__sn__SimpleMap_str_int *__sn__self) {
+
+    return (__sn__EntryIter_str_int){ .__sn__keys = sn_array_copy(__sn__self->__sn__keys), .__sn__values = sn_array_copy(__sn__self->__sn__values), .__sn__index = 0LL };}
+
+
+bool __sn__EntryIter_str_int_hasNext(__sn__EntryIter_str_int *__sn__self) {
+
+    return sn_lt_long(__sn__self->__sn__index, sn_array_length(__sn__self->__sn__keys));}
+
+__sn__Entry_str_int __sn__EntryIter_str_int_next(__sn__EntryIter_str_int *__sn__self) {
+
+    sn_auto_str char * __sn__k = strdup((((char * *)__sn__self->__sn__keys->data)[({ long long __ai__ = __sn__self->__sn__index; __ai__ < 0 ? __ai__ + __sn__self->__sn__keys->len : __ai__; })]));
+
+    long long __sn__v = (((long long *)__sn__self->__sn__values->data)[({ long long __ai__ = __sn__self->__sn__index; __ai__ < 0 ? __ai__ + __sn__self->__sn__values->len : __ai__; })]);
+
+    (__sn__self->__sn__index = sn_add_long(__sn__self->__sn__index, 1LL));
+    
+
+    return (__sn__Entry_str_int){ .__sn__key = strdup(__sn__k), .__sn__value = __sn__v };}
+
+
+
+void __sn__SimpleMap_int_str_put(__sn__SimpleMap_int_str *__sn__self, long long __sn__key, char * __sn__value) {
+
+    __sn__arr_push(&__sn__self->__sn__keys, __sn__key);
+    
+
+    __sn__arr_push(&__sn__self->__sn__values, strdup(__sn__value));
+    
+}
+
+long long __sn__SimpleMap_int_str_size(__sn__SimpleMap_int_str *__sn__self) {
+
+    return sn_array_length(__sn__self->__sn__keys);}
+
+__sn__EntryIter_int_str __sn__SimpleMap_int_str_iter(__sn__SimpleMap_int_str *__sn__self) {
+
+    return (__sn__EntryIter_int_str){ .__sn__keys = sn_array_copy(__sn__self->__sn__keys), .__sn__values = sn_array_copy(__sn__self->__sn__values), .__sn__index = 0LL };}
+
+
+bool __sn__EntryIter_int_str_hasNext(__sn__EntryIter_int_str *__sn__self) {
+
+    return sn_lt_long(__sn__self->__sn__index, sn_array_length(__sn__self->__sn__keys));}
+
+__sn__Entry_int_str __sn__EntryIter_int_str_next(__sn__EntryIter_int_str *__sn__self) {
+
+    long long __sn__k = (((long long *)__sn__self->__sn__keys->data)[({ long long __ai__ = __sn__self->__sn__index; __ai__ < 0 ? __ai__ + __sn__self->__sn__keys->len : __ai__; })]);
+
+    sn_auto_str char * __sn__v = strdup((((char * *)__sn__self->__sn__values->data)[({ long long __ai__ = __sn__self->__sn__index; __ai__ < 0 ? __ai__ + __sn__self->__sn__values->len : __ai__; })]));
+
+    (__sn__self->__sn__index = sn_add_long(__sn__self->__sn__index, 1LL));
+    
+
+    return (__sn__Entry_int_str){ .__sn__key = __sn__k, .__sn__value = strdup(__sn__v) };}
+
+
+int main() {
+    sn_auto_SimpleMap_int_int __sn__SimpleMap_int_int __sn__m = (__sn__SimpleMap_int_int){ .__sn__keys = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        }), .__sn__values = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        }) };
+    __sn__SimpleMap_int_int_put(&__sn__m, 1LL, 100LL);
+    
+    __sn__SimpleMap_int_int_put(&__sn__m, 2LL, 200LL);
+    
+    __sn__SimpleMap_int_int_put(&__sn__m, 3LL, 300LL);
+    
+    if ((__sn__SimpleMap_int_int_size(&__sn__m) != 3LL)) {
+        sn_print("FAIL: map size should be 3\n");
+        
+        return 1LL;}
+    long long __sn__ksum = 0LL;
+    long long __sn__vsum = 0LL;
+    {
+        sn_auto_EntryIter_int_int __sn__EntryIter_int_int __sn_iter__ = __sn__SimpleMap_int_int_iter(&(__sn__m));
+        while (__sn__EntryIter_int_int_hasNext(&__sn_iter__)) {
+            __sn__Entry_int_int __sn__entry = __sn__EntryIter_int_int_next(&__sn_iter__);
+            {
+                (__sn__ksum = sn_add_long(__sn__ksum, __sn__entry.__sn__key));
+                
+                (__sn__vsum = sn_add_long(__sn__vsum, __sn__entry.__sn__value));
+                
+            }
+        }
+    }
+    if ((__sn__ksum != 6LL)) {
+        sn_print("FAIL: key sum should be 6\n");
+        
+        return 1LL;}
+    if ((__sn__vsum != 600LL)) {
+        sn_print("FAIL: value sum should be 600\n");
+        
+        return 1LL;}
+    sn_print("Test 1 passed: SimpleMap<int, int> iteration\n");
+    
+    sn_auto_SimpleMap_str_int __sn__SimpleMap_str_int __sn__m2 = (__sn__SimpleMap_str_int){ .__sn__keys = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 0);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            __al__;
+        }), .__sn__values = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        }) };
+    __sn__SimpleMap_str_int_put(&__sn__m2, "alice", 95LL);
+    
+    __sn__SimpleMap_str_int_put(&__sn__m2, "bob", 82LL);
+    
+    __sn__SimpleMap_str_int_put(&__sn__m2, "carol", 91LL);
+    
+    long long __sn__total = 0LL;
+    {
+        sn_auto_EntryIter_str_int __sn__EntryIter_str_int __sn_iter__ = __sn__SimpleMap_str_int_iter(&(__sn__m2));
+        while (__sn__EntryIter_str_int_hasNext(&__sn_iter__)) {
+            sn_auto_Entry_str_int __sn__Entry_str_int __sn__entry = __sn__EntryIter_str_int_next(&__sn_iter__);
+            {
+                (__sn__total = sn_add_long(__sn__total, __sn__entry.__sn__value));
+                
+            }
+        }
+    }
+    if ((__sn__total != 268LL)) {
+        sn_print("FAIL: total should be 268\n");
+        
+        return 1LL;}
+    sn_print("Test 2 passed: SimpleMap<str, int> iteration\n");
+    
+    sn_auto_SimpleMap_int_str __sn__SimpleMap_int_str __sn__m3 = (__sn__SimpleMap_int_str){ .__sn__keys = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        }), .__sn__values = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 0);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            __al__;
+        }) };
+    __sn__SimpleMap_int_str_put(&__sn__m3, 1LL, "one");
+    
+    __sn__SimpleMap_int_str_put(&__sn__m3, 2LL, "two");
+    
+    long long __sn__ksum3 = 0LL;
+    {
+        sn_auto_EntryIter_int_str __sn__EntryIter_int_str __sn_iter__ = __sn__SimpleMap_int_str_iter(&(__sn__m3));
+        while (__sn__EntryIter_int_str_hasNext(&__sn_iter__)) {
+            sn_auto_Entry_int_str __sn__Entry_int_str __sn__entry = __sn__EntryIter_int_str_next(&__sn_iter__);
+            {
+                (__sn__ksum3 = sn_add_long(__sn__ksum3, __sn__entry.__sn__key));
+                
+            }
+        }
+    }
+    if ((__sn__ksum3 != 3LL)) {
+        sn_print("FAIL: key sum should be 3\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: SimpleMap<int, str> iteration\n");
+    
+    sn_print("All multi-param generic iterator tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,559 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: SimpleMap_int_int (as val) */
+typedef struct {
+    SnArray * __sn__keys;
+    SnArray * __sn__values;
+} __sn__SimpleMap_int_int;
+/* Value operations */
+static inline __sn__SimpleMap_int_int __sn__SimpleMap_int_int_copy(const __sn__SimpleMap_int_int *src) {
+    __sn__SimpleMap_int_int dst;
+    dst.__sn__keys = sn_array_copy(src->__sn__keys);
+    dst.__sn__values = sn_array_copy(src->__sn__values);
+    return dst;
+}
+
+static inline void __sn__SimpleMap_int_int_cleanup(__sn__SimpleMap_int_int *p) {
+    sn_cleanup_array(&p->__sn__keys);
+    sn_cleanup_array(&p->__sn__values);
+
+}
+
+#define sn_auto_SimpleMap_int_int __attribute__((cleanup(__sn__SimpleMap_int_int_cleanup)))
+
+static inline void __sn__SimpleMap_int_int_cleanup_elem(void *p) { __sn__SimpleMap_int_int_cleanup((__sn__SimpleMap_int_int *)p); }
+static inline void __sn__SimpleMap_int_int_copy_into(const void *src, void *dst) { *(__sn__SimpleMap_int_int *)dst = __sn__SimpleMap_int_int_copy((const __sn__SimpleMap_int_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SimpleMap_int_int *__sn__SimpleMap_int_int_alloc(void) {
+    return calloc(1, sizeof(__sn__SimpleMap_int_int));
+}
+
+static inline void __sn__SimpleMap_int_int_release(__sn__SimpleMap_int_int **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__keys);
+        sn_cleanup_array(&(*p)->__sn__values);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SimpleMap_int_int __attribute__((cleanup(__sn__SimpleMap_int_int_release)))
+
+static inline void __sn__SimpleMap_int_int_release_elem(void *p) { __sn__SimpleMap_int_int_release((__sn__SimpleMap_int_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SimpleMap_int_int_to_string(const __sn__SimpleMap_int_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SimpleMap_int_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "keys: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__keys); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "values: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__values); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: EntryIter_int_int (as val) */
+typedef struct {
+    SnArray * __sn__keys;
+    SnArray * __sn__values;
+    long long __sn__index;
+} __sn__EntryIter_int_int;
+/* Value operations */
+static inline __sn__EntryIter_int_int __sn__EntryIter_int_int_copy(const __sn__EntryIter_int_int *src) {
+    __sn__EntryIter_int_int dst;
+    dst.__sn__keys = sn_array_copy(src->__sn__keys);
+    dst.__sn__values = sn_array_copy(src->__sn__values);
+    dst.__sn__index = src->__sn__index;
+    return dst;
+}
+
+static inline void __sn__EntryIter_int_int_cleanup(__sn__EntryIter_int_int *p) {
+    sn_cleanup_array(&p->__sn__keys);
+    sn_cleanup_array(&p->__sn__values);
+
+}
+
+#define sn_auto_EntryIter_int_int __attribute__((cleanup(__sn__EntryIter_int_int_cleanup)))
+
+static inline void __sn__EntryIter_int_int_cleanup_elem(void *p) { __sn__EntryIter_int_int_cleanup((__sn__EntryIter_int_int *)p); }
+static inline void __sn__EntryIter_int_int_copy_into(const void *src, void *dst) { *(__sn__EntryIter_int_int *)dst = __sn__EntryIter_int_int_copy((const __sn__EntryIter_int_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__EntryIter_int_int *__sn__EntryIter_int_int_alloc(void) {
+    return calloc(1, sizeof(__sn__EntryIter_int_int));
+}
+
+static inline void __sn__EntryIter_int_int_release(__sn__EntryIter_int_int **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__keys);
+        sn_cleanup_array(&(*p)->__sn__values);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_EntryIter_int_int __attribute__((cleanup(__sn__EntryIter_int_int_release)))
+
+static inline void __sn__EntryIter_int_int_release_elem(void *p) { __sn__EntryIter_int_int_release((__sn__EntryIter_int_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__EntryIter_int_int_to_string(const __sn__EntryIter_int_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "EntryIter_int_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "keys: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__keys); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "values: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__values); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "index: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__index);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Entry_int_int (as val) */
+typedef struct {
+    long long __sn__key;
+    long long __sn__value;
+} __sn__Entry_int_int;
+/* Value operations */
+static inline __sn__Entry_int_int __sn__Entry_int_int_copy(const __sn__Entry_int_int *src) {
+    __sn__Entry_int_int dst;
+    dst.__sn__key = src->__sn__key;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Entry_int_int_cleanup(__sn__Entry_int_int *p) {
+
+}
+
+#define sn_auto_Entry_int_int __attribute__((cleanup(__sn__Entry_int_int_cleanup)))
+
+static inline void __sn__Entry_int_int_cleanup_elem(void *p) { __sn__Entry_int_int_cleanup((__sn__Entry_int_int *)p); }
+static inline void __sn__Entry_int_int_copy_into(const void *src, void *dst) { *(__sn__Entry_int_int *)dst = __sn__Entry_int_int_copy((const __sn__Entry_int_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Entry_int_int *__sn__Entry_int_int_alloc(void) {
+    return calloc(1, sizeof(__sn__Entry_int_int));
+}
+
+static inline void __sn__Entry_int_int_release(__sn__Entry_int_int **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Entry_int_int __attribute__((cleanup(__sn__Entry_int_int_release)))
+
+static inline void __sn__Entry_int_int_release_elem(void *p) { __sn__Entry_int_int_release((__sn__Entry_int_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Entry_int_int_to_string(const __sn__Entry_int_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Entry_int_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__key);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: SimpleMap_str_int (as val) */
+typedef struct {
+    SnArray * __sn__keys;
+    SnArray * __sn__values;
+} __sn__SimpleMap_str_int;
+/* Value operations */
+static inline __sn__SimpleMap_str_int __sn__SimpleMap_str_int_copy(const __sn__SimpleMap_str_int *src) {
+    __sn__SimpleMap_str_int dst;
+    dst.__sn__keys = sn_array_copy(src->__sn__keys);
+    dst.__sn__values = sn_array_copy(src->__sn__values);
+    return dst;
+}
+
+static inline void __sn__SimpleMap_str_int_cleanup(__sn__SimpleMap_str_int *p) {
+    sn_cleanup_array(&p->__sn__keys);
+    sn_cleanup_array(&p->__sn__values);
+
+}
+
+#define sn_auto_SimpleMap_str_int __attribute__((cleanup(__sn__SimpleMap_str_int_cleanup)))
+
+static inline void __sn__SimpleMap_str_int_cleanup_elem(void *p) { __sn__SimpleMap_str_int_cleanup((__sn__SimpleMap_str_int *)p); }
+static inline void __sn__SimpleMap_str_int_copy_into(const void *src, void *dst) { *(__sn__SimpleMap_str_int *)dst = __sn__SimpleMap_str_int_copy((const __sn__SimpleMap_str_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SimpleMap_str_int *__sn__SimpleMap_str_int_alloc(void) {
+    return calloc(1, sizeof(__sn__SimpleMap_str_int));
+}
+
+static inline void __sn__SimpleMap_str_int_release(__sn__SimpleMap_str_int **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__keys);
+        sn_cleanup_array(&(*p)->__sn__values);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SimpleMap_str_int __attribute__((cleanup(__sn__SimpleMap_str_int_release)))
+
+static inline void __sn__SimpleMap_str_int_release_elem(void *p) { __sn__SimpleMap_str_int_release((__sn__SimpleMap_str_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SimpleMap_str_int_to_string(const __sn__SimpleMap_str_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SimpleMap_str_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "keys: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__keys); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "values: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__values); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: EntryIter_str_int (as val) */
+typedef struct {
+    SnArray * __sn__keys;
+    SnArray * __sn__values;
+    long long __sn__index;
+} __sn__EntryIter_str_int;
+/* Value operations */
+static inline __sn__EntryIter_str_int __sn__EntryIter_str_int_copy(const __sn__EntryIter_str_int *src) {
+    __sn__EntryIter_str_int dst;
+    dst.__sn__keys = sn_array_copy(src->__sn__keys);
+    dst.__sn__values = sn_array_copy(src->__sn__values);
+    dst.__sn__index = src->__sn__index;
+    return dst;
+}
+
+static inline void __sn__EntryIter_str_int_cleanup(__sn__EntryIter_str_int *p) {
+    sn_cleanup_array(&p->__sn__keys);
+    sn_cleanup_array(&p->__sn__values);
+
+}
+
+#define sn_auto_EntryIter_str_int __attribute__((cleanup(__sn__EntryIter_str_int_cleanup)))
+
+static inline void __sn__EntryIter_str_int_cleanup_elem(void *p) { __sn__EntryIter_str_int_cleanup((__sn__EntryIter_str_int *)p); }
+static inline void __sn__EntryIter_str_int_copy_into(const void *src, void *dst) { *(__sn__EntryIter_str_int *)dst = __sn__EntryIter_str_int_copy((const __sn__EntryIter_str_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__EntryIter_str_int *__sn__EntryIter_str_int_alloc(void) {
+    return calloc(1, sizeof(__sn__EntryIter_str_int));
+}
+
+static inline void __sn__EntryIter_str_int_release(__sn__EntryIter_str_int **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__keys);
+        sn_cleanup_array(&(*p)->__sn__values);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_EntryIter_str_int __attribute__((cleanup(__sn__EntryIter_str_int_release)))
+
+static inline void __sn__EntryIter_str_int_release_elem(void *p) { __sn__EntryIter_str_int_release((__sn__EntryIter_str_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__EntryIter_str_int_to_string(const __sn__EntryIter_str_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "EntryIter_str_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "keys: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__keys); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "values: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__values); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "index: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__index);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Entry_str_int (as val) */
+typedef struct {
+    char * __sn__key;
+    long long __sn__value;
+} __sn__Entry_str_int;
+/* Value operations */
+static inline __sn__Entry_str_int __sn__Entry_str_int_copy(const __sn__Entry_str_int *src) {
+    __sn__Entry_str_int dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Entry_str_int_cleanup(__sn__Entry_str_int *p) {
+    free(p->__sn__key);
+
+}
+
+#define sn_auto_Entry_str_int __attribute__((cleanup(__sn__Entry_str_int_cleanup)))
+
+static inline void __sn__Entry_str_int_cleanup_elem(void *p) { __sn__Entry_str_int_cleanup((__sn__Entry_str_int *)p); }
+static inline void __sn__Entry_str_int_copy_into(const void *src, void *dst) { *(__sn__Entry_str_int *)dst = __sn__Entry_str_int_copy((const __sn__Entry_str_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Entry_str_int *__sn__Entry_str_int_alloc(void) {
+    return calloc(1, sizeof(__sn__Entry_str_int));
+}
+
+static inline void __sn__Entry_str_int_release(__sn__Entry_str_int **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Entry_str_int __attribute__((cleanup(__sn__Entry_str_int_release)))
+
+static inline void __sn__Entry_str_int_release_elem(void *p) { __sn__Entry_str_int_release((__sn__Entry_str_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Entry_str_int_to_string(const __sn__Entry_str_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Entry_str_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: SimpleMap_int_str (as val) */
+typedef struct {
+    SnArray * __sn__keys;
+    SnArray * __sn__values;
+} __sn__SimpleMap_int_str;
+/* Value operations */
+static inline __sn__SimpleMap_int_str __sn__SimpleMap_int_str_copy(const __sn__SimpleMap_int_str *src) {
+    __sn__SimpleMap_int_str dst;
+    dst.__sn__keys = sn_array_copy(src->__sn__keys);
+    dst.__sn__values = sn_array_copy(src->__sn__values);
+    return dst;
+}
+
+static inline void __sn__SimpleMap_int_str_cleanup(__sn__SimpleMap_int_str *p) {
+    sn_cleanup_array(&p->__sn__keys);
+    sn_cleanup_array(&p->__sn__values);
+
+}
+
+#define sn_auto_SimpleMap_int_str __attribute__((cleanup(__sn__SimpleMap_int_str_cleanup)))
+
+static inline void __sn__SimpleMap_int_str_cleanup_elem(void *p) { __sn__SimpleMap_int_str_cleanup((__sn__SimpleMap_int_str *)p); }
+static inline void __sn__SimpleMap_int_str_copy_into(const void *src, void *dst) { *(__sn__SimpleMap_int_str *)dst = __sn__SimpleMap_int_str_copy((const __sn__SimpleMap_int_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SimpleMap_int_str *__sn__SimpleMap_int_str_alloc(void) {
+    return calloc(1, sizeof(__sn__SimpleMap_int_str));
+}
+
+static inline void __sn__SimpleMap_int_str_release(__sn__SimpleMap_int_str **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__keys);
+        sn_cleanup_array(&(*p)->__sn__values);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SimpleMap_int_str __attribute__((cleanup(__sn__SimpleMap_int_str_release)))
+
+static inline void __sn__SimpleMap_int_str_release_elem(void *p) { __sn__SimpleMap_int_str_release((__sn__SimpleMap_int_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SimpleMap_int_str_to_string(const __sn__SimpleMap_int_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SimpleMap_int_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "keys: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__keys); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "values: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__values); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: EntryIter_int_str (as val) */
+typedef struct {
+    SnArray * __sn__keys;
+    SnArray * __sn__values;
+    long long __sn__index;
+} __sn__EntryIter_int_str;
+/* Value operations */
+static inline __sn__EntryIter_int_str __sn__EntryIter_int_str_copy(const __sn__EntryIter_int_str *src) {
+    __sn__EntryIter_int_str dst;
+    dst.__sn__keys = sn_array_copy(src->__sn__keys);
+    dst.__sn__values = sn_array_copy(src->__sn__values);
+    dst.__sn__index = src->__sn__index;
+    return dst;
+}
+
+static inline void __sn__EntryIter_int_str_cleanup(__sn__EntryIter_int_str *p) {
+    sn_cleanup_array(&p->__sn__keys);
+    sn_cleanup_array(&p->__sn__values);
+
+}
+
+#define sn_auto_EntryIter_int_str __attribute__((cleanup(__sn__EntryIter_int_str_cleanup)))
+
+static inline void __sn__EntryIter_int_str_cleanup_elem(void *p) { __sn__EntryIter_int_str_cleanup((__sn__EntryIter_int_str *)p); }
+static inline void __sn__EntryIter_int_str_copy_into(const void *src, void *dst) { *(__sn__EntryIter_int_str *)dst = __sn__EntryIter_int_str_copy((const __sn__EntryIter_int_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__EntryIter_int_str *__sn__EntryIter_int_str_alloc(void) {
+    return calloc(1, sizeof(__sn__EntryIter_int_str));
+}
+
+static inline void __sn__EntryIter_int_str_release(__sn__EntryIter_int_str **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__keys);
+        sn_cleanup_array(&(*p)->__sn__values);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_EntryIter_int_str __attribute__((cleanup(__sn__EntryIter_int_str_release)))
+
+static inline void __sn__EntryIter_int_str_release_elem(void *p) { __sn__EntryIter_int_str_release((__sn__EntryIter_int_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__EntryIter_int_str_to_string(const __sn__EntryIter_int_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "EntryIter_int_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "keys: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__keys); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "values: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__values); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "index: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__index);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Entry_int_str (as val) */
+typedef struct {
+    long long __sn__key;
+    char * __sn__value;
+} __sn__Entry_int_str;
+/* Value operations */
+static inline __sn__Entry_int_str __sn__Entry_int_str_copy(const __sn__Entry_int_str *src) {
+    __sn__Entry_int_str dst;
+    dst.__sn__key = src->__sn__key;
+    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    return dst;
+}
+
+static inline void __sn__Entry_int_str_cleanup(__sn__Entry_int_str *p) {
+    free(p->__sn__value);
+
+}
+
+#define sn_auto_Entry_int_str __attribute__((cleanup(__sn__Entry_int_str_cleanup)))
+
+static inline void __sn__Entry_int_str_cleanup_elem(void *p) { __sn__Entry_int_str_cleanup((__sn__Entry_int_str *)p); }
+static inline void __sn__Entry_int_str_copy_into(const void *src, void *dst) { *(__sn__Entry_int_str *)dst = __sn__Entry_int_str_copy((const __sn__Entry_int_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Entry_int_str *__sn__Entry_int_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Entry_int_str));
+}
+
+static inline void __sn__Entry_int_str_release(__sn__Entry_int_str **p) {
+    if (*p) {
+        free((*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Entry_int_str __attribute__((cleanup(__sn__Entry_int_str_release)))
+
+static inline void __sn__Entry_int_str_release_elem(void *p) { __sn__Entry_int_str_release((__sn__Entry_int_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Entry_int_str_to_string(const __sn__Entry_int_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Entry_int_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__key);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+void __sn__SimpleMap_int_int_put(__sn__SimpleMap_int_int *, long long, long long);
+long long __sn__SimpleMap_int_int_size(__sn__SimpleMap_int_int *);
+__sn__EntryIter_int_int __sn__SimpleMap_int_int_iter(__sn__SimpleMap_int_int *);
+bool __sn__EntryIter_int_int_hasNext(__sn__EntryIter_int_int *);
+__sn__Entry_int_int __sn__EntryIter_int_int_next(__sn__EntryIter_int_int *);
+void __sn__SimpleMap_str_int_put(__sn__SimpleMap_str_int *, char *, long long);
+long long __sn__SimpleMap_str_int_size(__sn__SimpleMap_str_int *);
+__sn__EntryIter_str_int __sn__SimpleMap_str_int_iter(__sn__SimpleMap_str_int *);
+bool __sn__EntryIter_str_int_hasNext(__sn__EntryIter_str_int *);
+__sn__Entry_str_int __sn__EntryIter_str_int_next(__sn__EntryIter_str_int *);
+void __sn__SimpleMap_int_str_put(__sn__SimpleMap_int_str *, long long, char *);
+long long __sn__SimpleMap_int_str_size(__sn__SimpleMap_int_str *);
+__sn__EntryIter_int_str __sn__SimpleMap_int_str_iter(__sn__SimpleMap_int_str *);
+bool __sn__EntryIter_int_str_hasNext(__sn__EntryIter_int_str *);
+__sn__Entry_int_str __sn__EntryIter_int_str_next(__sn__EntryIter_int_str *);
+
+
+
+#endif
@@ -0,0 +1,75 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Wrapper_int __sn__Factory_int_wrap(__sn__Factory_int *__sn__self, long long __sn__item) {
+
+    return (__sn__Wrapper_int){ .__sn__value = __sn__item };}
+
+__sn__Wrapper_int __sn__Factory_int_wrapDefault(__sn__Factory_int *__sn__self) {
+
+    return (__sn__Wrapper_int){ .__sn__value = __sn__self->__sn__default_val };}
+
+
+long long __sn__Wrapper_int_get(__sn__Wrapper_int *__sn__self) {
+
+    return __sn__self->__sn__value;}
+
+
+__sn__Wrapper_str __sn__Factory_str_wrap(__sn__Factory_str *__sn__self, char * __sn__item) {
+
+    return (__sn__Wrapper_str){ .__sn__value = strdup(__sn__item) };}
+
+__sn__Wrapper_str __sn__Factory_str_wrapDefault(__sn__Factory_str *__sn__self) {
+
+    return (__sn__Wrapper_str){ .__sn__value = strdup(__sn__self->__sn__default_val) };}
+
+
+char * __sn__Wrapper_str_get(__sn__Wrapper_str *__sn__self) {
+
+    return strdup(__sn__self->__sn__value);}
+
+int main() {
+    __sn__Factory_int __sn__fi = (__sn__Factory_int){ .__sn__default_val = 0LL };
+    __sn__Wrapper_int __sn__wi = __sn__Factory_int_wrap(&__sn__fi, 42LL);
+    if ((__sn__Wrapper_int_get(&__sn__wi) != 42LL)) {
+        sn_print("FAIL: Wrapper<int> value should be 42\n");
+        
+        return 1LL;}
+    sn_print("Test 1 passed: Factory<int>.wrap(42)\n");
+    
+    sn_auto_Factory_str __sn__Factory_str __sn__fs = (__sn__Factory_str){ .__sn__default_val = strdup("") };
+    sn_auto_Wrapper_str __sn__Wrapper_str __sn__ws = __sn__Factory_str_wrap(&__sn__fs, "hello");
+    if (({char *__sct0__=__sn__Wrapper_str_get(&__sn__ws);bool __scr__=(strcmp(__sct0__,"hello")!=0);free(__sct0__);__scr__;})) {
+        sn_print("FAIL: Wrapper<str> value should be hello\n");
+        
+        return 1LL;}
+    sn_print("Test 2 passed: Factory<str>.wrap(hello)\n");
+    
+    __sn__Factory_int __sn__fi2 = (__sn__Factory_int){ .__sn__default_val = 99LL };
+    __sn__Wrapper_int __sn__wd = __sn__Factory_int_wrapDefault(&__sn__fi2);
+    if ((__sn__Wrapper_int_get(&__sn__wd) != 99LL)) {
+        sn_print("FAIL: Wrapper<int> default should be 99\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: Factory<int>.wrapDefault()\n");
+    
+    __sn__Factory_int __sn__fa = (__sn__Factory_int){ .__sn__default_val = 1LL };
+    __sn__Factory_int __sn__fb = (__sn__Factory_int){ .__sn__default_val = 2LL };
+    __sn__Wrapper_int __sn__wa = __sn__Factory_int_wrap(&__sn__fa, 10LL);
+    __sn__Wrapper_int __sn__wb = __sn__Factory_int_wrap(&__sn__fb, 20LL);
+    if ((__sn__Wrapper_int_get(&__sn__wa) != 10LL)) {
+        sn_print("FAIL: wa should be 10\n");
+        
+        return 1LL;}
+    if ((__sn__Wrapper_int_get(&__sn__wb) != 20LL)) {
+        sn_print("FAIL: wb should be 20\n");
+        
+        return 1LL;}
+    sn_print("Test 4 passed: Multiple same-type instantiations\n");
+    
+    sn_print("All nested generic return tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
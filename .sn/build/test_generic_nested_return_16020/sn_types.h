@@ -0,0 +1,226 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Factory_int (as val) */
+typedef struct {
+    long long __sn__default_val;
+} __sn__Factory_int;
+/* Value operations */
+static inline __sn__Factory_int __sn__Factory_int_copy(const __sn__Factory_int *src) {
+    __sn__Factory_int dst;
+    dst.__sn__default_val = src->__sn__default_val;
+    return dst;
+}
+
+static inline void __sn__Factory_int_cleanup(__sn__Factory_int *p) {
+
+}
+
+#define sn_auto_Factory_int __attribute__((cleanup(__sn__Factory_int_cleanup)))
+
+static inline void __sn__Factory_int_cleanup_elem(void *p) { __sn__Factory_int_cleanup((__sn__Factory_int *)p); }
+static inline void __sn__Factory_int_copy_into(const void *src, void *dst) { *(__sn__Factory_int *)dst = __sn__Factory_int_copy((const __sn__Factory_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Factory_int *__sn__Factory_int_alloc(void) {
+    return calloc(1, sizeof(__sn__Factory_int));
+}
+
+static inline void __sn__Factory_int_release(__sn__Factory_int **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Factory_int __attribute__((cleanup(__sn__Factory_int_release)))
+
+static inline void __sn__Factory_int_release_elem(void *p) { __sn__Factory_int_release((__sn__Factory_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Factory_int_to_string(const __sn__Factory_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Factory_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "default_val: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__default_val);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Wrapper_int (as val) */
+typedef struct {
+    long long __sn__value;
+} __sn__Wrapper_int;
+/* Value operations */
+static inline __sn__Wrapper_int __sn__Wrapper_int_copy(const __sn__Wrapper_int *src) {
+    __sn__Wrapper_int dst;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Wrapper_int_cleanup(__sn__Wrapper_int *p) {
+
+}
+
+#define sn_auto_Wrapper_int __attribute__((cleanup(__sn__Wrapper_int_cleanup)))
+
+static inline void __sn__Wrapper_int_cleanup_elem(void *p) { __sn__Wrapper_int_cleanup((__sn__Wrapper_int *)p); }
+static inline void __sn__Wrapper_int_copy_into(const void *src, void *dst) { *(__sn__Wrapper_int *)dst = __sn__Wrapper_int_copy((const __sn__Wrapper_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Wrapper_int *__sn__Wrapper_int_alloc(void) {
+    return calloc(1, sizeof(__sn__Wrapper_int));
+}
+
+static inline void __sn__Wrapper_int_release(__sn__Wrapper_int **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Wrapper_int __attribute__((cleanup(__sn__Wrapper_int_release)))
+
+static inline void __sn__Wrapper_int_release_elem(void *p) { __sn__Wrapper_int_release((__sn__Wrapper_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Wrapper_int_to_string(const __sn__Wrapper_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Wrapper_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Factory_str (as val) */
+typedef struct {
+    char * __sn__default_val;
+} __sn__Factory_str;
+/* Value operations */
+static inline __sn__Factory_str __sn__Factory_str_copy(const __sn__Factory_str *src) {
+    __sn__Factory_str dst;
+    dst.__sn__default_val = src->__sn__default_val ? strdup(src->__sn__default_val) : NULL;
+    return dst;
+}
+
+static inline void __sn__Factory_str_cleanup(__sn__Factory_str *p) {
+    free(p->__sn__default_val);
+
+}
+
+#define sn_auto_Factory_str __attribute__((cleanup(__sn__Factory_str_cleanup)))
+
+static inline void __sn__Factory_str_cleanup_elem(void *p) { __sn__Factory_str_cleanup((__sn__Factory_str *)p); }
+static inline void __sn__Factory_str_copy_into(const void *src, void *dst) { *(__sn__Factory_str *)dst = __sn__Factory_str_copy((const __sn__Factory_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Factory_str *__sn__Factory_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Factory_str));
+}
+
+static inline void __sn__Factory_str_release(__sn__Factory_str **p) {
+    if (*p) {
+        free((*p)->__sn__default_val);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Factory_str __attribute__((cleanup(__sn__Factory_str_release)))
+
+static inline void __sn__Factory_str_release_elem(void *p) { __sn__Factory_str_release((__sn__Factory_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Factory_str_to_string(const __sn__Factory_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Factory_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "default_val: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__default_val ? p->__sn__default_val : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Wrapper_str (as val) */
+typedef struct {
+    char * __sn__value;
+} __sn__Wrapper_str;
+/* Value operations */
+static inline __sn__Wrapper_str __sn__Wrapper_str_copy(const __sn__Wrapper_str *src) {
+    __sn__Wrapper_str dst;
+    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    return dst;
+}
+
+static inline void __sn__Wrapper_str_cleanup(__sn__Wrapper_str *p) {
+    free(p->__sn__value);
+
+}
+
+#define sn_auto_Wrapper_str __attribute__((cleanup(__sn__Wrapper_str_cleanup)))
+
+static inline void __sn__Wrapper_str_cleanup_elem(void *p) { __sn__Wrapper_str_cleanup((__sn__Wrapper_str *)p); }
+static inline void __sn__Wrapper_str_copy_into(const void *src, void *dst) { *(__sn__Wrapper_str *)dst = __sn__Wrapper_str_copy((const __sn__Wrapper_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Wrapper_str *__sn__Wrapper_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Wrapper_str));
+}
+
+static inline void __sn__Wrapper_str_release(__sn__Wrapper_str **p) {
+    if (*p) {
+        free((*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Wrapper_str __attribute__((cleanup(__sn__Wrapper_str_release)))
+
+static inline void __sn__Wrapper_str_release_elem(void *p) { __sn__Wrapper_str_release((__sn__Wrapper_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Wrapper_str_to_string(const __sn__Wrapper_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Wrapper_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+__sn__Wrapper_int __sn__Factory_int_wrap(__sn__Factory_int *, long long);
+__sn__Wrapper_int __sn__Factory_int_wrapDefault(__sn__Factory_int *);
+long long __sn__Wrapper_int_get(__sn__Wrapper_int *);
+__sn__Wrapper_str __sn__Factory_str_wrap(__sn__Factory_str *, char *);
+__sn__Wrapper_str __sn__Factory_str_wrapDefault(__sn__Factory_str *);
+char * __sn__Wrapper_str_get(__sn__Wrapper_str *);
+
+
+
+#endif
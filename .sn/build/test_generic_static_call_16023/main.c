@@ -0,0 +1,115 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__Tag_label(__sn__Tag *__sn__self) {
+
+    return strdup(__sn__self->__sn__name);}
+
+
+__sn__Wrapper_int __sn__Wrapper_int_create(long long __sn__v) {
+
+    return (__sn__Wrapper_int){ .__sn__value = __sn__v, .__sn__count = 1LL };}
+
+__sn__Wrapper_int __sn__Wrapper_int_createWithCount(long long __sn__v, long long __sn__n) {
+
+    return (__sn__Wrapper_int){ .__sn__value = __sn__v, .__sn__count = __sn__n };}
+
+long long __sn__Wrapper_int_getCount(__sn__Wrapper_int *__sn__self) {
+
+    return __sn__self->__sn__count;}
+
+
+__sn__Wrapper_str __sn__Wrapper_str_create(char * __sn__v) {
+
+    return (__sn__Wrapper_str){ .__sn__value = strdup(__sn__v), .__sn__count = 1LL };}
+
+__sn__Wrapper_str __sn__Wrapper_str_createWithCount(char * __sn__v, long long __sn__n) {
+
+    return (__sn__Wrapper_str){ .__sn__value = strdup(__sn__v), .__sn__count = __sn__n };}
+
+long long __sn__Wrapper_str_getCount(__sn__Wrapper_str *__sn__self) {
+
+    return __sn__self->__sn__count;}
+
+
+__sn__Container_Tag __sn__Container_Tag_of(__sn__Tag *__sn__item) {
+
+    return (__sn__Container_Tag){ .__sn__item = __sn__Tag_copy(&((*__sn__item))), .__sn__size = 1LL };}
+
+long long __sn__Container_Tag_getSize(__sn__Container_Tag *__sn__self) {
+
+    return __sn__self->__sn__size;}
+
+char * __sn__Container_Tag_getLabel(__sn__Container_Tag *__sn__self) {
+
+    return __sn__Tag_label(&__sn__self->__sn__item);}
+
+
+__sn__Wrapper_Tag __sn__Wrapper_Tag_create(__sn__Tag *__sn__v) {
+
+    return (__sn__Wrapper_Tag){ .__sn__value = __sn__Tag_copy(&((*__sn__v))), .__sn__count = 1LL };}
+
+__sn__Wrapper_Tag __sn__Wrapper_Tag_createWithCount(__sn__Tag *__sn__v, long long __sn__n) {
+
+    return (__sn__Wrapper_Tag){ .__sn__value = __sn__Tag_copy(&((*__sn__v))), .__sn__count = __sn__n };}
+
+long long __sn__Wrapper_Tag_getCount(__sn__Wrapper_Tag *__sn__self) {
+
+    return __sn__self->__sn__count;}
+
+int main() {
+    __sn__Wrapper_int __sn__w1 = __sn__Wrapper_int_create(42LL);
+    if ((__sn__w1.__sn__value != 42LL)) {
+        sn_print("FAIL: Wrapper<int>.create value should be 42\n");
+        
+        return 1LL;}
+    if ((__sn__Wrapper_int_getCount(&__sn__w1) != 1LL)) {
+        sn_print("FAIL: Wrapper<int>.create count should be 1\n");
+        
+        return 1LL;}
+    sn_print("Test 1 passed: Wrapper<int>.create(42)\n");
+    
+    sn_auto_Wrapper_str __sn__Wrapper_str __sn__w2 = __sn__Wrapper_str_create("hello");
+    if ((strcmp(__sn__w2.__sn__value, "hello") != 0)) {
+        sn_print("FAIL: Wrapper<str>.create value should be hello\n");
+        
+        return 1LL;}
+    sn_print("Test 2 passed: Wrapper<str>.create(\"hello\")\n");
+    
+    __sn__Wrapper_int __sn__w3 = __sn__Wrapper_int_createWithCount(99LL, 5LL);
+    if ((__sn__w3.__sn__value != 99LL)) {
+        sn_print("FAIL: value should be 99\n");
+        
+        return 1LL;}
+    if ((__sn__Wrapper_int_getCount(&__sn__w3) != 5LL)) {
+        sn_print("FAIL: count should be 5\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: Wrapper<int>.createWithCount(99, 5)\n");
+    
+    sn_auto_Tag __sn__Tag __sn__tag1 = (__sn__Tag){ .__sn__name = strdup("alpha") };
+    sn_auto_Container_Tag __sn__Container_Tag __sn__c1 = __sn__Container_Tag_of(&__sn__tag1);
+    if ((__sn__Container_Tag_getSize(&__sn__c1) != 1LL)) {
+        sn_print("FAIL: Container size should be 1\n");
+        
+        return 1LL;}
+    if (({char *__sct0__=__sn__Container_Tag_getLabel(&__sn__c1);bool __scr__=(strcmp(__sct0__,"alpha")!=0);free(__sct0__);__scr__;})) {
+        sn_print("FAIL: Container label should be alpha\n");
+        
+        return 1LL;}
+    sn_print("Test 4 passed: Container<Tag>.of(Tag{name:\"alpha\"})\n");
+    
+    sn_auto_Tag __sn__Tag __sn__inner = (__sn__Tag){ .__sn__name = strdup("beta") };
+    sn_auto_Wrapper_Tag __sn__Wrapper_Tag __sn__w4 = __sn__Wrapper_Tag_create(&__sn__inner);
+    if ((strcmp(__sn__w4.__sn__value.__sn__name, "beta") != 0)) {
+        sn_print("FAIL: Wrapper<Tag> value.name should be beta\n");
+        
+        return 1LL;}
+    sn_print("Test 5 passed: Wrapper<Tag>.create(inner)\n");
+    
+    sn_print("All generic static call tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
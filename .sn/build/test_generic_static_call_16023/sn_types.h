@@ -0,0 +1,305 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Tag (as val) */
+typedef struct {
+    char * __sn__name;
+} __sn__Tag;
+/* Value operations */
+static inline __sn__Tag __sn__Tag_copy(const __sn__Tag *src) {
+    __sn__Tag dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__Tag_cleanup(__sn__Tag *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Tag __attribute__((cleanup(__sn__Tag_cleanup)))
+
+static inline void __sn__Tag_cleanup_elem(void *p) { __sn__Tag_cleanup((__sn__Tag *)p); }
+static inline void __sn__Tag_copy_into(const void *src, void *dst) { *(__sn__Tag *)dst = __sn__Tag_copy((const __sn__Tag *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Tag *__sn__Tag_alloc(void) {
+    return calloc(1, sizeof(__sn__Tag));
+}
+
+static inline void __sn__Tag_release(__sn__Tag **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Tag __attribute__((cleanup(__sn__Tag_release)))
+
+static inline void __sn__Tag_release_elem(void *p) { __sn__Tag_release((__sn__Tag **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Tag_to_string(const __sn__Tag *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Tag { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Wrapper_int (as val) */
+typedef struct {
+    long long __sn__value;
+    long long __sn__count;
+} __sn__Wrapper_int;
+/* Value operations */
+static inline __sn__Wrapper_int __sn__Wrapper_int_copy(const __sn__Wrapper_int *src) {
+    __sn__Wrapper_int dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__count = src->__sn__count;
+    return dst;
+}
+
+static inline void __sn__Wrapper_int_cleanup(__sn__Wrapper_int *p) {
+
+}
+
+#define sn_auto_Wrapper_int __attribute__((cleanup(__sn__Wrapper_int_cleanup)))
+
+static inline void __sn__Wrapper_int_cleanup_elem(void *p) { __sn__Wrapper_int_cleanup((__sn__Wrapper_int *)p); }
+static inline void __sn__Wrapper_int_copy_into(const void *src, void *dst) { *(__sn__Wrapper_int *)dst = __sn__Wrapper_int_copy((const __sn__Wrapper_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Wrapper_int *__sn__Wrapper_int_alloc(void) {
+    return calloc(1, sizeof(__sn__Wrapper_int));
+}
+
+static inline void __sn__Wrapper_int_release(__sn__Wrapper_int **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Wrapper_int __attribute__((cleanup(__sn__Wrapper_int_release)))
+
+static inline void __sn__Wrapper_int_release_elem(void *p) { __sn__Wrapper_int_release((__sn__Wrapper_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Wrapper_int_to_string(const __sn__Wrapper_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Wrapper_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "count: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__count);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Wrapper_str (as val) */
+typedef struct {
+    char * __sn__value;
+    long long __sn__count;
+} __sn__Wrapper_str;
+/* Value operations */
+static inline __sn__Wrapper_str __sn__Wrapper_str_copy(const __sn__Wrapper_str *src) {
+    __sn__Wrapper_str dst;
+    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    dst.__sn__count = src->__sn__count;
+    return dst;
+}
+
+static inline void __sn__Wrapper_str_cleanup(__sn__Wrapper_str *p) {
+    free(p->__sn__value);
+
+}
+
+#define sn_auto_Wrapper_str __attribute__((cleanup(__sn__Wrapper_str_cleanup)))
+
+static inline void __sn__Wrapper_str_cleanup_elem(void *p) { __sn__Wrapper_str_cleanup((__sn__Wrapper_str *)p); }
+static inline void __sn__Wrapper_str_copy_into(const void *src, void *dst) { *(__sn__Wrapper_str *)dst = __sn__Wrapper_str_copy((const __sn__Wrapper_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Wrapper_str *__sn__Wrapper_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Wrapper_str));
+}
+
+static inline void __sn__Wrapper_str_release(__sn__Wrapper_str **p) {
+    if (*p) {
+        free((*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Wrapper_str __attribute__((cleanup(__sn__Wrapper_str_release)))
+
+static inline void __sn__Wrapper_str_release_elem(void *p) { __sn__Wrapper_str_release((__sn__Wrapper_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Wrapper_str_to_string(const __sn__Wrapper_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Wrapper_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "count: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__count);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Container_Tag (as val) */
+typedef struct {
+    __sn__Tag __sn__item;
+    long long __sn__size;
+} __sn__Container_Tag;
+/* Value operations */
+static inline __sn__Container_Tag __sn__Container_Tag_copy(const __sn__Container_Tag *src) {
+    __sn__Container_Tag dst;
+    dst.__sn__item = __sn__Tag_copy(&src->__sn__item);
+    dst.__sn__size = src->__sn__size;
+    return dst;
+}
+
+static inline void __sn__Container_Tag_cleanup(__sn__Container_Tag *p) {
+    __sn__Tag_cleanup(&p->__sn__item);
+
+}
+
+#define sn_auto_Container_Tag __attribute__((cleanup(__sn__Container_Tag_cleanup)))
+
+static inline void __sn__Container_Tag_cleanup_elem(void *p) { __sn__Container_Tag_cleanup((__sn__Container_Tag *)p); }
+static inline void __sn__Container_Tag_copy_into(const void *src, void *dst) { *(__sn__Container_Tag *)dst = __sn__Container_Tag_copy((const __sn__Container_Tag *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Container_Tag *__sn__Container_Tag_alloc(void) {
+    return calloc(1, sizeof(__sn__Container_Tag));
+}
+
+static inline void __sn__Container_Tag_release(__sn__Container_Tag **p) {
+    if (*p) {
+        __sn__Tag_cleanup(&(*p)->__sn__item);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Container_Tag __attribute__((cleanup(__sn__Container_Tag_release)))
+
+static inline void __sn__Container_Tag_release_elem(void *p) { __sn__Container_Tag_release((__sn__Container_Tag **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Container_Tag_to_string(const __sn__Container_Tag *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Container_Tag { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "item: ");
+    { char *__fs__ = __sn__Tag_to_string(&p->__sn__item); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "size: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__size);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Wrapper_Tag (as val) */
+typedef struct {
+    __sn__Tag __sn__value;
+    long long __sn__count;
+} __sn__Wrapper_Tag;
+/* Value operations */
+static inline __sn__Wrapper_Tag __sn__Wrapper_Tag_copy(const __sn__Wrapper_Tag *src) {
+    __sn__Wrapper_Tag dst;
+    dst.__sn__value = __sn__Tag_copy(&src->__sn__value);
+    dst.__sn__count = src->__sn__count;
+    return dst;
+}
+
+static inline void __sn__Wrapper_Tag_cleanup(__sn__Wrapper_Tag *p) {
+    __sn__Tag_cleanup(&p->__sn__value);
+
+}
+
+#define sn_auto_Wrapper_Tag __attribute__((cleanup(__sn__Wrapper_Tag_cleanup)))
+
+static inline void __sn__Wrapper_Tag_cleanup_elem(void *p) { __sn__Wrapper_Tag_cleanup((__sn__Wrapper_Tag *)p); }
+static inline void __sn__Wrapper_Tag_copy_into(const void *src, void *dst) { *(__sn__Wrapper_Tag *)dst = __sn__Wrapper_Tag_copy((const __sn__Wrapper_Tag *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Wrapper_Tag *__sn__Wrapper_Tag_alloc(void) {
+    return calloc(1, sizeof(__sn__Wrapper_Tag));
+}
+
+static inline void __sn__Wrapper_Tag_release(__sn__Wrapper_Tag **p) {
+    if (*p) {
+        __sn__Tag_cleanup(&(*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Wrapper_Tag __attribute__((cleanup(__sn__Wrapper_Tag_release)))
+
+static inline void __sn__Wrapper_Tag_release_elem(void *p) { __sn__Wrapper_Tag_release((__sn__Wrapper_Tag **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Wrapper_Tag_to_string(const __sn__Wrapper_Tag *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Wrapper_Tag { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    { char *__fs__ = __sn__Tag_to_string(&p->__sn__value); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "count: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__count);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+char * __sn__Tag_label(__sn__Tag *);
+__sn__Wrapper_int __sn__Wrapper_int_create(long long);
+__sn__Wrapper_int __sn__Wrapper_int_createWithCount(long long, long long);
+long long __sn__Wrapper_int_getCount(__sn__Wrapper_int *);
+__sn__Wrapper_str __sn__Wrapper_str_create(char *);
+__sn__Wrapper_str __sn__Wrapper_str_createWithCount(char *, long long);
+long long __sn__Wrapper_str_getCount(__sn__Wrapper_str *);
+__sn__Container_Tag __sn__Container_Tag_of(__sn__Tag *);
+long long __sn__Container_Tag_getSize(__sn__Container_Tag *);
+char * __sn__Container_Tag_getLabel(__sn__Container_Tag *);
+__sn__Wrapper_Tag __sn__Wrapper_Tag_create(__sn__Tag *);
+__sn__Wrapper_Tag __sn__Wrapper_Tag_createWithCount(__sn__Tag *, long long);
+long long __sn__Wrapper_Tag_getCount(__sn__Wrapper_Tag *);
+
+
+
+#endif
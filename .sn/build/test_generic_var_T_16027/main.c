@@ -0,0 +1,174 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__Container_int_first(__sn__Container_int *__sn__self) {
+
+    long long __sn__result = (((long long *)__sn__self->__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]);
+
+    return __sn__result;}
+
+long long __sn__Container_int_last(__sn__Container_int *__sn__self) {
+
+    long long __sn__idx = sn_sub_long(sn_array_length(__sn__self->__sn__items), 1LL);
+
+    long long __sn__result = (((long long *)__sn__self->__sn__items->data)[({ long long __ai__ = __sn__idx; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]);
+
+    return __sn__result;}
+
+long long __sn__Container_int_sum_first_two(__sn__Container_int *__sn__self) {
+
+    long long __sn__a = (((long long *)__sn__self->__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]);
+
+    long long __sn__b = (((long long *)__sn__self->__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]);
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+char * __sn__Container_str_first(__sn__Container_str *__sn__self) {
+
+    sn_auto_str char * __sn__result = strdup((((char * *)__sn__self->__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]));
+
+    {
+        char * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+char * __sn__Container_str_last(__sn__Container_str *__sn__self) {
+
+    long long __sn__idx = sn_sub_long(sn_array_length(__sn__self->__sn__items), 1LL);
+
+    sn_auto_str char * __sn__result = strdup((((char * *)__sn__self->__sn__items->data)[({ long long __ai__ = __sn__idx; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]));
+
+    {
+        char * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+char * __sn__Container_str_sum_first_two(__sn__Container_str *__sn__self) {
+
+    sn_auto_str char * __sn__a = strdup((((char * *)__sn__self->__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]));
+
+    sn_auto_str char * __sn__b = strdup((((char * *)__sn__self->__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]));
+
+    return sn_str_concat(__sn__a, __sn__b);}
+
+
+long long __sn__Pair_int_str_getFirst(__sn__Pair_int_str *__sn__self) {
+
+    long long __sn__v = __sn__self->__sn__first;
+
+    return __sn__v;}
+
+char * __sn__Pair_int_str_getSecond(__sn__Pair_int_str *__sn__self) {
+
+    sn_auto_str char * __sn__v = strdup(__sn__self->__sn__second);
+
+    {
+        char * __ret__ = __sn__v;
+        __sn__v = NULL;
+        return __ret__;
+    }}
+
+
+char * __sn__Pair_str_int_getFirst(__sn__Pair_str_int *__sn__self) {
+
+    sn_auto_str char * __sn__v = strdup(__sn__self->__sn__first);
+
+    {
+        char * __ret__ = __sn__v;
+        __sn__v = NULL;
+        return __ret__;
+    }}
+
+long long __sn__Pair_str_int_getSecond(__sn__Pair_str_int *__sn__self) {
+
+    long long __sn__v = __sn__self->__sn__second;
+
+    return __sn__v;}
+
+int main() {
+    sn_auto_Container_int __sn__Container_int __sn__ci = (__sn__Container_int){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            __al__;
+        }) };
+    if ((__sn__Container_int_first(&__sn__ci) != 10LL)) {
+        sn_print("FAIL: Container<int>.first() should be 10\n");
+        
+        return 1LL;}
+    if ((__sn__Container_int_last(&__sn__ci) != 30LL)) {
+        sn_print("FAIL: Container<int>.last() should be 30\n");
+        
+        return 1LL;}
+    sn_print("Test 1 passed: var T with int\n");
+    
+    sn_auto_Container_str __sn__Container_str __sn__cs = (__sn__Container_str){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("alpha") });
+            sn_array_push(__al__, &(char *){ strdup("beta") });
+            sn_array_push(__al__, &(char *){ strdup("gamma") });
+            __al__;
+        }) };
+    if (({char *__sct0__=__sn__Container_str_first(&__sn__cs);bool __scr__=(strcmp(__sct0__,"alpha")!=0);free(__sct0__);__scr__;})) {
+        sn_print("FAIL: Container<str>.first() should be alpha\n");
+        
+        return 1LL;}
+    if (({char *__sct0__=__sn__Container_str_last(&__sn__cs);bool __scr__=(strcmp(__sct0__,"gamma")!=0);free(__sct0__);__scr__;})) {
+        sn_print("FAIL: Container<str>.last() should be gamma\n");
+        
+        return 1LL;}
+    sn_print("Test 2 passed: var T with str\n");
+    
+    sn_auto_Container_int __sn__Container_int __sn__cn = (__sn__Container_int){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 11LL });
+            __al__;
+        }) };
+    if ((__sn__Container_int_sum_first_two(&__sn__cn) != 10LL)) {
+        sn_print("FAIL: sum_first_two should be 10\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: var T arithmetic\n");
+    
+    sn_auto_Pair_int_str __sn__Pair_int_str __sn__p = (__sn__Pair_int_str){ .__sn__first = 42LL, .__sn__second = strdup("answer") };
+    if ((__sn__Pair_int_str_getFirst(&__sn__p) != 42LL)) {
+        sn_print("FAIL: Pair.getFirst() should be 42\n");
+        
+        return 1LL;}
+    if (({char *__sct0__=__sn__Pair_int_str_getSecond(&__sn__p);bool __scr__=(strcmp(__sct0__,"answer")!=0);free(__sct0__);__scr__;})) {
+        sn_print("FAIL: Pair.getSecond() should be answer\n");
+        
+        return 1LL;}
+    sn_print("Test 4 passed: Multi-param var A, var B\n");
+    
+    sn_auto_Pair_str_int __sn__Pair_str_int __sn__p2 = (__sn__Pair_str_int){ .__sn__first = strdup("key"), .__sn__second = 99LL };
+    if (({char *__sct0__=__sn__Pair_str_int_getFirst(&__sn__p2);bool __scr__=(strcmp(__sct0__,"key")!=0);free(__sct0__);__scr__;})) {
+        sn_print("FAIL: Pair<str,int>.getFirst() should be key\n");
+        
+        return 1LL;}
+    if ((__sn__Pair_str_int_getSecond(&__sn__p2) != 99LL)) {
+        sn_print("FAIL: Pair<str,int>.getSecond() should be 99\n");
+        
+        return 1LL;}
+    sn_print("Test 5 passed: Reversed type args (shared body clearing)\n");
+    
+    sn_print("All generic var T tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
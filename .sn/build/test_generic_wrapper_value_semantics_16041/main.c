@@ -0,0 +1,147 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__Box_mutate(__sn__Box *__sn__self, double __sn__v) {
+
+    (__sn__self->__sn__flag = true);
+    
+
+    (__sn__self->__sn__count = sn_add_long(__sn__self->__sn__count, 1LL));
+    
+
+    ({
+        SnArray *__ma_arr_tmp__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 3);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ __sn__v });
+            sn_array_push(__al__, &(double){ sn_add_double(__sn__v, 1.0) });
+            sn_array_push(__al__, &(double){ sn_add_double(__sn__v, 2.0) });
+            __al__;
+        });
+        sn_cleanup_array(&__sn__self->__sn__data);
+        __sn__self->__sn__data = __ma_arr_tmp__;
+        __sn__self->__sn__data;
+    });
+    
+}
+
+
+void __sn__Wrap_Box_runDirect(__sn__Wrap_Box *__sn__self, double __sn__v) {
+
+    __sn__Box_mutate(&__sn__self->__sn__inner, __sn__v);
+    
+
+    (__sn__self->__sn__ranInsideFlag = __sn__self->__sn__inner.__sn__flag);
+    
+
+    (__sn__self->__sn__ranInsideData0 = (((double *)__sn__self->__sn__inner.__sn__data->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__self->__sn__inner.__sn__data->len : __ai__; })]));
+    
+}
+
+void __sn__Wrap_Box_runViaLocal(__sn__Wrap_Box *__sn__self, double __sn__v) {
+
+    sn_auto_Box __sn__Box __sn__local = __sn__Box_copy(&__sn__self->__sn__inner);
+
+    __sn__Box_mutate(&__sn__local, __sn__v);
+    
+}
+
+int main() {
+    sn_auto_arr SnArray * __sn__d0 = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 3);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 0.0 });
+            sn_array_push(__al__, &(double){ 0.0 });
+            sn_array_push(__al__, &(double){ 0.0 });
+            __al__;
+        });
+    sn_auto_Box __sn__Box __sn__b = (__sn__Box){ .__sn__flag = false, .__sn__count = 0LL, .__sn__data = sn_array_copy(__sn__d0) };
+    sn_auto_Wrap_Box __sn__Wrap_Box __sn__w = (__sn__Wrap_Box){ .__sn__inner = __sn__Box_copy(&(__sn__b)), .__sn__ranInsideFlag = false, .__sn__ranInsideData0 = (-1.0) };
+    __sn__Wrap_Box_runDirect(&__sn__w, 42.0);
+    
+    if ((!__sn__w.__sn__ranInsideFlag)) {
+        sn_print("FAIL: inside runDirect, self.inner.flag not visible after mutate\n");
+        
+        return 1LL;}
+    if ((__sn__w.__sn__ranInsideData0 != 42.0)) {
+        sn_print("FAIL: inside runDirect, self.inner.data[0] not visible after mutate\n");
+        
+        return 1LL;}
+    sn_print("Test 1 passed: inside-method self-view sees mutation\n");
+    
+    if ((!__sn__w.__sn__inner.__sn__flag)) {
+        sn_print("FAIL: w.inner.flag should be true after runDirect\n");
+        
+        return 1LL;}
+    if ((__sn__w.__sn__inner.__sn__count != 1LL)) {
+        sn_print("FAIL: w.inner.count should be 1 after runDirect\n");
+        
+        return 1LL;}
+    if ((sn_array_length(__sn__w.__sn__inner.__sn__data) != 3LL)) {
+        sn_print("FAIL: w.inner.data.length should be 3 after runDirect\n");
+        
+        return 1LL;}
+    if (((((double *)__sn__w.__sn__inner.__sn__data->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__w.__sn__inner.__sn__data->len : __ai__; })]) != 42.0)) {
+        sn_print("FAIL: w.inner.data[0] should be 42.0 after runDirect\n");
+        
+        return 1LL;}
+    if (((((double *)__sn__w.__sn__inner.__sn__data->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__w.__sn__inner.__sn__data->len : __ai__; })]) != 44.0)) {
+        sn_print("FAIL: w.inner.data[2] should be 44.0 after runDirect\n");
+        
+        return 1LL;}
+    sn_print("Test 2 passed: post-call wrapper.inner reflects mutation\n");
+    
+    if (__sn__b.__sn__flag) {
+        sn_print("FAIL: caller's b.flag should remain false (pre-construction copy)\n");
+        
+        return 1LL;}
+    if ((__sn__b.__sn__count != 0LL)) {
+        sn_print("FAIL: caller's b.count should remain 0 (pre-construction copy)\n");
+        
+        return 1LL;}
+    if ((sn_array_length(__sn__b.__sn__data) != 3LL)) {
+        sn_print("FAIL: caller's b.data.length should remain 3 (pre-construction copy)\n");
+        
+        return 1LL;}
+    if (((((double *)__sn__b.__sn__data->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__b.__sn__data->len : __ai__; })]) != 0.0)) {
+        sn_print("FAIL: caller's b.data[0] should remain 0.0 (pre-construction copy)\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: pre-construction caller variable unaffected (value semantics)\n");
+    
+    sn_auto_Box __sn__Box __sn__b2 = (__sn__Box){ .__sn__flag = false, .__sn__count = 0LL, .__sn__data = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 1);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 0.0 });
+            __al__;
+        }) };
+    sn_auto_Wrap_Box __sn__Wrap_Box __sn__w2 = (__sn__Wrap_Box){ .__sn__inner = __sn__Box_copy(&(__sn__b2)), .__sn__ranInsideFlag = false, .__sn__ranInsideData0 = (-1.0) };
+    __sn__Wrap_Box_runViaLocal(&__sn__w2, 99.0);
+    
+    if (__sn__w2.__sn__inner.__sn__flag) {
+        sn_print("FAIL: runViaLocal mutated the wrapper's copy — expected local-copy isolation\n");
+        
+        return 1LL;}
+    if ((__sn__w2.__sn__inner.__sn__count != 0LL)) {
+        sn_print("FAIL: runViaLocal bumped count — expected local-copy isolation\n");
+        
+        return 1LL;}
+    if ((sn_array_length(__sn__w2.__sn__inner.__sn__data) != 1LL)) {
+        sn_print("FAIL: runViaLocal changed data length — expected local-copy isolation\n");
+        
+        return 1LL;}
+    if (((((double *)__sn__w2.__sn__inner.__sn__data->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__w2.__sn__inner.__sn__data->len : __ai__; })]) != 0.0)) {
+        sn_print("FAIL: runViaLocal changed data[0] — expected local-copy isolation\n");
+        
+        return 1LL;}
+    sn_print("Test 4 passed: local-copy-then-mutate does not propagate\n");
+    
+    sn_print("All generic wrapper value semantics tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,147 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Box (as val) */
+typedef struct {
+    bool __sn__flag;
+    long long __sn__count;
+    SnArray * __sn__data;
+} __sn__Box;
+/* Value operations */
+static inline __sn__Box __sn__Box_copy(const __sn__Box *src) {
+    __sn__Box dst;
+    dst.__sn__flag = src->__sn__flag;
+    dst.__sn__count = src->__sn__count;
+    dst.__sn__data = sn_array_copy(src->__sn__data);
+    return dst;
+}
+
+static inline void __sn__Box_cleanup(__sn__Box *p) {
+    sn_cleanup_array(&p->__sn__data);
+
+}
+
+#define sn_auto_Box __attribute__((cleanup(__sn__Box_cleanup)))
+
+static inline void __sn__Box_cleanup_elem(void *p) { __sn__Box_cleanup((__sn__Box *)p); }
+static inline void __sn__Box_copy_into(const void *src, void *dst) { *(__sn__Box *)dst = __sn__Box_copy((const __sn__Box *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Box *__sn__Box_alloc(void) {
+    return calloc(1, sizeof(__sn__Box));
+}
+
+static inline void __sn__Box_release(__sn__Box **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__data);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Box __attribute__((cleanup(__sn__Box_release)))
+
+static inline void __sn__Box_release_elem(void *p) { __sn__Box_release((__sn__Box **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Box_to_string(const __sn__Box *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Box { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "flag: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__flag ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "count: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__count);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "data: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__data); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Wrap_Box (as val) */
+typedef struct {
+    __sn__Box __sn__inner;
+    bool __sn__ranInsideFlag;
+    double __sn__ranInsideData0;
+} __sn__Wrap_Box;
+/* Value operations */
+static inline __sn__Wrap_Box __sn__Wrap_Box_copy(const __sn__Wrap_Box *src) {
+    __sn__Wrap_Box dst;
+    dst.__sn__inner = __sn__Box_copy(&src->__sn__inner);
+    dst.__sn__ranInsideFlag = src->__sn__ranInsideFlag;
+    dst.__sn__ranInsideData0 = src->__sn__ranInsideData0;
+    return dst;
+}
+
+static inline void __sn__Wrap_Box_cleanup(__sn__Wrap_Box *p) {
+    __sn__Box_cleanup(&p->__sn__inner);
+
+}
+
+#define sn_auto_Wrap_Box __attribute__((cleanup(__sn__Wrap_Box_cleanup)))
+
+static inline void __sn__Wrap_Box_cleanup_elem(void *p) { __sn__Wrap_Box_cleanup((__sn__Wrap_Box *)p); }
+static inline void __sn__Wrap_Box_copy_into(const void *src, void *dst) { *(__sn__Wrap_Box *)dst = __sn__Wrap_Box_copy((const __sn__Wrap_Box *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Wrap_Box *__sn__Wrap_Box_alloc(void) {
+    return calloc(1, sizeof(__sn__Wrap_Box));
+}
+
+static inline void __sn__Wrap_Box_release(__sn__Wrap_Box **p) {
+    if (*p) {
+        __sn__Box_cleanup(&(*p)->__sn__inner);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Wrap_Box __attribute__((cleanup(__sn__Wrap_Box_release)))
+
+static inline void __sn__Wrap_Box_release_elem(void *p) { __sn__Wrap_Box_release((__sn__Wrap_Box **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Wrap_Box_to_string(const __sn__Wrap_Box *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Wrap_Box { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "inner: ");
+    { char *__fs__ = __sn__Box_to_string(&p->__sn__inner); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "ranInsideFlag: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__ranInsideFlag ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "ranInsideData0: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__ranInsideData0);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+void __sn__Box_mutate(__sn__Box *, double);
+void __sn__Wrap_Box_runDirect(__sn__Wrap_Box *, double);
+void __sn__Wrap_Box_runViaLocal(__sn__Wrap_Box *, double);
+
+
+
+#endif
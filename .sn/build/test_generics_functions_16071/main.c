@@ -0,0 +1,247 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__identity_int(long long __sn__x) {
+
+    return __sn__x;}
+
+
+char * __sn__identity_str(char * __sn__x) {
+
+    return strdup(__sn__x);}
+
+
+long long __sn__first_int(SnArray * __sn__arr) {
+
+    return (((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);}
+
+
+char * __sn__first_str(SnArray * __sn__arr) {
+
+    return strdup((((char * *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]));}
+
+
+SnArray * __sn__map_int_int(SnArray * __sn__arr, void * __sn__f) {
+
+    sn_auto_arr SnArray * __sn__result = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__x = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__arr_push(&__sn__result, ((long long (*)(void *, long long))((__Closure__ *)__sn__f)->fn)(__sn__f, __sn__x));
+                
+            }
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+
+SnArray * __sn__map_str_str(SnArray * __sn__arr, void * __sn__f) {
+
+    sn_auto_arr SnArray * __sn__result = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 0);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            __al__;
+        });
+
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            char * __sn__x = ((char * *)__arr_0__->data)[__idx_0__];
+            {
+                char * __sn____chain_tmp_0 = ((char * (*)(void *, char *))((__Closure__ *)__sn__f)->fn)(__sn__f, __sn__x);
+                __sn__arr_push(&__sn__result, __sn____chain_tmp_0);
+                
+            }
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+
+SnArray * __sn__filter_int(SnArray * __sn__arr, void * __sn__pred) {
+
+    sn_auto_arr SnArray * __sn__result = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__x = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if (((bool (*)(void *, long long))((__Closure__ *)__sn__pred)->fn)(__sn__pred, __sn__x)) {
+                    __sn__arr_push(&__sn__result, __sn__x);
+                    
+                }
+            }
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    long long __sn__i = __sn__identity_int(99LL);
+    if ((__sn__i != 99LL)) {
+        sn_print("FAIL: identity(99) should return 99\n");
+        
+        return 1LL;}
+    sn_print("Test 1 passed: identity<int>\n");
+    
+    sn_auto_str char * __sn__s = __sn__identity_str("sindarin");
+    if ((strcmp(__sn__s, "sindarin") != 0)) {
+        sn_print("FAIL: identity('sindarin') should return 'sindarin'\n");
+        
+        return 1LL;}
+    sn_print("Test 2 passed: identity<str>\n");
+    
+    sn_auto_arr SnArray * __sn__nums = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            __al__;
+        });
+    long long __sn__f = __sn__first_int(__sn__nums);
+    if ((__sn__f != 10LL)) {
+        sn_print("FAIL: first(nums) should return 10\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: first<int>\n");
+    
+    sn_auto_arr SnArray * __sn__words = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("alpha") });
+            sn_array_push(__al__, &(char *){ strdup("beta") });
+            sn_array_push(__al__, &(char *){ strdup("gamma") });
+            __al__;
+        });
+    sn_auto_str char * __sn__fw = __sn__first_str(__sn__words);
+    if ((strcmp(__sn__fw, "alpha") != 0)) {
+        sn_print("FAIL: first(words) should return 'alpha'\n");
+        
+        return 1LL;}
+    sn_print("Test 4 passed: first<str>\n");
+    
+    sn_auto_arr SnArray * __sn__doubled = ({ sn_auto_arr SnArray *__al_tmp_0__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        }); sn_auto_fn void *__fn_tmp_1__ = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__map_int_int(__al_tmp_0__, __fn_tmp_1__); });
+    if (((((((long long *)__sn__doubled->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__doubled->len : __ai__; })]) != 2LL) || ((((long long *)__sn__doubled->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__doubled->len : __ai__; })]) != 4LL)) || ((((long long *)__sn__doubled->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__doubled->len : __ai__; })]) != 6LL))) {
+        sn_print("FAIL: map double should produce [2, 4, 6]\n");
+        
+        return 1LL;}
+    sn_print("Test 5 passed: map<int, int>\n");
+    
+    sn_auto_arr SnArray * __sn__uppers = ({ sn_auto_arr SnArray *__al_tmp_0__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("hello") });
+            sn_array_push(__al__, &(char *){ strdup("world") });
+            __al__;
+        }); sn_auto_fn void *__fn_tmp_1__ = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__map_str_str(__al_tmp_0__, __fn_tmp_1__); });
+    if (((strcmp((((char * *)__sn__uppers->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__uppers->len : __ai__; })]), "HELLO") != 0) || (strcmp((((char * *)__sn__uppers->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__uppers->len : __ai__; })]), "WORLD") != 0))) {
+        sn_print("FAIL: map toUpper should produce ['HELLO', 'WORLD']\n");
+        
+        return 1LL;}
+    sn_print("Test 6 passed: map<str, str>\n");
+    
+    sn_auto_arr SnArray * __sn__evens = ({ sn_auto_arr SnArray *__al_tmp_0__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        }); sn_auto_fn void *__fn_tmp_1__ = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_2__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__filter_int(__al_tmp_0__, __fn_tmp_1__); });
+    if ((((sn_array_length(__sn__evens) != 2LL) || ((((long long *)__sn__evens->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__evens->len : __ai__; })]) != 2LL)) || ((((long long *)__sn__evens->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__evens->len : __ai__; })]) != 4LL))) {
+        sn_print("FAIL: filter even should produce [2, 4]\n");
+        
+        return 1LL;}
+    sn_print("Test 7 passed: filter<int>\n");
+    
+    sn_print("All generic function tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
+
+static long long __lambda_0__(void *__closure__, long long __sn__x) {
+    return sn_mul_long(__sn__x, 2LL);
+}
+
+static char * __lambda_1__(void *__closure__, char * __sn__x) {
+    return __sn___toUpper(&__sn__x);
+}
+
+static bool __lambda_2__(void *__closure__, long long __sn__x) {
+    return (sn_mod_long(__sn__x, 2LL) == 0LL);
+}
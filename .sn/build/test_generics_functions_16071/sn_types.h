@@ -0,0 +1,34 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long __sn__identity_int(long long);
+char * __sn__identity_str(char *);
+long long __sn__first_int(SnArray *);
+char * __sn__first_str(SnArray *);
+SnArray * __sn__map_int_int(SnArray *, void *);
+SnArray * __sn__map_str_str(SnArray *, void *);
+SnArray * __sn__filter_int(SnArray *, void *);
+
+
+
+static long long __lambda_0__(void *__closure__, long long __sn__x);
+static char * __lambda_1__(void *__closure__, char * __sn__x);
+static bool __lambda_2__(void *__closure__, long long __sn__x);
+
+#endif
@@ -0,0 +1,157 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__unwrap_int(__sn__Box_int __sn__b) {
+
+    return __sn__b.__sn__value;}
+
+
+char * __sn__unwrap_str(__sn__Box_str *__sn__b) {
+
+    return strdup((*__sn__b).__sn__value);}
+
+
+long long __sn__runOne_CrusherAdapter(__sn__Worker_CrusherAdapter __sn__w) {
+
+    return __sn__CrusherAdapter_stepId(&__sn__w.__sn__sim);}
+
+
+long long __sn__runOne_WidgetAdapter(__sn__Worker_WidgetAdapter __sn__w) {
+
+    return __sn__WidgetAdapter_stepId(&__sn__w.__sn__sim);}
+
+
+long long __sn__firstOf_int_str(__sn__Pair_int_str *__sn__p) {
+
+    return (*__sn__p).__sn__first;}
+
+
+char * __sn__secondOf_int_str(__sn__Pair_int_str *__sn__p) {
+
+    return strdup((*__sn__p).__sn__second);}
+
+
+long long __sn__innerFirst_int_str(__sn__Box_Pair_int_str *__sn__bp) {
+
+    return (*__sn__bp).__sn__value.__sn__first;}
+
+
+long long __sn__takeBoth_int(long long __sn__x, __sn__Box_int __sn__b) {
+
+    if ((__sn__x == __sn__b.__sn__value)) {
+        return __sn__x;}
+
+    return __sn__b.__sn__value;}
+
+
+__sn__Worker_CrusherAdapter __sn__buildWorker_CrusherAdapter(__sn__CrusherAdapter __sn__s) {
+
+    return (__sn__Worker_CrusherAdapter){ .__sn__sim = __sn__s, .__sn__steps = 0LL };}
+
+
+long long __sn__CrusherAdapter_stepId(__sn__CrusherAdapter *__sn__self) {
+
+    return __sn__self->__sn__counter;}
+
+
+long long __sn__WidgetAdapter_stepId(__sn__WidgetAdapter *__sn__self) {
+
+    return sn_mul_long(__sn__self->__sn__tag, 10LL);}
+
+
+
+
+
+
+
+
+int main() {
+    __sn__Box_int __sn__bi = (__sn__Box_int){ .__sn__value = 42LL };
+    long long __sn__i1 = __sn__unwrap_int(__sn__bi);
+    if ((__sn__i1 != 42LL)) {
+        sn_print("FAIL: unwrap(Box<int>) should return 42\n");
+        
+        return 1LL;}
+    sn_print("Case 1a passed: unwrap<int> from var\n");
+    
+    sn_auto_Box_str __sn__Box_str __sn__bs = (__sn__Box_str){ .__sn__value = strdup("hello") };
+    sn_auto_str char * __sn__s1 = __sn__unwrap_str(&__sn__bs);
+    if ((strcmp(__sn__s1, "hello") != 0)) {
+        sn_print("FAIL: unwrap(Box<str>) should return 'hello'\n");
+        
+        return 1LL;}
+    sn_print("Case 1b passed: unwrap<str> from var\n");
+    
+    __sn__Worker_CrusherAdapter __sn__wc = (__sn__Worker_CrusherAdapter){ .__sn__sim = (__sn__CrusherAdapter){ .__sn__counter = 7LL }, .__sn__steps = 0LL };
+    long long __sn__r1 = __sn__runOne_CrusherAdapter(__sn__wc);
+    if ((__sn__r1 != 7LL)) {
+        sn_print("FAIL: runOne(Worker<CrusherAdapter>) should return 7\n");
+        
+        return 1LL;}
+    sn_print("Case 2a passed: runOne<CrusherAdapter>\n");
+    
+    __sn__Worker_WidgetAdapter __sn__ww = (__sn__Worker_WidgetAdapter){ .__sn__sim = (__sn__WidgetAdapter){ .__sn__tag = 4LL }, .__sn__steps = 0LL };
+    long long __sn__r2 = __sn__runOne_WidgetAdapter(__sn__ww);
+    if ((__sn__r2 != 40LL)) {
+        sn_print("FAIL: runOne(Worker<WidgetAdapter>) should return 40\n");
+        
+        return 1LL;}
+    sn_print("Case 2b passed: runOne<WidgetAdapter>\n");
+    
+    sn_auto_Pair_int_str __sn__Pair_int_str __sn__p1 = (__sn__Pair_int_str){ .__sn__first = 99LL, .__sn__second = strdup("ok") };
+    long long __sn__pi = __sn__firstOf_int_str(&__sn__p1);
+    sn_auto_str char * __sn__ps = __sn__secondOf_int_str(&__sn__p1);
+    if ((__sn__pi != 99LL)) {
+        sn_print("FAIL: firstOf(Pair<int,str>) should return 99\n");
+        
+        return 1LL;}
+    if ((strcmp(__sn__ps, "ok") != 0)) {
+        sn_print("FAIL: secondOf(Pair<int,str>) should return 'ok'\n");
+        
+        return 1LL;}
+    sn_print("Case 3 passed: firstOf/secondOf<int, str>\n");
+    
+    sn_auto_Pair_int_str __sn__Pair_int_str __sn__innerPair = (__sn__Pair_int_str){ .__sn__first = 11LL, .__sn__second = strdup("deep") };
+    sn_auto_Box_Pair_int_str __sn__Box_Pair_int_str __sn__bp = (__sn__Box_Pair_int_str){ .__sn__value = __sn__Pair_int_str_copy(&(__sn__innerPair)) };
+    long long __sn__di = __sn__innerFirst_int_str(&__sn__bp);
+    if ((__sn__di != 11LL)) {
+        sn_print("FAIL: innerFirst(Box<Pair<int,str>>) should return 11\n");
+        
+        return 1LL;}
+    sn_print("Case 4 passed: innerFirst<int, str> (doubly nested)\n");
+    
+    __sn__Box_int __sn__b5 = (__sn__Box_int){ .__sn__value = 5LL };
+    long long __sn__t1 = __sn__takeBoth_int(5LL, __sn__b5);
+    if ((__sn__t1 != 5LL)) {
+        sn_print("FAIL: takeBoth(5, Box<int>{5}) should return 5\n");
+        
+        return 1LL;}
+    sn_print("Case 5 passed: takeBoth<int>\n");
+    
+    __sn__Engine __sn__e1 = (__sn__Engine){ .__sn__worker = (__sn__Worker_CrusherAdapter){ .__sn__sim = (__sn__CrusherAdapter){ .__sn__counter = 3LL }, .__sn__steps = 0LL }, .__sn__iterations = 0LL };
+    if ((__sn__e1.__sn__worker.__sn__sim.__sn__counter != 3LL)) {
+        sn_print("FAIL: Engine.worker.sim.counter should be 3\n");
+        
+        return 1LL;}
+    sn_print("Case 6 passed: Engine literal with nested Worker<CrusherAdapter>\n");
+    
+    __sn__Worker_CrusherAdapter __sn__w7 = __sn__e1.__sn__worker;
+    if ((__sn__w7.__sn__sim.__sn__counter != 3LL)) {
+        sn_print("FAIL: w7.sim.counter should be 3\n");
+        
+        return 1LL;}
+    sn_print("Case 7 passed: copy from Engine.worker into Worker<CrusherAdapter>\n");
+    
+    __sn__Engine __sn__e2 = (__sn__Engine){ .__sn__worker = __sn__buildWorker_CrusherAdapter((__sn__CrusherAdapter){ .__sn__counter = 11LL }), .__sn__iterations = 1LL };
+    if ((__sn__e2.__sn__worker.__sn__sim.__sn__counter != 11LL)) {
+        sn_print("FAIL: e2.worker.sim.counter should be 11\n");
+        
+        return 1LL;}
+    sn_print("Case 8 passed: Engine field init from buildWorker<CrusherAdapter>\n");
+    
+    sn_print("All nested-inference tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,493 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: CrusherAdapter (as val) */
+typedef struct {
+    long long __sn__counter;
+} __sn__CrusherAdapter;
+/* Value operations */
+static inline __sn__CrusherAdapter __sn__CrusherAdapter_copy(const __sn__CrusherAdapter *src) {
+    __sn__CrusherAdapter dst;
+    dst.__sn__counter = src->__sn__counter;
+    return dst;
+}
+
+static inline void __sn__CrusherAdapter_cleanup(__sn__CrusherAdapter *p) {
+
+}
+
+#define sn_auto_CrusherAdapter __attribute__((cleanup(__sn__CrusherAdapter_cleanup)))
+
+static inline void __sn__CrusherAdapter_cleanup_elem(void *p) { __sn__CrusherAdapter_cleanup((__sn__CrusherAdapter *)p); }
+static inline void __sn__CrusherAdapter_copy_into(const void *src, void *dst) { *(__sn__CrusherAdapter *)dst = __sn__CrusherAdapter_copy((const __sn__CrusherAdapter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__CrusherAdapter *__sn__CrusherAdapter_alloc(void) {
+    return calloc(1, sizeof(__sn__CrusherAdapter));
+}
+
+static inline void __sn__CrusherAdapter_release(__sn__CrusherAdapter **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_CrusherAdapter __attribute__((cleanup(__sn__CrusherAdapter_release)))
+
+static inline void __sn__CrusherAdapter_release_elem(void *p) { __sn__CrusherAdapter_release((__sn__CrusherAdapter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__CrusherAdapter_to_string(const __sn__CrusherAdapter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "CrusherAdapter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "counter: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__counter);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: WidgetAdapter (as val) */
+typedef struct {
+    long long __sn__tag;
+} __sn__WidgetAdapter;
+/* Value operations */
+static inline __sn__WidgetAdapter __sn__WidgetAdapter_copy(const __sn__WidgetAdapter *src) {
+    __sn__WidgetAdapter dst;
+    dst.__sn__tag = src->__sn__tag;
+    return dst;
+}
+
+static inline void __sn__WidgetAdapter_cleanup(__sn__WidgetAdapter *p) {
+
+}
+
+#define sn_auto_WidgetAdapter __attribute__((cleanup(__sn__WidgetAdapter_cleanup)))
+
+static inline void __sn__WidgetAdapter_cleanup_elem(void *p) { __sn__WidgetAdapter_cleanup((__sn__WidgetAdapter *)p); }
+static inline void __sn__WidgetAdapter_copy_into(const void *src, void *dst) { *(__sn__WidgetAdapter *)dst = __sn__WidgetAdapter_copy((const __sn__WidgetAdapter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__WidgetAdapter *__sn__WidgetAdapter_alloc(void) {
+    return calloc(1, sizeof(__sn__WidgetAdapter));
+}
+
+static inline void __sn__WidgetAdapter_release(__sn__WidgetAdapter **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_WidgetAdapter __attribute__((cleanup(__sn__WidgetAdapter_release)))
+
+static inline void __sn__WidgetAdapter_release_elem(void *p) { __sn__WidgetAdapter_release((__sn__WidgetAdapter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__WidgetAdapter_to_string(const __sn__WidgetAdapter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "WidgetAdapter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tag: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__tag);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Worker_CrusherAdapter (as val) */
+typedef struct {
+    __sn__CrusherAdapter __sn__sim;
+    long long __sn__steps;
+} __sn__Worker_CrusherAdapter;
+/* Value operations */
+static inline __sn__Worker_CrusherAdapter __sn__Worker_CrusherAdapter_copy(const __sn__Worker_CrusherAdapter *src) {
+    __sn__Worker_CrusherAdapter dst;
+    dst.__sn__sim = __sn__CrusherAdapter_copy(&src->__sn__sim);
+    dst.__sn__steps = src->__sn__steps;
+    return dst;
+}
+
+static inline void __sn__Worker_CrusherAdapter_cleanup(__sn__Worker_CrusherAdapter *p) {
+
+}
+
+#define sn_auto_Worker_CrusherAdapter __attribute__((cleanup(__sn__Worker_CrusherAdapter_cleanup)))
+
+static inline void __sn__Worker_CrusherAdapter_cleanup_elem(void *p) { __sn__Worker_CrusherAdapter_cleanup((__sn__Worker_CrusherAdapter *)p); }
+static inline void __sn__Worker_CrusherAdapter_copy_into(const void *src, void *dst) { *(__sn__Worker_CrusherAdapter *)dst = __sn__Worker_CrusherAdapter_copy((const __sn__Worker_CrusherAdapter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Worker_CrusherAdapter *__sn__Worker_CrusherAdapter_alloc(void) {
+    return calloc(1, sizeof(__sn__Worker_CrusherAdapter));
+}
+
+static inline void __sn__Worker_CrusherAdapter_release(__sn__Worker_CrusherAdapter **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Worker_CrusherAdapter __attribute__((cleanup(__sn__Worker_CrusherAdapter_release)))
+
+static inline void __sn__Worker_CrusherAdapter_release_elem(void *p) { __sn__Worker_CrusherAdapter_release((__sn__Worker_CrusherAdapter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Worker_CrusherAdapter_to_string(const __sn__Worker_CrusherAdapter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Worker_CrusherAdapter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "sim: ");
+    { char *__fs__ = __sn__CrusherAdapter_to_string(&p->__sn__sim); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "steps: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__steps);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Engine (as val) */
+typedef struct {
+    __sn__Worker_CrusherAdapter __sn__worker;
+    long long __sn__iterations;
+} __sn__Engine;
+/* Value operations */
+static inline __sn__Engine __sn__Engine_copy(const __sn__Engine *src) {
+    __sn__Engine dst;
+    dst.__sn__worker = __sn__Worker_CrusherAdapter_copy(&src->__sn__worker);
+    dst.__sn__iterations = src->__sn__iterations;
+    return dst;
+}
+
+static inline void __sn__Engine_cleanup(__sn__Engine *p) {
+
+}
+
+#define sn_auto_Engine __attribute__((cleanup(__sn__Engine_cleanup)))
+
+static inline void __sn__Engine_cleanup_elem(void *p) { __sn__Engine_cleanup((__sn__Engine *)p); }
+static inline void __sn__Engine_copy_into(const void *src, void *dst) { *(__sn__Engine *)dst = __sn__Engine_copy((const __sn__Engine *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Engine *__sn__Engine_alloc(void) {
+    return calloc(1, sizeof(__sn__Engine));
+}
+
+static inline void __sn__Engine_release(__sn__Engine **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Engine __attribute__((cleanup(__sn__Engine_release)))
+
+static inline void __sn__Engine_release_elem(void *p) { __sn__Engine_release((__sn__Engine **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Engine_to_string(const __sn__Engine *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Engine { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "worker: ");
+    { char *__fs__ = __sn__Worker_CrusherAdapter_to_string(&p->__sn__worker); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "iterations: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__iterations);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Box_int (as val) */
+typedef struct {
+    long long __sn__value;
+} __sn__Box_int;
+/* Value operations */
+static inline __sn__Box_int __sn__Box_int_copy(const __sn__Box_int *src) {
+    __sn__Box_int dst;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Box_int_cleanup(__sn__Box_int *p) {
+
+}
+
+#define sn_auto_Box_int __attribute__((cleanup(__sn__Box_int_cleanup)))
+
+static inline void __sn__Box_int_cleanup_elem(void *p) { __sn__Box_int_cleanup((__sn__Box_int *)p); }
+static inline void __sn__Box_int_copy_into(const void *src, void *dst) { *(__sn__Box_int *)dst = __sn__Box_int_copy((const __sn__Box_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Box_int *__sn__Box_int_alloc(void) {
+    return calloc(1, sizeof(__sn__Box_int));
+}
+
+static inline void __sn__Box_int_release(__sn__Box_int **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Box_int __attribute__((cleanup(__sn__Box_int_release)))
+
+static inline void __sn__Box_int_release_elem(void *p) { __sn__Box_int_release((__sn__Box_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Box_int_to_string(const __sn__Box_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Box_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Box_str (as val) */
+typedef struct {
+    char * __sn__value;
+} __sn__Box_str;
+/* Value operations */
+static inline __sn__Box_str __sn__Box_str_copy(const __sn__Box_str *src) {
+    __sn__Box_str dst;
+    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    return dst;
+}
+
+static inline void __sn__Box_str_cleanup(__sn__Box_str *p) {
+    free(p->__sn__value);
+
+}
+
+#define sn_auto_Box_str __attribute__((cleanup(__sn__Box_str_cleanup)))
+
+static inline void __sn__Box_str_cleanup_elem(void *p) { __sn__Box_str_cleanup((__sn__Box_str *)p); }
+static inline void __sn__Box_str_copy_into(const void *src, void *dst) { *(__sn__Box_str *)dst = __sn__Box_str_copy((const __sn__Box_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Box_str *__sn__Box_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Box_str));
+}
+
+static inline void __sn__Box_str_release(__sn__Box_str **p) {
+    if (*p) {
+        free((*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Box_str __attribute__((cleanup(__sn__Box_str_release)))
+
+static inline void __sn__Box_str_release_elem(void *p) { __sn__Box_str_release((__sn__Box_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Box_str_to_string(const __sn__Box_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Box_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Worker_WidgetAdapter (as val) */
+typedef struct {
+    __sn__WidgetAdapter __sn__sim;
+    long long __sn__steps;
+} __sn__Worker_WidgetAdapter;
+/* Value operations */
+static inline __sn__Worker_WidgetAdapter __sn__Worker_WidgetAdapter_copy(const __sn__Worker_WidgetAdapter *src) {
+    __sn__Worker_WidgetAdapter dst;
+    dst.__sn__sim = __sn__WidgetAdapter_copy(&src->__sn__sim);
+    dst.__sn__steps = src->__sn__steps;
+    return dst;
+}
+
+static inline void __sn__Worker_WidgetAdapter_cleanup(__sn__Worker_WidgetAdapter *p) {
+
+}
+
+#define sn_auto_Worker_WidgetAdapter __attribute__((cleanup(__sn__Worker_WidgetAdapter_cleanup)))
+
+static inline void __sn__Worker_WidgetAdapter_cleanup_elem(void *p) { __sn__Worker_WidgetAdapter_cleanup((__sn__Worker_WidgetAdapter *)p); }
+static inline void __sn__Worker_WidgetAdapter_copy_into(const void *src, void *dst) { *(__sn__Worker_WidgetAdapter *)dst = __sn__Worker_WidgetAdapter_copy((const __sn__Worker_WidgetAdapter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Worker_WidgetAdapter *__sn__Worker_WidgetAdapter_alloc(void) {
+    return calloc(1, sizeof(__sn__Worker_WidgetAdapter));
+}
+
+static inline void __sn__Worker_WidgetAdapter_release(__sn__Worker_WidgetAdapter **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Worker_WidgetAdapter __attribute__((cleanup(__sn__Worker_WidgetAdapter_release)))
+
+static inline void __sn__Worker_WidgetAdapter_release_elem(void *p) { __sn__Worker_WidgetAdapter_release((__sn__Worker_WidgetAdapter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Worker_WidgetAdapter_to_string(const __sn__Worker_WidgetAdapter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Worker_WidgetAdapter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "sim: ");
+    { char *__fs__ = __sn__WidgetAdapter_to_string(&p->__sn__sim); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "steps: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__steps);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Pair_int_str (as val) */
+typedef struct {
+    long long __sn__first;
+    char * __sn__second;
+} __sn__Pair_int_str;
+/* Value operations */
+static inline __sn__Pair_int_str __sn__Pair_int_str_copy(const __sn__Pair_int_str *src) {
+    __sn__Pair_int_str dst;
+    dst.__sn__first = src->__sn__first;
+    dst.__sn__second = src->__sn__second ? strdup(src->__sn__second) : NULL;
+    return dst;
+}
+
+static inline void __sn__Pair_int_str_cleanup(__sn__Pair_int_str *p) {
+    free(p->__sn__second);
+
+}
+
+#define sn_auto_Pair_int_str __attribute__((cleanup(__sn__Pair_int_str_cleanup)))
+
+static inline void __sn__Pair_int_str_cleanup_elem(void *p) { __sn__Pair_int_str_cleanup((__sn__Pair_int_str *)p); }
+static inline void __sn__Pair_int_str_copy_into(const void *src, void *dst) { *(__sn__Pair_int_str *)dst = __sn__Pair_int_str_copy((const __sn__Pair_int_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Pair_int_str *__sn__Pair_int_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Pair_int_str));
+}
+
+static inline void __sn__Pair_int_str_release(__sn__Pair_int_str **p) {
+    if (*p) {
+        free((*p)->__sn__second);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Pair_int_str __attribute__((cleanup(__sn__Pair_int_str_release)))
+
+static inline void __sn__Pair_int_str_release_elem(void *p) { __sn__Pair_int_str_release((__sn__Pair_int_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Pair_int_str_to_string(const __sn__Pair_int_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Pair_int_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "first: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__first);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "second: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__second ? p->__sn__second : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Box_Pair_int_str (as val) */
+typedef struct {
+    __sn__Pair_int_str __sn__value;
+} __sn__Box_Pair_int_str;
+/* Value operations */
+static inline __sn__Box_Pair_int_str __sn__Box_Pair_int_str_copy(const __sn__Box_Pair_int_str *src) {
+    __sn__Box_Pair_int_str dst;
+    dst.__sn__value = __sn__Pair_int_str_copy(&src->__sn__value);
+    return dst;
+}
+
+static inline void __sn__Box_Pair_int_str_cleanup(__sn__Box_Pair_int_str *p) {
+    __sn__Pair_int_str_cleanup(&p->__sn__value);
+
+}
+
+#define sn_auto_Box_Pair_int_str __attribute__((cleanup(__sn__Box_Pair_int_str_cleanup)))
+
+static inline void __sn__Box_Pair_int_str_cleanup_elem(void *p) { __sn__Box_Pair_int_str_cleanup((__sn__Box_Pair_int_str *)p); }
+static inline void __sn__Box_Pair_int_str_copy_into(const void *src, void *dst) { *(__sn__Box_Pair_int_str *)dst = __sn__Box_Pair_int_str_copy((const __sn__Box_Pair_int_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Box_Pair_int_str *__sn__Box_Pair_int_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Box_Pair_int_str));
+}
+
+static inline void __sn__Box_Pair_int_str_release(__sn__Box_Pair_int_str **p) {
+    if (*p) {
+        __sn__Pair_int_str_cleanup(&(*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Box_Pair_int_str __attribute__((cleanup(__sn__Box_Pair_int_str_release)))
+
+static inline void __sn__Box_Pair_int_str_release_elem(void *p) { __sn__Box_Pair_int_str_release((__sn__Box_Pair_int_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Box_Pair_int_str_to_string(const __sn__Box_Pair_int_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Box_Pair_int_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    { char *__fs__ = __sn__Pair_int_str_to_string(&p->__sn__value); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+long long __sn__unwrap_int(__sn__Box_int);
+char * __sn__unwrap_str(__sn__Box_str *);
+long long __sn__runOne_CrusherAdapter(__sn__Worker_CrusherAdapter);
+long long __sn__runOne_WidgetAdapter(__sn__Worker_WidgetAdapter);
+long long __sn__firstOf_int_str(__sn__Pair_int_str *);
+char * __sn__secondOf_int_str(__sn__Pair_int_str *);
+long long __sn__innerFirst_int_str(__sn__Box_Pair_int_str *);
+long long __sn__takeBoth_int(long long, __sn__Box_int);
+__sn__Worker_CrusherAdapter __sn__buildWorker_CrusherAdapter(__sn__CrusherAdapter);
+
+long long __sn__CrusherAdapter_stepId(__sn__CrusherAdapter *);
+long long __sn__WidgetAdapter_stepId(__sn__WidgetAdapter *);
+
+
+
+#endif
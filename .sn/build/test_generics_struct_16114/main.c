@@ -0,0 +1,170 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__Stack_int_push(__sn__Stack_int *__sn__self, long long __sn__item) {
+
+    __sn__arr_push(&__sn__self->__sn__items, __sn__item);
+    
+
+    (__sn__self->__sn__size = sn_add_long(__sn__self->__sn__size, 1LL));
+    
+}
+
+long long __sn__Stack_int_pop(__sn__Stack_int *__sn__self) {
+
+    (__sn__self->__sn__size = sn_sub_long(__sn__self->__sn__size, 1LL));
+    
+
+    return *(long long *)__sn___pop(&__sn__self->__sn__items);}
+
+bool __sn__Stack_int_isEmpty(__sn__Stack_int *__sn__self) {
+
+    return (__sn__self->__sn__size == 0LL);}
+
+
+void __sn__Stack_str_push(__sn__Stack_str *__sn__self, char * __sn__item) {
+
+    __sn__arr_push(&__sn__self->__sn__items, strdup(__sn__item));
+    
+
+    (__sn__self->__sn__size = sn_add_long(__sn__self->__sn__size, 1LL));
+    
+}
+
+char * __sn__Stack_str_pop(__sn__Stack_str *__sn__self) {
+
+    (__sn__self->__sn__size = sn_sub_long(__sn__self->__sn__size, 1LL));
+    
+
+    return *(char * *)__sn___pop(&__sn__self->__sn__items);}
+
+bool __sn__Stack_str_isEmpty(__sn__Stack_str *__sn__self) {
+
+    return (__sn__self->__sn__size == 0LL);}
+
+
+
+int main() {
+    sn_auto_Stack_int __sn__Stack_int __sn__si = (__sn__Stack_int){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        }), .__sn__size = 0LL };
+    __sn__Stack_int_push(&__sn__si, 10LL);
+    
+    __sn__Stack_int_push(&__sn__si, 20LL);
+    
+    __sn__Stack_int_push(&__sn__si, 30LL);
+    
+    if ((__sn__si.__sn__size != 3LL)) {
+        sn_print("FAIL: Stack<int> size should be 3\n");
+        
+        return 1LL;}
+    long long __sn__top1 = __sn__Stack_int_pop(&__sn__si);
+    if ((__sn__top1 != 30LL)) {
+        sn_print("FAIL: Stack<int> pop should return 30\n");
+        
+        return 1LL;}
+    long long __sn__top2 = __sn__Stack_int_pop(&__sn__si);
+    if ((__sn__top2 != 20LL)) {
+        sn_print("FAIL: Stack<int> pop should return 20\n");
+        
+        return 1LL;}
+    if (__sn__Stack_int_isEmpty(&__sn__si)) {
+        sn_print("FAIL: Stack<int> should not be empty (1 item left)\n");
+        
+        return 1LL;}
+    __sn__Stack_int_pop(&__sn__si);
+    
+    if ((!__sn__Stack_int_isEmpty(&__sn__si))) {
+        sn_print("FAIL: Stack<int> should be empty after popping all items\n");
+        
+        return 1LL;}
+    sn_print("Test 1 passed: Stack<int>\n");
+    
+    sn_auto_Stack_str __sn__Stack_str __sn__ss = (__sn__Stack_str){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 0);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            __al__;
+        }), .__sn__size = 0LL };
+    __sn__Stack_str_push(&__sn__ss, "hello");
+    
+    __sn__Stack_str_push(&__sn__ss, "world");
+    
+    if ((__sn__ss.__sn__size != 2LL)) {
+        sn_print("FAIL: Stack<str> size should be 2\n");
+        
+        return 1LL;}
+    sn_auto_str char * __sn__tops = __sn__Stack_str_pop(&__sn__ss);
+    if ((strcmp(__sn__tops, "world") != 0)) {
+        sn_print("FAIL: Stack<str> pop should return 'world'\n");
+        
+        return 1LL;}
+    if (__sn__Stack_str_isEmpty(&__sn__ss)) {
+        sn_print("FAIL: Stack<str> should not be empty (1 item left)\n");
+        
+        return 1LL;}
+    sn_print("Test 2 passed: Stack<str>\n");
+    
+    sn_auto_Stack_int __sn__Stack_int __sn__a = (__sn__Stack_int){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        }), .__sn__size = 0LL };
+    sn_auto_Stack_int __sn__Stack_int __sn__b = (__sn__Stack_int){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        }), .__sn__size = 0LL };
+    __sn__Stack_int_push(&__sn__a, 1LL);
+    
+    __sn__Stack_int_push(&__sn__a, 2LL);
+    
+    __sn__Stack_int_push(&__sn__b, 99LL);
+    
+    long long __sn__aTop = __sn__Stack_int_pop(&__sn__a);
+    long long __sn__bTop = __sn__Stack_int_pop(&__sn__b);
+    if ((__sn__aTop != 2LL)) {
+        sn_print("FAIL: a.pop() should return 2\n");
+        
+        return 1LL;}
+    if ((__sn__bTop != 99LL)) {
+        sn_print("FAIL: b.pop() should return 99\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: Two Stack<int> instances are independent\n");
+    
+    sn_auto_Pair_int_str __sn__Pair_int_str __sn__p1 = (__sn__Pair_int_str){ .__sn__first = 42LL, .__sn__second = strdup("answer") };
+    if ((__sn__p1.__sn__first != 42LL)) {
+        sn_print("FAIL: Pair<int,str>.first should be 42\n");
+        
+        return 1LL;}
+    if ((strcmp(__sn__p1.__sn__second, "answer") != 0)) {
+        sn_print("FAIL: Pair<int,str>.second should be 'answer'\n");
+        
+        return 1LL;}
+    sn_print("Test 4 passed: Pair<int, str>\n");
+    
+    sn_auto_Pair_str_bool __sn__Pair_str_bool __sn__p2 = (__sn__Pair_str_bool){ .__sn__first = strdup("active"), .__sn__second = true };
+    if ((strcmp(__sn__p2.__sn__first, "active") != 0)) {
+        sn_print("FAIL: Pair<str,bool>.first should be 'active'\n");
+        
+        return 1LL;}
+    if ((!__sn__p2.__sn__second)) {
+        sn_print("FAIL: Pair<str,bool>.second should be true\n");
+        
+        return 1LL;}
+    sn_print("Test 5 passed: Pair<str, bool>\n");
+    
+    sn_print("All generic struct tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
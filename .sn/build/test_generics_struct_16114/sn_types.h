@@ -0,0 +1,250 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Stack_int (as val) */
+typedef struct {
+    SnArray * __sn__items;
+    long long __sn__size;
+} __sn__Stack_int;
+/* Value operations */
+static inline __sn__Stack_int __sn__Stack_int_copy(const __sn__Stack_int *src) {
+    __sn__Stack_int dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    dst.__sn__size = src->__sn__size;
+    return dst;
+}
+
+static inline void __sn__Stack_int_cleanup(__sn__Stack_int *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_Stack_int __attribute__((cleanup(__sn__Stack_int_cleanup)))
+
+static inline void __sn__Stack_int_cleanup_elem(void *p) { __sn__Stack_int_cleanup((__sn__Stack_int *)p); }
+static inline void __sn__Stack_int_copy_into(const void *src, void *dst) { *(__sn__Stack_int *)dst = __sn__Stack_int_copy((const __sn__Stack_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Stack_int *__sn__Stack_int_alloc(void) {
+    return calloc(1, sizeof(__sn__Stack_int));
+}
+
+static inline void __sn__Stack_int_release(__sn__Stack_int **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Stack_int __attribute__((cleanup(__sn__Stack_int_release)))
+
+static inline void __sn__Stack_int_release_elem(void *p) { __sn__Stack_int_release((__sn__Stack_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Stack_int_to_string(const __sn__Stack_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Stack_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "size: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__size);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Stack_str (as val) */
+typedef struct {
+    SnArray * __sn__items;
+    long long __sn__size;
+} __sn__Stack_str;
+/* Value operations */
+static inline __sn__Stack_str __sn__Stack_str_copy(const __sn__Stack_str *src) {
+    __sn__Stack_str dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    dst.__sn__size = src->__sn__size;
+    return dst;
+}
+
+static inline void __sn__Stack_str_cleanup(__sn__Stack_str *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_Stack_str __attribute__((cleanup(__sn__Stack_str_cleanup)))
+
+static inline void __sn__Stack_str_cleanup_elem(void *p) { __sn__Stack_str_cleanup((__sn__Stack_str *)p); }
+static inline void __sn__Stack_str_copy_into(const void *src, void *dst) { *(__sn__Stack_str *)dst = __sn__Stack_str_copy((const __sn__Stack_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Stack_str *__sn__Stack_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Stack_str));
+}
+
+static inline void __sn__Stack_str_release(__sn__Stack_str **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Stack_str __attribute__((cleanup(__sn__Stack_str_release)))
+
+static inline void __sn__Stack_str_release_elem(void *p) { __sn__Stack_str_release((__sn__Stack_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Stack_str_to_string(const __sn__Stack_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Stack_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "size: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__size);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Pair_int_str (as val) */
+typedef struct {
+    long long __sn__first;
+    char * __sn__second;
+} __sn__Pair_int_str;
+/* Value operations */
+static inline __sn__Pair_int_str __sn__Pair_int_str_copy(const __sn__Pair_int_str *src) {
+    __sn__Pair_int_str dst;
+    dst.__sn__first = src->__sn__first;
+    dst.__sn__second = src->__sn__second ? strdup(src->__sn__second) : NULL;
+    return dst;
+}
+
+static inline void __sn__Pair_int_str_cleanup(__sn__Pair_int_str *p) {
+    free(p->__sn__second);
+
+}
+
+#define sn_auto_Pair_int_str __attribute__((cleanup(__sn__Pair_int_str_cleanup)))
+
+static inline void __sn__Pair_int_str_cleanup_elem(void *p) { __sn__Pair_int_str_cleanup((__sn__Pair_int_str *)p); }
+static inline void __sn__Pair_int_str_copy_into(const void *src, void *dst) { *(__sn__Pair_int_str *)dst = __sn__Pair_int_str_copy((const __sn__Pair_int_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Pair_int_str *__sn__Pair_int_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Pair_int_str));
+}
+
+static inline void __sn__Pair_int_str_release(__sn__Pair_int_str **p) {
+    if (*p) {
+        free((*p)->__sn__second);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Pair_int_str __attribute__((cleanup(__sn__Pair_int_str_release)))
+
+static inline void __sn__Pair_int_str_release_elem(void *p) { __sn__Pair_int_str_release((__sn__Pair_int_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Pair_int_str_to_string(const __sn__Pair_int_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Pair_int_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "first: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__first);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "second: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__second ? p->__sn__second : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Pair_str_bool (as val) */
+typedef struct {
+    char * __sn__first;
+    bool __sn__second;
+} __sn__Pair_str_bool;
+/* Value operations */
+static inline __sn__Pair_str_bool __sn__Pair_str_bool_copy(const __sn__Pair_str_bool *src) {
+    __sn__Pair_str_bool dst;
+    dst.__sn__first = src->__sn__first ? strdup(src->__sn__first) : NULL;
+    dst.__sn__second = src->__sn__second;
+    return dst;
+}
+
+static inline void __sn__Pair_str_bool_cleanup(__sn__Pair_str_bool *p) {
+    free(p->__sn__first);
+
+}
+
+#define sn_auto_Pair_str_bool __attribute__((cleanup(__sn__Pair_str_bool_cleanup)))
+
+static inline void __sn__Pair_str_bool_cleanup_elem(void *p) { __sn__Pair_str_bool_cleanup((__sn__Pair_str_bool *)p); }
+static inline void __sn__Pair_str_bool_copy_into(const void *src, void *dst) { *(__sn__Pair_str_bool *)dst = __sn__Pair_str_bool_copy((const __sn__Pair_str_bool *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Pair_str_bool *__sn__Pair_str_bool_alloc(void) {
+    return calloc(1, sizeof(__sn__Pair_str_bool));
+}
+
+static inline void __sn__Pair_str_bool_release(__sn__Pair_str_bool **p) {
+    if (*p) {
+        free((*p)->__sn__first);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Pair_str_bool __attribute__((cleanup(__sn__Pair_str_bool_release)))
+
+static inline void __sn__Pair_str_bool_release_elem(void *p) { __sn__Pair_str_bool_release((__sn__Pair_str_bool **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Pair_str_bool_to_string(const __sn__Pair_str_bool *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Pair_str_bool { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "first: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__first ? p->__sn__first : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "second: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__second ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+void __sn__Stack_int_push(__sn__Stack_int *, long long);
+long long __sn__Stack_int_pop(__sn__Stack_int *);
+bool __sn__Stack_int_isEmpty(__sn__Stack_int *);
+void __sn__Stack_str_push(__sn__Stack_str *, char *);
+char * __sn__Stack_str_pop(__sn__Stack_str *);
+bool __sn__Stack_str_isEmpty(__sn__Stack_str *);
+
+
+
+#endif
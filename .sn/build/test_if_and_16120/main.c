@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 5LL;
+    if ((sn_gt_long(__sn__x, 0LL) && sn_lt_long(__sn__x, 10LL))) {
+        sn_print("in range\n");
+        
+    } else {
+        sn_print("out of range\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
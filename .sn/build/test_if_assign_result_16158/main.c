@@ -0,0 +1,38 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 10LL;
+    long long __sn__abs_val = 0LL;
+    if ((__sn__x >= 0LL)) {
+        (__sn__abs_val = __sn__x);
+        
+    } else {
+        (__sn__abs_val = (-__sn__x));
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__abs_val));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    (__sn__x = (-7LL));
+    
+    if ((__sn__x >= 0LL)) {
+        (__sn__abs_val = __sn__x);
+        
+    } else {
+        (__sn__abs_val = (-__sn__x));
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__abs_val));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
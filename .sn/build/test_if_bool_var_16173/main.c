@@ -0,0 +1,14 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    bool __sn__flag = true;
+    bool __sn__other = false;
+    if ((__sn__flag && (!__sn__other))) {
+        sn_print("correct\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
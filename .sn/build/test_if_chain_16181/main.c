@@ -0,0 +1,21 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 5LL;
+    if ((__sn__x == 1LL)) {
+        sn_print("one\n");
+        
+    } else {
+        if ((__sn__x == 5LL)) {
+            sn_print("five\n");
+            
+        } else {
+            sn_print("other\n");
+            
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
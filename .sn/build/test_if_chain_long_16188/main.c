@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 3LL;
+    if ((__sn__x == 1LL)) {
+        sn_print("one\n");
+        
+    } else {
+        if ((__sn__x == 2LL)) {
+            sn_print("two\n");
+            
+        } else {
+            if ((__sn__x == 3LL)) {
+                sn_print("three\n");
+                
+            } else {
+                sn_print("other\n");
+                
+            }
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 10LL;
+    if (sn_gt_long(__sn__x, 5LL)) {
+        sn_print("big\n");
+        
+    } else {
+        sn_print("small\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 7LL;
+    if ((((__sn__x == 3LL) || (__sn__x == 5LL)) || (__sn__x == 7LL))) {
+        sn_print("prime\n");
+        
+    } else {
+        sn_print("not prime\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
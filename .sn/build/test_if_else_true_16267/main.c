@@ -0,0 +1,15 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    if (true) {
+        sn_print("true\n");
+        
+    } else {
+        sn_print("false\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
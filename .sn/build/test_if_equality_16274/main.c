@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 42LL;
+    if ((__sn__x == 42LL)) {
+        sn_print("match\n");
+        
+    } else {
+        sn_print("no match\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
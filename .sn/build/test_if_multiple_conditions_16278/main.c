@@ -0,0 +1,15 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = 5LL;
+    long long __sn__b = 10LL;
+    long long __sn__c = 15LL;
+    if ((sn_lt_long(__sn__a, __sn__b) && sn_lt_long(__sn__b, __sn__c))) {
+        sn_print("ascending\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
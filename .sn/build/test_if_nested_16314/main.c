@@ -0,0 +1,21 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 15LL;
+    if (sn_gt_long(__sn__x, 10LL)) {
+        if (sn_gt_long(__sn__x, 20LL)) {
+            sn_print("very big\n");
+            
+        } else {
+            sn_print("medium\n");
+            
+        }
+    } else {
+        sn_print("small\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
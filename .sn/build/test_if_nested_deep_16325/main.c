@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 5LL;
+    if (sn_gt_long(__sn__x, 0LL)) {
+        if (sn_gt_long(__sn__x, 3LL)) {
+            if (sn_gt_long(__sn__x, 4LL)) {
+                sn_print("deep\n");
+                
+            }
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
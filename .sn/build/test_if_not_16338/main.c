@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    bool __sn__flag = false;
+    if ((!__sn__flag)) {
+        sn_print("not set\n");
+        
+    } else {
+        sn_print("set\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 15LL;
+    if ((sn_lt_long(__sn__x, 5LL) || sn_gt_long(__sn__x, 10LL))) {
+        sn_print("outside\n");
+        
+    } else {
+        sn_print("inside\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__classify(long long __sn__n) {
+
+    if (sn_lt_long(__sn__n, 10LL)) {
+        return 1LL;} else {
+        if (sn_lt_long(__sn__n, 20LL)) {
+            return 2LL;} else {
+            return 3LL;}
+    }
+}
+
+int main() {
+    long long __sn__x = __sn__classify(5LL);
+    long long __sn__y = __sn__classify(15LL);
+    long long __sn__z = __sn__classify(25LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__y));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)(__sn__z));
+            sn_auto_str char *__is_p5__ = sn_strdup("\n");
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__s = strdup("hello");
+    if ((strcmp(__sn__s, "hello") == 0)) {
+        sn_print("match\n");
+        
+    }
+    if ((strcmp(__sn__s, "world") != 0)) {
+        sn_print("different\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
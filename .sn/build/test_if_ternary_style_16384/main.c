@@ -0,0 +1,33 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 10LL;
+    sn_auto_str char * __sn__label = strdup("");
+    if (sn_gt_long(__sn__x, 5LL)) {
+        ({
+            char *__sn_tmp__ = strdup("big");
+            free(__sn__label);
+            __sn__label = __sn_tmp__;
+            __sn__label;
+        });
+        
+    } else {
+        ({
+            char *__sn_tmp__ = strdup("small");
+            free(__sn__label);
+            __sn__label = __sn_tmp__;
+            __sn__label;
+        });
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__label);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,14 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    if (true) {
+        sn_print("yes\n");
+        
+    }
+    sn_print("done\n");
+    
+    fflush(stdout);
+    return 0;
+}
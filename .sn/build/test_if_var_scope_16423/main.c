@@ -0,0 +1,24 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 10LL;
+    if (sn_gt_long(__sn__x, 5LL)) {
+        long long __sn__y = sn_mul_long(__sn__x, 2LL);
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__y));
+                sn_auto_str char *__is_p1__ = sn_strdup("\n");
+                sn_str_concat_multi(2, __is_p0__, __is_p1__);
+            }); sn_print(__ps__); };
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
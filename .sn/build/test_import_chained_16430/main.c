@@ -0,0 +1,131 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("=== Chained Import Test ===\n\n");
+    
+    sn_print("Test 1: Transitive import - Vector2D from vector2d\n");
+    
+    __sn__Vector2D __sn__v1 = __sn__Vector2D_unit_x();
+    __sn__Vector2D __sn__v2 = __sn__Vector2D_unit_y();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  v1 = (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__v1.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__v1.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  v2 = (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__v2.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__v2.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  v1.dot(v2) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Vector2D_dot(&__sn__v1, __sn__v2)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 2: Functions from transitive import\n");
+    
+    __sn__Vector2D __sn__v3 = __sn__vec_add(__sn__v1, __sn__v2);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  v1 + v2 = (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__v3.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__v3.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    __sn__Vector2D __sn__v4 = __sn__vec_scale(__sn__v3, 3LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  (v1 + v2) * 3 = (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__v4.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__v4.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 3: Particle struct (uses Vector2D fields)\n");
+    
+    __sn__Vector2D __sn__pos = (__sn__Vector2D){ .__sn__x = 10LL, .__sn__y = 20LL };
+    __sn__Particle __sn__p = __sn__Particle_at_rest(__sn__pos, 5LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Position: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__position.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__position.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Velocity: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__velocity.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__velocity.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Mass: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__mass));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 4: Particle with velocity\n");
+    
+    __sn__Vector2D __sn__vel = __sn__make_velocity(3LL, 4LL);
+    __sn__Particle __sn__moving = (__sn__Particle){ .__sn__position = __sn__pos, .__sn__velocity = __sn__vel, .__sn__mass = 2LL };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Velocity: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__moving.__sn__velocity.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__moving.__sn__velocity.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Velocity^2: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Vector2D_magnitude_squared(&__sn__moving.__sn__velocity)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Kinetic energy: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Particle_kinetic_energy(&__sn__moving)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 5: Move particle function\n");
+    
+    __sn__Particle __sn__moved = __sn__move_particle(__sn__moving, 2LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  After dt=2: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__moved.__sn__position.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__moved.__sn__position.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\n=== All Chained Import Tests PASSED ===\n");
+    
+    fflush(stdout);
+    return 0;
+}
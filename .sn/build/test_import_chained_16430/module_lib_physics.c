@@ -0,0 +1,33 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Particle __sn__move_particle(__sn__Particle __sn__p, long long __sn__dt) {
+
+    __sn__Vector2D __sn__delta = __sn__vec_scale(__sn__p.__sn__velocity, __sn__dt);
+
+    __sn__Vector2D __sn__new_pos = __sn__vec_add(__sn__p.__sn__position, __sn__delta);
+
+    return (__sn__Particle){ .__sn__position = __sn__new_pos, .__sn__velocity = __sn__p.__sn__velocity, .__sn__mass = __sn__p.__sn__mass };}
+
+
+__sn__Vector2D __sn__make_velocity(long long __sn__vx, long long __sn__vy) {
+
+    return (__sn__Vector2D){ .__sn__x = __sn__vx, .__sn__y = __sn__vy };}
+
+
+long long __sn__Particle_kinetic_energy(__sn__Particle *__sn__self) {
+
+    long long __sn__v_squared = __sn__Vector2D_magnitude_squared(&__sn__self->__sn__velocity);
+
+    return sn_div_long(sn_mul_long(__sn__self->__sn__mass, __sn__v_squared), 2LL);}
+
+long long __sn__Particle_momentum_magnitude(__sn__Particle *__sn__self) {
+
+    return sn_mul_long(__sn__self->__sn__mass, __sn__Vector2D_magnitude_squared(&__sn__self->__sn__velocity));}
+
+__sn__Particle __sn__Particle_at_rest(__sn__Vector2D __sn__pos, long long __sn__m) {
+
+    return (__sn__Particle){ .__sn__position = __sn__pos, .__sn__velocity = __sn__Vector2D_zero(), .__sn__mass = __sn__m };}
+
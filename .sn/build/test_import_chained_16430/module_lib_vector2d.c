@@ -0,0 +1,35 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Vector2D __sn__vec_add(__sn__Vector2D __sn__a, __sn__Vector2D __sn__b) {
+
+    return (__sn__Vector2D){ .__sn__x = sn_add_long(__sn__a.__sn__x, __sn__b.__sn__x), .__sn__y = sn_add_long(__sn__a.__sn__y, __sn__b.__sn__y) };}
+
+
+__sn__Vector2D __sn__vec_scale(__sn__Vector2D __sn__v, long long __sn__s) {
+
+    return (__sn__Vector2D){ .__sn__x = sn_mul_long(__sn__v.__sn__x, __sn__s), .__sn__y = sn_mul_long(__sn__v.__sn__y, __sn__s) };}
+
+
+long long __sn__Vector2D_magnitude_squared(__sn__Vector2D *__sn__self) {
+
+    return sn_add_long(sn_mul_long(__sn__self->__sn__x, __sn__self->__sn__x), sn_mul_long(__sn__self->__sn__y, __sn__self->__sn__y));}
+
+long long __sn__Vector2D_dot(__sn__Vector2D *__sn__self, __sn__Vector2D __sn__other) {
+
+    return sn_add_long(sn_mul_long(__sn__self->__sn__x, __sn__other.__sn__x), sn_mul_long(__sn__self->__sn__y, __sn__other.__sn__y));}
+
+__sn__Vector2D __sn__Vector2D_zero() {
+
+    return (__sn__Vector2D){ .__sn__x = 0LL, .__sn__y = 0LL };}
+
+__sn__Vector2D __sn__Vector2D_unit_x() {
+
+    return (__sn__Vector2D){ .__sn__x = 1LL, .__sn__y = 0LL };}
+
+__sn__Vector2D __sn__Vector2D_unit_y() {
+
+    return (__sn__Vector2D){ .__sn__x = 0LL, .__sn__y = 1LL };}
+
@@ -0,0 +1,147 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Vector2D (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Vector2D;
+/* Value operations */
+static inline __sn__Vector2D __sn__Vector2D_copy(const __sn__Vector2D *src) {
+    __sn__Vector2D dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Vector2D_cleanup(__sn__Vector2D *p) {
+
+}
+
+#define sn_auto_Vector2D __attribute__((cleanup(__sn__Vector2D_cleanup)))
+
+static inline void __sn__Vector2D_cleanup_elem(void *p) { __sn__Vector2D_cleanup((__sn__Vector2D *)p); }
+static inline void __sn__Vector2D_copy_into(const void *src, void *dst) { *(__sn__Vector2D *)dst = __sn__Vector2D_copy((const __sn__Vector2D *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Vector2D *__sn__Vector2D_alloc(void) {
+    return calloc(1, sizeof(__sn__Vector2D));
+}
+
+static inline void __sn__Vector2D_release(__sn__Vector2D **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Vector2D __attribute__((cleanup(__sn__Vector2D_release)))
+
+static inline void __sn__Vector2D_release_elem(void *p) { __sn__Vector2D_release((__sn__Vector2D **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Vector2D_to_string(const __sn__Vector2D *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Vector2D { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Particle (as val) */
+typedef struct {
+    __sn__Vector2D __sn__position;
+    __sn__Vector2D __sn__velocity;
+    long long __sn__mass;
+} __sn__Particle;
+/* Value operations */
+static inline __sn__Particle __sn__Particle_copy(const __sn__Particle *src) {
+    __sn__Particle dst;
+    dst.__sn__position = __sn__Vector2D_copy(&src->__sn__position);
+    dst.__sn__velocity = __sn__Vector2D_copy(&src->__sn__velocity);
+    dst.__sn__mass = src->__sn__mass;
+    return dst;
+}
+
+static inline void __sn__Particle_cleanup(__sn__Particle *p) {
+
+}
+
+#define sn_auto_Particle __attribute__((cleanup(__sn__Particle_cleanup)))
+
+static inline void __sn__Particle_cleanup_elem(void *p) { __sn__Particle_cleanup((__sn__Particle *)p); }
+static inline void __sn__Particle_copy_into(const void *src, void *dst) { *(__sn__Particle *)dst = __sn__Particle_copy((const __sn__Particle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Particle *__sn__Particle_alloc(void) {
+    return calloc(1, sizeof(__sn__Particle));
+}
+
+static inline void __sn__Particle_release(__sn__Particle **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Particle __attribute__((cleanup(__sn__Particle_release)))
+
+static inline void __sn__Particle_release_elem(void *p) { __sn__Particle_release((__sn__Particle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Particle_to_string(const __sn__Particle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Particle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "position: ");
+    { char *__fs__ = __sn__Vector2D_to_string(&p->__sn__position); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "velocity: ");
+    { char *__fs__ = __sn__Vector2D_to_string(&p->__sn__velocity); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "mass: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__mass);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Vector2D __sn__vec_add(__sn__Vector2D, __sn__Vector2D);
+__sn__Vector2D __sn__vec_scale(__sn__Vector2D, long long);
+__sn__Particle __sn__move_particle(__sn__Particle, long long);
+__sn__Vector2D __sn__make_velocity(long long, long long);
+
+long long __sn__Vector2D_magnitude_squared(__sn__Vector2D *);
+long long __sn__Vector2D_dot(__sn__Vector2D *, __sn__Vector2D);
+__sn__Vector2D __sn__Vector2D_zero();
+__sn__Vector2D __sn__Vector2D_unit_x();
+__sn__Vector2D __sn__Vector2D_unit_y();
+long long __sn__Particle_kinetic_energy(__sn__Particle *);
+long long __sn__Particle_momentum_magnitude(__sn__Particle *);
+__sn__Particle __sn__Particle_at_rest(__sn__Vector2D, long long);
+
+
+
+#endif
@@ -0,0 +1,15 @@
+#include "sn_types.h"
+
+long long __sn__DIAMOND_BASE_VALUE = 42LL;
+
+
+
+long long __sn__diamondBaseFunc(long long __sn__x) {
+
+    return sn_add_long(__sn__x, __sn__DIAMOND_BASE_VALUE);}
+
+
+__sn__DiamondBase __sn__DiamondBase_new() {
+
+    return (__sn__DiamondBase){ .__sn__value = __sn__DIAMOND_BASE_VALUE };}
+
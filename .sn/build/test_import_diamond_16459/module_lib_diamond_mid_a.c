@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__midAFunc(long long __sn__x) {
+
+    return sn_mul_long(__sn__diamondBaseFunc(__sn__x), 2LL);}
+
+
+long long __sn__getMidAValue() {
+
+    __sn__DiamondBase __sn__base = __sn__DiamondBase_new();
+
+    return sn_add_long(__sn__base.__sn__value, 100LL);}
+
@@ -0,0 +1,79 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: DiamondBase (as val) */
+typedef struct {
+    long long __sn__value;
+} __sn__DiamondBase;
+/* Value operations */
+static inline __sn__DiamondBase __sn__DiamondBase_copy(const __sn__DiamondBase *src) {
+    __sn__DiamondBase dst;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__DiamondBase_cleanup(__sn__DiamondBase *p) {
+
+}
+
+#define sn_auto_DiamondBase __attribute__((cleanup(__sn__DiamondBase_cleanup)))
+
+static inline void __sn__DiamondBase_cleanup_elem(void *p) { __sn__DiamondBase_cleanup((__sn__DiamondBase *)p); }
+static inline void __sn__DiamondBase_copy_into(const void *src, void *dst) { *(__sn__DiamondBase *)dst = __sn__DiamondBase_copy((const __sn__DiamondBase *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__DiamondBase *__sn__DiamondBase_alloc(void) {
+    return calloc(1, sizeof(__sn__DiamondBase));
+}
+
+static inline void __sn__DiamondBase_release(__sn__DiamondBase **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_DiamondBase __attribute__((cleanup(__sn__DiamondBase_release)))
+
+static inline void __sn__DiamondBase_release_elem(void *p) { __sn__DiamondBase_release((__sn__DiamondBase **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__DiamondBase_to_string(const __sn__DiamondBase *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "DiamondBase { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+extern long long __sn__DIAMOND_BASE_VALUE;
+
+long long __sn__diamondBaseFunc(long long);
+long long __sn__midAFunc(long long);
+long long __sn__getMidAValue();
+long long __sn__midBFunc(long long);
+long long __sn__getMidBValue();
+
+__sn__DiamondBase __sn__DiamondBase_new();
+
+
+
+#endif
@@ -0,0 +1,10 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    { sn_auto_str char *__ps__ = __sn__greet("World"); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__customHandler(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 3LL);}
+
+long long __fn_wrap_0__(void *__closure__, long long __p0__) {
+    (void)__closure__;
+    return __sn__defaultHandler(__p0__);
+ }
+long long __fn_wrap_1__(void *__closure__, long long __p0__) {
+    (void)__closure__;
+    return __sn__alternateHandler(__p0__);
+ }
+long long __fn_wrap_2__(void *__closure__, long long __p0__) {
+    (void)__closure__;
+    return __sn__customHandler(__p0__);
+ }
+int main() {
+    sn_print("Creating processor with default handler\n");
+    
+    sn_auto_Processor __sn__Processor __sn__proc = __sn__Processor_new();
+    sn_print("Processing with default handler\n");
+    
+    long long __sn__result1 = __sn__Processor_process(&__sn__proc, 5LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Default: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result1));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("Creating processor with alternate handler\n");
+    
+    sn_auto_Processor __sn__Processor __sn__proc2 = __sn__createWithHandler(({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_1__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }));
+    long long __sn__result2 = __sn__Processor_process(&__sn__proc2, 5LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Alternate: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result2));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("Creating processor with custom handler\n");
+    
+    sn_auto_Processor __sn__Processor __sn__proc3 = __sn__createWithHandler(({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_2__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }));
+    long long __sn__result3 = __sn__Processor_process(&__sn__proc3, 5LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Custom: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result3));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("All tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__defaultHandler(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 2LL);}
+
+
+long long __sn__alternateHandler(long long __sn__x) {
+
+    return sn_add_long(__sn__x, 10LL);}
+
+
+__sn__Processor __sn__createWithHandler(void * __sn__h) {
+
+    return (__sn__Processor){ .__sn__handler = __sn__h };}
+
+
+__sn__Processor __sn__Processor_new() {
+
+    return (__sn__Processor){ .__sn__handler = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_0__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }) };}
+
+long long __sn__Processor_process(__sn__Processor *__sn__self, long long __sn__value) {
+
+    return ((long long (*)(void *, long long))((__Closure__ *)(__sn__self->__sn__handler))->fn)(__sn__self->__sn__handler, __sn__value);}
+
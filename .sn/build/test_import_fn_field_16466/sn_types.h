@@ -0,0 +1,83 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Processor (as val) */
+typedef struct {
+    void * __sn__handler;
+} __sn__Processor;
+/* Value operations */
+static inline __sn__Processor __sn__Processor_copy(const __sn__Processor *src) {
+    __sn__Processor dst;
+    dst.__sn__handler = sn_closure_retain(src->__sn__handler);
+    return dst;
+}
+
+static inline void __sn__Processor_cleanup(__sn__Processor *p) {
+    sn_closure_release((void **)&p->__sn__handler);
+
+}
+
+#define sn_auto_Processor __attribute__((cleanup(__sn__Processor_cleanup)))
+
+static inline void __sn__Processor_cleanup_elem(void *p) { __sn__Processor_cleanup((__sn__Processor *)p); }
+static inline void __sn__Processor_copy_into(const void *src, void *dst) { *(__sn__Processor *)dst = __sn__Processor_copy((const __sn__Processor *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Processor *__sn__Processor_alloc(void) {
+    return calloc(1, sizeof(__sn__Processor));
+}
+
+static inline void __sn__Processor_release(__sn__Processor **p) {
+    if (*p) {
+        sn_closure_release((void **)&(*p)->__sn__handler);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Processor __attribute__((cleanup(__sn__Processor_release)))
+
+static inline void __sn__Processor_release_elem(void *p) { __sn__Processor_release((__sn__Processor **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Processor_to_string(const __sn__Processor *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Processor { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "handler: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__handler);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+long long __sn__defaultHandler(long long);
+long long __sn__alternateHandler(long long);
+__sn__Processor __sn__createWithHandler(void *);
+long long __sn__customHandler(long long);
+
+__sn__Processor __sn__Processor_new();
+long long __sn__Processor_process(__sn__Processor *, long long);
+
+
+long long __fn_wrap_0__(void *__closure__, long long __p0__);
+long long __fn_wrap_1__(void *__closure__, long long __p0__);
+long long __fn_wrap_2__(void *__closure__, long long __p0__);
+
+#endif
@@ -0,0 +1,70 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Response __sn__homeHandler(__sn__Request *__sn__req) {
+
+    sn_auto_Response __sn__Response __sn____chain_tmp_1 = __sn__Response_ok();
+
+    return __sn__Response_text(&__sn____chain_tmp_1, "Home");}
+
+__sn__Response __fn_wrap_0__(void *__closure__, __sn__Request * __p0__) {
+    (void)__closure__;
+    return __sn__defaultNotFoundHandler(__p0__);
+ }
+__sn__Response __fn_wrap_1__(void *__closure__, __sn__Request * __p0__) {
+    (void)__closure__;
+    return __sn__homeHandler(__p0__);
+ }
+int main() {
+    sn_print("Creating router\n");
+    
+    sn_auto_Router __sn__Router __sn__router = __sn__Router_new();
+    sn_print("Adding route\n");
+    
+    { __sn__Router __discard__ = __sn__Router_addRoute(&__sn__router, "/", ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_1__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; })); __sn__Router_cleanup(&__discard__); }
+    
+    sn_print("Creating request\n");
+    
+    sn_auto_Request __sn__Request __sn__req = __sn__Request_new("GET", "/");
+    sn_print("Handling request\n");
+    
+    sn_auto_Response __sn__Response __sn__res = __sn__Router_handle(&__sn__router, &__sn__req);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Status: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__res.__sn__status));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Body: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__res.__sn__body);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("Testing not found\n");
+    
+    sn_auto_Request __sn__Request __sn__req2 = __sn__Request_new("GET", "/nonexistent");
+    sn_auto_Response __sn__Response __sn__res2 = __sn__Router_handle(&__sn__router, &__sn__req2);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Status: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__res2.__sn__status));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Body: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__res2.__sn__body);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("All tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
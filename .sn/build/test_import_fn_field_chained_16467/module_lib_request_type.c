@@ -0,0 +1,9 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Request __sn__Request_new(char * __sn__method, char * __sn__path) {
+
+    return (__sn__Request){ .__sn__method = strdup(__sn__method), .__sn__path = strdup(__sn__path) };}
+
@@ -0,0 +1,29 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Response __sn__Response_new(long long __sn__status) {
+
+    return (__sn__Response){ .__sn__status = __sn__status, .__sn__body = strdup("") };}
+
+__sn__Response __sn__Response_ok() {
+
+    return __sn__Response_new(200LL);}
+
+__sn__Response __sn__Response_notFound() {
+
+    return __sn__Response_new(404LL);}
+
+__sn__Response __sn__Response_text(__sn__Response *__sn__self, char * __sn__content) {
+
+    ({
+        char *__ma_str_tmp__ = strdup(__sn__content);
+        free(__sn__self->__sn__body);
+        __sn__self->__sn__body = __ma_str_tmp__;
+        __sn__self->__sn__body;
+    });
+    
+
+    return __sn__Response_copy(__sn__self);}
+
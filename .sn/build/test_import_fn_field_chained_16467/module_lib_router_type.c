@@ -0,0 +1,47 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Response __sn__defaultNotFoundHandler(__sn__Request *__sn__req) {
+
+    sn_auto_Response __sn__Response __sn____chain_tmp_0 = __sn__Response_notFound();
+
+    return __sn__Response_text(&__sn____chain_tmp_0, "Not Found");}
+
+
+
+__sn__Router __sn__Router_new() {
+
+    return (__sn__Router){ .__sn__routes = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Route), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Route_cleanup_elem;
+            __al__->elem_copy = __sn__Route_copy_into;
+            __al__;
+        }), .__sn__notFoundHandler = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_0__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }) };}
+
+__sn__Router __sn__Router_addRoute(__sn__Router *__sn__self, char * __sn__pattern, void * __sn__handler) {
+
+    __sn__arr_push(&__sn__self->__sn__routes, (__sn__Route){ .__sn__pattern = strdup(__sn__pattern), .__sn__handler = __sn__handler });
+    
+
+    return __sn__Router_copy(__sn__self);}
+
+__sn__Response __sn__Router_handle(__sn__Router *__sn__self, __sn__Request *__sn__req) {
+
+    {
+        SnArray *__arr_0__ = __sn__self->__sn__routes;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            __sn__Route __sn__route = ((__sn__Route *)__arr_0__->data)[__idx_0__];
+            {
+                if ((strcmp(__sn__route.__sn__pattern, (*__sn__req).__sn__path) == 0)) {
+                    return ((__sn__Response (*)(void *, __sn__Request *))((__Closure__ *)(__sn__route.__sn__handler))->fn)(__sn__route.__sn__handler, &(*__sn__req));}
+            }
+        }
+    }
+
+    return ((__sn__Response (*)(void *, __sn__Request *))((__Closure__ *)(__sn__self->__sn__notFoundHandler))->fn)(__sn__self->__sn__notFoundHandler, &(*__sn__req));}
+
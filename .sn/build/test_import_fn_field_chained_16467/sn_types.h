@@ -0,0 +1,262 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Request (as val) */
+typedef struct {
+    char * __sn__path;
+    char * __sn__method;
+} __sn__Request;
+/* Value operations */
+static inline __sn__Request __sn__Request_copy(const __sn__Request *src) {
+    __sn__Request dst;
+    dst.__sn__path = src->__sn__path ? strdup(src->__sn__path) : NULL;
+    dst.__sn__method = src->__sn__method ? strdup(src->__sn__method) : NULL;
+    return dst;
+}
+
+static inline void __sn__Request_cleanup(__sn__Request *p) {
+    free(p->__sn__path);
+    free(p->__sn__method);
+
+}
+
+#define sn_auto_Request __attribute__((cleanup(__sn__Request_cleanup)))
+
+static inline void __sn__Request_cleanup_elem(void *p) { __sn__Request_cleanup((__sn__Request *)p); }
+static inline void __sn__Request_copy_into(const void *src, void *dst) { *(__sn__Request *)dst = __sn__Request_copy((const __sn__Request *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Request *__sn__Request_alloc(void) {
+    return calloc(1, sizeof(__sn__Request));
+}
+
+static inline void __sn__Request_release(__sn__Request **p) {
+    if (*p) {
+        free((*p)->__sn__path);
+        free((*p)->__sn__method);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Request __attribute__((cleanup(__sn__Request_release)))
+
+static inline void __sn__Request_release_elem(void *p) { __sn__Request_release((__sn__Request **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Request_to_string(const __sn__Request *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Request { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "path: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__path ? p->__sn__path : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "method: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__method ? p->__sn__method : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Response (as val) */
+typedef struct {
+    long long __sn__status;
+    char * __sn__body;
+} __sn__Response;
+/* Value operations */
+static inline __sn__Response __sn__Response_copy(const __sn__Response *src) {
+    __sn__Response dst;
+    dst.__sn__status = src->__sn__status;
+    dst.__sn__body = src->__sn__body ? strdup(src->__sn__body) : NULL;
+    return dst;
+}
+
+static inline void __sn__Response_cleanup(__sn__Response *p) {
+    free(p->__sn__body);
+
+}
+
+#define sn_auto_Response __attribute__((cleanup(__sn__Response_cleanup)))
+
+static inline void __sn__Response_cleanup_elem(void *p) { __sn__Response_cleanup((__sn__Response *)p); }
+static inline void __sn__Response_copy_into(const void *src, void *dst) { *(__sn__Response *)dst = __sn__Response_copy((const __sn__Response *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Response *__sn__Response_alloc(void) {
+    return calloc(1, sizeof(__sn__Response));
+}
+
+static inline void __sn__Response_release(__sn__Response **p) {
+    if (*p) {
+        free((*p)->__sn__body);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Response __attribute__((cleanup(__sn__Response_release)))
+
+static inline void __sn__Response_release_elem(void *p) { __sn__Response_release((__sn__Response **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Response_to_string(const __sn__Response *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Response { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "status: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__status);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "body: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__body ? p->__sn__body : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Route (as val) */
+typedef struct {
+    char * __sn__pattern;
+    void * __sn__handler;
+} __sn__Route;
+/* Value operations */
+static inline __sn__Route __sn__Route_copy(const __sn__Route *src) {
+    __sn__Route dst;
+    dst.__sn__pattern = src->__sn__pattern ? strdup(src->__sn__pattern) : NULL;
+    dst.__sn__handler = sn_closure_retain(src->__sn__handler);
+    return dst;
+}
+
+static inline void __sn__Route_cleanup(__sn__Route *p) {
+    free(p->__sn__pattern);
+    sn_closure_release((void **)&p->__sn__handler);
+
+}
+
+#define sn_auto_Route __attribute__((cleanup(__sn__Route_cleanup)))
+
+static inline void __sn__Route_cleanup_elem(void *p) { __sn__Route_cleanup((__sn__Route *)p); }
+static inline void __sn__Route_copy_into(const void *src, void *dst) { *(__sn__Route *)dst = __sn__Route_copy((const __sn__Route *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Route *__sn__Route_alloc(void) {
+    return calloc(1, sizeof(__sn__Route));
+}
+
+static inline void __sn__Route_release(__sn__Route **p) {
+    if (*p) {
+        free((*p)->__sn__pattern);
+        sn_closure_release((void **)&(*p)->__sn__handler);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Route __attribute__((cleanup(__sn__Route_release)))
+
+static inline void __sn__Route_release_elem(void *p) { __sn__Route_release((__sn__Route **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Route_to_string(const __sn__Route *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Route { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "pattern: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__pattern ? p->__sn__pattern : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "handler: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__handler);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Router (as val) */
+typedef struct {
+    SnArray * __sn__routes;
+    void * __sn__notFoundHandler;
+} __sn__Router;
+/* Value operations */
+static inline __sn__Router __sn__Router_copy(const __sn__Router *src) {
+    __sn__Router dst;
+    dst.__sn__routes = sn_array_copy(src->__sn__routes);
+    dst.__sn__notFoundHandler = sn_closure_retain(src->__sn__notFoundHandler);
+    return dst;
+}
+
+static inline void __sn__Router_cleanup(__sn__Router *p) {
+    sn_cleanup_array(&p->__sn__routes);
+    sn_closure_release((void **)&p->__sn__notFoundHandler);
+
+}
+
+#define sn_auto_Router __attribute__((cleanup(__sn__Router_cleanup)))
+
+static inline void __sn__Router_cleanup_elem(void *p) { __sn__Router_cleanup((__sn__Router *)p); }
+static inline void __sn__Router_copy_into(const void *src, void *dst) { *(__sn__Router *)dst = __sn__Router_copy((const __sn__Router *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Router *__sn__Router_alloc(void) {
+    return calloc(1, sizeof(__sn__Router));
+}
+
+static inline void __sn__Router_release(__sn__Router **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__routes);
+        sn_closure_release((void **)&(*p)->__sn__notFoundHandler);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Router __attribute__((cleanup(__sn__Router_release)))
+
+static inline void __sn__Router_release_elem(void *p) { __sn__Router_release((__sn__Router **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Router_to_string(const __sn__Router *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Router { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "routes: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__routes); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "notFoundHandler: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__notFoundHandler);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Response __sn__defaultNotFoundHandler(__sn__Request *);
+__sn__Response __sn__homeHandler(__sn__Request *);
+
+__sn__Request __sn__Request_new(char *, char *);
+__sn__Response __sn__Response_new(long long);
+__sn__Response __sn__Response_ok();
+__sn__Response __sn__Response_notFound();
+__sn__Response __sn__Response_text(__sn__Response *, char *);
+__sn__Router __sn__Router_new();
+__sn__Router __sn__Router_addRoute(__sn__Router *, char *, void *);
+__sn__Response __sn__Router_handle(__sn__Router *, __sn__Request *);
+
+
+__sn__Response __fn_wrap_0__(void *__closure__, __sn__Request * __p0__);
+__sn__Response __fn_wrap_1__(void *__closure__, __sn__Request * __p0__);
+
+#endif
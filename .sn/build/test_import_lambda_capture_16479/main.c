@@ -0,0 +1,32 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_fn void * __sn__over10 = __sn__makeChecker(10LL);
+    sn_auto_fn void * __sn__over50 = __sn__makeChecker(50LL);
+    if (((bool (*)(void *, long long))((__Closure__ *)__sn__over10)->fn)(__sn__over10, 42LL)) {
+        sn_print("over10(42)=true\n");
+        
+    } else {
+        sn_print("over10(42)=false\n");
+        
+    }
+    if (((bool (*)(void *, long long))((__Closure__ *)__sn__over50)->fn)(__sn__over50, 42LL)) {
+        sn_print("over50(42)=true\n");
+        
+    } else {
+        sn_print("over50(42)=false\n");
+        
+    }
+    sn_auto_fn void * __sn__add5 = __sn__makeAdder(5LL);
+    long long __sn__r = ((long long (*)(void *, long long))((__Closure__ *)__sn__add5)->fn)(__sn__add5, 10LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("add5(10)=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,42 @@
+#include "sn_types.h"
+
+
+
+
+void * __sn__makeChecker(long long __sn__threshold) {
+
+    return ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->threshold = __sn__threshold;
+        __cl__;
+    });}
+
+
+void * __sn__makeAdder(long long __sn__delta) {
+
+    return ({
+        __closure_1__ *__cl__ = malloc(sizeof(__closure_1__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__closure_1__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->delta = __sn__delta;
+        __cl__;
+    });}
+
+
+static bool __lambda_0__(void *__closure__, long long __sn__x) {
+
+    long long __sn__threshold = ((__closure_0__ *)__closure__)->threshold;
+    return sn_gt_long(__sn__x, __sn__threshold);
+}
+
+static long long __lambda_1__(void *__closure__, long long __sn__x) {
+
+    long long __sn__delta = ((__closure_1__ *)__closure__)->delta;
+    return sn_add_long(__sn__x, __sn__delta);
+}
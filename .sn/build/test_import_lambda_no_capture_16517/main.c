@@ -0,0 +1,25 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_fn void * __sn__t = __sn__alwaysTrue();
+    sn_auto_fn void * __sn__f = __sn__alwaysFalse();
+    if (((bool (*)(void *, long long))((__Closure__ *)__sn__t)->fn)(__sn__t, 42LL)) {
+        sn_print("t(42)=true\n");
+        
+    } else {
+        sn_print("t(42)=false\n");
+        
+    }
+    if (((bool (*)(void *, long long))((__Closure__ *)__sn__f)->fn)(__sn__f, 42LL)) {
+        sn_print("f(42)=true\n");
+        
+    } else {
+        sn_print("f(42)=false\n");
+        
+    }
+    sn_print("ok\n");
+    
+    return 0LL;    fflush(stdout);
+}
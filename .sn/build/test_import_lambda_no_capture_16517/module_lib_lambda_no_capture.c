@@ -0,0 +1,36 @@
+#include "sn_types.h"
+
+
+
+
+void * __sn__alwaysTrue() {
+
+    return ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });}
+
+
+void * __sn__alwaysFalse() {
+
+    return ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });}
+
+
+static bool __lambda_0__(void *__closure__, long long __sn__x) {
+    return true;
+}
+
+static bool __lambda_1__(void *__closure__, long long __sn__x) {
+    return false;
+}
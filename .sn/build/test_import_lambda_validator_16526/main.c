@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_Validator __sn__Validator __sn__pos = __sn__positiveValidator();
+    if (((bool (*)(void *, long long))((__Closure__ *)(__sn__pos.__sn__check))->fn)(__sn__pos.__sn__check, 5LL)) {
+        sn_print("pos.check(5)=true\n");
+        
+    } else {
+        sn_print("pos.check(5)=false\n");
+        
+    }
+    if (((bool (*)(void *, long long))((__Closure__ *)(__sn__pos.__sn__check))->fn)(__sn__pos.__sn__check, 0LL)) {
+        sn_print("pos.check(0)=true\n");
+        
+    } else {
+        sn_print("pos.check(0)=false\n");
+        
+    }
+    sn_auto_Validator __sn__Validator __sn__tv = __sn__thresholdValidator(10LL);
+    if (((bool (*)(void *, long long))((__Closure__ *)(__sn__tv.__sn__check))->fn)(__sn__tv.__sn__check, 10LL)) {
+        sn_print("tv.check(10)=true\n");
+        
+    } else {
+        sn_print("tv.check(10)=false\n");
+        
+    }
+    if (((bool (*)(void *, long long))((__Closure__ *)(__sn__tv.__sn__check))->fn)(__sn__tv.__sn__check, 9LL)) {
+        sn_print("tv.check(9)=true\n");
+        
+    } else {
+        sn_print("tv.check(9)=false\n");
+        
+    }
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,40 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Validator __sn__positiveValidator() {
+
+    return (__sn__Validator){ .__sn__check = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }) };}
+
+
+__sn__Validator __sn__thresholdValidator(long long __sn__threshold) {
+
+    return (__sn__Validator){ .__sn__check = ({
+        __closure_1__ *__cl__ = malloc(sizeof(__closure_1__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__closure_1__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->threshold = __sn__threshold;
+        __cl__;
+    }) };}
+
+
+
+static bool __lambda_0__(void *__closure__, long long __sn__x) {
+    return sn_gt_long(__sn__x, 0LL);
+}
+
+static bool __lambda_1__(void *__closure__, long long __sn__x) {
+
+    long long __sn__threshold = ((__closure_1__ *)__closure__)->threshold;
+    return (__sn__x >= __sn__threshold);
+}
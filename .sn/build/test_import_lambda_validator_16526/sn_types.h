@@ -0,0 +1,85 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Validator (as val) */
+typedef struct {
+    void * __sn__check;
+} __sn__Validator;
+/* Value operations */
+static inline __sn__Validator __sn__Validator_copy(const __sn__Validator *src) {
+    __sn__Validator dst;
+    dst.__sn__check = sn_closure_retain(src->__sn__check);
+    return dst;
+}
+
+static inline void __sn__Validator_cleanup(__sn__Validator *p) {
+    sn_closure_release((void **)&p->__sn__check);
+
+}
+
+#define sn_auto_Validator __attribute__((cleanup(__sn__Validator_cleanup)))
+
+static inline void __sn__Validator_cleanup_elem(void *p) { __sn__Validator_cleanup((__sn__Validator *)p); }
+static inline void __sn__Validator_copy_into(const void *src, void *dst) { *(__sn__Validator *)dst = __sn__Validator_copy((const __sn__Validator *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Validator *__sn__Validator_alloc(void) {
+    return calloc(1, sizeof(__sn__Validator));
+}
+
+static inline void __sn__Validator_release(__sn__Validator **p) {
+    if (*p) {
+        sn_closure_release((void **)&(*p)->__sn__check);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Validator __attribute__((cleanup(__sn__Validator_release)))
+
+static inline void __sn__Validator_release_elem(void *p) { __sn__Validator_release((__sn__Validator **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Validator_to_string(const __sn__Validator *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Validator { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "check: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__check);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Validator __sn__positiveValidator();
+__sn__Validator __sn__thresholdValidator(long long);
+
+
+
+static bool __lambda_0__(void *__closure__, long long __sn__x);
+typedef struct __closure_1__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    long long threshold;
+} __closure_1__;
+static bool __lambda_1__(void *__closure__, long long __sn__x);
+
+#endif
@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    __sn__initCounter(42LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("counter = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__getCounter()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("doubled = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__double_value(21LL)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
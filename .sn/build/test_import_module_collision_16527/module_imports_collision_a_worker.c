@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+long long __sn__sharedCounter = 0LL;
+
+
+
+void __sn__initCounter(long long __sn__n) {
+
+    (__sn__sharedCounter = __sn__n);
+    
+}
+
+
+long long __sn__getCounter() {
+
+    return __sn__sharedCounter;}
+
@@ -0,0 +1,9 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__double_value(long long __sn__x) {
+
+    return __sn__multiply(__sn__x, 2LL);}
+
@@ -0,0 +1,9 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__multiply(long long __sn__a, long long __sn__b) {
+
+    return sn_mul_long(__sn__a, __sn__b);}
+
@@ -0,0 +1,29 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+extern long long __sn__sharedCounter;
+
+void __sn__initCounter(long long);
+long long __sn__getCounter();
+long long __sn__multiply(long long, long long);
+long long __sn__double_value(long long);
+
+
+
+
+#endif
@@ -0,0 +1,103 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("=== Multi-Struct Import Test ===\n\n");
+    
+    sn_print("Test 1: Rectangle struct\n");
+    
+    __sn__Rectangle __sn__r = __sn__Rectangle_create(5LL, 3LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Created: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r.__sn__width));
+            sn_auto_str char *__is_p2__ = sn_strdup("x");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__r.__sn__height));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Area: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Rectangle_area(&__sn__r)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Perimeter: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Rectangle_perimeter(&__sn__r)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 2: Circle struct\n");
+    
+    __sn__Circle __sn__c = __sn__Circle_unit();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Unit circle radius: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__radius));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Diameter: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Circle_diameter(&__sn__c)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 3: Triangle struct\n");
+    
+    __sn__Triangle __sn__t = (__sn__Triangle){ .__sn__base = 6LL, .__sn__height = 4LL };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Base: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__t.__sn__base));
+            sn_auto_str char *__is_p2__ = sn_strdup(", Height: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__t.__sn__height));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Area: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Triangle_area(&__sn__t)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 4: Imported factory function\n");
+    
+    __sn__Rectangle __sn__sq = __sn__make_square(4LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Square: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sq.__sn__width));
+            sn_auto_str char *__is_p2__ = sn_strdup("x");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__sq.__sn__height));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Area: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Rectangle_area(&__sn__sq)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 5: Function with multiple struct parameters\n");
+    
+    long long __sn__total = __sn__shapes_sum_areas(__sn__r, __sn__c, __sn__t);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Sum of areas: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__total));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\n=== All Multi-Struct Import Tests PASSED ===\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,41 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Rectangle __sn__make_square(long long __sn__side) {
+
+    return (__sn__Rectangle){ .__sn__width = __sn__side, .__sn__height = __sn__side };}
+
+
+long long __sn__shapes_sum_areas(__sn__Rectangle __sn__r, __sn__Circle __sn__c, __sn__Triangle __sn__t) {
+
+    return sn_add_long(sn_add_long(__sn__Rectangle_area(&__sn__r), sn_mul_long(sn_mul_long(__sn__c.__sn__radius, __sn__c.__sn__radius), 3LL)), __sn__Triangle_area(&__sn__t));}
+
+
+long long __sn__Rectangle_area(__sn__Rectangle *__sn__self) {
+
+    return sn_mul_long(__sn__self->__sn__width, __sn__self->__sn__height);}
+
+long long __sn__Rectangle_perimeter(__sn__Rectangle *__sn__self) {
+
+    return sn_mul_long(2LL, sn_add_long(__sn__self->__sn__width, __sn__self->__sn__height));}
+
+__sn__Rectangle __sn__Rectangle_create(long long __sn__w, long long __sn__h) {
+
+    return (__sn__Rectangle){ .__sn__width = __sn__w, .__sn__height = __sn__h };}
+
+
+long long __sn__Circle_diameter(__sn__Circle *__sn__self) {
+
+    return sn_mul_long(__sn__self->__sn__radius, 2LL);}
+
+__sn__Circle __sn__Circle_unit() {
+
+    return (__sn__Circle){ .__sn__radius = 1LL };}
+
+
+long long __sn__Triangle_area(__sn__Triangle *__sn__self) {
+
+    return sn_div_long(sn_mul_long(__sn__self->__sn__base, __sn__self->__sn__height), 2LL);}
+
@@ -0,0 +1,186 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Rectangle (as val) */
+typedef struct {
+    long long __sn__width;
+    long long __sn__height;
+} __sn__Rectangle;
+/* Value operations */
+static inline __sn__Rectangle __sn__Rectangle_copy(const __sn__Rectangle *src) {
+    __sn__Rectangle dst;
+    dst.__sn__width = src->__sn__width;
+    dst.__sn__height = src->__sn__height;
+    return dst;
+}
+
+static inline void __sn__Rectangle_cleanup(__sn__Rectangle *p) {
+
+}
+
+#define sn_auto_Rectangle __attribute__((cleanup(__sn__Rectangle_cleanup)))
+
+static inline void __sn__Rectangle_cleanup_elem(void *p) { __sn__Rectangle_cleanup((__sn__Rectangle *)p); }
+static inline void __sn__Rectangle_copy_into(const void *src, void *dst) { *(__sn__Rectangle *)dst = __sn__Rectangle_copy((const __sn__Rectangle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Rectangle *__sn__Rectangle_alloc(void) {
+    return calloc(1, sizeof(__sn__Rectangle));
+}
+
+static inline void __sn__Rectangle_release(__sn__Rectangle **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Rectangle __attribute__((cleanup(__sn__Rectangle_release)))
+
+static inline void __sn__Rectangle_release_elem(void *p) { __sn__Rectangle_release((__sn__Rectangle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Rectangle_to_string(const __sn__Rectangle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Rectangle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "width: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__width);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "height: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__height);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Circle (as val) */
+typedef struct {
+    long long __sn__radius;
+} __sn__Circle;
+/* Value operations */
+static inline __sn__Circle __sn__Circle_copy(const __sn__Circle *src) {
+    __sn__Circle dst;
+    dst.__sn__radius = src->__sn__radius;
+    return dst;
+}
+
+static inline void __sn__Circle_cleanup(__sn__Circle *p) {
+
+}
+
+#define sn_auto_Circle __attribute__((cleanup(__sn__Circle_cleanup)))
+
+static inline void __sn__Circle_cleanup_elem(void *p) { __sn__Circle_cleanup((__sn__Circle *)p); }
+static inline void __sn__Circle_copy_into(const void *src, void *dst) { *(__sn__Circle *)dst = __sn__Circle_copy((const __sn__Circle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Circle *__sn__Circle_alloc(void) {
+    return calloc(1, sizeof(__sn__Circle));
+}
+
+static inline void __sn__Circle_release(__sn__Circle **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Circle __attribute__((cleanup(__sn__Circle_release)))
+
+static inline void __sn__Circle_release_elem(void *p) { __sn__Circle_release((__sn__Circle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Circle_to_string(const __sn__Circle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Circle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "radius: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__radius);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Triangle (as val) */
+typedef struct {
+    long long __sn__base;
+    long long __sn__height;
+} __sn__Triangle;
+/* Value operations */
+static inline __sn__Triangle __sn__Triangle_copy(const __sn__Triangle *src) {
+    __sn__Triangle dst;
+    dst.__sn__base = src->__sn__base;
+    dst.__sn__height = src->__sn__height;
+    return dst;
+}
+
+static inline void __sn__Triangle_cleanup(__sn__Triangle *p) {
+
+}
+
+#define sn_auto_Triangle __attribute__((cleanup(__sn__Triangle_cleanup)))
+
+static inline void __sn__Triangle_cleanup_elem(void *p) { __sn__Triangle_cleanup((__sn__Triangle *)p); }
+static inline void __sn__Triangle_copy_into(const void *src, void *dst) { *(__sn__Triangle *)dst = __sn__Triangle_copy((const __sn__Triangle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Triangle *__sn__Triangle_alloc(void) {
+    return calloc(1, sizeof(__sn__Triangle));
+}
+
+static inline void __sn__Triangle_release(__sn__Triangle **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Triangle __attribute__((cleanup(__sn__Triangle_release)))
+
+static inline void __sn__Triangle_release_elem(void *p) { __sn__Triangle_release((__sn__Triangle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Triangle_to_string(const __sn__Triangle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Triangle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "base: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__base);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "height: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__height);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Rectangle __sn__make_square(long long);
+long long __sn__shapes_sum_areas(__sn__Rectangle, __sn__Circle, __sn__Triangle);
+
+long long __sn__Rectangle_area(__sn__Rectangle *);
+long long __sn__Rectangle_perimeter(__sn__Rectangle *);
+__sn__Rectangle __sn__Rectangle_create(long long, long long);
+long long __sn__Circle_diameter(__sn__Circle *);
+__sn__Circle __sn__Circle_unit();
+long long __sn__Triangle_area(__sn__Triangle *);
+
+
+
+#endif
@@ -0,0 +1,50 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    __sn__Point __sn__p1 = __sn__point_origin();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Origin: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Point_getX(&__sn__p1)));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Point_getY(&__sn__p1)));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    __sn__Point __sn__p2 = __sn__point_create(3LL, 4LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Created: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Point_getX(&__sn__p2)));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Point_getY(&__sn__p2)));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    __sn__Point __sn__p3 = (__sn__Point){ .__sn__x = 10LL, .__sn__y = 20LL };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Literal: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Point_getX(&__sn__p3)));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Point_getY(&__sn__p3)));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    __sn__Point __sn__sum = __sn__add_points(__sn__p2, __sn__p3);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sum: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Point_getX(&__sn__sum)));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Point_getY(&__sn__sum)));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    sn_print("All struct import tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
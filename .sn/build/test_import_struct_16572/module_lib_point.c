@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Point __sn__point_create(long long __sn__x, long long __sn__y) {
+
+    return (__sn__Point){ .__sn__x = __sn__x, .__sn__y = __sn__y };}
+
+
+__sn__Point __sn__point_origin() {
+
+    return (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };}
+
+
+__sn__Point __sn__add_points(__sn__Point __sn__a, __sn__Point __sn__b) {
+
+    return (__sn__Point){ .__sn__x = sn_add_long(__sn__a.__sn__x, __sn__b.__sn__x), .__sn__y = sn_add_long(__sn__a.__sn__y, __sn__b.__sn__y) };}
+
+
+long long __sn__Point_getX(__sn__Point *__sn__self) {
+
+    return __sn__self->__sn__x;}
+
+long long __sn__Point_getY(__sn__Point *__sn__self) {
+
+    return __sn__self->__sn__y;}
+
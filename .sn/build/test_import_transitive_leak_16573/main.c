@@ -0,0 +1,36 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__r1 = __sn__average(10LL, 20LL);
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("average(10,20) should be 15, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r1));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__r1 == 15LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("average(10,20) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r1));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__r2 = __sn__calcAndAvg(3LL, 4LL);
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("calcAndAvg(3,4) should be 9, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r2));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__r2 == 9LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("calcAndAvg(3,4) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r2));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_println("test_import_transitive_leak: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,9 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__calculate(long long __sn__a, long long __sn__b) {
+
+    return __sn__sum(__sn__a, __sn__prod(__sn__a, __sn__b));}
+
@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__average(long long __sn__a, long long __sn__b) {
+
+    return sn_div_long(__sn__sum(__sn__a, __sn__b), 2LL);}
+
+
+long long __sn__calcAndAvg(long long __sn__a, long long __sn__b) {
+
+    long long __sn__c = __sn__calculate(__sn__a, __sn__b);
+
+    return __sn__average(__sn__c, __sn__a);}
+
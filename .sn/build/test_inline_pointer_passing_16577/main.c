@@ -0,0 +1,53 @@
+#include "sn_types.h"
+
+
+
+long long * mock_alloc(long long __sn__size) {
+
+    return NULL;}
+
+void mock_free(long long * __sn__ptr) {
+
+    return;}
+
+long long * get_resource() {
+
+    return NULL;}
+
+void use_resource(long long * __sn__ptr) {
+
+    return;}
+
+long long * transform_pointer(long long * __sn__ptr) {
+
+    return __sn__ptr;}
+
+long long * combine_resources(long long * __sn__a, long long * __sn__b) {
+
+    return __sn__a;}
+
+int main() {
+    mock_free(mock_alloc(100LL));
+    
+    sn_println("Test 1 passed: mock_free(mock_alloc(100))");
+    
+    use_resource(get_resource());
+    
+    sn_println("Test 2 passed: use_resource(get_resource())");
+    
+    use_resource(transform_pointer(get_resource()));
+    
+    sn_println("Test 3 passed: use_resource(transform_pointer(get_resource()))");
+    
+    use_resource(combine_resources(get_resource(), get_resource()));
+    
+    sn_println("Test 4 passed: combine_resources with two inline get_resource() calls");
+    
+    mock_free(NULL);
+    
+    sn_println("Test 5 passed: mock_free(nil)");
+    
+    sn_println("All inline pointer passing tests passed!");
+    
+    return 0LL;    fflush(stdout);
+}
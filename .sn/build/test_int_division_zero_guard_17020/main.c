@@ -0,0 +1,21 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 10LL;
+    long long __sn__divisor = 2LL;
+    if ((__sn__divisor != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_div_long(__sn__x, __sn__divisor)));
+                sn_auto_str char *__is_p1__ = sn_strdup("\n");
+                sn_str_concat_multi(2, __is_p0__, __is_p1__);
+            }); sn_print(__ps__); };
+        
+    } else {
+        sn_print("div by zero\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
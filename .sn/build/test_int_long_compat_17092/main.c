@@ -0,0 +1,55 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__getLong() {
+
+    return 999LL;}
+
+
+long long __sn__getInt() {
+
+    return 777LL;}
+
+int main() {
+    long long __sn__x = 42LL;
+    long long __sn__y = __sn__x;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("long to int: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__y));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__a = 100LL;
+    long long __sn__b = __sn__a;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("int to long: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__b));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__c = 500LL;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("literal to long: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__d = __sn__getLong();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("fn long to int: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__d));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__e = __sn__getInt();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("fn int to long: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__e));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = 0LL;
+    long long __sn__b = 10LL;
+    __sn__a++;
+    
+    __sn__a++;
+    
+    __sn__a++;
+    
+    __sn__b--;
+    
+    __sn__b--;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__a));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__b));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,15 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = sn_div_long(sn_sub_long(sn_mul_long(sn_add_long(5LL, 3LL), 2LL), 4LL), 3LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,18 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__base = 2LL;
+    long long __sn__result = 1LL;
+    (__sn__result = sn_mul_long(sn_mul_long(sn_mul_long(__sn__base, __sn__base), __sn__base), __sn__base));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
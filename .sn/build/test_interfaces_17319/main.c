@@ -0,0 +1,158 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__acceptComparable(void * __sn__x) {
+
+    return;}
+
+
+void __sn__acceptHashable(void * __sn__x) {
+
+    return;}
+
+
+void __sn__acceptStringable(void * __sn__x) {
+
+    return;}
+
+
+long long __sn__Score_compare(__sn__Score *__sn__self, __sn__Score __sn__other) {
+
+    if (sn_lt_long(__sn__self->__sn__value, __sn__other.__sn__value)) {
+        return (-1LL);}
+
+    if (sn_gt_long(__sn__self->__sn__value, __sn__other.__sn__value)) {
+        return 1LL;}
+
+    return 0LL;}
+
+
+long long __sn__UserId_hash(__sn__UserId *__sn__self) {
+
+    return sn_mul_long(__sn__self->__sn__id, 31LL);}
+
+bool __sn__UserId_equals(__sn__UserId *__sn__self, __sn__UserId __sn__other) {
+
+    return (__sn__self->__sn__id == __sn__other.__sn__id);}
+
+
+char * __sn__Color_toString(__sn__Color *__sn__self) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("rgb(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__r));
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__g));
+            sn_auto_str char *__is_p4__ = sn_strdup(",");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__b));
+            sn_auto_str char *__is_p6__ = sn_strdup(")");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        });}
+
+
+long long __sn__Player_compare(__sn__Player *__sn__self, __sn__Player *__sn__other) {
+
+    if (sn_lt_long(__sn__self->__sn__score, (*__sn__other).__sn__score)) {
+        return (-1LL);}
+
+    if (sn_gt_long(__sn__self->__sn__score, (*__sn__other).__sn__score)) {
+        return 1LL;}
+
+    return 0LL;}
+
+char * __sn__Player_toString(__sn__Player *__sn__self) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Player(");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__self->__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__score));
+            sn_auto_str char *__is_p4__ = sn_strdup(")");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        });}
+
+int main() {
+    __sn__Score __sn__s1 = (__sn__Score){ .__sn__value = 10LL };
+    __sn__Score __sn__s2 = (__sn__Score){ .__sn__value = 20LL };
+    long long __sn__cmp1 = __sn__Score_compare(&__sn__s1, __sn__s2);
+    if ((__sn__cmp1 != (-1LL))) {
+        sn_print("FAIL: s1.compare(s2) should be -1\n");
+        
+        return 1LL;}
+    long long __sn__cmp2 = __sn__Score_compare(&__sn__s2, __sn__s1);
+    if ((__sn__cmp2 != 1LL)) {
+        sn_print("FAIL: s2.compare(s1) should be 1\n");
+        
+        return 1LL;}
+    __sn__Score __sn__s3 = (__sn__Score){ .__sn__value = 10LL };
+    long long __sn__cmp3 = __sn__Score_compare(&__sn__s1, __sn__s3);
+    if ((__sn__cmp3 != 0LL)) {
+        sn_print("FAIL: s1.compare(s3) should be 0\n");
+        
+        return 1LL;}
+    sn_print("Test 1 passed: Score.compare works correctly\n");
+    
+    __sn__acceptComparable(&__sn__s1);
+    
+    sn_print("Test 2 passed: Score satisfies Comparable\n");
+    
+    __sn__UserId __sn__u1 = (__sn__UserId){ .__sn__id = 7LL };
+    __sn__UserId __sn__u2 = (__sn__UserId){ .__sn__id = 7LL };
+    __sn__UserId __sn__u3 = (__sn__UserId){ .__sn__id = 9LL };
+    long long __sn__hashVal = __sn__UserId_hash(&__sn__u1);
+    if ((__sn__hashVal != 217LL)) {
+        sn_print("FAIL: hash(id=7) should be 217\n");
+        
+        return 1LL;}
+    bool __sn__eq1 = __sn__UserId_equals(&__sn__u1, __sn__u2);
+    if ((!__sn__eq1)) {
+        sn_print("FAIL: u1.equals(u2) should be true\n");
+        
+        return 1LL;}
+    bool __sn__eq2 = __sn__UserId_equals(&__sn__u1, __sn__u3);
+    if (__sn__eq2) {
+        sn_print("FAIL: u1.equals(u3) should be false\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: UserId.hash and UserId.equals work correctly\n");
+    
+    __sn__acceptHashable(&__sn__u1);
+    
+    sn_print("Test 4 passed: UserId satisfies Hashable\n");
+    
+    __sn__Color __sn__red = (__sn__Color){ .__sn__r = 255LL, .__sn__g = 0LL, .__sn__b = 0LL };
+    sn_auto_str char * __sn__redStr = __sn__Color_toString(&__sn__red);
+    if ((strcmp(__sn__redStr, "rgb(255,0,0)") != 0)) {
+        sn_print("FAIL: red.toString() should be rgb(255,0,0)\n");
+        
+        return 1LL;}
+    sn_print("Test 5 passed: Color.toString works correctly\n");
+    
+    __sn__acceptStringable(&__sn__red);
+    
+    sn_print("Test 6 passed: Color satisfies Stringable\n");
+    
+    sn_auto_Player __sn__Player __sn__alice = (__sn__Player){ .__sn__name = strdup("Alice"), .__sn__score = 100LL };
+    sn_auto_Player __sn__Player __sn__bob = (__sn__Player){ .__sn__name = strdup("Bob"), .__sn__score = 200LL };
+    long long __sn__rankResult = __sn__Player_compare(&__sn__alice, &__sn__bob);
+    if ((__sn__rankResult != (-1LL))) {
+        sn_print("FAIL: alice.compare(bob) should be -1\n");
+        
+        return 1LL;}
+    sn_auto_str char * __sn__aliceStr = __sn__Player_toString(&__sn__alice);
+    if ((strcmp(__sn__aliceStr, "Player(Alice,100)") != 0)) {
+        sn_print("FAIL: alice.toString() should be Player(Alice,100)\n");
+        
+        return 1LL;}
+    __sn__acceptComparable(&__sn__alice);
+    
+    __sn__acceptStringable(&__sn__alice);
+    
+    sn_print("Test 7 passed: Player satisfies Comparable and Stringable\n");
+    
+    sn_print("All interface tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,242 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Score (as val) */
+typedef struct {
+    long long __sn__value;
+} __sn__Score;
+/* Value operations */
+static inline __sn__Score __sn__Score_copy(const __sn__Score *src) {
+    __sn__Score dst;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Score_cleanup(__sn__Score *p) {
+
+}
+
+#define sn_auto_Score __attribute__((cleanup(__sn__Score_cleanup)))
+
+static inline void __sn__Score_cleanup_elem(void *p) { __sn__Score_cleanup((__sn__Score *)p); }
+static inline void __sn__Score_copy_into(const void *src, void *dst) { *(__sn__Score *)dst = __sn__Score_copy((const __sn__Score *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Score *__sn__Score_alloc(void) {
+    return calloc(1, sizeof(__sn__Score));
+}
+
+static inline void __sn__Score_release(__sn__Score **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Score __attribute__((cleanup(__sn__Score_release)))
+
+static inline void __sn__Score_release_elem(void *p) { __sn__Score_release((__sn__Score **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Score_to_string(const __sn__Score *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Score { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: UserId (as val) */
+typedef struct {
+    long long __sn__id;
+} __sn__UserId;
+/* Value operations */
+static inline __sn__UserId __sn__UserId_copy(const __sn__UserId *src) {
+    __sn__UserId dst;
+    dst.__sn__id = src->__sn__id;
+    return dst;
+}
+
+static inline void __sn__UserId_cleanup(__sn__UserId *p) {
+
+}
+
+#define sn_auto_UserId __attribute__((cleanup(__sn__UserId_cleanup)))
+
+static inline void __sn__UserId_cleanup_elem(void *p) { __sn__UserId_cleanup((__sn__UserId *)p); }
+static inline void __sn__UserId_copy_into(const void *src, void *dst) { *(__sn__UserId *)dst = __sn__UserId_copy((const __sn__UserId *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__UserId *__sn__UserId_alloc(void) {
+    return calloc(1, sizeof(__sn__UserId));
+}
+
+static inline void __sn__UserId_release(__sn__UserId **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_UserId __attribute__((cleanup(__sn__UserId_release)))
+
+static inline void __sn__UserId_release_elem(void *p) { __sn__UserId_release((__sn__UserId **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__UserId_to_string(const __sn__UserId *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "UserId { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__id);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Color (as val) */
+typedef struct {
+    long long __sn__r;
+    long long __sn__g;
+    long long __sn__b;
+} __sn__Color;
+/* Value operations */
+static inline __sn__Color __sn__Color_copy(const __sn__Color *src) {
+    __sn__Color dst;
+    dst.__sn__r = src->__sn__r;
+    dst.__sn__g = src->__sn__g;
+    dst.__sn__b = src->__sn__b;
+    return dst;
+}
+
+static inline void __sn__Color_cleanup(__sn__Color *p) {
+
+}
+
+#define sn_auto_Color __attribute__((cleanup(__sn__Color_cleanup)))
+
+static inline void __sn__Color_cleanup_elem(void *p) { __sn__Color_cleanup((__sn__Color *)p); }
+static inline void __sn__Color_copy_into(const void *src, void *dst) { *(__sn__Color *)dst = __sn__Color_copy((const __sn__Color *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Color *__sn__Color_alloc(void) {
+    return calloc(1, sizeof(__sn__Color));
+}
+
+static inline void __sn__Color_release(__sn__Color **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Color __attribute__((cleanup(__sn__Color_release)))
+
+static inline void __sn__Color_release_elem(void *p) { __sn__Color_release((__sn__Color **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Color_to_string(const __sn__Color *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Color { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "r: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__r);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__g);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__b);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Player (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__score;
+} __sn__Player;
+/* Value operations */
+static inline __sn__Player __sn__Player_copy(const __sn__Player *src) {
+    __sn__Player dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__score = src->__sn__score;
+    return dst;
+}
+
+static inline void __sn__Player_cleanup(__sn__Player *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Player __attribute__((cleanup(__sn__Player_cleanup)))
+
+static inline void __sn__Player_cleanup_elem(void *p) { __sn__Player_cleanup((__sn__Player *)p); }
+static inline void __sn__Player_copy_into(const void *src, void *dst) { *(__sn__Player *)dst = __sn__Player_copy((const __sn__Player *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Player *__sn__Player_alloc(void) {
+    return calloc(1, sizeof(__sn__Player));
+}
+
+static inline void __sn__Player_release(__sn__Player **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Player __attribute__((cleanup(__sn__Player_release)))
+
+static inline void __sn__Player_release_elem(void *p) { __sn__Player_release((__sn__Player **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Player_to_string(const __sn__Player *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Player { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "score: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__score);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__acceptComparable(void *);
+void __sn__acceptHashable(void *);
+void __sn__acceptStringable(void *);
+
+long long __sn__Score_compare(__sn__Score *, __sn__Score);
+long long __sn__UserId_hash(__sn__UserId *);
+bool __sn__UserId_equals(__sn__UserId *, __sn__UserId);
+char * __sn__Color_toString(__sn__Color *);
+long long __sn__Player_compare(__sn__Player *, __sn__Player *);
+char * __sn__Player_toString(__sn__Player *);
+
+
+
+#endif
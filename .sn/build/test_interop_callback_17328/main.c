@@ -0,0 +1,337 @@
+#include "sn_types.h"
+
+
+
+long long invoke_callback(void * __sn__cb, void * __sn__a, void * __sn__b) {
+
+    return ((long long (*)(void *, void *, void *))((__Closure__ *)__sn__cb)->fn)(__sn__cb, __sn__a, __sn__b);}
+
+bool test_basic_callback() {
+
+    sn_print("  Testing basic native callback invocation...\n");
+    
+
+    sn_auto_fn void * __sn__cmp = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__result = invoke_callback(__sn__cmp, NULL, NULL);
+
+    if ((__sn__result != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: Expected 0 for nil==nil, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    (__sn__result = invoke_callback(__sn__cmp, NULL, NULL));
+    
+
+    if ((__sn__result != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: Second nil==nil test failed\n");
+                sn_str_concat_multi(1, __is_p0__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("    PASS: basic callback test\n");
+    
+
+    return true;}
+
+long long apply_callback_twice(void * __sn__cb, long long __sn__value) {
+
+    long long __sn__result = ((long long (*)(void *, long long))((__Closure__ *)__sn__cb)->fn)(__sn__cb, __sn__value);
+
+    return ((long long (*)(void *, long long))((__Closure__ *)__sn__cb)->fn)(__sn__cb, __sn__result);}
+
+bool test_multiple_invocations() {
+
+    sn_print("  Testing multiple callback invocations...\n");
+    
+
+    sn_auto_fn void * __sn__double_it = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__result = apply_callback_twice(__sn__double_it, 5LL);
+
+    if ((__sn__result != 20LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: Expected 20, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_auto_fn void * __sn__inc = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_2__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    (__sn__result = apply_callback_twice(__sn__inc, 0LL));
+    
+
+    if ((__sn__result != 2LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: Expected 2, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("    PASS: multiple invocations test\n");
+    
+
+    return true;}
+
+bool test_callback_logic() {
+
+    sn_print("  Testing callback return value logic...\n");
+    
+
+    sn_auto_fn void * __sn__cmp = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_3__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__r1 = invoke_callback(__sn__cmp, NULL, NULL);
+
+    if ((__sn__r1 != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: nil,nil should return 0, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r1));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("    All callback logic paths tested\n");
+    
+
+    sn_print("    PASS: callback logic test\n");
+    
+
+    return true;}
+
+long long count_matching(void * __sn__pred, long long __sn__count) {
+
+    long long __sn__matches = 0LL;
+
+    long long __sn__i = 0LL;
+
+    while (sn_lt_long(__sn__i, __sn__count)) {
+        if (((bool (*)(void *, long long))((__Closure__ *)__sn__pred)->fn)(__sn__pred, __sn__i)) {
+            (__sn__matches = sn_add_long(__sn__matches, 1LL));
+            
+        }
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+
+    return __sn__matches;}
+
+bool test_predicate_callback() {
+
+    sn_print("  Testing predicate callback...\n");
+    
+
+    sn_auto_fn void * __sn__is_even = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_4__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__evens = count_matching(__sn__is_even, 10LL);
+
+    if ((__sn__evens != 5LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: Expected 5 even numbers, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__evens));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_auto_fn void * __sn__gt5 = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_5__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__gt5_count = count_matching(__sn__gt5, 10LL);
+
+    if ((__sn__gt5_count != 4LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: Expected 4 numbers > 5, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__gt5_count));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("    PASS: predicate callback test\n");
+    
+
+    return true;}
+
+long long invoke_status(void * __sn__cb, long long __sn__code) {
+
+    return ((long long (*)(void *, long long))((__Closure__ *)__sn__cb)->fn)(__sn__cb, __sn__code);}
+
+bool test_status_callback() {
+
+    sn_print("  Testing status callback...\n");
+    
+
+    sn_auto_fn void * __sn__echo = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_6__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__result = invoke_status(__sn__echo, 42LL);
+
+    if ((__sn__result != 42LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: Expected 42, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_auto_fn void * __sn__checker = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_7__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    (__sn__result = invoke_status(__sn__checker, 10LL));
+    
+
+    if ((__sn__result != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: Expected 0 for positive, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    (__sn__result = invoke_status(__sn__checker, (-5LL)));
+    
+
+    if ((__sn__result != 1LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: Expected 1 for negative, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("    PASS: status callback test\n");
+    
+
+    return true;}
+
+int main() {
+    sn_print("=== Native Callback Interop Test ===\n\n");
+    
+    if ((!test_basic_callback())) {
+        return 1LL;}
+    if ((!test_multiple_invocations())) {
+        return 1LL;}
+    if ((!test_callback_logic())) {
+        return 1LL;}
+    if ((!test_predicate_callback())) {
+        return 1LL;}
+    if ((!test_status_callback())) {
+        return 1LL;}
+    sn_print("\n=== All native callback tests PASSED! ===\n");
+    
+    return 0LL;    fflush(stdout);
+}
+
+static long long __lambda_0__(void *__closure__, void * __sn__a, void * __sn__b) {
+    if ((__sn__a == NULL)) {
+        if ((__sn__b == NULL)) {
+            return 0LL;}
+        return (-1LL);}
+    if ((__sn__b == NULL)) {
+        return 1LL;}
+    return 0LL;}
+
+static long long __lambda_1__(void *__closure__, long long __sn__value) {
+    return sn_mul_long(__sn__value, 2LL);}
+
+static long long __lambda_2__(void *__closure__, long long __sn__value) {
+    return sn_add_long(__sn__value, 1LL);}
+
+static long long __lambda_3__(void *__closure__, void * __sn__a, void * __sn__b) {
+    if ((__sn__a == NULL)) {
+        if ((__sn__b == NULL)) {
+            return 0LL;}
+        return (-1LL);}
+    if ((__sn__b == NULL)) {
+        return 1LL;}
+    return 0LL;}
+
+static bool __lambda_4__(void *__closure__, long long __sn__value) {
+    return (sn_mod_long(__sn__value, 2LL) == 0LL);}
+
+static bool __lambda_5__(void *__closure__, long long __sn__value) {
+    return sn_gt_long(__sn__value, 5LL);}
+
+static long long __lambda_6__(void *__closure__, long long __sn__code) {
+    return __sn__code;}
+
+static long long __lambda_7__(void *__closure__, long long __sn__code) {
+    if ((__sn__code >= 0LL)) {
+        return 0LL;}
+    return 1LL;}
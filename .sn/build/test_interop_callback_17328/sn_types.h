@@ -0,0 +1,41 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long invoke_callback(void *, void *, void *);
+bool test_basic_callback();
+long long apply_callback_twice(void *, long long);
+bool test_multiple_invocations();
+bool test_callback_logic();
+long long count_matching(void *, long long);
+bool test_predicate_callback();
+long long invoke_status(void *, long long);
+bool test_status_callback();
+
+
+
+static long long __lambda_0__(void *__closure__, void * __sn__a, void * __sn__b);
+static long long __lambda_1__(void *__closure__, long long __sn__value);
+static long long __lambda_2__(void *__closure__, long long __sn__value);
+static long long __lambda_3__(void *__closure__, void * __sn__a, void * __sn__b);
+static bool __lambda_4__(void *__closure__, long long __sn__value);
+static bool __lambda_5__(void *__closure__, long long __sn__value);
+static long long __lambda_6__(void *__closure__, long long __sn__code);
+static long long __lambda_7__(void *__closure__, long long __sn__code);
+
+#endif
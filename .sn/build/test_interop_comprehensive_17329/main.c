@@ -0,0 +1,352 @@
+#include "sn_types.h"
+double sin(double);
+double cos(double);
+double sqrt(double);
+
+
+
+void * * get_null_handle() {
+
+    return NULL;}
+
+bool is_handle_valid(void * * __sn__h) {
+
+    return (__sn__h != NULL);}
+
+void compute_circle(double __sn__radius, double *__sn__area, double *__sn__circumference) {
+
+    double __sn__pi = 3.1415926535900001;
+
+    (*__sn__area = sn_mul_double(sn_mul_double(__sn__pi, __sn__radius), __sn__radius));
+    
+
+    (*__sn__circumference = sn_mul_double(sn_mul_double(2.0, __sn__pi), __sn__radius));
+    
+}
+
+long long apply_transform(void * __sn__cb, long long __sn__value) {
+
+    return ((long long (*)(void *, long long))((__Closure__ *)__sn__cb)->fn)(__sn__cb, __sn__value);}
+
+long long apply_n_times(void * __sn__cb, long long __sn__value, long long __sn__n) {
+
+    long long __sn__result = __sn__value;
+
+    long long __sn__i = 0LL;
+
+    while (sn_lt_long(__sn__i, __sn__n)) {
+        (__sn__result = ((long long (*)(void *, long long))((__Closure__ *)__sn__cb)->fn)(__sn__cb, __sn__result));
+        
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+
+    return __sn__result;}
+
+
+bool __sn__approx_eq(double __sn__a, double __sn__b, double __sn__tol) {
+
+    double __sn__diff = sn_sub_double(__sn__a, __sn__b);
+
+    if (sn_lt_double(__sn__diff, 0.0)) {
+        (__sn__diff = (-__sn__diff));
+        
+    }
+
+    return sn_lt_double(__sn__diff, __sn__tol);}
+
+
+bool __sn__test_math_integration() {
+
+    sn_print("Test 1: Math library integration\n");
+    
+
+    double __sn__angle = 0.0;
+
+    double __sn__s = sin(__sn__angle);
+
+    double __sn__c = cos(__sn__angle);
+
+    if ((!__sn__approx_eq(__sn__s, 0.0, 1.0000000000000001e-05))) {
+        sn_print("  FAIL: sin(0) != 0\n");
+        
+        return false;}
+
+    if ((!__sn__approx_eq(__sn__c, 1.0, 1.0000000000000001e-05))) {
+        sn_print("  FAIL: cos(0) != 1\n");
+        
+        return false;}
+
+    double __sn__sq = sqrt(16.0);
+
+    if ((!__sn__approx_eq(__sn__sq, 4.0, 1.0000000000000001e-05))) {
+        sn_print("  FAIL: sqrt(16) != 4\n");
+        
+        return false;}
+
+    sn_print("  PASS: Math library works\n");
+    
+
+    return true;}
+
+
+bool __sn__test_variadic_printf() {
+
+    sn_print("Test 2: Variadic printf\n");
+    
+
+    printf("  String: %s\n", "hello");
+    
+
+    printf("  Integer: %ld\n", 42LL);
+    
+
+    printf("  Double: %.2f\n", 3.1415899999999999);
+    
+
+    printf("  Mixed: %s=%ld (%.1f%%)\n", "score", 95LL, 95.0);
+    
+
+    sn_print("  PASS: Variadic printf works\n");
+    
+
+    return true;}
+
+
+bool __sn__test_opaque_type() {
+
+    sn_print("Test 3: Opaque type operations\n");
+    
+
+    if (is_handle_valid(NULL)) {
+        sn_print("  FAIL: nil should be invalid\n");
+        
+        return false;}
+
+    if (is_handle_valid(get_null_handle())) {
+        sn_print("  FAIL: get_null_handle() should return invalid handle\n");
+        
+        return false;}
+
+    sn_print("  PASS: Opaque type works\n");
+    
+
+    return true;}
+
+
+bool __sn__test_out_params() {
+
+    sn_print("Test 4: Out-parameters with as ref\n");
+    
+
+    double __sn__area = 0.0;
+
+    double __sn__circ = 0.0;
+
+    compute_circle(10.0, &__sn__area, &__sn__circ);
+    
+
+    if ((!__sn__approx_eq(__sn__area, 314.15899999999999, 0.01))) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Area = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__area));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected ~314.159\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    if ((!__sn__approx_eq(__sn__circ, 62.832000000000001, 0.01))) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Circumference = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__circ));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected ~62.832\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("  PASS: Out-parameters work\n");
+    
+
+    return true;}
+
+bool test_callbacks() {
+
+    sn_print("Test 5: Native callbacks\n");
+    
+
+    sn_auto_fn void * __sn__double_it = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__result = apply_transform(__sn__double_it, 5LL);
+
+    if ((__sn__result != 10LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: double(5) = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 10\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    (__sn__result = apply_n_times(__sn__double_it, 1LL, 4LL));
+    
+
+    if ((__sn__result != 16LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: double^4(1) = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 16\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_auto_fn void * __sn__inc = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    (__sn__result = apply_n_times(__sn__inc, 0LL, 5LL));
+    
+
+    if ((__sn__result != 5LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: inc^5(0) = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 5\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("  PASS: Native callbacks work\n");
+    
+
+    return true;}
+
+bool test_pointers() {
+
+    sn_print("Test 6: Pointer operations\n");
+    
+
+    long long * __sn__p = NULL;
+
+    if ((__sn__p != NULL)) {
+        sn_print("  FAIL: nil pointer comparison failed\n");
+        
+        return false;}
+
+    void * __sn__vp = NULL;
+
+    if ((__sn__vp != NULL)) {
+        sn_print("  FAIL: void pointer nil comparison failed\n");
+        
+        return false;}
+
+    void * * __sn__h = get_null_handle();
+
+    if ((__sn__h != NULL)) {
+        sn_print("  FAIL: get_null_handle() should return nil\n");
+        
+        return false;}
+
+    sn_print("  PASS: Pointer operations work\n");
+    
+
+    return true;}
+
+bool test_combined_workflow() {
+
+    sn_print("Test 7: Combined workflow (all features together)\n");
+    
+
+    double __sn__radius = 5.0;
+
+    double __sn__sqrt_radius = sqrt(__sn__radius);
+
+    double __sn__area = 0.0;
+
+    double __sn__circ = 0.0;
+
+    compute_circle(__sn__radius, &__sn__area, &__sn__circ);
+    
+
+    sn_auto_fn void * __sn__scale = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_2__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__scaled = apply_transform(__sn__scale, 7LL);
+
+    printf("  Combined: sqrt(%.1f)=%.4f, scaled=%ld\n", __sn__radius, __sn__sqrt_radius, __sn__scaled);
+    
+
+    void * * __sn__h = get_null_handle();
+
+    if ((__sn__h != NULL)) {
+        sn_print("  FAIL: Handle should be nil\n");
+        
+        return false;}
+
+    if ((__sn__scaled != 70LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Expected scaled=70, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__scaled));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("  PASS: Combined workflow works\n");
+    
+
+    return true;}
+
+int main() {
+    sn_print("=== Comprehensive C Interop Test ===\n\n");
+    
+    if ((!__sn__test_math_integration())) {
+        return 1LL;}
+    if ((!__sn__test_variadic_printf())) {
+        return 1LL;}
+    if ((!__sn__test_opaque_type())) {
+        return 1LL;}
+    if ((!__sn__test_out_params())) {
+        return 1LL;}
+    if ((!test_callbacks())) {
+        return 1LL;}
+    if ((!test_pointers())) {
+        return 1LL;}
+    if ((!test_combined_workflow())) {
+        return 1LL;}
+    sn_print("\n=== All comprehensive interop tests PASSED! ===\n");
+    
+    return 0LL;    fflush(stdout);
+}
+
+static long long __lambda_0__(void *__closure__, long long __sn__value) {
+    return sn_mul_long(__sn__value, 2LL);}
+
+static long long __lambda_1__(void *__closure__, long long __sn__value) {
+    return sn_add_long(__sn__value, 1LL);}
+
+static long long __lambda_2__(void *__closure__, long long __sn__value) {
+    return sn_mul_long(__sn__value, 10LL);}
@@ -0,0 +1,41 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+#include <math.h>
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+void * * get_null_handle();
+bool is_handle_valid(void * *);
+void compute_circle(double, double *, double *);
+long long apply_transform(void *, long long);
+long long apply_n_times(void *, long long, long long);
+bool __sn__approx_eq(double, double, double);
+bool __sn__test_math_integration();
+bool __sn__test_variadic_printf();
+bool __sn__test_opaque_type();
+bool __sn__test_out_params();
+bool test_callbacks();
+bool test_pointers();
+bool test_combined_workflow();
+
+
+
+static long long __lambda_0__(void *__closure__, long long __sn__value);
+static long long __lambda_1__(void *__closure__, long long __sn__value);
+static long long __lambda_2__(void *__closure__, long long __sn__value);
+
+#endif
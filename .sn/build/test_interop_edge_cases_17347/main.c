@@ -0,0 +1,244 @@
+#include "sn_types.h"
+
+
+
+long long * get_nil_int_ptr() {
+
+    return NULL;}
+
+char * get_nil_char_ptr() {
+
+    return NULL;}
+
+bool test_nil_equality(long long * __sn__ptr) {
+
+    return (__sn__ptr == NULL);}
+
+bool test_nil_inequality(long long * __sn__ptr) {
+
+    return (__sn__ptr != NULL);}
+
+void test_nil_comparisons() {
+
+    sn_print("Test 1: Nil pointer comparisons\n");
+    
+
+    long long * __sn__ptr = get_nil_int_ptr();
+
+    if ((__sn__ptr == NULL)) {
+        sn_print("  ptr == nil: PASS\n");
+        
+    } else {
+        sn_print("  ptr == nil: FAIL\n");
+        
+    }
+
+    if ((__sn__ptr != NULL)) {
+        sn_print("  ptr != nil when nil: FAIL\n");
+        
+    } else {
+        sn_print("  ptr != nil when nil: PASS\n");
+        
+    }
+
+    bool __sn__eq_result = test_nil_equality(__sn__ptr);
+
+    if (__sn__eq_result) {
+        sn_print("  Function test_nil_equality: PASS\n");
+        
+    } else {
+        sn_print("  Function test_nil_equality: FAIL\n");
+        
+    }
+
+    bool __sn__neq_result = test_nil_inequality(__sn__ptr);
+
+    if ((!__sn__neq_result)) {
+        sn_print("  Function test_nil_inequality: PASS\n");
+        
+    } else {
+        sn_print("  Function test_nil_inequality: FAIL\n");
+        
+    }
+}
+
+char * safe_char_unwrap(char * __sn__ptr) {
+
+    if ((__sn__ptr == NULL)) {
+        return strdup("(null)");}
+
+    return (__sn__ptr ? strdup(__sn__ptr) : NULL);}
+
+void test_null_char_unwrap() {
+
+    sn_print("\nTest 2: *char as val when NULL\n");
+    
+
+    char * __sn__ptr = get_nil_char_ptr();
+
+    if ((__sn__ptr == NULL)) {
+        sn_print("  Pointer is nil: PASS\n");
+        
+    }
+
+    sn_auto_str char * __sn__result = safe_char_unwrap(__sn__ptr);
+
+    if ((strcmp(__sn__result, "(null)") == 0)) {
+        sn_print("  Safe unwrap returns guard value: PASS\n");
+        
+    } else {
+        sn_print("  Safe unwrap returns guard value: FAIL\n");
+        
+    }
+}
+
+long long mixed_params(long long __sn__a, long long * __sn__ptr, double __sn__b, bool __sn__flag) {
+
+    if ((__sn__ptr == NULL)) {
+        return (-1LL);}
+
+    if (__sn__flag) {
+        return sn_mul_long(__sn__a, 2LL);}
+
+    return sn_add_long(__sn__a, 10LL);}
+
+
+long long __sn__call_mixed_params_with_nil() {
+
+    return mixed_params(5LL, NULL, 3.1400000000000001, true);}
+
+long long call_mixed_params_with_ptr(long long * __sn__p) {
+
+    return mixed_params(5LL, __sn__p, 3.1400000000000001, false);}
+
+void test_mixed_parameters() {
+
+    sn_print("\nTest 3: Mixed pointer and primitive parameters\n");
+    
+
+    long long __sn__result1 = __sn__call_mixed_params_with_nil();
+
+    if ((__sn__result1 == (-1LL))) {
+        sn_print("  Nil pointer detection: PASS\n");
+        
+    } else {
+        sn_print("  Nil pointer detection: FAIL\n");
+        
+    }
+
+    long long __sn__result2 = mixed_params(5LL, NULL, 2.71, true);
+
+    if ((__sn__result2 == (-1LL))) {
+        sn_print("  Mixed with nil and true flag: PASS\n");
+        
+    } else {
+        sn_print("  Mixed with nil and true flag: FAIL\n");
+        
+    }
+}
+
+bool invoke_ptr_callback(void * __sn__cb, long long * __sn__ptr) {
+
+    return ((bool (*)(void *, long long *))((__Closure__ *)__sn__cb)->fn)(__sn__cb, __sn__ptr);}
+
+void test_callback_with_pointer() {
+
+    sn_print("\nTest 4: Callback with pointer parameters\n");
+    
+
+    sn_auto_fn void * __sn__nil_checker = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    bool __sn__is_nil = invoke_ptr_callback(__sn__nil_checker, NULL);
+
+    if (__sn__is_nil) {
+        sn_print("  Callback received nil: PASS\n");
+        
+    } else {
+        sn_print("  Callback received nil: FAIL\n");
+        
+    }
+
+    sn_auto_fn void * __sn__not_nil_checker = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    bool __sn__is_not_nil = invoke_ptr_callback(__sn__not_nil_checker, NULL);
+
+    if ((!__sn__is_not_nil)) {
+        sn_print("  Callback !nil check with nil: PASS\n");
+        
+    } else {
+        sn_print("  Callback !nil check with nil: FAIL\n");
+        
+    }
+}
+
+long long * * get_nil_ptr_ptr() {
+
+    return NULL;}
+
+bool test_double_pointer_nil(long long * * __sn__pp) {
+
+    return (__sn__pp == NULL);}
+
+void test_ptr_ptr_nil() {
+
+    sn_print("\nTest 5: Pointer-to-pointer nil handling\n");
+    
+
+    long long * * __sn__pp = get_nil_ptr_ptr();
+
+    if ((__sn__pp == NULL)) {
+        sn_print("  **int == nil: PASS\n");
+        
+    } else {
+        sn_print("  **int == nil: FAIL\n");
+        
+    }
+
+    bool __sn__result = test_double_pointer_nil(__sn__pp);
+
+    if (__sn__result) {
+        sn_print("  Function with **int nil: PASS\n");
+        
+    } else {
+        sn_print("  Function with **int nil: FAIL\n");
+        
+    }
+}
+
+int main() {
+    sn_print("=== Interop Edge Case Tests ===\n\n");
+    
+    test_nil_comparisons();
+    
+    test_null_char_unwrap();
+    
+    test_mixed_parameters();
+    
+    test_callback_with_pointer();
+    
+    test_ptr_ptr_nil();
+    
+    sn_print("\n=== All edge case tests completed! ===\n");
+    
+    return 0LL;    fflush(stdout);
+}
+
+static bool __lambda_0__(void *__closure__, long long * __sn__ptr) {
+    return (__sn__ptr == NULL);}
+
+static bool __lambda_1__(void *__closure__, long long * __sn__ptr) {
+    return (__sn__ptr != NULL);}
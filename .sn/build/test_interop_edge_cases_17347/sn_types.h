@@ -0,0 +1,42 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long * get_nil_int_ptr();
+char * get_nil_char_ptr();
+bool test_nil_equality(long long *);
+bool test_nil_inequality(long long *);
+void test_nil_comparisons();
+char * safe_char_unwrap(char *);
+void test_null_char_unwrap();
+long long mixed_params(long long, long long *, double, bool);
+long long __sn__call_mixed_params_with_nil();
+long long call_mixed_params_with_ptr(long long *);
+void test_mixed_parameters();
+bool invoke_ptr_callback(void *, long long *);
+void test_callback_with_pointer();
+long long * * get_nil_ptr_ptr();
+bool test_double_pointer_nil(long long * *);
+void test_ptr_ptr_nil();
+
+
+
+static bool __lambda_0__(void *__closure__, long long * __sn__ptr);
+static bool __lambda_1__(void *__closure__, long long * __sn__ptr);
+
+#endif
@@ -0,0 +1,229 @@
+#include "sn_types.h"
+double sin(double);
+double cos(double);
+double tan(double);
+double sqrt(double);
+double pow(double, double);
+double fabs(double);
+double floor(double);
+double ceil(double);
+double log(double);
+double log10(double);
+double exp(double);
+
+
+
+
+bool __sn__approx_eq(double __sn__a, double __sn__b, double __sn__tolerance) {
+
+    double __sn__diff = sn_sub_double(__sn__a, __sn__b);
+
+    if (sn_lt_double(__sn__diff, 0.0)) {
+        (__sn__diff = (-__sn__diff));
+        
+    }
+
+    return sn_lt_double(__sn__diff, __sn__tolerance);}
+
+int main() {
+    sn_print("=== C Math Library Interop Test ===\n\n");
+    
+    double __sn__tolerance = 1.0000000000000001e-05;
+    double __sn__pi = 3.1415926535900001;
+    double __sn__sin_0 = sin(0.0);
+    double __sn__cos_0 = cos(0.0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sin(0) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__sin_0));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("cos(0) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__cos_0));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__approx_eq(__sn__sin_0, 0.0, __sn__tolerance))) {
+        sn_print("FAIL: sin(0) should be 0\n");
+        
+        return 1LL;}
+    if ((!__sn__approx_eq(__sn__cos_0, 1.0, __sn__tolerance))) {
+        sn_print("FAIL: cos(0) should be 1\n");
+        
+        return 1LL;}
+    double __sn__angle = sn_div_double(__sn__pi, 2.0);
+    double __sn__sin_90 = sin(__sn__angle);
+    double __sn__cos_90 = cos(__sn__angle);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sin(pi/2) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__sin_90));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("cos(pi/2) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__cos_90));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__approx_eq(__sn__sin_90, 1.0, __sn__tolerance))) {
+        sn_print("FAIL: sin(pi/2) should be 1\n");
+        
+        return 1LL;}
+    if ((!__sn__approx_eq(__sn__cos_90, 0.0, __sn__tolerance))) {
+        sn_print("FAIL: cos(pi/2) should be 0\n");
+        
+        return 1LL;}
+    double __sn__sqrt_4 = sqrt(4.0);
+    double __sn__sqrt_2 = sqrt(2.0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sqrt(4) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__sqrt_4));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sqrt(2) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__sqrt_2));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__approx_eq(__sn__sqrt_4, 2.0, __sn__tolerance))) {
+        sn_print("FAIL: sqrt(4) should be 2\n");
+        
+        return 1LL;}
+    if ((!__sn__approx_eq(__sn__sqrt_2, 1.41421, __sn__tolerance))) {
+        sn_print("FAIL: sqrt(2) should be ~1.41421\n");
+        
+        return 1LL;}
+    double __sn__pow_2_3 = pow(2.0, 3.0);
+    double __sn__pow_10_2 = pow(10.0, 2.0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("pow(2, 3) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__pow_2_3));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("pow(10, 2) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__pow_10_2));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__approx_eq(__sn__pow_2_3, 8.0, __sn__tolerance))) {
+        sn_print("FAIL: pow(2, 3) should be 8\n");
+        
+        return 1LL;}
+    if ((!__sn__approx_eq(__sn__pow_10_2, 100.0, __sn__tolerance))) {
+        sn_print("FAIL: pow(10, 2) should be 100\n");
+        
+        return 1LL;}
+    double __sn__abs_neg = fabs((-5.5));
+    double __sn__abs_pos = fabs(3.2999999999999998);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("fabs(-5.5) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__abs_neg));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("fabs(3.3) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__abs_pos));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__approx_eq(__sn__abs_neg, 5.5, __sn__tolerance))) {
+        sn_print("FAIL: fabs(-5.5) should be 5.5\n");
+        
+        return 1LL;}
+    if ((!__sn__approx_eq(__sn__abs_pos, 3.2999999999999998, __sn__tolerance))) {
+        sn_print("FAIL: fabs(3.3) should be 3.3\n");
+        
+        return 1LL;}
+    double __sn__floor_val = floor(2.7000000000000002);
+    double __sn__ceil_val = ceil(2.2999999999999998);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("floor(2.7) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__floor_val));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("ceil(2.3) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__ceil_val));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__approx_eq(__sn__floor_val, 2.0, __sn__tolerance))) {
+        sn_print("FAIL: floor(2.7) should be 2\n");
+        
+        return 1LL;}
+    if ((!__sn__approx_eq(__sn__ceil_val, 3.0, __sn__tolerance))) {
+        sn_print("FAIL: ceil(2.3) should be 3\n");
+        
+        return 1LL;}
+    double __sn__log_e = log(2.71828);
+    double __sn__log10_100 = log10(100.0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("log(e) ~ ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__log_e));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("log10(100) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__log10_100));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__approx_eq(__sn__log_e, 1.0, 0.0001))) {
+        sn_print("FAIL: log(e) should be ~1\n");
+        
+        return 1LL;}
+    if ((!__sn__approx_eq(__sn__log10_100, 2.0, __sn__tolerance))) {
+        sn_print("FAIL: log10(100) should be 2\n");
+        
+        return 1LL;}
+    double __sn__exp_1 = exp(1.0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("exp(1) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__exp_1));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__approx_eq(__sn__exp_1, 2.71828, 0.0001))) {
+        sn_print("FAIL: exp(1) should be ~2.71828\n");
+        
+        return 1LL;}
+    double __sn__tan_45 = tan(sn_div_double(__sn__pi, 4.0));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("tan(pi/4) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__tan_45));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__approx_eq(__sn__tan_45, 1.0, __sn__tolerance))) {
+        sn_print("FAIL: tan(pi/4) should be 1\n");
+        
+        return 1LL;}
+    sn_print("\n=== All math interop tests PASSED! ===\n");
+    
+    return 0LL;    fflush(stdout);
+}
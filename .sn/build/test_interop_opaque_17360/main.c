@@ -0,0 +1,181 @@
+#include "sn_types.h"
+
+
+
+void * * get_null_handle() {
+
+    return NULL;}
+
+bool is_handle_nil(void * * __sn__h) {
+
+    return (__sn__h == NULL);}
+
+void use_handle(void * * __sn__h) {
+
+    return;}
+
+void * * pass_through(void * * __sn__h) {
+
+    return __sn__h;}
+
+bool handles_equal(void * * __sn__a, void * * __sn__b) {
+
+    return (__sn__a == __sn__b);}
+
+bool test_nil_opaque() {
+
+    sn_print("  Testing nil opaque pointer handling...\n");
+    
+
+    void * * __sn__h = get_null_handle();
+
+    if ((__sn__h != NULL)) {
+        sn_print("    FAIL: get_null_handle() should return nil\n");
+        
+        return false;}
+
+    if ((!is_handle_nil(NULL))) {
+        sn_print("    FAIL: is_handle_nil(nil) should be true\n");
+        
+        return false;}
+
+    if ((!is_handle_nil(__sn__h))) {
+        sn_print("    FAIL: is_handle_nil(h) should be true for nil handle\n");
+        
+        return false;}
+
+    sn_print("    PASS: nil opaque pointer tests\n");
+    
+
+    return true;}
+
+bool test_opaque_passing() {
+
+    sn_print("  Testing opaque pointer passing...\n");
+    
+
+    void * * __sn__h = get_null_handle();
+
+    use_handle(__sn__h);
+    
+
+    use_handle(NULL);
+    
+
+    void * * __sn__passed = pass_through(NULL);
+
+    if ((__sn__passed != NULL)) {
+        sn_print("    FAIL: pass_through(nil) should return nil\n");
+        
+        return false;}
+
+    sn_print("    PASS: opaque pointer passing tests\n");
+    
+
+    return true;}
+
+bool test_opaque_comparison() {
+
+    sn_print("  Testing opaque pointer comparison...\n");
+    
+
+    if ((!handles_equal(NULL, NULL))) {
+        sn_print("    FAIL: nil == nil should be true\n");
+        
+        return false;}
+
+    void * * __sn__h1 = get_null_handle();
+
+    void * * __sn__h2 = get_null_handle();
+
+    if ((!handles_equal(__sn__h1, __sn__h2))) {
+        sn_print("    FAIL: Two nil handles should be equal\n");
+        
+        return false;}
+
+    if ((!handles_equal(__sn__h1, __sn__h1))) {
+        sn_print("    FAIL: Handle should equal itself\n");
+        
+        return false;}
+
+    sn_print("    PASS: opaque pointer comparison tests\n");
+    
+
+    return true;}
+
+bool test_opaque_in_native_fn() {
+
+    sn_print("  Testing opaque variable in native function...\n");
+    
+
+    void * * __sn__h = NULL;
+
+    (__sn__h = get_null_handle());
+    
+
+    if ((__sn__h != NULL)) {
+        sn_print("    FAIL: h should be nil\n");
+        
+        return false;}
+
+    use_handle(__sn__h);
+    
+
+    void * * __sn__passed = pass_through(__sn__h);
+
+    if ((__sn__passed != NULL)) {
+        sn_print("    FAIL: passed should be nil\n");
+        
+        return false;}
+
+    sn_print("    PASS: opaque variable tests\n");
+    
+
+    return true;}
+
+
+bool __sn__test_opaque_from_regular_fn() {
+
+    sn_print("  Testing opaque calls from regular function...\n");
+    
+
+    use_handle(get_null_handle());
+    
+
+    use_handle(NULL);
+    
+
+    bool __sn__is_nil = is_handle_nil(NULL);
+
+    if ((!__sn__is_nil)) {
+        sn_print("    FAIL: is_handle_nil(nil) should be true\n");
+        
+        return false;}
+
+    if ((!handles_equal(NULL, NULL))) {
+        sn_print("    FAIL: handles_equal(nil, nil) should be true\n");
+        
+        return false;}
+
+    sn_print("    PASS: regular function opaque tests\n");
+    
+
+    return true;}
+
+int main() {
+    sn_print("=== Opaque Type Interop Test ===\n\n");
+    
+    if ((!test_nil_opaque())) {
+        return 1LL;}
+    if ((!test_opaque_passing())) {
+        return 1LL;}
+    if ((!test_opaque_comparison())) {
+        return 1LL;}
+    if ((!test_opaque_in_native_fn())) {
+        return 1LL;}
+    if ((!__sn__test_opaque_from_regular_fn())) {
+        return 1LL;}
+    sn_print("\n=== All opaque type tests PASSED! ===\n");
+    
+    return 0LL;    fflush(stdout);
+}
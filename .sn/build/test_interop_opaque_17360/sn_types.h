@@ -0,0 +1,34 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+void * * get_null_handle();
+bool is_handle_nil(void * *);
+void use_handle(void * *);
+void * * pass_through(void * *);
+bool handles_equal(void * *, void * *);
+bool test_nil_opaque();
+bool test_opaque_passing();
+bool test_opaque_comparison();
+bool test_opaque_in_native_fn();
+bool __sn__test_opaque_from_regular_fn();
+
+
+
+
+#endif
@@ -0,0 +1,310 @@
+#include "sn_types.h"
+
+
+
+long long * get_nil_int_ptr() {
+
+    return NULL;}
+
+void * get_nil_void_ptr() {
+
+    return NULL;}
+
+bool is_ptr_nil(long long * __sn__p) {
+
+    return (__sn__p == NULL);}
+
+bool is_void_ptr_nil(void * __sn__p) {
+
+    return (__sn__p == NULL);}
+
+long long * get_static_int() {
+
+    return NULL;}
+
+unsigned char * get_mock_buffer() {
+
+    return NULL;}
+
+long long get_mock_buffer_len() {
+
+    return 10LL;}
+
+long long unwrap_int(long long * __sn__p) {
+
+    if ((__sn__p == NULL)) {
+        return (-999LL);}
+
+    return (*(__sn__p));}
+
+char * unwrap_char(char * __sn__p) {
+
+    if ((__sn__p == NULL)) {
+        return strdup("(nil)");}
+
+    return (__sn__p ? strdup(__sn__p) : NULL);}
+
+SnArray * unwrap_buffer_slice(unsigned char * __sn__p, long long __sn__len) {
+
+    if ((__sn__p == NULL)) {
+        return sn_array_from_ptr(__sn__p, 0LL, 0LL);}
+
+    return sn_array_from_ptr(__sn__p, 0LL, __sn__len);}
+
+void compute_stats(long long __sn__a, long long __sn__b, long long *__sn__sum, long long *__sn__product) {
+
+    (*__sn__sum = sn_add_long(__sn__a, __sn__b));
+    
+
+    (*__sn__product = sn_mul_long(__sn__a, __sn__b));
+    
+}
+
+void increment(long long *__sn__num) {
+
+    (*__sn__num = sn_add_long((*__sn__num), 1LL));
+    
+}
+
+void halve(double *__sn__num) {
+
+    (*__sn__num = sn_div_double((*__sn__num), 2.0));
+    
+}
+
+bool ptrs_equal(long long * __sn__a, long long * __sn__b) {
+
+    return (__sn__a == __sn__b);}
+
+bool ptrs_not_equal(long long * __sn__a, long long * __sn__b) {
+
+    return (__sn__a != __sn__b);}
+
+
+bool __sn__test_nil_pointers() {
+
+    sn_print("  Testing nil pointers...\n");
+    
+
+    if ((!is_ptr_nil(NULL))) {
+        sn_print("    FAIL: is_ptr_nil(nil) should be true\n");
+        
+        return false;}
+
+    if ((!is_void_ptr_nil(NULL))) {
+        sn_print("    FAIL: is_void_ptr_nil(nil) should be true\n");
+        
+        return false;}
+
+    sn_print("    PASS: nil pointer tests\n");
+    
+
+    return true;}
+
+bool test_pointer_variables() {
+
+    sn_print("  Testing pointer variables in native function...\n");
+    
+
+    long long * __sn__p = NULL;
+
+    void * __sn__vp = NULL;
+
+    long long * * __sn__pp = NULL;
+
+    if ((__sn__p != NULL)) {
+        sn_print("    FAIL: p should be nil\n");
+        
+        return false;}
+
+    if ((__sn__vp != NULL)) {
+        sn_print("    FAIL: vp should be nil\n");
+        
+        return false;}
+
+    if ((__sn__pp != NULL)) {
+        sn_print("    FAIL: pp should be nil\n");
+        
+        return false;}
+
+    long long * __sn__ptr = get_nil_int_ptr();
+
+    if ((__sn__ptr != NULL)) {
+        sn_print("    FAIL: get_nil_int_ptr() should return nil\n");
+        
+        return false;}
+
+    sn_print("    PASS: pointer variable tests\n");
+    
+
+    return true;}
+
+
+bool __sn__test_pointer_unwrap() {
+
+    sn_print("  Testing pointer unwrap with 'as val'...\n");
+    
+
+    long long __sn__result = unwrap_int(NULL);
+
+    if ((__sn__result != (-999LL))) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: unwrap_int(nil) returned ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected -999\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_auto_str char * __sn__s = unwrap_char(NULL);
+
+    if ((strcmp(__sn__s, "(nil)") != 0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: unwrap_char(nil) returned '");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__s);
+                sn_auto_str char *__is_p2__ = sn_strdup("', expected '(nil)'\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_auto_arr SnArray * __sn__buf = unwrap_buffer_slice(NULL, 0LL);
+
+    if ((sn_array_length(__sn__buf) != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: unwrap_buffer_slice(nil, 0) length = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__buf)));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 0\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("    PASS: pointer unwrap tests\n");
+    
+
+    return true;}
+
+
+bool __sn__test_out_params() {
+
+    sn_print("  Testing 'as ref' out-parameters...\n");
+    
+
+    long long __sn__sum = 0LL;
+
+    long long __sn__product = 0LL;
+
+    compute_stats(7LL, 6LL, &__sn__sum, &__sn__product);
+    
+
+    if ((__sn__sum != 13LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: sum = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 13\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    if ((__sn__product != 42LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: product = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__product));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 42\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    long long __sn__counter = 10LL;
+
+    increment(&__sn__counter);
+    
+
+    increment(&__sn__counter);
+    
+
+    increment(&__sn__counter);
+    
+
+    if ((__sn__counter != 13LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: counter = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__counter));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 13\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    double __sn__half = 100.0;
+
+    halve(&__sn__half);
+    
+
+    if (sn_lt_double(__sn__half, 49.899999999999999)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: half = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__half));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected ~50.0\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    if (sn_gt_double(__sn__half, 50.100000000000001)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("    FAIL: half = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__half));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected ~50.0\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("    PASS: out-parameter tests\n");
+    
+
+    return true;}
+
+
+bool __sn__test_pointer_comparison() {
+
+    sn_print("  Testing pointer comparisons...\n");
+    
+
+    if ((!ptrs_equal(NULL, NULL))) {
+        sn_print("    FAIL: nil == nil should be true\n");
+        
+        return false;}
+
+    if (ptrs_not_equal(NULL, NULL)) {
+        sn_print("    FAIL: nil != nil should be false\n");
+        
+        return false;}
+
+    sn_print("    PASS: pointer comparison tests\n");
+    
+
+    return true;}
+
+int main() {
+    sn_print("=== Pointer Operations Interop Test ===\n\n");
+    
+    if ((!__sn__test_nil_pointers())) {
+        return 1LL;}
+    if ((!test_pointer_variables())) {
+        return 1LL;}
+    if ((!__sn__test_pointer_unwrap())) {
+        return 1LL;}
+    if ((!__sn__test_out_params())) {
+        return 1LL;}
+    if ((!__sn__test_pointer_comparison())) {
+        return 1LL;}
+    sn_print("\n=== All pointer interop tests PASSED! ===\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,46 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+#include <stdlib.h>
+#include <string.h>
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long * get_nil_int_ptr();
+void * get_nil_void_ptr();
+bool is_ptr_nil(long long *);
+bool is_void_ptr_nil(void *);
+long long * get_static_int();
+unsigned char * get_mock_buffer();
+long long get_mock_buffer_len();
+long long unwrap_int(long long *);
+char * unwrap_char(char *);
+SnArray * unwrap_buffer_slice(unsigned char *, long long);
+void compute_stats(long long, long long, long long *, long long *);
+void increment(long long *);
+void halve(double *);
+bool ptrs_equal(long long *, long long *);
+bool ptrs_not_equal(long long *, long long *);
+bool __sn__test_nil_pointers();
+bool test_pointer_variables();
+bool __sn__test_pointer_unwrap();
+bool __sn__test_out_params();
+bool __sn__test_pointer_comparison();
+
+
+
+
+#endif
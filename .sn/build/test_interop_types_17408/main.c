@@ -0,0 +1,127 @@
+#include "sn_types.h"
+
+
+
+
+int32_t __sn__add_int32(int32_t __sn__a, int32_t __sn__b) {
+
+    return sn_add_int32(__sn__a, __sn__b);}
+
+
+uint64_t __sn__add_uint(uint64_t __sn__a, uint64_t __sn__b) {
+
+    return sn_add_uint(__sn__a, __sn__b);}
+
+
+uint32_t __sn__add_uint32(uint32_t __sn__a, uint32_t __sn__b) {
+
+    return sn_add_uint32(__sn__a, __sn__b);}
+
+
+float __sn__add_float(float __sn__a, float __sn__b) {
+
+    return sn_add_float(__sn__a, __sn__b);}
+
+int main() {
+    int32_t __sn__i32a = 100LL;
+    int32_t __sn__i32b = 50LL;
+    int32_t __sn__i32sum = __sn__add_int32(__sn__i32a, __sn__i32b);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("int32: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i32a));
+            sn_auto_str char *__is_p2__ = sn_strdup(" + ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__i32b));
+            sn_auto_str char *__is_p4__ = sn_strdup(" = ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__i32sum));
+            sn_auto_str char *__is_p6__ = sn_strdup("\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    uint64_t __sn__u64a = 1000000LL;
+    uint64_t __sn__u64b = 500000LL;
+    uint64_t __sn__u64sum = __sn__add_uint(__sn__u64a, __sn__u64b);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("uint: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__u64a));
+            sn_auto_str char *__is_p2__ = sn_strdup(" + ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__u64b));
+            sn_auto_str char *__is_p4__ = sn_strdup(" = ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__u64sum));
+            sn_auto_str char *__is_p6__ = sn_strdup("\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    uint32_t __sn__u32a = 65535LL;
+    uint32_t __sn__u32b = 1LL;
+    uint32_t __sn__u32sum = __sn__add_uint32(__sn__u32a, __sn__u32b);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("uint32: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__u32a));
+            sn_auto_str char *__is_p2__ = sn_strdup(" + ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__u32b));
+            sn_auto_str char *__is_p4__ = sn_strdup(" = ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__u32sum));
+            sn_auto_str char *__is_p6__ = sn_strdup("\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    float __sn__fa = 3.1400000000000001;
+    float __sn__fb = 2.8599999999999999;
+    float __sn__fsum = __sn__add_float(__sn__fa, __sn__fb);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("float: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__fa));
+            sn_auto_str char *__is_p2__ = sn_strdup(" + ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__fb));
+            sn_auto_str char *__is_p4__ = sn_strdup(" = ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%.5f", (double)(__sn__fsum));
+            sn_auto_str char *__is_p6__ = sn_strdup("\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    (__sn__i32a = 200LL);
+    
+    (__sn__u64a = 2000000LL);
+    
+    (__sn__u32a = 100000LL);
+    
+    (__sn__fa = 1.5);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After reassignment: i32=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i32a));
+            sn_auto_str char *__is_p2__ = sn_strdup(", u64=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__u64a));
+            sn_auto_str char *__is_p4__ = sn_strdup(", u32=");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__u32a));
+            sn_auto_str char *__is_p6__ = sn_strdup(", f=");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%.5f", (double)(__sn__fa));
+            sn_auto_str char *__is_p8__ = sn_strdup("\n");
+            sn_str_concat_multi(9, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__);
+        }); sn_print(__ps__); };
+    
+    int32_t __sn__i32two = 2LL;
+    int32_t __sn__i32mul = sn_mul_int32(__sn__i32a, __sn__i32two);
+    uint64_t __sn__u64three = 3LL;
+    uint64_t __sn__u64mul = sn_mul_uint(__sn__u64a, __sn__u64three);
+    uint32_t __sn__u32four = 4LL;
+    uint32_t __sn__u32mul = sn_mul_uint32(__sn__u32a, __sn__u32four);
+    float __sn__fmul = sn_mul_double(__sn__fa, 2.0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Multiply: i32=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i32mul));
+            sn_auto_str char *__is_p2__ = sn_strdup(", u64=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__u64mul));
+            sn_auto_str char *__is_p4__ = sn_strdup(", u32=");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__u32mul));
+            sn_auto_str char *__is_p6__ = sn_strdup(", f=");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%.5f", (double)(__sn__fmul));
+            sn_auto_str char *__is_p8__ = sn_strdup("\n");
+            sn_str_concat_multi(9, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__);
+        }); sn_print(__ps__); };
+    
+    sn_print("All interop type tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+int32_t __sn__add_int32(int32_t, int32_t);
+uint64_t __sn__add_uint(uint64_t, uint64_t);
+uint32_t __sn__add_uint32(uint32_t, uint32_t);
+float __sn__add_float(float, float);
+
+
+
+
+#endif
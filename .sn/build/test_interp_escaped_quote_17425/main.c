@@ -0,0 +1,29 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__getHeader(char * __sn__name) {
+
+    return sn_str_concat("VALUE:", __sn__name);}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Result: ");
+            sn_auto_str char *__is_p1__ = __sn__getHeader("Content-Type");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__x = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Header: ");
+            sn_auto_str char *__is_p1__ = __sn__getHeader("Accept");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });
+    sn_print(__sn__x);
+    
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
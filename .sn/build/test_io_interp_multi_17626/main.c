@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = 1LL;
+    long long __sn__b = 2LL;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__a));
+            sn_auto_str char *__is_p1__ = sn_strdup(" + ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__b));
+            sn_auto_str char *__is_p3__ = sn_strdup(" = ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)(sn_add_long(__sn__a, __sn__b)));
+            sn_auto_str char *__is_p5__ = sn_strdup("\n");
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,18 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 10LL;
+    long long __sn__y = 3LL;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_div_long(__sn__x, __sn__y)));
+            sn_auto_str char *__is_p1__ = sn_strdup(" remainder ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(sn_mod_long(__sn__x, __sn__y)));
+            sn_auto_str char *__is_p3__ = sn_strdup("\n");
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
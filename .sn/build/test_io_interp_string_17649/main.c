@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__name = strdup("Alice");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hello, ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("!\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
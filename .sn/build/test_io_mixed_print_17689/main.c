@@ -0,0 +1,19 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("start ");
+    
+    long long __sn__x = 42LL;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    sn_print("end\n");
+    
+    fflush(stdout);
+    return 0;
+}
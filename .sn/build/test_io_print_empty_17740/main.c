@@ -0,0 +1,12 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("");
+    
+    sn_print("done\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,14 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("line1\n");
+    
+    sn_print("line2\n");
+    
+    sn_print("line3\n");
+    
+    fflush(stdout);
+    return 0;
+}
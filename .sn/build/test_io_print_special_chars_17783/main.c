@@ -0,0 +1,10 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("a\nb\nc\n");
+    
+    fflush(stdout);
+    return 0;
+}
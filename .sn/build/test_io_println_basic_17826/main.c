@@ -0,0 +1,10 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_println("hello world");
+    
+    fflush(stdout);
+    return 0;
+}
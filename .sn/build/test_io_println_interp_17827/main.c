@@ -0,0 +1,15 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 42LL;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("value is ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,322 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__RangeIter_hasNext(__sn__RangeIter *__sn__self) {
+
+    return sn_lt_long(__sn__self->__sn__current, __sn__self->__sn__end);}
+
+long long __sn__RangeIter_next(__sn__RangeIter *__sn__self) {
+
+    long long __sn__v = __sn__self->__sn__current;
+
+    (__sn__self->__sn__current = sn_add_long(__sn__self->__sn__current, 1LL));
+    
+
+    return __sn__v;}
+
+
+__sn__RangeIter __sn__Range_iter(__sn__Range *__sn__self) {
+
+    return (__sn__RangeIter){ .__sn__current = __sn__self->__sn__start, .__sn__end = __sn__self->__sn__end };}
+
+
+
+bool __sn__PointListIter_hasNext(__sn__PointListIter *__sn__self) {
+
+    return sn_lt_long(__sn__self->__sn__index, sn_array_length(__sn__self->__sn__items));}
+
+__sn__Point __sn__PointListIter_next(__sn__PointListIter *__sn__self) {
+
+    __sn__Point __sn__p = (((__sn__Point *)__sn__self->__sn__items->data)[({ long long __ai__ = __sn__self->__sn__index; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]);
+
+    (__sn__self->__sn__index = sn_add_long(__sn__self->__sn__index, 1LL));
+    
+
+    return __sn__p;}
+
+
+__sn__PointListIter __sn__PointList_iter(__sn__PointList *__sn__self) {
+
+    return (__sn__PointListIter){ .__sn__items = sn_array_copy(__sn__self->__sn__items), .__sn__index = 0LL };}
+
+
+__sn__ArrayIter_int __sn__Sequence_int_iter(__sn__Sequence_int *__sn__self) {
+
+    return (__sn__ArrayIter_int){ .__sn__items = sn_array_copy(__sn__self->__sn__items), .__sn__index = 0LL };}
+
+
+bool __sn__ArrayIter_int_hasNext(__sn__ArrayIter_int *__sn__self) {
+
+    return sn_lt_long(__sn__self->__sn__index, sn_array_length(__sn__self->__sn__items));}
+
+long long __sn__ArrayIter_int_next(__sn__ArrayIter_int *__sn__self) {
+
+    long long __sn__v = (((long long *)__sn__self->__sn__items->data)[({ long long __ai__ = __sn__self->__sn__index; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]);
+
+    (__sn__self->__sn__index = sn_add_long(__sn__self->__sn__index, 1LL));
+    
+
+    return __sn__v;}
+
+
+__sn__ArrayIter_str __sn__Sequence_str_iter(__sn__Sequence_str *__sn__self) {
+
+    return (__sn__ArrayIter_str){ .__sn__items = sn_array_copy(__sn__self->__sn__items), .__sn__index = 0LL };}
+
+
+bool __sn__ArrayIter_str_hasNext(__sn__ArrayIter_str *__sn__self) {
+
+    return sn_lt_long(__sn__self->__sn__index, sn_array_length(__sn__self->__sn__items));}
+
+char * __sn__ArrayIter_str_next(__sn__ArrayIter_str *__sn__self) {
+
+    sn_auto_str char * __sn__v = strdup((((char * *)__sn__self->__sn__items->data)[({ long long __ai__ = __sn__self->__sn__index; __ai__ < 0 ? __ai__ + __sn__self->__sn__items->len : __ai__; })]));
+
+    (__sn__self->__sn__index = sn_add_long(__sn__self->__sn__index, 1LL));
+    
+
+    {
+        char * __ret__ = __sn__v;
+        __sn__v = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    __sn__Range __sn__r = (__sn__Range){ .__sn__start = 0LL, .__sn__end = 5LL };
+    long long __sn__sum = 0LL;
+    {
+        __sn__RangeIter __sn_iter__ = __sn__Range_iter(&(__sn__r));
+        while (__sn__RangeIter_hasNext(&__sn_iter__)) {
+            long long __sn__x = __sn__RangeIter_next(&__sn_iter__);
+            {
+                (__sn__sum = sn_add_long(__sn__sum, __sn__x));
+                
+            }
+        }
+    }
+    if ((__sn__sum != 10LL)) {
+        sn_print("FAIL: Range sum should be 10, got ");
+        
+        printf("%lld", (long long)(__sn__sum));
+        
+        sn_print("\n");
+        
+        return 1LL;}
+    sn_print("Test 1 passed: Range iteration (0+1+2+3+4 = 10)\n");
+    
+    __sn__Range __sn__r2 = (__sn__Range){ .__sn__start = 3LL, .__sn__end = 6LL };
+    long long __sn__sum2 = 0LL;
+    {
+        __sn__RangeIter __sn_iter__ = __sn__Range_iter(&(__sn__r2));
+        while (__sn__RangeIter_hasNext(&__sn_iter__)) {
+            long long __sn__x = __sn__RangeIter_next(&__sn_iter__);
+            {
+                (__sn__sum2 = sn_add_long(__sn__sum2, __sn__x));
+                
+            }
+        }
+    }
+    if ((__sn__sum2 != 12LL)) {
+        sn_print("FAIL: Range(3,6) sum should be 12\n");
+        
+        return 1LL;}
+    sn_print("Test 2 passed: Range(3,6) iteration (3+4+5 = 12)\n");
+    
+    __sn__Range __sn__r3 = (__sn__Range){ .__sn__start = 5LL, .__sn__end = 5LL };
+    long long __sn__count = 0LL;
+    {
+        __sn__RangeIter __sn_iter__ = __sn__Range_iter(&(__sn__r3));
+        while (__sn__RangeIter_hasNext(&__sn_iter__)) {
+            long long __sn__x = __sn__RangeIter_next(&__sn_iter__);
+            {
+                (__sn__count = sn_add_long(__sn__count, 1LL));
+                
+            }
+        }
+    }
+    if ((__sn__count != 0LL)) {
+        sn_print("FAIL: Empty range should iterate 0 times\n");
+        
+        return 1LL;}
+    sn_print("Test 3 passed: Empty range (no iterations)\n");
+    
+    sn_auto_PointList __sn__PointList __sn__pts = (__sn__PointList){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 1LL, .__sn__y = 2LL }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 3LL, .__sn__y = 4LL }));
+            __al__;
+        }) };
+    long long __sn__xsum = 0LL;
+    {
+        sn_auto_PointListIter __sn__PointListIter __sn_iter__ = __sn__PointList_iter(&(__sn__pts));
+        while (__sn__PointListIter_hasNext(&__sn_iter__)) {
+            __sn__Point __sn__p = __sn__PointListIter_next(&__sn_iter__);
+            {
+                (__sn__xsum = sn_add_long(__sn__xsum, __sn__p.__sn__x));
+                
+            }
+        }
+    }
+    if ((__sn__xsum != 4LL)) {
+        sn_print("FAIL: PointList x-sum should be 4\n");
+        
+        return 1LL;}
+    sn_print("Test 4 passed: PointList iteration (struct elements)\n");
+    
+    __sn__Range __sn__outer = (__sn__Range){ .__sn__start = 0LL, .__sn__end = 3LL };
+    long long __sn__inner_sum = 0LL;
+    {
+        __sn__RangeIter __sn_iter__ = __sn__Range_iter(&(__sn__outer));
+        while (__sn__RangeIter_hasNext(&__sn_iter__)) {
+            long long __sn__i = __sn__RangeIter_next(&__sn_iter__);
+            {
+                __sn__Range __sn__inner = (__sn__Range){ .__sn__start = 0LL, .__sn__end = 3LL };
+                {
+                    __sn__RangeIter __sn_iter__ = __sn__Range_iter(&(__sn__inner));
+                    while (__sn__RangeIter_hasNext(&__sn_iter__)) {
+                        long long __sn__j = __sn__RangeIter_next(&__sn_iter__);
+                        {
+                            (__sn__inner_sum = sn_add_long(sn_add_long(__sn__inner_sum, sn_mul_long(__sn__i, 10LL)), __sn__j));
+                            
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if ((__sn__inner_sum != 99LL)) {
+        sn_print("FAIL: Nested iteration sum should be 99, got ");
+        
+        printf("%lld", (long long)(__sn__inner_sum));
+        
+        sn_print("\n");
+        
+        return 1LL;}
+    sn_print("Test 5 passed: Nested iterator loops\n");
+    
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            __al__;
+        });
+    long long __sn__arr_sum = 0LL;
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__a = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                (__sn__arr_sum = sn_add_long(__sn__arr_sum, __sn__a));
+                
+            }
+        }
+    }
+    __sn__Range __sn__r6 = (__sn__Range){ .__sn__start = 1LL, .__sn__end = 4LL };
+    long long __sn__range_sum = 0LL;
+    {
+        __sn__RangeIter __sn_iter__ = __sn__Range_iter(&(__sn__r6));
+        while (__sn__RangeIter_hasNext(&__sn_iter__)) {
+            long long __sn__b = __sn__RangeIter_next(&__sn_iter__);
+            {
+                (__sn__range_sum = sn_add_long(__sn__range_sum, __sn__b));
+                
+            }
+        }
+    }
+    if ((__sn__arr_sum != 60LL)) {
+        sn_print("FAIL: Array sum should be 60\n");
+        
+        return 1LL;}
+    if ((__sn__range_sum != 6LL)) {
+        sn_print("FAIL: Range sum should be 6\n");
+        
+        return 1LL;}
+    sn_print("Test 6 passed: Mixed array and iterator for-each\n");
+    
+    __sn__Range __sn__r7 = (__sn__Range){ .__sn__start = 0LL, .__sn__end = 100LL };
+    long long __sn__sum7 = 0LL;
+    {
+        __sn__RangeIter __sn_iter__ = __sn__Range_iter(&(__sn__r7));
+        while (__sn__RangeIter_hasNext(&__sn_iter__)) {
+            long long __sn__x = __sn__RangeIter_next(&__sn_iter__);
+            {
+                if ((__sn__x >= 5LL)) {
+                    break;
+                }
+                (__sn__sum7 = sn_add_long(__sn__sum7, __sn__x));
+                
+            }
+        }
+    }
+    if ((__sn__sum7 != 10LL)) {
+        sn_print("FAIL: Break sum should be 10\n");
+        
+        return 1LL;}
+    sn_print("Test 7 passed: break inside iterator loop\n");
+    
+    sn_auto_Sequence_int __sn__Sequence_int __sn__seq = (__sn__Sequence_int){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            __al__;
+        }) };
+    long long __sn__sum8 = 0LL;
+    {
+        sn_auto_ArrayIter_int __sn__ArrayIter_int __sn_iter__ = __sn__Sequence_int_iter(&(__sn__seq));
+        while (__sn__ArrayIter_int_hasNext(&__sn_iter__)) {
+            long long __sn__item = __sn__ArrayIter_int_next(&__sn_iter__);
+            {
+                (__sn__sum8 = sn_add_long(__sn__sum8, __sn__item));
+                
+            }
+        }
+    }
+    if ((__sn__sum8 != 60LL)) {
+        sn_print("FAIL: Sequence<int> sum should be 60\n");
+        
+        return 1LL;}
+    sn_print("Test 8 passed: Sequence<int> (generic iterator)\n");
+    
+    sn_auto_Sequence_str __sn__Sequence_str __sn__words = (__sn__Sequence_str){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("hello") });
+            sn_array_push(__al__, &(char *){ strdup("world") });
+            sn_array_push(__al__, &(char *){ strdup("!") });
+            __al__;
+        }) };
+    long long __sn__wcount = 0LL;
+    {
+        sn_auto_ArrayIter_str __sn__ArrayIter_str __sn_iter__ = __sn__Sequence_str_iter(&(__sn__words));
+        while (__sn__ArrayIter_str_hasNext(&__sn_iter__)) {
+            sn_auto_str char * __sn__w = __sn__ArrayIter_str_next(&__sn_iter__);
+            {
+                (__sn__wcount = sn_add_long(__sn__wcount, 1LL));
+                
+            }
+        }
+    }
+    if ((__sn__wcount != 3LL)) {
+        sn_print("FAIL: Sequence<str> should have 3 items\n");
+        
+        return 1LL;}
+    sn_print("Test 9 passed: Sequence<str> (generic iterator)\n");
+    
+    sn_print("All iterator protocol tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,510 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: RangeIter (as val) */
+typedef struct {
+    long long __sn__current;
+    long long __sn__end;
+} __sn__RangeIter;
+/* Value operations */
+static inline __sn__RangeIter __sn__RangeIter_copy(const __sn__RangeIter *src) {
+    __sn__RangeIter dst;
+    dst.__sn__current = src->__sn__current;
+    dst.__sn__end = src->__sn__end;
+    return dst;
+}
+
+static inline void __sn__RangeIter_cleanup(__sn__RangeIter *p) {
+
+}
+
+#define sn_auto_RangeIter __attribute__((cleanup(__sn__RangeIter_cleanup)))
+
+static inline void __sn__RangeIter_cleanup_elem(void *p) { __sn__RangeIter_cleanup((__sn__RangeIter *)p); }
+static inline void __sn__RangeIter_copy_into(const void *src, void *dst) { *(__sn__RangeIter *)dst = __sn__RangeIter_copy((const __sn__RangeIter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__RangeIter *__sn__RangeIter_alloc(void) {
+    return calloc(1, sizeof(__sn__RangeIter));
+}
+
+static inline void __sn__RangeIter_release(__sn__RangeIter **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_RangeIter __attribute__((cleanup(__sn__RangeIter_release)))
+
+static inline void __sn__RangeIter_release_elem(void *p) { __sn__RangeIter_release((__sn__RangeIter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__RangeIter_to_string(const __sn__RangeIter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "RangeIter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "current: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__current);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "end: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__end);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Range (as val) */
+typedef struct {
+    long long __sn__start;
+    long long __sn__end;
+} __sn__Range;
+/* Value operations */
+static inline __sn__Range __sn__Range_copy(const __sn__Range *src) {
+    __sn__Range dst;
+    dst.__sn__start = src->__sn__start;
+    dst.__sn__end = src->__sn__end;
+    return dst;
+}
+
+static inline void __sn__Range_cleanup(__sn__Range *p) {
+
+}
+
+#define sn_auto_Range __attribute__((cleanup(__sn__Range_cleanup)))
+
+static inline void __sn__Range_cleanup_elem(void *p) { __sn__Range_cleanup((__sn__Range *)p); }
+static inline void __sn__Range_copy_into(const void *src, void *dst) { *(__sn__Range *)dst = __sn__Range_copy((const __sn__Range *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Range *__sn__Range_alloc(void) {
+    return calloc(1, sizeof(__sn__Range));
+}
+
+static inline void __sn__Range_release(__sn__Range **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Range __attribute__((cleanup(__sn__Range_release)))
+
+static inline void __sn__Range_release_elem(void *p) { __sn__Range_release((__sn__Range **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Range_to_string(const __sn__Range *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Range { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "start: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__start);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "end: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__end);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: PointListIter (as val) */
+typedef struct {
+    SnArray * __sn__items;
+    long long __sn__index;
+} __sn__PointListIter;
+/* Value operations */
+static inline __sn__PointListIter __sn__PointListIter_copy(const __sn__PointListIter *src) {
+    __sn__PointListIter dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    dst.__sn__index = src->__sn__index;
+    return dst;
+}
+
+static inline void __sn__PointListIter_cleanup(__sn__PointListIter *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_PointListIter __attribute__((cleanup(__sn__PointListIter_cleanup)))
+
+static inline void __sn__PointListIter_cleanup_elem(void *p) { __sn__PointListIter_cleanup((__sn__PointListIter *)p); }
+static inline void __sn__PointListIter_copy_into(const void *src, void *dst) { *(__sn__PointListIter *)dst = __sn__PointListIter_copy((const __sn__PointListIter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__PointListIter *__sn__PointListIter_alloc(void) {
+    return calloc(1, sizeof(__sn__PointListIter));
+}
+
+static inline void __sn__PointListIter_release(__sn__PointListIter **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_PointListIter __attribute__((cleanup(__sn__PointListIter_release)))
+
+static inline void __sn__PointListIter_release_elem(void *p) { __sn__PointListIter_release((__sn__PointListIter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__PointListIter_to_string(const __sn__PointListIter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "PointListIter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "index: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__index);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: PointList (as val) */
+typedef struct {
+    SnArray * __sn__items;
+} __sn__PointList;
+/* Value operations */
+static inline __sn__PointList __sn__PointList_copy(const __sn__PointList *src) {
+    __sn__PointList dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    return dst;
+}
+
+static inline void __sn__PointList_cleanup(__sn__PointList *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_PointList __attribute__((cleanup(__sn__PointList_cleanup)))
+
+static inline void __sn__PointList_cleanup_elem(void *p) { __sn__PointList_cleanup((__sn__PointList *)p); }
+static inline void __sn__PointList_copy_into(const void *src, void *dst) { *(__sn__PointList *)dst = __sn__PointList_copy((const __sn__PointList *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__PointList *__sn__PointList_alloc(void) {
+    return calloc(1, sizeof(__sn__PointList));
+}
+
+static inline void __sn__PointList_release(__sn__PointList **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_PointList __attribute__((cleanup(__sn__PointList_release)))
+
+static inline void __sn__PointList_release_elem(void *p) { __sn__PointList_release((__sn__PointList **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__PointList_to_string(const __sn__PointList *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "PointList { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Sequence_int (as val) */
+typedef struct {
+    SnArray * __sn__items;
+} __sn__Sequence_int;
+/* Value operations */
+static inline __sn__Sequence_int __sn__Sequence_int_copy(const __sn__Sequence_int *src) {
+    __sn__Sequence_int dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    return dst;
+}
+
+static inline void __sn__Sequence_int_cleanup(__sn__Sequence_int *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_Sequence_int __attribute__((cleanup(__sn__Sequence_int_cleanup)))
+
+static inline void __sn__Sequence_int_cleanup_elem(void *p) { __sn__Sequence_int_cleanup((__sn__Sequence_int *)p); }
+static inline void __sn__Sequence_int_copy_into(const void *src, void *dst) { *(__sn__Sequence_int *)dst = __sn__Sequence_int_copy((const __sn__Sequence_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Sequence_int *__sn__Sequence_int_alloc(void) {
+    return calloc(1, sizeof(__sn__Sequence_int));
+}
+
+static inline void __sn__Sequence_int_release(__sn__Sequence_int **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Sequence_int __attribute__((cleanup(__sn__Sequence_int_release)))
+
+static inline void __sn__Sequence_int_release_elem(void *p) { __sn__Sequence_int_release((__sn__Sequence_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Sequence_int_to_string(const __sn__Sequence_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Sequence_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: ArrayIter_int (as val) */
+typedef struct {
+    SnArray * __sn__items;
+    long long __sn__index;
+} __sn__ArrayIter_int;
+/* Value operations */
+static inline __sn__ArrayIter_int __sn__ArrayIter_int_copy(const __sn__ArrayIter_int *src) {
+    __sn__ArrayIter_int dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    dst.__sn__index = src->__sn__index;
+    return dst;
+}
+
+static inline void __sn__ArrayIter_int_cleanup(__sn__ArrayIter_int *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_ArrayIter_int __attribute__((cleanup(__sn__ArrayIter_int_cleanup)))
+
+static inline void __sn__ArrayIter_int_cleanup_elem(void *p) { __sn__ArrayIter_int_cleanup((__sn__ArrayIter_int *)p); }
+static inline void __sn__ArrayIter_int_copy_into(const void *src, void *dst) { *(__sn__ArrayIter_int *)dst = __sn__ArrayIter_int_copy((const __sn__ArrayIter_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__ArrayIter_int *__sn__ArrayIter_int_alloc(void) {
+    return calloc(1, sizeof(__sn__ArrayIter_int));
+}
+
+static inline void __sn__ArrayIter_int_release(__sn__ArrayIter_int **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_ArrayIter_int __attribute__((cleanup(__sn__ArrayIter_int_release)))
+
+static inline void __sn__ArrayIter_int_release_elem(void *p) { __sn__ArrayIter_int_release((__sn__ArrayIter_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__ArrayIter_int_to_string(const __sn__ArrayIter_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "ArrayIter_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "index: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__index);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Sequence_str (as val) */
+typedef struct {
+    SnArray * __sn__items;
+} __sn__Sequence_str;
+/* Value operations */
+static inline __sn__Sequence_str __sn__Sequence_str_copy(const __sn__Sequence_str *src) {
+    __sn__Sequence_str dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    return dst;
+}
+
+static inline void __sn__Sequence_str_cleanup(__sn__Sequence_str *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_Sequence_str __attribute__((cleanup(__sn__Sequence_str_cleanup)))
+
+static inline void __sn__Sequence_str_cleanup_elem(void *p) { __sn__Sequence_str_cleanup((__sn__Sequence_str *)p); }
+static inline void __sn__Sequence_str_copy_into(const void *src, void *dst) { *(__sn__Sequence_str *)dst = __sn__Sequence_str_copy((const __sn__Sequence_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Sequence_str *__sn__Sequence_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Sequence_str));
+}
+
+static inline void __sn__Sequence_str_release(__sn__Sequence_str **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Sequence_str __attribute__((cleanup(__sn__Sequence_str_release)))
+
+static inline void __sn__Sequence_str_release_elem(void *p) { __sn__Sequence_str_release((__sn__Sequence_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Sequence_str_to_string(const __sn__Sequence_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Sequence_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: ArrayIter_str (as val) */
+typedef struct {
+    SnArray * __sn__items;
+    long long __sn__index;
+} __sn__ArrayIter_str;
+/* Value operations */
+static inline __sn__ArrayIter_str __sn__ArrayIter_str_copy(const __sn__ArrayIter_str *src) {
+    __sn__ArrayIter_str dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    dst.__sn__index = src->__sn__index;
+    return dst;
+}
+
+static inline void __sn__ArrayIter_str_cleanup(__sn__ArrayIter_str *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_ArrayIter_str __attribute__((cleanup(__sn__ArrayIter_str_cleanup)))
+
+static inline void __sn__ArrayIter_str_cleanup_elem(void *p) { __sn__ArrayIter_str_cleanup((__sn__ArrayIter_str *)p); }
+static inline void __sn__ArrayIter_str_copy_into(const void *src, void *dst) { *(__sn__ArrayIter_str *)dst = __sn__ArrayIter_str_copy((const __sn__ArrayIter_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__ArrayIter_str *__sn__ArrayIter_str_alloc(void) {
+    return calloc(1, sizeof(__sn__ArrayIter_str));
+}
+
+static inline void __sn__ArrayIter_str_release(__sn__ArrayIter_str **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_ArrayIter_str __attribute__((cleanup(__sn__ArrayIter_str_release)))
+
+static inline void __sn__ArrayIter_str_release_elem(void *p) { __sn__ArrayIter_str_release((__sn__ArrayIter_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__ArrayIter_str_to_string(const __sn__ArrayIter_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "ArrayIter_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "index: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__index);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+bool __sn__RangeIter_hasNext(__sn__RangeIter *);
+long long __sn__RangeIter_next(__sn__RangeIter *);
+__sn__RangeIter __sn__Range_iter(__sn__Range *);
+bool __sn__PointListIter_hasNext(__sn__PointListIter *);
+__sn__Point __sn__PointListIter_next(__sn__PointListIter *);
+__sn__PointListIter __sn__PointList_iter(__sn__PointList *);
+__sn__ArrayIter_int __sn__Sequence_int_iter(__sn__Sequence_int *);
+bool __sn__ArrayIter_int_hasNext(__sn__ArrayIter_int *);
+long long __sn__ArrayIter_int_next(__sn__ArrayIter_int *);
+__sn__ArrayIter_str __sn__Sequence_str_iter(__sn__Sequence_str *);
+bool __sn__ArrayIter_str_hasNext(__sn__ArrayIter_str *);
+char * __sn__ArrayIter_str_next(__sn__ArrayIter_str *);
+
+
+
+#endif
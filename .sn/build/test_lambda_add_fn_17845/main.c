@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_fn void * __sn__add = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long, long long))((__Closure__ *)__sn__add)->fn)(__sn__add, 10LL, 20LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
+
+static long long __lambda_0__(void *__closure__, long long __sn__a, long long __sn__b) {
+    return sn_add_long(__sn__a, __sn__b);
+}
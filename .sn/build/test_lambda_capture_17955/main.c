@@ -0,0 +1,71 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 10LL;
+    long long __sn__y = 20LL;
+    sn_auto_fn void * __sn__addXY = ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->x = __sn__x;
+        __cl__->y = __sn__y;
+        __cl__;
+    });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sum with z=5: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__addXY)->fn)(__sn__addXY, 5LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sum with z=100: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__addXY)->fn)(__sn__addXY, 100LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__multiplier = 3LL;
+    sn_auto_fn void * __sn__times = ({
+        __closure_1__ *__cl__ = malloc(sizeof(__closure_1__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__closure_1__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->multiplier = __sn__multiplier;
+        __cl__;
+    });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Times 4 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__times)->fn)(__sn__times, 4LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Times 7 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__times)->fn)(__sn__times, 7LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
+
+static long long __lambda_0__(void *__closure__, long long __sn__z) {
+
+    long long __sn__x = ((__closure_0__ *)__closure__)->x;
+
+    long long __sn__y = ((__closure_0__ *)__closure__)->y;
+    return sn_add_long(sn_add_long(__sn__x, __sn__y), __sn__z);
+}
+
+static long long __lambda_1__(void *__closure__, long long __sn__n) {
+
+    long long __sn__multiplier = ((__closure_1__ *)__closure__)->multiplier;
+    return sn_mul_long(__sn__n, __sn__multiplier);
+}
@@ -0,0 +1,41 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+
+
+
+typedef struct __closure_0__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    long long x;
+    long long y;
+} __closure_0__;
+static long long __lambda_0__(void *__closure__, long long __sn__z);
+typedef struct __closure_1__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    long long multiplier;
+} __closure_1__;
+static long long __lambda_1__(void *__closure__, long long __sn__n);
+
+#endif
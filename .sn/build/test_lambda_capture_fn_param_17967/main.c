@@ -0,0 +1,53 @@
+#include "sn_types.h"
+
+
+
+
+void * __sn__wrap(void * __sn__target) {
+
+    return ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = __closure_0_capture_cleanup__;
+        __cl__->__rc__ = 1;
+        __cl__->target = sn_closure_retain(__sn__target);
+        __cl__;
+    });}
+
+
+long long __sn__timesTwo(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 2LL);}
+
+long long __fn_wrap_0__(void *__closure__, long long __p0__) {
+    (void)__closure__;
+    return __sn__timesTwo(__p0__);
+ }
+int main() {
+    sn_auto_fn void * __sn__w = ({ sn_auto_fn void *__fn_tmp_0__ = ({ __Closure__ *__cl__ = malloc(sizeof(__Closure__)); __cl__->fn = (void *)__fn_wrap_0__; __cl__->size = sizeof(__Closure__); __cl__->__cleanup__ = NULL; __cl__->__rc__ = 1; __cl__; }); __sn__wrap(__fn_tmp_0__); });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__w)->fn)(__sn__w, 5LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__w)->fn)(__sn__w, 10LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
+
+static void __closure_0_capture_cleanup__(void *p) {
+    __closure_0__ *cl = (__closure_0__ *)p;
+    sn_closure_release((void **)&cl->target);
+    free(cl);
+}
+static long long __lambda_0__(void *__closure__, long long __sn__x) {
+
+    void * __sn__target = ((__closure_0__ *)__closure__)->target;
+    return sn_add_long(((long long (*)(void *, long long))((__Closure__ *)__sn__target)->fn)(__sn__target, __sn__x), 1LL);
+}
@@ -0,0 +1,36 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+void * __sn__wrap(void *);
+long long __sn__timesTwo(long long);
+
+
+
+typedef struct __closure_0__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    void * target;
+} __closure_0__;
+static void __closure_0_capture_cleanup__(void *p);
+static long long __lambda_0__(void *__closure__, long long __sn__x);
+long long __fn_wrap_0__(void *__closure__, long long __p0__);
+
+#endif
@@ -0,0 +1,50 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__callTwice(void * __sn__action) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = ((char * (*)(void *))((__Closure__ *)__sn__action)->fn)(__sn__action);
+            sn_auto_str char *__is_p1__ = sn_strdup(" | ");
+            sn_auto_str char *__is_p2__ = ((char * (*)(void *))((__Closure__ *)__sn__action)->fn)(__sn__action);
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });}
+
+int main() {
+    sn_auto_str char * __sn__greeting = strdup("hello world");
+    sn_auto_fn void * __sn__producer = ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = __closure_0_capture_cleanup__;
+        __cl__->__rc__ = 1;
+        __cl__->greeting = __sn__greeting ? strdup(__sn__greeting) : NULL;
+        __cl__;
+    });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__callTwice(__sn__producer);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = ((char * (*)(void *))((__Closure__ *)__sn__producer)->fn)(__sn__producer);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
+
+static void __closure_0_capture_cleanup__(void *p) {
+    __closure_0__ *cl = (__closure_0__ *)p;
+    free(cl->greeting);
+    free(cl);
+}
+static char * __lambda_0__(void *__closure__) {
+
+    char * __sn__greeting = ((__closure_0__ *)__closure__)->greeting;
+    return strdup(__sn__greeting);
+}
@@ -0,0 +1,34 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+char * __sn__callTwice(void *);
+
+
+
+typedef struct __closure_0__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    char * greeting;
+} __closure_0__;
+static void __closure_0_capture_cleanup__(void *p);
+static char * __lambda_0__(void *__closure__);
+
+#endif
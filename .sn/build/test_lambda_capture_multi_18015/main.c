@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = 10LL;
+    long long __sn__b = 20LL;
+    sn_auto_fn void * __sn__sum = ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->a = __sn__a;
+        __cl__->b = __sn__b;
+        __cl__;
+    });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *))((__Closure__ *)__sn__sum)->fn)(__sn__sum)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
+
+static long long __lambda_0__(void *__closure__) {
+
+    long long __sn__a = ((__closure_0__ *)__closure__)->a;
+
+    long long __sn__b = ((__closure_0__ *)__closure__)->b;
+    return sn_add_long(__sn__a, __sn__b);
+}
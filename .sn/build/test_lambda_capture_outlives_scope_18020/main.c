@@ -0,0 +1,131 @@
+#include "sn_types.h"
+
+
+
+
+void * __sn__makeProducer() {
+
+    sn_auto_str char * __sn__greeting = strdup("hello from a captured local string");
+
+    sn_auto_State __sn__State * __sn__s = ({
+        __sn__State *__tmp__ = __sn__State__new();
+        __tmp__->__sn__prefix = strdup("state-prefix");
+        __tmp__->__sn__count = 7LL;
+        __tmp__;
+    });
+
+    return ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = __closure_0_capture_cleanup__;
+        __cl__->__rc__ = 1;
+        __cl__->greeting = __sn__greeting ? strdup(__sn__greeting) : NULL;
+        __cl__->s = __sn__State_retain(__sn__s);
+        __cl__;
+    });}
+
+
+void * __sn__makeCounter() {
+
+    sn_auto_capture long long *__sn__counter = malloc(sizeof(long long)); *__sn__counter = 100LL;
+
+    sn_auto_State __sn__State * __sn__s = ({
+        __sn__State *__tmp__ = __sn__State__new();
+        __tmp__->__sn__prefix = strdup("shared");
+        __tmp__->__sn__count = 0LL;
+        __tmp__;
+    });
+
+    {
+        void * __ret__ = ({
+        __closure_1__ *__cl__ = malloc(sizeof(__closure_1__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__closure_1__);
+        __cl__->__cleanup__ = __closure_1_capture_cleanup__;
+        __cl__->__rc__ = 1;
+        __cl__->counter = __sn__counter;
+        __cl__->s = __sn__State_retain(__sn__s);
+        __cl__;
+    });
+        ((__Closure__ *)__ret__)->__cleanup__ = (void (*)(void *))__closure_1_free__;
+        __sn__counter = NULL;
+        return __ret__;
+    }}
+
+
+int main() {
+    sn_auto_fn void * __sn__p = __sn__makeProducer();
+    sn_auto_str char * __sn__first = ((char * (*)(void *))((__Closure__ *)__sn__p)->fn)(__sn__p);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__first);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__second = ((char * (*)(void *))((__Closure__ *)__sn__p)->fn)(__sn__p);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__second);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_fn void * __sn__c = __sn__makeCounter();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("counter: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *))((__Closure__ *)__sn__c)->fn)(__sn__c)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("counter: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *))((__Closure__ *)__sn__c)->fn)(__sn__c)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("counter: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *))((__Closure__ *)__sn__c)->fn)(__sn__c)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
+
+static void __closure_0_capture_cleanup__(void *p) {
+    __closure_0__ *cl = (__closure_0__ *)p;
+    free(cl->greeting);
+    __sn__State_release(&cl->s);
+    free(cl);
+}
+static char * __lambda_0__(void *__closure__) {
+
+    char * __sn__greeting = ((__closure_0__ *)__closure__)->greeting;
+
+    __sn__State * __sn__s = ((__closure_0__ *)__closure__)->s;
+    return ({
+        sn_auto_str char *__is_p0__ = sn_strdup(__sn__greeting);
+        sn_auto_str char *__is_p1__ = sn_strdup(" | ");
+        sn_auto_str char *__is_p2__ = sn_strdup(__sn__s->__sn__prefix);
+        sn_auto_str char *__is_p3__ = sn_strdup(" | count=");
+        sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)(__sn__s->__sn__count));
+        sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+    });
+}
+
+static void __closure_1_capture_cleanup__(void *p) {
+    __closure_1__ *cl = (__closure_1__ *)p;
+    __sn__State_release(&cl->s);
+    free(cl);
+}
+static long long __lambda_1__(void *__closure__) {
+
+    long long *__sn__counter = ((__closure_1__ *)__closure__)->counter;
+
+    __sn__State * __sn__s = ((__closure_1__ *)__closure__)->s;
+    (*__sn__counter = sn_add_long((*__sn__counter), 1LL));
+    
+    return sn_add_long((*__sn__counter), __sn__s->__sn__count);}
@@ -0,0 +1,113 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: State (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    char * __sn__prefix;
+    long long __sn__count;
+} __sn__State;
+
+
+static inline __sn__State *__sn__State__new(void) {
+    __sn__State *p = calloc(1, sizeof(__sn__State));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__State *__sn__State_retain(__sn__State *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__State_release(__sn__State **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free((*p)->__sn__prefix);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__State *__sn__State_copy(const __sn__State *src) {
+    __sn__State *dst = calloc(1, sizeof(__sn__State));
+    dst->__rc__ = 1;
+    dst->__sn__prefix = src->__sn__prefix ? strdup(src->__sn__prefix) : NULL;
+    dst->__sn__count = src->__sn__count;
+    return dst;
+}
+
+#define sn_auto_State __attribute__((cleanup(__sn__State_release)))
+#define sn_auto_ref_State __attribute__((cleanup(__sn__State_release)))
+
+static inline void __sn__State_release_elem(void *p) { __sn__State_release((__sn__State **)p); }
+static inline void __sn__State_retain_into(const void *src, void *dst) { *(__sn__State **)dst = __sn__State_retain(*(__sn__State *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__State_to_string(const __sn__State *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "State { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "prefix: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__prefix ? p->__sn__prefix : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "count: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__count);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+void * __sn__makeProducer();
+void * __sn__makeCounter();
+
+
+
+typedef struct __closure_0__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    char * greeting;
+    __sn__State * s;
+} __closure_0__;
+static void __closure_0_capture_cleanup__(void *p);
+static char * __lambda_0__(void *__closure__);
+typedef struct __closure_1__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    long long *counter;
+    __sn__State * s;
+} __closure_1__;
+static void __closure_1_free__(void *p) {
+    __closure_1__ *cl = (__closure_1__ *)p;
+    free(cl->counter);
+    __sn__State_release(&cl->s);
+    free(cl);
+}
+static void __closure_1_cleanup__(void **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+#define sn_auto_closure_1 __attribute__((cleanup(__closure_1_cleanup__)))
+static void __closure_1_capture_cleanup__(void *p);
+static long long __lambda_1__(void *__closure__);
+
+#endif
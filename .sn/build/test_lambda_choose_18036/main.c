@@ -0,0 +1,49 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__apply2(void * __sn__f, long long __sn__x, long long __sn__y) {
+
+    return ((long long (*)(void *, long long, long long))((__Closure__ *)__sn__f)->fn)(__sn__f, __sn__x, __sn__y);}
+
+int main() {
+    sn_auto_fn void * __sn__add = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    sn_auto_fn void * __sn__sub = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__apply2(__sn__add, 10LL, 3LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__apply2(__sn__sub, 10LL, 3LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
+
+static long long __lambda_0__(void *__closure__, long long __sn__a, long long __sn__b) {
+    return sn_add_long(__sn__a, __sn__b);
+}
+
+static long long __lambda_1__(void *__closure__, long long __sn__a, long long __sn__b) {
+    return sn_sub_long(__sn__a, __sn__b);
+}
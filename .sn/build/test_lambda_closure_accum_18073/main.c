@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_capture long long *__sn__total = malloc(sizeof(long long)); *__sn__total = 0LL;
+    sn_auto_closure_0 void * __sn__add_to = ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->total = __sn__total;
+        __cl__;
+    });
+    ((void (*)(void *, long long))((__Closure__ *)__sn__add_to)->fn)(__sn__add_to, 10LL);
+    
+    ((void (*)(void *, long long))((__Closure__ *)__sn__add_to)->fn)(__sn__add_to, 20LL);
+    
+    ((void (*)(void *, long long))((__Closure__ *)__sn__add_to)->fn)(__sn__add_to, 30LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((*__sn__total)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
+
+static void __lambda_0__(void *__closure__, long long __sn__x) {
+
+    long long *__sn__total = ((__closure_0__ *)__closure__)->total;
+    (*__sn__total = sn_add_long((*__sn__total), __sn__x));
+    
+}
@@ -0,0 +1,78 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__compute(char * __sn__name, long long __sn__value) {
+
+    sn_auto_fn void * __sn__task = ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = __closure_0_capture_cleanup__;
+        __cl__->__rc__ = 1;
+        __cl__->name = __sn__name ? strdup(__sn__name) : NULL;
+        __cl__->value = __sn__value;
+        __cl__;
+    });
+
+    long long __sn__handle = 0; sn_auto_thread SnThread * __sn__handle__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->__closure_fn = (__Closure__ *)__sn__task;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+
+    long long __sn__result = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__handle__th__; __sn__handle__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__handle = *(long long *)__sync_th__->result; }
+        __sn__handle; })
+    ;
+
+    return __sn__result;}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = ((long long (*)(void *))(args->__closure_fn)->fn)(args->__closure_fn);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    long long __sn__r = __sn__compute("worker", 21LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Result: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
+
+static void __closure_0_capture_cleanup__(void *p) {
+    __closure_0__ *cl = (__closure_0__ *)p;
+    free(cl->name);
+    free(cl);
+}
+static long long __lambda_0__(void *__closure__) {
+
+    char * __sn__name = ((__closure_0__ *)__closure__)->name;
+
+    long long __sn__value = ((__closure_0__ *)__closure__)->value;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hello from ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    return sn_mul_long(__sn__value, 2LL);}
@@ -0,0 +1,40 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long __sn__compute(char *, long long);
+
+
+typedef struct {
+    __Closure__ *__closure_fn;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+
+typedef struct __closure_0__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    char * name;
+    long long value;
+} __closure_0__;
+static void __closure_0_capture_cleanup__(void *p);
+static long long __lambda_0__(void *__closure__);
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+
+
+
+typedef struct __closure_0__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    long long *count;
+} __closure_0__;
+static void __closure_0_free__(void *p) {
+    __closure_0__ *cl = (__closure_0__ *)p;
+    free(cl->count);
+    free(cl);
+}
+static void __closure_0_cleanup__(void **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+#define sn_auto_closure_0 __attribute__((cleanup(__closure_0_cleanup__)))
+static long long __lambda_0__(void *__closure__);
+
+#endif
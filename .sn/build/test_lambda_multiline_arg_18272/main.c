@@ -0,0 +1,100 @@
+#include "sn_types.h"
+
+long long __sn__a = 0LL;
+long long __sn__b = 0LL;
+
+
+
+void __sn__run(void * __sn__task) {
+
+    ((void (*)(void *))((__Closure__ *)__sn__task)->fn)(__sn__task);
+    
+}
+
+
+long long __sn__apply(void * __sn__f, long long __sn__x) {
+
+    return ((long long (*)(void *, long long))((__Closure__ *)__sn__f)->fn)(__sn__f, __sn__x);}
+
+int main() {
+    ({ sn_auto_fn void *__fn_tmp_0__ = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__run(__fn_tmp_0__); });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_add_long(__sn__a, __sn__b)));
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__r = ({ sn_auto_fn void *__fn_tmp_0__ = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__apply(__fn_tmp_0__, 5LL); });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__r));
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    (__sn__a = 0LL);
+    
+    ({ sn_auto_fn void *__fn_tmp_0__ = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_2__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__run(__fn_tmp_0__); });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_add_long(__sn__a, __sn__b)));
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
+
+static void __lambda_0__(void *__closure__) {
+    (__sn__a = 10LL);
+    
+    (__sn__b = 20LL);
+    
+}
+
+static long long __lambda_1__(void *__closure__, long long __sn__x) {
+    long long __sn__y = sn_mul_long(__sn__x, 2LL);
+    return sn_add_long(__sn__y, 1LL);}
+
+static void __lambda_3__(void *__closure__) {
+    (__sn__b = 200LL);
+    
+}
+
+static void __lambda_4__(void *__closure__) {
+    (__sn__b = 200LL);
+    
+}
+
+static void __lambda_2__(void *__closure__) {
+    (__sn__a = 100LL);
+    
+    ({ sn_auto_fn void *__fn_tmp_0__ = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_4__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    }); __sn__run(__fn_tmp_0__); });
+    
+}
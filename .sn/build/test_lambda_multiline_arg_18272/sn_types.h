@@ -0,0 +1,33 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+extern long long __sn__a;
+extern long long __sn__b;
+
+void __sn__run(void *);
+long long __sn__apply(void *, long long);
+
+
+
+static void __lambda_0__(void *__closure__);
+static long long __lambda_1__(void *__closure__, long long __sn__x);
+static void __lambda_3__(void *__closure__);
+static void __lambda_4__(void *__closure__);
+static void __lambda_2__(void *__closure__);
+
+#endif
@@ -0,0 +1,198 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("Testing recursive lambdas:\n\n");
+    
+    sn_print("Test 1: Factorial\n");
+    
+    sn_auto_fn void * __sn__factorial = ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = __closure_0_capture_cleanup__;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    
+        ((__closure_0__ *)__sn__factorial)->factorial = __sn__factorial;    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  factorial(0) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__factorial)->fn)(__sn__factorial, 0LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  factorial(1) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__factorial)->fn)(__sn__factorial, 1LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  factorial(5) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__factorial)->fn)(__sn__factorial, 5LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  factorial(10) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__factorial)->fn)(__sn__factorial, 10LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 2: Fibonacci\n");
+    
+    sn_auto_fn void * __sn__fibonacci = ({
+        __closure_1__ *__cl__ = malloc(sizeof(__closure_1__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__closure_1__);
+        __cl__->__cleanup__ = __closure_1_capture_cleanup__;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    
+        ((__closure_1__ *)__sn__fibonacci)->fibonacci = __sn__fibonacci;    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  fibonacci(0) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__fibonacci)->fn)(__sn__fibonacci, 0LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  fibonacci(1) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__fibonacci)->fn)(__sn__fibonacci, 1LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  fibonacci(10) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__fibonacci)->fn)(__sn__fibonacci, 10LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 3: Sum 1 to n\n");
+    
+    sn_auto_fn void * __sn__sumTo = ({
+        __closure_2__ *__cl__ = malloc(sizeof(__closure_2__));
+        __cl__->fn = (void *)__lambda_2__;
+        __cl__->size = sizeof(__closure_2__);
+        __cl__->__cleanup__ = __closure_2_capture_cleanup__;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    
+        ((__closure_2__ *)__sn__sumTo)->sumTo = __sn__sumTo;    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  sumTo(0) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__sumTo)->fn)(__sn__sumTo, 0LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  sumTo(5) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__sumTo)->fn)(__sn__sumTo, 5LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  sumTo(10) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__sumTo)->fn)(__sn__sumTo, 10LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nTest 4: GCD\n");
+    
+    sn_auto_fn void * __sn__gcd = ({
+        __closure_3__ *__cl__ = malloc(sizeof(__closure_3__));
+        __cl__->fn = (void *)__lambda_3__;
+        __cl__->size = sizeof(__closure_3__);
+        __cl__->__cleanup__ = __closure_3_capture_cleanup__;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    
+        ((__closure_3__ *)__sn__gcd)->gcd = __sn__gcd;    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  gcd(12, 8) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long, long long))((__Closure__ *)__sn__gcd)->fn)(__sn__gcd, 12LL, 8LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  gcd(100, 25) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long, long long))((__Closure__ *)__sn__gcd)->fn)(__sn__gcd, 100LL, 25LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  gcd(17, 13) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long, long long))((__Closure__ *)__sn__gcd)->fn)(__sn__gcd, 17LL, 13LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("\nAll recursive lambda tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
+
+static void __closure_0_capture_cleanup__(void *p) {
+    __closure_0__ *cl = (__closure_0__ *)p;
+    sn_closure_release((void **)&cl->factorial);
+    free(cl);
+}
+static long long __lambda_0__(void *__closure__, long long __sn__n) {
+
+    void * __sn__factorial = ((__closure_0__ *)__closure__)->factorial;
+    if ((__sn__n <= 1LL)) {
+        return 1LL;} else {
+        return sn_mul_long(__sn__n, ((long long (*)(void *, long long))((__Closure__ *)__sn__factorial)->fn)(__sn__factorial, sn_sub_long(__sn__n, 1LL)));}
+}
+
+static void __closure_1_capture_cleanup__(void *p) {
+    __closure_1__ *cl = (__closure_1__ *)p;
+    sn_closure_release((void **)&cl->fibonacci);
+    free(cl);
+}
+static long long __lambda_1__(void *__closure__, long long __sn__n) {
+
+    void * __sn__fibonacci = ((__closure_1__ *)__closure__)->fibonacci;
+    if ((__sn__n <= 1LL)) {
+        return __sn__n;} else {
+        return sn_add_long(((long long (*)(void *, long long))((__Closure__ *)__sn__fibonacci)->fn)(__sn__fibonacci, sn_sub_long(__sn__n, 1LL)), ((long long (*)(void *, long long))((__Closure__ *)__sn__fibonacci)->fn)(__sn__fibonacci, sn_sub_long(__sn__n, 2LL)));}
+}
+
+static void __closure_2_capture_cleanup__(void *p) {
+    __closure_2__ *cl = (__closure_2__ *)p;
+    sn_closure_release((void **)&cl->sumTo);
+    free(cl);
+}
+static long long __lambda_2__(void *__closure__, long long __sn__n) {
+
+    void * __sn__sumTo = ((__closure_2__ *)__closure__)->sumTo;
+    if ((__sn__n <= 0LL)) {
+        return 0LL;} else {
+        return sn_add_long(__sn__n, ((long long (*)(void *, long long))((__Closure__ *)__sn__sumTo)->fn)(__sn__sumTo, sn_sub_long(__sn__n, 1LL)));}
+}
+
+static void __closure_3_capture_cleanup__(void *p) {
+    __closure_3__ *cl = (__closure_3__ *)p;
+    sn_closure_release((void **)&cl->gcd);
+    free(cl);
+}
+static long long __lambda_3__(void *__closure__, long long __sn__a, long long __sn__b) {
+
+    void * __sn__gcd = ((__closure_3__ *)__closure__)->gcd;
+    if ((__sn__b == 0LL)) {
+        return __sn__a;} else {
+        return ((long long (*)(void *, long long, long long))((__Closure__ *)__sn__gcd)->fn)(__sn__gcd, __sn__b, sn_mod_long(__sn__a, __sn__b));}
+}
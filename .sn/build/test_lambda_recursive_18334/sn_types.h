@@ -0,0 +1,60 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+
+
+
+typedef struct __closure_0__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    void * factorial;
+} __closure_0__;
+static void __closure_0_capture_cleanup__(void *p);
+static long long __lambda_0__(void *__closure__, long long __sn__n);
+typedef struct __closure_1__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    void * fibonacci;
+} __closure_1__;
+static void __closure_1_capture_cleanup__(void *p);
+static long long __lambda_1__(void *__closure__, long long __sn__n);
+typedef struct __closure_2__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    void * sumTo;
+} __closure_2__;
+static void __closure_2_capture_cleanup__(void *p);
+static long long __lambda_2__(void *__closure__, long long __sn__n);
+typedef struct __closure_3__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    void * gcd;
+} __closure_3__;
+static void __closure_3_capture_cleanup__(void *p);
+static long long __lambda_3__(void *__closure__, long long __sn__a, long long __sn__b);
+
+#endif
@@ -0,0 +1,50 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_fn void * __sn__makeArr = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    sn_auto_arr SnArray * __sn__result = ((SnArray * (*)(void *, long long))((__Closure__ *)__sn__makeArr)->fn)(__sn__makeArr, 5LL);
+    { char *__ps__ = sn_array_to_string(__sn__result); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_auto_fn void * __sn__dbl = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Double 5 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(((long long (*)(void *, long long))((__Closure__ *)__sn__dbl)->fn)(__sn__dbl, 5LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
+
+static SnArray * __lambda_0__(void *__closure__, long long __sn__x) {
+    return ({
+        SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+        __al__->elem_tag = SN_TAG_INT;
+
+        sn_array_push(__al__, &(long long){ __sn__x });
+        sn_array_push(__al__, &(long long){ sn_mul_long(__sn__x, 2LL) });
+        __al__;
+    });
+}
+
+static long long __lambda_1__(void *__closure__, long long __sn__x) {
+    return sn_mul_long(__sn__x, 2LL);
+}
@@ -0,0 +1,30 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_fn void * __sn__label = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = ((char * (*)(void *, long long))((__Closure__ *)__sn__label)->fn)(__sn__label, 42LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
+
+static char * __lambda_0__(void *__closure__, long long __sn__n) {
+    return ({
+        sn_auto_str char *__is_p0__ = sn_strdup("value=");
+        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__n));
+        sn_str_concat_multi(2, __is_p0__, __is_p1__);
+    });
+}
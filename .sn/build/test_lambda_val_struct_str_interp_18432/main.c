@@ -0,0 +1,43 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Validator __sn__makeValidator(long long __sn__threshold) {
+
+    return (__sn__Validator){ .__sn__message = ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->threshold = __sn__threshold;
+        __cl__;
+    }) };}
+
+
+
+int main() {
+    sn_auto_Validator __sn__Validator __sn__v = __sn__makeValidator(5LL);
+    sn_auto_Subject __sn__Subject __sn__s = (__sn__Subject){ .__sn__n = 3LL, .__sn__label = strdup("hello") };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("message=");
+            sn_auto_str char *__is_p1__ = ((char * (*)(void *, __sn__Subject *))((__Closure__ *)(__sn__v.__sn__message))->fn)(__sn__v.__sn__message, &__sn__s);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
+
+static char * __lambda_0__(void *__closure__, __sn__Subject *__sn__s) {
+
+    long long __sn__threshold = ((__closure_0__ *)__closure__)->threshold;
+    return ({
+        sn_auto_str char *__is_p0__ = sn_strdup("n=");
+        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((*__sn__s).__sn__n));
+        sn_auto_str char *__is_p2__ = sn_strdup(" below minimum ");
+        sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__threshold));
+        sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+    });
+}
@@ -0,0 +1,138 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Subject (as val) */
+typedef struct {
+    long long __sn__n;
+    char * __sn__label;
+} __sn__Subject;
+/* Value operations */
+static inline __sn__Subject __sn__Subject_copy(const __sn__Subject *src) {
+    __sn__Subject dst;
+    dst.__sn__n = src->__sn__n;
+    dst.__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    return dst;
+}
+
+static inline void __sn__Subject_cleanup(__sn__Subject *p) {
+    free(p->__sn__label);
+
+}
+
+#define sn_auto_Subject __attribute__((cleanup(__sn__Subject_cleanup)))
+
+static inline void __sn__Subject_cleanup_elem(void *p) { __sn__Subject_cleanup((__sn__Subject *)p); }
+static inline void __sn__Subject_copy_into(const void *src, void *dst) { *(__sn__Subject *)dst = __sn__Subject_copy((const __sn__Subject *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Subject *__sn__Subject_alloc(void) {
+    return calloc(1, sizeof(__sn__Subject));
+}
+
+static inline void __sn__Subject_release(__sn__Subject **p) {
+    if (*p) {
+        free((*p)->__sn__label);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Subject __attribute__((cleanup(__sn__Subject_release)))
+
+static inline void __sn__Subject_release_elem(void *p) { __sn__Subject_release((__sn__Subject **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Subject_to_string(const __sn__Subject *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Subject { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "n: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__n);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Validator (as val) */
+typedef struct {
+    void * __sn__message;
+} __sn__Validator;
+/* Value operations */
+static inline __sn__Validator __sn__Validator_copy(const __sn__Validator *src) {
+    __sn__Validator dst;
+    dst.__sn__message = sn_closure_retain(src->__sn__message);
+    return dst;
+}
+
+static inline void __sn__Validator_cleanup(__sn__Validator *p) {
+    sn_closure_release((void **)&p->__sn__message);
+
+}
+
+#define sn_auto_Validator __attribute__((cleanup(__sn__Validator_cleanup)))
+
+static inline void __sn__Validator_cleanup_elem(void *p) { __sn__Validator_cleanup((__sn__Validator *)p); }
+static inline void __sn__Validator_copy_into(const void *src, void *dst) { *(__sn__Validator *)dst = __sn__Validator_copy((const __sn__Validator *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Validator *__sn__Validator_alloc(void) {
+    return calloc(1, sizeof(__sn__Validator));
+}
+
+static inline void __sn__Validator_release(__sn__Validator **p) {
+    if (*p) {
+        sn_closure_release((void **)&(*p)->__sn__message);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Validator __attribute__((cleanup(__sn__Validator_release)))
+
+static inline void __sn__Validator_release_elem(void *p) { __sn__Validator_release((__sn__Validator **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Validator_to_string(const __sn__Validator *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Validator { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "message: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__message);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Validator __sn__makeValidator(long long);
+
+
+
+typedef struct __closure_0__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+    long long threshold;
+} __closure_0__;
+static char * __lambda_0__(void *__closure__, __sn__Subject *__sn__s);
+
+#endif
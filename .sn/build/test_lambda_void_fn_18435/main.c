@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_capture long long *__sn__count = malloc(sizeof(long long)); *__sn__count = 0LL;
+    sn_auto_closure_0 void * __sn__inc = ({
+        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__closure_0__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__->count = __sn__count;
+        __cl__;
+    });
+    ((void (*)(void *))((__Closure__ *)__sn__inc)->fn)(__sn__inc);
+    
+    ((void (*)(void *))((__Closure__ *)__sn__inc)->fn)(__sn__inc);
+    
+    ((void (*)(void *))((__Closure__ *)__sn__inc)->fn)(__sn__inc);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((*__sn__count)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
+
+static void __lambda_0__(void *__closure__) {
+
+    long long *__sn__count = ((__closure_0__ *)__closure__)->count;
+    (*__sn__count)++;
+    
+}
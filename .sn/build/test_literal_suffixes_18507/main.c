@@ -0,0 +1,201 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__identity_int(long long __sn__x) {
+
+    return __sn__x;}
+
+
+long long __sn__identity_long(long long __sn__x) {
+
+    return __sn__x;}
+
+
+unsigned char __sn__identity_byte(unsigned char __sn__x) {
+
+    return __sn__x;}
+
+int main() {
+    sn_print("=== Literal Suffix Tests ===\n\n");
+    
+    long long __sn__i1 = 42LL;
+    long long __sn__i2 = 0LL;
+    long long __sn__i3 = (-100LL);
+    sn_assert((__sn__i1 == 42LL), "int literal 42");
+    
+    sn_assert((__sn__i2 == 0LL), "int literal 0");
+    
+    sn_assert((__sn__i3 == (-100LL)), "int literal -100");
+    
+    sn_print("test_int_literals: PASS\n");
+    
+    long long __sn__l1 = 42LL;
+    long long __sn__l2 = 42LL;
+    long long __sn__l3 = 0LL;
+    long long __sn__l4 = 0LL;
+    long long __sn__l5 = 1000000000LL;
+    long long __sn__l6 = 1000000000LL;
+    sn_assert((__sn__l1 == 42LL), "long literal 42l");
+    
+    sn_assert((__sn__l2 == 42LL), "long literal 42L");
+    
+    sn_assert((__sn__l3 == 0LL), "long literal 0l");
+    
+    sn_assert((__sn__l4 == 0LL), "long literal 0L");
+    
+    sn_assert((__sn__l5 == 1000000000LL), "long literal 1000000000l");
+    
+    sn_assert((__sn__l6 == 1000000000LL), "long literal 1000000000L");
+    
+    sn_print("test_long_literals: PASS\n");
+    
+    unsigned char __sn__b1 = (unsigned char)0;
+    unsigned char __sn__b2 = (unsigned char)0;
+    unsigned char __sn__b3 = (unsigned char)255;
+    unsigned char __sn__b4 = (unsigned char)255;
+    unsigned char __sn__b5 = (unsigned char)128;
+    unsigned char __sn__b6 = (unsigned char)128;
+    sn_assert((__sn__b1 == 0LL), "byte literal 0b");
+    
+    sn_assert((__sn__b2 == 0LL), "byte literal 0B");
+    
+    sn_assert((__sn__b3 == 255LL), "byte literal 255b");
+    
+    sn_assert((__sn__b4 == 255LL), "byte literal 255B");
+    
+    sn_assert((__sn__b5 == 128LL), "byte literal 128b");
+    
+    sn_assert((__sn__b6 == 128LL), "byte literal 128B");
+    
+    sn_print("test_byte_literals: PASS\n");
+    
+    double __sn__d1 = 3.1400000000000001;
+    double __sn__d2 = 3.1400000000000001;
+    double __sn__d3 = 3.1400000000000001;
+    double __sn__d4 = 0.0;
+    double __sn__d5 = 0.0;
+    double __sn__d6 = 0.0;
+    sn_assert((sn_gt_double(__sn__d1, 3.1299999999999999) && sn_lt_double(__sn__d1, 3.1499999999999999)), "double literal 3.14");
+    
+    sn_assert((sn_gt_double(__sn__d2, 3.1299999999999999) && sn_lt_double(__sn__d2, 3.1499999999999999)), "double literal 3.14d");
+    
+    sn_assert((sn_gt_double(__sn__d3, 3.1299999999999999) && sn_lt_double(__sn__d3, 3.1499999999999999)), "double literal 3.14D");
+    
+    sn_assert((__sn__d4 == 0.0), "double literal 0.0");
+    
+    sn_assert((__sn__d5 == 0.0), "double literal 0.0d");
+    
+    sn_assert((__sn__d6 == 0.0), "double literal 0.0D");
+    
+    sn_print("test_double_literals: PASS\n");
+    
+    float __sn__f1 = 3.1400000000000001;
+    float __sn__f2 = 3.1400000000000001;
+    float __sn__f3 = 0.0;
+    float __sn__f4 = 0.0;
+    float __sn__f5 = 1.5;
+    float __sn__f6 = 1.5;
+    sn_assert((sn_gt_float(__sn__f1, 3.1299999999999999) && sn_lt_float(__sn__f1, 3.1499999999999999)), "float literal 3.14f");
+    
+    sn_assert((sn_gt_float(__sn__f2, 3.1299999999999999) && sn_lt_float(__sn__f2, 3.1499999999999999)), "float literal 3.14F");
+    
+    sn_assert((__sn__f3 == 0.0), "float literal 0.0f");
+    
+    sn_assert((__sn__f4 == 0.0), "float literal 0.0F");
+    
+    sn_assert((__sn__f5 == 1.5), "float literal 1.5f");
+    
+    sn_assert((__sn__f6 == 1.5), "float literal 1.5F");
+    
+    sn_print("test_float_literals: PASS\n");
+    
+    uint64_t __sn__u1 = 42LL;
+    uint64_t __sn__u2 = 42LL;
+    uint64_t __sn__u3 = 0LL;
+    uint64_t __sn__u4 = 0LL;
+    uint64_t __sn__u5 = 1000000LL;
+    uint64_t __sn__u6 = 1000000LL;
+    sn_assert((__sn__u1 == 42LL), "uint literal 42u");
+    
+    sn_assert((__sn__u2 == 42LL), "uint literal 42U");
+    
+    sn_assert((__sn__u3 == 0LL), "uint literal 0u");
+    
+    sn_assert((__sn__u4 == 0LL), "uint literal 0U");
+    
+    sn_assert((__sn__u5 == 1000000LL), "uint literal 1000000u");
+    
+    sn_assert((__sn__u6 == 1000000LL), "uint literal 1000000U");
+    
+    sn_print("test_uint_literals: PASS\n");
+    
+    uint32_t __sn__u32_1 = 42LL;
+    uint32_t __sn__u32_2 = 42LL;
+    uint32_t __sn__u32_3 = 0LL;
+    uint32_t __sn__u32_4 = 0LL;
+    uint32_t __sn__u32_5 = 4000000000LL;
+    uint32_t __sn__u32_6 = 4000000000LL;
+    sn_assert((__sn__u32_1 == 42LL), "uint32 literal 42u32");
+    
+    sn_assert((__sn__u32_2 == 42LL), "uint32 literal 42U32");
+    
+    sn_assert((__sn__u32_3 == 0LL), "uint32 literal 0u32");
+    
+    sn_assert((__sn__u32_4 == 0LL), "uint32 literal 0U32");
+    
+    sn_assert((__sn__u32_5 == 4000000000LL), "uint32 literal 4000000000u32");
+    
+    sn_assert((__sn__u32_6 == 4000000000LL), "uint32 literal 4000000000U32");
+    
+    sn_print("test_uint32_literals: PASS\n");
+    
+    int32_t __sn__i32_1 = 42LL;
+    int32_t __sn__i32_2 = 42LL;
+    int32_t __sn__i32_3 = 0LL;
+    int32_t __sn__i32_4 = 0LL;
+    int32_t __sn__i32_5 = 2000000000LL;
+    int32_t __sn__i32_6 = 2000000000LL;
+    sn_assert((__sn__i32_1 == 42LL), "int32 literal 42i32");
+    
+    sn_assert((__sn__i32_2 == 42LL), "int32 literal 42I32");
+    
+    sn_assert((__sn__i32_3 == 0LL), "int32 literal 0i32");
+    
+    sn_assert((__sn__i32_4 == 0LL), "int32 literal 0I32");
+    
+    sn_assert((__sn__i32_5 == 2000000000LL), "int32 literal 2000000000i32");
+    
+    sn_assert((__sn__i32_6 == 2000000000LL), "int32 literal 2000000000I32");
+    
+    sn_print("test_int32_literals: PASS\n");
+    
+    long long __sn__expr1 = sn_add_long(10LL, 20LL);
+    float __sn__expr2 = sn_add_float(1.5, 2.5);
+    uint64_t __sn__expr3 = sn_mul_uint(100LL, 2LL);
+    sn_assert((__sn__expr1 == 30LL), "long literals in expression");
+    
+    sn_assert((__sn__expr2 == 4.0), "float literals in expression");
+    
+    sn_assert((__sn__expr3 == 200LL), "uint literals in expression");
+    
+    sn_print("test_literals_in_expressions: PASS\n");
+    
+    sn_assert((__sn__identity_int(42LL) == 42LL), "int literal as arg");
+    
+    sn_assert((__sn__identity_long(42LL) == 42LL), "long literal as arg");
+    
+    sn_assert((__sn__identity_long(42LL) == 42LL), "long literal L as arg");
+    
+    sn_assert((__sn__identity_byte((unsigned char)255) == 255LL), "byte literal as arg");
+    
+    sn_assert((__sn__identity_byte((unsigned char)255) == 255LL), "byte literal B as arg");
+    
+    sn_print("test_literals_as_args: PASS\n");
+    
+    sn_print("\nAll literal suffix tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
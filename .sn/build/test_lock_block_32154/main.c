@@ -0,0 +1,95 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_basic_lock() {
+
+    _Atomic long long __sn__counter = 0LL;
+
+    (&__sn___mutex);
+    {
+    
+        (__sn__counter = sn_add_long(__sn__counter, 1LL));
+        
+    
+        (__sn__counter = sn_add_long(__sn__counter, 1LL));
+        
+    }
+    (&__sn___mutex);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Counter after lock: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__counter));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_lock_compound() {
+
+    _Atomic long long __sn__value = 10LL;
+
+    (&__sn___mutex);
+    {
+    
+        __sn__value = __sn__value + 5LL;
+        
+    
+        __sn__value = __sn__value - 2LL;
+        
+    }
+    (&__sn___mutex);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Value after lock: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_lock_nested() {
+
+    _Atomic long long __sn__total = 0LL;
+
+    (&__sn___mutex);
+    {
+    
+        {
+            sn_auto_arr SnArray *__arr_0__ = sn_array_range(1LL, 5LL);
+            long long __len_0__ = __arr_0__->len;
+            for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+                long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+                {
+                    __sn__total = __sn__total + __sn__i;
+                    
+                }
+            }
+        }
+    }
+    (&__sn___mutex);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Total after lock: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__total));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+int main() {
+    __sn__test_basic_lock();
+    
+    __sn__test_lock_compound();
+    
+    __sn__test_lock_nested();
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+extern _Atomic long long __sn__mu;
+extern pthread_mutex_t __sn__mu_mutex;
+extern long long __sn__counter;
+
+void __sn__earlyReturn(bool);
+
+
+
+
+#endif
@@ -0,0 +1,59 @@
+#include "sn_types.h"
+
+_Atomic long long __sn__mu = 0LL;
+long long __sn__counter = 0LL;
+
+
+
+void __sn__earlyReturn(bool __sn__doReturn) {
+
+    (&__sn___mutex);
+    {
+    
+        (__sn__counter = sn_add_long(__sn__counter, 1LL));
+        
+    
+        if (__sn__doReturn) {
+            (&__sn___mutex);
+            return;}
+    
+        (__sn__counter = sn_add_long(__sn__counter, 1LL));
+        
+    }
+    (&__sn___mutex);
+}
+
+int main() {
+    __sn__earlyReturn(true);
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After early return: expected 1, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__counter));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__counter == 1LL), __assert_msg__); sn_free(__assert_msg__); (void)0; });
+    
+    (&__sn___mutex);
+    {
+    
+        (__sn__counter = sn_add_long(__sn__counter, 100LL));
+        
+    }
+    (&__sn___mutex);
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After re-lock: expected 101, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__counter));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__counter == 101LL), __assert_msg__); sn_free(__assert_msg__); (void)0; });
+    
+    __sn__earlyReturn(false);
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After normal return: expected 103, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__counter));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__counter == 103LL), __assert_msg__); sn_free(__assert_msg__); (void)0; });
+    
+    sn_print("PASS\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,53 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__single = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 0LL });
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 4LL); __sn__i++) {
+            ({
+                SnArray *__sn_tmp__ = ({
+                    SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+                    __al__->elem_tag = SN_TAG_INT;
+            
+                    sn_array_push(__al__, &(long long){ __sn__i });
+                    __al__;
+                });
+                sn_cleanup_array(&__sn__single);
+                __sn__single = __sn_tmp__;
+                __sn__single;
+            });
+            
+            ({
+                SnArray *__sn_tmp__ = __sn__arr_concat(&__sn__arr, __sn__single);
+                sn_cleanup_array(&__sn__arr);
+                __sn__arr = __sn_tmp__;
+                __sn__arr;
+            });
+            
+        }
+    }
+    printf("%lld\n", (long long)(sn_array_length(__sn__arr)));
+    
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__arr)); __sn__i++) {
+            printf("%lld\n", (long long)((((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
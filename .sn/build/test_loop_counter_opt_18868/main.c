@@ -0,0 +1,87 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 10);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            sn_array_push(__al__, &(long long){ 40LL });
+            sn_array_push(__al__, &(long long){ 50LL });
+            sn_array_push(__al__, &(long long){ 60LL });
+            sn_array_push(__al__, &(long long){ 70LL });
+            sn_array_push(__al__, &(long long){ 80LL });
+            sn_array_push(__al__, &(long long){ 90LL });
+            sn_array_push(__al__, &(long long){ 100LL });
+            __al__;
+        });
+    long long __sn__sum1 = 0LL;
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 10LL); __sn__i++) {
+            (__sn__sum1 = sn_add_long(__sn__sum1, (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sum with loop counter: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum1));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__sum2 = 0LL;
+    long long __sn__j = 0LL;
+    while (sn_lt_long(__sn__j, 10LL)) {
+        (__sn__sum2 = sn_add_long(__sn__sum2, (((long long *)__sn__arr->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+        
+        (__sn__j = sn_add_long(__sn__j, 1LL));
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sum with while loop: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum2));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__first = (((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+    long long __sn__last = (((long long *)__sn__arr->data)[({ long long __ai__ = 9LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("First: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__first));
+            sn_auto_str char *__is_p2__ = sn_strdup(", Last: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__last));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__matrix_sum = 0LL;
+    sn_auto_arr SnArray * __sn__row = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+    {
+        for (long long __sn__x = 0LL; sn_lt_long(__sn__x, 3LL); __sn__x++) {
+            (__sn__matrix_sum = sn_add_long(__sn__matrix_sum, (((long long *)__sn__row->data)[({ long long __ai__ = __sn__x; __ai__ < 0 ? __ai__ + __sn__row->len : __ai__; })])));
+            
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Row sum: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__matrix_sum));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
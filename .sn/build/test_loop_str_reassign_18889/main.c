@@ -0,0 +1,25 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__result = strdup("");
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 3LL); __sn__i++) {
+            ({
+                char *__sn_tmp__ = ({char *__sct__=({
+                    sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_str_concat_multi(1, __is_p0__);
+                });char *__scr__=sn_str_concat(__sn__result,__sct__);free(__sct__);__scr__;});
+                free(__sn__result);
+                __sn__result = __sn_tmp__;
+                __sn__result;
+            });
+            
+        }
+    }
+    sn_println(__sn__result);
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__sum = 0LL;
+    {
+        for (long long __sn__i = 1LL; (__sn__i <= 5LL); __sn__i++) {
+            (__sn__sum = sn_add_long(__sn__sum, __sn__i));
+            
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sum 1-5: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__count = 0LL;
+    while (sn_lt_long(__sn__count, 3LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Count: ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__count));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        (__sn__count = sn_add_long(__sn__count, 1LL));
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,30 @@
+#include "sn_types.h"
+
+
+
+int main(int argc, char **argv) {
+    sn_auto_arr SnArray *__sn__args = sn_array_new(sizeof(char *), argc);
+    __sn__args->elem_tag = SN_TAG_STRING;
+    __sn__args->elem_release = (void (*)(void *))sn_cleanup_str;
+    __sn__args->elem_copy = sn_copy_str;
+    for (int __i__ = 0; __i__ < argc; __i__++) {
+        char *__s__ = strdup(argv[__i__]);
+        sn_array_push(__sn__args, &__s__);
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Has args: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((sn_gt_long(sn_array_length(__sn__args), 0LL)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("First arg contains test name: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn___contains(&(((char * *)__sn__args->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__args->len : __ai__; })]), "test_main_args")) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
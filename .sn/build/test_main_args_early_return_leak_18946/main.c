@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+int main(int argc, char **argv) {
+    sn_auto_arr SnArray *__sn__args = sn_array_new(sizeof(char *), argc);
+    __sn__args->elem_tag = SN_TAG_STRING;
+    __sn__args->elem_release = (void (*)(void *))sn_cleanup_str;
+    __sn__args->elem_copy = sn_copy_str;
+    for (int __i__ = 0; __i__ < argc; __i__++) {
+        char *__s__ = strdup(argv[__i__]);
+        sn_array_push(__sn__args, &__s__);
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("args: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__args)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
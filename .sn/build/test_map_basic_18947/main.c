@@ -0,0 +1,62 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_map_str_int __sn__map_str_int * __sn__ages = ({
+        __sn__map_str_int *__tmp__ = __sn__map_str_int__new();
+        __tmp__;
+    });
+    __sn__map_str_int_set(__sn__ages, "alice", 30LL);
+    
+    __sn__map_str_int_set(__sn__ages, "bob", 25LL);
+    
+    __sn__map_str_int_set(__sn__ages, "alice", 31LL);
+    
+    printf("%lld\n", (long long)(__sn__map_str_int_length(__sn__ages)));
+    
+    printf("%lld\n", (long long)(__sn__map_str_int_get(__sn__ages, "alice")));
+    
+    printf("%lld\n", (long long)(__sn__map_str_int_get(__sn__ages, "bob")));
+    
+    printf("%s\n", (__sn__map_str_int_has(__sn__ages, "carol")) ? "true" : "false");
+    
+    printf("%lld\n", (long long)(__sn__map_str_int_getOr(__sn__ages, "carol", (-1LL))));
+    
+    printf("%s\n", (__sn__map_str_int_remove(__sn__ages, "bob")) ? "true" : "false");
+    
+    printf("%s\n", (__sn__map_str_int_remove(__sn__ages, "bob")) ? "true" : "false");
+    
+    printf("%lld\n", (long long)(__sn__map_str_int_length(__sn__ages)));
+    
+    sn_auto_map_int_str __sn__map_int_str * __sn__names = ({
+        __sn__map_int_str *__tmp__ = __sn__map_int_str__new();
+        __tmp__;
+    });
+    __sn__map_int_str_set(__sn__names, 1LL, "one");
+    
+    __sn__map_int_str_set(__sn__names, 2LL, "two");
+    
+    __sn__map_int_str_set(__sn__names, 2LL, "deux");
+    
+    { sn_auto_str char *__ps__ = __sn__map_int_str_get(__sn__names, 2LL); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = __sn__map_int_str_getOr(__sn__names, 3LL, "none"); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__map_int_str_to_string(__sn__names);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    __sn__map_int_str_clear(__sn__names);
+    
+    printf("%lld\n", (long long)(__sn__map_int_str_length(__sn__names)));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__map_int_str_to_string(__sn__names);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__fill(__sn__map_str_double * __sn__m) {
+
+    __sn__map_str_double_set(__sn__m, "pi", 3.5);
+    
+
+    __sn__map_str_double_set(__sn__m, "e", 2.75);
+    
+}
+
+int main() {
+    sn_auto_map_str_double __sn__map_str_double * __sn__a = ({
+        __sn__map_str_double *__tmp__ = __sn__map_str_double__new();
+        __tmp__;
+    });
+    __sn__fill(__sn__a);
+    
+    printf("%lld\n", (long long)(__sn__map_str_double_length(__sn__a)));
+    
+    sn_auto_map_str_double __sn__map_str_double * __sn__b = __sn__map_str_double_clone(__sn__a);
+    __sn__map_str_double_set(__sn__b, "pi", 1.0);
+    
+    __sn__map_str_double_set(__sn__b, "tau", 6.5);
+    
+    printf("%.5f\n", (double)(__sn__map_str_double_get(__sn__a, "pi")));
+    
+    printf("%.5f\n", (double)(__sn__map_str_double_get(__sn__b, "pi")));
+    
+    printf("%lld\n", (long long)(__sn__map_str_double_length(__sn__a)));
+    
+    printf("%lld\n", (long long)(__sn__map_str_double_length(__sn__b)));
+    
+    sn_auto_map_int_int_arr __sn__map_int_int_arr * __sn__nested = ({
+        __sn__map_int_int_arr *__tmp__ = __sn__map_int_int_arr__new();
+        __tmp__;
+    });
+    ({ sn_auto_arr SnArray *__al_tmp_1__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        }); __sn__map_int_int_arr_set(__sn__nested, 1LL, __al_tmp_1__); });
+    
+    sn_auto_arr SnArray * __sn__arr = __sn__map_int_int_arr_get(__sn__nested, 1LL);
+    __sn__arr_push(&__sn__arr, 4LL);
+    
+    sn_auto_arr SnArray * __sn__again = __sn__map_int_int_arr_get(__sn__nested, 1LL);
+    { char *__ps__ = sn_array_to_string(__sn__again); printf("%s\n", __ps__); free(__ps__); };
+    
+    { char *__ps__ = sn_array_to_string(__sn__arr); printf("%s\n", __ps__); free(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,10 @@
+#include "sn_types.h"
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,506 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Map: map_str_double (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_str_double;
+
+static uint64_t __sn__map_str_double__hash(const void *p) {
+    const char * *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, sn_hash_str((*k)));
+    return h;
+}
+
+static bool __sn__map_str_double__eq(const void *a, const void *b) {
+    const char * *x = a;
+    const char * *y = b;
+    return true        && sn_map_str_eq((*x), (*y));
+}
+
+static const SnMapOps __sn__map_str_double__ops = {
+    .key_size = sizeof(char *),
+    .val_size = sizeof(double),
+    .hash = __sn__map_str_double__hash,
+    .eq = __sn__map_str_double__eq,
+    .key_copy = sn_copy_str,
+    .key_release = (void (*)(void *))sn_cleanup_str,
+    .key_tag = SN_TAG_STRING,
+    .val_tag = SN_TAG_DOUBLE,
+};
+
+static inline __sn__map_str_double *__sn__map_str_double__new(void) {
+    return sn_map_new(&__sn__map_str_double__ops);
+}
+
+static inline __sn__map_str_double *__sn__map_str_double_retain(__sn__map_str_double *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_str_double_release(__sn__map_str_double **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_str_double *__sn__map_str_double_copy(const __sn__map_str_double *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_str_double __attribute__((cleanup(__sn__map_str_double_release)))
+#define sn_auto_ref_map_str_double __attribute__((cleanup(__sn__map_str_double_release)))
+
+static inline void __sn__map_str_double_release_elem(void *p) { __sn__map_str_double_release((__sn__map_str_double **)p); }
+static inline void __sn__map_str_double_retain_into(const void *src, void *dst) { *(__sn__map_str_double **)dst = __sn__map_str_double_retain(*(__sn__map_str_double *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_str_double_to_string(const __sn__map_str_double *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_str_double_set(__sn__map_str_double *m, char * key, double value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline double __sn__map_str_double_get(__sn__map_str_double *m, char * key) {
+    const double *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    double r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline double __sn__map_str_double_getOr(__sn__map_str_double *m, char * key, double fallback) {
+    const double *v = sn_map_find(m, &key);
+    double r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_str_double_has(__sn__map_str_double *m, char * key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_str_double_remove(__sn__map_str_double *m, char * key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_str_double_length(__sn__map_str_double *m) {
+    return m->len;
+}
+
+static inline void __sn__map_str_double_clear(__sn__map_str_double *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_str_double_keys(__sn__map_str_double *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_str_double_values(__sn__map_str_double *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_str_double *__sn__map_str_double_clone(__sn__map_str_double *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_str_double (as val) */
+typedef struct {
+    char * __sn__key;
+    double __sn__value;
+} __sn__MapEntry_str_double;
+/* Value operations */
+static inline __sn__MapEntry_str_double __sn__MapEntry_str_double_copy(const __sn__MapEntry_str_double *src) {
+    __sn__MapEntry_str_double dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__MapEntry_str_double_cleanup(__sn__MapEntry_str_double *p) {
+    free(p->__sn__key);
+
+}
+
+#define sn_auto_MapEntry_str_double __attribute__((cleanup(__sn__MapEntry_str_double_cleanup)))
+
+static inline void __sn__MapEntry_str_double_cleanup_elem(void *p) { __sn__MapEntry_str_double_cleanup((__sn__MapEntry_str_double *)p); }
+static inline void __sn__MapEntry_str_double_copy_into(const void *src, void *dst) { *(__sn__MapEntry_str_double *)dst = __sn__MapEntry_str_double_copy((const __sn__MapEntry_str_double *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_str_double *__sn__MapEntry_str_double_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_str_double));
+}
+
+static inline void __sn__MapEntry_str_double_release(__sn__MapEntry_str_double **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_str_double __attribute__((cleanup(__sn__MapEntry_str_double_release)))
+
+static inline void __sn__MapEntry_str_double_release_elem(void *p) { __sn__MapEntry_str_double_release((__sn__MapEntry_str_double **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_str_double_to_string(const __sn__MapEntry_str_double *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_str_double { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_str_double (as val) */
+typedef struct {
+    __sn__map_str_double * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_str_double;
+/* Value operations */
+static inline __sn__MapIter_str_double __sn__MapIter_str_double_copy(const __sn__MapIter_str_double *src) {
+    __sn__MapIter_str_double dst;
+    dst.__sn___map = __sn__map_str_double_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_str_double_cleanup(__sn__MapIter_str_double *p) {
+    __sn__map_str_double_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_str_double __attribute__((cleanup(__sn__MapIter_str_double_cleanup)))
+
+static inline void __sn__MapIter_str_double_cleanup_elem(void *p) { __sn__MapIter_str_double_cleanup((__sn__MapIter_str_double *)p); }
+static inline void __sn__MapIter_str_double_copy_into(const void *src, void *dst) { *(__sn__MapIter_str_double *)dst = __sn__MapIter_str_double_copy((const __sn__MapIter_str_double *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_str_double *__sn__MapIter_str_double_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_str_double));
+}
+
+static inline void __sn__MapIter_str_double_release(__sn__MapIter_str_double **p) {
+    if (*p) {
+        __sn__map_str_double_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_str_double __attribute__((cleanup(__sn__MapIter_str_double_release)))
+
+static inline void __sn__MapIter_str_double_release_elem(void *p) { __sn__MapIter_str_double_release((__sn__MapIter_str_double **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_str_double_to_string(const __sn__MapIter_str_double *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_str_double { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_str_double_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_str_double → MapEntry_str_double */
+static inline __sn__MapIter_str_double __sn__map_str_double_iter(__sn__map_str_double *m) {
+    return (__sn__MapIter_str_double){ .__sn___map = __sn__map_str_double_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_str_double_hasNext(__sn__MapIter_str_double *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_str_double __sn__MapIter_str_double_next(__sn__MapIter_str_double *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_str_double e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+/* Map: map_int_int_arr (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_int_int_arr;
+
+static uint64_t __sn__map_int_int_arr__hash(const void *p) {
+    const long long *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, (uint64_t)(*k));
+    return h;
+}
+
+static bool __sn__map_int_int_arr__eq(const void *a, const void *b) {
+    const long long *x = a;
+    const long long *y = b;
+    return true
+        && (*x) == (*y);
+}
+
+static const SnMapOps __sn__map_int_int_arr__ops = {
+    .key_size = sizeof(long long),
+    .val_size = sizeof(SnArray *),
+    .hash = __sn__map_int_int_arr__hash,
+    .eq = __sn__map_int_int_arr__eq,
+    .val_copy = sn_copy_array,
+    .val_release = (void (*)(void *))sn_cleanup_array,
+    .key_tag = SN_TAG_INT,
+    .val_tag = SN_TAG_ARRAY,
+};
+
+static inline __sn__map_int_int_arr *__sn__map_int_int_arr__new(void) {
+    return sn_map_new(&__sn__map_int_int_arr__ops);
+}
+
+static inline __sn__map_int_int_arr *__sn__map_int_int_arr_retain(__sn__map_int_int_arr *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_int_int_arr_release(__sn__map_int_int_arr **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_int_int_arr *__sn__map_int_int_arr_copy(const __sn__map_int_int_arr *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_int_int_arr __attribute__((cleanup(__sn__map_int_int_arr_release)))
+#define sn_auto_ref_map_int_int_arr __attribute__((cleanup(__sn__map_int_int_arr_release)))
+
+static inline void __sn__map_int_int_arr_release_elem(void *p) { __sn__map_int_int_arr_release((__sn__map_int_int_arr **)p); }
+static inline void __sn__map_int_int_arr_retain_into(const void *src, void *dst) { *(__sn__map_int_int_arr **)dst = __sn__map_int_int_arr_retain(*(__sn__map_int_int_arr *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_int_int_arr_to_string(const __sn__map_int_int_arr *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_int_int_arr_set(__sn__map_int_int_arr *m, long long key, SnArray * value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline SnArray * __sn__map_int_int_arr_get(__sn__map_int_int_arr *m, long long key) {
+    const SnArray * *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    SnArray * r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline SnArray * __sn__map_int_int_arr_getOr(__sn__map_int_int_arr *m, long long key, SnArray * fallback) {
+    const SnArray * *v = sn_map_find(m, &key);
+    SnArray * r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_int_int_arr_has(__sn__map_int_int_arr *m, long long key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_int_int_arr_remove(__sn__map_int_int_arr *m, long long key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_int_int_arr_length(__sn__map_int_int_arr *m) {
+    return m->len;
+}
+
+static inline void __sn__map_int_int_arr_clear(__sn__map_int_int_arr *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_int_int_arr_keys(__sn__map_int_int_arr *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_int_int_arr_values(__sn__map_int_int_arr *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_int_int_arr *__sn__map_int_int_arr_clone(__sn__map_int_int_arr *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_int_int_arr (as val) */
+typedef struct {
+    long long __sn__key;
+    SnArray * __sn__value;
+} __sn__MapEntry_int_int_arr;
+/* Value operations */
+static inline __sn__MapEntry_int_int_arr __sn__MapEntry_int_int_arr_copy(const __sn__MapEntry_int_int_arr *src) {
+    __sn__MapEntry_int_int_arr dst;
+    dst.__sn__key = src->__sn__key;
+    dst.__sn__value = sn_array_copy(src->__sn__value);
+    return dst;
+}
+
+static inline void __sn__MapEntry_int_int_arr_cleanup(__sn__MapEntry_int_int_arr *p) {
+    sn_cleanup_array(&p->__sn__value);
+
+}
+
+#define sn_auto_MapEntry_int_int_arr __attribute__((cleanup(__sn__MapEntry_int_int_arr_cleanup)))
+
+static inline void __sn__MapEntry_int_int_arr_cleanup_elem(void *p) { __sn__MapEntry_int_int_arr_cleanup((__sn__MapEntry_int_int_arr *)p); }
+static inline void __sn__MapEntry_int_int_arr_copy_into(const void *src, void *dst) { *(__sn__MapEntry_int_int_arr *)dst = __sn__MapEntry_int_int_arr_copy((const __sn__MapEntry_int_int_arr *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_int_int_arr *__sn__MapEntry_int_int_arr_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_int_int_arr));
+}
+
+static inline void __sn__MapEntry_int_int_arr_release(__sn__MapEntry_int_int_arr **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_int_int_arr __attribute__((cleanup(__sn__MapEntry_int_int_arr_release)))
+
+static inline void __sn__MapEntry_int_int_arr_release_elem(void *p) { __sn__MapEntry_int_int_arr_release((__sn__MapEntry_int_int_arr **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_int_int_arr_to_string(const __sn__MapEntry_int_int_arr *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_int_int_arr { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__key);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__value); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_int_int_arr (as val) */
+typedef struct {
+    __sn__map_int_int_arr * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_int_int_arr;
+/* Value operations */
+static inline __sn__MapIter_int_int_arr __sn__MapIter_int_int_arr_copy(const __sn__MapIter_int_int_arr *src) {
+    __sn__MapIter_int_int_arr dst;
+    dst.__sn___map = __sn__map_int_int_arr_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_int_int_arr_cleanup(__sn__MapIter_int_int_arr *p) {
+    __sn__map_int_int_arr_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_int_int_arr __attribute__((cleanup(__sn__MapIter_int_int_arr_cleanup)))
+
+static inline void __sn__MapIter_int_int_arr_cleanup_elem(void *p) { __sn__MapIter_int_int_arr_cleanup((__sn__MapIter_int_int_arr *)p); }
+static inline void __sn__MapIter_int_int_arr_copy_into(const void *src, void *dst) { *(__sn__MapIter_int_int_arr *)dst = __sn__MapIter_int_int_arr_copy((const __sn__MapIter_int_int_arr *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_int_int_arr *__sn__MapIter_int_int_arr_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_int_int_arr));
+}
+
+static inline void __sn__MapIter_int_int_arr_release(__sn__MapIter_int_int_arr **p) {
+    if (*p) {
+        __sn__map_int_int_arr_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_int_int_arr __attribute__((cleanup(__sn__MapIter_int_int_arr_release)))
+
+static inline void __sn__MapIter_int_int_arr_release_elem(void *p) { __sn__MapIter_int_int_arr_release((__sn__MapIter_int_int_arr **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_int_int_arr_to_string(const __sn__MapIter_int_int_arr *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_int_int_arr { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_int_int_arr_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_int_int_arr → MapEntry_int_int_arr */
+static inline __sn__MapIter_int_int_arr __sn__map_int_int_arr_iter(__sn__map_int_int_arr *m) {
+    return (__sn__MapIter_int_int_arr){ .__sn___map = __sn__map_int_int_arr_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_int_int_arr_hasNext(__sn__MapIter_int_int_arr *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_int_int_arr __sn__MapIter_int_int_arr_next(__sn__MapIter_int_int_arr *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_int_int_arr e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+
+void __sn__fill(__sn__map_str_double *);
+
+
+
+
+#endif
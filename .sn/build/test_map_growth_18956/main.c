@@ -0,0 +1,97 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_map_int_int __sn__map_int_int * __sn__m = ({
+        __sn__map_int_int *__tmp__ = __sn__map_int_int__new();
+        __tmp__;
+    });
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 10000LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__map_int_int_set(__sn__m, sn_mul_long(__sn__i, 7LL), __sn__i);
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__map_int_int_length(__sn__m)));
+    
+    printf("%lld\n", (long long)(__sn__map_int_int_get(__sn__m, 6993LL)));
+    
+    long long __sn__removed = 0LL;
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 10000LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if ((sn_mod_long(__sn__i, 2LL) == 0LL)) {
+                    if (__sn__map_int_int_remove(__sn__m, sn_mul_long(__sn__i, 7LL))) {
+                        (__sn__removed = sn_add_long(__sn__removed, 1LL));
+                        
+                    }
+                }
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__removed));
+    
+    printf("%lld\n", (long long)(__sn__map_int_int_length(__sn__m)));
+    
+    printf("%s\n", (__sn__map_int_int_has(__sn__m, 14LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__map_int_int_has(__sn__m, 7LL)) ? "true" : "false");
+    
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 20LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__round = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                {
+                    sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 1000LL);
+                    long long __len_0__ = __arr_0__->len;
+                    for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+                        long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+                        {
+                            __sn__map_int_int_set(__sn__m, sn_add_long(100000LL, __sn__i), __sn__round);
+                            
+                        }
+                    }
+                }
+                {
+                    sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 1000LL);
+                    long long __len_0__ = __arr_0__->len;
+                    for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+                        long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+                        {
+                            __sn__map_int_int_remove(__sn__m, sn_add_long(100000LL, __sn__i));
+                            
+                        }
+                    }
+                }
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__map_int_int_length(__sn__m)));
+    
+    long long __sn__sum = 0LL;
+    {
+        sn_auto_MapIter_int_int __sn__MapIter_int_int __sn_iter__ = __sn__map_int_int_iter(__sn__m);
+        while (__sn__MapIter_int_int_hasNext(&__sn_iter__)) {
+            __sn__MapEntry_int_int __sn__e = __sn__MapIter_int_int_next(&__sn_iter__);
+            {
+                (__sn__sum = sn_add_long(__sn__sum, __sn__e.__sn__value));
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__sum));
+    
+    fflush(stdout);
+    return 0;
+}
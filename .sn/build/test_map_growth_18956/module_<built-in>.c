@@ -0,0 +1,7 @@
+#include "sn_types.h"
+
+
+
+
+
+
@@ -0,0 +1,72 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_map_int_str __sn__map_int_str * __sn__m = ({
+        __sn__map_int_str *__tmp__ = __sn__map_int_str__new();
+        __tmp__;
+    });
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 5LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                sn_auto_str char * __sn____chain_tmp_0 = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("v");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                        sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                    });
+                __sn__map_int_str_set(__sn__m, __sn__i, __sn____chain_tmp_0);
+                
+            }
+        }
+    }
+    long long __sn__total = 0LL;
+    long long __sn__count = 0LL;
+    {
+        sn_auto_MapIter_int_str __sn__MapIter_int_str __sn_iter__ = __sn__map_int_str_iter(__sn__m);
+        while (__sn__MapIter_int_str_hasNext(&__sn_iter__)) {
+            sn_auto_MapEntry_int_str __sn__MapEntry_int_str __sn__e = __sn__MapIter_int_str_next(&__sn_iter__);
+            {
+                (__sn__total = sn_add_long(__sn__total, __sn__e.__sn__key));
+                
+                (__sn__count = sn_add_long(__sn__count, sn_str_length(__sn__e.__sn__value)));
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__total));
+    
+    printf("%lld\n", (long long)(__sn__count));
+    
+    sn_auto_arr SnArray * __sn__ks = __sn__map_int_str_keys(__sn__m);
+    printf("%lld\n", (long long)(sn_array_length(__sn__ks)));
+    
+    printf("%lld\n", (long long)(__sn__arr_int_sum_checked(&__sn__ks)));
+    
+    sn_auto_arr SnArray * __sn__vs = __sn__map_int_str_values(__sn__m);
+    printf("%lld\n", (long long)(sn_array_length(__sn__vs)));
+    
+    printf("%s\n", (__sn__arr_contains(&__sn__vs, "v3")) ? "true" : "false");
+    
+    sn_auto_map_str_int __sn__map_str_int * __sn__empty = ({
+        __sn__map_str_int *__tmp__ = __sn__map_str_int__new();
+        __tmp__;
+    });
+    {
+        sn_auto_MapIter_str_int __sn__MapIter_str_int __sn_iter__ = __sn__map_str_int_iter(__sn__empty);
+        while (__sn__MapIter_str_int_hasNext(&__sn_iter__)) {
+            sn_auto_MapEntry_str_int __sn__MapEntry_str_int __sn__e = __sn__MapIter_str_int_next(&__sn_iter__);
+            {
+                sn_println("unreachable");
+                
+            }
+        }
+    }
+    sn_println("done");
+    
+    fflush(stdout);
+    return 0;
+}
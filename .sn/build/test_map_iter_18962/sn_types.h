@@ -0,0 +1,505 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Map: map_int_str (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_int_str;
+
+static uint64_t __sn__map_int_str__hash(const void *p) {
+    const long long *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, (uint64_t)(*k));
+    return h;
+}
+
+static bool __sn__map_int_str__eq(const void *a, const void *b) {
+    const long long *x = a;
+    const long long *y = b;
+    return true
+        && (*x) == (*y);
+}
+
+static const SnMapOps __sn__map_int_str__ops = {
+    .key_size = sizeof(long long),
+    .val_size = sizeof(char *),
+    .hash = __sn__map_int_str__hash,
+    .eq = __sn__map_int_str__eq,
+    .val_copy = sn_copy_str,
+    .val_release = (void (*)(void *))sn_cleanup_str,
+    .key_tag = SN_TAG_INT,
+    .val_tag = SN_TAG_STRING,
+};
+
+static inline __sn__map_int_str *__sn__map_int_str__new(void) {
+    return sn_map_new(&__sn__map_int_str__ops);
+}
+
+static inline __sn__map_int_str *__sn__map_int_str_retain(__sn__map_int_str *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_int_str_release(__sn__map_int_str **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_int_str *__sn__map_int_str_copy(const __sn__map_int_str *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_int_str __attribute__((cleanup(__sn__map_int_str_release)))
+#define sn_auto_ref_map_int_str __attribute__((cleanup(__sn__map_int_str_release)))
+
+static inline void __sn__map_int_str_release_elem(void *p) { __sn__map_int_str_release((__sn__map_int_str **)p); }
+static inline void __sn__map_int_str_retain_into(const void *src, void *dst) { *(__sn__map_int_str **)dst = __sn__map_int_str_retain(*(__sn__map_int_str *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_int_str_to_string(const __sn__map_int_str *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_int_str_set(__sn__map_int_str *m, long long key, char * value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline char * __sn__map_int_str_get(__sn__map_int_str *m, long long key) {
+    const char * *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    char * r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline char * __sn__map_int_str_getOr(__sn__map_int_str *m, long long key, char * fallback) {
+    const char * *v = sn_map_find(m, &key);
+    char * r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_int_str_has(__sn__map_int_str *m, long long key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_int_str_remove(__sn__map_int_str *m, long long key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_int_str_length(__sn__map_int_str *m) {
+    return m->len;
+}
+
+static inline void __sn__map_int_str_clear(__sn__map_int_str *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_int_str_keys(__sn__map_int_str *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_int_str_values(__sn__map_int_str *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_int_str *__sn__map_int_str_clone(__sn__map_int_str *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_int_str (as val) */
+typedef struct {
+    long long __sn__key;
+    char * __sn__value;
+} __sn__MapEntry_int_str;
+/* Value operations */
+static inline __sn__MapEntry_int_str __sn__MapEntry_int_str_copy(const __sn__MapEntry_int_str *src) {
+    __sn__MapEntry_int_str dst;
+    dst.__sn__key = src->__sn__key;
+    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    return dst;
+}
+
+static inline void __sn__MapEntry_int_str_cleanup(__sn__MapEntry_int_str *p) {
+    free(p->__sn__value);
+
+}
+
+#define sn_auto_MapEntry_int_str __attribute__((cleanup(__sn__MapEntry_int_str_cleanup)))
+
+static inline void __sn__MapEntry_int_str_cleanup_elem(void *p) { __sn__MapEntry_int_str_cleanup((__sn__MapEntry_int_str *)p); }
+static inline void __sn__MapEntry_int_str_copy_into(const void *src, void *dst) { *(__sn__MapEntry_int_str *)dst = __sn__MapEntry_int_str_copy((const __sn__MapEntry_int_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_int_str *__sn__MapEntry_int_str_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_int_str));
+}
+
+static inline void __sn__MapEntry_int_str_release(__sn__MapEntry_int_str **p) {
+    if (*p) {
+        free((*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_int_str __attribute__((cleanup(__sn__MapEntry_int_str_release)))
+
+static inline void __sn__MapEntry_int_str_release_elem(void *p) { __sn__MapEntry_int_str_release((__sn__MapEntry_int_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_int_str_to_string(const __sn__MapEntry_int_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_int_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__key);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_int_str (as val) */
+typedef struct {
+    __sn__map_int_str * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_int_str;
+/* Value operations */
+static inline __sn__MapIter_int_str __sn__MapIter_int_str_copy(const __sn__MapIter_int_str *src) {
+    __sn__MapIter_int_str dst;
+    dst.__sn___map = __sn__map_int_str_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_int_str_cleanup(__sn__MapIter_int_str *p) {
+    __sn__map_int_str_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_int_str __attribute__((cleanup(__sn__MapIter_int_str_cleanup)))
+
+static inline void __sn__MapIter_int_str_cleanup_elem(void *p) { __sn__MapIter_int_str_cleanup((__sn__MapIter_int_str *)p); }
+static inline void __sn__MapIter_int_str_copy_into(const void *src, void *dst) { *(__sn__MapIter_int_str *)dst = __sn__MapIter_int_str_copy((const __sn__MapIter_int_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_int_str *__sn__MapIter_int_str_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_int_str));
+}
+
+static inline void __sn__MapIter_int_str_release(__sn__MapIter_int_str **p) {
+    if (*p) {
+        __sn__map_int_str_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_int_str __attribute__((cleanup(__sn__MapIter_int_str_release)))
+
+static inline void __sn__MapIter_int_str_release_elem(void *p) { __sn__MapIter_int_str_release((__sn__MapIter_int_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_int_str_to_string(const __sn__MapIter_int_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_int_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_int_str_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_int_str → MapEntry_int_str */
+static inline __sn__MapIter_int_str __sn__map_int_str_iter(__sn__map_int_str *m) {
+    return (__sn__MapIter_int_str){ .__sn___map = __sn__map_int_str_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_int_str_hasNext(__sn__MapIter_int_str *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_int_str __sn__MapIter_int_str_next(__sn__MapIter_int_str *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_int_str e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+/* Map: map_str_int (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_str_int;
+
+static uint64_t __sn__map_str_int__hash(const void *p) {
+    const char * *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, sn_hash_str((*k)));
+    return h;
+}
+
+static bool __sn__map_str_int__eq(const void *a, const void *b) {
+    const char * *x = a;
+    const char * *y = b;
+    return true        && sn_map_str_eq((*x), (*y));
+}
+
+static const SnMapOps __sn__map_str_int__ops = {
+    .key_size = sizeof(char *),
+    .val_size = sizeof(long long),
+    .hash = __sn__map_str_int__hash,
+    .eq = __sn__map_str_int__eq,
+    .key_copy = sn_copy_str,
+    .key_release = (void (*)(void *))sn_cleanup_str,
+    .key_tag = SN_TAG_STRING,
+    .val_tag = SN_TAG_INT,
+};
+
+static inline __sn__map_str_int *__sn__map_str_int__new(void) {
+    return sn_map_new(&__sn__map_str_int__ops);
+}
+
+static inline __sn__map_str_int *__sn__map_str_int_retain(__sn__map_str_int *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_str_int_release(__sn__map_str_int **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_str_int *__sn__map_str_int_copy(const __sn__map_str_int *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_str_int __attribute__((cleanup(__sn__map_str_int_release)))
+#define sn_auto_ref_map_str_int __attribute__((cleanup(__sn__map_str_int_release)))
+
+static inline void __sn__map_str_int_release_elem(void *p) { __sn__map_str_int_release((__sn__map_str_int **)p); }
+static inline void __sn__map_str_int_retain_into(const void *src, void *dst) { *(__sn__map_str_int **)dst = __sn__map_str_int_retain(*(__sn__map_str_int *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_str_int_to_string(const __sn__map_str_int *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_str_int_set(__sn__map_str_int *m, char * key, long long value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline long long __sn__map_str_int_get(__sn__map_str_int *m, char * key) {
+    const long long *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    long long r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline long long __sn__map_str_int_getOr(__sn__map_str_int *m, char * key, long long fallback) {
+    const long long *v = sn_map_find(m, &key);
+    long long r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_str_int_has(__sn__map_str_int *m, char * key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_str_int_remove(__sn__map_str_int *m, char * key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_str_int_length(__sn__map_str_int *m) {
+    return m->len;
+}
+
+static inline void __sn__map_str_int_clear(__sn__map_str_int *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_str_int_keys(__sn__map_str_int *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_str_int_values(__sn__map_str_int *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_str_int *__sn__map_str_int_clone(__sn__map_str_int *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_str_int (as val) */
+typedef struct {
+    char * __sn__key;
+    long long __sn__value;
+} __sn__MapEntry_str_int;
+/* Value operations */
+static inline __sn__MapEntry_str_int __sn__MapEntry_str_int_copy(const __sn__MapEntry_str_int *src) {
+    __sn__MapEntry_str_int dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__MapEntry_str_int_cleanup(__sn__MapEntry_str_int *p) {
+    free(p->__sn__key);
+
+}
+
+#define sn_auto_MapEntry_str_int __attribute__((cleanup(__sn__MapEntry_str_int_cleanup)))
+
+static inline void __sn__MapEntry_str_int_cleanup_elem(void *p) { __sn__MapEntry_str_int_cleanup((__sn__MapEntry_str_int *)p); }
+static inline void __sn__MapEntry_str_int_copy_into(const void *src, void *dst) { *(__sn__MapEntry_str_int *)dst = __sn__MapEntry_str_int_copy((const __sn__MapEntry_str_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_str_int *__sn__MapEntry_str_int_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_str_int));
+}
+
+static inline void __sn__MapEntry_str_int_release(__sn__MapEntry_str_int **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_str_int __attribute__((cleanup(__sn__MapEntry_str_int_release)))
+
+static inline void __sn__MapEntry_str_int_release_elem(void *p) { __sn__MapEntry_str_int_release((__sn__MapEntry_str_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_str_int_to_string(const __sn__MapEntry_str_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_str_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_str_int (as val) */
+typedef struct {
+    __sn__map_str_int * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_str_int;
+/* Value operations */
+static inline __sn__MapIter_str_int __sn__MapIter_str_int_copy(const __sn__MapIter_str_int *src) {
+    __sn__MapIter_str_int dst;
+    dst.__sn___map = __sn__map_str_int_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_str_int_cleanup(__sn__MapIter_str_int *p) {
+    __sn__map_str_int_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_str_int __attribute__((cleanup(__sn__MapIter_str_int_cleanup)))
+
+static inline void __sn__MapIter_str_int_cleanup_elem(void *p) { __sn__MapIter_str_int_cleanup((__sn__MapIter_str_int *)p); }
+static inline void __sn__MapIter_str_int_copy_into(const void *src, void *dst) { *(__sn__MapIter_str_int *)dst = __sn__MapIter_str_int_copy((const __sn__MapIter_str_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_str_int *__sn__MapIter_str_int_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_str_int));
+}
+
+static inline void __sn__MapIter_str_int_release(__sn__MapIter_str_int **p) {
+    if (*p) {
+        __sn__map_str_int_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_str_int __attribute__((cleanup(__sn__MapIter_str_int_release)))
+
+static inline void __sn__MapIter_str_int_release_elem(void *p) { __sn__MapIter_str_int_release((__sn__MapIter_str_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_str_int_to_string(const __sn__MapIter_str_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_str_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_str_int_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_str_int → MapEntry_str_int */
+static inline __sn__MapIter_str_int __sn__map_str_int_iter(__sn__map_str_int *m) {
+    return (__sn__MapIter_str_int){ .__sn___map = __sn__map_str_int_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_str_int_hasNext(__sn__MapIter_str_int *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_str_int __sn__MapIter_str_int_next(__sn__MapIter_str_int *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_str_int e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+
+
+
+
+
+#endif
@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_map_str_int __sn__map_str_int * __sn__m = ({
+        __sn__map_str_int *__tmp__ = __sn__map_str_int__new();
+        __tmp__;
+    });
+    __sn__map_str_int_set(__sn__m, "a", 1LL);
+    
+    sn_println("before");
+    
+    printf("%lld\n", (long long)(__sn__map_str_int_get(__sn__m, "b")));
+    
+    sn_println("This should not be printed");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "sn_types.h"
+
+
+
+
+__sn__map_int_double * __sn__build(long long __sn__n) {
+
+    sn_auto_map_int_double __sn__map_int_double * __sn__m = ({
+        __sn__map_int_double *__tmp__ = __sn__map_int_double__new();
+        __tmp__;
+    });
+
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, __sn__n);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__map_int_double_set(__sn__m, __sn__i, sn_mul_double(__sn__i, 0.5));
+                
+            }
+        }
+    }
+
+    {
+        __sn__map_int_double * __ret__ = __sn__m;
+        __sn__m = NULL;
+        return __ret__;
+    }}
+
+
+
+int main() {
+    sn_auto_Registry __sn__Registry * __sn__r = ({
+        __sn__Registry *__tmp__ = __sn__Registry__new();
+        __tmp__->__sn__name = strdup("reg");
+        __tmp__->__sn__ids = ({
+        __sn__map_str_int *__tmp__ = __sn__map_str_int__new();
+        __tmp__;
+    });
+        __tmp__;
+    });
+    __sn__map_str_int_set(__sn__r->__sn__ids, "a", 1LL);
+    
+    __sn__map_str_int_set(__sn__r->__sn__ids, "b", 2LL);
+    
+    printf("%lld\n", (long long)(__sn__map_str_int_length(__sn__r->__sn__ids)));
+    
+    printf("%lld\n", (long long)(__sn__map_str_int_get(__sn__r->__sn__ids, "b")));
+    
+    sn_auto_map_str_map_int_bool __sn__map_str_map_int_bool * __sn__groups = ({
+        __sn__map_str_map_int_bool *__tmp__ = __sn__map_str_map_int_bool__new();
+        __tmp__;
+    });
+    sn_auto_map_int_bool __sn__map_int_bool * __sn__evens = ({
+        __sn__map_int_bool *__tmp__ = __sn__map_int_bool__new();
+        __tmp__;
+    });
+    __sn__map_int_bool_set(__sn__evens, 2LL, true);
+    
+    __sn__map_int_bool_set(__sn__evens, 4LL, true);
+    
+    __sn__map_str_map_int_bool_set(__sn__groups, "evens", __sn__evens);
+    
+    __sn__map_int_bool_set(__sn__evens, 6LL, true);
+    
+    sn_auto_map_int_bool __sn__map_int_bool * __sn__g = __sn__map_str_map_int_bool_get(__sn__groups, "evens");
+    printf("%lld\n", (long long)(__sn__map_int_bool_length(__sn__g)));
+    
+    sn_auto_map_int_double __sn__map_int_double * __sn__halves = __sn__build(4LL);
+    printf("%.5f\n", (double)(__sn__map_int_double_get(__sn__halves, 3LL)));
+    
+    sn_auto_map_str_Point __sn__map_str_Point * __sn__pts = ({
+        __sn__map_str_Point *__tmp__ = __sn__map_str_Point__new();
+        __tmp__;
+    });
+    __sn__map_str_Point_set(__sn__pts, "origin", (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL });
+    
+    __sn__Point __sn__p = __sn__map_str_Point_getOr(__sn__pts, "missing", (__sn__Point){ .__sn__x = 9LL, .__sn__y = 9LL });
+    printf("%lld\n", (long long)(__sn__p.__sn__x));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__map_str_Point_to_string(__sn__pts);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_map_double_str __sn__map_double_str * __sn__f = ({
+        __sn__map_double_str *__tmp__ = __sn__map_double_str__new();
+        __tmp__;
+    });
+    __sn__map_double_str_set(__sn__f, 0.0, "zero");
+    
+    { sn_auto_str char *__ps__ = __sn__map_double_str_get(__sn__f, (-0.0)); sn_println(__ps__); };
+    
+    printf("%s\n", (__sn__map_double_str_has(__sn__f, 1.5)) ? "true" : "false");
+    
+    fflush(stdout);
+    return 0;
+}
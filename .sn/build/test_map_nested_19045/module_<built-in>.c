@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,1582 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map: map_str_int (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_str_int;
+
+static uint64_t __sn__map_str_int__hash(const void *p) {
+    const char * *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, sn_hash_str((*k)));
+    return h;
+}
+
+static bool __sn__map_str_int__eq(const void *a, const void *b) {
+    const char * *x = a;
+    const char * *y = b;
+    return true        && sn_map_str_eq((*x), (*y));
+}
+
+static const SnMapOps __sn__map_str_int__ops = {
+    .key_size = sizeof(char *),
+    .val_size = sizeof(long long),
+    .hash = __sn__map_str_int__hash,
+    .eq = __sn__map_str_int__eq,
+    .key_copy = sn_copy_str,
+    .key_release = (void (*)(void *))sn_cleanup_str,
+    .key_tag = SN_TAG_STRING,
+    .val_tag = SN_TAG_INT,
+};
+
+static inline __sn__map_str_int *__sn__map_str_int__new(void) {
+    return sn_map_new(&__sn__map_str_int__ops);
+}
+
+static inline __sn__map_str_int *__sn__map_str_int_retain(__sn__map_str_int *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_str_int_release(__sn__map_str_int **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_str_int *__sn__map_str_int_copy(const __sn__map_str_int *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_str_int __attribute__((cleanup(__sn__map_str_int_release)))
+#define sn_auto_ref_map_str_int __attribute__((cleanup(__sn__map_str_int_release)))
+
+static inline void __sn__map_str_int_release_elem(void *p) { __sn__map_str_int_release((__sn__map_str_int **)p); }
+static inline void __sn__map_str_int_retain_into(const void *src, void *dst) { *(__sn__map_str_int **)dst = __sn__map_str_int_retain(*(__sn__map_str_int *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_str_int_to_string(const __sn__map_str_int *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_str_int_set(__sn__map_str_int *m, char * key, long long value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline long long __sn__map_str_int_get(__sn__map_str_int *m, char * key) {
+    const long long *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    long long r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline long long __sn__map_str_int_getOr(__sn__map_str_int *m, char * key, long long fallback) {
+    const long long *v = sn_map_find(m, &key);
+    long long r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_str_int_has(__sn__map_str_int *m, char * key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_str_int_remove(__sn__map_str_int *m, char * key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_str_int_length(__sn__map_str_int *m) {
+    return m->len;
+}
+
+static inline void __sn__map_str_int_clear(__sn__map_str_int *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_str_int_keys(__sn__map_str_int *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_str_int_values(__sn__map_str_int *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_str_int *__sn__map_str_int_clone(__sn__map_str_int *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: Registry (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    char * __sn__name;
+    __sn__map_str_int * __sn__ids;
+} __sn__Registry;
+
+
+static inline __sn__Registry *__sn__Registry__new(void) {
+    __sn__Registry *p = calloc(1, sizeof(__sn__Registry));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Registry *__sn__Registry_retain(__sn__Registry *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Registry_release(__sn__Registry **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free((*p)->__sn__name);
+        __sn__map_str_int_release(&(*p)->__sn__ids);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Registry *__sn__Registry_copy(const __sn__Registry *src) {
+    __sn__Registry *dst = calloc(1, sizeof(__sn__Registry));
+    dst->__rc__ = 1;
+    dst->__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst->__sn__ids = __sn__map_str_int_retain(src->__sn__ids);
+    return dst;
+}
+
+#define sn_auto_Registry __attribute__((cleanup(__sn__Registry_release)))
+#define sn_auto_ref_Registry __attribute__((cleanup(__sn__Registry_release)))
+
+static inline void __sn__Registry_release_elem(void *p) { __sn__Registry_release((__sn__Registry **)p); }
+static inline void __sn__Registry_retain_into(const void *src, void *dst) { *(__sn__Registry **)dst = __sn__Registry_retain(*(__sn__Registry *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Registry_to_string(const __sn__Registry *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Registry { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "ids: ");
+    { char *__fs__ = __sn__map_str_int_to_string(p->__sn__ids); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+/* Struct: MapEntry_str_int (as val) */
+typedef struct {
+    char * __sn__key;
+    long long __sn__value;
+} __sn__MapEntry_str_int;
+/* Value operations */
+static inline __sn__MapEntry_str_int __sn__MapEntry_str_int_copy(const __sn__MapEntry_str_int *src) {
+    __sn__MapEntry_str_int dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__MapEntry_str_int_cleanup(__sn__MapEntry_str_int *p) {
+    free(p->__sn__key);
+
+}
+
+#define sn_auto_MapEntry_str_int __attribute__((cleanup(__sn__MapEntry_str_int_cleanup)))
+
+static inline void __sn__MapEntry_str_int_cleanup_elem(void *p) { __sn__MapEntry_str_int_cleanup((__sn__MapEntry_str_int *)p); }
+static inline void __sn__MapEntry_str_int_copy_into(const void *src, void *dst) { *(__sn__MapEntry_str_int *)dst = __sn__MapEntry_str_int_copy((const __sn__MapEntry_str_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_str_int *__sn__MapEntry_str_int_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_str_int));
+}
+
+static inline void __sn__MapEntry_str_int_release(__sn__MapEntry_str_int **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_str_int __attribute__((cleanup(__sn__MapEntry_str_int_release)))
+
+static inline void __sn__MapEntry_str_int_release_elem(void *p) { __sn__MapEntry_str_int_release((__sn__MapEntry_str_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_str_int_to_string(const __sn__MapEntry_str_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_str_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_str_int (as val) */
+typedef struct {
+    __sn__map_str_int * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_str_int;
+/* Value operations */
+static inline __sn__MapIter_str_int __sn__MapIter_str_int_copy(const __sn__MapIter_str_int *src) {
+    __sn__MapIter_str_int dst;
+    dst.__sn___map = __sn__map_str_int_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_str_int_cleanup(__sn__MapIter_str_int *p) {
+    __sn__map_str_int_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_str_int __attribute__((cleanup(__sn__MapIter_str_int_cleanup)))
+
+static inline void __sn__MapIter_str_int_cleanup_elem(void *p) { __sn__MapIter_str_int_cleanup((__sn__MapIter_str_int *)p); }
+static inline void __sn__MapIter_str_int_copy_into(const void *src, void *dst) { *(__sn__MapIter_str_int *)dst = __sn__MapIter_str_int_copy((const __sn__MapIter_str_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_str_int *__sn__MapIter_str_int_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_str_int));
+}
+
+static inline void __sn__MapIter_str_int_release(__sn__MapIter_str_int **p) {
+    if (*p) {
+        __sn__map_str_int_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_str_int __attribute__((cleanup(__sn__MapIter_str_int_release)))
+
+static inline void __sn__MapIter_str_int_release_elem(void *p) { __sn__MapIter_str_int_release((__sn__MapIter_str_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_str_int_to_string(const __sn__MapIter_str_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_str_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_str_int_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_str_int → MapEntry_str_int */
+static inline __sn__MapIter_str_int __sn__map_str_int_iter(__sn__map_str_int *m) {
+    return (__sn__MapIter_str_int){ .__sn___map = __sn__map_str_int_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_str_int_hasNext(__sn__MapIter_str_int *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_str_int __sn__MapIter_str_int_next(__sn__MapIter_str_int *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_str_int e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+/* Map: map_int_double (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_int_double;
+
+static uint64_t __sn__map_int_double__hash(const void *p) {
+    const long long *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, (uint64_t)(*k));
+    return h;
+}
+
+static bool __sn__map_int_double__eq(const void *a, const void *b) {
+    const long long *x = a;
+    const long long *y = b;
+    return true
+        && (*x) == (*y);
+}
+
+static const SnMapOps __sn__map_int_double__ops = {
+    .key_size = sizeof(long long),
+    .val_size = sizeof(double),
+    .hash = __sn__map_int_double__hash,
+    .eq = __sn__map_int_double__eq,
+    .key_tag = SN_TAG_INT,
+    .val_tag = SN_TAG_DOUBLE,
+};
+
+static inline __sn__map_int_double *__sn__map_int_double__new(void) {
+    return sn_map_new(&__sn__map_int_double__ops);
+}
+
+static inline __sn__map_int_double *__sn__map_int_double_retain(__sn__map_int_double *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_int_double_release(__sn__map_int_double **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_int_double *__sn__map_int_double_copy(const __sn__map_int_double *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_int_double __attribute__((cleanup(__sn__map_int_double_release)))
+#define sn_auto_ref_map_int_double __attribute__((cleanup(__sn__map_int_double_release)))
+
+static inline void __sn__map_int_double_release_elem(void *p) { __sn__map_int_double_release((__sn__map_int_double **)p); }
+static inline void __sn__map_int_double_retain_into(const void *src, void *dst) { *(__sn__map_int_double **)dst = __sn__map_int_double_retain(*(__sn__map_int_double *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_int_double_to_string(const __sn__map_int_double *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_int_double_set(__sn__map_int_double *m, long long key, double value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline double __sn__map_int_double_get(__sn__map_int_double *m, long long key) {
+    const double *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    double r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline double __sn__map_int_double_getOr(__sn__map_int_double *m, long long key, double fallback) {
+    const double *v = sn_map_find(m, &key);
+    double r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_int_double_has(__sn__map_int_double *m, long long key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_int_double_remove(__sn__map_int_double *m, long long key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_int_double_length(__sn__map_int_double *m) {
+    return m->len;
+}
+
+static inline void __sn__map_int_double_clear(__sn__map_int_double *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_int_double_keys(__sn__map_int_double *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_int_double_values(__sn__map_int_double *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_int_double *__sn__map_int_double_clone(__sn__map_int_double *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_int_double (as val) */
+typedef struct {
+    long long __sn__key;
+    double __sn__value;
+} __sn__MapEntry_int_double;
+/* Value operations */
+static inline __sn__MapEntry_int_double __sn__MapEntry_int_double_copy(const __sn__MapEntry_int_double *src) {
+    __sn__MapEntry_int_double dst;
+    dst.__sn__key = src->__sn__key;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__MapEntry_int_double_cleanup(__sn__MapEntry_int_double *p) {
+
+}
+
+#define sn_auto_MapEntry_int_double __attribute__((cleanup(__sn__MapEntry_int_double_cleanup)))
+
+static inline void __sn__MapEntry_int_double_cleanup_elem(void *p) { __sn__MapEntry_int_double_cleanup((__sn__MapEntry_int_double *)p); }
+static inline void __sn__MapEntry_int_double_copy_into(const void *src, void *dst) { *(__sn__MapEntry_int_double *)dst = __sn__MapEntry_int_double_copy((const __sn__MapEntry_int_double *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_int_double *__sn__MapEntry_int_double_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_int_double));
+}
+
+static inline void __sn__MapEntry_int_double_release(__sn__MapEntry_int_double **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_int_double __attribute__((cleanup(__sn__MapEntry_int_double_release)))
+
+static inline void __sn__MapEntry_int_double_release_elem(void *p) { __sn__MapEntry_int_double_release((__sn__MapEntry_int_double **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_int_double_to_string(const __sn__MapEntry_int_double *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_int_double { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__key);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_int_double (as val) */
+typedef struct {
+    __sn__map_int_double * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_int_double;
+/* Value operations */
+static inline __sn__MapIter_int_double __sn__MapIter_int_double_copy(const __sn__MapIter_int_double *src) {
+    __sn__MapIter_int_double dst;
+    dst.__sn___map = __sn__map_int_double_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_int_double_cleanup(__sn__MapIter_int_double *p) {
+    __sn__map_int_double_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_int_double __attribute__((cleanup(__sn__MapIter_int_double_cleanup)))
+
+static inline void __sn__MapIter_int_double_cleanup_elem(void *p) { __sn__MapIter_int_double_cleanup((__sn__MapIter_int_double *)p); }
+static inline void __sn__MapIter_int_double_copy_into(const void *src, void *dst) { *(__sn__MapIter_int_double *)dst = __sn__MapIter_int_double_copy((const __sn__MapIter_int_double *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_int_double *__sn__MapIter_int_double_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_int_double));
+}
+
+static inline void __sn__MapIter_int_double_release(__sn__MapIter_int_double **p) {
+    if (*p) {
+        __sn__map_int_double_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_int_double __attribute__((cleanup(__sn__MapIter_int_double_release)))
+
+static inline void __sn__MapIter_int_double_release_elem(void *p) { __sn__MapIter_int_double_release((__sn__MapIter_int_double **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_int_double_to_string(const __sn__MapIter_int_double *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_int_double { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_int_double_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_int_double → MapEntry_int_double */
+static inline __sn__MapIter_int_double __sn__map_int_double_iter(__sn__map_int_double *m) {
+    return (__sn__MapIter_int_double){ .__sn___map = __sn__map_int_double_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_int_double_hasNext(__sn__MapIter_int_double *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_int_double __sn__MapIter_int_double_next(__sn__MapIter_int_double *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_int_double e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+/* Map: map_int_bool (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_int_bool;
+
+static uint64_t __sn__map_int_bool__hash(const void *p) {
+    const long long *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, (uint64_t)(*k));
+    return h;
+}
+
+static bool __sn__map_int_bool__eq(const void *a, const void *b) {
+    const long long *x = a;
+    const long long *y = b;
+    return true
+        && (*x) == (*y);
+}
+
+static const SnMapOps __sn__map_int_bool__ops = {
+    .key_size = sizeof(long long),
+    .val_size = sizeof(bool),
+    .hash = __sn__map_int_bool__hash,
+    .eq = __sn__map_int_bool__eq,
+    .key_tag = SN_TAG_INT,
+    .val_tag = SN_TAG_BOOL,
+};
+
+static inline __sn__map_int_bool *__sn__map_int_bool__new(void) {
+    return sn_map_new(&__sn__map_int_bool__ops);
+}
+
+static inline __sn__map_int_bool *__sn__map_int_bool_retain(__sn__map_int_bool *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_int_bool_release(__sn__map_int_bool **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_int_bool *__sn__map_int_bool_copy(const __sn__map_int_bool *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_int_bool __attribute__((cleanup(__sn__map_int_bool_release)))
+#define sn_auto_ref_map_int_bool __attribute__((cleanup(__sn__map_int_bool_release)))
+
+static inline void __sn__map_int_bool_release_elem(void *p) { __sn__map_int_bool_release((__sn__map_int_bool **)p); }
+static inline void __sn__map_int_bool_retain_into(const void *src, void *dst) { *(__sn__map_int_bool **)dst = __sn__map_int_bool_retain(*(__sn__map_int_bool *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_int_bool_to_string(const __sn__map_int_bool *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_int_bool_set(__sn__map_int_bool *m, long long key, bool value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline bool __sn__map_int_bool_get(__sn__map_int_bool *m, long long key) {
+    const bool *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    bool r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline bool __sn__map_int_bool_getOr(__sn__map_int_bool *m, long long key, bool fallback) {
+    const bool *v = sn_map_find(m, &key);
+    bool r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_int_bool_has(__sn__map_int_bool *m, long long key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_int_bool_remove(__sn__map_int_bool *m, long long key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_int_bool_length(__sn__map_int_bool *m) {
+    return m->len;
+}
+
+static inline void __sn__map_int_bool_clear(__sn__map_int_bool *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_int_bool_keys(__sn__map_int_bool *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_int_bool_values(__sn__map_int_bool *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_int_bool *__sn__map_int_bool_clone(__sn__map_int_bool *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_int_bool (as val) */
+typedef struct {
+    long long __sn__key;
+    bool __sn__value;
+} __sn__MapEntry_int_bool;
+/* Value operations */
+static inline __sn__MapEntry_int_bool __sn__MapEntry_int_bool_copy(const __sn__MapEntry_int_bool *src) {
+    __sn__MapEntry_int_bool dst;
+    dst.__sn__key = src->__sn__key;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__MapEntry_int_bool_cleanup(__sn__MapEntry_int_bool *p) {
+
+}
+
+#define sn_auto_MapEntry_int_bool __attribute__((cleanup(__sn__MapEntry_int_bool_cleanup)))
+
+static inline void __sn__MapEntry_int_bool_cleanup_elem(void *p) { __sn__MapEntry_int_bool_cleanup((__sn__MapEntry_int_bool *)p); }
+static inline void __sn__MapEntry_int_bool_copy_into(const void *src, void *dst) { *(__sn__MapEntry_int_bool *)dst = __sn__MapEntry_int_bool_copy((const __sn__MapEntry_int_bool *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_int_bool *__sn__MapEntry_int_bool_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_int_bool));
+}
+
+static inline void __sn__MapEntry_int_bool_release(__sn__MapEntry_int_bool **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_int_bool __attribute__((cleanup(__sn__MapEntry_int_bool_release)))
+
+static inline void __sn__MapEntry_int_bool_release_elem(void *p) { __sn__MapEntry_int_bool_release((__sn__MapEntry_int_bool **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_int_bool_to_string(const __sn__MapEntry_int_bool *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_int_bool { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__key);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__value ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_int_bool (as val) */
+typedef struct {
+    __sn__map_int_bool * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_int_bool;
+/* Value operations */
+static inline __sn__MapIter_int_bool __sn__MapIter_int_bool_copy(const __sn__MapIter_int_bool *src) {
+    __sn__MapIter_int_bool dst;
+    dst.__sn___map = __sn__map_int_bool_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_int_bool_cleanup(__sn__MapIter_int_bool *p) {
+    __sn__map_int_bool_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_int_bool __attribute__((cleanup(__sn__MapIter_int_bool_cleanup)))
+
+static inline void __sn__MapIter_int_bool_cleanup_elem(void *p) { __sn__MapIter_int_bool_cleanup((__sn__MapIter_int_bool *)p); }
+static inline void __sn__MapIter_int_bool_copy_into(const void *src, void *dst) { *(__sn__MapIter_int_bool *)dst = __sn__MapIter_int_bool_copy((const __sn__MapIter_int_bool *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_int_bool *__sn__MapIter_int_bool_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_int_bool));
+}
+
+static inline void __sn__MapIter_int_bool_release(__sn__MapIter_int_bool **p) {
+    if (*p) {
+        __sn__map_int_bool_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_int_bool __attribute__((cleanup(__sn__MapIter_int_bool_release)))
+
+static inline void __sn__MapIter_int_bool_release_elem(void *p) { __sn__MapIter_int_bool_release((__sn__MapIter_int_bool **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_int_bool_to_string(const __sn__MapIter_int_bool *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_int_bool { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_int_bool_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_int_bool → MapEntry_int_bool */
+static inline __sn__MapIter_int_bool __sn__map_int_bool_iter(__sn__map_int_bool *m) {
+    return (__sn__MapIter_int_bool){ .__sn___map = __sn__map_int_bool_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_int_bool_hasNext(__sn__MapIter_int_bool *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_int_bool __sn__MapIter_int_bool_next(__sn__MapIter_int_bool *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_int_bool e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+/* Map: map_str_map_int_bool (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_str_map_int_bool;
+
+static uint64_t __sn__map_str_map_int_bool__hash(const void *p) {
+    const char * *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, sn_hash_str((*k)));
+    return h;
+}
+
+static bool __sn__map_str_map_int_bool__eq(const void *a, const void *b) {
+    const char * *x = a;
+    const char * *y = b;
+    return true        && sn_map_str_eq((*x), (*y));
+}
+
+static char *__sn__map_str_map_int_bool__val_str(const void *p) {
+    return __sn__map_int_bool_to_string(*(__sn__map_int_bool *const *)p);
+}
+
+static const SnMapOps __sn__map_str_map_int_bool__ops = {
+    .key_size = sizeof(char *),
+    .val_size = sizeof(__sn__map_int_bool *),
+    .hash = __sn__map_str_map_int_bool__hash,
+    .eq = __sn__map_str_map_int_bool__eq,
+    .key_copy = sn_copy_str,
+    .key_release = (void (*)(void *))sn_cleanup_str,
+    .val_copy = __sn__map_int_bool_retain_into,
+    .val_release = __sn__map_int_bool_release_elem,
+    .key_tag = SN_TAG_STRING,
+    .val_tag = SN_TAG_STRUCT,
+    .val_str = __sn__map_str_map_int_bool__val_str,
+};
+
+static inline __sn__map_str_map_int_bool *__sn__map_str_map_int_bool__new(void) {
+    return sn_map_new(&__sn__map_str_map_int_bool__ops);
+}
+
+static inline __sn__map_str_map_int_bool *__sn__map_str_map_int_bool_retain(__sn__map_str_map_int_bool *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_str_map_int_bool_release(__sn__map_str_map_int_bool **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_str_map_int_bool *__sn__map_str_map_int_bool_copy(const __sn__map_str_map_int_bool *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_str_map_int_bool __attribute__((cleanup(__sn__map_str_map_int_bool_release)))
+#define sn_auto_ref_map_str_map_int_bool __attribute__((cleanup(__sn__map_str_map_int_bool_release)))
+
+static inline void __sn__map_str_map_int_bool_release_elem(void *p) { __sn__map_str_map_int_bool_release((__sn__map_str_map_int_bool **)p); }
+static inline void __sn__map_str_map_int_bool_retain_into(const void *src, void *dst) { *(__sn__map_str_map_int_bool **)dst = __sn__map_str_map_int_bool_retain(*(__sn__map_str_map_int_bool *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_str_map_int_bool_to_string(const __sn__map_str_map_int_bool *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_str_map_int_bool_set(__sn__map_str_map_int_bool *m, char * key, __sn__map_int_bool * value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline __sn__map_int_bool * __sn__map_str_map_int_bool_get(__sn__map_str_map_int_bool *m, char * key) {
+    const __sn__map_int_bool * *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    __sn__map_int_bool * r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline __sn__map_int_bool * __sn__map_str_map_int_bool_getOr(__sn__map_str_map_int_bool *m, char * key, __sn__map_int_bool * fallback) {
+    const __sn__map_int_bool * *v = sn_map_find(m, &key);
+    __sn__map_int_bool * r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_str_map_int_bool_has(__sn__map_str_map_int_bool *m, char * key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_str_map_int_bool_remove(__sn__map_str_map_int_bool *m, char * key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_str_map_int_bool_length(__sn__map_str_map_int_bool *m) {
+    return m->len;
+}
+
+static inline void __sn__map_str_map_int_bool_clear(__sn__map_str_map_int_bool *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_str_map_int_bool_keys(__sn__map_str_map_int_bool *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_str_map_int_bool_values(__sn__map_str_map_int_bool *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_str_map_int_bool *__sn__map_str_map_int_bool_clone(__sn__map_str_map_int_bool *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_str_map_int_bool (as val) */
+typedef struct {
+    char * __sn__key;
+    __sn__map_int_bool * __sn__value;
+} __sn__MapEntry_str_map_int_bool;
+/* Value operations */
+static inline __sn__MapEntry_str_map_int_bool __sn__MapEntry_str_map_int_bool_copy(const __sn__MapEntry_str_map_int_bool *src) {
+    __sn__MapEntry_str_map_int_bool dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = __sn__map_int_bool_retain(src->__sn__value);
+    return dst;
+}
+
+static inline void __sn__MapEntry_str_map_int_bool_cleanup(__sn__MapEntry_str_map_int_bool *p) {
+    free(p->__sn__key);
+    __sn__map_int_bool_release(&p->__sn__value);
+
+}
+
+#define sn_auto_MapEntry_str_map_int_bool __attribute__((cleanup(__sn__MapEntry_str_map_int_bool_cleanup)))
+
+static inline void __sn__MapEntry_str_map_int_bool_cleanup_elem(void *p) { __sn__MapEntry_str_map_int_bool_cleanup((__sn__MapEntry_str_map_int_bool *)p); }
+static inline void __sn__MapEntry_str_map_int_bool_copy_into(const void *src, void *dst) { *(__sn__MapEntry_str_map_int_bool *)dst = __sn__MapEntry_str_map_int_bool_copy((const __sn__MapEntry_str_map_int_bool *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_str_map_int_bool *__sn__MapEntry_str_map_int_bool_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_str_map_int_bool));
+}
+
+static inline void __sn__MapEntry_str_map_int_bool_release(__sn__MapEntry_str_map_int_bool **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        __sn__map_int_bool_release(&(*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_str_map_int_bool __attribute__((cleanup(__sn__MapEntry_str_map_int_bool_release)))
+
+static inline void __sn__MapEntry_str_map_int_bool_release_elem(void *p) { __sn__MapEntry_str_map_int_bool_release((__sn__MapEntry_str_map_int_bool **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_str_map_int_bool_to_string(const __sn__MapEntry_str_map_int_bool *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_str_map_int_bool { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    { char *__fs__ = __sn__map_int_bool_to_string(p->__sn__value); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_str_map_int_bool (as val) */
+typedef struct {
+    __sn__map_str_map_int_bool * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_str_map_int_bool;
+/* Value operations */
+static inline __sn__MapIter_str_map_int_bool __sn__MapIter_str_map_int_bool_copy(const __sn__MapIter_str_map_int_bool *src) {
+    __sn__MapIter_str_map_int_bool dst;
+    dst.__sn___map = __sn__map_str_map_int_bool_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_str_map_int_bool_cleanup(__sn__MapIter_str_map_int_bool *p) {
+    __sn__map_str_map_int_bool_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_str_map_int_bool __attribute__((cleanup(__sn__MapIter_str_map_int_bool_cleanup)))
+
+static inline void __sn__MapIter_str_map_int_bool_cleanup_elem(void *p) { __sn__MapIter_str_map_int_bool_cleanup((__sn__MapIter_str_map_int_bool *)p); }
+static inline void __sn__MapIter_str_map_int_bool_copy_into(const void *src, void *dst) { *(__sn__MapIter_str_map_int_bool *)dst = __sn__MapIter_str_map_int_bool_copy((const __sn__MapIter_str_map_int_bool *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_str_map_int_bool *__sn__MapIter_str_map_int_bool_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_str_map_int_bool));
+}
+
+static inline void __sn__MapIter_str_map_int_bool_release(__sn__MapIter_str_map_int_bool **p) {
+    if (*p) {
+        __sn__map_str_map_int_bool_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_str_map_int_bool __attribute__((cleanup(__sn__MapIter_str_map_int_bool_release)))
+
+static inline void __sn__MapIter_str_map_int_bool_release_elem(void *p) { __sn__MapIter_str_map_int_bool_release((__sn__MapIter_str_map_int_bool **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_str_map_int_bool_to_string(const __sn__MapIter_str_map_int_bool *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_str_map_int_bool { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_str_map_int_bool_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_str_map_int_bool → MapEntry_str_map_int_bool */
+static inline __sn__MapIter_str_map_int_bool __sn__map_str_map_int_bool_iter(__sn__map_str_map_int_bool *m) {
+    return (__sn__MapIter_str_map_int_bool){ .__sn___map = __sn__map_str_map_int_bool_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_str_map_int_bool_hasNext(__sn__MapIter_str_map_int_bool *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_str_map_int_bool __sn__MapIter_str_map_int_bool_next(__sn__MapIter_str_map_int_bool *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_str_map_int_bool e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+/* Map: map_str_Point (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_str_Point;
+
+static uint64_t __sn__map_str_Point__hash(const void *p) {
+    const char * *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, sn_hash_str((*k)));
+    return h;
+}
+
+static bool __sn__map_str_Point__eq(const void *a, const void *b) {
+    const char * *x = a;
+    const char * *y = b;
+    return true        && sn_map_str_eq((*x), (*y));
+}
+
+static char *__sn__map_str_Point__val_str(const void *p) {
+    return __sn__Point_to_string((const __sn__Point *)p);
+}
+
+static const SnMapOps __sn__map_str_Point__ops = {
+    .key_size = sizeof(char *),
+    .val_size = sizeof(__sn__Point),
+    .hash = __sn__map_str_Point__hash,
+    .eq = __sn__map_str_Point__eq,
+    .key_copy = sn_copy_str,
+    .key_release = (void (*)(void *))sn_cleanup_str,
+    .key_tag = SN_TAG_STRING,
+    .val_tag = SN_TAG_STRUCT,
+    .val_str = __sn__map_str_Point__val_str,
+};
+
+static inline __sn__map_str_Point *__sn__map_str_Point__new(void) {
+    return sn_map_new(&__sn__map_str_Point__ops);
+}
+
+static inline __sn__map_str_Point *__sn__map_str_Point_retain(__sn__map_str_Point *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_str_Point_release(__sn__map_str_Point **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_str_Point *__sn__map_str_Point_copy(const __sn__map_str_Point *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_str_Point __attribute__((cleanup(__sn__map_str_Point_release)))
+#define sn_auto_ref_map_str_Point __attribute__((cleanup(__sn__map_str_Point_release)))
+
+static inline void __sn__map_str_Point_release_elem(void *p) { __sn__map_str_Point_release((__sn__map_str_Point **)p); }
+static inline void __sn__map_str_Point_retain_into(const void *src, void *dst) { *(__sn__map_str_Point **)dst = __sn__map_str_Point_retain(*(__sn__map_str_Point *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_str_Point_to_string(const __sn__map_str_Point *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_str_Point_set(__sn__map_str_Point *m, char * key, __sn__Point value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline __sn__Point __sn__map_str_Point_get(__sn__map_str_Point *m, char * key) {
+    const __sn__Point *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    __sn__Point r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline __sn__Point __sn__map_str_Point_getOr(__sn__map_str_Point *m, char * key, __sn__Point fallback) {
+    const __sn__Point *v = sn_map_find(m, &key);
+    __sn__Point r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_str_Point_has(__sn__map_str_Point *m, char * key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_str_Point_remove(__sn__map_str_Point *m, char * key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_str_Point_length(__sn__map_str_Point *m) {
+    return m->len;
+}
+
+static inline void __sn__map_str_Point_clear(__sn__map_str_Point *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_str_Point_keys(__sn__map_str_Point *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_str_Point_values(__sn__map_str_Point *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_str_Point *__sn__map_str_Point_clone(__sn__map_str_Point *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_str_Point (as val) */
+typedef struct {
+    char * __sn__key;
+    __sn__Point __sn__value;
+} __sn__MapEntry_str_Point;
+/* Value operations */
+static inline __sn__MapEntry_str_Point __sn__MapEntry_str_Point_copy(const __sn__MapEntry_str_Point *src) {
+    __sn__MapEntry_str_Point dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = __sn__Point_copy(&src->__sn__value);
+    return dst;
+}
+
+static inline void __sn__MapEntry_str_Point_cleanup(__sn__MapEntry_str_Point *p) {
+    free(p->__sn__key);
+
+}
+
+#define sn_auto_MapEntry_str_Point __attribute__((cleanup(__sn__MapEntry_str_Point_cleanup)))
+
+static inline void __sn__MapEntry_str_Point_cleanup_elem(void *p) { __sn__MapEntry_str_Point_cleanup((__sn__MapEntry_str_Point *)p); }
+static inline void __sn__MapEntry_str_Point_copy_into(const void *src, void *dst) { *(__sn__MapEntry_str_Point *)dst = __sn__MapEntry_str_Point_copy((const __sn__MapEntry_str_Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_str_Point *__sn__MapEntry_str_Point_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_str_Point));
+}
+
+static inline void __sn__MapEntry_str_Point_release(__sn__MapEntry_str_Point **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_str_Point __attribute__((cleanup(__sn__MapEntry_str_Point_release)))
+
+static inline void __sn__MapEntry_str_Point_release_elem(void *p) { __sn__MapEntry_str_Point_release((__sn__MapEntry_str_Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_str_Point_to_string(const __sn__MapEntry_str_Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_str_Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__value); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_str_Point (as val) */
+typedef struct {
+    __sn__map_str_Point * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_str_Point;
+/* Value operations */
+static inline __sn__MapIter_str_Point __sn__MapIter_str_Point_copy(const __sn__MapIter_str_Point *src) {
+    __sn__MapIter_str_Point dst;
+    dst.__sn___map = __sn__map_str_Point_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_str_Point_cleanup(__sn__MapIter_str_Point *p) {
+    __sn__map_str_Point_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_str_Point __attribute__((cleanup(__sn__MapIter_str_Point_cleanup)))
+
+static inline void __sn__MapIter_str_Point_cleanup_elem(void *p) { __sn__MapIter_str_Point_cleanup((__sn__MapIter_str_Point *)p); }
+static inline void __sn__MapIter_str_Point_copy_into(const void *src, void *dst) { *(__sn__MapIter_str_Point *)dst = __sn__MapIter_str_Point_copy((const __sn__MapIter_str_Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_str_Point *__sn__MapIter_str_Point_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_str_Point));
+}
+
+static inline void __sn__MapIter_str_Point_release(__sn__MapIter_str_Point **p) {
+    if (*p) {
+        __sn__map_str_Point_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_str_Point __attribute__((cleanup(__sn__MapIter_str_Point_release)))
+
+static inline void __sn__MapIter_str_Point_release_elem(void *p) { __sn__MapIter_str_Point_release((__sn__MapIter_str_Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_str_Point_to_string(const __sn__MapIter_str_Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_str_Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_str_Point_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_str_Point → MapEntry_str_Point */
+static inline __sn__MapIter_str_Point __sn__map_str_Point_iter(__sn__map_str_Point *m) {
+    return (__sn__MapIter_str_Point){ .__sn___map = __sn__map_str_Point_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_str_Point_hasNext(__sn__MapIter_str_Point *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_str_Point __sn__MapIter_str_Point_next(__sn__MapIter_str_Point *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_str_Point e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+/* Map: map_double_str (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_double_str;
+
+static uint64_t __sn__map_double_str__hash(const void *p) {
+    const double *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, sn_hash_f64((double)(*k)));
+    return h;
+}
+
+static bool __sn__map_double_str__eq(const void *a, const void *b) {
+    const double *x = a;
+    const double *y = b;
+    return true
+        && (*x) == (*y);
+}
+
+static const SnMapOps __sn__map_double_str__ops = {
+    .key_size = sizeof(double),
+    .val_size = sizeof(char *),
+    .hash = __sn__map_double_str__hash,
+    .eq = __sn__map_double_str__eq,
+    .val_copy = sn_copy_str,
+    .val_release = (void (*)(void *))sn_cleanup_str,
+    .key_tag = SN_TAG_DOUBLE,
+    .val_tag = SN_TAG_STRING,
+};
+
+static inline __sn__map_double_str *__sn__map_double_str__new(void) {
+    return sn_map_new(&__sn__map_double_str__ops);
+}
+
+static inline __sn__map_double_str *__sn__map_double_str_retain(__sn__map_double_str *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_double_str_release(__sn__map_double_str **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_double_str *__sn__map_double_str_copy(const __sn__map_double_str *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_double_str __attribute__((cleanup(__sn__map_double_str_release)))
+#define sn_auto_ref_map_double_str __attribute__((cleanup(__sn__map_double_str_release)))
+
+static inline void __sn__map_double_str_release_elem(void *p) { __sn__map_double_str_release((__sn__map_double_str **)p); }
+static inline void __sn__map_double_str_retain_into(const void *src, void *dst) { *(__sn__map_double_str **)dst = __sn__map_double_str_retain(*(__sn__map_double_str *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_double_str_to_string(const __sn__map_double_str *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_double_str_set(__sn__map_double_str *m, double key, char * value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline char * __sn__map_double_str_get(__sn__map_double_str *m, double key) {
+    const char * *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    char * r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline char * __sn__map_double_str_getOr(__sn__map_double_str *m, double key, char * fallback) {
+    const char * *v = sn_map_find(m, &key);
+    char * r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_double_str_has(__sn__map_double_str *m, double key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_double_str_remove(__sn__map_double_str *m, double key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_double_str_length(__sn__map_double_str *m) {
+    return m->len;
+}
+
+static inline void __sn__map_double_str_clear(__sn__map_double_str *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_double_str_keys(__sn__map_double_str *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_double_str_values(__sn__map_double_str *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_double_str *__sn__map_double_str_clone(__sn__map_double_str *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_double_str (as val) */
+typedef struct {
+    double __sn__key;
+    char * __sn__value;
+} __sn__MapEntry_double_str;
+/* Value operations */
+static inline __sn__MapEntry_double_str __sn__MapEntry_double_str_copy(const __sn__MapEntry_double_str *src) {
+    __sn__MapEntry_double_str dst;
+    dst.__sn__key = src->__sn__key;
+    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    return dst;
+}
+
+static inline void __sn__MapEntry_double_str_cleanup(__sn__MapEntry_double_str *p) {
+    free(p->__sn__value);
+
+}
+
+#define sn_auto_MapEntry_double_str __attribute__((cleanup(__sn__MapEntry_double_str_cleanup)))
+
+static inline void __sn__MapEntry_double_str_cleanup_elem(void *p) { __sn__MapEntry_double_str_cleanup((__sn__MapEntry_double_str *)p); }
+static inline void __sn__MapEntry_double_str_copy_into(const void *src, void *dst) { *(__sn__MapEntry_double_str *)dst = __sn__MapEntry_double_str_copy((const __sn__MapEntry_double_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_double_str *__sn__MapEntry_double_str_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_double_str));
+}
+
+static inline void __sn__MapEntry_double_str_release(__sn__MapEntry_double_str **p) {
+    if (*p) {
+        free((*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_double_str __attribute__((cleanup(__sn__MapEntry_double_str_release)))
+
+static inline void __sn__MapEntry_double_str_release_elem(void *p) { __sn__MapEntry_double_str_release((__sn__MapEntry_double_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_double_str_to_string(const __sn__MapEntry_double_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_double_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__key);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_double_str (as val) */
+typedef struct {
+    __sn__map_double_str * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_double_str;
+/* Value operations */
+static inline __sn__MapIter_double_str __sn__MapIter_double_str_copy(const __sn__MapIter_double_str *src) {
+    __sn__MapIter_double_str dst;
+    dst.__sn___map = __sn__map_double_str_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_double_str_cleanup(__sn__MapIter_double_str *p) {
+    __sn__map_double_str_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_double_str __attribute__((cleanup(__sn__MapIter_double_str_cleanup)))
+
+static inline void __sn__MapIter_double_str_cleanup_elem(void *p) { __sn__MapIter_double_str_cleanup((__sn__MapIter_double_str *)p); }
+static inline void __sn__MapIter_double_str_copy_into(const void *src, void *dst) { *(__sn__MapIter_double_str *)dst = __sn__MapIter_double_str_copy((const __sn__MapIter_double_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_double_str *__sn__MapIter_double_str_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_double_str));
+}
+
+static inline void __sn__MapIter_double_str_release(__sn__MapIter_double_str **p) {
+    if (*p) {
+        __sn__map_double_str_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_double_str __attribute__((cleanup(__sn__MapIter_double_str_release)))
+
+static inline void __sn__MapIter_double_str_release_elem(void *p) { __sn__MapIter_double_str_release((__sn__MapIter_double_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_double_str_to_string(const __sn__MapIter_double_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_double_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_double_str_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_double_str → MapEntry_double_str */
+static inline __sn__MapIter_double_str __sn__map_double_str_iter(__sn__map_double_str *m) {
+    return (__sn__MapIter_double_str){ .__sn___map = __sn__map_double_str_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_double_str_hasNext(__sn__MapIter_double_str *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_double_str __sn__MapIter_double_str_next(__sn__MapIter_double_str *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_double_str e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+
+__sn__map_int_double * __sn__build(long long);
+
+
+
+
+#endif
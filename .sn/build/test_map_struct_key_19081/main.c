@@ -0,0 +1,58 @@
+#include "sn_types.h"
+
+
+
+
+
+
+int main() {
+    sn_auto_map_Point_str __sn__map_Point_str * __sn__grid = ({
+        __sn__map_Point_str *__tmp__ = __sn__map_Point_str__new();
+        __tmp__;
+    });
+    __sn__map_Point_str_set(__sn__grid, (__sn__Point){ .__sn__x = 1LL, .__sn__y = 2LL }, "a");
+    
+    __sn__map_Point_str_set(__sn__grid, (__sn__Point){ .__sn__x = 2LL, .__sn__y = 1LL }, "b");
+    
+    __sn__map_Point_str_set(__sn__grid, (__sn__Point){ .__sn__x = 1LL, .__sn__y = 2LL }, "c");
+    
+    printf("%lld\n", (long long)(__sn__map_Point_str_length(__sn__grid)));
+    
+    { sn_auto_str char *__ps__ = __sn__map_Point_str_get(__sn__grid, (__sn__Point){ .__sn__x = 1LL, .__sn__y = 2LL }); sn_println(__ps__); };
+    
+    printf("%s\n", (__sn__map_Point_str_has(__sn__grid, (__sn__Point){ .__sn__x = 3LL, .__sn__y = 3LL })) ? "true" : "false");
+    
+    sn_auto_map_Tile_int __sn__map_Tile_int * __sn__tiles = ({
+        __sn__map_Tile_int *__tmp__ = __sn__map_Tile_int__new();
+        __tmp__;
+    });
+    sn_auto_Tile __sn__Tile __sn__t = (__sn__Tile){ .__sn__name = strdup("grass"), .__sn__pos = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL } };
+    __sn__map_Tile_int_set(__sn__tiles, __sn__Tile_copy(&(__sn__t)), 1LL);
+    
+    printf("%lld\n", (long long)(__sn__map_Tile_int_get(__sn__tiles, (__sn__Tile){ .__sn__name = strdup("grass"), .__sn__pos = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL } })));
+    
+    printf("%s\n", (__sn__map_Tile_int_has(__sn__tiles, (__sn__Tile){ .__sn__name = strdup("grass"), .__sn__pos = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 1LL } })) ? "true" : "false");
+    
+    sn_auto_map_str_Counter __sn__map_str_Counter * __sn__counters = ({
+        __sn__map_str_Counter *__tmp__ = __sn__map_str_Counter__new();
+        __tmp__;
+    });
+    sn_auto_Counter __sn__Counter * __sn__c = ({
+        __sn__Counter *__tmp__ = __sn__Counter__new();
+        __tmp__->__sn__n = 0LL;
+        __tmp__;
+    });
+    __sn__map_str_Counter_set(__sn__counters, "hits", __sn__c);
+    
+    (__sn__c->__sn__n = 5LL);
+    
+    sn_auto_Counter __sn__Counter * __sn__same = __sn__map_str_Counter_get(__sn__counters, "hits");
+    printf("%lld\n", (long long)(__sn__same->__sn__n));
+    
+    __sn__map_str_Counter_remove(__sn__counters, "hits");
+    
+    printf("%lld\n", (long long)(__sn__c->__sn__n));
+    
+    fflush(stdout);
+    return 0;
+}
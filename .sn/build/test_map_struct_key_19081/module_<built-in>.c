@@ -0,0 +1,13 @@
+#include "sn_types.h"
+
+
+
+
+
+
+
+
+
+
+
+
@@ -0,0 +1,929 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Tile (as val) */
+typedef struct {
+    char * __sn__name;
+    __sn__Point __sn__pos;
+} __sn__Tile;
+/* Value operations */
+static inline __sn__Tile __sn__Tile_copy(const __sn__Tile *src) {
+    __sn__Tile dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__pos = __sn__Point_copy(&src->__sn__pos);
+    return dst;
+}
+
+static inline void __sn__Tile_cleanup(__sn__Tile *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Tile __attribute__((cleanup(__sn__Tile_cleanup)))
+
+static inline void __sn__Tile_cleanup_elem(void *p) { __sn__Tile_cleanup((__sn__Tile *)p); }
+static inline void __sn__Tile_copy_into(const void *src, void *dst) { *(__sn__Tile *)dst = __sn__Tile_copy((const __sn__Tile *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Tile *__sn__Tile_alloc(void) {
+    return calloc(1, sizeof(__sn__Tile));
+}
+
+static inline void __sn__Tile_release(__sn__Tile **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Tile __attribute__((cleanup(__sn__Tile_release)))
+
+static inline void __sn__Tile_release_elem(void *p) { __sn__Tile_release((__sn__Tile **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Tile_to_string(const __sn__Tile *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Tile { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "pos: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__pos); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Counter (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__n;
+} __sn__Counter;
+
+
+static inline __sn__Counter *__sn__Counter__new(void) {
+    __sn__Counter *p = calloc(1, sizeof(__sn__Counter));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Counter *__sn__Counter_retain(__sn__Counter *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Counter_release(__sn__Counter **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Counter *__sn__Counter_copy(const __sn__Counter *src) {
+    __sn__Counter *dst = calloc(1, sizeof(__sn__Counter));
+    dst->__rc__ = 1;
+    dst->__sn__n = src->__sn__n;
+    return dst;
+}
+
+#define sn_auto_Counter __attribute__((cleanup(__sn__Counter_release)))
+#define sn_auto_ref_Counter __attribute__((cleanup(__sn__Counter_release)))
+
+static inline void __sn__Counter_release_elem(void *p) { __sn__Counter_release((__sn__Counter **)p); }
+static inline void __sn__Counter_retain_into(const void *src, void *dst) { *(__sn__Counter **)dst = __sn__Counter_retain(*(__sn__Counter *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Counter_to_string(const __sn__Counter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Counter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "n: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__n);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+/* Map: map_Point_str (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_Point_str;
+
+static uint64_t __sn__map_Point_str__hash(const void *p) {
+    const __sn__Point *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, (uint64_t)(*k).__sn__x);
+    h = sn_hash_mix(h, (uint64_t)(*k).__sn__y);
+    return h;
+}
+
+static bool __sn__map_Point_str__eq(const void *a, const void *b) {
+    const __sn__Point *x = a;
+    const __sn__Point *y = b;
+    return true
+        && (*x).__sn__x == (*y).__sn__x
+        && (*x).__sn__y == (*y).__sn__y;
+}
+static char *__sn__map_Point_str__key_str(const void *p) {
+    return __sn__Point_to_string((const __sn__Point *)p);
+}
+
+static const SnMapOps __sn__map_Point_str__ops = {
+    .key_size = sizeof(__sn__Point),
+    .val_size = sizeof(char *),
+    .hash = __sn__map_Point_str__hash,
+    .eq = __sn__map_Point_str__eq,
+    .val_copy = sn_copy_str,
+    .val_release = (void (*)(void *))sn_cleanup_str,
+    .key_tag = SN_TAG_STRUCT,
+    .val_tag = SN_TAG_STRING,
+    .key_str = __sn__map_Point_str__key_str,
+};
+
+static inline __sn__map_Point_str *__sn__map_Point_str__new(void) {
+    return sn_map_new(&__sn__map_Point_str__ops);
+}
+
+static inline __sn__map_Point_str *__sn__map_Point_str_retain(__sn__map_Point_str *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_Point_str_release(__sn__map_Point_str **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_Point_str *__sn__map_Point_str_copy(const __sn__map_Point_str *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_Point_str __attribute__((cleanup(__sn__map_Point_str_release)))
+#define sn_auto_ref_map_Point_str __attribute__((cleanup(__sn__map_Point_str_release)))
+
+static inline void __sn__map_Point_str_release_elem(void *p) { __sn__map_Point_str_release((__sn__map_Point_str **)p); }
+static inline void __sn__map_Point_str_retain_into(const void *src, void *dst) { *(__sn__map_Point_str **)dst = __sn__map_Point_str_retain(*(__sn__map_Point_str *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_Point_str_to_string(const __sn__map_Point_str *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_Point_str_set(__sn__map_Point_str *m, __sn__Point key, char * value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline char * __sn__map_Point_str_get(__sn__map_Point_str *m, __sn__Point key) {
+    const char * *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    char * r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline char * __sn__map_Point_str_getOr(__sn__map_Point_str *m, __sn__Point key, char * fallback) {
+    const char * *v = sn_map_find(m, &key);
+    char * r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_Point_str_has(__sn__map_Point_str *m, __sn__Point key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_Point_str_remove(__sn__map_Point_str *m, __sn__Point key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_Point_str_length(__sn__map_Point_str *m) {
+    return m->len;
+}
+
+static inline void __sn__map_Point_str_clear(__sn__map_Point_str *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_Point_str_keys(__sn__map_Point_str *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_Point_str_values(__sn__map_Point_str *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_Point_str *__sn__map_Point_str_clone(__sn__map_Point_str *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_Point_str (as val) */
+typedef struct {
+    __sn__Point __sn__key;
+    char * __sn__value;
+} __sn__MapEntry_Point_str;
+/* Value operations */
+static inline __sn__MapEntry_Point_str __sn__MapEntry_Point_str_copy(const __sn__MapEntry_Point_str *src) {
+    __sn__MapEntry_Point_str dst;
+    dst.__sn__key = __sn__Point_copy(&src->__sn__key);
+    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    return dst;
+}
+
+static inline void __sn__MapEntry_Point_str_cleanup(__sn__MapEntry_Point_str *p) {
+    free(p->__sn__value);
+
+}
+
+#define sn_auto_MapEntry_Point_str __attribute__((cleanup(__sn__MapEntry_Point_str_cleanup)))
+
+static inline void __sn__MapEntry_Point_str_cleanup_elem(void *p) { __sn__MapEntry_Point_str_cleanup((__sn__MapEntry_Point_str *)p); }
+static inline void __sn__MapEntry_Point_str_copy_into(const void *src, void *dst) { *(__sn__MapEntry_Point_str *)dst = __sn__MapEntry_Point_str_copy((const __sn__MapEntry_Point_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_Point_str *__sn__MapEntry_Point_str_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_Point_str));
+}
+
+static inline void __sn__MapEntry_Point_str_release(__sn__MapEntry_Point_str **p) {
+    if (*p) {
+        free((*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_Point_str __attribute__((cleanup(__sn__MapEntry_Point_str_release)))
+
+static inline void __sn__MapEntry_Point_str_release_elem(void *p) { __sn__MapEntry_Point_str_release((__sn__MapEntry_Point_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_Point_str_to_string(const __sn__MapEntry_Point_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_Point_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__key); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_Point_str (as val) */
+typedef struct {
+    __sn__map_Point_str * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_Point_str;
+/* Value operations */
+static inline __sn__MapIter_Point_str __sn__MapIter_Point_str_copy(const __sn__MapIter_Point_str *src) {
+    __sn__MapIter_Point_str dst;
+    dst.__sn___map = __sn__map_Point_str_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_Point_str_cleanup(__sn__MapIter_Point_str *p) {
+    __sn__map_Point_str_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_Point_str __attribute__((cleanup(__sn__MapIter_Point_str_cleanup)))
+
+static inline void __sn__MapIter_Point_str_cleanup_elem(void *p) { __sn__MapIter_Point_str_cleanup((__sn__MapIter_Point_str *)p); }
+static inline void __sn__MapIter_Point_str_copy_into(const void *src, void *dst) { *(__sn__MapIter_Point_str *)dst = __sn__MapIter_Point_str_copy((const __sn__MapIter_Point_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_Point_str *__sn__MapIter_Point_str_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_Point_str));
+}
+
+static inline void __sn__MapIter_Point_str_release(__sn__MapIter_Point_str **p) {
+    if (*p) {
+        __sn__map_Point_str_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_Point_str __attribute__((cleanup(__sn__MapIter_Point_str_release)))
+
+static inline void __sn__MapIter_Point_str_release_elem(void *p) { __sn__MapIter_Point_str_release((__sn__MapIter_Point_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_Point_str_to_string(const __sn__MapIter_Point_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_Point_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_Point_str_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_Point_str → MapEntry_Point_str */
+static inline __sn__MapIter_Point_str __sn__map_Point_str_iter(__sn__map_Point_str *m) {
+    return (__sn__MapIter_Point_str){ .__sn___map = __sn__map_Point_str_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_Point_str_hasNext(__sn__MapIter_Point_str *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_Point_str __sn__MapIter_Point_str_next(__sn__MapIter_Point_str *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_Point_str e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+/* Map: map_Tile_int (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_Tile_int;
+
+static uint64_t __sn__map_Tile_int__hash(const void *p) {
+    const __sn__Tile *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, sn_hash_str((*k).__sn__name));
+    h = sn_hash_mix(h, (uint64_t)(*k).__sn__pos.__sn__x);
+    h = sn_hash_mix(h, (uint64_t)(*k).__sn__pos.__sn__y);
+    return h;
+}
+
+static bool __sn__map_Tile_int__eq(const void *a, const void *b) {
+    const __sn__Tile *x = a;
+    const __sn__Tile *y = b;
+    return true        && sn_map_str_eq((*x).__sn__name, (*y).__sn__name)
+        && (*x).__sn__pos.__sn__x == (*y).__sn__pos.__sn__x
+        && (*x).__sn__pos.__sn__y == (*y).__sn__pos.__sn__y;
+}
+static char *__sn__map_Tile_int__key_str(const void *p) {
+    return __sn__Tile_to_string((const __sn__Tile *)p);
+}
+
+static const SnMapOps __sn__map_Tile_int__ops = {
+    .key_size = sizeof(__sn__Tile),
+    .val_size = sizeof(long long),
+    .hash = __sn__map_Tile_int__hash,
+    .eq = __sn__map_Tile_int__eq,
+    .key_copy = __sn__Tile_copy_into,
+    .key_release = __sn__Tile_cleanup_elem,
+    .key_tag = SN_TAG_STRUCT,
+    .val_tag = SN_TAG_INT,
+    .key_str = __sn__map_Tile_int__key_str,
+};
+
+static inline __sn__map_Tile_int *__sn__map_Tile_int__new(void) {
+    return sn_map_new(&__sn__map_Tile_int__ops);
+}
+
+static inline __sn__map_Tile_int *__sn__map_Tile_int_retain(__sn__map_Tile_int *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_Tile_int_release(__sn__map_Tile_int **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_Tile_int *__sn__map_Tile_int_copy(const __sn__map_Tile_int *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_Tile_int __attribute__((cleanup(__sn__map_Tile_int_release)))
+#define sn_auto_ref_map_Tile_int __attribute__((cleanup(__sn__map_Tile_int_release)))
+
+static inline void __sn__map_Tile_int_release_elem(void *p) { __sn__map_Tile_int_release((__sn__map_Tile_int **)p); }
+static inline void __sn__map_Tile_int_retain_into(const void *src, void *dst) { *(__sn__map_Tile_int **)dst = __sn__map_Tile_int_retain(*(__sn__map_Tile_int *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_Tile_int_to_string(const __sn__map_Tile_int *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_Tile_int_set(__sn__map_Tile_int *m, __sn__Tile key, long long value) {
+    sn_map_set(m, &key, &value);
+    __sn__Tile_cleanup(&key);
+}
+
+static inline long long __sn__map_Tile_int_get(__sn__map_Tile_int *m, __sn__Tile key) {
+    const long long *v = sn_map_find(m, &key);
+    __sn__Tile_cleanup(&key);
+    if (!v) sn_map_panic("map key not found");
+    long long r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline long long __sn__map_Tile_int_getOr(__sn__map_Tile_int *m, __sn__Tile key, long long fallback) {
+    const long long *v = sn_map_find(m, &key);
+    __sn__Tile_cleanup(&key);
+    long long r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_Tile_int_has(__sn__map_Tile_int *m, __sn__Tile key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    __sn__Tile_cleanup(&key);
+    return r;
+}
+
+static inline bool __sn__map_Tile_int_remove(__sn__map_Tile_int *m, __sn__Tile key) {
+    bool r = sn_map_remove(m, &key);
+    __sn__Tile_cleanup(&key);
+    return r;
+}
+
+static inline long long __sn__map_Tile_int_length(__sn__map_Tile_int *m) {
+    return m->len;
+}
+
+static inline void __sn__map_Tile_int_clear(__sn__map_Tile_int *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_Tile_int_keys(__sn__map_Tile_int *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_Tile_int_values(__sn__map_Tile_int *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_Tile_int *__sn__map_Tile_int_clone(__sn__map_Tile_int *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_Tile_int (as val) */
+typedef struct {
+    __sn__Tile __sn__key;
+    long long __sn__value;
+} __sn__MapEntry_Tile_int;
+/* Value operations */
+static inline __sn__MapEntry_Tile_int __sn__MapEntry_Tile_int_copy(const __sn__MapEntry_Tile_int *src) {
+    __sn__MapEntry_Tile_int dst;
+    dst.__sn__key = __sn__Tile_copy(&src->__sn__key);
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__MapEntry_Tile_int_cleanup(__sn__MapEntry_Tile_int *p) {
+    __sn__Tile_cleanup(&p->__sn__key);
+
+}
+
+#define sn_auto_MapEntry_Tile_int __attribute__((cleanup(__sn__MapEntry_Tile_int_cleanup)))
+
+static inline void __sn__MapEntry_Tile_int_cleanup_elem(void *p) { __sn__MapEntry_Tile_int_cleanup((__sn__MapEntry_Tile_int *)p); }
+static inline void __sn__MapEntry_Tile_int_copy_into(const void *src, void *dst) { *(__sn__MapEntry_Tile_int *)dst = __sn__MapEntry_Tile_int_copy((const __sn__MapEntry_Tile_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_Tile_int *__sn__MapEntry_Tile_int_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_Tile_int));
+}
+
+static inline void __sn__MapEntry_Tile_int_release(__sn__MapEntry_Tile_int **p) {
+    if (*p) {
+        __sn__Tile_cleanup(&(*p)->__sn__key);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_Tile_int __attribute__((cleanup(__sn__MapEntry_Tile_int_release)))
+
+static inline void __sn__MapEntry_Tile_int_release_elem(void *p) { __sn__MapEntry_Tile_int_release((__sn__MapEntry_Tile_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_Tile_int_to_string(const __sn__MapEntry_Tile_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_Tile_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    { char *__fs__ = __sn__Tile_to_string(&p->__sn__key); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_Tile_int (as val) */
+typedef struct {
+    __sn__map_Tile_int * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_Tile_int;
+/* Value operations */
+static inline __sn__MapIter_Tile_int __sn__MapIter_Tile_int_copy(const __sn__MapIter_Tile_int *src) {
+    __sn__MapIter_Tile_int dst;
+    dst.__sn___map = __sn__map_Tile_int_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_Tile_int_cleanup(__sn__MapIter_Tile_int *p) {
+    __sn__map_Tile_int_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_Tile_int __attribute__((cleanup(__sn__MapIter_Tile_int_cleanup)))
+
+static inline void __sn__MapIter_Tile_int_cleanup_elem(void *p) { __sn__MapIter_Tile_int_cleanup((__sn__MapIter_Tile_int *)p); }
+static inline void __sn__MapIter_Tile_int_copy_into(const void *src, void *dst) { *(__sn__MapIter_Tile_int *)dst = __sn__MapIter_Tile_int_copy((const __sn__MapIter_Tile_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_Tile_int *__sn__MapIter_Tile_int_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_Tile_int));
+}
+
+static inline void __sn__MapIter_Tile_int_release(__sn__MapIter_Tile_int **p) {
+    if (*p) {
+        __sn__map_Tile_int_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_Tile_int __attribute__((cleanup(__sn__MapIter_Tile_int_release)))
+
+static inline void __sn__MapIter_Tile_int_release_elem(void *p) { __sn__MapIter_Tile_int_release((__sn__MapIter_Tile_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_Tile_int_to_string(const __sn__MapIter_Tile_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_Tile_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_Tile_int_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_Tile_int → MapEntry_Tile_int */
+static inline __sn__MapIter_Tile_int __sn__map_Tile_int_iter(__sn__map_Tile_int *m) {
+    return (__sn__MapIter_Tile_int){ .__sn___map = __sn__map_Tile_int_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_Tile_int_hasNext(__sn__MapIter_Tile_int *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_Tile_int __sn__MapIter_Tile_int_next(__sn__MapIter_Tile_int *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_Tile_int e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+/* Map: map_str_Counter (built-in map, refcounted — see sn_map.h) */
+typedef SnMap __sn__map_str_Counter;
+
+static uint64_t __sn__map_str_Counter__hash(const void *p) {
+    const char * *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, sn_hash_str((*k)));
+    return h;
+}
+
+static bool __sn__map_str_Counter__eq(const void *a, const void *b) {
+    const char * *x = a;
+    const char * *y = b;
+    return true        && sn_map_str_eq((*x), (*y));
+}
+
+static char *__sn__map_str_Counter__val_str(const void *p) {
+    return __sn__Counter_to_string(*(__sn__Counter *const *)p);
+}
+
+static const SnMapOps __sn__map_str_Counter__ops = {
+    .key_size = sizeof(char *),
+    .val_size = sizeof(__sn__Counter *),
+    .hash = __sn__map_str_Counter__hash,
+    .eq = __sn__map_str_Counter__eq,
+    .key_copy = sn_copy_str,
+    .key_release = (void (*)(void *))sn_cleanup_str,
+    .val_copy = __sn__Counter_retain_into,
+    .val_release = __sn__Counter_release_elem,
+    .key_tag = SN_TAG_STRING,
+    .val_tag = SN_TAG_STRUCT,
+    .val_str = __sn__map_str_Counter__val_str,
+};
+
+static inline __sn__map_str_Counter *__sn__map_str_Counter__new(void) {
+    return sn_map_new(&__sn__map_str_Counter__ops);
+}
+
+static inline __sn__map_str_Counter *__sn__map_str_Counter_retain(__sn__map_str_Counter *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__map_str_Counter_release(__sn__map_str_Counter **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_map_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__map_str_Counter *__sn__map_str_Counter_copy(const __sn__map_str_Counter *src) {
+    return sn_map_clone(src);
+}
+
+#define sn_auto_map_str_Counter __attribute__((cleanup(__sn__map_str_Counter_release)))
+#define sn_auto_ref_map_str_Counter __attribute__((cleanup(__sn__map_str_Counter_release)))
+
+static inline void __sn__map_str_Counter_release_elem(void *p) { __sn__map_str_Counter_release((__sn__map_str_Counter **)p); }
+static inline void __sn__map_str_Counter_retain_into(const void *src, void *dst) { *(__sn__map_str_Counter **)dst = __sn__map_str_Counter_retain(*(__sn__map_str_Counter *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__map_str_Counter_to_string(const __sn__map_str_Counter *p) {
+    return sn_map_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the map;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline void __sn__map_str_Counter_set(__sn__map_str_Counter *m, char * key, __sn__Counter * value) {
+    sn_map_set(m, &key, &value);
+}
+
+static inline __sn__Counter * __sn__map_str_Counter_get(__sn__map_str_Counter *m, char * key) {
+    const __sn__Counter * *v = sn_map_find(m, &key);
+    if (!v) sn_map_panic("map key not found");
+    __sn__Counter * r;
+    sn_map_copy_val(m, v, &r);
+    return r;
+}
+
+static inline __sn__Counter * __sn__map_str_Counter_getOr(__sn__map_str_Counter *m, char * key, __sn__Counter * fallback) {
+    const __sn__Counter * *v = sn_map_find(m, &key);
+    __sn__Counter * r;
+    sn_map_copy_val(m, v ? v : &fallback, &r);
+    return r;
+}
+
+static inline bool __sn__map_str_Counter_has(__sn__map_str_Counter *m, char * key) {
+    bool r = sn_map_find(m, &key) != NULL;
+    return r;
+}
+
+static inline bool __sn__map_str_Counter_remove(__sn__map_str_Counter *m, char * key) {
+    bool r = sn_map_remove(m, &key);
+    return r;
+}
+
+static inline long long __sn__map_str_Counter_length(__sn__map_str_Counter *m) {
+    return m->len;
+}
+
+static inline void __sn__map_str_Counter_clear(__sn__map_str_Counter *m) {
+    sn_map_clear(m);
+}
+
+static inline SnArray *__sn__map_str_Counter_keys(__sn__map_str_Counter *m) {
+    return sn_map_keys(m);
+}
+
+static inline SnArray *__sn__map_str_Counter_values(__sn__map_str_Counter *m) {
+    return sn_map_values(m);
+}
+
+static inline __sn__map_str_Counter *__sn__map_str_Counter_clone(__sn__map_str_Counter *m) {
+    return sn_map_clone(m);
+}
+
+/* Struct: MapEntry_str_Counter (as val) */
+typedef struct {
+    char * __sn__key;
+    __sn__Counter * __sn__value;
+} __sn__MapEntry_str_Counter;
+/* Value operations */
+static inline __sn__MapEntry_str_Counter __sn__MapEntry_str_Counter_copy(const __sn__MapEntry_str_Counter *src) {
+    __sn__MapEntry_str_Counter dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = __sn__Counter_retain(src->__sn__value);
+    return dst;
+}
+
+static inline void __sn__MapEntry_str_Counter_cleanup(__sn__MapEntry_str_Counter *p) {
+    free(p->__sn__key);
+    __sn__Counter_release(&p->__sn__value);
+
+}
+
+#define sn_auto_MapEntry_str_Counter __attribute__((cleanup(__sn__MapEntry_str_Counter_cleanup)))
+
+static inline void __sn__MapEntry_str_Counter_cleanup_elem(void *p) { __sn__MapEntry_str_Counter_cleanup((__sn__MapEntry_str_Counter *)p); }
+static inline void __sn__MapEntry_str_Counter_copy_into(const void *src, void *dst) { *(__sn__MapEntry_str_Counter *)dst = __sn__MapEntry_str_Counter_copy((const __sn__MapEntry_str_Counter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapEntry_str_Counter *__sn__MapEntry_str_Counter_alloc(void) {
+    return calloc(1, sizeof(__sn__MapEntry_str_Counter));
+}
+
+static inline void __sn__MapEntry_str_Counter_release(__sn__MapEntry_str_Counter **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        __sn__Counter_release(&(*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapEntry_str_Counter __attribute__((cleanup(__sn__MapEntry_str_Counter_release)))
+
+static inline void __sn__MapEntry_str_Counter_release_elem(void *p) { __sn__MapEntry_str_Counter_release((__sn__MapEntry_str_Counter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapEntry_str_Counter_to_string(const __sn__MapEntry_str_Counter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapEntry_str_Counter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    { char *__fs__ = __sn__Counter_to_string(p->__sn__value); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MapIter_str_Counter (as val) */
+typedef struct {
+    __sn__map_str_Counter * __sn___map;
+    long long __sn___pos;
+} __sn__MapIter_str_Counter;
+/* Value operations */
+static inline __sn__MapIter_str_Counter __sn__MapIter_str_Counter_copy(const __sn__MapIter_str_Counter *src) {
+    __sn__MapIter_str_Counter dst;
+    dst.__sn___map = __sn__map_str_Counter_retain(src->__sn___map);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__MapIter_str_Counter_cleanup(__sn__MapIter_str_Counter *p) {
+    __sn__map_str_Counter_release(&p->__sn___map);
+
+}
+
+#define sn_auto_MapIter_str_Counter __attribute__((cleanup(__sn__MapIter_str_Counter_cleanup)))
+
+static inline void __sn__MapIter_str_Counter_cleanup_elem(void *p) { __sn__MapIter_str_Counter_cleanup((__sn__MapIter_str_Counter *)p); }
+static inline void __sn__MapIter_str_Counter_copy_into(const void *src, void *dst) { *(__sn__MapIter_str_Counter *)dst = __sn__MapIter_str_Counter_copy((const __sn__MapIter_str_Counter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MapIter_str_Counter *__sn__MapIter_str_Counter_alloc(void) {
+    return calloc(1, sizeof(__sn__MapIter_str_Counter));
+}
+
+static inline void __sn__MapIter_str_Counter_release(__sn__MapIter_str_Counter **p) {
+    if (*p) {
+        __sn__map_str_Counter_release(&(*p)->__sn___map);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MapIter_str_Counter __attribute__((cleanup(__sn__MapIter_str_Counter_release)))
+
+static inline void __sn__MapIter_str_Counter_release_elem(void *p) { __sn__MapIter_str_Counter_release((__sn__MapIter_str_Counter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MapIter_str_Counter_to_string(const __sn__MapIter_str_Counter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MapIter_str_Counter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_map: ");
+    { char *__fs__ = __sn__map_str_Counter_to_string(p->__sn___map); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Map iteration: map_str_Counter → MapEntry_str_Counter */
+static inline __sn__MapIter_str_Counter __sn__map_str_Counter_iter(__sn__map_str_Counter *m) {
+    return (__sn__MapIter_str_Counter){ .__sn___map = __sn__map_str_Counter_retain(m), .__sn___pos = 0 };
+}
+
+static inline bool __sn__MapIter_str_Counter_hasNext(__sn__MapIter_str_Counter *it) {
+    it->__sn___pos = sn_map_next(it->__sn___map, it->__sn___pos);
+    return it->__sn___pos < it->__sn___map->cap;
+}
+
+static inline __sn__MapEntry_str_Counter __sn__MapIter_str_Counter_next(__sn__MapIter_str_Counter *it) {
+    SnMap *m = it->__sn___map;
+    long long i = sn_map_next(m, it->__sn___pos);
+    if (i >= m->cap) sn_map_panic("map iterator exhausted");
+    __sn__MapEntry_str_Counter e;
+    sn_map_copy_key(m, sn_map_slot_key(m, i), &e.__sn__key);
+    sn_map_copy_val(m, sn_map_slot_val(m, i), &e.__sn__value);
+    it->__sn___pos = i + 1;
+    return e;
+}
+
+
+
+
+
+
+#endif
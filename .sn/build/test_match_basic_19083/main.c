@@ -0,0 +1,42 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__check_status(long long __sn__code) {
+
+    ({
+            long long __match_subject__ = __sn__code;
+            if (__match_subject__ == 200LL) {
+                sn_print("OK\n");
+    
+    
+            } else if (__match_subject__ == 404LL) {
+                sn_print("Not Found\n");
+    
+    
+            } else if (__match_subject__ == 500LL) {
+                sn_print("Server Error\n");
+    
+    
+            } else {
+                sn_print("Unknown\n");
+    
+    
+            }
+        });
+    
+}
+
+int main() {
+    __sn__check_status(200LL);
+    
+    __sn__check_status(404LL);
+    
+    __sn__check_status(500LL);
+    
+    __sn__check_status(301LL);
+    
+    fflush(stdout);
+    return 0;
+}
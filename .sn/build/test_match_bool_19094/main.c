@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    bool __sn__b = true;
+    ({
+            bool __match_subject__ = __sn__b;
+            if (__match_subject__ == true) {
+                sn_print("yes\n");
+    
+    
+            } else if (__match_subject__ == false) {
+                sn_print("no\n");
+    
+    
+            }
+        });
+    
+    fflush(stdout);
+    return 0;
+}
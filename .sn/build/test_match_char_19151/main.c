@@ -0,0 +1,30 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    char __sn__c = (char)98;
+    ({
+            char __match_subject__ = __sn__c;
+            if (__match_subject__ == (char)97) {
+                sn_print("first\n");
+    
+    
+            } else if (__match_subject__ == (char)98) {
+                sn_print("second\n");
+    
+    
+            } else if (__match_subject__ == (char)99) {
+                sn_print("third\n");
+    
+    
+            } else {
+                sn_print("other\n");
+    
+    
+            }
+        });
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__day_type(long long __sn__day) {
+
+    ({
+            long long __match_subject__ = __sn__day;
+            if (__match_subject__ == 1LL || __match_subject__ == 7LL) {
+                sn_print("Weekend\n");
+    
+    
+            } else {
+                sn_print("Weekday\n");
+    
+    
+            }
+        });
+    
+}
+
+int main() {
+    __sn__day_type(1LL);
+    
+    __sn__day_type(2LL);
+    
+    __sn__day_type(5LL);
+    
+    __sn__day_type(7LL);
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,29 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 2LL;
+    sn_auto_str char * __sn__result = ({
+            char * __match_result__;
+            long long __match_subject__ = __sn__x;
+            if (__match_subject__ == 1LL) {
+                __match_result__ = strdup("one");
+            } else if (__match_subject__ == 2LL) {
+                __match_result__ = strdup("two");
+            } else if (__match_subject__ == 3LL) {
+                __match_result__ = strdup("three");
+            } else {
+                __match_result__ = strdup("other");
+            }
+            __match_result__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__result);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            ({
+                    long long __match_subject__ = __sn__i;
+                    if (__match_subject__ == 0LL) {
+                        sn_print("zero ");
+            
+            
+                    } else if (__match_subject__ == 1LL) {
+                        sn_print("one ");
+            
+            
+                    } else if (__match_subject__ == 2LL) {
+                        sn_print("two ");
+            
+            
+                    } else if (__match_subject__ == 3LL) {
+                        sn_print("three ");
+            
+            
+                    } else {
+                        sn_print("other ");
+            
+            
+                    }
+                });
+            
+        }
+    }
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
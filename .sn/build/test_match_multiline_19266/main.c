@@ -0,0 +1,54 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__process(long long __sn__code) {
+
+    sn_auto_str char * __sn__result = ({
+            char * __match_result__;
+            long long __match_subject__ = __sn__code;
+            if (__match_subject__ == 200LL) {
+                sn_print("Processing 200...\n");
+    
+    __match_result__ = strdup("OK");
+            } else if (__match_subject__ == 404LL) {
+                sn_print("Processing 404...\n");
+    
+    __match_result__ = strdup("Not Found");
+            } else {
+                sn_print("Processing unknown...\n");
+    
+    __match_result__ = strdup("Unknown");
+            }
+            __match_result__;
+        });
+
+    {
+        char * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__process(200LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__process(404LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__process(999LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 2LL;
+    long long __sn__result = 0LL;
+    ({
+            long long __match_result__;
+            long long __match_subject__ = __sn__x;
+            if (__match_subject__ == 1LL) {
+                __match_result__ = (__sn__result = 10LL);
+            } else if (__match_subject__ == 2LL) {
+                (__sn__result = 20LL);
+    
+    __match_result__ = (__sn__result = sn_add_long(__sn__result, 5LL));
+            } else {
+                __match_result__ = (__sn__result = (-1LL));
+            }
+            __match_result__;
+        });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 3LL;
+    ({
+            long long __match_subject__ = __sn__x;
+            if (__match_subject__ == 1LL || __match_subject__ == 2LL) {
+                sn_print("low\n");
+    
+    
+            } else if (__match_subject__ == 3LL || __match_subject__ == 4LL) {
+                sn_print("mid\n");
+    
+    
+            } else {
+                sn_print("high\n");
+    
+    
+            }
+        });
+    
+    fflush(stdout);
+    return 0;
+}
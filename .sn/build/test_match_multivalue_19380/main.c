@@ -0,0 +1,52 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__categorize(long long __sn__code) {
+
+    ({
+            long long __match_subject__ = __sn__code;
+            if (__match_subject__ == 200LL || __match_subject__ == 201LL || __match_subject__ == 202LL) {
+                sn_print("Success\n");
+    
+    
+            } else if (__match_subject__ == 301LL || __match_subject__ == 302LL) {
+                sn_print("Redirect\n");
+    
+    
+            } else if (__match_subject__ == 400LL || __match_subject__ == 401LL || __match_subject__ == 403LL || __match_subject__ == 404LL) {
+                sn_print("Client Error\n");
+    
+    
+            } else if (__match_subject__ == 500LL || __match_subject__ == 502LL || __match_subject__ == 503LL) {
+                sn_print("Server Error\n");
+    
+    
+            } else {
+                sn_print("Other\n");
+    
+    
+            }
+        });
+    
+}
+
+int main() {
+    __sn__categorize(200LL);
+    
+    __sn__categorize(201LL);
+    
+    __sn__categorize(301LL);
+    
+    __sn__categorize(400LL);
+    
+    __sn__categorize(404LL);
+    
+    __sn__categorize(500LL);
+    
+    __sn__categorize(100LL);
+    
+    fflush(stdout);
+    return 0;
+}
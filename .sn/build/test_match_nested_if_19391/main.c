@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 5LL;
+    ({
+            long long __match_subject__ = __sn__x;
+            if (__match_subject__ == 1LL) {
+                sn_print("one\n");
+    
+    
+            } else if (__match_subject__ == 5LL) {
+                if (sn_gt_long(__sn__x, 3LL)) {
+        sn_print("five and big\n");
+        
+    }
+    
+            } else {
+                sn_print("other\n");
+    
+    
+            }
+        });
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__describe(long long __sn__x) {
+
+    return ({
+            char * __match_result__;
+            long long __match_subject__ = __sn__x;
+            if (__match_subject__ == 1LL) {
+                __match_result__ = strdup("one");
+            } else if (__match_subject__ == 5LL) {
+                __match_result__ = strdup("five");
+            } else if (__match_subject__ == 10LL) {
+                __match_result__ = strdup("ten");
+            } else {
+                __match_result__ = strdup("unknown");
+            }
+            __match_result__;
+        });}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__describe(1LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__describe(5LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__describe(10LL);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
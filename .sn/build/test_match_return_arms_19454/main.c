@@ -0,0 +1,32 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__describe(long long __sn__code) {
+
+    ({
+            long long __match_subject__ = __sn__code;
+            if (__match_subject__ == 1LL) {
+                return strdup("one");
+            } else if (__match_subject__ == 2LL) {
+                return strdup("two");
+            } else if (__match_subject__ == 3LL) {
+                return strdup("three");
+            } else {
+                return strdup("other");
+            }
+        });}
+
+int main() {
+    { sn_auto_str char *__ps__ = __sn__describe(1LL); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = __sn__describe(2LL); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = __sn__describe(3LL); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = __sn__describe(99LL); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__myMatchReturn(long long __sn__val1) {
+
+    return ({
+            char * __match_result__;
+            long long __match_subject__ = __sn__val1;
+            if (__match_subject__ == 1LL) {
+                __match_result__ = strdup("One");
+            } else if (__match_subject__ == 2LL) {
+                __match_result__ = strdup("Two");
+            } else if (__match_subject__ == 3LL) {
+                __match_result__ = strdup("Three");
+            } else {
+                __match_result__ = strdup("Unknown");
+            }
+            __match_result__;
+        });}
+
+int main() {
+    long long __sn__val1 = 2LL;
+    sn_auto_str char * __sn__res = __sn__myMatchReturn(__sn__val1);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__val1));
+            sn_auto_str char *__is_p1__ = sn_strdup(" = ");
+            sn_auto_str char *__is_p2__ = sn_strdup(__sn__res);
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_println(__ps__); };
+    
+    sn_println("All tests completed");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__s = strdup("hello");
+    ({
+            char * __match_subject__ = __sn__s;
+            if (strcmp(__match_subject__, "hi") == 0) {
+                sn_print("casual\n");
+    
+    
+            } else if (strcmp(__match_subject__, "hello") == 0) {
+                sn_print("formal\n");
+    
+    
+            } else {
+                sn_print("unknown\n");
+    
+    
+            }
+        });
+    
+    fflush(stdout);
+    return 0;
+}
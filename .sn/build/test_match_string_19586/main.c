@@ -0,0 +1,42 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__describe(char * __sn__color) {
+
+    ({
+            char * __match_subject__ = __sn__color;
+            if (strcmp(__match_subject__, "red") == 0) {
+                sn_print("warm\n");
+    
+    
+            } else if (strcmp(__match_subject__, "blue") == 0) {
+                sn_print("cool\n");
+    
+    
+            } else if (strcmp(__match_subject__, "green") == 0) {
+                sn_print("natural\n");
+    
+    
+            } else {
+                sn_print("unknown color\n");
+    
+    
+            }
+        });
+    
+}
+
+int main() {
+    __sn__describe("red");
+    
+    __sn__describe("blue");
+    
+    __sn__describe("green");
+    
+    __sn__describe("yellow");
+    
+    fflush(stdout);
+    return 0;
+}
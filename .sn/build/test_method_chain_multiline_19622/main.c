@@ -0,0 +1,102 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Counter __sn__Counter_create(long long __sn__start) {
+
+    return (__sn__Counter){ .__sn__value = __sn__start };}
+
+__sn__Counter __sn__Counter_add(__sn__Counter *__sn__self, long long __sn__n) {
+
+    return (__sn__Counter){ .__sn__value = sn_add_long(__sn__self->__sn__value, __sn__n) };}
+
+__sn__Counter __sn__Counter_multiply(__sn__Counter *__sn__self, long long __sn__n) {
+
+    return (__sn__Counter){ .__sn__value = sn_mul_long(__sn__self->__sn__value, __sn__n) };}
+
+long long __sn__Counter_get(__sn__Counter *__sn__self) {
+
+    return __sn__self->__sn__value;}
+
+int main() {
+    sn_auto_str char * __sn__s = strdup("  hello world  ");
+    sn_auto_str char * __sn____chain_tmp_0 = __sn___trim(&__sn__s);
+    sn_auto_str char * __sn__r1 = __sn___toUpper(&__sn____chain_tmp_0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("str single line: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__r1);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn____chain_tmp_1 = __sn___trim(&__sn__s);
+    sn_auto_str char * __sn__r2 = __sn___toUpper(&__sn____chain_tmp_1);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("str same indent: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__r2);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn____chain_tmp_2 = __sn___trim(&__sn__s);
+    sn_auto_str char * __sn__r3 = __sn___toUpper(&__sn____chain_tmp_2);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("str indented: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__r3);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    char * __sn____chain_tmp_3 = "  TEST STRING  ";
+    sn_auto_str char * __sn____chain_tmp_4 = __sn___trim(&__sn____chain_tmp_3);
+    sn_auto_str char * __sn____chain_tmp_5 = __sn___toLower(&__sn____chain_tmp_4);
+    sn_auto_str char * __sn__r4 = __sn___toUpper(&__sn____chain_tmp_5);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("str multiple: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__r4);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Counter __sn__Counter __sn____chain_tmp_6 = __sn__Counter_create(10LL);
+    sn_auto_Counter __sn__Counter __sn____chain_tmp_7 = __sn__Counter_add(&__sn____chain_tmp_6, 5LL);
+    __sn__Counter __sn__c1 = __sn__Counter_multiply(&__sn____chain_tmp_7, 2LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("struct static+instance: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Counter_get(&__sn__c1)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__Counter __sn__base = (__sn__Counter){ .__sn__value = 5LL };
+    sn_auto_Counter __sn__Counter __sn____chain_tmp_8 = __sn__Counter_add(&__sn__base, 3LL);
+    __sn__Counter __sn__c2 = __sn__Counter_multiply(&__sn____chain_tmp_8, 2LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("struct same indent: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Counter_get(&__sn__c2)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Counter __sn__Counter __sn____chain_tmp_9 = __sn__Counter_add(&__sn__base, 10LL);
+    __sn__Counter __sn__c3 = __sn__Counter_multiply(&__sn____chain_tmp_9, 3LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("struct indented: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Counter_get(&__sn__c3)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Counter __sn__Counter __sn____chain_tmp_10 = __sn__Counter_add(&__sn__base, 1LL);
+    sn_auto_Counter __sn__Counter __sn____chain_tmp_11 = __sn__Counter_add(&__sn____chain_tmp_10, 2LL);
+    __sn__Counter __sn__c4 = __sn__Counter_multiply(&__sn____chain_tmp_11, 2LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("struct multiple: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Counter_get(&__sn__c4)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
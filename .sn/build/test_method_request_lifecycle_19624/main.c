@@ -0,0 +1,197 @@
+#include "sn_types.h"
+
+
+
+
+
+__sn__Request __sn__Request_parse(char * __sn__raw) {
+
+    sn_auto_str char * __sn__normalized = __sn___replace(&__sn__raw, "\r\n", "\n");
+
+    sn_auto_arr SnArray * __sn__lines = __sn___split(&__sn__normalized, "\n");
+
+    sn_auto_Request __sn__Request __sn__req = (__sn__Request){ .__sn__method = strdup(""), .__sn__path = strdup(""), .__sn__headers = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Header), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Header_cleanup_elem;
+            __al__->elem_copy = __sn__Header_copy_into;
+            __al__;
+        }), .__sn__body = strdup("") };
+
+    if ((sn_array_length(__sn__lines) == 0LL)) {
+        {
+            __sn__Request __ret__ = __sn__req;
+            memset(&__sn__req, 0, sizeof(__sn__req));
+            return __ret__;
+        }}
+
+    sn_auto_arr SnArray * __sn__parts = __sn___split(&(((char * *)__sn__lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__lines->len : __ai__; })]), " ");
+
+    if ((sn_array_length(__sn__parts) >= 1LL)) {
+        ({
+            char *__ma_str_tmp__ = strdup((((char * *)__sn__parts->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__parts->len : __ai__; })]));
+            free(__sn__req.__sn__method);
+            __sn__req.__sn__method = __ma_str_tmp__;
+            __sn__req.__sn__method;
+        });
+        
+    }
+
+    if ((sn_array_length(__sn__parts) >= 2LL)) {
+        ({
+            char *__ma_str_tmp__ = strdup((((char * *)__sn__parts->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__parts->len : __ai__; })]));
+            free(__sn__req.__sn__path);
+            __sn__req.__sn__path = __ma_str_tmp__;
+            __sn__req.__sn__path;
+        });
+        
+    }
+
+    long long __sn__i = 1LL;
+
+    while (sn_lt_long(__sn__i, sn_array_length(__sn__lines))) {
+        sn_auto_str char * __sn__line = strdup((((char * *)__sn__lines->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__lines->len : __ai__; })]));
+        if (({char *__sct0__=__sn___trim(&__sn__line);bool __scr__=(strcmp(__sct0__,"")==0);free(__sct0__);__scr__;})) {
+            break;
+        }
+        long long __sn__colonIdx = __sn___indexOf(&__sn__line, ":");
+        if (sn_gt_long(__sn__colonIdx, 0LL)) {
+            sn_auto_str char * __sn__hname_raw = __sn___substring(&__sn__line, 0LL, __sn__colonIdx);
+            sn_auto_str char * __sn__hname = __sn___trim(&__sn__hname_raw);
+            sn_auto_str char * __sn__hvalue_raw = __sn___substring(&__sn__line, sn_add_long(__sn__colonIdx, 1LL), sn_str_length(__sn__line));
+            sn_auto_str char * __sn__hvalue = __sn___trim(&__sn__hvalue_raw);
+            __sn__arr_push(&__sn__req.__sn__headers, (__sn__Header){ .__sn__name = strdup(__sn__hname), .__sn__value = strdup(__sn__hvalue) });
+            
+        }
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+
+    {
+        __sn__Request __ret__ = __sn__req;
+        memset(&__sn__req, 0, sizeof(__sn__req));
+        return __ret__;
+    }}
+
+char * __sn__Request_getHeader(__sn__Request *__sn__self, char * __sn__target) {
+
+    sn_auto_str char * __sn__lowerName = __sn___toLower(&__sn__target);
+
+    long long __sn__i = 0LL;
+
+    while (sn_lt_long(__sn__i, sn_array_length(__sn__self->__sn__headers))) {
+        if (({char *__sct0__=__sn___toLower(&(((__sn__Header *)__sn__self->__sn__headers->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__self->__sn__headers->len : __ai__; })]).__sn__name);bool __scr__=(strcmp(__sct0__,__sn__lowerName)==0);free(__sct0__);__scr__;})) {
+            return strdup((((__sn__Header *)__sn__self->__sn__headers->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__self->__sn__headers->len : __ai__; })]).__sn__value);}
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+
+    return strdup("");}
+
+
+char * __sn__Response_toText(__sn__Response *__sn__self) {
+
+    sn_auto_str char * __sn__result = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("HTTP/1.1 ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__status));
+            sn_auto_str char *__is_p2__ = sn_strdup(" OK\r\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });
+
+    ({
+        char *__sn_tmp__ = sn_str_concat(__sn__result, "Content-Type: text/plain\r\n\r\n");
+        free(__sn__result);
+        __sn__result = __sn_tmp__;
+        __sn__result;
+    });
+    
+
+    ({
+        char *__sn_tmp__ = sn_str_concat(__sn__result, __sn__self->__sn__body);
+        free(__sn__result);
+        __sn__result = __sn_tmp__;
+        __sn__result;
+    });
+    
+
+    {
+        char * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_str char * __sn__raw = strdup("GET /items HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\nAccept: */*\r\n\r\n");
+    sn_auto_Request __sn__Request __sn__req = __sn__Request_parse(__sn__raw);
+    if ((strcmp(__sn__req.__sn__method, "GET") != 0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: method=");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__req.__sn__method);
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((strcmp(__sn__req.__sn__path, "/items") != 0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: path=");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__req.__sn__path);
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((sn_array_length(__sn__req.__sn__headers) != 3LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: headers count=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__req.__sn__headers)));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_auto_str char * __sn__conn = __sn__Request_getHeader(&__sn__req, "connection");
+    if ((strcmp(__sn__conn, "keep-alive") != 0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: connection=");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__conn);
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_auto_str char * __sn__host = __sn__Request_getHeader(&__sn__req, "Host");
+    if ((strcmp(__sn__host, "localhost") != 0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: host=");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__host);
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_auto_Response __sn__Response __sn__resp = (__sn__Response){ .__sn__status = 200LL, .__sn__body = strdup("Hello") };
+    if ((strcmp(__sn__conn, "keep-alive") == 0)) {
+        ({
+            __sn__Response __tmp__ = (__sn__Response){ .__sn__status = 200LL, .__sn__body = strdup("Hello (keep-alive)") };
+            __sn__Response_cleanup(&__sn__resp);
+            __sn__resp = __tmp__;
+            __sn__resp;
+        });
+        
+    }
+    sn_auto_str char * __sn__text = __sn__Response_toText(&__sn__resp);
+    if (sn_lt_long(__sn___indexOf(&__sn__text, "keep-alive"), 0LL)) {
+        sn_print("FAIL: response body missing keep-alive\n");
+        
+        return 0;}
+    if (sn_lt_long(__sn___indexOf(&__sn__text, "HTTP/1.1 200 OK"), 0LL)) {
+        sn_print("FAIL: response missing status line\n");
+        
+        return 0;}
+    sn_print("PASS\n");
+    
+    fflush(stdout);
+    return 0;
+}
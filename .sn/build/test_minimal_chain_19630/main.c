@@ -0,0 +1,31 @@
+#include "sn_types.h"
+
+long long __sn__level_12__staticCounter = 1200LL;
+long long __sn__MyL12__instanceCounter = 12LL;
+long long __sn__MyL12__holderLevel = 0;
+long long __sn__level_13__staticCounter = 1300LL;
+char * __sn__level_13__staticName = NULL;
+long long __sn__MyL12__L13__instanceCounter = 13LL;
+long long __sn__level_14__staticCounter = 1400LL;
+long long __sn__MyL12__L13__level_14__instanceCounter = 14LL;
+long long __sn__level_15__staticCounter = 1500LL;
+long long __sn__MyL12__L13__level_14__L15__instanceCounter = 15LL;
+long long __sn__level_11__staticCounter = 1100LL;
+long long __sn__MyL11__instanceCounter = 11LL;
+long long __sn__MyL11__level_12__instanceCounter = 12LL;
+long long __sn__MyL11__level_12__holderLevel = 0;
+long long __sn__MyL11__level_12__L13__instanceCounter = 13LL;
+long long __sn__MyL11__level_12__L13__level_14__instanceCounter = 14LL;
+long long __sn__MyL11__level_12__L13__level_14__L15__instanceCounter = 15LL;
+
+
+int main() {
+    __sn__MyL12__holderLevel = __sn__MyL12__L13__createDeepHolder(120LL);
+    __sn__level_13__staticName = strdup("level13_static");
+    __sn__MyL11__level_12__holderLevel = __sn__MyL11__level_12__L13__createDeepHolder(120LL);
+    sn_print("Test\n");
+    
+    free(__sn__level_13__staticName);
+    fflush(stdout);
+    return 0;
+}
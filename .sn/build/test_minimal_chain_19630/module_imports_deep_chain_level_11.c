@@ -0,0 +1,42 @@
+#include "sn_types.h"
+
+
+
+
+__sn__DataBundle __sn__MyL11__createBundle() {
+
+    return (__sn__DataBundle){ .__sn__id = 11LL, .__sn__sum = __sn__MyL11__level_12__getAllStaticSum() };}
+
+
+long long __sn__MyL11__getStaticCounter() {
+
+    return __sn__level_11__staticCounter;}
+
+
+void __sn__MyL11__incrementStatic() {
+
+    (__sn__level_11__staticCounter = sn_add_long(__sn__level_11__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MyL11__getInstanceCounter() {
+
+    return __sn__MyL11__instanceCounter;}
+
+
+long long __sn__MyL11__getDeepStatic() {
+
+    return __sn__MyL11__level_12__getStaticCounter();}
+
+
+long long __sn__MyL11__getLevelId() {
+
+    return 11LL;}
+
+
+long long __sn__MyL11__computeChainValue(long long __sn__base) {
+
+    return __sn__MyL11__level_12__computeChainValue(sn_add_long(__sn__base, 11LL));}
+
+
@@ -0,0 +1,88 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__MyL12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__MyL12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MyL12__getInstanceCounter() {
+
+    return __sn__MyL12__instanceCounter;}
+
+
+long long __sn__MyL12__getDeepStatic() {
+
+    return __sn__MyL12__L13__getStaticCounter();}
+
+
+long long __sn__MyL12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__MyL12__L13__getStaticCounter()), __sn__MyL12__L13__getDeepStatic()), __sn__MyL12__L13__getDeepDeepStatic());}
+
+
+long long __sn__MyL12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__MyL12__computeChainValue(long long __sn__base) {
+
+    return __sn__MyL12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__MyL12__getHolderLevel() {
+
+    return __sn__MyL12__holderLevel;}
+
+
+long long __sn__MyL11__level_12__getStaticCounter() {
+
+    return __sn__level_12__staticCounter;}
+
+
+void __sn__MyL11__level_12__incrementStatic() {
+
+    (__sn__level_12__staticCounter = sn_add_long(__sn__level_12__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MyL11__level_12__getInstanceCounter() {
+
+    return __sn__MyL11__level_12__instanceCounter;}
+
+
+long long __sn__MyL11__level_12__getDeepStatic() {
+
+    return __sn__MyL11__level_12__L13__getStaticCounter();}
+
+
+long long __sn__MyL11__level_12__getAllStaticSum() {
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__level_12__staticCounter, __sn__MyL11__level_12__L13__getStaticCounter()), __sn__MyL11__level_12__L13__getDeepStatic()), __sn__MyL11__level_12__L13__getDeepDeepStatic());}
+
+
+long long __sn__MyL11__level_12__getLevelId() {
+
+    return 12LL;}
+
+
+long long __sn__MyL11__level_12__computeChainValue(long long __sn__base) {
+
+    return __sn__MyL11__level_12__L13__computeChainValue(sn_add_long(__sn__base, 12LL));}
+
+
+long long __sn__MyL11__level_12__getHolderLevel() {
+
+    return __sn__MyL11__level_12__holderLevel;}
+
@@ -0,0 +1,120 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__MyL12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__MyL12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__MyL12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MyL12__L13__getInstanceCounter() {
+
+    return __sn__MyL12__L13__instanceCounter;}
+
+
+void __sn__MyL12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MyL12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MyL12__L13__getDeepStatic() {
+
+    return __sn__MyL12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__MyL12__L13__getDeepDeepStatic() {
+
+    return __sn__MyL12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__MyL12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__MyL12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__MyL12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__MyL12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__MyL12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
+
+long long __sn__MyL11__level_12__L13__getStaticCounter() {
+
+    return __sn__level_13__staticCounter;}
+
+
+char * __sn__MyL11__level_12__L13__getStaticName() {
+
+    {
+        char * __ret__ = __sn__level_13__staticName;
+        __sn__level_13__staticName = NULL;
+        return __ret__;
+    }}
+
+
+void __sn__MyL11__level_12__L13__incrementStatic() {
+
+    (__sn__level_13__staticCounter = sn_add_long(__sn__level_13__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MyL11__level_12__L13__getInstanceCounter() {
+
+    return __sn__MyL11__level_12__L13__instanceCounter;}
+
+
+void __sn__MyL11__level_12__L13__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MyL11__level_12__L13__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MyL11__level_12__L13__getDeepStatic() {
+
+    return __sn__MyL11__level_12__L13__level_14__getStaticCounter();}
+
+
+long long __sn__MyL11__level_12__L13__getDeepDeepStatic() {
+
+    return __sn__MyL11__level_12__L13__level_14__getDeepStatic();}
+
+
+long long __sn__MyL11__level_12__L13__getLevelId() {
+
+    return 13LL;}
+
+
+long long __sn__MyL11__level_12__L13__computeChainValue(long long __sn__base) {
+
+    return __sn__MyL11__level_12__L13__level_14__computeChainValue(sn_add_long(__sn__base, 13LL));}
+
+
+long long __sn__MyL11__level_12__L13__createDeepHolder(long long __sn__n) {
+
+    return __sn__MyL11__level_12__L13__level_14__createHolder(__sn__n).__sn__level;}
+
@@ -0,0 +1,107 @@
+#include "sn_types.h"
+
+
+
+
+__sn__StateHolder __sn__MyL12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_0__ = __sn__MyL12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_0__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__MyL12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__MyL12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MyL12__L13__level_14__getInstanceCounter() {
+
+    return __sn__MyL12__L13__level_14__instanceCounter;}
+
+
+long long __sn__MyL12__L13__level_14__getDeepStatic() {
+
+    return __sn__MyL12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__MyL12__L13__level_14__incrementDeepStatic() {
+
+    __sn__MyL12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__MyL12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__MyL12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__MyL12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__MyL12__L13__level_14__getDeepLevelId() {
+
+    return __sn__MyL12__L13__level_14__L15__getLevelId();}
+
+
+__sn__StateHolder __sn__MyL11__level_12__L13__level_14__createHolder(long long __sn__n) {
+
+    long long __sn__stateValue = ({ sn_auto_State __sn__State __mtmp_1__ = __sn__MyL11__level_12__L13__level_14__L15__createState(sn_mul_long(__sn__n, 10LL), "level14"); __mtmp_1__.__sn__value; });
+
+    return (__sn__StateHolder){ .__sn__level = __sn__n, .__sn__nestedValue = __sn__stateValue };}
+
+
+long long __sn__MyL11__level_12__L13__level_14__getStaticCounter() {
+
+    return __sn__level_14__staticCounter;}
+
+
+void __sn__MyL11__level_12__L13__level_14__incrementStatic() {
+
+    (__sn__level_14__staticCounter = sn_add_long(__sn__level_14__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MyL11__level_12__L13__level_14__getInstanceCounter() {
+
+    return __sn__MyL11__level_12__L13__level_14__instanceCounter;}
+
+
+long long __sn__MyL11__level_12__L13__level_14__getDeepStatic() {
+
+    return __sn__MyL11__level_12__L13__level_14__L15__getStaticCounter();}
+
+
+void __sn__MyL11__level_12__L13__level_14__incrementDeepStatic() {
+
+    __sn__MyL11__level_12__L13__level_14__L15__incrementStatic();
+    
+}
+
+
+long long __sn__MyL11__level_12__L13__level_14__getLevelId() {
+
+    return 14LL;}
+
+
+long long __sn__MyL11__level_12__L13__level_14__computeChainValue(long long __sn__base) {
+
+    return __sn__MyL11__level_12__L13__level_14__L15__computeChainValue(sn_add_long(__sn__base, 14LL));}
+
+
+long long __sn__MyL11__level_12__L13__level_14__getDeepLevelId() {
+
+    return __sn__MyL11__level_12__L13__level_14__L15__getLevelId();}
+
+
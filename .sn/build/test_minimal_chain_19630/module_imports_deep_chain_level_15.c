@@ -0,0 +1,83 @@
+#include "sn_types.h"
+
+
+
+
+__sn__State __sn__MyL12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__MyL12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__MyL12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MyL12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__MyL12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__MyL12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MyL12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MyL12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__MyL12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
+__sn__State __sn__MyL11__level_12__L13__level_14__L15__createState(long long __sn__n, char * __sn__s) {
+
+    return (__sn__State){ .__sn__value = __sn__n, .__sn__name = strdup(__sn__s) };}
+
+
+long long __sn__MyL11__level_12__L13__level_14__L15__getStaticCounter() {
+
+    return __sn__level_15__staticCounter;}
+
+
+void __sn__MyL11__level_12__L13__level_14__L15__incrementStatic() {
+
+    (__sn__level_15__staticCounter = sn_add_long(__sn__level_15__staticCounter, 1LL));
+    
+}
+
+
+long long __sn__MyL11__level_12__L13__level_14__L15__getInstanceCounter() {
+
+    return __sn__MyL11__level_12__L13__level_14__L15__instanceCounter;}
+
+
+void __sn__MyL11__level_12__L13__level_14__L15__setInstanceCounter(long long __sn__v) {
+
+    (__sn__MyL11__level_12__L13__level_14__L15__instanceCounter = __sn__v);
+    
+}
+
+
+long long __sn__MyL11__level_12__L13__level_14__L15__getLevelId() {
+
+    return 15LL;}
+
+
+long long __sn__MyL11__level_12__L13__level_14__L15__computeChainValue(long long __sn__base) {
+
+    return sn_add_long(__sn__base, 15LL);}
+
+
@@ -0,0 +1,277 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: StateHolder (as val) */
+typedef struct {
+    long long __sn__level;
+    long long __sn__nestedValue;
+} __sn__StateHolder;
+/* Value operations */
+static inline __sn__StateHolder __sn__StateHolder_copy(const __sn__StateHolder *src) {
+    __sn__StateHolder dst;
+    dst.__sn__level = src->__sn__level;
+    dst.__sn__nestedValue = src->__sn__nestedValue;
+    return dst;
+}
+
+static inline void __sn__StateHolder_cleanup(__sn__StateHolder *p) {
+
+}
+
+#define sn_auto_StateHolder __attribute__((cleanup(__sn__StateHolder_cleanup)))
+
+static inline void __sn__StateHolder_cleanup_elem(void *p) { __sn__StateHolder_cleanup((__sn__StateHolder *)p); }
+static inline void __sn__StateHolder_copy_into(const void *src, void *dst) { *(__sn__StateHolder *)dst = __sn__StateHolder_copy((const __sn__StateHolder *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__StateHolder *__sn__StateHolder_alloc(void) {
+    return calloc(1, sizeof(__sn__StateHolder));
+}
+
+static inline void __sn__StateHolder_release(__sn__StateHolder **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_StateHolder __attribute__((cleanup(__sn__StateHolder_release)))
+
+static inline void __sn__StateHolder_release_elem(void *p) { __sn__StateHolder_release((__sn__StateHolder **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__StateHolder_to_string(const __sn__StateHolder *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "StateHolder { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "level: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__level);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "nestedValue: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__nestedValue);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: State (as val) */
+typedef struct {
+    long long __sn__value;
+    char * __sn__name;
+} __sn__State;
+/* Value operations */
+static inline __sn__State __sn__State_copy(const __sn__State *src) {
+    __sn__State dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__State_cleanup(__sn__State *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_State __attribute__((cleanup(__sn__State_cleanup)))
+
+static inline void __sn__State_cleanup_elem(void *p) { __sn__State_cleanup((__sn__State *)p); }
+static inline void __sn__State_copy_into(const void *src, void *dst) { *(__sn__State *)dst = __sn__State_copy((const __sn__State *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__State *__sn__State_alloc(void) {
+    return calloc(1, sizeof(__sn__State));
+}
+
+static inline void __sn__State_release(__sn__State **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_State __attribute__((cleanup(__sn__State_release)))
+
+static inline void __sn__State_release_elem(void *p) { __sn__State_release((__sn__State **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__State_to_string(const __sn__State *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "State { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: DataBundle (as val) */
+typedef struct {
+    long long __sn__id;
+    long long __sn__sum;
+} __sn__DataBundle;
+/* Value operations */
+static inline __sn__DataBundle __sn__DataBundle_copy(const __sn__DataBundle *src) {
+    __sn__DataBundle dst;
+    dst.__sn__id = src->__sn__id;
+    dst.__sn__sum = src->__sn__sum;
+    return dst;
+}
+
+static inline void __sn__DataBundle_cleanup(__sn__DataBundle *p) {
+
+}
+
+#define sn_auto_DataBundle __attribute__((cleanup(__sn__DataBundle_cleanup)))
+
+static inline void __sn__DataBundle_cleanup_elem(void *p) { __sn__DataBundle_cleanup((__sn__DataBundle *)p); }
+static inline void __sn__DataBundle_copy_into(const void *src, void *dst) { *(__sn__DataBundle *)dst = __sn__DataBundle_copy((const __sn__DataBundle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__DataBundle *__sn__DataBundle_alloc(void) {
+    return calloc(1, sizeof(__sn__DataBundle));
+}
+
+static inline void __sn__DataBundle_release(__sn__DataBundle **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_DataBundle __attribute__((cleanup(__sn__DataBundle_release)))
+
+static inline void __sn__DataBundle_release_elem(void *p) { __sn__DataBundle_release((__sn__DataBundle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__DataBundle_to_string(const __sn__DataBundle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "DataBundle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__id);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "sum: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__sum);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+extern /* static */ long long __sn__level_12__staticCounter;
+extern long long __sn__MyL12__instanceCounter;
+extern long long __sn__MyL12__holderLevel;
+extern /* static */ long long __sn__level_13__staticCounter;
+extern /* static */ char * __sn__level_13__staticName;
+extern long long __sn__MyL12__L13__instanceCounter;
+extern /* static */ long long __sn__level_14__staticCounter;
+extern long long __sn__MyL12__L13__level_14__instanceCounter;
+extern /* static */ long long __sn__level_15__staticCounter;
+extern long long __sn__MyL12__L13__level_14__L15__instanceCounter;
+extern /* static */ long long __sn__level_11__staticCounter;
+extern long long __sn__MyL11__instanceCounter;
+extern long long __sn__MyL11__level_12__instanceCounter;
+extern long long __sn__MyL11__level_12__holderLevel;
+extern long long __sn__MyL11__level_12__L13__instanceCounter;
+extern long long __sn__MyL11__level_12__L13__level_14__instanceCounter;
+extern long long __sn__MyL11__level_12__L13__level_14__L15__instanceCounter;
+
+long long __sn__MyL12__getStaticCounter();
+void __sn__MyL12__incrementStatic();
+long long __sn__MyL12__getInstanceCounter();
+long long __sn__MyL12__getDeepStatic();
+long long __sn__MyL12__getAllStaticSum();
+long long __sn__MyL12__getLevelId();
+long long __sn__MyL12__computeChainValue(long long);
+long long __sn__MyL12__getHolderLevel();
+long long __sn__MyL12__L13__getStaticCounter();
+char * __sn__MyL12__L13__getStaticName();
+void __sn__MyL12__L13__incrementStatic();
+long long __sn__MyL12__L13__getInstanceCounter();
+void __sn__MyL12__L13__setInstanceCounter(long long);
+long long __sn__MyL12__L13__getDeepStatic();
+long long __sn__MyL12__L13__getDeepDeepStatic();
+long long __sn__MyL12__L13__getLevelId();
+long long __sn__MyL12__L13__computeChainValue(long long);
+long long __sn__MyL12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__MyL12__L13__level_14__createHolder(long long);
+long long __sn__MyL12__L13__level_14__getStaticCounter();
+void __sn__MyL12__L13__level_14__incrementStatic();
+long long __sn__MyL12__L13__level_14__getInstanceCounter();
+long long __sn__MyL12__L13__level_14__getDeepStatic();
+void __sn__MyL12__L13__level_14__incrementDeepStatic();
+long long __sn__MyL12__L13__level_14__getLevelId();
+long long __sn__MyL12__L13__level_14__computeChainValue(long long);
+long long __sn__MyL12__L13__level_14__getDeepLevelId();
+__sn__State __sn__MyL12__L13__level_14__L15__createState(long long, char *);
+long long __sn__MyL12__L13__level_14__L15__getStaticCounter();
+void __sn__MyL12__L13__level_14__L15__incrementStatic();
+long long __sn__MyL12__L13__level_14__L15__getInstanceCounter();
+void __sn__MyL12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__MyL12__L13__level_14__L15__getLevelId();
+long long __sn__MyL12__L13__level_14__L15__computeChainValue(long long);
+__sn__DataBundle __sn__MyL11__createBundle();
+long long __sn__MyL11__getStaticCounter();
+void __sn__MyL11__incrementStatic();
+long long __sn__MyL11__getInstanceCounter();
+long long __sn__MyL11__getDeepStatic();
+long long __sn__MyL11__getLevelId();
+long long __sn__MyL11__computeChainValue(long long);
+long long __sn__MyL11__level_12__getStaticCounter();
+void __sn__MyL11__level_12__incrementStatic();
+long long __sn__MyL11__level_12__getInstanceCounter();
+long long __sn__MyL11__level_12__getDeepStatic();
+long long __sn__MyL11__level_12__getAllStaticSum();
+long long __sn__MyL11__level_12__getLevelId();
+long long __sn__MyL11__level_12__computeChainValue(long long);
+long long __sn__MyL11__level_12__getHolderLevel();
+long long __sn__MyL11__level_12__L13__getStaticCounter();
+char * __sn__MyL11__level_12__L13__getStaticName();
+void __sn__MyL11__level_12__L13__incrementStatic();
+long long __sn__MyL11__level_12__L13__getInstanceCounter();
+void __sn__MyL11__level_12__L13__setInstanceCounter(long long);
+long long __sn__MyL11__level_12__L13__getDeepStatic();
+long long __sn__MyL11__level_12__L13__getDeepDeepStatic();
+long long __sn__MyL11__level_12__L13__getLevelId();
+long long __sn__MyL11__level_12__L13__computeChainValue(long long);
+long long __sn__MyL11__level_12__L13__createDeepHolder(long long);
+__sn__StateHolder __sn__MyL11__level_12__L13__level_14__createHolder(long long);
+long long __sn__MyL11__level_12__L13__level_14__getStaticCounter();
+void __sn__MyL11__level_12__L13__level_14__incrementStatic();
+long long __sn__MyL11__level_12__L13__level_14__getInstanceCounter();
+long long __sn__MyL11__level_12__L13__level_14__getDeepStatic();
+void __sn__MyL11__level_12__L13__level_14__incrementDeepStatic();
+long long __sn__MyL11__level_12__L13__level_14__getLevelId();
+long long __sn__MyL11__level_12__L13__level_14__computeChainValue(long long);
+long long __sn__MyL11__level_12__L13__level_14__getDeepLevelId();
+__sn__State __sn__MyL11__level_12__L13__level_14__L15__createState(long long, char *);
+long long __sn__MyL11__level_12__L13__level_14__L15__getStaticCounter();
+void __sn__MyL11__level_12__L13__level_14__L15__incrementStatic();
+long long __sn__MyL11__level_12__L13__level_14__L15__getInstanceCounter();
+void __sn__MyL11__level_12__L13__level_14__L15__setInstanceCounter(long long);
+long long __sn__MyL11__level_12__L13__level_14__L15__getLevelId();
+long long __sn__MyL11__level_12__L13__level_14__L15__computeChainValue(long long);
+
+
+
+
+#endif
@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    __sn__arr_push(&__sn__arr, 1LL);
+    
+    __sn__arr_push(&__sn__arr, 2LL);
+    
+    __sn__arr_push(&__sn__arr, 3LL);
+    
+    *(long long *)__sn___pop(&__sn__arr);
+    
+    __sn__arr_push(&__sn__arr, 4LL);
+    
+    __sn__arr_push(&__sn__arr, 5LL);
+    
+    *(long long *)__sn___pop(&__sn__arr);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__arr_join(&__sn__arr, " ");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
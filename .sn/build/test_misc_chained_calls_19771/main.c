@@ -0,0 +1,19 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__add_one(long long __sn__x) {
+
+    return sn_add_long(__sn__x, 1LL);}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__add_one(__sn__add_one(__sn__add_one(0LL)))));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 15LL;
+    long long __sn__y = 20LL;
+    if (((sn_gt_long(__sn__x, 10LL) && sn_gt_long(__sn__y, 15LL)) || (__sn__x == 0LL))) {
+        sn_print("yes\n");
+        
+    } else {
+        sn_print("no\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 1LL;
+    if (sn_gt_long(__sn__x, 0LL)) {
+        if (sn_lt_long(__sn__x, 10LL)) {
+            if ((__sn__x == 1LL)) {
+                sn_print("found\n");
+                
+            }
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
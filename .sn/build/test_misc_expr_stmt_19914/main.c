@@ -0,0 +1,15 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = sn_add_long(sn_add_long(sn_add_long(sn_add_long(sn_add_long(sn_add_long(sn_add_long(sn_add_long(sn_add_long(1LL, 2LL), 3LL), 4LL), 5LL), 6LL), 7LL), 8LL), 9LL), 10LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,19 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__add5(long long __sn__a, long long __sn__b, long long __sn__c, long long __sn__d, long long __sn__e) {
+
+    return sn_add_long(sn_add_long(sn_add_long(sn_add_long(__sn__a, __sn__b), __sn__c), __sn__d), __sn__e);}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__add5(1LL, 2LL, 3LL, 4LL, 5LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
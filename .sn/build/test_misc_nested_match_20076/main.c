@@ -0,0 +1,38 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 2LL;
+    long long __sn__y = 3LL;
+    ({
+            long long __match_subject__ = __sn__x;
+            if (__match_subject__ == 1LL) {
+                sn_print("one\n");
+    
+    
+            } else if (__match_subject__ == 2LL) {
+                ({
+            long long __match_subject__ = __sn__y;
+            if (__match_subject__ == 3LL) {
+                sn_print("two-three\n");
+    
+    
+            } else {
+                sn_print("two-other\n");
+    
+    
+            }
+        });
+    
+    
+            } else {
+                sn_print("other\n");
+    
+    
+            }
+        });
+    
+    fflush(stdout);
+    return 0;
+}
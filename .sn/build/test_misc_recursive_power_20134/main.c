@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__rec_pow(long long __sn__b, long long __sn__e) {
+
+    if ((__sn__e == 0LL)) {
+        return 1LL;}
+
+    return sn_mul_long(__sn__b, __sn__rec_pow(__sn__b, sn_sub_long(__sn__e, 1LL)));}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__rec_pow(2LL, 8LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__inc_check(long long __sn__n) {
+
+    return true;}
+
+int main() {
+    long long __sn__x = 0LL;
+    if ((false && __sn__inc_check(__sn__x))) {
+        sn_print("no\n");
+        
+    }
+    sn_print("done\n");
+    
+    fflush(stdout);
+    return 0;
+}
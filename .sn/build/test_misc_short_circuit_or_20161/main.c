@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__never_called() {
+
+    return false;}
+
+int main() {
+    if ((true || __sn__never_called())) {
+        sn_print("yes\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
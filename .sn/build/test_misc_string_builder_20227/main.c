@@ -0,0 +1,36 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__result = strdup("");
+    ({
+        char *__sn_tmp__ = __sn___append(&__sn__result, "a");
+        free(__sn__result);
+        __sn__result = __sn_tmp__;
+        __sn__result;
+    });
+    
+    ({
+        char *__sn_tmp__ = __sn___append(&__sn__result, "b");
+        free(__sn__result);
+        __sn__result = __sn_tmp__;
+        __sn__result;
+    });
+    
+    ({
+        char *__sn_tmp__ = __sn___append(&__sn__result, "c");
+        free(__sn__result);
+        __sn__result = __sn_tmp__;
+        __sn__result;
+    });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__result);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
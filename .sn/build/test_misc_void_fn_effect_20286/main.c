@@ -0,0 +1,24 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__print_header(char * __sn__title) {
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("=== ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__title);
+            sn_auto_str char *__is_p2__ = sn_strdup(" ===\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+int main() {
+    __sn__print_header("Test");
+    
+    sn_print("body\n");
+    
+    fflush(stdout);
+    return 0;
+}
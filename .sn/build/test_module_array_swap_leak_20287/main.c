@@ -0,0 +1,284 @@
+#include "sn_types.h"
+__sn__Tag * tag_create(long long);
+long long tag_alive_count();
+
+SnArray * __sn__buffer = NULL;
+
+
+
+void __sn__emit(char * __sn__name, SnArray * __sn__tags) {
+
+    __sn__arr_push(&__sn__buffer, (__sn__Item){ .__sn__name = strdup(__sn__name), .__sn__tags = sn_array_copy(__sn__tags) });
+    
+}
+
+
+long long __sn__flush() {
+
+    sn_auto_arr SnArray * __sn__toSend = sn_array_copy(__sn__buffer);
+
+    ({
+        SnArray *__sn_tmp__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_cleanup_elem;
+            __al__->elem_copy = __sn__Item_copy_into;
+            __al__;
+        });
+        sn_cleanup_array(&__sn__buffer);
+        __sn__buffer = __sn_tmp__;
+        __sn__buffer;
+    });
+    
+
+    long long __sn__count = sn_array_length(__sn__toSend);
+
+    return __sn__count;}
+
+
+void __sn__createAndEmit(long long __sn__id) {
+
+    sn_auto_Tag __sn__Tag * __sn__t1 = tag_create(__sn__id);
+
+    sn_auto_Tag __sn__Tag * __sn__t2 = tag_create(sn_add_long(__sn__id, 1LL));
+
+    sn_auto_str char * __sn____chain_tmp_0 = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("metric_");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__id));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });
+
+    ({ sn_auto_arr SnArray *__al_tmp_1__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Tag *), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Tag_release_elem;
+            __al__->elem_copy = __sn__Tag_retain_into;
+            sn_array_push(__al__, &(__sn__Tag *){ __sn__Tag_retain(__sn__t1) });
+            sn_array_push(__al__, &(__sn__Tag *){ __sn__Tag_retain(__sn__t2) });
+            __al__;
+        }); __sn__emit(__sn____chain_tmp_0, __al_tmp_1__); });
+    
+}
+
+
+void __sn__test_separate_scopes() {
+
+    __sn__createAndEmit(10LL);
+    
+
+    __sn__createAndEmit(20LL);
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("before flush: alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+
+    long long __sn__count = __sn__flush();
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("after flush: count=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup(" alive=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test_separate_scopes: leaked ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_auto_str char *__is_p2__ = sn_strdup(" tags");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_assert((tag_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+
+    sn_println("test_separate_scopes: PASS");
+    
+}
+
+
+void __sn__test_repeated_flush() {
+
+    {
+        for (long long __sn__round = 0LL; sn_lt_long(__sn__round, 5LL); __sn__round++) {
+            __sn__createAndEmit(sn_mul_long(__sn__round, 100LL));
+            
+        }
+    }
+
+    __sn__flush();
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("after 5 rounds: alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test_repeated_flush: leaked ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_auto_str char *__is_p2__ = sn_strdup(" tags");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_assert((tag_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+
+    sn_println("test_repeated_flush: PASS");
+    
+}
+
+
+void __sn__test_mixed_empty() {
+
+    ({ sn_auto_arr SnArray *__al_tmp_1__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+    
+            __al__;
+        }); __sn__emit("no_tags", __al_tmp_1__); });
+    
+
+    __sn__createAndEmit(999LL);
+    
+
+    ({ sn_auto_arr SnArray *__al_tmp_1__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+    
+            __al__;
+        }); __sn__emit("no_tags_2", __al_tmp_1__); });
+    
+
+    __sn__flush();
+    
+
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test_mixed_empty: leaked ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_auto_str char *__is_p2__ = sn_strdup(" tags");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_assert((tag_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+
+    sn_println("test_mixed_empty: PASS");
+    
+}
+
+
+void __sn__test_direct_reassign() {
+
+    __sn__createAndEmit(50LL);
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("before reassign: alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+
+    ({
+        SnArray *__sn_tmp__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_cleanup_elem;
+            __al__->elem_copy = __sn__Item_copy_into;
+            __al__;
+        });
+        sn_cleanup_array(&__sn__buffer);
+        __sn__buffer = __sn_tmp__;
+        __sn__buffer;
+    });
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("after reassign: alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test_direct_reassign: leaked ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_auto_str char *__is_p2__ = sn_strdup(" tags");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_assert((tag_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+
+    sn_println("test_direct_reassign: PASS");
+    
+}
+
+
+void __sn__test_same_scope() {
+
+    sn_auto_Tag __sn__Tag * __sn__t = tag_create(1LL);
+
+    ({ sn_auto_arr SnArray *__al_tmp_1__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Tag *), 1);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Tag_release_elem;
+            __al__->elem_copy = __sn__Tag_retain_into;
+            sn_array_push(__al__, &(__sn__Tag *){ __sn__Tag_retain(__sn__t) });
+            __al__;
+        }); __sn__emit("inline", __al_tmp_1__); });
+    
+
+    __sn__flush();
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("after same-scope flush: alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+}
+
+
+
+int main() {
+    __sn__buffer = ({
+        SnArray *__al__ = sn_array_new(sizeof(__sn__Item), 0);
+        __al__->elem_tag = SN_TAG_STRUCT;
+
+        __al__->elem_release = __sn__Item_cleanup_elem;
+        __al__->elem_copy = __sn__Item_copy_into;
+        __al__;
+    });
+    __sn__test_separate_scopes();
+    
+    __sn__test_repeated_flush();
+    
+    __sn__test_mixed_empty();
+    
+    __sn__test_direct_reassign();
+    
+    __sn__test_same_scope();
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("final: alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("final leak: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tag_alive_count()));
+            sn_auto_str char *__is_p2__ = sn_strdup(" tags");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_assert((tag_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    sn_println("test_module_array_swap_leak: ALL PASS");
+    
+    sn_cleanup_array(&__sn__buffer);
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,125 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Tag (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__id;
+} __sn__Tag;
+
+
+static inline __sn__Tag *__sn__Tag__new(void) {
+    __sn__Tag *p = calloc(1, sizeof(__sn__Tag));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Tag *__sn__Tag_retain(__sn__Tag *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+void tag_dispose(__sn__Tag *);
+static inline void __sn__Tag_release(__sn__Tag **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        tag_dispose(*p);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Tag __attribute__((cleanup(__sn__Tag_release)))
+#define sn_auto_ref_Tag __attribute__((cleanup(__sn__Tag_release)))
+
+static inline void __sn__Tag_release_elem(void *p) { __sn__Tag_release((__sn__Tag **)p); }
+static inline void __sn__Tag_retain_into(const void *src, void *dst) { *(__sn__Tag **)dst = __sn__Tag_retain(*(__sn__Tag *const *)src); }
+
+/* Struct: Item (as val) */
+typedef struct {
+    char * __sn__name;
+    SnArray * __sn__tags;
+} __sn__Item;
+/* Value operations */
+static inline __sn__Item __sn__Item_copy(const __sn__Item *src) {
+    __sn__Item dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__tags = sn_array_copy(src->__sn__tags);
+    return dst;
+}
+
+static inline void __sn__Item_cleanup(__sn__Item *p) {
+    free(p->__sn__name);
+    sn_cleanup_array(&p->__sn__tags);
+
+}
+
+#define sn_auto_Item __attribute__((cleanup(__sn__Item_cleanup)))
+
+static inline void __sn__Item_cleanup_elem(void *p) { __sn__Item_cleanup((__sn__Item *)p); }
+static inline void __sn__Item_copy_into(const void *src, void *dst) { *(__sn__Item *)dst = __sn__Item_copy((const __sn__Item *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Item *__sn__Item_alloc(void) {
+    return calloc(1, sizeof(__sn__Item));
+}
+
+static inline void __sn__Item_release(__sn__Item **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        sn_cleanup_array(&(*p)->__sn__tags);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Item __attribute__((cleanup(__sn__Item_release)))
+
+static inline void __sn__Item_release_elem(void *p) { __sn__Item_release((__sn__Item **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Item_to_string(const __sn__Item *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Item { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tags: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__tags); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+extern SnArray * __sn__buffer;
+
+void __sn__emit(char *, SnArray *);
+long long __sn__flush();
+void __sn__createAndEmit(long long);
+void __sn__test_separate_scopes();
+void __sn__test_repeated_flush();
+void __sn__test_mixed_empty();
+void __sn__test_direct_reassign();
+void __sn__test_same_scope();
+
+void tag_dispose(__sn__Tag *);
+
+
+
+#endif
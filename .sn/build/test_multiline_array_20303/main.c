@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__nums = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 4);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            sn_array_push(__al__, &(long long){ 40LL });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("len=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__nums)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" sum=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(sn_add_long(sn_add_long(sn_add_long((((long long *)__sn__nums->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__nums->len : __ai__; })]), (((long long *)__sn__nums->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__nums->len : __ai__; })])), (((long long *)__sn__nums->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__nums->len : __ai__; })])), (((long long *)__sn__nums->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__nums->len : __ai__; })]))));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
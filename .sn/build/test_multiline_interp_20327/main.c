@@ -0,0 +1,85 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__msg1 = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Line 1\nLine 2\nLine 3");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+    sn_print(__sn__msg1);
+    
+    sn_print("\n---\n");
+    
+    sn_auto_str char * __sn__name = strdup("World");
+    sn_auto_str char * __sn__msg2 = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hello,\n");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("!");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });
+    sn_print(__sn__msg2);
+    
+    sn_print("\n---\n");
+    
+    long long __sn__x = 42LL;
+    sn_auto_str char * __sn__msg3 = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Value: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup("\nDoubled: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(sn_mul_long(__sn__x, 2LL)));
+            sn_auto_str char *__is_p4__ = sn_strdup("\nTripled: ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(sn_mul_long(__sn__x, 3LL)));
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        });
+    sn_print(__sn__msg3);
+    
+    sn_print("\n---\n");
+    
+    double __sn__pi = 3.1415899999999999;
+    sn_auto_str char * __sn__msg4 = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pi values:\n2 decimals: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.2f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n4 decimals: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.4f", (double)(__sn__pi));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        });
+    sn_print(__sn__msg4);
+    
+    sn_print("\n---\n");
+    
+    long long __sn__count = 5LL;
+    sn_auto_str char * __sn__item = strdup("apples");
+    sn_auto_str char * __sn__msg5 = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Shopping list:\n- ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup(" ");
+            sn_auto_str char *__is_p3__ = sn_strdup(__sn__item);
+            sn_auto_str char *__is_p4__ = sn_strdup("\n- ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(sn_mul_long(__sn__count, 2LL)));
+            sn_auto_str char *__is_p6__ = sn_strdup(" oranges\nTotal items: ");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(sn_add_long(__sn__count, sn_mul_long(__sn__count, 2LL))));
+            sn_str_concat_multi(8, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__);
+        });
+    sn_print(__sn__msg5);
+    
+    sn_print("\n---\n");
+    
+    sn_auto_str char * __sn__msg6 = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("First\n\nThird");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+    sn_print(__sn__msg6);
+    
+    sn_print("\n---\n");
+    
+    sn_auto_str char * __sn__msg7 = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Tab:\there\nQuote: \"quoted\"\nBackslash: \\");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+    sn_print(__sn__msg7);
+    
+    sn_print("\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,202 @@
+#include "sn_types.h"
+
+
+
+
+
+
+int main() {
+    sn_print("=== Multi-line Literal Tests ===\n\n");
+    
+    sn_auto_arr SnArray * __sn__ints = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 9);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            sn_array_push(__al__, &(long long){ 9LL });
+            __al__;
+        });
+    sn_assert((sn_array_length(__sn__ints) == 9LL), "int array length");
+    
+    sn_assert(((((long long *)__sn__ints->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__ints->len : __ai__; })]) == 1LL), "int array first");
+    
+    sn_assert(((((long long *)__sn__ints->data)[({ long long __ai__ = 8LL; __ai__ < 0 ? __ai__ + __sn__ints->len : __ai__; })]) == 9LL), "int array last");
+    
+    sn_assert(((((long long *)__sn__ints->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__ints->len : __ai__; })]) == 5LL), "int array middle");
+    
+    sn_print("test_multiline_int_array: PASS\n");
+    
+    sn_auto_arr SnArray * __sn__bytes = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 13);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 72LL });
+            sn_array_push(__al__, &(unsigned char){ 101LL });
+            sn_array_push(__al__, &(unsigned char){ 108LL });
+            sn_array_push(__al__, &(unsigned char){ 108LL });
+            sn_array_push(__al__, &(unsigned char){ 111LL });
+            sn_array_push(__al__, &(unsigned char){ 44LL });
+            sn_array_push(__al__, &(unsigned char){ 32LL });
+            sn_array_push(__al__, &(unsigned char){ 87LL });
+            sn_array_push(__al__, &(unsigned char){ 111LL });
+            sn_array_push(__al__, &(unsigned char){ 114LL });
+            sn_array_push(__al__, &(unsigned char){ 108LL });
+            sn_array_push(__al__, &(unsigned char){ 100LL });
+            sn_array_push(__al__, &(unsigned char){ 33LL });
+            __al__;
+        });
+    sn_assert((sn_array_length(__sn__bytes) == 13LL), "byte array length");
+    
+    sn_assert(((((unsigned char *)__sn__bytes->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__bytes->len : __ai__; })]) == 72LL), "byte array H");
+    
+    sn_assert(((((unsigned char *)__sn__bytes->data)[({ long long __ai__ = 12LL; __ai__ < 0 ? __ai__ + __sn__bytes->len : __ai__; })]) == 33LL), "byte array !");
+    
+    sn_print("test_multiline_byte_array: PASS\n");
+    
+    sn_auto_arr SnArray * __sn__doubles = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 5);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.0 });
+            sn_array_push(__al__, &(double){ 2.5 });
+            sn_array_push(__al__, &(double){ 3.1400000000000001 });
+            sn_array_push(__al__, &(double){ 4.0 });
+            sn_array_push(__al__, &(double){ 5.5 });
+            __al__;
+        });
+    sn_assert((sn_array_length(__sn__doubles) == 5LL), "double array length");
+    
+    sn_assert(sn_gt_double((((double *)__sn__doubles->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__doubles->len : __ai__; })]), 3.1000000000000001), "double array pi");
+    
+    sn_print("test_multiline_double_array: PASS\n");
+    
+    sn_auto_arr SnArray * __sn__bools = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 5);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            __al__;
+        });
+    sn_assert((sn_array_length(__sn__bools) == 5LL), "bool array length");
+    
+    sn_assert((((bool *)__sn__bools->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__bools->len : __ai__; })]), "bool array first true");
+    
+    sn_assert((!(((bool *)__sn__bools->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__bools->len : __ai__; })])), "bool array second false");
+    
+    sn_print("test_multiline_bool_array: PASS\n");
+    
+    sn_auto_arr SnArray * __sn__strs = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("hello") });
+            sn_array_push(__al__, &(char *){ strdup("world") });
+            sn_array_push(__al__, &(char *){ strdup("test") });
+            __al__;
+        });
+    sn_assert((sn_array_length(__sn__strs) == 3LL), "string array length");
+    
+    sn_assert((strcmp((((char * *)__sn__strs->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__strs->len : __ai__; })]), "hello") == 0), "string array first");
+    
+    sn_assert((strcmp((((char * *)__sn__strs->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__strs->len : __ai__; })]), "test") == 0), "string array last");
+    
+    sn_print("test_multiline_string_array: PASS\n");
+    
+    sn_auto_arr SnArray * __sn__matrix = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 3);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            sn_array_push(__al__, &(long long){ 9LL });
+            __al__;
+        }) });
+            __al__;
+        });
+    sn_assert((sn_array_length(__sn__matrix) == 3LL), "matrix rows");
+    
+    sn_assert((sn_array_length((((SnArray * *)__sn__matrix->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__matrix->len : __ai__; })])) == 3LL), "matrix cols");
+    
+    sn_assert(((((long long *)(((SnArray * *)__sn__matrix->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__matrix->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__matrix->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__matrix->len : __ai__; })])->len : __ai__; })]) == 5LL), "matrix center");
+    
+    sn_print("test_nested_multiline_arrays: PASS\n");
+    
+    sn_auto_Config __sn__Config __sn__config = (__sn__Config){ .__sn__name = strdup("myapp"), .__sn__port = 8080LL, .__sn__debug = true };
+    sn_assert((strcmp(__sn__config.__sn__name, "myapp") == 0), "config name");
+    
+    sn_assert((__sn__config.__sn__port == 8080LL), "config port");
+    
+    sn_assert(__sn__config.__sn__debug, "config debug");
+    
+    sn_print("test_multiline_struct: PASS\n");
+    
+    __sn__Point __sn__point = (__sn__Point){ .__sn__x = 100LL, .__sn__y = 200LL };
+    sn_assert((__sn__point.__sn__x == 100LL), "point x");
+    
+    sn_assert((__sn__point.__sn__y == 200LL), "point y");
+    
+    sn_print("test_multiline_point: PASS\n");
+    
+    sn_auto_Person __sn__Person __sn__p1 = (__sn__Person){ .__sn__name = strdup("Alice"), .__sn__age = 30LL };
+    sn_auto_Person __sn__Person __sn__p2 = (__sn__Person){ .__sn__name = strdup("Bob"), .__sn__age = 25LL };
+    sn_assert((strcmp(__sn__p1.__sn__name, "Alice") == 0), "person 1 name");
+    
+    sn_assert((__sn__p2.__sn__age == 25LL), "person 2 age");
+    
+    sn_print("test_struct_values: PASS\n");
+    
+    sn_auto_arr SnArray * __sn__single = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+    sn_assert((sn_array_length(__sn__single) == 3LL), "single line array");
+    
+    sn_print("test_single_line_still_works: PASS\n");
+    
+    sn_print("\nAll multi-line literal tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
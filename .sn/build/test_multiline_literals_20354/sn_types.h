@@ -0,0 +1,192 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Config (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__port;
+    bool __sn__debug;
+} __sn__Config;
+/* Value operations */
+static inline __sn__Config __sn__Config_copy(const __sn__Config *src) {
+    __sn__Config dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__port = src->__sn__port;
+    dst.__sn__debug = src->__sn__debug;
+    return dst;
+}
+
+static inline void __sn__Config_cleanup(__sn__Config *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Config __attribute__((cleanup(__sn__Config_cleanup)))
+
+static inline void __sn__Config_cleanup_elem(void *p) { __sn__Config_cleanup((__sn__Config *)p); }
+static inline void __sn__Config_copy_into(const void *src, void *dst) { *(__sn__Config *)dst = __sn__Config_copy((const __sn__Config *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Config *__sn__Config_alloc(void) {
+    return calloc(1, sizeof(__sn__Config));
+}
+
+static inline void __sn__Config_release(__sn__Config **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Config __attribute__((cleanup(__sn__Config_release)))
+
+static inline void __sn__Config_release_elem(void *p) { __sn__Config_release((__sn__Config **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Config_to_string(const __sn__Config *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Config { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "port: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__port);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "debug: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__debug ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Person (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__age;
+} __sn__Person;
+/* Value operations */
+static inline __sn__Person __sn__Person_copy(const __sn__Person *src) {
+    __sn__Person dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__age = src->__sn__age;
+    return dst;
+}
+
+static inline void __sn__Person_cleanup(__sn__Person *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Person __attribute__((cleanup(__sn__Person_cleanup)))
+
+static inline void __sn__Person_cleanup_elem(void *p) { __sn__Person_cleanup((__sn__Person *)p); }
+static inline void __sn__Person_copy_into(const void *src, void *dst) { *(__sn__Person *)dst = __sn__Person_copy((const __sn__Person *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Person *__sn__Person_alloc(void) {
+    return calloc(1, sizeof(__sn__Person));
+}
+
+static inline void __sn__Person_release(__sn__Person **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Person __attribute__((cleanup(__sn__Person_release)))
+
+static inline void __sn__Person_release_elem(void *p) { __sn__Person_release((__sn__Person **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Person_to_string(const __sn__Person *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Person { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "age: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__age);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+
+
+
+#endif
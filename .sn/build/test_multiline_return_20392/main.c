@@ -0,0 +1,24 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Config __sn__makeConfig() {
+
+    return (__sn__Config){ .__sn__host = strdup("localhost"), .__sn__port = 8080LL, .__sn__debug = true };}
+
+
+int main() {
+    sn_auto_Config __sn__Config __sn__c = __sn__makeConfig();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__c.__sn__host);
+            sn_auto_str char *__is_p1__ = sn_strdup(":");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__port));
+            sn_auto_str char *__is_p3__ = sn_strdup(" debug=");
+            sn_auto_str char *__is_p4__ = sn_strdup((__sn__c.__sn__debug) ? "true" : "false");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
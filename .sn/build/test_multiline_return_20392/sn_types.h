@@ -0,0 +1,85 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Config (as val) */
+typedef struct {
+    char * __sn__host;
+    long long __sn__port;
+    bool __sn__debug;
+} __sn__Config;
+/* Value operations */
+static inline __sn__Config __sn__Config_copy(const __sn__Config *src) {
+    __sn__Config dst;
+    dst.__sn__host = src->__sn__host ? strdup(src->__sn__host) : NULL;
+    dst.__sn__port = src->__sn__port;
+    dst.__sn__debug = src->__sn__debug;
+    return dst;
+}
+
+static inline void __sn__Config_cleanup(__sn__Config *p) {
+    free(p->__sn__host);
+
+}
+
+#define sn_auto_Config __attribute__((cleanup(__sn__Config_cleanup)))
+
+static inline void __sn__Config_cleanup_elem(void *p) { __sn__Config_cleanup((__sn__Config *)p); }
+static inline void __sn__Config_copy_into(const void *src, void *dst) { *(__sn__Config *)dst = __sn__Config_copy((const __sn__Config *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Config *__sn__Config_alloc(void) {
+    return calloc(1, sizeof(__sn__Config));
+}
+
+static inline void __sn__Config_release(__sn__Config **p) {
+    if (*p) {
+        free((*p)->__sn__host);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Config __attribute__((cleanup(__sn__Config_release)))
+
+static inline void __sn__Config_release_elem(void *p) { __sn__Config_release((__sn__Config **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Config_to_string(const __sn__Config *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Config { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "host: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__host ? p->__sn__host : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "port: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__port);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "debug: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__debug ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Config __sn__makeConfig();
+
+
+
+
+#endif
@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+
+int main() {
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 1LL, .__sn__y = 2LL, .__sn__z = 3LL };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("x=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(" y=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(" z=");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__z));
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long __sn__math__add(long long, long long);
+long long __sn__math__subtract(long long, long long);
+long long __sn__math__multiply(long long, long long);
+long long __sn__math__divide(long long, long long);
+
+
+
+
+#endif
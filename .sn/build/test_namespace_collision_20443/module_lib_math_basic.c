@@ -0,0 +1,14 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__basic__sum(long long __sn__a, long long __sn__b) {
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+long long __sn__basic__prod(long long __sn__a, long long __sn__b) {
+
+    return sn_mul_long(__sn__a, __sn__b);}
+
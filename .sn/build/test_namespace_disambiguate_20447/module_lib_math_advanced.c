@@ -0,0 +1,23 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__adv__power(long long __sn__base, long long __sn__exp) {
+
+    long long __sn__result = 1LL;
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, __sn__exp); __sn__i++) {
+            (__sn__result = sn_mul_long(__sn__result, __sn__base));
+            
+        }
+    }
+
+    return __sn__result;}
+
+
+long long __sn__adv__square(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, __sn__x);}
+
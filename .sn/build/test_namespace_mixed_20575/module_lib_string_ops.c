@@ -0,0 +1,33 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__strings__greet(char * __sn__name) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hello, ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("!");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });}
+
+
+char * __sn__strings__farewell(char * __sn__name) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Goodbye, ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("!");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });}
+
+
+char * __sn__strings__double_str(char * __sn__s) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__s);
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__s);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });}
+
@@ -0,0 +1,27 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__math__add(long long __sn__a, long long __sn__b) {
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+long long __sn__math__subtract(long long __sn__a, long long __sn__b) {
+
+    return sn_sub_long(__sn__a, __sn__b);}
+
+
+long long __sn__math__multiply(long long __sn__a, long long __sn__b) {
+
+    return sn_mul_long(__sn__a, __sn__b);}
+
+
+long long __sn__math__divide(long long __sn__a, long long __sn__b) {
+
+    if ((__sn__b == 0LL)) {
+        return 0LL;}
+
+    return sn_div_long(__sn__a, __sn__b);}
+
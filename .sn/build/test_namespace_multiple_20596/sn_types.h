@@ -0,0 +1,31 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long __sn__math__add(long long, long long);
+long long __sn__math__subtract(long long, long long);
+long long __sn__math__multiply(long long, long long);
+long long __sn__math__divide(long long, long long);
+char * __sn__strings__greet(char *);
+char * __sn__strings__farewell(char *);
+char * __sn__strings__double_str(char *);
+
+
+
+
+#endif
@@ -0,0 +1,38 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("fmt.bracket(\"test\") = ");
+            sn_auto_str char *__is_p1__ = __sn__fmt__bracket("test");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("fmt.parens(\"hello\") = ");
+            sn_auto_str char *__is_p1__ = __sn__fmt__parens("hello");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("fmt.double_bracket(\"x\") = ");
+            sn_auto_str char *__is_p1__ = __sn__fmt__double_bracket("x");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn____chain_tmp_0 = __sn__fmt__parens("nested");
+    sn_auto_str char * __sn__result = __sn__fmt__bracket(__sn____chain_tmp_0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("fmt.bracket(fmt.parens(\"nested\")) = ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__result);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__fmt__bracket(char * __sn__s) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("[");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__s);
+            sn_auto_str char *__is_p2__ = sn_strdup("]");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });}
+
+
+char * __sn__fmt__parens(char * __sn__s) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("(");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__s);
+            sn_auto_str char *__is_p2__ = sn_strdup(")");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });}
+
+
+char * __sn__fmt__double_bracket(char * __sn__s) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("[[");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__s);
+            sn_auto_str char *__is_p2__ = sn_strdup("]]");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });}
+
@@ -0,0 +1,61 @@
+#include "sn_types.h"
+
+
+
+long long call_with_value(void * __sn__cb, long long __sn__value) {
+
+    return ((long long (*)(void *, long long))((__Closure__ *)__sn__cb)->fn)(__sn__cb, __sn__value);}
+
+long long apply_op(void * __sn__op, long long __sn__a, long long __sn__b) {
+
+    return ((long long (*)(void *, long long, long long))((__Closure__ *)__sn__op)->fn)(__sn__op, __sn__a, __sn__b);}
+
+long long test_callbacks() {
+
+    sn_auto_fn void * __sn__doubler = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    sn_auto_fn void * __sn__adder = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_1__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__result1 = call_with_value(__sn__doubler, 21LL);
+
+    long long __sn__result2 = apply_op(__sn__adder, 10LL, 32LL);
+
+    return sn_add_long(__sn__result1, __sn__result2);}
+
+int main() {
+    long long __sn__result = test_callbacks();
+    if ((__sn__result == 84LL)) {
+        sn_print("PASS\n");
+        
+        return 0LL;} else {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: expected 84, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 1LL;}
+    fflush(stdout);
+    return 0;
+}
+
+static long long __lambda_0__(void *__closure__, long long __sn__x) {
+    return sn_mul_long(__sn__x, 2LL);}
+
+static long long __lambda_1__(void *__closure__, long long __sn__a, long long __sn__b) {
+    return sn_add_long(__sn__a, __sn__b);}
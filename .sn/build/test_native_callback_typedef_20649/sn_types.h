@@ -0,0 +1,29 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long call_with_value(void *, long long);
+long long apply_op(void *, long long, long long);
+long long test_callbacks();
+
+
+
+static long long __lambda_0__(void *__closure__, long long __sn__x);
+static long long __lambda_1__(void *__closure__, long long __sn__a, long long __sn__b);
+
+#endif
@@ -0,0 +1,146 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__add(long long __sn__a, long long __sn__b) {
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+long long __sn__multiply(long long __sn__a, long long __sn__b) {
+
+    return sn_mul_long(__sn__a, __sn__b);}
+
+
+void __sn__compare_values(long long __sn__x, long long __sn__y) {
+
+    if (sn_lt_long(__sn__x, __sn__y)) {
+        sn_print("x < y\n");
+        
+    }
+
+    if (sn_gt_long(__sn__x, __sn__y)) {
+        sn_print("x > y\n");
+        
+    }
+
+    if ((__sn__x == __sn__y)) {
+        sn_print("x == y\n");
+        
+    }
+
+    if ((__sn__x <= __sn__y)) {
+        sn_print("x <= y\n");
+        
+    }
+
+    if ((__sn__x >= __sn__y)) {
+        sn_print("x >= y\n");
+        
+    }
+
+    if ((__sn__x != __sn__y)) {
+        sn_print("x != y\n");
+        
+    }
+}
+
+
+void __sn__test_double_ops() {
+
+    double __sn__a = 3.1400000000000001;
+
+    double __sn__b = 2.0;
+
+    double __sn__sum = sn_add_double(__sn__a, __sn__b);
+
+    double __sn__diff = sn_sub_double(__sn__a, __sn__b);
+
+    double __sn__prod = sn_mul_double(__sn__a, __sn__b);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("double sum = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__sum));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("double diff = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__diff));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("double prod = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__prod));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+int main() {
+    long long __sn__result = __sn__add(10LL, 20LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("10 + 20 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    (__sn__result = __sn__multiply(7LL, 8LL));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("7 * 8 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__sub = sn_sub_long(50LL, 13LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("50 - 13 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sub));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__neg = (-25LL);
+    long long __sn__pos = 25LL;
+    long long __sn__sum = sn_add_long(__sn__neg, __sn__pos);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("-25 + 25 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("Testing 5 vs 10:\n");
+    
+    __sn__compare_values(5LL, 10LL);
+    
+    sn_print("Testing 10 vs 5:\n");
+    
+    __sn__compare_values(10LL, 5LL);
+    
+    sn_print("Testing 7 vs 7:\n");
+    
+    __sn__compare_values(7LL, 7LL);
+    
+    __sn__test_double_ops();
+    
+    long long __sn__complex = sn_div_long(sn_mul_long(sn_add_long(3LL, 4LL), sn_sub_long(10LL, 3LL)), 7LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("(3 + 4) * (10 - 3) / 7 = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__complex));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,75 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Tensor * __sn__makeTensor(long long __sn__t, long long __sn__d) {
+
+    return ({
+        __sn__Tensor *__tmp__ = __sn__Tensor__new();
+        __tmp__->__sn__tag = __sn__t;
+        __tmp__->__sn__data = __sn__d;
+        __tmp__;
+    });}
+
+
+__sn__GraphTensors __sn__graphToTensors(long long __sn__n) {
+
+    return (__sn__GraphTensors){ .__sn__nodeFeatures = __sn__makeTensor(1LL, sn_mul_long(__sn__n, 10LL)), .__sn__edgeIndex = __sn__makeTensor(2LL, sn_mul_long(__sn__n, 20LL)), .__sn__edgeWeight = __sn__makeTensor(3LL, sn_mul_long(__sn__n, 30LL)), .__sn__batchIndex = __sn__makeTensor(4LL, sn_mul_long(__sn__n, 40LL)), .__sn__numNodes = __sn__n };}
+
+
+long long __sn__aggregate(__sn__Tensor * __sn__t, long long __sn__scale) {
+
+    return sn_mul_long(__sn__t->__sn__data, __sn__scale);}
+
+
+long long __sn__gcnForward(__sn__GraphTensors *__sn__tensors, long long __sn__w) {
+
+    sn_auto_Tensor __sn__Tensor * __sn__nf = __sn__Tensor_retain((*__sn__tensors).__sn__nodeFeatures);
+
+    sn_auto_Tensor __sn__Tensor * __sn__ew = __sn__Tensor_retain((*__sn__tensors).__sn__edgeWeight);
+
+    long long __sn__r1 = __sn__aggregate(__sn__nf, __sn__w);
+
+    long long __sn__r2 = __sn__aggregate(__sn__ew, sn_add_long(__sn__w, 1LL));
+
+    return sn_add_long(__sn__r1, __sn__r2);}
+
+
+long long __sn__forward(__sn__GraphTensors *__sn__tensors) {
+
+    long long __sn__r1 = __sn__gcnForward(&(*__sn__tensors), 2LL);
+
+    long long __sn__r2 = __sn__gcnForward(&(*__sn__tensors), 3LL);
+
+    long long __sn__bi = (*__sn__tensors).__sn__batchIndex->__sn__data;
+
+    return sn_add_long(sn_add_long(__sn__r1, __sn__r2), __sn__bi);}
+
+
+
+int main() {
+    long long __sn__i = 0LL;
+    while (sn_lt_long(__sn__i, 10LL)) {
+        sn_auto_GraphTensors __sn__GraphTensors __sn__tensors = __sn__graphToTensors(sn_add_long(__sn__i, 1LL));
+        long long __sn__result = __sn__forward(&__sn__tensors);
+        long long __sn__nf = __sn__tensors.__sn__nodeFeatures->__sn__data;
+        long long __sn__ew = __sn__tensors.__sn__edgeWeight->__sn__data;
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("cycle ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                sn_auto_str char *__is_p2__ = sn_strdup(": result=");
+                sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p4__ = sn_strdup(", nf=");
+                sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__nf));
+                sn_auto_str char *__is_p6__ = sn_strdup(", ew=");
+                sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__ew));
+                sn_auto_str char *__is_p8__ = sn_strdup("\n");
+                sn_str_concat_multi(9, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__);
+            }); sn_print(__ps__); };
+        
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,158 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Tensor (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__tag;
+    long long __sn__data;
+} __sn__Tensor;
+
+
+static inline __sn__Tensor *__sn__Tensor__new(void) {
+    __sn__Tensor *p = calloc(1, sizeof(__sn__Tensor));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Tensor *__sn__Tensor_retain(__sn__Tensor *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Tensor_release(__sn__Tensor **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Tensor *__sn__Tensor_copy(const __sn__Tensor *src) {
+    __sn__Tensor *dst = calloc(1, sizeof(__sn__Tensor));
+    dst->__rc__ = 1;
+    dst->__sn__tag = src->__sn__tag;
+    dst->__sn__data = src->__sn__data;
+    return dst;
+}
+
+#define sn_auto_Tensor __attribute__((cleanup(__sn__Tensor_release)))
+#define sn_auto_ref_Tensor __attribute__((cleanup(__sn__Tensor_release)))
+
+static inline void __sn__Tensor_release_elem(void *p) { __sn__Tensor_release((__sn__Tensor **)p); }
+static inline void __sn__Tensor_retain_into(const void *src, void *dst) { *(__sn__Tensor **)dst = __sn__Tensor_retain(*(__sn__Tensor *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Tensor_to_string(const __sn__Tensor *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Tensor { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tag: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__tag);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "data: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__data);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+/* Struct: GraphTensors (as val) */
+typedef struct {
+    __sn__Tensor * __sn__nodeFeatures;
+    __sn__Tensor * __sn__edgeIndex;
+    __sn__Tensor * __sn__edgeWeight;
+    __sn__Tensor * __sn__batchIndex;
+    long long __sn__numNodes;
+} __sn__GraphTensors;
+/* Value operations */
+static inline __sn__GraphTensors __sn__GraphTensors_copy(const __sn__GraphTensors *src) {
+    __sn__GraphTensors dst;
+    dst.__sn__nodeFeatures = __sn__Tensor_retain(src->__sn__nodeFeatures);
+    dst.__sn__edgeIndex = __sn__Tensor_retain(src->__sn__edgeIndex);
+    dst.__sn__edgeWeight = __sn__Tensor_retain(src->__sn__edgeWeight);
+    dst.__sn__batchIndex = __sn__Tensor_retain(src->__sn__batchIndex);
+    dst.__sn__numNodes = src->__sn__numNodes;
+    return dst;
+}
+
+static inline void __sn__GraphTensors_cleanup(__sn__GraphTensors *p) {
+    __sn__Tensor_release(&p->__sn__nodeFeatures);
+    __sn__Tensor_release(&p->__sn__edgeIndex);
+    __sn__Tensor_release(&p->__sn__edgeWeight);
+    __sn__Tensor_release(&p->__sn__batchIndex);
+
+}
+
+#define sn_auto_GraphTensors __attribute__((cleanup(__sn__GraphTensors_cleanup)))
+
+static inline void __sn__GraphTensors_cleanup_elem(void *p) { __sn__GraphTensors_cleanup((__sn__GraphTensors *)p); }
+static inline void __sn__GraphTensors_copy_into(const void *src, void *dst) { *(__sn__GraphTensors *)dst = __sn__GraphTensors_copy((const __sn__GraphTensors *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__GraphTensors *__sn__GraphTensors_alloc(void) {
+    return calloc(1, sizeof(__sn__GraphTensors));
+}
+
+static inline void __sn__GraphTensors_release(__sn__GraphTensors **p) {
+    if (*p) {
+        __sn__Tensor_release(&(*p)->__sn__nodeFeatures);
+        __sn__Tensor_release(&(*p)->__sn__edgeIndex);
+        __sn__Tensor_release(&(*p)->__sn__edgeWeight);
+        __sn__Tensor_release(&(*p)->__sn__batchIndex);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_GraphTensors __attribute__((cleanup(__sn__GraphTensors_release)))
+
+static inline void __sn__GraphTensors_release_elem(void *p) { __sn__GraphTensors_release((__sn__GraphTensors **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__GraphTensors_to_string(const __sn__GraphTensors *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "GraphTensors { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "nodeFeatures: ");
+    { char *__fs__ = __sn__Tensor_to_string(p->__sn__nodeFeatures); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "edgeIndex: ");
+    { char *__fs__ = __sn__Tensor_to_string(p->__sn__edgeIndex); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "edgeWeight: ");
+    { char *__fs__ = __sn__Tensor_to_string(p->__sn__edgeWeight); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "batchIndex: ");
+    { char *__fs__ = __sn__Tensor_to_string(p->__sn__batchIndex); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "numNodes: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__numNodes);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Tensor * __sn__makeTensor(long long, long long);
+__sn__GraphTensors __sn__graphToTensors(long long);
+long long __sn__aggregate(__sn__Tensor *, long long);
+long long __sn__gcnForward(__sn__GraphTensors *, long long);
+long long __sn__forward(__sn__GraphTensors *);
+
+
+
+
+#endif
@@ -0,0 +1,113 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Container __sn__make_container() {
+
+    sn_auto_Handle __sn__Handle * __sn__a = ({
+        __sn__Handle *__tmp__ = __sn__Handle__new();
+        __tmp__->__sn__tag = 10LL;
+        __tmp__->__sn__payload = 100LL;
+        __tmp__;
+    });
+
+    sn_auto_Handle __sn__Handle * __sn__b = ({
+        __sn__Handle *__tmp__ = __sn__Handle__new();
+        __tmp__->__sn__tag = 20LL;
+        __tmp__->__sn__payload = 200LL;
+        __tmp__;
+    });
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Inside: a.tag=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__a->__sn__tag));
+            sn_auto_str char *__is_p2__ = sn_strdup(", a.payload=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__a->__sn__payload));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Inside: b.tag=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__b->__sn__tag));
+            sn_auto_str char *__is_p2__ = sn_strdup(", b.payload=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__b->__sn__payload));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    return (__sn__Container){ .__sn__h1 = __sn__Handle_retain(__sn__a), .__sn__h2 = __sn__Handle_retain(__sn__b) };}
+
+
+
+int main() {
+    sn_auto_Handle __sn__Handle * __sn__h = ({
+        __sn__Handle *__tmp__ = __sn__Handle__new();
+        __tmp__->__sn__tag = 1LL;
+        __tmp__->__sn__payload = 2LL;
+        __tmp__;
+    });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Direct: tag=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__h->__sn__tag));
+            sn_auto_str char *__is_p2__ = sn_strdup(", payload=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__h->__sn__payload));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Handle __sn__Handle * __sn__x = ({
+        __sn__Handle *__tmp__ = __sn__Handle__new();
+        __tmp__->__sn__tag = 30LL;
+        __tmp__->__sn__payload = 300LL;
+        __tmp__;
+    });
+    sn_auto_Handle __sn__Handle * __sn__y = ({
+        __sn__Handle *__tmp__ = __sn__Handle__new();
+        __tmp__->__sn__tag = 40LL;
+        __tmp__->__sn__payload = 400LL;
+        __tmp__;
+    });
+    sn_auto_Container __sn__Container __sn__local = (__sn__Container){ .__sn__h1 = __sn__Handle_retain(__sn__x), .__sn__h2 = __sn__Handle_retain(__sn__y) };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Local h1: tag=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__local.__sn__h1->__sn__tag));
+            sn_auto_str char *__is_p2__ = sn_strdup(", payload=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__local.__sn__h1->__sn__payload));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Local h2: tag=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__local.__sn__h2->__sn__tag));
+            sn_auto_str char *__is_p2__ = sn_strdup(", payload=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__local.__sn__h2->__sn__payload));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Container __sn__Container __sn__c = __sn__make_container();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Returned h1: tag=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__h1->__sn__tag));
+            sn_auto_str char *__is_p2__ = sn_strdup(", payload=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__h1->__sn__payload));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Returned h2: tag=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__h2->__sn__tag));
+            sn_auto_str char *__is_p2__ = sn_strdup(", payload=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__h2->__sn__payload));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,135 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Handle (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__tag;
+    long long __sn__payload;
+} __sn__Handle;
+
+
+static inline __sn__Handle *__sn__Handle__new(void) {
+    __sn__Handle *p = calloc(1, sizeof(__sn__Handle));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Handle *__sn__Handle_retain(__sn__Handle *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Handle_release(__sn__Handle **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Handle *__sn__Handle_copy(const __sn__Handle *src) {
+    __sn__Handle *dst = calloc(1, sizeof(__sn__Handle));
+    dst->__rc__ = 1;
+    dst->__sn__tag = src->__sn__tag;
+    dst->__sn__payload = src->__sn__payload;
+    return dst;
+}
+
+#define sn_auto_Handle __attribute__((cleanup(__sn__Handle_release)))
+#define sn_auto_ref_Handle __attribute__((cleanup(__sn__Handle_release)))
+
+static inline void __sn__Handle_release_elem(void *p) { __sn__Handle_release((__sn__Handle **)p); }
+static inline void __sn__Handle_retain_into(const void *src, void *dst) { *(__sn__Handle **)dst = __sn__Handle_retain(*(__sn__Handle *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Handle_to_string(const __sn__Handle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Handle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tag: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__tag);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "payload: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__payload);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+/* Struct: Container (as val) */
+typedef struct {
+    __sn__Handle * __sn__h1;
+    __sn__Handle * __sn__h2;
+} __sn__Container;
+/* Value operations */
+static inline __sn__Container __sn__Container_copy(const __sn__Container *src) {
+    __sn__Container dst;
+    dst.__sn__h1 = __sn__Handle_retain(src->__sn__h1);
+    dst.__sn__h2 = __sn__Handle_retain(src->__sn__h2);
+    return dst;
+}
+
+static inline void __sn__Container_cleanup(__sn__Container *p) {
+    __sn__Handle_release(&p->__sn__h1);
+    __sn__Handle_release(&p->__sn__h2);
+
+}
+
+#define sn_auto_Container __attribute__((cleanup(__sn__Container_cleanup)))
+
+static inline void __sn__Container_cleanup_elem(void *p) { __sn__Container_cleanup((__sn__Container *)p); }
+static inline void __sn__Container_copy_into(const void *src, void *dst) { *(__sn__Container *)dst = __sn__Container_copy((const __sn__Container *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Container *__sn__Container_alloc(void) {
+    return calloc(1, sizeof(__sn__Container));
+}
+
+static inline void __sn__Container_release(__sn__Container **p) {
+    if (*p) {
+        __sn__Handle_release(&(*p)->__sn__h1);
+        __sn__Handle_release(&(*p)->__sn__h2);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Container __attribute__((cleanup(__sn__Container_release)))
+
+static inline void __sn__Container_release_elem(void *p) { __sn__Container_release((__sn__Container **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Container_to_string(const __sn__Container *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Container { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "h1: ");
+    { char *__fs__ = __sn__Handle_to_string(p->__sn__h1); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "h2: ");
+    { char *__fs__ = __sn__Handle_to_string(p->__sn__h2); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Container __sn__make_container();
+
+
+
+
+#endif
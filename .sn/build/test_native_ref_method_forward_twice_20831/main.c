@@ -0,0 +1,123 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__useForward(__sn__Model *__sn__model) {
+
+    sn_auto_Output __sn__Output __sn__out = __sn__Model_forward(&(*__sn__model));
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("forward: a=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__out.__sn__a)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" b=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__out.__sn__b)));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+}
+
+
+void __sn__useForwardSafe(__sn__Model *__sn__model) {
+
+    sn_auto_Output __sn__Output __sn__out = __sn__Model_forwardSafe(&(*__sn__model));
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("safe: a=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__out.__sn__a)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" b=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__out.__sn__b)));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+}
+
+
+long long __sn__Handle_value(__sn__Handle *__sn__self) {
+
+    return __sn__self->__sn___id;}
+
+
+
+__sn__Output __sn__Model_forward(__sn__Model *__sn__self) {
+
+    return (__sn__Output){ .__sn__a = __sn__Handle_retain(__sn__self->__sn__w1), .__sn__b = __sn__Handle_retain(__sn__self->__sn__w2) };}
+
+__sn__Output __sn__Model_forwardSafe(__sn__Model *__sn__self) {
+
+    sn_auto_Handle __sn__Handle * __sn__h1 = __sn__Handle_retain(__sn__self->__sn__w1);
+
+    sn_auto_Handle __sn__Handle * __sn__h2 = __sn__Handle_retain(__sn__self->__sn__w2);
+
+    return (__sn__Output){ .__sn__a = __sn__Handle_retain(__sn__h1), .__sn__b = __sn__Handle_retain(__sn__h2) };}
+
+int main() {
+    sn_auto_Model __sn__Model __sn__m1 = (__sn__Model){ .__sn__w1 = ({
+        __sn__Handle *__tmp__ = __sn__Handle__new();
+        __tmp__->__sn___id = 10LL;
+        __tmp__;
+    }), .__sn__w2 = ({
+        __sn__Handle *__tmp__ = __sn__Handle__new();
+        __tmp__->__sn___id = 20LL;
+        __tmp__;
+    }) };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test1 model: w1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__m1.__sn__w1)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" w2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__m1.__sn__w2)));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    __sn__useForwardSafe(&__sn__m1);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test1 after: w1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__m1.__sn__w1)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" w2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__m1.__sn__w2)));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Model __sn__Model __sn__m2 = (__sn__Model){ .__sn__w1 = ({
+        __sn__Handle *__tmp__ = __sn__Handle__new();
+        __tmp__->__sn___id = 30LL;
+        __tmp__;
+    }), .__sn__w2 = ({
+        __sn__Handle *__tmp__ = __sn__Handle__new();
+        __tmp__->__sn___id = 40LL;
+        __tmp__;
+    }) };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test2 model: w1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__m2.__sn__w1)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" w2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__m2.__sn__w2)));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    __sn__useForward(&__sn__m2);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test2 after: w1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__m2.__sn__w1)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" w2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__m2.__sn__w2)));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    __sn__useForward(&__sn__m2);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("test3 after: w1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__m2.__sn__w1)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" w2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__Handle_value(__sn__m2.__sn__w2)));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    sn_println("PASS");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,191 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Handle (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn___id;
+} __sn__Handle;
+
+
+static inline __sn__Handle *__sn__Handle__new(void) {
+    __sn__Handle *p = calloc(1, sizeof(__sn__Handle));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Handle *__sn__Handle_retain(__sn__Handle *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Handle_release(__sn__Handle **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Handle *__sn__Handle_copy(const __sn__Handle *src) {
+    __sn__Handle *dst = calloc(1, sizeof(__sn__Handle));
+    dst->__rc__ = 1;
+    dst->__sn___id = src->__sn___id;
+    return dst;
+}
+
+#define sn_auto_Handle __attribute__((cleanup(__sn__Handle_release)))
+#define sn_auto_ref_Handle __attribute__((cleanup(__sn__Handle_release)))
+
+static inline void __sn__Handle_release_elem(void *p) { __sn__Handle_release((__sn__Handle **)p); }
+static inline void __sn__Handle_retain_into(const void *src, void *dst) { *(__sn__Handle **)dst = __sn__Handle_retain(*(__sn__Handle *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Handle_to_string(const __sn__Handle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Handle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___id);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+/* Struct: Output (as val) */
+typedef struct {
+    __sn__Handle * __sn__a;
+    __sn__Handle * __sn__b;
+} __sn__Output;
+/* Value operations */
+static inline __sn__Output __sn__Output_copy(const __sn__Output *src) {
+    __sn__Output dst;
+    dst.__sn__a = __sn__Handle_retain(src->__sn__a);
+    dst.__sn__b = __sn__Handle_retain(src->__sn__b);
+    return dst;
+}
+
+static inline void __sn__Output_cleanup(__sn__Output *p) {
+    __sn__Handle_release(&p->__sn__a);
+    __sn__Handle_release(&p->__sn__b);
+
+}
+
+#define sn_auto_Output __attribute__((cleanup(__sn__Output_cleanup)))
+
+static inline void __sn__Output_cleanup_elem(void *p) { __sn__Output_cleanup((__sn__Output *)p); }
+static inline void __sn__Output_copy_into(const void *src, void *dst) { *(__sn__Output *)dst = __sn__Output_copy((const __sn__Output *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Output *__sn__Output_alloc(void) {
+    return calloc(1, sizeof(__sn__Output));
+}
+
+static inline void __sn__Output_release(__sn__Output **p) {
+    if (*p) {
+        __sn__Handle_release(&(*p)->__sn__a);
+        __sn__Handle_release(&(*p)->__sn__b);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Output __attribute__((cleanup(__sn__Output_release)))
+
+static inline void __sn__Output_release_elem(void *p) { __sn__Output_release((__sn__Output **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Output_to_string(const __sn__Output *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Output { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a: ");
+    { char *__fs__ = __sn__Handle_to_string(p->__sn__a); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b: ");
+    { char *__fs__ = __sn__Handle_to_string(p->__sn__b); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Model (as val) */
+typedef struct {
+    __sn__Handle * __sn__w1;
+    __sn__Handle * __sn__w2;
+} __sn__Model;
+/* Value operations */
+static inline __sn__Model __sn__Model_copy(const __sn__Model *src) {
+    __sn__Model dst;
+    dst.__sn__w1 = __sn__Handle_retain(src->__sn__w1);
+    dst.__sn__w2 = __sn__Handle_retain(src->__sn__w2);
+    return dst;
+}
+
+static inline void __sn__Model_cleanup(__sn__Model *p) {
+    __sn__Handle_release(&p->__sn__w1);
+    __sn__Handle_release(&p->__sn__w2);
+
+}
+
+#define sn_auto_Model __attribute__((cleanup(__sn__Model_cleanup)))
+
+static inline void __sn__Model_cleanup_elem(void *p) { __sn__Model_cleanup((__sn__Model *)p); }
+static inline void __sn__Model_copy_into(const void *src, void *dst) { *(__sn__Model *)dst = __sn__Model_copy((const __sn__Model *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Model *__sn__Model_alloc(void) {
+    return calloc(1, sizeof(__sn__Model));
+}
+
+static inline void __sn__Model_release(__sn__Model **p) {
+    if (*p) {
+        __sn__Handle_release(&(*p)->__sn__w1);
+        __sn__Handle_release(&(*p)->__sn__w2);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Model __attribute__((cleanup(__sn__Model_release)))
+
+static inline void __sn__Model_release_elem(void *p) { __sn__Model_release((__sn__Model **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Model_to_string(const __sn__Model *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Model { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "w1: ");
+    { char *__fs__ = __sn__Handle_to_string(p->__sn__w1); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "w2: ");
+    { char *__fs__ = __sn__Handle_to_string(p->__sn__w2); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__useForward(__sn__Model *);
+void __sn__useForwardSafe(__sn__Model *);
+
+long long __sn__Handle_value(__sn__Handle *);
+__sn__Output __sn__Model_forward(__sn__Model *);
+__sn__Output __sn__Model_forwardSafe(__sn__Model *);
+
+
+
+#endif
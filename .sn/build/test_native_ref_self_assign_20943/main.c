@@ -0,0 +1,48 @@
+#include "sn_types.h"
+__sn__Tensor * tensor_create(long long);
+__sn__Tensor * tensor_register(__sn__Tensor *);
+long long tensor_get_handle(__sn__Tensor *);
+long long tensor_check_alive(__sn__Tensor *);
+
+
+
+
+int main() {
+    sn_auto_Tensor __sn__Tensor * __sn__bias = tensor_create(42LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("before: handle=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tensor_get_handle(__sn__bias)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    ({
+        __sn__Tensor *__old__ = __sn__bias;
+        __sn__bias = ({
+        __sn__Tensor *__bi_snap_0__ = __sn__bias;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__Tensor *__bi_result__ = tensor_register(__sn__bias);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__Tensor_retain(__bi_result__);
+        __bi_result__;
+    });
+        __sn__Tensor_release(&__old__);
+        __sn__bias;
+    });
+    
+    long long __sn__alive = tensor_check_alive(__sn__bias);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("alive: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__alive));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("after: handle=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tensor_get_handle(__sn__bias)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_println("PASS");
+    
+    fflush(stdout);
+    return 0;
+}
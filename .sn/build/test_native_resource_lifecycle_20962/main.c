@@ -0,0 +1,214 @@
+#include "sn_types.h"
+__sn__MockListener * mock_listener_bind(char *);
+__sn__MockStream * mock_listener_accept(__sn__MockListener *);
+long long mock_listener_get_port(__sn__MockListener *);
+void mock_listener_close(__sn__MockListener *);
+void mock_stream_write(__sn__MockStream *, char *);
+char * mock_stream_read(__sn__MockStream *);
+char * mock_stream_get_remote_addr(__sn__MockStream *);
+void mock_stream_close(__sn__MockStream *);
+
+
+
+
+void __sn__test_basic_lifecycle() {
+
+    sn_print("Test 1: Basic listener + stream lifecycle\n");
+    
+
+    sn_auto_MockListener __sn__MockListener * __sn__listener = __sn__MockListener_bind("127.0.0.1:0");
+
+    long long __sn__port = __sn__MockListener_port(__sn__listener);
+
+    sn_assert(sn_gt_long(__sn__port, 0LL), "port should be assigned");
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Bound on port ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__port));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    sn_auto_MockStream __sn__MockStream * __sn__stream = __sn__MockListener_accept(__sn__listener);
+
+    __sn__MockStream_write(__sn__stream, "hello world");
+    
+
+    sn_auto_str char * __sn__data = __sn__MockStream_read(__sn__stream);
+
+    sn_assert((strcmp(__sn__data, "hello world") == 0), "should read what was written");
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Read: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__data);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    sn_auto_str char * __sn__addr = __sn__MockStream_remoteAddress(__sn__stream);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Remote: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__addr);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    __sn__MockStream_close(__sn__stream);
+    
+
+    __sn__MockListener_close(__sn__listener);
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_using_blocks() {
+
+    sn_print("Test 2: Using blocks for scoped cleanup\n");
+    
+
+    {
+        sn_auto_MockListener __sn__MockListener * __sn__listener = __sn__MockListener_bind("127.0.0.1:0");
+    {
+        long long __sn__port = __sn__MockListener_port(__sn__listener);
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  Bound on port ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__port));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        {
+            sn_auto_MockStream __sn__MockStream * __sn__stream = __sn__MockListener_accept(__sn__listener);
+        {
+            __sn__MockStream_write(__sn__stream, "scoped data");
+            
+            sn_auto_str char * __sn__data = __sn__MockStream_read(__sn__stream);
+            sn_assert((strcmp(__sn__data, "scoped data") == 0), "should read scoped data");
+            
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("  Read: ");
+                    sn_auto_str char *__is_p1__ = sn_strdup(__sn__data);
+                    sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                    sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                }); sn_print(__ps__); };
+            
+        }
+            __sn__MockStream_dispose(__sn__stream);
+        }
+    }
+        __sn__MockListener_dispose(__sn__listener);
+    }
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__test_auto_cleanup() {
+
+    sn_print("Test 3: Auto cleanup on scope exit\n");
+    
+
+    sn_auto_MockListener __sn__MockListener * __sn__listener = __sn__MockListener_bind("127.0.0.1:0");
+
+    sn_auto_MockStream __sn__MockStream * __sn__stream = __sn__MockListener_accept(__sn__listener);
+
+    __sn__MockStream_write(__sn__stream, "auto cleanup test");
+    
+
+    sn_auto_str char * __sn__data = __sn__MockStream_read(__sn__stream);
+
+    sn_assert((strcmp(__sn__data, "auto cleanup test") == 0), "read back data");
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Read: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__data);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    sn_print("  PASS\n");
+    
+}
+
+
+void __sn__MockStream_write(__sn__MockStream *__sn__self, char * __sn__data) {
+
+    mock_stream_write(__sn__self, __sn__data);
+    
+}
+
+char * __sn__MockStream_read(__sn__MockStream *__sn__self) {
+
+    return mock_stream_read(__sn__self);}
+
+char * __sn__MockStream_remoteAddress(__sn__MockStream *__sn__self) {
+
+    return mock_stream_get_remote_addr(__sn__self);}
+
+void __sn__MockStream_close(__sn__MockStream *__sn__self) {
+
+    mock_stream_close(__sn__self);
+    
+}
+
+void __sn__MockStream_dispose(__sn__MockStream *__sn__self) {
+
+    mock_stream_close(__sn__self);
+    
+}
+
+
+__sn__MockListener * __sn__MockListener_bind(char * __sn__address) {
+
+    return mock_listener_bind(__sn__address);}
+
+__sn__MockStream * __sn__MockListener_accept(__sn__MockListener *__sn__self) {
+
+    return mock_listener_accept(__sn__self);}
+
+long long __sn__MockListener_port(__sn__MockListener *__sn__self) {
+
+    return mock_listener_get_port(__sn__self);}
+
+void __sn__MockListener_close(__sn__MockListener *__sn__self) {
+
+    mock_listener_close(__sn__self);
+    
+}
+
+void __sn__MockListener_dispose(__sn__MockListener *__sn__self) {
+
+    mock_listener_close(__sn__self);
+    
+}
+
+int main() {
+    sn_print("=== Native Resource Lifecycle Tests (Codegen 3) ===\n\n");
+    
+    __sn__test_basic_lifecycle();
+    
+    sn_print("\n");
+    
+    __sn__test_using_blocks();
+    
+    sn_print("\n");
+    
+    __sn__test_auto_cleanup();
+    
+    sn_print("\nAll tests passed.\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,110 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: MockStream (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    char * remote_addr;
+    unsigned char * buffer;
+    long long capacity;
+    long long length;
+    int32_t is_open;
+} __sn__MockStream;
+
+
+static inline __sn__MockStream *__sn__MockStream__new(void) {
+    __sn__MockStream *p = calloc(1, sizeof(__sn__MockStream));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__MockStream *__sn__MockStream_retain(__sn__MockStream *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__MockStream_release(__sn__MockStream **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free((*p)->remote_addr);
+        free((*p)->buffer);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_MockStream __attribute__((cleanup(__sn__MockStream_release)))
+#define sn_auto_ref_MockStream __attribute__((cleanup(__sn__MockStream_release)))
+
+static inline void __sn__MockStream_release_elem(void *p) { __sn__MockStream_release((__sn__MockStream **)p); }
+static inline void __sn__MockStream_retain_into(const void *src, void *dst) { *(__sn__MockStream **)dst = __sn__MockStream_retain(*(__sn__MockStream *const *)src); }
+
+/* Struct: MockListener (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    char * address;
+    long long port;
+    int32_t is_bound;
+} __sn__MockListener;
+
+
+static inline __sn__MockListener *__sn__MockListener__new(void) {
+    __sn__MockListener *p = calloc(1, sizeof(__sn__MockListener));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__MockListener *__sn__MockListener_retain(__sn__MockListener *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__MockListener_release(__sn__MockListener **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free((*p)->address);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_MockListener __attribute__((cleanup(__sn__MockListener_release)))
+#define sn_auto_ref_MockListener __attribute__((cleanup(__sn__MockListener_release)))
+
+static inline void __sn__MockListener_release_elem(void *p) { __sn__MockListener_release((__sn__MockListener **)p); }
+static inline void __sn__MockListener_retain_into(const void *src, void *dst) { *(__sn__MockListener **)dst = __sn__MockListener_retain(*(__sn__MockListener *const *)src); }
+
+
+void __sn__test_basic_lifecycle();
+void __sn__test_using_blocks();
+void __sn__test_auto_cleanup();
+
+void __sn__MockStream_write(__sn__MockStream *, char *);
+char * __sn__MockStream_read(__sn__MockStream *);
+char * __sn__MockStream_remoteAddress(__sn__MockStream *);
+void __sn__MockStream_close(__sn__MockStream *);
+void __sn__MockStream_dispose(__sn__MockStream *);
+__sn__MockListener * __sn__MockListener_bind(char *);
+__sn__MockStream * __sn__MockListener_accept(__sn__MockListener *);
+long long __sn__MockListener_port(__sn__MockListener *);
+void __sn__MockListener_close(__sn__MockListener *);
+void __sn__MockListener_dispose(__sn__MockListener *);
+
+
+
+#endif
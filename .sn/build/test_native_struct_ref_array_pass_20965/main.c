@@ -0,0 +1,72 @@
+#include "sn_types.h"
+long long verify_widget_array(SnArray *, long long);
+long long verify_single_widget(__sn__Widget *, long long);
+
+
+
+long long run_test() {
+
+    sn_auto_Widget __sn__Widget * __sn__w1 = ({
+        __sn__Widget *__tmp__ = __sn__Widget__new();
+        __tmp__->__sn__id = 1LL;
+        __tmp__->__sn__value = 10LL;
+        __tmp__;
+    });
+
+    sn_auto_Widget __sn__Widget * __sn__w2 = ({
+        __sn__Widget *__tmp__ = __sn__Widget__new();
+        __tmp__->__sn__id = 2LL;
+        __tmp__->__sn__value = 20LL;
+        __tmp__;
+    });
+
+    sn_auto_Widget __sn__Widget * __sn__w3 = ({
+        __sn__Widget *__tmp__ = __sn__Widget__new();
+        __tmp__->__sn__id = 3LL;
+        __tmp__->__sn__value = 30LL;
+        __tmp__;
+    });
+
+    sn_auto_arr SnArray * __sn__widgets = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Widget *), 3);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Widget_release_elem;
+            __al__->elem_copy = __sn__Widget_retain_into;
+            sn_array_push(__al__, &(__sn__Widget *){ __sn__Widget_retain(__sn__w1) });
+            sn_array_push(__al__, &(__sn__Widget *){ __sn__Widget_retain(__sn__w2) });
+            sn_array_push(__al__, &(__sn__Widget *){ __sn__Widget_retain(__sn__w3) });
+            __al__;
+        });
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sindarin count: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__widgets)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+
+    long long __sn__single_ok = verify_single_widget(__sn__w1, 1LL);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("single pass: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__single_ok));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+
+    long long __sn__array_ok = verify_widget_array(__sn__widgets, 3LL);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("array pass: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__array_ok));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+
+    return 0LL;}
+
+
+int main() {
+    return run_test();    fflush(stdout);
+}
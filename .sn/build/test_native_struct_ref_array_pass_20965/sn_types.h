@@ -0,0 +1,58 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Widget (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__id;
+    long long __sn__value;
+} __sn__Widget;
+
+
+static inline __sn__Widget *__sn__Widget__new(void) {
+    __sn__Widget *p = calloc(1, sizeof(__sn__Widget));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Widget *__sn__Widget_retain(__sn__Widget *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Widget_release(__sn__Widget **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Widget __attribute__((cleanup(__sn__Widget_release)))
+#define sn_auto_ref_Widget __attribute__((cleanup(__sn__Widget_release)))
+
+static inline void __sn__Widget_release_elem(void *p) { __sn__Widget_release((__sn__Widget **)p); }
+static inline void __sn__Widget_retain_into(const void *src, void *dst) { *(__sn__Widget **)dst = __sn__Widget_retain(*(__sn__Widget *const *)src); }
+
+
+long long run_test();
+
+
+
+
+#endif
@@ -0,0 +1,140 @@
+#include "sn_types.h"
+__sn__Handle * handle_create(long long);
+
+
+
+
+void __sn__test_basic() {
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            sn_auto_Handle __sn__Handle * __sn__a = __sn__Handle_create(sn_mul_long(__sn__i, 4LL));
+            sn_auto_Handle __sn__Handle * __sn__b = __sn__Handle_create(sn_add_long(sn_mul_long(__sn__i, 4LL), 1LL));
+            sn_auto_Handle __sn__Handle * __sn__c = __sn__Handle_create(sn_add_long(sn_mul_long(__sn__i, 4LL), 2LL));
+            sn_auto_Handle __sn__Handle * __sn__d = __sn__Handle_create(sn_add_long(sn_mul_long(__sn__i, 4LL), 3LL));
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("basic ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": a=");
+                    sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__a->__sn___id));
+                    sn_auto_str char *__is_p4__ = sn_strdup(" b=");
+                    sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__b->__sn___id));
+                    sn_auto_str char *__is_p6__ = sn_strdup(" c=");
+                    sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__c->__sn___id));
+                    sn_auto_str char *__is_p8__ = sn_strdup(" d=");
+                    sn_auto_str char *__is_p9__ = sn_str_fmt("%lld", (long long)(__sn__d->__sn___id));
+                    sn_str_concat_multi(10, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__, __is_p9__);
+                }); sn_println(__ps__); };
+            
+        }
+    }
+
+    sn_println("test_basic: PASS");
+    
+}
+
+
+void __sn__test_shared_handle() {
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            sn_auto_Handle __sn__Handle * __sn__h = __sn__Handle_create(sn_mul_long(__sn__i, 100LL));
+            sn_auto_Handle __sn__Handle * __sn__a = __sn__Handle_retain(__sn__h);
+            sn_auto_Handle __sn__Handle * __sn__b = __sn__Handle_retain(__sn__h);
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("shared ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": h=");
+                    sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__h->__sn___id));
+                    sn_auto_str char *__is_p4__ = sn_strdup(" a=");
+                    sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__a->__sn___id));
+                    sn_auto_str char *__is_p6__ = sn_strdup(" b=");
+                    sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__b->__sn___id));
+                    sn_str_concat_multi(8, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__);
+                }); sn_println(__ps__); };
+            
+        }
+    }
+
+    sn_println("test_shared_handle: PASS");
+    
+}
+
+
+__sn__Handle * __sn__transform(__sn__Handle * __sn__input) {
+
+    sn_auto_Handle __sn__Handle * __sn__local = __sn__Handle_retain(__sn__input);
+
+    return __sn__Handle_create(sn_mul_long(__sn__local->__sn___id, 10LL));}
+
+
+void __sn__test_cross_scope() {
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            sn_auto_Handle __sn__Handle * __sn__h = __sn__Handle_create(sn_add_long(__sn__i, 1LL));
+            sn_auto_Handle __sn__Handle * __sn__r = __sn__transform(__sn__h);
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("cross ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": h=");
+                    sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__h->__sn___id));
+                    sn_auto_str char *__is_p4__ = sn_strdup(" r=");
+                    sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__r->__sn___id));
+                    sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+                }); sn_println(__ps__); };
+            
+        }
+    }
+
+    sn_println("test_cross_scope: PASS");
+    
+}
+
+
+void __sn__test_reassign() {
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            sn_auto_Handle __sn__Handle * __sn__h = __sn__Handle_create(__sn__i);
+            ({
+                __sn__Handle *__old__ = __sn__h;
+                __sn__h = __sn__Handle_create(sn_add_long(__sn__i, 100LL));
+                __sn__Handle_release(&__old__);
+                __sn__h;
+            });
+            
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("reassign ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": h=");
+                    sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__h->__sn___id));
+                    sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                }); sn_println(__ps__); };
+            
+        }
+    }
+
+    sn_println("test_reassign: PASS");
+    
+}
+
+
+__sn__Handle * __sn__Handle_create(long long __sn__id) {
+
+    return handle_create(__sn__id);}
+
+int main() {
+    __sn__test_basic();
+    
+    __sn__test_shared_handle();
+    
+    __sn__test_cross_scope();
+    
+    __sn__test_reassign();
+    
+    sn_println("done");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Handle (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn___id;
+} __sn__Handle;
+
+
+static inline __sn__Handle *__sn__Handle__new(void) {
+    __sn__Handle *p = calloc(1, sizeof(__sn__Handle));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Handle *__sn__Handle_retain(__sn__Handle *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Handle_release(__sn__Handle **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Handle __attribute__((cleanup(__sn__Handle_release)))
+#define sn_auto_ref_Handle __attribute__((cleanup(__sn__Handle_release)))
+
+static inline void __sn__Handle_release_elem(void *p) { __sn__Handle_release((__sn__Handle **)p); }
+static inline void __sn__Handle_retain_into(const void *src, void *dst) { *(__sn__Handle **)dst = __sn__Handle_retain(*(__sn__Handle *const *)src); }
+
+
+void __sn__test_basic();
+void __sn__test_shared_handle();
+__sn__Handle * __sn__transform(__sn__Handle *);
+void __sn__test_cross_scope();
+void __sn__test_reassign();
+
+__sn__Handle * __sn__Handle_create(long long);
+
+
+
+#endif
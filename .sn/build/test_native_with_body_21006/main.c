@@ -0,0 +1,60 @@
+#include "sn_types.h"
+
+
+
+long long my_abs(long long __sn__x) {
+
+    if (sn_lt_long(__sn__x, 0LL)) {
+        return (-__sn__x);}
+
+    return __sn__x;}
+
+long long clamp(long long __sn__value, long long __sn__min_v, long long __sn__max_v) {
+
+    if (sn_lt_long(__sn__value, __sn__min_v)) {
+        return __sn__min_v;}
+
+    if (sn_gt_long(__sn__value, __sn__max_v)) {
+        return __sn__max_v;}
+
+    return __sn__value;}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("my_abs(-5) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(my_abs((-5LL))));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("my_abs(5) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(my_abs(5LL)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("my_abs(0) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(my_abs(0LL)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("clamp(-10, 0, 100) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(clamp((-10LL), 0LL, 100LL)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("clamp(50, 0, 100) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(clamp(50LL, 0LL, 100LL)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("clamp(150, 0, 100) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(clamp(150LL, 0LL, 100LL)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
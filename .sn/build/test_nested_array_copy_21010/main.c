@@ -0,0 +1,73 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__grid = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            __al__;
+        }) });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__copy = __sn__arr_clone(&__sn__grid);
+    ((long long *)(((SnArray * *)__sn__copy->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__copy->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->len : __ai__; })] = 999LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })])));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })])));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })])));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })])));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__copy->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__copy->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__copy->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__copy->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->len : __ai__; })])));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__copy->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__copy->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->len : __ai__; })])));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__copy->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__copy->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__copy->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__copy->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->len : __ai__; })])));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__copy->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__copy->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__copy->len : __ai__; })])->len : __ai__; })])));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
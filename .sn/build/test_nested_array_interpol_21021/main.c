@@ -0,0 +1,316 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__int_2d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 3);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 6LL });
+            __al__;
+        }) });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("int[][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__int_2d);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__double_2d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 2);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.5 });
+            sn_array_push(__al__, &(double){ 2.5 });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 1);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 3.5 });
+            __al__;
+        }) });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("double[][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__double_2d);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__str_2d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("hello") });
+            sn_array_push(__al__, &(char *){ strdup("world") });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 1);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("foo") });
+            __al__;
+        }) });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("str[][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__str_2d);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__bool_2d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 2);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 2);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        }) });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("bool[][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__bool_2d);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__char_2d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 2);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)97 });
+            sn_array_push(__al__, &(char){ (char)98 });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 3);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)99 });
+            sn_array_push(__al__, &(char){ (char)100 });
+            sn_array_push(__al__, &(char){ (char)101 });
+            __al__;
+        }) });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("char[][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__char_2d);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__b1 = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 2);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 1LL });
+            sn_array_push(__al__, &(unsigned char){ 2LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__b2 = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 2);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 255LL });
+            sn_array_push(__al__, &(unsigned char){ 128LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__byte_2d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ sn_array_copy(__sn__b1) });
+            sn_array_push(__al__, &(SnArray *){ sn_array_copy(__sn__b2) });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("byte[][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__byte_2d);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__empty_2d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 0);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("empty: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__empty_2d);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__with_empty = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 3);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+    
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        }) });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("with_empty: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__with_empty);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__single = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 42LL });
+            __al__;
+        }) });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("single: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__single);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__matrix = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        }) });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("matrix[0][0]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__matrix->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__matrix->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__matrix->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__matrix->len : __ai__; })])->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("matrix[1][1]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__matrix->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__matrix->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__matrix->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__matrix->len : __ai__; })])->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
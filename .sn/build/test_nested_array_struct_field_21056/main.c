@@ -0,0 +1,111 @@
+#include "sn_types.h"
+
+
+
+
+__sn__CsvTable __sn__CsvTable_create() {
+
+    return (__sn__CsvTable){ .__sn__rows = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 0);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            __al__;
+        }), .__sn__cursor = 0LL };}
+
+void __sn__CsvTable_load(__sn__CsvTable *__sn__self) {
+
+    sn_auto_str char * __sn__line1 = strdup("a,b,c");
+
+    sn_auto_str char * __sn__line2 = strdup("d,e,f");
+
+    sn_auto_str char * __sn__line3 = strdup("g,h,i");
+
+    SnArray * __sn____chain_tmp_0 = __sn___split(&__sn__line1, ",");
+
+    __sn__arr_push(&__sn__self->__sn__rows, __sn____chain_tmp_0);
+    
+
+    SnArray * __sn____chain_tmp_1 = __sn___split(&__sn__line2, ",");
+
+    __sn__arr_push(&__sn__self->__sn__rows, __sn____chain_tmp_1);
+    
+
+    SnArray * __sn____chain_tmp_2 = __sn___split(&__sn__line3, ",");
+
+    __sn__arr_push(&__sn__self->__sn__rows, __sn____chain_tmp_2);
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("loaded ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__self->__sn__rows)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" rows");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_println(__ps__); };
+    
+}
+
+char * __sn__CsvTable_name(__sn__CsvTable *__sn__self) {
+
+    return strdup("csv");}
+
+SnArray * __sn__CsvTable_nextRow(__sn__CsvTable *__sn__self) {
+
+    if ((__sn__self->__sn__cursor >= sn_array_length(__sn__self->__sn__rows))) {
+        return ({
+                SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+        
+                __al__;
+            });}
+
+    sn_auto_arr SnArray * __sn__row = sn_array_copy((((SnArray * *)__sn__self->__sn__rows->data)[({ long long __ai__ = __sn__self->__sn__cursor; __ai__ < 0 ? __ai__ + __sn__self->__sn__rows->len : __ai__; })]));
+
+    (__sn__self->__sn__cursor = sn_add_long(__sn__self->__sn__cursor, 1LL));
+    
+
+    {
+        SnArray * __ret__ = __sn__row;
+        __sn__row = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_CsvTable __sn__CsvTable __sn__table = __sn__CsvTable_create();
+    __sn__CsvTable_load(&__sn__table);
+    
+    { sn_auto_str char *__ps__ = __sn__CsvTable_name(&__sn__table); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__row1 = __sn__CsvTable_nextRow(&__sn__table);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((((char * *)__sn__row1->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__row1->len : __ai__; })]));
+            sn_auto_str char *__is_p1__ = sn_strdup(",");
+            sn_auto_str char *__is_p2__ = sn_strdup((((char * *)__sn__row1->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__row1->len : __ai__; })]));
+            sn_auto_str char *__is_p3__ = sn_strdup(",");
+            sn_auto_str char *__is_p4__ = sn_strdup((((char * *)__sn__row1->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__row1->len : __ai__; })]));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__row2 = __sn__CsvTable_nextRow(&__sn__table);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((((char * *)__sn__row2->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__row2->len : __ai__; })]));
+            sn_auto_str char *__is_p1__ = sn_strdup(",");
+            sn_auto_str char *__is_p2__ = sn_strdup((((char * *)__sn__row2->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__row2->len : __ai__; })]));
+            sn_auto_str char *__is_p3__ = sn_strdup(",");
+            sn_auto_str char *__is_p4__ = sn_strdup((((char * *)__sn__row2->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__row2->len : __ai__; })]));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__row3 = __sn__CsvTable_nextRow(&__sn__table);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((((char * *)__sn__row3->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__row3->len : __ai__; })]));
+            sn_auto_str char *__is_p1__ = sn_strdup(",");
+            sn_auto_str char *__is_p2__ = sn_strdup((((char * *)__sn__row3->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__row3->len : __ai__; })]));
+            sn_auto_str char *__is_p3__ = sn_strdup(",");
+            sn_auto_str char *__is_p4__ = sn_strdup((((char * *)__sn__row3->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__row3->len : __ai__; })]));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
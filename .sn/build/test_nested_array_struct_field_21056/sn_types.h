@@ -0,0 +1,83 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: CsvTable (as val) */
+typedef struct {
+    SnArray * __sn__rows;
+    long long __sn__cursor;
+} __sn__CsvTable;
+/* Value operations */
+static inline __sn__CsvTable __sn__CsvTable_copy(const __sn__CsvTable *src) {
+    __sn__CsvTable dst;
+    dst.__sn__rows = sn_array_copy(src->__sn__rows);
+    dst.__sn__cursor = src->__sn__cursor;
+    return dst;
+}
+
+static inline void __sn__CsvTable_cleanup(__sn__CsvTable *p) {
+    sn_cleanup_array(&p->__sn__rows);
+
+}
+
+#define sn_auto_CsvTable __attribute__((cleanup(__sn__CsvTable_cleanup)))
+
+static inline void __sn__CsvTable_cleanup_elem(void *p) { __sn__CsvTable_cleanup((__sn__CsvTable *)p); }
+static inline void __sn__CsvTable_copy_into(const void *src, void *dst) { *(__sn__CsvTable *)dst = __sn__CsvTable_copy((const __sn__CsvTable *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__CsvTable *__sn__CsvTable_alloc(void) {
+    return calloc(1, sizeof(__sn__CsvTable));
+}
+
+static inline void __sn__CsvTable_release(__sn__CsvTable **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__rows);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_CsvTable __attribute__((cleanup(__sn__CsvTable_release)))
+
+static inline void __sn__CsvTable_release_elem(void *p) { __sn__CsvTable_release((__sn__CsvTable **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__CsvTable_to_string(const __sn__CsvTable *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "CsvTable { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "rows: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__rows); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "cursor: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__cursor);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+__sn__CsvTable __sn__CsvTable_create();
+void __sn__CsvTable_load(__sn__CsvTable *);
+char * __sn__CsvTable_name(__sn__CsvTable *);
+SnArray * __sn__CsvTable_nextRow(__sn__CsvTable *);
+
+
+
+#endif
@@ -0,0 +1,109 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 42LL;
+    sn_auto_str char * __sn__name = strdup("Alice");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Outer: ");
+            sn_auto_str char *__is_p1__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Inner: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Result: ");
+            sn_auto_str char *__is_p1__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Value: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_add_long(__sn__x, 1LL)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("L1: ");
+            sn_auto_str char *__is_p1__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("L2: ");
+            sn_auto_str char *__is_p1__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("L3: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("A");
+            sn_auto_str char *__is_p1__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("B");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+            sn_auto_str char *__is_p2__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("C");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+            sn_auto_str char *__is_p3__ = sn_strdup("D\n");
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hello: ");
+            sn_auto_str char *__is_p1__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__name);
+            sn_auto_str char *__is_p1__ = sn_strdup(" says hi");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Math: ");
+            sn_auto_str char *__is_p1__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sum: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_add_long(__sn__x, 10LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" Prod: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(sn_mul_long(__sn__x, 2LL)));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        });
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn____chain_tmp_0 = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("name: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Upper: ");
+            sn_auto_str char *__is_p1__ = __sn___toUpper(&__sn____chain_tmp_0);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Multi: ");
+            sn_auto_str char *__is_p1__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("x=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", doubled=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(sn_mul_long(__sn__x, 2LL)));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        });
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
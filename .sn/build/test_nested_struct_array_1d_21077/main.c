@@ -0,0 +1,57 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__buildPeople() {
+
+    sn_auto_arr SnArray * __sn__people = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Person), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Person_cleanup_elem;
+            __al__->elem_copy = __sn__Person_copy_into;
+            __al__;
+        });
+
+    __sn__arr_push(&__sn__people, (__sn__Person){ .__sn__name = strdup("Alice"), .__sn__addr = (__sn__Address){ .__sn__street = strdup("123 Main"), .__sn__city = strdup("Springfield") } });
+    
+
+    __sn__arr_push(&__sn__people, (__sn__Person){ .__sn__name = strdup("Bob"), .__sn__addr = (__sn__Address){ .__sn__street = strdup("456 Oak"), .__sn__city = strdup("Shelbyville") } });
+    
+
+    {
+        SnArray * __ret__ = __sn__people;
+        __sn__people = NULL;
+        return __ret__;
+    }}
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__people = __sn__buildPeople();
+    if ((sn_array_length(__sn__people) != 2LL)) {
+        sn_print("FAIL: length\n");
+        
+        return 0;}
+    if ((strcmp((((__sn__Person *)__sn__people->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__people->len : __ai__; })]).__sn__name, "Alice") != 0)) {
+        sn_print("FAIL: name 0\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Person *)__sn__people->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__people->len : __ai__; })]).__sn__addr.__sn__street, "123 Main") != 0) || (strcmp((((__sn__Person *)__sn__people->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__people->len : __ai__; })]).__sn__addr.__sn__city, "Springfield") != 0))) {
+        sn_print("FAIL: addr 0\n");
+        
+        return 0;}
+    if ((strcmp((((__sn__Person *)__sn__people->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__people->len : __ai__; })]).__sn__name, "Bob") != 0)) {
+        sn_print("FAIL: name 1\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Person *)__sn__people->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__people->len : __ai__; })]).__sn__addr.__sn__street, "456 Oak") != 0) || (strcmp((((__sn__Person *)__sn__people->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__people->len : __ai__; })]).__sn__addr.__sn__city, "Shelbyville") != 0))) {
+        sn_print("FAIL: addr 1\n");
+        
+        return 0;}
+    sn_print("PASS\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__buildGroups() {
+
+    sn_auto_arr SnArray * __sn__g1 = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Person), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Person_cleanup_elem;
+            __al__->elem_copy = __sn__Person_copy_into;
+            sn_array_push(__al__, &((__sn__Person){ .__sn__name = strdup("Alice"), .__sn__addr = (__sn__Address){ .__sn__street = strdup("1st Ave"), .__sn__city = strdup("NYC") } }));
+            sn_array_push(__al__, &((__sn__Person){ .__sn__name = strdup("Bob"), .__sn__addr = (__sn__Address){ .__sn__street = strdup("2nd Ave"), .__sn__city = strdup("LA") } }));
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__g2 = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Person), 1);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Person_cleanup_elem;
+            __al__->elem_copy = __sn__Person_copy_into;
+            sn_array_push(__al__, &((__sn__Person){ .__sn__name = strdup("Charlie"), .__sn__addr = (__sn__Address){ .__sn__street = strdup("3rd Ave"), .__sn__city = strdup("CHI") } }));
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__groups = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ sn_array_copy(__sn__g1) });
+            sn_array_push(__al__, &(SnArray *){ sn_array_copy(__sn__g2) });
+            __al__;
+        });
+
+    {
+        SnArray * __ret__ = __sn__groups;
+        __sn__groups = NULL;
+        return __ret__;
+    }}
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__groups = __sn__buildGroups();
+    if ((sn_array_length(__sn__groups) != 2LL)) {
+        sn_print("FAIL: outer\n");
+        
+        return 0;}
+    if (((sn_array_length((((SnArray * *)__sn__groups->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])) != 2LL) || (sn_array_length((((SnArray * *)__sn__groups->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])) != 1LL))) {
+        sn_print("FAIL: inner lengths\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Person *)(((SnArray * *)__sn__groups->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__groups->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->len : __ai__; })]).__sn__name, "Alice") != 0) || (strcmp((((__sn__Person *)(((SnArray * *)__sn__groups->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__groups->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->len : __ai__; })]).__sn__addr.__sn__city, "NYC") != 0))) {
+        sn_print("FAIL: [0][0]\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Person *)(((SnArray * *)__sn__groups->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__groups->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->len : __ai__; })]).__sn__name, "Bob") != 0) || (strcmp((((__sn__Person *)(((SnArray * *)__sn__groups->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__groups->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->len : __ai__; })]).__sn__addr.__sn__street, "2nd Ave") != 0))) {
+        sn_print("FAIL: [0][1]\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Person *)(((SnArray * *)__sn__groups->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__groups->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->len : __ai__; })]).__sn__name, "Charlie") != 0) || (strcmp((((__sn__Person *)(((SnArray * *)__sn__groups->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__groups->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__groups->len : __ai__; })])->len : __ai__; })]).__sn__addr.__sn__city, "CHI") != 0))) {
+        sn_print("FAIL: [1][0]\n");
+        
+        return 0;}
+    sn_print("PASS\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,30 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = NULL;
+    printf("%s\n", (sn_array_equals(__sn__arr, NULL)) ? "true" : "false");
+    
+    ({
+        SnArray *__sn_tmp__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+        sn_cleanup_array(&__sn__arr);
+        __sn__arr = __sn_tmp__;
+        __sn__arr;
+    });
+    
+    printf("%s\n", (sn_array_equals(__sn__arr, NULL)) ? "true" : "false");
+    
+    printf("%lld\n", (long long)(sn_array_length(__sn__arr)));
+    
+    fflush(stdout);
+    return 0;
+}
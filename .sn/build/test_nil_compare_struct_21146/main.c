@@ -0,0 +1,45 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Connection * __sn__tryConnect(char * __sn__host) {
+
+    if ((strcmp(__sn__host, "bad") == 0)) {
+        return NULL;}
+
+    return ({
+        __sn__Connection *__tmp__ = __sn__Connection__new();
+        __tmp__->__sn__host = strdup(__sn__host);
+        __tmp__->__sn__port = 8080LL;
+        __tmp__;
+    });}
+
+
+int main() {
+    sn_auto_Connection __sn__Connection * __sn__good = __sn__tryConnect("localhost");
+    sn_auto_Connection __sn__Connection * __sn__bad = __sn__tryConnect("bad");
+    if ((__sn__good != NULL)) {
+        sn_println("good: connected");
+        
+    } else {
+        sn_println("good: nil");
+        
+    }
+    if ((__sn__bad == NULL)) {
+        sn_println("bad: nil");
+        
+    } else {
+        sn_println("bad: connected");
+        
+    }
+    if ((NULL == __sn__bad)) {
+        sn_println("nil == bad: true");
+        
+    } else {
+        sn_println("nil == bad: false");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
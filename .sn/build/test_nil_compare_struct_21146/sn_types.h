@@ -0,0 +1,79 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Connection (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    char * __sn__host;
+    long long __sn__port;
+} __sn__Connection;
+
+
+static inline __sn__Connection *__sn__Connection__new(void) {
+    __sn__Connection *p = calloc(1, sizeof(__sn__Connection));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Connection *__sn__Connection_retain(__sn__Connection *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Connection_release(__sn__Connection **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free((*p)->__sn__host);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Connection *__sn__Connection_copy(const __sn__Connection *src) {
+    __sn__Connection *dst = calloc(1, sizeof(__sn__Connection));
+    dst->__rc__ = 1;
+    dst->__sn__host = src->__sn__host ? strdup(src->__sn__host) : NULL;
+    dst->__sn__port = src->__sn__port;
+    return dst;
+}
+
+#define sn_auto_Connection __attribute__((cleanup(__sn__Connection_release)))
+#define sn_auto_ref_Connection __attribute__((cleanup(__sn__Connection_release)))
+
+static inline void __sn__Connection_release_elem(void *p) { __sn__Connection_release((__sn__Connection **)p); }
+static inline void __sn__Connection_retain_into(const void *src, void *dst) { *(__sn__Connection **)dst = __sn__Connection_retain(*(__sn__Connection *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Connection_to_string(const __sn__Connection *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Connection { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "host: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__host ? p->__sn__host : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "port: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__port);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+__sn__Connection * __sn__tryConnect(char *);
+
+
+
+
+#endif
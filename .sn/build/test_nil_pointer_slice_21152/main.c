@@ -0,0 +1,46 @@
+#include "sn_types.h"
+
+
+
+unsigned char * get_nil_buffer() {
+
+    return NULL;}
+
+long long get_length() {
+
+    return 5LL;}
+
+
+void __sn__test_nil_slice_creates_array() {
+
+    long long __sn__len = get_length();
+
+    sn_auto_arr SnArray * __sn__data = sn_array_from_ptr(get_nil_buffer(), 0LL, __sn__len);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Array length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__data)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    if ((sn_array_length(__sn__data) == 5LL)) {
+        sn_print("Length check: PASS\n");
+        
+    } else {
+        sn_print("Length check: FAIL\n");
+        
+    }
+}
+
+int main() {
+    sn_print("Testing nil pointer slicing...\n");
+    
+    __sn__test_nil_slice_creates_array();
+    
+    sn_print("Nil pointer slice test complete!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,22 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__s = NULL;
+    printf("%s\n", ((__sn__s == NULL)) ? "true" : "false");
+    
+    ({
+        char *__sn_tmp__ = strdup("hello");
+        free(__sn__s);
+        __sn__s = __sn_tmp__;
+        __sn__s;
+    });
+    
+    printf("%s\n", ((__sn__s == NULL)) ? "true" : "false");
+    
+    sn_println(__sn__s);
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,15 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 0LL;
+    if ((false && (sn_div_long(__sn__x, 0LL) == 0LL))) {
+        sn_print("bad\n");
+        
+    }
+    sn_print("ok\n");
+    
+    fflush(stdout);
+    return 0;
+}
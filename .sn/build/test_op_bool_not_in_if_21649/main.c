@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 5LL;
+    if ((!sn_gt_long(__sn__x, 10LL))) {
+        sn_print("not big\n");
+        
+    }
+    if ((!sn_lt_long(__sn__x, 0LL))) {
+        sn_print("not negative\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
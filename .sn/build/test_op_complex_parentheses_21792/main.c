@@ -0,0 +1,18 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = 2LL;
+    long long __sn__b = 3LL;
+    long long __sn__c = 4LL;
+    long long __sn__r = sn_sub_long(sn_mul_long(sn_add_long(__sn__a, __sn__b), __sn__c), sn_mul_long(sn_sub_long(__sn__b, __sn__a), sn_add_long(__sn__c, __sn__a)));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__r));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
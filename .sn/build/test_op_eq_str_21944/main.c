@@ -0,0 +1,23 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__a = strdup("hello");
+    sn_auto_str char * __sn__b = strdup("hello");
+    sn_auto_str char * __sn__c = strdup("world");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(((strcmp(__sn__a, __sn__b) == 0)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(((strcmp(__sn__a, __sn__c) == 0)) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
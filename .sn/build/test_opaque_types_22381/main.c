@@ -0,0 +1,37 @@
+#include "sn_types.h"
+
+
+
+void * * get_null_file() {
+
+    return NULL;}
+
+bool is_file_nil(void * * __sn__f) {
+
+    return (__sn__f == NULL);}
+
+void use_file_ptr(void * * __sn__f) {
+
+    return;}
+
+int main() {
+    bool __sn__result = is_file_nil(NULL);
+    if (__sn__result) {
+        sn_print("is_file_nil(nil) returned true (expected)\n");
+        
+    } else {
+        sn_print("is_file_nil(nil) returned false (unexpected)\n");
+        
+    }
+    use_file_ptr(get_null_file());
+    
+    sn_print("use_file_ptr(get_null_file()) succeeded\n");
+    
+    use_file_ptr(NULL);
+    
+    sn_print("use_file_ptr(nil) succeeded\n");
+    
+    sn_print("All opaque type tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,239 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__Point_op_eq(__sn__Point *__sn__self, __sn__Point __sn__other) {
+
+    return ((__sn__self->__sn__x == __sn__other.__sn__x) && (__sn__self->__sn__y == __sn__other.__sn__y));}
+
+bool __sn__Point_op_lt(__sn__Point *__sn__self, __sn__Point __sn__other) {
+
+    return sn_lt_long(__sn__self->__sn__x, __sn__other.__sn__x);}
+
+
+bool __sn__Score_op_eq(__sn__Score *__sn__self, __sn__Score __sn__other) {
+
+    return (__sn__self->__sn__value == __sn__other.__sn__value);}
+
+
+long long __sn__HashItem_hash(__sn__HashItem *__sn__self) {
+
+    return sn_mul_long(__sn__self->__sn__id, 31LL);}
+
+int main() {
+    __sn__Point __sn__p1 = (__sn__Point){ .__sn__x = 3LL, .__sn__y = 4LL };
+    __sn__Point __sn__p2 = (__sn__Point){ .__sn__x = 3LL, .__sn__y = 4LL };
+    bool __sn__eq = __sn__Point_op_eq(&__sn__p1, __sn__p2);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1 == p2 (equal points): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__eq) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__eq)) {
+        sn_print("FAIL: equal points should be ==\n");
+        
+        return 1LL;}
+    __sn__Point __sn__p3 = (__sn__Point){ .__sn__x = 1LL, .__sn__y = 2LL };
+    bool __sn__neq = __sn__Point_op_eq(&__sn__p1, __sn__p3);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1 == p3 (unequal points): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__neq) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (__sn__neq) {
+        sn_print("FAIL: unequal points should not be ==\n");
+        
+        return 1LL;}
+    bool __sn__ne1 = (!__sn__Point_op_eq(&__sn__p1, __sn__p3));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1 != p3 (unequal): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__ne1) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__ne1)) {
+        sn_print("FAIL: unequal points should be !=\n");
+        
+        return 1LL;}
+    bool __sn__ne2 = (!__sn__Point_op_eq(&__sn__p1, __sn__p2));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1 != p2 (equal): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__ne2) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (__sn__ne2) {
+        sn_print("FAIL: equal points should not be !=\n");
+        
+        return 1LL;}
+    bool __sn__lt1 = __sn__Point_op_lt(&__sn__p3, __sn__p1);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p3 < p1 (x:1 < x:3): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__lt1) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__lt1)) {
+        sn_print("FAIL: p3 should be < p1\n");
+        
+        return 1LL;}
+    bool __sn__lt2 = __sn__Point_op_lt(&__sn__p1, __sn__p3);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1 < p3 (x:3 < x:1): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__lt2) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (__sn__lt2) {
+        sn_print("FAIL: p1 should not be < p3\n");
+        
+        return 1LL;}
+    bool __sn__gt1 = __sn__Point_op_lt(&__sn__p3, __sn__p1);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1 > p3 (x:3 > x:1): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__gt1) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__gt1)) {
+        sn_print("FAIL: p1 should be > p3\n");
+        
+        return 1LL;}
+    bool __sn__gt2 = __sn__Point_op_lt(&__sn__p1, __sn__p3);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p3 > p1 (x:1 > x:3): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__gt2) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (__sn__gt2) {
+        sn_print("FAIL: p3 should not be > p1\n");
+        
+        return 1LL;}
+    bool __sn__le1 = (!__sn__Point_op_lt(&__sn__p1, __sn__p3));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p3 <= p1 (x:1 <= x:3): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__le1) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__le1)) {
+        sn_print("FAIL: p3 should be <= p1\n");
+        
+        return 1LL;}
+    bool __sn__le2 = (!__sn__Point_op_lt(&__sn__p2, __sn__p1));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1 <= p2 (equal): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__le2) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__le2)) {
+        sn_print("FAIL: equal points should be <=\n");
+        
+        return 1LL;}
+    bool __sn__le3 = (!__sn__Point_op_lt(&__sn__p3, __sn__p1));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1 <= p3 (x:3 <= x:1): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__le3) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (__sn__le3) {
+        sn_print("FAIL: p1 should not be <= p3\n");
+        
+        return 1LL;}
+    bool __sn__ge1 = (!__sn__Point_op_lt(&__sn__p1, __sn__p3));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1 >= p3 (x:3 >= x:1): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__ge1) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__ge1)) {
+        sn_print("FAIL: p1 should be >= p3\n");
+        
+        return 1LL;}
+    bool __sn__ge2 = (!__sn__Point_op_lt(&__sn__p1, __sn__p2));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1 >= p2 (equal): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__ge2) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__ge2)) {
+        sn_print("FAIL: equal points should be >=\n");
+        
+        return 1LL;}
+    bool __sn__ge3 = (!__sn__Point_op_lt(&__sn__p3, __sn__p1));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p3 >= p1 (x:1 >= x:3): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__ge3) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (__sn__ge3) {
+        sn_print("FAIL: p3 should not be >= p1\n");
+        
+        return 1LL;}
+    __sn__Score __sn__s1 = (__sn__Score){ .__sn__value = 10LL };
+    __sn__Score __sn__s2 = (__sn__Score){ .__sn__value = 10LL };
+    __sn__Score __sn__s3 = (__sn__Score){ .__sn__value = 20LL };
+    bool __sn__seq = __sn__Score_op_eq(&__sn__s1, __sn__s2);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("s1 == s2 (equal scores): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__seq) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__seq)) {
+        sn_print("FAIL: equal scores should be ==\n");
+        
+        return 1LL;}
+    bool __sn__sne = (!__sn__Score_op_eq(&__sn__s1, __sn__s3));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("s1 != s3 (unequal scores, auto-derived !=): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__sne) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((!__sn__sne)) {
+        sn_print("FAIL: unequal scores should be !=\n");
+        
+        return 1LL;}
+    __sn__HashItem __sn__h = (__sn__HashItem){ .__sn__id = 7LL };
+    long long __sn__hashVal = __sn__HashItem_hash(&__sn__h);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("hash(id=7): ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__hashVal));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__hashVal != 217LL)) {
+        sn_print("FAIL: hash should be 7 * 31 = 217\n");
+        
+        return 1LL;}
+    sn_print("All operator overloading tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
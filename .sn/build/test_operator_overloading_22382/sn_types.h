@@ -0,0 +1,177 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Score (as val) */
+typedef struct {
+    long long __sn__value;
+} __sn__Score;
+/* Value operations */
+static inline __sn__Score __sn__Score_copy(const __sn__Score *src) {
+    __sn__Score dst;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Score_cleanup(__sn__Score *p) {
+
+}
+
+#define sn_auto_Score __attribute__((cleanup(__sn__Score_cleanup)))
+
+static inline void __sn__Score_cleanup_elem(void *p) { __sn__Score_cleanup((__sn__Score *)p); }
+static inline void __sn__Score_copy_into(const void *src, void *dst) { *(__sn__Score *)dst = __sn__Score_copy((const __sn__Score *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Score *__sn__Score_alloc(void) {
+    return calloc(1, sizeof(__sn__Score));
+}
+
+static inline void __sn__Score_release(__sn__Score **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Score __attribute__((cleanup(__sn__Score_release)))
+
+static inline void __sn__Score_release_elem(void *p) { __sn__Score_release((__sn__Score **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Score_to_string(const __sn__Score *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Score { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: HashItem (as val) */
+typedef struct {
+    long long __sn__id;
+} __sn__HashItem;
+/* Value operations */
+static inline __sn__HashItem __sn__HashItem_copy(const __sn__HashItem *src) {
+    __sn__HashItem dst;
+    dst.__sn__id = src->__sn__id;
+    return dst;
+}
+
+static inline void __sn__HashItem_cleanup(__sn__HashItem *p) {
+
+}
+
+#define sn_auto_HashItem __attribute__((cleanup(__sn__HashItem_cleanup)))
+
+static inline void __sn__HashItem_cleanup_elem(void *p) { __sn__HashItem_cleanup((__sn__HashItem *)p); }
+static inline void __sn__HashItem_copy_into(const void *src, void *dst) { *(__sn__HashItem *)dst = __sn__HashItem_copy((const __sn__HashItem *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__HashItem *__sn__HashItem_alloc(void) {
+    return calloc(1, sizeof(__sn__HashItem));
+}
+
+static inline void __sn__HashItem_release(__sn__HashItem **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_HashItem __attribute__((cleanup(__sn__HashItem_release)))
+
+static inline void __sn__HashItem_release_elem(void *p) { __sn__HashItem_release((__sn__HashItem **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__HashItem_to_string(const __sn__HashItem *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "HashItem { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__id);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+bool __sn__Point_op_eq(__sn__Point *, __sn__Point);
+bool __sn__Point_op_lt(__sn__Point *, __sn__Point);
+bool __sn__Score_op_eq(__sn__Score *, __sn__Score);
+long long __sn__HashItem_hash(__sn__HashItem *);
+
+
+
+#endif
@@ -0,0 +1,222 @@
+#include "sn_types.h"
+
+
+
+
+bool __sn__Weight_op_eq(__sn__Weight *__sn__self, __sn__Weight __sn__other) {
+
+    return (__sn__self->__sn__kg == __sn__other.__sn__kg);}
+
+bool __sn__Weight_op_lt(__sn__Weight *__sn__self, __sn__Weight __sn__other) {
+
+    return sn_lt_long(__sn__self->__sn__kg, __sn__other.__sn__kg);}
+
+
+bool __sn__Tag_op_eq(__sn__Tag *__sn__self, __sn__Tag __sn__other) {
+
+    return (__sn__self->__sn__code == __sn__other.__sn__code);}
+
+bool __sn__Tag_op_ne(__sn__Tag *__sn__self, __sn__Tag __sn__other) {
+
+    return (__sn__self->__sn__code != __sn__other.__sn__code);}
+
+
+bool __sn__Version_op_eq(__sn__Version *__sn__self, __sn__Version __sn__other) {
+
+    return ((__sn__self->__sn__major == __sn__other.__sn__major) && (__sn__self->__sn__minor == __sn__other.__sn__minor));}
+
+bool __sn__Version_op_lt(__sn__Version *__sn__self, __sn__Version __sn__other) {
+
+    if (sn_lt_long(__sn__self->__sn__major, __sn__other.__sn__major)) {
+        return true;}
+
+    if (sn_gt_long(__sn__self->__sn__major, __sn__other.__sn__major)) {
+        return false;}
+
+    return sn_lt_long(__sn__self->__sn__minor, __sn__other.__sn__minor);}
+
+int main() {
+    __sn__Weight __sn__w1 = (__sn__Weight){ .__sn__kg = 10LL };
+    __sn__Weight __sn__w2 = (__sn__Weight){ .__sn__kg = 20LL };
+    __sn__Weight __sn__w3 = (__sn__Weight){ .__sn__kg = 10LL };
+    if (__sn__Weight_op_eq(&__sn__w1, __sn__w3)) {
+        sn_print("w1 == w3 (direct if): true\n");
+        
+    } else {
+        sn_print("FAIL: w1 == w3 should be true\n");
+        
+        return 1LL;}
+    if (__sn__Weight_op_lt(&__sn__w1, __sn__w2)) {
+        sn_print("w1 < w2 (direct if): true\n");
+        
+    } else {
+        sn_print("FAIL: w1 < w2 should be true\n");
+        
+        return 1LL;}
+    if (__sn__Weight_op_lt(&__sn__w1, __sn__w2)) {
+        sn_print("w2 > w1 (auto-derived, direct if): true\n");
+        
+    } else {
+        sn_print("FAIL: w2 > w1 should be true\n");
+        
+        return 1LL;}
+    if ((!__sn__Weight_op_eq(&__sn__w1, __sn__w2))) {
+        sn_print("w1 != w2 (auto-derived, direct if): true\n");
+        
+    } else {
+        sn_print("FAIL: w1 != w2 should be true\n");
+        
+        return 1LL;}
+    if ((__sn__Weight_op_eq(&__sn__w1, __sn__w3) && __sn__Weight_op_lt(&__sn__w1, __sn__w2))) {
+        sn_print("w1 == w3 && w1 < w2: true\n");
+        
+    } else {
+        sn_print("FAIL: combined && condition failed\n");
+        
+        return 1LL;}
+    if ((__sn__Weight_op_lt(&__sn__w1, __sn__w2) && (!__sn__Weight_op_eq(&__sn__w2, __sn__w3)))) {
+        sn_print("w2 > w1 && w2 != w3: true\n");
+        
+    } else {
+        sn_print("FAIL: combined && condition 2 failed\n");
+        
+        return 1LL;}
+    if ((__sn__Weight_op_lt(&__sn__w2, __sn__w1) || __sn__Weight_op_lt(&__sn__w1, __sn__w2))) {
+        sn_print("w1 > w2 || w1 < w2 (one true): true\n");
+        
+    } else {
+        sn_print("FAIL: || condition failed\n");
+        
+        return 1LL;}
+    __sn__Weight __sn__cur = (__sn__Weight){ .__sn__kg = 1LL };
+    __sn__Weight __sn__limit = (__sn__Weight){ .__sn__kg = 5LL };
+    long long __sn__count = 0LL;
+    while (__sn__Weight_op_lt(&__sn__cur, __sn__limit)) {
+        (__sn__count = sn_add_long(__sn__count, 1LL));
+        
+        (__sn__cur = (__sn__Weight){ .__sn__kg = sn_add_long(__sn__cur.__sn__kg, 1LL) });
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("while cur < limit count: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__count != 4LL)) {
+        sn_print("FAIL: while loop count should be 4\n");
+        
+        return 1LL;}
+    __sn__Tag __sn__t1 = (__sn__Tag){ .__sn__code = 42LL };
+    __sn__Tag __sn__t2 = (__sn__Tag){ .__sn__code = 42LL };
+    __sn__Tag __sn__t3 = (__sn__Tag){ .__sn__code = 99LL };
+    if (__sn__Tag_op_eq(&__sn__t1, __sn__t2)) {
+        sn_print("t1 == t2 (explicit ==): true\n");
+        
+    } else {
+        sn_print("FAIL: t1 == t2 should be true\n");
+        
+        return 1LL;}
+    if (__sn__Tag_op_ne(&__sn__t1, __sn__t3)) {
+        sn_print("t1 != t3 (explicit !=): true\n");
+        
+    } else {
+        sn_print("FAIL: t1 != t3 should be true\n");
+        
+        return 1LL;}
+    bool __sn__sameTag = __sn__Tag_op_ne(&__sn__t1, __sn__t2);
+    if (__sn__sameTag) {
+        sn_print("FAIL: t1 != t2 should be false\n");
+        
+        return 1LL;}
+    sn_print("t1 != t2 (explicit !=, equal tags): false\n");
+    
+    __sn__Version __sn__v1 = (__sn__Version){ .__sn__major = 1LL, .__sn__minor = 2LL };
+    __sn__Version __sn__v2 = (__sn__Version){ .__sn__major = 1LL, .__sn__minor = 5LL };
+    __sn__Version __sn__v3 = (__sn__Version){ .__sn__major = 2LL, .__sn__minor = 0LL };
+    __sn__Version __sn__v4 = (__sn__Version){ .__sn__major = 1LL, .__sn__minor = 2LL };
+    if (__sn__Version_op_lt(&__sn__v1, __sn__v2)) {
+        sn_print("v1(1.2) < v2(1.5): true\n");
+        
+    } else {
+        sn_print("FAIL: 1.2 should be < 1.5\n");
+        
+        return 1LL;}
+    if (__sn__Version_op_lt(&__sn__v2, __sn__v3)) {
+        sn_print("v2(1.5) < v3(2.0): true\n");
+        
+    } else {
+        sn_print("FAIL: 1.5 should be < 2.0\n");
+        
+        return 1LL;}
+    if (__sn__Version_op_eq(&__sn__v1, __sn__v4)) {
+        sn_print("v1(1.2) == v4(1.2): true\n");
+        
+    } else {
+        sn_print("FAIL: 1.2 should == 1.2\n");
+        
+        return 1LL;}
+    if (__sn__Version_op_lt(&__sn__v2, __sn__v3)) {
+        sn_print("v3(2.0) > v2(1.5): true\n");
+        
+    } else {
+        sn_print("FAIL: 2.0 should be > 1.5\n");
+        
+        return 1LL;}
+    if ((!__sn__Version_op_lt(&__sn__v4, __sn__v1))) {
+        sn_print("v1(1.2) <= v4(1.2) (equal, auto-derived <=): true\n");
+        
+    } else {
+        sn_print("FAIL: equal versions should be <=\n");
+        
+        return 1LL;}
+    if ((!__sn__Version_op_lt(&__sn__v1, __sn__v4))) {
+        sn_print("v1(1.2) >= v4(1.2) (equal, auto-derived >=): true\n");
+        
+    } else {
+        sn_print("FAIL: equal versions should be >=\n");
+        
+        return 1LL;}
+    if ((!__sn__Version_op_lt(&__sn__v3, __sn__v1))) {
+        sn_print("v3(2.0) >= v1(1.2) (auto-derived >=): true\n");
+        
+    } else {
+        sn_print("FAIL: 2.0 should be >= 1.2\n");
+        
+        return 1LL;}
+    sn_auto_arr SnArray * __sn__weights = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Weight), 4);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Weight){ .__sn__kg = 7LL }));
+            sn_array_push(__al__, &((__sn__Weight){ .__sn__kg = 2LL }));
+            sn_array_push(__al__, &((__sn__Weight){ .__sn__kg = 9LL }));
+            sn_array_push(__al__, &((__sn__Weight){ .__sn__kg = 4LL }));
+            __al__;
+        });
+    __sn__Weight __sn__minW = (((__sn__Weight *)__sn__weights->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__weights->len : __ai__; })]);
+    long long __sn__i = 1LL;
+    while (sn_lt_long(__sn__i, sn_array_length(__sn__weights))) {
+        if (__sn__Weight_op_lt(&(((__sn__Weight *)__sn__weights->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__weights->len : __ai__; })]), __sn__minW)) {
+            (__sn__minW = (((__sn__Weight *)__sn__weights->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__weights->len : __ai__; })]));
+            
+        }
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("min weight kg: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__minW.__sn__kg));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__minW.__sn__kg != 2LL)) {
+        sn_print("FAIL: min weight should be 2\n");
+        
+        return 1LL;}
+    sn_print("All advanced operator overloading tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,179 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Weight (as val) */
+typedef struct {
+    long long __sn__kg;
+} __sn__Weight;
+/* Value operations */
+static inline __sn__Weight __sn__Weight_copy(const __sn__Weight *src) {
+    __sn__Weight dst;
+    dst.__sn__kg = src->__sn__kg;
+    return dst;
+}
+
+static inline void __sn__Weight_cleanup(__sn__Weight *p) {
+
+}
+
+#define sn_auto_Weight __attribute__((cleanup(__sn__Weight_cleanup)))
+
+static inline void __sn__Weight_cleanup_elem(void *p) { __sn__Weight_cleanup((__sn__Weight *)p); }
+static inline void __sn__Weight_copy_into(const void *src, void *dst) { *(__sn__Weight *)dst = __sn__Weight_copy((const __sn__Weight *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Weight *__sn__Weight_alloc(void) {
+    return calloc(1, sizeof(__sn__Weight));
+}
+
+static inline void __sn__Weight_release(__sn__Weight **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Weight __attribute__((cleanup(__sn__Weight_release)))
+
+static inline void __sn__Weight_release_elem(void *p) { __sn__Weight_release((__sn__Weight **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Weight_to_string(const __sn__Weight *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Weight { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "kg: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__kg);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Tag (as val) */
+typedef struct {
+    long long __sn__code;
+} __sn__Tag;
+/* Value operations */
+static inline __sn__Tag __sn__Tag_copy(const __sn__Tag *src) {
+    __sn__Tag dst;
+    dst.__sn__code = src->__sn__code;
+    return dst;
+}
+
+static inline void __sn__Tag_cleanup(__sn__Tag *p) {
+
+}
+
+#define sn_auto_Tag __attribute__((cleanup(__sn__Tag_cleanup)))
+
+static inline void __sn__Tag_cleanup_elem(void *p) { __sn__Tag_cleanup((__sn__Tag *)p); }
+static inline void __sn__Tag_copy_into(const void *src, void *dst) { *(__sn__Tag *)dst = __sn__Tag_copy((const __sn__Tag *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Tag *__sn__Tag_alloc(void) {
+    return calloc(1, sizeof(__sn__Tag));
+}
+
+static inline void __sn__Tag_release(__sn__Tag **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Tag __attribute__((cleanup(__sn__Tag_release)))
+
+static inline void __sn__Tag_release_elem(void *p) { __sn__Tag_release((__sn__Tag **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Tag_to_string(const __sn__Tag *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Tag { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "code: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__code);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Version (as val) */
+typedef struct {
+    long long __sn__major;
+    long long __sn__minor;
+} __sn__Version;
+/* Value operations */
+static inline __sn__Version __sn__Version_copy(const __sn__Version *src) {
+    __sn__Version dst;
+    dst.__sn__major = src->__sn__major;
+    dst.__sn__minor = src->__sn__minor;
+    return dst;
+}
+
+static inline void __sn__Version_cleanup(__sn__Version *p) {
+
+}
+
+#define sn_auto_Version __attribute__((cleanup(__sn__Version_cleanup)))
+
+static inline void __sn__Version_cleanup_elem(void *p) { __sn__Version_cleanup((__sn__Version *)p); }
+static inline void __sn__Version_copy_into(const void *src, void *dst) { *(__sn__Version *)dst = __sn__Version_copy((const __sn__Version *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Version *__sn__Version_alloc(void) {
+    return calloc(1, sizeof(__sn__Version));
+}
+
+static inline void __sn__Version_release(__sn__Version **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Version __attribute__((cleanup(__sn__Version_release)))
+
+static inline void __sn__Version_release_elem(void *p) { __sn__Version_release((__sn__Version **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Version_to_string(const __sn__Version *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Version { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "major: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__major);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "minor: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__minor);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+bool __sn__Weight_op_eq(__sn__Weight *, __sn__Weight);
+bool __sn__Weight_op_lt(__sn__Weight *, __sn__Weight);
+bool __sn__Tag_op_eq(__sn__Tag *, __sn__Tag);
+bool __sn__Tag_op_ne(__sn__Tag *, __sn__Tag);
+bool __sn__Version_op_eq(__sn__Version *, __sn__Version);
+bool __sn__Version_op_lt(__sn__Version *, __sn__Version);
+
+
+
+#endif
@@ -0,0 +1,111 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__compute(__sn__Worker * __sn__w) {
+
+    return sn_mul_long(__sn__w->__sn__value, 2LL);}
+
+
+long long __sn__Worker_runSync(__sn__Worker *__sn__self) {
+
+    return __sn__compute(__sn__self);}
+
+long long __sn__Worker_runThread(__sn__Worker *__sn__self) {
+
+    long long __sn__h = 0; sn_auto_thread SnThread * __sn__h__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = __sn__Worker_retain(__sn__self);
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+
+    return ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__h__th__; __sn__h__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__h = *(long long *)__sync_th__->result; }
+        __sn__h; })
+    ;}
+
+void __sn__Worker_runDetached(__sn__Worker *__sn__self) {
+
+    long long __sn__h = 0; sn_auto_thread SnThread * __sn__h__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+        __args__->arg0 = __sn__Worker_retain(__sn__self);
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+
+    ({
+        SnThread *__dt__ = __sn__h__th__;
+        if (__dt__) {
+            __dt__->detached = 1;
+            pthread_detach(__dt__->thread);
+        }
+        (void)0;
+    });
+    
+}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__compute(args->arg0);
+    __sn__Worker_release(&args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__compute(args->arg0);
+    __sn__Worker_release(&args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_auto_Worker __sn__Worker * __sn__w = ({
+        __sn__Worker *__tmp__ = __sn__Worker__new();
+        __tmp__->__sn__value = 21LL;
+        __tmp__;
+    });
+    long long __sn__sync_result = __sn__Worker_runSync(__sn__w);
+    if ((__sn__sync_result != 42LL)) {
+        sn_print("runSync: FAIL\n");
+        
+        return 1LL;}
+    sn_print("runSync: PASS\n");
+    
+    long long __sn__thread_result = __sn__Worker_runThread(__sn__w);
+    if ((__sn__thread_result != 42LL)) {
+        sn_print("runThread: FAIL\n");
+        
+        return 1LL;}
+    sn_print("runThread: PASS\n");
+    
+    __sn__Worker_runDetached(__sn__w);
+    
+    sn_print("runDetached: PASS\n");
+    
+    sn_print("All pass-self tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
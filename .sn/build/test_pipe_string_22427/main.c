@@ -0,0 +1,230 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("=== Pipe Block String Tests ===\n\n");
+    
+    sn_auto_str char * __sn__basic = strdup("Line 1\nLine 2\nLine 3\n\n");
+    sn_auto_arr SnArray * __sn__basic_lines = __sn___splitLines(&__sn__basic);
+    sn_assert((sn_array_length(__sn__basic_lines) >= 3LL), "basic has at least 3 content lines");
+    
+    sn_assert((strcmp((((char * *)__sn__basic_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__basic_lines->len : __ai__; })]), "Line 1") == 0), "basic line 1 - no leading indent");
+    
+    sn_assert((strcmp((((char * *)__sn__basic_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__basic_lines->len : __ai__; })]), "Line 2") == 0), "basic line 2 - no leading indent");
+    
+    sn_assert((strcmp((((char * *)__sn__basic_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__basic_lines->len : __ai__; })]), "Line 3") == 0), "basic line 3 - no leading indent");
+    
+    sn_assert((!__sn___startsWith(&(((char * *)__sn__basic_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__basic_lines->len : __ai__; })]), " ")), "line 1 has no leading space");
+    
+    sn_assert((!__sn___startsWith(&(((char * *)__sn__basic_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__basic_lines->len : __ai__; })]), " ")), "line 2 has no leading space");
+    
+    sn_assert((!__sn___startsWith(&(((char * *)__sn__basic_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__basic_lines->len : __ai__; })]), " ")), "line 3 has no leading space");
+    
+    sn_print("test_basic_multiline: PASS\n");
+    
+    sn_auto_str char * __sn__indented = strdup("outer\n    inner1\n    inner2\nouter again\n\n");
+    sn_auto_arr SnArray * __sn__ind_lines = __sn___splitLines(&__sn__indented);
+    sn_assert((sn_array_length(__sn__ind_lines) >= 4LL), "indented has at least 4 content lines");
+    
+    sn_assert((strcmp((((char * *)__sn__ind_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__ind_lines->len : __ai__; })]), "outer") == 0), "first line - base indent stripped");
+    
+    sn_assert((strcmp((((char * *)__sn__ind_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__ind_lines->len : __ai__; })]), "    inner1") == 0), "second line - 4 spaces relative indent");
+    
+    sn_assert((strcmp((((char * *)__sn__ind_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__ind_lines->len : __ai__; })]), "    inner2") == 0), "third line - 4 spaces relative indent");
+    
+    sn_assert((strcmp((((char * *)__sn__ind_lines->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__ind_lines->len : __ai__; })]), "outer again") == 0), "fourth line - back to base");
+    
+    sn_assert(__sn___startsWith(&(((char * *)__sn__ind_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__ind_lines->len : __ai__; })]), "    "), "inner1 starts with 4 spaces");
+    
+    sn_assert((__sn___charAt(&(((char * *)__sn__ind_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__ind_lines->len : __ai__; })]), 4LL) == (char)105), "inner1 content starts at position 4");
+    
+    sn_print("test_relative_indentation: PASS\n");
+    
+    sn_auto_str char * __sn__nested = strdup("level0\n    level1\n        level2\n    level1\nlevel0\n\n");
+    sn_auto_arr SnArray * __sn__nest_lines = __sn___splitLines(&__sn__nested);
+    sn_assert((sn_array_length(__sn__nest_lines) >= 5LL), "nested has at least 5 content lines");
+    
+    sn_assert((strcmp((((char * *)__sn__nest_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__nest_lines->len : __ai__; })]), "level0") == 0), "nest line 0 - no indent");
+    
+    sn_assert((strcmp((((char * *)__sn__nest_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__nest_lines->len : __ai__; })]), "    level1") == 0), "nest line 1 - 4 spaces");
+    
+    sn_assert((strcmp((((char * *)__sn__nest_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__nest_lines->len : __ai__; })]), "        level2") == 0), "nest line 2 - 8 spaces");
+    
+    sn_assert((strcmp((((char * *)__sn__nest_lines->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__nest_lines->len : __ai__; })]), "    level1") == 0), "nest line 3 - 4 spaces");
+    
+    sn_assert((strcmp((((char * *)__sn__nest_lines->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__nest_lines->len : __ai__; })]), "level0") == 0), "nest line 4 - no indent");
+    
+    sn_assert((!__sn___startsWith(&(((char * *)__sn__nest_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__nest_lines->len : __ai__; })]), " ")), "level0 has 0 leading spaces");
+    
+    sn_assert((__sn___startsWith(&(((char * *)__sn__nest_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__nest_lines->len : __ai__; })]), "    ") && (!__sn___startsWith(&(((char * *)__sn__nest_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__nest_lines->len : __ai__; })]), "     "))), "level1 has exactly 4 spaces");
+    
+    sn_assert((__sn___startsWith(&(((char * *)__sn__nest_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__nest_lines->len : __ai__; })]), "        ") && (!__sn___startsWith(&(((char * *)__sn__nest_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__nest_lines->len : __ai__; })]), "         "))), "level2 has exactly 8 spaces");
+    
+    sn_print("test_nested_indentation: PASS\n");
+    
+    sn_auto_str char * __sn__sql = strdup("SELECT *\nFROM users\nWHERE active = true\n\n");
+    sn_assert(__sn___contains(&__sn__sql, "SELECT"), "sql has SELECT");
+    
+    sn_assert(__sn___contains(&__sn__sql, "FROM"), "sql has FROM");
+    
+    sn_assert(__sn___contains(&__sn__sql, "WHERE"), "sql has WHERE");
+    
+    sn_auto_arr SnArray * __sn__sql_lines = __sn___splitLines(&__sn__sql);
+    sn_assert((sn_array_length(__sn__sql_lines) >= 3LL), "sql has at least 3 lines");
+    
+    sn_assert((strcmp((((char * *)__sn__sql_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__sql_lines->len : __ai__; })]), "SELECT *") == 0), "sql line 1 - no indent");
+    
+    sn_assert((strcmp((((char * *)__sn__sql_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__sql_lines->len : __ai__; })]), "FROM users") == 0), "sql line 2 - no indent");
+    
+    sn_assert((strcmp((((char * *)__sn__sql_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__sql_lines->len : __ai__; })]), "WHERE active = true") == 0), "sql line 3 - no indent");
+    
+    sn_print("test_sql: PASS\n");
+    
+    sn_auto_str char * __sn__name = strdup("Alice");
+    sn_auto_str char * __sn__greeting = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hello ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("!\nWelcome back.\n\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });
+    sn_assert(__sn___contains(&__sn__greeting, "Alice"), "greeting interpolated name");
+    
+    sn_auto_arr SnArray * __sn__greet_lines = __sn___splitLines(&__sn__greeting);
+    sn_assert((sn_array_length(__sn__greet_lines) >= 2LL), "greeting has at least 2 lines");
+    
+    sn_assert((strcmp((((char * *)__sn__greet_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__greet_lines->len : __ai__; })]), "Hello Alice!") == 0), "greeting line 1 - interpolation worked");
+    
+    sn_assert((strcmp((((char * *)__sn__greet_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__greet_lines->len : __ai__; })]), "Welcome back.") == 0), "greeting line 2");
+    
+    sn_print("test_interpolated: PASS\n");
+    
+    long long __sn__x = 42LL;
+    sn_auto_str char * __sn__math = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("x = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup("\nx * 2 = ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(sn_mul_long(__sn__x, 2LL)));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        });
+    sn_auto_arr SnArray * __sn__math_lines = __sn___splitLines(&__sn__math);
+    sn_assert((sn_array_length(__sn__math_lines) >= 2LL), "math has at least 2 lines");
+    
+    sn_assert((strcmp((((char * *)__sn__math_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__math_lines->len : __ai__; })]), "x = 42") == 0), "math line 1 - simple interpolation");
+    
+    sn_assert((strcmp((((char * *)__sn__math_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__math_lines->len : __ai__; })]), "x * 2 = 84") == 0), "math line 2 - expression interpolation");
+    
+    sn_print("test_math_interp: PASS\n");
+    
+    sn_auto_str char * __sn__code_type = strdup("function");
+    sn_auto_str char * __sn__code = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("def ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__code_type);
+            sn_auto_str char *__is_p2__ = sn_strdup("():\n    print(\"hello\")\n    return 42\n\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });
+    sn_auto_arr SnArray * __sn__code_lines = __sn___splitLines(&__sn__code);
+    sn_assert((sn_array_length(__sn__code_lines) >= 3LL), "code has at least 3 lines");
+    
+    sn_assert((strcmp((((char * *)__sn__code_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__code_lines->len : __ai__; })]), "def function():") == 0), "code line 1 - interpolation + no indent");
+    
+    sn_assert((strcmp((((char * *)__sn__code_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__code_lines->len : __ai__; })]), "    print(\"hello\")") == 0), "code line 2 - 4 space indent preserved");
+    
+    sn_assert((strcmp((((char * *)__sn__code_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__code_lines->len : __ai__; })]), "    return 42") == 0), "code line 3 - 4 space indent preserved");
+    
+    sn_assert(__sn___startsWith(&(((char * *)__sn__code_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__code_lines->len : __ai__; })]), "    "), "code line 2 has 4 leading spaces");
+    
+    sn_assert(__sn___startsWith(&(((char * *)__sn__code_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__code_lines->len : __ai__; })]), "    "), "code line 3 has 4 leading spaces");
+    
+    sn_print("test_interpolated_with_indent: PASS\n");
+    
+    sn_auto_str char * __sn__single = strdup("just one line\n\n");
+    sn_auto_arr SnArray * __sn__single_lines = __sn___splitLines(&__sn__single);
+    sn_assert((sn_array_length(__sn__single_lines) >= 1LL), "single has at least 1 line");
+    
+    sn_assert((strcmp((((char * *)__sn__single_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__single_lines->len : __ai__; })]), "just one line") == 0), "single line - no indent");
+    
+    sn_print("test_single_line: PASS\n");
+    
+    sn_auto_str char * __sn__two_space_src = strdup("line at base\n  indented 2 more\nback to base\n\n");
+    sn_auto_arr SnArray * __sn__ts_lines = __sn___splitLines(&__sn__two_space_src);
+    sn_assert((sn_array_length(__sn__ts_lines) >= 3LL), "two_space_src has at least 3 content lines");
+    
+    sn_assert((strcmp((((char * *)__sn__ts_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__ts_lines->len : __ai__; })]), "line at base") == 0), "2sp src line 0 - no indent");
+    
+    sn_assert((strcmp((((char * *)__sn__ts_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__ts_lines->len : __ai__; })]), "  indented 2 more") == 0), "2sp src line 1 - 2 space relative");
+    
+    sn_assert((strcmp((((char * *)__sn__ts_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__ts_lines->len : __ai__; })]), "back to base") == 0), "2sp src line 2 - no indent");
+    
+    sn_assert((__sn___startsWith(&(((char * *)__sn__ts_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__ts_lines->len : __ai__; })]), "  ") && (!__sn___startsWith(&(((char * *)__sn__ts_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__ts_lines->len : __ai__; })]), "   "))), "2sp src has exactly 2 spaces");
+    
+    sn_print("test_two_space_source: PASS\n");
+    
+    sn_auto_str char * __sn__four_space_src = strdup("line at base\n    indented 4 more\nback to base\n\n");
+    sn_auto_arr SnArray * __sn__fs_lines = __sn___splitLines(&__sn__four_space_src);
+    sn_assert((sn_array_length(__sn__fs_lines) >= 3LL), "four_space_src has at least 3 content lines");
+    
+    sn_assert((strcmp((((char * *)__sn__fs_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__fs_lines->len : __ai__; })]), "line at base") == 0), "4sp src line 0 - no indent");
+    
+    sn_assert((strcmp((((char * *)__sn__fs_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__fs_lines->len : __ai__; })]), "    indented 4 more") == 0), "4sp src line 1 - 4 space relative");
+    
+    sn_assert((strcmp((((char * *)__sn__fs_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__fs_lines->len : __ai__; })]), "back to base") == 0), "4sp src line 2 - no indent");
+    
+    sn_assert((__sn___startsWith(&(((char * *)__sn__fs_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__fs_lines->len : __ai__; })]), "    ") && (!__sn___startsWith(&(((char * *)__sn__fs_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__fs_lines->len : __ai__; })]), "     "))), "4sp src has exactly 4 spaces");
+    
+    sn_print("test_four_space_source: PASS\n");
+    
+    sn_auto_str char * __sn__mixed_2_2 = strdup("fn example():\n  var x: int = 1\n  if true:\n    nested\n  done\n\n");
+    sn_auto_arr SnArray * __sn__m22_lines = __sn___splitLines(&__sn__mixed_2_2);
+    sn_assert((sn_array_length(__sn__m22_lines) >= 5LL), "mixed_2_2 has at least 5 lines");
+    
+    sn_assert((strcmp((((char * *)__sn__m22_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__m22_lines->len : __ai__; })]), "fn example():") == 0), "m22 line 0 - base");
+    
+    sn_assert((strcmp((((char * *)__sn__m22_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__m22_lines->len : __ai__; })]), "  var x: int = 1") == 0), "m22 line 1 - 2sp");
+    
+    sn_assert((strcmp((((char * *)__sn__m22_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__m22_lines->len : __ai__; })]), "  if true:") == 0), "m22 line 2 - 2sp");
+    
+    sn_assert((strcmp((((char * *)__sn__m22_lines->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__m22_lines->len : __ai__; })]), "    nested") == 0), "m22 line 3 - 4sp (2+2)");
+    
+    sn_assert((strcmp((((char * *)__sn__m22_lines->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__m22_lines->len : __ai__; })]), "  done") == 0), "m22 line 4 - 2sp");
+    
+    sn_print("test_mixed_2_2: PASS\n");
+    
+    sn_auto_str char * __sn__mixed_4_4 = strdup("fn example():\n    var x: int = 1\n    if true:\n        nested\n    done\n\n");
+    sn_auto_arr SnArray * __sn__m44_lines = __sn___splitLines(&__sn__mixed_4_4);
+    sn_assert((sn_array_length(__sn__m44_lines) >= 5LL), "mixed_4_4 has at least 5 lines");
+    
+    sn_assert((strcmp((((char * *)__sn__m44_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__m44_lines->len : __ai__; })]), "fn example():") == 0), "m44 line 0 - base");
+    
+    sn_assert((strcmp((((char * *)__sn__m44_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__m44_lines->len : __ai__; })]), "    var x: int = 1") == 0), "m44 line 1 - 4sp");
+    
+    sn_assert((strcmp((((char * *)__sn__m44_lines->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__m44_lines->len : __ai__; })]), "    if true:") == 0), "m44 line 2 - 4sp");
+    
+    sn_assert((strcmp((((char * *)__sn__m44_lines->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__m44_lines->len : __ai__; })]), "        nested") == 0), "m44 line 3 - 8sp (4+4)");
+    
+    sn_assert((strcmp((((char * *)__sn__m44_lines->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__m44_lines->len : __ai__; })]), "    done") == 0), "m44 line 4 - 4sp");
+    
+    sn_print("test_mixed_4_4: PASS\n");
+    
+    sn_auto_str char * __sn__fn_name = strdup("greet");
+    sn_auto_str char * __sn__interp_2sp = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("fn ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__fn_name);
+            sn_auto_str char *__is_p2__ = sn_strdup("():\n  print(\"hi\")\n\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });
+    sn_auto_arr SnArray * __sn__i2_lines = __sn___splitLines(&__sn__interp_2sp);
+    sn_assert((sn_array_length(__sn__i2_lines) >= 2LL), "interp_2sp has at least 2 lines");
+    
+    sn_assert((strcmp((((char * *)__sn__i2_lines->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__i2_lines->len : __ai__; })]), "fn greet():") == 0), "i2sp line 0 - interpolated");
+    
+    sn_assert((strcmp((((char * *)__sn__i2_lines->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__i2_lines->len : __ai__; })]), "  print(\"hi\")") == 0), "i2sp line 1 - 2sp indent");
+    
+    sn_print("test_interp_two_space: PASS\n");
+    
+    sn_print("\nAll pipe block string tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
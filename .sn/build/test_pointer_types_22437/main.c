@@ -0,0 +1,86 @@
+#include "sn_types.h"
+
+
+
+bool test_pointer_type_param(long long * __sn__p) {
+
+    if ((__sn__p == NULL)) {
+        return true;}
+
+    return false;}
+
+bool test_void_pointer_param(void * __sn__p) {
+
+    if ((__sn__p == NULL)) {
+        return true;}
+
+    return false;}
+
+bool test_double_pointer_param(long long * * __sn__pp) {
+
+    if ((__sn__pp == NULL)) {
+        return true;}
+
+    return false;}
+
+void test_pointer_variable() {
+
+    long long * __sn__p = NULL;
+
+    if ((__sn__p == NULL)) {
+        sn_print("p is nil (expected)\n");
+        
+    } else {
+        sn_print("p is not nil (unexpected)\n");
+        
+    }
+
+    void * __sn__vp = NULL;
+
+    if ((__sn__vp == NULL)) {
+        sn_print("void pointer is nil (expected)\n");
+        
+    }
+
+    long long * * __sn__pp = NULL;
+
+    if ((__sn__pp == NULL)) {
+        sn_print("double pointer is nil (expected)\n");
+        
+    }
+}
+
+int main() {
+    test_pointer_variable();
+    
+    bool __sn__result = test_pointer_type_param(NULL);
+    if (__sn__result) {
+        sn_print("test_pointer_type_param passed\n");
+        
+    } else {
+        sn_print("test_pointer_type_param failed\n");
+        
+    }
+    (__sn__result = test_void_pointer_param(NULL));
+    
+    if (__sn__result) {
+        sn_print("test_void_pointer_param passed\n");
+        
+    } else {
+        sn_print("test_void_pointer_param failed\n");
+        
+    }
+    (__sn__result = test_double_pointer_param(NULL));
+    
+    if (__sn__result) {
+        sn_print("test_double_pointer_param passed\n");
+        
+    } else {
+        sn_print("test_double_pointer_param failed\n");
+        
+    }
+    sn_print("All pointer type tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,143 @@
+#include "sn_types.h"
+char * mock_getenv(char *);
+
+
+
+long long * get_int_ptr() {
+
+    return NULL;}
+
+long long unwrap_int_pointer(long long * __sn__ptr) {
+
+    if ((__sn__ptr == NULL)) {
+        return (-1LL);}
+
+    return (*(__sn__ptr));}
+
+void test_int_unwrap() {
+
+    sn_print("Test 1: *int unwrap with 'as val'\n");
+    
+
+    long long * __sn__ptr = get_int_ptr();
+
+    long long __sn__result = unwrap_int_pointer(__sn__ptr);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  nil pointer unwrap returns: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    sn_print("  *int unwrap test: OK\n");
+    
+}
+
+char * get_env_value() {
+
+    return NULL;}
+
+char * get_environment_var(char * __sn__ptr) {
+
+    if ((__sn__ptr == NULL)) {
+        return strdup("(not set)");}
+
+    return (__sn__ptr ? strdup(__sn__ptr) : NULL);}
+
+void test_char_unwrap() {
+
+    sn_print("Test 2: *char to str unwrap with 'as val'\n");
+    
+
+    char * __sn__env_ptr = get_env_value();
+
+    sn_auto_str char * __sn__value = get_environment_var(__sn__env_ptr);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Environment value: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__value);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    sn_print("  *char to str unwrap test: OK\n");
+    
+}
+
+unsigned char * get_buffer() {
+
+    return NULL;}
+
+long long get_buffer_len() {
+
+    return 8LL;}
+
+SnArray * unwrap_buffer(unsigned char * __sn__ptr, long long __sn__len) {
+
+    if ((__sn__ptr == NULL)) {
+        return sn_array_from_ptr(__sn__ptr, 0LL, 0LL);}
+
+    return sn_array_from_ptr(__sn__ptr, 0LL, __sn__len);}
+
+void test_buffer_unwrap() {
+
+    sn_print("Test 3: buffer unwrap with ptr[0..len] as val\n");
+    
+
+    long long __sn__len = get_buffer_len();
+
+    unsigned char * __sn__ptr = get_buffer();
+
+    sn_auto_arr SnArray * __sn__data = sn_array_from_ptr(__sn__ptr, 0LL, __sn__len);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Buffer slice created with length param: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__len));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Array length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__data)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    sn_auto_arr SnArray * __sn__data2 = unwrap_buffer(__sn__ptr, __sn__len);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Via unwrap_buffer fn, length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__data2)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    sn_print("  Buffer unwrap test: OK\n");
+    
+}
+
+int main() {
+    sn_print("=== Pointer Unwrap Integration Tests ===\n\n");
+    
+    test_int_unwrap();
+    
+    sn_print("\n");
+    
+    test_char_unwrap();
+    
+    sn_print("\n");
+    
+    test_buffer_unwrap();
+    
+    sn_print("\n=== All pointer unwrap tests passed! ===\n");
+    
+    fflush(stdout);
+    return 0;
+}
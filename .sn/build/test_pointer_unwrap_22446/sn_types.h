@@ -0,0 +1,34 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long * get_int_ptr();
+long long unwrap_int_pointer(long long *);
+void test_int_unwrap();
+char * get_env_value();
+char * get_environment_var(char *);
+void test_char_unwrap();
+unsigned char * get_buffer();
+long long get_buffer_len();
+SnArray * unwrap_buffer(unsigned char *, long long);
+void test_buffer_unwrap();
+
+
+
+
+#endif
@@ -0,0 +1,12 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("a\tb\tc\n");
+    
+    sn_print("1\t2\t3\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include "sn_types.h"
+
+
+
+long long invoke_comparator(void * __sn__cmp, void * __sn__a, void * __sn__b) {
+
+    return ((long long (*)(void *, void *, void *))((__Closure__ *)__sn__cmp)->fn)(__sn__cmp, __sn__a, __sn__b);}
+
+long long test_nil_comparison(void * __sn__cmp) {
+
+    return invoke_comparator(__sn__cmp, NULL, NULL);}
+
+long long run_comparator_test() {
+
+    sn_auto_fn void * __sn__cmp = ({
+        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __cl__->fn = (void *)__lambda_0__;
+        __cl__->size = sizeof(__Closure__);
+        __cl__->__cleanup__ = NULL;
+        __cl__->__rc__ = 1;
+        __cl__;
+    });
+
+    long long __sn__result = test_nil_comparison(__sn__cmp);
+
+    return __sn__result;}
+
+int main() {
+    sn_print("Testing qsort-style native comparator callback\n");
+    
+    long long __sn__result = run_comparator_test();
+    if ((__sn__result == 0LL)) {
+        sn_print("PASS: Comparator callback executed correctly\n");
+        
+        sn_print("- Defined type Comparator = native fn(a: *void, b: *void): int\n");
+        
+        sn_print("- Created native lambda matching Comparator signature\n");
+        
+        sn_print("- Passed callback to native function\n");
+        
+        sn_print("- Callback returned expected comparison result\n");
+        
+        return 0LL;} else {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: Unexpected comparator result: ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 1LL;}
+    fflush(stdout);
+    return 0;
+}
+
+static long long __lambda_0__(void *__closure__, void * __sn__a, void * __sn__b) {
+    if ((__sn__a == __sn__b)) {
+        return 0LL;}
+    if ((__sn__a == NULL)) {
+        return (-1LL);}
+    if ((__sn__b == NULL)) {
+        return 1LL;}
+    return 0LL;}
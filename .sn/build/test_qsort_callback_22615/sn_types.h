@@ -0,0 +1,29 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+#include <stdlib.h>
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+long long invoke_comparator(void *, void *, void *);
+long long test_nil_comparison(void *);
+long long run_comparator_test();
+
+
+
+static long long __lambda_0__(void *__closure__, void * __sn__a, void * __sn__b);
+
+#endif
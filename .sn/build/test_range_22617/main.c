@@ -0,0 +1,72 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__r1 = sn_array_range(1LL, 5LL);
+    sn_print("Range 1..5: ");
+    
+    { char *__ps__ = sn_array_to_string(__sn__r1); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__r1)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__start = 3LL;
+    long long __sn__end = 8LL;
+    sn_auto_arr SnArray * __sn__r2 = sn_array_range(__sn__start, __sn__end);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Range ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__start));
+            sn_auto_str char *__is_p2__ = sn_strdup("..");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__end));
+            sn_auto_str char *__is_p4__ = sn_strdup(": ");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { char *__ps__ = sn_array_to_string(__sn__r2); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 0LL });
+            { SnArray *__rng__ = sn_array_range(1LL, 4LL); sn_array_extend(__al__, __rng__); sn_array_free(__rng__); }
+            sn_array_push(__al__, &(long long){ 10LL });
+            __al__;
+        });
+    sn_print("Array with range {0, 1..4, 10}: ");
+    
+    { char *__ps__ = sn_array_to_string(__sn__arr); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    long long __sn__sum = 0LL;
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(1LL, 6LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__n = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                (__sn__sum = sn_add_long(__sn__sum, __sn__n));
+                
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sum of 1..6: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
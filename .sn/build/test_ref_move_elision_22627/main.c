@@ -0,0 +1,193 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__build(long long __sn__n) {
+
+    sn_auto_arr SnArray * __sn__out = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Node *), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Node_release_elem;
+            __al__->elem_copy = __sn__Node_retain_into;
+            __al__;
+        });
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, __sn__n); __sn__i = __sn__i + 1LL) {
+            sn_auto_Node __sn__Node * __sn__x = ({
+                __sn__Node *__tmp__ = __sn__Node__new();
+                __tmp__->__sn__v = __sn__i;
+                __tmp__;
+            });
+            (__sn__x->__sn__v = sn_mul_long(__sn__x->__sn__v, 2LL));
+            
+            __sn__arr_push(&__sn__out, __sn__Node_retain(__sn__x));
+            
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__out;
+        __sn__out = NULL;
+        return __ret__;
+    }}
+
+
+__sn__Pair * __sn__pair(long long __sn__a, long long __sn__b) {
+
+    sn_auto_Node __sn__Node * __sn__l = ({
+        __sn__Node *__tmp__ = __sn__Node__new();
+        __tmp__->__sn__v = __sn__a;
+        __tmp__;
+    });
+
+    sn_auto_Node __sn__Node * __sn__r = ({
+        __sn__Node *__tmp__ = __sn__Node__new();
+        __tmp__->__sn__v = __sn__b;
+        __tmp__;
+    });
+
+    return ({
+        __sn__Pair *__tmp__ = __sn__Pair__new();
+        __tmp__->__sn__left = __sn__Node_retain(__sn__l);
+        __tmp__->__sn__right = __sn__Node_retain(__sn__r);
+        __tmp__;
+    });}
+
+
+__sn__Node * __sn__pick(bool __sn__flag) {
+
+    sn_auto_Node __sn__Node * __sn__keep = ({
+        __sn__Node *__tmp__ = __sn__Node__new();
+        __tmp__->__sn__v = 1LL;
+        __tmp__;
+    });
+
+    sn_auto_Node __sn__Node * __sn__n = ({
+        __sn__Node *__tmp__ = __sn__Node__new();
+        __tmp__->__sn__v = 2LL;
+        __tmp__;
+    });
+
+    if (__sn__flag) {
+        ({
+            __sn__Node *__old__ = __sn__keep;
+            __sn__keep = __sn__Node_retain(__sn__n);
+            __sn__Node_release(&__old__);
+            __sn__keep;
+        });
+        
+    }
+
+    {
+        __sn__Node * __ret__ = __sn__keep;
+        __sn__keep = NULL;
+        return __ret__;
+    }}
+
+
+long long __sn__reuse() {
+
+    sn_auto_Node __sn__Node * __sn__shared = ({
+        __sn__Node *__tmp__ = __sn__Node__new();
+        __tmp__->__sn__v = 3LL;
+        __tmp__;
+    });
+
+    long long __sn__total = 0LL;
+
+    sn_auto_arr SnArray * __sn__xs = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Node *), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Node_release_elem;
+            __al__->elem_copy = __sn__Node_retain_into;
+            __al__;
+        });
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 3LL); __sn__i = __sn__i + 1LL) {
+            __sn__arr_push(&__sn__xs, __sn__Node_retain(__sn__shared));
+            
+            (__sn__total = sn_add_long(__sn__total, __sn__shared->__sn__v));
+            
+        }
+    }
+
+    sn_auto_Pair __sn__Pair * __sn__p = __sn__pair(0LL, 0LL);
+
+    sn_auto_Node __sn__Node * __sn__fresh = ({
+        __sn__Node *__tmp__ = __sn__Node__new();
+        __tmp__->__sn__v = 9LL;
+        __tmp__;
+    });
+
+    ({
+        __sn__Node *__old__ = __sn__p->__sn__left;
+        __sn__p->__sn__left = __sn__Node_retain(__sn__fresh);
+        __sn__Node_release(&__old__);
+        __sn__p->__sn__left;
+    });
+    
+
+    sn_auto_Node __sn__Node * __sn__four = ({
+        __sn__Node *__tmp__ = __sn__Node__new();
+        __tmp__->__sn__v = 4LL;
+        __tmp__;
+    });
+
+    sn_auto_arr SnArray * __sn__list = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Node *), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Node_release_elem;
+            __al__->elem_copy = __sn__Node_retain_into;
+            sn_array_push(__al__, &(__sn__Node *){ __sn__Node_retain(__sn__shared) });
+            sn_array_push(__al__, &(__sn__Node *){ __sn__Node_retain(__sn__four) });
+            __al__;
+        });
+
+    return sn_add_long(sn_add_long(sn_add_long(__sn__total, sn_array_length(__sn__xs)), __sn__p->__sn__left->__sn__v), sn_array_length(__sn__list));}
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__ns = __sn__build(4LL);
+    long long __sn__sum = 0LL;
+    {
+        SnArray *__arr_0__ = __sn__ns;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            __sn__Node * __sn__n = ((__sn__Node * *)__arr_0__->data)[__idx_0__];
+            {
+                (__sn__sum = sn_add_long(__sn__sum, __sn__n->__sn__v));
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__sum));
+    
+    sn_auto_Pair __sn__Pair * __sn__p = __sn__pair(5LL, 6LL);
+    printf("%lld\n", (long long)(sn_add_long(__sn__p->__sn__left->__sn__v, __sn__p->__sn__right->__sn__v)));
+    
+    sn_auto_Node __sn__Node * __sn__k1 = __sn__pick(true);
+    sn_auto_Node __sn__Node * __sn__k2 = __sn__pick(false);
+    printf("%lld\n", (long long)(__sn__k1->__sn__v));
+    
+    printf("%lld\n", (long long)(__sn__k2->__sn__v));
+    
+    sn_auto_Node __sn__Node * __sn__a = ({
+        __sn__Node *__tmp__ = __sn__Node__new();
+        __tmp__->__sn__v = 7LL;
+        __tmp__;
+    });
+    sn_auto_Node __sn__Node * __sn__b = __sn__Node_retain(__sn__a);
+    printf("%lld\n", (long long)(__sn__b->__sn__v));
+    
+    printf("%lld\n", (long long)(__sn__reuse()));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,131 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Node (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__v;
+} __sn__Node;
+
+
+static inline __sn__Node *__sn__Node__new(void) {
+    __sn__Node *p = calloc(1, sizeof(__sn__Node));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Node *__sn__Node_retain(__sn__Node *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Node_release(__sn__Node **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Node *__sn__Node_copy(const __sn__Node *src) {
+    __sn__Node *dst = calloc(1, sizeof(__sn__Node));
+    dst->__rc__ = 1;
+    dst->__sn__v = src->__sn__v;
+    return dst;
+}
+
+#define sn_auto_Node __attribute__((cleanup(__sn__Node_release)))
+#define sn_auto_ref_Node __attribute__((cleanup(__sn__Node_release)))
+
+static inline void __sn__Node_release_elem(void *p) { __sn__Node_release((__sn__Node **)p); }
+static inline void __sn__Node_retain_into(const void *src, void *dst) { *(__sn__Node **)dst = __sn__Node_retain(*(__sn__Node *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Node_to_string(const __sn__Node *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Node { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "v: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__v);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+/* Struct: Pair (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    __sn__Node * __sn__left;
+    __sn__Node * __sn__right;
+} __sn__Pair;
+
+
+static inline __sn__Pair *__sn__Pair__new(void) {
+    __sn__Pair *p = calloc(1, sizeof(__sn__Pair));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Pair *__sn__Pair_retain(__sn__Pair *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Pair_release(__sn__Pair **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        __sn__Node_release(&(*p)->__sn__left);
+        __sn__Node_release(&(*p)->__sn__right);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Pair *__sn__Pair_copy(const __sn__Pair *src) {
+    __sn__Pair *dst = calloc(1, sizeof(__sn__Pair));
+    dst->__rc__ = 1;
+    dst->__sn__left = __sn__Node_retain(src->__sn__left);
+    dst->__sn__right = __sn__Node_retain(src->__sn__right);
+    return dst;
+}
+
+#define sn_auto_Pair __attribute__((cleanup(__sn__Pair_release)))
+#define sn_auto_ref_Pair __attribute__((cleanup(__sn__Pair_release)))
+
+static inline void __sn__Pair_release_elem(void *p) { __sn__Pair_release((__sn__Pair **)p); }
+static inline void __sn__Pair_retain_into(const void *src, void *dst) { *(__sn__Pair **)dst = __sn__Pair_retain(*(__sn__Pair *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Pair_to_string(const __sn__Pair *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Pair { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "left: ");
+    { char *__fs__ = __sn__Node_to_string(p->__sn__left); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "right: ");
+    { char *__fs__ = __sn__Node_to_string(p->__sn__right); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+SnArray * __sn__build(long long);
+__sn__Pair * __sn__pair(long long, long long);
+__sn__Node * __sn__pick(bool);
+long long __sn__reuse();
+
+
+
+
+#endif
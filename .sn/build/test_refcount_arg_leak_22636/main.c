@@ -0,0 +1,80 @@
+#include "sn_types.h"
+__sn__Foo * foo_create(long long);
+long long foo_alive();
+
+
+
+
+long long __sn__consume(long long __sn__val) {
+
+    return __sn__val;}
+
+
+long long __sn__case1() {
+
+    sn_auto_Foo __sn__Foo * __sn____chain_tmp_0 = foo_create(1LL);
+
+    return __sn__consume(foo_get_x(__sn____chain_tmp_0));}
+
+
+long long __sn__case2() {
+
+    sn_auto_Foo __sn__Foo * __sn____chain_tmp_1 = foo_create(2LL);
+
+    return foo_get_x(__sn____chain_tmp_1);}
+
+
+long long __sn__case3() {
+
+    sn_auto_Foo __sn__Foo * __sn____chain_tmp_2 = foo_create(3LL);
+
+    sn_auto_Foo __sn__Foo * __sn____chain_tmp_3 = foo_create(4LL);
+
+    return sn_add_long(__sn__consume(foo_get_x(__sn____chain_tmp_2)), __sn__consume(foo_get_x(__sn____chain_tmp_3)));}
+
+
+int main() {
+    long long __sn__r1 = __sn__case1();
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 1: expected 1, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r1));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__r1 == 1LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 1: leaked, alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(foo_alive()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((foo_alive() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    long long __sn__r2 = __sn__case2();
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 2: expected 2, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r2));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__r2 == 2LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 2: leaked, alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(foo_alive()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((foo_alive() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    long long __sn__r3 = __sn__case3();
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 3: expected 7, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r3));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__r3 == 7LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 3: leaked, alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(foo_alive()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((foo_alive() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    sn_println("test_refcount_arg_leak: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,64 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Foo (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__x;
+} __sn__Foo;
+
+
+static inline __sn__Foo *__sn__Foo__new(void) {
+    __sn__Foo *p = calloc(1, sizeof(__sn__Foo));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Foo *__sn__Foo_retain(__sn__Foo *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+void foo_dispose(__sn__Foo *);
+static inline void __sn__Foo_release(__sn__Foo **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        foo_dispose(*p);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Foo __attribute__((cleanup(__sn__Foo_release)))
+#define sn_auto_ref_Foo __attribute__((cleanup(__sn__Foo_release)))
+
+static inline void __sn__Foo_release_elem(void *p) { __sn__Foo_release((__sn__Foo **)p); }
+static inline void __sn__Foo_retain_into(const void *src, void *dst) { *(__sn__Foo **)dst = __sn__Foo_retain(*(__sn__Foo *const *)src); }
+
+
+long long __sn__consume(long long);
+long long __sn__case1();
+long long __sn__case2();
+long long __sn__case3();
+
+void foo_dispose(__sn__Foo *);
+long long foo_get_x(__sn__Foo *);
+
+
+
+#endif
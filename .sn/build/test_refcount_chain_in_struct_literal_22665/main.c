@@ -0,0 +1,78 @@
+#include "sn_types.h"
+__sn__Tracker * tracker_create(long long);
+long long tracker_alive_count();
+
+
+
+
+__sn__Result __sn__makeResult() {
+
+    sn_auto_Tracker __sn__Tracker * __sn____chain_tmp_0 = tracker_create(1LL);
+
+    return (__sn__Result){ .__sn__value = tracker_get_value(__sn____chain_tmp_0) };}
+
+
+__sn__Result __sn__makeResultLocal() {
+
+    sn_auto_Tracker __sn__Tracker * __sn____chain_tmp_1 = tracker_create(2LL);
+
+    __sn__Result __sn__r = (__sn__Result){ .__sn__value = tracker_get_value(__sn____chain_tmp_1) };
+
+    return __sn__r;}
+
+
+__sn__Result __sn__makeResultInline() {
+
+    sn_auto_Tracker __sn__Tracker * __sn____chain_tmp_2 = tracker_create(3LL);
+
+    __sn__Result __sn__r = (__sn__Result){ .__sn__value = tracker_get_value(__sn____chain_tmp_2) };
+
+    return __sn__r;}
+
+
+
+int main() {
+    __sn__Result __sn__r1 = __sn__makeResult();
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 1: expected 1, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r1.__sn__value));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__r1.__sn__value == 1LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 1: leaked tracker, alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tracker_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((tracker_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    __sn__Result __sn__r2 = __sn__makeResultLocal();
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 2: expected 2, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r2.__sn__value));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__r2.__sn__value == 2LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 2: leaked tracker, alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tracker_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((tracker_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    __sn__Result __sn__r3 = __sn__makeResultInline();
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 3: expected 3, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r3.__sn__value));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__r3.__sn__value == 3LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("case 3: leaked tracker, alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tracker_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((tracker_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    sn_println("test_refcount_chain_in_struct_literal: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
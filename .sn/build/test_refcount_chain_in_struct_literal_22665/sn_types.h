@@ -0,0 +1,111 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Tracker (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__id;
+} __sn__Tracker;
+
+
+static inline __sn__Tracker *__sn__Tracker__new(void) {
+    __sn__Tracker *p = calloc(1, sizeof(__sn__Tracker));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Tracker *__sn__Tracker_retain(__sn__Tracker *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+void tracker_dispose(__sn__Tracker *);
+static inline void __sn__Tracker_release(__sn__Tracker **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        tracker_dispose(*p);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Tracker __attribute__((cleanup(__sn__Tracker_release)))
+#define sn_auto_ref_Tracker __attribute__((cleanup(__sn__Tracker_release)))
+
+static inline void __sn__Tracker_release_elem(void *p) { __sn__Tracker_release((__sn__Tracker **)p); }
+static inline void __sn__Tracker_retain_into(const void *src, void *dst) { *(__sn__Tracker **)dst = __sn__Tracker_retain(*(__sn__Tracker *const *)src); }
+
+/* Struct: Result (as val) */
+typedef struct {
+    long long __sn__value;
+} __sn__Result;
+/* Value operations */
+static inline __sn__Result __sn__Result_copy(const __sn__Result *src) {
+    __sn__Result dst;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Result_cleanup(__sn__Result *p) {
+
+}
+
+#define sn_auto_Result __attribute__((cleanup(__sn__Result_cleanup)))
+
+static inline void __sn__Result_cleanup_elem(void *p) { __sn__Result_cleanup((__sn__Result *)p); }
+static inline void __sn__Result_copy_into(const void *src, void *dst) { *(__sn__Result *)dst = __sn__Result_copy((const __sn__Result *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Result *__sn__Result_alloc(void) {
+    return calloc(1, sizeof(__sn__Result));
+}
+
+static inline void __sn__Result_release(__sn__Result **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Result __attribute__((cleanup(__sn__Result_release)))
+
+static inline void __sn__Result_release_elem(void *p) { __sn__Result_release((__sn__Result **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Result_to_string(const __sn__Result *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Result { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Result __sn__makeResult();
+__sn__Result __sn__makeResultLocal();
+__sn__Result __sn__makeResultInline();
+
+void tracker_dispose(__sn__Tracker *);
+long long tracker_get_value(__sn__Tracker *);
+
+
+
+#endif
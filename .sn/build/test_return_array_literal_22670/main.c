@@ -0,0 +1,173 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__getInts() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });}
+
+
+SnArray * __sn__getDoubles() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 3);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.1000000000000001 });
+            sn_array_push(__al__, &(double){ 2.2000000000000002 });
+            sn_array_push(__al__, &(double){ 3.2999999999999998 });
+            __al__;
+        });}
+
+
+SnArray * __sn__getStrings() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("alice") });
+            sn_array_push(__al__, &(char *){ strdup("bob") });
+            sn_array_push(__al__, &(char *){ strdup("charlie") });
+            __al__;
+        });}
+
+
+SnArray * __sn__getBools() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 3);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        });}
+
+
+SnArray * __sn__getEmpty() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+    
+            __al__;
+        });}
+
+
+SnArray * __sn__getFromParams(long long __sn__a, long long __sn__b, long long __sn__c) {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ __sn__a });
+            sn_array_push(__al__, &(long long){ __sn__b });
+            sn_array_push(__al__, &(long long){ __sn__c });
+            __al__;
+        });}
+
+
+
+SnArray * __sn__Container_getPoints(__sn__Container *__sn__self) {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 1LL, .__sn__y = 2LL }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 3LL, .__sn__y = 4LL }));
+            __al__;
+        });}
+
+int main() {
+    sn_auto_arr SnArray * __sn__ints = __sn__getInts();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__ints->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__ints->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__ints->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__ints->len : __ai__; })])));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__ints->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__ints->len : __ai__; })])));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__doubles = __sn__getDoubles();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%.5f", (double)((((double *)__sn__doubles->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__doubles->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%.5f", (double)((((double *)__sn__doubles->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__doubles->len : __ai__; })])));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%.5f", (double)((((double *)__sn__doubles->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__doubles->len : __ai__; })])));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__strings = __sn__getStrings();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((((char * *)__sn__strings->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__strings->len : __ai__; })]));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_strdup((((char * *)__sn__strings->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__strings->len : __ai__; })]));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_strdup((((char * *)__sn__strings->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__strings->len : __ai__; })]));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__bools = __sn__getBools();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(((((bool *)__sn__bools->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__bools->len : __ai__; })])) ? "true" : "false");
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_strdup(((((bool *)__sn__bools->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__bools->len : __ai__; })])) ? "true" : "false");
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_strdup(((((bool *)__sn__bools->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__bools->len : __ai__; })])) ? "true" : "false");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__empty = __sn__getEmpty();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__empty)));
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__params = __sn__getFromParams(10LL, 20LL, 30LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__params->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__params->len : __ai__; })])));
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__params->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__params->len : __ai__; })])));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__params->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__params->len : __ai__; })])));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Container __sn__Container __sn__c = (__sn__Container){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__;
+        }) };
+    sn_auto_arr SnArray * __sn__points = __sn__Container_getPoints(&__sn__c);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((__sn__Point *)__sn__points->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__points->len : __ai__; })]).__sn__x));
+            sn_auto_str char *__is_p1__ = sn_strdup(",");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)((((__sn__Point *)__sn__points->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__points->len : __ai__; })]).__sn__y));
+            sn_auto_str char *__is_p3__ = sn_strdup(" ");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)((((__sn__Point *)__sn__points->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__points->len : __ai__; })]).__sn__x));
+            sn_auto_str char *__is_p5__ = sn_strdup(",");
+            sn_auto_str char *__is_p6__ = sn_str_fmt("%lld", (long long)((((__sn__Point *)__sn__points->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__points->len : __ai__; })]).__sn__y));
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_println(__ps__); };
+    
+    sn_println("PASS");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Container __sn__makeContainer() {
+
+    sn_auto_arr SnArray * __sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("alpha") });
+            sn_array_push(__al__, &(char *){ strdup("beta") });
+            sn_array_push(__al__, &(char *){ strdup("gamma") });
+            __al__;
+        });
+
+    return (__sn__Container){ .__sn__id = strdup("test"), .__sn__items = sn_array_copy(__sn__items), .__sn__count = 3LL };}
+
+
+SnArray * __sn__getItems() {
+
+    sn_auto_Container __sn__Container __sn__c = __sn__makeContainer();
+
+    return sn_array_copy(__sn__c.__sn__items);}
+
+
+char * __sn__getId() {
+
+    sn_auto_Container __sn__Container __sn__c = __sn__makeContainer();
+
+    return strdup(__sn__c.__sn__id);}
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__items = __sn__getItems();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("items: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_strdup((((char * *)__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_strdup((((char * *)__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]));
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("count: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__items)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_str char * __sn__id = __sn__getId();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("id: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__id);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__items2 = __sn__getItems();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("items2: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__items2->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__items2->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_strdup((((char * *)__sn__items2->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__items2->len : __ai__; })]));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_strdup((((char * *)__sn__items2->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__items2->len : __ai__; })]));
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    sn_println("done");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Container (as val) */
+typedef struct {
+    char * __sn__id;
+    SnArray * __sn__items;
+    long long __sn__count;
+} __sn__Container;
+/* Value operations */
+static inline __sn__Container __sn__Container_copy(const __sn__Container *src) {
+    __sn__Container dst;
+    dst.__sn__id = src->__sn__id ? strdup(src->__sn__id) : NULL;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    dst.__sn__count = src->__sn__count;
+    return dst;
+}
+
+static inline void __sn__Container_cleanup(__sn__Container *p) {
+    free(p->__sn__id);
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_Container __attribute__((cleanup(__sn__Container_cleanup)))
+
+static inline void __sn__Container_cleanup_elem(void *p) { __sn__Container_cleanup((__sn__Container *)p); }
+static inline void __sn__Container_copy_into(const void *src, void *dst) { *(__sn__Container *)dst = __sn__Container_copy((const __sn__Container *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Container *__sn__Container_alloc(void) {
+    return calloc(1, sizeof(__sn__Container));
+}
+
+static inline void __sn__Container_release(__sn__Container **p) {
+    if (*p) {
+        free((*p)->__sn__id);
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Container __attribute__((cleanup(__sn__Container_release)))
+
+static inline void __sn__Container_release_elem(void *p) { __sn__Container_release((__sn__Container **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Container_to_string(const __sn__Container *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Container { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__id ? p->__sn__id : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "count: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__count);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Container __sn__makeContainer();
+SnArray * __sn__getItems();
+char * __sn__getId();
+
+
+
+
+#endif
@@ -0,0 +1,90 @@
+#include "sn_types.h"
+
+__sn__Tensor * __sn__g_cache = {0};
+
+
+
+__sn__Tensor * __sn__storeAndReturn(__sn__Tensor * __sn__t) {
+
+    ({
+        __sn__Tensor *__old__ = __sn__g_cache;
+        __sn__g_cache = __sn__Tensor_retain(__sn__t);
+        __sn__Tensor_release(&__old__);
+        __sn__g_cache;
+    });
+    
+
+    return __sn__Tensor_retain(__sn__t);}
+
+
+__sn__Tensor * __sn__passThrough(__sn__Tensor * __sn__t) {
+
+    return __sn__Tensor_retain(__sn__t);}
+
+
+int main() {
+    __sn__g_cache = ({
+    __sn__Tensor *__tmp__ = __sn__Tensor__new();
+    __tmp__->__sn__value = 0LL;
+    __tmp__;
+});
+    sn_auto_Tensor __sn__Tensor * __sn__a = ({
+        __sn__Tensor *__tmp__ = __sn__Tensor__new();
+        __tmp__->__sn__value = 42LL;
+        __tmp__;
+    });
+    sn_auto_Tensor __sn__Tensor * __sn__b = __sn__passThrough(__sn__a);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("a=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__a->__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(" b=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__b->__sn__value));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Tensor __sn__Tensor * __sn__c = ({
+        __sn__Tensor *__tmp__ = __sn__Tensor__new();
+        __tmp__->__sn__value = 7LL;
+        __tmp__;
+    });
+    sn_auto_Tensor __sn__Tensor * __sn__d = __sn__storeAndReturn(__sn__c);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("c=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c->__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(" d=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__d->__sn__value));
+            sn_auto_str char *__is_p4__ = sn_strdup(" cache=");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__g_cache->__sn__value));
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Tensor __sn__Tensor * __sn__e = ({
+        __sn__Tensor *__tmp__ = __sn__Tensor__new();
+        __tmp__->__sn__value = 99LL;
+        __tmp__;
+    });
+    ({
+        __sn__Tensor *__old__ = __sn__g_cache;
+        __sn__g_cache = __sn__Tensor_retain(__sn__e);
+        __sn__Tensor_release(&__old__);
+        __sn__g_cache;
+    });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("after restash: a=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__a->__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(" c=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__c->__sn__value));
+            sn_auto_str char *__is_p4__ = sn_strdup(" e=");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__e->__sn__value));
+            sn_auto_str char *__is_p6__ = sn_strdup(" cache=");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__g_cache->__sn__value));
+            sn_str_concat_multi(8, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__);
+        }); sn_println(__ps__); };
+    
+    sn_println("PASS");
+    
+    __sn__Tensor_release(&__sn__g_cache);
+    fflush(stdout);
+    return 0;
+}
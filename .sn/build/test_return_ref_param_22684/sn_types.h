@@ -0,0 +1,75 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Tensor (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__value;
+} __sn__Tensor;
+
+
+static inline __sn__Tensor *__sn__Tensor__new(void) {
+    __sn__Tensor *p = calloc(1, sizeof(__sn__Tensor));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Tensor *__sn__Tensor_retain(__sn__Tensor *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Tensor_release(__sn__Tensor **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Tensor *__sn__Tensor_copy(const __sn__Tensor *src) {
+    __sn__Tensor *dst = calloc(1, sizeof(__sn__Tensor));
+    dst->__rc__ = 1;
+    dst->__sn__value = src->__sn__value;
+    return dst;
+}
+
+#define sn_auto_Tensor __attribute__((cleanup(__sn__Tensor_release)))
+#define sn_auto_ref_Tensor __attribute__((cleanup(__sn__Tensor_release)))
+
+static inline void __sn__Tensor_release_elem(void *p) { __sn__Tensor_release((__sn__Tensor **)p); }
+static inline void __sn__Tensor_retain_into(const void *src, void *dst) { *(__sn__Tensor **)dst = __sn__Tensor_retain(*(__sn__Tensor *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Tensor_to_string(const __sn__Tensor *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Tensor { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+extern __sn__Tensor * __sn__g_cache;
+
+__sn__Tensor * __sn__storeAndReturn(__sn__Tensor *);
+__sn__Tensor * __sn__passThrough(__sn__Tensor *);
+
+
+
+
+#endif
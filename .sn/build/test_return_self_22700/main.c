@@ -0,0 +1,64 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Builder __sn__Builder_setValue(__sn__Builder *__sn__self, long long __sn__v) {
+
+    (__sn__self->__sn__value = __sn__v);
+    
+
+    return __sn__Builder_copy(__sn__self);}
+
+__sn__Builder __sn__Builder_setName(__sn__Builder *__sn__self, char * __sn__n) {
+
+    ({
+        char *__ma_str_tmp__ = strdup(__sn__n);
+        free(__sn__self->__sn__name);
+        __sn__self->__sn__name = __ma_str_tmp__;
+        __sn__self->__sn__name;
+    });
+    
+
+    return __sn__Builder_copy(__sn__self);}
+
+int main() {
+    sn_auto_Builder __sn__Builder __sn__b = (__sn__Builder){ .__sn__value = 0LL, .__sn__name = strdup("") };
+    ({
+        __sn__Builder __tmp__ = __sn__Builder_setValue(&__sn__b, 42LL);
+        __sn__Builder_cleanup(&__sn__b);
+        __sn__b = __tmp__;
+        __sn__b;
+    });
+    
+    if ((__sn__b.__sn__value != 42LL)) {
+        sn_print("setValue return self: FAIL\n");
+        
+        return 1LL;}
+    sn_print("setValue return self: PASS\n");
+    
+    sn_auto_Builder __sn__Builder __sn__b2 = (__sn__Builder){ .__sn__value = 0LL, .__sn__name = strdup("") };
+    sn_auto_Builder __sn__Builder __sn____chain_tmp_0 = __sn__Builder_setValue(&__sn__b2, 100LL);
+    ({
+        __sn__Builder __tmp__ = __sn__Builder_setName(&__sn____chain_tmp_0, "test");
+        __sn__Builder_cleanup(&__sn__b2);
+        __sn__b2 = __tmp__;
+        __sn__b2;
+    });
+    
+    if ((__sn__b2.__sn__value != 100LL)) {
+        sn_print("chained setValue: FAIL\n");
+        
+        return 1LL;}
+    sn_print("chained setValue: PASS\n");
+    
+    if ((strcmp(__sn__b2.__sn__name, "test") != 0)) {
+        sn_print("chained setName: FAIL\n");
+        
+        return 1LL;}
+    sn_print("chained setName: PASS\n");
+    
+    sn_print("All return self tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,81 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Builder (as val) */
+typedef struct {
+    long long __sn__value;
+    char * __sn__name;
+} __sn__Builder;
+/* Value operations */
+static inline __sn__Builder __sn__Builder_copy(const __sn__Builder *src) {
+    __sn__Builder dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__Builder_cleanup(__sn__Builder *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Builder __attribute__((cleanup(__sn__Builder_cleanup)))
+
+static inline void __sn__Builder_cleanup_elem(void *p) { __sn__Builder_cleanup((__sn__Builder *)p); }
+static inline void __sn__Builder_copy_into(const void *src, void *dst) { *(__sn__Builder *)dst = __sn__Builder_copy((const __sn__Builder *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Builder *__sn__Builder_alloc(void) {
+    return calloc(1, sizeof(__sn__Builder));
+}
+
+static inline void __sn__Builder_release(__sn__Builder **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Builder __attribute__((cleanup(__sn__Builder_release)))
+
+static inline void __sn__Builder_release_elem(void *p) { __sn__Builder_release((__sn__Builder **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Builder_to_string(const __sn__Builder *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Builder { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+__sn__Builder __sn__Builder_setValue(__sn__Builder *, long long);
+__sn__Builder __sn__Builder_setName(__sn__Builder *, char *);
+
+
+
+#endif
@@ -0,0 +1,100 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        });
+    long long __sn__max_val = (((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__n = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if (sn_gt_long(__sn__n, __sn__max_val)) {
+                    (__sn__max_val = __sn__n);
+                    
+                }
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("max = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__max_val));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__sum = 0LL;
+    sn_auto_arr SnArray * __sn__nums = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+    {
+        SnArray *__arr_0__ = __sn__nums;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                {
+                    SnArray *__arr_0__ = __sn__nums;
+                    long long __len_0__ = __arr_0__->len;
+                    for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+                        long long __sn__j = ((long long *)__arr_0__->data)[__idx_0__];
+                        {
+                            if (sn_gt_long(__sn__i, 0LL)) {
+                                if (sn_gt_long(__sn__j, 0LL)) {
+                                    (__sn__sum = sn_add_long(__sn__sum, 1LL));
+                                    
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sum = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__count = 0LL;
+    long long __sn__limit = 5LL;
+    while (sn_lt_long(__sn__count, __sn__limit)) {
+        if (sn_gt_long(__sn__count, 2LL)) {
+            (__sn__limit = sn_sub_long(__sn__limit, 1LL));
+            
+        }
+        (__sn__count = sn_add_long(__sn__count, 1LL));
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("count = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup(", limit = ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__limit));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
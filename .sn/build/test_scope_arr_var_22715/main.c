@@ -0,0 +1,24 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__nums = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 15LL });
+            __al__;
+        });
+    long long __sn__sum = sn_add_long(sn_add_long((((long long *)__sn__nums->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__nums->len : __ai__; })]), (((long long *)__sn__nums->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__nums->len : __ai__; })])), (((long long *)__sn__nums->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__nums->len : __ai__; })]));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,19 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    bool __sn__flag = true;
+    if (__sn__flag) {
+        sn_print("yes\n");
+        
+    }
+    (__sn__flag = false);
+    
+    if ((!__sn__flag)) {
+        sn_print("no\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
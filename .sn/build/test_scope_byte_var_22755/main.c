@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    unsigned char __sn__b = 200LL;
+    unsigned char __sn__c = 55LL;
+    long long __sn__sum = sn_add_byte(__sn__b, __sn__c);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
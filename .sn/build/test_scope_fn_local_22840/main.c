@@ -0,0 +1,23 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__compute(long long __sn__n) {
+
+    long long __sn__result = sn_mul_long(__sn__n, __sn__n);
+
+    long long __sn__bonus = 10LL;
+
+    return sn_add_long(__sn__result, __sn__bonus);}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__compute(5LL)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,27 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__do_work(long long __sn__n) {
+
+    long long __sn__doubled = sn_mul_long(__sn__n, 2LL);
+
+    sn_auto_str char * __sn__msg = strdup("Result");
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__msg);
+            sn_auto_str char *__is_p1__ = sn_strdup(": ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__doubled));
+            sn_auto_str char *__is_p3__ = sn_strdup("\n");
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_print(__ps__); };
+    
+}
+
+int main() {
+    __sn__do_work(42LL);
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,27 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__outer(long long __sn__n) {
+
+    long long __sn__a = __sn__inner(__sn__n);
+
+    return sn_add_long(__sn__a, __sn__n);}
+
+
+long long __sn__inner(long long __sn__n) {
+
+    return sn_mul_long(__sn__n, 3LL);}
+
+int main() {
+    long long __sn__x = __sn__outer(5LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,21 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__x = 1LL;
+    if (sn_gt_long(__sn__x, 0LL)) {
+        long long __sn__y = 2LL;
+        if (sn_gt_long(__sn__y, 1LL)) {
+            long long __sn__z = 3LL;
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_add_long(sn_add_long(__sn__x, __sn__y), __sn__z)));
+                    sn_auto_str char *__is_p1__ = sn_strdup("\n");
+                    sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,27 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__i = 0LL;
+    long long __sn__total = 0LL;
+    while (sn_lt_long(__sn__i, 3LL)) {
+        long long __sn__j = 0LL;
+        while (sn_lt_long(__sn__j, 3LL)) {
+            __sn__total++;
+            
+            __sn__j++;
+            
+        }
+        __sn__i++;
+        
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__total));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include "sn_types.h"
+__sn__Resource * resource_create(long long, long long);
+long long resource_get_id(__sn__Resource *);
+long long resource_get_value(__sn__Resource *);
+void resource_update(__sn__Resource *, long long);
+void resource_process_array(SnArray *, long long);
+
+
+
+
+
+
+SnArray * __sn__Model_parameters(__sn__Model *__sn__self) {
+
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Resource *), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Resource_release_elem;
+            __al__->elem_copy = __sn__Resource_retain_into;
+            sn_array_push(__al__, &(__sn__Resource *){ __sn__Resource_retain(__sn__self->__sn__w1) });
+            sn_array_push(__al__, &(__sn__Resource *){ __sn__Resource_retain(__sn__self->__sn__w2) });
+            __al__;
+        });
+
+    {
+        SnArray * __ret__ = __sn__arr;
+        __sn__arr = NULL;
+        return __ret__;
+    }}
+
+__sn__Output __sn__Model_forward(__sn__Model *__sn__self) {
+
+    long long __sn__val1 = resource_get_value(__sn__self->__sn__w1);
+
+    long long __sn__val2 = resource_get_value(__sn__self->__sn__w2);
+
+    return (__sn__Output){ .__sn__v1 = __sn__val1, .__sn__v2 = __sn__val2 };}
+
+void __sn__Model_train(__sn__Model *__sn__self, long long __sn__newVal1, long long __sn__newVal2) {
+
+    sn_auto_arr SnArray * __sn__params = __sn__Model_parameters(__sn__self);
+
+    resource_update((((__sn__Resource * *)__sn__params->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__params->len : __ai__; })]), __sn__newVal1);
+    
+
+    resource_update((((__sn__Resource * *)__sn__params->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__params->len : __ai__; })]), __sn__newVal2);
+    
+
+    resource_process_array(__sn__params, 2LL);
+    
+
+    __sn__Output __sn__out = __sn__Model_forward(__sn__self);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("train inner: v1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__out.__sn__v1));
+            sn_auto_str char *__is_p2__ = sn_strdup(" v2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__out.__sn__v2));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+}
+
+int main() {
+    sn_auto_Model __sn__Model __sn__model = (__sn__Model){ .__sn__w1 = resource_create(1LL, 100LL), .__sn__w2 = resource_create(2LL, 200LL) };
+    __sn__Output __sn__f1 = __sn__Model_forward(&__sn__model);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("forward 1: v1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__f1.__sn__v1));
+            sn_auto_str char *__is_p2__ = sn_strdup(" v2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__f1.__sn__v2));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    __sn__Output __sn__f2 = __sn__Model_forward(&__sn__model);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("forward 2: v1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__f2.__sn__v1));
+            sn_auto_str char *__is_p2__ = sn_strdup(" v2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__f2.__sn__v2));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    __sn__Model_train(&__sn__model, 150LL, 250LL);
+    
+    long long __sn__w1v = resource_get_value(__sn__model.__sn__w1);
+    long long __sn__w2v = resource_get_value(__sn__model.__sn__w2);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("caller direct: w1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__w1v));
+            sn_auto_str char *__is_p2__ = sn_strdup(" w2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__w2v));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    __sn__Output __sn__f3 = __sn__Model_forward(&__sn__model);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("forward 3: v1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__f3.__sn__v1));
+            sn_auto_str char *__is_p2__ = sn_strdup(" v2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__f3.__sn__v2));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    __sn__Model_train(&__sn__model, 300LL, 400LL);
+    
+    __sn__Output __sn__f4 = __sn__Model_forward(&__sn__model);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("forward 4: v1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__f4.__sn__v1));
+            sn_auto_str char *__is_p2__ = sn_strdup(" v2=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__f4.__sn__v2));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    sn_println("PASS");
+    
+    fflush(stdout);
+    return 0;
+}
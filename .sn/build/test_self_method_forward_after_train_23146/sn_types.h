@@ -0,0 +1,170 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Resource (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__id;
+    long long __sn__value;
+} __sn__Resource;
+
+
+static inline __sn__Resource *__sn__Resource__new(void) {
+    __sn__Resource *p = calloc(1, sizeof(__sn__Resource));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Resource *__sn__Resource_retain(__sn__Resource *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Resource_release(__sn__Resource **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Resource __attribute__((cleanup(__sn__Resource_release)))
+#define sn_auto_ref_Resource __attribute__((cleanup(__sn__Resource_release)))
+
+static inline void __sn__Resource_release_elem(void *p) { __sn__Resource_release((__sn__Resource **)p); }
+static inline void __sn__Resource_retain_into(const void *src, void *dst) { *(__sn__Resource **)dst = __sn__Resource_retain(*(__sn__Resource *const *)src); }
+
+/* Struct: Output (as val) */
+typedef struct {
+    long long __sn__v1;
+    long long __sn__v2;
+} __sn__Output;
+/* Value operations */
+static inline __sn__Output __sn__Output_copy(const __sn__Output *src) {
+    __sn__Output dst;
+    dst.__sn__v1 = src->__sn__v1;
+    dst.__sn__v2 = src->__sn__v2;
+    return dst;
+}
+
+static inline void __sn__Output_cleanup(__sn__Output *p) {
+
+}
+
+#define sn_auto_Output __attribute__((cleanup(__sn__Output_cleanup)))
+
+static inline void __sn__Output_cleanup_elem(void *p) { __sn__Output_cleanup((__sn__Output *)p); }
+static inline void __sn__Output_copy_into(const void *src, void *dst) { *(__sn__Output *)dst = __sn__Output_copy((const __sn__Output *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Output *__sn__Output_alloc(void) {
+    return calloc(1, sizeof(__sn__Output));
+}
+
+static inline void __sn__Output_release(__sn__Output **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Output __attribute__((cleanup(__sn__Output_release)))
+
+static inline void __sn__Output_release_elem(void *p) { __sn__Output_release((__sn__Output **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Output_to_string(const __sn__Output *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Output { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "v1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__v1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "v2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__v2);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Model (as val) */
+typedef struct {
+    __sn__Resource * __sn__w1;
+    __sn__Resource * __sn__w2;
+} __sn__Model;
+/* Value operations */
+static inline __sn__Model __sn__Model_copy(const __sn__Model *src) {
+    __sn__Model dst;
+    dst.__sn__w1 = __sn__Resource_retain(src->__sn__w1);
+    dst.__sn__w2 = __sn__Resource_retain(src->__sn__w2);
+    return dst;
+}
+
+static inline void __sn__Model_cleanup(__sn__Model *p) {
+    __sn__Resource_release(&p->__sn__w1);
+    __sn__Resource_release(&p->__sn__w2);
+
+}
+
+#define sn_auto_Model __attribute__((cleanup(__sn__Model_cleanup)))
+
+static inline void __sn__Model_cleanup_elem(void *p) { __sn__Model_cleanup((__sn__Model *)p); }
+static inline void __sn__Model_copy_into(const void *src, void *dst) { *(__sn__Model *)dst = __sn__Model_copy((const __sn__Model *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Model *__sn__Model_alloc(void) {
+    return calloc(1, sizeof(__sn__Model));
+}
+
+static inline void __sn__Model_release(__sn__Model **p) {
+    if (*p) {
+        __sn__Resource_release(&(*p)->__sn__w1);
+        __sn__Resource_release(&(*p)->__sn__w2);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Model __attribute__((cleanup(__sn__Model_release)))
+
+static inline void __sn__Model_release_elem(void *p) { __sn__Model_release((__sn__Model **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Model_to_string(const __sn__Model *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Model { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "w1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "<Resource %p>", (void *)p->__sn__w1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "w2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "<Resource %p>", (void *)p->__sn__w2);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+SnArray * __sn__Model_parameters(__sn__Model *);
+__sn__Output __sn__Model_forward(__sn__Model *);
+void __sn__Model_train(__sn__Model *, long long, long long);
+
+
+
+#endif
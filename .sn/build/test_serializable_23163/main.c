@@ -0,0 +1,219 @@
+#include "sn_types.h"
+__sn__Encoder * sn_test_json_encoder();
+__sn__Decoder * sn_test_json_decoder(char *);
+__sn__Encoder * sn_test_json_array_encoder();
+
+
+
+
+
+
+int main() {
+    sn_auto_Address __sn__Address __sn__a = (__sn__Address){ .__sn__street = strdup("123 Main St"), .__sn__city = strdup("NYC") };
+    sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_0 = sn_test_json_encoder();
+    sn_auto_str char * __sn__json = __sn__Address_encode(&__sn__a, __sn____chain_tmp_0);
+    sn_assert((strcmp(__sn__json, "{\"street\":\"123 Main St\",\"city\":\"NYC\"}") == 0), "Address encode");
+    
+    sn_println("test_encode_address: PASS");
+    
+    sn_auto_Person __sn__Person __sn__p = (__sn__Person){ .__sn__name = strdup("Alice"), .__sn__age = 30LL, .__sn__score = 9.5, .__sn__active = true, .__sn__address = (__sn__Address){ .__sn__street = strdup("456 Oak Ave"), .__sn__city = strdup("LA") }, .__sn__tags = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("dev") });
+            sn_array_push(__al__, &(char *){ strdup("lead") });
+            __al__;
+        }) };
+    sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_1 = sn_test_json_encoder();
+    sn_auto_str char * __sn__json2 = __sn__Person_encode(&__sn__p, __sn____chain_tmp_1);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("encoded: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__json2);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_assert((strcmp(__sn__json2, "{\"name\":\"Alice\",\"age\":30,\"score\":9.5,\"active\":true,\"address\":{\"street\":\"456 Oak Ave\",\"city\":\"LA\"},\"tags\":[\"dev\",\"lead\"]}") == 0), "Person encode");
+    
+    sn_println("test_encode_person: PASS");
+    
+    sn_auto_Decoder __sn__Decoder * __sn__dec = sn_test_json_decoder("{\"street\":\"789 Pine Rd\",\"city\":\"Chicago\"}");
+    sn_auto_Address __sn__Address __sn__a2 = __sn__Address_decode(__sn__dec);
+    sn_assert((strcmp(__sn__a2.__sn__street, "789 Pine Rd") == 0), "Address decode street");
+    
+    sn_assert((strcmp(__sn__a2.__sn__city, "Chicago") == 0), "Address decode city");
+    
+    sn_println("test_decode_address: PASS");
+    
+    sn_auto_Decoder __sn__Decoder * __sn__dec2 = sn_test_json_decoder("{\"name\":\"Bob\",\"age\":25,\"score\":8.3,\"active\":false,\"address\":{\"street\":\"10 Elm\",\"city\":\"SF\"},\"tags\":[\"ops\",\"sre\",\"infra\"]}");
+    sn_auto_Person __sn__Person __sn__p2 = __sn__Person_decode(__sn__dec2);
+    sn_assert((strcmp(__sn__p2.__sn__name, "Bob") == 0), "Person decode name");
+    
+    sn_assert((__sn__p2.__sn__age == 25LL), "Person decode age");
+    
+    sn_assert((__sn__p2.__sn__score == 8.3000000000000007), "Person decode score");
+    
+    sn_assert((__sn__p2.__sn__active == false), "Person decode active");
+    
+    sn_assert((strcmp(__sn__p2.__sn__address.__sn__street, "10 Elm") == 0), "Person decode address.street");
+    
+    sn_assert((strcmp(__sn__p2.__sn__address.__sn__city, "SF") == 0), "Person decode address.city");
+    
+    sn_assert((sn_array_length(__sn__p2.__sn__tags) == 3LL), "Person decode tags length");
+    
+    sn_assert((strcmp((((char * *)__sn__p2.__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__p2.__sn__tags->len : __ai__; })]), "ops") == 0), "Person decode tags[0]");
+    
+    sn_assert((strcmp((((char * *)__sn__p2.__sn__tags->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__p2.__sn__tags->len : __ai__; })]), "sre") == 0), "Person decode tags[1]");
+    
+    sn_assert((strcmp((((char * *)__sn__p2.__sn__tags->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__p2.__sn__tags->len : __ai__; })]), "infra") == 0), "Person decode tags[2]");
+    
+    sn_println("test_decode_person: PASS");
+    
+    sn_auto_Person __sn__Person __sn__original = (__sn__Person){ .__sn__name = strdup("Charlie"), .__sn__age = 40LL, .__sn__score = 7.7000000000000002, .__sn__active = true, .__sn__address = (__sn__Address){ .__sn__street = strdup("99 River Dr"), .__sn__city = strdup("Boston") }, .__sn__tags = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 1);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("mgr") });
+            __al__;
+        }) };
+    sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_2 = sn_test_json_encoder();
+    sn_auto_str char * __sn__rtJson = __sn__Person_encode(&__sn__original, __sn____chain_tmp_2);
+    sn_auto_Decoder __sn__Decoder * __sn____chain_tmp_3 = sn_test_json_decoder(__sn__rtJson);
+    sn_auto_Person __sn__Person __sn__roundtrip = __sn__Person_decode(__sn____chain_tmp_3);
+    sn_assert((strcmp(__sn__roundtrip.__sn__name, "Charlie") == 0), "roundtrip name");
+    
+    sn_assert((__sn__roundtrip.__sn__age == 40LL), "roundtrip age");
+    
+    sn_assert((__sn__roundtrip.__sn__score == 7.7000000000000002), "roundtrip score");
+    
+    sn_assert((__sn__roundtrip.__sn__active == true), "roundtrip active");
+    
+    sn_assert((strcmp(__sn__roundtrip.__sn__address.__sn__street, "99 River Dr") == 0), "roundtrip address.street");
+    
+    sn_assert((strcmp(__sn__roundtrip.__sn__address.__sn__city, "Boston") == 0), "roundtrip address.city");
+    
+    sn_assert((sn_array_length(__sn__roundtrip.__sn__tags) == 1LL), "roundtrip tags length");
+    
+    sn_assert((strcmp((((char * *)__sn__roundtrip.__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__roundtrip.__sn__tags->len : __ai__; })]), "mgr") == 0), "roundtrip tags[0]");
+    
+    sn_println("test_roundtrip: PASS");
+    
+    sn_auto_arr SnArray * __sn__addrs = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Address), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Address_cleanup_elem;
+            __al__->elem_copy = __sn__Address_copy_into;
+            sn_array_push(__al__, &((__sn__Address){ .__sn__street = strdup("1 Main"), .__sn__city = strdup("NYC") }));
+            sn_array_push(__al__, &((__sn__Address){ .__sn__street = strdup("2 Oak"), .__sn__city = strdup("LA") }));
+            __al__;
+        });
+    sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_4 = sn_test_json_array_encoder();
+    sn_auto_str char * __sn__arrJson = __sn__Address_encodeArray(__sn__addrs, __sn____chain_tmp_4);
+    sn_assert((strcmp(__sn__arrJson, "[{\"street\":\"1 Main\",\"city\":\"NYC\"},{\"street\":\"2 Oak\",\"city\":\"LA\"}]") == 0), "encodeArray");
+    
+    sn_println("test_encodeArray: PASS");
+    
+    sn_auto_Decoder __sn__Decoder * __sn__arrDec = sn_test_json_decoder("[{\"street\":\"3 Pine\",\"city\":\"SF\"},{\"street\":\"4 Elm\",\"city\":\"CHI\"}]");
+    sn_auto_arr SnArray * __sn__decoded = __sn__Address_decodeArray(__sn__arrDec);
+    sn_assert((sn_array_length(__sn__decoded) == 2LL), "decodeArray length");
+    
+    sn_assert((strcmp((((__sn__Address *)__sn__decoded->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__decoded->len : __ai__; })]).__sn__street, "3 Pine") == 0), "decodeArray[0].street");
+    
+    sn_assert((strcmp((((__sn__Address *)__sn__decoded->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__decoded->len : __ai__; })]).__sn__city, "SF") == 0), "decodeArray[0].city");
+    
+    sn_assert((strcmp((((__sn__Address *)__sn__decoded->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__decoded->len : __ai__; })]).__sn__street, "4 Elm") == 0), "decodeArray[1].street");
+    
+    sn_assert((strcmp((((__sn__Address *)__sn__decoded->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__decoded->len : __ai__; })]).__sn__city, "CHI") == 0), "decodeArray[1].city");
+    
+    sn_println("test_decodeArray: PASS");
+    
+    sn_auto_arr SnArray * __sn__people = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Person), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Person_cleanup_elem;
+            __al__->elem_copy = __sn__Person_copy_into;
+            sn_array_push(__al__, &((__sn__Person){ .__sn__name = strdup("Alice"), .__sn__age = 30LL, .__sn__score = 9.5, .__sn__active = true, .__sn__address = (__sn__Address){ .__sn__street = strdup("1 A"), .__sn__city = strdup("X") }, .__sn__tags = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("a") });
+            sn_array_push(__al__, &(char *){ strdup("b") });
+            __al__;
+        }) }));
+            sn_array_push(__al__, &((__sn__Person){ .__sn__name = strdup("Bob"), .__sn__age = 25LL, .__sn__score = 8.0, .__sn__active = false, .__sn__address = (__sn__Address){ .__sn__street = strdup("2 B"), .__sn__city = strdup("Y") }, .__sn__tags = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 1);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("c") });
+            __al__;
+        }) }));
+            __al__;
+        });
+    sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_5 = sn_test_json_array_encoder();
+    sn_auto_str char * __sn__rtArrJson = __sn__Person_encodeArray(__sn__people, __sn____chain_tmp_5);
+    sn_auto_Decoder __sn__Decoder * __sn____chain_tmp_6 = sn_test_json_decoder(__sn__rtArrJson);
+    sn_auto_arr SnArray * __sn__rtPeople = __sn__Person_decodeArray(__sn____chain_tmp_6);
+    sn_assert((sn_array_length(__sn__rtPeople) == 2LL), "array roundtrip length");
+    
+    sn_assert((strcmp((((__sn__Person *)__sn__rtPeople->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__rtPeople->len : __ai__; })]).__sn__name, "Alice") == 0), "array roundtrip [0].name");
+    
+    sn_assert(((((__sn__Person *)__sn__rtPeople->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__rtPeople->len : __ai__; })]).__sn__age == 30LL), "array roundtrip [0].age");
+    
+    sn_assert((strcmp((((__sn__Person *)__sn__rtPeople->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__rtPeople->len : __ai__; })]).__sn__address.__sn__city, "X") == 0), "array roundtrip [0].address.city");
+    
+    sn_assert((sn_array_length((((__sn__Person *)__sn__rtPeople->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__rtPeople->len : __ai__; })]).__sn__tags) == 2LL), "array roundtrip [0].tags.length");
+    
+    sn_assert((strcmp((((char * *)(((__sn__Person *)__sn__rtPeople->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__rtPeople->len : __ai__; })]).__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Person *)__sn__rtPeople->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__rtPeople->len : __ai__; })]).__sn__tags->len : __ai__; })]), "a") == 0), "array roundtrip [0].tags[0]");
+    
+    sn_assert((strcmp((((__sn__Person *)__sn__rtPeople->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__rtPeople->len : __ai__; })]).__sn__name, "Bob") == 0), "array roundtrip [1].name");
+    
+    sn_assert(((((__sn__Person *)__sn__rtPeople->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__rtPeople->len : __ai__; })]).__sn__active == false), "array roundtrip [1].active");
+    
+    sn_assert((strcmp((((char * *)(((__sn__Person *)__sn__rtPeople->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__rtPeople->len : __ai__; })]).__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Person *)__sn__rtPeople->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__rtPeople->len : __ai__; })]).__sn__tags->len : __ai__; })]), "c") == 0), "array roundtrip [1].tags[0]");
+    
+    sn_println("test_array_roundtrip: PASS");
+    
+    sn_auto_ApiResponse __sn__ApiResponse __sn__resp = (__sn__ApiResponse){ .__sn__statusCode = 200LL, .__sn__errorMessage = strdup("none"), .__sn__isSuccess = true };
+    sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_7 = sn_test_json_encoder();
+    sn_auto_str char * __sn__respJson = __sn__ApiResponse_encode(&__sn__resp, __sn____chain_tmp_7);
+    sn_assert((strcmp(__sn__respJson, "{\"status_code\":200,\"error_message\":\"none\",\"is_success\":true}") == 0), "alias encode");
+    
+    sn_println("test_alias_encode: PASS");
+    
+    sn_auto_Decoder __sn__Decoder * __sn____chain_tmp_8 = sn_test_json_decoder("{\"status_code\":404,\"error_message\":\"not found\",\"is_success\":false}");
+    sn_auto_ApiResponse __sn__ApiResponse __sn__resp2 = __sn__ApiResponse_decode(__sn____chain_tmp_8);
+    sn_assert((__sn__resp2.__sn__statusCode == 404LL), "alias decode statusCode");
+    
+    sn_assert((strcmp(__sn__resp2.__sn__errorMessage, "not found") == 0), "alias decode errorMessage");
+    
+    sn_assert((__sn__resp2.__sn__isSuccess == false), "alias decode isSuccess");
+    
+    sn_println("test_alias_decode: PASS");
+    
+    sn_auto_ApiResponse __sn__ApiResponse __sn__resp3 = (__sn__ApiResponse){ .__sn__statusCode = 500LL, .__sn__errorMessage = strdup("internal error"), .__sn__isSuccess = false };
+    sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_9 = sn_test_json_encoder();
+    sn_auto_str char * __sn__rtRespJson = __sn__ApiResponse_encode(&__sn__resp3, __sn____chain_tmp_9);
+    sn_auto_Decoder __sn__Decoder * __sn____chain_tmp_10 = sn_test_json_decoder(__sn__rtRespJson);
+    sn_auto_ApiResponse __sn__ApiResponse __sn__resp4 = __sn__ApiResponse_decode(__sn____chain_tmp_10);
+    sn_assert((__sn__resp4.__sn__statusCode == 500LL), "alias roundtrip statusCode");
+    
+    sn_assert((strcmp(__sn__resp4.__sn__errorMessage, "internal error") == 0), "alias roundtrip errorMessage");
+    
+    sn_assert((__sn__resp4.__sn__isSuccess == false), "alias roundtrip isSuccess");
+    
+    sn_println("test_alias_roundtrip: PASS");
+    
+    sn_println("\nAll @serializable tests passed!");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,380 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Address (as val) */
+typedef struct {
+    char * __sn__street;
+    char * __sn__city;
+} __sn__Address;
+/* Value operations */
+static inline __sn__Address __sn__Address_copy(const __sn__Address *src) {
+    __sn__Address dst;
+    dst.__sn__street = src->__sn__street ? strdup(src->__sn__street) : NULL;
+    dst.__sn__city = src->__sn__city ? strdup(src->__sn__city) : NULL;
+    return dst;
+}
+
+static inline void __sn__Address_cleanup(__sn__Address *p) {
+    free(p->__sn__street);
+    free(p->__sn__city);
+
+}
+
+#define sn_auto_Address __attribute__((cleanup(__sn__Address_cleanup)))
+
+static inline void __sn__Address_cleanup_elem(void *p) { __sn__Address_cleanup((__sn__Address *)p); }
+static inline void __sn__Address_copy_into(const void *src, void *dst) { *(__sn__Address *)dst = __sn__Address_copy((const __sn__Address *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Address *__sn__Address_alloc(void) {
+    return calloc(1, sizeof(__sn__Address));
+}
+
+static inline void __sn__Address_release(__sn__Address **p) {
+    if (*p) {
+        free((*p)->__sn__street);
+        free((*p)->__sn__city);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Address __attribute__((cleanup(__sn__Address_release)))
+
+static inline void __sn__Address_release_elem(void *p) { __sn__Address_release((__sn__Address **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Address_to_string(const __sn__Address *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Address { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "street: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__street ? p->__sn__street : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "city: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__city ? p->__sn__city : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__Address_encode_impl(__sn__Address *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "street", __sn__self->__sn__street);
+    __sn__Encoder_writeStr(__sn__e, "city", __sn__self->__sn__city);
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__Address_encode(__sn__Address *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Address_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__Address __sn__Address_decode(__sn__Decoder *__sn__d) {
+    __sn__Address __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__street = __sn__Decoder_readStr(__sn__d, "street");
+    __r__.__sn__city = __sn__Decoder_readStr(__sn__d, "city");
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__Address_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__Address_encode_impl(&((__sn__Address *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__Address_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__Address), __len__);
+    __arr__->elem_release = __sn__Address_cleanup_elem;
+    __arr__->elem_copy = __sn__Address_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__Address __v__ = __sn__Address_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+/* Struct: Person (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__age;
+    double __sn__score;
+    bool __sn__active;
+    __sn__Address __sn__address;
+    SnArray * __sn__tags;
+} __sn__Person;
+/* Value operations */
+static inline __sn__Person __sn__Person_copy(const __sn__Person *src) {
+    __sn__Person dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__age = src->__sn__age;
+    dst.__sn__score = src->__sn__score;
+    dst.__sn__active = src->__sn__active;
+    dst.__sn__address = __sn__Address_copy(&src->__sn__address);
+    dst.__sn__tags = sn_array_copy(src->__sn__tags);
+    return dst;
+}
+
+static inline void __sn__Person_cleanup(__sn__Person *p) {
+    free(p->__sn__name);
+    __sn__Address_cleanup(&p->__sn__address);
+    sn_cleanup_array(&p->__sn__tags);
+
+}
+
+#define sn_auto_Person __attribute__((cleanup(__sn__Person_cleanup)))
+
+static inline void __sn__Person_cleanup_elem(void *p) { __sn__Person_cleanup((__sn__Person *)p); }
+static inline void __sn__Person_copy_into(const void *src, void *dst) { *(__sn__Person *)dst = __sn__Person_copy((const __sn__Person *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Person *__sn__Person_alloc(void) {
+    return calloc(1, sizeof(__sn__Person));
+}
+
+static inline void __sn__Person_release(__sn__Person **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        __sn__Address_cleanup(&(*p)->__sn__address);
+        sn_cleanup_array(&(*p)->__sn__tags);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Person __attribute__((cleanup(__sn__Person_release)))
+
+static inline void __sn__Person_release_elem(void *p) { __sn__Person_release((__sn__Person **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Person_to_string(const __sn__Person *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Person { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "age: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__age);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "score: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__score);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "active: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__active ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "address: ");
+    { char *__fs__ = __sn__Address_to_string(&p->__sn__address); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tags: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__tags); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__Person_encode_impl(__sn__Person *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "name", __sn__self->__sn__name);
+    __sn__Encoder_writeInt(__sn__e, "age", __sn__self->__sn__age);
+    __sn__Encoder_writeDouble(__sn__e, "score", __sn__self->__sn__score);
+    __sn__Encoder_writeBool(__sn__e, "active", __sn__self->__sn__active);
+    { __sn__Encoder *__sub__ = __sn__Encoder_beginObject(__sn__e, "address"); __sn__Address_encode_impl(&__sn__self->__sn__address, __sub__); __sn__Encoder_end(__sub__); }
+    { __sn__Encoder *__arr__ = __sn__Encoder_beginArray(__sn__e, "tags"); for (long long __i__ = 0; __i__ < __sn__self->__sn__tags->len; __i__++) { __sn__Encoder_appendStr(__arr__, ((char **)__sn__self->__sn__tags->data)[__i__]); } __sn__Encoder_end(__arr__); }
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__Person_encode(__sn__Person *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Person_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__Person __sn__Person_decode(__sn__Decoder *__sn__d) {
+    __sn__Person __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__name = __sn__Decoder_readStr(__sn__d, "name");
+    __r__.__sn__age = __sn__Decoder_readInt(__sn__d, "age");
+    __r__.__sn__score = __sn__Decoder_readDouble(__sn__d, "score");
+    __r__.__sn__active = __sn__Decoder_readBool(__sn__d, "active");
+    { sn_auto_Decoder __sn__Decoder *__sub__ = __sn__Decoder_readObject(__sn__d, "address"); __r__.__sn__address = __sn__Address_decode(__sub__); }
+    { sn_auto_Decoder __sn__Decoder *__arr__ = __sn__Decoder_readArray(__sn__d, "tags"); long long __len__ = __sn__Decoder_length(__arr__); __r__.__sn__tags = sn_array_new(sizeof(char *), __len__); __r__.__sn__tags->elem_tag = SN_TAG_STRING; __r__.__sn__tags->elem_release = (void (*)(void *))sn_cleanup_str; __r__.__sn__tags->elem_copy = sn_copy_str; for (long long __i__ = 0; __i__ < __len__; __i__++) { char *__v__ = __sn__Decoder_atStr(__arr__, __i__); sn_array_push(__r__.__sn__tags, &__v__); } }
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__Person_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__Person_encode_impl(&((__sn__Person *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__Person_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__Person), __len__);
+    __arr__->elem_release = __sn__Person_cleanup_elem;
+    __arr__->elem_copy = __sn__Person_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__Person __v__ = __sn__Person_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+/* Struct: ApiResponse (as val) */
+typedef struct {
+    long long __sn__statusCode;
+    char * __sn__errorMessage;
+    bool __sn__isSuccess;
+} __sn__ApiResponse;
+/* Value operations */
+static inline __sn__ApiResponse __sn__ApiResponse_copy(const __sn__ApiResponse *src) {
+    __sn__ApiResponse dst;
+    dst.__sn__statusCode = src->__sn__statusCode;
+    dst.__sn__errorMessage = src->__sn__errorMessage ? strdup(src->__sn__errorMessage) : NULL;
+    dst.__sn__isSuccess = src->__sn__isSuccess;
+    return dst;
+}
+
+static inline void __sn__ApiResponse_cleanup(__sn__ApiResponse *p) {
+    free(p->__sn__errorMessage);
+
+}
+
+#define sn_auto_ApiResponse __attribute__((cleanup(__sn__ApiResponse_cleanup)))
+
+static inline void __sn__ApiResponse_cleanup_elem(void *p) { __sn__ApiResponse_cleanup((__sn__ApiResponse *)p); }
+static inline void __sn__ApiResponse_copy_into(const void *src, void *dst) { *(__sn__ApiResponse *)dst = __sn__ApiResponse_copy((const __sn__ApiResponse *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__ApiResponse *__sn__ApiResponse_alloc(void) {
+    return calloc(1, sizeof(__sn__ApiResponse));
+}
+
+static inline void __sn__ApiResponse_release(__sn__ApiResponse **p) {
+    if (*p) {
+        free((*p)->__sn__errorMessage);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_ApiResponse __attribute__((cleanup(__sn__ApiResponse_release)))
+
+static inline void __sn__ApiResponse_release_elem(void *p) { __sn__ApiResponse_release((__sn__ApiResponse **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__ApiResponse_to_string(const __sn__ApiResponse *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "ApiResponse { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "statusCode: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__statusCode);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "errorMessage: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__errorMessage ? p->__sn__errorMessage : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "isSuccess: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__isSuccess ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__ApiResponse_encode_impl(__sn__ApiResponse *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeInt(__sn__e, "status_code", __sn__self->__sn__statusCode);
+    __sn__Encoder_writeStr(__sn__e, "error_message", __sn__self->__sn__errorMessage);
+    __sn__Encoder_writeBool(__sn__e, "is_success", __sn__self->__sn__isSuccess);
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__ApiResponse_encode(__sn__ApiResponse *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__ApiResponse_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__ApiResponse __sn__ApiResponse_decode(__sn__Decoder *__sn__d) {
+    __sn__ApiResponse __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__statusCode = __sn__Decoder_readInt(__sn__d, "status_code");
+    __r__.__sn__errorMessage = __sn__Decoder_readStr(__sn__d, "error_message");
+    __r__.__sn__isSuccess = __sn__Decoder_readBool(__sn__d, "is_success");
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__ApiResponse_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__ApiResponse_encode_impl(&((__sn__ApiResponse *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__ApiResponse_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__ApiResponse), __len__);
+    __arr__->elem_release = __sn__ApiResponse_cleanup_elem;
+    __arr__->elem_copy = __sn__ApiResponse_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__ApiResponse __v__ = __sn__ApiResponse_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+
+
+
+
+
+#endif
@@ -0,0 +1,45 @@
+#include "sn_types.h"
+__sn__Encoder * sn_test_json_encoder();
+__sn__Decoder * sn_test_json_decoder(char *);
+
+
+
+
+
+
+int main() {
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 3LL); __sn__i++) {
+            sn_auto_Wrapper __sn__Wrapper __sn__w = (__sn__Wrapper){ .__sn__inner = (__sn__Inner){ .__sn__id = strdup("test"), .__sn__tags = ({
+                    SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+                    __al__->elem_tag = SN_TAG_STRING;
+            
+                    __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+                    __al__->elem_copy = sn_copy_str;
+                    sn_array_push(__al__, &(char *){ strdup("a") });
+                    sn_array_push(__al__, &(char *){ strdup("b") });
+                    __al__;
+                }) } };
+            sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_0 = sn_test_json_encoder();
+            sn_auto_str char * __sn__json = __sn__Wrapper_encode(&__sn__w, __sn____chain_tmp_0);
+            sn_auto_Decoder __sn__Decoder * __sn__dec = sn_test_json_decoder(__sn__json);
+            sn_auto_Wrapper __sn__Wrapper __sn__decoded = __sn__Wrapper_decode(__sn__dec);
+            sn_auto_Inner __sn__Inner __sn__inner = __sn__Inner_copy(&__sn__decoded.__sn__inner);
+            sn_auto_Output __sn__Output __sn__out = (__sn__Output){ .__sn__name = strdup(__sn__inner.__sn__id), .__sn__items = sn_array_copy(__sn__inner.__sn__tags) };
+            sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_1 = sn_test_json_encoder();
+            sn_auto_str char * __sn__json2 = __sn__Output_encode(&__sn__out, __sn____chain_tmp_1);
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("iteration ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": ");
+                    sn_auto_str char *__is_p3__ = sn_strdup(__sn__json2);
+                    sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                }); sn_println(__ps__); };
+            
+        }
+    }
+    sn_println("PASS");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,336 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Inner (as val) */
+typedef struct {
+    char * __sn__id;
+    SnArray * __sn__tags;
+} __sn__Inner;
+/* Value operations */
+static inline __sn__Inner __sn__Inner_copy(const __sn__Inner *src) {
+    __sn__Inner dst;
+    dst.__sn__id = src->__sn__id ? strdup(src->__sn__id) : NULL;
+    dst.__sn__tags = sn_array_copy(src->__sn__tags);
+    return dst;
+}
+
+static inline void __sn__Inner_cleanup(__sn__Inner *p) {
+    free(p->__sn__id);
+    sn_cleanup_array(&p->__sn__tags);
+
+}
+
+#define sn_auto_Inner __attribute__((cleanup(__sn__Inner_cleanup)))
+
+static inline void __sn__Inner_cleanup_elem(void *p) { __sn__Inner_cleanup((__sn__Inner *)p); }
+static inline void __sn__Inner_copy_into(const void *src, void *dst) { *(__sn__Inner *)dst = __sn__Inner_copy((const __sn__Inner *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Inner *__sn__Inner_alloc(void) {
+    return calloc(1, sizeof(__sn__Inner));
+}
+
+static inline void __sn__Inner_release(__sn__Inner **p) {
+    if (*p) {
+        free((*p)->__sn__id);
+        sn_cleanup_array(&(*p)->__sn__tags);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Inner __attribute__((cleanup(__sn__Inner_release)))
+
+static inline void __sn__Inner_release_elem(void *p) { __sn__Inner_release((__sn__Inner **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Inner_to_string(const __sn__Inner *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Inner { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__id ? p->__sn__id : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tags: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__tags); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__Inner_encode_impl(__sn__Inner *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "id", __sn__self->__sn__id);
+    { __sn__Encoder *__arr__ = __sn__Encoder_beginArray(__sn__e, "tags"); for (long long __i__ = 0; __i__ < __sn__self->__sn__tags->len; __i__++) { __sn__Encoder_appendStr(__arr__, ((char **)__sn__self->__sn__tags->data)[__i__]); } __sn__Encoder_end(__arr__); }
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__Inner_encode(__sn__Inner *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Inner_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__Inner __sn__Inner_decode(__sn__Decoder *__sn__d) {
+    __sn__Inner __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__id = __sn__Decoder_readStr(__sn__d, "id");
+    { sn_auto_Decoder __sn__Decoder *__arr__ = __sn__Decoder_readArray(__sn__d, "tags"); long long __len__ = __sn__Decoder_length(__arr__); __r__.__sn__tags = sn_array_new(sizeof(char *), __len__); __r__.__sn__tags->elem_tag = SN_TAG_STRING; __r__.__sn__tags->elem_release = (void (*)(void *))sn_cleanup_str; __r__.__sn__tags->elem_copy = sn_copy_str; for (long long __i__ = 0; __i__ < __len__; __i__++) { char *__v__ = __sn__Decoder_atStr(__arr__, __i__); sn_array_push(__r__.__sn__tags, &__v__); } }
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__Inner_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__Inner_encode_impl(&((__sn__Inner *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__Inner_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__Inner), __len__);
+    __arr__->elem_release = __sn__Inner_cleanup_elem;
+    __arr__->elem_copy = __sn__Inner_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__Inner __v__ = __sn__Inner_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+/* Struct: Wrapper (as val) */
+typedef struct {
+    __sn__Inner __sn__inner;
+} __sn__Wrapper;
+/* Value operations */
+static inline __sn__Wrapper __sn__Wrapper_copy(const __sn__Wrapper *src) {
+    __sn__Wrapper dst;
+    dst.__sn__inner = __sn__Inner_copy(&src->__sn__inner);
+    return dst;
+}
+
+static inline void __sn__Wrapper_cleanup(__sn__Wrapper *p) {
+    __sn__Inner_cleanup(&p->__sn__inner);
+
+}
+
+#define sn_auto_Wrapper __attribute__((cleanup(__sn__Wrapper_cleanup)))
+
+static inline void __sn__Wrapper_cleanup_elem(void *p) { __sn__Wrapper_cleanup((__sn__Wrapper *)p); }
+static inline void __sn__Wrapper_copy_into(const void *src, void *dst) { *(__sn__Wrapper *)dst = __sn__Wrapper_copy((const __sn__Wrapper *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Wrapper *__sn__Wrapper_alloc(void) {
+    return calloc(1, sizeof(__sn__Wrapper));
+}
+
+static inline void __sn__Wrapper_release(__sn__Wrapper **p) {
+    if (*p) {
+        __sn__Inner_cleanup(&(*p)->__sn__inner);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Wrapper __attribute__((cleanup(__sn__Wrapper_release)))
+
+static inline void __sn__Wrapper_release_elem(void *p) { __sn__Wrapper_release((__sn__Wrapper **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Wrapper_to_string(const __sn__Wrapper *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Wrapper { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "inner: ");
+    { char *__fs__ = __sn__Inner_to_string(&p->__sn__inner); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__Wrapper_encode_impl(__sn__Wrapper *__sn__self, __sn__Encoder *__sn__e) {
+    { __sn__Encoder *__sub__ = __sn__Encoder_beginObject(__sn__e, "inner"); __sn__Inner_encode_impl(&__sn__self->__sn__inner, __sub__); __sn__Encoder_end(__sub__); }
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__Wrapper_encode(__sn__Wrapper *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Wrapper_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__Wrapper __sn__Wrapper_decode(__sn__Decoder *__sn__d) {
+    __sn__Wrapper __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    { sn_auto_Decoder __sn__Decoder *__sub__ = __sn__Decoder_readObject(__sn__d, "inner"); __r__.__sn__inner = __sn__Inner_decode(__sub__); }
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__Wrapper_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__Wrapper_encode_impl(&((__sn__Wrapper *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__Wrapper_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__Wrapper), __len__);
+    __arr__->elem_release = __sn__Wrapper_cleanup_elem;
+    __arr__->elem_copy = __sn__Wrapper_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__Wrapper __v__ = __sn__Wrapper_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+/* Struct: Output (as val) */
+typedef struct {
+    char * __sn__name;
+    SnArray * __sn__items;
+} __sn__Output;
+/* Value operations */
+static inline __sn__Output __sn__Output_copy(const __sn__Output *src) {
+    __sn__Output dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    return dst;
+}
+
+static inline void __sn__Output_cleanup(__sn__Output *p) {
+    free(p->__sn__name);
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_Output __attribute__((cleanup(__sn__Output_cleanup)))
+
+static inline void __sn__Output_cleanup_elem(void *p) { __sn__Output_cleanup((__sn__Output *)p); }
+static inline void __sn__Output_copy_into(const void *src, void *dst) { *(__sn__Output *)dst = __sn__Output_copy((const __sn__Output *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Output *__sn__Output_alloc(void) {
+    return calloc(1, sizeof(__sn__Output));
+}
+
+static inline void __sn__Output_release(__sn__Output **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Output __attribute__((cleanup(__sn__Output_release)))
+
+static inline void __sn__Output_release_elem(void *p) { __sn__Output_release((__sn__Output **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Output_to_string(const __sn__Output *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Output { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__Output_encode_impl(__sn__Output *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "name", __sn__self->__sn__name);
+    { __sn__Encoder *__arr__ = __sn__Encoder_beginArray(__sn__e, "items"); for (long long __i__ = 0; __i__ < __sn__self->__sn__items->len; __i__++) { __sn__Encoder_appendStr(__arr__, ((char **)__sn__self->__sn__items->data)[__i__]); } __sn__Encoder_end(__arr__); }
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__Output_encode(__sn__Output *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Output_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__Output __sn__Output_decode(__sn__Decoder *__sn__d) {
+    __sn__Output __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__name = __sn__Decoder_readStr(__sn__d, "name");
+    { sn_auto_Decoder __sn__Decoder *__arr__ = __sn__Decoder_readArray(__sn__d, "items"); long long __len__ = __sn__Decoder_length(__arr__); __r__.__sn__items = sn_array_new(sizeof(char *), __len__); __r__.__sn__items->elem_tag = SN_TAG_STRING; __r__.__sn__items->elem_release = (void (*)(void *))sn_cleanup_str; __r__.__sn__items->elem_copy = sn_copy_str; for (long long __i__ = 0; __i__ < __len__; __i__++) { char *__v__ = __sn__Decoder_atStr(__arr__, __i__); sn_array_push(__r__.__sn__items, &__v__); } }
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__Output_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__Output_encode_impl(&((__sn__Output *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__Output_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__Output), __len__);
+    __arr__->elem_release = __sn__Output_cleanup_elem;
+    __arr__->elem_copy = __sn__Output_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__Output __v__ = __sn__Output_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+
+
+
+
+
+#endif
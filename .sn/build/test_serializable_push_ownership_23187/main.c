@@ -0,0 +1,129 @@
+#include "sn_types.h"
+__sn__Encoder * sn_test_json_encoder();
+__sn__Decoder * sn_test_json_decoder(char *);
+__sn__Encoder * sn_test_json_array_encoder();
+
+
+
+
+__sn__Observation __sn__makeObservation(long long __sn__i, char * __sn__featureJson) {
+
+    sn_auto_Decoder __sn__Decoder * __sn__dec = sn_test_json_decoder(__sn__featureJson);
+
+    return (__sn__Observation){ .__sn__id = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("obs-");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }), .__sn__source = strdup("sensor-array"), .__sn__timestamp = sn_add_long(1000LL, __sn__i), .__sn__features = __sn__NumericField_decodeArray(__sn__dec) };}
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__rows = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 5);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("[{\"key\":\"temperature\",\"value\":23.5}]") });
+            sn_array_push(__al__, &(char *){ strdup("[{\"key\":\"humidity\",\"value\":67.2}]") });
+            sn_array_push(__al__, &(char *){ strdup("[{\"key\":\"pressure\",\"value\":1013.25}]") });
+            sn_array_push(__al__, &(char *){ strdup("[{\"key\":\"windSpeed\",\"value\":5.8}]") });
+            sn_array_push(__al__, &(char *){ strdup("[{\"key\":\"visibility\",\"value\":10.0}]") });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__observations = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Observation), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Observation_cleanup_elem;
+            __al__->elem_copy = __sn__Observation_copy_into;
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            sn_auto_Observation __sn__Observation __sn__obs = __sn__makeObservation(__sn__i, (((char * *)__sn__rows->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__rows->len : __ai__; })]));
+            __sn__arr_push(&__sn__observations, __sn__Observation_copy(&(__sn__obs)));
+            
+        }
+    }
+    sn_assert((sn_array_length(__sn__observations) == 5LL), "push count");
+    
+    sn_assert((strcmp((((__sn__Observation *)__sn__observations->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__observations->len : __ai__; })]).__sn__id, "obs-0") == 0), "push obs[0].id");
+    
+    sn_assert((strcmp((((__sn__NumericField *)(((__sn__Observation *)__sn__observations->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__observations->len : __ai__; })]).__sn__features->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Observation *)__sn__observations->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__observations->len : __ai__; })]).__sn__features->len : __ai__; })]).__sn__key, "temperature") == 0), "push obs[0].features[0].key");
+    
+    sn_assert((strcmp((((__sn__NumericField *)(((__sn__Observation *)__sn__observations->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__observations->len : __ai__; })]).__sn__features->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Observation *)__sn__observations->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__observations->len : __ai__; })]).__sn__features->len : __ai__; })]).__sn__key, "visibility") == 0), "push obs[4].features[0].key");
+    
+    sn_println("test_push_lvalue: PASS");
+    
+    sn_auto_arr SnArray * __sn__obs2 = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Observation), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Observation_cleanup_elem;
+            __al__->elem_copy = __sn__Observation_copy_into;
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            __sn__arr_push(&__sn__obs2, __sn__makeObservation(__sn__i, (((char * *)__sn__rows->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__rows->len : __ai__; })])));
+            
+        }
+    }
+    sn_assert((strcmp((((__sn__Observation *)__sn__obs2->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__obs2->len : __ai__; })]).__sn__id, "obs-0") == 0), "rvalue obs[0].id");
+    
+    sn_assert((strcmp((((__sn__NumericField *)(((__sn__Observation *)__sn__obs2->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__obs2->len : __ai__; })]).__sn__features->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Observation *)__sn__obs2->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__obs2->len : __ai__; })]).__sn__features->len : __ai__; })]).__sn__key, "temperature") == 0), "rvalue obs[0].features[0].key");
+    
+    sn_assert((strcmp((((__sn__NumericField *)(((__sn__Observation *)__sn__obs2->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__obs2->len : __ai__; })]).__sn__features->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Observation *)__sn__obs2->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__obs2->len : __ai__; })]).__sn__features->len : __ai__; })]).__sn__key, "visibility") == 0), "rvalue obs[4].features[0].key");
+    
+    sn_println("test_push_rvalue: PASS");
+    
+    sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_0 = sn_test_json_array_encoder();
+    sn_auto_str char * __sn__json = __sn__Observation_encodeArray(__sn__observations, __sn____chain_tmp_0);
+    sn_assert(sn_gt_long(sn_str_length(__sn__json), 100LL), "re-encoded JSON should be substantial");
+    
+    sn_println("test_re_encode: PASS");
+    
+    sn_auto_Decoder __sn__Decoder * __sn__rtDec = sn_test_json_decoder(__sn__json);
+    sn_auto_arr SnArray * __sn__rtObs = __sn__Observation_decodeArray(__sn__rtDec);
+    sn_assert((sn_array_length(__sn__rtObs) == 5LL), "roundtrip count");
+    
+    sn_assert((strcmp((((__sn__Observation *)__sn__rtObs->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__rtObs->len : __ai__; })]).__sn__id, "obs-0") == 0), "roundtrip obs[0].id");
+    
+    sn_assert((strcmp((((__sn__NumericField *)(((__sn__Observation *)__sn__rtObs->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__rtObs->len : __ai__; })]).__sn__features->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Observation *)__sn__rtObs->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__rtObs->len : __ai__; })]).__sn__features->len : __ai__; })]).__sn__key, "temperature") == 0), "roundtrip obs[0].features[0].key");
+    
+    sn_assert((strcmp((((__sn__NumericField *)(((__sn__Observation *)__sn__rtObs->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__rtObs->len : __ai__; })]).__sn__features->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Observation *)__sn__rtObs->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__rtObs->len : __ai__; })]).__sn__features->len : __ai__; })]).__sn__key, "windSpeed") == 0), "roundtrip obs[3].features[0].key");
+    
+    sn_assert((strcmp((((__sn__NumericField *)(((__sn__Observation *)__sn__rtObs->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__rtObs->len : __ai__; })]).__sn__features->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Observation *)__sn__rtObs->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__rtObs->len : __ai__; })]).__sn__features->len : __ai__; })]).__sn__key, "visibility") == 0), "roundtrip obs[4].features[0].key");
+    
+    sn_println("test_roundtrip: PASS");
+    
+    sn_auto_arr SnArray * __sn__obs3 = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Observation), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Observation_cleanup_elem;
+            __al__->elem_copy = __sn__Observation_copy_into;
+            __al__;
+        });
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            sn_auto_Observation __sn__Observation __sn__ob = __sn__makeObservation(__sn__i, (((char * *)__sn__rows->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__rows->len : __ai__; })]));
+            __sn__arr_insert(&__sn__obs3, __sn__i, __sn__Observation_copy(&(__sn__ob)));
+            
+        }
+    }
+    sn_assert((strcmp((((__sn__Observation *)__sn__obs3->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__obs3->len : __ai__; })]).__sn__id, "obs-0") == 0), "insert obs[0].id");
+    
+    sn_assert((strcmp((((__sn__NumericField *)(((__sn__Observation *)__sn__obs3->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__obs3->len : __ai__; })]).__sn__features->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Observation *)__sn__obs3->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__obs3->len : __ai__; })]).__sn__features->len : __ai__; })]).__sn__key, "temperature") == 0), "insert obs[0].features[0].key");
+    
+    sn_assert((strcmp((((__sn__NumericField *)(((__sn__Observation *)__sn__obs3->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__obs3->len : __ai__; })]).__sn__features->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((__sn__Observation *)__sn__obs3->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__obs3->len : __ai__; })]).__sn__features->len : __ai__; })]).__sn__key, "visibility") == 0), "insert obs[4].features[0].key");
+    
+    sn_println("test_insert: PASS");
+    
+    sn_println("\nAll push-ownership tests passed!");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,253 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: NumericField (as val) */
+typedef struct {
+    char * __sn__key;
+    double __sn__value;
+} __sn__NumericField;
+/* Value operations */
+static inline __sn__NumericField __sn__NumericField_copy(const __sn__NumericField *src) {
+    __sn__NumericField dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__NumericField_cleanup(__sn__NumericField *p) {
+    free(p->__sn__key);
+
+}
+
+#define sn_auto_NumericField __attribute__((cleanup(__sn__NumericField_cleanup)))
+
+static inline void __sn__NumericField_cleanup_elem(void *p) { __sn__NumericField_cleanup((__sn__NumericField *)p); }
+static inline void __sn__NumericField_copy_into(const void *src, void *dst) { *(__sn__NumericField *)dst = __sn__NumericField_copy((const __sn__NumericField *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__NumericField *__sn__NumericField_alloc(void) {
+    return calloc(1, sizeof(__sn__NumericField));
+}
+
+static inline void __sn__NumericField_release(__sn__NumericField **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_NumericField __attribute__((cleanup(__sn__NumericField_release)))
+
+static inline void __sn__NumericField_release_elem(void *p) { __sn__NumericField_release((__sn__NumericField **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__NumericField_to_string(const __sn__NumericField *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "NumericField { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__NumericField_encode_impl(__sn__NumericField *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "key", __sn__self->__sn__key);
+    __sn__Encoder_writeDouble(__sn__e, "value", __sn__self->__sn__value);
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__NumericField_encode(__sn__NumericField *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__NumericField_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__NumericField __sn__NumericField_decode(__sn__Decoder *__sn__d) {
+    __sn__NumericField __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__key = __sn__Decoder_readStr(__sn__d, "key");
+    __r__.__sn__value = __sn__Decoder_readDouble(__sn__d, "value");
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__NumericField_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__NumericField_encode_impl(&((__sn__NumericField *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__NumericField_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__NumericField), __len__);
+    __arr__->elem_release = __sn__NumericField_cleanup_elem;
+    __arr__->elem_copy = __sn__NumericField_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__NumericField __v__ = __sn__NumericField_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+/* Struct: Observation (as val) */
+typedef struct {
+    char * __sn__id;
+    char * __sn__source;
+    long long __sn__timestamp;
+    SnArray * __sn__features;
+} __sn__Observation;
+/* Value operations */
+static inline __sn__Observation __sn__Observation_copy(const __sn__Observation *src) {
+    __sn__Observation dst;
+    dst.__sn__id = src->__sn__id ? strdup(src->__sn__id) : NULL;
+    dst.__sn__source = src->__sn__source ? strdup(src->__sn__source) : NULL;
+    dst.__sn__timestamp = src->__sn__timestamp;
+    dst.__sn__features = sn_array_copy(src->__sn__features);
+    return dst;
+}
+
+static inline void __sn__Observation_cleanup(__sn__Observation *p) {
+    free(p->__sn__id);
+    free(p->__sn__source);
+    sn_cleanup_array(&p->__sn__features);
+
+}
+
+#define sn_auto_Observation __attribute__((cleanup(__sn__Observation_cleanup)))
+
+static inline void __sn__Observation_cleanup_elem(void *p) { __sn__Observation_cleanup((__sn__Observation *)p); }
+static inline void __sn__Observation_copy_into(const void *src, void *dst) { *(__sn__Observation *)dst = __sn__Observation_copy((const __sn__Observation *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Observation *__sn__Observation_alloc(void) {
+    return calloc(1, sizeof(__sn__Observation));
+}
+
+static inline void __sn__Observation_release(__sn__Observation **p) {
+    if (*p) {
+        free((*p)->__sn__id);
+        free((*p)->__sn__source);
+        sn_cleanup_array(&(*p)->__sn__features);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Observation __attribute__((cleanup(__sn__Observation_release)))
+
+static inline void __sn__Observation_release_elem(void *p) { __sn__Observation_release((__sn__Observation **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Observation_to_string(const __sn__Observation *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Observation { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__id ? p->__sn__id : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "source: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__source ? p->__sn__source : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "timestamp: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__timestamp);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "features: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__features); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__Observation_encode_impl(__sn__Observation *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "id", __sn__self->__sn__id);
+    __sn__Encoder_writeStr(__sn__e, "source", __sn__self->__sn__source);
+    __sn__Encoder_writeInt(__sn__e, "timestamp", __sn__self->__sn__timestamp);
+    { __sn__Encoder *__arr__ = __sn__Encoder_beginArray(__sn__e, "features"); for (long long __i__ = 0; __i__ < __sn__self->__sn__features->len; __i__++) { __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__arr__); __sn__NumericField_encode_impl(&((__sn__NumericField *)__sn__self->__sn__features->data)[__i__], __obj__); __sn__Encoder_end(__obj__); } __sn__Encoder_end(__arr__); }
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__Observation_encode(__sn__Observation *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Observation_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__Observation __sn__Observation_decode(__sn__Decoder *__sn__d) {
+    __sn__Observation __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__id = __sn__Decoder_readStr(__sn__d, "id");
+    __r__.__sn__source = __sn__Decoder_readStr(__sn__d, "source");
+    __r__.__sn__timestamp = __sn__Decoder_readInt(__sn__d, "timestamp");
+    { sn_auto_Decoder __sn__Decoder *__arr__ = __sn__Decoder_readArray(__sn__d, "features"); long long __len__ = __sn__Decoder_length(__arr__); __r__.__sn__features = sn_array_new(sizeof(__sn__NumericField), __len__); __r__.__sn__features->elem_release = __sn__NumericField_cleanup_elem; __r__.__sn__features->elem_copy = __sn__NumericField_copy_into; for (long long __i__ = 0; __i__ < __len__; __i__++) { sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__arr__, __i__); __sn__NumericField __v__ = __sn__NumericField_decode(__elem__); sn_array_push(__r__.__sn__features, &__v__); } }
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__Observation_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__Observation_encode_impl(&((__sn__Observation *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__Observation_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__Observation), __len__);
+    __arr__->elem_release = __sn__Observation_cleanup_elem;
+    __arr__->elem_copy = __sn__Observation_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__Observation __v__ = __sn__Observation_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+
+__sn__Observation __sn__makeObservation(long long, char *);
+
+
+
+
+#endif
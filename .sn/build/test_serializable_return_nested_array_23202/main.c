@@ -0,0 +1,92 @@
+#include "sn_types.h"
+__sn__Encoder * sn_test_json_encoder();
+__sn__Decoder * sn_test_json_decoder(char *);
+
+
+
+
+__sn__Response __sn__decodeResponse(char * __sn__payload) {
+
+    sn_auto_Decoder __sn__Decoder * __sn__dec = sn_test_json_decoder(__sn__payload);
+
+    sn_auto_Response __sn__Response __sn__resp = __sn__Response_decode(__sn__dec);
+
+    {
+        __sn__Response __ret__ = __sn__resp;
+        memset(&__sn__resp, 0, sizeof(__sn__resp));
+        return __ret__;
+    }}
+
+
+
+
+
+int main() {
+    sn_auto_Detail __sn__Detail __sn__d = (__sn__Detail){ .__sn__id = strdup("p1"), .__sn__modelId = strdup("gnn"), .__sn__action = strdup("buy"), .__sn__confidence = 0.45000000000000001, .__sn__distribution = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item), 3);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_cleanup_elem;
+            __al__->elem_copy = __sn__Item_copy_into;
+            sn_array_push(__al__, &((__sn__Item){ .__sn__action = strdup("buy"), .__sn__probability = 0.45000000000000001 }));
+            sn_array_push(__al__, &((__sn__Item){ .__sn__action = strdup("sell"), .__sn__probability = 0.29999999999999999 }));
+            sn_array_push(__al__, &((__sn__Item){ .__sn__action = strdup("hold"), .__sn__probability = 0.25 }));
+            __al__;
+        }) };
+    sn_auto_Summary __sn__Summary __sn__s = (__sn__Summary){ .__sn__id = strdup("e1"), .__sn__vector = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 4);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 0.10000000000000001 });
+            sn_array_push(__al__, &(double){ 0.20000000000000001 });
+            sn_array_push(__al__, &(double){ 0.29999999999999999 });
+            sn_array_push(__al__, &(double){ 0.40000000000000002 });
+            __al__;
+        }), .__sn__dimension = 4LL };
+    sn_auto_Response __sn__Response __sn__resp = (__sn__Response){ .__sn__detail = __sn__Detail_copy(&(__sn__d)), .__sn__summary = __sn__Summary_copy(&(__sn__s)) };
+    sn_auto_Encoder __sn__Encoder * __sn____chain_tmp_0 = sn_test_json_encoder();
+    sn_auto_str char * __sn__payload = __sn__Response_encode(&__sn__resp, __sn____chain_tmp_0);
+    sn_auto_Decoder __sn__Decoder * __sn__dec = sn_test_json_decoder(__sn__payload);
+    sn_auto_Response __sn__Response __sn__local = __sn__Response_decode(__sn__dec);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("same-scope: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__local.__sn__detail.__sn__action);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_assert((strcmp(__sn__local.__sn__detail.__sn__action, "buy") == 0), "same-scope action");
+    
+    sn_assert((sn_array_length(__sn__local.__sn__detail.__sn__distribution) == 3LL), "same-scope dist len");
+    
+    sn_assert((sn_array_length(__sn__local.__sn__summary.__sn__vector) == 4LL), "same-scope vec len");
+    
+    sn_println("same-scope decode: PASS");
+    
+    sn_auto_Response __sn__Response __sn__returned = __sn__decodeResponse(__sn__payload);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("fn-return: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__returned.__sn__detail.__sn__action);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_assert((strcmp(__sn__returned.__sn__detail.__sn__action, "buy") == 0), "fn-return action");
+    
+    sn_assert((sn_array_length(__sn__returned.__sn__detail.__sn__distribution) == 3LL), "fn-return dist len");
+    
+    sn_assert((strcmp((((__sn__Item *)__sn__returned.__sn__detail.__sn__distribution->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__returned.__sn__detail.__sn__distribution->len : __ai__; })]).__sn__action, "buy") == 0), "fn-return dist[0]");
+    
+    sn_assert((strcmp((((__sn__Item *)__sn__returned.__sn__detail.__sn__distribution->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__returned.__sn__detail.__sn__distribution->len : __ai__; })]).__sn__action, "sell") == 0), "fn-return dist[1]");
+    
+    sn_assert((strcmp((((__sn__Item *)__sn__returned.__sn__detail.__sn__distribution->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__returned.__sn__detail.__sn__distribution->len : __ai__; })]).__sn__action, "hold") == 0), "fn-return dist[2]");
+    
+    sn_assert((sn_array_length(__sn__returned.__sn__summary.__sn__vector) == 4LL), "fn-return vec len");
+    
+    sn_assert((__sn__returned.__sn__summary.__sn__dimension == 4LL), "fn-return dimension");
+    
+    sn_println("fn-return decode: PASS");
+    
+    sn_println("All tests passed!");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,483 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Item (as val) */
+typedef struct {
+    char * __sn__action;
+    double __sn__probability;
+} __sn__Item;
+/* Value operations */
+static inline __sn__Item __sn__Item_copy(const __sn__Item *src) {
+    __sn__Item dst;
+    dst.__sn__action = src->__sn__action ? strdup(src->__sn__action) : NULL;
+    dst.__sn__probability = src->__sn__probability;
+    return dst;
+}
+
+static inline void __sn__Item_cleanup(__sn__Item *p) {
+    free(p->__sn__action);
+
+}
+
+#define sn_auto_Item __attribute__((cleanup(__sn__Item_cleanup)))
+
+static inline void __sn__Item_cleanup_elem(void *p) { __sn__Item_cleanup((__sn__Item *)p); }
+static inline void __sn__Item_copy_into(const void *src, void *dst) { *(__sn__Item *)dst = __sn__Item_copy((const __sn__Item *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Item *__sn__Item_alloc(void) {
+    return calloc(1, sizeof(__sn__Item));
+}
+
+static inline void __sn__Item_release(__sn__Item **p) {
+    if (*p) {
+        free((*p)->__sn__action);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Item __attribute__((cleanup(__sn__Item_release)))
+
+static inline void __sn__Item_release_elem(void *p) { __sn__Item_release((__sn__Item **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Item_to_string(const __sn__Item *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Item { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "action: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__action ? p->__sn__action : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "probability: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__probability);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__Item_encode_impl(__sn__Item *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "action", __sn__self->__sn__action);
+    __sn__Encoder_writeDouble(__sn__e, "probability", __sn__self->__sn__probability);
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__Item_encode(__sn__Item *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Item_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__Item __sn__Item_decode(__sn__Decoder *__sn__d) {
+    __sn__Item __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__action = __sn__Decoder_readStr(__sn__d, "action");
+    __r__.__sn__probability = __sn__Decoder_readDouble(__sn__d, "probability");
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__Item_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__Item_encode_impl(&((__sn__Item *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__Item_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__Item), __len__);
+    __arr__->elem_release = __sn__Item_cleanup_elem;
+    __arr__->elem_copy = __sn__Item_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__Item __v__ = __sn__Item_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+/* Struct: Detail (as val) */
+typedef struct {
+    char * __sn__id;
+    char * __sn__modelId;
+    char * __sn__action;
+    double __sn__confidence;
+    SnArray * __sn__distribution;
+} __sn__Detail;
+/* Value operations */
+static inline __sn__Detail __sn__Detail_copy(const __sn__Detail *src) {
+    __sn__Detail dst;
+    dst.__sn__id = src->__sn__id ? strdup(src->__sn__id) : NULL;
+    dst.__sn__modelId = src->__sn__modelId ? strdup(src->__sn__modelId) : NULL;
+    dst.__sn__action = src->__sn__action ? strdup(src->__sn__action) : NULL;
+    dst.__sn__confidence = src->__sn__confidence;
+    dst.__sn__distribution = sn_array_copy(src->__sn__distribution);
+    return dst;
+}
+
+static inline void __sn__Detail_cleanup(__sn__Detail *p) {
+    free(p->__sn__id);
+    free(p->__sn__modelId);
+    free(p->__sn__action);
+    sn_cleanup_array(&p->__sn__distribution);
+
+}
+
+#define sn_auto_Detail __attribute__((cleanup(__sn__Detail_cleanup)))
+
+static inline void __sn__Detail_cleanup_elem(void *p) { __sn__Detail_cleanup((__sn__Detail *)p); }
+static inline void __sn__Detail_copy_into(const void *src, void *dst) { *(__sn__Detail *)dst = __sn__Detail_copy((const __sn__Detail *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Detail *__sn__Detail_alloc(void) {
+    return calloc(1, sizeof(__sn__Detail));
+}
+
+static inline void __sn__Detail_release(__sn__Detail **p) {
+    if (*p) {
+        free((*p)->__sn__id);
+        free((*p)->__sn__modelId);
+        free((*p)->__sn__action);
+        sn_cleanup_array(&(*p)->__sn__distribution);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Detail __attribute__((cleanup(__sn__Detail_release)))
+
+static inline void __sn__Detail_release_elem(void *p) { __sn__Detail_release((__sn__Detail **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Detail_to_string(const __sn__Detail *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Detail { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__id ? p->__sn__id : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "modelId: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__modelId ? p->__sn__modelId : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "action: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__action ? p->__sn__action : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "confidence: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__confidence);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "distribution: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__distribution); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__Detail_encode_impl(__sn__Detail *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "id", __sn__self->__sn__id);
+    __sn__Encoder_writeStr(__sn__e, "modelId", __sn__self->__sn__modelId);
+    __sn__Encoder_writeStr(__sn__e, "action", __sn__self->__sn__action);
+    __sn__Encoder_writeDouble(__sn__e, "confidence", __sn__self->__sn__confidence);
+    { __sn__Encoder *__arr__ = __sn__Encoder_beginArray(__sn__e, "distribution"); for (long long __i__ = 0; __i__ < __sn__self->__sn__distribution->len; __i__++) { __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__arr__); __sn__Item_encode_impl(&((__sn__Item *)__sn__self->__sn__distribution->data)[__i__], __obj__); __sn__Encoder_end(__obj__); } __sn__Encoder_end(__arr__); }
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__Detail_encode(__sn__Detail *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Detail_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__Detail __sn__Detail_decode(__sn__Decoder *__sn__d) {
+    __sn__Detail __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__id = __sn__Decoder_readStr(__sn__d, "id");
+    __r__.__sn__modelId = __sn__Decoder_readStr(__sn__d, "modelId");
+    __r__.__sn__action = __sn__Decoder_readStr(__sn__d, "action");
+    __r__.__sn__confidence = __sn__Decoder_readDouble(__sn__d, "confidence");
+    { sn_auto_Decoder __sn__Decoder *__arr__ = __sn__Decoder_readArray(__sn__d, "distribution"); long long __len__ = __sn__Decoder_length(__arr__); __r__.__sn__distribution = sn_array_new(sizeof(__sn__Item), __len__); __r__.__sn__distribution->elem_release = __sn__Item_cleanup_elem; __r__.__sn__distribution->elem_copy = __sn__Item_copy_into; for (long long __i__ = 0; __i__ < __len__; __i__++) { sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__arr__, __i__); __sn__Item __v__ = __sn__Item_decode(__elem__); sn_array_push(__r__.__sn__distribution, &__v__); } }
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__Detail_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__Detail_encode_impl(&((__sn__Detail *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__Detail_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__Detail), __len__);
+    __arr__->elem_release = __sn__Detail_cleanup_elem;
+    __arr__->elem_copy = __sn__Detail_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__Detail __v__ = __sn__Detail_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+/* Struct: Summary (as val) */
+typedef struct {
+    char * __sn__id;
+    SnArray * __sn__vector;
+    long long __sn__dimension;
+} __sn__Summary;
+/* Value operations */
+static inline __sn__Summary __sn__Summary_copy(const __sn__Summary *src) {
+    __sn__Summary dst;
+    dst.__sn__id = src->__sn__id ? strdup(src->__sn__id) : NULL;
+    dst.__sn__vector = sn_array_copy(src->__sn__vector);
+    dst.__sn__dimension = src->__sn__dimension;
+    return dst;
+}
+
+static inline void __sn__Summary_cleanup(__sn__Summary *p) {
+    free(p->__sn__id);
+    sn_cleanup_array(&p->__sn__vector);
+
+}
+
+#define sn_auto_Summary __attribute__((cleanup(__sn__Summary_cleanup)))
+
+static inline void __sn__Summary_cleanup_elem(void *p) { __sn__Summary_cleanup((__sn__Summary *)p); }
+static inline void __sn__Summary_copy_into(const void *src, void *dst) { *(__sn__Summary *)dst = __sn__Summary_copy((const __sn__Summary *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Summary *__sn__Summary_alloc(void) {
+    return calloc(1, sizeof(__sn__Summary));
+}
+
+static inline void __sn__Summary_release(__sn__Summary **p) {
+    if (*p) {
+        free((*p)->__sn__id);
+        sn_cleanup_array(&(*p)->__sn__vector);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Summary __attribute__((cleanup(__sn__Summary_release)))
+
+static inline void __sn__Summary_release_elem(void *p) { __sn__Summary_release((__sn__Summary **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Summary_to_string(const __sn__Summary *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Summary { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__id ? p->__sn__id : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "vector: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__vector); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "dimension: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__dimension);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__Summary_encode_impl(__sn__Summary *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "id", __sn__self->__sn__id);
+    { __sn__Encoder *__arr__ = __sn__Encoder_beginArray(__sn__e, "vector"); for (long long __i__ = 0; __i__ < __sn__self->__sn__vector->len; __i__++) { __sn__Encoder_appendDouble(__arr__, ((double *)__sn__self->__sn__vector->data)[__i__]); } __sn__Encoder_end(__arr__); }
+    __sn__Encoder_writeInt(__sn__e, "dimension", __sn__self->__sn__dimension);
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__Summary_encode(__sn__Summary *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Summary_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__Summary __sn__Summary_decode(__sn__Decoder *__sn__d) {
+    __sn__Summary __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__id = __sn__Decoder_readStr(__sn__d, "id");
+    { sn_auto_Decoder __sn__Decoder *__arr__ = __sn__Decoder_readArray(__sn__d, "vector"); long long __len__ = __sn__Decoder_length(__arr__); __r__.__sn__vector = sn_array_new(sizeof(double), __len__); __r__.__sn__vector->elem_tag = SN_TAG_DOUBLE; for (long long __i__ = 0; __i__ < __len__; __i__++) { double __v__ = __sn__Decoder_atDouble(__arr__, __i__); sn_array_push(__r__.__sn__vector, &__v__); } }
+    __r__.__sn__dimension = __sn__Decoder_readInt(__sn__d, "dimension");
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__Summary_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__Summary_encode_impl(&((__sn__Summary *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__Summary_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__Summary), __len__);
+    __arr__->elem_release = __sn__Summary_cleanup_elem;
+    __arr__->elem_copy = __sn__Summary_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__Summary __v__ = __sn__Summary_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+/* Struct: Response (as val) */
+typedef struct {
+    __sn__Detail __sn__detail;
+    __sn__Summary __sn__summary;
+} __sn__Response;
+/* Value operations */
+static inline __sn__Response __sn__Response_copy(const __sn__Response *src) {
+    __sn__Response dst;
+    dst.__sn__detail = __sn__Detail_copy(&src->__sn__detail);
+    dst.__sn__summary = __sn__Summary_copy(&src->__sn__summary);
+    return dst;
+}
+
+static inline void __sn__Response_cleanup(__sn__Response *p) {
+    __sn__Detail_cleanup(&p->__sn__detail);
+    __sn__Summary_cleanup(&p->__sn__summary);
+
+}
+
+#define sn_auto_Response __attribute__((cleanup(__sn__Response_cleanup)))
+
+static inline void __sn__Response_cleanup_elem(void *p) { __sn__Response_cleanup((__sn__Response *)p); }
+static inline void __sn__Response_copy_into(const void *src, void *dst) { *(__sn__Response *)dst = __sn__Response_copy((const __sn__Response *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Response *__sn__Response_alloc(void) {
+    return calloc(1, sizeof(__sn__Response));
+}
+
+static inline void __sn__Response_release(__sn__Response **p) {
+    if (*p) {
+        __sn__Detail_cleanup(&(*p)->__sn__detail);
+        __sn__Summary_cleanup(&(*p)->__sn__summary);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Response __attribute__((cleanup(__sn__Response_release)))
+
+static inline void __sn__Response_release_elem(void *p) { __sn__Response_release((__sn__Response **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Response_to_string(const __sn__Response *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Response { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "detail: ");
+    { char *__fs__ = __sn__Detail_to_string(&p->__sn__detail); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "summary: ");
+    { char *__fs__ = __sn__Summary_to_string(&p->__sn__summary); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__Response_encode_impl(__sn__Response *__sn__self, __sn__Encoder *__sn__e) {
+    { __sn__Encoder *__sub__ = __sn__Encoder_beginObject(__sn__e, "detail"); __sn__Detail_encode_impl(&__sn__self->__sn__detail, __sub__); __sn__Encoder_end(__sub__); }
+    { __sn__Encoder *__sub__ = __sn__Encoder_beginObject(__sn__e, "summary"); __sn__Summary_encode_impl(&__sn__self->__sn__summary, __sub__); __sn__Encoder_end(__sub__); }
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__Response_encode(__sn__Response *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Response_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__Response __sn__Response_decode(__sn__Decoder *__sn__d) {
+    __sn__Response __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    { sn_auto_Decoder __sn__Decoder *__sub__ = __sn__Decoder_readObject(__sn__d, "detail"); __r__.__sn__detail = __sn__Detail_decode(__sub__); }
+    { sn_auto_Decoder __sn__Decoder *__sub__ = __sn__Decoder_readObject(__sn__d, "summary"); __r__.__sn__summary = __sn__Summary_decode(__sub__); }
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__Response_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__Response_encode_impl(&((__sn__Response *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__Response_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__Response), __len__);
+    __arr__->elem_release = __sn__Response_cleanup_elem;
+    __arr__->elem_copy = __sn__Response_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__Response __v__ = __sn__Response_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+
+__sn__Response __sn__decodeResponse(char *);
+
+
+
+
+#endif
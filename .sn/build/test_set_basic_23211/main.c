@@ -0,0 +1,84 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_set_int __sn__set_int * __sn__s = ({
+        __sn__set_int *__tmp__ = __sn__set_int__new();
+        __tmp__;
+    });
+    printf("%s\n", (__sn__set_int_add(__sn__s, 3LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_add(__sn__s, 1LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_add(__sn__s, 3LL)) ? "true" : "false");
+    
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__s)));
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__s, 1LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__s, 2LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_remove(__sn__s, 1LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_remove(__sn__s, 1LL)) ? "true" : "false");
+    
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__s)));
+    
+    __sn__set_int_add(__sn__s, (-5LL));
+    
+    __sn__set_int_add(__sn__s, 1000000000LL);
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__s, (-5LL))) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__s, 1000000000LL)) ? "true" : "false");
+    
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__s)));
+    
+    sn_auto_set_str __sn__set_str * __sn__words = ({
+        __sn__set_str *__tmp__ = __sn__set_str__new();
+        __tmp__;
+    });
+    __sn__set_str_add(__sn__words, "pear");
+    
+    __sn__set_str_add(__sn__words, "apple");
+    
+    __sn__set_str_add(__sn__words, "pear");
+    
+    printf("%lld\n", (long long)(__sn__set_str_length(__sn__words)));
+    
+    printf("%s\n", (__sn__set_str_contains(__sn__words, "apple")) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_str_contains(__sn__words, "plum")) ? "true" : "false");
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__set_str_length(__sn__words)));
+            sn_auto_str char *__is_p1__ = sn_strdup(" words");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    __sn__set_str_clear(__sn__words);
+    
+    printf("%lld\n", (long long)(__sn__set_str_length(__sn__words)));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__set_str_to_string(__sn__words);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_set_int __sn__set_int * __sn__small = ({
+        __sn__set_int *__tmp__ = __sn__set_int__new();
+        __tmp__;
+    });
+    __sn__set_int_add(__sn__small, 2LL);
+    
+    __sn__set_int_add(__sn__small, 1LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__set_int_to_string(__sn__small);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
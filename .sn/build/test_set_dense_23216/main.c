@@ -0,0 +1,140 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_set_int __sn__set_int * __sn__s = ({
+        __sn__set_int *__tmp__ = __sn__set_int__new();
+        __tmp__;
+    });
+    __sn__set_int_add(__sn__s, 5000LL);
+    
+    __sn__set_int_add(__sn__s, 2500LL);
+    
+    __sn__set_int_add(__sn__s, (-7LL));
+    
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 6000LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__set_int_add(__sn__s, __sn__i);
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__s)));
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__s, 2500LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__s, 5000LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__s, (-7LL))) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_add(__sn__s, 5000LL)) ? "true" : "false");
+    
+    long long __sn__removed = 0LL;
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 6000LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if ((sn_mod_long(__sn__i, 3LL) != 0LL)) {
+                    if (__sn__set_int_remove(__sn__s, __sn__i)) {
+                        (__sn__removed = sn_add_long(__sn__removed, 1LL));
+                        
+                    }
+                }
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__removed));
+    
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__s)));
+    
+    long long __sn__total = 0LL;
+    long long __sn__count = 0LL;
+    {
+        sn_auto_SetIter_int __sn__SetIter_int __sn_iter__ = __sn__set_int_iter(__sn__s);
+        while (__sn__SetIter_int_hasNext(&__sn_iter__)) {
+            long long __sn__x = __sn__SetIter_int_next(&__sn_iter__);
+            {
+                (__sn__total = sn_add_long(__sn__total, __sn__x));
+                
+                (__sn__count = sn_add_long(__sn__count, 1LL));
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__count));
+    
+    printf("%lld\n", (long long)(__sn__total));
+    
+    sn_auto_set_int __sn__set_int * __sn__big = ({
+        __sn__set_int *__tmp__ = __sn__set_int__new();
+        __tmp__;
+    });
+    __sn__set_int_add(__sn__big, (1LL << 40LL));
+    
+    __sn__set_int_add(__sn__big, 3LL);
+    
+    __sn__set_int_add(__sn__big, (1LL << 40LL));
+    
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__big)));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__set_int_to_string(__sn__big);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_set_bool __sn__set_bool * __sn__flags = ({
+        __sn__set_bool *__tmp__ = __sn__set_bool__new();
+        __tmp__;
+    });
+    __sn__set_bool_add(__sn__flags, true);
+    
+    __sn__set_bool_add(__sn__flags, true);
+    
+    printf("%lld\n", (long long)(__sn__set_bool_length(__sn__flags)));
+    
+    printf("%s\n", (__sn__set_bool_contains(__sn__flags, false)) ? "true" : "false");
+    
+    sn_auto_set_int __sn__set_int * __sn__bytes = ({
+        __sn__set_int *__tmp__ = __sn__set_int__new();
+        __tmp__;
+    });
+    sn_auto_arr SnArray * __sn__raw = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 4);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 255LL });
+            sn_array_push(__al__, &(unsigned char){ 0LL });
+            sn_array_push(__al__, &(unsigned char){ 255LL });
+            sn_array_push(__al__, &(unsigned char){ 17LL });
+            __al__;
+        });
+    {
+        SnArray *__arr_0__ = __sn__raw;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            unsigned char __sn__b = ((unsigned char *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__set_int_add(__sn__bytes, __sn__b);
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__bytes)));
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__bytes, (((unsigned char *)__sn__raw->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__raw->len : __ai__; })]))) ? "true" : "false");
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__set_int_to_string(__sn__bytes);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,378 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Set: set_int (built-in set, refcounted — see sn_set.h) */
+typedef SnSet __sn__set_int;
+
+static uint64_t __sn__set_int__hash(const void *p) {
+    const long long *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, (uint64_t)(*k));
+    return h;
+}
+
+static bool __sn__set_int__eq(const void *a, const void *b) {
+    const long long *x = a;
+    const long long *y = b;
+    return true
+        && (*x) == (*y);
+}
+
+static const SnSetOps __sn__set_int__ops = {
+    .map = {
+        .key_size = sizeof(long long),
+        .val_size = 0,
+        .hash = __sn__set_int__hash,
+        .eq = __sn__set_int__eq,
+        .key_tag = SN_TAG_INT,
+    },
+    .int_kind = SN_SET_INT_I64,
+};
+
+static inline __sn__set_int *__sn__set_int__new(void) {
+    return sn_set_new(&__sn__set_int__ops);
+}
+
+static inline __sn__set_int *__sn__set_int_retain(__sn__set_int *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__set_int_release(__sn__set_int **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_set_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__set_int *__sn__set_int_copy(const __sn__set_int *src) {
+    return sn_set_clone(src);
+}
+
+#define sn_auto_set_int __attribute__((cleanup(__sn__set_int_release)))
+#define sn_auto_ref_set_int __attribute__((cleanup(__sn__set_int_release)))
+
+static inline void __sn__set_int_release_elem(void *p) { __sn__set_int_release((__sn__set_int **)p); }
+static inline void __sn__set_int_retain_into(const void *src, void *dst) { *(__sn__set_int **)dst = __sn__set_int_retain(*(__sn__set_int *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__set_int_to_string(const __sn__set_int *p) {
+    return sn_set_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the set;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline bool __sn__set_int_add(__sn__set_int *s, long long value) {
+    bool r = sn_set_add(s, &value);
+    return r;
+}
+
+static inline bool __sn__set_int_contains(__sn__set_int *s, long long value) {
+    bool r = sn_set_contains(s, &value);
+    return r;
+}
+
+static inline bool __sn__set_int_remove(__sn__set_int *s, long long value) {
+    bool r = sn_set_remove(s, &value);
+    return r;
+}
+
+static inline long long __sn__set_int_length(__sn__set_int *s) {
+    return sn_set_len(s);
+}
+
+static inline void __sn__set_int_clear(__sn__set_int *s) {
+    sn_set_clear(s);
+}
+
+static inline __sn__set_int *__sn__set_int_union(__sn__set_int *s, __sn__set_int *other) {
+    return sn_set_union(s, other);
+}
+
+static inline __sn__set_int *__sn__set_int_intersect(__sn__set_int *s, __sn__set_int *other) {
+    return sn_set_intersect(s, other);
+}
+
+static inline __sn__set_int *__sn__set_int_difference(__sn__set_int *s, __sn__set_int *other) {
+    return sn_set_difference(s, other);
+}
+
+static inline SnArray *__sn__set_int_toArray(__sn__set_int *s) {
+    return sn_set_to_array(s);
+}
+
+static inline __sn__set_int *__sn__set_int_clone(__sn__set_int *s) {
+    return sn_set_clone(s);
+}
+/* Struct: SetIter_int (as val) */
+typedef struct {
+    __sn__set_int * __sn___set;
+    long long __sn___pos;
+} __sn__SetIter_int;
+/* Value operations */
+static inline __sn__SetIter_int __sn__SetIter_int_copy(const __sn__SetIter_int *src) {
+    __sn__SetIter_int dst;
+    dst.__sn___set = __sn__set_int_retain(src->__sn___set);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__SetIter_int_cleanup(__sn__SetIter_int *p) {
+    __sn__set_int_release(&p->__sn___set);
+
+}
+
+#define sn_auto_SetIter_int __attribute__((cleanup(__sn__SetIter_int_cleanup)))
+
+static inline void __sn__SetIter_int_cleanup_elem(void *p) { __sn__SetIter_int_cleanup((__sn__SetIter_int *)p); }
+static inline void __sn__SetIter_int_copy_into(const void *src, void *dst) { *(__sn__SetIter_int *)dst = __sn__SetIter_int_copy((const __sn__SetIter_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SetIter_int *__sn__SetIter_int_alloc(void) {
+    return calloc(1, sizeof(__sn__SetIter_int));
+}
+
+static inline void __sn__SetIter_int_release(__sn__SetIter_int **p) {
+    if (*p) {
+        __sn__set_int_release(&(*p)->__sn___set);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SetIter_int __attribute__((cleanup(__sn__SetIter_int_release)))
+
+static inline void __sn__SetIter_int_release_elem(void *p) { __sn__SetIter_int_release((__sn__SetIter_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SetIter_int_to_string(const __sn__SetIter_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SetIter_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_set: ");
+    { char *__fs__ = __sn__set_int_to_string(p->__sn___set); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Set iteration: set_int → long long */
+static inline __sn__SetIter_int __sn__set_int_iter(__sn__set_int *s) {
+    return (__sn__SetIter_int){ .__sn___set = __sn__set_int_retain(s), .__sn___pos = 0 };
+}
+
+static inline bool __sn__SetIter_int_hasNext(__sn__SetIter_int *it) {
+    it->__sn___pos = sn_set_next(it->__sn___set, it->__sn___pos);
+    return it->__sn___pos < sn_set_end(it->__sn___set);
+}
+
+static inline long long __sn__SetIter_int_next(__sn__SetIter_int *it) {
+    SnSet *s = it->__sn___set;
+    long long i = sn_set_next(s, it->__sn___pos);
+    if (i >= sn_set_end(s)) sn_map_panic("set iterator exhausted");
+    long long r;
+    sn_set_copy_at(s, i, &r);
+    it->__sn___pos = i + 1;
+    return r;
+}
+/* Set: set_bool (built-in set, refcounted — see sn_set.h) */
+typedef SnSet __sn__set_bool;
+
+static uint64_t __sn__set_bool__hash(const void *p) {
+    const bool *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, (uint64_t)(*k));
+    return h;
+}
+
+static bool __sn__set_bool__eq(const void *a, const void *b) {
+    const bool *x = a;
+    const bool *y = b;
+    return true
+        && (*x) == (*y);
+}
+
+static const SnSetOps __sn__set_bool__ops = {
+    .map = {
+        .key_size = sizeof(bool),
+        .val_size = 0,
+        .hash = __sn__set_bool__hash,
+        .eq = __sn__set_bool__eq,
+        .key_tag = SN_TAG_BOOL,
+    },
+    .int_kind = SN_SET_INT_U8,
+};
+
+static inline __sn__set_bool *__sn__set_bool__new(void) {
+    return sn_set_new(&__sn__set_bool__ops);
+}
+
+static inline __sn__set_bool *__sn__set_bool_retain(__sn__set_bool *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__set_bool_release(__sn__set_bool **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_set_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__set_bool *__sn__set_bool_copy(const __sn__set_bool *src) {
+    return sn_set_clone(src);
+}
+
+#define sn_auto_set_bool __attribute__((cleanup(__sn__set_bool_release)))
+#define sn_auto_ref_set_bool __attribute__((cleanup(__sn__set_bool_release)))
+
+static inline void __sn__set_bool_release_elem(void *p) { __sn__set_bool_release((__sn__set_bool **)p); }
+static inline void __sn__set_bool_retain_into(const void *src, void *dst) { *(__sn__set_bool **)dst = __sn__set_bool_retain(*(__sn__set_bool *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__set_bool_to_string(const __sn__set_bool *p) {
+    return sn_set_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the set;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline bool __sn__set_bool_add(__sn__set_bool *s, bool value) {
+    bool r = sn_set_add(s, &value);
+    return r;
+}
+
+static inline bool __sn__set_bool_contains(__sn__set_bool *s, bool value) {
+    bool r = sn_set_contains(s, &value);
+    return r;
+}
+
+static inline bool __sn__set_bool_remove(__sn__set_bool *s, bool value) {
+    bool r = sn_set_remove(s, &value);
+    return r;
+}
+
+static inline long long __sn__set_bool_length(__sn__set_bool *s) {
+    return sn_set_len(s);
+}
+
+static inline void __sn__set_bool_clear(__sn__set_bool *s) {
+    sn_set_clear(s);
+}
+
+static inline __sn__set_bool *__sn__set_bool_union(__sn__set_bool *s, __sn__set_bool *other) {
+    return sn_set_union(s, other);
+}
+
+static inline __sn__set_bool *__sn__set_bool_intersect(__sn__set_bool *s, __sn__set_bool *other) {
+    return sn_set_intersect(s, other);
+}
+
+static inline __sn__set_bool *__sn__set_bool_difference(__sn__set_bool *s, __sn__set_bool *other) {
+    return sn_set_difference(s, other);
+}
+
+static inline SnArray *__sn__set_bool_toArray(__sn__set_bool *s) {
+    return sn_set_to_array(s);
+}
+
+static inline __sn__set_bool *__sn__set_bool_clone(__sn__set_bool *s) {
+    return sn_set_clone(s);
+}
+/* Struct: SetIter_bool (as val) */
+typedef struct {
+    __sn__set_bool * __sn___set;
+    long long __sn___pos;
+} __sn__SetIter_bool;
+/* Value operations */
+static inline __sn__SetIter_bool __sn__SetIter_bool_copy(const __sn__SetIter_bool *src) {
+    __sn__SetIter_bool dst;
+    dst.__sn___set = __sn__set_bool_retain(src->__sn___set);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__SetIter_bool_cleanup(__sn__SetIter_bool *p) {
+    __sn__set_bool_release(&p->__sn___set);
+
+}
+
+#define sn_auto_SetIter_bool __attribute__((cleanup(__sn__SetIter_bool_cleanup)))
+
+static inline void __sn__SetIter_bool_cleanup_elem(void *p) { __sn__SetIter_bool_cleanup((__sn__SetIter_bool *)p); }
+static inline void __sn__SetIter_bool_copy_into(const void *src, void *dst) { *(__sn__SetIter_bool *)dst = __sn__SetIter_bool_copy((const __sn__SetIter_bool *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SetIter_bool *__sn__SetIter_bool_alloc(void) {
+    return calloc(1, sizeof(__sn__SetIter_bool));
+}
+
+static inline void __sn__SetIter_bool_release(__sn__SetIter_bool **p) {
+    if (*p) {
+        __sn__set_bool_release(&(*p)->__sn___set);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SetIter_bool __attribute__((cleanup(__sn__SetIter_bool_release)))
+
+static inline void __sn__SetIter_bool_release_elem(void *p) { __sn__SetIter_bool_release((__sn__SetIter_bool **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SetIter_bool_to_string(const __sn__SetIter_bool *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SetIter_bool { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_set: ");
+    { char *__fs__ = __sn__set_bool_to_string(p->__sn___set); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Set iteration: set_bool → bool */
+static inline __sn__SetIter_bool __sn__set_bool_iter(__sn__set_bool *s) {
+    return (__sn__SetIter_bool){ .__sn___set = __sn__set_bool_retain(s), .__sn___pos = 0 };
+}
+
+static inline bool __sn__SetIter_bool_hasNext(__sn__SetIter_bool *it) {
+    it->__sn___pos = sn_set_next(it->__sn___set, it->__sn___pos);
+    return it->__sn___pos < sn_set_end(it->__sn___set);
+}
+
+static inline bool __sn__SetIter_bool_next(__sn__SetIter_bool *it) {
+    SnSet *s = it->__sn___set;
+    long long i = sn_set_next(s, it->__sn___pos);
+    if (i >= sn_set_end(s)) sn_map_panic("set iterator exhausted");
+    bool r;
+    sn_set_copy_at(s, i, &r);
+    it->__sn___pos = i + 1;
+    return r;
+}
+
+
+
+
+
+#endif
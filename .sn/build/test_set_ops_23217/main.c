@@ -0,0 +1,160 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_set_int __sn__set_int * __sn__evens = ({
+        __sn__set_int *__tmp__ = __sn__set_int__new();
+        __tmp__;
+    });
+    sn_auto_set_int __sn__set_int * __sn__threes = ({
+        __sn__set_int *__tmp__ = __sn__set_int__new();
+        __tmp__;
+    });
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 20LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if ((sn_mod_long(__sn__i, 2LL) == 0LL)) {
+                    __sn__set_int_add(__sn__evens, __sn__i);
+                    
+                }
+                if ((sn_mod_long(__sn__i, 3LL) == 0LL)) {
+                    __sn__set_int_add(__sn__threes, __sn__i);
+                    
+                }
+            }
+        }
+    }
+    __sn__set_int_add(__sn__threes, (-3LL));
+    
+    __sn__set_int_add(__sn__threes, 9000000LL);
+    
+    sn_auto_set_int __sn__set_int * __sn__u = ({
+        __sn__set_int *__bi_snap_0__ = __sn__threes;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__set_int *__bi_result__ = __sn__set_int_union(__sn__evens, __sn__threes);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__set_int_retain(__bi_result__);
+        __bi_result__;
+    });
+    sn_auto_set_int __sn__set_int * __sn__n = ({
+        __sn__set_int *__bi_snap_0__ = __sn__threes;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__set_int *__bi_result__ = __sn__set_int_intersect(__sn__evens, __sn__threes);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__set_int_retain(__bi_result__);
+        __bi_result__;
+    });
+    sn_auto_set_int __sn__set_int * __sn__d = ({
+        __sn__set_int *__bi_snap_0__ = __sn__threes;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__set_int *__bi_result__ = __sn__set_int_difference(__sn__evens, __sn__threes);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__set_int_retain(__bi_result__);
+        __bi_result__;
+    });
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__u)));
+    
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__n)));
+    
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__d)));
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__u, (-3LL))) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__u, 9000000LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__n, 6LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__d, 6LL)) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_int_contains(__sn__d, 4LL)) ? "true" : "false");
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn__set_int_to_string(__sn__n);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__total = 0LL;
+    {
+        sn_auto_SetIter_int __sn__SetIter_int __sn_iter__ = __sn__set_int_iter(__sn__u);
+        while (__sn__SetIter_int_hasNext(&__sn_iter__)) {
+            long long __sn__x = __sn__SetIter_int_next(&__sn_iter__);
+            {
+                (__sn__total = sn_add_long(__sn__total, __sn__x));
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__total));
+    
+    sn_auto_arr SnArray * __sn__arr = __sn__set_int_toArray(__sn__d);
+    printf("%lld\n", (long long)(sn_array_length(__sn__arr)));
+    
+    printf("%lld\n", (long long)(__sn__arr_int_sum_checked(&__sn__arr)));
+    
+    sn_auto_set_int __sn__set_int * __sn__c = __sn__set_int_clone(__sn__u);
+    __sn__set_int_remove(__sn__c, 0LL);
+    
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__u)));
+    
+    printf("%lld\n", (long long)(__sn__set_int_length(__sn__c)));
+    
+    sn_auto_set_str __sn__set_str * __sn__a = ({
+        __sn__set_str *__tmp__ = __sn__set_str__new();
+        __tmp__;
+    });
+    sn_auto_set_str __sn__set_str * __sn__b = ({
+        __sn__set_str *__tmp__ = __sn__set_str__new();
+        __tmp__;
+    });
+    __sn__set_str_add(__sn__a, "x");
+    
+    __sn__set_str_add(__sn__a, "y");
+    
+    __sn__set_str_add(__sn__b, "y");
+    
+    __sn__set_str_add(__sn__b, "z");
+    
+    sn_auto_set_str __sn__set_str * __sn____chain_tmp_0 = ({
+        __sn__set_str *__bi_snap_0__ = __sn__b;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__set_str *__bi_result__ = __sn__set_str_union(__sn__a, __sn__b);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__set_str_retain(__bi_result__);
+        __bi_result__;
+    });
+    printf("%lld\n", (long long)(__sn__set_str_length(__sn____chain_tmp_0)));
+    
+    sn_auto_set_str __sn__set_str * __sn____chain_tmp_1 = ({
+        __sn__set_str *__bi_snap_0__ = __sn__b;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__set_str *__bi_result__ = __sn__set_str_intersect(__sn__a, __sn__b);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__set_str_retain(__bi_result__);
+        __bi_result__;
+    });
+    printf("%s\n", (__sn__set_str_contains(__sn____chain_tmp_1, "y")) ? "true" : "false");
+    
+    sn_auto_set_str __sn__set_str * __sn____chain_tmp_2 = ({
+        __sn__set_str *__bi_snap_0__ = __sn__b;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__set_str *__bi_result__ = __sn__set_str_difference(__sn__a, __sn__b);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__set_str_retain(__bi_result__);
+        __bi_result__;
+    });
+    printf("%s\n", (__sn__set_str_contains(__sn____chain_tmp_2, "x")) ? "true" : "false");
+    
+    long long __sn__count = 0LL;
+    {
+        sn_auto_SetIter_str __sn__SetIter_str __sn_iter__ = __sn__set_str_iter(__sn__a);
+        while (__sn__SetIter_str_hasNext(&__sn_iter__)) {
+            sn_auto_str char * __sn__w = __sn__SetIter_str_next(&__sn_iter__);
+            {
+                (__sn__count = sn_add_long(__sn__count, sn_str_length(__sn__w)));
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__count));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include "sn_types.h"
+
+
+
+
+
+int main() {
+    sn_auto_set_Point __sn__set_Point * __sn__pts = ({
+        __sn__set_Point *__tmp__ = __sn__set_Point__new();
+        __tmp__;
+    });
+    __sn__set_Point_add(__sn__pts, (__sn__Point){ .__sn__x = 1LL, .__sn__y = 2LL });
+    
+    __sn__set_Point_add(__sn__pts, (__sn__Point){ .__sn__x = 2LL, .__sn__y = 1LL });
+    
+    __sn__set_Point_add(__sn__pts, (__sn__Point){ .__sn__x = 1LL, .__sn__y = 2LL });
+    
+    printf("%lld\n", (long long)(__sn__set_Point_length(__sn__pts)));
+    
+    printf("%s\n", (__sn__set_Point_contains(__sn__pts, (__sn__Point){ .__sn__x = 2LL, .__sn__y = 1LL })) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_Point_contains(__sn__pts, (__sn__Point){ .__sn__x = 3LL, .__sn__y = 3LL })) ? "true" : "false");
+    
+    sn_auto_set_Tag __sn__set_Tag * __sn__tags = ({
+        __sn__set_Tag *__tmp__ = __sn__set_Tag__new();
+        __tmp__;
+    });
+    sn_auto_Tag __sn__Tag __sn__t = (__sn__Tag){ .__sn__name = strdup("hot"), .__sn__level = 1LL };
+    __sn__set_Tag_add(__sn__tags, __sn__Tag_copy(&(__sn__t)));
+    
+    __sn__set_Tag_add(__sn__tags, (__sn__Tag){ .__sn__name = strdup("hot"), .__sn__level = 2LL });
+    
+    __sn__set_Tag_add(__sn__tags, (__sn__Tag){ .__sn__name = strdup("hot"), .__sn__level = 1LL });
+    
+    printf("%lld\n", (long long)(__sn__set_Tag_length(__sn__tags)));
+    
+    printf("%s\n", (__sn__set_Tag_contains(__sn__tags, __sn__Tag_copy(&(__sn__t)))) ? "true" : "false");
+    
+    printf("%s\n", (__sn__set_Tag_remove(__sn__tags, (__sn__Tag){ .__sn__name = strdup("hot"), .__sn__level = 2LL })) ? "true" : "false");
+    
+    long long __sn__sum = 0LL;
+    {
+        sn_auto_SetIter_Tag __sn__SetIter_Tag __sn_iter__ = __sn__set_Tag_iter(__sn__tags);
+        while (__sn__SetIter_Tag_hasNext(&__sn_iter__)) {
+            sn_auto_Tag __sn__Tag __sn__tag = __sn__SetIter_Tag_next(&__sn_iter__);
+            {
+                (__sn__sum = sn_add_long(sn_add_long(__sn__sum, __sn__tag.__sn__level), sn_str_length(__sn__tag.__sn__name)));
+                
+            }
+        }
+    }
+    printf("%lld\n", (long long)(__sn__sum));
+    
+    sn_auto_arr SnArray * __sn__arr = __sn__set_Tag_toArray(__sn__tags);
+    printf("%lld\n", (long long)(sn_array_length(__sn__arr)));
+    
+    printf("%lld\n", (long long)((((__sn__Tag *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]).__sn__level));
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,8 @@
+#include "sn_types.h"
+
+
+
+
+
+
+
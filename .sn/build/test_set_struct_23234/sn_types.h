@@ -0,0 +1,502 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Tag (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__level;
+} __sn__Tag;
+/* Value operations */
+static inline __sn__Tag __sn__Tag_copy(const __sn__Tag *src) {
+    __sn__Tag dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__level = src->__sn__level;
+    return dst;
+}
+
+static inline void __sn__Tag_cleanup(__sn__Tag *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Tag __attribute__((cleanup(__sn__Tag_cleanup)))
+
+static inline void __sn__Tag_cleanup_elem(void *p) { __sn__Tag_cleanup((__sn__Tag *)p); }
+static inline void __sn__Tag_copy_into(const void *src, void *dst) { *(__sn__Tag *)dst = __sn__Tag_copy((const __sn__Tag *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Tag *__sn__Tag_alloc(void) {
+    return calloc(1, sizeof(__sn__Tag));
+}
+
+static inline void __sn__Tag_release(__sn__Tag **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Tag __attribute__((cleanup(__sn__Tag_release)))
+
+static inline void __sn__Tag_release_elem(void *p) { __sn__Tag_release((__sn__Tag **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Tag_to_string(const __sn__Tag *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Tag { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "level: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__level);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Set: set_Point (built-in set, refcounted — see sn_set.h) */
+typedef SnSet __sn__set_Point;
+
+static uint64_t __sn__set_Point__hash(const void *p) {
+    const __sn__Point *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, (uint64_t)(*k).__sn__x);
+    h = sn_hash_mix(h, (uint64_t)(*k).__sn__y);
+    return h;
+}
+
+static bool __sn__set_Point__eq(const void *a, const void *b) {
+    const __sn__Point *x = a;
+    const __sn__Point *y = b;
+    return true
+        && (*x).__sn__x == (*y).__sn__x
+        && (*x).__sn__y == (*y).__sn__y;
+}
+static char *__sn__set_Point__key_str(const void *p) {
+    return __sn__Point_to_string((const __sn__Point *)p);
+}
+
+static const SnSetOps __sn__set_Point__ops = {
+    .map = {
+        .key_size = sizeof(__sn__Point),
+        .val_size = 0,
+        .hash = __sn__set_Point__hash,
+        .eq = __sn__set_Point__eq,
+        .key_tag = SN_TAG_STRUCT,
+        .key_str = __sn__set_Point__key_str,
+    },
+    .int_kind = SN_SET_INT_NONE,
+};
+
+static inline __sn__set_Point *__sn__set_Point__new(void) {
+    return sn_set_new(&__sn__set_Point__ops);
+}
+
+static inline __sn__set_Point *__sn__set_Point_retain(__sn__set_Point *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__set_Point_release(__sn__set_Point **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_set_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__set_Point *__sn__set_Point_copy(const __sn__set_Point *src) {
+    return sn_set_clone(src);
+}
+
+#define sn_auto_set_Point __attribute__((cleanup(__sn__set_Point_release)))
+#define sn_auto_ref_set_Point __attribute__((cleanup(__sn__set_Point_release)))
+
+static inline void __sn__set_Point_release_elem(void *p) { __sn__set_Point_release((__sn__set_Point **)p); }
+static inline void __sn__set_Point_retain_into(const void *src, void *dst) { *(__sn__set_Point **)dst = __sn__set_Point_retain(*(__sn__set_Point *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__set_Point_to_string(const __sn__set_Point *p) {
+    return sn_set_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the set;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline bool __sn__set_Point_add(__sn__set_Point *s, __sn__Point value) {
+    bool r = sn_set_add(s, &value);
+    return r;
+}
+
+static inline bool __sn__set_Point_contains(__sn__set_Point *s, __sn__Point value) {
+    bool r = sn_set_contains(s, &value);
+    return r;
+}
+
+static inline bool __sn__set_Point_remove(__sn__set_Point *s, __sn__Point value) {
+    bool r = sn_set_remove(s, &value);
+    return r;
+}
+
+static inline long long __sn__set_Point_length(__sn__set_Point *s) {
+    return sn_set_len(s);
+}
+
+static inline void __sn__set_Point_clear(__sn__set_Point *s) {
+    sn_set_clear(s);
+}
+
+static inline __sn__set_Point *__sn__set_Point_union(__sn__set_Point *s, __sn__set_Point *other) {
+    return sn_set_union(s, other);
+}
+
+static inline __sn__set_Point *__sn__set_Point_intersect(__sn__set_Point *s, __sn__set_Point *other) {
+    return sn_set_intersect(s, other);
+}
+
+static inline __sn__set_Point *__sn__set_Point_difference(__sn__set_Point *s, __sn__set_Point *other) {
+    return sn_set_difference(s, other);
+}
+
+static inline SnArray *__sn__set_Point_toArray(__sn__set_Point *s) {
+    return sn_set_to_array(s);
+}
+
+static inline __sn__set_Point *__sn__set_Point_clone(__sn__set_Point *s) {
+    return sn_set_clone(s);
+}
+/* Struct: SetIter_Point (as val) */
+typedef struct {
+    __sn__set_Point * __sn___set;
+    long long __sn___pos;
+} __sn__SetIter_Point;
+/* Value operations */
+static inline __sn__SetIter_Point __sn__SetIter_Point_copy(const __sn__SetIter_Point *src) {
+    __sn__SetIter_Point dst;
+    dst.__sn___set = __sn__set_Point_retain(src->__sn___set);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__SetIter_Point_cleanup(__sn__SetIter_Point *p) {
+    __sn__set_Point_release(&p->__sn___set);
+
+}
+
+#define sn_auto_SetIter_Point __attribute__((cleanup(__sn__SetIter_Point_cleanup)))
+
+static inline void __sn__SetIter_Point_cleanup_elem(void *p) { __sn__SetIter_Point_cleanup((__sn__SetIter_Point *)p); }
+static inline void __sn__SetIter_Point_copy_into(const void *src, void *dst) { *(__sn__SetIter_Point *)dst = __sn__SetIter_Point_copy((const __sn__SetIter_Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SetIter_Point *__sn__SetIter_Point_alloc(void) {
+    return calloc(1, sizeof(__sn__SetIter_Point));
+}
+
+static inline void __sn__SetIter_Point_release(__sn__SetIter_Point **p) {
+    if (*p) {
+        __sn__set_Point_release(&(*p)->__sn___set);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SetIter_Point __attribute__((cleanup(__sn__SetIter_Point_release)))
+
+static inline void __sn__SetIter_Point_release_elem(void *p) { __sn__SetIter_Point_release((__sn__SetIter_Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SetIter_Point_to_string(const __sn__SetIter_Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SetIter_Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_set: ");
+    { char *__fs__ = __sn__set_Point_to_string(p->__sn___set); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Set iteration: set_Point → __sn__Point */
+static inline __sn__SetIter_Point __sn__set_Point_iter(__sn__set_Point *s) {
+    return (__sn__SetIter_Point){ .__sn___set = __sn__set_Point_retain(s), .__sn___pos = 0 };
+}
+
+static inline bool __sn__SetIter_Point_hasNext(__sn__SetIter_Point *it) {
+    it->__sn___pos = sn_set_next(it->__sn___set, it->__sn___pos);
+    return it->__sn___pos < sn_set_end(it->__sn___set);
+}
+
+static inline __sn__Point __sn__SetIter_Point_next(__sn__SetIter_Point *it) {
+    SnSet *s = it->__sn___set;
+    long long i = sn_set_next(s, it->__sn___pos);
+    if (i >= sn_set_end(s)) sn_map_panic("set iterator exhausted");
+    __sn__Point r;
+    sn_set_copy_at(s, i, &r);
+    it->__sn___pos = i + 1;
+    return r;
+}
+/* Set: set_Tag (built-in set, refcounted — see sn_set.h) */
+typedef SnSet __sn__set_Tag;
+
+static uint64_t __sn__set_Tag__hash(const void *p) {
+    const __sn__Tag *k = p;
+    uint64_t h = 0;
+    h = sn_hash_mix(h, sn_hash_str((*k).__sn__name));
+    h = sn_hash_mix(h, (uint64_t)(*k).__sn__level);
+    return h;
+}
+
+static bool __sn__set_Tag__eq(const void *a, const void *b) {
+    const __sn__Tag *x = a;
+    const __sn__Tag *y = b;
+    return true        && sn_map_str_eq((*x).__sn__name, (*y).__sn__name)
+        && (*x).__sn__level == (*y).__sn__level;
+}
+static char *__sn__set_Tag__key_str(const void *p) {
+    return __sn__Tag_to_string((const __sn__Tag *)p);
+}
+
+static const SnSetOps __sn__set_Tag__ops = {
+    .map = {
+        .key_size = sizeof(__sn__Tag),
+        .val_size = 0,
+        .hash = __sn__set_Tag__hash,
+        .eq = __sn__set_Tag__eq,
+        .key_copy = __sn__Tag_copy_into,
+        .key_release = __sn__Tag_cleanup_elem,
+        .key_tag = SN_TAG_STRUCT,
+        .key_str = __sn__set_Tag__key_str,
+    },
+    .int_kind = SN_SET_INT_NONE,
+};
+
+static inline __sn__set_Tag *__sn__set_Tag__new(void) {
+    return sn_set_new(&__sn__set_Tag__ops);
+}
+
+static inline __sn__set_Tag *__sn__set_Tag_retain(__sn__set_Tag *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__set_Tag_release(__sn__set_Tag **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        sn_set_free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__set_Tag *__sn__set_Tag_copy(const __sn__set_Tag *src) {
+    return sn_set_clone(src);
+}
+
+#define sn_auto_set_Tag __attribute__((cleanup(__sn__set_Tag_release)))
+#define sn_auto_ref_set_Tag __attribute__((cleanup(__sn__set_Tag_release)))
+
+static inline void __sn__set_Tag_release_elem(void *p) { __sn__set_Tag_release((__sn__set_Tag **)p); }
+static inline void __sn__set_Tag_retain_into(const void *src, void *dst) { *(__sn__set_Tag **)dst = __sn__set_Tag_retain(*(__sn__set_Tag *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__set_Tag_to_string(const __sn__set_Tag *p) {
+    return sn_set_to_string(p);
+}
+
+/* Methods — str/array/ref arguments are borrowed and copied into the set;
+ * composite val-struct arguments are owned by the callee (native call ABI). */
+static inline bool __sn__set_Tag_add(__sn__set_Tag *s, __sn__Tag value) {
+    bool r = sn_set_add(s, &value);
+    __sn__Tag_cleanup(&value);
+    return r;
+}
+
+static inline bool __sn__set_Tag_contains(__sn__set_Tag *s, __sn__Tag value) {
+    bool r = sn_set_contains(s, &value);
+    __sn__Tag_cleanup(&value);
+    return r;
+}
+
+static inline bool __sn__set_Tag_remove(__sn__set_Tag *s, __sn__Tag value) {
+    bool r = sn_set_remove(s, &value);
+    __sn__Tag_cleanup(&value);
+    return r;
+}
+
+static inline long long __sn__set_Tag_length(__sn__set_Tag *s) {
+    return sn_set_len(s);
+}
+
+static inline void __sn__set_Tag_clear(__sn__set_Tag *s) {
+    sn_set_clear(s);
+}
+
+static inline __sn__set_Tag *__sn__set_Tag_union(__sn__set_Tag *s, __sn__set_Tag *other) {
+    return sn_set_union(s, other);
+}
+
+static inline __sn__set_Tag *__sn__set_Tag_intersect(__sn__set_Tag *s, __sn__set_Tag *other) {
+    return sn_set_intersect(s, other);
+}
+
+static inline __sn__set_Tag *__sn__set_Tag_difference(__sn__set_Tag *s, __sn__set_Tag *other) {
+    return sn_set_difference(s, other);
+}
+
+static inline SnArray *__sn__set_Tag_toArray(__sn__set_Tag *s) {
+    return sn_set_to_array(s);
+}
+
+static inline __sn__set_Tag *__sn__set_Tag_clone(__sn__set_Tag *s) {
+    return sn_set_clone(s);
+}
+/* Struct: SetIter_Tag (as val) */
+typedef struct {
+    __sn__set_Tag * __sn___set;
+    long long __sn___pos;
+} __sn__SetIter_Tag;
+/* Value operations */
+static inline __sn__SetIter_Tag __sn__SetIter_Tag_copy(const __sn__SetIter_Tag *src) {
+    __sn__SetIter_Tag dst;
+    dst.__sn___set = __sn__set_Tag_retain(src->__sn___set);
+    dst.__sn___pos = src->__sn___pos;
+    return dst;
+}
+
+static inline void __sn__SetIter_Tag_cleanup(__sn__SetIter_Tag *p) {
+    __sn__set_Tag_release(&p->__sn___set);
+
+}
+
+#define sn_auto_SetIter_Tag __attribute__((cleanup(__sn__SetIter_Tag_cleanup)))
+
+static inline void __sn__SetIter_Tag_cleanup_elem(void *p) { __sn__SetIter_Tag_cleanup((__sn__SetIter_Tag *)p); }
+static inline void __sn__SetIter_Tag_copy_into(const void *src, void *dst) { *(__sn__SetIter_Tag *)dst = __sn__SetIter_Tag_copy((const __sn__SetIter_Tag *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SetIter_Tag *__sn__SetIter_Tag_alloc(void) {
+    return calloc(1, sizeof(__sn__SetIter_Tag));
+}
+
+static inline void __sn__SetIter_Tag_release(__sn__SetIter_Tag **p) {
+    if (*p) {
+        __sn__set_Tag_release(&(*p)->__sn___set);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SetIter_Tag __attribute__((cleanup(__sn__SetIter_Tag_release)))
+
+static inline void __sn__SetIter_Tag_release_elem(void *p) { __sn__SetIter_Tag_release((__sn__SetIter_Tag **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SetIter_Tag_to_string(const __sn__SetIter_Tag *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SetIter_Tag { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_set: ");
+    { char *__fs__ = __sn__set_Tag_to_string(p->__sn___set); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "_pos: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn___pos);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Set iteration: set_Tag → __sn__Tag */
+static inline __sn__SetIter_Tag __sn__set_Tag_iter(__sn__set_Tag *s) {
+    return (__sn__SetIter_Tag){ .__sn___set = __sn__set_Tag_retain(s), .__sn___pos = 0 };
+}
+
+static inline bool __sn__SetIter_Tag_hasNext(__sn__SetIter_Tag *it) {
+    it->__sn___pos = sn_set_next(it->__sn___set, it->__sn___pos);
+    return it->__sn___pos < sn_set_end(it->__sn___set);
+}
+
+static inline __sn__Tag __sn__SetIter_Tag_next(__sn__SetIter_Tag *it) {
+    SnSet *s = it->__sn___set;
+    long long i = sn_set_next(s, it->__sn___pos);
+    if (i >= sn_set_end(s)) sn_map_panic("set iterator exhausted");
+    __sn__Tag r;
+    sn_set_copy_at(s, i, &r);
+    it->__sn___pos = i + 1;
+    return r;
+}
+
+
+
+
+
+#endif
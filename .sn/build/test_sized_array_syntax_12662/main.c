@@ -0,0 +1,76 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__sa__ = sn_array_new(sizeof(long long), 10LL);
+            __sa__->elem_tag = SN_TAG_INT;
+    
+            for (long long __si__ = 0; __si__ < (long long)(10LL); __si__++) {
+                sn_array_push(__sa__, &(long long){  });
+            }
+            __sa__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("arr[0]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__arr2 = ({
+            SnArray *__sa__ = sn_array_new(sizeof(long long), 5LL);
+            __sa__->elem_tag = SN_TAG_INT;
+    
+            for (long long __si__ = 0; __si__ < (long long)(5LL); __si__++) {
+                sn_array_push(__sa__, &(long long){  });
+            }
+            __sa__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("arr2[0]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr2->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr2->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__arr3 = ({
+            SnArray *__sa__ = sn_array_new(sizeof(bool), 100LL);
+            __sa__->elem_tag = SN_TAG_BOOL;
+    
+            for (long long __si__ = 0; __si__ < (long long)(100LL); __si__++) {
+                sn_array_push(__sa__, &(bool){  });
+            }
+            __sa__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("arr3[0]: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(((((bool *)__sn__arr3->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr3->len : __ai__; })])) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__arr4 = ({
+            SnArray *__sa__ = sn_array_new(sizeof(char *), 3LL);
+            __sa__->elem_tag = SN_TAG_STRING;
+            __sa__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __sa__->elem_copy = sn_copy_str;
+    
+            for (long long __si__ = 0; __si__ < (long long)(3LL); __si__++) {
+                sn_array_push(__sa__, &(char *){ strdup() });
+            }
+            __sa__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("arr4[0]: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__arr4->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr4->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("Sized array syntax test complete\n");
+    
+    fflush(stdout);
+    return 0;
+}
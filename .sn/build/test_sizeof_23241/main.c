@@ -0,0 +1,604 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_sizeof_in_normal_function() {
+
+    sn_assert((sizeof(long long) == 8LL), "normal fn: sizeof(int)");
+    
+
+    sn_assert((sizeof(long long) == 8LL), "normal fn: sizeof(long)");
+    
+
+    sn_assert((sizeof(double) == 8LL), "normal fn: sizeof(double)");
+    
+
+    sn_assert((sizeof(float) == 4LL), "normal fn: sizeof(float)");
+    
+
+    sn_assert((sizeof(unsigned char) == 1LL), "normal fn: sizeof(byte)");
+    
+
+    sn_assert((sizeof(bool) == 1LL), "normal fn: sizeof(bool)");
+    
+
+    sn_assert((sizeof(char) == 1LL), "normal fn: sizeof(char)");
+    
+
+    sn_assert((sizeof(int32_t) == 4LL), "normal fn: sizeof(int32)");
+    
+
+    sn_assert((sizeof(uint64_t) == 8LL), "normal fn: sizeof(uint)");
+    
+
+    sn_assert((sizeof(uint32_t) == 4LL), "normal fn: sizeof(uint32)");
+    
+
+    sn_assert((sizeof(__sn__Point) == 16LL), "normal fn: sizeof(Point)");
+    
+
+    sn_assert((sizeof(__sn__SmallStruct) == 8LL), "normal fn: sizeof(SmallStruct)");
+    
+
+    sn_assert((sizeof(__sn__NestedStruct) == 24LL), "normal fn: sizeof(NestedStruct)");
+    
+
+    long long __sn__x = 42LL;
+
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 1.0, .__sn__y = 2.0 };
+
+    sn_assert((sizeof(long long) == 8LL), "normal fn: sizeof int var");
+    
+
+    sn_assert((sizeof(__sn__Point) == 16LL), "normal fn: sizeof Point var");
+    
+
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+
+    sn_assert((sizeof(SnArray *) == 8LL), "normal fn: sizeof array");
+    
+
+    sn_assert((sn_array_length(__sn__arr) == 3LL), "normal fn: array .length");
+    
+
+    sn_print("test_sizeof_in_normal_function: PASS\n");
+    
+}
+
+void test_sizeof_in_native() {
+
+    sn_assert((sizeof(long long) == 8LL), "native: sizeof(int)");
+    
+
+    sn_assert((sizeof(long long) == 8LL), "native: sizeof(long)");
+    
+
+    sn_assert((sizeof(double) == 8LL), "native: sizeof(double)");
+    
+
+    sn_assert((sizeof(float) == 4LL), "native: sizeof(float)");
+    
+
+    sn_assert((sizeof(unsigned char) == 1LL), "native: sizeof(byte)");
+    
+
+    sn_assert((sizeof(bool) == 1LL), "native: sizeof(bool)");
+    
+
+    sn_assert((sizeof(char) == 1LL), "native: sizeof(char)");
+    
+
+    sn_assert((sizeof(int32_t) == 4LL), "native: sizeof(int32)");
+    
+
+    sn_assert((sizeof(uint64_t) == 8LL), "native: sizeof(uint)");
+    
+
+    sn_assert((sizeof(uint32_t) == 4LL), "native: sizeof(uint32)");
+    
+
+    sn_assert((sizeof(void *) == 8LL), "native: sizeof(*int)");
+    
+
+    sn_assert((sizeof(void *) == 8LL), "native: sizeof(*byte)");
+    
+
+    sn_assert((sizeof(void *) == 8LL), "native: sizeof(*void)");
+    
+
+    sn_assert((sizeof(void *) == 8LL), "native: sizeof(*Point)");
+    
+
+    sn_assert((sizeof(__sn__Point) == 16LL), "native: sizeof(Point)");
+    
+
+    sn_assert((sizeof(__sn__SmallStruct) == 8LL), "native: sizeof(SmallStruct)");
+    
+
+    sn_assert((sizeof(__sn__NestedStruct) == 24LL), "native: sizeof(NestedStruct)");
+    
+
+    sn_assert((sizeof(__sn__AllPrimitives) >= 56LL), "native: sizeof(AllPrimitives)");
+    
+
+    sn_assert((sizeof(__sn__EmptyStruct) == 1LL), "native: sizeof(EmptyStruct)");
+    
+
+    long long __sn__x = 42LL;
+
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 1.0, .__sn__y = 2.0 };
+
+    sn_assert((sizeof(long long) == 8LL), "native: sizeof int var");
+    
+
+    sn_assert((sizeof(__sn__Point) == 16LL), "native: sizeof Point var");
+    
+
+    long long * __sn__ptr = NULL;
+
+    sn_assert((sizeof(void *) == 8LL), "native: sizeof pointer var");
+    
+
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__arr_long = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__arr_double = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 2);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.0 });
+            sn_array_push(__al__, &(double){ 2.0 });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__arr_float = ({
+            SnArray *__al__ = sn_array_new(sizeof(float), 2);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(float){ 1.0 });
+            sn_array_push(__al__, &(float){ 2.0 });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__arr_byte = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 2);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)1 });
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)2 });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__arr_bool = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 2);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__arr_char = ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 2);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)97 });
+            sn_array_push(__al__, &(char){ (char)98 });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__arr_int32 = ({
+            SnArray *__al__ = sn_array_new(sizeof(int32_t), 2);
+    
+            sn_array_push(__al__, &(int32_t){ 1LL });
+            sn_array_push(__al__, &(int32_t){ 2LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__arr_uint = ({
+            SnArray *__al__ = sn_array_new(sizeof(uint64_t), 2);
+    
+            sn_array_push(__al__, &(uint64_t){ 1LL });
+            sn_array_push(__al__, &(uint64_t){ 2LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__arr_uint32 = ({
+            SnArray *__al__ = sn_array_new(sizeof(uint32_t), 2);
+    
+            sn_array_push(__al__, &(uint32_t){ 1LL });
+            sn_array_push(__al__, &(uint32_t){ 2LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__arr_struct = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 1);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }));
+            __al__;
+        });
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof int[]");
+    
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof long[]");
+    
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof double[]");
+    
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof float[]");
+    
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof byte[]");
+    
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof bool[]");
+    
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof char[]");
+    
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof int32[]");
+    
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof uint[]");
+    
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof uint32[]");
+    
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof Point[]");
+    
+
+    sn_assert((sn_array_length(__sn__arr) == 3LL), "native: array .length");
+    
+
+    sn_auto_arr SnArray * __sn__arr2d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        }) });
+            __al__;
+        });
+
+    sn_assert((sizeof(SnArray *) == 8LL), "native: sizeof int[][]");
+    
+
+    sn_print("test_sizeof_in_native: PASS\n");
+    
+}
+
+
+
+
+
+
+int main() {
+    sn_print("=== Comprehensive sizeof Tests ===\n\n");
+    
+    sn_assert((sizeof(long long) == 8LL), "sizeof(int)");
+    
+    sn_assert((sizeof(long long) == 8LL), "sizeof(long)");
+    
+    sn_assert((sizeof(double) == 8LL), "sizeof(double)");
+    
+    sn_assert((sizeof(float) == 4LL), "sizeof(float)");
+    
+    sn_assert((sizeof(unsigned char) == 1LL), "sizeof(byte)");
+    
+    sn_assert((sizeof(bool) == 1LL), "sizeof(bool)");
+    
+    sn_assert((sizeof(char) == 1LL), "sizeof(char)");
+    
+    sn_assert((sizeof(int32_t) == 4LL), "sizeof(int32)");
+    
+    sn_assert((sizeof(uint64_t) == 8LL), "sizeof(uint)");
+    
+    sn_assert((sizeof(uint32_t) == 4LL), "sizeof(uint32)");
+    
+    sn_print("test_primitive_types: PASS\n");
+    
+    sn_assert((sizeof(__sn__Point) == 16LL), "sizeof(Point) - arena ptr + 2 doubles");
+    
+    sn_assert((sizeof(__sn__NestedStruct) == 24LL), "sizeof(NestedStruct) - arena ptr + Point + int");
+    
+    sn_assert((sizeof(__sn__SmallStruct) == 8LL), "sizeof(SmallStruct) with padding");
+    
+    sn_assert((sizeof(__sn__AllPrimitives) >= 56LL), "sizeof(AllPrimitives) minimum size");
+    
+    sn_assert((sizeof(__sn__EmptyStruct) == 1LL), "sizeof(EmptyStruct) - arena ptr + single byte");
+    
+    sn_print("test_struct_types: PASS\n");
+    
+    long long __sn__i = 42LL;
+    long long __sn__l = 100LL;
+    double __sn__d = 3.1400000000000001;
+    float __sn__f = 2.5;
+    unsigned char __sn__b = (unsigned char)255;
+    bool __sn__bo = true;
+    char __sn__c = (char)65;
+    int32_t __sn__i32 = 100LL;
+    uint64_t __sn__u = 1000LL;
+    uint32_t __sn__u32 = 500LL;
+    sn_assert((sizeof(long long) == 8LL), "sizeof int variable");
+    
+    sn_assert((sizeof(long long) == 8LL), "sizeof long variable");
+    
+    sn_assert((sizeof(double) == 8LL), "sizeof double variable");
+    
+    sn_assert((sizeof(float) == 4LL), "sizeof float variable");
+    
+    sn_assert((sizeof(unsigned char) == 1LL), "sizeof byte variable");
+    
+    sn_assert((sizeof(bool) == 1LL), "sizeof bool variable");
+    
+    sn_assert((sizeof(char) == 1LL), "sizeof char variable");
+    
+    sn_assert((sizeof(int32_t) == 4LL), "sizeof int32 variable");
+    
+    sn_assert((sizeof(uint64_t) == 8LL), "sizeof uint variable");
+    
+    sn_assert((sizeof(uint32_t) == 4LL), "sizeof uint32 variable");
+    
+    sn_print("test_primitive_variables: PASS\n");
+    
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 1.0, .__sn__y = 2.0 };
+    __sn__SmallStruct __sn__s = (__sn__SmallStruct){ .__sn__a = 1LL, .__sn__b = 2LL, .__sn__c = true };
+    __sn__NestedStruct __sn__n = (__sn__NestedStruct){ .__sn__point = (__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }, .__sn__value = 42LL };
+    sn_assert((sizeof(__sn__Point) == 16LL), "sizeof Point variable");
+    
+    sn_assert((sizeof(__sn__SmallStruct) == 8LL), "sizeof SmallStruct variable");
+    
+    sn_assert((sizeof(__sn__NestedStruct) == 24LL), "sizeof NestedStruct variable");
+    
+    sn_print("test_struct_variables: PASS\n");
+    
+    sn_assert((sizeof(long long) == 8LL), "sizeof i without parens");
+    
+    sn_assert((sizeof(__sn__Point) == 16LL), "sizeof p without parens");
+    
+    sn_assert((sizeof(long long) == 8LL), "sizeof int without parens");
+    
+    sn_assert((sizeof(__sn__Point) == 16LL), "sizeof Point without parens");
+    
+    sn_print("test_without_parentheses: PASS\n");
+    
+    long long __sn__sum = sn_add_long(sizeof(long long), sizeof(double));
+    sn_assert((__sn__sum == 16LL), "sizeof in addition");
+    
+    long long __sn__product = sn_mul_long(sizeof(__sn__Point), 2LL);
+    sn_assert((__sn__product == 32LL), "sizeof in multiplication");
+    
+    bool __sn__cond = sn_gt_long(sizeof(long long), sizeof(unsigned char));
+    sn_assert(__sn__cond, "sizeof in comparison");
+    
+    sn_print("test_in_expressions: PASS\n");
+    
+    sn_auto_arr SnArray * __sn__arr_int = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr_byte = ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 3);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ 1LL });
+            sn_array_push(__al__, &(unsigned char){ 2LL });
+            sn_array_push(__al__, &(unsigned char){ 3LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr_point = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 1);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }));
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr_double = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 2);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.0 });
+            sn_array_push(__al__, &(double){ 2.0 });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr_float = ({
+            SnArray *__al__ = sn_array_new(sizeof(float), 3);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(float){ 1.0 });
+            sn_array_push(__al__, &(float){ 2.0 });
+            sn_array_push(__al__, &(float){ 3.0 });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr_bool = ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 3);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr_char = ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 3);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)97 });
+            sn_array_push(__al__, &(char){ (char)98 });
+            sn_array_push(__al__, &(char){ (char)99 });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr_int32 = ({
+            SnArray *__al__ = sn_array_new(sizeof(int32_t), 2);
+    
+            sn_array_push(__al__, &(int32_t){ 1LL });
+            sn_array_push(__al__, &(int32_t){ 2LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr_uint = ({
+            SnArray *__al__ = sn_array_new(sizeof(uint64_t), 2);
+    
+            sn_array_push(__al__, &(uint64_t){ 1LL });
+            sn_array_push(__al__, &(uint64_t){ 2LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr_uint32 = ({
+            SnArray *__al__ = sn_array_new(sizeof(uint32_t), 2);
+    
+            sn_array_push(__al__, &(uint32_t){ 1LL });
+            sn_array_push(__al__, &(uint32_t){ 2LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr_long = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        });
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof int[] variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sn_array_length(__sn__arr_int) == 5LL), "array .length for count");
+    
+    sn_print("test_arrays: PASS\n");
+    
+    sn_auto_arr SnArray * __sn__arr2d_int = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        }) });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr2d_byte = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 2);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)1 });
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)2 });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 1);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)3 });
+            __al__;
+        }) });
+            __al__;
+        });
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sizeof(SnArray *) == 8LL), "sizeof (pointer) variable");
+    
+    sn_assert((sn_array_length(__sn__arr2d_int) == 2LL), "2D array outer length");
+    
+    sn_assert((sn_array_length((((SnArray * *)__sn__arr2d_int->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr2d_int->len : __ai__; })])) == 2LL), "2D array inner length");
+    
+    sn_print("test_2d_arrays: PASS\n");
+    
+    __sn__test_sizeof_in_normal_function();
+    
+    test_sizeof_in_native();
+    
+    sn_print("\nAll sizeof tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,331 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: SmallStruct (as val) */
+typedef struct {
+    int32_t __sn__a;
+    unsigned char __sn__b;
+    bool __sn__c;
+} __sn__SmallStruct;
+/* Value operations */
+static inline __sn__SmallStruct __sn__SmallStruct_copy(const __sn__SmallStruct *src) {
+    __sn__SmallStruct dst;
+    dst.__sn__a = src->__sn__a;
+    dst.__sn__b = src->__sn__b;
+    dst.__sn__c = src->__sn__c;
+    return dst;
+}
+
+static inline void __sn__SmallStruct_cleanup(__sn__SmallStruct *p) {
+
+}
+
+#define sn_auto_SmallStruct __attribute__((cleanup(__sn__SmallStruct_cleanup)))
+
+static inline void __sn__SmallStruct_cleanup_elem(void *p) { __sn__SmallStruct_cleanup((__sn__SmallStruct *)p); }
+static inline void __sn__SmallStruct_copy_into(const void *src, void *dst) { *(__sn__SmallStruct *)dst = __sn__SmallStruct_copy((const __sn__SmallStruct *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SmallStruct *__sn__SmallStruct_alloc(void) {
+    return calloc(1, sizeof(__sn__SmallStruct));
+}
+
+static inline void __sn__SmallStruct_release(__sn__SmallStruct **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SmallStruct __attribute__((cleanup(__sn__SmallStruct_release)))
+
+static inline void __sn__SmallStruct_release_elem(void *p) { __sn__SmallStruct_release((__sn__SmallStruct **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SmallStruct_to_string(const __sn__SmallStruct *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SmallStruct { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__b);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__c ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: NestedStruct (as val) */
+typedef struct {
+    __sn__Point __sn__point;
+    long long __sn__value;
+} __sn__NestedStruct;
+/* Value operations */
+static inline __sn__NestedStruct __sn__NestedStruct_copy(const __sn__NestedStruct *src) {
+    __sn__NestedStruct dst;
+    dst.__sn__point = __sn__Point_copy(&src->__sn__point);
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__NestedStruct_cleanup(__sn__NestedStruct *p) {
+
+}
+
+#define sn_auto_NestedStruct __attribute__((cleanup(__sn__NestedStruct_cleanup)))
+
+static inline void __sn__NestedStruct_cleanup_elem(void *p) { __sn__NestedStruct_cleanup((__sn__NestedStruct *)p); }
+static inline void __sn__NestedStruct_copy_into(const void *src, void *dst) { *(__sn__NestedStruct *)dst = __sn__NestedStruct_copy((const __sn__NestedStruct *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__NestedStruct *__sn__NestedStruct_alloc(void) {
+    return calloc(1, sizeof(__sn__NestedStruct));
+}
+
+static inline void __sn__NestedStruct_release(__sn__NestedStruct **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_NestedStruct __attribute__((cleanup(__sn__NestedStruct_release)))
+
+static inline void __sn__NestedStruct_release_elem(void *p) { __sn__NestedStruct_release((__sn__NestedStruct **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__NestedStruct_to_string(const __sn__NestedStruct *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "NestedStruct { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "point: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__point); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: AllPrimitives (as val) */
+typedef struct {
+    long long __sn__i;
+    long long __sn__l;
+    double __sn__d;
+    float __sn__f;
+    unsigned char __sn__b;
+    bool __sn__bo;
+    char __sn__c;
+    int32_t __sn__i32;
+    uint64_t __sn__u;
+    uint32_t __sn__u32;
+} __sn__AllPrimitives;
+/* Value operations */
+static inline __sn__AllPrimitives __sn__AllPrimitives_copy(const __sn__AllPrimitives *src) {
+    __sn__AllPrimitives dst;
+    dst.__sn__i = src->__sn__i;
+    dst.__sn__l = src->__sn__l;
+    dst.__sn__d = src->__sn__d;
+    dst.__sn__f = src->__sn__f;
+    dst.__sn__b = src->__sn__b;
+    dst.__sn__bo = src->__sn__bo;
+    dst.__sn__c = src->__sn__c;
+    dst.__sn__i32 = src->__sn__i32;
+    dst.__sn__u = src->__sn__u;
+    dst.__sn__u32 = src->__sn__u32;
+    return dst;
+}
+
+static inline void __sn__AllPrimitives_cleanup(__sn__AllPrimitives *p) {
+
+}
+
+#define sn_auto_AllPrimitives __attribute__((cleanup(__sn__AllPrimitives_cleanup)))
+
+static inline void __sn__AllPrimitives_cleanup_elem(void *p) { __sn__AllPrimitives_cleanup((__sn__AllPrimitives *)p); }
+static inline void __sn__AllPrimitives_copy_into(const void *src, void *dst) { *(__sn__AllPrimitives *)dst = __sn__AllPrimitives_copy((const __sn__AllPrimitives *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__AllPrimitives *__sn__AllPrimitives_alloc(void) {
+    return calloc(1, sizeof(__sn__AllPrimitives));
+}
+
+static inline void __sn__AllPrimitives_release(__sn__AllPrimitives **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_AllPrimitives __attribute__((cleanup(__sn__AllPrimitives_release)))
+
+static inline void __sn__AllPrimitives_release_elem(void *p) { __sn__AllPrimitives_release((__sn__AllPrimitives **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__AllPrimitives_to_string(const __sn__AllPrimitives *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "AllPrimitives { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "i: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__i);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "l: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__l);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "d: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__d);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "f: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__f);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__b);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "bo: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__bo ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "'%c'", p->__sn__c);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "i32: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__i32);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "u: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__u);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "u32: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__u32);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: EmptyStruct (as val) */
+typedef struct {
+    unsigned char __sn__dummy;
+} __sn__EmptyStruct;
+/* Value operations */
+static inline __sn__EmptyStruct __sn__EmptyStruct_copy(const __sn__EmptyStruct *src) {
+    __sn__EmptyStruct dst;
+    dst.__sn__dummy = src->__sn__dummy;
+    return dst;
+}
+
+static inline void __sn__EmptyStruct_cleanup(__sn__EmptyStruct *p) {
+
+}
+
+#define sn_auto_EmptyStruct __attribute__((cleanup(__sn__EmptyStruct_cleanup)))
+
+static inline void __sn__EmptyStruct_cleanup_elem(void *p) { __sn__EmptyStruct_cleanup((__sn__EmptyStruct *)p); }
+static inline void __sn__EmptyStruct_copy_into(const void *src, void *dst) { *(__sn__EmptyStruct *)dst = __sn__EmptyStruct_copy((const __sn__EmptyStruct *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__EmptyStruct *__sn__EmptyStruct_alloc(void) {
+    return calloc(1, sizeof(__sn__EmptyStruct));
+}
+
+static inline void __sn__EmptyStruct_release(__sn__EmptyStruct **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_EmptyStruct __attribute__((cleanup(__sn__EmptyStruct_release)))
+
+static inline void __sn__EmptyStruct_release_elem(void *p) { __sn__EmptyStruct_release((__sn__EmptyStruct **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__EmptyStruct_to_string(const __sn__EmptyStruct *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "EmptyStruct { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "dummy: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__dummy);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__test_sizeof_in_normal_function();
+void test_sizeof_in_native();
+
+
+
+
+#endif
@@ -0,0 +1,104 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr1 = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__arr2 = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_extend(__al__, __sn__arr1);
+            __al__;
+        });
+    sn_print("Spread {...arr1}: ");
+    
+    { char *__ps__ = sn_array_to_string(__sn__arr2); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__arr3 = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 4);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 0LL });
+            sn_array_extend(__al__, __sn__arr1);
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        });
+    sn_print("Spread {0, ...arr1, 4, 5}: ");
+    
+    { char *__ps__ = sn_array_to_string(__sn__arr3); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        });
+    sn_auto_arr SnArray * __sn__combined = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_extend(__al__, __sn__a);
+            sn_array_extend(__al__, __sn__b);
+            __al__;
+        });
+    sn_print("Combined {...a, ...b}: ");
+    
+    { char *__ps__ = sn_array_to_string(__sn__combined); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    sn_auto_arr SnArray * __sn__withRange = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_extend(__al__, __sn__arr1);
+            { SnArray *__rng__ = sn_array_range(10LL, 13LL); sn_array_extend(__al__, __rng__); sn_array_free(__rng__); }
+            __al__;
+        });
+    sn_print("Spread with range {...arr1, 10..13}: ");
+    
+    { char *__ps__ = sn_array_to_string(__sn__withRange); printf("%s", __ps__); free(__ps__); };
+    
+    sn_print("\n");
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Original length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__arr1)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Combined length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__combined)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include "sn_types.h"
+
+char * __sn__myValue_1 = NULL;
+
+
+
+void __sn__otherValueTest() {
+
+    sn_auto_str char * __sn__myValue = strdup("other value <-");
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("otherValueTest::");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__myValue);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+}
+
+int main() {
+    __sn__myValue = strdup("This is my value");
+    __sn__myValue_1 = strdup("Testing");
+    __sn__otherValueTest();
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("main::");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__myValue);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    __sn__mutateValue();
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("main::");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__myValue);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_exit(0LL);
+    
+    free(__sn__myValue);
+    free(__sn__myValue_1);
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+char * __sn__myValue = NULL;
+
+
+
+void __sn__mutateValue() {
+
+    ({
+        char *__sn_tmp__ = strdup("mutated");
+        free(__sn__myValue);
+        __sn__myValue = __sn_tmp__;
+        __sn__myValue;
+    });
+    
+}
+
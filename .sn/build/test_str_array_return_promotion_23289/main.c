@@ -0,0 +1,83 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__getNames() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 4);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("alice") });
+            sn_array_push(__al__, &(char *){ strdup("bob") });
+            sn_array_push(__al__, &(char *){ strdup("charlie") });
+            sn_array_push(__al__, &(char *){ strdup("david") });
+            __al__;
+        });}
+
+
+char * __sn__processName(char * __sn__name) {
+
+    sn_auto_str char * __sn__result = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("processed:");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        });
+
+    sn_auto_str char * __sn__dummy1 = strdup("some temporary string");
+
+    sn_auto_str char * __sn__dummy2 = strdup("another temp string");
+
+    sn_auto_arr SnArray * __sn__dummy3 = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 5);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("a") });
+            sn_array_push(__al__, &(char *){ strdup("b") });
+            sn_array_push(__al__, &(char *){ strdup("c") });
+            sn_array_push(__al__, &(char *){ strdup("d") });
+            sn_array_push(__al__, &(char *){ strdup("e") });
+            __al__;
+        });
+
+    {
+        char * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_arr SnArray * __sn__names = __sn__getNames();
+    {
+        SnArray *__arr_0__ = __sn__names;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            char * __sn__name = ((char * *)__arr_0__->data)[__idx_0__];
+            {
+                sn_auto_str char * __sn__processed = __sn__processName(__sn__name);
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup(__sn__name);
+                        sn_auto_str char *__is_p1__ = sn_strdup(" -> ");
+                        sn_auto_str char *__is_p2__ = sn_strdup(__sn__processed);
+                        sn_auto_str char *__is_p3__ = sn_strdup("\n");
+                        sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+    if (((((strcmp((((char * *)__sn__names->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__names->len : __ai__; })]), "alice") == 0) && (strcmp((((char * *)__sn__names->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__names->len : __ai__; })]), "bob") == 0)) && (strcmp((((char * *)__sn__names->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__names->len : __ai__; })]), "charlie") == 0)) && (strcmp((((char * *)__sn__names->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__names->len : __ai__; })]), "david") == 0))) {
+        sn_print("PASS: Array strings preserved correctly\n");
+        
+    } else {
+        sn_print("FAIL: Array strings were corrupted\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
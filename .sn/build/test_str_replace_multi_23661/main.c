@@ -0,0 +1,15 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__s = strdup("aaa bbb aaa");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = __sn___replace(&__sn__s, "aaa", "x");
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
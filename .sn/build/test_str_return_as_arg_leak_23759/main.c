@@ -0,0 +1,24 @@
+#include "sn_types.h"
+__sn__Source * source_create();
+__sn__Wrapper * wrap_string(char *);
+long long process_wrapper(__sn__Wrapper *);
+
+
+
+
+
+
+int main() {
+    sn_auto_Source __sn__Source * __sn__src = source_create();
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 10LL); __sn__i++) {
+            sn_auto_str char * __sn____chain_tmp_0 = source_get_string(__sn__src, "key");
+            sn_auto_Wrapper __sn__Wrapper * __sn____chain_tmp_1 = wrap_string(__sn____chain_tmp_0);
+            __sn__Result __sn__r = (__sn__Result){ .__sn__data = process_wrapper(__sn____chain_tmp_1) };
+        }
+    }
+    sn_println("test_str_return_as_arg_leak: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
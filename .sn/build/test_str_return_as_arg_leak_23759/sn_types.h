@@ -0,0 +1,140 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Source (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn___v;
+} __sn__Source;
+
+
+static inline __sn__Source *__sn__Source__new(void) {
+    __sn__Source *p = calloc(1, sizeof(__sn__Source));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Source *__sn__Source_retain(__sn__Source *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+static inline void __sn__Source_release(__sn__Source **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Source __attribute__((cleanup(__sn__Source_release)))
+#define sn_auto_ref_Source __attribute__((cleanup(__sn__Source_release)))
+
+static inline void __sn__Source_release_elem(void *p) { __sn__Source_release((__sn__Source **)p); }
+static inline void __sn__Source_retain_into(const void *src, void *dst) { *(__sn__Source **)dst = __sn__Source_retain(*(__sn__Source *const *)src); }
+
+/* Struct: Wrapper (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__value;
+} __sn__Wrapper;
+
+
+static inline __sn__Wrapper *__sn__Wrapper__new(void) {
+    __sn__Wrapper *p = calloc(1, sizeof(__sn__Wrapper));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Wrapper *__sn__Wrapper_retain(__sn__Wrapper *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+void wrapper_dispose(__sn__Wrapper *);
+static inline void __sn__Wrapper_release(__sn__Wrapper **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        wrapper_dispose(*p);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Wrapper __attribute__((cleanup(__sn__Wrapper_release)))
+#define sn_auto_ref_Wrapper __attribute__((cleanup(__sn__Wrapper_release)))
+
+static inline void __sn__Wrapper_release_elem(void *p) { __sn__Wrapper_release((__sn__Wrapper **)p); }
+static inline void __sn__Wrapper_retain_into(const void *src, void *dst) { *(__sn__Wrapper **)dst = __sn__Wrapper_retain(*(__sn__Wrapper *const *)src); }
+
+/* Struct: Result (as val) */
+typedef struct {
+    long long __sn__data;
+} __sn__Result;
+/* Value operations */
+static inline __sn__Result __sn__Result_copy(const __sn__Result *src) {
+    __sn__Result dst;
+    dst.__sn__data = src->__sn__data;
+    return dst;
+}
+
+static inline void __sn__Result_cleanup(__sn__Result *p) {
+
+}
+
+#define sn_auto_Result __attribute__((cleanup(__sn__Result_cleanup)))
+
+static inline void __sn__Result_cleanup_elem(void *p) { __sn__Result_cleanup((__sn__Result *)p); }
+static inline void __sn__Result_copy_into(const void *src, void *dst) { *(__sn__Result *)dst = __sn__Result_copy((const __sn__Result *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Result *__sn__Result_alloc(void) {
+    return calloc(1, sizeof(__sn__Result));
+}
+
+static inline void __sn__Result_release(__sn__Result **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Result __attribute__((cleanup(__sn__Result_release)))
+
+static inline void __sn__Result_release_elem(void *p) { __sn__Result_release((__sn__Result **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Result_to_string(const __sn__Result *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Result { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "data: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__data);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+char * source_get_string(__sn__Source *, char *);
+void wrapper_dispose(__sn__Wrapper *);
+
+
+
+#endif
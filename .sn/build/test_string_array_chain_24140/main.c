@@ -0,0 +1,94 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__multiline = strdup("  hello  \n  world  \n  test  ");
+    sn_auto_arr SnArray * __sn____chain_tmp_0 = __sn___splitLines(&__sn__multiline);
+    sn_auto_str char * __sn__line1 = __sn___trim(&(((char * *)__sn____chain_tmp_0->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn____chain_tmp_0->len : __ai__; })]));
+    sn_auto_arr SnArray * __sn____chain_tmp_1 = __sn___splitLines(&__sn__multiline);
+    sn_auto_str char * __sn__line2 = __sn___trim(&(((char * *)__sn____chain_tmp_1->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn____chain_tmp_1->len : __ai__; })]));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__line1);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__line2);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__csv = strdup("  apple  ,  banana  ,  cherry  ");
+    sn_auto_arr SnArray * __sn____chain_tmp_2 = __sn___split(&__sn__csv, ",");
+    sn_auto_str char * __sn__first = __sn___trim(&(((char * *)__sn____chain_tmp_2->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn____chain_tmp_2->len : __ai__; })]));
+    sn_auto_arr SnArray * __sn____chain_tmp_3 = __sn___split(&__sn__csv, ",");
+    sn_auto_str char * __sn____chain_tmp_4 = __sn___trim(&(((char * *)__sn____chain_tmp_3->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn____chain_tmp_3->len : __ai__; })]));
+    sn_auto_str char * __sn__second = __sn___toUpper(&__sn____chain_tmp_4);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__first);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__second);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__words = strdup("HELLO world TEST");
+    sn_auto_arr SnArray * __sn____chain_tmp_5 = __sn___splitWhitespace(&__sn__words);
+    sn_auto_str char * __sn__w1 = __sn___toLower(&(((char * *)__sn____chain_tmp_5->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn____chain_tmp_5->len : __ai__; })]));
+    sn_auto_arr SnArray * __sn____chain_tmp_6 = __sn___splitWhitespace(&__sn__words);
+    sn_auto_str char * __sn__w2 = __sn___toUpper(&(((char * *)__sn____chain_tmp_6->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn____chain_tmp_6->len : __ai__; })]));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__w1);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__w2);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__lengths = strdup("short,medium,longerword");
+    sn_auto_arr SnArray * __sn____chain_tmp_7 = __sn___split(&__sn__lengths, ",");
+    long long __sn__len1 = sn_str_length((((char * *)__sn____chain_tmp_7->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn____chain_tmp_7->len : __ai__; })]));
+    sn_auto_arr SnArray * __sn____chain_tmp_8 = __sn___split(&__sn__lengths, ",");
+    long long __sn__len2 = sn_str_length((((char * *)__sn____chain_tmp_8->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn____chain_tmp_8->len : __ai__; })]));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__len1));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__len2));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__items = strdup("a,b,c,d,e");
+    sn_auto_arr SnArray * __sn____chain_tmp_9 = __sn___split(&__sn__items, ",");
+    sn_auto_str char * __sn__last = __sn___toUpper(&(((char * *)__sn____chain_tmp_9->data)[({ long long __ai__ = (-1LL); __ai__ < 0 ? __ai__ + __sn____chain_tmp_9->len : __ai__; })]));
+    sn_auto_arr SnArray * __sn____chain_tmp_10 = __sn___split(&__sn__items, ",");
+    sn_auto_str char * __sn__secondLast = __sn___toUpper(&(((char * *)__sn____chain_tmp_10->data)[({ long long __ai__ = (-2LL); __ai__ < 0 ? __ai__ + __sn____chain_tmp_10->len : __ai__; })]));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__last);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__secondLast);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
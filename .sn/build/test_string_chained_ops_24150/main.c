@@ -0,0 +1,17 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__s = strdup("  Hello World  ");
+    sn_auto_str char * __sn____chain_tmp_0 = __sn___trim(&__sn__s);
+    sn_auto_str char * __sn__r = __sn___toLower(&__sn____chain_tmp_0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__r);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
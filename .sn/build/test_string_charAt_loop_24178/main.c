@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__s = strdup("hello");
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_str_length(__sn__s)); __sn__i++) {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_str_fmt("%c", (char)(__sn___charAt(&__sn__s, __sn__i)));
+                    sn_str_concat_multi(1, __is_p0__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,20 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__a = strdup("a");
+    sn_auto_str char * __sn__b = strdup("b");
+    sn_auto_str char * __sn__c = strdup("c");
+    sn_auto_str char * __sn__result = ({
+        sn_str_concat_multi(3, __sn__a, __sn__b, __sn__c);
+    });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__result);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,10 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_print("line1\nline2\nline3\n");
+    
+    fflush(stdout);
+    return 0;
+}
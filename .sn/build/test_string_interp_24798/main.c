@@ -0,0 +1,56 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__name = strdup("World");
+    long long __sn__count = 42LL;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hello!\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hello ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("!\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hello ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup(", count is ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__count));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+        sn_auto_str char *__sct_0__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Part1");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+        sn_str_concat_multi(3, __sct_0__, "Part2", "\n");
+    }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Result: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_mul_long(__sn__count, 2LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" doubled\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__empty = ({
+            sn_str_concat_multi(0);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Empty is: '");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__empty);
+            sn_auto_str char *__is_p2__ = sn_strdup("'\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
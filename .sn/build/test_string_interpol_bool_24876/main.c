@@ -0,0 +1,19 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    bool __sn__flag = true;
+    long long __sn__x = 42LL;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("flag=");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__flag) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup(" x=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,16 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    char __sn__c = (char)65;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("char: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%c", (char)(__sn__c));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,304 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    double __sn__pi = 3.14159265358979;
+    double __sn__e = 2.7182818284590402;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pi .1f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.1f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("E .1f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.1f", (double)(__sn__e));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pi .2f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.2f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("E .2f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.2f", (double)(__sn__e));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pi .5f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("E .5f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__e));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pi .0f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.0f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pi .3f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.3f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pi .4f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.4f", (double)(__sn__pi));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__num = 255LL;
+    long long __sn__small = 42LL;
+    long long __sn__zero = 0LL;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hex x: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llx", (long long)(__sn__num));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Small hex: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llx", (long long)(__sn__small));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Zero hex: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llx", (long long)(__sn__zero));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Hex X: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llX", (long long)(__sn__num));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Small HEX: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llX", (long long)(__sn__small));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Octal: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llo", (long long)(__sn__num));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Small octal: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llo", (long long)(__sn__small));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Zero octal: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llo", (long long)(__sn__zero));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pad 3: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%03lld", (long long)(__sn__small));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pad 5: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%05lld", (long long)(__sn__small));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Pad 8: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%08lld", (long long)(__sn__small));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Zero pad: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%05lld", (long long)(__sn__zero));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__large = 999999999LL;
+    double __sn__large_d = 123456789.123456;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Large int: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__large));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Large padded: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%015lld", (long long)(__sn__large));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Large hex: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llx", (long long)(__sn__large));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Large double .2f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.2f", (double)(__sn__large_d));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Large double .6f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.6f", (double)(__sn__large_d));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    double __sn__tiny = 0.00012345600000000001;
+    long long __sn__small_neg = (-42LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Tiny .2f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.2f", (double)(__sn__tiny));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Tiny .6f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.6f", (double)(__sn__tiny));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Neg padded: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%05lld", (long long)(__sn__small_neg));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    double __sn__value = 42.5;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Width 10 .2f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%10.2f", (double)(__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Width 8 .1f: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%8.1f", (double)(__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Multi: hex=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llx", (long long)(__sn__num));
+            sn_auto_str char *__is_p2__ = sn_strdup(" oct=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%llo", (long long)(__sn__num));
+            sn_auto_str char *__is_p4__ = sn_strdup(" dec=");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__num));
+            sn_auto_str char *__is_p6__ = sn_strdup("\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Mixed types: int=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%05lld", (long long)(__sn__small));
+            sn_auto_str char *__is_p2__ = sn_strdup(" float=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.3f", (double)(__sn__pi));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Expr hex: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%llx", (long long)(sn_mul_long(__sn__num, 2LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Expr pad: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%04lld", (long long)(sn_add_long(__sn__small, 8LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Expr float: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.2f", (double)(sn_mul_double(__sn__pi, 2.0)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sci e: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%e", (double)(__sn__large_d));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sci E: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%E", (double)(__sn__large_d));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Tiny sci: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%e", (double)(__sn__tiny));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    double __sn__ratio = 0.75;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Percent: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.2f", (double)(__sn__ratio));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,176 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__basic = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("First line\nSecond line\nThird line");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 1 - Basic multi-line:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    sn_print(__sn__basic);
+    
+    sn_print("\n\n");
+    
+    long long __sn__a = 10LL;
+    long long __sn__b = 20LL;
+    long long __sn__c = 30LL;
+    sn_auto_str char * __sn__multi_expr = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Line with a: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__a));
+            sn_auto_str char *__is_p2__ = sn_strdup("\nLine with b: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__b));
+            sn_auto_str char *__is_p4__ = sn_strdup("\nLine with c: ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__c));
+            sn_auto_str char *__is_p6__ = sn_strdup("\nSum on this line: ");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(sn_add_long(sn_add_long(__sn__a, __sn__b), __sn__c)));
+            sn_str_concat_multi(8, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 2 - Expressions on different lines:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    sn_print(__sn__multi_expr);
+    
+    sn_print("\n\n");
+    
+    sn_auto_str char * __sn__indented = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("No indent\n  Two spaces\n    Four spaces\n      Six spaces\n        Eight spaces");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 3 - Indentation preservation:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    sn_print(__sn__indented);
+    
+    sn_print("\n\n");
+    
+    sn_auto_str char * __sn__tabbed = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Start\n\tOne tab\n\t\tTwo tabs\n \tSpace then tab");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 4 - Tab preservation:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    sn_print(__sn__tabbed);
+    
+    sn_print("\n\n");
+    
+    sn_auto_str char * __sn__with_empty = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Before empty\n\nAfter empty\n\nAnother gap\n\nEnd");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 5 - Empty lines:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    sn_print(__sn__with_empty);
+    
+    sn_print("\n\n");
+    
+    sn_auto_str char * __sn__start_val = strdup("START");
+    sn_auto_str char * __sn__end_val = strdup("END");
+    sn_auto_str char * __sn__boundary = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__start_val);
+            sn_auto_str char *__is_p1__ = sn_strdup("\nmiddle content\n");
+            sn_auto_str char *__is_p2__ = sn_strdup(__sn__end_val);
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 6 - Interpolation at boundaries:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    sn_print(__sn__boundary);
+    
+    sn_print("\n\n");
+    
+    long long __sn__x = 1LL;
+    long long __sn__y = 2LL;
+    long long __sn__z = 3LL;
+    sn_auto_str char * __sn__multi_per_line = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("First: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(" and ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup("\nSecond: ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__y));
+            sn_auto_str char *__is_p6__ = sn_strdup(" and ");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__z));
+            sn_auto_str char *__is_p8__ = sn_strdup("\nThird: ");
+            sn_auto_str char *__is_p9__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_auto_str char *__is_p10__ = sn_strdup(" and ");
+            sn_auto_str char *__is_p11__ = sn_str_fmt("%lld", (long long)(__sn__z));
+            sn_str_concat_multi(12, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__, __is_p9__, __is_p10__, __is_p11__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 7 - Multiple interpolations per line:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    sn_print(__sn__multi_per_line);
+    
+    sn_print("\n\n");
+    
+    sn_auto_str char * __sn__name = strdup("Alice");
+    long long __sn__age = 25LL;
+    double __sn__score = 95.5;
+    sn_auto_str char * __sn__status = strdup("Adult");
+    sn_auto_str char * __sn__complex = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("User Profile:\nName: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\nAge: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__age));
+            sn_auto_str char *__is_p4__ = sn_strdup(" years old\nScore: ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%.1f", (double)(__sn__score));
+            sn_auto_str char *__is_p6__ = sn_strdup(" points\nStatus: ");
+            sn_auto_str char *__is_p7__ = sn_strdup(__sn__status);
+            sn_str_concat_multi(8, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 8 - Complex expressions:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    sn_print(__sn__complex);
+    
+    sn_print("\n\n");
+    
+    sn_auto_str char * __sn__ws_lines = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Content\n\nMore content");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 9 - Whitespace-only lines:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    sn_print(__sn__ws_lines);
+    
+    sn_print("\n\n");
+    
+    sn_auto_str char * __sn__trailing = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Line with trailing spaces\nNext line");
+            sn_str_concat_multi(1, __is_p0__);
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 10 - Trailing whitespace:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    sn_print(__sn__trailing);
+    
+    sn_print("\n");
+    
+    return 0LL;    fflush(stdout);
+}
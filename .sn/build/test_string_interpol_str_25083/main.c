@@ -0,0 +1,18 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__first = strdup("John");
+    sn_auto_str char * __sn__last = strdup("Doe");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__first);
+            sn_auto_str char *__is_p1__ = sn_strdup(" ");
+            sn_auto_str char *__is_p2__ = sn_strdup(__sn__last);
+            sn_auto_str char *__is_p3__ = sn_strdup("\n");
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include "sn_types.h"
+
+
+
+
+
+int main() {
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 10LL, .__sn__y = 20LL };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Point: ");
+            sn_auto_str char *__is_p1__ = __sn__Point_to_string(&(__sn__p));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Person __sn__Person __sn__person = (__sn__Person){ .__sn__name = strdup("Alice"), .__sn__age = 30LL, .__sn__active = true };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Person: ");
+            sn_auto_str char *__is_p1__ = __sn__Person_to_string(&(__sn__person));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Inline: ");
+            sn_auto_str char *__is_p1__ = __sn__Point_to_string(&((__sn__Point){ .__sn__x = 5LL, .__sn__y = 15LL }));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
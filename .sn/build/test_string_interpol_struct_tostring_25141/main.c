@@ -0,0 +1,58 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__Vector_toString(__sn__Vector *__sn__self) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("<");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__self->__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__self->__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%.5f", (double)(__sn__self->__sn__z));
+            sn_auto_str char *__is_p6__ = sn_strdup(">");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        });}
+
+
+char * __sn__Color_toString(__sn__Color *__sn__self) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("rgb(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__r));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__g));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__b));
+            sn_auto_str char *__is_p6__ = sn_strdup(")");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        });}
+
+int main() {
+    __sn__Vector __sn__v = (__sn__Vector){ .__sn__x = 1.5, .__sn__y = 2.5, .__sn__z = 3.5 };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Vector: ");
+            sn_auto_str char *__is_p1__ = __sn__Vector_toString(&(__sn__v));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__Color __sn__c = (__sn__Color){ .__sn__r = 255LL, .__sn__g = 128LL, .__sn__b = 64LL };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Color: ");
+            sn_auto_str char *__is_p1__ = __sn__Color_toString(&(__sn__c));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Inline: ");
+            sn_auto_str char *__is_p1__ = __sn__Color_toString(&((__sn__Color){ .__sn__r = 0LL, .__sn__g = 0LL, .__sn__b = 0LL }));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
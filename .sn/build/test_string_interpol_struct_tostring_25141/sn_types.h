@@ -0,0 +1,142 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Vector (as val) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+    double __sn__z;
+} __sn__Vector;
+/* Value operations */
+static inline __sn__Vector __sn__Vector_copy(const __sn__Vector *src) {
+    __sn__Vector dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    dst.__sn__z = src->__sn__z;
+    return dst;
+}
+
+static inline void __sn__Vector_cleanup(__sn__Vector *p) {
+
+}
+
+#define sn_auto_Vector __attribute__((cleanup(__sn__Vector_cleanup)))
+
+static inline void __sn__Vector_cleanup_elem(void *p) { __sn__Vector_cleanup((__sn__Vector *)p); }
+static inline void __sn__Vector_copy_into(const void *src, void *dst) { *(__sn__Vector *)dst = __sn__Vector_copy((const __sn__Vector *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Vector *__sn__Vector_alloc(void) {
+    return calloc(1, sizeof(__sn__Vector));
+}
+
+static inline void __sn__Vector_release(__sn__Vector **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Vector __attribute__((cleanup(__sn__Vector_release)))
+
+static inline void __sn__Vector_release_elem(void *p) { __sn__Vector_release((__sn__Vector **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Vector_to_string(const __sn__Vector *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Vector { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "z: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__z);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Color (as val) */
+typedef struct {
+    long long __sn__r;
+    long long __sn__g;
+    long long __sn__b;
+} __sn__Color;
+/* Value operations */
+static inline __sn__Color __sn__Color_copy(const __sn__Color *src) {
+    __sn__Color dst;
+    dst.__sn__r = src->__sn__r;
+    dst.__sn__g = src->__sn__g;
+    dst.__sn__b = src->__sn__b;
+    return dst;
+}
+
+static inline void __sn__Color_cleanup(__sn__Color *p) {
+
+}
+
+#define sn_auto_Color __attribute__((cleanup(__sn__Color_cleanup)))
+
+static inline void __sn__Color_cleanup_elem(void *p) { __sn__Color_cleanup((__sn__Color *)p); }
+static inline void __sn__Color_copy_into(const void *src, void *dst) { *(__sn__Color *)dst = __sn__Color_copy((const __sn__Color *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Color *__sn__Color_alloc(void) {
+    return calloc(1, sizeof(__sn__Color));
+}
+
+static inline void __sn__Color_release(__sn__Color **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Color __attribute__((cleanup(__sn__Color_release)))
+
+static inline void __sn__Color_release_elem(void *p) { __sn__Color_release((__sn__Color **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Color_to_string(const __sn__Color *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Color { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "r: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__r);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__g);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__b);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+char * __sn__Vector_toString(__sn__Vector *);
+char * __sn__Color_toString(__sn__Color *);
+
+
+
+#endif
@@ -0,0 +1,101 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__s = strdup("Hello, World!");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_str_length(__sn__s)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("substring: ");
+            sn_auto_str char *__is_p1__ = __sn___substring(&__sn__s, 0LL, 5LL);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("indexOf: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn___indexOf(&__sn__s, "World")));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("toUpper: ");
+            sn_auto_str char *__is_p1__ = __sn___toUpper(&__sn__s);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("toLower: ");
+            sn_auto_str char *__is_p1__ = __sn___toLower(&__sn__s);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__padded = strdup("  hello  ");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("trim: '");
+            sn_auto_str char *__is_p1__ = __sn___trim(&__sn__padded);
+            sn_auto_str char *__is_p2__ = sn_strdup("'\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("startsWith: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn___startsWith(&__sn__s, "Hello")) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("endsWith: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn___endsWith(&__sn__s, "!")) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("contains: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn___contains(&__sn__s, "World")) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("replace: ");
+            sn_auto_str char *__is_p1__ = __sn___replace(&__sn__s, "World", "Sindarin");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__csv = strdup("a,b,c");
+    sn_auto_arr SnArray * __sn__parts = __sn___split(&__sn__csv, ",");
+    sn_print("split:");
+    
+    {
+        SnArray *__arr_0__ = __sn__parts;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            char * __sn__p = ((char * *)__arr_0__->data)[__idx_0__];
+            {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup(" [");
+                        sn_auto_str char *__is_p1__ = sn_strdup(__sn__p);
+                        sn_auto_str char *__is_p2__ = sn_strdup("]");
+                        sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+    sn_print("\n");
+    
+    return 0LL;    fflush(stdout);
+}
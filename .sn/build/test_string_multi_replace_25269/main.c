@@ -0,0 +1,30 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__s = strdup("one two three");
+    sn_auto_str char * __sn__r = __sn___replace(&__sn__s, "one", "1");
+    ({
+        char *__sn_tmp__ = __sn___replace(&__sn__r, "two", "2");
+        free(__sn__r);
+        __sn__r = __sn_tmp__;
+        __sn__r;
+    });
+    
+    ({
+        char *__sn_tmp__ = __sn___replace(&__sn__r, "three", "3");
+        free(__sn__r);
+        __sn__r = __sn_tmp__;
+        __sn__r;
+    });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__r);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
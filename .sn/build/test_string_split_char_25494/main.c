@@ -0,0 +1,26 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__s = strdup("a-b-c-d-e");
+    sn_auto_arr SnArray * __sn__parts = __sn___split(&__sn__s, "-");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__parts)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup((((char * *)__sn__parts->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__parts->len : __ai__; })]));
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__parts->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__parts->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup((((char * *)__sn__parts->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__parts->len : __ai__; })]));
+            sn_auto_str char *__is_p3__ = sn_strdup((((char * *)__sn__parts->data)[({ long long __ai__ = 3LL; __ai__ < 0 ? __ai__ + __sn__parts->len : __ai__; })]));
+            sn_auto_str char *__is_p4__ = sn_strdup((((char * *)__sn__parts->data)[({ long long __ai__ = 4LL; __ai__ < 0 ? __ai__ + __sn__parts->len : __ai__; })]));
+            sn_auto_str char *__is_p5__ = sn_strdup("\n");
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
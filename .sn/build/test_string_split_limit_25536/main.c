@@ -0,0 +1,90 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_str char * __sn__s = strdup("a:b:c:d:e");
+    sn_auto_arr SnArray * __sn__all = __sn___split(&__sn__s, ":");
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("no limit: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__all)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" parts\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__two = __sn___split(&__sn__s, ":", 2LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("limit 2: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__two)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" parts\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  [0]: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__two->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__two->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  [1]: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__two->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__two->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__three = __sn___split(&__sn__s, ":", 3LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("limit 3: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__three)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" parts\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  [0]: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__three->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__three->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  [1]: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__three->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__three->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  [2]: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__three->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__three->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__one = __sn___split(&__sn__s, ":", 1LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("limit 1: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__one)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" parts\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  [0]: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((((char * *)__sn__one->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__one->len : __ai__; })]));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__large = __sn___split(&__sn__s, ":", 100LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("limit 100: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__large)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" parts\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
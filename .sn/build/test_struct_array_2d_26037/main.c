@@ -0,0 +1,78 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__buildGrid() {
+
+    sn_auto_arr SnArray * __sn__row1 = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_cleanup_elem;
+            __al__->elem_copy = __sn__Item_copy_into;
+            sn_array_push(__al__, &((__sn__Item){ .__sn__name = strdup("a1"), .__sn__value = strdup("v1") }));
+            sn_array_push(__al__, &((__sn__Item){ .__sn__name = strdup("a2"), .__sn__value = strdup("v2") }));
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__row2 = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_cleanup_elem;
+            __al__->elem_copy = __sn__Item_copy_into;
+            sn_array_push(__al__, &((__sn__Item){ .__sn__name = strdup("b1"), .__sn__value = strdup("v3") }));
+            sn_array_push(__al__, &((__sn__Item){ .__sn__name = strdup("b2"), .__sn__value = strdup("v4") }));
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__grid = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ sn_array_copy(__sn__row1) });
+            sn_array_push(__al__, &(SnArray *){ sn_array_copy(__sn__row2) });
+            __al__;
+        });
+
+    {
+        SnArray * __ret__ = __sn__grid;
+        __sn__grid = NULL;
+        return __ret__;
+    }}
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__grid = __sn__buildGrid();
+    if ((sn_array_length(__sn__grid) != 2LL)) {
+        sn_print("FAIL: outer length\n");
+        
+        return 0;}
+    if (((sn_array_length((((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])) != 2LL) || (sn_array_length((((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])) != 2LL))) {
+        sn_print("FAIL: inner length\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Item *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })]).__sn__name, "a1") != 0) || (strcmp((((__sn__Item *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })]).__sn__value, "v1") != 0))) {
+        sn_print("FAIL: [0][0]\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Item *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })]).__sn__name, "a2") != 0) || (strcmp((((__sn__Item *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })]).__sn__value, "v2") != 0))) {
+        sn_print("FAIL: [0][1]\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Item *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })]).__sn__name, "b1") != 0) || (strcmp((((__sn__Item *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })]).__sn__value, "v3") != 0))) {
+        sn_print("FAIL: [1][0]\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Item *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })]).__sn__name, "b2") != 0) || (strcmp((((__sn__Item *)(((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__grid->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__grid->len : __ai__; })])->len : __ai__; })]).__sn__value, "v4") != 0))) {
+        sn_print("FAIL: [1][1]\n");
+        
+        return 0;}
+    sn_print("PASS\n");
+    
+    fflush(stdout);
+    return 0;
+}
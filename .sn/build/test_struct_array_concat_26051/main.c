@@ -0,0 +1,65 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__buildConcat() {
+
+    sn_auto_arr SnArray * __sn__a = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Entry), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Entry_cleanup_elem;
+            __al__->elem_copy = __sn__Entry_copy_into;
+            sn_array_push(__al__, &((__sn__Entry){ .__sn__key = strdup("a"), .__sn__value = strdup("1") }));
+            sn_array_push(__al__, &((__sn__Entry){ .__sn__key = strdup("b"), .__sn__value = strdup("2") }));
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__b = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Entry), 1);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Entry_cleanup_elem;
+            __al__->elem_copy = __sn__Entry_copy_into;
+            sn_array_push(__al__, &((__sn__Entry){ .__sn__key = strdup("c"), .__sn__value = strdup("3") }));
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__combined = __sn__arr_concat(&__sn__a, __sn__b);
+
+    {
+        SnArray * __ret__ = __sn__combined;
+        __sn__combined = NULL;
+        return __ret__;
+    }}
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__items = __sn__buildConcat();
+    if ((sn_array_length(__sn__items) != 3LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: length ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__items)));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if (((strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__key, "a") != 0) || (strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__value, "1") != 0))) {
+        sn_print("FAIL: item 0\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__key, "b") != 0) || (strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__value, "2") != 0))) {
+        sn_print("FAIL: item 1\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__key, "c") != 0) || (strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__value, "3") != 0))) {
+        sn_print("FAIL: item 2\n");
+        
+        return 0;}
+    sn_print("PASS\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Item __sn__buildItem() {
+
+    sn_auto_Item __sn__Item __sn__item = (__sn__Item){ .__sn__name = strdup("widget"), .__sn__tags = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Tag), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Tag_cleanup_elem;
+            __al__->elem_copy = __sn__Tag_copy_into;
+            __al__;
+        }) };
+
+    __sn__arr_push(&__sn__item.__sn__tags, (__sn__Tag){ .__sn__key = strdup("color"), .__sn__value = strdup("red") });
+    
+
+    __sn__arr_push(&__sn__item.__sn__tags, (__sn__Tag){ .__sn__key = strdup("size"), .__sn__value = strdup("large") });
+    
+
+    __sn__arr_push(&__sn__item.__sn__tags, (__sn__Tag){ .__sn__key = strdup("material"), .__sn__value = strdup("steel") });
+    
+
+    {
+        __sn__Item __ret__ = __sn__item;
+        memset(&__sn__item, 0, sizeof(__sn__item));
+        return __ret__;
+    }}
+
+
+
+int main() {
+    sn_auto_Item __sn__Item __sn__item = __sn__buildItem();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Item: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__item.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Tags: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__item.__sn__tags)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__item.__sn__tags)); __sn__i++) {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("  ");
+                    sn_auto_str char *__is_p1__ = sn_strdup((((__sn__Tag *)__sn__item.__sn__tags->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__item.__sn__tags->len : __ai__; })]).__sn__key);
+                    sn_auto_str char *__is_p2__ = sn_strdup("=");
+                    sn_auto_str char *__is_p3__ = sn_strdup((((__sn__Tag *)__sn__item.__sn__tags->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__item.__sn__tags->len : __ai__; })]).__sn__value);
+                    sn_auto_str char *__is_p4__ = sn_strdup("\n");
+                    sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+    if ((sn_array_length(__sn__item.__sn__tags) == 3LL)) {
+        if (((strcmp((((__sn__Tag *)__sn__item.__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__item.__sn__tags->len : __ai__; })]).__sn__key, "color") == 0) && (strcmp((((__sn__Tag *)__sn__item.__sn__tags->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__item.__sn__tags->len : __ai__; })]).__sn__value, "red") == 0))) {
+            if (((strcmp((((__sn__Tag *)__sn__item.__sn__tags->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__item.__sn__tags->len : __ai__; })]).__sn__key, "size") == 0) && (strcmp((((__sn__Tag *)__sn__item.__sn__tags->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__item.__sn__tags->len : __ai__; })]).__sn__value, "large") == 0))) {
+                if (((strcmp((((__sn__Tag *)__sn__item.__sn__tags->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__item.__sn__tags->len : __ai__; })]).__sn__key, "material") == 0) && (strcmp((((__sn__Tag *)__sn__item.__sn__tags->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__item.__sn__tags->len : __ai__; })]).__sn__value, "steel") == 0))) {
+                    sn_print("PASS\n");
+                    
+                    return 0;}
+            }
+        }
+    }
+    sn_print("FAIL\n");
+    
+    fflush(stdout);
+    return 0;
+}
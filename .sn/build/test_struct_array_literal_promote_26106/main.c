@@ -0,0 +1,54 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__makePairs() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Pair), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Pair_cleanup_elem;
+            __al__->elem_copy = __sn__Pair_copy_into;
+            sn_array_push(__al__, &((__sn__Pair){ .__sn__left = strdup("a"), .__sn__right = strdup("b") }));
+            sn_array_push(__al__, &((__sn__Pair){ .__sn__left = strdup("c"), .__sn__right = strdup("d") }));
+            __al__;
+        });}
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__pairs = __sn__makePairs();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Count: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__pairs)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__pairs)); __sn__i++) {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("  ");
+                    sn_auto_str char *__is_p1__ = sn_strdup((((__sn__Pair *)__sn__pairs->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__pairs->len : __ai__; })]).__sn__left);
+                    sn_auto_str char *__is_p2__ = sn_strdup(",");
+                    sn_auto_str char *__is_p3__ = sn_strdup((((__sn__Pair *)__sn__pairs->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__pairs->len : __ai__; })]).__sn__right);
+                    sn_auto_str char *__is_p4__ = sn_strdup("\n");
+                    sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+    if ((sn_array_length(__sn__pairs) == 2LL)) {
+        if (((strcmp((((__sn__Pair *)__sn__pairs->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__pairs->len : __ai__; })]).__sn__left, "a") == 0) && (strcmp((((__sn__Pair *)__sn__pairs->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__pairs->len : __ai__; })]).__sn__right, "b") == 0))) {
+            if (((strcmp((((__sn__Pair *)__sn__pairs->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__pairs->len : __ai__; })]).__sn__left, "c") == 0) && (strcmp((((__sn__Pair *)__sn__pairs->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__pairs->len : __ai__; })]).__sn__right, "d") == 0))) {
+                sn_print("PASS\n");
+                
+                return 0;}
+        }
+    }
+    sn_print("FAIL\n");
+    
+    fflush(stdout);
+    return 0;
+}
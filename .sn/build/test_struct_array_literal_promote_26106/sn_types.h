@@ -0,0 +1,82 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Pair (as val) */
+typedef struct {
+    char * __sn__left;
+    char * __sn__right;
+} __sn__Pair;
+/* Value operations */
+static inline __sn__Pair __sn__Pair_copy(const __sn__Pair *src) {
+    __sn__Pair dst;
+    dst.__sn__left = src->__sn__left ? strdup(src->__sn__left) : NULL;
+    dst.__sn__right = src->__sn__right ? strdup(src->__sn__right) : NULL;
+    return dst;
+}
+
+static inline void __sn__Pair_cleanup(__sn__Pair *p) {
+    free(p->__sn__left);
+    free(p->__sn__right);
+
+}
+
+#define sn_auto_Pair __attribute__((cleanup(__sn__Pair_cleanup)))
+
+static inline void __sn__Pair_cleanup_elem(void *p) { __sn__Pair_cleanup((__sn__Pair *)p); }
+static inline void __sn__Pair_copy_into(const void *src, void *dst) { *(__sn__Pair *)dst = __sn__Pair_copy((const __sn__Pair *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Pair *__sn__Pair_alloc(void) {
+    return calloc(1, sizeof(__sn__Pair));
+}
+
+static inline void __sn__Pair_release(__sn__Pair **p) {
+    if (*p) {
+        free((*p)->__sn__left);
+        free((*p)->__sn__right);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Pair __attribute__((cleanup(__sn__Pair_release)))
+
+static inline void __sn__Pair_release_elem(void *p) { __sn__Pair_release((__sn__Pair **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Pair_to_string(const __sn__Pair *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Pair { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "left: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__left ? p->__sn__left : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "right: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__right ? p->__sn__right : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+SnArray * __sn__makePairs();
+
+
+
+
+#endif
@@ -0,0 +1,72 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Response __sn__createResponse() {
+
+    sn_auto_Response __sn__Response __sn__res = (__sn__Response){ .__sn__code = 200LL, .__sn__headers = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Header), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Header_cleanup_elem;
+            __al__->elem_copy = __sn__Header_copy_into;
+            __al__;
+        }) };
+
+    __sn__arr_push(&__sn__res.__sn__headers, (__sn__Header){ .__sn__name = strdup("Content-Type"), .__sn__value = strdup("text/plain") });
+    
+
+    __sn__arr_push(&__sn__res.__sn__headers, (__sn__Header){ .__sn__name = strdup("X-Custom"), .__sn__value = strdup("test-value") });
+    
+
+    {
+        __sn__Response __ret__ = __sn__res;
+        memset(&__sn__res, 0, sizeof(__sn__res));
+        return __ret__;
+    }}
+
+
+
+int main() {
+    sn_auto_Response __sn__Response __sn__res = __sn__createResponse();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Code: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__res.__sn__code));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Headers: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__res.__sn__headers)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__res.__sn__headers)); __sn__i++) {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("  ");
+                    sn_auto_str char *__is_p1__ = sn_strdup((((__sn__Header *)__sn__res.__sn__headers->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__res.__sn__headers->len : __ai__; })]).__sn__name);
+                    sn_auto_str char *__is_p2__ = sn_strdup(": ");
+                    sn_auto_str char *__is_p3__ = sn_strdup((((__sn__Header *)__sn__res.__sn__headers->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__res.__sn__headers->len : __ai__; })]).__sn__value);
+                    sn_auto_str char *__is_p4__ = sn_strdup("\n");
+                    sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+    if ((sn_array_length(__sn__res.__sn__headers) == 2LL)) {
+        if (((strcmp((((__sn__Header *)__sn__res.__sn__headers->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__res.__sn__headers->len : __ai__; })]).__sn__name, "Content-Type") == 0) && (strcmp((((__sn__Header *)__sn__res.__sn__headers->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__res.__sn__headers->len : __ai__; })]).__sn__value, "text/plain") == 0))) {
+            if (((strcmp((((__sn__Header *)__sn__res.__sn__headers->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__res.__sn__headers->len : __ai__; })]).__sn__name, "X-Custom") == 0) && (strcmp((((__sn__Header *)__sn__res.__sn__headers->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__res.__sn__headers->len : __ai__; })]).__sn__value, "test-value") == 0))) {
+                sn_print("PASS\n");
+                
+                return 0;}
+        }
+    }
+    sn_print("FAIL\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,137 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Header (as val) */
+typedef struct {
+    char * __sn__name;
+    char * __sn__value;
+} __sn__Header;
+/* Value operations */
+static inline __sn__Header __sn__Header_copy(const __sn__Header *src) {
+    __sn__Header dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    return dst;
+}
+
+static inline void __sn__Header_cleanup(__sn__Header *p) {
+    free(p->__sn__name);
+    free(p->__sn__value);
+
+}
+
+#define sn_auto_Header __attribute__((cleanup(__sn__Header_cleanup)))
+
+static inline void __sn__Header_cleanup_elem(void *p) { __sn__Header_cleanup((__sn__Header *)p); }
+static inline void __sn__Header_copy_into(const void *src, void *dst) { *(__sn__Header *)dst = __sn__Header_copy((const __sn__Header *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Header *__sn__Header_alloc(void) {
+    return calloc(1, sizeof(__sn__Header));
+}
+
+static inline void __sn__Header_release(__sn__Header **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free((*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Header __attribute__((cleanup(__sn__Header_release)))
+
+static inline void __sn__Header_release_elem(void *p) { __sn__Header_release((__sn__Header **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Header_to_string(const __sn__Header *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Header { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Response (as val) */
+typedef struct {
+    long long __sn__code;
+    SnArray * __sn__headers;
+} __sn__Response;
+/* Value operations */
+static inline __sn__Response __sn__Response_copy(const __sn__Response *src) {
+    __sn__Response dst;
+    dst.__sn__code = src->__sn__code;
+    dst.__sn__headers = sn_array_copy(src->__sn__headers);
+    return dst;
+}
+
+static inline void __sn__Response_cleanup(__sn__Response *p) {
+    sn_cleanup_array(&p->__sn__headers);
+
+}
+
+#define sn_auto_Response __attribute__((cleanup(__sn__Response_cleanup)))
+
+static inline void __sn__Response_cleanup_elem(void *p) { __sn__Response_cleanup((__sn__Response *)p); }
+static inline void __sn__Response_copy_into(const void *src, void *dst) { *(__sn__Response *)dst = __sn__Response_copy((const __sn__Response *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Response *__sn__Response_alloc(void) {
+    return calloc(1, sizeof(__sn__Response));
+}
+
+static inline void __sn__Response_release(__sn__Response **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__headers);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Response __attribute__((cleanup(__sn__Response_release)))
+
+static inline void __sn__Response_release_elem(void *p) { __sn__Response_release((__sn__Response **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Response_to_string(const __sn__Response *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Response { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "code: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__code);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "headers: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__headers); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Response __sn__createResponse();
+
+
+
+
+#endif
@@ -0,0 +1,66 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__buildMany() {
+
+    sn_auto_arr SnArray * __sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Entry), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Entry_cleanup_elem;
+            __al__->elem_copy = __sn__Entry_copy_into;
+            __al__;
+        });
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 20LL); __sn__i++) {
+            __sn__arr_push(&__sn__items, (__sn__Entry){ .__sn__key = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("key_");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                }), .__sn__value = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("val_");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                    sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                }) });
+            
+        }
+    }
+
+    {
+        SnArray * __ret__ = __sn__items;
+        __sn__items = NULL;
+        return __ret__;
+    }}
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__items = __sn__buildMany();
+    if ((sn_array_length(__sn__items) != 20LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: length ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__items)));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if (((strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__key, "key_0") != 0) || (strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__value, "val_0") != 0))) {
+        sn_print("FAIL: item 0\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 10LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__key, "key_10") != 0) || (strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 10LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__value, "val_10") != 0))) {
+        sn_print("FAIL: item 10\n");
+        
+        return 0;}
+    if (((strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 19LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__key, "key_19") != 0) || (strcmp((((__sn__Entry *)__sn__items->data)[({ long long __ai__ = 19LL; __ai__ < 0 ? __ai__ + __sn__items->len : __ai__; })]).__sn__value, "val_19") != 0))) {
+        sn_print("FAIL: item 19\n");
+        
+        return 0;}
+    sn_print("PASS\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include "sn_types.h"
+
+
+
+
+
+void __sn__Container_addItem(__sn__Container *__sn__self, char * __sn__name, SnArray * __sn__vals) {
+
+    __sn__arr_push(&__sn__self->__sn__items, (__sn__Item){ .__sn__name = strdup(__sn__name), .__sn__values = sn_array_copy(__sn__vals) });
+    
+}
+
+void __sn__Container_reset(__sn__Container *__sn__self) {
+
+    ({
+        SnArray *__ma_arr_tmp__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_cleanup_elem;
+            __al__->elem_copy = __sn__Item_copy_into;
+            __al__;
+        });
+        sn_cleanup_array(&__sn__self->__sn__items);
+        __sn__self->__sn__items = __ma_arr_tmp__;
+        __sn__self->__sn__items;
+    });
+    
+}
+
+long long __sn__Container_count(__sn__Container *__sn__self) {
+
+    return sn_array_length(__sn__self->__sn__items);}
+
+int main() {
+    sn_auto_Container __sn__Container __sn__c = (__sn__Container){ .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_cleanup_elem;
+            __al__->elem_copy = __sn__Item_copy_into;
+            __al__;
+        }) };
+    ({ sn_auto_arr SnArray *__al_tmp_1__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        }); __sn__Container_addItem(&__sn__c, "first", __al_tmp_1__); });
+    
+    ({ sn_auto_arr SnArray *__al_tmp_1__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 4LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            __al__;
+        }); __sn__Container_addItem(&__sn__c, "second", __al_tmp_1__); });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Should have 2 items, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Container_count(&__sn__c)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__Container_count(&__sn__c) == 2LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    __sn__Container_reset(&__sn__c);
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Should have 0 items after reset, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Container_count(&__sn__c)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__Container_count(&__sn__c) == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    ({ sn_auto_arr SnArray *__al_tmp_1__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            sn_array_push(__al__, &(long long){ 9LL });
+            __al__;
+        }); __sn__Container_addItem(&__sn__c, "third", __al_tmp_1__); });
+    
+    ({ sn_auto_arr SnArray *__al_tmp_1__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            __al__;
+        }); __sn__Container_addItem(&__sn__c, "fourth", __al_tmp_1__); });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Should have 2 items after re-add, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Container_count(&__sn__c)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((__sn__Container_count(&__sn__c) == 2LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    sn_auto_Item __sn__Item __sn__item = __sn__Item_copy(&(((__sn__Item *)__sn__c.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c.__sn__items->len : __ai__; })]));
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Name should be 'third', got '");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__item.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("'");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_assert((strcmp(__sn__item.__sn__name, "third") == 0), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Values should have 3 elements, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__item.__sn__values)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((sn_array_length(__sn__item.__sn__values) == 3LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("First value should be 7, got ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__item.__sn__values->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__item.__sn__values->len : __ai__; })])));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert(((((long long *)__sn__item.__sn__values->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__item.__sn__values->len : __ai__; })]) == 7LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    sn_auto_Item __sn__Item __sn__item2 = __sn__Item_copy(&(((__sn__Item *)__sn__c.__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__c.__sn__items->len : __ai__; })]));
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Name should be 'fourth', got '");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__item2.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("'");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_assert((strcmp(__sn__item2.__sn__name, "fourth") == 0), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    sn_print("PASS\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,134 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Item (as val) */
+typedef struct {
+    char * __sn__name;
+    SnArray * __sn__values;
+} __sn__Item;
+/* Value operations */
+static inline __sn__Item __sn__Item_copy(const __sn__Item *src) {
+    __sn__Item dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__values = sn_array_copy(src->__sn__values);
+    return dst;
+}
+
+static inline void __sn__Item_cleanup(__sn__Item *p) {
+    free(p->__sn__name);
+    sn_cleanup_array(&p->__sn__values);
+
+}
+
+#define sn_auto_Item __attribute__((cleanup(__sn__Item_cleanup)))
+
+static inline void __sn__Item_cleanup_elem(void *p) { __sn__Item_cleanup((__sn__Item *)p); }
+static inline void __sn__Item_copy_into(const void *src, void *dst) { *(__sn__Item *)dst = __sn__Item_copy((const __sn__Item *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Item *__sn__Item_alloc(void) {
+    return calloc(1, sizeof(__sn__Item));
+}
+
+static inline void __sn__Item_release(__sn__Item **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        sn_cleanup_array(&(*p)->__sn__values);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Item __attribute__((cleanup(__sn__Item_release)))
+
+static inline void __sn__Item_release_elem(void *p) { __sn__Item_release((__sn__Item **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Item_to_string(const __sn__Item *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Item { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "values: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__values); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Container (as val) */
+typedef struct {
+    SnArray * __sn__items;
+} __sn__Container;
+/* Value operations */
+static inline __sn__Container __sn__Container_copy(const __sn__Container *src) {
+    __sn__Container dst;
+    dst.__sn__items = sn_array_copy(src->__sn__items);
+    return dst;
+}
+
+static inline void __sn__Container_cleanup(__sn__Container *p) {
+    sn_cleanup_array(&p->__sn__items);
+
+}
+
+#define sn_auto_Container __attribute__((cleanup(__sn__Container_cleanup)))
+
+static inline void __sn__Container_cleanup_elem(void *p) { __sn__Container_cleanup((__sn__Container *)p); }
+static inline void __sn__Container_copy_into(const void *src, void *dst) { *(__sn__Container *)dst = __sn__Container_copy((const __sn__Container *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Container *__sn__Container_alloc(void) {
+    return calloc(1, sizeof(__sn__Container));
+}
+
+static inline void __sn__Container_release(__sn__Container **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__items);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Container __attribute__((cleanup(__sn__Container_release)))
+
+static inline void __sn__Container_release_elem(void *p) { __sn__Container_release((__sn__Container **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Container_to_string(const __sn__Container *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Container { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "items: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__items); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+void __sn__Container_addItem(__sn__Container *, char *, SnArray *);
+void __sn__Container_reset(__sn__Container *);
+long long __sn__Container_count(__sn__Container *);
+
+
+
+#endif
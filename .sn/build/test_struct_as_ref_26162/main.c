@@ -0,0 +1,151 @@
+#include "sn_types.h"
+
+
+
+void update_point(__sn__Point *__sn__p) {
+
+    ((*__sn__p).__sn__x = sn_add_double((*__sn__p).__sn__x, 10.0));
+    
+
+    ((*__sn__p).__sn__y = sn_add_double((*__sn__p).__sn__y, 20.0));
+    
+}
+
+void scale_point(__sn__Point *__sn__p, double __sn__factor) {
+
+    ((*__sn__p).__sn__x = sn_mul_double((*__sn__p).__sn__x, __sn__factor));
+    
+
+    ((*__sn__p).__sn__y = sn_mul_double((*__sn__p).__sn__y, __sn__factor));
+    
+}
+
+void increment_counter(__sn__Counter *__sn__c) {
+
+    ((*__sn__c).__sn__count = sn_add_long((*__sn__c).__sn__count, 1LL));
+    
+}
+
+
+
+int main() {
+    sn_print("Testing 'as ref' struct parameter passing:\n\n");
+    
+    __sn__Point __sn__pt = (__sn__Point){ .__sn__x = 5.0, .__sn__y = 10.0 };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("1. Original point: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__pt.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__pt.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    update_point(&__sn__pt);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   After update_point: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__pt.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__pt.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__pt.__sn__x != 15.0)) {
+        sn_print("FAIL: Expected x=15.0\n");
+        
+        return 1LL;}
+    if ((__sn__pt.__sn__y != 30.0)) {
+        sn_print("FAIL: Expected y=30.0\n");
+        
+        return 1LL;}
+    __sn__Point __sn__pt2 = (__sn__Point){ .__sn__x = 2.0, .__sn__y = 3.0 };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("\n2. Before scaling: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__pt2.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__pt2.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    scale_point(&__sn__pt2, 5.0);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   After scale by 5: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__pt2.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__pt2.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__pt2.__sn__x != 10.0)) {
+        sn_print("FAIL: Expected x=10.0\n");
+        
+        return 1LL;}
+    if ((__sn__pt2.__sn__y != 15.0)) {
+        sn_print("FAIL: Expected y=15.0\n");
+        
+        return 1LL;}
+    sn_auto_Counter __sn__Counter __sn__ctr = (__sn__Counter){ .__sn__count = 0LL, .__sn__name = strdup("test_counter") };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("\n3. Before increment: count=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__ctr.__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    increment_counter(&__sn__ctr);
+    
+    increment_counter(&__sn__ctr);
+    
+    increment_counter(&__sn__ctr);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   After 3 increments: count=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__ctr.__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__ctr.__sn__count != 3LL)) {
+        sn_print("FAIL: Expected count=3\n");
+        
+        return 1LL;}
+    __sn__Point __sn__pt3 = (__sn__Point){ .__sn__x = 1.0, .__sn__y = 1.0 };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("\n4. Starting point: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__pt3.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__pt3.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    update_point(&__sn__pt3);
+    
+    update_point(&__sn__pt3);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   After two updates: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__pt3.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__pt3.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__pt3.__sn__x != 21.0)) {
+        sn_print("FAIL: Expected x=21.0\n");
+        
+        return 1LL;}
+    if ((__sn__pt3.__sn__y != 41.0)) {
+        sn_print("FAIL: Expected y=41.0\n");
+        
+        return 1LL;}
+    sn_print("\nAll 'as ref' struct tests PASSED!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,142 @@
+#include "sn_types.h"
+
+
+
+long long test_chaining() {
+
+    sn_auto_Vec2 __sn__Vec2 * __sn__v1 = ({
+        __sn__Vec2 *__tmp__ = __sn__Vec2__new();
+        __tmp__->__sn__x = 1LL;
+        __tmp__->__sn__y = 2LL;
+        __tmp__;
+    });
+
+    sn_auto_Vec2 __sn__Vec2 * __sn__v2 = ({
+        __sn__Vec2 *__tmp__ = __sn__Vec2__new();
+        __tmp__->__sn__x = 3LL;
+        __tmp__->__sn__y = 4LL;
+        __tmp__;
+    });
+
+    sn_auto_Vec2 __sn__Vec2 * __sn__sum = ({
+        __sn__Vec2 *__bi_snap_0__ = __sn__v2;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__Vec2 *__bi_result__ = __sn__Vec2_add(__sn__v1, __sn__v2);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__Vec2_retain(__bi_result__);
+        __bi_result__;
+    });
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.add(v2): (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum->__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__sum->__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    sn_auto_Vec2 __sn__Vec2 * __sn____chain_tmp_0 = ({
+        __sn__Vec2 *__bi_snap_0__ = __sn__v2;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__Vec2 *__bi_result__ = __sn__Vec2_add(__sn__v1, __sn__v2);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__Vec2_retain(__bi_result__);
+        __bi_result__;
+    });
+
+    sn_auto_Vec2 __sn__Vec2 * __sn__chained = __sn__Vec2_scale(__sn____chain_tmp_0, 2LL);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.add(v2).scale(2): (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__chained->__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__chained->__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    sn_auto_Vec2 __sn__Vec2 * __sn____chain_tmp_1 = ({
+        __sn__Vec2 *__bi_snap_0__ = __sn__v2;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__Vec2 *__bi_result__ = __sn__Vec2_add(__sn__v1, __sn__v2);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__Vec2_retain(__bi_result__);
+        __bi_result__;
+    });
+
+    sn_auto_Vec2 __sn__Vec2 * __sn____chain_tmp_2 = __sn__Vec2_scale(__sn____chain_tmp_1, 3LL);
+
+    sn_auto_Vec2 __sn__Vec2 * __sn__deep = __sn__Vec2_negate(__sn____chain_tmp_2);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.add(v2).scale(3).negate(): (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__deep->__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__deep->__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    sn_auto_Vec2 __sn__Vec2 * __sn____chain_tmp_3 = ({
+        __sn__Vec2 *__bi_snap_0__ = __sn__v2;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__Vec2 *__bi_result__ = __sn__Vec2_add(__sn__v1, __sn__v2);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__Vec2_retain(__bi_result__);
+        __bi_result__;
+    });
+
+    sn_auto_Vec2 __sn__Vec2 * __sn____chain_tmp_4 = ({
+        __sn__Vec2 *__bi_snap_0__ = __sn__v1;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__Vec2 *__bi_result__ = __sn__Vec2_add(__sn____chain_tmp_3, __sn__v1);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__Vec2_retain(__bi_result__);
+        __bi_result__;
+    });
+
+    sn_auto_Vec2 __sn__Vec2 * __sn__triple = ({
+        __sn__Vec2 *__bi_snap_0__ = __sn__v2;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__Vec2 *__bi_result__ = __sn__Vec2_add(__sn____chain_tmp_4, __sn__v2);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__Vec2_retain(__bi_result__);
+        __bi_result__;
+    });
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.add(v2).add(v1).add(v2): (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__triple->__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__triple->__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    sn_auto_Vec2 __sn__Vec2 * __sn____chain_tmp_5 = __sn__Vec2_negate(__sn__v1);
+
+    sn_auto_Vec2 __sn__Vec2 * __sn____chain_tmp_6 = ({
+        __sn__Vec2 *__bi_snap_0__ = __sn__v2;
+        int __bi_rc_0__ = __bi_snap_0__ ? __bi_snap_0__->__rc__ : 0;
+        __sn__Vec2 *__bi_result__ = __sn__Vec2_add(__sn____chain_tmp_5, __sn__v2);
+        if (__bi_result__ && ((__bi_result__ == __bi_snap_0__ && __bi_result__->__rc__ == __bi_rc_0__))) __sn__Vec2_retain(__bi_result__);
+        __bi_result__;
+    });
+
+    sn_auto_Vec2 __sn__Vec2 * __sn__negChain = __sn__Vec2_scale(__sn____chain_tmp_6, 2LL);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.negate().add(v2).scale(2): (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__negChain->__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__negChain->__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    return 0LL;}
+
+
+int main() {
+    return test_chaining();    fflush(stdout);
+}
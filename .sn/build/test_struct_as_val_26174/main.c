@@ -0,0 +1,229 @@
+#include "sn_types.h"
+
+
+
+
+
+int main() {
+    sn_print("Testing 'as val' struct deep copy semantics:\n\n");
+    
+    sn_auto_Container __sn__Container __sn__c1 = (__sn__Container){ .__sn__name = strdup("original"), .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        }) };
+    sn_auto_Container __sn__Container __sn__c2 = __sn__Container_copy(&__sn__c1);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("1. Before modification:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   c1.items: [");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c1.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c1.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c1.__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__c1.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c1.__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__c1.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p6__ = sn_strdup("]\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   c2.items: [");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c2.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c2.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c2.__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__c2.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c2.__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__c2.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p6__ = sn_strdup("]\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    ((long long *)__sn__c2.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c2.__sn__items->len : __ai__; })] = 100LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   After c2.items[0] = 100 (deep copy):\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   c1.items: [");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c1.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c1.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c1.__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__c1.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c1.__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__c1.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p6__ = sn_strdup("]\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   c2.items: [");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c2.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c2.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c2.__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__c2.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c2.__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__c2.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p6__ = sn_strdup("]\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    if (((((long long *)__sn__c1.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c1.__sn__items->len : __ai__; })]) != 1LL)) {
+        sn_print("FAIL: Expected c1.items[0] to be unchanged after deep copy\n");
+        
+        return 1LL;}
+    sn_auto_Container __sn__Container __sn__c3 = (__sn__Container){ .__sn__name = strdup("source"), .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            __al__;
+        }) };
+    sn_auto_Container __sn__Container __sn__c4 = __sn__Container_copy(&(__sn__c3));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("\n2. With 'as val' (deep copy):\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   c3.items: [");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c3.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c3.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c3.__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__c3.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c3.__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__c3.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p6__ = sn_strdup("]\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   c4.items: [");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c4.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c4.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c4.__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__c4.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c4.__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__c4.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p6__ = sn_strdup("]\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    ((long long *)__sn__c4.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c4.__sn__items->len : __ai__; })] = 999LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   After c4.items[0] = 999 (deep copy):\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   c3.items: [");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c3.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c3.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c3.__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__c3.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c3.__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__c3.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p6__ = sn_strdup("]\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   c4.items: [");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c4.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c4.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c4.__sn__items->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__c4.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__c4.__sn__items->data)[({ long long __ai__ = 2LL; __ai__ < 0 ? __ai__ + __sn__c4.__sn__items->len : __ai__; })])));
+            sn_auto_str char *__is_p6__ = sn_strdup("]\n");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_print(__ps__); };
+    
+    if (((((long long *)__sn__c3.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c3.__sn__items->len : __ai__; })]) != 10LL)) {
+        sn_print("FAIL: c3.items[0] should be unchanged after deep copy modification\n");
+        
+        return 1LL;}
+    if (((((long long *)__sn__c4.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__c4.__sn__items->len : __ai__; })]) != 999LL)) {
+        sn_print("FAIL: c4.items[0] should be 999\n");
+        
+        return 1LL;}
+    sn_auto_DataHolder __sn__DataHolder __sn__d1 = (__sn__DataHolder){ .__sn__label = strdup("measurements"), .__sn__values = ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 3);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.5 });
+            sn_array_push(__al__, &(double){ 2.5 });
+            sn_array_push(__al__, &(double){ 3.5 });
+            __al__;
+        }) };
+    sn_auto_DataHolder __sn__DataHolder __sn__d2 = __sn__DataHolder_copy(&(__sn__d1));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("\n3. Deep copy with doubles:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    ((double *)__sn__d2.__sn__values->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__d2.__sn__values->len : __ai__; })] = 100.5;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   d1.values[1]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)((((double *)__sn__d1.__sn__values->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__d1.__sn__values->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   d2.values[1]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)((((double *)__sn__d2.__sn__values->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__d2.__sn__values->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (((((double *)__sn__d1.__sn__values->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__d1.__sn__values->len : __ai__; })]) != 2.5)) {
+        sn_print("FAIL: d1.values should be unchanged\n");
+        
+        return 1LL;}
+    if (((((double *)__sn__d2.__sn__values->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__d2.__sn__values->len : __ai__; })]) != 100.5)) {
+        sn_print("FAIL: d2.values[1] should be 100.5\n");
+        
+        return 1LL;}
+    sn_auto_Container __sn__Container __sn__c5 = (__sn__Container){ .__sn__name = strdup("test_name"), .__sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 15LL });
+            __al__;
+        }) };
+    sn_auto_Container __sn__Container __sn__c6 = __sn__Container_copy(&(__sn__c5));
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("\n4. String field in deep copy:\n");
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   c5.name: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__c5.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("   c6.name: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__c6.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((strcmp(__sn__c6.__sn__name, "test_name") != 0)) {
+        sn_print("FAIL: String field should be copied\n");
+        
+        return 1LL;}
+    sn_print("\nAll 'as val' struct deep copy tests PASSED!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,260 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_basic_types() {
+
+    __sn__BasicTypes __sn__s = (__sn__BasicTypes){ .__sn__field_int = 1LL, .__sn__field_int32 = 2LL, .__sn__field_double = 6.0, .__sn__field_float = 7.0, .__sn__field_char = (char)97, .__sn__field_bool = true, .__sn__field_byte = (unsigned char)255 };
+
+    if ((__sn__s.__sn__field_int == 1LL)) {
+        sn_print("field_int: PASS\n");
+        
+    } else {
+        sn_print("field_int: FAIL\n");
+        
+    }
+
+    if ((__sn__s.__sn__field_int32 == 2LL)) {
+        sn_print("field_int32: PASS\n");
+        
+    } else {
+        sn_print("field_int32: FAIL\n");
+        
+    }
+
+    if ((__sn__s.__sn__field_double == 6.0)) {
+        sn_print("field_double: PASS\n");
+        
+    } else {
+        sn_print("field_double: FAIL\n");
+        
+    }
+
+    if ((__sn__s.__sn__field_char == (char)97)) {
+        sn_print("field_char: PASS\n");
+        
+    } else {
+        sn_print("field_char: FAIL\n");
+        
+    }
+
+    if ((__sn__s.__sn__field_bool == true)) {
+        sn_print("field_bool: PASS\n");
+        
+    } else {
+        sn_print("field_bool: FAIL\n");
+        
+    }
+
+    if ((__sn__s.__sn__field_byte == (unsigned char)255)) {
+        sn_print("field_byte: PASS\n");
+        
+    } else {
+        sn_print("field_byte: FAIL\n");
+        
+    }
+}
+
+
+void __sn__test_nested_struct() {
+
+    __sn__NestedStruct __sn__n = (__sn__NestedStruct){ .__sn__point = (__sn__Point){ .__sn__x = 3.1400000000000001, .__sn__y = 2.71 }, .__sn__value = 42LL };
+
+    if ((__sn__n.__sn__point.__sn__x == 3.1400000000000001)) {
+        sn_print("nested point.x: PASS\n");
+        
+    } else {
+        sn_print("nested point.x: FAIL\n");
+        
+    }
+
+    if ((__sn__n.__sn__point.__sn__y == 2.71)) {
+        sn_print("nested point.y: PASS\n");
+        
+    } else {
+        sn_print("nested point.y: FAIL\n");
+        
+    }
+
+    if ((__sn__n.__sn__value == 42LL)) {
+        sn_print("nested value: PASS\n");
+        
+    } else {
+        sn_print("nested value: FAIL\n");
+        
+    }
+}
+
+
+void __sn__test_packed_struct_size() {
+
+    long long __sn__packed_size = sizeof(__sn__PackedData);
+
+    if ((__sn__packed_size == 10LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("PackedData sizeof=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__packed_size));
+                sn_auto_str char *__is_p2__ = sn_strdup(": PASS (expected 10)\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+    } else {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("PackedData sizeof=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__packed_size));
+                sn_auto_str char *__is_p2__ = sn_strdup(": FAIL (expected 10)\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+    }
+}
+
+
+void __sn__test_unpacked_struct_alignment() {
+
+    long long __sn__unpacked_size = sizeof(__sn__AfterPacked);
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("AfterPacked sizeof=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__unpacked_size));
+            sn_auto_str char *__is_p2__ = sn_strdup(": checking alignment\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    if ((__sn__unpacked_size >= 17LL)) {
+        sn_print("AfterPacked alignment: PASS (size >= 17)\n");
+        
+    } else {
+        sn_print("AfterPacked alignment: FAIL (size < 17)\n");
+        
+    }
+}
+
+
+void __sn__test_c_type_sizes() {
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("int: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(long long)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" bytes\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("int32: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(int32_t)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" bytes\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("double: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(double)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" bytes\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("float: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(float)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" bytes\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("char: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(char)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" bytes\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("bool: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(bool)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" bytes\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("byte: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(unsigned char)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" bytes\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    if ((sizeof(long long) == 8LL)) {
+        sn_print("sizeof(int) == 8: PASS\n");
+        
+    } else {
+        sn_print("sizeof(int) == 8: FAIL\n");
+        
+    }
+
+    if ((sizeof(int32_t) == 4LL)) {
+        sn_print("sizeof(int32) == 4: PASS\n");
+        
+    } else {
+        sn_print("sizeof(int32) == 4: FAIL\n");
+        
+    }
+
+    if ((sizeof(double) == 8LL)) {
+        sn_print("sizeof(double) == 8: PASS\n");
+        
+    } else {
+        sn_print("sizeof(double) == 8: FAIL\n");
+        
+    }
+
+    if ((sizeof(float) == 4LL)) {
+        sn_print("sizeof(float) == 4: PASS\n");
+        
+    } else {
+        sn_print("sizeof(float) == 4: FAIL\n");
+        
+    }
+}
+
+
+
+
+
+
+
+int main() {
+    sn_print("=== Struct Code Generation Validation ===\n\n");
+    
+    sn_print("--- Testing Basic Field Types ---\n");
+    
+    __sn__test_basic_types();
+    
+    sn_print("\n--- Testing Nested Structs ---\n");
+    
+    __sn__test_nested_struct();
+    
+    sn_print("\n--- Testing Packed Struct Size ---\n");
+    
+    __sn__test_packed_struct_size();
+    
+    sn_print("\n--- Testing Unpacked Struct Alignment ---\n");
+    
+    __sn__test_unpacked_struct_alignment();
+    
+    sn_print("\n--- C Type Sizes ---\n");
+    
+    __sn__test_c_type_sizes();
+    
+    sn_print("\n=== All Struct Code Generation Tests Completed ===\n");
+    
+    fflush(stdout);
+    return 0;
+}
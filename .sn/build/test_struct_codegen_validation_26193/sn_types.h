@@ -0,0 +1,343 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: BasicTypes (as val) */
+typedef struct {
+    long long __sn__field_int;
+    int32_t __sn__field_int32;
+    double __sn__field_double;
+    float __sn__field_float;
+    char __sn__field_char;
+    bool __sn__field_bool;
+    unsigned char __sn__field_byte;
+} __sn__BasicTypes;
+/* Value operations */
+static inline __sn__BasicTypes __sn__BasicTypes_copy(const __sn__BasicTypes *src) {
+    __sn__BasicTypes dst;
+    dst.__sn__field_int = src->__sn__field_int;
+    dst.__sn__field_int32 = src->__sn__field_int32;
+    dst.__sn__field_double = src->__sn__field_double;
+    dst.__sn__field_float = src->__sn__field_float;
+    dst.__sn__field_char = src->__sn__field_char;
+    dst.__sn__field_bool = src->__sn__field_bool;
+    dst.__sn__field_byte = src->__sn__field_byte;
+    return dst;
+}
+
+static inline void __sn__BasicTypes_cleanup(__sn__BasicTypes *p) {
+
+}
+
+#define sn_auto_BasicTypes __attribute__((cleanup(__sn__BasicTypes_cleanup)))
+
+static inline void __sn__BasicTypes_cleanup_elem(void *p) { __sn__BasicTypes_cleanup((__sn__BasicTypes *)p); }
+static inline void __sn__BasicTypes_copy_into(const void *src, void *dst) { *(__sn__BasicTypes *)dst = __sn__BasicTypes_copy((const __sn__BasicTypes *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__BasicTypes *__sn__BasicTypes_alloc(void) {
+    return calloc(1, sizeof(__sn__BasicTypes));
+}
+
+static inline void __sn__BasicTypes_release(__sn__BasicTypes **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_BasicTypes __attribute__((cleanup(__sn__BasicTypes_release)))
+
+static inline void __sn__BasicTypes_release_elem(void *p) { __sn__BasicTypes_release((__sn__BasicTypes **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__BasicTypes_to_string(const __sn__BasicTypes *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "BasicTypes { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field_int: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field_int);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field_int32: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field_int32);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field_double: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__field_double);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field_float: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__field_float);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field_char: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "'%c'", p->__sn__field_char);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field_bool: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__field_bool ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field_byte: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__field_byte);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Point (as val) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: NestedStruct (as val) */
+typedef struct {
+    __sn__Point __sn__point;
+    long long __sn__value;
+} __sn__NestedStruct;
+/* Value operations */
+static inline __sn__NestedStruct __sn__NestedStruct_copy(const __sn__NestedStruct *src) {
+    __sn__NestedStruct dst;
+    dst.__sn__point = __sn__Point_copy(&src->__sn__point);
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__NestedStruct_cleanup(__sn__NestedStruct *p) {
+
+}
+
+#define sn_auto_NestedStruct __attribute__((cleanup(__sn__NestedStruct_cleanup)))
+
+static inline void __sn__NestedStruct_cleanup_elem(void *p) { __sn__NestedStruct_cleanup((__sn__NestedStruct *)p); }
+static inline void __sn__NestedStruct_copy_into(const void *src, void *dst) { *(__sn__NestedStruct *)dst = __sn__NestedStruct_copy((const __sn__NestedStruct *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__NestedStruct *__sn__NestedStruct_alloc(void) {
+    return calloc(1, sizeof(__sn__NestedStruct));
+}
+
+static inline void __sn__NestedStruct_release(__sn__NestedStruct **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_NestedStruct __attribute__((cleanup(__sn__NestedStruct_release)))
+
+static inline void __sn__NestedStruct_release_elem(void *p) { __sn__NestedStruct_release((__sn__NestedStruct **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__NestedStruct_to_string(const __sn__NestedStruct *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "NestedStruct { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "point: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__point); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: PackedData (as val) */
+#pragma pack(push, 1)
+typedef struct {
+    int32_t __sn__header;
+    unsigned char __sn__version;
+    unsigned char __sn__flags;
+    int32_t __sn__payload_size;
+} __sn__PackedData;
+#pragma pack(pop)
+/* Value operations */
+static inline __sn__PackedData __sn__PackedData_copy(const __sn__PackedData *src) {
+    __sn__PackedData dst;
+    dst.__sn__header = src->__sn__header;
+    dst.__sn__version = src->__sn__version;
+    dst.__sn__flags = src->__sn__flags;
+    dst.__sn__payload_size = src->__sn__payload_size;
+    return dst;
+}
+
+static inline void __sn__PackedData_cleanup(__sn__PackedData *p) {
+
+}
+
+#define sn_auto_PackedData __attribute__((cleanup(__sn__PackedData_cleanup)))
+
+static inline void __sn__PackedData_cleanup_elem(void *p) { __sn__PackedData_cleanup((__sn__PackedData *)p); }
+static inline void __sn__PackedData_copy_into(const void *src, void *dst) { *(__sn__PackedData *)dst = __sn__PackedData_copy((const __sn__PackedData *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__PackedData *__sn__PackedData_alloc(void) {
+    return calloc(1, sizeof(__sn__PackedData));
+}
+
+static inline void __sn__PackedData_release(__sn__PackedData **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_PackedData __attribute__((cleanup(__sn__PackedData_release)))
+
+static inline void __sn__PackedData_release_elem(void *p) { __sn__PackedData_release((__sn__PackedData **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__PackedData_to_string(const __sn__PackedData *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "PackedData { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "header: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__header);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "version: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__version);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "flags: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__flags);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "payload_size: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__payload_size);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: AfterPacked (as val) */
+typedef struct {
+    long long __sn__a;
+    unsigned char __sn__b;
+    long long __sn__c;
+} __sn__AfterPacked;
+/* Value operations */
+static inline __sn__AfterPacked __sn__AfterPacked_copy(const __sn__AfterPacked *src) {
+    __sn__AfterPacked dst;
+    dst.__sn__a = src->__sn__a;
+    dst.__sn__b = src->__sn__b;
+    dst.__sn__c = src->__sn__c;
+    return dst;
+}
+
+static inline void __sn__AfterPacked_cleanup(__sn__AfterPacked *p) {
+
+}
+
+#define sn_auto_AfterPacked __attribute__((cleanup(__sn__AfterPacked_cleanup)))
+
+static inline void __sn__AfterPacked_cleanup_elem(void *p) { __sn__AfterPacked_cleanup((__sn__AfterPacked *)p); }
+static inline void __sn__AfterPacked_copy_into(const void *src, void *dst) { *(__sn__AfterPacked *)dst = __sn__AfterPacked_copy((const __sn__AfterPacked *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__AfterPacked *__sn__AfterPacked_alloc(void) {
+    return calloc(1, sizeof(__sn__AfterPacked));
+}
+
+static inline void __sn__AfterPacked_release(__sn__AfterPacked **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_AfterPacked __attribute__((cleanup(__sn__AfterPacked_release)))
+
+static inline void __sn__AfterPacked_release_elem(void *p) { __sn__AfterPacked_release((__sn__AfterPacked **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__AfterPacked_to_string(const __sn__AfterPacked *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "AfterPacked { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__b);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__c);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: NativeBuffer (native) */
+typedef struct {
+    unsigned char * __sn__data;
+    long long __sn__size;
+    long long __sn__capacity;
+} __sn__NativeBuffer;
+
+
+void __sn__test_basic_types();
+void __sn__test_nested_struct();
+void __sn__test_packed_struct_size();
+void __sn__test_unpacked_struct_alignment();
+void __sn__test_c_type_sizes();
+
+
+
+
+#endif
@@ -0,0 +1,58 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Outer __sn__buildOuter() {
+
+    sn_auto_Inner __sn__Inner __sn__i = (__sn__Inner){ .__sn__value = strdup("deep-value") };
+
+    sn_auto_Middle __sn__Middle __sn__m = (__sn__Middle){ .__sn__label = strdup("mid-label"), .__sn__inner = __sn__Inner_copy(&(__sn__i)) };
+
+    sn_auto_Outer __sn__Outer __sn__o = (__sn__Outer){ .__sn__title = strdup("top-title"), .__sn__middle = __sn__Middle_copy(&(__sn__m)) };
+
+    {
+        __sn__Outer __ret__ = __sn__o;
+        memset(&__sn__o, 0, sizeof(__sn__o));
+        return __ret__;
+    }}
+
+
+
+
+int main() {
+    sn_auto_Outer __sn__Outer __sn__o = __sn__buildOuter();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Title: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__o.__sn__title);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Label: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__o.__sn__middle.__sn__label);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Value: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__o.__sn__middle.__sn__inner.__sn__value);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((strcmp(__sn__o.__sn__title, "top-title") == 0)) {
+        if ((strcmp(__sn__o.__sn__middle.__sn__label, "mid-label") == 0)) {
+            if ((strcmp(__sn__o.__sn__middle.__sn__inner.__sn__value, "deep-value") == 0)) {
+                sn_print("PASS\n");
+                
+                return 0;}
+        }
+    }
+    sn_print("FAIL\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include "sn_types.h"
+
+
+
+
+
+
+
+
+int main() {
+    __sn__Config __sn__cfg1 = (__sn__Config){ .__sn__timeout = 30LL, .__sn__retries = 3LL, .__sn__verbose = false };
+    sn_print("Test 1 - Zero init passed\n");
+    
+    __sn__Config __sn__cfg2 = (__sn__Config){ .__sn__timeout = 60LL, .__sn__retries = 3LL, .__sn__verbose = false };
+    sn_print("Test 2 - Partial init (timeout only) passed\n");
+    
+    __sn__Config __sn__cfg3 = (__sn__Config){ .__sn__verbose = true, .__sn__timeout = 30LL, .__sn__retries = 3LL };
+    sn_print("Test 3 - Partial init (verbose only) passed\n");
+    
+    __sn__Config __sn__cfg4 = (__sn__Config){ .__sn__timeout = 120LL, .__sn__retries = 5LL, .__sn__verbose = true };
+    sn_print("Test 4 - Full override passed\n");
+    
+    sn_auto_Connection __sn__Connection __sn__conn1 = (__sn__Connection){ .__sn__host = strdup("localhost"), .__sn__port = 8080LL, .__sn__maxConn = 100LL };
+    sn_print("Test 5 - Connection defaults passed\n");
+    
+    sn_auto_Connection __sn__Connection __sn__conn2 = (__sn__Connection){ .__sn__port = 443LL, .__sn__host = strdup("localhost"), .__sn__maxConn = 100LL };
+    sn_print("Test 6 - Connection partial passed\n");
+    
+    sn_auto_Connection __sn__Connection __sn__conn3 = (__sn__Connection){ .__sn__host = strdup("example.com"), .__sn__port = 9000LL, .__sn__maxConn = 500LL };
+    sn_print("Test 7 - Connection full override passed\n");
+    
+    __sn__Point __sn__p1 = (__sn__Point){ .__sn__x = 10.5, .__sn__y = 20.5 };
+    sn_print("Test 8 - Point (all required) passed\n");
+    
+    sn_auto_Mixed __sn__Mixed __sn__mix1 = (__sn__Mixed){ .__sn__required_field = 100LL, .__sn__another_required = strdup("hello"), .__sn__optional_field = 42LL, .__sn__another_optional = true };
+    sn_print("Test 9 - Mixed (required only) passed\n");
+    
+    sn_auto_Mixed __sn__Mixed __sn__mix2 = (__sn__Mixed){ .__sn__required_field = 200LL, .__sn__another_required = strdup("world"), .__sn__optional_field = 99LL, .__sn__another_optional = true };
+    sn_print("Test 10 - Mixed (one override) passed\n");
+    
+    sn_auto_Mixed __sn__Mixed __sn__mix3 = (__sn__Mixed){ .__sn__required_field = 300LL, .__sn__optional_field = 0LL, .__sn__another_required = strdup("test"), .__sn__another_optional = false };
+    sn_print("Test 11 - Mixed (all override) passed\n");
+    
+    sn_auto_Outer __sn__Outer __sn__outer1 = (__sn__Outer){ .__sn__name = strdup("test"), .__sn__cfg = (__sn__Config){ .__sn__timeout = 30LL, .__sn__retries = 3LL, .__sn__verbose = false } };
+    sn_print("Test 12 - Nested with inner defaults passed\n");
+    
+    sn_auto_Outer __sn__Outer __sn__outer2 = (__sn__Outer){ .__sn__name = strdup("partial"), .__sn__cfg = (__sn__Config){ .__sn__timeout = 90LL, .__sn__retries = 3LL, .__sn__verbose = false } };
+    sn_print("Test 13 - Nested partial passed\n");
+    
+    sn_print("All struct default tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,315 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Config (as val) */
+typedef struct {
+    long long __sn__timeout;
+    long long __sn__retries;
+    bool __sn__verbose;
+} __sn__Config;
+/* Value operations */
+static inline __sn__Config __sn__Config_copy(const __sn__Config *src) {
+    __sn__Config dst;
+    dst.__sn__timeout = src->__sn__timeout;
+    dst.__sn__retries = src->__sn__retries;
+    dst.__sn__verbose = src->__sn__verbose;
+    return dst;
+}
+
+static inline void __sn__Config_cleanup(__sn__Config *p) {
+
+}
+
+#define sn_auto_Config __attribute__((cleanup(__sn__Config_cleanup)))
+
+static inline void __sn__Config_cleanup_elem(void *p) { __sn__Config_cleanup((__sn__Config *)p); }
+static inline void __sn__Config_copy_into(const void *src, void *dst) { *(__sn__Config *)dst = __sn__Config_copy((const __sn__Config *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Config *__sn__Config_alloc(void) {
+    return calloc(1, sizeof(__sn__Config));
+}
+
+static inline void __sn__Config_release(__sn__Config **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Config __attribute__((cleanup(__sn__Config_release)))
+
+static inline void __sn__Config_release_elem(void *p) { __sn__Config_release((__sn__Config **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Config_to_string(const __sn__Config *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Config { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "timeout: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__timeout);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "retries: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__retries);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "verbose: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__verbose ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Connection (as val) */
+typedef struct {
+    char * __sn__host;
+    long long __sn__port;
+    long long __sn__maxConn;
+} __sn__Connection;
+/* Value operations */
+static inline __sn__Connection __sn__Connection_copy(const __sn__Connection *src) {
+    __sn__Connection dst;
+    dst.__sn__host = src->__sn__host ? strdup(src->__sn__host) : NULL;
+    dst.__sn__port = src->__sn__port;
+    dst.__sn__maxConn = src->__sn__maxConn;
+    return dst;
+}
+
+static inline void __sn__Connection_cleanup(__sn__Connection *p) {
+    free(p->__sn__host);
+
+}
+
+#define sn_auto_Connection __attribute__((cleanup(__sn__Connection_cleanup)))
+
+static inline void __sn__Connection_cleanup_elem(void *p) { __sn__Connection_cleanup((__sn__Connection *)p); }
+static inline void __sn__Connection_copy_into(const void *src, void *dst) { *(__sn__Connection *)dst = __sn__Connection_copy((const __sn__Connection *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Connection *__sn__Connection_alloc(void) {
+    return calloc(1, sizeof(__sn__Connection));
+}
+
+static inline void __sn__Connection_release(__sn__Connection **p) {
+    if (*p) {
+        free((*p)->__sn__host);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Connection __attribute__((cleanup(__sn__Connection_release)))
+
+static inline void __sn__Connection_release_elem(void *p) { __sn__Connection_release((__sn__Connection **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Connection_to_string(const __sn__Connection *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Connection { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "host: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__host ? p->__sn__host : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "port: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__port);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "maxConn: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__maxConn);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Point (as val) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Outer (as val) */
+typedef struct {
+    char * __sn__name;
+    __sn__Config __sn__cfg;
+} __sn__Outer;
+/* Value operations */
+static inline __sn__Outer __sn__Outer_copy(const __sn__Outer *src) {
+    __sn__Outer dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__cfg = __sn__Config_copy(&src->__sn__cfg);
+    return dst;
+}
+
+static inline void __sn__Outer_cleanup(__sn__Outer *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Outer __attribute__((cleanup(__sn__Outer_cleanup)))
+
+static inline void __sn__Outer_cleanup_elem(void *p) { __sn__Outer_cleanup((__sn__Outer *)p); }
+static inline void __sn__Outer_copy_into(const void *src, void *dst) { *(__sn__Outer *)dst = __sn__Outer_copy((const __sn__Outer *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Outer *__sn__Outer_alloc(void) {
+    return calloc(1, sizeof(__sn__Outer));
+}
+
+static inline void __sn__Outer_release(__sn__Outer **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Outer __attribute__((cleanup(__sn__Outer_release)))
+
+static inline void __sn__Outer_release_elem(void *p) { __sn__Outer_release((__sn__Outer **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Outer_to_string(const __sn__Outer *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Outer { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "cfg: ");
+    { char *__fs__ = __sn__Config_to_string(&p->__sn__cfg); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Mixed (as val) */
+typedef struct {
+    long long __sn__required_field;
+    long long __sn__optional_field;
+    char * __sn__another_required;
+    bool __sn__another_optional;
+} __sn__Mixed;
+/* Value operations */
+static inline __sn__Mixed __sn__Mixed_copy(const __sn__Mixed *src) {
+    __sn__Mixed dst;
+    dst.__sn__required_field = src->__sn__required_field;
+    dst.__sn__optional_field = src->__sn__optional_field;
+    dst.__sn__another_required = src->__sn__another_required ? strdup(src->__sn__another_required) : NULL;
+    dst.__sn__another_optional = src->__sn__another_optional;
+    return dst;
+}
+
+static inline void __sn__Mixed_cleanup(__sn__Mixed *p) {
+    free(p->__sn__another_required);
+
+}
+
+#define sn_auto_Mixed __attribute__((cleanup(__sn__Mixed_cleanup)))
+
+static inline void __sn__Mixed_cleanup_elem(void *p) { __sn__Mixed_cleanup((__sn__Mixed *)p); }
+static inline void __sn__Mixed_copy_into(const void *src, void *dst) { *(__sn__Mixed *)dst = __sn__Mixed_copy((const __sn__Mixed *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Mixed *__sn__Mixed_alloc(void) {
+    return calloc(1, sizeof(__sn__Mixed));
+}
+
+static inline void __sn__Mixed_release(__sn__Mixed **p) {
+    if (*p) {
+        free((*p)->__sn__another_required);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Mixed __attribute__((cleanup(__sn__Mixed_release)))
+
+static inline void __sn__Mixed_release_elem(void *p) { __sn__Mixed_release((__sn__Mixed **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Mixed_to_string(const __sn__Mixed *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Mixed { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "required_field: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__required_field);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "optional_field: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__optional_field);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "another_required: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__another_required ? p->__sn__another_required : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "another_optional: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__another_optional ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+
+
+
+#endif
@@ -0,0 +1,277 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_simple_struct_escape() {
+
+    __sn__Point __sn__outer = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+
+    if (true) {
+        __sn__Point __sn__inner = (__sn__Point){ .__sn__x = 42LL, .__sn__y = 99LL };
+        (__sn__outer = __sn__inner);
+        
+    }
+
+    if ((__sn__outer.__sn__x != 42LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: outer.x = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__outer.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 42\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__outer.__sn__y != 99LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: outer.y = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__outer.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 99\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Simple struct escape test: PASS\n");
+    
+}
+
+
+void __sn__test_struct_with_string_escape() {
+
+    sn_auto_Person __sn__Person __sn__outer = (__sn__Person){ .__sn__name = strdup("default"), .__sn__age = 0LL };
+
+    if (true) {
+        sn_auto_Person __sn__Person __sn__inner = (__sn__Person){ .__sn__name = strdup("Alice"), .__sn__age = 30LL };
+        ({
+            __sn__Person __tmp__ = __sn__Person_copy(&__sn__inner);
+            __sn__Person_cleanup(&__sn__outer);
+            __sn__outer = __tmp__;
+            __sn__outer;
+        });
+        
+    }
+
+    if ((strcmp(__sn__outer.__sn__name, "Alice") != 0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: outer.name = ");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__outer.__sn__name);
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected Alice\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__outer.__sn__age != 30LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: outer.age = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__outer.__sn__age));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 30\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Struct with string escape test: PASS\n");
+    
+}
+
+
+void __sn__test_conditional_struct_escape() {
+
+    __sn__Point __sn__result = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+
+    bool __sn__condition = true;
+
+    if (__sn__condition) {
+        __sn__Point __sn__p = (__sn__Point){ .__sn__x = 100LL, .__sn__y = 200LL };
+        (__sn__result = __sn__p);
+        
+    }
+
+    if ((__sn__result.__sn__x != 100LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: result.x = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 100\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__result.__sn__y != 200LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: result.y = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 200\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Conditional struct escape test: PASS\n");
+    
+}
+
+
+void __sn__test_struct_escape_with_defaults() {
+
+    sn_auto_Rectangle __sn__Rectangle __sn__outer = (__sn__Rectangle){ .__sn__width = 0LL, .__sn__height = 0LL, .__sn__label = strdup("rect") };
+
+    if (true) {
+        sn_auto_Rectangle __sn__Rectangle __sn__inner = (__sn__Rectangle){ .__sn__width = 50LL, .__sn__height = 75LL, .__sn__label = strdup("rect") };
+        ({
+            __sn__Rectangle __tmp__ = __sn__Rectangle_copy(&__sn__inner);
+            __sn__Rectangle_cleanup(&__sn__outer);
+            __sn__outer = __tmp__;
+            __sn__outer;
+        });
+        
+    }
+
+    if ((__sn__outer.__sn__width != 50LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: outer.width = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__outer.__sn__width));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 50\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__outer.__sn__height != 75LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: outer.height = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__outer.__sn__height));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 75\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((strcmp(__sn__outer.__sn__label, "rect") != 0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: outer.label = ");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__outer.__sn__label);
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected rect\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Struct escape with defaults test: PASS\n");
+    
+}
+
+
+void __sn__test_nested_if_struct_escape() {
+
+    __sn__Point __sn__outer = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+
+    if (true) {
+        if (true) {
+            __sn__Point __sn__deep = (__sn__Point){ .__sn__x = 111LL, .__sn__y = 222LL };
+            (__sn__outer = __sn__deep);
+            
+        }
+    }
+
+    if ((__sn__outer.__sn__x != 111LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: outer.x = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__outer.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 111\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__outer.__sn__y != 222LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: outer.y = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__outer.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 222\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Nested if struct escape test: PASS\n");
+    
+}
+
+
+void __sn__test_multiple_struct_escapes() {
+
+    __sn__Point __sn__result = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+
+    if (true) {
+        __sn__Point __sn__first = (__sn__Point){ .__sn__x = 10LL, .__sn__y = 20LL };
+        (__sn__result = __sn__first);
+        
+    }
+
+    if ((__sn__result.__sn__x != 10LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: result.x after first = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 10\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if (true) {
+        __sn__Point __sn__second = (__sn__Point){ .__sn__x = 30LL, .__sn__y = 40LL };
+        (__sn__result = __sn__second);
+        
+    }
+
+    if ((__sn__result.__sn__x != 30LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: result.x after second = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 30\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__result.__sn__y != 40LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: result.y after second = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 40\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Multiple struct escapes test: PASS\n");
+    
+}
+
+
+
+
+int main() {
+    sn_print("Testing struct escaping from if-block to outer scope:\n");
+    
+    __sn__test_simple_struct_escape();
+    
+    __sn__test_struct_with_string_escape();
+    
+    __sn__test_conditional_struct_escape();
+    
+    __sn__test_struct_escape_with_defaults();
+    
+    __sn__test_nested_if_struct_escape();
+    
+    __sn__test_multiple_struct_escapes();
+    
+    sn_print("All struct escape if-block tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
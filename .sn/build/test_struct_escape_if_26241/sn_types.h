@@ -0,0 +1,198 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Person (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__age;
+} __sn__Person;
+/* Value operations */
+static inline __sn__Person __sn__Person_copy(const __sn__Person *src) {
+    __sn__Person dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__age = src->__sn__age;
+    return dst;
+}
+
+static inline void __sn__Person_cleanup(__sn__Person *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Person __attribute__((cleanup(__sn__Person_cleanup)))
+
+static inline void __sn__Person_cleanup_elem(void *p) { __sn__Person_cleanup((__sn__Person *)p); }
+static inline void __sn__Person_copy_into(const void *src, void *dst) { *(__sn__Person *)dst = __sn__Person_copy((const __sn__Person *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Person *__sn__Person_alloc(void) {
+    return calloc(1, sizeof(__sn__Person));
+}
+
+static inline void __sn__Person_release(__sn__Person **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Person __attribute__((cleanup(__sn__Person_release)))
+
+static inline void __sn__Person_release_elem(void *p) { __sn__Person_release((__sn__Person **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Person_to_string(const __sn__Person *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Person { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "age: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__age);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Rectangle (as val) */
+typedef struct {
+    long long __sn__width;
+    long long __sn__height;
+    char * __sn__label;
+} __sn__Rectangle;
+/* Value operations */
+static inline __sn__Rectangle __sn__Rectangle_copy(const __sn__Rectangle *src) {
+    __sn__Rectangle dst;
+    dst.__sn__width = src->__sn__width;
+    dst.__sn__height = src->__sn__height;
+    dst.__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    return dst;
+}
+
+static inline void __sn__Rectangle_cleanup(__sn__Rectangle *p) {
+    free(p->__sn__label);
+
+}
+
+#define sn_auto_Rectangle __attribute__((cleanup(__sn__Rectangle_cleanup)))
+
+static inline void __sn__Rectangle_cleanup_elem(void *p) { __sn__Rectangle_cleanup((__sn__Rectangle *)p); }
+static inline void __sn__Rectangle_copy_into(const void *src, void *dst) { *(__sn__Rectangle *)dst = __sn__Rectangle_copy((const __sn__Rectangle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Rectangle *__sn__Rectangle_alloc(void) {
+    return calloc(1, sizeof(__sn__Rectangle));
+}
+
+static inline void __sn__Rectangle_release(__sn__Rectangle **p) {
+    if (*p) {
+        free((*p)->__sn__label);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Rectangle __attribute__((cleanup(__sn__Rectangle_release)))
+
+static inline void __sn__Rectangle_release_elem(void *p) { __sn__Rectangle_release((__sn__Rectangle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Rectangle_to_string(const __sn__Rectangle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Rectangle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "width: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__width);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "height: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__height);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__test_simple_struct_escape();
+void __sn__test_struct_with_string_escape();
+void __sn__test_conditional_struct_escape();
+void __sn__test_struct_escape_with_defaults();
+void __sn__test_nested_if_struct_escape();
+void __sn__test_multiple_struct_escapes();
+
+
+
+
+#endif
@@ -0,0 +1,258 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_struct_within_while_loop() {
+
+    long long __sn__sum_x = 0LL;
+
+    long long __sn__sum_y = 0LL;
+
+    long long __sn__i = 0LL;
+
+    while (sn_lt_long(__sn__i, 3LL)) {
+        __sn__Point __sn__p = (__sn__Point){ .__sn__x = sn_mul_long(__sn__i, 10LL), .__sn__y = sn_mul_long(__sn__i, 20LL) };
+        (__sn__sum_x = sn_add_long(__sn__sum_x, __sn__p.__sn__x));
+        
+        (__sn__sum_y = sn_add_long(__sn__sum_y, __sn__p.__sn__y));
+        
+        (__sn__i = sn_add_long(__sn__i, 1LL));
+        
+    }
+
+    if ((__sn__sum_x != 30LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: sum_x = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum_x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 30\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__sum_y != 60LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: sum_y = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum_y));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 60\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Struct within while loop test: PASS\n");
+    
+}
+
+
+void __sn__test_struct_within_for_loop() {
+
+    long long __sn__total = 0LL;
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            __sn__Point __sn__p = (__sn__Point){ .__sn__x = sn_add_long(__sn__i, 1LL), .__sn__y = sn_mul_long(sn_add_long(__sn__i, 1LL), 2LL) };
+            (__sn__total = sn_add_long(sn_add_long(__sn__total, __sn__p.__sn__x), __sn__p.__sn__y));
+            
+        }
+    }
+
+    if ((__sn__total != 45LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: total = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__total));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 45\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Struct within for loop test: PASS\n");
+    
+}
+
+
+void __sn__test_struct_with_string_in_loop() {
+
+    long long __sn__last_age = 0LL;
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 3LL); __sn__i++) {
+            sn_auto_Person __sn__Person __sn__person = (__sn__Person){ .__sn__name = strdup("Alice"), .__sn__age = sn_add_long(25LL, __sn__i) };
+            (__sn__last_age = __sn__person.__sn__age);
+            
+        }
+    }
+
+    if ((__sn__last_age != 27LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: last_age = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__last_age));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 27\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Struct with string in loop test: PASS\n");
+    
+}
+
+
+void __sn__test_struct_defaults_in_loop() {
+
+    long long __sn__sum_values = 0LL;
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 4LL); __sn__i++) {
+            sn_auto_Counter __sn__Counter __sn__c = (__sn__Counter){ .__sn__value = sn_mul_long(__sn__i, 100LL), .__sn__label = strdup("count") };
+            (__sn__sum_values = sn_add_long(__sn__sum_values, __sn__c.__sn__value));
+            
+        }
+    }
+
+    if ((__sn__sum_values != 600LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: sum_values = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum_values));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 600\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Struct defaults in loop test: PASS\n");
+    
+}
+
+
+void __sn__test_nested_loops_with_struct() {
+
+    long long __sn__accumulated = 0LL;
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 2LL); __sn__i++) {
+            {
+                for (long long __sn__j = 0LL; sn_lt_long(__sn__j, 3LL); __sn__j++) {
+                    __sn__Point __sn__p = (__sn__Point){ .__sn__x = sn_add_long(sn_mul_long(__sn__i, 10LL), __sn__j), .__sn__y = sn_add_long(sn_mul_long(__sn__i, 100LL), sn_mul_long(__sn__j, 10LL)) };
+                    (__sn__accumulated = sn_add_long(sn_add_long(__sn__accumulated, __sn__p.__sn__x), __sn__p.__sn__y));
+                    
+                }
+            }
+        }
+    }
+
+    if ((__sn__accumulated != 396LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: accumulated = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__accumulated));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 396\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Nested loops with struct test: PASS\n");
+    
+}
+
+
+void __sn__test_conditional_struct_in_loop() {
+
+    long long __sn__special_value = 0LL;
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 10LL); __sn__i++) {
+            if ((__sn__i == 7LL)) {
+                __sn__Point __sn__special = (__sn__Point){ .__sn__x = 777LL, .__sn__y = 888LL };
+                (__sn__special_value = sn_add_long(__sn__special.__sn__x, __sn__special.__sn__y));
+                
+            }
+        }
+    }
+
+    if ((__sn__special_value != 1665LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: special_value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__special_value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 1665\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Conditional struct in loop test: PASS\n");
+    
+}
+
+
+void __sn__test_struct_field_accumulation() {
+
+    long long __sn__max_x = 0LL;
+
+    long long __sn__max_y = 0LL;
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, 5LL); __sn__i++) {
+            __sn__Point __sn__p = (__sn__Point){ .__sn__x = sn_mul_long(__sn__i, 3LL), .__sn__y = sn_mul_long(__sn__i, 5LL) };
+            if (sn_gt_long(__sn__p.__sn__x, __sn__max_x)) {
+                (__sn__max_x = __sn__p.__sn__x);
+                
+            }
+            if (sn_gt_long(__sn__p.__sn__y, __sn__max_y)) {
+                (__sn__max_y = __sn__p.__sn__y);
+                
+            }
+        }
+    }
+
+    if ((__sn__max_x != 12LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: max_x = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__max_x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 12\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__max_y != 20LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: max_y = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__max_y));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 20\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Struct field accumulation test: PASS\n");
+    
+}
+
+
+
+
+int main() {
+    sn_print("Testing struct usage patterns in loops:\n");
+    
+    __sn__test_struct_within_while_loop();
+    
+    __sn__test_struct_within_for_loop();
+    
+    __sn__test_struct_with_string_in_loop();
+    
+    __sn__test_struct_defaults_in_loop();
+    
+    __sn__test_nested_loops_with_struct();
+    
+    __sn__test_conditional_struct_in_loop();
+    
+    __sn__test_struct_field_accumulation();
+    
+    sn_print("All struct loop tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
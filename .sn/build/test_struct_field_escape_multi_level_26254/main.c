@@ -0,0 +1,215 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_nested_to_nested_assignment() {
+
+    sn_auto_Tree __sn__Tree __sn__src = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 42LL, .__sn__id = 0LL }, .__sn__weight = 1LL }, .__sn__name = strdup("tree") };
+
+    sn_auto_Tree __sn__Tree __sn__dst = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 0LL, .__sn__id = 0LL }, .__sn__weight = 1LL }, .__sn__name = strdup("tree") };
+
+    (__sn__dst.__sn__branch.__sn__leaf.__sn__value = __sn__src.__sn__branch.__sn__leaf.__sn__value);
+    
+
+    if ((__sn__dst.__sn__branch.__sn__leaf.__sn__value != 42LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: dst.branch.leaf.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__dst.__sn__branch.__sn__leaf.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 42\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Nested to nested assignment test: PASS\n");
+    
+}
+
+
+void __sn__test_deep_nested_cross_assign() {
+
+    sn_auto_Forest __sn__Forest __sn__f1 = (__sn__Forest){ .__sn__tree = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 100LL, .__sn__id = 1LL }, .__sn__weight = 1LL }, .__sn__name = strdup("tree") }, .__sn__size = 0LL };
+
+    sn_auto_Forest __sn__Forest __sn__f2 = (__sn__Forest){ .__sn__tree = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 0LL, .__sn__id = 0LL }, .__sn__weight = 1LL }, .__sn__name = strdup("tree") }, .__sn__size = 0LL };
+
+    (__sn__f2.__sn__tree.__sn__branch.__sn__leaf.__sn__value = __sn__f1.__sn__tree.__sn__branch.__sn__leaf.__sn__value);
+    
+
+    (__sn__f2.__sn__tree.__sn__branch.__sn__leaf.__sn__id = __sn__f1.__sn__tree.__sn__branch.__sn__leaf.__sn__id);
+    
+
+    if ((__sn__f2.__sn__tree.__sn__branch.__sn__leaf.__sn__value != 100LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: f2.tree.branch.leaf.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__f2.__sn__tree.__sn__branch.__sn__leaf.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 100\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__f2.__sn__tree.__sn__branch.__sn__leaf.__sn__id != 1LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: f2.tree.branch.leaf.id = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__f2.__sn__tree.__sn__branch.__sn__leaf.__sn__id));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 1\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Deep nested cross assign test: PASS\n");
+    
+}
+
+
+void __sn__test_partial_chain_copy() {
+
+    sn_auto_Forest __sn__Forest __sn__src = (__sn__Forest){ .__sn__tree = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 55LL, .__sn__id = 0LL }, .__sn__weight = 1LL }, .__sn__name = strdup("tree") }, .__sn__size = 0LL };
+
+    sn_auto_Tree __sn__Tree __sn__dst_tree = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 0LL, .__sn__id = 0LL }, .__sn__weight = 1LL }, .__sn__name = strdup("tree") };
+
+    (__sn__dst_tree.__sn__branch.__sn__leaf.__sn__value = __sn__src.__sn__tree.__sn__branch.__sn__leaf.__sn__value);
+    
+
+    if ((__sn__dst_tree.__sn__branch.__sn__leaf.__sn__value != 55LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: dst_tree.branch.leaf.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__dst_tree.__sn__branch.__sn__leaf.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 55\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Partial chain copy test: PASS\n");
+    
+}
+
+
+void __sn__test_intermediate_field_access() {
+
+    sn_auto_Tree __sn__Tree __sn__t1 = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 10LL, .__sn__id = 0LL }, .__sn__weight = 5LL }, .__sn__name = strdup("tree") };
+
+    sn_auto_Tree __sn__Tree __sn__t2 = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 0LL, .__sn__id = 0LL }, .__sn__weight = 0LL }, .__sn__name = strdup("tree") };
+
+    (__sn__t2.__sn__branch.__sn__weight = __sn__t1.__sn__branch.__sn__weight);
+    
+
+    if ((__sn__t2.__sn__branch.__sn__weight != 5LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: t2.branch.weight = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__t2.__sn__branch.__sn__weight));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 5\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Intermediate field access test: PASS\n");
+    
+}
+
+
+void __sn__test_mixed_depth_assignments() {
+
+    sn_auto_Forest __sn__Forest __sn__forest = (__sn__Forest){ .__sn__tree = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 0LL, .__sn__id = 0LL }, .__sn__weight = 1LL }, .__sn__name = strdup("tree") }, .__sn__size = 0LL };
+
+    long long __sn__shallow_val = 111LL;
+
+    sn_auto_Tree __sn__Tree __sn__deep_src = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 222LL, .__sn__id = 0LL }, .__sn__weight = 1LL }, .__sn__name = strdup("tree") };
+
+    (__sn__forest.__sn__tree.__sn__branch.__sn__leaf.__sn__value = __sn__shallow_val);
+    
+
+    if ((__sn__forest.__sn__tree.__sn__branch.__sn__leaf.__sn__value != 111LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: forest.tree.branch.leaf.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__forest.__sn__tree.__sn__branch.__sn__leaf.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 111\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    (__sn__forest.__sn__tree.__sn__branch.__sn__leaf.__sn__value = __sn__deep_src.__sn__branch.__sn__leaf.__sn__value);
+    
+
+    if ((__sn__forest.__sn__tree.__sn__branch.__sn__leaf.__sn__value != 222LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: forest.tree.branch.leaf.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__forest.__sn__tree.__sn__branch.__sn__leaf.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 222\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Mixed depth assignments test: PASS\n");
+    
+}
+
+
+void __sn__test_chain_swap() {
+
+    sn_auto_Tree __sn__Tree __sn__t1 = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 1LL, .__sn__id = 0LL }, .__sn__weight = 1LL }, .__sn__name = strdup("tree") };
+
+    sn_auto_Tree __sn__Tree __sn__t2 = (__sn__Tree){ .__sn__branch = (__sn__Branch){ .__sn__leaf = (__sn__Leaf){ .__sn__value = 2LL, .__sn__id = 0LL }, .__sn__weight = 1LL }, .__sn__name = strdup("tree") };
+
+    long long __sn__temp = __sn__t1.__sn__branch.__sn__leaf.__sn__value;
+
+    (__sn__t1.__sn__branch.__sn__leaf.__sn__value = __sn__t2.__sn__branch.__sn__leaf.__sn__value);
+    
+
+    (__sn__t2.__sn__branch.__sn__leaf.__sn__value = __sn__temp);
+    
+
+    if ((__sn__t1.__sn__branch.__sn__leaf.__sn__value != 2LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: t1.branch.leaf.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__t1.__sn__branch.__sn__leaf.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 2\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__t2.__sn__branch.__sn__leaf.__sn__value != 1LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: t2.branch.leaf.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__t2.__sn__branch.__sn__leaf.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 1\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Chain swap test: PASS\n");
+    
+}
+
+
+
+
+
+int main() {
+    sn_print("Testing multi-level nested field escape detection:\n");
+    
+    __sn__test_nested_to_nested_assignment();
+    
+    __sn__test_deep_nested_cross_assign();
+    
+    __sn__test_partial_chain_copy();
+    
+    __sn__test_intermediate_field_access();
+    
+    __sn__test_mixed_depth_assignments();
+    
+    __sn__test_chain_swap();
+    
+    sn_print("All multi-level nesting tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,246 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Leaf (as val) */
+typedef struct {
+    long long __sn__value;
+    long long __sn__id;
+} __sn__Leaf;
+/* Value operations */
+static inline __sn__Leaf __sn__Leaf_copy(const __sn__Leaf *src) {
+    __sn__Leaf dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__id = src->__sn__id;
+    return dst;
+}
+
+static inline void __sn__Leaf_cleanup(__sn__Leaf *p) {
+
+}
+
+#define sn_auto_Leaf __attribute__((cleanup(__sn__Leaf_cleanup)))
+
+static inline void __sn__Leaf_cleanup_elem(void *p) { __sn__Leaf_cleanup((__sn__Leaf *)p); }
+static inline void __sn__Leaf_copy_into(const void *src, void *dst) { *(__sn__Leaf *)dst = __sn__Leaf_copy((const __sn__Leaf *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Leaf *__sn__Leaf_alloc(void) {
+    return calloc(1, sizeof(__sn__Leaf));
+}
+
+static inline void __sn__Leaf_release(__sn__Leaf **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Leaf __attribute__((cleanup(__sn__Leaf_release)))
+
+static inline void __sn__Leaf_release_elem(void *p) { __sn__Leaf_release((__sn__Leaf **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Leaf_to_string(const __sn__Leaf *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Leaf { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__id);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Branch (as val) */
+typedef struct {
+    __sn__Leaf __sn__leaf;
+    long long __sn__weight;
+} __sn__Branch;
+/* Value operations */
+static inline __sn__Branch __sn__Branch_copy(const __sn__Branch *src) {
+    __sn__Branch dst;
+    dst.__sn__leaf = __sn__Leaf_copy(&src->__sn__leaf);
+    dst.__sn__weight = src->__sn__weight;
+    return dst;
+}
+
+static inline void __sn__Branch_cleanup(__sn__Branch *p) {
+
+}
+
+#define sn_auto_Branch __attribute__((cleanup(__sn__Branch_cleanup)))
+
+static inline void __sn__Branch_cleanup_elem(void *p) { __sn__Branch_cleanup((__sn__Branch *)p); }
+static inline void __sn__Branch_copy_into(const void *src, void *dst) { *(__sn__Branch *)dst = __sn__Branch_copy((const __sn__Branch *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Branch *__sn__Branch_alloc(void) {
+    return calloc(1, sizeof(__sn__Branch));
+}
+
+static inline void __sn__Branch_release(__sn__Branch **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Branch __attribute__((cleanup(__sn__Branch_release)))
+
+static inline void __sn__Branch_release_elem(void *p) { __sn__Branch_release((__sn__Branch **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Branch_to_string(const __sn__Branch *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Branch { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "leaf: ");
+    { char *__fs__ = __sn__Leaf_to_string(&p->__sn__leaf); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "weight: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__weight);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Tree (as val) */
+typedef struct {
+    __sn__Branch __sn__branch;
+    char * __sn__name;
+} __sn__Tree;
+/* Value operations */
+static inline __sn__Tree __sn__Tree_copy(const __sn__Tree *src) {
+    __sn__Tree dst;
+    dst.__sn__branch = __sn__Branch_copy(&src->__sn__branch);
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__Tree_cleanup(__sn__Tree *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Tree __attribute__((cleanup(__sn__Tree_cleanup)))
+
+static inline void __sn__Tree_cleanup_elem(void *p) { __sn__Tree_cleanup((__sn__Tree *)p); }
+static inline void __sn__Tree_copy_into(const void *src, void *dst) { *(__sn__Tree *)dst = __sn__Tree_copy((const __sn__Tree *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Tree *__sn__Tree_alloc(void) {
+    return calloc(1, sizeof(__sn__Tree));
+}
+
+static inline void __sn__Tree_release(__sn__Tree **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Tree __attribute__((cleanup(__sn__Tree_release)))
+
+static inline void __sn__Tree_release_elem(void *p) { __sn__Tree_release((__sn__Tree **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Tree_to_string(const __sn__Tree *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Tree { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "branch: ");
+    { char *__fs__ = __sn__Branch_to_string(&p->__sn__branch); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Forest (as val) */
+typedef struct {
+    __sn__Tree __sn__tree;
+    long long __sn__size;
+} __sn__Forest;
+/* Value operations */
+static inline __sn__Forest __sn__Forest_copy(const __sn__Forest *src) {
+    __sn__Forest dst;
+    dst.__sn__tree = __sn__Tree_copy(&src->__sn__tree);
+    dst.__sn__size = src->__sn__size;
+    return dst;
+}
+
+static inline void __sn__Forest_cleanup(__sn__Forest *p) {
+    __sn__Tree_cleanup(&p->__sn__tree);
+
+}
+
+#define sn_auto_Forest __attribute__((cleanup(__sn__Forest_cleanup)))
+
+static inline void __sn__Forest_cleanup_elem(void *p) { __sn__Forest_cleanup((__sn__Forest *)p); }
+static inline void __sn__Forest_copy_into(const void *src, void *dst) { *(__sn__Forest *)dst = __sn__Forest_copy((const __sn__Forest *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Forest *__sn__Forest_alloc(void) {
+    return calloc(1, sizeof(__sn__Forest));
+}
+
+static inline void __sn__Forest_release(__sn__Forest **p) {
+    if (*p) {
+        __sn__Tree_cleanup(&(*p)->__sn__tree);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Forest __attribute__((cleanup(__sn__Forest_release)))
+
+static inline void __sn__Forest_release_elem(void *p) { __sn__Forest_release((__sn__Forest **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Forest_to_string(const __sn__Forest *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Forest { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tree: ");
+    { char *__fs__ = __sn__Tree_to_string(&p->__sn__tree); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "size: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__size);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__test_nested_to_nested_assignment();
+void __sn__test_deep_nested_cross_assign();
+void __sn__test_partial_chain_copy();
+void __sn__test_intermediate_field_access();
+void __sn__test_mixed_depth_assignments();
+void __sn__test_chain_swap();
+
+
+
+
+#endif
@@ -0,0 +1,191 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_two_level_nested_escape() {
+
+    sn_auto_Middle __sn__Middle __sn__wrapper = (__sn__Middle){ .__sn__inner = (__sn__Inner){ .__sn__value = 0LL, .__sn__factor = 1LL }, .__sn__name = strdup("middle") };
+
+    long long __sn__local_val = 123LL;
+
+    (__sn__wrapper.__sn__inner.__sn__value = __sn__local_val);
+    
+
+    if ((__sn__wrapper.__sn__inner.__sn__value != 123LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: wrapper.inner.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__wrapper.__sn__inner.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 123\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Two-level nested escape test: PASS\n");
+    
+}
+
+
+void __sn__test_three_level_nested_escape() {
+
+    sn_auto_Outer __sn__Outer __sn__root = (__sn__Outer){ .__sn__middle = (__sn__Middle){ .__sn__inner = (__sn__Inner){ .__sn__value = 0LL, .__sn__factor = 1LL }, .__sn__name = strdup("middle") }, .__sn__id = 0LL };
+
+    long long __sn__data = 456LL;
+
+    (__sn__root.__sn__middle.__sn__inner.__sn__value = __sn__data);
+    
+
+    if ((__sn__root.__sn__middle.__sn__inner.__sn__value != 456LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: root.middle.inner.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__root.__sn__middle.__sn__inner.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 456\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Three-level nested escape test: PASS\n");
+    
+}
+
+
+void __sn__test_four_level_nested_escape() {
+
+    sn_auto_Deep __sn__Deep __sn__deep = (__sn__Deep){ .__sn__outer = (__sn__Outer){ .__sn__middle = (__sn__Middle){ .__sn__inner = (__sn__Inner){ .__sn__value = 0LL, .__sn__factor = 1LL }, .__sn__name = strdup("middle") }, .__sn__id = 0LL }, .__sn__label = strdup("deep") };
+
+    long long __sn__deep_val = 789LL;
+
+    (__sn__deep.__sn__outer.__sn__middle.__sn__inner.__sn__value = __sn__deep_val);
+    
+
+    if ((__sn__deep.__sn__outer.__sn__middle.__sn__inner.__sn__value != 789LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: deep.outer.middle.inner.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__deep.__sn__outer.__sn__middle.__sn__inner.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 789\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Four-level nested escape test: PASS\n");
+    
+}
+
+
+void __sn__test_nested_with_defaults() {
+
+    sn_auto_Outer __sn__Outer __sn__o = (__sn__Outer){ .__sn__middle = (__sn__Middle){ .__sn__inner = (__sn__Inner){ .__sn__value = 100LL, .__sn__factor = 1LL }, .__sn__name = strdup("middle") }, .__sn__id = 0LL };
+
+    if ((strcmp(__sn__o.__sn__middle.__sn__name, "middle") != 0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: o.middle.name = ");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__o.__sn__middle.__sn__name);
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 'middle'\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__o.__sn__middle.__sn__inner.__sn__factor != 1LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: o.middle.inner.factor = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__o.__sn__middle.__sn__inner.__sn__factor));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 1\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__o.__sn__id != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: o.id = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__o.__sn__id));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 0\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    long long __sn__new_factor = 10LL;
+
+    (__sn__o.__sn__middle.__sn__inner.__sn__factor = __sn__new_factor);
+    
+
+    if ((__sn__o.__sn__middle.__sn__inner.__sn__factor != 10LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: o.middle.inner.factor = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__o.__sn__middle.__sn__inner.__sn__factor));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 10\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Nested with defaults test: PASS\n");
+    
+}
+
+
+void __sn__test_multiple_nested_escapes() {
+
+    sn_auto_Outer __sn__Outer __sn__root = (__sn__Outer){ .__sn__middle = (__sn__Middle){ .__sn__inner = (__sn__Inner){ .__sn__value = 0LL, .__sn__factor = 1LL }, .__sn__name = strdup("middle") }, .__sn__id = 0LL };
+
+    long long __sn__v1 = 11LL;
+
+    long long __sn__v2 = 22LL;
+
+    (__sn__root.__sn__middle.__sn__inner.__sn__value = __sn__v1);
+    
+
+    (__sn__root.__sn__id = __sn__v2);
+    
+
+    if ((__sn__root.__sn__middle.__sn__inner.__sn__value != 11LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: root.middle.inner.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__root.__sn__middle.__sn__inner.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 11\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__root.__sn__id != 22LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: root.id = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__root.__sn__id));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 22\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Multiple nested escapes test: PASS\n");
+    
+}
+
+
+
+
+
+int main() {
+    sn_print("Testing nested field assignment escape detection:\n");
+    
+    __sn__test_two_level_nested_escape();
+    
+    __sn__test_three_level_nested_escape();
+    
+    __sn__test_four_level_nested_escape();
+    
+    __sn__test_nested_with_defaults();
+    
+    __sn__test_multiple_nested_escapes();
+    
+    sn_print("All nested field escape tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,249 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Inner (as val) */
+typedef struct {
+    long long __sn__value;
+    long long __sn__factor;
+} __sn__Inner;
+/* Value operations */
+static inline __sn__Inner __sn__Inner_copy(const __sn__Inner *src) {
+    __sn__Inner dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__factor = src->__sn__factor;
+    return dst;
+}
+
+static inline void __sn__Inner_cleanup(__sn__Inner *p) {
+
+}
+
+#define sn_auto_Inner __attribute__((cleanup(__sn__Inner_cleanup)))
+
+static inline void __sn__Inner_cleanup_elem(void *p) { __sn__Inner_cleanup((__sn__Inner *)p); }
+static inline void __sn__Inner_copy_into(const void *src, void *dst) { *(__sn__Inner *)dst = __sn__Inner_copy((const __sn__Inner *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Inner *__sn__Inner_alloc(void) {
+    return calloc(1, sizeof(__sn__Inner));
+}
+
+static inline void __sn__Inner_release(__sn__Inner **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Inner __attribute__((cleanup(__sn__Inner_release)))
+
+static inline void __sn__Inner_release_elem(void *p) { __sn__Inner_release((__sn__Inner **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Inner_to_string(const __sn__Inner *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Inner { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "factor: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__factor);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Middle (as val) */
+typedef struct {
+    __sn__Inner __sn__inner;
+    char * __sn__name;
+} __sn__Middle;
+/* Value operations */
+static inline __sn__Middle __sn__Middle_copy(const __sn__Middle *src) {
+    __sn__Middle dst;
+    dst.__sn__inner = __sn__Inner_copy(&src->__sn__inner);
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__Middle_cleanup(__sn__Middle *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Middle __attribute__((cleanup(__sn__Middle_cleanup)))
+
+static inline void __sn__Middle_cleanup_elem(void *p) { __sn__Middle_cleanup((__sn__Middle *)p); }
+static inline void __sn__Middle_copy_into(const void *src, void *dst) { *(__sn__Middle *)dst = __sn__Middle_copy((const __sn__Middle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Middle *__sn__Middle_alloc(void) {
+    return calloc(1, sizeof(__sn__Middle));
+}
+
+static inline void __sn__Middle_release(__sn__Middle **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Middle __attribute__((cleanup(__sn__Middle_release)))
+
+static inline void __sn__Middle_release_elem(void *p) { __sn__Middle_release((__sn__Middle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Middle_to_string(const __sn__Middle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Middle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "inner: ");
+    { char *__fs__ = __sn__Inner_to_string(&p->__sn__inner); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Outer (as val) */
+typedef struct {
+    __sn__Middle __sn__middle;
+    long long __sn__id;
+} __sn__Outer;
+/* Value operations */
+static inline __sn__Outer __sn__Outer_copy(const __sn__Outer *src) {
+    __sn__Outer dst;
+    dst.__sn__middle = __sn__Middle_copy(&src->__sn__middle);
+    dst.__sn__id = src->__sn__id;
+    return dst;
+}
+
+static inline void __sn__Outer_cleanup(__sn__Outer *p) {
+    __sn__Middle_cleanup(&p->__sn__middle);
+
+}
+
+#define sn_auto_Outer __attribute__((cleanup(__sn__Outer_cleanup)))
+
+static inline void __sn__Outer_cleanup_elem(void *p) { __sn__Outer_cleanup((__sn__Outer *)p); }
+static inline void __sn__Outer_copy_into(const void *src, void *dst) { *(__sn__Outer *)dst = __sn__Outer_copy((const __sn__Outer *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Outer *__sn__Outer_alloc(void) {
+    return calloc(1, sizeof(__sn__Outer));
+}
+
+static inline void __sn__Outer_release(__sn__Outer **p) {
+    if (*p) {
+        __sn__Middle_cleanup(&(*p)->__sn__middle);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Outer __attribute__((cleanup(__sn__Outer_release)))
+
+static inline void __sn__Outer_release_elem(void *p) { __sn__Outer_release((__sn__Outer **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Outer_to_string(const __sn__Outer *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Outer { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "middle: ");
+    { char *__fs__ = __sn__Middle_to_string(&p->__sn__middle); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__id);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Deep (as val) */
+typedef struct {
+    __sn__Outer __sn__outer;
+    char * __sn__label;
+} __sn__Deep;
+/* Value operations */
+static inline __sn__Deep __sn__Deep_copy(const __sn__Deep *src) {
+    __sn__Deep dst;
+    dst.__sn__outer = __sn__Outer_copy(&src->__sn__outer);
+    dst.__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    return dst;
+}
+
+static inline void __sn__Deep_cleanup(__sn__Deep *p) {
+    __sn__Outer_cleanup(&p->__sn__outer);
+    free(p->__sn__label);
+
+}
+
+#define sn_auto_Deep __attribute__((cleanup(__sn__Deep_cleanup)))
+
+static inline void __sn__Deep_cleanup_elem(void *p) { __sn__Deep_cleanup((__sn__Deep *)p); }
+static inline void __sn__Deep_copy_into(const void *src, void *dst) { *(__sn__Deep *)dst = __sn__Deep_copy((const __sn__Deep *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Deep *__sn__Deep_alloc(void) {
+    return calloc(1, sizeof(__sn__Deep));
+}
+
+static inline void __sn__Deep_release(__sn__Deep **p) {
+    if (*p) {
+        __sn__Outer_cleanup(&(*p)->__sn__outer);
+        free((*p)->__sn__label);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Deep __attribute__((cleanup(__sn__Deep_release)))
+
+static inline void __sn__Deep_release_elem(void *p) { __sn__Deep_release((__sn__Deep **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Deep_to_string(const __sn__Deep *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Deep { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "outer: ");
+    { char *__fs__ = __sn__Outer_to_string(&p->__sn__outer); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__test_two_level_nested_escape();
+void __sn__test_three_level_nested_escape();
+void __sn__test_four_level_nested_escape();
+void __sn__test_nested_with_defaults();
+void __sn__test_multiple_nested_escapes();
+
+
+
+
+#endif
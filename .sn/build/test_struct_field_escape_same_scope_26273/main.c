@@ -0,0 +1,211 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_same_scope_simple() {
+
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+
+    long long __sn__new_x = 10LL;
+
+    long long __sn__new_y = 20LL;
+
+    (__sn__p.__sn__x = __sn__new_x);
+    
+
+    (__sn__p.__sn__y = __sn__new_y);
+    
+
+    if ((__sn__p.__sn__x != 10LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: p.x = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 10\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__p.__sn__y != 20LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: p.y = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 20\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Same scope simple test: PASS\n");
+    
+}
+
+
+void __sn__test_same_scope_with_computation() {
+
+    __sn__Rectangle __sn__rect = (__sn__Rectangle){ .__sn__width = 5LL, .__sn__height = 10LL, .__sn__area = 0LL };
+
+    long long __sn__w = __sn__rect.__sn__width;
+
+    long long __sn__h = __sn__rect.__sn__height;
+
+    (__sn__rect.__sn__area = sn_mul_long(__sn__w, __sn__h));
+    
+
+    if ((__sn__rect.__sn__area != 50LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: rect.area = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__rect.__sn__area));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 50\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Same scope with computation test: PASS\n");
+    
+}
+
+
+void __sn__test_same_scope_struct_field_copy() {
+
+    __sn__Point __sn__p1 = (__sn__Point){ .__sn__x = 100LL, .__sn__y = 200LL };
+
+    __sn__Point __sn__p2 = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+
+    (__sn__p2.__sn__x = __sn__p1.__sn__x);
+    
+
+    (__sn__p2.__sn__y = __sn__p1.__sn__y);
+    
+
+    if ((__sn__p2.__sn__x != 100LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: p2.x = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p2.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 100\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__p2.__sn__y != 200LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: p2.y = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p2.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 200\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Same scope struct field copy test: PASS\n");
+    
+}
+
+
+void __sn__test_same_scope_nested() {
+
+    __sn__Pair __sn__pair = (__sn__Pair){ .__sn__first = (__sn__Point){ .__sn__x = 1LL, .__sn__y = 2LL }, .__sn__second = (__sn__Point){ .__sn__x = 3LL, .__sn__y = 4LL } };
+
+    long long __sn__temp = __sn__pair.__sn__first.__sn__x;
+
+    (__sn__pair.__sn__second.__sn__x = __sn__temp);
+    
+
+    if ((__sn__pair.__sn__second.__sn__x != 1LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: pair.second.x = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__pair.__sn__second.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 1\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Same scope nested test: PASS\n");
+    
+}
+
+
+void __sn__test_same_scope_multiple_assigns() {
+
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+
+    long long __sn__a = 1LL;
+
+    long long __sn__b = 2LL;
+
+    long long __sn__c = 3LL;
+
+    (__sn__p.__sn__x = __sn__a);
+    
+
+    (__sn__p.__sn__x = __sn__b);
+    
+
+    (__sn__p.__sn__x = __sn__c);
+    
+
+    if ((__sn__p.__sn__x != 3LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: p.x = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 3\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Same scope multiple assigns test: PASS\n");
+    
+}
+
+
+void __sn__test_same_scope_self_assign() {
+
+    __sn__Rectangle __sn__rect = (__sn__Rectangle){ .__sn__width = 8LL, .__sn__height = 4LL, .__sn__area = 0LL };
+
+    long long __sn__current = __sn__rect.__sn__width;
+
+    (__sn__rect.__sn__width = __sn__current);
+    
+
+    if ((__sn__rect.__sn__width != 8LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: rect.width = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__rect.__sn__width));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 8\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Same scope self assign test: PASS\n");
+    
+}
+
+
+
+
+int main() {
+    sn_print("Testing same-scope field assignments (no escape):\n");
+    
+    __sn__test_same_scope_simple();
+    
+    __sn__test_same_scope_with_computation();
+    
+    __sn__test_same_scope_struct_field_copy();
+    
+    __sn__test_same_scope_nested();
+    
+    __sn__test_same_scope_multiple_assigns();
+    
+    __sn__test_same_scope_self_assign();
+    
+    sn_print("All same-scope field assignment tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
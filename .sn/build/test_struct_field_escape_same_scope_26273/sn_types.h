@@ -0,0 +1,194 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Rectangle (as val) */
+typedef struct {
+    long long __sn__width;
+    long long __sn__height;
+    long long __sn__area;
+} __sn__Rectangle;
+/* Value operations */
+static inline __sn__Rectangle __sn__Rectangle_copy(const __sn__Rectangle *src) {
+    __sn__Rectangle dst;
+    dst.__sn__width = src->__sn__width;
+    dst.__sn__height = src->__sn__height;
+    dst.__sn__area = src->__sn__area;
+    return dst;
+}
+
+static inline void __sn__Rectangle_cleanup(__sn__Rectangle *p) {
+
+}
+
+#define sn_auto_Rectangle __attribute__((cleanup(__sn__Rectangle_cleanup)))
+
+static inline void __sn__Rectangle_cleanup_elem(void *p) { __sn__Rectangle_cleanup((__sn__Rectangle *)p); }
+static inline void __sn__Rectangle_copy_into(const void *src, void *dst) { *(__sn__Rectangle *)dst = __sn__Rectangle_copy((const __sn__Rectangle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Rectangle *__sn__Rectangle_alloc(void) {
+    return calloc(1, sizeof(__sn__Rectangle));
+}
+
+static inline void __sn__Rectangle_release(__sn__Rectangle **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Rectangle __attribute__((cleanup(__sn__Rectangle_release)))
+
+static inline void __sn__Rectangle_release_elem(void *p) { __sn__Rectangle_release((__sn__Rectangle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Rectangle_to_string(const __sn__Rectangle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Rectangle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "width: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__width);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "height: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__height);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "area: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__area);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Pair (as val) */
+typedef struct {
+    __sn__Point __sn__first;
+    __sn__Point __sn__second;
+} __sn__Pair;
+/* Value operations */
+static inline __sn__Pair __sn__Pair_copy(const __sn__Pair *src) {
+    __sn__Pair dst;
+    dst.__sn__first = __sn__Point_copy(&src->__sn__first);
+    dst.__sn__second = __sn__Point_copy(&src->__sn__second);
+    return dst;
+}
+
+static inline void __sn__Pair_cleanup(__sn__Pair *p) {
+
+}
+
+#define sn_auto_Pair __attribute__((cleanup(__sn__Pair_cleanup)))
+
+static inline void __sn__Pair_cleanup_elem(void *p) { __sn__Pair_cleanup((__sn__Pair *)p); }
+static inline void __sn__Pair_copy_into(const void *src, void *dst) { *(__sn__Pair *)dst = __sn__Pair_copy((const __sn__Pair *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Pair *__sn__Pair_alloc(void) {
+    return calloc(1, sizeof(__sn__Pair));
+}
+
+static inline void __sn__Pair_release(__sn__Pair **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Pair __attribute__((cleanup(__sn__Pair_release)))
+
+static inline void __sn__Pair_release_elem(void *p) { __sn__Pair_release((__sn__Pair **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Pair_to_string(const __sn__Pair *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Pair { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "first: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__first); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "second: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__second); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__test_same_scope_simple();
+void __sn__test_same_scope_with_computation();
+void __sn__test_same_scope_struct_field_copy();
+void __sn__test_same_scope_nested();
+void __sn__test_same_scope_multiple_assigns();
+void __sn__test_same_scope_self_assign();
+
+
+
+
+#endif
@@ -0,0 +1,140 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_simple_escape() {
+
+    sn_auto_Container __sn__Container __sn__outer = (__sn__Container){ .__sn__value = 0LL, .__sn__name = strdup("default") };
+
+    long long __sn__inner_value = 42LL;
+
+    (__sn__outer.__sn__value = __sn__inner_value);
+    
+
+    if ((__sn__outer.__sn__value != 42LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: outer.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__outer.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 42\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Simple escape test: PASS\n");
+    
+}
+
+
+void __sn__test_escape_with_defaults() {
+
+    __sn__Holder __sn__holder = (__sn__Holder){ .__sn__data = 100LL, .__sn__flag = false };
+
+    if ((__sn__holder.__sn__flag != false)) {
+        sn_print("FAIL: holder.flag should be false by default\n");
+        
+        return;}
+
+    long long __sn__new_val = 999LL;
+
+    (__sn__holder.__sn__data = __sn__new_val);
+    
+
+    if ((__sn__holder.__sn__data != 999LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: holder.data = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__holder.__sn__data));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 999\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Escape with defaults test: PASS\n");
+    
+}
+
+
+void __sn__test_multiple_field_escapes() {
+
+    sn_auto_Container __sn__Container __sn__c = (__sn__Container){ .__sn__value = 0LL, .__sn__name = strdup("default") };
+
+    long long __sn__v1 = 10LL;
+
+    long long __sn__v2 = 20LL;
+
+    (__sn__c.__sn__value = __sn__v1);
+    
+
+    if ((__sn__c.__sn__value != 10LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: c.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 10\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    (__sn__c.__sn__value = __sn__v2);
+    
+
+    if ((__sn__c.__sn__value != 20LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: c.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 20\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Multiple field escapes test: PASS\n");
+    
+}
+
+
+void __sn__test_escape_with_computation() {
+
+    sn_auto_Container __sn__Container __sn__container = (__sn__Container){ .__sn__value = 0LL, .__sn__name = strdup("default") };
+
+    long long __sn__a = 5LL;
+
+    long long __sn__b = 7LL;
+
+    (__sn__container.__sn__value = sn_mul_long(__sn__a, __sn__b));
+    
+
+    if ((__sn__container.__sn__value != 35LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: container.value = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__container.__sn__value));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 35\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Escape with computation test: PASS\n");
+    
+}
+
+
+
+int main() {
+    sn_print("Testing simple field assignment escape detection:\n");
+    
+    __sn__test_simple_escape();
+    
+    __sn__test_escape_with_defaults();
+    
+    __sn__test_multiple_field_escapes();
+    
+    __sn__test_escape_with_computation();
+    
+    sn_print("All simple field escape tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,136 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Container (as val) */
+typedef struct {
+    long long __sn__value;
+    char * __sn__name;
+} __sn__Container;
+/* Value operations */
+static inline __sn__Container __sn__Container_copy(const __sn__Container *src) {
+    __sn__Container dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__Container_cleanup(__sn__Container *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Container __attribute__((cleanup(__sn__Container_cleanup)))
+
+static inline void __sn__Container_cleanup_elem(void *p) { __sn__Container_cleanup((__sn__Container *)p); }
+static inline void __sn__Container_copy_into(const void *src, void *dst) { *(__sn__Container *)dst = __sn__Container_copy((const __sn__Container *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Container *__sn__Container_alloc(void) {
+    return calloc(1, sizeof(__sn__Container));
+}
+
+static inline void __sn__Container_release(__sn__Container **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Container __attribute__((cleanup(__sn__Container_release)))
+
+static inline void __sn__Container_release_elem(void *p) { __sn__Container_release((__sn__Container **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Container_to_string(const __sn__Container *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Container { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Holder (as val) */
+typedef struct {
+    long long __sn__data;
+    bool __sn__flag;
+} __sn__Holder;
+/* Value operations */
+static inline __sn__Holder __sn__Holder_copy(const __sn__Holder *src) {
+    __sn__Holder dst;
+    dst.__sn__data = src->__sn__data;
+    dst.__sn__flag = src->__sn__flag;
+    return dst;
+}
+
+static inline void __sn__Holder_cleanup(__sn__Holder *p) {
+
+}
+
+#define sn_auto_Holder __attribute__((cleanup(__sn__Holder_cleanup)))
+
+static inline void __sn__Holder_cleanup_elem(void *p) { __sn__Holder_cleanup((__sn__Holder *)p); }
+static inline void __sn__Holder_copy_into(const void *src, void *dst) { *(__sn__Holder *)dst = __sn__Holder_copy((const __sn__Holder *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Holder *__sn__Holder_alloc(void) {
+    return calloc(1, sizeof(__sn__Holder));
+}
+
+static inline void __sn__Holder_release(__sn__Holder **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Holder __attribute__((cleanup(__sn__Holder_release)))
+
+static inline void __sn__Holder_release_elem(void *p) { __sn__Holder_release((__sn__Holder **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Holder_to_string(const __sn__Holder *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Holder { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "data: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__data);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "flag: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__flag ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__test_simple_escape();
+void __sn__test_escape_with_defaults();
+void __sn__test_multiple_field_escapes();
+void __sn__test_escape_with_computation();
+
+
+
+
+#endif
@@ -0,0 +1,60 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__RateLimiter_record(__sn__RateLimiter *__sn__self, long long __sn__ts) {
+
+    __sn__arr_push(&__sn__self->__sn__timestamps, __sn__ts);
+    
+}
+
+void __sn__RateLimiter_evict(__sn__RateLimiter *__sn__self, long long __sn__cutoff) {
+
+    while ((sn_gt_long(sn_array_length(__sn__self->__sn__timestamps), 0LL) && sn_lt_long((((long long *)__sn__self->__sn__timestamps->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__self->__sn__timestamps->len : __ai__; })]), __sn__cutoff))) {
+        ({
+            SnArray *__ma_arr_tmp__ = sn_array_slice(__sn__self->__sn__timestamps, 1LL, sn_array_length(__sn__self->__sn__timestamps));
+            sn_cleanup_array(&__sn__self->__sn__timestamps);
+            __sn__self->__sn__timestamps = __ma_arr_tmp__;
+            __sn__self->__sn__timestamps;
+        });
+        
+    }
+}
+
+int main() {
+    sn_auto_RateLimiter __sn__RateLimiter __sn__rl = (__sn__RateLimiter){ .__sn__timestamps = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        }) };
+    {
+        for (long long __sn__i = 1LL; (__sn__i <= 20LL); __sn__i++) {
+            __sn__RateLimiter_record(&__sn__rl, sn_mul_long(__sn__i, 100LL));
+            
+        }
+    }
+    __sn__RateLimiter_evict(&__sn__rl, 1500LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__rl.__sn__timestamps)));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__rl.__sn__timestamps)); __sn__i++) {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__rl.__sn__timestamps->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__rl.__sn__timestamps->len : __ai__; })])));
+                    sn_auto_str char *__is_p1__ = sn_strdup("\n");
+                    sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+    sn_print("PASS\n");
+    
+    fflush(stdout);
+    return 0;
+}
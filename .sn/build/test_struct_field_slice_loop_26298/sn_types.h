@@ -0,0 +1,76 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: RateLimiter (as val) */
+typedef struct {
+    SnArray * __sn__timestamps;
+} __sn__RateLimiter;
+/* Value operations */
+static inline __sn__RateLimiter __sn__RateLimiter_copy(const __sn__RateLimiter *src) {
+    __sn__RateLimiter dst;
+    dst.__sn__timestamps = sn_array_copy(src->__sn__timestamps);
+    return dst;
+}
+
+static inline void __sn__RateLimiter_cleanup(__sn__RateLimiter *p) {
+    sn_cleanup_array(&p->__sn__timestamps);
+
+}
+
+#define sn_auto_RateLimiter __attribute__((cleanup(__sn__RateLimiter_cleanup)))
+
+static inline void __sn__RateLimiter_cleanup_elem(void *p) { __sn__RateLimiter_cleanup((__sn__RateLimiter *)p); }
+static inline void __sn__RateLimiter_copy_into(const void *src, void *dst) { *(__sn__RateLimiter *)dst = __sn__RateLimiter_copy((const __sn__RateLimiter *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__RateLimiter *__sn__RateLimiter_alloc(void) {
+    return calloc(1, sizeof(__sn__RateLimiter));
+}
+
+static inline void __sn__RateLimiter_release(__sn__RateLimiter **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__timestamps);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_RateLimiter __attribute__((cleanup(__sn__RateLimiter_release)))
+
+static inline void __sn__RateLimiter_release_elem(void *p) { __sn__RateLimiter_release((__sn__RateLimiter **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__RateLimiter_to_string(const __sn__RateLimiter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "RateLimiter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "timestamps: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__timestamps); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+void __sn__RateLimiter_record(__sn__RateLimiter *, long long);
+void __sn__RateLimiter_evict(__sn__RateLimiter *, long long);
+
+
+
+#endif
@@ -0,0 +1,172 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_large_struct_size() {
+
+    if ((sizeof(__sn__LargeStruct) != 8192LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: sizeof(LargeStruct) = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__LargeStruct)));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 8192\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(LargeStruct) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__LargeStruct)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" (at 8KB threshold)\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    sn_print("Size test: PASS\n");
+    
+}
+
+
+void __sn__test_large_struct_allocation() {
+
+    __sn__LargeStruct __sn__data = (__sn__LargeStruct){ .__sn__field0 = 42LL, .__sn__field1023 = 99LL, .__sn__field1 = 0LL, .__sn__field2 = 0LL, .__sn__field3 = 0LL, .__sn__field4 = 0LL, .__sn__field5 = 0LL, .__sn__field6 = 0LL, .__sn__field7 = 0LL, .__sn__field8 = 0LL, .__sn__field9 = 0LL, .__sn__field10 = 0LL, .__sn__field11 = 0LL, .__sn__field12 = 0LL, .__sn__field13 = 0LL, .__sn__field14 = 0LL, .__sn__field15 = 0LL, .__sn__field16 = 0LL, .__sn__field17 = 0LL, .__sn__field18 = 0LL, .__sn__field19 = 0LL, .__sn__field20 = 0LL, .__sn__field21 = 0LL, .__sn__field22 = 0LL, .__sn__field23 = 0LL, .__sn__field24 = 0LL, .__sn__field25 = 0LL, .__sn__field26 = 0LL, .__sn__field27 = 0LL, .__sn__field28 = 0LL, .__sn__field29 = 0LL, .__sn__field30 = 0LL, .__sn__field31 = 0LL, .__sn__field32 = 0LL, .__sn__field33 = 0LL, .__sn__field34 = 0LL, .__sn__field35 = 0LL, .__sn__field36 = 0LL, .__sn__field37 = 0LL, .__sn__field38 = 0LL, .__sn__field39 = 0LL, .__sn__field40 = 0LL, .__sn__field41 = 0LL, .__sn__field42 = 0LL, .__sn__field43 = 0LL, .__sn__field44 = 0LL, .__sn__field45 = 0LL, .__sn__field46 = 0LL, .__sn__field47 = 0LL, .__sn__field48 = 0LL, .__sn__field49 = 0LL, .__sn__field50 = 0LL, .__sn__field51 = 0LL, .__sn__field52 = 0LL, .__sn__field53 = 0LL, .__sn__field54 = 0LL, .__sn__field55 = 0LL, .__sn__field56 = 0LL, .__sn__field57 = 0LL, .__sn__field58 = 0LL, .__sn__field59 = 0LL, .__sn__field60 = 0LL, .__sn__field61 = 0LL, .__sn__field62 = 0LL, .__sn__field63 = 0LL, .__sn__field64 = 0LL, .__sn__field65 = 0LL, .__sn__field66 = 0LL, .__sn__field67 = 0LL, .__sn__field68 = 0LL, .__sn__field69 = 0LL, .__sn__field70 = 0LL, .__sn__field71 = 0LL, .__sn__field72 = 0LL, .__sn__field73 = 0LL, .__sn__field74 = 0LL, .__sn__field75 = 0LL, .__sn__field76 = 0LL, .__sn__field77 = 0LL, .__sn__field78 = 0LL, .__sn__field79 = 0LL, .__sn__field80 = 0LL, .__sn__field81 = 0LL, .__sn__field82 = 0LL, .__sn__field83 = 0LL, .__sn__field84 = 0LL, .__sn__field85 = 0LL, .__sn__field86 = 0LL, .__sn__field87 = 0LL, .__sn__field88 = 0LL, .__sn__field89 = 0LL, .__sn__field90 = 0LL, .__sn__field91 = 0LL, .__sn__field92 = 0LL, .__sn__field93 = 0LL, .__sn__field94 = 0LL, .__sn__field95 = 0LL, .__sn__field96 = 0LL, .__sn__field97 = 0LL, .__sn__field98 = 0LL, .__sn__field99 = 0LL, .__sn__field100 = 0LL, .__sn__field101 = 0LL, .__sn__field102 = 0LL, .__sn__field103 = 0LL, .__sn__field104 = 0LL, .__sn__field105 = 0LL, .__sn__field106 = 0LL, .__sn__field107 = 0LL, .__sn__field108 = 0LL, .__sn__field109 = 0LL, .__sn__field110 = 0LL, .__sn__field111 = 0LL, .__sn__field112 = 0LL, .__sn__field113 = 0LL, .__sn__field114 = 0LL, .__sn__field115 = 0LL, .__sn__field116 = 0LL, .__sn__field117 = 0LL, .__sn__field118 = 0LL, .__sn__field119 = 0LL, .__sn__field120 = 0LL, .__sn__field121 = 0LL, .__sn__field122 = 0LL, .__sn__field123 = 0LL, .__sn__field124 = 0LL, .__sn__field125 = 0LL, .__sn__field126 = 0LL, .__sn__field127 = 0LL, .__sn__field128 = 0LL, .__sn__field129 = 0LL, .__sn__field130 = 0LL, .__sn__field131 = 0LL, .__sn__field132 = 0LL, .__sn__field133 = 0LL, .__sn__field134 = 0LL, .__sn__field135 = 0LL, .__sn__field136 = 0LL, .__sn__field137 = 0LL, .__sn__field138 = 0LL, .__sn__field139 = 0LL, .__sn__field140 = 0LL, .__sn__field141 = 0LL, .__sn__field142 = 0LL, .__sn__field143 = 0LL, .__sn__field144 = 0LL, .__sn__field145 = 0LL, .__sn__field146 = 0LL, .__sn__field147 = 0LL, .__sn__field148 = 0LL, .__sn__field149 = 0LL, .__sn__field150 = 0LL, .__sn__field151 = 0LL, .__sn__field152 = 0LL, .__sn__field153 = 0LL, .__sn__field154 = 0LL, .__sn__field155 = 0LL, .__sn__field156 = 0LL, .__sn__field157 = 0LL, .__sn__field158 = 0LL, .__sn__field159 = 0LL, .__sn__field160 = 0LL, .__sn__field161 = 0LL, .__sn__field162 = 0LL, .__sn__field163 = 0LL, .__sn__field164 = 0LL, .__sn__field165 = 0LL, .__sn__field166 = 0LL, .__sn__field167 = 0LL, .__sn__field168 = 0LL, .__sn__field169 = 0LL, .__sn__field170 = 0LL, .__sn__field171 = 0LL, .__sn__field172 = 0LL, .__sn__field173 = 0LL, .__sn__field174 = 0LL, .__sn__field175 = 0LL, .__sn__field176 = 0LL, .__sn__field177 = 0LL, .__sn__field178 = 0LL, .__sn__field179 = 0LL, .__sn__field180 = 0LL, .__sn__field181 = 0LL, .__sn__field182 = 0LL, .__sn__field183 = 0LL, .__sn__field184 = 0LL, .__sn__field185 = 0LL, .__sn__field186 = 0LL, .__sn__field187 = 0LL, .__sn__field188 = 0LL, .__sn__field189 = 0LL, .__sn__field190 = 0LL, .__sn__field191 = 0LL, .__sn__field192 = 0LL, .__sn__field193 = 0LL, .__sn__field194 = 0LL, .__sn__field195 = 0LL, .__sn__field196 = 0LL, .__sn__field197 = 0LL, .__sn__field198 = 0LL, .__sn__field199 = 0LL, .__sn__field200 = 0LL, .__sn__field201 = 0LL, .__sn__field202 = 0LL, .__sn__field203 = 0LL, .__sn__field204 = 0LL, .__sn__field205 = 0LL, .__sn__field206 = 0LL, .__sn__field207 = 0LL, .__sn__field208 = 0LL, .__sn__field209 = 0LL, .__sn__field210 = 0LL, .__sn__field211 = 0LL, .__sn__field212 = 0LL, .__sn__field213 = 0LL, .__sn__field214 = 0LL, .__sn__field215 = 0LL, .__sn__field216 = 0LL, .__sn__field217 = 0LL, .__sn__field218 = 0LL, .__sn__field219 = 0LL, .__sn__field220 = 0LL, .__sn__field221 = 0LL, .__sn__field222 = 0LL, .__sn__field223 = 0LL, .__sn__field224 = 0LL, .__sn__field225 = 0LL, .__sn__field226 = 0LL, .__sn__field227 = 0LL, .__sn__field228 = 0LL, .__sn__field229 = 0LL, .__sn__field230 = 0LL, .__sn__field231 = 0LL, .__sn__field232 = 0LL, .__sn__field233 = 0LL, .__sn__field234 = 0LL, .__sn__field235 = 0LL, .__sn__field236 = 0LL, .__sn__field237 = 0LL, .__sn__field238 = 0LL, .__sn__field239 = 0LL, .__sn__field240 = 0LL, .__sn__field241 = 0LL, .__sn__field242 = 0LL, .__sn__field243 = 0LL, .__sn__field244 = 0LL, .__sn__field245 = 0LL, .__sn__field246 = 0LL, .__sn__field247 = 0LL, .__sn__field248 = 0LL, .__sn__field249 = 0LL, .__sn__field250 = 0LL, .__sn__field251 = 0LL, .__sn__field252 = 0LL, .__sn__field253 = 0LL, .__sn__field254 = 0LL, .__sn__field255 = 0LL, .__sn__field256 = 0LL, .__sn__field257 = 0LL, .__sn__field258 = 0LL, .__sn__field259 = 0LL, .__sn__field260 = 0LL, .__sn__field261 = 0LL, .__sn__field262 = 0LL, .__sn__field263 = 0LL, .__sn__field264 = 0LL, .__sn__field265 = 0LL, .__sn__field266 = 0LL, .__sn__field267 = 0LL, .__sn__field268 = 0LL, .__sn__field269 = 0LL, .__sn__field270 = 0LL, .__sn__field271 = 0LL, .__sn__field272 = 0LL, .__sn__field273 = 0LL, .__sn__field274 = 0LL, .__sn__field275 = 0LL, .__sn__field276 = 0LL, .__sn__field277 = 0LL, .__sn__field278 = 0LL, .__sn__field279 = 0LL, .__sn__field280 = 0LL, .__sn__field281 = 0LL, .__sn__field282 = 0LL, .__sn__field283 = 0LL, .__sn__field284 = 0LL, .__sn__field285 = 0LL, .__sn__field286 = 0LL, .__sn__field287 = 0LL, .__sn__field288 = 0LL, .__sn__field289 = 0LL, .__sn__field290 = 0LL, .__sn__field291 = 0LL, .__sn__field292 = 0LL, .__sn__field293 = 0LL, .__sn__field294 = 0LL, .__sn__field295 = 0LL, .__sn__field296 = 0LL, .__sn__field297 = 0LL, .__sn__field298 = 0LL, .__sn__field299 = 0LL, .__sn__field300 = 0LL, .__sn__field301 = 0LL, .__sn__field302 = 0LL, .__sn__field303 = 0LL, .__sn__field304 = 0LL, .__sn__field305 = 0LL, .__sn__field306 = 0LL, .__sn__field307 = 0LL, .__sn__field308 = 0LL, .__sn__field309 = 0LL, .__sn__field310 = 0LL, .__sn__field311 = 0LL, .__sn__field312 = 0LL, .__sn__field313 = 0LL, .__sn__field314 = 0LL, .__sn__field315 = 0LL, .__sn__field316 = 0LL, .__sn__field317 = 0LL, .__sn__field318 = 0LL, .__sn__field319 = 0LL, .__sn__field320 = 0LL, .__sn__field321 = 0LL, .__sn__field322 = 0LL, .__sn__field323 = 0LL, .__sn__field324 = 0LL, .__sn__field325 = 0LL, .__sn__field326 = 0LL, .__sn__field327 = 0LL, .__sn__field328 = 0LL, .__sn__field329 = 0LL, .__sn__field330 = 0LL, .__sn__field331 = 0LL, .__sn__field332 = 0LL, .__sn__field333 = 0LL, .__sn__field334 = 0LL, .__sn__field335 = 0LL, .__sn__field336 = 0LL, .__sn__field337 = 0LL, .__sn__field338 = 0LL, .__sn__field339 = 0LL, .__sn__field340 = 0LL, .__sn__field341 = 0LL, .__sn__field342 = 0LL, .__sn__field343 = 0LL, .__sn__field344 = 0LL, .__sn__field345 = 0LL, .__sn__field346 = 0LL, .__sn__field347 = 0LL, .__sn__field348 = 0LL, .__sn__field349 = 0LL, .__sn__field350 = 0LL, .__sn__field351 = 0LL, .__sn__field352 = 0LL, .__sn__field353 = 0LL, .__sn__field354 = 0LL, .__sn__field355 = 0LL, .__sn__field356 = 0LL, .__sn__field357 = 0LL, .__sn__field358 = 0LL, .__sn__field359 = 0LL, .__sn__field360 = 0LL, .__sn__field361 = 0LL, .__sn__field362 = 0LL, .__sn__field363 = 0LL, .__sn__field364 = 0LL, .__sn__field365 = 0LL, .__sn__field366 = 0LL, .__sn__field367 = 0LL, .__sn__field368 = 0LL, .__sn__field369 = 0LL, .__sn__field370 = 0LL, .__sn__field371 = 0LL, .__sn__field372 = 0LL, .__sn__field373 = 0LL, .__sn__field374 = 0LL, .__sn__field375 = 0LL, .__sn__field376 = 0LL, .__sn__field377 = 0LL, .__sn__field378 = 0LL, .__sn__field379 = 0LL, .__sn__field380 = 0LL, .__sn__field381 = 0LL, .__sn__field382 = 0LL, .__sn__field383 = 0LL, .__sn__field384 = 0LL, .__sn__field385 = 0LL, .__sn__field386 = 0LL, .__sn__field387 = 0LL, .__sn__field388 = 0LL, .__sn__field389 = 0LL, .__sn__field390 = 0LL, .__sn__field391 = 0LL, .__sn__field392 = 0LL, .__sn__field393 = 0LL, .__sn__field394 = 0LL, .__sn__field395 = 0LL, .__sn__field396 = 0LL, .__sn__field397 = 0LL, .__sn__field398 = 0LL, .__sn__field399 = 0LL, .__sn__field400 = 0LL, .__sn__field401 = 0LL, .__sn__field402 = 0LL, .__sn__field403 = 0LL, .__sn__field404 = 0LL, .__sn__field405 = 0LL, .__sn__field406 = 0LL, .__sn__field407 = 0LL, .__sn__field408 = 0LL, .__sn__field409 = 0LL, .__sn__field410 = 0LL, .__sn__field411 = 0LL, .__sn__field412 = 0LL, .__sn__field413 = 0LL, .__sn__field414 = 0LL, .__sn__field415 = 0LL, .__sn__field416 = 0LL, .__sn__field417 = 0LL, .__sn__field418 = 0LL, .__sn__field419 = 0LL, .__sn__field420 = 0LL, .__sn__field421 = 0LL, .__sn__field422 = 0LL, .__sn__field423 = 0LL, .__sn__field424 = 0LL, .__sn__field425 = 0LL, .__sn__field426 = 0LL, .__sn__field427 = 0LL, .__sn__field428 = 0LL, .__sn__field429 = 0LL, .__sn__field430 = 0LL, .__sn__field431 = 0LL, .__sn__field432 = 0LL, .__sn__field433 = 0LL, .__sn__field434 = 0LL, .__sn__field435 = 0LL, .__sn__field436 = 0LL, .__sn__field437 = 0LL, .__sn__field438 = 0LL, .__sn__field439 = 0LL, .__sn__field440 = 0LL, .__sn__field441 = 0LL, .__sn__field442 = 0LL, .__sn__field443 = 0LL, .__sn__field444 = 0LL, .__sn__field445 = 0LL, .__sn__field446 = 0LL, .__sn__field447 = 0LL, .__sn__field448 = 0LL, .__sn__field449 = 0LL, .__sn__field450 = 0LL, .__sn__field451 = 0LL, .__sn__field452 = 0LL, .__sn__field453 = 0LL, .__sn__field454 = 0LL, .__sn__field455 = 0LL, .__sn__field456 = 0LL, .__sn__field457 = 0LL, .__sn__field458 = 0LL, .__sn__field459 = 0LL, .__sn__field460 = 0LL, .__sn__field461 = 0LL, .__sn__field462 = 0LL, .__sn__field463 = 0LL, .__sn__field464 = 0LL, .__sn__field465 = 0LL, .__sn__field466 = 0LL, .__sn__field467 = 0LL, .__sn__field468 = 0LL, .__sn__field469 = 0LL, .__sn__field470 = 0LL, .__sn__field471 = 0LL, .__sn__field472 = 0LL, .__sn__field473 = 0LL, .__sn__field474 = 0LL, .__sn__field475 = 0LL, .__sn__field476 = 0LL, .__sn__field477 = 0LL, .__sn__field478 = 0LL, .__sn__field479 = 0LL, .__sn__field480 = 0LL, .__sn__field481 = 0LL, .__sn__field482 = 0LL, .__sn__field483 = 0LL, .__sn__field484 = 0LL, .__sn__field485 = 0LL, .__sn__field486 = 0LL, .__sn__field487 = 0LL, .__sn__field488 = 0LL, .__sn__field489 = 0LL, .__sn__field490 = 0LL, .__sn__field491 = 0LL, .__sn__field492 = 0LL, .__sn__field493 = 0LL, .__sn__field494 = 0LL, .__sn__field495 = 0LL, .__sn__field496 = 0LL, .__sn__field497 = 0LL, .__sn__field498 = 0LL, .__sn__field499 = 0LL, .__sn__field500 = 0LL, .__sn__field501 = 0LL, .__sn__field502 = 0LL, .__sn__field503 = 0LL, .__sn__field504 = 0LL, .__sn__field505 = 0LL, .__sn__field506 = 0LL, .__sn__field507 = 0LL, .__sn__field508 = 0LL, .__sn__field509 = 0LL, .__sn__field510 = 0LL, .__sn__field511 = 0LL, .__sn__field512 = 0LL, .__sn__field513 = 0LL, .__sn__field514 = 0LL, .__sn__field515 = 0LL, .__sn__field516 = 0LL, .__sn__field517 = 0LL, .__sn__field518 = 0LL, .__sn__field519 = 0LL, .__sn__field520 = 0LL, .__sn__field521 = 0LL, .__sn__field522 = 0LL, .__sn__field523 = 0LL, .__sn__field524 = 0LL, .__sn__field525 = 0LL, .__sn__field526 = 0LL, .__sn__field527 = 0LL, .__sn__field528 = 0LL, .__sn__field529 = 0LL, .__sn__field530 = 0LL, .__sn__field531 = 0LL, .__sn__field532 = 0LL, .__sn__field533 = 0LL, .__sn__field534 = 0LL, .__sn__field535 = 0LL, .__sn__field536 = 0LL, .__sn__field537 = 0LL, .__sn__field538 = 0LL, .__sn__field539 = 0LL, .__sn__field540 = 0LL, .__sn__field541 = 0LL, .__sn__field542 = 0LL, .__sn__field543 = 0LL, .__sn__field544 = 0LL, .__sn__field545 = 0LL, .__sn__field546 = 0LL, .__sn__field547 = 0LL, .__sn__field548 = 0LL, .__sn__field549 = 0LL, .__sn__field550 = 0LL, .__sn__field551 = 0LL, .__sn__field552 = 0LL, .__sn__field553 = 0LL, .__sn__field554 = 0LL, .__sn__field555 = 0LL, .__sn__field556 = 0LL, .__sn__field557 = 0LL, .__sn__field558 = 0LL, .__sn__field559 = 0LL, .__sn__field560 = 0LL, .__sn__field561 = 0LL, .__sn__field562 = 0LL, .__sn__field563 = 0LL, .__sn__field564 = 0LL, .__sn__field565 = 0LL, .__sn__field566 = 0LL, .__sn__field567 = 0LL, .__sn__field568 = 0LL, .__sn__field569 = 0LL, .__sn__field570 = 0LL, .__sn__field571 = 0LL, .__sn__field572 = 0LL, .__sn__field573 = 0LL, .__sn__field574 = 0LL, .__sn__field575 = 0LL, .__sn__field576 = 0LL, .__sn__field577 = 0LL, .__sn__field578 = 0LL, .__sn__field579 = 0LL, .__sn__field580 = 0LL, .__sn__field581 = 0LL, .__sn__field582 = 0LL, .__sn__field583 = 0LL, .__sn__field584 = 0LL, .__sn__field585 = 0LL, .__sn__field586 = 0LL, .__sn__field587 = 0LL, .__sn__field588 = 0LL, .__sn__field589 = 0LL, .__sn__field590 = 0LL, .__sn__field591 = 0LL, .__sn__field592 = 0LL, .__sn__field593 = 0LL, .__sn__field594 = 0LL, .__sn__field595 = 0LL, .__sn__field596 = 0LL, .__sn__field597 = 0LL, .__sn__field598 = 0LL, .__sn__field599 = 0LL, .__sn__field600 = 0LL, .__sn__field601 = 0LL, .__sn__field602 = 0LL, .__sn__field603 = 0LL, .__sn__field604 = 0LL, .__sn__field605 = 0LL, .__sn__field606 = 0LL, .__sn__field607 = 0LL, .__sn__field608 = 0LL, .__sn__field609 = 0LL, .__sn__field610 = 0LL, .__sn__field611 = 0LL, .__sn__field612 = 0LL, .__sn__field613 = 0LL, .__sn__field614 = 0LL, .__sn__field615 = 0LL, .__sn__field616 = 0LL, .__sn__field617 = 0LL, .__sn__field618 = 0LL, .__sn__field619 = 0LL, .__sn__field620 = 0LL, .__sn__field621 = 0LL, .__sn__field622 = 0LL, .__sn__field623 = 0LL, .__sn__field624 = 0LL, .__sn__field625 = 0LL, .__sn__field626 = 0LL, .__sn__field627 = 0LL, .__sn__field628 = 0LL, .__sn__field629 = 0LL, .__sn__field630 = 0LL, .__sn__field631 = 0LL, .__sn__field632 = 0LL, .__sn__field633 = 0LL, .__sn__field634 = 0LL, .__sn__field635 = 0LL, .__sn__field636 = 0LL, .__sn__field637 = 0LL, .__sn__field638 = 0LL, .__sn__field639 = 0LL, .__sn__field640 = 0LL, .__sn__field641 = 0LL, .__sn__field642 = 0LL, .__sn__field643 = 0LL, .__sn__field644 = 0LL, .__sn__field645 = 0LL, .__sn__field646 = 0LL, .__sn__field647 = 0LL, .__sn__field648 = 0LL, .__sn__field649 = 0LL, .__sn__field650 = 0LL, .__sn__field651 = 0LL, .__sn__field652 = 0LL, .__sn__field653 = 0LL, .__sn__field654 = 0LL, .__sn__field655 = 0LL, .__sn__field656 = 0LL, .__sn__field657 = 0LL, .__sn__field658 = 0LL, .__sn__field659 = 0LL, .__sn__field660 = 0LL, .__sn__field661 = 0LL, .__sn__field662 = 0LL, .__sn__field663 = 0LL, .__sn__field664 = 0LL, .__sn__field665 = 0LL, .__sn__field666 = 0LL, .__sn__field667 = 0LL, .__sn__field668 = 0LL, .__sn__field669 = 0LL, .__sn__field670 = 0LL, .__sn__field671 = 0LL, .__sn__field672 = 0LL, .__sn__field673 = 0LL, .__sn__field674 = 0LL, .__sn__field675 = 0LL, .__sn__field676 = 0LL, .__sn__field677 = 0LL, .__sn__field678 = 0LL, .__sn__field679 = 0LL, .__sn__field680 = 0LL, .__sn__field681 = 0LL, .__sn__field682 = 0LL, .__sn__field683 = 0LL, .__sn__field684 = 0LL, .__sn__field685 = 0LL, .__sn__field686 = 0LL, .__sn__field687 = 0LL, .__sn__field688 = 0LL, .__sn__field689 = 0LL, .__sn__field690 = 0LL, .__sn__field691 = 0LL, .__sn__field692 = 0LL, .__sn__field693 = 0LL, .__sn__field694 = 0LL, .__sn__field695 = 0LL, .__sn__field696 = 0LL, .__sn__field697 = 0LL, .__sn__field698 = 0LL, .__sn__field699 = 0LL, .__sn__field700 = 0LL, .__sn__field701 = 0LL, .__sn__field702 = 0LL, .__sn__field703 = 0LL, .__sn__field704 = 0LL, .__sn__field705 = 0LL, .__sn__field706 = 0LL, .__sn__field707 = 0LL, .__sn__field708 = 0LL, .__sn__field709 = 0LL, .__sn__field710 = 0LL, .__sn__field711 = 0LL, .__sn__field712 = 0LL, .__sn__field713 = 0LL, .__sn__field714 = 0LL, .__sn__field715 = 0LL, .__sn__field716 = 0LL, .__sn__field717 = 0LL, .__sn__field718 = 0LL, .__sn__field719 = 0LL, .__sn__field720 = 0LL, .__sn__field721 = 0LL, .__sn__field722 = 0LL, .__sn__field723 = 0LL, .__sn__field724 = 0LL, .__sn__field725 = 0LL, .__sn__field726 = 0LL, .__sn__field727 = 0LL, .__sn__field728 = 0LL, .__sn__field729 = 0LL, .__sn__field730 = 0LL, .__sn__field731 = 0LL, .__sn__field732 = 0LL, .__sn__field733 = 0LL, .__sn__field734 = 0LL, .__sn__field735 = 0LL, .__sn__field736 = 0LL, .__sn__field737 = 0LL, .__sn__field738 = 0LL, .__sn__field739 = 0LL, .__sn__field740 = 0LL, .__sn__field741 = 0LL, .__sn__field742 = 0LL, .__sn__field743 = 0LL, .__sn__field744 = 0LL, .__sn__field745 = 0LL, .__sn__field746 = 0LL, .__sn__field747 = 0LL, .__sn__field748 = 0LL, .__sn__field749 = 0LL, .__sn__field750 = 0LL, .__sn__field751 = 0LL, .__sn__field752 = 0LL, .__sn__field753 = 0LL, .__sn__field754 = 0LL, .__sn__field755 = 0LL, .__sn__field756 = 0LL, .__sn__field757 = 0LL, .__sn__field758 = 0LL, .__sn__field759 = 0LL, .__sn__field760 = 0LL, .__sn__field761 = 0LL, .__sn__field762 = 0LL, .__sn__field763 = 0LL, .__sn__field764 = 0LL, .__sn__field765 = 0LL, .__sn__field766 = 0LL, .__sn__field767 = 0LL, .__sn__field768 = 0LL, .__sn__field769 = 0LL, .__sn__field770 = 0LL, .__sn__field771 = 0LL, .__sn__field772 = 0LL, .__sn__field773 = 0LL, .__sn__field774 = 0LL, .__sn__field775 = 0LL, .__sn__field776 = 0LL, .__sn__field777 = 0LL, .__sn__field778 = 0LL, .__sn__field779 = 0LL, .__sn__field780 = 0LL, .__sn__field781 = 0LL, .__sn__field782 = 0LL, .__sn__field783 = 0LL, .__sn__field784 = 0LL, .__sn__field785 = 0LL, .__sn__field786 = 0LL, .__sn__field787 = 0LL, .__sn__field788 = 0LL, .__sn__field789 = 0LL, .__sn__field790 = 0LL, .__sn__field791 = 0LL, .__sn__field792 = 0LL, .__sn__field793 = 0LL, .__sn__field794 = 0LL, .__sn__field795 = 0LL, .__sn__field796 = 0LL, .__sn__field797 = 0LL, .__sn__field798 = 0LL, .__sn__field799 = 0LL, .__sn__field800 = 0LL, .__sn__field801 = 0LL, .__sn__field802 = 0LL, .__sn__field803 = 0LL, .__sn__field804 = 0LL, .__sn__field805 = 0LL, .__sn__field806 = 0LL, .__sn__field807 = 0LL, .__sn__field808 = 0LL, .__sn__field809 = 0LL, .__sn__field810 = 0LL, .__sn__field811 = 0LL, .__sn__field812 = 0LL, .__sn__field813 = 0LL, .__sn__field814 = 0LL, .__sn__field815 = 0LL, .__sn__field816 = 0LL, .__sn__field817 = 0LL, .__sn__field818 = 0LL, .__sn__field819 = 0LL, .__sn__field820 = 0LL, .__sn__field821 = 0LL, .__sn__field822 = 0LL, .__sn__field823 = 0LL, .__sn__field824 = 0LL, .__sn__field825 = 0LL, .__sn__field826 = 0LL, .__sn__field827 = 0LL, .__sn__field828 = 0LL, .__sn__field829 = 0LL, .__sn__field830 = 0LL, .__sn__field831 = 0LL, .__sn__field832 = 0LL, .__sn__field833 = 0LL, .__sn__field834 = 0LL, .__sn__field835 = 0LL, .__sn__field836 = 0LL, .__sn__field837 = 0LL, .__sn__field838 = 0LL, .__sn__field839 = 0LL, .__sn__field840 = 0LL, .__sn__field841 = 0LL, .__sn__field842 = 0LL, .__sn__field843 = 0LL, .__sn__field844 = 0LL, .__sn__field845 = 0LL, .__sn__field846 = 0LL, .__sn__field847 = 0LL, .__sn__field848 = 0LL, .__sn__field849 = 0LL, .__sn__field850 = 0LL, .__sn__field851 = 0LL, .__sn__field852 = 0LL, .__sn__field853 = 0LL, .__sn__field854 = 0LL, .__sn__field855 = 0LL, .__sn__field856 = 0LL, .__sn__field857 = 0LL, .__sn__field858 = 0LL, .__sn__field859 = 0LL, .__sn__field860 = 0LL, .__sn__field861 = 0LL, .__sn__field862 = 0LL, .__sn__field863 = 0LL, .__sn__field864 = 0LL, .__sn__field865 = 0LL, .__sn__field866 = 0LL, .__sn__field867 = 0LL, .__sn__field868 = 0LL, .__sn__field869 = 0LL, .__sn__field870 = 0LL, .__sn__field871 = 0LL, .__sn__field872 = 0LL, .__sn__field873 = 0LL, .__sn__field874 = 0LL, .__sn__field875 = 0LL, .__sn__field876 = 0LL, .__sn__field877 = 0LL, .__sn__field878 = 0LL, .__sn__field879 = 0LL, .__sn__field880 = 0LL, .__sn__field881 = 0LL, .__sn__field882 = 0LL, .__sn__field883 = 0LL, .__sn__field884 = 0LL, .__sn__field885 = 0LL, .__sn__field886 = 0LL, .__sn__field887 = 0LL, .__sn__field888 = 0LL, .__sn__field889 = 0LL, .__sn__field890 = 0LL, .__sn__field891 = 0LL, .__sn__field892 = 0LL, .__sn__field893 = 0LL, .__sn__field894 = 0LL, .__sn__field895 = 0LL, .__sn__field896 = 0LL, .__sn__field897 = 0LL, .__sn__field898 = 0LL, .__sn__field899 = 0LL, .__sn__field900 = 0LL, .__sn__field901 = 0LL, .__sn__field902 = 0LL, .__sn__field903 = 0LL, .__sn__field904 = 0LL, .__sn__field905 = 0LL, .__sn__field906 = 0LL, .__sn__field907 = 0LL, .__sn__field908 = 0LL, .__sn__field909 = 0LL, .__sn__field910 = 0LL, .__sn__field911 = 0LL, .__sn__field912 = 0LL, .__sn__field913 = 0LL, .__sn__field914 = 0LL, .__sn__field915 = 0LL, .__sn__field916 = 0LL, .__sn__field917 = 0LL, .__sn__field918 = 0LL, .__sn__field919 = 0LL, .__sn__field920 = 0LL, .__sn__field921 = 0LL, .__sn__field922 = 0LL, .__sn__field923 = 0LL, .__sn__field924 = 0LL, .__sn__field925 = 0LL, .__sn__field926 = 0LL, .__sn__field927 = 0LL, .__sn__field928 = 0LL, .__sn__field929 = 0LL, .__sn__field930 = 0LL, .__sn__field931 = 0LL, .__sn__field932 = 0LL, .__sn__field933 = 0LL, .__sn__field934 = 0LL, .__sn__field935 = 0LL, .__sn__field936 = 0LL, .__sn__field937 = 0LL, .__sn__field938 = 0LL, .__sn__field939 = 0LL, .__sn__field940 = 0LL, .__sn__field941 = 0LL, .__sn__field942 = 0LL, .__sn__field943 = 0LL, .__sn__field944 = 0LL, .__sn__field945 = 0LL, .__sn__field946 = 0LL, .__sn__field947 = 0LL, .__sn__field948 = 0LL, .__sn__field949 = 0LL, .__sn__field950 = 0LL, .__sn__field951 = 0LL, .__sn__field952 = 0LL, .__sn__field953 = 0LL, .__sn__field954 = 0LL, .__sn__field955 = 0LL, .__sn__field956 = 0LL, .__sn__field957 = 0LL, .__sn__field958 = 0LL, .__sn__field959 = 0LL, .__sn__field960 = 0LL, .__sn__field961 = 0LL, .__sn__field962 = 0LL, .__sn__field963 = 0LL, .__sn__field964 = 0LL, .__sn__field965 = 0LL, .__sn__field966 = 0LL, .__sn__field967 = 0LL, .__sn__field968 = 0LL, .__sn__field969 = 0LL, .__sn__field970 = 0LL, .__sn__field971 = 0LL, .__sn__field972 = 0LL, .__sn__field973 = 0LL, .__sn__field974 = 0LL, .__sn__field975 = 0LL, .__sn__field976 = 0LL, .__sn__field977 = 0LL, .__sn__field978 = 0LL, .__sn__field979 = 0LL, .__sn__field980 = 0LL, .__sn__field981 = 0LL, .__sn__field982 = 0LL, .__sn__field983 = 0LL, .__sn__field984 = 0LL, .__sn__field985 = 0LL, .__sn__field986 = 0LL, .__sn__field987 = 0LL, .__sn__field988 = 0LL, .__sn__field989 = 0LL, .__sn__field990 = 0LL, .__sn__field991 = 0LL, .__sn__field992 = 0LL, .__sn__field993 = 0LL, .__sn__field994 = 0LL, .__sn__field995 = 0LL, .__sn__field996 = 0LL, .__sn__field997 = 0LL, .__sn__field998 = 0LL, .__sn__field999 = 0LL, .__sn__field1000 = 0LL, .__sn__field1001 = 0LL, .__sn__field1002 = 0LL, .__sn__field1003 = 0LL, .__sn__field1004 = 0LL, .__sn__field1005 = 0LL, .__sn__field1006 = 0LL, .__sn__field1007 = 0LL, .__sn__field1008 = 0LL, .__sn__field1009 = 0LL, .__sn__field1010 = 0LL, .__sn__field1011 = 0LL, .__sn__field1012 = 0LL, .__sn__field1013 = 0LL, .__sn__field1014 = 0LL, .__sn__field1015 = 0LL, .__sn__field1016 = 0LL, .__sn__field1017 = 0LL, .__sn__field1018 = 0LL, .__sn__field1019 = 0LL, .__sn__field1020 = 0LL, .__sn__field1021 = 0LL, .__sn__field1022 = 0LL };
+
+    if ((__sn__data.__sn__field0 != 42LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: data.field0 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__data.__sn__field0));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 42\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__data.__sn__field1023 != 99LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: data.field1023 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__data.__sn__field1023));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 99\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__data.__sn__field512 != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: data.field512 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__data.__sn__field512));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 0\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Allocation test: PASS\n");
+    
+}
+
+
+void __sn__test_large_struct_field_access() {
+
+    __sn__LargeStruct __sn__data = (__sn__LargeStruct){ .__sn__field100 = 100LL, .__sn__field500 = 500LL, .__sn__field900 = 900LL, .__sn__field0 = 0LL, .__sn__field1 = 0LL, .__sn__field2 = 0LL, .__sn__field3 = 0LL, .__sn__field4 = 0LL, .__sn__field5 = 0LL, .__sn__field6 = 0LL, .__sn__field7 = 0LL, .__sn__field8 = 0LL, .__sn__field9 = 0LL, .__sn__field10 = 0LL, .__sn__field11 = 0LL, .__sn__field12 = 0LL, .__sn__field13 = 0LL, .__sn__field14 = 0LL, .__sn__field15 = 0LL, .__sn__field16 = 0LL, .__sn__field17 = 0LL, .__sn__field18 = 0LL, .__sn__field19 = 0LL, .__sn__field20 = 0LL, .__sn__field21 = 0LL, .__sn__field22 = 0LL, .__sn__field23 = 0LL, .__sn__field24 = 0LL, .__sn__field25 = 0LL, .__sn__field26 = 0LL, .__sn__field27 = 0LL, .__sn__field28 = 0LL, .__sn__field29 = 0LL, .__sn__field30 = 0LL, .__sn__field31 = 0LL, .__sn__field32 = 0LL, .__sn__field33 = 0LL, .__sn__field34 = 0LL, .__sn__field35 = 0LL, .__sn__field36 = 0LL, .__sn__field37 = 0LL, .__sn__field38 = 0LL, .__sn__field39 = 0LL, .__sn__field40 = 0LL, .__sn__field41 = 0LL, .__sn__field42 = 0LL, .__sn__field43 = 0LL, .__sn__field44 = 0LL, .__sn__field45 = 0LL, .__sn__field46 = 0LL, .__sn__field47 = 0LL, .__sn__field48 = 0LL, .__sn__field49 = 0LL, .__sn__field50 = 0LL, .__sn__field51 = 0LL, .__sn__field52 = 0LL, .__sn__field53 = 0LL, .__sn__field54 = 0LL, .__sn__field55 = 0LL, .__sn__field56 = 0LL, .__sn__field57 = 0LL, .__sn__field58 = 0LL, .__sn__field59 = 0LL, .__sn__field60 = 0LL, .__sn__field61 = 0LL, .__sn__field62 = 0LL, .__sn__field63 = 0LL, .__sn__field64 = 0LL, .__sn__field65 = 0LL, .__sn__field66 = 0LL, .__sn__field67 = 0LL, .__sn__field68 = 0LL, .__sn__field69 = 0LL, .__sn__field70 = 0LL, .__sn__field71 = 0LL, .__sn__field72 = 0LL, .__sn__field73 = 0LL, .__sn__field74 = 0LL, .__sn__field75 = 0LL, .__sn__field76 = 0LL, .__sn__field77 = 0LL, .__sn__field78 = 0LL, .__sn__field79 = 0LL, .__sn__field80 = 0LL, .__sn__field81 = 0LL, .__sn__field82 = 0LL, .__sn__field83 = 0LL, .__sn__field84 = 0LL, .__sn__field85 = 0LL, .__sn__field86 = 0LL, .__sn__field87 = 0LL, .__sn__field88 = 0LL, .__sn__field89 = 0LL, .__sn__field90 = 0LL, .__sn__field91 = 0LL, .__sn__field92 = 0LL, .__sn__field93 = 0LL, .__sn__field94 = 0LL, .__sn__field95 = 0LL, .__sn__field96 = 0LL, .__sn__field97 = 0LL, .__sn__field98 = 0LL, .__sn__field99 = 0LL, .__sn__field101 = 0LL, .__sn__field102 = 0LL, .__sn__field103 = 0LL, .__sn__field104 = 0LL, .__sn__field105 = 0LL, .__sn__field106 = 0LL, .__sn__field107 = 0LL, .__sn__field108 = 0LL, .__sn__field109 = 0LL, .__sn__field110 = 0LL, .__sn__field111 = 0LL, .__sn__field112 = 0LL, .__sn__field113 = 0LL, .__sn__field114 = 0LL, .__sn__field115 = 0LL, .__sn__field116 = 0LL, .__sn__field117 = 0LL, .__sn__field118 = 0LL, .__sn__field119 = 0LL, .__sn__field120 = 0LL, .__sn__field121 = 0LL, .__sn__field122 = 0LL, .__sn__field123 = 0LL, .__sn__field124 = 0LL, .__sn__field125 = 0LL, .__sn__field126 = 0LL, .__sn__field127 = 0LL, .__sn__field128 = 0LL, .__sn__field129 = 0LL, .__sn__field130 = 0LL, .__sn__field131 = 0LL, .__sn__field132 = 0LL, .__sn__field133 = 0LL, .__sn__field134 = 0LL, .__sn__field135 = 0LL, .__sn__field136 = 0LL, .__sn__field137 = 0LL, .__sn__field138 = 0LL, .__sn__field139 = 0LL, .__sn__field140 = 0LL, .__sn__field141 = 0LL, .__sn__field142 = 0LL, .__sn__field143 = 0LL, .__sn__field144 = 0LL, .__sn__field145 = 0LL, .__sn__field146 = 0LL, .__sn__field147 = 0LL, .__sn__field148 = 0LL, .__sn__field149 = 0LL, .__sn__field150 = 0LL, .__sn__field151 = 0LL, .__sn__field152 = 0LL, .__sn__field153 = 0LL, .__sn__field154 = 0LL, .__sn__field155 = 0LL, .__sn__field156 = 0LL, .__sn__field157 = 0LL, .__sn__field158 = 0LL, .__sn__field159 = 0LL, .__sn__field160 = 0LL, .__sn__field161 = 0LL, .__sn__field162 = 0LL, .__sn__field163 = 0LL, .__sn__field164 = 0LL, .__sn__field165 = 0LL, .__sn__field166 = 0LL, .__sn__field167 = 0LL, .__sn__field168 = 0LL, .__sn__field169 = 0LL, .__sn__field170 = 0LL, .__sn__field171 = 0LL, .__sn__field172 = 0LL, .__sn__field173 = 0LL, .__sn__field174 = 0LL, .__sn__field175 = 0LL, .__sn__field176 = 0LL, .__sn__field177 = 0LL, .__sn__field178 = 0LL, .__sn__field179 = 0LL, .__sn__field180 = 0LL, .__sn__field181 = 0LL, .__sn__field182 = 0LL, .__sn__field183 = 0LL, .__sn__field184 = 0LL, .__sn__field185 = 0LL, .__sn__field186 = 0LL, .__sn__field187 = 0LL, .__sn__field188 = 0LL, .__sn__field189 = 0LL, .__sn__field190 = 0LL, .__sn__field191 = 0LL, .__sn__field192 = 0LL, .__sn__field193 = 0LL, .__sn__field194 = 0LL, .__sn__field195 = 0LL, .__sn__field196 = 0LL, .__sn__field197 = 0LL, .__sn__field198 = 0LL, .__sn__field199 = 0LL, .__sn__field200 = 0LL, .__sn__field201 = 0LL, .__sn__field202 = 0LL, .__sn__field203 = 0LL, .__sn__field204 = 0LL, .__sn__field205 = 0LL, .__sn__field206 = 0LL, .__sn__field207 = 0LL, .__sn__field208 = 0LL, .__sn__field209 = 0LL, .__sn__field210 = 0LL, .__sn__field211 = 0LL, .__sn__field212 = 0LL, .__sn__field213 = 0LL, .__sn__field214 = 0LL, .__sn__field215 = 0LL, .__sn__field216 = 0LL, .__sn__field217 = 0LL, .__sn__field218 = 0LL, .__sn__field219 = 0LL, .__sn__field220 = 0LL, .__sn__field221 = 0LL, .__sn__field222 = 0LL, .__sn__field223 = 0LL, .__sn__field224 = 0LL, .__sn__field225 = 0LL, .__sn__field226 = 0LL, .__sn__field227 = 0LL, .__sn__field228 = 0LL, .__sn__field229 = 0LL, .__sn__field230 = 0LL, .__sn__field231 = 0LL, .__sn__field232 = 0LL, .__sn__field233 = 0LL, .__sn__field234 = 0LL, .__sn__field235 = 0LL, .__sn__field236 = 0LL, .__sn__field237 = 0LL, .__sn__field238 = 0LL, .__sn__field239 = 0LL, .__sn__field240 = 0LL, .__sn__field241 = 0LL, .__sn__field242 = 0LL, .__sn__field243 = 0LL, .__sn__field244 = 0LL, .__sn__field245 = 0LL, .__sn__field246 = 0LL, .__sn__field247 = 0LL, .__sn__field248 = 0LL, .__sn__field249 = 0LL, .__sn__field250 = 0LL, .__sn__field251 = 0LL, .__sn__field252 = 0LL, .__sn__field253 = 0LL, .__sn__field254 = 0LL, .__sn__field255 = 0LL, .__sn__field256 = 0LL, .__sn__field257 = 0LL, .__sn__field258 = 0LL, .__sn__field259 = 0LL, .__sn__field260 = 0LL, .__sn__field261 = 0LL, .__sn__field262 = 0LL, .__sn__field263 = 0LL, .__sn__field264 = 0LL, .__sn__field265 = 0LL, .__sn__field266 = 0LL, .__sn__field267 = 0LL, .__sn__field268 = 0LL, .__sn__field269 = 0LL, .__sn__field270 = 0LL, .__sn__field271 = 0LL, .__sn__field272 = 0LL, .__sn__field273 = 0LL, .__sn__field274 = 0LL, .__sn__field275 = 0LL, .__sn__field276 = 0LL, .__sn__field277 = 0LL, .__sn__field278 = 0LL, .__sn__field279 = 0LL, .__sn__field280 = 0LL, .__sn__field281 = 0LL, .__sn__field282 = 0LL, .__sn__field283 = 0LL, .__sn__field284 = 0LL, .__sn__field285 = 0LL, .__sn__field286 = 0LL, .__sn__field287 = 0LL, .__sn__field288 = 0LL, .__sn__field289 = 0LL, .__sn__field290 = 0LL, .__sn__field291 = 0LL, .__sn__field292 = 0LL, .__sn__field293 = 0LL, .__sn__field294 = 0LL, .__sn__field295 = 0LL, .__sn__field296 = 0LL, .__sn__field297 = 0LL, .__sn__field298 = 0LL, .__sn__field299 = 0LL, .__sn__field300 = 0LL, .__sn__field301 = 0LL, .__sn__field302 = 0LL, .__sn__field303 = 0LL, .__sn__field304 = 0LL, .__sn__field305 = 0LL, .__sn__field306 = 0LL, .__sn__field307 = 0LL, .__sn__field308 = 0LL, .__sn__field309 = 0LL, .__sn__field310 = 0LL, .__sn__field311 = 0LL, .__sn__field312 = 0LL, .__sn__field313 = 0LL, .__sn__field314 = 0LL, .__sn__field315 = 0LL, .__sn__field316 = 0LL, .__sn__field317 = 0LL, .__sn__field318 = 0LL, .__sn__field319 = 0LL, .__sn__field320 = 0LL, .__sn__field321 = 0LL, .__sn__field322 = 0LL, .__sn__field323 = 0LL, .__sn__field324 = 0LL, .__sn__field325 = 0LL, .__sn__field326 = 0LL, .__sn__field327 = 0LL, .__sn__field328 = 0LL, .__sn__field329 = 0LL, .__sn__field330 = 0LL, .__sn__field331 = 0LL, .__sn__field332 = 0LL, .__sn__field333 = 0LL, .__sn__field334 = 0LL, .__sn__field335 = 0LL, .__sn__field336 = 0LL, .__sn__field337 = 0LL, .__sn__field338 = 0LL, .__sn__field339 = 0LL, .__sn__field340 = 0LL, .__sn__field341 = 0LL, .__sn__field342 = 0LL, .__sn__field343 = 0LL, .__sn__field344 = 0LL, .__sn__field345 = 0LL, .__sn__field346 = 0LL, .__sn__field347 = 0LL, .__sn__field348 = 0LL, .__sn__field349 = 0LL, .__sn__field350 = 0LL, .__sn__field351 = 0LL, .__sn__field352 = 0LL, .__sn__field353 = 0LL, .__sn__field354 = 0LL, .__sn__field355 = 0LL, .__sn__field356 = 0LL, .__sn__field357 = 0LL, .__sn__field358 = 0LL, .__sn__field359 = 0LL, .__sn__field360 = 0LL, .__sn__field361 = 0LL, .__sn__field362 = 0LL, .__sn__field363 = 0LL, .__sn__field364 = 0LL, .__sn__field365 = 0LL, .__sn__field366 = 0LL, .__sn__field367 = 0LL, .__sn__field368 = 0LL, .__sn__field369 = 0LL, .__sn__field370 = 0LL, .__sn__field371 = 0LL, .__sn__field372 = 0LL, .__sn__field373 = 0LL, .__sn__field374 = 0LL, .__sn__field375 = 0LL, .__sn__field376 = 0LL, .__sn__field377 = 0LL, .__sn__field378 = 0LL, .__sn__field379 = 0LL, .__sn__field380 = 0LL, .__sn__field381 = 0LL, .__sn__field382 = 0LL, .__sn__field383 = 0LL, .__sn__field384 = 0LL, .__sn__field385 = 0LL, .__sn__field386 = 0LL, .__sn__field387 = 0LL, .__sn__field388 = 0LL, .__sn__field389 = 0LL, .__sn__field390 = 0LL, .__sn__field391 = 0LL, .__sn__field392 = 0LL, .__sn__field393 = 0LL, .__sn__field394 = 0LL, .__sn__field395 = 0LL, .__sn__field396 = 0LL, .__sn__field397 = 0LL, .__sn__field398 = 0LL, .__sn__field399 = 0LL, .__sn__field400 = 0LL, .__sn__field401 = 0LL, .__sn__field402 = 0LL, .__sn__field403 = 0LL, .__sn__field404 = 0LL, .__sn__field405 = 0LL, .__sn__field406 = 0LL, .__sn__field407 = 0LL, .__sn__field408 = 0LL, .__sn__field409 = 0LL, .__sn__field410 = 0LL, .__sn__field411 = 0LL, .__sn__field412 = 0LL, .__sn__field413 = 0LL, .__sn__field414 = 0LL, .__sn__field415 = 0LL, .__sn__field416 = 0LL, .__sn__field417 = 0LL, .__sn__field418 = 0LL, .__sn__field419 = 0LL, .__sn__field420 = 0LL, .__sn__field421 = 0LL, .__sn__field422 = 0LL, .__sn__field423 = 0LL, .__sn__field424 = 0LL, .__sn__field425 = 0LL, .__sn__field426 = 0LL, .__sn__field427 = 0LL, .__sn__field428 = 0LL, .__sn__field429 = 0LL, .__sn__field430 = 0LL, .__sn__field431 = 0LL, .__sn__field432 = 0LL, .__sn__field433 = 0LL, .__sn__field434 = 0LL, .__sn__field435 = 0LL, .__sn__field436 = 0LL, .__sn__field437 = 0LL, .__sn__field438 = 0LL, .__sn__field439 = 0LL, .__sn__field440 = 0LL, .__sn__field441 = 0LL, .__sn__field442 = 0LL, .__sn__field443 = 0LL, .__sn__field444 = 0LL, .__sn__field445 = 0LL, .__sn__field446 = 0LL, .__sn__field447 = 0LL, .__sn__field448 = 0LL, .__sn__field449 = 0LL, .__sn__field450 = 0LL, .__sn__field451 = 0LL, .__sn__field452 = 0LL, .__sn__field453 = 0LL, .__sn__field454 = 0LL, .__sn__field455 = 0LL, .__sn__field456 = 0LL, .__sn__field457 = 0LL, .__sn__field458 = 0LL, .__sn__field459 = 0LL, .__sn__field460 = 0LL, .__sn__field461 = 0LL, .__sn__field462 = 0LL, .__sn__field463 = 0LL, .__sn__field464 = 0LL, .__sn__field465 = 0LL, .__sn__field466 = 0LL, .__sn__field467 = 0LL, .__sn__field468 = 0LL, .__sn__field469 = 0LL, .__sn__field470 = 0LL, .__sn__field471 = 0LL, .__sn__field472 = 0LL, .__sn__field473 = 0LL, .__sn__field474 = 0LL, .__sn__field475 = 0LL, .__sn__field476 = 0LL, .__sn__field477 = 0LL, .__sn__field478 = 0LL, .__sn__field479 = 0LL, .__sn__field480 = 0LL, .__sn__field481 = 0LL, .__sn__field482 = 0LL, .__sn__field483 = 0LL, .__sn__field484 = 0LL, .__sn__field485 = 0LL, .__sn__field486 = 0LL, .__sn__field487 = 0LL, .__sn__field488 = 0LL, .__sn__field489 = 0LL, .__sn__field490 = 0LL, .__sn__field491 = 0LL, .__sn__field492 = 0LL, .__sn__field493 = 0LL, .__sn__field494 = 0LL, .__sn__field495 = 0LL, .__sn__field496 = 0LL, .__sn__field497 = 0LL, .__sn__field498 = 0LL, .__sn__field499 = 0LL, .__sn__field501 = 0LL, .__sn__field502 = 0LL, .__sn__field503 = 0LL, .__sn__field504 = 0LL, .__sn__field505 = 0LL, .__sn__field506 = 0LL, .__sn__field507 = 0LL, .__sn__field508 = 0LL, .__sn__field509 = 0LL, .__sn__field510 = 0LL, .__sn__field511 = 0LL, .__sn__field512 = 0LL, .__sn__field513 = 0LL, .__sn__field514 = 0LL, .__sn__field515 = 0LL, .__sn__field516 = 0LL, .__sn__field517 = 0LL, .__sn__field518 = 0LL, .__sn__field519 = 0LL, .__sn__field520 = 0LL, .__sn__field521 = 0LL, .__sn__field522 = 0LL, .__sn__field523 = 0LL, .__sn__field524 = 0LL, .__sn__field525 = 0LL, .__sn__field526 = 0LL, .__sn__field527 = 0LL, .__sn__field528 = 0LL, .__sn__field529 = 0LL, .__sn__field530 = 0LL, .__sn__field531 = 0LL, .__sn__field532 = 0LL, .__sn__field533 = 0LL, .__sn__field534 = 0LL, .__sn__field535 = 0LL, .__sn__field536 = 0LL, .__sn__field537 = 0LL, .__sn__field538 = 0LL, .__sn__field539 = 0LL, .__sn__field540 = 0LL, .__sn__field541 = 0LL, .__sn__field542 = 0LL, .__sn__field543 = 0LL, .__sn__field544 = 0LL, .__sn__field545 = 0LL, .__sn__field546 = 0LL, .__sn__field547 = 0LL, .__sn__field548 = 0LL, .__sn__field549 = 0LL, .__sn__field550 = 0LL, .__sn__field551 = 0LL, .__sn__field552 = 0LL, .__sn__field553 = 0LL, .__sn__field554 = 0LL, .__sn__field555 = 0LL, .__sn__field556 = 0LL, .__sn__field557 = 0LL, .__sn__field558 = 0LL, .__sn__field559 = 0LL, .__sn__field560 = 0LL, .__sn__field561 = 0LL, .__sn__field562 = 0LL, .__sn__field563 = 0LL, .__sn__field564 = 0LL, .__sn__field565 = 0LL, .__sn__field566 = 0LL, .__sn__field567 = 0LL, .__sn__field568 = 0LL, .__sn__field569 = 0LL, .__sn__field570 = 0LL, .__sn__field571 = 0LL, .__sn__field572 = 0LL, .__sn__field573 = 0LL, .__sn__field574 = 0LL, .__sn__field575 = 0LL, .__sn__field576 = 0LL, .__sn__field577 = 0LL, .__sn__field578 = 0LL, .__sn__field579 = 0LL, .__sn__field580 = 0LL, .__sn__field581 = 0LL, .__sn__field582 = 0LL, .__sn__field583 = 0LL, .__sn__field584 = 0LL, .__sn__field585 = 0LL, .__sn__field586 = 0LL, .__sn__field587 = 0LL, .__sn__field588 = 0LL, .__sn__field589 = 0LL, .__sn__field590 = 0LL, .__sn__field591 = 0LL, .__sn__field592 = 0LL, .__sn__field593 = 0LL, .__sn__field594 = 0LL, .__sn__field595 = 0LL, .__sn__field596 = 0LL, .__sn__field597 = 0LL, .__sn__field598 = 0LL, .__sn__field599 = 0LL, .__sn__field600 = 0LL, .__sn__field601 = 0LL, .__sn__field602 = 0LL, .__sn__field603 = 0LL, .__sn__field604 = 0LL, .__sn__field605 = 0LL, .__sn__field606 = 0LL, .__sn__field607 = 0LL, .__sn__field608 = 0LL, .__sn__field609 = 0LL, .__sn__field610 = 0LL, .__sn__field611 = 0LL, .__sn__field612 = 0LL, .__sn__field613 = 0LL, .__sn__field614 = 0LL, .__sn__field615 = 0LL, .__sn__field616 = 0LL, .__sn__field617 = 0LL, .__sn__field618 = 0LL, .__sn__field619 = 0LL, .__sn__field620 = 0LL, .__sn__field621 = 0LL, .__sn__field622 = 0LL, .__sn__field623 = 0LL, .__sn__field624 = 0LL, .__sn__field625 = 0LL, .__sn__field626 = 0LL, .__sn__field627 = 0LL, .__sn__field628 = 0LL, .__sn__field629 = 0LL, .__sn__field630 = 0LL, .__sn__field631 = 0LL, .__sn__field632 = 0LL, .__sn__field633 = 0LL, .__sn__field634 = 0LL, .__sn__field635 = 0LL, .__sn__field636 = 0LL, .__sn__field637 = 0LL, .__sn__field638 = 0LL, .__sn__field639 = 0LL, .__sn__field640 = 0LL, .__sn__field641 = 0LL, .__sn__field642 = 0LL, .__sn__field643 = 0LL, .__sn__field644 = 0LL, .__sn__field645 = 0LL, .__sn__field646 = 0LL, .__sn__field647 = 0LL, .__sn__field648 = 0LL, .__sn__field649 = 0LL, .__sn__field650 = 0LL, .__sn__field651 = 0LL, .__sn__field652 = 0LL, .__sn__field653 = 0LL, .__sn__field654 = 0LL, .__sn__field655 = 0LL, .__sn__field656 = 0LL, .__sn__field657 = 0LL, .__sn__field658 = 0LL, .__sn__field659 = 0LL, .__sn__field660 = 0LL, .__sn__field661 = 0LL, .__sn__field662 = 0LL, .__sn__field663 = 0LL, .__sn__field664 = 0LL, .__sn__field665 = 0LL, .__sn__field666 = 0LL, .__sn__field667 = 0LL, .__sn__field668 = 0LL, .__sn__field669 = 0LL, .__sn__field670 = 0LL, .__sn__field671 = 0LL, .__sn__field672 = 0LL, .__sn__field673 = 0LL, .__sn__field674 = 0LL, .__sn__field675 = 0LL, .__sn__field676 = 0LL, .__sn__field677 = 0LL, .__sn__field678 = 0LL, .__sn__field679 = 0LL, .__sn__field680 = 0LL, .__sn__field681 = 0LL, .__sn__field682 = 0LL, .__sn__field683 = 0LL, .__sn__field684 = 0LL, .__sn__field685 = 0LL, .__sn__field686 = 0LL, .__sn__field687 = 0LL, .__sn__field688 = 0LL, .__sn__field689 = 0LL, .__sn__field690 = 0LL, .__sn__field691 = 0LL, .__sn__field692 = 0LL, .__sn__field693 = 0LL, .__sn__field694 = 0LL, .__sn__field695 = 0LL, .__sn__field696 = 0LL, .__sn__field697 = 0LL, .__sn__field698 = 0LL, .__sn__field699 = 0LL, .__sn__field700 = 0LL, .__sn__field701 = 0LL, .__sn__field702 = 0LL, .__sn__field703 = 0LL, .__sn__field704 = 0LL, .__sn__field705 = 0LL, .__sn__field706 = 0LL, .__sn__field707 = 0LL, .__sn__field708 = 0LL, .__sn__field709 = 0LL, .__sn__field710 = 0LL, .__sn__field711 = 0LL, .__sn__field712 = 0LL, .__sn__field713 = 0LL, .__sn__field714 = 0LL, .__sn__field715 = 0LL, .__sn__field716 = 0LL, .__sn__field717 = 0LL, .__sn__field718 = 0LL, .__sn__field719 = 0LL, .__sn__field720 = 0LL, .__sn__field721 = 0LL, .__sn__field722 = 0LL, .__sn__field723 = 0LL, .__sn__field724 = 0LL, .__sn__field725 = 0LL, .__sn__field726 = 0LL, .__sn__field727 = 0LL, .__sn__field728 = 0LL, .__sn__field729 = 0LL, .__sn__field730 = 0LL, .__sn__field731 = 0LL, .__sn__field732 = 0LL, .__sn__field733 = 0LL, .__sn__field734 = 0LL, .__sn__field735 = 0LL, .__sn__field736 = 0LL, .__sn__field737 = 0LL, .__sn__field738 = 0LL, .__sn__field739 = 0LL, .__sn__field740 = 0LL, .__sn__field741 = 0LL, .__sn__field742 = 0LL, .__sn__field743 = 0LL, .__sn__field744 = 0LL, .__sn__field745 = 0LL, .__sn__field746 = 0LL, .__sn__field747 = 0LL, .__sn__field748 = 0LL, .__sn__field749 = 0LL, .__sn__field750 = 0LL, .__sn__field751 = 0LL, .__sn__field752 = 0LL, .__sn__field753 = 0LL, .__sn__field754 = 0LL, .__sn__field755 = 0LL, .__sn__field756 = 0LL, .__sn__field757 = 0LL, .__sn__field758 = 0LL, .__sn__field759 = 0LL, .__sn__field760 = 0LL, .__sn__field761 = 0LL, .__sn__field762 = 0LL, .__sn__field763 = 0LL, .__sn__field764 = 0LL, .__sn__field765 = 0LL, .__sn__field766 = 0LL, .__sn__field767 = 0LL, .__sn__field768 = 0LL, .__sn__field769 = 0LL, .__sn__field770 = 0LL, .__sn__field771 = 0LL, .__sn__field772 = 0LL, .__sn__field773 = 0LL, .__sn__field774 = 0LL, .__sn__field775 = 0LL, .__sn__field776 = 0LL, .__sn__field777 = 0LL, .__sn__field778 = 0LL, .__sn__field779 = 0LL, .__sn__field780 = 0LL, .__sn__field781 = 0LL, .__sn__field782 = 0LL, .__sn__field783 = 0LL, .__sn__field784 = 0LL, .__sn__field785 = 0LL, .__sn__field786 = 0LL, .__sn__field787 = 0LL, .__sn__field788 = 0LL, .__sn__field789 = 0LL, .__sn__field790 = 0LL, .__sn__field791 = 0LL, .__sn__field792 = 0LL, .__sn__field793 = 0LL, .__sn__field794 = 0LL, .__sn__field795 = 0LL, .__sn__field796 = 0LL, .__sn__field797 = 0LL, .__sn__field798 = 0LL, .__sn__field799 = 0LL, .__sn__field800 = 0LL, .__sn__field801 = 0LL, .__sn__field802 = 0LL, .__sn__field803 = 0LL, .__sn__field804 = 0LL, .__sn__field805 = 0LL, .__sn__field806 = 0LL, .__sn__field807 = 0LL, .__sn__field808 = 0LL, .__sn__field809 = 0LL, .__sn__field810 = 0LL, .__sn__field811 = 0LL, .__sn__field812 = 0LL, .__sn__field813 = 0LL, .__sn__field814 = 0LL, .__sn__field815 = 0LL, .__sn__field816 = 0LL, .__sn__field817 = 0LL, .__sn__field818 = 0LL, .__sn__field819 = 0LL, .__sn__field820 = 0LL, .__sn__field821 = 0LL, .__sn__field822 = 0LL, .__sn__field823 = 0LL, .__sn__field824 = 0LL, .__sn__field825 = 0LL, .__sn__field826 = 0LL, .__sn__field827 = 0LL, .__sn__field828 = 0LL, .__sn__field829 = 0LL, .__sn__field830 = 0LL, .__sn__field831 = 0LL, .__sn__field832 = 0LL, .__sn__field833 = 0LL, .__sn__field834 = 0LL, .__sn__field835 = 0LL, .__sn__field836 = 0LL, .__sn__field837 = 0LL, .__sn__field838 = 0LL, .__sn__field839 = 0LL, .__sn__field840 = 0LL, .__sn__field841 = 0LL, .__sn__field842 = 0LL, .__sn__field843 = 0LL, .__sn__field844 = 0LL, .__sn__field845 = 0LL, .__sn__field846 = 0LL, .__sn__field847 = 0LL, .__sn__field848 = 0LL, .__sn__field849 = 0LL, .__sn__field850 = 0LL, .__sn__field851 = 0LL, .__sn__field852 = 0LL, .__sn__field853 = 0LL, .__sn__field854 = 0LL, .__sn__field855 = 0LL, .__sn__field856 = 0LL, .__sn__field857 = 0LL, .__sn__field858 = 0LL, .__sn__field859 = 0LL, .__sn__field860 = 0LL, .__sn__field861 = 0LL, .__sn__field862 = 0LL, .__sn__field863 = 0LL, .__sn__field864 = 0LL, .__sn__field865 = 0LL, .__sn__field866 = 0LL, .__sn__field867 = 0LL, .__sn__field868 = 0LL, .__sn__field869 = 0LL, .__sn__field870 = 0LL, .__sn__field871 = 0LL, .__sn__field872 = 0LL, .__sn__field873 = 0LL, .__sn__field874 = 0LL, .__sn__field875 = 0LL, .__sn__field876 = 0LL, .__sn__field877 = 0LL, .__sn__field878 = 0LL, .__sn__field879 = 0LL, .__sn__field880 = 0LL, .__sn__field881 = 0LL, .__sn__field882 = 0LL, .__sn__field883 = 0LL, .__sn__field884 = 0LL, .__sn__field885 = 0LL, .__sn__field886 = 0LL, .__sn__field887 = 0LL, .__sn__field888 = 0LL, .__sn__field889 = 0LL, .__sn__field890 = 0LL, .__sn__field891 = 0LL, .__sn__field892 = 0LL, .__sn__field893 = 0LL, .__sn__field894 = 0LL, .__sn__field895 = 0LL, .__sn__field896 = 0LL, .__sn__field897 = 0LL, .__sn__field898 = 0LL, .__sn__field899 = 0LL, .__sn__field901 = 0LL, .__sn__field902 = 0LL, .__sn__field903 = 0LL, .__sn__field904 = 0LL, .__sn__field905 = 0LL, .__sn__field906 = 0LL, .__sn__field907 = 0LL, .__sn__field908 = 0LL, .__sn__field909 = 0LL, .__sn__field910 = 0LL, .__sn__field911 = 0LL, .__sn__field912 = 0LL, .__sn__field913 = 0LL, .__sn__field914 = 0LL, .__sn__field915 = 0LL, .__sn__field916 = 0LL, .__sn__field917 = 0LL, .__sn__field918 = 0LL, .__sn__field919 = 0LL, .__sn__field920 = 0LL, .__sn__field921 = 0LL, .__sn__field922 = 0LL, .__sn__field923 = 0LL, .__sn__field924 = 0LL, .__sn__field925 = 0LL, .__sn__field926 = 0LL, .__sn__field927 = 0LL, .__sn__field928 = 0LL, .__sn__field929 = 0LL, .__sn__field930 = 0LL, .__sn__field931 = 0LL, .__sn__field932 = 0LL, .__sn__field933 = 0LL, .__sn__field934 = 0LL, .__sn__field935 = 0LL, .__sn__field936 = 0LL, .__sn__field937 = 0LL, .__sn__field938 = 0LL, .__sn__field939 = 0LL, .__sn__field940 = 0LL, .__sn__field941 = 0LL, .__sn__field942 = 0LL, .__sn__field943 = 0LL, .__sn__field944 = 0LL, .__sn__field945 = 0LL, .__sn__field946 = 0LL, .__sn__field947 = 0LL, .__sn__field948 = 0LL, .__sn__field949 = 0LL, .__sn__field950 = 0LL, .__sn__field951 = 0LL, .__sn__field952 = 0LL, .__sn__field953 = 0LL, .__sn__field954 = 0LL, .__sn__field955 = 0LL, .__sn__field956 = 0LL, .__sn__field957 = 0LL, .__sn__field958 = 0LL, .__sn__field959 = 0LL, .__sn__field960 = 0LL, .__sn__field961 = 0LL, .__sn__field962 = 0LL, .__sn__field963 = 0LL, .__sn__field964 = 0LL, .__sn__field965 = 0LL, .__sn__field966 = 0LL, .__sn__field967 = 0LL, .__sn__field968 = 0LL, .__sn__field969 = 0LL, .__sn__field970 = 0LL, .__sn__field971 = 0LL, .__sn__field972 = 0LL, .__sn__field973 = 0LL, .__sn__field974 = 0LL, .__sn__field975 = 0LL, .__sn__field976 = 0LL, .__sn__field977 = 0LL, .__sn__field978 = 0LL, .__sn__field979 = 0LL, .__sn__field980 = 0LL, .__sn__field981 = 0LL, .__sn__field982 = 0LL, .__sn__field983 = 0LL, .__sn__field984 = 0LL, .__sn__field985 = 0LL, .__sn__field986 = 0LL, .__sn__field987 = 0LL, .__sn__field988 = 0LL, .__sn__field989 = 0LL, .__sn__field990 = 0LL, .__sn__field991 = 0LL, .__sn__field992 = 0LL, .__sn__field993 = 0LL, .__sn__field994 = 0LL, .__sn__field995 = 0LL, .__sn__field996 = 0LL, .__sn__field997 = 0LL, .__sn__field998 = 0LL, .__sn__field999 = 0LL, .__sn__field1000 = 0LL, .__sn__field1001 = 0LL, .__sn__field1002 = 0LL, .__sn__field1003 = 0LL, .__sn__field1004 = 0LL, .__sn__field1005 = 0LL, .__sn__field1006 = 0LL, .__sn__field1007 = 0LL, .__sn__field1008 = 0LL, .__sn__field1009 = 0LL, .__sn__field1010 = 0LL, .__sn__field1011 = 0LL, .__sn__field1012 = 0LL, .__sn__field1013 = 0LL, .__sn__field1014 = 0LL, .__sn__field1015 = 0LL, .__sn__field1016 = 0LL, .__sn__field1017 = 0LL, .__sn__field1018 = 0LL, .__sn__field1019 = 0LL, .__sn__field1020 = 0LL, .__sn__field1021 = 0LL, .__sn__field1022 = 0LL, .__sn__field1023 = 0LL };
+
+    if ((__sn__data.__sn__field100 != 100LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: data.field100 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__data.__sn__field100));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 100\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__data.__sn__field500 != 500LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: data.field500 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__data.__sn__field500));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 500\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__data.__sn__field900 != 900LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: data.field900 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__data.__sn__field900));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 900\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Field access test: PASS\n");
+    
+}
+
+
+void __sn__test_large_struct_modification() {
+
+    __sn__LargeStruct __sn__data = (__sn__LargeStruct){ .__sn__field0 = 0LL, .__sn__field1 = 0LL, .__sn__field2 = 0LL, .__sn__field3 = 0LL, .__sn__field4 = 0LL, .__sn__field5 = 0LL, .__sn__field6 = 0LL, .__sn__field7 = 0LL, .__sn__field8 = 0LL, .__sn__field9 = 0LL, .__sn__field10 = 0LL, .__sn__field11 = 0LL, .__sn__field12 = 0LL, .__sn__field13 = 0LL, .__sn__field14 = 0LL, .__sn__field15 = 0LL, .__sn__field16 = 0LL, .__sn__field17 = 0LL, .__sn__field18 = 0LL, .__sn__field19 = 0LL, .__sn__field20 = 0LL, .__sn__field21 = 0LL, .__sn__field22 = 0LL, .__sn__field23 = 0LL, .__sn__field24 = 0LL, .__sn__field25 = 0LL, .__sn__field26 = 0LL, .__sn__field27 = 0LL, .__sn__field28 = 0LL, .__sn__field29 = 0LL, .__sn__field30 = 0LL, .__sn__field31 = 0LL, .__sn__field32 = 0LL, .__sn__field33 = 0LL, .__sn__field34 = 0LL, .__sn__field35 = 0LL, .__sn__field36 = 0LL, .__sn__field37 = 0LL, .__sn__field38 = 0LL, .__sn__field39 = 0LL, .__sn__field40 = 0LL, .__sn__field41 = 0LL, .__sn__field42 = 0LL, .__sn__field43 = 0LL, .__sn__field44 = 0LL, .__sn__field45 = 0LL, .__sn__field46 = 0LL, .__sn__field47 = 0LL, .__sn__field48 = 0LL, .__sn__field49 = 0LL, .__sn__field50 = 0LL, .__sn__field51 = 0LL, .__sn__field52 = 0LL, .__sn__field53 = 0LL, .__sn__field54 = 0LL, .__sn__field55 = 0LL, .__sn__field56 = 0LL, .__sn__field57 = 0LL, .__sn__field58 = 0LL, .__sn__field59 = 0LL, .__sn__field60 = 0LL, .__sn__field61 = 0LL, .__sn__field62 = 0LL, .__sn__field63 = 0LL, .__sn__field64 = 0LL, .__sn__field65 = 0LL, .__sn__field66 = 0LL, .__sn__field67 = 0LL, .__sn__field68 = 0LL, .__sn__field69 = 0LL, .__sn__field70 = 0LL, .__sn__field71 = 0LL, .__sn__field72 = 0LL, .__sn__field73 = 0LL, .__sn__field74 = 0LL, .__sn__field75 = 0LL, .__sn__field76 = 0LL, .__sn__field77 = 0LL, .__sn__field78 = 0LL, .__sn__field79 = 0LL, .__sn__field80 = 0LL, .__sn__field81 = 0LL, .__sn__field82 = 0LL, .__sn__field83 = 0LL, .__sn__field84 = 0LL, .__sn__field85 = 0LL, .__sn__field86 = 0LL, .__sn__field87 = 0LL, .__sn__field88 = 0LL, .__sn__field89 = 0LL, .__sn__field90 = 0LL, .__sn__field91 = 0LL, .__sn__field92 = 0LL, .__sn__field93 = 0LL, .__sn__field94 = 0LL, .__sn__field95 = 0LL, .__sn__field96 = 0LL, .__sn__field97 = 0LL, .__sn__field98 = 0LL, .__sn__field99 = 0LL, .__sn__field100 = 0LL, .__sn__field101 = 0LL, .__sn__field102 = 0LL, .__sn__field103 = 0LL, .__sn__field104 = 0LL, .__sn__field105 = 0LL, .__sn__field106 = 0LL, .__sn__field107 = 0LL, .__sn__field108 = 0LL, .__sn__field109 = 0LL, .__sn__field110 = 0LL, .__sn__field111 = 0LL, .__sn__field112 = 0LL, .__sn__field113 = 0LL, .__sn__field114 = 0LL, .__sn__field115 = 0LL, .__sn__field116 = 0LL, .__sn__field117 = 0LL, .__sn__field118 = 0LL, .__sn__field119 = 0LL, .__sn__field120 = 0LL, .__sn__field121 = 0LL, .__sn__field122 = 0LL, .__sn__field123 = 0LL, .__sn__field124 = 0LL, .__sn__field125 = 0LL, .__sn__field126 = 0LL, .__sn__field127 = 0LL, .__sn__field128 = 0LL, .__sn__field129 = 0LL, .__sn__field130 = 0LL, .__sn__field131 = 0LL, .__sn__field132 = 0LL, .__sn__field133 = 0LL, .__sn__field134 = 0LL, .__sn__field135 = 0LL, .__sn__field136 = 0LL, .__sn__field137 = 0LL, .__sn__field138 = 0LL, .__sn__field139 = 0LL, .__sn__field140 = 0LL, .__sn__field141 = 0LL, .__sn__field142 = 0LL, .__sn__field143 = 0LL, .__sn__field144 = 0LL, .__sn__field145 = 0LL, .__sn__field146 = 0LL, .__sn__field147 = 0LL, .__sn__field148 = 0LL, .__sn__field149 = 0LL, .__sn__field150 = 0LL, .__sn__field151 = 0LL, .__sn__field152 = 0LL, .__sn__field153 = 0LL, .__sn__field154 = 0LL, .__sn__field155 = 0LL, .__sn__field156 = 0LL, .__sn__field157 = 0LL, .__sn__field158 = 0LL, .__sn__field159 = 0LL, .__sn__field160 = 0LL, .__sn__field161 = 0LL, .__sn__field162 = 0LL, .__sn__field163 = 0LL, .__sn__field164 = 0LL, .__sn__field165 = 0LL, .__sn__field166 = 0LL, .__sn__field167 = 0LL, .__sn__field168 = 0LL, .__sn__field169 = 0LL, .__sn__field170 = 0LL, .__sn__field171 = 0LL, .__sn__field172 = 0LL, .__sn__field173 = 0LL, .__sn__field174 = 0LL, .__sn__field175 = 0LL, .__sn__field176 = 0LL, .__sn__field177 = 0LL, .__sn__field178 = 0LL, .__sn__field179 = 0LL, .__sn__field180 = 0LL, .__sn__field181 = 0LL, .__sn__field182 = 0LL, .__sn__field183 = 0LL, .__sn__field184 = 0LL, .__sn__field185 = 0LL, .__sn__field186 = 0LL, .__sn__field187 = 0LL, .__sn__field188 = 0LL, .__sn__field189 = 0LL, .__sn__field190 = 0LL, .__sn__field191 = 0LL, .__sn__field192 = 0LL, .__sn__field193 = 0LL, .__sn__field194 = 0LL, .__sn__field195 = 0LL, .__sn__field196 = 0LL, .__sn__field197 = 0LL, .__sn__field198 = 0LL, .__sn__field199 = 0LL, .__sn__field200 = 0LL, .__sn__field201 = 0LL, .__sn__field202 = 0LL, .__sn__field203 = 0LL, .__sn__field204 = 0LL, .__sn__field205 = 0LL, .__sn__field206 = 0LL, .__sn__field207 = 0LL, .__sn__field208 = 0LL, .__sn__field209 = 0LL, .__sn__field210 = 0LL, .__sn__field211 = 0LL, .__sn__field212 = 0LL, .__sn__field213 = 0LL, .__sn__field214 = 0LL, .__sn__field215 = 0LL, .__sn__field216 = 0LL, .__sn__field217 = 0LL, .__sn__field218 = 0LL, .__sn__field219 = 0LL, .__sn__field220 = 0LL, .__sn__field221 = 0LL, .__sn__field222 = 0LL, .__sn__field223 = 0LL, .__sn__field224 = 0LL, .__sn__field225 = 0LL, .__sn__field226 = 0LL, .__sn__field227 = 0LL, .__sn__field228 = 0LL, .__sn__field229 = 0LL, .__sn__field230 = 0LL, .__sn__field231 = 0LL, .__sn__field232 = 0LL, .__sn__field233 = 0LL, .__sn__field234 = 0LL, .__sn__field235 = 0LL, .__sn__field236 = 0LL, .__sn__field237 = 0LL, .__sn__field238 = 0LL, .__sn__field239 = 0LL, .__sn__field240 = 0LL, .__sn__field241 = 0LL, .__sn__field242 = 0LL, .__sn__field243 = 0LL, .__sn__field244 = 0LL, .__sn__field245 = 0LL, .__sn__field246 = 0LL, .__sn__field247 = 0LL, .__sn__field248 = 0LL, .__sn__field249 = 0LL, .__sn__field250 = 0LL, .__sn__field251 = 0LL, .__sn__field252 = 0LL, .__sn__field253 = 0LL, .__sn__field254 = 0LL, .__sn__field255 = 0LL, .__sn__field256 = 0LL, .__sn__field257 = 0LL, .__sn__field258 = 0LL, .__sn__field259 = 0LL, .__sn__field260 = 0LL, .__sn__field261 = 0LL, .__sn__field262 = 0LL, .__sn__field263 = 0LL, .__sn__field264 = 0LL, .__sn__field265 = 0LL, .__sn__field266 = 0LL, .__sn__field267 = 0LL, .__sn__field268 = 0LL, .__sn__field269 = 0LL, .__sn__field270 = 0LL, .__sn__field271 = 0LL, .__sn__field272 = 0LL, .__sn__field273 = 0LL, .__sn__field274 = 0LL, .__sn__field275 = 0LL, .__sn__field276 = 0LL, .__sn__field277 = 0LL, .__sn__field278 = 0LL, .__sn__field279 = 0LL, .__sn__field280 = 0LL, .__sn__field281 = 0LL, .__sn__field282 = 0LL, .__sn__field283 = 0LL, .__sn__field284 = 0LL, .__sn__field285 = 0LL, .__sn__field286 = 0LL, .__sn__field287 = 0LL, .__sn__field288 = 0LL, .__sn__field289 = 0LL, .__sn__field290 = 0LL, .__sn__field291 = 0LL, .__sn__field292 = 0LL, .__sn__field293 = 0LL, .__sn__field294 = 0LL, .__sn__field295 = 0LL, .__sn__field296 = 0LL, .__sn__field297 = 0LL, .__sn__field298 = 0LL, .__sn__field299 = 0LL, .__sn__field300 = 0LL, .__sn__field301 = 0LL, .__sn__field302 = 0LL, .__sn__field303 = 0LL, .__sn__field304 = 0LL, .__sn__field305 = 0LL, .__sn__field306 = 0LL, .__sn__field307 = 0LL, .__sn__field308 = 0LL, .__sn__field309 = 0LL, .__sn__field310 = 0LL, .__sn__field311 = 0LL, .__sn__field312 = 0LL, .__sn__field313 = 0LL, .__sn__field314 = 0LL, .__sn__field315 = 0LL, .__sn__field316 = 0LL, .__sn__field317 = 0LL, .__sn__field318 = 0LL, .__sn__field319 = 0LL, .__sn__field320 = 0LL, .__sn__field321 = 0LL, .__sn__field322 = 0LL, .__sn__field323 = 0LL, .__sn__field324 = 0LL, .__sn__field325 = 0LL, .__sn__field326 = 0LL, .__sn__field327 = 0LL, .__sn__field328 = 0LL, .__sn__field329 = 0LL, .__sn__field330 = 0LL, .__sn__field331 = 0LL, .__sn__field332 = 0LL, .__sn__field333 = 0LL, .__sn__field334 = 0LL, .__sn__field335 = 0LL, .__sn__field336 = 0LL, .__sn__field337 = 0LL, .__sn__field338 = 0LL, .__sn__field339 = 0LL, .__sn__field340 = 0LL, .__sn__field341 = 0LL, .__sn__field342 = 0LL, .__sn__field343 = 0LL, .__sn__field344 = 0LL, .__sn__field345 = 0LL, .__sn__field346 = 0LL, .__sn__field347 = 0LL, .__sn__field348 = 0LL, .__sn__field349 = 0LL, .__sn__field350 = 0LL, .__sn__field351 = 0LL, .__sn__field352 = 0LL, .__sn__field353 = 0LL, .__sn__field354 = 0LL, .__sn__field355 = 0LL, .__sn__field356 = 0LL, .__sn__field357 = 0LL, .__sn__field358 = 0LL, .__sn__field359 = 0LL, .__sn__field360 = 0LL, .__sn__field361 = 0LL, .__sn__field362 = 0LL, .__sn__field363 = 0LL, .__sn__field364 = 0LL, .__sn__field365 = 0LL, .__sn__field366 = 0LL, .__sn__field367 = 0LL, .__sn__field368 = 0LL, .__sn__field369 = 0LL, .__sn__field370 = 0LL, .__sn__field371 = 0LL, .__sn__field372 = 0LL, .__sn__field373 = 0LL, .__sn__field374 = 0LL, .__sn__field375 = 0LL, .__sn__field376 = 0LL, .__sn__field377 = 0LL, .__sn__field378 = 0LL, .__sn__field379 = 0LL, .__sn__field380 = 0LL, .__sn__field381 = 0LL, .__sn__field382 = 0LL, .__sn__field383 = 0LL, .__sn__field384 = 0LL, .__sn__field385 = 0LL, .__sn__field386 = 0LL, .__sn__field387 = 0LL, .__sn__field388 = 0LL, .__sn__field389 = 0LL, .__sn__field390 = 0LL, .__sn__field391 = 0LL, .__sn__field392 = 0LL, .__sn__field393 = 0LL, .__sn__field394 = 0LL, .__sn__field395 = 0LL, .__sn__field396 = 0LL, .__sn__field397 = 0LL, .__sn__field398 = 0LL, .__sn__field399 = 0LL, .__sn__field400 = 0LL, .__sn__field401 = 0LL, .__sn__field402 = 0LL, .__sn__field403 = 0LL, .__sn__field404 = 0LL, .__sn__field405 = 0LL, .__sn__field406 = 0LL, .__sn__field407 = 0LL, .__sn__field408 = 0LL, .__sn__field409 = 0LL, .__sn__field410 = 0LL, .__sn__field411 = 0LL, .__sn__field412 = 0LL, .__sn__field413 = 0LL, .__sn__field414 = 0LL, .__sn__field415 = 0LL, .__sn__field416 = 0LL, .__sn__field417 = 0LL, .__sn__field418 = 0LL, .__sn__field419 = 0LL, .__sn__field420 = 0LL, .__sn__field421 = 0LL, .__sn__field422 = 0LL, .__sn__field423 = 0LL, .__sn__field424 = 0LL, .__sn__field425 = 0LL, .__sn__field426 = 0LL, .__sn__field427 = 0LL, .__sn__field428 = 0LL, .__sn__field429 = 0LL, .__sn__field430 = 0LL, .__sn__field431 = 0LL, .__sn__field432 = 0LL, .__sn__field433 = 0LL, .__sn__field434 = 0LL, .__sn__field435 = 0LL, .__sn__field436 = 0LL, .__sn__field437 = 0LL, .__sn__field438 = 0LL, .__sn__field439 = 0LL, .__sn__field440 = 0LL, .__sn__field441 = 0LL, .__sn__field442 = 0LL, .__sn__field443 = 0LL, .__sn__field444 = 0LL, .__sn__field445 = 0LL, .__sn__field446 = 0LL, .__sn__field447 = 0LL, .__sn__field448 = 0LL, .__sn__field449 = 0LL, .__sn__field450 = 0LL, .__sn__field451 = 0LL, .__sn__field452 = 0LL, .__sn__field453 = 0LL, .__sn__field454 = 0LL, .__sn__field455 = 0LL, .__sn__field456 = 0LL, .__sn__field457 = 0LL, .__sn__field458 = 0LL, .__sn__field459 = 0LL, .__sn__field460 = 0LL, .__sn__field461 = 0LL, .__sn__field462 = 0LL, .__sn__field463 = 0LL, .__sn__field464 = 0LL, .__sn__field465 = 0LL, .__sn__field466 = 0LL, .__sn__field467 = 0LL, .__sn__field468 = 0LL, .__sn__field469 = 0LL, .__sn__field470 = 0LL, .__sn__field471 = 0LL, .__sn__field472 = 0LL, .__sn__field473 = 0LL, .__sn__field474 = 0LL, .__sn__field475 = 0LL, .__sn__field476 = 0LL, .__sn__field477 = 0LL, .__sn__field478 = 0LL, .__sn__field479 = 0LL, .__sn__field480 = 0LL, .__sn__field481 = 0LL, .__sn__field482 = 0LL, .__sn__field483 = 0LL, .__sn__field484 = 0LL, .__sn__field485 = 0LL, .__sn__field486 = 0LL, .__sn__field487 = 0LL, .__sn__field488 = 0LL, .__sn__field489 = 0LL, .__sn__field490 = 0LL, .__sn__field491 = 0LL, .__sn__field492 = 0LL, .__sn__field493 = 0LL, .__sn__field494 = 0LL, .__sn__field495 = 0LL, .__sn__field496 = 0LL, .__sn__field497 = 0LL, .__sn__field498 = 0LL, .__sn__field499 = 0LL, .__sn__field500 = 0LL, .__sn__field501 = 0LL, .__sn__field502 = 0LL, .__sn__field503 = 0LL, .__sn__field504 = 0LL, .__sn__field505 = 0LL, .__sn__field506 = 0LL, .__sn__field507 = 0LL, .__sn__field508 = 0LL, .__sn__field509 = 0LL, .__sn__field510 = 0LL, .__sn__field511 = 0LL, .__sn__field512 = 0LL, .__sn__field513 = 0LL, .__sn__field514 = 0LL, .__sn__field515 = 0LL, .__sn__field516 = 0LL, .__sn__field517 = 0LL, .__sn__field518 = 0LL, .__sn__field519 = 0LL, .__sn__field520 = 0LL, .__sn__field521 = 0LL, .__sn__field522 = 0LL, .__sn__field523 = 0LL, .__sn__field524 = 0LL, .__sn__field525 = 0LL, .__sn__field526 = 0LL, .__sn__field527 = 0LL, .__sn__field528 = 0LL, .__sn__field529 = 0LL, .__sn__field530 = 0LL, .__sn__field531 = 0LL, .__sn__field532 = 0LL, .__sn__field533 = 0LL, .__sn__field534 = 0LL, .__sn__field535 = 0LL, .__sn__field536 = 0LL, .__sn__field537 = 0LL, .__sn__field538 = 0LL, .__sn__field539 = 0LL, .__sn__field540 = 0LL, .__sn__field541 = 0LL, .__sn__field542 = 0LL, .__sn__field543 = 0LL, .__sn__field544 = 0LL, .__sn__field545 = 0LL, .__sn__field546 = 0LL, .__sn__field547 = 0LL, .__sn__field548 = 0LL, .__sn__field549 = 0LL, .__sn__field550 = 0LL, .__sn__field551 = 0LL, .__sn__field552 = 0LL, .__sn__field553 = 0LL, .__sn__field554 = 0LL, .__sn__field555 = 0LL, .__sn__field556 = 0LL, .__sn__field557 = 0LL, .__sn__field558 = 0LL, .__sn__field559 = 0LL, .__sn__field560 = 0LL, .__sn__field561 = 0LL, .__sn__field562 = 0LL, .__sn__field563 = 0LL, .__sn__field564 = 0LL, .__sn__field565 = 0LL, .__sn__field566 = 0LL, .__sn__field567 = 0LL, .__sn__field568 = 0LL, .__sn__field569 = 0LL, .__sn__field570 = 0LL, .__sn__field571 = 0LL, .__sn__field572 = 0LL, .__sn__field573 = 0LL, .__sn__field574 = 0LL, .__sn__field575 = 0LL, .__sn__field576 = 0LL, .__sn__field577 = 0LL, .__sn__field578 = 0LL, .__sn__field579 = 0LL, .__sn__field580 = 0LL, .__sn__field581 = 0LL, .__sn__field582 = 0LL, .__sn__field583 = 0LL, .__sn__field584 = 0LL, .__sn__field585 = 0LL, .__sn__field586 = 0LL, .__sn__field587 = 0LL, .__sn__field588 = 0LL, .__sn__field589 = 0LL, .__sn__field590 = 0LL, .__sn__field591 = 0LL, .__sn__field592 = 0LL, .__sn__field593 = 0LL, .__sn__field594 = 0LL, .__sn__field595 = 0LL, .__sn__field596 = 0LL, .__sn__field597 = 0LL, .__sn__field598 = 0LL, .__sn__field599 = 0LL, .__sn__field600 = 0LL, .__sn__field601 = 0LL, .__sn__field602 = 0LL, .__sn__field603 = 0LL, .__sn__field604 = 0LL, .__sn__field605 = 0LL, .__sn__field606 = 0LL, .__sn__field607 = 0LL, .__sn__field608 = 0LL, .__sn__field609 = 0LL, .__sn__field610 = 0LL, .__sn__field611 = 0LL, .__sn__field612 = 0LL, .__sn__field613 = 0LL, .__sn__field614 = 0LL, .__sn__field615 = 0LL, .__sn__field616 = 0LL, .__sn__field617 = 0LL, .__sn__field618 = 0LL, .__sn__field619 = 0LL, .__sn__field620 = 0LL, .__sn__field621 = 0LL, .__sn__field622 = 0LL, .__sn__field623 = 0LL, .__sn__field624 = 0LL, .__sn__field625 = 0LL, .__sn__field626 = 0LL, .__sn__field627 = 0LL, .__sn__field628 = 0LL, .__sn__field629 = 0LL, .__sn__field630 = 0LL, .__sn__field631 = 0LL, .__sn__field632 = 0LL, .__sn__field633 = 0LL, .__sn__field634 = 0LL, .__sn__field635 = 0LL, .__sn__field636 = 0LL, .__sn__field637 = 0LL, .__sn__field638 = 0LL, .__sn__field639 = 0LL, .__sn__field640 = 0LL, .__sn__field641 = 0LL, .__sn__field642 = 0LL, .__sn__field643 = 0LL, .__sn__field644 = 0LL, .__sn__field645 = 0LL, .__sn__field646 = 0LL, .__sn__field647 = 0LL, .__sn__field648 = 0LL, .__sn__field649 = 0LL, .__sn__field650 = 0LL, .__sn__field651 = 0LL, .__sn__field652 = 0LL, .__sn__field653 = 0LL, .__sn__field654 = 0LL, .__sn__field655 = 0LL, .__sn__field656 = 0LL, .__sn__field657 = 0LL, .__sn__field658 = 0LL, .__sn__field659 = 0LL, .__sn__field660 = 0LL, .__sn__field661 = 0LL, .__sn__field662 = 0LL, .__sn__field663 = 0LL, .__sn__field664 = 0LL, .__sn__field665 = 0LL, .__sn__field666 = 0LL, .__sn__field667 = 0LL, .__sn__field668 = 0LL, .__sn__field669 = 0LL, .__sn__field670 = 0LL, .__sn__field671 = 0LL, .__sn__field672 = 0LL, .__sn__field673 = 0LL, .__sn__field674 = 0LL, .__sn__field675 = 0LL, .__sn__field676 = 0LL, .__sn__field677 = 0LL, .__sn__field678 = 0LL, .__sn__field679 = 0LL, .__sn__field680 = 0LL, .__sn__field681 = 0LL, .__sn__field682 = 0LL, .__sn__field683 = 0LL, .__sn__field684 = 0LL, .__sn__field685 = 0LL, .__sn__field686 = 0LL, .__sn__field687 = 0LL, .__sn__field688 = 0LL, .__sn__field689 = 0LL, .__sn__field690 = 0LL, .__sn__field691 = 0LL, .__sn__field692 = 0LL, .__sn__field693 = 0LL, .__sn__field694 = 0LL, .__sn__field695 = 0LL, .__sn__field696 = 0LL, .__sn__field697 = 0LL, .__sn__field698 = 0LL, .__sn__field699 = 0LL, .__sn__field700 = 0LL, .__sn__field701 = 0LL, .__sn__field702 = 0LL, .__sn__field703 = 0LL, .__sn__field704 = 0LL, .__sn__field705 = 0LL, .__sn__field706 = 0LL, .__sn__field707 = 0LL, .__sn__field708 = 0LL, .__sn__field709 = 0LL, .__sn__field710 = 0LL, .__sn__field711 = 0LL, .__sn__field712 = 0LL, .__sn__field713 = 0LL, .__sn__field714 = 0LL, .__sn__field715 = 0LL, .__sn__field716 = 0LL, .__sn__field717 = 0LL, .__sn__field718 = 0LL, .__sn__field719 = 0LL, .__sn__field720 = 0LL, .__sn__field721 = 0LL, .__sn__field722 = 0LL, .__sn__field723 = 0LL, .__sn__field724 = 0LL, .__sn__field725 = 0LL, .__sn__field726 = 0LL, .__sn__field727 = 0LL, .__sn__field728 = 0LL, .__sn__field729 = 0LL, .__sn__field730 = 0LL, .__sn__field731 = 0LL, .__sn__field732 = 0LL, .__sn__field733 = 0LL, .__sn__field734 = 0LL, .__sn__field735 = 0LL, .__sn__field736 = 0LL, .__sn__field737 = 0LL, .__sn__field738 = 0LL, .__sn__field739 = 0LL, .__sn__field740 = 0LL, .__sn__field741 = 0LL, .__sn__field742 = 0LL, .__sn__field743 = 0LL, .__sn__field744 = 0LL, .__sn__field745 = 0LL, .__sn__field746 = 0LL, .__sn__field747 = 0LL, .__sn__field748 = 0LL, .__sn__field749 = 0LL, .__sn__field750 = 0LL, .__sn__field751 = 0LL, .__sn__field752 = 0LL, .__sn__field753 = 0LL, .__sn__field754 = 0LL, .__sn__field755 = 0LL, .__sn__field756 = 0LL, .__sn__field757 = 0LL, .__sn__field758 = 0LL, .__sn__field759 = 0LL, .__sn__field760 = 0LL, .__sn__field761 = 0LL, .__sn__field762 = 0LL, .__sn__field763 = 0LL, .__sn__field764 = 0LL, .__sn__field765 = 0LL, .__sn__field766 = 0LL, .__sn__field767 = 0LL, .__sn__field768 = 0LL, .__sn__field769 = 0LL, .__sn__field770 = 0LL, .__sn__field771 = 0LL, .__sn__field772 = 0LL, .__sn__field773 = 0LL, .__sn__field774 = 0LL, .__sn__field775 = 0LL, .__sn__field776 = 0LL, .__sn__field777 = 0LL, .__sn__field778 = 0LL, .__sn__field779 = 0LL, .__sn__field780 = 0LL, .__sn__field781 = 0LL, .__sn__field782 = 0LL, .__sn__field783 = 0LL, .__sn__field784 = 0LL, .__sn__field785 = 0LL, .__sn__field786 = 0LL, .__sn__field787 = 0LL, .__sn__field788 = 0LL, .__sn__field789 = 0LL, .__sn__field790 = 0LL, .__sn__field791 = 0LL, .__sn__field792 = 0LL, .__sn__field793 = 0LL, .__sn__field794 = 0LL, .__sn__field795 = 0LL, .__sn__field796 = 0LL, .__sn__field797 = 0LL, .__sn__field798 = 0LL, .__sn__field799 = 0LL, .__sn__field800 = 0LL, .__sn__field801 = 0LL, .__sn__field802 = 0LL, .__sn__field803 = 0LL, .__sn__field804 = 0LL, .__sn__field805 = 0LL, .__sn__field806 = 0LL, .__sn__field807 = 0LL, .__sn__field808 = 0LL, .__sn__field809 = 0LL, .__sn__field810 = 0LL, .__sn__field811 = 0LL, .__sn__field812 = 0LL, .__sn__field813 = 0LL, .__sn__field814 = 0LL, .__sn__field815 = 0LL, .__sn__field816 = 0LL, .__sn__field817 = 0LL, .__sn__field818 = 0LL, .__sn__field819 = 0LL, .__sn__field820 = 0LL, .__sn__field821 = 0LL, .__sn__field822 = 0LL, .__sn__field823 = 0LL, .__sn__field824 = 0LL, .__sn__field825 = 0LL, .__sn__field826 = 0LL, .__sn__field827 = 0LL, .__sn__field828 = 0LL, .__sn__field829 = 0LL, .__sn__field830 = 0LL, .__sn__field831 = 0LL, .__sn__field832 = 0LL, .__sn__field833 = 0LL, .__sn__field834 = 0LL, .__sn__field835 = 0LL, .__sn__field836 = 0LL, .__sn__field837 = 0LL, .__sn__field838 = 0LL, .__sn__field839 = 0LL, .__sn__field840 = 0LL, .__sn__field841 = 0LL, .__sn__field842 = 0LL, .__sn__field843 = 0LL, .__sn__field844 = 0LL, .__sn__field845 = 0LL, .__sn__field846 = 0LL, .__sn__field847 = 0LL, .__sn__field848 = 0LL, .__sn__field849 = 0LL, .__sn__field850 = 0LL, .__sn__field851 = 0LL, .__sn__field852 = 0LL, .__sn__field853 = 0LL, .__sn__field854 = 0LL, .__sn__field855 = 0LL, .__sn__field856 = 0LL, .__sn__field857 = 0LL, .__sn__field858 = 0LL, .__sn__field859 = 0LL, .__sn__field860 = 0LL, .__sn__field861 = 0LL, .__sn__field862 = 0LL, .__sn__field863 = 0LL, .__sn__field864 = 0LL, .__sn__field865 = 0LL, .__sn__field866 = 0LL, .__sn__field867 = 0LL, .__sn__field868 = 0LL, .__sn__field869 = 0LL, .__sn__field870 = 0LL, .__sn__field871 = 0LL, .__sn__field872 = 0LL, .__sn__field873 = 0LL, .__sn__field874 = 0LL, .__sn__field875 = 0LL, .__sn__field876 = 0LL, .__sn__field877 = 0LL, .__sn__field878 = 0LL, .__sn__field879 = 0LL, .__sn__field880 = 0LL, .__sn__field881 = 0LL, .__sn__field882 = 0LL, .__sn__field883 = 0LL, .__sn__field884 = 0LL, .__sn__field885 = 0LL, .__sn__field886 = 0LL, .__sn__field887 = 0LL, .__sn__field888 = 0LL, .__sn__field889 = 0LL, .__sn__field890 = 0LL, .__sn__field891 = 0LL, .__sn__field892 = 0LL, .__sn__field893 = 0LL, .__sn__field894 = 0LL, .__sn__field895 = 0LL, .__sn__field896 = 0LL, .__sn__field897 = 0LL, .__sn__field898 = 0LL, .__sn__field899 = 0LL, .__sn__field900 = 0LL, .__sn__field901 = 0LL, .__sn__field902 = 0LL, .__sn__field903 = 0LL, .__sn__field904 = 0LL, .__sn__field905 = 0LL, .__sn__field906 = 0LL, .__sn__field907 = 0LL, .__sn__field908 = 0LL, .__sn__field909 = 0LL, .__sn__field910 = 0LL, .__sn__field911 = 0LL, .__sn__field912 = 0LL, .__sn__field913 = 0LL, .__sn__field914 = 0LL, .__sn__field915 = 0LL, .__sn__field916 = 0LL, .__sn__field917 = 0LL, .__sn__field918 = 0LL, .__sn__field919 = 0LL, .__sn__field920 = 0LL, .__sn__field921 = 0LL, .__sn__field922 = 0LL, .__sn__field923 = 0LL, .__sn__field924 = 0LL, .__sn__field925 = 0LL, .__sn__field926 = 0LL, .__sn__field927 = 0LL, .__sn__field928 = 0LL, .__sn__field929 = 0LL, .__sn__field930 = 0LL, .__sn__field931 = 0LL, .__sn__field932 = 0LL, .__sn__field933 = 0LL, .__sn__field934 = 0LL, .__sn__field935 = 0LL, .__sn__field936 = 0LL, .__sn__field937 = 0LL, .__sn__field938 = 0LL, .__sn__field939 = 0LL, .__sn__field940 = 0LL, .__sn__field941 = 0LL, .__sn__field942 = 0LL, .__sn__field943 = 0LL, .__sn__field944 = 0LL, .__sn__field945 = 0LL, .__sn__field946 = 0LL, .__sn__field947 = 0LL, .__sn__field948 = 0LL, .__sn__field949 = 0LL, .__sn__field950 = 0LL, .__sn__field951 = 0LL, .__sn__field952 = 0LL, .__sn__field953 = 0LL, .__sn__field954 = 0LL, .__sn__field955 = 0LL, .__sn__field956 = 0LL, .__sn__field957 = 0LL, .__sn__field958 = 0LL, .__sn__field959 = 0LL, .__sn__field960 = 0LL, .__sn__field961 = 0LL, .__sn__field962 = 0LL, .__sn__field963 = 0LL, .__sn__field964 = 0LL, .__sn__field965 = 0LL, .__sn__field966 = 0LL, .__sn__field967 = 0LL, .__sn__field968 = 0LL, .__sn__field969 = 0LL, .__sn__field970 = 0LL, .__sn__field971 = 0LL, .__sn__field972 = 0LL, .__sn__field973 = 0LL, .__sn__field974 = 0LL, .__sn__field975 = 0LL, .__sn__field976 = 0LL, .__sn__field977 = 0LL, .__sn__field978 = 0LL, .__sn__field979 = 0LL, .__sn__field980 = 0LL, .__sn__field981 = 0LL, .__sn__field982 = 0LL, .__sn__field983 = 0LL, .__sn__field984 = 0LL, .__sn__field985 = 0LL, .__sn__field986 = 0LL, .__sn__field987 = 0LL, .__sn__field988 = 0LL, .__sn__field989 = 0LL, .__sn__field990 = 0LL, .__sn__field991 = 0LL, .__sn__field992 = 0LL, .__sn__field993 = 0LL, .__sn__field994 = 0LL, .__sn__field995 = 0LL, .__sn__field996 = 0LL, .__sn__field997 = 0LL, .__sn__field998 = 0LL, .__sn__field999 = 0LL, .__sn__field1000 = 0LL, .__sn__field1001 = 0LL, .__sn__field1002 = 0LL, .__sn__field1003 = 0LL, .__sn__field1004 = 0LL, .__sn__field1005 = 0LL, .__sn__field1006 = 0LL, .__sn__field1007 = 0LL, .__sn__field1008 = 0LL, .__sn__field1009 = 0LL, .__sn__field1010 = 0LL, .__sn__field1011 = 0LL, .__sn__field1012 = 0LL, .__sn__field1013 = 0LL, .__sn__field1014 = 0LL, .__sn__field1015 = 0LL, .__sn__field1016 = 0LL, .__sn__field1017 = 0LL, .__sn__field1018 = 0LL, .__sn__field1019 = 0LL, .__sn__field1020 = 0LL, .__sn__field1021 = 0LL, .__sn__field1022 = 0LL, .__sn__field1023 = 0LL };
+
+    (__sn__data.__sn__field0 = 1LL);
+    
+
+    (__sn__data.__sn__field512 = 2LL);
+    
+
+    (__sn__data.__sn__field1023 = 3LL);
+    
+
+    if ((__sn__data.__sn__field0 != 1LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: data.field0 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__data.__sn__field0));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 1\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__data.__sn__field512 != 2LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: data.field512 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__data.__sn__field512));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 2\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__data.__sn__field1023 != 3LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: data.field1023 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__data.__sn__field1023));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 3\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("Modification test: PASS\n");
+    
+}
+
+
+int main() {
+    sn_print("Testing heap-allocated structs (>=8KB):\n");
+    
+    __sn__test_large_struct_size();
+    
+    __sn__test_large_struct_allocation();
+    
+    __sn__test_large_struct_field_access();
+    
+    __sn__test_large_struct_modification();
+    
+    sn_print("All heap allocation tests passed.\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,5191 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: LargeStruct (as val) */
+typedef struct {
+    long long __sn__field0;
+    long long __sn__field1;
+    long long __sn__field2;
+    long long __sn__field3;
+    long long __sn__field4;
+    long long __sn__field5;
+    long long __sn__field6;
+    long long __sn__field7;
+    long long __sn__field8;
+    long long __sn__field9;
+    long long __sn__field10;
+    long long __sn__field11;
+    long long __sn__field12;
+    long long __sn__field13;
+    long long __sn__field14;
+    long long __sn__field15;
+    long long __sn__field16;
+    long long __sn__field17;
+    long long __sn__field18;
+    long long __sn__field19;
+    long long __sn__field20;
+    long long __sn__field21;
+    long long __sn__field22;
+    long long __sn__field23;
+    long long __sn__field24;
+    long long __sn__field25;
+    long long __sn__field26;
+    long long __sn__field27;
+    long long __sn__field28;
+    long long __sn__field29;
+    long long __sn__field30;
+    long long __sn__field31;
+    long long __sn__field32;
+    long long __sn__field33;
+    long long __sn__field34;
+    long long __sn__field35;
+    long long __sn__field36;
+    long long __sn__field37;
+    long long __sn__field38;
+    long long __sn__field39;
+    long long __sn__field40;
+    long long __sn__field41;
+    long long __sn__field42;
+    long long __sn__field43;
+    long long __sn__field44;
+    long long __sn__field45;
+    long long __sn__field46;
+    long long __sn__field47;
+    long long __sn__field48;
+    long long __sn__field49;
+    long long __sn__field50;
+    long long __sn__field51;
+    long long __sn__field52;
+    long long __sn__field53;
+    long long __sn__field54;
+    long long __sn__field55;
+    long long __sn__field56;
+    long long __sn__field57;
+    long long __sn__field58;
+    long long __sn__field59;
+    long long __sn__field60;
+    long long __sn__field61;
+    long long __sn__field62;
+    long long __sn__field63;
+    long long __sn__field64;
+    long long __sn__field65;
+    long long __sn__field66;
+    long long __sn__field67;
+    long long __sn__field68;
+    long long __sn__field69;
+    long long __sn__field70;
+    long long __sn__field71;
+    long long __sn__field72;
+    long long __sn__field73;
+    long long __sn__field74;
+    long long __sn__field75;
+    long long __sn__field76;
+    long long __sn__field77;
+    long long __sn__field78;
+    long long __sn__field79;
+    long long __sn__field80;
+    long long __sn__field81;
+    long long __sn__field82;
+    long long __sn__field83;
+    long long __sn__field84;
+    long long __sn__field85;
+    long long __sn__field86;
+    long long __sn__field87;
+    long long __sn__field88;
+    long long __sn__field89;
+    long long __sn__field90;
+    long long __sn__field91;
+    long long __sn__field92;
+    long long __sn__field93;
+    long long __sn__field94;
+    long long __sn__field95;
+    long long __sn__field96;
+    long long __sn__field97;
+    long long __sn__field98;
+    long long __sn__field99;
+    long long __sn__field100;
+    long long __sn__field101;
+    long long __sn__field102;
+    long long __sn__field103;
+    long long __sn__field104;
+    long long __sn__field105;
+    long long __sn__field106;
+    long long __sn__field107;
+    long long __sn__field108;
+    long long __sn__field109;
+    long long __sn__field110;
+    long long __sn__field111;
+    long long __sn__field112;
+    long long __sn__field113;
+    long long __sn__field114;
+    long long __sn__field115;
+    long long __sn__field116;
+    long long __sn__field117;
+    long long __sn__field118;
+    long long __sn__field119;
+    long long __sn__field120;
+    long long __sn__field121;
+    long long __sn__field122;
+    long long __sn__field123;
+    long long __sn__field124;
+    long long __sn__field125;
+    long long __sn__field126;
+    long long __sn__field127;
+    long long __sn__field128;
+    long long __sn__field129;
+    long long __sn__field130;
+    long long __sn__field131;
+    long long __sn__field132;
+    long long __sn__field133;
+    long long __sn__field134;
+    long long __sn__field135;
+    long long __sn__field136;
+    long long __sn__field137;
+    long long __sn__field138;
+    long long __sn__field139;
+    long long __sn__field140;
+    long long __sn__field141;
+    long long __sn__field142;
+    long long __sn__field143;
+    long long __sn__field144;
+    long long __sn__field145;
+    long long __sn__field146;
+    long long __sn__field147;
+    long long __sn__field148;
+    long long __sn__field149;
+    long long __sn__field150;
+    long long __sn__field151;
+    long long __sn__field152;
+    long long __sn__field153;
+    long long __sn__field154;
+    long long __sn__field155;
+    long long __sn__field156;
+    long long __sn__field157;
+    long long __sn__field158;
+    long long __sn__field159;
+    long long __sn__field160;
+    long long __sn__field161;
+    long long __sn__field162;
+    long long __sn__field163;
+    long long __sn__field164;
+    long long __sn__field165;
+    long long __sn__field166;
+    long long __sn__field167;
+    long long __sn__field168;
+    long long __sn__field169;
+    long long __sn__field170;
+    long long __sn__field171;
+    long long __sn__field172;
+    long long __sn__field173;
+    long long __sn__field174;
+    long long __sn__field175;
+    long long __sn__field176;
+    long long __sn__field177;
+    long long __sn__field178;
+    long long __sn__field179;
+    long long __sn__field180;
+    long long __sn__field181;
+    long long __sn__field182;
+    long long __sn__field183;
+    long long __sn__field184;
+    long long __sn__field185;
+    long long __sn__field186;
+    long long __sn__field187;
+    long long __sn__field188;
+    long long __sn__field189;
+    long long __sn__field190;
+    long long __sn__field191;
+    long long __sn__field192;
+    long long __sn__field193;
+    long long __sn__field194;
+    long long __sn__field195;
+    long long __sn__field196;
+    long long __sn__field197;
+    long long __sn__field198;
+    long long __sn__field199;
+    long long __sn__field200;
+    long long __sn__field201;
+    long long __sn__field202;
+    long long __sn__field203;
+    long long __sn__field204;
+    long long __sn__field205;
+    long long __sn__field206;
+    long long __sn__field207;
+    long long __sn__field208;
+    long long __sn__field209;
+    long long __sn__field210;
+    long long __sn__field211;
+    long long __sn__field212;
+    long long __sn__field213;
+    long long __sn__field214;
+    long long __sn__field215;
+    long long __sn__field216;
+    long long __sn__field217;
+    long long __sn__field218;
+    long long __sn__field219;
+    long long __sn__field220;
+    long long __sn__field221;
+    long long __sn__field222;
+    long long __sn__field223;
+    long long __sn__field224;
+    long long __sn__field225;
+    long long __sn__field226;
+    long long __sn__field227;
+    long long __sn__field228;
+    long long __sn__field229;
+    long long __sn__field230;
+    long long __sn__field231;
+    long long __sn__field232;
+    long long __sn__field233;
+    long long __sn__field234;
+    long long __sn__field235;
+    long long __sn__field236;
+    long long __sn__field237;
+    long long __sn__field238;
+    long long __sn__field239;
+    long long __sn__field240;
+    long long __sn__field241;
+    long long __sn__field242;
+    long long __sn__field243;
+    long long __sn__field244;
+    long long __sn__field245;
+    long long __sn__field246;
+    long long __sn__field247;
+    long long __sn__field248;
+    long long __sn__field249;
+    long long __sn__field250;
+    long long __sn__field251;
+    long long __sn__field252;
+    long long __sn__field253;
+    long long __sn__field254;
+    long long __sn__field255;
+    long long __sn__field256;
+    long long __sn__field257;
+    long long __sn__field258;
+    long long __sn__field259;
+    long long __sn__field260;
+    long long __sn__field261;
+    long long __sn__field262;
+    long long __sn__field263;
+    long long __sn__field264;
+    long long __sn__field265;
+    long long __sn__field266;
+    long long __sn__field267;
+    long long __sn__field268;
+    long long __sn__field269;
+    long long __sn__field270;
+    long long __sn__field271;
+    long long __sn__field272;
+    long long __sn__field273;
+    long long __sn__field274;
+    long long __sn__field275;
+    long long __sn__field276;
+    long long __sn__field277;
+    long long __sn__field278;
+    long long __sn__field279;
+    long long __sn__field280;
+    long long __sn__field281;
+    long long __sn__field282;
+    long long __sn__field283;
+    long long __sn__field284;
+    long long __sn__field285;
+    long long __sn__field286;
+    long long __sn__field287;
+    long long __sn__field288;
+    long long __sn__field289;
+    long long __sn__field290;
+    long long __sn__field291;
+    long long __sn__field292;
+    long long __sn__field293;
+    long long __sn__field294;
+    long long __sn__field295;
+    long long __sn__field296;
+    long long __sn__field297;
+    long long __sn__field298;
+    long long __sn__field299;
+    long long __sn__field300;
+    long long __sn__field301;
+    long long __sn__field302;
+    long long __sn__field303;
+    long long __sn__field304;
+    long long __sn__field305;
+    long long __sn__field306;
+    long long __sn__field307;
+    long long __sn__field308;
+    long long __sn__field309;
+    long long __sn__field310;
+    long long __sn__field311;
+    long long __sn__field312;
+    long long __sn__field313;
+    long long __sn__field314;
+    long long __sn__field315;
+    long long __sn__field316;
+    long long __sn__field317;
+    long long __sn__field318;
+    long long __sn__field319;
+    long long __sn__field320;
+    long long __sn__field321;
+    long long __sn__field322;
+    long long __sn__field323;
+    long long __sn__field324;
+    long long __sn__field325;
+    long long __sn__field326;
+    long long __sn__field327;
+    long long __sn__field328;
+    long long __sn__field329;
+    long long __sn__field330;
+    long long __sn__field331;
+    long long __sn__field332;
+    long long __sn__field333;
+    long long __sn__field334;
+    long long __sn__field335;
+    long long __sn__field336;
+    long long __sn__field337;
+    long long __sn__field338;
+    long long __sn__field339;
+    long long __sn__field340;
+    long long __sn__field341;
+    long long __sn__field342;
+    long long __sn__field343;
+    long long __sn__field344;
+    long long __sn__field345;
+    long long __sn__field346;
+    long long __sn__field347;
+    long long __sn__field348;
+    long long __sn__field349;
+    long long __sn__field350;
+    long long __sn__field351;
+    long long __sn__field352;
+    long long __sn__field353;
+    long long __sn__field354;
+    long long __sn__field355;
+    long long __sn__field356;
+    long long __sn__field357;
+    long long __sn__field358;
+    long long __sn__field359;
+    long long __sn__field360;
+    long long __sn__field361;
+    long long __sn__field362;
+    long long __sn__field363;
+    long long __sn__field364;
+    long long __sn__field365;
+    long long __sn__field366;
+    long long __sn__field367;
+    long long __sn__field368;
+    long long __sn__field369;
+    long long __sn__field370;
+    long long __sn__field371;
+    long long __sn__field372;
+    long long __sn__field373;
+    long long __sn__field374;
+    long long __sn__field375;
+    long long __sn__field376;
+    long long __sn__field377;
+    long long __sn__field378;
+    long long __sn__field379;
+    long long __sn__field380;
+    long long __sn__field381;
+    long long __sn__field382;
+    long long __sn__field383;
+    long long __sn__field384;
+    long long __sn__field385;
+    long long __sn__field386;
+    long long __sn__field387;
+    long long __sn__field388;
+    long long __sn__field389;
+    long long __sn__field390;
+    long long __sn__field391;
+    long long __sn__field392;
+    long long __sn__field393;
+    long long __sn__field394;
+    long long __sn__field395;
+    long long __sn__field396;
+    long long __sn__field397;
+    long long __sn__field398;
+    long long __sn__field399;
+    long long __sn__field400;
+    long long __sn__field401;
+    long long __sn__field402;
+    long long __sn__field403;
+    long long __sn__field404;
+    long long __sn__field405;
+    long long __sn__field406;
+    long long __sn__field407;
+    long long __sn__field408;
+    long long __sn__field409;
+    long long __sn__field410;
+    long long __sn__field411;
+    long long __sn__field412;
+    long long __sn__field413;
+    long long __sn__field414;
+    long long __sn__field415;
+    long long __sn__field416;
+    long long __sn__field417;
+    long long __sn__field418;
+    long long __sn__field419;
+    long long __sn__field420;
+    long long __sn__field421;
+    long long __sn__field422;
+    long long __sn__field423;
+    long long __sn__field424;
+    long long __sn__field425;
+    long long __sn__field426;
+    long long __sn__field427;
+    long long __sn__field428;
+    long long __sn__field429;
+    long long __sn__field430;
+    long long __sn__field431;
+    long long __sn__field432;
+    long long __sn__field433;
+    long long __sn__field434;
+    long long __sn__field435;
+    long long __sn__field436;
+    long long __sn__field437;
+    long long __sn__field438;
+    long long __sn__field439;
+    long long __sn__field440;
+    long long __sn__field441;
+    long long __sn__field442;
+    long long __sn__field443;
+    long long __sn__field444;
+    long long __sn__field445;
+    long long __sn__field446;
+    long long __sn__field447;
+    long long __sn__field448;
+    long long __sn__field449;
+    long long __sn__field450;
+    long long __sn__field451;
+    long long __sn__field452;
+    long long __sn__field453;
+    long long __sn__field454;
+    long long __sn__field455;
+    long long __sn__field456;
+    long long __sn__field457;
+    long long __sn__field458;
+    long long __sn__field459;
+    long long __sn__field460;
+    long long __sn__field461;
+    long long __sn__field462;
+    long long __sn__field463;
+    long long __sn__field464;
+    long long __sn__field465;
+    long long __sn__field466;
+    long long __sn__field467;
+    long long __sn__field468;
+    long long __sn__field469;
+    long long __sn__field470;
+    long long __sn__field471;
+    long long __sn__field472;
+    long long __sn__field473;
+    long long __sn__field474;
+    long long __sn__field475;
+    long long __sn__field476;
+    long long __sn__field477;
+    long long __sn__field478;
+    long long __sn__field479;
+    long long __sn__field480;
+    long long __sn__field481;
+    long long __sn__field482;
+    long long __sn__field483;
+    long long __sn__field484;
+    long long __sn__field485;
+    long long __sn__field486;
+    long long __sn__field487;
+    long long __sn__field488;
+    long long __sn__field489;
+    long long __sn__field490;
+    long long __sn__field491;
+    long long __sn__field492;
+    long long __sn__field493;
+    long long __sn__field494;
+    long long __sn__field495;
+    long long __sn__field496;
+    long long __sn__field497;
+    long long __sn__field498;
+    long long __sn__field499;
+    long long __sn__field500;
+    long long __sn__field501;
+    long long __sn__field502;
+    long long __sn__field503;
+    long long __sn__field504;
+    long long __sn__field505;
+    long long __sn__field506;
+    long long __sn__field507;
+    long long __sn__field508;
+    long long __sn__field509;
+    long long __sn__field510;
+    long long __sn__field511;
+    long long __sn__field512;
+    long long __sn__field513;
+    long long __sn__field514;
+    long long __sn__field515;
+    long long __sn__field516;
+    long long __sn__field517;
+    long long __sn__field518;
+    long long __sn__field519;
+    long long __sn__field520;
+    long long __sn__field521;
+    long long __sn__field522;
+    long long __sn__field523;
+    long long __sn__field524;
+    long long __sn__field525;
+    long long __sn__field526;
+    long long __sn__field527;
+    long long __sn__field528;
+    long long __sn__field529;
+    long long __sn__field530;
+    long long __sn__field531;
+    long long __sn__field532;
+    long long __sn__field533;
+    long long __sn__field534;
+    long long __sn__field535;
+    long long __sn__field536;
+    long long __sn__field537;
+    long long __sn__field538;
+    long long __sn__field539;
+    long long __sn__field540;
+    long long __sn__field541;
+    long long __sn__field542;
+    long long __sn__field543;
+    long long __sn__field544;
+    long long __sn__field545;
+    long long __sn__field546;
+    long long __sn__field547;
+    long long __sn__field548;
+    long long __sn__field549;
+    long long __sn__field550;
+    long long __sn__field551;
+    long long __sn__field552;
+    long long __sn__field553;
+    long long __sn__field554;
+    long long __sn__field555;
+    long long __sn__field556;
+    long long __sn__field557;
+    long long __sn__field558;
+    long long __sn__field559;
+    long long __sn__field560;
+    long long __sn__field561;
+    long long __sn__field562;
+    long long __sn__field563;
+    long long __sn__field564;
+    long long __sn__field565;
+    long long __sn__field566;
+    long long __sn__field567;
+    long long __sn__field568;
+    long long __sn__field569;
+    long long __sn__field570;
+    long long __sn__field571;
+    long long __sn__field572;
+    long long __sn__field573;
+    long long __sn__field574;
+    long long __sn__field575;
+    long long __sn__field576;
+    long long __sn__field577;
+    long long __sn__field578;
+    long long __sn__field579;
+    long long __sn__field580;
+    long long __sn__field581;
+    long long __sn__field582;
+    long long __sn__field583;
+    long long __sn__field584;
+    long long __sn__field585;
+    long long __sn__field586;
+    long long __sn__field587;
+    long long __sn__field588;
+    long long __sn__field589;
+    long long __sn__field590;
+    long long __sn__field591;
+    long long __sn__field592;
+    long long __sn__field593;
+    long long __sn__field594;
+    long long __sn__field595;
+    long long __sn__field596;
+    long long __sn__field597;
+    long long __sn__field598;
+    long long __sn__field599;
+    long long __sn__field600;
+    long long __sn__field601;
+    long long __sn__field602;
+    long long __sn__field603;
+    long long __sn__field604;
+    long long __sn__field605;
+    long long __sn__field606;
+    long long __sn__field607;
+    long long __sn__field608;
+    long long __sn__field609;
+    long long __sn__field610;
+    long long __sn__field611;
+    long long __sn__field612;
+    long long __sn__field613;
+    long long __sn__field614;
+    long long __sn__field615;
+    long long __sn__field616;
+    long long __sn__field617;
+    long long __sn__field618;
+    long long __sn__field619;
+    long long __sn__field620;
+    long long __sn__field621;
+    long long __sn__field622;
+    long long __sn__field623;
+    long long __sn__field624;
+    long long __sn__field625;
+    long long __sn__field626;
+    long long __sn__field627;
+    long long __sn__field628;
+    long long __sn__field629;
+    long long __sn__field630;
+    long long __sn__field631;
+    long long __sn__field632;
+    long long __sn__field633;
+    long long __sn__field634;
+    long long __sn__field635;
+    long long __sn__field636;
+    long long __sn__field637;
+    long long __sn__field638;
+    long long __sn__field639;
+    long long __sn__field640;
+    long long __sn__field641;
+    long long __sn__field642;
+    long long __sn__field643;
+    long long __sn__field644;
+    long long __sn__field645;
+    long long __sn__field646;
+    long long __sn__field647;
+    long long __sn__field648;
+    long long __sn__field649;
+    long long __sn__field650;
+    long long __sn__field651;
+    long long __sn__field652;
+    long long __sn__field653;
+    long long __sn__field654;
+    long long __sn__field655;
+    long long __sn__field656;
+    long long __sn__field657;
+    long long __sn__field658;
+    long long __sn__field659;
+    long long __sn__field660;
+    long long __sn__field661;
+    long long __sn__field662;
+    long long __sn__field663;
+    long long __sn__field664;
+    long long __sn__field665;
+    long long __sn__field666;
+    long long __sn__field667;
+    long long __sn__field668;
+    long long __sn__field669;
+    long long __sn__field670;
+    long long __sn__field671;
+    long long __sn__field672;
+    long long __sn__field673;
+    long long __sn__field674;
+    long long __sn__field675;
+    long long __sn__field676;
+    long long __sn__field677;
+    long long __sn__field678;
+    long long __sn__field679;
+    long long __sn__field680;
+    long long __sn__field681;
+    long long __sn__field682;
+    long long __sn__field683;
+    long long __sn__field684;
+    long long __sn__field685;
+    long long __sn__field686;
+    long long __sn__field687;
+    long long __sn__field688;
+    long long __sn__field689;
+    long long __sn__field690;
+    long long __sn__field691;
+    long long __sn__field692;
+    long long __sn__field693;
+    long long __sn__field694;
+    long long __sn__field695;
+    long long __sn__field696;
+    long long __sn__field697;
+    long long __sn__field698;
+    long long __sn__field699;
+    long long __sn__field700;
+    long long __sn__field701;
+    long long __sn__field702;
+    long long __sn__field703;
+    long long __sn__field704;
+    long long __sn__field705;
+    long long __sn__field706;
+    long long __sn__field707;
+    long long __sn__field708;
+    long long __sn__field709;
+    long long __sn__field710;
+    long long __sn__field711;
+    long long __sn__field712;
+    long long __sn__field713;
+    long long __sn__field714;
+    long long __sn__field715;
+    long long __sn__field716;
+    long long __sn__field717;
+    long long __sn__field718;
+    long long __sn__field719;
+    long long __sn__field720;
+    long long __sn__field721;
+    long long __sn__field722;
+    long long __sn__field723;
+    long long __sn__field724;
+    long long __sn__field725;
+    long long __sn__field726;
+    long long __sn__field727;
+    long long __sn__field728;
+    long long __sn__field729;
+    long long __sn__field730;
+    long long __sn__field731;
+    long long __sn__field732;
+    long long __sn__field733;
+    long long __sn__field734;
+    long long __sn__field735;
+    long long __sn__field736;
+    long long __sn__field737;
+    long long __sn__field738;
+    long long __sn__field739;
+    long long __sn__field740;
+    long long __sn__field741;
+    long long __sn__field742;
+    long long __sn__field743;
+    long long __sn__field744;
+    long long __sn__field745;
+    long long __sn__field746;
+    long long __sn__field747;
+    long long __sn__field748;
+    long long __sn__field749;
+    long long __sn__field750;
+    long long __sn__field751;
+    long long __sn__field752;
+    long long __sn__field753;
+    long long __sn__field754;
+    long long __sn__field755;
+    long long __sn__field756;
+    long long __sn__field757;
+    long long __sn__field758;
+    long long __sn__field759;
+    long long __sn__field760;
+    long long __sn__field761;
+    long long __sn__field762;
+    long long __sn__field763;
+    long long __sn__field764;
+    long long __sn__field765;
+    long long __sn__field766;
+    long long __sn__field767;
+    long long __sn__field768;
+    long long __sn__field769;
+    long long __sn__field770;
+    long long __sn__field771;
+    long long __sn__field772;
+    long long __sn__field773;
+    long long __sn__field774;
+    long long __sn__field775;
+    long long __sn__field776;
+    long long __sn__field777;
+    long long __sn__field778;
+    long long __sn__field779;
+    long long __sn__field780;
+    long long __sn__field781;
+    long long __sn__field782;
+    long long __sn__field783;
+    long long __sn__field784;
+    long long __sn__field785;
+    long long __sn__field786;
+    long long __sn__field787;
+    long long __sn__field788;
+    long long __sn__field789;
+    long long __sn__field790;
+    long long __sn__field791;
+    long long __sn__field792;
+    long long __sn__field793;
+    long long __sn__field794;
+    long long __sn__field795;
+    long long __sn__field796;
+    long long __sn__field797;
+    long long __sn__field798;
+    long long __sn__field799;
+    long long __sn__field800;
+    long long __sn__field801;
+    long long __sn__field802;
+    long long __sn__field803;
+    long long __sn__field804;
+    long long __sn__field805;
+    long long __sn__field806;
+    long long __sn__field807;
+    long long __sn__field808;
+    long long __sn__field809;
+    long long __sn__field810;
+    long long __sn__field811;
+    long long __sn__field812;
+    long long __sn__field813;
+    long long __sn__field814;
+    long long __sn__field815;
+    long long __sn__field816;
+    long long __sn__field817;
+    long long __sn__field818;
+    long long __sn__field819;
+    long long __sn__field820;
+    long long __sn__field821;
+    long long __sn__field822;
+    long long __sn__field823;
+    long long __sn__field824;
+    long long __sn__field825;
+    long long __sn__field826;
+    long long __sn__field827;
+    long long __sn__field828;
+    long long __sn__field829;
+    long long __sn__field830;
+    long long __sn__field831;
+    long long __sn__field832;
+    long long __sn__field833;
+    long long __sn__field834;
+    long long __sn__field835;
+    long long __sn__field836;
+    long long __sn__field837;
+    long long __sn__field838;
+    long long __sn__field839;
+    long long __sn__field840;
+    long long __sn__field841;
+    long long __sn__field842;
+    long long __sn__field843;
+    long long __sn__field844;
+    long long __sn__field845;
+    long long __sn__field846;
+    long long __sn__field847;
+    long long __sn__field848;
+    long long __sn__field849;
+    long long __sn__field850;
+    long long __sn__field851;
+    long long __sn__field852;
+    long long __sn__field853;
+    long long __sn__field854;
+    long long __sn__field855;
+    long long __sn__field856;
+    long long __sn__field857;
+    long long __sn__field858;
+    long long __sn__field859;
+    long long __sn__field860;
+    long long __sn__field861;
+    long long __sn__field862;
+    long long __sn__field863;
+    long long __sn__field864;
+    long long __sn__field865;
+    long long __sn__field866;
+    long long __sn__field867;
+    long long __sn__field868;
+    long long __sn__field869;
+    long long __sn__field870;
+    long long __sn__field871;
+    long long __sn__field872;
+    long long __sn__field873;
+    long long __sn__field874;
+    long long __sn__field875;
+    long long __sn__field876;
+    long long __sn__field877;
+    long long __sn__field878;
+    long long __sn__field879;
+    long long __sn__field880;
+    long long __sn__field881;
+    long long __sn__field882;
+    long long __sn__field883;
+    long long __sn__field884;
+    long long __sn__field885;
+    long long __sn__field886;
+    long long __sn__field887;
+    long long __sn__field888;
+    long long __sn__field889;
+    long long __sn__field890;
+    long long __sn__field891;
+    long long __sn__field892;
+    long long __sn__field893;
+    long long __sn__field894;
+    long long __sn__field895;
+    long long __sn__field896;
+    long long __sn__field897;
+    long long __sn__field898;
+    long long __sn__field899;
+    long long __sn__field900;
+    long long __sn__field901;
+    long long __sn__field902;
+    long long __sn__field903;
+    long long __sn__field904;
+    long long __sn__field905;
+    long long __sn__field906;
+    long long __sn__field907;
+    long long __sn__field908;
+    long long __sn__field909;
+    long long __sn__field910;
+    long long __sn__field911;
+    long long __sn__field912;
+    long long __sn__field913;
+    long long __sn__field914;
+    long long __sn__field915;
+    long long __sn__field916;
+    long long __sn__field917;
+    long long __sn__field918;
+    long long __sn__field919;
+    long long __sn__field920;
+    long long __sn__field921;
+    long long __sn__field922;
+    long long __sn__field923;
+    long long __sn__field924;
+    long long __sn__field925;
+    long long __sn__field926;
+    long long __sn__field927;
+    long long __sn__field928;
+    long long __sn__field929;
+    long long __sn__field930;
+    long long __sn__field931;
+    long long __sn__field932;
+    long long __sn__field933;
+    long long __sn__field934;
+    long long __sn__field935;
+    long long __sn__field936;
+    long long __sn__field937;
+    long long __sn__field938;
+    long long __sn__field939;
+    long long __sn__field940;
+    long long __sn__field941;
+    long long __sn__field942;
+    long long __sn__field943;
+    long long __sn__field944;
+    long long __sn__field945;
+    long long __sn__field946;
+    long long __sn__field947;
+    long long __sn__field948;
+    long long __sn__field949;
+    long long __sn__field950;
+    long long __sn__field951;
+    long long __sn__field952;
+    long long __sn__field953;
+    long long __sn__field954;
+    long long __sn__field955;
+    long long __sn__field956;
+    long long __sn__field957;
+    long long __sn__field958;
+    long long __sn__field959;
+    long long __sn__field960;
+    long long __sn__field961;
+    long long __sn__field962;
+    long long __sn__field963;
+    long long __sn__field964;
+    long long __sn__field965;
+    long long __sn__field966;
+    long long __sn__field967;
+    long long __sn__field968;
+    long long __sn__field969;
+    long long __sn__field970;
+    long long __sn__field971;
+    long long __sn__field972;
+    long long __sn__field973;
+    long long __sn__field974;
+    long long __sn__field975;
+    long long __sn__field976;
+    long long __sn__field977;
+    long long __sn__field978;
+    long long __sn__field979;
+    long long __sn__field980;
+    long long __sn__field981;
+    long long __sn__field982;
+    long long __sn__field983;
+    long long __sn__field984;
+    long long __sn__field985;
+    long long __sn__field986;
+    long long __sn__field987;
+    long long __sn__field988;
+    long long __sn__field989;
+    long long __sn__field990;
+    long long __sn__field991;
+    long long __sn__field992;
+    long long __sn__field993;
+    long long __sn__field994;
+    long long __sn__field995;
+    long long __sn__field996;
+    long long __sn__field997;
+    long long __sn__field998;
+    long long __sn__field999;
+    long long __sn__field1000;
+    long long __sn__field1001;
+    long long __sn__field1002;
+    long long __sn__field1003;
+    long long __sn__field1004;
+    long long __sn__field1005;
+    long long __sn__field1006;
+    long long __sn__field1007;
+    long long __sn__field1008;
+    long long __sn__field1009;
+    long long __sn__field1010;
+    long long __sn__field1011;
+    long long __sn__field1012;
+    long long __sn__field1013;
+    long long __sn__field1014;
+    long long __sn__field1015;
+    long long __sn__field1016;
+    long long __sn__field1017;
+    long long __sn__field1018;
+    long long __sn__field1019;
+    long long __sn__field1020;
+    long long __sn__field1021;
+    long long __sn__field1022;
+    long long __sn__field1023;
+} __sn__LargeStruct;
+/* Value operations */
+static inline __sn__LargeStruct __sn__LargeStruct_copy(const __sn__LargeStruct *src) {
+    __sn__LargeStruct dst;
+    dst.__sn__field0 = src->__sn__field0;
+    dst.__sn__field1 = src->__sn__field1;
+    dst.__sn__field2 = src->__sn__field2;
+    dst.__sn__field3 = src->__sn__field3;
+    dst.__sn__field4 = src->__sn__field4;
+    dst.__sn__field5 = src->__sn__field5;
+    dst.__sn__field6 = src->__sn__field6;
+    dst.__sn__field7 = src->__sn__field7;
+    dst.__sn__field8 = src->__sn__field8;
+    dst.__sn__field9 = src->__sn__field9;
+    dst.__sn__field10 = src->__sn__field10;
+    dst.__sn__field11 = src->__sn__field11;
+    dst.__sn__field12 = src->__sn__field12;
+    dst.__sn__field13 = src->__sn__field13;
+    dst.__sn__field14 = src->__sn__field14;
+    dst.__sn__field15 = src->__sn__field15;
+    dst.__sn__field16 = src->__sn__field16;
+    dst.__sn__field17 = src->__sn__field17;
+    dst.__sn__field18 = src->__sn__field18;
+    dst.__sn__field19 = src->__sn__field19;
+    dst.__sn__field20 = src->__sn__field20;
+    dst.__sn__field21 = src->__sn__field21;
+    dst.__sn__field22 = src->__sn__field22;
+    dst.__sn__field23 = src->__sn__field23;
+    dst.__sn__field24 = src->__sn__field24;
+    dst.__sn__field25 = src->__sn__field25;
+    dst.__sn__field26 = src->__sn__field26;
+    dst.__sn__field27 = src->__sn__field27;
+    dst.__sn__field28 = src->__sn__field28;
+    dst.__sn__field29 = src->__sn__field29;
+    dst.__sn__field30 = src->__sn__field30;
+    dst.__sn__field31 = src->__sn__field31;
+    dst.__sn__field32 = src->__sn__field32;
+    dst.__sn__field33 = src->__sn__field33;
+    dst.__sn__field34 = src->__sn__field34;
+    dst.__sn__field35 = src->__sn__field35;
+    dst.__sn__field36 = src->__sn__field36;
+    dst.__sn__field37 = src->__sn__field37;
+    dst.__sn__field38 = src->__sn__field38;
+    dst.__sn__field39 = src->__sn__field39;
+    dst.__sn__field40 = src->__sn__field40;
+    dst.__sn__field41 = src->__sn__field41;
+    dst.__sn__field42 = src->__sn__field42;
+    dst.__sn__field43 = src->__sn__field43;
+    dst.__sn__field44 = src->__sn__field44;
+    dst.__sn__field45 = src->__sn__field45;
+    dst.__sn__field46 = src->__sn__field46;
+    dst.__sn__field47 = src->__sn__field47;
+    dst.__sn__field48 = src->__sn__field48;
+    dst.__sn__field49 = src->__sn__field49;
+    dst.__sn__field50 = src->__sn__field50;
+    dst.__sn__field51 = src->__sn__field51;
+    dst.__sn__field52 = src->__sn__field52;
+    dst.__sn__field53 = src->__sn__field53;
+    dst.__sn__field54 = src->__sn__field54;
+    dst.__sn__field55 = src->__sn__field55;
+    dst.__sn__field56 = src->__sn__field56;
+    dst.__sn__field57 = src->__sn__field57;
+    dst.__sn__field58 = src->__sn__field58;
+    dst.__sn__field59 = src->__sn__field59;
+    dst.__sn__field60 = src->__sn__field60;
+    dst.__sn__field61 = src->__sn__field61;
+    dst.__sn__field62 = src->__sn__field62;
+    dst.__sn__field63 = src->__sn__field63;
+    dst.__sn__field64 = src->__sn__field64;
+    dst.__sn__field65 = src->__sn__field65;
+    dst.__sn__field66 = src->__sn__field66;
+    dst.__sn__field67 = src->__sn__field67;
+    dst.__sn__field68 = src->__sn__field68;
+    dst.__sn__field69 = src->__sn__field69;
+    dst.__sn__field70 = src->__sn__field70;
+    dst.__sn__field71 = src->__sn__field71;
+    dst.__sn__field72 = src->__sn__field72;
+    dst.__sn__field73 = src->__sn__field73;
+    dst.__sn__field74 = src->__sn__field74;
+    dst.__sn__field75 = src->__sn__field75;
+    dst.__sn__field76 = src->__sn__field76;
+    dst.__sn__field77 = src->__sn__field77;
+    dst.__sn__field78 = src->__sn__field78;
+    dst.__sn__field79 = src->__sn__field79;
+    dst.__sn__field80 = src->__sn__field80;
+    dst.__sn__field81 = src->__sn__field81;
+    dst.__sn__field82 = src->__sn__field82;
+    dst.__sn__field83 = src->__sn__field83;
+    dst.__sn__field84 = src->__sn__field84;
+    dst.__sn__field85 = src->__sn__field85;
+    dst.__sn__field86 = src->__sn__field86;
+    dst.__sn__field87 = src->__sn__field87;
+    dst.__sn__field88 = src->__sn__field88;
+    dst.__sn__field89 = src->__sn__field89;
+    dst.__sn__field90 = src->__sn__field90;
+    dst.__sn__field91 = src->__sn__field91;
+    dst.__sn__field92 = src->__sn__field92;
+    dst.__sn__field93 = src->__sn__field93;
+    dst.__sn__field94 = src->__sn__field94;
+    dst.__sn__field95 = src->__sn__field95;
+    dst.__sn__field96 = src->__sn__field96;
+    dst.__sn__field97 = src->__sn__field97;
+    dst.__sn__field98 = src->__sn__field98;
+    dst.__sn__field99 = src->__sn__field99;
+    dst.__sn__field100 = src->__sn__field100;
+    dst.__sn__field101 = src->__sn__field101;
+    dst.__sn__field102 = src->__sn__field102;
+    dst.__sn__field103 = src->__sn__field103;
+    dst.__sn__field104 = src->__sn__field104;
+    dst.__sn__field105 = src->__sn__field105;
+    dst.__sn__field106 = src->__sn__field106;
+    dst.__sn__field107 = src->__sn__field107;
+    dst.__sn__field108 = src->__sn__field108;
+    dst.__sn__field109 = src->__sn__field109;
+    dst.__sn__field110 = src->__sn__field110;
+    dst.__sn__field111 = src->__sn__field111;
+    dst.__sn__field112 = src->__sn__field112;
+    dst.__sn__field113 = src->__sn__field113;
+    dst.__sn__field114 = src->__sn__field114;
+    dst.__sn__field115 = src->__sn__field115;
+    dst.__sn__field116 = src->__sn__field116;
+    dst.__sn__field117 = src->__sn__field117;
+    dst.__sn__field118 = src->__sn__field118;
+    dst.__sn__field119 = src->__sn__field119;
+    dst.__sn__field120 = src->__sn__field120;
+    dst.__sn__field121 = src->__sn__field121;
+    dst.__sn__field122 = src->__sn__field122;
+    dst.__sn__field123 = src->__sn__field123;
+    dst.__sn__field124 = src->__sn__field124;
+    dst.__sn__field125 = src->__sn__field125;
+    dst.__sn__field126 = src->__sn__field126;
+    dst.__sn__field127 = src->__sn__field127;
+    dst.__sn__field128 = src->__sn__field128;
+    dst.__sn__field129 = src->__sn__field129;
+    dst.__sn__field130 = src->__sn__field130;
+    dst.__sn__field131 = src->__sn__field131;
+    dst.__sn__field132 = src->__sn__field132;
+    dst.__sn__field133 = src->__sn__field133;
+    dst.__sn__field134 = src->__sn__field134;
+    dst.__sn__field135 = src->__sn__field135;
+    dst.__sn__field136 = src->__sn__field136;
+    dst.__sn__field137 = src->__sn__field137;
+    dst.__sn__field138 = src->__sn__field138;
+    dst.__sn__field139 = src->__sn__field139;
+    dst.__sn__field140 = src->__sn__field140;
+    dst.__sn__field141 = src->__sn__field141;
+    dst.__sn__field142 = src->__sn__field142;
+    dst.__sn__field143 = src->__sn__field143;
+    dst.__sn__field144 = src->__sn__field144;
+    dst.__sn__field145 = src->__sn__field145;
+    dst.__sn__field146 = src->__sn__field146;
+    dst.__sn__field147 = src->__sn__field147;
+    dst.__sn__field148 = src->__sn__field148;
+    dst.__sn__field149 = src->__sn__field149;
+    dst.__sn__field150 = src->__sn__field150;
+    dst.__sn__field151 = src->__sn__field151;
+    dst.__sn__field152 = src->__sn__field152;
+    dst.__sn__field153 = src->__sn__field153;
+    dst.__sn__field154 = src->__sn__field154;
+    dst.__sn__field155 = src->__sn__field155;
+    dst.__sn__field156 = src->__sn__field156;
+    dst.__sn__field157 = src->__sn__field157;
+    dst.__sn__field158 = src->__sn__field158;
+    dst.__sn__field159 = src->__sn__field159;
+    dst.__sn__field160 = src->__sn__field160;
+    dst.__sn__field161 = src->__sn__field161;
+    dst.__sn__field162 = src->__sn__field162;
+    dst.__sn__field163 = src->__sn__field163;
+    dst.__sn__field164 = src->__sn__field164;
+    dst.__sn__field165 = src->__sn__field165;
+    dst.__sn__field166 = src->__sn__field166;
+    dst.__sn__field167 = src->__sn__field167;
+    dst.__sn__field168 = src->__sn__field168;
+    dst.__sn__field169 = src->__sn__field169;
+    dst.__sn__field170 = src->__sn__field170;
+    dst.__sn__field171 = src->__sn__field171;
+    dst.__sn__field172 = src->__sn__field172;
+    dst.__sn__field173 = src->__sn__field173;
+    dst.__sn__field174 = src->__sn__field174;
+    dst.__sn__field175 = src->__sn__field175;
+    dst.__sn__field176 = src->__sn__field176;
+    dst.__sn__field177 = src->__sn__field177;
+    dst.__sn__field178 = src->__sn__field178;
+    dst.__sn__field179 = src->__sn__field179;
+    dst.__sn__field180 = src->__sn__field180;
+    dst.__sn__field181 = src->__sn__field181;
+    dst.__sn__field182 = src->__sn__field182;
+    dst.__sn__field183 = src->__sn__field183;
+    dst.__sn__field184 = src->__sn__field184;
+    dst.__sn__field185 = src->__sn__field185;
+    dst.__sn__field186 = src->__sn__field186;
+    dst.__sn__field187 = src->__sn__field187;
+    dst.__sn__field188 = src->__sn__field188;
+    dst.__sn__field189 = src->__sn__field189;
+    dst.__sn__field190 = src->__sn__field190;
+    dst.__sn__field191 = src->__sn__field191;
+    dst.__sn__field192 = src->__sn__field192;
+    dst.__sn__field193 = src->__sn__field193;
+    dst.__sn__field194 = src->__sn__field194;
+    dst.__sn__field195 = src->__sn__field195;
+    dst.__sn__field196 = src->__sn__field196;
+    dst.__sn__field197 = src->__sn__field197;
+    dst.__sn__field198 = src->__sn__field198;
+    dst.__sn__field199 = src->__sn__field199;
+    dst.__sn__field200 = src->__sn__field200;
+    dst.__sn__field201 = src->__sn__field201;
+    dst.__sn__field202 = src->__sn__field202;
+    dst.__sn__field203 = src->__sn__field203;
+    dst.__sn__field204 = src->__sn__field204;
+    dst.__sn__field205 = src->__sn__field205;
+    dst.__sn__field206 = src->__sn__field206;
+    dst.__sn__field207 = src->__sn__field207;
+    dst.__sn__field208 = src->__sn__field208;
+    dst.__sn__field209 = src->__sn__field209;
+    dst.__sn__field210 = src->__sn__field210;
+    dst.__sn__field211 = src->__sn__field211;
+    dst.__sn__field212 = src->__sn__field212;
+    dst.__sn__field213 = src->__sn__field213;
+    dst.__sn__field214 = src->__sn__field214;
+    dst.__sn__field215 = src->__sn__field215;
+    dst.__sn__field216 = src->__sn__field216;
+    dst.__sn__field217 = src->__sn__field217;
+    dst.__sn__field218 = src->__sn__field218;
+    dst.__sn__field219 = src->__sn__field219;
+    dst.__sn__field220 = src->__sn__field220;
+    dst.__sn__field221 = src->__sn__field221;
+    dst.__sn__field222 = src->__sn__field222;
+    dst.__sn__field223 = src->__sn__field223;
+    dst.__sn__field224 = src->__sn__field224;
+    dst.__sn__field225 = src->__sn__field225;
+    dst.__sn__field226 = src->__sn__field226;
+    dst.__sn__field227 = src->__sn__field227;
+    dst.__sn__field228 = src->__sn__field228;
+    dst.__sn__field229 = src->__sn__field229;
+    dst.__sn__field230 = src->__sn__field230;
+    dst.__sn__field231 = src->__sn__field231;
+    dst.__sn__field232 = src->__sn__field232;
+    dst.__sn__field233 = src->__sn__field233;
+    dst.__sn__field234 = src->__sn__field234;
+    dst.__sn__field235 = src->__sn__field235;
+    dst.__sn__field236 = src->__sn__field236;
+    dst.__sn__field237 = src->__sn__field237;
+    dst.__sn__field238 = src->__sn__field238;
+    dst.__sn__field239 = src->__sn__field239;
+    dst.__sn__field240 = src->__sn__field240;
+    dst.__sn__field241 = src->__sn__field241;
+    dst.__sn__field242 = src->__sn__field242;
+    dst.__sn__field243 = src->__sn__field243;
+    dst.__sn__field244 = src->__sn__field244;
+    dst.__sn__field245 = src->__sn__field245;
+    dst.__sn__field246 = src->__sn__field246;
+    dst.__sn__field247 = src->__sn__field247;
+    dst.__sn__field248 = src->__sn__field248;
+    dst.__sn__field249 = src->__sn__field249;
+    dst.__sn__field250 = src->__sn__field250;
+    dst.__sn__field251 = src->__sn__field251;
+    dst.__sn__field252 = src->__sn__field252;
+    dst.__sn__field253 = src->__sn__field253;
+    dst.__sn__field254 = src->__sn__field254;
+    dst.__sn__field255 = src->__sn__field255;
+    dst.__sn__field256 = src->__sn__field256;
+    dst.__sn__field257 = src->__sn__field257;
+    dst.__sn__field258 = src->__sn__field258;
+    dst.__sn__field259 = src->__sn__field259;
+    dst.__sn__field260 = src->__sn__field260;
+    dst.__sn__field261 = src->__sn__field261;
+    dst.__sn__field262 = src->__sn__field262;
+    dst.__sn__field263 = src->__sn__field263;
+    dst.__sn__field264 = src->__sn__field264;
+    dst.__sn__field265 = src->__sn__field265;
+    dst.__sn__field266 = src->__sn__field266;
+    dst.__sn__field267 = src->__sn__field267;
+    dst.__sn__field268 = src->__sn__field268;
+    dst.__sn__field269 = src->__sn__field269;
+    dst.__sn__field270 = src->__sn__field270;
+    dst.__sn__field271 = src->__sn__field271;
+    dst.__sn__field272 = src->__sn__field272;
+    dst.__sn__field273 = src->__sn__field273;
+    dst.__sn__field274 = src->__sn__field274;
+    dst.__sn__field275 = src->__sn__field275;
+    dst.__sn__field276 = src->__sn__field276;
+    dst.__sn__field277 = src->__sn__field277;
+    dst.__sn__field278 = src->__sn__field278;
+    dst.__sn__field279 = src->__sn__field279;
+    dst.__sn__field280 = src->__sn__field280;
+    dst.__sn__field281 = src->__sn__field281;
+    dst.__sn__field282 = src->__sn__field282;
+    dst.__sn__field283 = src->__sn__field283;
+    dst.__sn__field284 = src->__sn__field284;
+    dst.__sn__field285 = src->__sn__field285;
+    dst.__sn__field286 = src->__sn__field286;
+    dst.__sn__field287 = src->__sn__field287;
+    dst.__sn__field288 = src->__sn__field288;
+    dst.__sn__field289 = src->__sn__field289;
+    dst.__sn__field290 = src->__sn__field290;
+    dst.__sn__field291 = src->__sn__field291;
+    dst.__sn__field292 = src->__sn__field292;
+    dst.__sn__field293 = src->__sn__field293;
+    dst.__sn__field294 = src->__sn__field294;
+    dst.__sn__field295 = src->__sn__field295;
+    dst.__sn__field296 = src->__sn__field296;
+    dst.__sn__field297 = src->__sn__field297;
+    dst.__sn__field298 = src->__sn__field298;
+    dst.__sn__field299 = src->__sn__field299;
+    dst.__sn__field300 = src->__sn__field300;
+    dst.__sn__field301 = src->__sn__field301;
+    dst.__sn__field302 = src->__sn__field302;
+    dst.__sn__field303 = src->__sn__field303;
+    dst.__sn__field304 = src->__sn__field304;
+    dst.__sn__field305 = src->__sn__field305;
+    dst.__sn__field306 = src->__sn__field306;
+    dst.__sn__field307 = src->__sn__field307;
+    dst.__sn__field308 = src->__sn__field308;
+    dst.__sn__field309 = src->__sn__field309;
+    dst.__sn__field310 = src->__sn__field310;
+    dst.__sn__field311 = src->__sn__field311;
+    dst.__sn__field312 = src->__sn__field312;
+    dst.__sn__field313 = src->__sn__field313;
+    dst.__sn__field314 = src->__sn__field314;
+    dst.__sn__field315 = src->__sn__field315;
+    dst.__sn__field316 = src->__sn__field316;
+    dst.__sn__field317 = src->__sn__field317;
+    dst.__sn__field318 = src->__sn__field318;
+    dst.__sn__field319 = src->__sn__field319;
+    dst.__sn__field320 = src->__sn__field320;
+    dst.__sn__field321 = src->__sn__field321;
+    dst.__sn__field322 = src->__sn__field322;
+    dst.__sn__field323 = src->__sn__field323;
+    dst.__sn__field324 = src->__sn__field324;
+    dst.__sn__field325 = src->__sn__field325;
+    dst.__sn__field326 = src->__sn__field326;
+    dst.__sn__field327 = src->__sn__field327;
+    dst.__sn__field328 = src->__sn__field328;
+    dst.__sn__field329 = src->__sn__field329;
+    dst.__sn__field330 = src->__sn__field330;
+    dst.__sn__field331 = src->__sn__field331;
+    dst.__sn__field332 = src->__sn__field332;
+    dst.__sn__field333 = src->__sn__field333;
+    dst.__sn__field334 = src->__sn__field334;
+    dst.__sn__field335 = src->__sn__field335;
+    dst.__sn__field336 = src->__sn__field336;
+    dst.__sn__field337 = src->__sn__field337;
+    dst.__sn__field338 = src->__sn__field338;
+    dst.__sn__field339 = src->__sn__field339;
+    dst.__sn__field340 = src->__sn__field340;
+    dst.__sn__field341 = src->__sn__field341;
+    dst.__sn__field342 = src->__sn__field342;
+    dst.__sn__field343 = src->__sn__field343;
+    dst.__sn__field344 = src->__sn__field344;
+    dst.__sn__field345 = src->__sn__field345;
+    dst.__sn__field346 = src->__sn__field346;
+    dst.__sn__field347 = src->__sn__field347;
+    dst.__sn__field348 = src->__sn__field348;
+    dst.__sn__field349 = src->__sn__field349;
+    dst.__sn__field350 = src->__sn__field350;
+    dst.__sn__field351 = src->__sn__field351;
+    dst.__sn__field352 = src->__sn__field352;
+    dst.__sn__field353 = src->__sn__field353;
+    dst.__sn__field354 = src->__sn__field354;
+    dst.__sn__field355 = src->__sn__field355;
+    dst.__sn__field356 = src->__sn__field356;
+    dst.__sn__field357 = src->__sn__field357;
+    dst.__sn__field358 = src->__sn__field358;
+    dst.__sn__field359 = src->__sn__field359;
+    dst.__sn__field360 = src->__sn__field360;
+    dst.__sn__field361 = src->__sn__field361;
+    dst.__sn__field362 = src->__sn__field362;
+    dst.__sn__field363 = src->__sn__field363;
+    dst.__sn__field364 = src->__sn__field364;
+    dst.__sn__field365 = src->__sn__field365;
+    dst.__sn__field366 = src->__sn__field366;
+    dst.__sn__field367 = src->__sn__field367;
+    dst.__sn__field368 = src->__sn__field368;
+    dst.__sn__field369 = src->__sn__field369;
+    dst.__sn__field370 = src->__sn__field370;
+    dst.__sn__field371 = src->__sn__field371;
+    dst.__sn__field372 = src->__sn__field372;
+    dst.__sn__field373 = src->__sn__field373;
+    dst.__sn__field374 = src->__sn__field374;
+    dst.__sn__field375 = src->__sn__field375;
+    dst.__sn__field376 = src->__sn__field376;
+    dst.__sn__field377 = src->__sn__field377;
+    dst.__sn__field378 = src->__sn__field378;
+    dst.__sn__field379 = src->__sn__field379;
+    dst.__sn__field380 = src->__sn__field380;
+    dst.__sn__field381 = src->__sn__field381;
+    dst.__sn__field382 = src->__sn__field382;
+    dst.__sn__field383 = src->__sn__field383;
+    dst.__sn__field384 = src->__sn__field384;
+    dst.__sn__field385 = src->__sn__field385;
+    dst.__sn__field386 = src->__sn__field386;
+    dst.__sn__field387 = src->__sn__field387;
+    dst.__sn__field388 = src->__sn__field388;
+    dst.__sn__field389 = src->__sn__field389;
+    dst.__sn__field390 = src->__sn__field390;
+    dst.__sn__field391 = src->__sn__field391;
+    dst.__sn__field392 = src->__sn__field392;
+    dst.__sn__field393 = src->__sn__field393;
+    dst.__sn__field394 = src->__sn__field394;
+    dst.__sn__field395 = src->__sn__field395;
+    dst.__sn__field396 = src->__sn__field396;
+    dst.__sn__field397 = src->__sn__field397;
+    dst.__sn__field398 = src->__sn__field398;
+    dst.__sn__field399 = src->__sn__field399;
+    dst.__sn__field400 = src->__sn__field400;
+    dst.__sn__field401 = src->__sn__field401;
+    dst.__sn__field402 = src->__sn__field402;
+    dst.__sn__field403 = src->__sn__field403;
+    dst.__sn__field404 = src->__sn__field404;
+    dst.__sn__field405 = src->__sn__field405;
+    dst.__sn__field406 = src->__sn__field406;
+    dst.__sn__field407 = src->__sn__field407;
+    dst.__sn__field408 = src->__sn__field408;
+    dst.__sn__field409 = src->__sn__field409;
+    dst.__sn__field410 = src->__sn__field410;
+    dst.__sn__field411 = src->__sn__field411;
+    dst.__sn__field412 = src->__sn__field412;
+    dst.__sn__field413 = src->__sn__field413;
+    dst.__sn__field414 = src->__sn__field414;
+    dst.__sn__field415 = src->__sn__field415;
+    dst.__sn__field416 = src->__sn__field416;
+    dst.__sn__field417 = src->__sn__field417;
+    dst.__sn__field418 = src->__sn__field418;
+    dst.__sn__field419 = src->__sn__field419;
+    dst.__sn__field420 = src->__sn__field420;
+    dst.__sn__field421 = src->__sn__field421;
+    dst.__sn__field422 = src->__sn__field422;
+    dst.__sn__field423 = src->__sn__field423;
+    dst.__sn__field424 = src->__sn__field424;
+    dst.__sn__field425 = src->__sn__field425;
+    dst.__sn__field426 = src->__sn__field426;
+    dst.__sn__field427 = src->__sn__field427;
+    dst.__sn__field428 = src->__sn__field428;
+    dst.__sn__field429 = src->__sn__field429;
+    dst.__sn__field430 = src->__sn__field430;
+    dst.__sn__field431 = src->__sn__field431;
+    dst.__sn__field432 = src->__sn__field432;
+    dst.__sn__field433 = src->__sn__field433;
+    dst.__sn__field434 = src->__sn__field434;
+    dst.__sn__field435 = src->__sn__field435;
+    dst.__sn__field436 = src->__sn__field436;
+    dst.__sn__field437 = src->__sn__field437;
+    dst.__sn__field438 = src->__sn__field438;
+    dst.__sn__field439 = src->__sn__field439;
+    dst.__sn__field440 = src->__sn__field440;
+    dst.__sn__field441 = src->__sn__field441;
+    dst.__sn__field442 = src->__sn__field442;
+    dst.__sn__field443 = src->__sn__field443;
+    dst.__sn__field444 = src->__sn__field444;
+    dst.__sn__field445 = src->__sn__field445;
+    dst.__sn__field446 = src->__sn__field446;
+    dst.__sn__field447 = src->__sn__field447;
+    dst.__sn__field448 = src->__sn__field448;
+    dst.__sn__field449 = src->__sn__field449;
+    dst.__sn__field450 = src->__sn__field450;
+    dst.__sn__field451 = src->__sn__field451;
+    dst.__sn__field452 = src->__sn__field452;
+    dst.__sn__field453 = src->__sn__field453;
+    dst.__sn__field454 = src->__sn__field454;
+    dst.__sn__field455 = src->__sn__field455;
+    dst.__sn__field456 = src->__sn__field456;
+    dst.__sn__field457 = src->__sn__field457;
+    dst.__sn__field458 = src->__sn__field458;
+    dst.__sn__field459 = src->__sn__field459;
+    dst.__sn__field460 = src->__sn__field460;
+    dst.__sn__field461 = src->__sn__field461;
+    dst.__sn__field462 = src->__sn__field462;
+    dst.__sn__field463 = src->__sn__field463;
+    dst.__sn__field464 = src->__sn__field464;
+    dst.__sn__field465 = src->__sn__field465;
+    dst.__sn__field466 = src->__sn__field466;
+    dst.__sn__field467 = src->__sn__field467;
+    dst.__sn__field468 = src->__sn__field468;
+    dst.__sn__field469 = src->__sn__field469;
+    dst.__sn__field470 = src->__sn__field470;
+    dst.__sn__field471 = src->__sn__field471;
+    dst.__sn__field472 = src->__sn__field472;
+    dst.__sn__field473 = src->__sn__field473;
+    dst.__sn__field474 = src->__sn__field474;
+    dst.__sn__field475 = src->__sn__field475;
+    dst.__sn__field476 = src->__sn__field476;
+    dst.__sn__field477 = src->__sn__field477;
+    dst.__sn__field478 = src->__sn__field478;
+    dst.__sn__field479 = src->__sn__field479;
+    dst.__sn__field480 = src->__sn__field480;
+    dst.__sn__field481 = src->__sn__field481;
+    dst.__sn__field482 = src->__sn__field482;
+    dst.__sn__field483 = src->__sn__field483;
+    dst.__sn__field484 = src->__sn__field484;
+    dst.__sn__field485 = src->__sn__field485;
+    dst.__sn__field486 = src->__sn__field486;
+    dst.__sn__field487 = src->__sn__field487;
+    dst.__sn__field488 = src->__sn__field488;
+    dst.__sn__field489 = src->__sn__field489;
+    dst.__sn__field490 = src->__sn__field490;
+    dst.__sn__field491 = src->__sn__field491;
+    dst.__sn__field492 = src->__sn__field492;
+    dst.__sn__field493 = src->__sn__field493;
+    dst.__sn__field494 = src->__sn__field494;
+    dst.__sn__field495 = src->__sn__field495;
+    dst.__sn__field496 = src->__sn__field496;
+    dst.__sn__field497 = src->__sn__field497;
+    dst.__sn__field498 = src->__sn__field498;
+    dst.__sn__field499 = src->__sn__field499;
+    dst.__sn__field500 = src->__sn__field500;
+    dst.__sn__field501 = src->__sn__field501;
+    dst.__sn__field502 = src->__sn__field502;
+    dst.__sn__field503 = src->__sn__field503;
+    dst.__sn__field504 = src->__sn__field504;
+    dst.__sn__field505 = src->__sn__field505;
+    dst.__sn__field506 = src->__sn__field506;
+    dst.__sn__field507 = src->__sn__field507;
+    dst.__sn__field508 = src->__sn__field508;
+    dst.__sn__field509 = src->__sn__field509;
+    dst.__sn__field510 = src->__sn__field510;
+    dst.__sn__field511 = src->__sn__field511;
+    dst.__sn__field512 = src->__sn__field512;
+    dst.__sn__field513 = src->__sn__field513;
+    dst.__sn__field514 = src->__sn__field514;
+    dst.__sn__field515 = src->__sn__field515;
+    dst.__sn__field516 = src->__sn__field516;
+    dst.__sn__field517 = src->__sn__field517;
+    dst.__sn__field518 = src->__sn__field518;
+    dst.__sn__field519 = src->__sn__field519;
+    dst.__sn__field520 = src->__sn__field520;
+    dst.__sn__field521 = src->__sn__field521;
+    dst.__sn__field522 = src->__sn__field522;
+    dst.__sn__field523 = src->__sn__field523;
+    dst.__sn__field524 = src->__sn__field524;
+    dst.__sn__field525 = src->__sn__field525;
+    dst.__sn__field526 = src->__sn__field526;
+    dst.__sn__field527 = src->__sn__field527;
+    dst.__sn__field528 = src->__sn__field528;
+    dst.__sn__field529 = src->__sn__field529;
+    dst.__sn__field530 = src->__sn__field530;
+    dst.__sn__field531 = src->__sn__field531;
+    dst.__sn__field532 = src->__sn__field532;
+    dst.__sn__field533 = src->__sn__field533;
+    dst.__sn__field534 = src->__sn__field534;
+    dst.__sn__field535 = src->__sn__field535;
+    dst.__sn__field536 = src->__sn__field536;
+    dst.__sn__field537 = src->__sn__field537;
+    dst.__sn__field538 = src->__sn__field538;
+    dst.__sn__field539 = src->__sn__field539;
+    dst.__sn__field540 = src->__sn__field540;
+    dst.__sn__field541 = src->__sn__field541;
+    dst.__sn__field542 = src->__sn__field542;
+    dst.__sn__field543 = src->__sn__field543;
+    dst.__sn__field544 = src->__sn__field544;
+    dst.__sn__field545 = src->__sn__field545;
+    dst.__sn__field546 = src->__sn__field546;
+    dst.__sn__field547 = src->__sn__field547;
+    dst.__sn__field548 = src->__sn__field548;
+    dst.__sn__field549 = src->__sn__field549;
+    dst.__sn__field550 = src->__sn__field550;
+    dst.__sn__field551 = src->__sn__field551;
+    dst.__sn__field552 = src->__sn__field552;
+    dst.__sn__field553 = src->__sn__field553;
+    dst.__sn__field554 = src->__sn__field554;
+    dst.__sn__field555 = src->__sn__field555;
+    dst.__sn__field556 = src->__sn__field556;
+    dst.__sn__field557 = src->__sn__field557;
+    dst.__sn__field558 = src->__sn__field558;
+    dst.__sn__field559 = src->__sn__field559;
+    dst.__sn__field560 = src->__sn__field560;
+    dst.__sn__field561 = src->__sn__field561;
+    dst.__sn__field562 = src->__sn__field562;
+    dst.__sn__field563 = src->__sn__field563;
+    dst.__sn__field564 = src->__sn__field564;
+    dst.__sn__field565 = src->__sn__field565;
+    dst.__sn__field566 = src->__sn__field566;
+    dst.__sn__field567 = src->__sn__field567;
+    dst.__sn__field568 = src->__sn__field568;
+    dst.__sn__field569 = src->__sn__field569;
+    dst.__sn__field570 = src->__sn__field570;
+    dst.__sn__field571 = src->__sn__field571;
+    dst.__sn__field572 = src->__sn__field572;
+    dst.__sn__field573 = src->__sn__field573;
+    dst.__sn__field574 = src->__sn__field574;
+    dst.__sn__field575 = src->__sn__field575;
+    dst.__sn__field576 = src->__sn__field576;
+    dst.__sn__field577 = src->__sn__field577;
+    dst.__sn__field578 = src->__sn__field578;
+    dst.__sn__field579 = src->__sn__field579;
+    dst.__sn__field580 = src->__sn__field580;
+    dst.__sn__field581 = src->__sn__field581;
+    dst.__sn__field582 = src->__sn__field582;
+    dst.__sn__field583 = src->__sn__field583;
+    dst.__sn__field584 = src->__sn__field584;
+    dst.__sn__field585 = src->__sn__field585;
+    dst.__sn__field586 = src->__sn__field586;
+    dst.__sn__field587 = src->__sn__field587;
+    dst.__sn__field588 = src->__sn__field588;
+    dst.__sn__field589 = src->__sn__field589;
+    dst.__sn__field590 = src->__sn__field590;
+    dst.__sn__field591 = src->__sn__field591;
+    dst.__sn__field592 = src->__sn__field592;
+    dst.__sn__field593 = src->__sn__field593;
+    dst.__sn__field594 = src->__sn__field594;
+    dst.__sn__field595 = src->__sn__field595;
+    dst.__sn__field596 = src->__sn__field596;
+    dst.__sn__field597 = src->__sn__field597;
+    dst.__sn__field598 = src->__sn__field598;
+    dst.__sn__field599 = src->__sn__field599;
+    dst.__sn__field600 = src->__sn__field600;
+    dst.__sn__field601 = src->__sn__field601;
+    dst.__sn__field602 = src->__sn__field602;
+    dst.__sn__field603 = src->__sn__field603;
+    dst.__sn__field604 = src->__sn__field604;
+    dst.__sn__field605 = src->__sn__field605;
+    dst.__sn__field606 = src->__sn__field606;
+    dst.__sn__field607 = src->__sn__field607;
+    dst.__sn__field608 = src->__sn__field608;
+    dst.__sn__field609 = src->__sn__field609;
+    dst.__sn__field610 = src->__sn__field610;
+    dst.__sn__field611 = src->__sn__field611;
+    dst.__sn__field612 = src->__sn__field612;
+    dst.__sn__field613 = src->__sn__field613;
+    dst.__sn__field614 = src->__sn__field614;
+    dst.__sn__field615 = src->__sn__field615;
+    dst.__sn__field616 = src->__sn__field616;
+    dst.__sn__field617 = src->__sn__field617;
+    dst.__sn__field618 = src->__sn__field618;
+    dst.__sn__field619 = src->__sn__field619;
+    dst.__sn__field620 = src->__sn__field620;
+    dst.__sn__field621 = src->__sn__field621;
+    dst.__sn__field622 = src->__sn__field622;
+    dst.__sn__field623 = src->__sn__field623;
+    dst.__sn__field624 = src->__sn__field624;
+    dst.__sn__field625 = src->__sn__field625;
+    dst.__sn__field626 = src->__sn__field626;
+    dst.__sn__field627 = src->__sn__field627;
+    dst.__sn__field628 = src->__sn__field628;
+    dst.__sn__field629 = src->__sn__field629;
+    dst.__sn__field630 = src->__sn__field630;
+    dst.__sn__field631 = src->__sn__field631;
+    dst.__sn__field632 = src->__sn__field632;
+    dst.__sn__field633 = src->__sn__field633;
+    dst.__sn__field634 = src->__sn__field634;
+    dst.__sn__field635 = src->__sn__field635;
+    dst.__sn__field636 = src->__sn__field636;
+    dst.__sn__field637 = src->__sn__field637;
+    dst.__sn__field638 = src->__sn__field638;
+    dst.__sn__field639 = src->__sn__field639;
+    dst.__sn__field640 = src->__sn__field640;
+    dst.__sn__field641 = src->__sn__field641;
+    dst.__sn__field642 = src->__sn__field642;
+    dst.__sn__field643 = src->__sn__field643;
+    dst.__sn__field644 = src->__sn__field644;
+    dst.__sn__field645 = src->__sn__field645;
+    dst.__sn__field646 = src->__sn__field646;
+    dst.__sn__field647 = src->__sn__field647;
+    dst.__sn__field648 = src->__sn__field648;
+    dst.__sn__field649 = src->__sn__field649;
+    dst.__sn__field650 = src->__sn__field650;
+    dst.__sn__field651 = src->__sn__field651;
+    dst.__sn__field652 = src->__sn__field652;
+    dst.__sn__field653 = src->__sn__field653;
+    dst.__sn__field654 = src->__sn__field654;
+    dst.__sn__field655 = src->__sn__field655;
+    dst.__sn__field656 = src->__sn__field656;
+    dst.__sn__field657 = src->__sn__field657;
+    dst.__sn__field658 = src->__sn__field658;
+    dst.__sn__field659 = src->__sn__field659;
+    dst.__sn__field660 = src->__sn__field660;
+    dst.__sn__field661 = src->__sn__field661;
+    dst.__sn__field662 = src->__sn__field662;
+    dst.__sn__field663 = src->__sn__field663;
+    dst.__sn__field664 = src->__sn__field664;
+    dst.__sn__field665 = src->__sn__field665;
+    dst.__sn__field666 = src->__sn__field666;
+    dst.__sn__field667 = src->__sn__field667;
+    dst.__sn__field668 = src->__sn__field668;
+    dst.__sn__field669 = src->__sn__field669;
+    dst.__sn__field670 = src->__sn__field670;
+    dst.__sn__field671 = src->__sn__field671;
+    dst.__sn__field672 = src->__sn__field672;
+    dst.__sn__field673 = src->__sn__field673;
+    dst.__sn__field674 = src->__sn__field674;
+    dst.__sn__field675 = src->__sn__field675;
+    dst.__sn__field676 = src->__sn__field676;
+    dst.__sn__field677 = src->__sn__field677;
+    dst.__sn__field678 = src->__sn__field678;
+    dst.__sn__field679 = src->__sn__field679;
+    dst.__sn__field680 = src->__sn__field680;
+    dst.__sn__field681 = src->__sn__field681;
+    dst.__sn__field682 = src->__sn__field682;
+    dst.__sn__field683 = src->__sn__field683;
+    dst.__sn__field684 = src->__sn__field684;
+    dst.__sn__field685 = src->__sn__field685;
+    dst.__sn__field686 = src->__sn__field686;
+    dst.__sn__field687 = src->__sn__field687;
+    dst.__sn__field688 = src->__sn__field688;
+    dst.__sn__field689 = src->__sn__field689;
+    dst.__sn__field690 = src->__sn__field690;
+    dst.__sn__field691 = src->__sn__field691;
+    dst.__sn__field692 = src->__sn__field692;
+    dst.__sn__field693 = src->__sn__field693;
+    dst.__sn__field694 = src->__sn__field694;
+    dst.__sn__field695 = src->__sn__field695;
+    dst.__sn__field696 = src->__sn__field696;
+    dst.__sn__field697 = src->__sn__field697;
+    dst.__sn__field698 = src->__sn__field698;
+    dst.__sn__field699 = src->__sn__field699;
+    dst.__sn__field700 = src->__sn__field700;
+    dst.__sn__field701 = src->__sn__field701;
+    dst.__sn__field702 = src->__sn__field702;
+    dst.__sn__field703 = src->__sn__field703;
+    dst.__sn__field704 = src->__sn__field704;
+    dst.__sn__field705 = src->__sn__field705;
+    dst.__sn__field706 = src->__sn__field706;
+    dst.__sn__field707 = src->__sn__field707;
+    dst.__sn__field708 = src->__sn__field708;
+    dst.__sn__field709 = src->__sn__field709;
+    dst.__sn__field710 = src->__sn__field710;
+    dst.__sn__field711 = src->__sn__field711;
+    dst.__sn__field712 = src->__sn__field712;
+    dst.__sn__field713 = src->__sn__field713;
+    dst.__sn__field714 = src->__sn__field714;
+    dst.__sn__field715 = src->__sn__field715;
+    dst.__sn__field716 = src->__sn__field716;
+    dst.__sn__field717 = src->__sn__field717;
+    dst.__sn__field718 = src->__sn__field718;
+    dst.__sn__field719 = src->__sn__field719;
+    dst.__sn__field720 = src->__sn__field720;
+    dst.__sn__field721 = src->__sn__field721;
+    dst.__sn__field722 = src->__sn__field722;
+    dst.__sn__field723 = src->__sn__field723;
+    dst.__sn__field724 = src->__sn__field724;
+    dst.__sn__field725 = src->__sn__field725;
+    dst.__sn__field726 = src->__sn__field726;
+    dst.__sn__field727 = src->__sn__field727;
+    dst.__sn__field728 = src->__sn__field728;
+    dst.__sn__field729 = src->__sn__field729;
+    dst.__sn__field730 = src->__sn__field730;
+    dst.__sn__field731 = src->__sn__field731;
+    dst.__sn__field732 = src->__sn__field732;
+    dst.__sn__field733 = src->__sn__field733;
+    dst.__sn__field734 = src->__sn__field734;
+    dst.__sn__field735 = src->__sn__field735;
+    dst.__sn__field736 = src->__sn__field736;
+    dst.__sn__field737 = src->__sn__field737;
+    dst.__sn__field738 = src->__sn__field738;
+    dst.__sn__field739 = src->__sn__field739;
+    dst.__sn__field740 = src->__sn__field740;
+    dst.__sn__field741 = src->__sn__field741;
+    dst.__sn__field742 = src->__sn__field742;
+    dst.__sn__field743 = src->__sn__field743;
+    dst.__sn__field744 = src->__sn__field744;
+    dst.__sn__field745 = src->__sn__field745;
+    dst.__sn__field746 = src->__sn__field746;
+    dst.__sn__field747 = src->__sn__field747;
+    dst.__sn__field748 = src->__sn__field748;
+    dst.__sn__field749 = src->__sn__field749;
+    dst.__sn__field750 = src->__sn__field750;
+    dst.__sn__field751 = src->__sn__field751;
+    dst.__sn__field752 = src->__sn__field752;
+    dst.__sn__field753 = src->__sn__field753;
+    dst.__sn__field754 = src->__sn__field754;
+    dst.__sn__field755 = src->__sn__field755;
+    dst.__sn__field756 = src->__sn__field756;
+    dst.__sn__field757 = src->__sn__field757;
+    dst.__sn__field758 = src->__sn__field758;
+    dst.__sn__field759 = src->__sn__field759;
+    dst.__sn__field760 = src->__sn__field760;
+    dst.__sn__field761 = src->__sn__field761;
+    dst.__sn__field762 = src->__sn__field762;
+    dst.__sn__field763 = src->__sn__field763;
+    dst.__sn__field764 = src->__sn__field764;
+    dst.__sn__field765 = src->__sn__field765;
+    dst.__sn__field766 = src->__sn__field766;
+    dst.__sn__field767 = src->__sn__field767;
+    dst.__sn__field768 = src->__sn__field768;
+    dst.__sn__field769 = src->__sn__field769;
+    dst.__sn__field770 = src->__sn__field770;
+    dst.__sn__field771 = src->__sn__field771;
+    dst.__sn__field772 = src->__sn__field772;
+    dst.__sn__field773 = src->__sn__field773;
+    dst.__sn__field774 = src->__sn__field774;
+    dst.__sn__field775 = src->__sn__field775;
+    dst.__sn__field776 = src->__sn__field776;
+    dst.__sn__field777 = src->__sn__field777;
+    dst.__sn__field778 = src->__sn__field778;
+    dst.__sn__field779 = src->__sn__field779;
+    dst.__sn__field780 = src->__sn__field780;
+    dst.__sn__field781 = src->__sn__field781;
+    dst.__sn__field782 = src->__sn__field782;
+    dst.__sn__field783 = src->__sn__field783;
+    dst.__sn__field784 = src->__sn__field784;
+    dst.__sn__field785 = src->__sn__field785;
+    dst.__sn__field786 = src->__sn__field786;
+    dst.__sn__field787 = src->__sn__field787;
+    dst.__sn__field788 = src->__sn__field788;
+    dst.__sn__field789 = src->__sn__field789;
+    dst.__sn__field790 = src->__sn__field790;
+    dst.__sn__field791 = src->__sn__field791;
+    dst.__sn__field792 = src->__sn__field792;
+    dst.__sn__field793 = src->__sn__field793;
+    dst.__sn__field794 = src->__sn__field794;
+    dst.__sn__field795 = src->__sn__field795;
+    dst.__sn__field796 = src->__sn__field796;
+    dst.__sn__field797 = src->__sn__field797;
+    dst.__sn__field798 = src->__sn__field798;
+    dst.__sn__field799 = src->__sn__field799;
+    dst.__sn__field800 = src->__sn__field800;
+    dst.__sn__field801 = src->__sn__field801;
+    dst.__sn__field802 = src->__sn__field802;
+    dst.__sn__field803 = src->__sn__field803;
+    dst.__sn__field804 = src->__sn__field804;
+    dst.__sn__field805 = src->__sn__field805;
+    dst.__sn__field806 = src->__sn__field806;
+    dst.__sn__field807 = src->__sn__field807;
+    dst.__sn__field808 = src->__sn__field808;
+    dst.__sn__field809 = src->__sn__field809;
+    dst.__sn__field810 = src->__sn__field810;
+    dst.__sn__field811 = src->__sn__field811;
+    dst.__sn__field812 = src->__sn__field812;
+    dst.__sn__field813 = src->__sn__field813;
+    dst.__sn__field814 = src->__sn__field814;
+    dst.__sn__field815 = src->__sn__field815;
+    dst.__sn__field816 = src->__sn__field816;
+    dst.__sn__field817 = src->__sn__field817;
+    dst.__sn__field818 = src->__sn__field818;
+    dst.__sn__field819 = src->__sn__field819;
+    dst.__sn__field820 = src->__sn__field820;
+    dst.__sn__field821 = src->__sn__field821;
+    dst.__sn__field822 = src->__sn__field822;
+    dst.__sn__field823 = src->__sn__field823;
+    dst.__sn__field824 = src->__sn__field824;
+    dst.__sn__field825 = src->__sn__field825;
+    dst.__sn__field826 = src->__sn__field826;
+    dst.__sn__field827 = src->__sn__field827;
+    dst.__sn__field828 = src->__sn__field828;
+    dst.__sn__field829 = src->__sn__field829;
+    dst.__sn__field830 = src->__sn__field830;
+    dst.__sn__field831 = src->__sn__field831;
+    dst.__sn__field832 = src->__sn__field832;
+    dst.__sn__field833 = src->__sn__field833;
+    dst.__sn__field834 = src->__sn__field834;
+    dst.__sn__field835 = src->__sn__field835;
+    dst.__sn__field836 = src->__sn__field836;
+    dst.__sn__field837 = src->__sn__field837;
+    dst.__sn__field838 = src->__sn__field838;
+    dst.__sn__field839 = src->__sn__field839;
+    dst.__sn__field840 = src->__sn__field840;
+    dst.__sn__field841 = src->__sn__field841;
+    dst.__sn__field842 = src->__sn__field842;
+    dst.__sn__field843 = src->__sn__field843;
+    dst.__sn__field844 = src->__sn__field844;
+    dst.__sn__field845 = src->__sn__field845;
+    dst.__sn__field846 = src->__sn__field846;
+    dst.__sn__field847 = src->__sn__field847;
+    dst.__sn__field848 = src->__sn__field848;
+    dst.__sn__field849 = src->__sn__field849;
+    dst.__sn__field850 = src->__sn__field850;
+    dst.__sn__field851 = src->__sn__field851;
+    dst.__sn__field852 = src->__sn__field852;
+    dst.__sn__field853 = src->__sn__field853;
+    dst.__sn__field854 = src->__sn__field854;
+    dst.__sn__field855 = src->__sn__field855;
+    dst.__sn__field856 = src->__sn__field856;
+    dst.__sn__field857 = src->__sn__field857;
+    dst.__sn__field858 = src->__sn__field858;
+    dst.__sn__field859 = src->__sn__field859;
+    dst.__sn__field860 = src->__sn__field860;
+    dst.__sn__field861 = src->__sn__field861;
+    dst.__sn__field862 = src->__sn__field862;
+    dst.__sn__field863 = src->__sn__field863;
+    dst.__sn__field864 = src->__sn__field864;
+    dst.__sn__field865 = src->__sn__field865;
+    dst.__sn__field866 = src->__sn__field866;
+    dst.__sn__field867 = src->__sn__field867;
+    dst.__sn__field868 = src->__sn__field868;
+    dst.__sn__field869 = src->__sn__field869;
+    dst.__sn__field870 = src->__sn__field870;
+    dst.__sn__field871 = src->__sn__field871;
+    dst.__sn__field872 = src->__sn__field872;
+    dst.__sn__field873 = src->__sn__field873;
+    dst.__sn__field874 = src->__sn__field874;
+    dst.__sn__field875 = src->__sn__field875;
+    dst.__sn__field876 = src->__sn__field876;
+    dst.__sn__field877 = src->__sn__field877;
+    dst.__sn__field878 = src->__sn__field878;
+    dst.__sn__field879 = src->__sn__field879;
+    dst.__sn__field880 = src->__sn__field880;
+    dst.__sn__field881 = src->__sn__field881;
+    dst.__sn__field882 = src->__sn__field882;
+    dst.__sn__field883 = src->__sn__field883;
+    dst.__sn__field884 = src->__sn__field884;
+    dst.__sn__field885 = src->__sn__field885;
+    dst.__sn__field886 = src->__sn__field886;
+    dst.__sn__field887 = src->__sn__field887;
+    dst.__sn__field888 = src->__sn__field888;
+    dst.__sn__field889 = src->__sn__field889;
+    dst.__sn__field890 = src->__sn__field890;
+    dst.__sn__field891 = src->__sn__field891;
+    dst.__sn__field892 = src->__sn__field892;
+    dst.__sn__field893 = src->__sn__field893;
+    dst.__sn__field894 = src->__sn__field894;
+    dst.__sn__field895 = src->__sn__field895;
+    dst.__sn__field896 = src->__sn__field896;
+    dst.__sn__field897 = src->__sn__field897;
+    dst.__sn__field898 = src->__sn__field898;
+    dst.__sn__field899 = src->__sn__field899;
+    dst.__sn__field900 = src->__sn__field900;
+    dst.__sn__field901 = src->__sn__field901;
+    dst.__sn__field902 = src->__sn__field902;
+    dst.__sn__field903 = src->__sn__field903;
+    dst.__sn__field904 = src->__sn__field904;
+    dst.__sn__field905 = src->__sn__field905;
+    dst.__sn__field906 = src->__sn__field906;
+    dst.__sn__field907 = src->__sn__field907;
+    dst.__sn__field908 = src->__sn__field908;
+    dst.__sn__field909 = src->__sn__field909;
+    dst.__sn__field910 = src->__sn__field910;
+    dst.__sn__field911 = src->__sn__field911;
+    dst.__sn__field912 = src->__sn__field912;
+    dst.__sn__field913 = src->__sn__field913;
+    dst.__sn__field914 = src->__sn__field914;
+    dst.__sn__field915 = src->__sn__field915;
+    dst.__sn__field916 = src->__sn__field916;
+    dst.__sn__field917 = src->__sn__field917;
+    dst.__sn__field918 = src->__sn__field918;
+    dst.__sn__field919 = src->__sn__field919;
+    dst.__sn__field920 = src->__sn__field920;
+    dst.__sn__field921 = src->__sn__field921;
+    dst.__sn__field922 = src->__sn__field922;
+    dst.__sn__field923 = src->__sn__field923;
+    dst.__sn__field924 = src->__sn__field924;
+    dst.__sn__field925 = src->__sn__field925;
+    dst.__sn__field926 = src->__sn__field926;
+    dst.__sn__field927 = src->__sn__field927;
+    dst.__sn__field928 = src->__sn__field928;
+    dst.__sn__field929 = src->__sn__field929;
+    dst.__sn__field930 = src->__sn__field930;
+    dst.__sn__field931 = src->__sn__field931;
+    dst.__sn__field932 = src->__sn__field932;
+    dst.__sn__field933 = src->__sn__field933;
+    dst.__sn__field934 = src->__sn__field934;
+    dst.__sn__field935 = src->__sn__field935;
+    dst.__sn__field936 = src->__sn__field936;
+    dst.__sn__field937 = src->__sn__field937;
+    dst.__sn__field938 = src->__sn__field938;
+    dst.__sn__field939 = src->__sn__field939;
+    dst.__sn__field940 = src->__sn__field940;
+    dst.__sn__field941 = src->__sn__field941;
+    dst.__sn__field942 = src->__sn__field942;
+    dst.__sn__field943 = src->__sn__field943;
+    dst.__sn__field944 = src->__sn__field944;
+    dst.__sn__field945 = src->__sn__field945;
+    dst.__sn__field946 = src->__sn__field946;
+    dst.__sn__field947 = src->__sn__field947;
+    dst.__sn__field948 = src->__sn__field948;
+    dst.__sn__field949 = src->__sn__field949;
+    dst.__sn__field950 = src->__sn__field950;
+    dst.__sn__field951 = src->__sn__field951;
+    dst.__sn__field952 = src->__sn__field952;
+    dst.__sn__field953 = src->__sn__field953;
+    dst.__sn__field954 = src->__sn__field954;
+    dst.__sn__field955 = src->__sn__field955;
+    dst.__sn__field956 = src->__sn__field956;
+    dst.__sn__field957 = src->__sn__field957;
+    dst.__sn__field958 = src->__sn__field958;
+    dst.__sn__field959 = src->__sn__field959;
+    dst.__sn__field960 = src->__sn__field960;
+    dst.__sn__field961 = src->__sn__field961;
+    dst.__sn__field962 = src->__sn__field962;
+    dst.__sn__field963 = src->__sn__field963;
+    dst.__sn__field964 = src->__sn__field964;
+    dst.__sn__field965 = src->__sn__field965;
+    dst.__sn__field966 = src->__sn__field966;
+    dst.__sn__field967 = src->__sn__field967;
+    dst.__sn__field968 = src->__sn__field968;
+    dst.__sn__field969 = src->__sn__field969;
+    dst.__sn__field970 = src->__sn__field970;
+    dst.__sn__field971 = src->__sn__field971;
+    dst.__sn__field972 = src->__sn__field972;
+    dst.__sn__field973 = src->__sn__field973;
+    dst.__sn__field974 = src->__sn__field974;
+    dst.__sn__field975 = src->__sn__field975;
+    dst.__sn__field976 = src->__sn__field976;
+    dst.__sn__field977 = src->__sn__field977;
+    dst.__sn__field978 = src->__sn__field978;
+    dst.__sn__field979 = src->__sn__field979;
+    dst.__sn__field980 = src->__sn__field980;
+    dst.__sn__field981 = src->__sn__field981;
+    dst.__sn__field982 = src->__sn__field982;
+    dst.__sn__field983 = src->__sn__field983;
+    dst.__sn__field984 = src->__sn__field984;
+    dst.__sn__field985 = src->__sn__field985;
+    dst.__sn__field986 = src->__sn__field986;
+    dst.__sn__field987 = src->__sn__field987;
+    dst.__sn__field988 = src->__sn__field988;
+    dst.__sn__field989 = src->__sn__field989;
+    dst.__sn__field990 = src->__sn__field990;
+    dst.__sn__field991 = src->__sn__field991;
+    dst.__sn__field992 = src->__sn__field992;
+    dst.__sn__field993 = src->__sn__field993;
+    dst.__sn__field994 = src->__sn__field994;
+    dst.__sn__field995 = src->__sn__field995;
+    dst.__sn__field996 = src->__sn__field996;
+    dst.__sn__field997 = src->__sn__field997;
+    dst.__sn__field998 = src->__sn__field998;
+    dst.__sn__field999 = src->__sn__field999;
+    dst.__sn__field1000 = src->__sn__field1000;
+    dst.__sn__field1001 = src->__sn__field1001;
+    dst.__sn__field1002 = src->__sn__field1002;
+    dst.__sn__field1003 = src->__sn__field1003;
+    dst.__sn__field1004 = src->__sn__field1004;
+    dst.__sn__field1005 = src->__sn__field1005;
+    dst.__sn__field1006 = src->__sn__field1006;
+    dst.__sn__field1007 = src->__sn__field1007;
+    dst.__sn__field1008 = src->__sn__field1008;
+    dst.__sn__field1009 = src->__sn__field1009;
+    dst.__sn__field1010 = src->__sn__field1010;
+    dst.__sn__field1011 = src->__sn__field1011;
+    dst.__sn__field1012 = src->__sn__field1012;
+    dst.__sn__field1013 = src->__sn__field1013;
+    dst.__sn__field1014 = src->__sn__field1014;
+    dst.__sn__field1015 = src->__sn__field1015;
+    dst.__sn__field1016 = src->__sn__field1016;
+    dst.__sn__field1017 = src->__sn__field1017;
+    dst.__sn__field1018 = src->__sn__field1018;
+    dst.__sn__field1019 = src->__sn__field1019;
+    dst.__sn__field1020 = src->__sn__field1020;
+    dst.__sn__field1021 = src->__sn__field1021;
+    dst.__sn__field1022 = src->__sn__field1022;
+    dst.__sn__field1023 = src->__sn__field1023;
+    return dst;
+}
+
+static inline void __sn__LargeStruct_cleanup(__sn__LargeStruct *p) {
+
+}
+
+#define sn_auto_LargeStruct __attribute__((cleanup(__sn__LargeStruct_cleanup)))
+
+static inline void __sn__LargeStruct_cleanup_elem(void *p) { __sn__LargeStruct_cleanup((__sn__LargeStruct *)p); }
+static inline void __sn__LargeStruct_copy_into(const void *src, void *dst) { *(__sn__LargeStruct *)dst = __sn__LargeStruct_copy((const __sn__LargeStruct *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__LargeStruct *__sn__LargeStruct_alloc(void) {
+    return calloc(1, sizeof(__sn__LargeStruct));
+}
+
+static inline void __sn__LargeStruct_release(__sn__LargeStruct **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_LargeStruct __attribute__((cleanup(__sn__LargeStruct_release)))
+
+static inline void __sn__LargeStruct_release_elem(void *p) { __sn__LargeStruct_release((__sn__LargeStruct **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__LargeStruct_to_string(const __sn__LargeStruct *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "LargeStruct { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field0: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field0);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field9: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field9);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field10: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field10);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field11: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field11);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field12: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field12);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field13: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field13);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field14: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field14);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field15: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field15);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field16: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field16);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field17: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field17);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field18: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field18);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field19: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field19);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field20: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field20);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field21: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field21);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field22: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field22);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field23: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field23);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field24: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field24);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field25: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field25);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field26: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field26);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field27: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field27);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field28: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field28);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field29: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field29);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field30: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field30);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field31: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field31);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field32: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field32);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field33: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field33);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field34: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field34);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field35: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field35);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field36: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field36);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field37: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field37);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field38: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field38);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field39: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field39);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field40: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field40);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field41: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field41);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field42: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field42);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field43: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field43);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field44: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field44);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field45: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field45);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field46: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field46);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field47: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field47);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field48: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field48);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field49: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field49);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field50: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field50);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field51: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field51);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field52: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field52);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field53: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field53);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field54: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field54);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field55: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field55);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field56: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field56);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field57: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field57);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field58: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field58);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field59: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field59);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field60: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field60);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field61: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field61);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field62: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field62);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field63: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field63);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field64: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field64);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field65: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field65);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field66: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field66);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field67: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field67);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field68: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field68);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field69: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field69);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field70: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field70);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field71: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field71);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field72: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field72);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field73: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field73);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field74: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field74);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field75: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field75);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field76: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field76);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field77: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field77);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field78: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field78);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field79: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field79);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field80: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field80);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field81: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field81);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field82: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field82);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field83: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field83);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field84: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field84);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field85: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field85);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field86: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field86);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field87: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field87);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field88: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field88);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field89: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field89);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field90: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field90);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field91: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field91);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field92: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field92);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field93: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field93);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field94: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field94);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field95: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field95);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field96: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field96);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field97: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field97);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field98: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field98);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field99: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field99);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field100: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field100);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field101: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field101);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field102: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field102);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field103: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field103);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field104: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field104);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field105: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field105);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field106: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field106);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field107: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field107);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field108: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field108);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field109: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field109);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field110: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field110);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field111: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field111);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field112: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field112);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field113: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field113);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field114: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field114);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field115: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field115);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field116: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field116);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field117: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field117);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field118: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field118);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field119: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field119);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field120: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field120);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field121: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field121);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field122: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field122);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field123: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field123);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field124: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field124);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field125: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field125);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field126: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field126);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field127: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field127);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field128: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field128);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field129: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field129);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field130: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field130);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field131: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field131);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field132: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field132);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field133: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field133);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field134: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field134);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field135: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field135);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field136: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field136);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field137: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field137);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field138: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field138);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field139: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field139);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field140: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field140);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field141: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field141);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field142: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field142);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field143: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field143);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field144: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field144);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field145: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field145);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field146: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field146);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field147: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field147);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field148: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field148);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field149: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field149);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field150: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field150);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field151: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field151);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field152: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field152);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field153: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field153);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field154: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field154);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field155: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field155);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field156: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field156);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field157: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field157);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field158: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field158);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field159: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field159);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field160: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field160);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field161: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field161);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field162: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field162);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field163: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field163);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field164: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field164);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field165: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field165);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field166: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field166);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field167: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field167);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field168: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field168);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field169: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field169);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field170: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field170);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field171: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field171);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field172: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field172);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field173: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field173);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field174: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field174);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field175: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field175);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field176: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field176);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field177: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field177);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field178: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field178);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field179: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field179);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field180: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field180);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field181: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field181);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field182: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field182);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field183: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field183);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field184: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field184);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field185: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field185);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field186: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field186);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field187: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field187);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field188: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field188);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field189: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field189);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field190: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field190);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field191: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field191);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field192: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field192);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field193: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field193);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field194: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field194);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field195: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field195);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field196: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field196);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field197: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field197);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field198: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field198);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field199: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field199);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field200: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field200);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field201: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field201);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field202: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field202);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field203: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field203);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field204: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field204);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field205: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field205);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field206: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field206);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field207: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field207);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field208: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field208);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field209: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field209);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field210: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field210);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field211: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field211);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field212: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field212);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field213: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field213);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field214: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field214);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field215: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field215);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field216: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field216);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field217: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field217);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field218: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field218);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field219: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field219);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field220: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field220);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field221: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field221);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field222: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field222);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field223: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field223);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field224: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field224);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field225: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field225);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field226: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field226);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field227: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field227);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field228: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field228);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field229: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field229);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field230: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field230);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field231: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field231);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field232: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field232);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field233: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field233);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field234: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field234);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field235: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field235);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field236: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field236);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field237: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field237);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field238: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field238);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field239: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field239);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field240: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field240);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field241: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field241);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field242: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field242);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field243: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field243);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field244: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field244);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field245: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field245);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field246: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field246);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field247: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field247);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field248: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field248);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field249: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field249);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field250: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field250);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field251: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field251);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field252: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field252);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field253: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field253);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field254: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field254);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field255: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field255);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field256: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field256);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field257: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field257);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field258: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field258);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field259: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field259);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field260: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field260);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field261: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field261);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field262: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field262);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field263: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field263);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field264: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field264);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field265: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field265);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field266: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field266);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field267: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field267);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field268: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field268);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field269: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field269);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field270: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field270);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field271: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field271);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field272: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field272);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field273: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field273);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field274: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field274);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field275: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field275);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field276: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field276);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field277: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field277);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field278: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field278);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field279: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field279);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field280: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field280);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field281: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field281);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field282: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field282);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field283: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field283);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field284: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field284);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field285: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field285);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field286: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field286);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field287: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field287);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field288: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field288);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field289: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field289);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field290: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field290);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field291: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field291);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field292: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field292);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field293: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field293);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field294: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field294);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field295: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field295);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field296: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field296);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field297: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field297);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field298: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field298);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field299: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field299);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field300: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field300);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field301: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field301);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field302: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field302);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field303: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field303);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field304: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field304);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field305: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field305);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field306: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field306);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field307: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field307);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field308: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field308);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field309: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field309);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field310: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field310);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field311: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field311);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field312: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field312);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field313: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field313);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field314: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field314);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field315: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field315);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field316: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field316);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field317: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field317);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field318: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field318);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field319: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field319);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field320: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field320);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field321: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field321);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field322: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field322);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field323: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field323);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field324: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field324);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field325: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field325);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field326: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field326);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field327: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field327);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field328: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field328);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field329: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field329);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field330: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field330);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field331: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field331);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field332: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field332);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field333: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field333);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field334: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field334);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field335: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field335);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field336: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field336);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field337: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field337);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field338: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field338);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field339: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field339);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field340: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field340);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field341: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field341);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field342: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field342);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field343: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field343);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field344: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field344);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field345: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field345);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field346: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field346);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field347: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field347);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field348: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field348);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field349: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field349);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field350: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field350);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field351: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field351);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field352: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field352);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field353: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field353);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field354: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field354);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field355: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field355);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field356: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field356);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field357: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field357);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field358: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field358);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field359: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field359);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field360: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field360);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field361: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field361);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field362: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field362);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field363: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field363);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field364: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field364);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field365: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field365);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field366: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field366);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field367: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field367);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field368: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field368);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field369: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field369);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field370: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field370);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field371: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field371);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field372: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field372);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field373: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field373);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field374: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field374);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field375: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field375);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field376: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field376);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field377: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field377);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field378: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field378);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field379: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field379);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field380: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field380);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field381: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field381);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field382: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field382);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field383: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field383);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field384: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field384);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field385: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field385);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field386: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field386);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field387: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field387);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field388: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field388);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field389: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field389);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field390: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field390);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field391: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field391);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field392: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field392);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field393: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field393);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field394: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field394);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field395: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field395);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field396: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field396);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field397: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field397);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field398: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field398);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field399: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field399);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field400: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field400);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field401: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field401);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field402: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field402);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field403: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field403);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field404: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field404);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field405: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field405);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field406: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field406);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field407: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field407);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field408: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field408);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field409: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field409);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field410: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field410);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field411: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field411);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field412: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field412);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field413: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field413);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field414: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field414);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field415: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field415);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field416: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field416);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field417: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field417);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field418: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field418);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field419: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field419);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field420: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field420);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field421: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field421);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field422: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field422);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field423: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field423);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field424: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field424);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field425: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field425);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field426: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field426);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field427: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field427);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field428: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field428);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field429: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field429);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field430: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field430);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field431: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field431);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field432: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field432);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field433: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field433);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field434: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field434);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field435: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field435);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field436: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field436);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field437: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field437);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field438: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field438);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field439: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field439);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field440: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field440);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field441: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field441);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field442: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field442);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field443: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field443);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field444: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field444);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field445: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field445);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field446: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field446);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field447: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field447);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field448: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field448);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field449: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field449);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field450: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field450);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field451: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field451);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field452: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field452);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field453: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field453);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field454: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field454);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field455: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field455);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field456: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field456);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field457: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field457);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field458: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field458);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field459: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field459);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field460: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field460);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field461: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field461);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field462: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field462);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field463: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field463);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field464: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field464);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field465: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field465);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field466: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field466);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field467: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field467);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field468: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field468);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field469: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field469);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field470: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field470);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field471: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field471);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field472: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field472);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field473: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field473);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field474: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field474);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field475: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field475);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field476: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field476);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field477: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field477);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field478: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field478);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field479: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field479);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field480: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field480);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field481: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field481);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field482: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field482);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field483: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field483);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field484: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field484);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field485: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field485);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field486: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field486);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field487: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field487);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field488: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field488);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field489: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field489);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field490: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field490);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field491: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field491);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field492: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field492);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field493: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field493);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field494: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field494);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field495: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field495);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field496: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field496);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field497: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field497);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field498: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field498);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field499: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field499);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field500: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field500);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field501: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field501);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field502: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field502);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field503: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field503);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field504: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field504);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field505: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field505);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field506: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field506);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field507: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field507);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field508: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field508);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field509: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field509);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field510: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field510);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field511: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field511);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field512: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field512);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field513: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field513);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field514: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field514);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field515: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field515);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field516: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field516);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field517: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field517);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field518: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field518);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field519: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field519);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field520: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field520);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field521: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field521);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field522: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field522);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field523: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field523);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field524: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field524);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field525: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field525);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field526: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field526);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field527: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field527);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field528: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field528);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field529: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field529);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field530: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field530);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field531: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field531);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field532: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field532);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field533: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field533);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field534: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field534);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field535: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field535);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field536: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field536);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field537: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field537);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field538: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field538);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field539: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field539);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field540: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field540);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field541: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field541);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field542: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field542);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field543: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field543);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field544: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field544);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field545: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field545);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field546: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field546);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field547: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field547);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field548: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field548);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field549: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field549);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field550: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field550);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field551: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field551);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field552: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field552);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field553: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field553);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field554: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field554);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field555: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field555);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field556: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field556);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field557: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field557);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field558: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field558);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field559: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field559);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field560: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field560);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field561: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field561);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field562: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field562);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field563: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field563);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field564: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field564);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field565: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field565);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field566: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field566);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field567: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field567);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field568: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field568);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field569: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field569);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field570: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field570);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field571: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field571);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field572: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field572);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field573: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field573);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field574: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field574);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field575: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field575);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field576: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field576);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field577: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field577);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field578: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field578);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field579: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field579);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field580: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field580);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field581: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field581);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field582: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field582);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field583: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field583);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field584: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field584);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field585: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field585);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field586: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field586);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field587: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field587);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field588: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field588);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field589: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field589);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field590: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field590);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field591: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field591);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field592: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field592);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field593: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field593);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field594: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field594);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field595: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field595);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field596: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field596);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field597: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field597);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field598: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field598);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field599: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field599);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field600: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field600);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field601: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field601);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field602: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field602);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field603: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field603);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field604: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field604);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field605: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field605);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field606: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field606);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field607: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field607);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field608: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field608);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field609: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field609);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field610: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field610);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field611: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field611);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field612: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field612);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field613: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field613);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field614: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field614);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field615: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field615);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field616: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field616);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field617: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field617);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field618: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field618);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field619: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field619);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field620: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field620);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field621: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field621);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field622: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field622);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field623: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field623);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field624: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field624);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field625: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field625);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field626: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field626);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field627: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field627);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field628: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field628);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field629: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field629);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field630: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field630);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field631: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field631);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field632: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field632);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field633: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field633);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field634: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field634);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field635: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field635);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field636: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field636);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field637: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field637);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field638: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field638);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field639: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field639);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field640: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field640);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field641: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field641);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field642: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field642);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field643: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field643);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field644: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field644);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field645: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field645);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field646: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field646);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field647: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field647);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field648: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field648);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field649: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field649);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field650: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field650);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field651: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field651);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field652: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field652);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field653: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field653);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field654: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field654);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field655: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field655);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field656: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field656);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field657: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field657);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field658: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field658);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field659: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field659);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field660: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field660);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field661: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field661);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field662: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field662);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field663: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field663);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field664: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field664);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field665: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field665);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field666: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field666);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field667: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field667);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field668: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field668);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field669: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field669);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field670: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field670);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field671: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field671);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field672: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field672);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field673: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field673);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field674: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field674);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field675: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field675);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field676: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field676);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field677: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field677);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field678: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field678);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field679: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field679);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field680: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field680);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field681: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field681);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field682: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field682);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field683: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field683);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field684: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field684);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field685: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field685);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field686: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field686);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field687: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field687);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field688: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field688);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field689: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field689);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field690: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field690);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field691: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field691);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field692: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field692);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field693: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field693);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field694: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field694);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field695: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field695);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field696: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field696);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field697: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field697);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field698: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field698);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field699: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field699);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field700: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field700);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field701: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field701);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field702: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field702);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field703: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field703);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field704: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field704);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field705: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field705);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field706: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field706);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field707: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field707);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field708: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field708);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field709: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field709);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field710: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field710);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field711: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field711);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field712: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field712);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field713: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field713);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field714: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field714);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field715: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field715);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field716: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field716);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field717: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field717);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field718: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field718);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field719: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field719);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field720: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field720);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field721: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field721);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field722: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field722);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field723: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field723);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field724: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field724);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field725: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field725);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field726: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field726);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field727: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field727);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field728: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field728);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field729: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field729);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field730: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field730);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field731: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field731);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field732: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field732);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field733: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field733);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field734: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field734);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field735: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field735);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field736: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field736);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field737: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field737);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field738: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field738);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field739: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field739);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field740: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field740);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field741: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field741);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field742: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field742);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field743: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field743);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field744: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field744);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field745: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field745);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field746: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field746);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field747: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field747);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field748: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field748);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field749: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field749);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field750: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field750);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field751: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field751);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field752: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field752);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field753: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field753);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field754: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field754);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field755: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field755);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field756: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field756);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field757: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field757);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field758: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field758);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field759: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field759);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field760: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field760);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field761: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field761);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field762: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field762);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field763: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field763);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field764: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field764);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field765: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field765);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field766: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field766);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field767: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field767);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field768: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field768);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field769: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field769);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field770: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field770);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field771: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field771);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field772: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field772);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field773: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field773);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field774: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field774);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field775: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field775);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field776: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field776);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field777: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field777);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field778: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field778);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field779: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field779);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field780: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field780);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field781: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field781);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field782: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field782);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field783: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field783);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field784: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field784);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field785: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field785);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field786: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field786);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field787: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field787);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field788: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field788);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field789: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field789);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field790: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field790);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field791: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field791);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field792: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field792);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field793: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field793);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field794: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field794);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field795: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field795);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field796: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field796);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field797: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field797);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field798: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field798);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field799: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field799);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field800: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field800);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field801: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field801);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field802: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field802);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field803: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field803);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field804: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field804);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field805: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field805);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field806: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field806);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field807: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field807);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field808: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field808);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field809: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field809);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field810: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field810);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field811: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field811);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field812: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field812);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field813: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field813);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field814: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field814);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field815: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field815);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field816: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field816);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field817: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field817);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field818: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field818);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field819: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field819);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field820: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field820);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field821: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field821);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field822: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field822);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field823: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field823);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field824: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field824);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field825: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field825);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field826: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field826);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field827: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field827);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field828: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field828);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field829: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field829);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field830: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field830);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field831: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field831);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field832: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field832);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field833: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field833);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field834: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field834);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field835: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field835);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field836: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field836);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field837: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field837);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field838: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field838);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field839: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field839);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field840: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field840);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field841: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field841);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field842: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field842);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field843: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field843);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field844: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field844);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field845: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field845);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field846: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field846);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field847: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field847);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field848: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field848);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field849: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field849);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field850: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field850);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field851: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field851);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field852: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field852);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field853: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field853);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field854: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field854);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field855: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field855);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field856: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field856);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field857: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field857);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field858: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field858);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field859: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field859);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field860: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field860);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field861: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field861);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field862: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field862);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field863: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field863);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field864: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field864);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field865: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field865);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field866: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field866);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field867: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field867);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field868: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field868);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field869: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field869);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field870: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field870);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field871: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field871);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field872: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field872);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field873: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field873);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field874: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field874);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field875: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field875);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field876: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field876);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field877: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field877);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field878: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field878);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field879: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field879);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field880: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field880);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field881: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field881);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field882: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field882);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field883: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field883);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field884: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field884);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field885: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field885);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field886: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field886);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field887: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field887);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field888: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field888);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field889: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field889);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field890: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field890);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field891: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field891);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field892: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field892);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field893: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field893);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field894: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field894);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field895: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field895);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field896: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field896);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field897: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field897);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field898: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field898);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field899: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field899);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field900: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field900);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field901: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field901);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field902: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field902);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field903: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field903);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field904: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field904);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field905: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field905);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field906: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field906);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field907: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field907);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field908: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field908);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field909: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field909);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field910: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field910);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field911: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field911);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field912: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field912);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field913: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field913);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field914: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field914);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field915: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field915);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field916: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field916);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field917: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field917);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field918: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field918);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field919: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field919);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field920: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field920);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field921: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field921);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field922: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field922);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field923: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field923);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field924: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field924);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field925: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field925);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field926: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field926);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field927: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field927);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field928: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field928);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field929: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field929);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field930: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field930);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field931: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field931);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field932: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field932);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field933: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field933);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field934: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field934);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field935: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field935);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field936: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field936);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field937: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field937);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field938: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field938);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field939: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field939);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field940: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field940);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field941: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field941);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field942: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field942);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field943: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field943);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field944: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field944);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field945: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field945);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field946: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field946);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field947: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field947);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field948: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field948);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field949: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field949);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field950: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field950);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field951: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field951);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field952: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field952);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field953: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field953);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field954: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field954);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field955: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field955);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field956: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field956);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field957: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field957);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field958: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field958);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field959: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field959);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field960: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field960);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field961: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field961);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field962: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field962);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field963: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field963);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field964: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field964);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field965: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field965);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field966: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field966);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field967: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field967);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field968: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field968);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field969: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field969);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field970: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field970);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field971: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field971);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field972: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field972);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field973: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field973);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field974: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field974);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field975: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field975);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field976: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field976);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field977: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field977);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field978: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field978);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field979: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field979);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field980: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field980);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field981: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field981);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field982: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field982);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field983: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field983);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field984: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field984);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field985: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field985);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field986: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field986);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field987: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field987);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field988: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field988);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field989: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field989);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field990: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field990);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field991: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field991);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field992: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field992);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field993: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field993);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field994: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field994);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field995: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field995);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field996: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field996);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field997: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field997);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field998: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field998);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field999: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field999);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1000: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1000);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1001: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1001);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1002: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1002);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1003: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1003);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1004: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1004);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1005: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1005);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1006: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1006);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1007: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1007);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1008: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1008);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1009: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1009);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1010: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1010);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1011: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1011);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1012: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1012);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1013: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1013);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1014: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1014);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1015: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1015);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1016: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1016);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1017: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1017);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1018: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1018);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1019: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1019);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1020: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1020);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1021: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1021);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1022: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1022);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1023: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1023);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__test_large_struct_size();
+void __sn__test_large_struct_allocation();
+void __sn__test_large_struct_field_access();
+void __sn__test_large_struct_modification();
+
+
+
+
+#endif
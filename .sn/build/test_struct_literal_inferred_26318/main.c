@@ -0,0 +1,93 @@
+#include "sn_types.h"
+
+
+
+
+
+
+
+
+
+int main() {
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 1.5, .__sn__y = 2.5 };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p=(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Config __sn__Config __sn__cfg = (__sn__Config){ .__sn__name = strdup("test"), .__sn__value = 42LL, .__sn__enabled = true };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("cfg=");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__cfg.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup(" val=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__cfg.__sn__value));
+            sn_auto_str char *__is_p4__ = sn_strdup(" on=");
+            sn_auto_str char *__is_p5__ = sn_strdup((__sn__cfg.__sn__enabled) ? "true" : "false");
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Nested __sn__Nested __sn__n = (__sn__Nested){ .__sn__label = strdup("origin"), .__sn__point = (__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 } };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("n=");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__n.__sn__label);
+            sn_auto_str char *__is_p2__ = sn_strdup(" (");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__n.__sn__point.__sn__x));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%.5f", (double)(__sn__n.__sn__point.__sn__y));
+            sn_auto_str char *__is_p6__ = sn_strdup(")");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_println(__ps__); };
+    
+    __sn__Box_int __sn__bi = (__sn__Box_int){ .__sn__value = 7LL, .__sn__tag = 1LL };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("bi=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__bi.__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(" tag=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__bi.__sn__tag));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Pair_int_str __sn__Pair_int_str __sn__pr = (__sn__Pair_int_str){ .__sn__first = 42LL, .__sn__second = strdup("answer") };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("pr=(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__pr.__sn__first));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_strdup(__sn__pr.__sn__second);
+            sn_auto_str char *__is_p4__ = sn_strdup(")");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Pair_Box_int_str __sn__Pair_Box_int_str __sn__nested = (__sn__Pair_Box_int_str){ .__sn__first = (__sn__Box_int){ .__sn__value = 9LL, .__sn__tag = 2LL }, .__sn__second = strdup("nine") };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("nested=(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__nested.__sn__first.__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_strdup(__sn__nested.__sn__second);
+            sn_auto_str char *__is_p4__ = sn_strdup(")");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__nums = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("nums=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__nums)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_println("SUCCESS");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,355 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Config (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__value;
+    bool __sn__enabled;
+} __sn__Config;
+/* Value operations */
+static inline __sn__Config __sn__Config_copy(const __sn__Config *src) {
+    __sn__Config dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__enabled = src->__sn__enabled;
+    return dst;
+}
+
+static inline void __sn__Config_cleanup(__sn__Config *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Config __attribute__((cleanup(__sn__Config_cleanup)))
+
+static inline void __sn__Config_cleanup_elem(void *p) { __sn__Config_cleanup((__sn__Config *)p); }
+static inline void __sn__Config_copy_into(const void *src, void *dst) { *(__sn__Config *)dst = __sn__Config_copy((const __sn__Config *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Config *__sn__Config_alloc(void) {
+    return calloc(1, sizeof(__sn__Config));
+}
+
+static inline void __sn__Config_release(__sn__Config **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Config __attribute__((cleanup(__sn__Config_release)))
+
+static inline void __sn__Config_release_elem(void *p) { __sn__Config_release((__sn__Config **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Config_to_string(const __sn__Config *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Config { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "enabled: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__enabled ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Nested (as val) */
+typedef struct {
+    char * __sn__label;
+    __sn__Point __sn__point;
+} __sn__Nested;
+/* Value operations */
+static inline __sn__Nested __sn__Nested_copy(const __sn__Nested *src) {
+    __sn__Nested dst;
+    dst.__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    dst.__sn__point = __sn__Point_copy(&src->__sn__point);
+    return dst;
+}
+
+static inline void __sn__Nested_cleanup(__sn__Nested *p) {
+    free(p->__sn__label);
+
+}
+
+#define sn_auto_Nested __attribute__((cleanup(__sn__Nested_cleanup)))
+
+static inline void __sn__Nested_cleanup_elem(void *p) { __sn__Nested_cleanup((__sn__Nested *)p); }
+static inline void __sn__Nested_copy_into(const void *src, void *dst) { *(__sn__Nested *)dst = __sn__Nested_copy((const __sn__Nested *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Nested *__sn__Nested_alloc(void) {
+    return calloc(1, sizeof(__sn__Nested));
+}
+
+static inline void __sn__Nested_release(__sn__Nested **p) {
+    if (*p) {
+        free((*p)->__sn__label);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Nested __attribute__((cleanup(__sn__Nested_release)))
+
+static inline void __sn__Nested_release_elem(void *p) { __sn__Nested_release((__sn__Nested **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Nested_to_string(const __sn__Nested *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Nested { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "point: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__point); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Box_int (as val) */
+typedef struct {
+    long long __sn__value;
+    long long __sn__tag;
+} __sn__Box_int;
+/* Value operations */
+static inline __sn__Box_int __sn__Box_int_copy(const __sn__Box_int *src) {
+    __sn__Box_int dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__tag = src->__sn__tag;
+    return dst;
+}
+
+static inline void __sn__Box_int_cleanup(__sn__Box_int *p) {
+
+}
+
+#define sn_auto_Box_int __attribute__((cleanup(__sn__Box_int_cleanup)))
+
+static inline void __sn__Box_int_cleanup_elem(void *p) { __sn__Box_int_cleanup((__sn__Box_int *)p); }
+static inline void __sn__Box_int_copy_into(const void *src, void *dst) { *(__sn__Box_int *)dst = __sn__Box_int_copy((const __sn__Box_int *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Box_int *__sn__Box_int_alloc(void) {
+    return calloc(1, sizeof(__sn__Box_int));
+}
+
+static inline void __sn__Box_int_release(__sn__Box_int **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Box_int __attribute__((cleanup(__sn__Box_int_release)))
+
+static inline void __sn__Box_int_release_elem(void *p) { __sn__Box_int_release((__sn__Box_int **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Box_int_to_string(const __sn__Box_int *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Box_int { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tag: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__tag);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Pair_int_str (as val) */
+typedef struct {
+    long long __sn__first;
+    char * __sn__second;
+} __sn__Pair_int_str;
+/* Value operations */
+static inline __sn__Pair_int_str __sn__Pair_int_str_copy(const __sn__Pair_int_str *src) {
+    __sn__Pair_int_str dst;
+    dst.__sn__first = src->__sn__first;
+    dst.__sn__second = src->__sn__second ? strdup(src->__sn__second) : NULL;
+    return dst;
+}
+
+static inline void __sn__Pair_int_str_cleanup(__sn__Pair_int_str *p) {
+    free(p->__sn__second);
+
+}
+
+#define sn_auto_Pair_int_str __attribute__((cleanup(__sn__Pair_int_str_cleanup)))
+
+static inline void __sn__Pair_int_str_cleanup_elem(void *p) { __sn__Pair_int_str_cleanup((__sn__Pair_int_str *)p); }
+static inline void __sn__Pair_int_str_copy_into(const void *src, void *dst) { *(__sn__Pair_int_str *)dst = __sn__Pair_int_str_copy((const __sn__Pair_int_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Pair_int_str *__sn__Pair_int_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Pair_int_str));
+}
+
+static inline void __sn__Pair_int_str_release(__sn__Pair_int_str **p) {
+    if (*p) {
+        free((*p)->__sn__second);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Pair_int_str __attribute__((cleanup(__sn__Pair_int_str_release)))
+
+static inline void __sn__Pair_int_str_release_elem(void *p) { __sn__Pair_int_str_release((__sn__Pair_int_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Pair_int_str_to_string(const __sn__Pair_int_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Pair_int_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "first: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__first);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "second: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__second ? p->__sn__second : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Pair_Box_int_str (as val) */
+typedef struct {
+    __sn__Box_int __sn__first;
+    char * __sn__second;
+} __sn__Pair_Box_int_str;
+/* Value operations */
+static inline __sn__Pair_Box_int_str __sn__Pair_Box_int_str_copy(const __sn__Pair_Box_int_str *src) {
+    __sn__Pair_Box_int_str dst;
+    dst.__sn__first = __sn__Box_int_copy(&src->__sn__first);
+    dst.__sn__second = src->__sn__second ? strdup(src->__sn__second) : NULL;
+    return dst;
+}
+
+static inline void __sn__Pair_Box_int_str_cleanup(__sn__Pair_Box_int_str *p) {
+    free(p->__sn__second);
+
+}
+
+#define sn_auto_Pair_Box_int_str __attribute__((cleanup(__sn__Pair_Box_int_str_cleanup)))
+
+static inline void __sn__Pair_Box_int_str_cleanup_elem(void *p) { __sn__Pair_Box_int_str_cleanup((__sn__Pair_Box_int_str *)p); }
+static inline void __sn__Pair_Box_int_str_copy_into(const void *src, void *dst) { *(__sn__Pair_Box_int_str *)dst = __sn__Pair_Box_int_str_copy((const __sn__Pair_Box_int_str *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Pair_Box_int_str *__sn__Pair_Box_int_str_alloc(void) {
+    return calloc(1, sizeof(__sn__Pair_Box_int_str));
+}
+
+static inline void __sn__Pair_Box_int_str_release(__sn__Pair_Box_int_str **p) {
+    if (*p) {
+        free((*p)->__sn__second);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Pair_Box_int_str __attribute__((cleanup(__sn__Pair_Box_int_str_release)))
+
+static inline void __sn__Pair_Box_int_str_release_elem(void *p) { __sn__Pair_Box_int_str_release((__sn__Pair_Box_int_str **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Pair_Box_int_str_to_string(const __sn__Pair_Box_int_str *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Pair_Box_int_str { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "first: ");
+    { char *__fs__ = __sn__Box_int_to_string(&p->__sn__first); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "second: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__second ? p->__sn__second : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+
+
+
+#endif
@@ -0,0 +1,39 @@
+#include "sn_types.h"
+
+
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Item), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Item_cleanup_elem;
+            __al__->elem_copy = __sn__Item_copy_into;
+            __al__;
+        });
+    __sn__arr_push(&__sn__items, (__sn__Item){ .__sn__key = strdup("a"), .__sn__value = 1.0 });
+    
+    __sn__arr_push(&__sn__items, (__sn__Item){ .__sn__key = strdup("b"), .__sn__value = 2.0 });
+    
+    sn_auto_Record __sn__Record __sn__rec = (__sn__Record){ .__sn__name = strdup("test"), .__sn__items = sn_array_copy(__sn__items) };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("name=");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__rec.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup(" items=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__rec.__sn__items)));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("item0=");
+            sn_auto_str char *__is_p1__ = sn_strdup((((__sn__Item *)__sn__rec.__sn__items->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__rec.__sn__items->len : __ai__; })]).__sn__key);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_println("SUCCESS");
+    
+    fflush(stdout);
+    return 0;
+}
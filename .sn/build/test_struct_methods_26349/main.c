@@ -0,0 +1,96 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__Counter_getValue(__sn__Counter *__sn__self) {
+
+    return __sn__self->__sn__value;}
+
+void __sn__Counter_increment(__sn__Counter *__sn__self) {
+
+    (__sn__self->__sn__value = sn_add_long(__sn__self->__sn__value, 1LL));
+    
+}
+
+long long __sn__Counter_addValue(__sn__Counter *__sn__self, long long __sn__amount) {
+
+    (__sn__self->__sn__value = sn_add_long(__sn__self->__sn__value, __sn__amount));
+    
+
+    return __sn__self->__sn__value;}
+
+
+double __sn__Point_getX(__sn__Point *__sn__self) {
+
+    return __sn__self->__sn__x;}
+
+double __sn__Point_getY(__sn__Point *__sn__self) {
+
+    return __sn__self->__sn__y;}
+
+int main() {
+    __sn__Counter __sn__c = (__sn__Counter){ .__sn__value = 42LL };
+    long long __sn__v = __sn__Counter_getValue(&__sn__c);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Initial counter value: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__v));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__v != 42LL)) {
+        sn_print("FAIL:\n getValue returned wrong value");
+        
+        return 1LL;}
+    __sn__Counter_increment(&__sn__c);
+    
+    (__sn__v = __sn__Counter_getValue(&__sn__c));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After increment: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__v));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__v != 43LL)) {
+        sn_print("FAIL:\n increment didn't work");
+        
+        return 1LL;}
+    long long __sn__result = __sn__Counter_addValue(&__sn__c, 10LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After addValue(10): ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__result != 53LL)) {
+        sn_print("FAIL:\n addValue returned wrong value");
+        
+        return 1LL;}
+    __sn__Point __sn__p1 = (__sn__Point){ .__sn__x = 3.0, .__sn__y = 4.0 };
+    double __sn__px = __sn__Point_getX(&__sn__p1);
+    double __sn__py = __sn__Point_getY(&__sn__p1);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Point: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__px));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__py));
+            sn_auto_str char *__is_p4__ = sn_strdup(")\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__px != 3.0)) {
+        sn_print("FAIL:\n getX returned wrong value");
+        
+        return 1LL;}
+    if ((__sn__py != 4.0)) {
+        sn_print("FAIL:\n getY returned wrong value");
+        
+        return 1LL;}
+    sn_print("All struct method tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,306 @@
+#include "sn_types.h"
+
+
+
+void c_init_buffer(__sn__CBuffer *__sn__buf, long long __sn__cap) {
+
+    ((*__sn__buf).__sn__data = NULL);
+    
+
+    ((*__sn__buf).__sn__size = 0LL);
+    
+
+    ((*__sn__buf).__sn__capacity = __sn__cap);
+    
+}
+
+bool c_set_buffer_size(__sn__CBuffer *__sn__buf, long long __sn__new_size) {
+
+    if (sn_gt_long(__sn__new_size, (*__sn__buf).__sn__capacity)) {
+        return false;}
+
+    ((*__sn__buf).__sn__size = __sn__new_size);
+    
+
+    return true;}
+
+long long c_get_buffer_capacity(__sn__CBuffer *__sn__buf) {
+
+    return (*__sn__buf).__sn__capacity;}
+
+void c_compute_box_area(__sn__BoundingBox *__sn__box) {
+
+    double __sn__width = sn_sub_double((*__sn__box).__sn__max_x, (*__sn__box).__sn__min_x);
+
+    double __sn__height = sn_sub_double((*__sn__box).__sn__max_y, (*__sn__box).__sn__min_y);
+
+    ((*__sn__box).__sn__area = sn_mul_double(__sn__width, __sn__height));
+    
+}
+
+double c_point_magnitude_squared(__sn__Point3D __sn__p) {
+
+    return sn_add_double(sn_add_double(sn_mul_double(__sn__p.__sn__x, __sn__p.__sn__x), sn_mul_double(__sn__p.__sn__y, __sn__p.__sn__y)), sn_mul_double(__sn__p.__sn__z, __sn__p.__sn__z));}
+
+bool test_struct_as_ref() {
+
+    sn_print("Test 1: Native struct passed via 'as ref'\n");
+    
+
+    __sn__CBuffer __sn__buf = (__sn__CBuffer){ .__sn__data = NULL, .__sn__size = 0LL, .__sn__capacity = 0LL };
+
+    c_init_buffer(&__sn__buf, 1024LL);
+    
+
+    if ((__sn__buf.__sn__capacity != 1024LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Expected capacity=1024, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__buf.__sn__capacity));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    if ((__sn__buf.__sn__size != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Expected size=0, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__buf.__sn__size));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("  PASS: Struct modified by C function via as ref\n");
+    
+
+    return true;}
+
+bool test_multiple_modifications() {
+
+    sn_print("Test 2: Multiple C function calls modifying struct\n");
+    
+
+    __sn__CBuffer __sn__buf = (__sn__CBuffer){ .__sn__data = NULL, .__sn__size = 0LL, .__sn__capacity = 0LL };
+
+    c_init_buffer(&__sn__buf, 512LL);
+    
+
+    bool __sn__ok = c_set_buffer_size(&__sn__buf, 100LL);
+
+    if ((!__sn__ok)) {
+        sn_print("  FAIL: c_set_buffer_size returned false\n");
+        
+        return false;}
+
+    if ((__sn__buf.__sn__size != 100LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Expected size=100, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__buf.__sn__size));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    (__sn__ok = c_set_buffer_size(&__sn__buf, 256LL));
+    
+
+    if ((!__sn__ok)) {
+        sn_print("  FAIL: Second c_set_buffer_size returned false\n");
+        
+        return false;}
+
+    if ((__sn__buf.__sn__size != 256LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Expected size=256, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__buf.__sn__size));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    (__sn__ok = c_set_buffer_size(&__sn__buf, 1000LL));
+    
+
+    if (__sn__ok) {
+        sn_print("  FAIL: Should have rejected size > capacity\n");
+        
+        return false;}
+
+    if ((__sn__buf.__sn__size != 256LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Size changed after failed set, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__buf.__sn__size));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("  PASS: Multiple modifications work correctly\n");
+    
+
+    return true;}
+
+bool test_read_via_c_function() {
+
+    sn_print("Test 3: Reading struct field via C function\n");
+    
+
+    __sn__CBuffer __sn__buf = (__sn__CBuffer){ .__sn__data = NULL, .__sn__size = 50LL, .__sn__capacity = 2048LL };
+
+    long long __sn__cap = c_get_buffer_capacity(&__sn__buf);
+
+    if ((__sn__cap != 2048LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Expected capacity=2048, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__cap));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("  PASS: C function can read struct fields\n");
+    
+
+    return true;}
+
+bool test_computed_field() {
+
+    sn_print("Test 4: C function computing struct field\n");
+    
+
+    __sn__BoundingBox __sn__box = (__sn__BoundingBox){ .__sn__min_x = 0.0, .__sn__min_y = 0.0, .__sn__max_x = 10.0, .__sn__max_y = 5.0, .__sn__area = 0.0 };
+
+    c_compute_box_area(&__sn__box);
+    
+
+    if (sn_lt_double(__sn__box.__sn__area, 49.899999999999999)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Expected area=50.0, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__box.__sn__area));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    if (sn_gt_double(__sn__box.__sn__area, 50.100000000000001)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Expected area=50.0, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__box.__sn__area));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("  PASS: Computed field set correctly\n");
+    
+
+    return true;}
+
+bool test_struct_by_value() {
+
+    sn_print("Test 5: Struct passed by value to C function\n");
+    
+
+    __sn__Point3D __sn__p = (__sn__Point3D){ .__sn__x = 3.0, .__sn__y = 4.0, .__sn__z = 0.0 };
+
+    double __sn__mag_sq = c_point_magnitude_squared(__sn__p);
+
+    if (sn_lt_double(__sn__mag_sq, 24.899999999999999)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Expected magnitude_squared=25.0, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__mag_sq));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    if (sn_gt_double(__sn__mag_sq, 25.100000000000001)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: Expected magnitude_squared=25.0, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__mag_sq));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("  PASS: Struct passed by value works\n");
+    
+
+    return true;}
+
+bool test_value_semantics_preserved() {
+
+    sn_print("Test 6: Original struct unchanged after pass-by-value\n");
+    
+
+    __sn__Point3D __sn__p = (__sn__Point3D){ .__sn__x = 1.0, .__sn__y = 2.0, .__sn__z = 3.0 };
+
+    double __sn___ = c_point_magnitude_squared(__sn__p);
+
+    if ((__sn__p.__sn__x != 1.0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: p.x changed from 1.0 to ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__p.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    if ((__sn__p.__sn__y != 2.0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: p.y changed from 2.0 to ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__p.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    if ((__sn__p.__sn__z != 3.0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  FAIL: p.z changed from 3.0 to ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__p.__sn__z));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return false;}
+
+    sn_print("  PASS: Original struct preserved after pass-by-value\n");
+    
+
+    return true;}
+
+
+
+
+int main() {
+    sn_print("=== Native Struct C Interop Test ===\n\n");
+    
+    if ((!test_struct_as_ref())) {
+        return 1LL;}
+    if ((!test_multiple_modifications())) {
+        return 1LL;}
+    if ((!test_read_via_c_function())) {
+        return 1LL;}
+    if ((!test_computed_field())) {
+        return 1LL;}
+    if ((!test_struct_by_value())) {
+        return 1LL;}
+    if ((!test_value_semantics_preserved())) {
+        return 1LL;}
+    sn_print("\n=== All Native Struct C Interop Tests PASSED! ===\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,60 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+#include <string.h>
+#include <stdlib.h>
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: CBuffer (native) */
+typedef struct {
+    unsigned char * __sn__data;
+    long long __sn__size;
+    long long __sn__capacity;
+} __sn__CBuffer;
+
+/* Struct: Point3D (native) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+    double __sn__z;
+} __sn__Point3D;
+
+/* Struct: BoundingBox (native) */
+typedef struct {
+    double __sn__min_x;
+    double __sn__min_y;
+    double __sn__max_x;
+    double __sn__max_y;
+    double __sn__area;
+} __sn__BoundingBox;
+
+
+void c_init_buffer(__sn__CBuffer *, long long);
+bool c_set_buffer_size(__sn__CBuffer *, long long);
+long long c_get_buffer_capacity(__sn__CBuffer *);
+void c_compute_box_area(__sn__BoundingBox *);
+double c_point_magnitude_squared(__sn__Point3D);
+bool test_struct_as_ref();
+bool test_multiple_modifications();
+bool test_read_via_c_function();
+bool test_computed_field();
+bool test_struct_by_value();
+bool test_value_semantics_preserved();
+
+
+
+
+#endif
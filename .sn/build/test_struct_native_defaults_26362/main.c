@@ -0,0 +1,54 @@
+#include "sn_types.h"
+
+
+
+void test_native_structs() {
+
+    __sn__NativeConfig __sn__cfg1 = (__sn__NativeConfig){ .__sn__data = NULL, .__sn__size = 0LL, .__sn__capacity = 1024LL, .__sn__flags = 0LL };
+
+    sn_print("Test 1 - Native zero init passed\n");
+    
+
+    __sn__NativeConfig __sn__cfg2 = (__sn__NativeConfig){ .__sn__data = NULL, .__sn__size = 100LL, .__sn__capacity = 1024LL, .__sn__flags = 0LL };
+
+    sn_print("Test 2 - Native partial init passed\n");
+    
+
+    __sn__NativeConfig __sn__cfg3 = (__sn__NativeConfig){ .__sn__data = NULL, .__sn__size = 512LL, .__sn__capacity = 2048LL, .__sn__flags = 7LL };
+
+    sn_print("Test 3 - Native full override passed\n");
+    
+
+    __sn__Buffer __sn__buf1 = (__sn__Buffer){ .__sn__ptr = NULL, .__sn__len = 0LL };
+
+    sn_print("Test 4 - Buffer (all required) passed\n");
+    
+
+    __sn__StreamConfig __sn__stream1 = (__sn__StreamConfig){ .__sn__input = NULL, .__sn__output = NULL, .__sn__buffer_size = 4096LL, .__sn__timeout_ms = 30000LL, .__sn__verbose = false };
+
+    sn_print("Test 5 - StreamConfig defaults passed\n");
+    
+
+    __sn__StreamConfig __sn__stream2 = (__sn__StreamConfig){ .__sn__input = NULL, .__sn__output = NULL, .__sn__buffer_size = 8192LL, .__sn__timeout_ms = 30000LL, .__sn__verbose = false };
+
+    sn_print("Test 6 - StreamConfig partial override passed\n");
+    
+
+    __sn__StreamConfig __sn__stream3 = (__sn__StreamConfig){ .__sn__input = NULL, .__sn__output = NULL, .__sn__buffer_size = 16384LL, .__sn__timeout_ms = 60000LL, .__sn__verbose = true };
+
+    sn_print("Test 7 - StreamConfig full override passed\n");
+    
+
+    sn_print("All native struct default tests passed!\n");
+    
+}
+
+
+
+
+int main() {
+    test_native_structs();
+    
+    fflush(stdout);
+    return 0;
+}
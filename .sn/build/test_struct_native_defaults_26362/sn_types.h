@@ -0,0 +1,48 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: NativeConfig (native) */
+typedef struct {
+    unsigned char * __sn__data;
+    long long __sn__size;
+    long long __sn__capacity;
+    long long __sn__flags;
+} __sn__NativeConfig;
+
+/* Struct: Buffer (native) */
+typedef struct {
+    unsigned char * __sn__ptr;
+    long long __sn__len;
+} __sn__Buffer;
+
+/* Struct: StreamConfig (native) */
+typedef struct {
+    unsigned char * __sn__input;
+    unsigned char * __sn__output;
+    long long __sn__buffer_size;
+    long long __sn__timeout_ms;
+    bool __sn__verbose;
+} __sn__StreamConfig;
+
+
+void test_native_structs();
+
+
+
+
+#endif
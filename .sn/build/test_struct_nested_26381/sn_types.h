@@ -0,0 +1,358 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Size (as val) */
+typedef struct {
+    long long __sn__width;
+    long long __sn__height;
+} __sn__Size;
+/* Value operations */
+static inline __sn__Size __sn__Size_copy(const __sn__Size *src) {
+    __sn__Size dst;
+    dst.__sn__width = src->__sn__width;
+    dst.__sn__height = src->__sn__height;
+    return dst;
+}
+
+static inline void __sn__Size_cleanup(__sn__Size *p) {
+
+}
+
+#define sn_auto_Size __attribute__((cleanup(__sn__Size_cleanup)))
+
+static inline void __sn__Size_cleanup_elem(void *p) { __sn__Size_cleanup((__sn__Size *)p); }
+static inline void __sn__Size_copy_into(const void *src, void *dst) { *(__sn__Size *)dst = __sn__Size_copy((const __sn__Size *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Size *__sn__Size_alloc(void) {
+    return calloc(1, sizeof(__sn__Size));
+}
+
+static inline void __sn__Size_release(__sn__Size **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Size __attribute__((cleanup(__sn__Size_release)))
+
+static inline void __sn__Size_release_elem(void *p) { __sn__Size_release((__sn__Size **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Size_to_string(const __sn__Size *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Size { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "width: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__width);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "height: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__height);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Line (as val) */
+typedef struct {
+    __sn__Point __sn__start;
+    __sn__Point __sn__end;
+} __sn__Line;
+/* Value operations */
+static inline __sn__Line __sn__Line_copy(const __sn__Line *src) {
+    __sn__Line dst;
+    dst.__sn__start = __sn__Point_copy(&src->__sn__start);
+    dst.__sn__end = __sn__Point_copy(&src->__sn__end);
+    return dst;
+}
+
+static inline void __sn__Line_cleanup(__sn__Line *p) {
+
+}
+
+#define sn_auto_Line __attribute__((cleanup(__sn__Line_cleanup)))
+
+static inline void __sn__Line_cleanup_elem(void *p) { __sn__Line_cleanup((__sn__Line *)p); }
+static inline void __sn__Line_copy_into(const void *src, void *dst) { *(__sn__Line *)dst = __sn__Line_copy((const __sn__Line *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Line *__sn__Line_alloc(void) {
+    return calloc(1, sizeof(__sn__Line));
+}
+
+static inline void __sn__Line_release(__sn__Line **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Line __attribute__((cleanup(__sn__Line_release)))
+
+static inline void __sn__Line_release_elem(void *p) { __sn__Line_release((__sn__Line **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Line_to_string(const __sn__Line *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Line { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "start: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__start); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "end: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__end); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Rectangle (as val) */
+typedef struct {
+    __sn__Point __sn__origin;
+    __sn__Size __sn__size;
+    char * __sn__color;
+} __sn__Rectangle;
+/* Value operations */
+static inline __sn__Rectangle __sn__Rectangle_copy(const __sn__Rectangle *src) {
+    __sn__Rectangle dst;
+    dst.__sn__origin = __sn__Point_copy(&src->__sn__origin);
+    dst.__sn__size = __sn__Size_copy(&src->__sn__size);
+    dst.__sn__color = src->__sn__color ? strdup(src->__sn__color) : NULL;
+    return dst;
+}
+
+static inline void __sn__Rectangle_cleanup(__sn__Rectangle *p) {
+    free(p->__sn__color);
+
+}
+
+#define sn_auto_Rectangle __attribute__((cleanup(__sn__Rectangle_cleanup)))
+
+static inline void __sn__Rectangle_cleanup_elem(void *p) { __sn__Rectangle_cleanup((__sn__Rectangle *)p); }
+static inline void __sn__Rectangle_copy_into(const void *src, void *dst) { *(__sn__Rectangle *)dst = __sn__Rectangle_copy((const __sn__Rectangle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Rectangle *__sn__Rectangle_alloc(void) {
+    return calloc(1, sizeof(__sn__Rectangle));
+}
+
+static inline void __sn__Rectangle_release(__sn__Rectangle **p) {
+    if (*p) {
+        free((*p)->__sn__color);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Rectangle __attribute__((cleanup(__sn__Rectangle_release)))
+
+static inline void __sn__Rectangle_release_elem(void *p) { __sn__Rectangle_release((__sn__Rectangle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Rectangle_to_string(const __sn__Rectangle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Rectangle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "origin: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__origin); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "size: ");
+    { char *__fs__ = __sn__Size_to_string(&p->__sn__size); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "color: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__color ? p->__sn__color : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Bounds (as val) */
+typedef struct {
+    __sn__Point __sn__top_left;
+    __sn__Point __sn__bottom_right;
+} __sn__Bounds;
+/* Value operations */
+static inline __sn__Bounds __sn__Bounds_copy(const __sn__Bounds *src) {
+    __sn__Bounds dst;
+    dst.__sn__top_left = __sn__Point_copy(&src->__sn__top_left);
+    dst.__sn__bottom_right = __sn__Point_copy(&src->__sn__bottom_right);
+    return dst;
+}
+
+static inline void __sn__Bounds_cleanup(__sn__Bounds *p) {
+
+}
+
+#define sn_auto_Bounds __attribute__((cleanup(__sn__Bounds_cleanup)))
+
+static inline void __sn__Bounds_cleanup_elem(void *p) { __sn__Bounds_cleanup((__sn__Bounds *)p); }
+static inline void __sn__Bounds_copy_into(const void *src, void *dst) { *(__sn__Bounds *)dst = __sn__Bounds_copy((const __sn__Bounds *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Bounds *__sn__Bounds_alloc(void) {
+    return calloc(1, sizeof(__sn__Bounds));
+}
+
+static inline void __sn__Bounds_release(__sn__Bounds **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Bounds __attribute__((cleanup(__sn__Bounds_release)))
+
+static inline void __sn__Bounds_release_elem(void *p) { __sn__Bounds_release((__sn__Bounds **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Bounds_to_string(const __sn__Bounds *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Bounds { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "top_left: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__top_left); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "bottom_right: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__bottom_right); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Canvas (as val) */
+typedef struct {
+    char * __sn__name;
+    __sn__Bounds __sn__bounds;
+    char * __sn__background;
+} __sn__Canvas;
+/* Value operations */
+static inline __sn__Canvas __sn__Canvas_copy(const __sn__Canvas *src) {
+    __sn__Canvas dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__bounds = __sn__Bounds_copy(&src->__sn__bounds);
+    dst.__sn__background = src->__sn__background ? strdup(src->__sn__background) : NULL;
+    return dst;
+}
+
+static inline void __sn__Canvas_cleanup(__sn__Canvas *p) {
+    free(p->__sn__name);
+    free(p->__sn__background);
+
+}
+
+#define sn_auto_Canvas __attribute__((cleanup(__sn__Canvas_cleanup)))
+
+static inline void __sn__Canvas_cleanup_elem(void *p) { __sn__Canvas_cleanup((__sn__Canvas *)p); }
+static inline void __sn__Canvas_copy_into(const void *src, void *dst) { *(__sn__Canvas *)dst = __sn__Canvas_copy((const __sn__Canvas *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Canvas *__sn__Canvas_alloc(void) {
+    return calloc(1, sizeof(__sn__Canvas));
+}
+
+static inline void __sn__Canvas_release(__sn__Canvas **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free((*p)->__sn__background);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Canvas __attribute__((cleanup(__sn__Canvas_release)))
+
+static inline void __sn__Canvas_release_elem(void *p) { __sn__Canvas_release((__sn__Canvas **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Canvas_to_string(const __sn__Canvas *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Canvas { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "bounds: ");
+    { char *__fs__ = __sn__Bounds_to_string(&p->__sn__bounds); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "background: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__background ? p->__sn__background : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+
+
+
+#endif
@@ -0,0 +1,134 @@
+#include "sn_types.h"
+
+
+
+
+
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__points1 = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 1.0, .__sn__y = 2.0 }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 3.0, .__sn__y = 4.0 }));
+            __al__;
+        });
+    sn_print("Test 1 - Array of structs with no defaults passed\n");
+    
+    sn_auto_arr SnArray * __sn__configs1 = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Config), 3);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Config_cleanup_elem;
+            __al__->elem_copy = __sn__Config_copy_into;
+            sn_array_push(__al__, &((__sn__Config){ .__sn__name = strdup("default"), .__sn__value = 0LL, .__sn__enabled = true }));
+            sn_array_push(__al__, &((__sn__Config){ .__sn__name = strdup("custom"), .__sn__value = 0LL, .__sn__enabled = true }));
+            sn_array_push(__al__, &((__sn__Config){ .__sn__value = 42LL, .__sn__enabled = false, .__sn__name = strdup("default") }));
+            __al__;
+        });
+    sn_print("Test 2 - Array of structs with defaults passed\n");
+    
+    sn_auto_Shape __sn__Shape __sn__shape1 = (__sn__Shape){ .__sn__name = strdup("triangle"), .__sn__points = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 3);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 1.0, .__sn__y = 0.0 }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 0.5, .__sn__y = 1.0 }));
+            __al__;
+        }), .__sn__color = strdup("black") };
+    sn_print("Test 3 - Struct containing array of structs passed\n");
+    
+    sn_auto_Shape __sn__Shape __sn__shape2 = (__sn__Shape){ .__sn__name = strdup("line"), .__sn__points = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 5.0, .__sn__y = 5.0 }));
+            __al__;
+        }), .__sn__color = strdup("red") };
+    sn_print("Test 4 - Struct containing array with outer defaults passed\n");
+    
+    sn_auto_Settings __sn__Settings __sn__settings1 = (__sn__Settings){ .__sn__configs = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Config), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Config_cleanup_elem;
+            __al__->elem_copy = __sn__Config_copy_into;
+            sn_array_push(__al__, &((__sn__Config){ .__sn__name = strdup("default"), .__sn__value = 0LL, .__sn__enabled = true }));
+            sn_array_push(__al__, &((__sn__Config){ .__sn__name = strdup("test"), .__sn__value = 0LL, .__sn__enabled = true }));
+            __al__;
+        }), .__sn__active = true };
+    sn_print("Test 5 - Struct containing array of structs with defaults passed\n");
+    
+    sn_auto_Shape __sn__Shape __sn__shape3 = (__sn__Shape){ .__sn__name = strdup("empty"), .__sn__points = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__;
+        }), .__sn__color = strdup("black") };
+    sn_print("Test 6 - Empty array in struct passed\n");
+    
+    sn_auto_Container __sn__Container __sn__container1 = (__sn__Container){ .__sn__label = strdup("shapes"), .__sn__shapes = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Shape), 1);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Shape_cleanup_elem;
+            __al__->elem_copy = __sn__Shape_copy_into;
+            sn_array_push(__al__, &((__sn__Shape){ .__sn__name = strdup("square"), .__sn__points = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 4);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 1.0, .__sn__y = 0.0 }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 1.0, .__sn__y = 1.0 }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 0.0, .__sn__y = 1.0 }));
+            __al__;
+        }), .__sn__color = strdup("black") }));
+            __al__;
+        }), .__sn__count = 0LL };
+    sn_print("Test 7 - Container with nested array of structs passed\n");
+    
+    sn_auto_Container __sn__Container __sn__container2 = (__sn__Container){ .__sn__label = strdup("multi"), .__sn__shapes = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Shape), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Shape_cleanup_elem;
+            __al__->elem_copy = __sn__Shape_copy_into;
+            sn_array_push(__al__, &((__sn__Shape){ .__sn__name = strdup("line1"), .__sn__points = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 1.0, .__sn__y = 1.0 }));
+            __al__;
+        }), .__sn__color = strdup("black") }));
+            sn_array_push(__al__, &((__sn__Shape){ .__sn__name = strdup("line2"), .__sn__points = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 2);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 2.0, .__sn__y = 2.0 }));
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 3.0, .__sn__y = 3.0 }));
+            __al__;
+        }), .__sn__color = strdup("blue") }));
+            __al__;
+        }), .__sn__count = 2LL };
+    sn_print("Test 8 - Container with multiple shapes passed\n");
+    
+    sn_auto_Shape __sn__Shape __sn__single = (__sn__Shape){ .__sn__name = strdup("dot"), .__sn__points = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Point), 1);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            sn_array_push(__al__, &((__sn__Point){ .__sn__x = 5.0, .__sn__y = 5.0 }));
+            __al__;
+        }), .__sn__color = strdup("black") };
+    sn_print("Test 9 - Single element array passed\n");
+    
+    sn_print("All nested struct array tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,318 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Config (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__value;
+    bool __sn__enabled;
+} __sn__Config;
+/* Value operations */
+static inline __sn__Config __sn__Config_copy(const __sn__Config *src) {
+    __sn__Config dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__enabled = src->__sn__enabled;
+    return dst;
+}
+
+static inline void __sn__Config_cleanup(__sn__Config *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Config __attribute__((cleanup(__sn__Config_cleanup)))
+
+static inline void __sn__Config_cleanup_elem(void *p) { __sn__Config_cleanup((__sn__Config *)p); }
+static inline void __sn__Config_copy_into(const void *src, void *dst) { *(__sn__Config *)dst = __sn__Config_copy((const __sn__Config *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Config *__sn__Config_alloc(void) {
+    return calloc(1, sizeof(__sn__Config));
+}
+
+static inline void __sn__Config_release(__sn__Config **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Config __attribute__((cleanup(__sn__Config_release)))
+
+static inline void __sn__Config_release_elem(void *p) { __sn__Config_release((__sn__Config **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Config_to_string(const __sn__Config *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Config { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "enabled: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__enabled ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Shape (as val) */
+typedef struct {
+    char * __sn__name;
+    SnArray * __sn__points;
+    char * __sn__color;
+} __sn__Shape;
+/* Value operations */
+static inline __sn__Shape __sn__Shape_copy(const __sn__Shape *src) {
+    __sn__Shape dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__points = sn_array_copy(src->__sn__points);
+    dst.__sn__color = src->__sn__color ? strdup(src->__sn__color) : NULL;
+    return dst;
+}
+
+static inline void __sn__Shape_cleanup(__sn__Shape *p) {
+    free(p->__sn__name);
+    sn_cleanup_array(&p->__sn__points);
+    free(p->__sn__color);
+
+}
+
+#define sn_auto_Shape __attribute__((cleanup(__sn__Shape_cleanup)))
+
+static inline void __sn__Shape_cleanup_elem(void *p) { __sn__Shape_cleanup((__sn__Shape *)p); }
+static inline void __sn__Shape_copy_into(const void *src, void *dst) { *(__sn__Shape *)dst = __sn__Shape_copy((const __sn__Shape *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Shape *__sn__Shape_alloc(void) {
+    return calloc(1, sizeof(__sn__Shape));
+}
+
+static inline void __sn__Shape_release(__sn__Shape **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        sn_cleanup_array(&(*p)->__sn__points);
+        free((*p)->__sn__color);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Shape __attribute__((cleanup(__sn__Shape_release)))
+
+static inline void __sn__Shape_release_elem(void *p) { __sn__Shape_release((__sn__Shape **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Shape_to_string(const __sn__Shape *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Shape { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "points: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__points); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "color: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__color ? p->__sn__color : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Settings (as val) */
+typedef struct {
+    SnArray * __sn__configs;
+    bool __sn__active;
+} __sn__Settings;
+/* Value operations */
+static inline __sn__Settings __sn__Settings_copy(const __sn__Settings *src) {
+    __sn__Settings dst;
+    dst.__sn__configs = sn_array_copy(src->__sn__configs);
+    dst.__sn__active = src->__sn__active;
+    return dst;
+}
+
+static inline void __sn__Settings_cleanup(__sn__Settings *p) {
+    sn_cleanup_array(&p->__sn__configs);
+
+}
+
+#define sn_auto_Settings __attribute__((cleanup(__sn__Settings_cleanup)))
+
+static inline void __sn__Settings_cleanup_elem(void *p) { __sn__Settings_cleanup((__sn__Settings *)p); }
+static inline void __sn__Settings_copy_into(const void *src, void *dst) { *(__sn__Settings *)dst = __sn__Settings_copy((const __sn__Settings *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Settings *__sn__Settings_alloc(void) {
+    return calloc(1, sizeof(__sn__Settings));
+}
+
+static inline void __sn__Settings_release(__sn__Settings **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__configs);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Settings __attribute__((cleanup(__sn__Settings_release)))
+
+static inline void __sn__Settings_release_elem(void *p) { __sn__Settings_release((__sn__Settings **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Settings_to_string(const __sn__Settings *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Settings { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "configs: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__configs); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "active: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__active ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Container (as val) */
+typedef struct {
+    char * __sn__label;
+    SnArray * __sn__shapes;
+    long long __sn__count;
+} __sn__Container;
+/* Value operations */
+static inline __sn__Container __sn__Container_copy(const __sn__Container *src) {
+    __sn__Container dst;
+    dst.__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    dst.__sn__shapes = sn_array_copy(src->__sn__shapes);
+    dst.__sn__count = src->__sn__count;
+    return dst;
+}
+
+static inline void __sn__Container_cleanup(__sn__Container *p) {
+    free(p->__sn__label);
+    sn_cleanup_array(&p->__sn__shapes);
+
+}
+
+#define sn_auto_Container __attribute__((cleanup(__sn__Container_cleanup)))
+
+static inline void __sn__Container_cleanup_elem(void *p) { __sn__Container_cleanup((__sn__Container *)p); }
+static inline void __sn__Container_copy_into(const void *src, void *dst) { *(__sn__Container *)dst = __sn__Container_copy((const __sn__Container *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Container *__sn__Container_alloc(void) {
+    return calloc(1, sizeof(__sn__Container));
+}
+
+static inline void __sn__Container_release(__sn__Container **p) {
+    if (*p) {
+        free((*p)->__sn__label);
+        sn_cleanup_array(&(*p)->__sn__shapes);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Container __attribute__((cleanup(__sn__Container_release)))
+
+static inline void __sn__Container_release_elem(void *p) { __sn__Container_release((__sn__Container **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Container_to_string(const __sn__Container *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Container { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "shapes: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__shapes); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "count: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__count);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+
+
+
+#endif
@@ -0,0 +1,84 @@
+#include "sn_types.h"
+
+
+
+
+__sn__App __sn__buildApp() {
+
+    sn_auto_Config __sn__Config __sn__cfg = (__sn__Config){ .__sn__name = strdup("myapp"), .__sn__entries = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Entry), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Entry_cleanup_elem;
+            __al__->elem_copy = __sn__Entry_copy_into;
+            __al__;
+        }) };
+
+    __sn__arr_push(&__sn__cfg.__sn__entries, (__sn__Entry){ .__sn__key = strdup("host"), .__sn__value = strdup("localhost") });
+    
+
+    __sn__arr_push(&__sn__cfg.__sn__entries, (__sn__Entry){ .__sn__key = strdup("port"), .__sn__value = strdup("8080") });
+    
+
+    sn_auto_App __sn__App __sn__app = (__sn__App){ .__sn__version = strdup("1.0"), .__sn__config = __sn__Config_copy(&(__sn__cfg)) };
+
+    {
+        __sn__App __ret__ = __sn__app;
+        memset(&__sn__app, 0, sizeof(__sn__app));
+        return __ret__;
+    }}
+
+
+
+
+int main() {
+    sn_auto_App __sn__App __sn__app = __sn__buildApp();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Version: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__app.__sn__version);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Config: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__app.__sn__config.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Entries: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__app.__sn__config.__sn__entries)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, sn_array_length(__sn__app.__sn__config.__sn__entries)); __sn__i++) {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("  ");
+                    sn_auto_str char *__is_p1__ = sn_strdup((((__sn__Entry *)__sn__app.__sn__config.__sn__entries->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__app.__sn__config.__sn__entries->len : __ai__; })]).__sn__key);
+                    sn_auto_str char *__is_p2__ = sn_strdup("=");
+                    sn_auto_str char *__is_p3__ = sn_strdup((((__sn__Entry *)__sn__app.__sn__config.__sn__entries->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__app.__sn__config.__sn__entries->len : __ai__; })]).__sn__value);
+                    sn_auto_str char *__is_p4__ = sn_strdup("\n");
+                    sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                }); sn_print(__ps__); };
+            
+        }
+    }
+    if (((strcmp(__sn__app.__sn__version, "1.0") == 0) && (strcmp(__sn__app.__sn__config.__sn__name, "myapp") == 0))) {
+        if ((sn_array_length(__sn__app.__sn__config.__sn__entries) == 2LL)) {
+            if (((strcmp((((__sn__Entry *)__sn__app.__sn__config.__sn__entries->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__app.__sn__config.__sn__entries->len : __ai__; })]).__sn__key, "host") == 0) && (strcmp((((__sn__Entry *)__sn__app.__sn__config.__sn__entries->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__app.__sn__config.__sn__entries->len : __ai__; })]).__sn__value, "localhost") == 0))) {
+                if (((strcmp((((__sn__Entry *)__sn__app.__sn__config.__sn__entries->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__app.__sn__config.__sn__entries->len : __ai__; })]).__sn__key, "port") == 0) && (strcmp((((__sn__Entry *)__sn__app.__sn__config.__sn__entries->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__app.__sn__config.__sn__entries->len : __ai__; })]).__sn__value, "8080") == 0))) {
+                    sn_print("PASS\n");
+                    
+                    return 0;}
+            }
+        }
+    }
+    sn_print("FAIL\n");
+    
+    fflush(stdout);
+    return 0;
+}
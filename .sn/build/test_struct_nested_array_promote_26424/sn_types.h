@@ -0,0 +1,196 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Entry (as val) */
+typedef struct {
+    char * __sn__key;
+    char * __sn__value;
+} __sn__Entry;
+/* Value operations */
+static inline __sn__Entry __sn__Entry_copy(const __sn__Entry *src) {
+    __sn__Entry dst;
+    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
+    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    return dst;
+}
+
+static inline void __sn__Entry_cleanup(__sn__Entry *p) {
+    free(p->__sn__key);
+    free(p->__sn__value);
+
+}
+
+#define sn_auto_Entry __attribute__((cleanup(__sn__Entry_cleanup)))
+
+static inline void __sn__Entry_cleanup_elem(void *p) { __sn__Entry_cleanup((__sn__Entry *)p); }
+static inline void __sn__Entry_copy_into(const void *src, void *dst) { *(__sn__Entry *)dst = __sn__Entry_copy((const __sn__Entry *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Entry *__sn__Entry_alloc(void) {
+    return calloc(1, sizeof(__sn__Entry));
+}
+
+static inline void __sn__Entry_release(__sn__Entry **p) {
+    if (*p) {
+        free((*p)->__sn__key);
+        free((*p)->__sn__value);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Entry __attribute__((cleanup(__sn__Entry_release)))
+
+static inline void __sn__Entry_release_elem(void *p) { __sn__Entry_release((__sn__Entry **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Entry_to_string(const __sn__Entry *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Entry { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "key: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__key ? p->__sn__key : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Config (as val) */
+typedef struct {
+    char * __sn__name;
+    SnArray * __sn__entries;
+} __sn__Config;
+/* Value operations */
+static inline __sn__Config __sn__Config_copy(const __sn__Config *src) {
+    __sn__Config dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__entries = sn_array_copy(src->__sn__entries);
+    return dst;
+}
+
+static inline void __sn__Config_cleanup(__sn__Config *p) {
+    free(p->__sn__name);
+    sn_cleanup_array(&p->__sn__entries);
+
+}
+
+#define sn_auto_Config __attribute__((cleanup(__sn__Config_cleanup)))
+
+static inline void __sn__Config_cleanup_elem(void *p) { __sn__Config_cleanup((__sn__Config *)p); }
+static inline void __sn__Config_copy_into(const void *src, void *dst) { *(__sn__Config *)dst = __sn__Config_copy((const __sn__Config *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Config *__sn__Config_alloc(void) {
+    return calloc(1, sizeof(__sn__Config));
+}
+
+static inline void __sn__Config_release(__sn__Config **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        sn_cleanup_array(&(*p)->__sn__entries);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Config __attribute__((cleanup(__sn__Config_release)))
+
+static inline void __sn__Config_release_elem(void *p) { __sn__Config_release((__sn__Config **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Config_to_string(const __sn__Config *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Config { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "entries: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__entries); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: App (as val) */
+typedef struct {
+    char * __sn__version;
+    __sn__Config __sn__config;
+} __sn__App;
+/* Value operations */
+static inline __sn__App __sn__App_copy(const __sn__App *src) {
+    __sn__App dst;
+    dst.__sn__version = src->__sn__version ? strdup(src->__sn__version) : NULL;
+    dst.__sn__config = __sn__Config_copy(&src->__sn__config);
+    return dst;
+}
+
+static inline void __sn__App_cleanup(__sn__App *p) {
+    free(p->__sn__version);
+    __sn__Config_cleanup(&p->__sn__config);
+
+}
+
+#define sn_auto_App __attribute__((cleanup(__sn__App_cleanup)))
+
+static inline void __sn__App_cleanup_elem(void *p) { __sn__App_cleanup((__sn__App *)p); }
+static inline void __sn__App_copy_into(const void *src, void *dst) { *(__sn__App *)dst = __sn__App_copy((const __sn__App *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__App *__sn__App_alloc(void) {
+    return calloc(1, sizeof(__sn__App));
+}
+
+static inline void __sn__App_release(__sn__App **p) {
+    if (*p) {
+        free((*p)->__sn__version);
+        __sn__Config_cleanup(&(*p)->__sn__config);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_App __attribute__((cleanup(__sn__App_release)))
+
+static inline void __sn__App_release_elem(void *p) { __sn__App_release((__sn__App **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__App_to_string(const __sn__App *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "App { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "version: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__version ? p->__sn__version : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "config: ");
+    { char *__fs__ = __sn__Config_to_string(&p->__sn__config); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__App __sn__buildApp();
+
+
+
+
+#endif
@@ -0,0 +1,57 @@
+#include "sn_types.h"
+
+
+
+
+
+
+
+
+
+
+
+int main() {
+    sn_auto_Config __sn__Config __sn__cfg1 = (__sn__Config){ .__sn__settings = (__sn__Settings){ .__sn__debug = false, .__sn__level = 1LL, .__sn__name = strdup("default") }, .__sn__enabled = true, .__sn__priority = 5LL };
+    sn_print("Test 1 - 2-level nested, inner all defaults passed\n");
+    
+    sn_auto_Config __sn__Config __sn__cfg2 = (__sn__Config){ .__sn__settings = (__sn__Settings){ .__sn__debug = true, .__sn__level = 1LL, .__sn__name = strdup("default") }, .__sn__enabled = true, .__sn__priority = 5LL };
+    sn_print("Test 2 - 2-level nested, defaults both levels passed\n");
+    
+    sn_auto_Config __sn__Config __sn__cfg3 = (__sn__Config){ .__sn__enabled = false, .__sn__settings = (__sn__Settings){ .__sn__debug = false, .__sn__level = 1LL, .__sn__name = strdup("default") }, .__sn__priority = 10LL };
+    sn_print("Test 3 - 2-level nested, override outer defaults passed\n");
+    
+    sn_auto_Shape __sn__Shape __sn__shape1 = (__sn__Shape){ .__sn__origin = (__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }, .__sn__color = strdup("black"), .__sn__filled = false };
+    sn_print("Test 4 - 2-level nested, inner no defaults passed\n");
+    
+    sn_auto_Shape __sn__Shape __sn__shape2 = (__sn__Shape){ .__sn__color = strdup("red"), .__sn__origin = (__sn__Point){ .__sn__x = 10.0, .__sn__y = 20.0 }, .__sn__filled = true };
+    sn_print("Test 5 - 2-level nested, override all passed\n");
+    
+    sn_auto_ServerConfig __sn__ServerConfig __sn__srv1 = (__sn__ServerConfig){ .__sn__timing = (__sn__Timing){ .__sn__retries = 3LL, .__sn__timeout = 30LL, .__sn__delay = 100LL }, .__sn__settings = (__sn__Settings){ .__sn__debug = false, .__sn__level = 1LL, .__sn__name = strdup("default") }, .__sn__host = strdup("localhost"), .__sn__port = 8080LL };
+    sn_print("Test 6 - 2-level nested, multiple inners passed\n");
+    
+    sn_auto_ServerConfig __sn__ServerConfig __sn__srv2 = (__sn__ServerConfig){ .__sn__host = strdup("api.example.com"), .__sn__timing = (__sn__Timing){ .__sn__retries = 5LL, .__sn__timeout = 60LL, .__sn__delay = 100LL }, .__sn__settings = (__sn__Settings){ .__sn__name = strdup("production"), .__sn__debug = false, .__sn__level = 1LL }, .__sn__port = 8080LL };
+    sn_print("Test 7 - 2-level nested, mixed inner defaults passed\n");
+    
+    sn_auto_Application __sn__Application __sn__app1 = (__sn__Application){ .__sn__name = strdup("MyApp"), .__sn__config = (__sn__Config){ .__sn__settings = (__sn__Settings){ .__sn__debug = false, .__sn__level = 1LL, .__sn__name = strdup("default") }, .__sn__enabled = true, .__sn__priority = 5LL }, .__sn__version = strdup("1.0.0"), .__sn__debug = false };
+    sn_print("Test 8 - 3-level nested, partial init passed\n");
+    
+    sn_auto_Application __sn__Application __sn__app2 = (__sn__Application){ .__sn__name = strdup("TestApp"), .__sn__version = strdup("2.0.0"), .__sn__config = (__sn__Config){ .__sn__enabled = true, .__sn__settings = (__sn__Settings){ .__sn__debug = true, .__sn__level = 3LL, .__sn__name = strdup("default") }, .__sn__priority = 1LL }, .__sn__debug = true };
+    sn_print("Test 9 - 3-level nested, all levels explicit passed\n");
+    
+    sn_auto_Application __sn__Application __sn__app3 = (__sn__Application){ .__sn__name = strdup("MinimalApp"), .__sn__config = (__sn__Config){ .__sn__settings = (__sn__Settings){ .__sn__debug = false, .__sn__level = 1LL, .__sn__name = strdup("default") }, .__sn__enabled = true, .__sn__priority = 5LL }, .__sn__version = strdup("1.0.0"), .__sn__debug = false };
+    sn_print("Test 10 - 3-level nested, minimal init passed\n");
+    
+    sn_auto_Application __sn__Application __sn__app4 = (__sn__Application){ .__sn__name = strdup("DefaultsApp"), .__sn__config = (__sn__Config){ .__sn__settings = (__sn__Settings){ .__sn__name = strdup("custom"), .__sn__debug = false, .__sn__level = 1LL }, .__sn__enabled = true, .__sn__priority = 5LL }, .__sn__version = strdup("1.0.0"), .__sn__debug = false };
+    sn_print("Test 11 - 3-level nested, defaults propagate passed\n");
+    
+    sn_auto_ComplexApp __sn__ComplexApp __sn__complex1 = (__sn__ComplexApp){ .__sn__appName = strdup("ComplexApp"), .__sn__mainConfig = (__sn__ServerConfig){ .__sn__timing = (__sn__Timing){ .__sn__retries = 3LL, .__sn__timeout = 30LL, .__sn__delay = 100LL }, .__sn__settings = (__sn__Settings){ .__sn__debug = false, .__sn__level = 1LL, .__sn__name = strdup("default") }, .__sn__host = strdup("localhost"), .__sn__port = 8080LL }, .__sn__fallbackConfig = (__sn__ServerConfig){ .__sn__host = strdup("backup.example.com"), .__sn__port = 9090LL, .__sn__timing = (__sn__Timing){ .__sn__retries = 5LL, .__sn__delay = 200LL, .__sn__timeout = 30LL }, .__sn__settings = (__sn__Settings){ .__sn__debug = true, .__sn__level = 1LL, .__sn__name = strdup("default") } }, .__sn__active = true };
+    sn_print("Test 12 - Complex nested with multiple paths passed\n");
+    
+    sn_auto_ComplexApp __sn__ComplexApp __sn__complex2 = (__sn__ComplexApp){ .__sn__appName = strdup("MinimalComplex"), .__sn__mainConfig = (__sn__ServerConfig){ .__sn__timing = (__sn__Timing){ .__sn__retries = 1LL, .__sn__timeout = 30LL, .__sn__delay = 100LL }, .__sn__settings = (__sn__Settings){ .__sn__debug = false, .__sn__level = 1LL, .__sn__name = strdup("default") }, .__sn__host = strdup("localhost"), .__sn__port = 8080LL }, .__sn__fallbackConfig = (__sn__ServerConfig){ .__sn__timing = (__sn__Timing){ .__sn__retries = 2LL, .__sn__timeout = 30LL, .__sn__delay = 100LL }, .__sn__settings = (__sn__Settings){ .__sn__debug = false, .__sn__level = 1LL, .__sn__name = strdup("default") }, .__sn__host = strdup("localhost"), .__sn__port = 8080LL }, .__sn__active = true };
+    sn_print("Test 13 - Complex nested minimal init passed\n");
+    
+    sn_print("All nested struct initialization tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
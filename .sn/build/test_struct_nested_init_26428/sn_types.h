@@ -0,0 +1,520 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Settings (as val) */
+typedef struct {
+    bool __sn__debug;
+    long long __sn__level;
+    char * __sn__name;
+} __sn__Settings;
+/* Value operations */
+static inline __sn__Settings __sn__Settings_copy(const __sn__Settings *src) {
+    __sn__Settings dst;
+    dst.__sn__debug = src->__sn__debug;
+    dst.__sn__level = src->__sn__level;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__Settings_cleanup(__sn__Settings *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Settings __attribute__((cleanup(__sn__Settings_cleanup)))
+
+static inline void __sn__Settings_cleanup_elem(void *p) { __sn__Settings_cleanup((__sn__Settings *)p); }
+static inline void __sn__Settings_copy_into(const void *src, void *dst) { *(__sn__Settings *)dst = __sn__Settings_copy((const __sn__Settings *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Settings *__sn__Settings_alloc(void) {
+    return calloc(1, sizeof(__sn__Settings));
+}
+
+static inline void __sn__Settings_release(__sn__Settings **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Settings __attribute__((cleanup(__sn__Settings_release)))
+
+static inline void __sn__Settings_release_elem(void *p) { __sn__Settings_release((__sn__Settings **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Settings_to_string(const __sn__Settings *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Settings { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "debug: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__debug ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "level: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__level);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Point (as val) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Timing (as val) */
+typedef struct {
+    long long __sn__timeout;
+    long long __sn__retries;
+    long long __sn__delay;
+} __sn__Timing;
+/* Value operations */
+static inline __sn__Timing __sn__Timing_copy(const __sn__Timing *src) {
+    __sn__Timing dst;
+    dst.__sn__timeout = src->__sn__timeout;
+    dst.__sn__retries = src->__sn__retries;
+    dst.__sn__delay = src->__sn__delay;
+    return dst;
+}
+
+static inline void __sn__Timing_cleanup(__sn__Timing *p) {
+
+}
+
+#define sn_auto_Timing __attribute__((cleanup(__sn__Timing_cleanup)))
+
+static inline void __sn__Timing_cleanup_elem(void *p) { __sn__Timing_cleanup((__sn__Timing *)p); }
+static inline void __sn__Timing_copy_into(const void *src, void *dst) { *(__sn__Timing *)dst = __sn__Timing_copy((const __sn__Timing *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Timing *__sn__Timing_alloc(void) {
+    return calloc(1, sizeof(__sn__Timing));
+}
+
+static inline void __sn__Timing_release(__sn__Timing **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Timing __attribute__((cleanup(__sn__Timing_release)))
+
+static inline void __sn__Timing_release_elem(void *p) { __sn__Timing_release((__sn__Timing **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Timing_to_string(const __sn__Timing *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Timing { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "timeout: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__timeout);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "retries: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__retries);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "delay: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__delay);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Config (as val) */
+typedef struct {
+    bool __sn__enabled;
+    __sn__Settings __sn__settings;
+    long long __sn__priority;
+} __sn__Config;
+/* Value operations */
+static inline __sn__Config __sn__Config_copy(const __sn__Config *src) {
+    __sn__Config dst;
+    dst.__sn__enabled = src->__sn__enabled;
+    dst.__sn__settings = __sn__Settings_copy(&src->__sn__settings);
+    dst.__sn__priority = src->__sn__priority;
+    return dst;
+}
+
+static inline void __sn__Config_cleanup(__sn__Config *p) {
+    __sn__Settings_cleanup(&p->__sn__settings);
+
+}
+
+#define sn_auto_Config __attribute__((cleanup(__sn__Config_cleanup)))
+
+static inline void __sn__Config_cleanup_elem(void *p) { __sn__Config_cleanup((__sn__Config *)p); }
+static inline void __sn__Config_copy_into(const void *src, void *dst) { *(__sn__Config *)dst = __sn__Config_copy((const __sn__Config *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Config *__sn__Config_alloc(void) {
+    return calloc(1, sizeof(__sn__Config));
+}
+
+static inline void __sn__Config_release(__sn__Config **p) {
+    if (*p) {
+        __sn__Settings_cleanup(&(*p)->__sn__settings);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Config __attribute__((cleanup(__sn__Config_release)))
+
+static inline void __sn__Config_release_elem(void *p) { __sn__Config_release((__sn__Config **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Config_to_string(const __sn__Config *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Config { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "enabled: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__enabled ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "settings: ");
+    { char *__fs__ = __sn__Settings_to_string(&p->__sn__settings); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "priority: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__priority);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Shape (as val) */
+typedef struct {
+    char * __sn__color;
+    __sn__Point __sn__origin;
+    bool __sn__filled;
+} __sn__Shape;
+/* Value operations */
+static inline __sn__Shape __sn__Shape_copy(const __sn__Shape *src) {
+    __sn__Shape dst;
+    dst.__sn__color = src->__sn__color ? strdup(src->__sn__color) : NULL;
+    dst.__sn__origin = __sn__Point_copy(&src->__sn__origin);
+    dst.__sn__filled = src->__sn__filled;
+    return dst;
+}
+
+static inline void __sn__Shape_cleanup(__sn__Shape *p) {
+    free(p->__sn__color);
+
+}
+
+#define sn_auto_Shape __attribute__((cleanup(__sn__Shape_cleanup)))
+
+static inline void __sn__Shape_cleanup_elem(void *p) { __sn__Shape_cleanup((__sn__Shape *)p); }
+static inline void __sn__Shape_copy_into(const void *src, void *dst) { *(__sn__Shape *)dst = __sn__Shape_copy((const __sn__Shape *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Shape *__sn__Shape_alloc(void) {
+    return calloc(1, sizeof(__sn__Shape));
+}
+
+static inline void __sn__Shape_release(__sn__Shape **p) {
+    if (*p) {
+        free((*p)->__sn__color);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Shape __attribute__((cleanup(__sn__Shape_release)))
+
+static inline void __sn__Shape_release_elem(void *p) { __sn__Shape_release((__sn__Shape **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Shape_to_string(const __sn__Shape *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Shape { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "color: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__color ? p->__sn__color : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "origin: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__origin); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "filled: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__filled ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: ServerConfig (as val) */
+typedef struct {
+    char * __sn__host;
+    long long __sn__port;
+    __sn__Timing __sn__timing;
+    __sn__Settings __sn__settings;
+} __sn__ServerConfig;
+/* Value operations */
+static inline __sn__ServerConfig __sn__ServerConfig_copy(const __sn__ServerConfig *src) {
+    __sn__ServerConfig dst;
+    dst.__sn__host = src->__sn__host ? strdup(src->__sn__host) : NULL;
+    dst.__sn__port = src->__sn__port;
+    dst.__sn__timing = __sn__Timing_copy(&src->__sn__timing);
+    dst.__sn__settings = __sn__Settings_copy(&src->__sn__settings);
+    return dst;
+}
+
+static inline void __sn__ServerConfig_cleanup(__sn__ServerConfig *p) {
+    free(p->__sn__host);
+    __sn__Settings_cleanup(&p->__sn__settings);
+
+}
+
+#define sn_auto_ServerConfig __attribute__((cleanup(__sn__ServerConfig_cleanup)))
+
+static inline void __sn__ServerConfig_cleanup_elem(void *p) { __sn__ServerConfig_cleanup((__sn__ServerConfig *)p); }
+static inline void __sn__ServerConfig_copy_into(const void *src, void *dst) { *(__sn__ServerConfig *)dst = __sn__ServerConfig_copy((const __sn__ServerConfig *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__ServerConfig *__sn__ServerConfig_alloc(void) {
+    return calloc(1, sizeof(__sn__ServerConfig));
+}
+
+static inline void __sn__ServerConfig_release(__sn__ServerConfig **p) {
+    if (*p) {
+        free((*p)->__sn__host);
+        __sn__Settings_cleanup(&(*p)->__sn__settings);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_ServerConfig __attribute__((cleanup(__sn__ServerConfig_release)))
+
+static inline void __sn__ServerConfig_release_elem(void *p) { __sn__ServerConfig_release((__sn__ServerConfig **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__ServerConfig_to_string(const __sn__ServerConfig *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "ServerConfig { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "host: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__host ? p->__sn__host : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "port: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__port);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "timing: ");
+    { char *__fs__ = __sn__Timing_to_string(&p->__sn__timing); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "settings: ");
+    { char *__fs__ = __sn__Settings_to_string(&p->__sn__settings); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Application (as val) */
+typedef struct {
+    char * __sn__name;
+    char * __sn__version;
+    __sn__Config __sn__config;
+    bool __sn__debug;
+} __sn__Application;
+/* Value operations */
+static inline __sn__Application __sn__Application_copy(const __sn__Application *src) {
+    __sn__Application dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__version = src->__sn__version ? strdup(src->__sn__version) : NULL;
+    dst.__sn__config = __sn__Config_copy(&src->__sn__config);
+    dst.__sn__debug = src->__sn__debug;
+    return dst;
+}
+
+static inline void __sn__Application_cleanup(__sn__Application *p) {
+    free(p->__sn__name);
+    free(p->__sn__version);
+    __sn__Config_cleanup(&p->__sn__config);
+
+}
+
+#define sn_auto_Application __attribute__((cleanup(__sn__Application_cleanup)))
+
+static inline void __sn__Application_cleanup_elem(void *p) { __sn__Application_cleanup((__sn__Application *)p); }
+static inline void __sn__Application_copy_into(const void *src, void *dst) { *(__sn__Application *)dst = __sn__Application_copy((const __sn__Application *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Application *__sn__Application_alloc(void) {
+    return calloc(1, sizeof(__sn__Application));
+}
+
+static inline void __sn__Application_release(__sn__Application **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free((*p)->__sn__version);
+        __sn__Config_cleanup(&(*p)->__sn__config);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Application __attribute__((cleanup(__sn__Application_release)))
+
+static inline void __sn__Application_release_elem(void *p) { __sn__Application_release((__sn__Application **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Application_to_string(const __sn__Application *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Application { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "version: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__version ? p->__sn__version : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "config: ");
+    { char *__fs__ = __sn__Config_to_string(&p->__sn__config); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "debug: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__debug ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: ComplexApp (as val) */
+typedef struct {
+    char * __sn__appName;
+    __sn__ServerConfig __sn__mainConfig;
+    __sn__ServerConfig __sn__fallbackConfig;
+    bool __sn__active;
+} __sn__ComplexApp;
+/* Value operations */
+static inline __sn__ComplexApp __sn__ComplexApp_copy(const __sn__ComplexApp *src) {
+    __sn__ComplexApp dst;
+    dst.__sn__appName = src->__sn__appName ? strdup(src->__sn__appName) : NULL;
+    dst.__sn__mainConfig = __sn__ServerConfig_copy(&src->__sn__mainConfig);
+    dst.__sn__fallbackConfig = __sn__ServerConfig_copy(&src->__sn__fallbackConfig);
+    dst.__sn__active = src->__sn__active;
+    return dst;
+}
+
+static inline void __sn__ComplexApp_cleanup(__sn__ComplexApp *p) {
+    free(p->__sn__appName);
+    __sn__ServerConfig_cleanup(&p->__sn__mainConfig);
+    __sn__ServerConfig_cleanup(&p->__sn__fallbackConfig);
+
+}
+
+#define sn_auto_ComplexApp __attribute__((cleanup(__sn__ComplexApp_cleanup)))
+
+static inline void __sn__ComplexApp_cleanup_elem(void *p) { __sn__ComplexApp_cleanup((__sn__ComplexApp *)p); }
+static inline void __sn__ComplexApp_copy_into(const void *src, void *dst) { *(__sn__ComplexApp *)dst = __sn__ComplexApp_copy((const __sn__ComplexApp *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__ComplexApp *__sn__ComplexApp_alloc(void) {
+    return calloc(1, sizeof(__sn__ComplexApp));
+}
+
+static inline void __sn__ComplexApp_release(__sn__ComplexApp **p) {
+    if (*p) {
+        free((*p)->__sn__appName);
+        __sn__ServerConfig_cleanup(&(*p)->__sn__mainConfig);
+        __sn__ServerConfig_cleanup(&(*p)->__sn__fallbackConfig);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_ComplexApp __attribute__((cleanup(__sn__ComplexApp_release)))
+
+static inline void __sn__ComplexApp_release_elem(void *p) { __sn__ComplexApp_release((__sn__ComplexApp **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__ComplexApp_to_string(const __sn__ComplexApp *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "ComplexApp { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "appName: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__appName ? p->__sn__appName : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "mainConfig: ");
+    { char *__fs__ = __sn__ServerConfig_to_string(&p->__sn__mainConfig); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "fallbackConfig: ");
+    { char *__fs__ = __sn__ServerConfig_to_string(&p->__sn__fallbackConfig); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "active: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__active ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+
+
+
+#endif
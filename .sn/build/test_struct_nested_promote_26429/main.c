@@ -0,0 +1,60 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Person __sn__createPerson() {
+
+    sn_auto_Address __sn__Address __sn__addr = (__sn__Address){ .__sn__street = strdup("123 Main St"), .__sn__city = strdup("Springfield") };
+
+    sn_auto_Person __sn__Person __sn__p = (__sn__Person){ .__sn__name = strdup("Alice"), .__sn__age = 30LL, .__sn__address = __sn__Address_copy(&(__sn__addr)) };
+
+    {
+        __sn__Person __ret__ = __sn__p;
+        memset(&__sn__p, 0, sizeof(__sn__p));
+        return __ret__;
+    }}
+
+
+
+int main() {
+    sn_auto_Person __sn__Person __sn__p = __sn__createPerson();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Name: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__p.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Age: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__age));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Street: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__p.__sn__address.__sn__street);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("City: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__p.__sn__address.__sn__city);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (((strcmp(__sn__p.__sn__name, "Alice") == 0) && (__sn__p.__sn__age == 30LL))) {
+        if (((strcmp(__sn__p.__sn__address.__sn__street, "123 Main St") == 0) && (strcmp(__sn__p.__sn__address.__sn__city, "Springfield") == 0))) {
+            sn_print("PASS\n");
+            
+            return 0;}
+    }
+    sn_print("FAIL\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,144 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Address (as val) */
+typedef struct {
+    char * __sn__street;
+    char * __sn__city;
+} __sn__Address;
+/* Value operations */
+static inline __sn__Address __sn__Address_copy(const __sn__Address *src) {
+    __sn__Address dst;
+    dst.__sn__street = src->__sn__street ? strdup(src->__sn__street) : NULL;
+    dst.__sn__city = src->__sn__city ? strdup(src->__sn__city) : NULL;
+    return dst;
+}
+
+static inline void __sn__Address_cleanup(__sn__Address *p) {
+    free(p->__sn__street);
+    free(p->__sn__city);
+
+}
+
+#define sn_auto_Address __attribute__((cleanup(__sn__Address_cleanup)))
+
+static inline void __sn__Address_cleanup_elem(void *p) { __sn__Address_cleanup((__sn__Address *)p); }
+static inline void __sn__Address_copy_into(const void *src, void *dst) { *(__sn__Address *)dst = __sn__Address_copy((const __sn__Address *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Address *__sn__Address_alloc(void) {
+    return calloc(1, sizeof(__sn__Address));
+}
+
+static inline void __sn__Address_release(__sn__Address **p) {
+    if (*p) {
+        free((*p)->__sn__street);
+        free((*p)->__sn__city);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Address __attribute__((cleanup(__sn__Address_release)))
+
+static inline void __sn__Address_release_elem(void *p) { __sn__Address_release((__sn__Address **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Address_to_string(const __sn__Address *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Address { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "street: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__street ? p->__sn__street : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "city: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__city ? p->__sn__city : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Person (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__age;
+    __sn__Address __sn__address;
+} __sn__Person;
+/* Value operations */
+static inline __sn__Person __sn__Person_copy(const __sn__Person *src) {
+    __sn__Person dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__age = src->__sn__age;
+    dst.__sn__address = __sn__Address_copy(&src->__sn__address);
+    return dst;
+}
+
+static inline void __sn__Person_cleanup(__sn__Person *p) {
+    free(p->__sn__name);
+    __sn__Address_cleanup(&p->__sn__address);
+
+}
+
+#define sn_auto_Person __attribute__((cleanup(__sn__Person_cleanup)))
+
+static inline void __sn__Person_cleanup_elem(void *p) { __sn__Person_cleanup((__sn__Person *)p); }
+static inline void __sn__Person_copy_into(const void *src, void *dst) { *(__sn__Person *)dst = __sn__Person_copy((const __sn__Person *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Person *__sn__Person_alloc(void) {
+    return calloc(1, sizeof(__sn__Person));
+}
+
+static inline void __sn__Person_release(__sn__Person **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        __sn__Address_cleanup(&(*p)->__sn__address);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Person __attribute__((cleanup(__sn__Person_release)))
+
+static inline void __sn__Person_release_elem(void *p) { __sn__Person_release((__sn__Person **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Person_to_string(const __sn__Person *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Person { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "age: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__age);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "address: ");
+    { char *__fs__ = __sn__Address_to_string(&p->__sn__address); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Person __sn__createPerson();
+
+
+
+
+#endif
@@ -0,0 +1,44 @@
+#include "sn_types.h"
+
+
+
+void test_native_ptr_struct() {
+
+    __sn__DataBuffer __sn__buf = (__sn__DataBuffer){ .__sn__data = NULL, .__sn__size = 0LL, .__sn__capacity = 1024LL };
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Native struct: size=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__buf.__sn__size));
+            sn_auto_str char *__is_p2__ = sn_strdup(", capacity=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__buf.__sn__capacity));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    (__sn__buf.__sn__size = 100LL);
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After modification: size=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__buf.__sn__size));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    sn_print("Native struct with pointer fields works!\n");
+    
+}
+
+
+
+
+int main() {
+    sn_print("Packed struct declarations compile successfully\n");
+    
+    test_native_ptr_struct();
+    
+    fflush(stdout);
+    return 0;
+}
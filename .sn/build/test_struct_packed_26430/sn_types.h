@@ -0,0 +1,160 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: PackedHeader (as val) */
+#pragma pack(push, 1)
+typedef struct {
+    int32_t __sn__magic;
+    unsigned char __sn__version;
+    unsigned char __sn__flags;
+    int32_t __sn__size;
+} __sn__PackedHeader;
+#pragma pack(pop)
+/* Value operations */
+static inline __sn__PackedHeader __sn__PackedHeader_copy(const __sn__PackedHeader *src) {
+    __sn__PackedHeader dst;
+    dst.__sn__magic = src->__sn__magic;
+    dst.__sn__version = src->__sn__version;
+    dst.__sn__flags = src->__sn__flags;
+    dst.__sn__size = src->__sn__size;
+    return dst;
+}
+
+static inline void __sn__PackedHeader_cleanup(__sn__PackedHeader *p) {
+
+}
+
+#define sn_auto_PackedHeader __attribute__((cleanup(__sn__PackedHeader_cleanup)))
+
+static inline void __sn__PackedHeader_cleanup_elem(void *p) { __sn__PackedHeader_cleanup((__sn__PackedHeader *)p); }
+static inline void __sn__PackedHeader_copy_into(const void *src, void *dst) { *(__sn__PackedHeader *)dst = __sn__PackedHeader_copy((const __sn__PackedHeader *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__PackedHeader *__sn__PackedHeader_alloc(void) {
+    return calloc(1, sizeof(__sn__PackedHeader));
+}
+
+static inline void __sn__PackedHeader_release(__sn__PackedHeader **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_PackedHeader __attribute__((cleanup(__sn__PackedHeader_release)))
+
+static inline void __sn__PackedHeader_release_elem(void *p) { __sn__PackedHeader_release((__sn__PackedHeader **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__PackedHeader_to_string(const __sn__PackedHeader *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "PackedHeader { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "magic: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__magic);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "version: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__version);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "flags: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__flags);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "size: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__size);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: UnpackedHeader (as val) */
+typedef struct {
+    int32_t __sn__magic;
+    unsigned char __sn__version;
+    unsigned char __sn__flags;
+    int32_t __sn__size;
+} __sn__UnpackedHeader;
+/* Value operations */
+static inline __sn__UnpackedHeader __sn__UnpackedHeader_copy(const __sn__UnpackedHeader *src) {
+    __sn__UnpackedHeader dst;
+    dst.__sn__magic = src->__sn__magic;
+    dst.__sn__version = src->__sn__version;
+    dst.__sn__flags = src->__sn__flags;
+    dst.__sn__size = src->__sn__size;
+    return dst;
+}
+
+static inline void __sn__UnpackedHeader_cleanup(__sn__UnpackedHeader *p) {
+
+}
+
+#define sn_auto_UnpackedHeader __attribute__((cleanup(__sn__UnpackedHeader_cleanup)))
+
+static inline void __sn__UnpackedHeader_cleanup_elem(void *p) { __sn__UnpackedHeader_cleanup((__sn__UnpackedHeader *)p); }
+static inline void __sn__UnpackedHeader_copy_into(const void *src, void *dst) { *(__sn__UnpackedHeader *)dst = __sn__UnpackedHeader_copy((const __sn__UnpackedHeader *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__UnpackedHeader *__sn__UnpackedHeader_alloc(void) {
+    return calloc(1, sizeof(__sn__UnpackedHeader));
+}
+
+static inline void __sn__UnpackedHeader_release(__sn__UnpackedHeader **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_UnpackedHeader __attribute__((cleanup(__sn__UnpackedHeader_release)))
+
+static inline void __sn__UnpackedHeader_release_elem(void *p) { __sn__UnpackedHeader_release((__sn__UnpackedHeader **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__UnpackedHeader_to_string(const __sn__UnpackedHeader *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "UnpackedHeader { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "magic: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__magic);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "version: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__version);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "flags: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__flags);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "size: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__size);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: DataBuffer (native) */
+typedef struct {
+    unsigned char * __sn__data;
+    long long __sn__size;
+    long long __sn__capacity;
+} __sn__DataBuffer;
+
+
+void test_native_ptr_struct();
+
+
+
+
+#endif
@@ -0,0 +1,63 @@
+#include "sn_types.h"
+__sn__Tracker * tracker_create(long long);
+long long tracker_alive_count();
+
+
+
+
+__sn__Layer __sn__createLayer(long long __sn__id) {
+
+    return (__sn__Layer){ .__sn__weight = tracker_create(__sn__id), .__sn__bias = tracker_create(sn_add_long(__sn__id, 100LL)) };}
+
+
+__sn__Network __sn__createNetwork() {
+
+    sn_auto_arr SnArray * __sn__layers = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Layer), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Layer_cleanup_elem;
+            __al__->elem_copy = __sn__Layer_copy_into;
+            __al__;
+        });
+
+    __sn__arr_push(&__sn__layers, __sn__createLayer(1LL));
+    
+
+    __sn__arr_push(&__sn__layers, __sn__createLayer(2LL));
+    
+
+    return (__sn__Network){ .__sn__layers = sn_array_copy(__sn__layers) };}
+
+
+void __sn__run() {
+
+    sn_auto_Network __sn__Network __sn__net = __sn__createNetwork();
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("inside run: layers=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__net.__sn__layers)));
+            sn_auto_str char *__is_p2__ = sn_strdup(" alive=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(tracker_alive_count()));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+}
+
+
+
+
+int main() {
+    __sn__run();
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("leaked layer trackers: alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tracker_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((tracker_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    sn_println("test_struct_return_array_leak: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
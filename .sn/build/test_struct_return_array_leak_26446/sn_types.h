@@ -0,0 +1,169 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Tracker (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__id;
+} __sn__Tracker;
+
+
+static inline __sn__Tracker *__sn__Tracker__new(void) {
+    __sn__Tracker *p = calloc(1, sizeof(__sn__Tracker));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Tracker *__sn__Tracker_retain(__sn__Tracker *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+void tracker_dispose(__sn__Tracker *);
+static inline void __sn__Tracker_release(__sn__Tracker **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        tracker_dispose(*p);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Tracker __attribute__((cleanup(__sn__Tracker_release)))
+#define sn_auto_ref_Tracker __attribute__((cleanup(__sn__Tracker_release)))
+
+static inline void __sn__Tracker_release_elem(void *p) { __sn__Tracker_release((__sn__Tracker **)p); }
+static inline void __sn__Tracker_retain_into(const void *src, void *dst) { *(__sn__Tracker **)dst = __sn__Tracker_retain(*(__sn__Tracker *const *)src); }
+
+/* Struct: Layer (as val) */
+typedef struct {
+    __sn__Tracker * __sn__weight;
+    __sn__Tracker * __sn__bias;
+} __sn__Layer;
+/* Value operations */
+static inline __sn__Layer __sn__Layer_copy(const __sn__Layer *src) {
+    __sn__Layer dst;
+    dst.__sn__weight = __sn__Tracker_retain(src->__sn__weight);
+    dst.__sn__bias = __sn__Tracker_retain(src->__sn__bias);
+    return dst;
+}
+
+static inline void __sn__Layer_cleanup(__sn__Layer *p) {
+    __sn__Tracker_release(&p->__sn__weight);
+    __sn__Tracker_release(&p->__sn__bias);
+
+}
+
+#define sn_auto_Layer __attribute__((cleanup(__sn__Layer_cleanup)))
+
+static inline void __sn__Layer_cleanup_elem(void *p) { __sn__Layer_cleanup((__sn__Layer *)p); }
+static inline void __sn__Layer_copy_into(const void *src, void *dst) { *(__sn__Layer *)dst = __sn__Layer_copy((const __sn__Layer *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Layer *__sn__Layer_alloc(void) {
+    return calloc(1, sizeof(__sn__Layer));
+}
+
+static inline void __sn__Layer_release(__sn__Layer **p) {
+    if (*p) {
+        __sn__Tracker_release(&(*p)->__sn__weight);
+        __sn__Tracker_release(&(*p)->__sn__bias);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Layer __attribute__((cleanup(__sn__Layer_release)))
+
+static inline void __sn__Layer_release_elem(void *p) { __sn__Layer_release((__sn__Layer **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Layer_to_string(const __sn__Layer *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Layer { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "weight: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "<Tracker %p>", (void *)p->__sn__weight);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "bias: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "<Tracker %p>", (void *)p->__sn__bias);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Network (as val) */
+typedef struct {
+    SnArray * __sn__layers;
+} __sn__Network;
+/* Value operations */
+static inline __sn__Network __sn__Network_copy(const __sn__Network *src) {
+    __sn__Network dst;
+    dst.__sn__layers = sn_array_copy(src->__sn__layers);
+    return dst;
+}
+
+static inline void __sn__Network_cleanup(__sn__Network *p) {
+    sn_cleanup_array(&p->__sn__layers);
+
+}
+
+#define sn_auto_Network __attribute__((cleanup(__sn__Network_cleanup)))
+
+static inline void __sn__Network_cleanup_elem(void *p) { __sn__Network_cleanup((__sn__Network *)p); }
+static inline void __sn__Network_copy_into(const void *src, void *dst) { *(__sn__Network *)dst = __sn__Network_copy((const __sn__Network *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Network *__sn__Network_alloc(void) {
+    return calloc(1, sizeof(__sn__Network));
+}
+
+static inline void __sn__Network_release(__sn__Network **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__layers);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Network __attribute__((cleanup(__sn__Network_release)))
+
+static inline void __sn__Network_release_elem(void *p) { __sn__Network_release((__sn__Network **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Network_to_string(const __sn__Network *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Network { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "layers: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__layers); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Layer __sn__createLayer(long long);
+__sn__Network __sn__createNetwork();
+void __sn__run();
+
+void tracker_dispose(__sn__Tracker *);
+
+
+
+#endif
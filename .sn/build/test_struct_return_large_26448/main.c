@@ -0,0 +1,165 @@
+#include "sn_types.h"
+
+
+
+
+__sn__LargeData __sn__createLargeData(long long __sn__v) {
+
+    return (__sn__LargeData){ .__sn__a1 = __sn__v, .__sn__b1 = sn_mul_long(__sn__v, 2LL), .__sn__c1 = sn_mul_long(__sn__v, 3LL), .__sn__d1 = sn_mul_long(__sn__v, 4LL), .__sn__p8 = sn_mul_long(__sn__v, 100LL), .__sn__a2 = 0LL, .__sn__a3 = 0LL, .__sn__a4 = 0LL, .__sn__a5 = 0LL, .__sn__a6 = 0LL, .__sn__a7 = 0LL, .__sn__a8 = 0LL, .__sn__b2 = 0LL, .__sn__b3 = 0LL, .__sn__b4 = 0LL, .__sn__b5 = 0LL, .__sn__b6 = 0LL, .__sn__b7 = 0LL, .__sn__b8 = 0LL, .__sn__c2 = 0LL, .__sn__c3 = 0LL, .__sn__c4 = 0LL, .__sn__c5 = 0LL, .__sn__c6 = 0LL, .__sn__c7 = 0LL, .__sn__c8 = 0LL, .__sn__d2 = 0LL, .__sn__d3 = 0LL, .__sn__d4 = 0LL, .__sn__d5 = 0LL, .__sn__d6 = 0LL, .__sn__d7 = 0LL, .__sn__d8 = 0LL, .__sn__e1 = 0LL, .__sn__e2 = 0LL, .__sn__e3 = 0LL, .__sn__e4 = 0LL, .__sn__e5 = 0LL, .__sn__e6 = 0LL, .__sn__e7 = 0LL, .__sn__e8 = 0LL, .__sn__f1 = 0LL, .__sn__f2 = 0LL, .__sn__f3 = 0LL, .__sn__f4 = 0LL, .__sn__f5 = 0LL, .__sn__f6 = 0LL, .__sn__f7 = 0LL, .__sn__f8 = 0LL, .__sn__g1 = 0LL, .__sn__g2 = 0LL, .__sn__g3 = 0LL, .__sn__g4 = 0LL, .__sn__g5 = 0LL, .__sn__g6 = 0LL, .__sn__g7 = 0LL, .__sn__g8 = 0LL, .__sn__h1 = 0LL, .__sn__h2 = 0LL, .__sn__h3 = 0LL, .__sn__h4 = 0LL, .__sn__h5 = 0LL, .__sn__h6 = 0LL, .__sn__h7 = 0LL, .__sn__h8 = 0LL, .__sn__i1 = 0LL, .__sn__i2 = 0LL, .__sn__i3 = 0LL, .__sn__i4 = 0LL, .__sn__i5 = 0LL, .__sn__i6 = 0LL, .__sn__i7 = 0LL, .__sn__i8 = 0LL, .__sn__j1 = 0LL, .__sn__j2 = 0LL, .__sn__j3 = 0LL, .__sn__j4 = 0LL, .__sn__j5 = 0LL, .__sn__j6 = 0LL, .__sn__j7 = 0LL, .__sn__j8 = 0LL, .__sn__k1 = 0LL, .__sn__k2 = 0LL, .__sn__k3 = 0LL, .__sn__k4 = 0LL, .__sn__k5 = 0LL, .__sn__k6 = 0LL, .__sn__k7 = 0LL, .__sn__k8 = 0LL, .__sn__l1 = 0LL, .__sn__l2 = 0LL, .__sn__l3 = 0LL, .__sn__l4 = 0LL, .__sn__l5 = 0LL, .__sn__l6 = 0LL, .__sn__l7 = 0LL, .__sn__l8 = 0LL, .__sn__m1 = 0LL, .__sn__m2 = 0LL, .__sn__m3 = 0LL, .__sn__m4 = 0LL, .__sn__m5 = 0LL, .__sn__m6 = 0LL, .__sn__m7 = 0LL, .__sn__m8 = 0LL, .__sn__n1 = 0LL, .__sn__n2 = 0LL, .__sn__n3 = 0LL, .__sn__n4 = 0LL, .__sn__n5 = 0LL, .__sn__n6 = 0LL, .__sn__n7 = 0LL, .__sn__n8 = 0LL, .__sn__o1 = 0LL, .__sn__o2 = 0LL, .__sn__o3 = 0LL, .__sn__o4 = 0LL, .__sn__o5 = 0LL, .__sn__o6 = 0LL, .__sn__o7 = 0LL, .__sn__o8 = 0LL, .__sn__p1 = 0LL, .__sn__p2 = 0LL, .__sn__p3 = 0LL, .__sn__p4 = 0LL, .__sn__p5 = 0LL, .__sn__p6 = 0LL, .__sn__p7 = 0LL };}
+
+
+__sn__LargeData __sn__modifyLargeData(__sn__LargeData __sn__data, long long __sn__off) {
+
+    __sn__LargeData __sn__result = (__sn__LargeData){ .__sn__a1 = sn_add_long(__sn__data.__sn__a1, __sn__off), .__sn__b1 = sn_add_long(__sn__data.__sn__b1, __sn__off), .__sn__c1 = sn_add_long(__sn__data.__sn__c1, __sn__off), .__sn__d1 = sn_add_long(__sn__data.__sn__d1, __sn__off), .__sn__p8 = sn_add_long(__sn__data.__sn__p8, __sn__off), .__sn__a2 = 0LL, .__sn__a3 = 0LL, .__sn__a4 = 0LL, .__sn__a5 = 0LL, .__sn__a6 = 0LL, .__sn__a7 = 0LL, .__sn__a8 = 0LL, .__sn__b2 = 0LL, .__sn__b3 = 0LL, .__sn__b4 = 0LL, .__sn__b5 = 0LL, .__sn__b6 = 0LL, .__sn__b7 = 0LL, .__sn__b8 = 0LL, .__sn__c2 = 0LL, .__sn__c3 = 0LL, .__sn__c4 = 0LL, .__sn__c5 = 0LL, .__sn__c6 = 0LL, .__sn__c7 = 0LL, .__sn__c8 = 0LL, .__sn__d2 = 0LL, .__sn__d3 = 0LL, .__sn__d4 = 0LL, .__sn__d5 = 0LL, .__sn__d6 = 0LL, .__sn__d7 = 0LL, .__sn__d8 = 0LL, .__sn__e1 = 0LL, .__sn__e2 = 0LL, .__sn__e3 = 0LL, .__sn__e4 = 0LL, .__sn__e5 = 0LL, .__sn__e6 = 0LL, .__sn__e7 = 0LL, .__sn__e8 = 0LL, .__sn__f1 = 0LL, .__sn__f2 = 0LL, .__sn__f3 = 0LL, .__sn__f4 = 0LL, .__sn__f5 = 0LL, .__sn__f6 = 0LL, .__sn__f7 = 0LL, .__sn__f8 = 0LL, .__sn__g1 = 0LL, .__sn__g2 = 0LL, .__sn__g3 = 0LL, .__sn__g4 = 0LL, .__sn__g5 = 0LL, .__sn__g6 = 0LL, .__sn__g7 = 0LL, .__sn__g8 = 0LL, .__sn__h1 = 0LL, .__sn__h2 = 0LL, .__sn__h3 = 0LL, .__sn__h4 = 0LL, .__sn__h5 = 0LL, .__sn__h6 = 0LL, .__sn__h7 = 0LL, .__sn__h8 = 0LL, .__sn__i1 = 0LL, .__sn__i2 = 0LL, .__sn__i3 = 0LL, .__sn__i4 = 0LL, .__sn__i5 = 0LL, .__sn__i6 = 0LL, .__sn__i7 = 0LL, .__sn__i8 = 0LL, .__sn__j1 = 0LL, .__sn__j2 = 0LL, .__sn__j3 = 0LL, .__sn__j4 = 0LL, .__sn__j5 = 0LL, .__sn__j6 = 0LL, .__sn__j7 = 0LL, .__sn__j8 = 0LL, .__sn__k1 = 0LL, .__sn__k2 = 0LL, .__sn__k3 = 0LL, .__sn__k4 = 0LL, .__sn__k5 = 0LL, .__sn__k6 = 0LL, .__sn__k7 = 0LL, .__sn__k8 = 0LL, .__sn__l1 = 0LL, .__sn__l2 = 0LL, .__sn__l3 = 0LL, .__sn__l4 = 0LL, .__sn__l5 = 0LL, .__sn__l6 = 0LL, .__sn__l7 = 0LL, .__sn__l8 = 0LL, .__sn__m1 = 0LL, .__sn__m2 = 0LL, .__sn__m3 = 0LL, .__sn__m4 = 0LL, .__sn__m5 = 0LL, .__sn__m6 = 0LL, .__sn__m7 = 0LL, .__sn__m8 = 0LL, .__sn__n1 = 0LL, .__sn__n2 = 0LL, .__sn__n3 = 0LL, .__sn__n4 = 0LL, .__sn__n5 = 0LL, .__sn__n6 = 0LL, .__sn__n7 = 0LL, .__sn__n8 = 0LL, .__sn__o1 = 0LL, .__sn__o2 = 0LL, .__sn__o3 = 0LL, .__sn__o4 = 0LL, .__sn__o5 = 0LL, .__sn__o6 = 0LL, .__sn__o7 = 0LL, .__sn__o8 = 0LL, .__sn__p1 = 0LL, .__sn__p2 = 0LL, .__sn__p3 = 0LL, .__sn__p4 = 0LL, .__sn__p5 = 0LL, .__sn__p6 = 0LL, .__sn__p7 = 0LL };
+
+    return __sn__result;}
+
+
+__sn__MediumData __sn__createMediumData(long long __sn__x, long long __sn__y, long long __sn__z, char * __sn__name) {
+
+    return (__sn__MediumData){ .__sn__x = __sn__x, .__sn__y = __sn__y, .__sn__z = __sn__z, .__sn__name = strdup(__sn__name) };}
+
+
+
+int main() {
+    sn_print("Testing large struct return semantics:\n");
+    
+    __sn__LargeData __sn__large1 = __sn__createLargeData(10LL);
+    if ((__sn__large1.__sn__a1 != 10LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Simple large struct return: FAIL (a1=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__large1.__sn__a1));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__large1.__sn__b1 != 20LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Simple large struct return: FAIL (b1=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__large1.__sn__b1));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__large1.__sn__p8 != 1000LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Simple large struct return: FAIL (p8=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__large1.__sn__p8));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Simple large struct return: PASS\n");
+    
+    __sn__LargeData __sn__large2 = __sn__modifyLargeData(__sn__large1, 5LL);
+    if ((__sn__large2.__sn__a1 != 15LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Modify large struct return: FAIL (a1=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__large2.__sn__a1));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__large2.__sn__b1 != 25LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Modify large struct return: FAIL (b1=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__large2.__sn__b1));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__large2.__sn__p8 != 1005LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Modify large struct return: FAIL (p8=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__large2.__sn__p8));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Modify large struct return: PASS\n");
+    
+    __sn__LargeData __sn__large3 = __sn__modifyLargeData(__sn__createLargeData(1LL), 100LL);
+    if ((__sn__large3.__sn__a1 != 101LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Chained large struct: FAIL (a1=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__large3.__sn__a1));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__large3.__sn__b1 != 102LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Chained large struct: FAIL (b1=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__large3.__sn__b1));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Chained large struct: PASS\n");
+    
+    sn_auto_MediumData __sn__MediumData __sn__med1 = __sn__createMediumData(1LL, 2LL, 3LL, "test");
+    if ((__sn__med1.__sn__x != 1LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Medium struct with string: FAIL (x=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__med1.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((strcmp(__sn__med1.__sn__name, "test") != 0)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Medium struct with string: FAIL (name=");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__med1.__sn__name);
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Medium struct with string: PASS\n");
+    
+    __sn__LargeData __sn__a = __sn__createLargeData(100LL);
+    __sn__LargeData __sn__b = __sn__createLargeData(200LL);
+    __sn__LargeData __sn__c = __sn__createLargeData(300LL);
+    if ((__sn__a.__sn__a1 != 100LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Multiple large structs: FAIL (a.a1=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__a.__sn__a1));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__b.__sn__a1 != 200LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Multiple large structs: FAIL (b.a1=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__b.__sn__a1));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__c.__sn__a1 != 300LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Multiple large structs: FAIL (c.a1=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__a1));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Multiple large struct returns: PASS\n");
+    
+    sn_print("All large struct return tests completed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
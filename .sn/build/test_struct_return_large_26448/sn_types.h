@@ -0,0 +1,775 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: LargeData (as val) */
+typedef struct {
+    long long __sn__a1;
+    long long __sn__a2;
+    long long __sn__a3;
+    long long __sn__a4;
+    long long __sn__a5;
+    long long __sn__a6;
+    long long __sn__a7;
+    long long __sn__a8;
+    long long __sn__b1;
+    long long __sn__b2;
+    long long __sn__b3;
+    long long __sn__b4;
+    long long __sn__b5;
+    long long __sn__b6;
+    long long __sn__b7;
+    long long __sn__b8;
+    long long __sn__c1;
+    long long __sn__c2;
+    long long __sn__c3;
+    long long __sn__c4;
+    long long __sn__c5;
+    long long __sn__c6;
+    long long __sn__c7;
+    long long __sn__c8;
+    long long __sn__d1;
+    long long __sn__d2;
+    long long __sn__d3;
+    long long __sn__d4;
+    long long __sn__d5;
+    long long __sn__d6;
+    long long __sn__d7;
+    long long __sn__d8;
+    long long __sn__e1;
+    long long __sn__e2;
+    long long __sn__e3;
+    long long __sn__e4;
+    long long __sn__e5;
+    long long __sn__e6;
+    long long __sn__e7;
+    long long __sn__e8;
+    long long __sn__f1;
+    long long __sn__f2;
+    long long __sn__f3;
+    long long __sn__f4;
+    long long __sn__f5;
+    long long __sn__f6;
+    long long __sn__f7;
+    long long __sn__f8;
+    long long __sn__g1;
+    long long __sn__g2;
+    long long __sn__g3;
+    long long __sn__g4;
+    long long __sn__g5;
+    long long __sn__g6;
+    long long __sn__g7;
+    long long __sn__g8;
+    long long __sn__h1;
+    long long __sn__h2;
+    long long __sn__h3;
+    long long __sn__h4;
+    long long __sn__h5;
+    long long __sn__h6;
+    long long __sn__h7;
+    long long __sn__h8;
+    long long __sn__i1;
+    long long __sn__i2;
+    long long __sn__i3;
+    long long __sn__i4;
+    long long __sn__i5;
+    long long __sn__i6;
+    long long __sn__i7;
+    long long __sn__i8;
+    long long __sn__j1;
+    long long __sn__j2;
+    long long __sn__j3;
+    long long __sn__j4;
+    long long __sn__j5;
+    long long __sn__j6;
+    long long __sn__j7;
+    long long __sn__j8;
+    long long __sn__k1;
+    long long __sn__k2;
+    long long __sn__k3;
+    long long __sn__k4;
+    long long __sn__k5;
+    long long __sn__k6;
+    long long __sn__k7;
+    long long __sn__k8;
+    long long __sn__l1;
+    long long __sn__l2;
+    long long __sn__l3;
+    long long __sn__l4;
+    long long __sn__l5;
+    long long __sn__l6;
+    long long __sn__l7;
+    long long __sn__l8;
+    long long __sn__m1;
+    long long __sn__m2;
+    long long __sn__m3;
+    long long __sn__m4;
+    long long __sn__m5;
+    long long __sn__m6;
+    long long __sn__m7;
+    long long __sn__m8;
+    long long __sn__n1;
+    long long __sn__n2;
+    long long __sn__n3;
+    long long __sn__n4;
+    long long __sn__n5;
+    long long __sn__n6;
+    long long __sn__n7;
+    long long __sn__n8;
+    long long __sn__o1;
+    long long __sn__o2;
+    long long __sn__o3;
+    long long __sn__o4;
+    long long __sn__o5;
+    long long __sn__o6;
+    long long __sn__o7;
+    long long __sn__o8;
+    long long __sn__p1;
+    long long __sn__p2;
+    long long __sn__p3;
+    long long __sn__p4;
+    long long __sn__p5;
+    long long __sn__p6;
+    long long __sn__p7;
+    long long __sn__p8;
+} __sn__LargeData;
+/* Value operations */
+static inline __sn__LargeData __sn__LargeData_copy(const __sn__LargeData *src) {
+    __sn__LargeData dst;
+    dst.__sn__a1 = src->__sn__a1;
+    dst.__sn__a2 = src->__sn__a2;
+    dst.__sn__a3 = src->__sn__a3;
+    dst.__sn__a4 = src->__sn__a4;
+    dst.__sn__a5 = src->__sn__a5;
+    dst.__sn__a6 = src->__sn__a6;
+    dst.__sn__a7 = src->__sn__a7;
+    dst.__sn__a8 = src->__sn__a8;
+    dst.__sn__b1 = src->__sn__b1;
+    dst.__sn__b2 = src->__sn__b2;
+    dst.__sn__b3 = src->__sn__b3;
+    dst.__sn__b4 = src->__sn__b4;
+    dst.__sn__b5 = src->__sn__b5;
+    dst.__sn__b6 = src->__sn__b6;
+    dst.__sn__b7 = src->__sn__b7;
+    dst.__sn__b8 = src->__sn__b8;
+    dst.__sn__c1 = src->__sn__c1;
+    dst.__sn__c2 = src->__sn__c2;
+    dst.__sn__c3 = src->__sn__c3;
+    dst.__sn__c4 = src->__sn__c4;
+    dst.__sn__c5 = src->__sn__c5;
+    dst.__sn__c6 = src->__sn__c6;
+    dst.__sn__c7 = src->__sn__c7;
+    dst.__sn__c8 = src->__sn__c8;
+    dst.__sn__d1 = src->__sn__d1;
+    dst.__sn__d2 = src->__sn__d2;
+    dst.__sn__d3 = src->__sn__d3;
+    dst.__sn__d4 = src->__sn__d4;
+    dst.__sn__d5 = src->__sn__d5;
+    dst.__sn__d6 = src->__sn__d6;
+    dst.__sn__d7 = src->__sn__d7;
+    dst.__sn__d8 = src->__sn__d8;
+    dst.__sn__e1 = src->__sn__e1;
+    dst.__sn__e2 = src->__sn__e2;
+    dst.__sn__e3 = src->__sn__e3;
+    dst.__sn__e4 = src->__sn__e4;
+    dst.__sn__e5 = src->__sn__e5;
+    dst.__sn__e6 = src->__sn__e6;
+    dst.__sn__e7 = src->__sn__e7;
+    dst.__sn__e8 = src->__sn__e8;
+    dst.__sn__f1 = src->__sn__f1;
+    dst.__sn__f2 = src->__sn__f2;
+    dst.__sn__f3 = src->__sn__f3;
+    dst.__sn__f4 = src->__sn__f4;
+    dst.__sn__f5 = src->__sn__f5;
+    dst.__sn__f6 = src->__sn__f6;
+    dst.__sn__f7 = src->__sn__f7;
+    dst.__sn__f8 = src->__sn__f8;
+    dst.__sn__g1 = src->__sn__g1;
+    dst.__sn__g2 = src->__sn__g2;
+    dst.__sn__g3 = src->__sn__g3;
+    dst.__sn__g4 = src->__sn__g4;
+    dst.__sn__g5 = src->__sn__g5;
+    dst.__sn__g6 = src->__sn__g6;
+    dst.__sn__g7 = src->__sn__g7;
+    dst.__sn__g8 = src->__sn__g8;
+    dst.__sn__h1 = src->__sn__h1;
+    dst.__sn__h2 = src->__sn__h2;
+    dst.__sn__h3 = src->__sn__h3;
+    dst.__sn__h4 = src->__sn__h4;
+    dst.__sn__h5 = src->__sn__h5;
+    dst.__sn__h6 = src->__sn__h6;
+    dst.__sn__h7 = src->__sn__h7;
+    dst.__sn__h8 = src->__sn__h8;
+    dst.__sn__i1 = src->__sn__i1;
+    dst.__sn__i2 = src->__sn__i2;
+    dst.__sn__i3 = src->__sn__i3;
+    dst.__sn__i4 = src->__sn__i4;
+    dst.__sn__i5 = src->__sn__i5;
+    dst.__sn__i6 = src->__sn__i6;
+    dst.__sn__i7 = src->__sn__i7;
+    dst.__sn__i8 = src->__sn__i8;
+    dst.__sn__j1 = src->__sn__j1;
+    dst.__sn__j2 = src->__sn__j2;
+    dst.__sn__j3 = src->__sn__j3;
+    dst.__sn__j4 = src->__sn__j4;
+    dst.__sn__j5 = src->__sn__j5;
+    dst.__sn__j6 = src->__sn__j6;
+    dst.__sn__j7 = src->__sn__j7;
+    dst.__sn__j8 = src->__sn__j8;
+    dst.__sn__k1 = src->__sn__k1;
+    dst.__sn__k2 = src->__sn__k2;
+    dst.__sn__k3 = src->__sn__k3;
+    dst.__sn__k4 = src->__sn__k4;
+    dst.__sn__k5 = src->__sn__k5;
+    dst.__sn__k6 = src->__sn__k6;
+    dst.__sn__k7 = src->__sn__k7;
+    dst.__sn__k8 = src->__sn__k8;
+    dst.__sn__l1 = src->__sn__l1;
+    dst.__sn__l2 = src->__sn__l2;
+    dst.__sn__l3 = src->__sn__l3;
+    dst.__sn__l4 = src->__sn__l4;
+    dst.__sn__l5 = src->__sn__l5;
+    dst.__sn__l6 = src->__sn__l6;
+    dst.__sn__l7 = src->__sn__l7;
+    dst.__sn__l8 = src->__sn__l8;
+    dst.__sn__m1 = src->__sn__m1;
+    dst.__sn__m2 = src->__sn__m2;
+    dst.__sn__m3 = src->__sn__m3;
+    dst.__sn__m4 = src->__sn__m4;
+    dst.__sn__m5 = src->__sn__m5;
+    dst.__sn__m6 = src->__sn__m6;
+    dst.__sn__m7 = src->__sn__m7;
+    dst.__sn__m8 = src->__sn__m8;
+    dst.__sn__n1 = src->__sn__n1;
+    dst.__sn__n2 = src->__sn__n2;
+    dst.__sn__n3 = src->__sn__n3;
+    dst.__sn__n4 = src->__sn__n4;
+    dst.__sn__n5 = src->__sn__n5;
+    dst.__sn__n6 = src->__sn__n6;
+    dst.__sn__n7 = src->__sn__n7;
+    dst.__sn__n8 = src->__sn__n8;
+    dst.__sn__o1 = src->__sn__o1;
+    dst.__sn__o2 = src->__sn__o2;
+    dst.__sn__o3 = src->__sn__o3;
+    dst.__sn__o4 = src->__sn__o4;
+    dst.__sn__o5 = src->__sn__o5;
+    dst.__sn__o6 = src->__sn__o6;
+    dst.__sn__o7 = src->__sn__o7;
+    dst.__sn__o8 = src->__sn__o8;
+    dst.__sn__p1 = src->__sn__p1;
+    dst.__sn__p2 = src->__sn__p2;
+    dst.__sn__p3 = src->__sn__p3;
+    dst.__sn__p4 = src->__sn__p4;
+    dst.__sn__p5 = src->__sn__p5;
+    dst.__sn__p6 = src->__sn__p6;
+    dst.__sn__p7 = src->__sn__p7;
+    dst.__sn__p8 = src->__sn__p8;
+    return dst;
+}
+
+static inline void __sn__LargeData_cleanup(__sn__LargeData *p) {
+
+}
+
+#define sn_auto_LargeData __attribute__((cleanup(__sn__LargeData_cleanup)))
+
+static inline void __sn__LargeData_cleanup_elem(void *p) { __sn__LargeData_cleanup((__sn__LargeData *)p); }
+static inline void __sn__LargeData_copy_into(const void *src, void *dst) { *(__sn__LargeData *)dst = __sn__LargeData_copy((const __sn__LargeData *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__LargeData *__sn__LargeData_alloc(void) {
+    return calloc(1, sizeof(__sn__LargeData));
+}
+
+static inline void __sn__LargeData_release(__sn__LargeData **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_LargeData __attribute__((cleanup(__sn__LargeData_release)))
+
+static inline void __sn__LargeData_release_elem(void *p) { __sn__LargeData_release((__sn__LargeData **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__LargeData_to_string(const __sn__LargeData *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "LargeData { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__b1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__b2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__b3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__b4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__b5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__b6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__b7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__b8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__c1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__c2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__c3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__c4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__c5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__c6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__c7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__c8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "d1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__d1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "d2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__d2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "d3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__d3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "d4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__d4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "d5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__d5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "d6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__d6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "d7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__d7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "d8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__d8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "e1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__e1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "e2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__e2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "e3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__e3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "e4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__e4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "e5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__e5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "e6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__e6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "e7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__e7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "e8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__e8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "f1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__f1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "f2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__f2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "f3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__f3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "f4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__f4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "f5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__f5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "f6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__f6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "f7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__f7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "f8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__f8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__g1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__g2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__g3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__g4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__g5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__g6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__g7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__g8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "h1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__h1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "h2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__h2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "h3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__h3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "h4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__h4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "h5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__h5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "h6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__h6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "h7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__h7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "h8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__h8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "i1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__i1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "i2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__i2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "i3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__i3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "i4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__i4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "i5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__i5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "i6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__i6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "i7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__i7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "i8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__i8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "j1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__j1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "j2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__j2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "j3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__j3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "j4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__j4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "j5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__j5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "j6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__j6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "j7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__j7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "j8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__j8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "k1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__k1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "k2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__k2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "k3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__k3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "k4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__k4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "k5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__k5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "k6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__k6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "k7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__k7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "k8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__k8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "l1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__l1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "l2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__l2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "l3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__l3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "l4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__l4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "l5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__l5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "l6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__l6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "l7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__l7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "l8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__l8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "m1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__m1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "m2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__m2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "m3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__m3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "m4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__m4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "m5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__m5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "m6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__m6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "m7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__m7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "m8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__m8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "n1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__n1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "n2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__n2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "n3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__n3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "n4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__n4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "n5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__n5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "n6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__n6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "n7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__n7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "n8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__n8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "o1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__o1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "o2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__o2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "o3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__o3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "o4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__o4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "o5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__o5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "o6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__o6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "o7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__o7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "o8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__o8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "p1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__p1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "p2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__p2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "p3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__p3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "p4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__p4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "p5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__p5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "p6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__p6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "p7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__p7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "p8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__p8);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MediumData (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+    long long __sn__z;
+    char * __sn__name;
+} __sn__MediumData;
+/* Value operations */
+static inline __sn__MediumData __sn__MediumData_copy(const __sn__MediumData *src) {
+    __sn__MediumData dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    dst.__sn__z = src->__sn__z;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__MediumData_cleanup(__sn__MediumData *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_MediumData __attribute__((cleanup(__sn__MediumData_cleanup)))
+
+static inline void __sn__MediumData_cleanup_elem(void *p) { __sn__MediumData_cleanup((__sn__MediumData *)p); }
+static inline void __sn__MediumData_copy_into(const void *src, void *dst) { *(__sn__MediumData *)dst = __sn__MediumData_copy((const __sn__MediumData *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MediumData *__sn__MediumData_alloc(void) {
+    return calloc(1, sizeof(__sn__MediumData));
+}
+
+static inline void __sn__MediumData_release(__sn__MediumData **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MediumData __attribute__((cleanup(__sn__MediumData_release)))
+
+static inline void __sn__MediumData_release_elem(void *p) { __sn__MediumData_release((__sn__MediumData **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MediumData_to_string(const __sn__MediumData *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MediumData { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "z: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__z);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__LargeData __sn__createLargeData(long long);
+__sn__LargeData __sn__modifyLargeData(__sn__LargeData, long long);
+__sn__MediumData __sn__createMediumData(long long, long long, long long, char *);
+
+
+
+
+#endif
@@ -0,0 +1,221 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Point __sn__createPoint(long long __sn__x, long long __sn__y) {
+
+    return (__sn__Point){ .__sn__x = __sn__x, .__sn__y = __sn__y };}
+
+
+__sn__Color __sn__createColor(unsigned char __sn__r, unsigned char __sn__g, unsigned char __sn__b) {
+
+    return (__sn__Color){ .__sn__r = __sn__r, .__sn__g = __sn__g, .__sn__b = __sn__b };}
+
+
+__sn__Rectangle __sn__createRectangle(long long __sn__x1, long long __sn__y1, long long __sn__x2, long long __sn__y2) {
+
+    __sn__Point __sn__tl = (__sn__Point){ .__sn__x = __sn__x1, .__sn__y = __sn__y1 };
+
+    __sn__Point __sn__br = (__sn__Point){ .__sn__x = __sn__x2, .__sn__y = __sn__y2 };
+
+    __sn__Color __sn__c = (__sn__Color){ .__sn__r = 255LL, .__sn__g = 0LL, .__sn__b = 0LL };
+
+    return (__sn__Rectangle){ .__sn__topLeft = __sn__tl, .__sn__bottomRight = __sn__br, .__sn__color = __sn__c };}
+
+
+__sn__Point __sn__movePoint(__sn__Point __sn__p, long long __sn__dx, long long __sn__dy) {
+
+    return (__sn__Point){ .__sn__x = sn_add_long(__sn__p.__sn__x, __sn__dx), .__sn__y = sn_add_long(__sn__p.__sn__y, __sn__dy) };}
+
+
+__sn__Point __sn__createPointConditional(bool __sn__useOrigin) {
+
+    if (__sn__useOrigin) {
+        return (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };}
+
+    return (__sn__Point){ .__sn__x = 100LL, .__sn__y = 100LL };}
+
+
+__sn__Point __sn__doublePoint(__sn__Point __sn__p) {
+
+    return (__sn__Point){ .__sn__x = sn_mul_long(__sn__p.__sn__x, 2LL), .__sn__y = sn_mul_long(__sn__p.__sn__y, 2LL) };}
+
+
+
+
+int main() {
+    sn_print("Testing small struct return semantics:\n");
+    
+    __sn__Point __sn__p1 = __sn__createPoint(10LL, 20LL);
+    if ((__sn__p1.__sn__x != 10LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Simple struct return: FAIL (x=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p1.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__p1.__sn__y != 20LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Simple struct return: FAIL (y=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p1.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Simple struct return: PASS\n");
+    
+    __sn__Color __sn__c1 = __sn__createColor(255LL, 128LL, 64LL);
+    if ((__sn__c1.__sn__r != 255LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Byte field struct return: FAIL (r=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%u", (unsigned)(__sn__c1.__sn__r));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__c1.__sn__g != 128LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Byte field struct return: FAIL (g=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%u", (unsigned)(__sn__c1.__sn__g));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__c1.__sn__b != 64LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Byte field struct return: FAIL (b=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%u", (unsigned)(__sn__c1.__sn__b));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Byte field struct return: PASS\n");
+    
+    __sn__Rectangle __sn__rect = __sn__createRectangle(0LL, 0LL, 100LL, 100LL);
+    if ((__sn__rect.__sn__topLeft.__sn__x != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Nested struct return: FAIL (topLeft.x=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__rect.__sn__topLeft.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__rect.__sn__bottomRight.__sn__x != 100LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Nested struct return: FAIL (bottomRight.x=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__rect.__sn__bottomRight.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__rect.__sn__color.__sn__r != 255LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Nested struct return: FAIL (color.r=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%u", (unsigned)(__sn__rect.__sn__color.__sn__r));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Nested struct return: PASS\n");
+    
+    __sn__Point __sn__p2 = __sn__createPoint(5LL, 5LL);
+    __sn__Point __sn__p3 = __sn__movePoint(__sn__p2, 10LL, 20LL);
+    if ((__sn__p3.__sn__x != 15LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Struct modify and return: FAIL (x=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p3.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__p3.__sn__y != 25LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Struct modify and return: FAIL (y=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p3.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Struct modify and return: PASS\n");
+    
+    __sn__Point __sn__pOrigin = __sn__createPointConditional(true);
+    __sn__Point __sn__pFar = __sn__createPointConditional(false);
+    if ((__sn__pOrigin.__sn__x != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Conditional struct return: FAIL (origin.x=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__pOrigin.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__pFar.__sn__x != 100LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Conditional struct return: FAIL (far.x=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__pFar.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Conditional struct return: PASS\n");
+    
+    __sn__Point __sn__p4 = __sn__doublePoint(__sn__createPoint(3LL, 4LL));
+    if ((__sn__p4.__sn__x != 6LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Chained struct return: FAIL (x=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p4.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__p4.__sn__y != 8LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Chained struct return: FAIL (y=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p4.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Chained struct return: PASS\n");
+    
+    __sn__Point __sn__p5 = __sn__movePoint(__sn__movePoint(__sn__createPoint(1LL, 1LL), 2LL, 2LL), 3LL, 3LL);
+    if ((__sn__p5.__sn__x != 6LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Multiple chained returns: FAIL (x=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p5.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    if ((__sn__p5.__sn__y != 6LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("Multiple chained returns: FAIL (y=");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p5.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(")\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return 0;}
+    sn_print("Multiple chained returns: PASS\n");
+    
+    sn_print("All small struct return tests completed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,199 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Color (as val) */
+typedef struct {
+    unsigned char __sn__r;
+    unsigned char __sn__g;
+    unsigned char __sn__b;
+} __sn__Color;
+/* Value operations */
+static inline __sn__Color __sn__Color_copy(const __sn__Color *src) {
+    __sn__Color dst;
+    dst.__sn__r = src->__sn__r;
+    dst.__sn__g = src->__sn__g;
+    dst.__sn__b = src->__sn__b;
+    return dst;
+}
+
+static inline void __sn__Color_cleanup(__sn__Color *p) {
+
+}
+
+#define sn_auto_Color __attribute__((cleanup(__sn__Color_cleanup)))
+
+static inline void __sn__Color_cleanup_elem(void *p) { __sn__Color_cleanup((__sn__Color *)p); }
+static inline void __sn__Color_copy_into(const void *src, void *dst) { *(__sn__Color *)dst = __sn__Color_copy((const __sn__Color *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Color *__sn__Color_alloc(void) {
+    return calloc(1, sizeof(__sn__Color));
+}
+
+static inline void __sn__Color_release(__sn__Color **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Color __attribute__((cleanup(__sn__Color_release)))
+
+static inline void __sn__Color_release_elem(void *p) { __sn__Color_release((__sn__Color **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Color_to_string(const __sn__Color *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Color { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "r: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__r);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "g: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__g);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__b);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Rectangle (as val) */
+typedef struct {
+    __sn__Point __sn__topLeft;
+    __sn__Point __sn__bottomRight;
+    __sn__Color __sn__color;
+} __sn__Rectangle;
+/* Value operations */
+static inline __sn__Rectangle __sn__Rectangle_copy(const __sn__Rectangle *src) {
+    __sn__Rectangle dst;
+    dst.__sn__topLeft = __sn__Point_copy(&src->__sn__topLeft);
+    dst.__sn__bottomRight = __sn__Point_copy(&src->__sn__bottomRight);
+    dst.__sn__color = __sn__Color_copy(&src->__sn__color);
+    return dst;
+}
+
+static inline void __sn__Rectangle_cleanup(__sn__Rectangle *p) {
+
+}
+
+#define sn_auto_Rectangle __attribute__((cleanup(__sn__Rectangle_cleanup)))
+
+static inline void __sn__Rectangle_cleanup_elem(void *p) { __sn__Rectangle_cleanup((__sn__Rectangle *)p); }
+static inline void __sn__Rectangle_copy_into(const void *src, void *dst) { *(__sn__Rectangle *)dst = __sn__Rectangle_copy((const __sn__Rectangle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Rectangle *__sn__Rectangle_alloc(void) {
+    return calloc(1, sizeof(__sn__Rectangle));
+}
+
+static inline void __sn__Rectangle_release(__sn__Rectangle **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Rectangle __attribute__((cleanup(__sn__Rectangle_release)))
+
+static inline void __sn__Rectangle_release_elem(void *p) { __sn__Rectangle_release((__sn__Rectangle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Rectangle_to_string(const __sn__Rectangle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Rectangle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "topLeft: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__topLeft); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "bottomRight: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__bottomRight); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "color: ");
+    { char *__fs__ = __sn__Color_to_string(&p->__sn__color); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Point __sn__createPoint(long long, long long);
+__sn__Color __sn__createColor(unsigned char, unsigned char, unsigned char);
+__sn__Rectangle __sn__createRectangle(long long, long long, long long, long long);
+__sn__Point __sn__movePoint(__sn__Point, long long, long long);
+__sn__Point __sn__createPointConditional(bool);
+__sn__Point __sn__doublePoint(__sn__Point);
+
+
+
+
+#endif
@@ -0,0 +1,42 @@
+#include "sn_types.h"
+__sn__Tracker * tracker_create(long long);
+long long tracker_alive_count();
+
+
+
+
+__sn__Output __sn__build() {
+
+    return (__sn__Output){ .__sn__primary = tracker_create(1LL), .__sn__secondary = tracker_create(2LL) };}
+
+
+void __sn__run() {
+
+    sn_auto_Tracker __sn__Tracker * __sn__p = ({ sn_auto_Output __sn__Output __mtmp_0__ = __sn__build(); __sn__Tracker_retain(__mtmp_0__.__sn__primary); });
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("inside run: p.id=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p->__sn__id));
+            sn_auto_str char *__is_p2__ = sn_strdup(" alive=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(tracker_alive_count()));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+}
+
+
+
+int main() {
+    __sn__run();
+    
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("leaked rvalue struct fields: alive=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(tracker_alive_count()));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_assert((tracker_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+    sn_println("test_struct_rvalue_member_leak: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,118 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Tracker (native, as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__id;
+} __sn__Tracker;
+
+
+static inline __sn__Tracker *__sn__Tracker__new(void) {
+    __sn__Tracker *p = calloc(1, sizeof(__sn__Tracker));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Tracker *__sn__Tracker_retain(__sn__Tracker *p) {
+    if (p) p->__rc__++;
+    return p;
+}
+
+void tracker_dispose(__sn__Tracker *);
+static inline void __sn__Tracker_release(__sn__Tracker **p) {
+    if (*p && --(*p)->__rc__ == 0) {
+        tracker_dispose(*p);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+
+#define sn_auto_Tracker __attribute__((cleanup(__sn__Tracker_release)))
+#define sn_auto_ref_Tracker __attribute__((cleanup(__sn__Tracker_release)))
+
+static inline void __sn__Tracker_release_elem(void *p) { __sn__Tracker_release((__sn__Tracker **)p); }
+static inline void __sn__Tracker_retain_into(const void *src, void *dst) { *(__sn__Tracker **)dst = __sn__Tracker_retain(*(__sn__Tracker *const *)src); }
+
+/* Struct: Output (as val) */
+typedef struct {
+    __sn__Tracker * __sn__primary;
+    __sn__Tracker * __sn__secondary;
+} __sn__Output;
+/* Value operations */
+static inline __sn__Output __sn__Output_copy(const __sn__Output *src) {
+    __sn__Output dst;
+    dst.__sn__primary = __sn__Tracker_retain(src->__sn__primary);
+    dst.__sn__secondary = __sn__Tracker_retain(src->__sn__secondary);
+    return dst;
+}
+
+static inline void __sn__Output_cleanup(__sn__Output *p) {
+    __sn__Tracker_release(&p->__sn__primary);
+    __sn__Tracker_release(&p->__sn__secondary);
+
+}
+
+#define sn_auto_Output __attribute__((cleanup(__sn__Output_cleanup)))
+
+static inline void __sn__Output_cleanup_elem(void *p) { __sn__Output_cleanup((__sn__Output *)p); }
+static inline void __sn__Output_copy_into(const void *src, void *dst) { *(__sn__Output *)dst = __sn__Output_copy((const __sn__Output *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Output *__sn__Output_alloc(void) {
+    return calloc(1, sizeof(__sn__Output));
+}
+
+static inline void __sn__Output_release(__sn__Output **p) {
+    if (*p) {
+        __sn__Tracker_release(&(*p)->__sn__primary);
+        __sn__Tracker_release(&(*p)->__sn__secondary);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Output __attribute__((cleanup(__sn__Output_release)))
+
+static inline void __sn__Output_release_elem(void *p) { __sn__Output_release((__sn__Output **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Output_to_string(const __sn__Output *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Output { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "primary: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "<Tracker %p>", (void *)p->__sn__primary);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "secondary: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "<Tracker %p>", (void *)p->__sn__secondary);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Output __sn__build();
+void __sn__run();
+
+void tracker_dispose(__sn__Tracker *);
+
+
+
+#endif
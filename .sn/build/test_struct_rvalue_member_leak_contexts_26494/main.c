@@ -0,0 +1,113 @@
+#include "sn_types.h"
+__sn__Tracker * tracker_create(long long);
+long long tracker_alive_count();
+void takes_tracker(__sn__Tracker *);
+
+
+
+
+__sn__Output __sn__build() {
+
+    return (__sn__Output){ .__sn__primary = tracker_create(1LL), .__sn__secondary = tracker_create(2LL) };}
+
+
+void __sn__ctx_arg() {
+
+    sn_auto_Tracker __sn__Tracker * __sn____chain_tmp_0 = ({ sn_auto_Output __sn__Output __mtmp_0__ = __sn__build(); __sn__Tracker_retain(__mtmp_0__.__sn__primary); });
+
+    takes_tracker(__sn____chain_tmp_0);
+    
+}
+
+
+__sn__Tracker * __sn__ctx_return_helper() {
+
+    return ({ sn_auto_Output __sn__Output __mtmp_1__ = __sn__build(); __sn__Tracker_retain(__mtmp_1__.__sn__primary); });}
+
+
+void __sn__ctx_return() {
+
+    sn_auto_Tracker __sn__Tracker * __sn__t = __sn__ctx_return_helper();
+
+    sn_assert((__sn__t->__sn__id == 1LL), "ctx_return: id mismatch");
+    
+}
+
+
+void __sn__ctx_field() {
+
+    sn_auto_Wrapper __sn__Wrapper __sn__w = (__sn__Wrapper){ .__sn__inner = ({ sn_auto_Output __sn__Output __mtmp_2__ = __sn__build(); __sn__Tracker_retain(__mtmp_2__.__sn__primary); }) };
+
+    sn_assert((__sn__w.__sn__inner->__sn__id == 1LL), "ctx_field: id mismatch");
+    
+}
+
+
+void __sn__ctx_chain() {
+
+    sn_auto_Tracker __sn__Tracker * __sn____chain_tmp_1 = ({ sn_auto_Output __sn__Output __mtmp_3__ = __sn__build(); __sn__Tracker_retain(__mtmp_3__.__sn__primary); });
+
+    long long __sn__x = tracker_get_id(__sn____chain_tmp_1);
+
+    sn_assert((__sn__x == 1LL), "ctx_chain: id mismatch");
+    
+}
+
+
+void __sn__ctx_reassign() {
+
+    sn_auto_Tracker __sn__Tracker * __sn__t = tracker_create(99LL);
+
+    ({
+        __sn__Tracker *__old__ = __sn__t;
+        __sn__t = ({ sn_auto_Output __sn__Output __mtmp_4__ = __sn__build(); __sn__Tracker_retain(__mtmp_4__.__sn__primary); });
+        __sn__Tracker_release(&__old__);
+        __sn__t;
+    });
+    
+
+    sn_assert((__sn__t->__sn__id == 1LL), "ctx_reassign: id mismatch");
+    
+}
+
+
+void __sn__check(char * __sn__label) {
+
+    ({ char *__assert_msg__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__label);
+            sn_auto_str char *__is_p1__ = sn_strdup(": leaked, alive=");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(tracker_alive_count()));
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_assert((tracker_alive_count() == 0LL), __assert_msg__); free(__assert_msg__); (void)0; });
+    
+}
+
+
+
+
+int main() {
+    __sn__ctx_arg();
+    
+    __sn__check("ctx_arg");
+    
+    __sn__ctx_return();
+    
+    __sn__check("ctx_return");
+    
+    __sn__ctx_field();
+    
+    __sn__check("ctx_field");
+    
+    __sn__ctx_chain();
+    
+    __sn__check("ctx_chain");
+    
+    __sn__ctx_reassign();
+    
+    __sn__check("ctx_reassign");
+    
+    sn_println("test_struct_rvalue_member_leak_contexts: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
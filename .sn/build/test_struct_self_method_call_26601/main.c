@@ -0,0 +1,360 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__Calculator_getValue(__sn__Calculator *__sn__self) {
+
+    return __sn__self->__sn__value;}
+
+char * __sn__Calculator_getLabel(__sn__Calculator *__sn__self) {
+
+    return strdup(__sn__self->__sn__label);}
+
+long long __sn__Calculator_doubled(__sn__Calculator *__sn__self) {
+
+    return sn_mul_long(__sn__Calculator_getValue(__sn__self), 2LL);}
+
+long long __sn__Calculator_quadrupled(__sn__Calculator *__sn__self) {
+
+    return sn_mul_long(__sn__Calculator_doubled(__sn__self), 2LL);}
+
+char * __sn__Calculator_describe(__sn__Calculator *__sn__self) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = __sn__Calculator_getLabel(__sn__self);
+            sn_auto_str char *__is_p1__ = sn_strdup(": ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__Calculator_getValue(__sn__self)));
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });}
+
+char * __sn__Calculator_describeDoubled(__sn__Calculator *__sn__self) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = __sn__Calculator_getLabel(__sn__self);
+            sn_auto_str char *__is_p1__ = sn_strdup(": ");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__Calculator_doubled(__sn__self)));
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        });}
+
+
+char * __sn__TextProcessor_getText(__sn__TextProcessor *__sn__self) {
+
+    return strdup(__sn__self->__sn__text);}
+
+char * __sn__TextProcessor_trimmed(__sn__TextProcessor *__sn__self) {
+
+    return __sn___trim(&__sn__self->__sn__text);}
+
+char * __sn__TextProcessor_upper(__sn__TextProcessor *__sn__self) {
+
+    return __sn___toUpper(&__sn__self->__sn__text);}
+
+char * __sn__TextProcessor_trimmedUpper(__sn__TextProcessor *__sn__self) {
+
+    sn_auto_str char * __sn____chain_tmp_4 = __sn__TextProcessor_trimmed(__sn__self);
+
+    return __sn___toUpper(&__sn____chain_tmp_4);}
+
+long long __sn__TextProcessor_getLength(__sn__TextProcessor *__sn__self) {
+
+    return sn_str_length(__sn__self->__sn__text);}
+
+bool __sn__TextProcessor_isEmpty(__sn__TextProcessor *__sn__self) {
+
+    return (__sn__TextProcessor_getLength(__sn__self) == 0LL);}
+
+bool __sn__TextProcessor_isNotEmpty(__sn__TextProcessor *__sn__self) {
+
+    return (!__sn__TextProcessor_isEmpty(__sn__self));}
+
+char * __sn__TextProcessor_describe(__sn__TextProcessor *__sn__self) {
+
+    if (__sn__TextProcessor_isNotEmpty(__sn__self)) {
+        return ({
+                sn_auto_str char *__is_p0__ = sn_strdup("TextProcessor(");
+                sn_auto_str char *__is_p1__ = __sn__TextProcessor_trimmedUpper(__sn__self);
+                sn_auto_str char *__is_p2__ = sn_strdup(")");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            });}
+
+    return strdup("TextProcessor(empty)");}
+
+
+char * __sn__Versioned_getTag(__sn__Versioned *__sn__self) {
+
+    return strdup(__sn__self->__sn__tag);}
+
+long long __sn__Versioned_compare(__sn__Versioned *__sn__self, __sn__Versioned *__sn__other) {
+
+    if (sn_lt_long(__sn__self->__sn__major, (*__sn__other).__sn__major)) {
+        return (-1LL);}
+
+    if (sn_gt_long(__sn__self->__sn__major, (*__sn__other).__sn__major)) {
+        return 1LL;}
+
+    if (sn_lt_long(__sn__self->__sn__minor, (*__sn__other).__sn__minor)) {
+        return (-1LL);}
+
+    if (sn_gt_long(__sn__self->__sn__minor, (*__sn__other).__sn__minor)) {
+        return 1LL;}
+
+    if (sn_lt_long(__sn__self->__sn__patch, (*__sn__other).__sn__patch)) {
+        return (-1LL);}
+
+    if (sn_gt_long(__sn__self->__sn__patch, (*__sn__other).__sn__patch)) {
+        return 1LL;}
+
+    return 0LL;}
+
+bool __sn__Versioned_eq(__sn__Versioned *__sn__self, __sn__Versioned *__sn__other) {
+
+    return (__sn__Versioned_compare(__sn__self, &(*__sn__other)) == 0LL);}
+
+bool __sn__Versioned_gt(__sn__Versioned *__sn__self, __sn__Versioned *__sn__other) {
+
+    return (__sn__Versioned_compare(__sn__self, &(*__sn__other)) == 1LL);}
+
+bool __sn__Versioned_lt(__sn__Versioned *__sn__self, __sn__Versioned *__sn__other) {
+
+    return (__sn__Versioned_compare(__sn__self, &(*__sn__other)) == (-1LL));}
+
+__sn__Versioned __sn__Versioned_bumpMajor(__sn__Versioned *__sn__self) {
+
+    sn_auto_Versioned __sn__Versioned __sn__result = (__sn__Versioned){ .__sn__major = sn_add_long(__sn__self->__sn__major, 1LL), .__sn__minor = 0LL, .__sn__patch = 0LL, .__sn__tag = strdup("") };
+
+    {
+        __sn__Versioned __ret__ = __sn__result;
+        memset(&__sn__result, 0, sizeof(__sn__result));
+        return __ret__;
+    }}
+
+__sn__Versioned __sn__Versioned_bumpMinor(__sn__Versioned *__sn__self) {
+
+    sn_auto_Versioned __sn__Versioned __sn__result = (__sn__Versioned){ .__sn__major = __sn__self->__sn__major, .__sn__minor = sn_add_long(__sn__self->__sn__minor, 1LL), .__sn__patch = 0LL, .__sn__tag = strdup("") };
+
+    {
+        __sn__Versioned __ret__ = __sn__result;
+        memset(&__sn__result, 0, sizeof(__sn__result));
+        return __ret__;
+    }}
+
+char * __sn__Versioned_toString(__sn__Versioned *__sn__self) {
+
+    sn_auto_str char * __sn__base = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__major));
+            sn_auto_str char *__is_p1__ = sn_strdup(".");
+            sn_auto_str char *__is_p2__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__minor));
+            sn_auto_str char *__is_p3__ = sn_strdup(".");
+            sn_auto_str char *__is_p4__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__patch));
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        });
+
+    if (({char *__sct0__=__sn__Versioned_getTag(__sn__self);bool __scr__=(strcmp(__sct0__,"")!=0);free(__sct0__);__scr__;})) {
+        return ({
+                sn_auto_str char *__is_p0__ = sn_strdup(__sn__base);
+                sn_auto_str char *__is_p1__ = sn_strdup("-");
+                sn_auto_str char *__is_p2__ = __sn__Versioned_getTag(__sn__self);
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            });}
+
+    {
+        char * __ret__ = __sn__base;
+        __sn__base = NULL;
+        return __ret__;
+    }}
+
+int main() {
+    sn_auto_Calculator __sn__Calculator __sn__calc = (__sn__Calculator){ .__sn__value = 5LL, .__sn__label = strdup("calc") };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("getValue: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Calculator_getValue(&__sn__calc)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("doubled: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Calculator_doubled(&__sn__calc)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("quadrupled: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__Calculator_quadrupled(&__sn__calc)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("describe: ");
+            sn_auto_str char *__is_p1__ = __sn__Calculator_describe(&__sn__calc);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("describeDoubled: ");
+            sn_auto_str char *__is_p1__ = __sn__Calculator_describeDoubled(&__sn__calc);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_TextProcessor __sn__TextProcessor __sn__tp = (__sn__TextProcessor){ .__sn__text = strdup("  hello  ") };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("getText: [");
+            sn_auto_str char *__is_p1__ = __sn__TextProcessor_getText(&__sn__tp);
+            sn_auto_str char *__is_p2__ = sn_strdup("]\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("trimmed: [");
+            sn_auto_str char *__is_p1__ = __sn__TextProcessor_trimmed(&__sn__tp);
+            sn_auto_str char *__is_p2__ = sn_strdup("]\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("upper: [");
+            sn_auto_str char *__is_p1__ = __sn__TextProcessor_upper(&__sn__tp);
+            sn_auto_str char *__is_p2__ = sn_strdup("]\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("trimmedUpper: [");
+            sn_auto_str char *__is_p1__ = __sn__TextProcessor_trimmedUpper(&__sn__tp);
+            sn_auto_str char *__is_p2__ = sn_strdup("]\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("getLength: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__TextProcessor_getLength(&__sn__tp)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isEmpty: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__TextProcessor_isEmpty(&__sn__tp)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("isNotEmpty: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__TextProcessor_isNotEmpty(&__sn__tp)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("describe: ");
+            sn_auto_str char *__is_p1__ = __sn__TextProcessor_describe(&__sn__tp);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_TextProcessor __sn__TextProcessor __sn__empty = (__sn__TextProcessor){ .__sn__text = strdup("") };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("empty.isEmpty: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__TextProcessor_isEmpty(&__sn__empty)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("empty.describe: ");
+            sn_auto_str char *__is_p1__ = __sn__TextProcessor_describe(&__sn__empty);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Versioned __sn__Versioned __sn__v1 = (__sn__Versioned){ .__sn__major = 1LL, .__sn__minor = 2LL, .__sn__patch = 3LL, .__sn__tag = strdup("beta") };
+    sn_auto_Versioned __sn__Versioned __sn__v2 = (__sn__Versioned){ .__sn__major = 2LL, .__sn__minor = 0LL, .__sn__patch = 0LL, .__sn__tag = strdup("") };
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.toString: ");
+            sn_auto_str char *__is_p1__ = __sn__Versioned_toString(&__sn__v1);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v2.toString: ");
+            sn_auto_str char *__is_p1__ = __sn__Versioned_toString(&__sn__v2);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.lt(v2): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__Versioned_lt(&__sn__v1, &__sn__v2)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v2.gt(v1): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__Versioned_gt(&__sn__v2, &__sn__v1)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.eq(v1): ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__Versioned_eq(&__sn__v1, &__sn__v1)) ? "true" : "false");
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Versioned __sn__Versioned __sn__bumped = __sn__Versioned_bumpMajor(&__sn__v1);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("bumped: ");
+            sn_auto_str char *__is_p1__ = __sn__Versioned_toString(&__sn__bumped);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Versioned __sn__Versioned __sn__bumpedMinor = __sn__Versioned_bumpMinor(&__sn__v1);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("bumpedMinor: ");
+            sn_auto_str char *__is_p1__ = __sn__Versioned_toString(&__sn__bumpedMinor);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("--- Method chaining ---\n");
+    
+    sn_auto_Versioned __sn__Versioned __sn____chain_tmp_0 = __sn__Versioned_bumpMajor(&__sn__v1);
+    sn_auto_Versioned __sn__Versioned __sn__chained1 = __sn__Versioned_bumpMinor(&__sn____chain_tmp_0);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.bumpMajor().bumpMinor(): ");
+            sn_auto_str char *__is_p1__ = __sn__Versioned_toString(&__sn__chained1);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Versioned __sn__Versioned __sn____chain_tmp_1 = __sn__Versioned_bumpMinor(&__sn__v1);
+    sn_auto_Versioned __sn__Versioned __sn____chain_tmp_2 = __sn__Versioned_bumpMinor(&__sn____chain_tmp_1);
+    sn_auto_Versioned __sn__Versioned __sn__chained2 = __sn__Versioned_bumpMinor(&__sn____chain_tmp_2);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.bumpMinor()x3: ");
+            sn_auto_str char *__is_p1__ = __sn__Versioned_toString(&__sn__chained2);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_Versioned __sn__Versioned __sn____chain_tmp_3 = __sn__Versioned_bumpMajor(&__sn__v1);
+    sn_auto_Versioned __sn__Versioned __sn__chained3 = __sn__Versioned_bumpMajor(&__sn____chain_tmp_3);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("v1.bumpMajor()x2: ");
+            sn_auto_str char *__is_p1__ = __sn__Versioned_toString(&__sn__chained3);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
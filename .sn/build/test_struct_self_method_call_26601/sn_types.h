@@ -0,0 +1,216 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Calculator (as val) */
+typedef struct {
+    long long __sn__value;
+    char * __sn__label;
+} __sn__Calculator;
+/* Value operations */
+static inline __sn__Calculator __sn__Calculator_copy(const __sn__Calculator *src) {
+    __sn__Calculator dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    return dst;
+}
+
+static inline void __sn__Calculator_cleanup(__sn__Calculator *p) {
+    free(p->__sn__label);
+
+}
+
+#define sn_auto_Calculator __attribute__((cleanup(__sn__Calculator_cleanup)))
+
+static inline void __sn__Calculator_cleanup_elem(void *p) { __sn__Calculator_cleanup((__sn__Calculator *)p); }
+static inline void __sn__Calculator_copy_into(const void *src, void *dst) { *(__sn__Calculator *)dst = __sn__Calculator_copy((const __sn__Calculator *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Calculator *__sn__Calculator_alloc(void) {
+    return calloc(1, sizeof(__sn__Calculator));
+}
+
+static inline void __sn__Calculator_release(__sn__Calculator **p) {
+    if (*p) {
+        free((*p)->__sn__label);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Calculator __attribute__((cleanup(__sn__Calculator_release)))
+
+static inline void __sn__Calculator_release_elem(void *p) { __sn__Calculator_release((__sn__Calculator **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Calculator_to_string(const __sn__Calculator *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Calculator { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: TextProcessor (as val) */
+typedef struct {
+    char * __sn__text;
+} __sn__TextProcessor;
+/* Value operations */
+static inline __sn__TextProcessor __sn__TextProcessor_copy(const __sn__TextProcessor *src) {
+    __sn__TextProcessor dst;
+    dst.__sn__text = src->__sn__text ? strdup(src->__sn__text) : NULL;
+    return dst;
+}
+
+static inline void __sn__TextProcessor_cleanup(__sn__TextProcessor *p) {
+    free(p->__sn__text);
+
+}
+
+#define sn_auto_TextProcessor __attribute__((cleanup(__sn__TextProcessor_cleanup)))
+
+static inline void __sn__TextProcessor_cleanup_elem(void *p) { __sn__TextProcessor_cleanup((__sn__TextProcessor *)p); }
+static inline void __sn__TextProcessor_copy_into(const void *src, void *dst) { *(__sn__TextProcessor *)dst = __sn__TextProcessor_copy((const __sn__TextProcessor *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__TextProcessor *__sn__TextProcessor_alloc(void) {
+    return calloc(1, sizeof(__sn__TextProcessor));
+}
+
+static inline void __sn__TextProcessor_release(__sn__TextProcessor **p) {
+    if (*p) {
+        free((*p)->__sn__text);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_TextProcessor __attribute__((cleanup(__sn__TextProcessor_release)))
+
+static inline void __sn__TextProcessor_release_elem(void *p) { __sn__TextProcessor_release((__sn__TextProcessor **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__TextProcessor_to_string(const __sn__TextProcessor *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "TextProcessor { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "text: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__text ? p->__sn__text : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Versioned (as val) */
+typedef struct {
+    long long __sn__major;
+    long long __sn__minor;
+    long long __sn__patch;
+    char * __sn__tag;
+} __sn__Versioned;
+/* Value operations */
+static inline __sn__Versioned __sn__Versioned_copy(const __sn__Versioned *src) {
+    __sn__Versioned dst;
+    dst.__sn__major = src->__sn__major;
+    dst.__sn__minor = src->__sn__minor;
+    dst.__sn__patch = src->__sn__patch;
+    dst.__sn__tag = src->__sn__tag ? strdup(src->__sn__tag) : NULL;
+    return dst;
+}
+
+static inline void __sn__Versioned_cleanup(__sn__Versioned *p) {
+    free(p->__sn__tag);
+
+}
+
+#define sn_auto_Versioned __attribute__((cleanup(__sn__Versioned_cleanup)))
+
+static inline void __sn__Versioned_cleanup_elem(void *p) { __sn__Versioned_cleanup((__sn__Versioned *)p); }
+static inline void __sn__Versioned_copy_into(const void *src, void *dst) { *(__sn__Versioned *)dst = __sn__Versioned_copy((const __sn__Versioned *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Versioned *__sn__Versioned_alloc(void) {
+    return calloc(1, sizeof(__sn__Versioned));
+}
+
+static inline void __sn__Versioned_release(__sn__Versioned **p) {
+    if (*p) {
+        free((*p)->__sn__tag);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Versioned __attribute__((cleanup(__sn__Versioned_release)))
+
+static inline void __sn__Versioned_release_elem(void *p) { __sn__Versioned_release((__sn__Versioned **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Versioned_to_string(const __sn__Versioned *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Versioned { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "major: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__major);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "minor: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__minor);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "patch: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__patch);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "tag: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__tag ? p->__sn__tag : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+long long __sn__Calculator_getValue(__sn__Calculator *);
+char * __sn__Calculator_getLabel(__sn__Calculator *);
+long long __sn__Calculator_doubled(__sn__Calculator *);
+long long __sn__Calculator_quadrupled(__sn__Calculator *);
+char * __sn__Calculator_describe(__sn__Calculator *);
+char * __sn__Calculator_describeDoubled(__sn__Calculator *);
+char * __sn__TextProcessor_getText(__sn__TextProcessor *);
+char * __sn__TextProcessor_trimmed(__sn__TextProcessor *);
+char * __sn__TextProcessor_upper(__sn__TextProcessor *);
+char * __sn__TextProcessor_trimmedUpper(__sn__TextProcessor *);
+long long __sn__TextProcessor_getLength(__sn__TextProcessor *);
+bool __sn__TextProcessor_isEmpty(__sn__TextProcessor *);
+bool __sn__TextProcessor_isNotEmpty(__sn__TextProcessor *);
+char * __sn__TextProcessor_describe(__sn__TextProcessor *);
+char * __sn__Versioned_getTag(__sn__Versioned *);
+long long __sn__Versioned_compare(__sn__Versioned *, __sn__Versioned *);
+bool __sn__Versioned_eq(__sn__Versioned *, __sn__Versioned *);
+bool __sn__Versioned_gt(__sn__Versioned *, __sn__Versioned *);
+bool __sn__Versioned_lt(__sn__Versioned *, __sn__Versioned *);
+__sn__Versioned __sn__Versioned_bumpMajor(__sn__Versioned *);
+__sn__Versioned __sn__Versioned_bumpMinor(__sn__Versioned *);
+char * __sn__Versioned_toString(__sn__Versioned *);
+
+
+
+#endif
@@ -0,0 +1,285 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_sizeof_primitive_types() {
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(int) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(long long)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(long) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(long long)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(double) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(double)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(float) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(float)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(byte) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(unsigned char)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(bool) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(bool)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(char) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(char)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(int32) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(int32_t)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_sizeof_struct_types() {
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(Point) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__Point)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(Rectangle) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__Rectangle)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(SmallStruct) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__SmallStruct)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_sizeof_expressions() {
+
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 1.0, .__sn__y = 2.0 };
+
+    __sn__Rectangle __sn__r = (__sn__Rectangle){ .__sn__origin = (__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }, .__sn__width = 10.0, .__sn__height = 20.0 };
+
+    __sn__SmallStruct __sn__s = (__sn__SmallStruct){ .__sn__a = 42LL, .__sn__b = (unsigned char)128, .__sn__c = true };
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof p = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__Point)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof r = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__Rectangle)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof s = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__SmallStruct)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(p) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__Point)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(r) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__Rectangle)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_struct_equality() {
+
+    __sn__Point __sn__p1 = (__sn__Point){ .__sn__x = 1.0, .__sn__y = 2.0 };
+
+    __sn__Point __sn__p2 = (__sn__Point){ .__sn__x = 1.0, .__sn__y = 2.0 };
+
+    __sn__Point __sn__p3 = (__sn__Point){ .__sn__x = 3.0, .__sn__y = 4.0 };
+
+    if (__sn__Point_op_eq(&__sn__p1, __sn__p2)) {
+        sn_print("p1 == p2: true (expected)\n");
+        
+    } else {
+        sn_print("p1 == p2: false (unexpected!)\n");
+        
+    }
+
+    if (__sn__Point_op_eq(&__sn__p1, __sn__p3)) {
+        sn_print("p1 == p3: true (unexpected!)\n");
+        
+    } else {
+        sn_print("p1 == p3: false (expected)\n");
+        
+    }
+
+    if ((!__sn__Point_op_eq(&__sn__p1, __sn__p3))) {
+        sn_print("p1 != p3: true (expected)\n");
+        
+    } else {
+        sn_print("p1 != p3: false (unexpected!)\n");
+        
+    }
+
+    if ((!__sn__Point_op_eq(&__sn__p1, __sn__p2))) {
+        sn_print("p1 != p2: true (unexpected!)\n");
+        
+    } else {
+        sn_print("p1 != p2: false (expected)\n");
+        
+    }
+}
+
+
+void __sn__test_nested_struct_equality() {
+
+    __sn__Rectangle __sn__r1 = (__sn__Rectangle){ .__sn__origin = (__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }, .__sn__width = 10.0, .__sn__height = 20.0 };
+
+    __sn__Rectangle __sn__r2 = (__sn__Rectangle){ .__sn__origin = (__sn__Point){ .__sn__x = 0.0, .__sn__y = 0.0 }, .__sn__width = 10.0, .__sn__height = 20.0 };
+
+    __sn__Rectangle __sn__r3 = (__sn__Rectangle){ .__sn__origin = (__sn__Point){ .__sn__x = 1.0, .__sn__y = 1.0 }, .__sn__width = 10.0, .__sn__height = 20.0 };
+
+    if (__sn__Rectangle_op_eq(&__sn__r1, __sn__r2)) {
+        sn_print("r1 == r2: true (expected)\n");
+        
+    } else {
+        sn_print("r1 == r2: false (unexpected!)\n");
+        
+    }
+
+    if ((!__sn__Rectangle_op_eq(&__sn__r1, __sn__r3))) {
+        sn_print("r1 != r3: true (expected)\n");
+        
+    } else {
+        sn_print("r1 != r3: false (unexpected!)\n");
+        
+    }
+}
+
+
+void __sn__test_sizeof_in_expressions() {
+
+    long long __sn__total = sn_add_long(sizeof(__sn__Point), sizeof(__sn__Rectangle));
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sizeof(Point) + sizeof(Rectangle) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__total));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    if (sn_gt_long(sizeof(__sn__Point), 8LL)) {
+        sn_print("sizeof(Point) > 8\n");
+        
+    } else {
+        sn_print("sizeof(Point) <= 8\n");
+        
+    }
+}
+
+
+bool __sn__Point_op_eq(__sn__Point *__sn__self, __sn__Point __sn__other) {
+
+    return ((__sn__self->__sn__x == __sn__other.__sn__x) && (__sn__self->__sn__y == __sn__other.__sn__y));}
+
+
+bool __sn__Rectangle_op_eq(__sn__Rectangle *__sn__self, __sn__Rectangle __sn__other) {
+
+    return ((((__sn__self->__sn__origin.__sn__x == __sn__other.__sn__origin.__sn__x) && (__sn__self->__sn__origin.__sn__y == __sn__other.__sn__origin.__sn__y)) && (__sn__self->__sn__width == __sn__other.__sn__width)) && (__sn__self->__sn__height == __sn__other.__sn__height));}
+
+
+int main() {
+    sn_print("=== Testing sizeof operator ===\n");
+    
+    __sn__test_sizeof_primitive_types();
+    
+    sn_print("\n");
+    
+    __sn__test_sizeof_struct_types();
+    
+    sn_print("\n");
+    
+    __sn__test_sizeof_expressions();
+    
+    sn_print("\n");
+    
+    __sn__test_sizeof_in_expressions();
+    
+    sn_print("\n");
+    
+    sn_print("=== Testing struct equality ===\n");
+    
+    __sn__test_struct_equality();
+    
+    sn_print("\n");
+    
+    __sn__test_nested_struct_equality();
+    
+    sn_print("\n");
+    
+    sn_print("All tests completed.\n");
+    
+    fflush(stdout);
+    return 0;
+}
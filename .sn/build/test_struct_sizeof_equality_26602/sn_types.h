@@ -0,0 +1,201 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Rectangle (as val) */
+typedef struct {
+    __sn__Point __sn__origin;
+    double __sn__width;
+    double __sn__height;
+} __sn__Rectangle;
+/* Value operations */
+static inline __sn__Rectangle __sn__Rectangle_copy(const __sn__Rectangle *src) {
+    __sn__Rectangle dst;
+    dst.__sn__origin = __sn__Point_copy(&src->__sn__origin);
+    dst.__sn__width = src->__sn__width;
+    dst.__sn__height = src->__sn__height;
+    return dst;
+}
+
+static inline void __sn__Rectangle_cleanup(__sn__Rectangle *p) {
+
+}
+
+#define sn_auto_Rectangle __attribute__((cleanup(__sn__Rectangle_cleanup)))
+
+static inline void __sn__Rectangle_cleanup_elem(void *p) { __sn__Rectangle_cleanup((__sn__Rectangle *)p); }
+static inline void __sn__Rectangle_copy_into(const void *src, void *dst) { *(__sn__Rectangle *)dst = __sn__Rectangle_copy((const __sn__Rectangle *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Rectangle *__sn__Rectangle_alloc(void) {
+    return calloc(1, sizeof(__sn__Rectangle));
+}
+
+static inline void __sn__Rectangle_release(__sn__Rectangle **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Rectangle __attribute__((cleanup(__sn__Rectangle_release)))
+
+static inline void __sn__Rectangle_release_elem(void *p) { __sn__Rectangle_release((__sn__Rectangle **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Rectangle_to_string(const __sn__Rectangle *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Rectangle { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "origin: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__origin); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "width: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__width);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "height: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__height);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: SmallStruct (as val) */
+typedef struct {
+    int32_t __sn__a;
+    unsigned char __sn__b;
+    bool __sn__c;
+} __sn__SmallStruct;
+/* Value operations */
+static inline __sn__SmallStruct __sn__SmallStruct_copy(const __sn__SmallStruct *src) {
+    __sn__SmallStruct dst;
+    dst.__sn__a = src->__sn__a;
+    dst.__sn__b = src->__sn__b;
+    dst.__sn__c = src->__sn__c;
+    return dst;
+}
+
+static inline void __sn__SmallStruct_cleanup(__sn__SmallStruct *p) {
+
+}
+
+#define sn_auto_SmallStruct __attribute__((cleanup(__sn__SmallStruct_cleanup)))
+
+static inline void __sn__SmallStruct_cleanup_elem(void *p) { __sn__SmallStruct_cleanup((__sn__SmallStruct *)p); }
+static inline void __sn__SmallStruct_copy_into(const void *src, void *dst) { *(__sn__SmallStruct *)dst = __sn__SmallStruct_copy((const __sn__SmallStruct *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SmallStruct *__sn__SmallStruct_alloc(void) {
+    return calloc(1, sizeof(__sn__SmallStruct));
+}
+
+static inline void __sn__SmallStruct_release(__sn__SmallStruct **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SmallStruct __attribute__((cleanup(__sn__SmallStruct_release)))
+
+static inline void __sn__SmallStruct_release_elem(void *p) { __sn__SmallStruct_release((__sn__SmallStruct **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SmallStruct_to_string(const __sn__SmallStruct *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SmallStruct { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "a: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__a);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "b: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%u", (unsigned)p->__sn__b);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "c: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__c ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__test_sizeof_primitive_types();
+void __sn__test_sizeof_struct_types();
+void __sn__test_sizeof_expressions();
+void __sn__test_struct_equality();
+void __sn__test_nested_struct_equality();
+void __sn__test_sizeof_in_expressions();
+
+bool __sn__Point_op_eq(__sn__Point *, __sn__Point);
+bool __sn__Rectangle_op_eq(__sn__Rectangle *, __sn__Rectangle);
+
+
+
+#endif
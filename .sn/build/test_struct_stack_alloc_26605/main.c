@@ -0,0 +1,143 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__test_small_point() {
+
+    __sn__SmallPoint __sn__p = (__sn__SmallPoint){ .__sn__x = 1.5, .__sn__y = 2.5 };
+
+    if ((sizeof(__sn__SmallPoint) != 16LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: sizeof(SmallPoint) = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__SmallPoint)));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 16\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__p.__sn__x != 1.5)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: p.x = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__p.__sn__x));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 1.5\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__p.__sn__y != 2.5)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: p.y = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__p.__sn__y));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 2.5\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("SmallPoint test: PASS\n");
+    
+}
+
+
+void __sn__test_config_with_defaults() {
+
+    __sn__SmallConfig __sn__c = (__sn__SmallConfig){ .__sn__timeout = 30LL, .__sn__retries = 3LL, .__sn__verbose = false };
+
+    if ((__sn__c.__sn__timeout != 30LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: c.timeout = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__timeout));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 30\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__c.__sn__retries != 3LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: c.retries = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__c.__sn__retries));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 3\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__c.__sn__verbose != false)) {
+        sn_print("FAIL: c.verbose != false\n");
+        
+        return;}
+
+    sn_print("SmallConfig defaults test: PASS\n");
+    
+}
+
+
+void __sn__test_medium_struct() {
+
+    if ((sizeof(__sn__MediumStruct) != 800LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: sizeof(MediumStruct) = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sizeof(__sn__MediumStruct)));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 800\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    __sn__MediumStruct __sn__m = (__sn__MediumStruct){ .__sn__field0 = 42LL, .__sn__field99 = 99LL, .__sn__field1 = 0LL, .__sn__field2 = 0LL, .__sn__field3 = 0LL, .__sn__field4 = 0LL, .__sn__field5 = 0LL, .__sn__field6 = 0LL, .__sn__field7 = 0LL, .__sn__field8 = 0LL, .__sn__field9 = 0LL, .__sn__field10 = 0LL, .__sn__field11 = 0LL, .__sn__field12 = 0LL, .__sn__field13 = 0LL, .__sn__field14 = 0LL, .__sn__field15 = 0LL, .__sn__field16 = 0LL, .__sn__field17 = 0LL, .__sn__field18 = 0LL, .__sn__field19 = 0LL, .__sn__field20 = 0LL, .__sn__field21 = 0LL, .__sn__field22 = 0LL, .__sn__field23 = 0LL, .__sn__field24 = 0LL, .__sn__field25 = 0LL, .__sn__field26 = 0LL, .__sn__field27 = 0LL, .__sn__field28 = 0LL, .__sn__field29 = 0LL, .__sn__field30 = 0LL, .__sn__field31 = 0LL, .__sn__field32 = 0LL, .__sn__field33 = 0LL, .__sn__field34 = 0LL, .__sn__field35 = 0LL, .__sn__field36 = 0LL, .__sn__field37 = 0LL, .__sn__field38 = 0LL, .__sn__field39 = 0LL, .__sn__field40 = 0LL, .__sn__field41 = 0LL, .__sn__field42 = 0LL, .__sn__field43 = 0LL, .__sn__field44 = 0LL, .__sn__field45 = 0LL, .__sn__field46 = 0LL, .__sn__field47 = 0LL, .__sn__field48 = 0LL, .__sn__field49 = 0LL, .__sn__field50 = 0LL, .__sn__field51 = 0LL, .__sn__field52 = 0LL, .__sn__field53 = 0LL, .__sn__field54 = 0LL, .__sn__field55 = 0LL, .__sn__field56 = 0LL, .__sn__field57 = 0LL, .__sn__field58 = 0LL, .__sn__field59 = 0LL, .__sn__field60 = 0LL, .__sn__field61 = 0LL, .__sn__field62 = 0LL, .__sn__field63 = 0LL, .__sn__field64 = 0LL, .__sn__field65 = 0LL, .__sn__field66 = 0LL, .__sn__field67 = 0LL, .__sn__field68 = 0LL, .__sn__field69 = 0LL, .__sn__field70 = 0LL, .__sn__field71 = 0LL, .__sn__field72 = 0LL, .__sn__field73 = 0LL, .__sn__field74 = 0LL, .__sn__field75 = 0LL, .__sn__field76 = 0LL, .__sn__field77 = 0LL, .__sn__field78 = 0LL, .__sn__field79 = 0LL, .__sn__field80 = 0LL, .__sn__field81 = 0LL, .__sn__field82 = 0LL, .__sn__field83 = 0LL, .__sn__field84 = 0LL, .__sn__field85 = 0LL, .__sn__field86 = 0LL, .__sn__field87 = 0LL, .__sn__field88 = 0LL, .__sn__field89 = 0LL, .__sn__field90 = 0LL, .__sn__field91 = 0LL, .__sn__field92 = 0LL, .__sn__field93 = 0LL, .__sn__field94 = 0LL, .__sn__field95 = 0LL, .__sn__field96 = 0LL, .__sn__field97 = 0LL, .__sn__field98 = 0LL };
+
+    if ((__sn__m.__sn__field0 != 42LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: m.field0 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__m.__sn__field0));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 42\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__m.__sn__field99 != 99LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: m.field99 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__m.__sn__field99));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 99\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    if ((__sn__m.__sn__field50 != 0LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAIL: m.field50 = ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__m.__sn__field50));
+                sn_auto_str char *__is_p2__ = sn_strdup(", expected 0\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+        return;}
+
+    sn_print("MediumStruct test: PASS\n");
+    
+}
+
+
+
+
+int main() {
+    sn_print("Testing stack-allocated structs (<8KB):\n");
+    
+    __sn__test_small_point();
+    
+    __sn__test_config_with_defaults();
+    
+    __sn__test_medium_struct();
+    
+    sn_print("All stack allocation tests passed.\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,681 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: SmallPoint (as val) */
+typedef struct {
+    double __sn__x;
+    double __sn__y;
+} __sn__SmallPoint;
+/* Value operations */
+static inline __sn__SmallPoint __sn__SmallPoint_copy(const __sn__SmallPoint *src) {
+    __sn__SmallPoint dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__SmallPoint_cleanup(__sn__SmallPoint *p) {
+
+}
+
+#define sn_auto_SmallPoint __attribute__((cleanup(__sn__SmallPoint_cleanup)))
+
+static inline void __sn__SmallPoint_cleanup_elem(void *p) { __sn__SmallPoint_cleanup((__sn__SmallPoint *)p); }
+static inline void __sn__SmallPoint_copy_into(const void *src, void *dst) { *(__sn__SmallPoint *)dst = __sn__SmallPoint_copy((const __sn__SmallPoint *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SmallPoint *__sn__SmallPoint_alloc(void) {
+    return calloc(1, sizeof(__sn__SmallPoint));
+}
+
+static inline void __sn__SmallPoint_release(__sn__SmallPoint **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SmallPoint __attribute__((cleanup(__sn__SmallPoint_release)))
+
+static inline void __sn__SmallPoint_release_elem(void *p) { __sn__SmallPoint_release((__sn__SmallPoint **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SmallPoint_to_string(const __sn__SmallPoint *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SmallPoint { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: SmallConfig (as val) */
+typedef struct {
+    long long __sn__timeout;
+    long long __sn__retries;
+    bool __sn__verbose;
+} __sn__SmallConfig;
+/* Value operations */
+static inline __sn__SmallConfig __sn__SmallConfig_copy(const __sn__SmallConfig *src) {
+    __sn__SmallConfig dst;
+    dst.__sn__timeout = src->__sn__timeout;
+    dst.__sn__retries = src->__sn__retries;
+    dst.__sn__verbose = src->__sn__verbose;
+    return dst;
+}
+
+static inline void __sn__SmallConfig_cleanup(__sn__SmallConfig *p) {
+
+}
+
+#define sn_auto_SmallConfig __attribute__((cleanup(__sn__SmallConfig_cleanup)))
+
+static inline void __sn__SmallConfig_cleanup_elem(void *p) { __sn__SmallConfig_cleanup((__sn__SmallConfig *)p); }
+static inline void __sn__SmallConfig_copy_into(const void *src, void *dst) { *(__sn__SmallConfig *)dst = __sn__SmallConfig_copy((const __sn__SmallConfig *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__SmallConfig *__sn__SmallConfig_alloc(void) {
+    return calloc(1, sizeof(__sn__SmallConfig));
+}
+
+static inline void __sn__SmallConfig_release(__sn__SmallConfig **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_SmallConfig __attribute__((cleanup(__sn__SmallConfig_release)))
+
+static inline void __sn__SmallConfig_release_elem(void *p) { __sn__SmallConfig_release((__sn__SmallConfig **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__SmallConfig_to_string(const __sn__SmallConfig *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "SmallConfig { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "timeout: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__timeout);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "retries: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__retries);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "verbose: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__verbose ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: MediumStruct (as val) */
+typedef struct {
+    long long __sn__field0;
+    long long __sn__field1;
+    long long __sn__field2;
+    long long __sn__field3;
+    long long __sn__field4;
+    long long __sn__field5;
+    long long __sn__field6;
+    long long __sn__field7;
+    long long __sn__field8;
+    long long __sn__field9;
+    long long __sn__field10;
+    long long __sn__field11;
+    long long __sn__field12;
+    long long __sn__field13;
+    long long __sn__field14;
+    long long __sn__field15;
+    long long __sn__field16;
+    long long __sn__field17;
+    long long __sn__field18;
+    long long __sn__field19;
+    long long __sn__field20;
+    long long __sn__field21;
+    long long __sn__field22;
+    long long __sn__field23;
+    long long __sn__field24;
+    long long __sn__field25;
+    long long __sn__field26;
+    long long __sn__field27;
+    long long __sn__field28;
+    long long __sn__field29;
+    long long __sn__field30;
+    long long __sn__field31;
+    long long __sn__field32;
+    long long __sn__field33;
+    long long __sn__field34;
+    long long __sn__field35;
+    long long __sn__field36;
+    long long __sn__field37;
+    long long __sn__field38;
+    long long __sn__field39;
+    long long __sn__field40;
+    long long __sn__field41;
+    long long __sn__field42;
+    long long __sn__field43;
+    long long __sn__field44;
+    long long __sn__field45;
+    long long __sn__field46;
+    long long __sn__field47;
+    long long __sn__field48;
+    long long __sn__field49;
+    long long __sn__field50;
+    long long __sn__field51;
+    long long __sn__field52;
+    long long __sn__field53;
+    long long __sn__field54;
+    long long __sn__field55;
+    long long __sn__field56;
+    long long __sn__field57;
+    long long __sn__field58;
+    long long __sn__field59;
+    long long __sn__field60;
+    long long __sn__field61;
+    long long __sn__field62;
+    long long __sn__field63;
+    long long __sn__field64;
+    long long __sn__field65;
+    long long __sn__field66;
+    long long __sn__field67;
+    long long __sn__field68;
+    long long __sn__field69;
+    long long __sn__field70;
+    long long __sn__field71;
+    long long __sn__field72;
+    long long __sn__field73;
+    long long __sn__field74;
+    long long __sn__field75;
+    long long __sn__field76;
+    long long __sn__field77;
+    long long __sn__field78;
+    long long __sn__field79;
+    long long __sn__field80;
+    long long __sn__field81;
+    long long __sn__field82;
+    long long __sn__field83;
+    long long __sn__field84;
+    long long __sn__field85;
+    long long __sn__field86;
+    long long __sn__field87;
+    long long __sn__field88;
+    long long __sn__field89;
+    long long __sn__field90;
+    long long __sn__field91;
+    long long __sn__field92;
+    long long __sn__field93;
+    long long __sn__field94;
+    long long __sn__field95;
+    long long __sn__field96;
+    long long __sn__field97;
+    long long __sn__field98;
+    long long __sn__field99;
+} __sn__MediumStruct;
+/* Value operations */
+static inline __sn__MediumStruct __sn__MediumStruct_copy(const __sn__MediumStruct *src) {
+    __sn__MediumStruct dst;
+    dst.__sn__field0 = src->__sn__field0;
+    dst.__sn__field1 = src->__sn__field1;
+    dst.__sn__field2 = src->__sn__field2;
+    dst.__sn__field3 = src->__sn__field3;
+    dst.__sn__field4 = src->__sn__field4;
+    dst.__sn__field5 = src->__sn__field5;
+    dst.__sn__field6 = src->__sn__field6;
+    dst.__sn__field7 = src->__sn__field7;
+    dst.__sn__field8 = src->__sn__field8;
+    dst.__sn__field9 = src->__sn__field9;
+    dst.__sn__field10 = src->__sn__field10;
+    dst.__sn__field11 = src->__sn__field11;
+    dst.__sn__field12 = src->__sn__field12;
+    dst.__sn__field13 = src->__sn__field13;
+    dst.__sn__field14 = src->__sn__field14;
+    dst.__sn__field15 = src->__sn__field15;
+    dst.__sn__field16 = src->__sn__field16;
+    dst.__sn__field17 = src->__sn__field17;
+    dst.__sn__field18 = src->__sn__field18;
+    dst.__sn__field19 = src->__sn__field19;
+    dst.__sn__field20 = src->__sn__field20;
+    dst.__sn__field21 = src->__sn__field21;
+    dst.__sn__field22 = src->__sn__field22;
+    dst.__sn__field23 = src->__sn__field23;
+    dst.__sn__field24 = src->__sn__field24;
+    dst.__sn__field25 = src->__sn__field25;
+    dst.__sn__field26 = src->__sn__field26;
+    dst.__sn__field27 = src->__sn__field27;
+    dst.__sn__field28 = src->__sn__field28;
+    dst.__sn__field29 = src->__sn__field29;
+    dst.__sn__field30 = src->__sn__field30;
+    dst.__sn__field31 = src->__sn__field31;
+    dst.__sn__field32 = src->__sn__field32;
+    dst.__sn__field33 = src->__sn__field33;
+    dst.__sn__field34 = src->__sn__field34;
+    dst.__sn__field35 = src->__sn__field35;
+    dst.__sn__field36 = src->__sn__field36;
+    dst.__sn__field37 = src->__sn__field37;
+    dst.__sn__field38 = src->__sn__field38;
+    dst.__sn__field39 = src->__sn__field39;
+    dst.__sn__field40 = src->__sn__field40;
+    dst.__sn__field41 = src->__sn__field41;
+    dst.__sn__field42 = src->__sn__field42;
+    dst.__sn__field43 = src->__sn__field43;
+    dst.__sn__field44 = src->__sn__field44;
+    dst.__sn__field45 = src->__sn__field45;
+    dst.__sn__field46 = src->__sn__field46;
+    dst.__sn__field47 = src->__sn__field47;
+    dst.__sn__field48 = src->__sn__field48;
+    dst.__sn__field49 = src->__sn__field49;
+    dst.__sn__field50 = src->__sn__field50;
+    dst.__sn__field51 = src->__sn__field51;
+    dst.__sn__field52 = src->__sn__field52;
+    dst.__sn__field53 = src->__sn__field53;
+    dst.__sn__field54 = src->__sn__field54;
+    dst.__sn__field55 = src->__sn__field55;
+    dst.__sn__field56 = src->__sn__field56;
+    dst.__sn__field57 = src->__sn__field57;
+    dst.__sn__field58 = src->__sn__field58;
+    dst.__sn__field59 = src->__sn__field59;
+    dst.__sn__field60 = src->__sn__field60;
+    dst.__sn__field61 = src->__sn__field61;
+    dst.__sn__field62 = src->__sn__field62;
+    dst.__sn__field63 = src->__sn__field63;
+    dst.__sn__field64 = src->__sn__field64;
+    dst.__sn__field65 = src->__sn__field65;
+    dst.__sn__field66 = src->__sn__field66;
+    dst.__sn__field67 = src->__sn__field67;
+    dst.__sn__field68 = src->__sn__field68;
+    dst.__sn__field69 = src->__sn__field69;
+    dst.__sn__field70 = src->__sn__field70;
+    dst.__sn__field71 = src->__sn__field71;
+    dst.__sn__field72 = src->__sn__field72;
+    dst.__sn__field73 = src->__sn__field73;
+    dst.__sn__field74 = src->__sn__field74;
+    dst.__sn__field75 = src->__sn__field75;
+    dst.__sn__field76 = src->__sn__field76;
+    dst.__sn__field77 = src->__sn__field77;
+    dst.__sn__field78 = src->__sn__field78;
+    dst.__sn__field79 = src->__sn__field79;
+    dst.__sn__field80 = src->__sn__field80;
+    dst.__sn__field81 = src->__sn__field81;
+    dst.__sn__field82 = src->__sn__field82;
+    dst.__sn__field83 = src->__sn__field83;
+    dst.__sn__field84 = src->__sn__field84;
+    dst.__sn__field85 = src->__sn__field85;
+    dst.__sn__field86 = src->__sn__field86;
+    dst.__sn__field87 = src->__sn__field87;
+    dst.__sn__field88 = src->__sn__field88;
+    dst.__sn__field89 = src->__sn__field89;
+    dst.__sn__field90 = src->__sn__field90;
+    dst.__sn__field91 = src->__sn__field91;
+    dst.__sn__field92 = src->__sn__field92;
+    dst.__sn__field93 = src->__sn__field93;
+    dst.__sn__field94 = src->__sn__field94;
+    dst.__sn__field95 = src->__sn__field95;
+    dst.__sn__field96 = src->__sn__field96;
+    dst.__sn__field97 = src->__sn__field97;
+    dst.__sn__field98 = src->__sn__field98;
+    dst.__sn__field99 = src->__sn__field99;
+    return dst;
+}
+
+static inline void __sn__MediumStruct_cleanup(__sn__MediumStruct *p) {
+
+}
+
+#define sn_auto_MediumStruct __attribute__((cleanup(__sn__MediumStruct_cleanup)))
+
+static inline void __sn__MediumStruct_cleanup_elem(void *p) { __sn__MediumStruct_cleanup((__sn__MediumStruct *)p); }
+static inline void __sn__MediumStruct_copy_into(const void *src, void *dst) { *(__sn__MediumStruct *)dst = __sn__MediumStruct_copy((const __sn__MediumStruct *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__MediumStruct *__sn__MediumStruct_alloc(void) {
+    return calloc(1, sizeof(__sn__MediumStruct));
+}
+
+static inline void __sn__MediumStruct_release(__sn__MediumStruct **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_MediumStruct __attribute__((cleanup(__sn__MediumStruct_release)))
+
+static inline void __sn__MediumStruct_release_elem(void *p) { __sn__MediumStruct_release((__sn__MediumStruct **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__MediumStruct_to_string(const __sn__MediumStruct *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "MediumStruct { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field0: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field0);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field1: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field1);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field2: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field2);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field3: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field3);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field4: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field4);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field5: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field5);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field6: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field6);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field7: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field7);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field8: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field8);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field9: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field9);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field10: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field10);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field11: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field11);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field12: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field12);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field13: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field13);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field14: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field14);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field15: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field15);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field16: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field16);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field17: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field17);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field18: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field18);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field19: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field19);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field20: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field20);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field21: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field21);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field22: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field22);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field23: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field23);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field24: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field24);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field25: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field25);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field26: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field26);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field27: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field27);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field28: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field28);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field29: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field29);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field30: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field30);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field31: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field31);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field32: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field32);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field33: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field33);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field34: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field34);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field35: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field35);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field36: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field36);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field37: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field37);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field38: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field38);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field39: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field39);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field40: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field40);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field41: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field41);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field42: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field42);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field43: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field43);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field44: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field44);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field45: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field45);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field46: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field46);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field47: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field47);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field48: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field48);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field49: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field49);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field50: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field50);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field51: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field51);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field52: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field52);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field53: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field53);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field54: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field54);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field55: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field55);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field56: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field56);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field57: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field57);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field58: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field58);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field59: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field59);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field60: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field60);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field61: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field61);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field62: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field62);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field63: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field63);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field64: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field64);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field65: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field65);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field66: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field66);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field67: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field67);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field68: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field68);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field69: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field69);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field70: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field70);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field71: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field71);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field72: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field72);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field73: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field73);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field74: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field74);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field75: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field75);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field76: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field76);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field77: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field77);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field78: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field78);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field79: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field79);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field80: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field80);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field81: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field81);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field82: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field82);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field83: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field83);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field84: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field84);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field85: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field85);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field86: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field86);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field87: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field87);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field88: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field88);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field89: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field89);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field90: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field90);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field91: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field91);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field92: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field92);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field93: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field93);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field94: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field94);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field95: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field95);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field96: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field96);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field97: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field97);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field98: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field98);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "field99: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__field99);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+void __sn__test_small_point();
+void __sn__test_config_with_defaults();
+void __sn__test_medium_struct();
+
+
+
+
+#endif
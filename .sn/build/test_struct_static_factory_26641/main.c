@@ -0,0 +1,218 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Point __sn__Point_create(long long __sn__a, long long __sn__b) {
+
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+
+    (__sn__p.__sn__x = __sn__a);
+    
+
+    (__sn__p.__sn__y = __sn__b);
+    
+
+    return __sn__p;}
+
+__sn__Point __sn__Point_createClamped(long long __sn__a, long long __sn__b, long long __sn__maxVal) {
+
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+
+    if (sn_gt_long(__sn__a, __sn__maxVal)) {
+        (__sn__p.__sn__x = __sn__maxVal);
+        
+    } else {
+        (__sn__p.__sn__x = __sn__a);
+        
+    }
+
+    if (sn_gt_long(__sn__b, __sn__maxVal)) {
+        (__sn__p.__sn__y = __sn__maxVal);
+        
+    } else {
+        (__sn__p.__sn__y = __sn__b);
+        
+    }
+
+    return __sn__p;}
+
+long long __sn__Point_distance(__sn__Point __sn__p1, __sn__Point __sn__p2) {
+
+    long long __sn__dx = sn_sub_long(__sn__p1.__sn__x, __sn__p2.__sn__x);
+
+    long long __sn__dy = sn_sub_long(__sn__p1.__sn__y, __sn__p2.__sn__y);
+
+    if (sn_lt_long(__sn__dx, 0LL)) {
+        (__sn__dx = (-__sn__dx));
+        
+    }
+
+    if (sn_lt_long(__sn__dy, 0LL)) {
+        (__sn__dy = (-__sn__dy));
+        
+    }
+
+    return sn_add_long(__sn__dx, __sn__dy);}
+
+__sn__Point __sn__Point_add(__sn__Point *__sn__self, __sn__Point __sn__other) {
+
+    __sn__Point __sn__result = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+
+    (__sn__result.__sn__x = sn_add_long(__sn__self->__sn__x, __sn__other.__sn__x));
+    
+
+    (__sn__result.__sn__y = sn_add_long(__sn__self->__sn__y, __sn__other.__sn__y));
+    
+
+    return __sn__result;}
+
+
+__sn__Rectangle __sn__Rectangle_create(long long __sn__x1, long long __sn__y1, long long __sn__x2, long long __sn__y2) {
+
+    __sn__Rectangle __sn__r = (__sn__Rectangle){ .__sn__topLeft = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL }, .__sn__bottomRight = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL } };
+
+    (__sn__r.__sn__topLeft.__sn__x = __sn__x1);
+    
+
+    (__sn__r.__sn__topLeft.__sn__y = __sn__y1);
+    
+
+    (__sn__r.__sn__bottomRight.__sn__x = __sn__x2);
+    
+
+    (__sn__r.__sn__bottomRight.__sn__y = __sn__y2);
+    
+
+    return __sn__r;}
+
+long long __sn__Rectangle_width(__sn__Rectangle __sn__r) {
+
+    return sn_sub_long(__sn__r.__sn__bottomRight.__sn__x, __sn__r.__sn__topLeft.__sn__x);}
+
+long long __sn__Rectangle_height(__sn__Rectangle __sn__r) {
+
+    return sn_sub_long(__sn__r.__sn__bottomRight.__sn__y, __sn__r.__sn__topLeft.__sn__y);}
+
+int main() {
+    __sn__Point __sn__p1 = __sn__Point_create(10LL, 20LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Point.create(10, 20): x=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p1.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", y=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p1.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__p1.__sn__x != 10LL)) {
+        sn_print("FAIL: x should be 10\n");
+        
+        return 1LL;}
+    if ((__sn__p1.__sn__y != 20LL)) {
+        sn_print("FAIL: y should be 20\n");
+        
+        return 1LL;}
+    __sn__Point __sn__p2 = __sn__Point_createClamped(100LL, 50LL, 75LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Point.createClamped(100, 50, 75): x=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p2.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", y=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p2.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__p2.__sn__x != 75LL)) {
+        sn_print("FAIL: x should be clamped to 75\n");
+        
+        return 1LL;}
+    if ((__sn__p2.__sn__y != 50LL)) {
+        sn_print("FAIL: y should be 50 (not clamped)\n");
+        
+        return 1LL;}
+    __sn__Point __sn__p3 = __sn__Point_create(0LL, 0LL);
+    __sn__Point __sn__p4 = __sn__Point_create(3LL, 4LL);
+    long long __sn__dist = __sn__Point_distance(__sn__p3, __sn__p4);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Point.distance from (0,0) to (3,4): ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__dist));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__dist != 7LL)) {
+        sn_print("FAIL: Manhattan distance should be 7\n");
+        
+        return 1LL;}
+    __sn__Point __sn__p5 = __sn__Point_add(&__sn__p3, __sn__p4);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("(0,0).add((3,4)): x=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p5.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", y=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p5.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__p5.__sn__x != 3LL)) {
+        sn_print("FAIL: x should be 3\n");
+        
+        return 1LL;}
+    if ((__sn__p5.__sn__y != 4LL)) {
+        sn_print("FAIL: y should be 4\n");
+        
+        return 1LL;}
+    __sn__Rectangle __sn__rect = __sn__Rectangle_create(5LL, 10LL, 25LL, 30LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Rectangle: topLeft=(");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__rect.__sn__topLeft.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(",");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__rect.__sn__topLeft.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup("), bottomRight=(");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__rect.__sn__bottomRight.__sn__x));
+            sn_auto_str char *__is_p6__ = sn_strdup(",");
+            sn_auto_str char *__is_p7__ = sn_str_fmt("%lld", (long long)(__sn__rect.__sn__bottomRight.__sn__y));
+            sn_auto_str char *__is_p8__ = sn_strdup(")\n");
+            sn_str_concat_multi(9, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__, __is_p7__, __is_p8__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__rect.__sn__topLeft.__sn__x != 5LL)) {
+        sn_print("FAIL: topLeft.x should be 5\n");
+        
+        return 1LL;}
+    if ((__sn__rect.__sn__topLeft.__sn__y != 10LL)) {
+        sn_print("FAIL: topLeft.y should be 10\n");
+        
+        return 1LL;}
+    if ((__sn__rect.__sn__bottomRight.__sn__x != 25LL)) {
+        sn_print("FAIL: bottomRight.x should be 25\n");
+        
+        return 1LL;}
+    if ((__sn__rect.__sn__bottomRight.__sn__y != 30LL)) {
+        sn_print("FAIL: bottomRight.y should be 30\n");
+        
+        return 1LL;}
+    long long __sn__w = __sn__Rectangle_width(__sn__rect);
+    long long __sn__h = __sn__Rectangle_height(__sn__rect);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Rectangle width: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__w));
+            sn_auto_str char *__is_p2__ = sn_strdup(", height: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__h));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__w != 20LL)) {
+        sn_print("FAIL: width should be 20\n");
+        
+        return 1LL;}
+    if ((__sn__h != 20LL)) {
+        sn_print("FAIL: height should be 20\n");
+        
+        return 1LL;}
+    sn_print("All static factory method tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,155 @@
+#include "sn_types.h"
+
+
+
+
+double __sn__sqrt(double __sn__x) {
+
+    if ((__sn__x <= 0.0)) {
+        return 0.0;}
+
+    double __sn__guess = sn_div_double(__sn__x, 2.0);
+
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 10LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                (__sn__guess = sn_div_double(sn_add_double(__sn__guess, sn_div_double(__sn__x, __sn__guess)), 2.0));
+                
+            }
+        }
+    }
+
+    return __sn__guess;}
+
+
+long long __sn__Counter_zero() {
+
+    return 0LL;}
+
+long long __sn__Counter_defaultValue() {
+
+    return 100LL;}
+
+long long __sn__Counter_add(long long __sn__a, long long __sn__b) {
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+long long __sn__Counter_getValue(__sn__Counter *__sn__self) {
+
+    return __sn__self->__sn__value;}
+
+void __sn__Counter_increment(__sn__Counter *__sn__self) {
+
+    (__sn__self->__sn__value = sn_add_long(__sn__self->__sn__value, 1LL));
+    
+}
+
+long long __sn__Counter_addValue(__sn__Counter *__sn__self, long long __sn__amount) {
+
+    (__sn__self->__sn__value = sn_add_long(__sn__self->__sn__value, __sn__amount));
+    
+
+    return __sn__self->__sn__value;}
+
+
+double __sn__Point_magnitude(__sn__Point *__sn__self) {
+
+    return __sn__sqrt(sn_add_double(sn_mul_double(__sn__self->__sn__x, __sn__self->__sn__x), sn_mul_double(__sn__self->__sn__y, __sn__self->__sn__y)));}
+
+double __sn__Point_getX(__sn__Point *__sn__self) {
+
+    return __sn__self->__sn__x;}
+
+double __sn__Point_getY(__sn__Point *__sn__self) {
+
+    return __sn__self->__sn__y;}
+
+int main() {
+    long long __sn__z = __sn__Counter_zero();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Counter.zero(): ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__z));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__z != 0LL)) {
+        sn_print("FAIL: Counter.zero() should return 0\n");
+        
+        return 1LL;}
+    long long __sn__d = __sn__Counter_defaultValue();
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Counter.defaultValue(): ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__d));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__d != 100LL)) {
+        sn_print("FAIL: Counter.defaultValue() should return 100\n");
+        
+        return 1LL;}
+    long long __sn__sum = __sn__Counter_add(3LL, 7LL);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Counter.add(3, 7): ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__sum != 10LL)) {
+        sn_print("FAIL: Counter.add(3, 7) should return 10\n");
+        
+        return 1LL;}
+    __sn__Counter __sn__c = (__sn__Counter){ .__sn__value = 42LL };
+    long long __sn__v = __sn__Counter_getValue(&__sn__c);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Initial value: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__v));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__v != 42LL)) {
+        sn_print("FAIL: getValue() should return 42\n");
+        
+        return 1LL;}
+    __sn__Counter_increment(&__sn__c);
+    
+    (__sn__v = __sn__Counter_getValue(&__sn__c));
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After increment: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__v));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__v != 43LL)) {
+        sn_print("FAIL: increment() didn't work\n");
+        
+        return 1LL;}
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 3.0, .__sn__y = 4.0 };
+    double __sn__mag = __sn__Point_magnitude(&__sn__p);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Point(3, 4) magnitude: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__mag));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if (sn_lt_double(__sn__mag, 4.9900000000000002)) {
+        sn_print("FAIL: magnitude should be ~5.0\n");
+        
+        return 1LL;}
+    if (sn_gt_double(__sn__mag, 5.0099999999999998)) {
+        sn_print("FAIL: magnitude should be ~5.0\n");
+        
+        return 1LL;}
+    sn_print("All static method tests passed!\n");
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,32 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__Accumulator_append(__sn__Accumulator *__sn__self, char * __sn__s) {
+
+    ({
+        char *__ma_str_tmp__ = sn_str_concat(__sn__self->__sn__buf, __sn__s);
+        free(__sn__self->__sn__buf);
+        __sn__self->__sn__buf = __ma_str_tmp__;
+        __sn__self->__sn__buf;
+    });
+    
+}
+
+int main() {
+    sn_auto_Accumulator __sn__Accumulator __sn__a = (__sn__Accumulator){ .__sn__buf = strdup("start") };
+    __sn__Accumulator_append(&__sn__a, "-X");
+    
+    __sn__Accumulator_append(&__sn__a, "-Y");
+    
+    __sn__Accumulator_append(&__sn__a, "-Z");
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup(__sn__a.__sn__buf);
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    return 0LL;    fflush(stdout);
+}
@@ -0,0 +1,75 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Accumulator (as val) */
+typedef struct {
+    char * __sn__buf;
+} __sn__Accumulator;
+/* Value operations */
+static inline __sn__Accumulator __sn__Accumulator_copy(const __sn__Accumulator *src) {
+    __sn__Accumulator dst;
+    dst.__sn__buf = src->__sn__buf ? strdup(src->__sn__buf) : NULL;
+    return dst;
+}
+
+static inline void __sn__Accumulator_cleanup(__sn__Accumulator *p) {
+    free(p->__sn__buf);
+
+}
+
+#define sn_auto_Accumulator __attribute__((cleanup(__sn__Accumulator_cleanup)))
+
+static inline void __sn__Accumulator_cleanup_elem(void *p) { __sn__Accumulator_cleanup((__sn__Accumulator *)p); }
+static inline void __sn__Accumulator_copy_into(const void *src, void *dst) { *(__sn__Accumulator *)dst = __sn__Accumulator_copy((const __sn__Accumulator *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Accumulator *__sn__Accumulator_alloc(void) {
+    return calloc(1, sizeof(__sn__Accumulator));
+}
+
+static inline void __sn__Accumulator_release(__sn__Accumulator **p) {
+    if (*p) {
+        free((*p)->__sn__buf);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Accumulator __attribute__((cleanup(__sn__Accumulator_release)))
+
+static inline void __sn__Accumulator_release_elem(void *p) { __sn__Accumulator_release((__sn__Accumulator **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Accumulator_to_string(const __sn__Accumulator *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Accumulator { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "buf: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__buf ? p->__sn__buf : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+void __sn__Accumulator_append(__sn__Accumulator *, char *);
+
+
+
+#endif
@@ -0,0 +1,93 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    _Atomic unsigned char __sn__b = 0LL;
+    
+    pthread_mutex_t __sn__b_mutex = PTHREAD_MUTEX_INITIALIZER;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Initial byte: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%u", (unsigned)(__sn__b));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__b++;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After ++: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%u", (unsigned)(__sn__b));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__b--;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After --: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%u", (unsigned)(__sn__b));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__b = __sn__b + 10LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After += 10: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%u", (unsigned)(__sn__b));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__b = __sn__b - 5LL;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After -= 5: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%u", (unsigned)(__sn__b));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    _Atomic char __sn__c = (char)65;
+    
+    pthread_mutex_t __sn__c_mutex = PTHREAD_MUTEX_INITIALIZER;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Initial char: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%c", (char)(__sn__c));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__c++;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After ++: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%c", (char)(__sn__c));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__c++;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After ++: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%c", (char)(__sn__c));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__c--;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After --: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%c", (char)(__sn__c));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("All sync byte/char tests passed!\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include "sn_types.h"
+void sn_test_sleep_ms(long long);
+
+long long __sn__request = 0LL;
+long long __sn__response = 0LL;
+_Atomic long long __sn__reqReady = 0LL;
+pthread_mutex_t __sn__reqReady_mutex = PTHREAD_MUTEX_INITIALIZER;
+_Atomic long long __sn__respReady = 0LL;
+pthread_mutex_t __sn__respReady_mutex = PTHREAD_MUTEX_INITIALIZER;
+_Atomic long long __sn__proxyDone = 0LL;
+pthread_mutex_t __sn__proxyDone_mutex = PTHREAD_MUTEX_INITIALIZER;
+_Atomic long long __sn__cycleCount = 0LL;
+pthread_mutex_t __sn__cycleCount_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+
+long long __sn__proxyWorker() {
+
+    while ((__sn__proxyDone == 0LL)) {
+        while ((__sn__reqReady == 0LL)) {
+            if ((__sn__proxyDone == 1LL)) {
+                return 0LL;}
+            sn_test_sleep_ms(1LL);
+            
+        }
+        (__sn__response = sn_mul_long(__sn__request, 2LL));
+        
+        (__sn__reqReady = 0LL);
+        
+        (__sn__respReady = 1LL);
+        
+    }
+
+    return 0LL;}
+
+
+long long __sn__sendRequest(long long __sn__payload) {
+
+    (__sn__request = __sn__payload);
+    
+
+    (__sn__respReady = 0LL);
+    
+
+    (__sn__reqReady = 1LL);
+    
+
+    while ((__sn__respReady == 0LL)) {
+        sn_test_sleep_ms(1LL);
+        
+    }
+
+    return __sn__response;}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    long long __result__ = __sn__proxyWorker();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    long long __sn__proxy = 0; sn_auto_thread SnThread * __sn__proxy__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    long long __sn__totalExchanges = 0LL;
+    {
+        for (long long __sn__cycle = 0LL; sn_lt_long(__sn__cycle, 3LL); __sn__cycle++) {
+            long long __sn__r1 = __sn__sendRequest(sn_add_long(sn_mul_long(__sn__cycle, 10LL), 1LL));
+            ({ char *__assert_msg__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("cycle ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__cycle));
+                    sn_auto_str char *__is_p2__ = sn_strdup(" req1");
+                    sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                }); sn_assert((__sn__r1 == sn_mul_long(sn_add_long(sn_mul_long(__sn__cycle, 10LL), 1LL), 2LL)), __assert_msg__); free(__assert_msg__); (void)0; });
+            
+            __sn__totalExchanges++;
+            
+            long long __sn__r2 = __sn__sendRequest(sn_add_long(sn_mul_long(__sn__cycle, 10LL), 2LL));
+            ({ char *__assert_msg__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("cycle ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__cycle));
+                    sn_auto_str char *__is_p2__ = sn_strdup(" req2");
+                    sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                }); sn_assert((__sn__r2 == sn_mul_long(sn_add_long(sn_mul_long(__sn__cycle, 10LL), 2LL), 2LL)), __assert_msg__); free(__assert_msg__); (void)0; });
+            
+            __sn__totalExchanges++;
+            
+            ({pthread_mutex_lock(&__sn__cycleCount_mutex); __sn__cycleCount++; pthread_mutex_unlock(&__sn__cycleCount_mutex); __sn__cycleCount; });
+            
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("cycle ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__cycle));
+                    sn_auto_str char *__is_p2__ = sn_strdup(": PASS");
+                    sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                }); sn_println(__ps__); };
+            
+            sn_test_sleep_ms(10LL);
+            
+        }
+    }
+    (__sn__proxyDone = 1LL);
+    
+    (__sn__reqReady = 1LL);
+    
+    long long __sn__ignored = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__proxy__th__; __sn__proxy__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__proxy = *(long long *)__sync_th__->result; }
+        __sn__proxy; })
+    ;
+    sn_assert((__sn__totalExchanges == 6LL), "total exchanges");
+    
+    sn_assert((__sn__cycleCount == 3LL), "cycle count");
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("All ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__totalExchanges));
+            sn_auto_str char *__is_p2__ = sn_strdup(" exchanges across ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__cycleCount));
+            sn_auto_str char *__is_p4__ = sn_strdup(" cycles completed!");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_println("test_sync_proxy_double_exchange: PASS");
+    
+    fflush(stdout);
+    return 0;
+}
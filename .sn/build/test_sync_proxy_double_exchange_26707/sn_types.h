@@ -0,0 +1,40 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+extern long long __sn__request;
+extern long long __sn__response;
+extern _Atomic long long __sn__reqReady;
+extern pthread_mutex_t __sn__reqReady_mutex;
+extern _Atomic long long __sn__respReady;
+extern pthread_mutex_t __sn__respReady_mutex;
+extern _Atomic long long __sn__proxyDone;
+extern pthread_mutex_t __sn__proxyDone_mutex;
+extern _Atomic long long __sn__cycleCount;
+extern pthread_mutex_t __sn__cycleCount_mutex;
+
+long long __sn__proxyWorker();
+long long __sn__sendRequest(long long);
+
+
+typedef struct {
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+
+
+#endif
@@ -0,0 +1,109 @@
+#include "sn_types.h"
+
+_Atomic SnArray * __sn__items = NULL;
+pthread_mutex_t __sn__items_mutex = PTHREAD_MUTEX_INITIALIZER;
+_Atomic char * __sn__message = NULL;
+pthread_mutex_t __sn__message_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+
+long long __sn__addItem() {
+
+    pthread_mutex_lock(&__sn__items_mutex);
+    {
+        __sn__arr_push(&__sn__items, strdup("a"));
+        
+        __sn__arr_push(&__sn__items, strdup("b"));
+        
+    }
+    pthread_mutex_unlock(&__sn__items_mutex);
+
+    pthread_mutex_lock(&__sn__message_mutex);
+    {
+        ({
+            char *__sn_tmp__ = strdup("done");
+            free(__sn__message);
+            __sn__message = __sn_tmp__;
+            __sn__message;
+        });
+        
+    }
+    pthread_mutex_unlock(&__sn__message_mutex);
+
+    return 1LL;}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    long long __result__ = __sn__addItem();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    long long __result__ = __sn__addItem();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    __sn__items = ({
+        SnArray *__al__ = sn_array_new(sizeof(char *), 0);
+        __al__->elem_tag = SN_TAG_STRING;
+
+        __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+        __al__->elem_copy = sn_copy_str;
+        __al__;
+    });
+    __sn__message = strdup("hello");
+    long long __sn__t1 = 0; sn_auto_thread SnThread * __sn__t1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    long long __sn__t2 = 0; sn_auto_thread SnThread * __sn__t2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    long long __sn__r1 = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__t1__th__; __sn__t1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__t1 = *(long long *)__sync_th__->result; }
+        __sn__t1; })
+    ;
+    long long __sn__r2 = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__t2__th__; __sn__t2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__t2 = *(long long *)__sync_th__->result; }
+        __sn__t2; })
+    ;
+    pthread_mutex_lock(&__sn__items_mutex);
+    {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("items: ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__items)));
+                sn_str_concat_multi(2, __is_p0__, __is_p1__);
+            }); sn_println(__ps__); };
+        
+    }
+    pthread_mutex_unlock(&__sn__items_mutex);
+    pthread_mutex_lock(&__sn__message_mutex);
+    {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("message: ");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__message);
+                sn_str_concat_multi(2, __is_p0__, __is_p1__);
+            }); sn_println(__ps__); };
+        
+    }
+    pthread_mutex_unlock(&__sn__message_mutex);
+    sn_cleanup_array(&__sn__items);
+    free(__sn__message);
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,37 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+extern _Atomic SnArray * __sn__items;
+extern pthread_mutex_t __sn__items_mutex;
+extern _Atomic char * __sn__message;
+extern pthread_mutex_t __sn__message_mutex;
+
+long long __sn__addItem();
+
+
+typedef struct {
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+typedef struct {
+    int _padding;
+} __ThreadArgs_1__;
+void *__thread_wrapper_1__(void *arg);
+
+
+#endif
@@ -0,0 +1,72 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__countdown(long long __sn__n) {
+
+    if ((__sn__n <= 0LL)) {
+        return 0LL;}
+
+    return __sn__countdown(sn_sub_long(__sn__n, 1LL));}
+
+
+long long __sn__sum_tail(long long __sn__n, long long __sn__acc) {
+
+    if ((__sn__n <= 0LL)) {
+        return __sn__acc;}
+
+    return __sn__sum_tail(sn_sub_long(__sn__n, 1LL), sn_add_long(__sn__acc, __sn__n));}
+
+
+long long __sn__sum(long long __sn__n) {
+
+    return __sn__sum_tail(__sn__n, 0LL);}
+
+
+long long __sn__gcd(long long __sn__a, long long __sn__b) {
+
+    if ((__sn__b == 0LL)) {
+        return __sn__a;}
+
+    return __sn__gcd(__sn__b, sn_mod_long(__sn__a, __sn__b));}
+
+int main() {
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("countdown(10) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__countdown(10LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sum(10) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum(10LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("gcd(48, 18) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__gcd(48LL, 18LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("countdown(1000) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__countdown(1000LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sum(100) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum(100LL)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
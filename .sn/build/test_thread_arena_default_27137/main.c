@@ -0,0 +1,184 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__build_array() {
+
+    sn_auto_arr SnArray * __sn__result = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            sn_array_push(__al__, &(long long){ 40LL });
+            sn_array_push(__al__, &(long long){ 50LL });
+            __al__;
+        });
+
+    __sn__arr_push(&__sn__result, 60LL);
+    
+
+    {
+        SnArray * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+
+char * __sn__build_string() {
+
+    sn_auto_str char * __sn__msg = strdup("Hello");
+
+    ({
+        char *__sn_tmp__ = sn_str_concat(__sn__msg, " from thread");
+        free(__sn__msg);
+        __sn__msg = __sn_tmp__;
+        __sn__msg;
+    });
+    
+
+    {
+        char * __ret__ = __sn__msg;
+        __sn__msg = NULL;
+        return __ret__;
+    }}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__build_array();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    char * __result__ = __sn__build_string();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(char *));
+    *(char * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_print("Testing default arena mode (promotion)\n");
+    
+    sn_auto_arr SnArray * __sn__arr_result = NULL; sn_auto_thread SnThread * __sn__arr_result__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(SnArray *);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__arr_result__th__; __sn__arr_result__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); sn_cleanup_array(&__sn__arr_result); __sn__arr_result = *(SnArray * *)__sync_th__->result; }
+        __sn__arr_result; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Array length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__arr_result)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Array[0]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr_result->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr_result->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Array[5]: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr_result->data)[({ long long __ai__ = 5LL; __ai__ < 0 ? __ai__ + __sn__arr_result->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    __sn__arr_push(&__sn__arr_result, 70LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After push, length: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__arr_result)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__str_result = NULL; sn_auto_thread SnThread * __sn__str_result__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(char *);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__str_result__th__; __sn__str_result__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); free(__sn__str_result); __sn__str_result = *(char * *)__sync_th__->result; }
+        __sn__str_result; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("String: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__str_result);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((sn_array_length(__sn__arr_result) == 7LL)) {
+        if (((((long long *)__sn__arr_result->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr_result->len : __ai__; })]) == 10LL)) {
+            if (((((long long *)__sn__arr_result->data)[({ long long __ai__ = 5LL; __ai__ < 0 ? __ai__ + __sn__arr_result->len : __ai__; })]) == 60LL)) {
+                if (((((long long *)__sn__arr_result->data)[({ long long __ai__ = 6LL; __ai__ < 0 ? __ai__ + __sn__arr_result->len : __ai__; })]) == 70LL)) {
+                    if ((strcmp(__sn__str_result, "Hello from thread") == 0)) {
+                        sn_print("SUCCESS: Default arena promotion works correctly\n");
+                        
+                    } else {
+                        { sn_auto_str char *__ps__ = ({
+                                sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: String expected 'Hello from thread', got '");
+                                sn_auto_str char *__is_p1__ = sn_strdup(__sn__str_result);
+                                sn_auto_str char *__is_p2__ = sn_strdup("'\n");
+                                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                            }); sn_print(__ps__); };
+                        
+                    }
+                } else {
+                    { sn_auto_str char *__ps__ = ({
+                            sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: arr[6] expected 70, got ");
+                            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr_result->data)[({ long long __ai__ = 6LL; __ai__ < 0 ? __ai__ + __sn__arr_result->len : __ai__; })])));
+                            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                        }); sn_print(__ps__); };
+                    
+                }
+            } else {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: arr[5] expected 60, got ");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr_result->data)[({ long long __ai__ = 5LL; __ai__ < 0 ? __ai__ + __sn__arr_result->len : __ai__; })])));
+                        sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                        sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                    }); sn_print(__ps__); };
+                
+            }
+        } else {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: arr[0] expected 10, got ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__arr_result->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr_result->len : __ai__; })])));
+                    sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                    sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                }); sn_print(__ps__); };
+            
+        }
+    } else {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: length expected 7, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__arr_result)));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,231 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__compute(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 2LL);}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__compute(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__compute(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__compute(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_auto_arr SnArray * __sn__handles = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 3LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__arr_push(&__sn__handles, ({
+                    SnThread *__th__ = sn_thread_create();
+                    __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+                    __args__->arg0 = __sn__i;
+                    __th__->result = __args__;
+                    __th__->result_size = sizeof(long long);
+                    pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+                    __th__;
+                }));
+                
+            }
+        }
+    }
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, sn_array_length(__sn__handles));
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                ({
+                    long long __si__ = __sn__i;
+                    if (__si__ < 0) __si__ += __sn__handles->len;
+                    SnThread *__sync_th__ = (SnThread*)(((long long*)__sn__handles->data)[__si__]);
+                    sn_thread_join(__sync_th__);
+                    long long __sync_val__ = *(long long *)__sync_th__->result;
+                    ((long long *)__sn__handles->data)[__si__] = __sync_val__;
+                    sn_thread_release(__sync_th__);
+                    __sync_val__; })
+                ;
+                
+            }
+        }
+    }
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, sn_array_length(__sn__handles));
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("compute(");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                        sn_auto_str char *__is_p2__ = sn_strdup(") = ");
+                        sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__handles->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__handles->len : __ai__; })])));
+                        sn_auto_str char *__is_p4__ = sn_strdup("\n");
+                        sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+    ({
+        SnArray *__sn_tmp__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+        sn_cleanup_array(&__sn__handles);
+        __sn__handles = __sn_tmp__;
+        __sn__handles;
+    });
+    
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(3LL, 6LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__arr_push(&__sn__handles, ({
+                    SnThread *__th__ = sn_thread_create();
+                    __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+                    __args__->arg0 = __sn__i;
+                    __th__->result = __args__;
+                    __th__->result_size = sizeof(long long);
+                    pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+                    __th__;
+                }));
+                
+            }
+        }
+    }
+    ({
+        for (long long __si__ = 0; __si__ < __sn__handles->len; __si__++) {
+            SnThread *__th__ = *(SnThread**)((char*)__sn__handles->data + __sn__handles->elem_size * (size_t)__si__);
+            if (__th__) { sn_thread_join(__th__); ((long long *)__sn__handles->data)[__si__] = *(long long *)__th__->result; sn_thread_release(__th__); }
+        }
+        __sn__handles; })
+    ;
+    
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, sn_array_length(__sn__handles));
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("compute(");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_add_long(__sn__i, 3LL)));
+                        sn_auto_str char *__is_p2__ = sn_strdup(") = ");
+                        sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__handles->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__handles->len : __ai__; })])));
+                        sn_auto_str char *__is_p4__ = sn_strdup("\n");
+                        sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+    ({
+        SnArray *__sn_tmp__ = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 0);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            __al__;
+        });
+        sn_cleanup_array(&__sn__handles);
+        __sn__handles = __sn_tmp__;
+        __sn__handles;
+    });
+    
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(6LL, 8LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__arr_push(&__sn__handles, ({
+                    SnThread *__th__ = sn_thread_create();
+                    __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+                    __args__->arg0 = __sn__i;
+                    __th__->result = __args__;
+                    __th__->result_size = sizeof(long long);
+                    pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+                    __th__;
+                }));
+                
+            }
+        }
+    }
+    ({
+        for (long long __si__ = 0; __si__ < __sn__handles->len; __si__++) {
+            SnThread *__th__ = *(SnThread**)((char*)__sn__handles->data + __sn__handles->elem_size * (size_t)__si__);
+            if (__th__) { sn_thread_join(__th__); ((long long *)__sn__handles->data)[__si__] = *(long long *)__th__->result; sn_thread_release(__th__); }
+        }
+        __sn__handles; })
+    ;
+    
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, sn_array_length(__sn__handles));
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("compute(");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_add_long(__sn__i, 6LL)));
+                        sn_auto_str char *__is_p2__ = sn_strdup(") = ");
+                        sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__handles->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__handles->len : __ai__; })])));
+                        sn_auto_str char *__is_p4__ = sn_strdup("\n");
+                        sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+    sn_print("SUCCESS: Array-based thread spawning works\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Result __sn__compute(long long __sn__x) {
+
+    return (__sn__Result){ .__sn__value = sn_mul_long(__sn__x, 2LL), .__sn__name = strdup("done") };}
+
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Result __result__ = __sn__compute(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Result));
+    *(__sn__Result *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_auto_arr SnArray * __sn__results = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Result), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Result_cleanup_elem;
+            __al__->elem_copy = __sn__Result_copy_into;
+            __al__;
+        });
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 4LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                __sn__arr_push(&__sn__results, ({
+                    SnThread *__th__ = sn_thread_create();
+                    __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+                    __args__->arg0 = __sn__i;
+                    __th__->result = __args__;
+                    __th__->result_size = sizeof(__sn__Result);
+                    pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+                    __th__;
+                }));
+                
+            }
+        }
+    }
+    ({
+        for (long long __si__ = 0; __si__ < __sn__results->len; __si__++) {
+            SnThread *__th__ = *(SnThread**)((char*)__sn__results->data + __sn__results->elem_size * (size_t)__si__);
+            if (__th__) { sn_thread_join(__th__); ((__sn__Result *)__sn__results->data)[__si__] = *(__sn__Result *)__th__->result; sn_thread_release(__th__); }
+        }
+        __sn__results; })
+    ;
+    
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, sn_array_length(__sn__results));
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)((((__sn__Result *)__sn__results->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + __sn__results->len : __ai__; })]).__sn__value));
+                        sn_auto_str char *__is_p1__ = sn_strdup("\n");
+                        sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                    }); sn_print(__ps__); };
+                
+            }
+        }
+    }
+    fflush(stdout);
+    return 0;
+}
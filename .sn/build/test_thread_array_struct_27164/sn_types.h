@@ -0,0 +1,85 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Result (as val) */
+typedef struct {
+    long long __sn__value;
+    char * __sn__name;
+} __sn__Result;
+/* Value operations */
+static inline __sn__Result __sn__Result_copy(const __sn__Result *src) {
+    __sn__Result dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__Result_cleanup(__sn__Result *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Result __attribute__((cleanup(__sn__Result_cleanup)))
+
+static inline void __sn__Result_cleanup_elem(void *p) { __sn__Result_cleanup((__sn__Result *)p); }
+static inline void __sn__Result_copy_into(const void *src, void *dst) { *(__sn__Result *)dst = __sn__Result_copy((const __sn__Result *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Result *__sn__Result_alloc(void) {
+    return calloc(1, sizeof(__sn__Result));
+}
+
+static inline void __sn__Result_release(__sn__Result **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Result __attribute__((cleanup(__sn__Result_release)))
+
+static inline void __sn__Result_release_elem(void *p) { __sn__Result_release((__sn__Result **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Result_to_string(const __sn__Result *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Result { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Result __sn__compute(long long);
+
+
+typedef struct {
+    long long arg0;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+
+
+#endif
@@ -0,0 +1,112 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__compute_a() {
+
+    return 10LL;}
+
+
+long long __sn__compute_b() {
+
+    return 20LL;}
+
+
+long long __sn__compute_c() {
+
+    return 30LL;}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    long long __result__ = __sn__compute_a();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    long long __result__ = __sn__compute_b();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    long long __result__ = __sn__compute_c();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    long long __sn__r1 = 0; sn_auto_thread SnThread * __sn__r1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    long long __sn__r2 = 0; sn_auto_thread SnThread * __sn__r2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    long long __sn__r3 = 0; sn_auto_thread SnThread * __sn__r3__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+        __th__;
+    });
+    ({
+        { sn_auto_thread SnThread *__sync_th__ = __sn__r1__th__; __sn__r1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r1 = *(long long *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__r2__th__; __sn__r2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r2 = *(long long *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__r3__th__; __sn__r3__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r3 = *(long long *)__sync_th__->result; } }
+        (void)0; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("r1: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r1));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("r2: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r2));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("r3: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r3));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__sum = sn_add_long(sn_add_long(__sn__r1, __sn__r2), __sn__r3);
+    if ((__sn__sum == 60LL)) {
+        sn_print("SUCCESS: All array sync results correct\n");
+        
+    } else {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: Expected sum 60, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+    }
+    fflush(stdout);
+    return 0;
+}
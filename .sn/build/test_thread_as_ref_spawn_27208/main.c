@@ -0,0 +1,112 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__increment(long long *__sn__counter) {
+
+    (*__sn__counter = sn_add_long((*__sn__counter), 10LL));
+    
+
+    return (*__sn__counter);}
+
+
+long long __sn__multiply(long long *__sn__value) {
+
+    (*__sn__value = sn_mul_long((*__sn__value), 3LL));
+    
+
+    return (*__sn__value);}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__increment(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__multiply(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    long long __sn__count = 5LL;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Before thread: count = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__r = 0; sn_auto_thread SnThread * __sn__r__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = &__sn__count;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    long long __sn__result = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__r__th__; __sn__r__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r = *(long long *)__sync_th__->result; }
+        __sn__r; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After sync: count = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__r2 = 0; sn_auto_thread SnThread * __sn__r2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+        __args__->arg0 = &__sn__count;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    long long __sn__result2 = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__r2__th__; __sn__r2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r2 = *(long long *)__sync_th__->result; }
+        __sn__r2; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After second sync: count = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__count == 45LL)) {
+        sn_print("SUCCESS: as ref primitive was correctly modified by threads\n");
+        
+    } else {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: expected count = 45, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__count));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+    }
+    fflush(stdout);
+    return 0;
+}
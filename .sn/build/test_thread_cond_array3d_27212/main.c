@@ -0,0 +1,871 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__makeInt3D() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });}
+
+
+SnArray * __sn__makeLong3D() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 6LL });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 8LL });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });}
+
+
+SnArray * __sn__makeDouble3D() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 2);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 1.0 });
+            sn_array_push(__al__, &(double){ 2.0 });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 2);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 3.0 });
+            sn_array_push(__al__, &(double){ 4.0 });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 2);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 5.0 });
+            sn_array_push(__al__, &(double){ 6.0 });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 2);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 7.0 });
+            sn_array_push(__al__, &(double){ 8.0 });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });}
+
+
+SnArray * __sn__makeBool3D() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 2);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ false });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 2);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 2);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ true });
+            sn_array_push(__al__, &(bool){ true });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 2);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ false });
+            sn_array_push(__al__, &(bool){ false });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });}
+
+
+SnArray * __sn__makeByte3D() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 2);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)1 });
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)2 });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 2);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)3 });
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)4 });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 2);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)5 });
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)6 });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 2);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)7 });
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)8 });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });}
+
+
+SnArray * __sn__makeChar3D() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 2);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)97 });
+            sn_array_push(__al__, &(char){ (char)98 });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 2);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)99 });
+            sn_array_push(__al__, &(char){ (char)100 });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 2);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)101 });
+            sn_array_push(__al__, &(char){ (char)102 });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 2);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)103 });
+            sn_array_push(__al__, &(char){ (char)104 });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });}
+
+
+SnArray * __sn__makeStr3D() {
+
+    return ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("a") });
+            sn_array_push(__al__, &(char *){ strdup("b") });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("c") });
+            sn_array_push(__al__, &(char *){ strdup("d") });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("e") });
+            sn_array_push(__al__, &(char *){ strdup("f") });
+            __al__;
+        }) });
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("g") });
+            sn_array_push(__al__, &(char *){ strdup("h") });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__makeInt3D();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__makeLong3D();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__makeDouble3D();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_3__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__makeBool3D();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_4__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__makeByte3D();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_5__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__makeChar3D();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_6__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__makeStr3D();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_7__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__makeInt3D();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    bool __sn__doSpawn = true;
+    sn_auto_arr SnArray * __sn__int3d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 0LL });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });
+    
+    sn_auto_thread SnThread * __sn__int3d__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__int3d__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __th__->result_size = sizeof(SnArray *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__int3d__th__; __sn__int3d__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); sn_cleanup_array(&__sn__int3d); __sn__int3d = *(SnArray * *)__sync_th__->result; }
+        __sn__int3d; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("int[][][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__int3d);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__long3d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 0LL });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });
+    
+    sn_auto_thread SnThread * __sn__long3d__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__long3d__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __th__->result_size = sizeof(SnArray *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__long3d__th__; __sn__long3d__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); sn_cleanup_array(&__sn__long3d); __sn__long3d = *(SnArray * *)__sync_th__->result; }
+        __sn__long3d; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("long[][][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__long3d);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__double3d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(double), 1);
+            __al__->elem_tag = SN_TAG_DOUBLE;
+    
+            sn_array_push(__al__, &(double){ 0.0 });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });
+    
+    sn_auto_thread SnThread * __sn__double3d__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__double3d__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __th__->result_size = sizeof(SnArray *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__double3d__th__; __sn__double3d__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); sn_cleanup_array(&__sn__double3d); __sn__double3d = *(SnArray * *)__sync_th__->result; }
+        __sn__double3d; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("double[][][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__double3d);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__bool3d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(bool), 1);
+            __al__->elem_tag = SN_TAG_BOOL;
+    
+            sn_array_push(__al__, &(bool){ false });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });
+    
+    sn_auto_thread SnThread * __sn__bool3d__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__bool3d__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __th__->result_size = sizeof(SnArray *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_3__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__bool3d__th__; __sn__bool3d__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); sn_cleanup_array(&__sn__bool3d); __sn__bool3d = *(SnArray * *)__sync_th__->result; }
+        __sn__bool3d; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("bool[][][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__bool3d);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__byte3d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(unsigned char), 1);
+            __al__->elem_tag = SN_TAG_BYTE;
+    
+            sn_array_push(__al__, &(unsigned char){ (unsigned char)0 });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });
+    
+    sn_auto_thread SnThread * __sn__byte3d__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__byte3d__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __th__->result_size = sizeof(SnArray *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_4__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__byte3d__th__; __sn__byte3d__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); sn_cleanup_array(&__sn__byte3d); __sn__byte3d = *(SnArray * *)__sync_th__->result; }
+        __sn__byte3d; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("byte[][][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__byte3d);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__char3d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char), 1);
+            __al__->elem_tag = SN_TAG_CHAR;
+    
+            sn_array_push(__al__, &(char){ (char)120 });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });
+    
+    sn_auto_thread SnThread * __sn__char3d__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__char3d__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __th__->result_size = sizeof(SnArray *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_5__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__char3d__th__; __sn__char3d__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); sn_cleanup_array(&__sn__char3d); __sn__char3d = *(SnArray * *)__sync_th__->result; }
+        __sn__char3d; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("char[][][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__char3d);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__str3d = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 1);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("x") });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });
+    
+    sn_auto_thread SnThread * __sn__str3d__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__str3d__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __th__->result_size = sizeof(SnArray *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_6__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__str3d__th__; __sn__str3d__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); sn_cleanup_array(&__sn__str3d); __sn__str3d = *(SnArray * *)__sync_th__->result; }
+        __sn__str3d; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("str[][][]: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__str3d);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__noSpawn = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 99LL });
+            __al__;
+        }) });
+            __al__;
+        }) });
+            __al__;
+        });
+    
+    sn_auto_thread SnThread * __sn__noSpawn__th__ = NULL;    if (false) {
+        (__sn__noSpawn__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __th__->result_size = sizeof(SnArray *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_7__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__noSpawn__th__; __sn__noSpawn__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); sn_cleanup_array(&__sn__noSpawn); __sn__noSpawn = *(SnArray * *)__sync_th__->result; }
+        __sn__noSpawn; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("no-spawn: ");
+            sn_auto_str char *__is_p1__ = sn_array_to_string(__sn__noSpawn);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
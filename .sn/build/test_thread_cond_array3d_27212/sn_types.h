@@ -0,0 +1,63 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+SnArray * __sn__makeInt3D();
+SnArray * __sn__makeLong3D();
+SnArray * __sn__makeDouble3D();
+SnArray * __sn__makeBool3D();
+SnArray * __sn__makeByte3D();
+SnArray * __sn__makeChar3D();
+SnArray * __sn__makeStr3D();
+
+
+typedef struct {
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+typedef struct {
+    int _padding;
+} __ThreadArgs_1__;
+void *__thread_wrapper_1__(void *arg);
+typedef struct {
+    int _padding;
+} __ThreadArgs_2__;
+void *__thread_wrapper_2__(void *arg);
+typedef struct {
+    int _padding;
+} __ThreadArgs_3__;
+void *__thread_wrapper_3__(void *arg);
+typedef struct {
+    int _padding;
+} __ThreadArgs_4__;
+void *__thread_wrapper_4__(void *arg);
+typedef struct {
+    int _padding;
+} __ThreadArgs_5__;
+void *__thread_wrapper_5__(void *arg);
+typedef struct {
+    int _padding;
+} __ThreadArgs_6__;
+void *__thread_wrapper_6__(void *arg);
+typedef struct {
+    int _padding;
+} __ThreadArgs_7__;
+void *__thread_wrapper_7__(void *arg);
+
+
+#endif
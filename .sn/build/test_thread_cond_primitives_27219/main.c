@@ -0,0 +1,273 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__computeInt(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 2LL);}
+
+
+long long __sn__computeLong(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 3LL);}
+
+
+double __sn__computeDouble(double __sn__x) {
+
+    return sn_mul_double(__sn__x, 1.5);}
+
+
+bool __sn__computeBool(bool __sn__x) {
+
+    return (!__sn__x);}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__computeInt(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__computeLong(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    double __result__ = __sn__computeDouble(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(double));
+    *(double *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_3__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_3__ *args = (__ThreadArgs_3__ *)__th__->result;
+    __ThreadArgs_3__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    bool __result__ = __sn__computeBool(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(bool));
+    *(bool *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_4__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_4__ *args = (__ThreadArgs_4__ *)__th__->result;
+    __ThreadArgs_4__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__computeInt(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_5__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_5__ *args = (__ThreadArgs_5__ *)__th__->result;
+    __ThreadArgs_5__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__computeInt(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    bool __sn__doSpawn = true;
+    long long __sn__intResult = 0LL;
+    
+    sn_auto_thread SnThread * __sn__intResult__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__intResult__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+            __args__->arg0 = 21LL;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(long long);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__intResult__th__; __sn__intResult__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__intResult = *(long long *)__sync_th__->result; }
+        __sn__intResult; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("int: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__intResult));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__longResult = 0LL;
+    
+    sn_auto_thread SnThread * __sn__longResult__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__longResult__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+            __args__->arg0 = 1000000000000LL;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(long long);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__longResult__th__; __sn__longResult__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__longResult = *(long long *)__sync_th__->result; }
+        __sn__longResult; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("long: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__longResult));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    double __sn__doubleResult = 0.0;
+    
+    sn_auto_thread SnThread * __sn__doubleResult__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__doubleResult__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+            __args__->arg0 = 10.0;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(double);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__doubleResult__th__; __sn__doubleResult__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__doubleResult = *(double *)__sync_th__->result; }
+        __sn__doubleResult; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("double: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__doubleResult));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    bool __sn__boolResult = false;
+    
+    sn_auto_thread SnThread * __sn__boolResult__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__boolResult__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_3__ *__args__ = malloc(sizeof(__ThreadArgs_3__));
+            __args__->arg0 = false;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(bool);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_3__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__boolResult__th__; __sn__boolResult__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__boolResult = *(bool *)__sync_th__->result; }
+        __sn__boolResult; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("bool: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((__sn__boolResult) ? "true" : "false");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    bool __sn__noSpawn = false;
+    long long __sn__intNoSpawn = 99LL;
+    
+    sn_auto_thread SnThread * __sn__intNoSpawn__th__ = NULL;    if (__sn__noSpawn) {
+        (__sn__intNoSpawn__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_4__ *__args__ = malloc(sizeof(__ThreadArgs_4__));
+            __args__->arg0 = 50LL;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(long long);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_4__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__intNoSpawn__th__; __sn__intNoSpawn__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__intNoSpawn = *(long long *)__sync_th__->result; }
+        __sn__intNoSpawn; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("no-spawn int: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__intNoSpawn));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__loopSum = 0LL;
+    
+    sn_auto_thread SnThread * __sn__loopSum__th__ = NULL;    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 3LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if ((sn_mod_long(__sn__i, 2LL) == 0LL)) {
+                    (__sn__loopSum__th__ = ({
+                        SnThread *__th__ = sn_thread_create();
+                        __ThreadArgs_5__ *__args__ = malloc(sizeof(__ThreadArgs_5__));
+                        __args__->arg0 = sn_mul_long(__sn__i, 10LL);
+                        __th__->result = __args__;
+                        __th__->result_size = sizeof(long long);
+                        pthread_create(&__th__->thread, NULL, __thread_wrapper_5__, __th__);
+                        __th__;
+                    }));
+                    
+                }
+                ({
+                    sn_auto_thread SnThread *__sync_th__ = __sn__loopSum__th__; __sn__loopSum__th__ = NULL;
+                    if (__sync_th__) { sn_thread_join(__sync_th__); __sn__loopSum = *(long long *)__sync_th__->result; }
+                    __sn__loopSum; })
+                ;
+                
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("loop sum: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__loopSum));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,262 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__computeString(char * __sn__s) {
+
+    return sn_str_concat(__sn__s, " world");}
+
+
+char * __sn__uppercaseFirst(char * __sn__s) {
+
+    return __sn___toUpper(&__sn__s);}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    char * __result__ = __sn__computeString(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(char *));
+    *(char * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    char * __result__ = __sn__uppercaseFirst(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(char *));
+    *(char * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    char * __result__ = __sn__computeString(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(char *));
+    *(char * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_3__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_3__ *args = (__ThreadArgs_3__ *)__th__->result;
+    __ThreadArgs_3__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    char * __result__ = __sn__computeString(args->arg0);
+    free(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(char *));
+    *(char * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_4__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_4__ *args = (__ThreadArgs_4__ *)__th__->result;
+    __ThreadArgs_4__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    char * __result__ = __sn__computeString(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(char *));
+    *(char * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_5__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_5__ *args = (__ThreadArgs_5__ *)__th__->result;
+    __ThreadArgs_5__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    char * __result__ = __sn__computeString(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(char *));
+    *(char * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    bool __sn__doSpawn = true;
+    sn_auto_str char * __sn__strResult = strdup("initial");
+    
+    sn_auto_thread SnThread * __sn__strResult__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__strResult__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+            __args__->arg0 = "hello";
+            __th__->result = __args__;
+            __th__->result_size = sizeof(char *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__strResult__th__; __sn__strResult__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); free(__sn__strResult); __sn__strResult = *(char * *)__sync_th__->result; }
+        __sn__strResult; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("string: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__strResult);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_str char * __sn__upperResult = strdup("");
+    
+    sn_auto_thread SnThread * __sn__upperResult__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__upperResult__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+            __args__->arg0 = "testing";
+            __th__->result = __args__;
+            __th__->result_size = sizeof(char *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__upperResult__th__; __sn__upperResult__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); free(__sn__upperResult); __sn__upperResult = *(char * *)__sync_th__->result; }
+        __sn__upperResult; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("upper: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__upperResult);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    bool __sn__noSpawn = false;
+    sn_auto_str char * __sn__noSpawnStr = strdup("unchanged");
+    
+    sn_auto_thread SnThread * __sn__noSpawnStr__th__ = NULL;    if (__sn__noSpawn) {
+        (__sn__noSpawnStr__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+            __args__->arg0 = "never";
+            __th__->result = __args__;
+            __th__->result_size = sizeof(char *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__noSpawnStr__th__; __sn__noSpawnStr__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); free(__sn__noSpawnStr); __sn__noSpawnStr = *(char * *)__sync_th__->result; }
+        __sn__noSpawnStr; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("no-spawn: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__noSpawnStr);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_str char * __sn__loopStr = strdup("start");
+    
+    sn_auto_thread SnThread * __sn__loopStr__th__ = NULL;    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 3LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if ((__sn__i == 1LL)) {
+                    (__sn__loopStr__th__ = ({
+                        SnThread *__th__ = sn_thread_create();
+                        __ThreadArgs_3__ *__args__ = malloc(sizeof(__ThreadArgs_3__));
+                        __args__->arg0 = ({
+                            sn_auto_str char *__is_p0__ = sn_strdup("iter");
+                            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                        });
+                        __th__->result = __args__;
+                        __th__->result_size = sizeof(char *);
+                        pthread_create(&__th__->thread, NULL, __thread_wrapper_3__, __th__);
+                        __th__;
+                    }));
+                    
+                }
+                ({
+                    sn_auto_thread SnThread *__sync_th__ = __sn__loopStr__th__; __sn__loopStr__th__ = NULL;
+                    if (__sync_th__) { sn_thread_join(__sync_th__); free(__sn__loopStr); __sn__loopStr = *(char * *)__sync_th__->result; }
+                    __sn__loopStr; })
+                ;
+                
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("loop: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__loopStr);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_str char * __sn__multi1 = strdup("a");
+    
+    sn_auto_thread SnThread * __sn__multi1__th__ = NULL;    sn_auto_str char * __sn__multi2 = strdup("b");
+    
+    sn_auto_thread SnThread * __sn__multi2__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__multi1__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_4__ *__args__ = malloc(sizeof(__ThreadArgs_4__));
+            __args__->arg0 = "first";
+            __th__->result = __args__;
+            __th__->result_size = sizeof(char *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_4__, __th__);
+            __th__;
+        }));
+        
+        (__sn__multi2__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_5__ *__args__ = malloc(sizeof(__ThreadArgs_5__));
+            __args__->arg0 = "second";
+            __th__->result = __args__;
+            __th__->result_size = sizeof(char *);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_5__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__multi1__th__; __sn__multi1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); free(__sn__multi1); __sn__multi1 = *(char * *)__sync_th__->result; }
+        __sn__multi1; })
+    ;
+    
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__multi2__th__; __sn__multi2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); free(__sn__multi2); __sn__multi2 = *(char * *)__sync_th__->result; }
+        __sn__multi2; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("multi: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__multi1);
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_strdup(__sn__multi2);
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,56 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+
+char * __sn__computeString(char *);
+char * __sn__uppercaseFirst(char *);
+
+
+typedef struct {
+    char * arg0;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+typedef struct {
+    char * arg0;
+    int _padding;
+} __ThreadArgs_1__;
+void *__thread_wrapper_1__(void *arg);
+typedef struct {
+    char * arg0;
+    int _padding;
+} __ThreadArgs_2__;
+void *__thread_wrapper_2__(void *arg);
+typedef struct {
+    char * arg0;
+    int _padding;
+} __ThreadArgs_3__;
+void *__thread_wrapper_3__(void *arg);
+typedef struct {
+    char * arg0;
+    int _padding;
+} __ThreadArgs_4__;
+void *__thread_wrapper_4__(void *arg);
+typedef struct {
+    char * arg0;
+    int _padding;
+} __ThreadArgs_5__;
+void *__thread_wrapper_5__(void *arg);
+
+
+#endif
@@ -0,0 +1,373 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Point __sn__makePoint(long long __sn__x, long long __sn__y) {
+
+    return (__sn__Point){ .__sn__x = __sn__x, .__sn__y = __sn__y };}
+
+
+__sn__Person __sn__makePerson(char * __sn__name, long long __sn__age) {
+
+    return (__sn__Person){ .__sn__name = strdup(__sn__name), .__sn__age = __sn__age };}
+
+
+__sn__WithArray __sn__makeWithArray(char * __sn__label) {
+
+    sn_auto_arr SnArray * __sn__values = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+
+    return (__sn__WithArray){ .__sn__values = sn_array_copy(__sn__values), .__sn__label = strdup(__sn__label) };}
+
+
+__sn__WithArray __sn__makeEmptyArray() {
+
+    sn_auto_arr SnArray * __sn__values = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 0LL });
+            __al__;
+        });
+
+    return (__sn__WithArray){ .__sn__values = sn_array_copy(__sn__values), .__sn__label = strdup("") };}
+
+
+__sn__WithArray2D __sn__makeWithArray2D(char * __sn__name) {
+
+    sn_auto_arr SnArray * __sn__row1 = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__row2 = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 2);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 4LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__matrix = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 2);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ sn_array_copy(__sn__row1) });
+            sn_array_push(__al__, &(SnArray *){ sn_array_copy(__sn__row2) });
+            __al__;
+        });
+
+    return (__sn__WithArray2D){ .__sn__matrix = sn_array_copy(__sn__matrix), .__sn__name = strdup(__sn__name) };}
+
+
+__sn__WithArray2D __sn__makeEmptyArray2D() {
+
+    sn_auto_arr SnArray * __sn__row = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 1);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 0LL });
+            __al__;
+        });
+
+    sn_auto_arr SnArray * __sn__matrix = ({
+            SnArray *__al__ = sn_array_new(sizeof(SnArray *), 1);
+            __al__->elem_tag = SN_TAG_ARRAY;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_array;
+            __al__->elem_copy = sn_copy_array;
+            sn_array_push(__al__, &(SnArray *){ sn_array_copy(__sn__row) });
+            __al__;
+        });
+
+    return (__sn__WithArray2D){ .__sn__matrix = sn_array_copy(__sn__matrix), .__sn__name = strdup("") };}
+
+
+__sn__Nested __sn__makeNested(char * __sn__name) {
+
+    return (__sn__Nested){ .__sn__inner = (__sn__Point){ .__sn__x = 5LL, .__sn__y = 6LL }, .__sn__name = strdup(__sn__name) };}
+
+
+__sn__Nested __sn__makeEmptyNested() {
+
+    return (__sn__Nested){ .__sn__inner = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL }, .__sn__name = strdup("") };}
+
+
+
+
+
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Point __result__ = __sn__makePoint(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Point));
+    *(__sn__Point *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Person __result__ = __sn__makePerson(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Person));
+    *(__sn__Person *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__WithArray __result__ = __sn__makeWithArray(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__WithArray));
+    *(__sn__WithArray *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_3__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_3__ *args = (__ThreadArgs_3__ *)__th__->result;
+    __ThreadArgs_3__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__WithArray2D __result__ = __sn__makeWithArray2D(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__WithArray2D));
+    *(__sn__WithArray2D *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_4__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_4__ *args = (__ThreadArgs_4__ *)__th__->result;
+    __ThreadArgs_4__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Nested __result__ = __sn__makeNested(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Nested));
+    *(__sn__Nested *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_5__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_5__ *args = (__ThreadArgs_5__ *)__th__->result;
+    __ThreadArgs_5__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Point __result__ = __sn__makePoint(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Point));
+    *(__sn__Point *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    bool __sn__doSpawn = true;
+    __sn__Point __sn__pt = (__sn__Point){ .__sn__x = 0LL, .__sn__y = 0LL };
+    
+    sn_auto_thread SnThread * __sn__pt__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__pt__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+            __args__->arg0 = 10LL;
+            __args__->arg1 = 20LL;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(__sn__Point);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__pt__th__; __sn__pt__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__pt = *(__sn__Point *)__sync_th__->result; }
+        __sn__pt; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Point: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__pt.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__pt.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Person __sn__Person __sn__p = (__sn__Person){ .__sn__name = strdup(""), .__sn__age = 0LL };
+    
+    sn_auto_thread SnThread * __sn__p__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__p__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+            __args__->arg0 = "Alice";
+            __args__->arg1 = 30LL;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(__sn__Person);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__p__th__; __sn__p__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__Person_cleanup(&__sn__p); __sn__p = *(__sn__Person *)__sync_th__->result; }
+        __sn__p; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Person: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__p.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup(", age ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__p.__sn__age));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_WithArray __sn__WithArray __sn__wa = __sn__makeEmptyArray();
+    
+    sn_auto_thread SnThread * __sn__wa__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__wa__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+            __args__->arg0 = "numbers";
+            __th__->result = __args__;
+            __th__->result_size = sizeof(__sn__WithArray);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__wa__th__; __sn__wa__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__WithArray_cleanup(&__sn__wa); __sn__wa = *(__sn__WithArray *)__sync_th__->result; }
+        __sn__wa; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("WithArray: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__wa.__sn__label);
+            sn_auto_str char *__is_p2__ = sn_strdup(", values[0]=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__wa.__sn__values->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__wa.__sn__values->len : __ai__; })])));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_WithArray2D __sn__WithArray2D __sn__wa2d = __sn__makeEmptyArray2D();
+    
+    sn_auto_thread SnThread * __sn__wa2d__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__wa2d__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_3__ *__args__ = malloc(sizeof(__ThreadArgs_3__));
+            __args__->arg0 = "grid";
+            __th__->result = __args__;
+            __th__->result_size = sizeof(__sn__WithArray2D);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_3__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__wa2d__th__; __sn__wa2d__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__WithArray2D_cleanup(&__sn__wa2d); __sn__wa2d = *(__sn__WithArray2D *)__sync_th__->result; }
+        __sn__wa2d; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("WithArray2D: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__wa2d.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup(", matrix[1][0]=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((((long long *)(((SnArray * *)__sn__wa2d.__sn__matrix->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__wa2d.__sn__matrix->len : __ai__; })])->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + (((SnArray * *)__sn__wa2d.__sn__matrix->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__wa2d.__sn__matrix->len : __ai__; })])->len : __ai__; })])));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_Nested __sn__Nested __sn__n = __sn__makeEmptyNested();
+    
+    sn_auto_thread SnThread * __sn__n__th__ = NULL;    if (__sn__doSpawn) {
+        (__sn__n__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_4__ *__args__ = malloc(sizeof(__ThreadArgs_4__));
+            __args__->arg0 = "nested";
+            __th__->result = __args__;
+            __th__->result_size = sizeof(__sn__Nested);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_4__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__n__th__; __sn__n__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__Nested_cleanup(&__sn__n); __sn__n = *(__sn__Nested *)__sync_th__->result; }
+        __sn__n; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Nested: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__n.__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup(", inner=(");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__n.__sn__inner.__sn__x));
+            sn_auto_str char *__is_p4__ = sn_strdup(", ");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__n.__sn__inner.__sn__y));
+            sn_auto_str char *__is_p6__ = sn_strdup(")");
+            sn_str_concat_multi(7, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__, __is_p6__);
+        }); sn_println(__ps__); };
+    
+    __sn__Point __sn__noSpawn = (__sn__Point){ .__sn__x = 99LL, .__sn__y = 98LL };
+    
+    sn_auto_thread SnThread * __sn__noSpawn__th__ = NULL;    if (false) {
+        (__sn__noSpawn__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_5__ *__args__ = malloc(sizeof(__ThreadArgs_5__));
+            __args__->arg0 = 1LL;
+            __args__->arg1 = 2LL;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(__sn__Point);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_5__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__noSpawn__th__; __sn__noSpawn__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__noSpawn = *(__sn__Point *)__sync_th__->result; }
+        __sn__noSpawn; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("no-spawn: (");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__noSpawn.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__noSpawn.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup(")");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
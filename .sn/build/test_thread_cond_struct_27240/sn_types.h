@@ -0,0 +1,342 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Point (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Point;
+/* Value operations */
+static inline __sn__Point __sn__Point_copy(const __sn__Point *src) {
+    __sn__Point dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Point_cleanup(__sn__Point *p) {
+
+}
+
+#define sn_auto_Point __attribute__((cleanup(__sn__Point_cleanup)))
+
+static inline void __sn__Point_cleanup_elem(void *p) { __sn__Point_cleanup((__sn__Point *)p); }
+static inline void __sn__Point_copy_into(const void *src, void *dst) { *(__sn__Point *)dst = __sn__Point_copy((const __sn__Point *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Point *__sn__Point_alloc(void) {
+    return calloc(1, sizeof(__sn__Point));
+}
+
+static inline void __sn__Point_release(__sn__Point **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Point __attribute__((cleanup(__sn__Point_release)))
+
+static inline void __sn__Point_release_elem(void *p) { __sn__Point_release((__sn__Point **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Point_to_string(const __sn__Point *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Point { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Person (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__age;
+} __sn__Person;
+/* Value operations */
+static inline __sn__Person __sn__Person_copy(const __sn__Person *src) {
+    __sn__Person dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__age = src->__sn__age;
+    return dst;
+}
+
+static inline void __sn__Person_cleanup(__sn__Person *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Person __attribute__((cleanup(__sn__Person_cleanup)))
+
+static inline void __sn__Person_cleanup_elem(void *p) { __sn__Person_cleanup((__sn__Person *)p); }
+static inline void __sn__Person_copy_into(const void *src, void *dst) { *(__sn__Person *)dst = __sn__Person_copy((const __sn__Person *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Person *__sn__Person_alloc(void) {
+    return calloc(1, sizeof(__sn__Person));
+}
+
+static inline void __sn__Person_release(__sn__Person **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Person __attribute__((cleanup(__sn__Person_release)))
+
+static inline void __sn__Person_release_elem(void *p) { __sn__Person_release((__sn__Person **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Person_to_string(const __sn__Person *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Person { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "age: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__age);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: WithArray (as val) */
+typedef struct {
+    SnArray * __sn__values;
+    char * __sn__label;
+} __sn__WithArray;
+/* Value operations */
+static inline __sn__WithArray __sn__WithArray_copy(const __sn__WithArray *src) {
+    __sn__WithArray dst;
+    dst.__sn__values = sn_array_copy(src->__sn__values);
+    dst.__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    return dst;
+}
+
+static inline void __sn__WithArray_cleanup(__sn__WithArray *p) {
+    sn_cleanup_array(&p->__sn__values);
+    free(p->__sn__label);
+
+}
+
+#define sn_auto_WithArray __attribute__((cleanup(__sn__WithArray_cleanup)))
+
+static inline void __sn__WithArray_cleanup_elem(void *p) { __sn__WithArray_cleanup((__sn__WithArray *)p); }
+static inline void __sn__WithArray_copy_into(const void *src, void *dst) { *(__sn__WithArray *)dst = __sn__WithArray_copy((const __sn__WithArray *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__WithArray *__sn__WithArray_alloc(void) {
+    return calloc(1, sizeof(__sn__WithArray));
+}
+
+static inline void __sn__WithArray_release(__sn__WithArray **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__values);
+        free((*p)->__sn__label);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_WithArray __attribute__((cleanup(__sn__WithArray_release)))
+
+static inline void __sn__WithArray_release_elem(void *p) { __sn__WithArray_release((__sn__WithArray **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__WithArray_to_string(const __sn__WithArray *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "WithArray { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "values: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__values); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: WithArray2D (as val) */
+typedef struct {
+    SnArray * __sn__matrix;
+    char * __sn__name;
+} __sn__WithArray2D;
+/* Value operations */
+static inline __sn__WithArray2D __sn__WithArray2D_copy(const __sn__WithArray2D *src) {
+    __sn__WithArray2D dst;
+    dst.__sn__matrix = sn_array_copy(src->__sn__matrix);
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__WithArray2D_cleanup(__sn__WithArray2D *p) {
+    sn_cleanup_array(&p->__sn__matrix);
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_WithArray2D __attribute__((cleanup(__sn__WithArray2D_cleanup)))
+
+static inline void __sn__WithArray2D_cleanup_elem(void *p) { __sn__WithArray2D_cleanup((__sn__WithArray2D *)p); }
+static inline void __sn__WithArray2D_copy_into(const void *src, void *dst) { *(__sn__WithArray2D *)dst = __sn__WithArray2D_copy((const __sn__WithArray2D *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__WithArray2D *__sn__WithArray2D_alloc(void) {
+    return calloc(1, sizeof(__sn__WithArray2D));
+}
+
+static inline void __sn__WithArray2D_release(__sn__WithArray2D **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__matrix);
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_WithArray2D __attribute__((cleanup(__sn__WithArray2D_release)))
+
+static inline void __sn__WithArray2D_release_elem(void *p) { __sn__WithArray2D_release((__sn__WithArray2D **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__WithArray2D_to_string(const __sn__WithArray2D *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "WithArray2D { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "matrix: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__matrix); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Nested (as val) */
+typedef struct {
+    __sn__Point __sn__inner;
+    char * __sn__name;
+} __sn__Nested;
+/* Value operations */
+static inline __sn__Nested __sn__Nested_copy(const __sn__Nested *src) {
+    __sn__Nested dst;
+    dst.__sn__inner = __sn__Point_copy(&src->__sn__inner);
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    return dst;
+}
+
+static inline void __sn__Nested_cleanup(__sn__Nested *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_Nested __attribute__((cleanup(__sn__Nested_cleanup)))
+
+static inline void __sn__Nested_cleanup_elem(void *p) { __sn__Nested_cleanup((__sn__Nested *)p); }
+static inline void __sn__Nested_copy_into(const void *src, void *dst) { *(__sn__Nested *)dst = __sn__Nested_copy((const __sn__Nested *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Nested *__sn__Nested_alloc(void) {
+    return calloc(1, sizeof(__sn__Nested));
+}
+
+static inline void __sn__Nested_release(__sn__Nested **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Nested __attribute__((cleanup(__sn__Nested_release)))
+
+static inline void __sn__Nested_release_elem(void *p) { __sn__Nested_release((__sn__Nested **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Nested_to_string(const __sn__Nested *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Nested { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "inner: ");
+    { char *__fs__ = __sn__Point_to_string(&p->__sn__inner); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__Point __sn__makePoint(long long, long long);
+__sn__Person __sn__makePerson(char *, long long);
+__sn__WithArray __sn__makeWithArray(char *);
+__sn__WithArray __sn__makeEmptyArray();
+__sn__WithArray2D __sn__makeWithArray2D(char *);
+__sn__WithArray2D __sn__makeEmptyArray2D();
+__sn__Nested __sn__makeNested(char *);
+__sn__Nested __sn__makeEmptyNested();
+
+
+typedef struct {
+    long long arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+typedef struct {
+    char * arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_1__;
+void *__thread_wrapper_1__(void *arg);
+typedef struct {
+    char * arg0;
+    int _padding;
+} __ThreadArgs_2__;
+void *__thread_wrapper_2__(void *arg);
+typedef struct {
+    char * arg0;
+    int _padding;
+} __ThreadArgs_3__;
+void *__thread_wrapper_3__(void *arg);
+typedef struct {
+    char * arg0;
+    int _padding;
+} __ThreadArgs_4__;
+void *__thread_wrapper_4__(void *arg);
+typedef struct {
+    long long arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_5__;
+void *__thread_wrapper_5__(void *arg);
+
+
+#endif
@@ -0,0 +1,141 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__compute(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 2LL);}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__compute(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__compute(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__compute(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    long long __sn__result1 = 10LL;
+    
+    sn_auto_thread SnThread * __sn__result1__th__ = NULL;    bool __sn__shouldSpawn1 = true;
+    if (__sn__shouldSpawn1) {
+        (__sn__result1__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+            __args__->arg0 = 21LL;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(long long);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__result1__th__; __sn__result1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__result1 = *(long long *)__sync_th__->result; }
+        __sn__result1; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 1 (spawn executed): ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result1));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__result2 = 42LL;
+    
+    sn_auto_thread SnThread * __sn__result2__th__ = NULL;    bool __sn__shouldSpawn2 = false;
+    if (__sn__shouldSpawn2) {
+        (__sn__result2__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+            __args__->arg0 = 100LL;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(long long);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__result2__th__; __sn__result2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__result2 = *(long long *)__sync_th__->result; }
+        __sn__result2; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 2 (spawn not executed): ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result2));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__result3 = 0LL;
+    
+    sn_auto_thread SnThread * __sn__result3__th__ = NULL;    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 3LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if ((__sn__i == 1LL)) {
+                    (__sn__result3__th__ = ({
+                        SnThread *__th__ = sn_thread_create();
+                        __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+                        __args__->arg0 = 50LL;
+                        __th__->result = __args__;
+                        __th__->result_size = sizeof(long long);
+                        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+                        __th__;
+                    }));
+                    
+                }
+            }
+        }
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__result3__th__; __sn__result3__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__result3 = *(long long *)__sync_th__->result; }
+        __sn__result3; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 3 (spawn in loop): ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result3));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
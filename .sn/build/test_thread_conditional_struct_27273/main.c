@@ -0,0 +1,157 @@
+#include "sn_types.h"
+
+
+
+
+__sn__TestResult __sn__runTest(long long __sn__x) {
+
+    return (__sn__TestResult){ .__sn__value = sn_mul_long(__sn__x, 2LL), .__sn__ok = true };}
+
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__TestResult __result__ = __sn__runTest(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__TestResult));
+    *(__sn__TestResult *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__TestResult __result__ = __sn__runTest(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__TestResult));
+    *(__sn__TestResult *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__TestResult __result__ = __sn__runTest(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__TestResult));
+    *(__sn__TestResult *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    __sn__TestResult __sn__h1 = (__sn__TestResult){ .__sn__value = 0LL, .__sn__ok = false };
+    
+    sn_auto_thread SnThread * __sn__h1__th__ = NULL;    bool __sn__condition1 = true;
+    if (__sn__condition1) {
+        (__sn__h1__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+            __args__->arg0 = 21LL;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(__sn__TestResult);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__h1__th__; __sn__h1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__h1 = *(__sn__TestResult *)__sync_th__->result; }
+        __sn__h1; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 1: value=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__h1.__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ok=");
+            sn_auto_str char *__is_p3__ = sn_strdup((__sn__h1.__sn__ok) ? "true" : "false");
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    __sn__TestResult __sn__h2 = (__sn__TestResult){ .__sn__value = 99LL, .__sn__ok = true };
+    
+    sn_auto_thread SnThread * __sn__h2__th__ = NULL;    bool __sn__condition2 = false;
+    if (__sn__condition2) {
+        (__sn__h2__th__ = ({
+            SnThread *__th__ = sn_thread_create();
+            __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+            __args__->arg0 = 50LL;
+            __th__->result = __args__;
+            __th__->result_size = sizeof(__sn__TestResult);
+            pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+            __th__;
+        }));
+        
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__h2__th__; __sn__h2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__h2 = *(__sn__TestResult *)__sync_th__->result; }
+        __sn__h2; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 2: value=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__h2.__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ok=");
+            sn_auto_str char *__is_p3__ = sn_strdup((__sn__h2.__sn__ok) ? "true" : "false");
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    sn_auto_arr SnArray * __sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 3);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 2LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            __al__;
+        });
+    __sn__TestResult __sn__h3 = (__sn__TestResult){ .__sn__value = (-1LL), .__sn__ok = false };
+    
+    sn_auto_thread SnThread * __sn__h3__th__ = NULL;    {
+        SnArray *__arr_0__ = __sn__items;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__item = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                if ((__sn__item == 2LL)) {
+                    (__sn__h3__th__ = ({
+                        SnThread *__th__ = sn_thread_create();
+                        __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+                        __args__->arg0 = sn_mul_long(__sn__item, 10LL);
+                        __th__->result = __args__;
+                        __th__->result_size = sizeof(__sn__TestResult);
+                        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+                        __th__;
+                    }));
+                    
+                }
+            }
+        }
+    }
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__h3__th__; __sn__h3__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__h3 = *(__sn__TestResult *)__sync_th__->result; }
+        __sn__h3; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Test 3: value=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__h3.__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ok=");
+            sn_auto_str char *__is_p3__ = sn_strdup((__sn__h3.__sn__ok) ? "true" : "false");
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,93 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: TestResult (as val) */
+typedef struct {
+    long long __sn__value;
+    bool __sn__ok;
+} __sn__TestResult;
+/* Value operations */
+static inline __sn__TestResult __sn__TestResult_copy(const __sn__TestResult *src) {
+    __sn__TestResult dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__ok = src->__sn__ok;
+    return dst;
+}
+
+static inline void __sn__TestResult_cleanup(__sn__TestResult *p) {
+
+}
+
+#define sn_auto_TestResult __attribute__((cleanup(__sn__TestResult_cleanup)))
+
+static inline void __sn__TestResult_cleanup_elem(void *p) { __sn__TestResult_cleanup((__sn__TestResult *)p); }
+static inline void __sn__TestResult_copy_into(const void *src, void *dst) { *(__sn__TestResult *)dst = __sn__TestResult_copy((const __sn__TestResult *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__TestResult *__sn__TestResult_alloc(void) {
+    return calloc(1, sizeof(__sn__TestResult));
+}
+
+static inline void __sn__TestResult_release(__sn__TestResult **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_TestResult __attribute__((cleanup(__sn__TestResult_release)))
+
+static inline void __sn__TestResult_release_elem(void *p) { __sn__TestResult_release((__sn__TestResult **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__TestResult_to_string(const __sn__TestResult *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "TestResult { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "ok: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__ok ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+__sn__TestResult __sn__runTest(long long);
+
+
+typedef struct {
+    long long arg0;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+typedef struct {
+    long long arg0;
+    int _padding;
+} __ThreadArgs_1__;
+void *__thread_wrapper_1__(void *arg);
+typedef struct {
+    long long arg0;
+    int _padding;
+} __ThreadArgs_2__;
+void *__thread_wrapper_2__(void *arg);
+
+
+#endif
@@ -0,0 +1,112 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__worker(long long __sn__id) {
+
+    return sn_mul_long(__sn__id, 10LL);}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__worker(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__worker(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__worker(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    long long __sn__r1 = 0; sn_auto_thread SnThread * __sn__r1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = 1LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    ({
+        SnThread *__dt__ = __sn__r1__th__;
+        if (__dt__) {
+            __dt__->detached = 1;
+            pthread_detach(__dt__->thread);
+        }
+        (void)0;
+    });
+    
+    sn_println("detached r1");
+    
+    long long __sn__r2 = 0; sn_auto_thread SnThread * __sn__r2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+        __args__->arg0 = 2LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    long long __sn__r3 = 0; sn_auto_thread SnThread * __sn__r3__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+        __args__->arg0 = 3LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+        __th__;
+    });
+    ({
+        SnThread *__dt__ = __sn__r2__th__;
+        if (__dt__) {
+            __dt__->detached = 1;
+            pthread_detach(__dt__->thread);
+        }
+        (void)0;
+    });
+    
+    ({
+        SnThread *__dt__ = __sn__r3__th__;
+        if (__dt__) {
+            __dt__->detached = 1;
+            pthread_detach(__dt__->thread);
+        }
+        (void)0;
+    });
+    
+    sn_println("detached r2 and r3");
+    
+    sn_println("done");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__worker(long long __sn__id) {
+
+    return __sn__id;}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__worker(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, 5LL);
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                long long __sn__handle = 0; sn_auto_thread SnThread * __sn__handle__th__ = ({
+                    SnThread *__th__ = sn_thread_create();
+                    __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+                    __args__->arg0 = __sn__i;
+                    __th__->result = __args__;
+                    __th__->result_size = sizeof(long long);
+                    pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+                    __th__;
+                });
+                ({
+                    SnThread *__dt__ = __sn__handle__th__;
+                    if (__dt__) {
+                        __dt__->detached = 1;
+                        pthread_detach(__dt__->thread);
+                    }
+                    (void)0;
+                });
+                
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("spawned and detached ");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__i));
+                        sn_str_concat_multi(2, __is_p0__, __is_p1__);
+                    }); sn_println(__ps__); };
+                
+            }
+        }
+    }
+    sn_println("loop completed");
+    
+    fflush(stdout);
+    return 0;
+}
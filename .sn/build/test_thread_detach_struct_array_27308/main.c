@@ -0,0 +1,93 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__processTable(__sn__DataTable *__sn__table) {
+
+    return sn_array_length((*__sn__table).__sn__rows);}
+
+
+
+__sn__DataTable __sn__DataTable_create() {
+
+    sn_auto_arr SnArray * __sn__rows = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Row), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Row_cleanup_elem;
+            __al__->elem_copy = __sn__Row_copy_into;
+            __al__;
+        });
+
+    __sn__arr_push(&__sn__rows, (__sn__Row){ .__sn__cells = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("a") });
+            sn_array_push(__al__, &(char *){ strdup("b") });
+            __al__;
+        }) });
+    
+
+    __sn__arr_push(&__sn__rows, (__sn__Row){ .__sn__cells = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 2);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("c") });
+            sn_array_push(__al__, &(char *){ strdup("d") });
+            __al__;
+        }) });
+    
+
+    return (__sn__DataTable){ .__sn__rows = sn_array_copy(__sn__rows), .__sn__cursor = 0LL };}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__processTable(&args->arg0);
+    __sn__DataTable_cleanup(&args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_auto_DataTable __sn__DataTable __sn__table = __sn__DataTable_create();
+    long long __sn__handle = 0; sn_auto_thread SnThread * __sn__handle__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = __sn__DataTable_copy(&(__sn__table));
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    ({
+        SnThread *__dt__ = __sn__handle__th__;
+        if (__dt__) {
+            __dt__->detached = 1;
+            pthread_detach(__dt__->thread);
+        }
+        (void)0;
+    });
+    
+    sn_println("detached");
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("rows: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__table.__sn__rows)));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__fire_and_forget_work() {
+
+    sn_print("Fire-and-forget thread executed\n");
+    
+}
+
+
+void __sn__immediate_sync_work() {
+
+    sn_print("Immediate sync thread executed\n");
+    
+}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __sn__immediate_sync_work();
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __sn__fire_and_forget_work();
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    ({
+        sn_auto_thread SnThread *__sync_th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(void);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+        sn_thread_join(__sync_th__);
+        (void)0; })
+    ;
+    
+    sn_print("After immediate sync\n");
+    
+    ({
+        sn_auto_thread SnThread *__sync_th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(void);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+        sn_thread_join(__sync_th__);
+        (void)0; })
+    ;
+    
+    sn_print("After second sync\n");
+    
+    sn_print("SUCCESS: Both patterns completed\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include "sn_types.h"
+
+
+
+
+SnArray * __sn__thread_assign() {
+
+    sn_auto_arr SnArray * __sn__values = sn_array_range(0LL, 1024LL);
+
+    {
+        SnArray * __ret__ = __sn__values;
+        __sn__values = NULL;
+        return __ret__;
+    }}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__thread_assign();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    SnArray * __result__ = __sn__thread_assign();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(SnArray *));
+    *(SnArray * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+        sn_auto_thread SnThread *__sync_th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(SnArray *);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+        sn_thread_join(__sync_th__);
+        SnArray * __sync_val__ = *(SnArray * *)__sync_th__->result; __sync_val__; })
+    ;
+    ({
+        SnArray *__sn_tmp__ = ({
+        sn_auto_thread SnThread *__sync_th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(SnArray *);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+        sn_thread_join(__sync_th__);
+        SnArray * __sync_val__ = *(SnArray * *)__sync_th__->result; __sync_val__; })
+    ;
+        sn_cleanup_array(&__sn__arr);
+        __sn__arr = __sn_tmp__;
+        __sn__arr;
+    });
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_array_to_string(__sn__arr);
+            sn_str_concat_multi(1, __is_p0__);
+        }); sn_println(__ps__); };
+    
+    sn_println("Hello world!");
+    
+    fflush(stdout);
+    return 0;
+}
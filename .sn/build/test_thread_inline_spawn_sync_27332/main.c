@@ -0,0 +1,139 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__compute_int() {
+
+    return 42LL;}
+
+
+double __sn__compute_double() {
+
+    return 3.1400000000000001;}
+
+
+char * __sn__compute_string() {
+
+    return strdup("hello");}
+
+
+void __sn__void_work() {
+
+    sn_print("Void work executed\n");
+    
+}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    long long __result__ = __sn__compute_int();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    double __result__ = __sn__compute_double();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(double));
+    *(double *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    char * __result__ = __sn__compute_string();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(char *));
+    *(char * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_3__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __sn__void_work();
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    long long __sn__result_int = ({
+        sn_auto_thread SnThread *__sync_th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+        sn_thread_join(__sync_th__);
+        long long __sync_val__ = *(long long *)__sync_th__->result; __sync_val__; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Int result: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result_int));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    double __sn__result_double = ({
+        sn_auto_thread SnThread *__sync_th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(double);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+        sn_thread_join(__sync_th__);
+        double __sync_val__ = *(double *)__sync_th__->result; __sync_val__; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Double result: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__result_double));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__result_string = ({
+        sn_auto_thread SnThread *__sync_th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(char *);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+        __th__;
+    });
+        sn_thread_join(__sync_th__);
+        char * __sync_val__ = *(char * *)__sync_th__->result; __sync_val__; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("String result: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__result_string);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    ({
+        sn_auto_thread SnThread *__sync_th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(void);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_3__, __th__);
+        __th__;
+    });
+        sn_thread_join(__sync_th__);
+        (void)0; })
+    ;
+    
+    sn_print("After void sync\n");
+    
+    if ((__sn__result_int == 42LL)) {
+        if ((strcmp(__sn__result_string, "hello") == 0)) {
+            sn_print("SUCCESS: All inline spawn-sync results correct\n");
+            
+        } else {
+            sn_print("FAILURE: String result incorrect\n");
+            
+        }
+    } else {
+        sn_print("FAILURE: Int result incorrect\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,230 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__sum_array(SnArray * __sn__arr) {
+
+    long long __sn__total = 0LL;
+
+    {
+        SnArray *__arr_0__ = __sn__arr;
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__n = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                (__sn__total = sn_add_long(__sn__total, __sn__n));
+                
+            }
+        }
+    }
+
+    return __sn__total;}
+
+
+long long __sn__get_first(SnArray * __sn__arr) {
+
+    return (((long long *)__sn__arr->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);}
+
+
+long long __sn__get_last(SnArray * __sn__arr) {
+
+    return (((long long *)__sn__arr->data)[({ long long __ai__ = sn_sub_long(sn_array_length(__sn__arr), 1LL); __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]);}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__sum_array(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__get_first(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__get_last(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_auto_arr SnArray * __sn__data = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 5);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 10LL });
+            sn_array_push(__al__, &(long long){ 20LL });
+            sn_array_push(__al__, &(long long){ 30LL });
+            sn_array_push(__al__, &(long long){ 40LL });
+            sn_array_push(__al__, &(long long){ 50LL });
+            __al__;
+        });
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Initial data: length = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__data)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__r1 = 0; sn_auto_thread SnThread * __sn__r1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = __sn__data;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    long long __sn__r2 = 0; sn_auto_thread SnThread * __sn__r2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+        __args__->arg0 = __sn__data;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    long long __sn__r3 = 0; sn_auto_thread SnThread * __sn__r3__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+        __args__->arg0 = __sn__data;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+        __th__;
+    });
+    sn_print("Spawned 3 threads capturing same array\n");
+    
+    long long __sn__len = sn_array_length(__sn__data);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Read while pending: length = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__len));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__sum = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__r1__th__; __sn__r1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r1 = *(long long *)__sync_th__->result; }
+        __sn__r1; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After first sync: sum = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__first_check = (((long long *)__sn__data->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__data->len : __ai__; })]);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Read after first sync: data[0] = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__first_check));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__first = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__r2__th__; __sn__r2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r2 = *(long long *)__sync_th__->result; }
+        __sn__r2; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After second sync: first = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__first));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__last = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__r3__th__; __sn__r3__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r3 = *(long long *)__sync_th__->result; }
+        __sn__r3; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After third sync: last = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__last));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    ((long long *)__sn__data->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__data->len : __ai__; })] = 100LL;
+    
+    __sn__arr_push(&__sn__data, 60LL);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("After writes: data[0] = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)((((long long *)__sn__data->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__data->len : __ai__; })])));
+            sn_auto_str char *__is_p2__ = sn_strdup(", length = ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__data)));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__sum == 150LL)) {
+        if ((__sn__first == 10LL)) {
+            if ((__sn__last == 50LL)) {
+                if (((((long long *)__sn__data->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__data->len : __ai__; })]) == 100LL)) {
+                    if ((sn_array_length(__sn__data) == 6LL)) {
+                        sn_print("SUCCESS: Multiple thread spawn works correctly\n");
+                        
+                    } else {
+                        sn_print("FAILURE: push didn't work after sync\n");
+                        
+                    }
+                } else {
+                    sn_print("FAILURE: write didn't work after sync\n");
+                    
+                }
+            } else {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: last expected 50, got ");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__last));
+                        sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                        sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                    }); sn_print(__ps__); };
+                
+            }
+        } else {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: first expected 10, got ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__first));
+                    sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                    sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                }); sn_print(__ps__); };
+            
+        }
+    } else {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: sum expected 150, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include "sn_types.h"
+__sn__NativeResult compute_native(long long);
+
+
+
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__NativeResult __result__ = compute_native(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__NativeResult));
+    *(__sn__NativeResult *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__NativeResult __result__ = compute_native(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__NativeResult));
+    *(__sn__NativeResult *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    __sn__NativeResult __sn__r1 = {0}; sn_auto_thread SnThread * __sn__r1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = 10LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__NativeResult);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    __sn__NativeResult __sn__r2 = {0}; sn_auto_thread SnThread * __sn__r2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+        __args__->arg0 = 20LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__NativeResult);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    ({
+        { sn_auto_thread SnThread *__sync_th__ = __sn__r1__th__; __sn__r1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r1 = *(__sn__NativeResult *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__r2__th__; __sn__r2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r2 = *(__sn__NativeResult *)__sync_th__->result; } }
+        (void)0; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("r1=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r1.__sn__count));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,257 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__add(long long __sn__a, long long __sn__b) {
+
+    return sn_add_long(__sn__a, __sn__b);}
+
+
+long long __sn__multiply(long long __sn__a, long long __sn__b) {
+
+    return sn_mul_long(__sn__a, __sn__b);}
+
+
+__sn__Result __sn__makeResult(long long __sn__x, long long __sn__y) {
+
+    return (__sn__Result){ .__sn__x = __sn__x, .__sn__y = __sn__y };}
+
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__add(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__multiply(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Result __result__ = __sn__makeResult(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Result));
+    *(__sn__Result *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_3__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_3__ *args = (__ThreadArgs_3__ *)__th__->result;
+    __ThreadArgs_3__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__add(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_4__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_4__ *args = (__ThreadArgs_4__ *)__th__->result;
+    __ThreadArgs_4__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__add(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_5__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_5__ *args = (__ThreadArgs_5__ *)__th__->result;
+    __ThreadArgs_5__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__add(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_6__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_6__ *args = (__ThreadArgs_6__ *)__th__->result;
+    __ThreadArgs_6__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__add(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    long long __sn__sum = 0; sn_auto_thread SnThread * __sn__sum__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = 10LL;
+        __args__->arg1 = 20LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    long long __sn__product = 0; sn_auto_thread SnThread * __sn__product__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+        __args__->arg0 = 5LL;
+        __args__->arg1 = 6LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__sum__th__; __sn__sum__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__sum = *(long long *)__sync_th__->result; }
+        __sn__sum; })
+    ;
+    
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__product__th__; __sn__product__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__product = *(long long *)__sync_th__->result; }
+        __sn__product; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("sum: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p2__ = sn_strdup(", product: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__product));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    __sn__Result __sn__r = {0}; sn_auto_thread SnThread * __sn__r__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+        __args__->arg0 = 100LL;
+        __args__->arg1 = 200LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__Result);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+        __th__;
+    });
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__r__th__; __sn__r__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r = *(__sn__Result *)__sync_th__->result; }
+        __sn__r; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("result: x=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", y=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__r.__sn__y));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__immediate = ({
+        sn_auto_thread SnThread *__sync_th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_3__ *__args__ = malloc(sizeof(__ThreadArgs_3__));
+        __args__->arg0 = 3LL;
+        __args__->arg1 = 4LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_3__, __th__);
+        __th__;
+    });
+        sn_thread_join(__sync_th__);
+        long long __sync_val__ = *(long long *)__sync_th__->result; __sync_val__; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("immediate: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__immediate));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_println(__ps__); };
+    
+    long long __sn__a = 0; sn_auto_thread SnThread * __sn__a__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_4__ *__args__ = malloc(sizeof(__ThreadArgs_4__));
+        __args__->arg0 = 1LL;
+        __args__->arg1 = 2LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_4__, __th__);
+        __th__;
+    });
+    long long __sn__b = 0; sn_auto_thread SnThread * __sn__b__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_5__ *__args__ = malloc(sizeof(__ThreadArgs_5__));
+        __args__->arg0 = 3LL;
+        __args__->arg1 = 4LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_5__, __th__);
+        __th__;
+    });
+    long long __sn__c = 0; sn_auto_thread SnThread * __sn__c__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_6__ *__args__ = malloc(sizeof(__ThreadArgs_6__));
+        __args__->arg0 = 5LL;
+        __args__->arg1 = 6LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_6__, __th__);
+        __th__;
+    });
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__a__th__; __sn__a__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__a = *(long long *)__sync_th__->result; }
+        __sn__a; })
+    ;
+    
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__b__th__; __sn__b__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__b = *(long long *)__sync_th__->result; }
+        __sn__b; })
+    ;
+    
+    ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__c__th__; __sn__c__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__c = *(long long *)__sync_th__->result; }
+        __sn__c; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("a=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__a));
+            sn_auto_str char *__is_p2__ = sn_strdup(", b=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__b));
+            sn_auto_str char *__is_p4__ = sn_strdup(", c=");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%lld", (long long)(__sn__c));
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
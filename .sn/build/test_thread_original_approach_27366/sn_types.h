@@ -0,0 +1,122 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Result (as val) */
+typedef struct {
+    long long __sn__x;
+    long long __sn__y;
+} __sn__Result;
+/* Value operations */
+static inline __sn__Result __sn__Result_copy(const __sn__Result *src) {
+    __sn__Result dst;
+    dst.__sn__x = src->__sn__x;
+    dst.__sn__y = src->__sn__y;
+    return dst;
+}
+
+static inline void __sn__Result_cleanup(__sn__Result *p) {
+
+}
+
+#define sn_auto_Result __attribute__((cleanup(__sn__Result_cleanup)))
+
+static inline void __sn__Result_cleanup_elem(void *p) { __sn__Result_cleanup((__sn__Result *)p); }
+static inline void __sn__Result_copy_into(const void *src, void *dst) { *(__sn__Result *)dst = __sn__Result_copy((const __sn__Result *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Result *__sn__Result_alloc(void) {
+    return calloc(1, sizeof(__sn__Result));
+}
+
+static inline void __sn__Result_release(__sn__Result **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Result __attribute__((cleanup(__sn__Result_release)))
+
+static inline void __sn__Result_release_elem(void *p) { __sn__Result_release((__sn__Result **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Result_to_string(const __sn__Result *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Result { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "x: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__x);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "y: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+long long __sn__add(long long, long long);
+long long __sn__multiply(long long, long long);
+__sn__Result __sn__makeResult(long long, long long);
+
+
+typedef struct {
+    long long arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+typedef struct {
+    long long arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_1__;
+void *__thread_wrapper_1__(void *arg);
+typedef struct {
+    long long arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_2__;
+void *__thread_wrapper_2__(void *arg);
+typedef struct {
+    long long arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_3__;
+void *__thread_wrapper_3__(void *arg);
+typedef struct {
+    long long arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_4__;
+void *__thread_wrapper_4__(void *arg);
+typedef struct {
+    long long arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_5__;
+void *__thread_wrapper_5__(void *arg);
+typedef struct {
+    long long arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_6__;
+void *__thread_wrapper_6__(void *arg);
+
+
+#endif
@@ -0,0 +1,170 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__churn(__sn__Holder * __sn__h, long long __sn__rounds) {
+
+    sn_auto_arr SnArray * __sn__kept = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Counter *), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Counter_release_elem;
+            __al__->elem_copy = __sn__Counter_retain_into;
+            __al__;
+        });
+
+    {
+        for (long long __sn__i = 0LL; sn_lt_long(__sn__i, __sn__rounds); __sn__i = __sn__i + 1LL) {
+            sn_auto_Counter __sn__Counter * __sn__c = __sn__Counter_retain(__sn__h->__sn__counter);
+            __sn__arr_push(&__sn__kept, ({ __sn__Counter * __mv__ = __sn__c; __sn__c = NULL; __mv__; }));
+            
+            if (sn_gt_long(sn_array_length(__sn__kept), 16LL)) {
+                ({
+                    SnArray *__sn_tmp__ = ({
+                        SnArray *__al__ = sn_array_new(sizeof(__sn__Counter *), 0);
+                        __al__->elem_tag = SN_TAG_STRUCT;
+                
+                        __al__->elem_release = __sn__Counter_release_elem;
+                        __al__->elem_copy = __sn__Counter_retain_into;
+                        __al__;
+                    });
+                    sn_cleanup_array(&__sn__kept);
+                    __sn__kept = __sn_tmp__;
+                    __sn__kept;
+                });
+                
+            }
+        }
+    }
+
+    return __sn__h->__sn__label;}
+
+
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__churn(args->arg0, args->arg1);
+    __sn__Holder_release(&args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__churn(args->arg0, args->arg1);
+    __sn__Holder_release(&args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__churn(args->arg0, args->arg1);
+    __sn__Holder_release(&args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_3__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_3__ *args = (__ThreadArgs_3__ *)__th__->result;
+    __ThreadArgs_3__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__churn(args->arg0, args->arg1);
+    __sn__Holder_release(&args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_auto_Holder __sn__Holder * __sn__h = ({
+        __sn__Holder *__tmp__ = __sn__Holder__new();
+        __tmp__->__sn__counter = ({
+        __sn__Counter *__tmp__ = __sn__Counter__new();
+        __tmp__->__sn__hits = 0LL;
+        __tmp__;
+    });
+        __tmp__->__sn__label = 7LL;
+        __tmp__;
+    });
+    long long __sn__r1 = 0; sn_auto_thread SnThread * __sn__r1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = __sn__Holder_retain(__sn__h);
+        __args__->arg1 = 20000LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    long long __sn__r2 = 0; sn_auto_thread SnThread * __sn__r2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+        __args__->arg0 = __sn__Holder_retain(__sn__h);
+        __args__->arg1 = 20000LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    long long __sn__r3 = 0; sn_auto_thread SnThread * __sn__r3__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+        __args__->arg0 = __sn__Holder_retain(__sn__h);
+        __args__->arg1 = 20000LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+        __th__;
+    });
+    long long __sn__r4 = 0; sn_auto_thread SnThread * __sn__r4__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_3__ *__args__ = malloc(sizeof(__ThreadArgs_3__));
+        __args__->arg0 = __sn__Holder_retain(__sn__h);
+        __args__->arg1 = 20000LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_3__, __th__);
+        __th__;
+    });
+    ({
+        { sn_auto_thread SnThread *__sync_th__ = __sn__r1__th__; __sn__r1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r1 = *(long long *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__r2__th__; __sn__r2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r2 = *(long long *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__r3__th__; __sn__r3__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r3 = *(long long *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__r4__th__; __sn__r4__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__r4 = *(long long *)__sync_th__->result; } }
+        (void)0; })
+    ;
+    
+    printf("%lld\n", (long long)(sn_add_long(sn_add_long(sn_add_long(__sn__r1, __sn__r2), __sn__r3), __sn__r4)));
+    
+    printf("%lld\n", (long long)(__sn__h->__sn__counter->__sn__hits));
+    
+    fflush(stdout);
+    return 0;
+}
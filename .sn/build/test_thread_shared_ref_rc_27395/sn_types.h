@@ -0,0 +1,151 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Counter (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    long long __sn__hits;
+} __sn__Counter;
+
+
+static inline __sn__Counter *__sn__Counter__new(void) {
+    __sn__Counter *p = calloc(1, sizeof(__sn__Counter));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Counter *__sn__Counter_retain(__sn__Counter *p) {
+    if (p) sn_rc_inc_atomic(&p->__rc__);
+    return p;
+}
+
+static inline void __sn__Counter_release(__sn__Counter **p) {
+    if (*p && sn_rc_dec_atomic(&(*p)->__rc__)) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Counter *__sn__Counter_copy(const __sn__Counter *src) {
+    __sn__Counter *dst = calloc(1, sizeof(__sn__Counter));
+    dst->__rc__ = 1;
+    dst->__sn__hits = src->__sn__hits;
+    return dst;
+}
+
+#define sn_auto_Counter __attribute__((cleanup(__sn__Counter_release)))
+#define sn_auto_ref_Counter __attribute__((cleanup(__sn__Counter_release)))
+
+static inline void __sn__Counter_release_elem(void *p) { __sn__Counter_release((__sn__Counter **)p); }
+static inline void __sn__Counter_retain_into(const void *src, void *dst) { *(__sn__Counter **)dst = __sn__Counter_retain(*(__sn__Counter *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Counter_to_string(const __sn__Counter *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Counter { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "hits: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__hits);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+/* Struct: Holder (as ref — refcounted) */
+typedef struct {
+    int __rc__;
+    __sn__Counter * __sn__counter;
+    long long __sn__label;
+} __sn__Holder;
+
+
+static inline __sn__Holder *__sn__Holder__new(void) {
+    __sn__Holder *p = calloc(1, sizeof(__sn__Holder));
+    p->__rc__ = 1;
+    return p;
+}
+
+static inline __sn__Holder *__sn__Holder_retain(__sn__Holder *p) {
+    if (p) sn_rc_inc_atomic(&p->__rc__);
+    return p;
+}
+
+static inline void __sn__Holder_release(__sn__Holder **p) {
+    if (*p && sn_rc_dec_atomic(&(*p)->__rc__)) {
+        __sn__Counter_release(&(*p)->__sn__counter);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+static inline __sn__Holder *__sn__Holder_copy(const __sn__Holder *src) {
+    __sn__Holder *dst = calloc(1, sizeof(__sn__Holder));
+    dst->__rc__ = 1;
+    dst->__sn__counter = __sn__Counter_retain(src->__sn__counter);
+    dst->__sn__label = src->__sn__label;
+    return dst;
+}
+
+#define sn_auto_Holder __attribute__((cleanup(__sn__Holder_release)))
+#define sn_auto_ref_Holder __attribute__((cleanup(__sn__Holder_release)))
+
+static inline void __sn__Holder_release_elem(void *p) { __sn__Holder_release((__sn__Holder **)p); }
+static inline void __sn__Holder_retain_into(const void *src, void *dst) { *(__sn__Holder **)dst = __sn__Holder_retain(*(__sn__Holder *const *)src); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Holder_to_string(const __sn__Holder *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Holder { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "counter: ");
+    { char *__fs__ = __sn__Counter_to_string(p->__sn__counter); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "label: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__label);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+long long __sn__churn(__sn__Holder *, long long);
+
+
+typedef struct {
+    __sn__Holder * arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+typedef struct {
+    __sn__Holder * arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_1__;
+void *__thread_wrapper_1__(void *arg);
+typedef struct {
+    __sn__Holder * arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_2__;
+void *__thread_wrapper_2__(void *arg);
+typedef struct {
+    __sn__Holder * arg0;
+    long long arg1;
+    int _padding;
+} __ThreadArgs_3__;
+void *__thread_wrapper_3__(void *arg);
+
+
+#endif
@@ -0,0 +1,71 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__Server_handleClient(__sn__Server *__sn__self, long long __sn__client) {
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Handling client: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__client));
+            sn_auto_str char *__is_p2__ = sn_strdup(" with value: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)(__sn__self->__sn__value));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+
+    return sn_mul_long(__sn__client, __sn__self->__sn__value);}
+
+long long __sn__Server_run(__sn__Server *__sn__self) {
+
+    long long __sn__result = 0; sn_auto_thread SnThread * __sn__result__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->self_arg = __sn__self;
+        __args__->arg0 = 42LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+
+    return ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__result__th__; __sn__result__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__result = *(long long *)__sync_th__->result; }
+        __sn__result; })
+    ;}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    long long __result__ = __sn__Server_handleClient(args->self_arg, args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    __sn__Server __sn__server = (__sn__Server){ .__sn__value = 10LL };
+    long long __sn__result = __sn__Server_run(&__sn__server);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Result: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__result == 420LL)) {
+        sn_print("SUCCESS: Thread spawn with self method works correctly\n");
+        
+    } else {
+        sn_print("FAILURE: Expected 420, got different result\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
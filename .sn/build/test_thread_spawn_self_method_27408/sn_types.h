@@ -0,0 +1,80 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Server (as val) */
+typedef struct {
+    long long __sn__value;
+} __sn__Server;
+/* Value operations */
+static inline __sn__Server __sn__Server_copy(const __sn__Server *src) {
+    __sn__Server dst;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Server_cleanup(__sn__Server *p) {
+
+}
+
+#define sn_auto_Server __attribute__((cleanup(__sn__Server_cleanup)))
+
+static inline void __sn__Server_cleanup_elem(void *p) { __sn__Server_cleanup((__sn__Server *)p); }
+static inline void __sn__Server_copy_into(const void *src, void *dst) { *(__sn__Server *)dst = __sn__Server_copy((const __sn__Server *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Server *__sn__Server_alloc(void) {
+    return calloc(1, sizeof(__sn__Server));
+}
+
+static inline void __sn__Server_release(__sn__Server **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Server __attribute__((cleanup(__sn__Server_release)))
+
+static inline void __sn__Server_release_elem(void *p) { __sn__Server_release((__sn__Server **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Server_to_string(const __sn__Server *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Server { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+
+long long __sn__Server_handleClient(__sn__Server *, long long);
+long long __sn__Server_run(__sn__Server *);
+
+typedef struct {
+    __sn__Server * self_arg;
+    long long arg0;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+
+
+#endif
@@ -0,0 +1,133 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__processTable(__sn__DataTable *__sn__table) {
+
+    sn_auto_str char * __sn__result = strdup("");
+
+    {
+        sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, sn_array_length((*__sn__table).__sn__rows));
+        long long __len_0__ = __arr_0__->len;
+        for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+            long long __sn__i = ((long long *)__arr_0__->data)[__idx_0__];
+            {
+                sn_auto_Row __sn__Row __sn__row = __sn__Row_copy(&(((__sn__Row *)(*__sn__table).__sn__rows->data)[({ long long __ai__ = __sn__i; __ai__ < 0 ? __ai__ + (*__sn__table).__sn__rows->len : __ai__; })]));
+                {
+                    sn_auto_arr SnArray *__arr_0__ = sn_array_range(0LL, sn_array_length(__sn__row.__sn__cells));
+                    long long __len_0__ = __arr_0__->len;
+                    for (long long __idx_0__ = 0; __idx_0__ < __len_0__; __idx_0__++) {
+                        long long __sn__j = ((long long *)__arr_0__->data)[__idx_0__];
+                        {
+                            if (sn_gt_long(sn_str_length(__sn__result), 0LL)) {
+                                ({
+                                    char *__sn_tmp__ = ({
+                                        sn_auto_str char *__is_p0__ = sn_strdup(__sn__result);
+                                        sn_auto_str char *__is_p1__ = sn_strdup(",");
+                                        sn_auto_str char *__is_p2__ = sn_strdup((((char * *)__sn__row.__sn__cells->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__row.__sn__cells->len : __ai__; })]));
+                                        sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                                    });
+                                    free(__sn__result);
+                                    __sn__result = __sn_tmp__;
+                                    __sn__result;
+                                });
+                                
+                            } else {
+                                ({
+                                    char *__sn_tmp__ = strdup((((char * *)__sn__row.__sn__cells->data)[({ long long __ai__ = __sn__j; __ai__ < 0 ? __ai__ + __sn__row.__sn__cells->len : __ai__; })]));
+                                    free(__sn__result);
+                                    __sn__result = __sn_tmp__;
+                                    __sn__result;
+                                });
+                                
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    {
+        char * __ret__ = __sn__result;
+        __sn__result = NULL;
+        return __ret__;
+    }}
+
+
+
+__sn__DataTable __sn__DataTable_create() {
+
+    sn_auto_arr SnArray * __sn__rows = ({
+            SnArray *__al__ = sn_array_new(sizeof(__sn__Row), 0);
+            __al__->elem_tag = SN_TAG_STRUCT;
+    
+            __al__->elem_release = __sn__Row_cleanup_elem;
+            __al__->elem_copy = __sn__Row_copy_into;
+            __al__;
+        });
+
+    __sn__arr_push(&__sn__rows, (__sn__Row){ .__sn__cells = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("a") });
+            sn_array_push(__al__, &(char *){ strdup("b") });
+            sn_array_push(__al__, &(char *){ strdup("c") });
+            __al__;
+        }) });
+    
+
+    __sn__arr_push(&__sn__rows, (__sn__Row){ .__sn__cells = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("d") });
+            sn_array_push(__al__, &(char *){ strdup("e") });
+            sn_array_push(__al__, &(char *){ strdup("f") });
+            __al__;
+        }) });
+    
+
+    return (__sn__DataTable){ .__sn__rows = sn_array_copy(__sn__rows), .__sn__cursor = 0LL };}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    char * __result__ = __sn__processTable(&args->arg0);
+    __sn__DataTable_cleanup(&args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(char *));
+    *(char * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_auto_DataTable __sn__DataTable __sn__table = __sn__DataTable_create();
+    sn_auto_str char * __sn__handle = NULL; sn_auto_thread SnThread * __sn__handle__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = __sn__DataTable_copy(&(__sn__table));
+        __th__->result = __args__;
+        __th__->result_size = sizeof(char *);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    sn_auto_str char * __sn__result = strdup(({
+        sn_auto_thread SnThread *__sync_th__ = __sn__handle__th__; __sn__handle__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); free(__sn__handle); __sn__handle = *(char * *)__sync_th__->result; }
+        __sn__handle; })
+    );
+    sn_println(__sn__result);
+    
+    fflush(stdout);
+    return 0;
+}
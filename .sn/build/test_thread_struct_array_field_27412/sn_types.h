@@ -0,0 +1,136 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Row (as val) */
+typedef struct {
+    SnArray * __sn__cells;
+} __sn__Row;
+/* Value operations */
+static inline __sn__Row __sn__Row_copy(const __sn__Row *src) {
+    __sn__Row dst;
+    dst.__sn__cells = sn_array_copy(src->__sn__cells);
+    return dst;
+}
+
+static inline void __sn__Row_cleanup(__sn__Row *p) {
+    sn_cleanup_array(&p->__sn__cells);
+
+}
+
+#define sn_auto_Row __attribute__((cleanup(__sn__Row_cleanup)))
+
+static inline void __sn__Row_cleanup_elem(void *p) { __sn__Row_cleanup((__sn__Row *)p); }
+static inline void __sn__Row_copy_into(const void *src, void *dst) { *(__sn__Row *)dst = __sn__Row_copy((const __sn__Row *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Row *__sn__Row_alloc(void) {
+    return calloc(1, sizeof(__sn__Row));
+}
+
+static inline void __sn__Row_release(__sn__Row **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__cells);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Row __attribute__((cleanup(__sn__Row_release)))
+
+static inline void __sn__Row_release_elem(void *p) { __sn__Row_release((__sn__Row **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Row_to_string(const __sn__Row *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Row { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "cells: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__cells); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: DataTable (as val) */
+typedef struct {
+    SnArray * __sn__rows;
+    long long __sn__cursor;
+} __sn__DataTable;
+/* Value operations */
+static inline __sn__DataTable __sn__DataTable_copy(const __sn__DataTable *src) {
+    __sn__DataTable dst;
+    dst.__sn__rows = sn_array_copy(src->__sn__rows);
+    dst.__sn__cursor = src->__sn__cursor;
+    return dst;
+}
+
+static inline void __sn__DataTable_cleanup(__sn__DataTable *p) {
+    sn_cleanup_array(&p->__sn__rows);
+
+}
+
+#define sn_auto_DataTable __attribute__((cleanup(__sn__DataTable_cleanup)))
+
+static inline void __sn__DataTable_cleanup_elem(void *p) { __sn__DataTable_cleanup((__sn__DataTable *)p); }
+static inline void __sn__DataTable_copy_into(const void *src, void *dst) { *(__sn__DataTable *)dst = __sn__DataTable_copy((const __sn__DataTable *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__DataTable *__sn__DataTable_alloc(void) {
+    return calloc(1, sizeof(__sn__DataTable));
+}
+
+static inline void __sn__DataTable_release(__sn__DataTable **p) {
+    if (*p) {
+        sn_cleanup_array(&(*p)->__sn__rows);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_DataTable __attribute__((cleanup(__sn__DataTable_release)))
+
+static inline void __sn__DataTable_release_elem(void *p) { __sn__DataTable_release((__sn__DataTable **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__DataTable_to_string(const __sn__DataTable *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "DataTable { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "rows: ");
+    { char *__fs__ = sn_array_to_string(p->__sn__rows); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "cursor: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__cursor);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+char * __sn__processTable(__sn__DataTable *);
+
+__sn__DataTable __sn__DataTable_create();
+
+typedef struct {
+    __sn__DataTable arg0;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+
+
+#endif
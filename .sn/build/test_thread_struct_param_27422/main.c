@@ -0,0 +1,51 @@
+#include "sn_types.h"
+
+
+
+
+char * __sn__processConfig(__sn__TestConfig *__sn__config) {
+
+    return ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Processed ");
+            sn_auto_str char *__is_p1__ = sn_strdup((*__sn__config).__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup(" with value ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%lld", (long long)((*__sn__config).__sn__value));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        });}
+
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    char * __result__ = __sn__processConfig(&args->arg0);
+    __sn__TestConfig_cleanup(&args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(char *));
+    *(char * *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    sn_auto_TestConfig __sn__TestConfig __sn__config = (__sn__TestConfig){ .__sn__name = strdup("test"), .__sn__value = 42LL };
+    sn_auto_str char * __sn__result = NULL; sn_auto_thread SnThread * __sn__result__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = __sn__TestConfig_copy(&(__sn__config));
+        __th__->result = __args__;
+        __th__->result_size = sizeof(char *);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    sn_auto_str char * __sn__output = strdup(({
+        sn_auto_thread SnThread *__sync_th__ = __sn__result__th__; __sn__result__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); free(__sn__result); __sn__result = *(char * *)__sync_th__->result; }
+        __sn__result; })
+    );
+    sn_println(__sn__output);
+    
+    fflush(stdout);
+    return 0;
+}
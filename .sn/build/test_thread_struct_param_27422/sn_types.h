@@ -0,0 +1,85 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: TestConfig (as val) */
+typedef struct {
+    char * __sn__name;
+    long long __sn__value;
+} __sn__TestConfig;
+/* Value operations */
+static inline __sn__TestConfig __sn__TestConfig_copy(const __sn__TestConfig *src) {
+    __sn__TestConfig dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__TestConfig_cleanup(__sn__TestConfig *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_TestConfig __attribute__((cleanup(__sn__TestConfig_cleanup)))
+
+static inline void __sn__TestConfig_cleanup_elem(void *p) { __sn__TestConfig_cleanup((__sn__TestConfig *)p); }
+static inline void __sn__TestConfig_copy_into(const void *src, void *dst) { *(__sn__TestConfig *)dst = __sn__TestConfig_copy((const __sn__TestConfig *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__TestConfig *__sn__TestConfig_alloc(void) {
+    return calloc(1, sizeof(__sn__TestConfig));
+}
+
+static inline void __sn__TestConfig_release(__sn__TestConfig **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_TestConfig __attribute__((cleanup(__sn__TestConfig_release)))
+
+static inline void __sn__TestConfig_release_elem(void *p) { __sn__TestConfig_release((__sn__TestConfig **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__TestConfig_to_string(const __sn__TestConfig *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "TestConfig { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+
+char * __sn__processConfig(__sn__TestConfig *);
+
+
+typedef struct {
+    __sn__TestConfig arg0;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+
+
+#endif
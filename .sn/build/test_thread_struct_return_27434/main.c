@@ -0,0 +1,133 @@
+#include "sn_types.h"
+
+
+
+
+__sn__Result __sn__compute() {
+
+    return (__sn__Result){ .__sn__value = 42LL, .__sn__ok = true };}
+
+
+__sn__Point __sn__calculate_point(double __sn__x, double __sn__y) {
+
+    return (__sn__Point){ .__sn__x = sn_mul_double(__sn__x, 2.0), .__sn__y = sn_mul_double(__sn__y, 3.0) };}
+
+
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    __sn__Result __result__ = __sn__compute();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Result));
+    *(__sn__Result *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Point __result__ = __sn__calculate_point(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Point));
+    *(__sn__Point *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    __sn__Result __result__ = __sn__compute();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Result));
+    *(__sn__Result *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    __sn__Result __sn__h = {0}; sn_auto_thread SnThread * __sn__h__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(__sn__Result);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    __sn__Result __sn__r = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__h__th__; __sn__h__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__h = *(__sn__Result *)__sync_th__->result; }
+        __sn__h; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Result value: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__r.__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ok: ");
+            sn_auto_str char *__is_p3__ = sn_strdup((__sn__r.__sn__ok) ? "true" : "false");
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if (((__sn__r.__sn__value == 42LL) && __sn__r.__sn__ok)) {
+        sn_print("SUCCESS: Simple struct return works\n");
+        
+    } else {
+        sn_print("FAILURE: Simple struct return failed\n");
+        
+    }
+    __sn__Point __sn__h2 = {0}; sn_auto_thread SnThread * __sn__h2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+        __args__->arg0 = 5.0;
+        __args__->arg1 = 10.0;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__Point);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    __sn__Point __sn__p = ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__h2__th__; __sn__h2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__h2 = *(__sn__Point *)__sync_th__->result; }
+        __sn__h2; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Point x: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%.5f", (double)(__sn__p.__sn__x));
+            sn_auto_str char *__is_p2__ = sn_strdup(", y: ");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__p.__sn__y));
+            sn_auto_str char *__is_p4__ = sn_strdup("\n");
+            sn_str_concat_multi(5, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__);
+        }); sn_print(__ps__); };
+    
+    if (((__sn__p.__sn__x == 10.0) && (__sn__p.__sn__y == 30.0))) {
+        sn_print("SUCCESS: Double field struct return works\n");
+        
+    } else {
+        sn_print("FAILURE: Double field struct return failed\n");
+        
+    }
+    __sn__Result __sn__direct = ({
+        sn_auto_thread SnThread *__sync_th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(__sn__Result);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+        __th__;
+    });
+        sn_thread_join(__sync_th__);
+        __sn__Result __sync_val__ = *(__sn__Result *)__sync_th__->result; __sync_val__; })
+    ;
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Direct value: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__direct.__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__direct.__sn__value == 42LL)) {
+        sn_print("SUCCESS: Inline spawn/sync works\n");
+        
+    } else {
+        sn_print("FAILURE: Inline spawn/sync failed\n");
+        
+    }
+    fflush(stdout);
+    return 0;
+}
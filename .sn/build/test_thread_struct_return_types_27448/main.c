@@ -0,0 +1,418 @@
+#include "sn_types.h"
+__sn__Metrics raw_metrics(long long);
+
+
+
+
+__sn__Primitive __sn__compute_primitive(long long __sn__x) {
+
+    return (__sn__Primitive){ .__sn__value = sn_mul_long(__sn__x, 10LL), .__sn__ok = true, .__sn__score = sn_mul_double(__sn__int_toDouble(__sn__x), 1.5) };}
+
+
+__sn__Composite __sn__compute_composite(long long __sn__x) {
+
+    return (__sn__Composite){ .__sn__id = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("item_");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__x));
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }), .__sn__value = sn_mul_double(__sn__int_toDouble(__sn__x), 2.0) };}
+
+
+__sn__TrainResult __sn__train(char * __sn__stream, __sn__HyperParams __p__hp) {
+    sn_auto_HyperParams __sn__HyperParams __sn__hp = __p__hp;
+
+    return (__sn__TrainResult){ .__sn__model_id = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("model_");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__stream);
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }), .__sn__accuracy = sn_mul_double(__sn__hp.__sn__rate, 100.0), .__sn__params = __sn__HyperParams_copy(&(__sn__hp)) };}
+
+
+__sn__Metrics __sn__compute_metrics(long long __sn__n) {
+
+    return raw_metrics(__sn__n);}
+
+
+
+
+
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_0__ *args = (__ThreadArgs_0__ *)__th__->result;
+    __ThreadArgs_0__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Primitive __result__ = __sn__compute_primitive(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Primitive));
+    *(__sn__Primitive *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_1__ *args = (__ThreadArgs_1__ *)__th__->result;
+    __ThreadArgs_1__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Primitive __result__ = __sn__compute_primitive(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Primitive));
+    *(__sn__Primitive *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_2__ *args = (__ThreadArgs_2__ *)__th__->result;
+    __ThreadArgs_2__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Composite __result__ = __sn__compute_composite(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Composite));
+    *(__sn__Composite *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_3__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_3__ *args = (__ThreadArgs_3__ *)__th__->result;
+    __ThreadArgs_3__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Composite __result__ = __sn__compute_composite(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Composite));
+    *(__sn__Composite *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_4__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_4__ *args = (__ThreadArgs_4__ *)__th__->result;
+    __ThreadArgs_4__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__TrainResult __result__ = __sn__train(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__TrainResult));
+    *(__sn__TrainResult *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_5__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_5__ *args = (__ThreadArgs_5__ *)__th__->result;
+    __ThreadArgs_5__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__TrainResult __result__ = __sn__train(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__TrainResult));
+    *(__sn__TrainResult *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_6__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_6__ *args = (__ThreadArgs_6__ *)__th__->result;
+    __ThreadArgs_6__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__TrainResult __result__ = __sn__train(args->arg0, args->arg1);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__TrainResult));
+    *(__sn__TrainResult *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_7__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_7__ *args = (__ThreadArgs_7__ *)__th__->result;
+    __ThreadArgs_7__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Metrics __result__ = __sn__compute_metrics(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Metrics));
+    *(__sn__Metrics *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_8__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+    __ThreadArgs_8__ *args = (__ThreadArgs_8__ *)__th__->result;
+    __ThreadArgs_8__ __args_copy__ = *args;
+    args = &__args_copy__;
+
+    __sn__Metrics __result__ = __sn__compute_metrics(args->arg0);
+    free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = calloc(1, sizeof(__sn__Metrics));
+    *(__sn__Metrics *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    __sn__Primitive __sn__p1 = {0}; sn_auto_thread SnThread * __sn__p1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __args__->arg0 = 1LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__Primitive);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    __sn__Primitive __sn__p2 = {0}; sn_auto_thread SnThread * __sn__p2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_1__ *__args__ = malloc(sizeof(__ThreadArgs_1__));
+        __args__->arg0 = 2LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__Primitive);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    ({
+        { sn_auto_thread SnThread *__sync_th__ = __sn__p1__th__; __sn__p1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__p1 = *(__sn__Primitive *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__p2__th__; __sn__p2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__p2 = *(__sn__Primitive *)__sync_th__->result; } }
+        (void)0; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p1: value=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p1.__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ok=");
+            sn_auto_str char *__is_p3__ = sn_strdup((__sn__p1.__sn__ok) ? "true" : "false");
+            sn_auto_str char *__is_p4__ = sn_strdup(", score=");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%.5f", (double)(__sn__p1.__sn__score));
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("p2: value=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__p2.__sn__value));
+            sn_auto_str char *__is_p2__ = sn_strdup(", ok=");
+            sn_auto_str char *__is_p3__ = sn_strdup((__sn__p2.__sn__ok) ? "true" : "false");
+            sn_auto_str char *__is_p4__ = sn_strdup(", score=");
+            sn_auto_str char *__is_p5__ = sn_str_fmt("%.5f", (double)(__sn__p2.__sn__score));
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    if ((((__sn__p1.__sn__value == 10LL) && __sn__p1.__sn__ok) && (__sn__p1.__sn__score == 1.5))) {
+        if ((((__sn__p2.__sn__value == 20LL) && __sn__p2.__sn__ok) && (__sn__p2.__sn__score == 3.0))) {
+            sn_println("A: PASS");
+            
+        } else {
+            sn_println("A: FAIL");
+            
+        }
+    } else {
+        sn_println("A: FAIL");
+        
+    }
+    sn_auto_Composite __sn__Composite __sn__c1 = {0}; sn_auto_thread SnThread * __sn__c1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_2__ *__args__ = malloc(sizeof(__ThreadArgs_2__));
+        __args__->arg0 = 1LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__Composite);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+        __th__;
+    });
+    sn_auto_Composite __sn__Composite __sn__c2 = {0}; sn_auto_thread SnThread * __sn__c2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_3__ *__args__ = malloc(sizeof(__ThreadArgs_3__));
+        __args__->arg0 = 2LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__Composite);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_3__, __th__);
+        __th__;
+    });
+    ({
+        { sn_auto_thread SnThread *__sync_th__ = __sn__c1__th__; __sn__c1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__c1 = *(__sn__Composite *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__c2__th__; __sn__c2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__c2 = *(__sn__Composite *)__sync_th__->result; } }
+        (void)0; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("c1: id=");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__c1.__sn__id);
+            sn_auto_str char *__is_p2__ = sn_strdup(", value=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__c1.__sn__value));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("c2: id=");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__c2.__sn__id);
+            sn_auto_str char *__is_p2__ = sn_strdup(", value=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__c2.__sn__value));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    if (((strcmp(__sn__c1.__sn__id, "item_1") == 0) && (__sn__c1.__sn__value == 2.0))) {
+        if (((strcmp(__sn__c2.__sn__id, "item_2") == 0) && (__sn__c2.__sn__value == 4.0))) {
+            sn_println("B: PASS");
+            
+        } else {
+            sn_println("B: FAIL");
+            
+        }
+    } else {
+        sn_println("B: FAIL");
+        
+    }
+    sn_auto_HyperParams __sn__HyperParams __sn__hp1 = (__sn__HyperParams){ .__sn__name = strdup("adam"), .__sn__rate = 0.001 };
+    sn_auto_HyperParams __sn__HyperParams __sn__hp2 = (__sn__HyperParams){ .__sn__name = strdup("sgd"), .__sn__rate = 0.01 };
+    sn_auto_HyperParams __sn__HyperParams __sn__hp3 = (__sn__HyperParams){ .__sn__name = strdup("rmsp"), .__sn__rate = 0.0050000000000000001 };
+    sn_auto_TrainResult __sn__TrainResult __sn__t1 = {0}; sn_auto_thread SnThread * __sn__t1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_4__ *__args__ = malloc(sizeof(__ThreadArgs_4__));
+        __args__->arg0 = "s1";
+        __args__->arg1 = __sn__HyperParams_copy(&(__sn__hp1));
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__TrainResult);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_4__, __th__);
+        __th__;
+    });
+    sn_auto_TrainResult __sn__TrainResult __sn__t2 = {0}; sn_auto_thread SnThread * __sn__t2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_5__ *__args__ = malloc(sizeof(__ThreadArgs_5__));
+        __args__->arg0 = "s2";
+        __args__->arg1 = __sn__HyperParams_copy(&(__sn__hp2));
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__TrainResult);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_5__, __th__);
+        __th__;
+    });
+    sn_auto_TrainResult __sn__TrainResult __sn__t3 = {0}; sn_auto_thread SnThread * __sn__t3__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_6__ *__args__ = malloc(sizeof(__ThreadArgs_6__));
+        __args__->arg0 = "s3";
+        __args__->arg1 = __sn__HyperParams_copy(&(__sn__hp3));
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__TrainResult);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_6__, __th__);
+        __th__;
+    });
+    ({
+        { sn_auto_thread SnThread *__sync_th__ = __sn__t1__th__; __sn__t1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__t1 = *(__sn__TrainResult *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__t2__th__; __sn__t2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__t2 = *(__sn__TrainResult *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__t3__th__; __sn__t3__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__t3 = *(__sn__TrainResult *)__sync_th__->result; } }
+        (void)0; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("t1: id=");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__t1.__sn__model_id);
+            sn_auto_str char *__is_p2__ = sn_strdup(", acc=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__t1.__sn__accuracy));
+            sn_auto_str char *__is_p4__ = sn_strdup(", cfg=");
+            sn_auto_str char *__is_p5__ = sn_strdup(__sn__t1.__sn__params.__sn__name);
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("t2: id=");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__t2.__sn__model_id);
+            sn_auto_str char *__is_p2__ = sn_strdup(", acc=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__t2.__sn__accuracy));
+            sn_auto_str char *__is_p4__ = sn_strdup(", cfg=");
+            sn_auto_str char *__is_p5__ = sn_strdup(__sn__t2.__sn__params.__sn__name);
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("t3: id=");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__t3.__sn__model_id);
+            sn_auto_str char *__is_p2__ = sn_strdup(", acc=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__t3.__sn__accuracy));
+            sn_auto_str char *__is_p4__ = sn_strdup(", cfg=");
+            sn_auto_str char *__is_p5__ = sn_strdup(__sn__t3.__sn__params.__sn__name);
+            sn_str_concat_multi(6, __is_p0__, __is_p1__, __is_p2__, __is_p3__, __is_p4__, __is_p5__);
+        }); sn_println(__ps__); };
+    
+    if (((strcmp(__sn__t1.__sn__model_id, "model_s1") == 0) && (strcmp(__sn__t1.__sn__params.__sn__name, "adam") == 0))) {
+        if (((strcmp(__sn__t2.__sn__model_id, "model_s2") == 0) && (strcmp(__sn__t2.__sn__params.__sn__name, "sgd") == 0))) {
+            if (((strcmp(__sn__t3.__sn__model_id, "model_s3") == 0) && (strcmp(__sn__t3.__sn__params.__sn__name, "rmsp") == 0))) {
+                sn_println("C: PASS");
+                
+            } else {
+                sn_println("C: FAIL");
+                
+            }
+        } else {
+            sn_println("C: FAIL");
+            
+        }
+    } else {
+        sn_println("C: FAIL");
+        
+    }
+    __sn__Metrics __sn__m1 = {0}; sn_auto_thread SnThread * __sn__m1__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_7__ *__args__ = malloc(sizeof(__ThreadArgs_7__));
+        __args__->arg0 = 10LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__Metrics);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_7__, __th__);
+        __th__;
+    });
+    __sn__Metrics __sn__m2 = {0}; sn_auto_thread SnThread * __sn__m2__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __ThreadArgs_8__ *__args__ = malloc(sizeof(__ThreadArgs_8__));
+        __args__->arg0 = 20LL;
+        __th__->result = __args__;
+        __th__->result_size = sizeof(__sn__Metrics);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_8__, __th__);
+        __th__;
+    });
+    ({
+        { sn_auto_thread SnThread *__sync_th__ = __sn__m1__th__; __sn__m1__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__m1 = *(__sn__Metrics *)__sync_th__->result; } }
+        { sn_auto_thread SnThread *__sync_th__ = __sn__m2__th__; __sn__m2__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__m2 = *(__sn__Metrics *)__sync_th__->result; } }
+        (void)0; })
+    ;
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("m1: count=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__m1.__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup(", total=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__m1.__sn__total));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("m2: count=");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__m2.__sn__count));
+            sn_auto_str char *__is_p2__ = sn_strdup(", total=");
+            sn_auto_str char *__is_p3__ = sn_str_fmt("%.5f", (double)(__sn__m2.__sn__total));
+            sn_str_concat_multi(4, __is_p0__, __is_p1__, __is_p2__, __is_p3__);
+        }); sn_println(__ps__); };
+    
+    if (((__sn__m1.__sn__count == 10LL) && (__sn__m1.__sn__total == 15.0))) {
+        if (((__sn__m2.__sn__count == 20LL) && (__sn__m2.__sn__total == 30.0))) {
+            sn_println("D: PASS");
+            
+        } else {
+            sn_println("D: FAIL");
+            
+        }
+    } else {
+        sn_println("D: FAIL");
+        
+    }
+    sn_println("All thread struct return type tests completed");
+    
+    fflush(stdout);
+    return 0;
+}
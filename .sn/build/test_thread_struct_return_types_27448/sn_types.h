@@ -0,0 +1,414 @@
+#ifndef SN_TYPES_H
+#define SN_TYPES_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include "sn_minimal.h"
+
+
+typedef struct __Closure__ {
+    void *fn;
+    size_t size;
+    void (*__cleanup__)(void *);
+    int __rc__;
+} __Closure__;
+/* Struct: Primitive (as val) */
+typedef struct {
+    long long __sn__value;
+    bool __sn__ok;
+    double __sn__score;
+} __sn__Primitive;
+/* Value operations */
+static inline __sn__Primitive __sn__Primitive_copy(const __sn__Primitive *src) {
+    __sn__Primitive dst;
+    dst.__sn__value = src->__sn__value;
+    dst.__sn__ok = src->__sn__ok;
+    dst.__sn__score = src->__sn__score;
+    return dst;
+}
+
+static inline void __sn__Primitive_cleanup(__sn__Primitive *p) {
+
+}
+
+#define sn_auto_Primitive __attribute__((cleanup(__sn__Primitive_cleanup)))
+
+static inline void __sn__Primitive_cleanup_elem(void *p) { __sn__Primitive_cleanup((__sn__Primitive *)p); }
+static inline void __sn__Primitive_copy_into(const void *src, void *dst) { *(__sn__Primitive *)dst = __sn__Primitive_copy((const __sn__Primitive *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Primitive *__sn__Primitive_alloc(void) {
+    return calloc(1, sizeof(__sn__Primitive));
+}
+
+static inline void __sn__Primitive_release(__sn__Primitive **p) {
+    if (*p) {
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Primitive __attribute__((cleanup(__sn__Primitive_release)))
+
+static inline void __sn__Primitive_release_elem(void *p) { __sn__Primitive_release((__sn__Primitive **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Primitive_to_string(const __sn__Primitive *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Primitive { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "ok: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%s", p->__sn__ok ? "true" : "false");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "score: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__score);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: Composite (as val) */
+typedef struct {
+    char * __sn__id;
+    double __sn__value;
+} __sn__Composite;
+/* Value operations */
+static inline __sn__Composite __sn__Composite_copy(const __sn__Composite *src) {
+    __sn__Composite dst;
+    dst.__sn__id = src->__sn__id ? strdup(src->__sn__id) : NULL;
+    dst.__sn__value = src->__sn__value;
+    return dst;
+}
+
+static inline void __sn__Composite_cleanup(__sn__Composite *p) {
+    free(p->__sn__id);
+
+}
+
+#define sn_auto_Composite __attribute__((cleanup(__sn__Composite_cleanup)))
+
+static inline void __sn__Composite_cleanup_elem(void *p) { __sn__Composite_cleanup((__sn__Composite *)p); }
+static inline void __sn__Composite_copy_into(const void *src, void *dst) { *(__sn__Composite *)dst = __sn__Composite_copy((const __sn__Composite *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__Composite *__sn__Composite_alloc(void) {
+    return calloc(1, sizeof(__sn__Composite));
+}
+
+static inline void __sn__Composite_release(__sn__Composite **p) {
+    if (*p) {
+        free((*p)->__sn__id);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_Composite __attribute__((cleanup(__sn__Composite_release)))
+
+static inline void __sn__Composite_release_elem(void *p) { __sn__Composite_release((__sn__Composite **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__Composite_to_string(const __sn__Composite *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "Composite { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__id ? p->__sn__id : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "value: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__value);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+
+/* Struct: HyperParams (as val) */
+typedef struct {
+    char * __sn__name;
+    double __sn__rate;
+} __sn__HyperParams;
+/* Value operations */
+static inline __sn__HyperParams __sn__HyperParams_copy(const __sn__HyperParams *src) {
+    __sn__HyperParams dst;
+    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__rate = src->__sn__rate;
+    return dst;
+}
+
+static inline void __sn__HyperParams_cleanup(__sn__HyperParams *p) {
+    free(p->__sn__name);
+
+}
+
+#define sn_auto_HyperParams __attribute__((cleanup(__sn__HyperParams_cleanup)))
+
+static inline void __sn__HyperParams_cleanup_elem(void *p) { __sn__HyperParams_cleanup((__sn__HyperParams *)p); }
+static inline void __sn__HyperParams_copy_into(const void *src, void *dst) { *(__sn__HyperParams *)dst = __sn__HyperParams_copy((const __sn__HyperParams *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__HyperParams *__sn__HyperParams_alloc(void) {
+    return calloc(1, sizeof(__sn__HyperParams));
+}
+
+static inline void __sn__HyperParams_release(__sn__HyperParams **p) {
+    if (*p) {
+        free((*p)->__sn__name);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_HyperParams __attribute__((cleanup(__sn__HyperParams_release)))
+
+static inline void __sn__HyperParams_release_elem(void *p) { __sn__HyperParams_release((__sn__HyperParams **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__HyperParams_to_string(const __sn__HyperParams *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "HyperParams { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "name: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "rate: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__rate);
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__HyperParams_encode_impl(__sn__HyperParams *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "name", __sn__self->__sn__name);
+    __sn__Encoder_writeDouble(__sn__e, "rate", __sn__self->__sn__rate);
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__HyperParams_encode(__sn__HyperParams *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__HyperParams_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__HyperParams __sn__HyperParams_decode(__sn__Decoder *__sn__d) {
+    __sn__HyperParams __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__name = __sn__Decoder_readStr(__sn__d, "name");
+    __r__.__sn__rate = __sn__Decoder_readDouble(__sn__d, "rate");
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__HyperParams_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__HyperParams_encode_impl(&((__sn__HyperParams *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__HyperParams_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__HyperParams), __len__);
+    __arr__->elem_release = __sn__HyperParams_cleanup_elem;
+    __arr__->elem_copy = __sn__HyperParams_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__HyperParams __v__ = __sn__HyperParams_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+/* Struct: TrainResult (as val) */
+typedef struct {
+    char * __sn__model_id;
+    double __sn__accuracy;
+    __sn__HyperParams __sn__params;
+} __sn__TrainResult;
+/* Value operations */
+static inline __sn__TrainResult __sn__TrainResult_copy(const __sn__TrainResult *src) {
+    __sn__TrainResult dst;
+    dst.__sn__model_id = src->__sn__model_id ? strdup(src->__sn__model_id) : NULL;
+    dst.__sn__accuracy = src->__sn__accuracy;
+    dst.__sn__params = __sn__HyperParams_copy(&src->__sn__params);
+    return dst;
+}
+
+static inline void __sn__TrainResult_cleanup(__sn__TrainResult *p) {
+    free(p->__sn__model_id);
+    __sn__HyperParams_cleanup(&p->__sn__params);
+
+}
+
+#define sn_auto_TrainResult __attribute__((cleanup(__sn__TrainResult_cleanup)))
+
+static inline void __sn__TrainResult_cleanup_elem(void *p) { __sn__TrainResult_cleanup((__sn__TrainResult *)p); }
+static inline void __sn__TrainResult_copy_into(const void *src, void *dst) { *(__sn__TrainResult *)dst = __sn__TrainResult_copy((const __sn__TrainResult *)src); }
+
+/* Ref/pointer operations */
+static inline __sn__TrainResult *__sn__TrainResult_alloc(void) {
+    return calloc(1, sizeof(__sn__TrainResult));
+}
+
+static inline void __sn__TrainResult_release(__sn__TrainResult **p) {
+    if (*p) {
+        free((*p)->__sn__model_id);
+        __sn__HyperParams_cleanup(&(*p)->__sn__params);
+        free(*p);
+    }
+    *p = NULL;
+}
+
+#define sn_auto_ref_TrainResult __attribute__((cleanup(__sn__TrainResult_release)))
+
+static inline void __sn__TrainResult_release_elem(void *p) { __sn__TrainResult_release((__sn__TrainResult **)p); }
+
+/* Auto-toString for string interpolation */
+static inline char *__sn__TrainResult_to_string(const __sn__TrainResult *p) {
+    char buf[1024];
+    int off = 0;
+    off += snprintf(buf + off, sizeof(buf) - off, "TrainResult { ");
+    off += snprintf(buf + off, sizeof(buf) - off, "model_id: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__model_id ? p->__sn__model_id : "nil");
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "accuracy: ");
+    off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__accuracy);
+    off += snprintf(buf + off, sizeof(buf) - off, ", ");
+    off += snprintf(buf + off, sizeof(buf) - off, "params: ");
+    { char *__fs__ = __sn__HyperParams_to_string(&p->__sn__params); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    off += snprintf(buf + off, sizeof(buf) - off, " }");
+    return strdup(buf);
+}
+
+/* @serializable: encode (internal — writes fields, no result) */
+static inline void __sn__TrainResult_encode_impl(__sn__TrainResult *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__Encoder_writeStr(__sn__e, "model_id", __sn__self->__sn__model_id);
+    __sn__Encoder_writeDouble(__sn__e, "accuracy", __sn__self->__sn__accuracy);
+    { __sn__Encoder *__sub__ = __sn__Encoder_beginObject(__sn__e, "params"); __sn__HyperParams_encode_impl(&__sn__self->__sn__params, __sub__); __sn__Encoder_end(__sub__); }
+
+}
+
+/* @serializable: encode (public — returns result string) */
+static inline char *__sn__TrainResult_encode(__sn__TrainResult *__sn__self, __sn__Encoder *__sn__e) {
+    __sn__TrainResult_encode_impl(__sn__self, __sn__e);
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decode */
+static inline __sn__TrainResult __sn__TrainResult_decode(__sn__Decoder *__sn__d) {
+    __sn__TrainResult __r__;
+    memset(&__r__, 0, sizeof(__r__));
+    __r__.__sn__model_id = __sn__Decoder_readStr(__sn__d, "model_id");
+    __r__.__sn__accuracy = __sn__Decoder_readDouble(__sn__d, "accuracy");
+    { sn_auto_Decoder __sn__Decoder *__sub__ = __sn__Decoder_readObject(__sn__d, "params"); __r__.__sn__params = __sn__HyperParams_decode(__sub__); }
+    return __r__;
+}
+
+/* @serializable: encodeArray */
+static inline char *__sn__TrainResult_encodeArray(SnArray *__sn__items, __sn__Encoder *__sn__e) {
+    for (long long __i__ = 0; __i__ < __sn__items->len; __i__++) {
+        __sn__Encoder *__obj__ = __sn__Encoder_appendObject(__sn__e);
+        __sn__TrainResult_encode_impl(&((__sn__TrainResult *)__sn__items->data)[__i__], __obj__);
+        __sn__Encoder_end(__obj__);
+    }
+    char *__res__ = __sn__Encoder_result(__sn__e);
+    __sn__e->__sn__cleanup = NULL;
+    return __res__;
+}
+
+/* @serializable: decodeArray */
+static inline SnArray *__sn__TrainResult_decodeArray(__sn__Decoder *__sn__d) {
+    long long __len__ = __sn__Decoder_length(__sn__d);
+    SnArray *__arr__ = sn_array_new(sizeof(__sn__TrainResult), __len__);
+    __arr__->elem_release = __sn__TrainResult_cleanup_elem;
+    __arr__->elem_copy = __sn__TrainResult_copy_into;
+    for (long long __i__ = 0; __i__ < __len__; __i__++) {
+        sn_auto_Decoder __sn__Decoder *__elem__ = __sn__Decoder_at(__sn__d, __i__);
+        __sn__TrainResult __v__ = __sn__TrainResult_decode(__elem__);
+        sn_array_push(__arr__, &__v__);
+    }
+    return __arr__;
+}
+
+
+/* Struct: Metrics (native) */
+typedef struct {
+    long long __sn__count;
+    double __sn__total;
+} __sn__Metrics;
+
+
+__sn__Primitive __sn__compute_primitive(long long);
+__sn__Composite __sn__compute_composite(long long);
+__sn__TrainResult __sn__train(char *, __sn__HyperParams);
+__sn__Metrics __sn__compute_metrics(long long);
+
+
+typedef struct {
+    long long arg0;
+    int _padding;
+} __ThreadArgs_0__;
+void *__thread_wrapper_0__(void *arg);
+typedef struct {
+    long long arg0;
+    int _padding;
+} __ThreadArgs_1__;
+void *__thread_wrapper_1__(void *arg);
+typedef struct {
+    long long arg0;
+    int _padding;
+} __ThreadArgs_2__;
+void *__thread_wrapper_2__(void *arg);
+typedef struct {
+    long long arg0;
+    int _padding;
+} __ThreadArgs_3__;
+void *__thread_wrapper_3__(void *arg);
+typedef struct {
+    char * arg0;
+    __sn__HyperParams arg1;
+    int _padding;
+} __ThreadArgs_4__;
+void *__thread_wrapper_4__(void *arg);
+typedef struct {
+    char * arg0;
+    __sn__HyperParams arg1;
+    int _padding;
+} __ThreadArgs_5__;
+void *__thread_wrapper_5__(void *arg);
+typedef struct {
+    char * arg0;
+    __sn__HyperParams arg1;
+    int _padding;
+} __ThreadArgs_6__;
+void *__thread_wrapper_6__(void *arg);
+typedef struct {
+    long long arg0;
+    int _padding;
+} __ThreadArgs_7__;
+void *__thread_wrapper_7__(void *arg);
+typedef struct {
+    long long arg0;
+    int _padding;
+} __ThreadArgs_8__;
+void *__thread_wrapper_8__(void *arg);
+
+
+#endif
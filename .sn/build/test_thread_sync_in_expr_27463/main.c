@@ -0,0 +1,148 @@
+#include "sn_types.h"
+
+
+
+
+long long __sn__compute_a() {
+
+    return 10LL;}
+
+
+long long __sn__compute_b() {
+
+    return 20LL;}
+
+
+long long __sn__compute_c() {
+
+    return 5LL;}
+
+
+long long __sn__double_value(long long __sn__x) {
+
+    return sn_mul_long(__sn__x, 2LL);}
+
+void *__thread_wrapper_0__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    long long __result__ = __sn__compute_a();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_1__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    long long __result__ = __sn__compute_b();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+void *__thread_wrapper_2__(void *arg) {
+    SnThread *__th__ = (SnThread *)arg;
+
+    long long __result__ = __sn__compute_c();
+    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    *(long long *)__th__->result = __result__;
+    sn_thread_release(__th__);
+    return NULL;
+}
+int main() {
+    long long __sn__a = 0; sn_auto_thread SnThread * __sn__a__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        __th__;
+    });
+    long long __sn__b = 0; sn_auto_thread SnThread * __sn__b__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_1__, __th__);
+        __th__;
+    });
+    long long __sn__c = 0; sn_auto_thread SnThread * __sn__c__th__ = ({
+        SnThread *__th__ = sn_thread_create();
+        __th__->result_size = sizeof(long long);
+        pthread_create(&__th__->thread, NULL, __thread_wrapper_2__, __th__);
+        __th__;
+    });
+    long long __sn__sum = sn_add_long(({
+        sn_auto_thread SnThread *__sync_th__ = __sn__a__th__; __sn__a__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__a = *(long long *)__sync_th__->result; }
+        __sn__a; })
+    , ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__b__th__; __sn__b__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__b = *(long long *)__sync_th__->result; }
+        __sn__b; })
+    );
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("a! + b! = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__result = sn_mul_long(sn_add_long(__sn__a, __sn__b), ({
+        sn_auto_thread SnThread *__sync_th__ = __sn__c__th__; __sn__c__th__ = NULL;
+        if (__sync_th__) { sn_thread_join(__sync_th__); __sn__c = *(long long *)__sync_th__->result; }
+        __sn__c; })
+    );
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("(a + b) * c! = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    long long __sn__doubled = __sn__double_value(__sn__c);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("double_value(c) = ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__doubled));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("Sum of all: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_add_long(sn_add_long(__sn__a, __sn__b), __sn__c)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    if ((__sn__sum == 30LL)) {
+        if ((__sn__result == 150LL)) {
+            if ((__sn__doubled == 10LL)) {
+                sn_print("SUCCESS: All sync-in-expression results correct\n");
+                
+            } else {
+                { sn_auto_str char *__ps__ = ({
+                        sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: doubled expected 10, got ");
+                        sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__doubled));
+                        sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                        sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                    }); sn_print(__ps__); };
+                
+            }
+        } else {
+            { sn_auto_str char *__ps__ = ({
+                    sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: result expected 150, got ");
+                    sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__result));
+                    sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                    sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+                }); sn_print(__ps__); };
+            
+        }
+    } else {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("FAILURE: sum expected 30, got ");
+                sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__sum));
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+    }
+    fflush(stdout);
+    return 0;
+}
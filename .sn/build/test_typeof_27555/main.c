@@ -0,0 +1,97 @@
+#include "sn_types.h"
+
+
+
+
+
+int main() {
+    long long __sn__i = 42LL;
+    sn_auto_TypeInfo __sn__TypeInfo __sn__info = sn_typeinfo_create("int", 367623774, NULL, 0);
+    sn_assert((strcmp(__sn__info.__sn__name, "int") == 0), "typeOf(int).name");
+    
+    sn_assert((__sn__info.__sn__fieldCount == 0LL), "typeOf(int).fieldCount");
+    
+    sn_assert((__sn__info.__sn__typeId != 0LL), "typeOf(int).typeId non-zero");
+    
+    sn_println("test_primitive_int: PASS");
+    
+    sn_auto_str char * __sn__s = strdup("hello");
+    sn_auto_TypeInfo __sn__TypeInfo __sn__sinfo = sn_typeinfo_create("str", 1112265104, NULL, 0);
+    sn_assert((strcmp(__sn__sinfo.__sn__name, "str") == 0), "typeOf(str).name");
+    
+    sn_assert((__sn__sinfo.__sn__fieldCount == 0LL), "typeOf(str).fieldCount");
+    
+    sn_println("test_primitive_str: PASS");
+    
+    double __sn__d = 3.1400000000000001;
+    sn_auto_TypeInfo __sn__TypeInfo __sn__dinfo = sn_typeinfo_create("double", 552275720, NULL, 0);
+    sn_assert((strcmp(__sn__dinfo.__sn__name, "double") == 0), "typeOf(double).name");
+    
+    sn_assert((__sn__dinfo.__sn__fieldCount == 0LL), "typeOf(double).fieldCount");
+    
+    sn_println("test_primitive_double: PASS");
+    
+    bool __sn__b = true;
+    sn_auto_TypeInfo __sn__TypeInfo __sn__binfo = sn_typeinfo_create("bool", 1217697085, NULL, 0);
+    sn_assert((strcmp(__sn__binfo.__sn__name, "bool") == 0), "typeOf(bool).name");
+    
+    sn_assert((__sn__binfo.__sn__fieldCount == 0LL), "typeOf(bool).fieldCount");
+    
+    sn_println("test_primitive_bool: PASS");
+    
+    __sn__Point __sn__p = (__sn__Point){ .__sn__x = 1.0, .__sn__y = 2.0 };
+    sn_auto_TypeInfo __sn__TypeInfo __sn__pinfo = ({static __sn__FieldInfo __typeof_fields__[] = { { .__sn__name = (char *)"x", .__sn__typeName = (char *)"double", .__sn__typeId = 552275720 }, { .__sn__name = (char *)"y", .__sn__typeName = (char *)"double", .__sn__typeId = 552275720 } }; sn_typeinfo_create("Point", 1789456177, __typeof_fields__, 2);});
+    sn_assert((strcmp(__sn__pinfo.__sn__name, "Point") == 0), "typeOf(Point).name");
+    
+    sn_assert((__sn__pinfo.__sn__fieldCount == 2LL), "typeOf(Point).fieldCount");
+    
+    sn_assert((__sn__pinfo.__sn__typeId != 0LL), "typeOf(Point).typeId non-zero");
+    
+    sn_println("test_struct_point: PASS");
+    
+    sn_assert((strcmp((((__sn__FieldInfo *)__sn__pinfo.__sn__fields->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__pinfo.__sn__fields->len : __ai__; })]).__sn__name, "x") == 0), "Point field 0 name");
+    
+    sn_assert((strcmp((((__sn__FieldInfo *)__sn__pinfo.__sn__fields->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__pinfo.__sn__fields->len : __ai__; })]).__sn__typeName, "double") == 0), "Point field 0 typeName");
+    
+    sn_assert(((((__sn__FieldInfo *)__sn__pinfo.__sn__fields->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__pinfo.__sn__fields->len : __ai__; })]).__sn__typeId != 0LL), "Point field 0 typeId non-zero");
+    
+    sn_assert((strcmp((((__sn__FieldInfo *)__sn__pinfo.__sn__fields->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__pinfo.__sn__fields->len : __ai__; })]).__sn__name, "y") == 0), "Point field 1 name");
+    
+    sn_assert((strcmp((((__sn__FieldInfo *)__sn__pinfo.__sn__fields->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__pinfo.__sn__fields->len : __ai__; })]).__sn__typeName, "double") == 0), "Point field 1 typeName");
+    
+    sn_println("test_field_iteration: PASS");
+    
+    sn_auto_Person __sn__Person __sn__person = (__sn__Person){ .__sn__name = strdup("Alice"), .__sn__age = 30LL };
+    sn_auto_TypeInfo __sn__TypeInfo __sn__perinfo = ({static __sn__FieldInfo __typeof_fields__[] = { { .__sn__name = (char *)"name", .__sn__typeName = (char *)"str", .__sn__typeId = 1112265104 }, { .__sn__name = (char *)"age", .__sn__typeName = (char *)"int", .__sn__typeId = 367623774 } }; sn_typeinfo_create("Person", 1131342752, __typeof_fields__, 2);});
+    sn_assert((strcmp(__sn__perinfo.__sn__name, "Person") == 0), "typeOf(Person).name");
+    
+    sn_assert((__sn__perinfo.__sn__fieldCount == 2LL), "typeOf(Person).fieldCount");
+    
+    sn_assert((strcmp((((__sn__FieldInfo *)__sn__perinfo.__sn__fields->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__perinfo.__sn__fields->len : __ai__; })]).__sn__name, "name") == 0), "Person field 0 name");
+    
+    sn_assert((strcmp((((__sn__FieldInfo *)__sn__perinfo.__sn__fields->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__perinfo.__sn__fields->len : __ai__; })]).__sn__typeName, "str") == 0), "Person field 0 typeName");
+    
+    sn_assert((strcmp((((__sn__FieldInfo *)__sn__perinfo.__sn__fields->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__perinfo.__sn__fields->len : __ai__; })]).__sn__name, "age") == 0), "Person field 1 name");
+    
+    sn_assert((strcmp((((__sn__FieldInfo *)__sn__perinfo.__sn__fields->data)[({ long long __ai__ = 1LL; __ai__ < 0 ? __ai__ + __sn__perinfo.__sn__fields->len : __ai__; })]).__sn__typeName, "int") == 0), "Person field 1 typeName");
+    
+    sn_println("test_struct_person: PASS");
+    
+    __sn__Point __sn__p2 = (__sn__Point){ .__sn__x = 3.0, .__sn__y = 4.0 };
+    sn_assert((1789456177LL == 1789456177LL), "same type same typeId");
+    
+    sn_assert((1789456177LL != 1131342752LL), "different type different typeId");
+    
+    sn_assert((367623774LL != 1112265104LL), "int != str typeId");
+    
+    sn_println("test_type_id_comparison: PASS");
+    
+    sn_assert(((((__sn__FieldInfo *)__sn__pinfo.__sn__fields->data)[({ long long __ai__ = 0LL; __ai__ < 0 ? __ai__ + __sn__pinfo.__sn__fields->len : __ai__; })]).__sn__typeId == 552275720LL), "Point.x typeId matches double typeId");
+    
+    sn_println("test_field_type_id_matches: PASS");
+    
+    sn_println("\nAll typeOf tests passed!");
+    
+    fflush(stdout);
+    return 0;
+}
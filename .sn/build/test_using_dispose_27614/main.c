@@ -0,0 +1,106 @@
+#include "sn_types.h"
+
+long long __sn__disposed_count = 0LL;
+
+
+
+void __sn__test_basic_using() {
+
+    sn_print("Test 1: Basic using statement\n");
+    
+
+    {
+        sn_auto_Resource __sn__Resource __sn__res = (__sn__Resource){ .__sn__name = strdup("test-resource") };
+    {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  Using: ");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__res.__sn__name);
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+    }
+        __sn__Resource_dispose(&__sn__res);
+    }
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Disposed count: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__disposed_count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__test_multiple_using() {
+
+    sn_print("Test 2: Multiple using statements\n");
+    
+
+    {
+        sn_auto_Resource __sn__Resource __sn__r1 = (__sn__Resource){ .__sn__name = strdup("resource-A") };
+    {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  Using: ");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__r1.__sn__name);
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+    }
+        __sn__Resource_dispose(&__sn__r1);
+    }
+
+    {
+        sn_auto_Resource __sn__Resource __sn__r2 = (__sn__Resource){ .__sn__name = strdup("resource-B") };
+    {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_strdup("  Using: ");
+                sn_auto_str char *__is_p1__ = sn_strdup(__sn__r2.__sn__name);
+                sn_auto_str char *__is_p2__ = sn_strdup("\n");
+                sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+            }); sn_print(__ps__); };
+        
+    }
+        __sn__Resource_dispose(&__sn__r2);
+    }
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Disposed count: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(__sn__disposed_count));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+void __sn__Resource_dispose(__sn__Resource *__sn__self) {
+
+    (__sn__disposed_count = sn_add_long(__sn__disposed_count, 1LL));
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("  Disposing: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__self->__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+int main() {
+    sn_print("=== using/dispose() Integration Tests ===\n\n");
+    
+    __sn__test_basic_using();
+    
+    sn_print("\n");
+    
+    __sn__test_multiple_using();
+    
+    sn_print("\nPASS\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include "sn_types.h"
+
+
+
+
+void __sn__processConfig(__sn__Config *__sn__c) {
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("name: ");
+            sn_auto_str char *__is_p1__ = sn_strdup((*__sn__c).__sn__name);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("items: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length((*__sn__c).__sn__items)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+}
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__items = ({
+            SnArray *__al__ = sn_array_new(sizeof(char *), 3);
+            __al__->elem_tag = SN_TAG_STRING;
+    
+            __al__->elem_release = (void (*)(void *))sn_cleanup_str;
+            __al__->elem_copy = sn_copy_str;
+            sn_array_push(__al__, &(char *){ strdup("alpha") });
+            sn_array_push(__al__, &(char *){ strdup("beta") });
+            sn_array_push(__al__, &(char *){ strdup("gamma") });
+            __al__;
+        });
+    sn_auto_Config __sn__Config __sn__config = (__sn__Config){ .__sn__name = strdup("test"), .__sn__items = sn_array_copy(__sn__items) };
+    __sn__processConfig(&__sn__config);
+    
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("original: ");
+            sn_auto_str char *__is_p1__ = sn_str_fmt("%lld", (long long)(sn_array_length(__sn__items)));
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_auto_str char * __sn__s = strdup("hello");
+    sn_auto_str char * __sn__s2 = strdup(__sn__s);
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_strdup("copy: ");
+            sn_auto_str char *__is_p1__ = sn_strdup(__sn__s2);
+            sn_auto_str char *__is_p2__ = sn_strdup("\n");
+            sn_str_concat_multi(3, __is_p0__, __is_p1__, __is_p2__);
+        }); sn_print(__ps__); };
+    
+    sn_print("done\n");
+    
+    fflush(stdout);
+    return 0;
+}
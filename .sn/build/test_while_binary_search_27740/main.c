@@ -0,0 +1,47 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    sn_auto_arr SnArray * __sn__arr = ({
+            SnArray *__al__ = sn_array_new(sizeof(long long), 7);
+            __al__->elem_tag = SN_TAG_INT;
+    
+            sn_array_push(__al__, &(long long){ 1LL });
+            sn_array_push(__al__, &(long long){ 3LL });
+            sn_array_push(__al__, &(long long){ 5LL });
+            sn_array_push(__al__, &(long long){ 7LL });
+            sn_array_push(__al__, &(long long){ 9LL });
+            sn_array_push(__al__, &(long long){ 11LL });
+            sn_array_push(__al__, &(long long){ 13LL });
+            __al__;
+        });
+    long long __sn__target = 7LL;
+    long long __sn__lo = 0LL;
+    long long __sn__hi = sn_sub_long(sn_array_length(__sn__arr), 1LL);
+    long long __sn__found = (-1LL);
+    while ((__sn__lo <= __sn__hi)) {
+        long long __sn__mid = sn_div_long(sn_add_long(__sn__lo, __sn__hi), 2LL);
+        if (((((long long *)__sn__arr->data)[({ long long __ai__ = __sn__mid; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]) == __sn__target)) {
+            (__sn__found = __sn__mid);
+            
+            break;
+        } else {
+            if (sn_lt_long((((long long *)__sn__arr->data)[({ long long __ai__ = __sn__mid; __ai__ < 0 ? __ai__ + __sn__arr->len : __ai__; })]), __sn__target)) {
+                (__sn__lo = sn_add_long(__sn__mid, 1LL));
+                
+            } else {
+                (__sn__hi = sn_sub_long(__sn__mid, 1LL));
+                
+            }
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__found));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__a = 0LL;
+    long long __sn__b = 1LL;
+    long long __sn__count = 0LL;
+    while (sn_lt_long(__sn__count, 8LL)) {
+        { sn_auto_str char *__ps__ = ({
+                sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__a));
+                sn_auto_str char *__is_p1__ = sn_strdup(" ");
+                sn_str_concat_multi(2, __is_p0__, __is_p1__);
+            }); sn_print(__ps__); };
+        
+        long long __sn__next = sn_add_long(__sn__a, __sn__b);
+        (__sn__a = __sn__b);
+        
+        (__sn__b = __sn__next);
+        
+        __sn__count++;
+        
+    }
+    sn_print("\n");
+    
+    fflush(stdout);
+    return 0;
+}
@@ -0,0 +1,24 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    bool __sn__running = true;
+    long long __sn__count = 0LL;
+    while (__sn__running) {
+        __sn__count++;
+        
+        if ((__sn__count >= 5LL)) {
+            (__sn__running = false);
+            
+        }
+    }
+    { sn_auto_str char *__ps__ = ({
+            sn_auto_str char *__is_p0__ = sn_str_fmt("%lld", (long long)(__sn__count));
+            sn_auto_str char *__is_p1__ = sn_strdup("\n");
+            sn_str_concat_multi(2, __is_p0__, __is_p1__);
+        }); sn_print(__ps__); };
+    
+    fflush(stdout);
+    return 0;
+}
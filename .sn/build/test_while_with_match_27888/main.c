@@ -0,0 +1,34 @@
+#include "sn_types.h"
+
+
+
+int main() {
+    long long __sn__i = 1LL;
+    while ((__sn__i <= 3LL)) {
+        ({
+                long long __match_subject__ = __sn__i;
+                if (__match_subject__ == 1LL) {
+                    sn_print("one\n");
+        
+        
+                } else if (__match_subject__ == 2LL) {
+                    sn_print("two\n");
+        
+        
+                } else if (__match_subject__ == 3LL) {
+                    sn_print("three\n");
+        
+        
+                } else {
+                    sn_print("?\n");
+        
+        
+                }
+            });
+        
+        __sn__i++;
+        
+    }
+    fflush(stdout);
+    return 0;
+}
@@ -743,9 +743,15 @@ class TestRunner:
         if not has_expected and test_type not in ('explore',):
             return ('skip', 'no .expected', None)
 
-        # Standard compilation (use #pragma source for C helper files)
+        # Standard compilation (use #pragma source for C helper files).  A
+        # <test>.flags file adds compiler options; those tests are built
+        # without -g, whose ASAN build would keep the default allocator.
         compile_cmd = [self.compiler, test_file, '-o', exe_file, '-l', '1', '-O0', '--no-install']
-        if not is_windows():
+        flags_file = test_file.replace('.sn', '.flags')
+        if os.path.isfile(flags_file):
+            with open(flags_file, 'r', encoding='utf-8') as f:
+                compile_cmd.extend(f.read().split())
+        elif not is_windows():
             compile_cmd.append('-g')
         exit_code, stdout, stderr = run_with_timeout(
             compile_cmd, self.compile_timeout, env=self.env
@@ -23,8 +23,12 @@ struct StructField
     size_t offset;          /* Byte offset within struct (computed during type checking) */
     Expr *default_value;    /* Optional default value (NULL if none) */
     const char *c_alias;    /* C name alias (from #pragma alias), NULL if none */
+    size_t min_alignment;   /* Alignment requested with @align(N)/@cacheline, 0 if natural */
 };
 
+/* Cache line size assumed by @cacheline (and by the runtime's SN_CACHE_LINE) */
+#define SN_CACHE_LINE_SIZE 64
+
 typedef enum
 {
     TYPE_INT,
@@ -64,10 +68,61 @@ typedef enum
     SYNC_ATOMIC     /* sync keyword - uses atomic operations */
 } SyncModifier;
 
+/* Memory order for updates of a sync variable: sync(relaxed) var ... */
+typedef enum
+{
+    SYNC_ORDER_SEQ_CST,  /* Default: sequentially consistent */
+    SYNC_ORDER_ACQ_REL,  /* acq_rel - release stores, acquire-release read-modify-writes */
+    SYNC_ORDER_RELAXED   /* relaxed - atomicity only, no ordering of other memory */
+} SyncOrder;
+
+/* Lock object the compiler gives a sync variable named by lock blocks */
+typedef enum
+{
+    SYNC_LOCK_MUTEX,     /* Default: lock(x) - one mutex */
+    SYNC_LOCK_RW,        /* lock read(x) / lock write(x) - sharded reader-writer lock */
+    SYNC_LOCK_STRIPED    /* lock(arr[i]) - one mutex per stripe of array elements */
+} SyncLockKind;
+
+/* How a lock block takes its lock */
+typedef enum
+{
+    LOCK_MODE_EXCLUSIVE, /* lock(x) */
+    LOCK_MODE_READ,      /* lock read(x) - shared with other readers */
+    LOCK_MODE_WRITE      /* lock write(x) */
+} LockMode;
+
+/* Higher-order array builtin a call resolves to: arr.map(f), arr.parReduce(init, f), ... */
+typedef enum
+{
+    ARRAY_HOF_NONE,       /* Any other call */
+    ARRAY_HOF_MAP,        /* map(f: fn(T): U): U[] */
+    ARRAY_HOF_FILTER,     /* filter(f: fn(T): bool): T[] */
+    ARRAY_HOF_REDUCE,     /* reduce(init: U, f: fn(U, T): U): U */
+    ARRAY_HOF_FOR_EACH,   /* forEach(f: fn(T): void) */
+    ARRAY_HOF_PAR_MAP,    /* parMap(f: fn(T): U): U[] - chunks on the thread pool */
+    ARRAY_HOF_PAR_REDUCE  /* parReduce(init: T, f: fn(T, T): T): T - f must be associative */
+} ArrayHof;
+
+/* Stage of a lazy iterator pipeline a call is: arr.iter().filter(f).map(g).collect() */
+typedef enum
+{
+    ITER_STAGE_NONE,      /* Not part of a pipeline */
+    ITER_STAGE_SOURCE,    /* arr.iter() / (a..b).iter(): indexed source, no hasNext/next */
+    ITER_STAGE_MAP,       /* map(f: fn(T): U) */
+    ITER_STAGE_FILTER,    /* filter(f: fn(T): bool) */
+    ITER_STAGE_TAKE,      /* take(n: int) */
+    ITER_STAGE_SKIP,      /* skip(n: int) */
+    ITER_STAGE_ZIP,       /* zip(other: U[]) yields Zipped<T, U> */
+    ITER_STAGE_ENUMERATE, /* enumerate() yields Enumerated<T> */
+    ITER_STAGE_COLLECT    /* collect(): T[] */
+} IterStage;
+
 /* Block modifier for memory management */
 typedef enum
 {
-    BLOCK_DEFAULT   /* Normal block - uses function's arena */
+    BLOCK_DEFAULT,  /* Normal block - uses function's arena */
+    BLOCK_ARENA     /* arena => block - heap allocations go to a region freed at exit */
 } BlockModifier;
 
 /* Function modifier for memory management */
@@ -76,6 +131,24 @@ typedef enum
     FUNC_DEFAULT    /* Normal function - arena strategy is compiler-inferred */
 } FunctionModifier;
 
+/* Built-in container a struct instantiates (codegen emits a runtime-backed body) */
+typedef enum
+{
+    CONTAINER_NONE,     /* Ordinary struct */
+    CONTAINER_MAP,      /* map<K, V> - SnMap hash table */
+    CONTAINER_MAP_ITER, /* MapIter<K, V> - returned by map.iter() */
+    CONTAINER_SET,      /* set<T> - SnSet (hash table + integer bitmap) */
+    CONTAINER_SET_ITER, /* SetIter<T> - returned by set.iter() */
+    CONTAINER_DEQUE,    /* deque<T> - SnDeque ring buffer */
+    CONTAINER_DEQUE_ITER, /* DequeIter<T> - returned by deque.iter() */
+    CONTAINER_BITS,     /* bits - SnBits packed bool sequence */
+    CONTAINER_BITS_ITER, /* BitsIter - returned by bits.iter() */
+    CONTAINER_CHANNEL,  /* channel<T> - SnChannel bounded MPMC queue */
+    CONTAINER_CHANNEL_ITER, /* ChannelIter<T> - returned by channel.iter() */
+    CONTAINER_TASK_GROUP, /* taskgroup<T> - SnTaskGroup of spawned tasks */
+    CONTAINER_TASK_GROUP_ITER /* TaskGroupIter<T> - returned by taskgroup.iter() */
+} ContainerKind;
+
 /* Struct method definition */
 struct StructMethod
 {
@@ -144,7 +217,9 @@ struct Type
             bool is_packed;         /* True if preceded by #pragma pack(1) */
             bool pass_self_by_ref;  /* True if 'as ref' - native methods receive self by pointer */
             bool is_serializable;   /* True if preceded by @serializable */
+            size_t min_alignment;   /* Alignment requested with @align(N)/@cacheline, 0 if natural */
             const char *c_alias;    /* C type name alias (from #pragma alias), NULL if none */
+            ContainerKind container_kind; /* Built-in container kind, CONTAINER_NONE otherwise */
         } struct_type;
 
         struct
@@ -161,6 +236,7 @@ struct Type
             Type **type_args;               /* concrete type arguments [TYPE_INT] */
             int type_arg_count;
             Type *resolved;                 /* set by type checker: the concrete monomorphized Type* */
+            Token name_token;               /* template name in the annotation, for errors (start NULL when synthesized) */
         } generic_inst;
     } as;
 };
@@ -172,6 +248,7 @@ typedef struct
 {
     bool escapes_scope;          /* Expression result escapes its declaring scope */
     bool needs_heap_allocation;  /* Expression needs heap allocation (large size or escapes) */
+    bool stores_outside_region;  /* Stores into memory that outlives the innermost arena block */
 } EscapeInfo;
 
 typedef enum
@@ -242,6 +319,8 @@ typedef struct
     Token name;
     int declaration_scope_depth; /* set by type checker; <= 0 means module-level global */
     bool is_param_ref;           /* set by type checker; true if resolved to a function parameter */
+    Stmt *sync_decl;             /* set by type checker; the 'sync var' declaration this names, or NULL */
+    Stmt *thread_local_decl;     /* set by type checker; the 'threadlocal var' declaration this names, or NULL */
 } VariableExpr;
 
 typedef struct
@@ -249,6 +328,8 @@ typedef struct
     Token name;
     Expr *value;
     int lhs_scope_depth; /* set by type checker; <= 0 means module-level global */
+    Stmt *sync_decl;     /* set by type checker; the 'sync var' declaration assigned to, or NULL */
+    Stmt *thread_local_decl; /* set by type checker; the 'threadlocal var' declaration assigned to, or NULL */
 } AssignExpr;
 
 typedef struct
@@ -280,6 +361,8 @@ typedef struct
     Expr **arguments;
     int arg_count;
     bool is_tail_call;  /* Marked by optimizer for tail call optimization */
+    ArrayHof array_hof; /* arr.map(f) and friends, set by the type checker */
+    IterStage iter_stage; /* lazy pipeline stage, set by the type checker */
 } CallExpr;
 
 typedef struct
@@ -431,7 +514,7 @@ typedef struct
     Expr *operand;               /* The expression whose type info to get */
 } TypeofExpr;
 
-typedef struct
+typedef struct LambdaExpr
 {
     Parameter *params;
     int param_count;
@@ -443,9 +526,11 @@ typedef struct
     FunctionModifier modifier;  /* shared, private, or default */
     bool is_native;           /* True if this is a native callback lambda (no closures, C-compatible) */
     /* Capture info (filled during type checking) */
-    Token *captured_vars;
+    Token *captured_vars;     /* Enclosing-function locals the body uses */
     Type **captured_types;
     int capture_count;
+    int outer_scope_depth;    /* Scope depth just outside the lambda */
+    struct LambdaExpr *enclosing; /* Enclosing lambda while checking its body */
     int lambda_id;  /* Unique ID for code gen */
 } LambdaExpr;
 
@@ -569,7 +654,11 @@ typedef struct
     Expr *initializer;
     MemoryQualifier mem_qualifier;  /* as val or as ref modifier */
     SyncModifier sync_modifier;     /* sync for atomic operations */
+    SyncOrder sync_order;           /* Memory order for updates of a sync variable */
+    bool is_lock_target;            /* True if a lock block names this sync variable (set by type checker) */
+    SyncLockKind lock_kind;         /* Kind of lock its lock blocks need (set by type checker) */
     bool is_static;                 /* True if declared with 'static var' at module level */
+    bool is_thread_local;           /* True if declared with 'threadlocal var' (one copy per thread) */
     bool code_emitted;              /* True if code has already been generated (prevents double emission in diamond imports) */
     bool has_pending_elements;      /* True if array has thread spawn elements via push (set by type checker) */
     Type *resolved_type;            /* Resolved type for generic bodies (set by type checker, cleared between instantiations) */
@@ -639,6 +728,44 @@ typedef struct
     Stmt *body;
 } ForStmt;
 
+/* Chunk scheduling for parallel for-loops */
+typedef enum
+{
+    SCHEDULE_STATIC,    /* Fixed chunks dealt out round-robin (default: one per worker) */
+    SCHEDULE_GUIDED     /* Shrinking chunks claimed on demand, never below the given size */
+} ParallelSchedule;
+
+typedef enum
+{
+    REDUCE_SUM,
+    REDUCE_MIN,
+    REDUCE_MAX
+} ReduceOp;
+
+typedef struct
+{
+    Token var_name;
+    ReduceOp op;
+} ParallelReduction;
+
+/* parallel(...) for x in iterable => clauses */
+typedef struct ParallelClause
+{
+    ParallelSchedule schedule;
+    Expr *chunk;                  /* Chunk size (NULL = default for the schedule) */
+    ParallelReduction *reductions;
+    int reduction_count;
+    /* Filled during type checking */
+    Token *captured_vars;         /* Enclosing-function locals the body uses (reductions excluded) */
+    Type **captured_types;
+    bool *captured_sync;          /* Captured variable is declared sync */
+    Stmt **captured_decls;        /* Declaration of each captured variable, when known */
+    int capture_count;
+    int capture_capacity;
+    int outer_scope_depth;        /* Scope depth just outside the loop */
+    struct ParallelClause *enclosing; /* Enclosing parallel loop while checking its body */
+} ParallelClause;
+
 typedef struct
 {
     Token var_name;
@@ -646,6 +773,7 @@ typedef struct
     Stmt *body;
     Type *iterator_type;  /* Non-NULL when iterable satisfies iterator protocol (set by type checker) */
     Type *element_type;   /* Element type of the iteration (set by type checker) */
+    ParallelClause *parallel; /* Non-NULL for parallel for-loops */
 } ForEachStmt;
 
 typedef struct
@@ -694,18 +822,23 @@ typedef struct
     bool is_packed;            /* True if preceded by #pragma pack(1) */
     bool pass_self_by_ref;     /* True if 'as ref' - native methods receive self by pointer */
     bool is_serializable;      /* True if preceded by @serializable */
+    size_t min_alignment;      /* Alignment requested with @align(N)/@cacheline, 0 if natural */
     const char *c_alias;       /* C type name alias (from #pragma alias), NULL if none */
     const char **type_params;  /* type parameter names: ["T", "U"] — NULL if not generic */
     int type_param_count;      /* number of type parameters */
     Type ***type_param_constraints;    /* constraints per type param — NULL if unconstrained */
     int *type_param_constraint_counts; /* number of constraints per type param — NULL if no constraints */
+    ContainerKind container_kind;      /* built-in container kind, CONTAINER_NONE otherwise */
+    Type **type_args;          /* concrete type arguments of a monomorphized instantiation — NULL otherwise */
+    int type_arg_count;        /* number of concrete type arguments */
 } StructDeclStmt;
 
-/* Lock statement for synchronized blocks: lock(expr) => body */
+/* Lock statement for synchronized blocks: lock [read|write](expr) => body */
 typedef struct
 {
-    Expr *lock_expr;           /* The sync variable to lock on */
+    Expr *lock_expr;           /* The sync variable, or an element of a sync array, to lock on */
     Stmt *body;                /* The lock block body */
+    LockMode mode;             /* Exclusive, shared (read) or write */
 } LockStmt;
 
 /* Using statement for scoped resource management: using name = expr => body */
@@ -853,7 +986,7 @@ Stmt *ast_create_struct_decl_stmt(Arena *arena, Token name, StructField *fields,
                                    const char *c_alias, const Token *loc_token);
 Stmt *ast_create_interface_decl_stmt(Arena *arena, Token name, StructMethod *methods, int method_count,
                                       const Token *loc_token);
-Stmt *ast_create_lock_stmt(Arena *arena, Expr *lock_expr, Stmt *body, const Token *loc_token);
+Stmt *ast_create_lock_stmt(Arena *arena, Expr *lock_expr, Stmt *body, LockMode mode, const Token *loc_token);
 Stmt *ast_create_using_stmt(Arena *arena, Token name, Expr *initializer, Stmt *body, const Token *loc_token);
 
 void ast_init_module(Arena *arena, Module *module, const char *filename);
@@ -20,6 +20,7 @@ static const char *block_modifier_to_string(BlockModifier mod)
     switch (mod)
     {
     case BLOCK_DEFAULT: return NULL;  /* Don't print default */
+    case BLOCK_ARENA: return "arena";
     default: return "unknown";
     }
 }
@@ -191,7 +192,8 @@ void ast_print_stmt(Arena *arena, Stmt *stmt, int indent_level)
         break;
 
     case STMT_FOR_EACH:
-        DEBUG_VERBOSE_INDENT(indent_level, "ForEach: %.*s",
+        DEBUG_VERBOSE_INDENT(indent_level, "%s: %.*s",
+                             stmt->as.for_each_stmt.parallel ? "ParallelForEach" : "ForEach",
                              stmt->as.for_each_stmt.var_name.length,
                              stmt->as.for_each_stmt.var_name.start);
         DEBUG_VERBOSE_INDENT(indent_level + 1, "Iterable:");
@@ -440,7 +440,7 @@ Stmt *ast_create_interface_decl_stmt(Arena *arena, Token name, StructMethod *met
     return stmt;
 }
 
-Stmt *ast_create_lock_stmt(Arena *arena, Expr *lock_expr, Stmt *body, const Token *loc_token)
+Stmt *ast_create_lock_stmt(Arena *arena, Expr *lock_expr, Stmt *body, LockMode mode, const Token *loc_token)
 {
     if (lock_expr == NULL || body == NULL)
     {
@@ -456,6 +456,7 @@ Stmt *ast_create_lock_stmt(Arena *arena, Expr *lock_expr, Stmt *body, const Toke
     stmt->type = STMT_LOCK;
     stmt->as.lock_stmt.lock_expr = lock_expr;
     stmt->as.lock_stmt.body = body;
+    stmt->as.lock_stmt.mode = mode;
     stmt->token = ast_dup_token(arena, loc_token);
     return stmt;
 }
@@ -63,6 +63,8 @@ Type *ast_clone_type(Arena *arena, Type *type)
         clone->as.struct_type.is_packed = type->as.struct_type.is_packed;
         clone->as.struct_type.pass_self_by_ref = type->as.struct_type.pass_self_by_ref;
         clone->as.struct_type.is_serializable = type->as.struct_type.is_serializable;
+        clone->as.struct_type.min_alignment = type->as.struct_type.min_alignment;
+        clone->as.struct_type.container_kind = type->as.struct_type.container_kind;
         clone->as.struct_type.c_alias = type->as.struct_type.c_alias
             ? arena_strdup(arena, type->as.struct_type.c_alias) : NULL;
         if (type->as.struct_type.field_count > 0)
@@ -82,6 +84,7 @@ Type *ast_clone_type(Arena *arena, Type *type)
                 clone->as.struct_type.fields[i].default_value = type->as.struct_type.fields[i].default_value;
                 clone->as.struct_type.fields[i].c_alias = type->as.struct_type.fields[i].c_alias
                     ? arena_strdup(arena, type->as.struct_type.fields[i].c_alias) : NULL;
+                clone->as.struct_type.fields[i].min_alignment = type->as.struct_type.fields[i].min_alignment;
             }
         }
         else
@@ -159,6 +162,7 @@ Type *ast_clone_type(Arena *arena, Type *type)
         clone->as.generic_inst.type_arg_count = type->as.generic_inst.type_arg_count;
         clone->as.generic_inst.resolved = type->as.generic_inst.resolved; /* shallow — type checker owns it */
         clone->as.generic_inst.type_param_names = type->as.generic_inst.type_param_names; /* shallow — type checker owns it */
+        clone->as.generic_inst.name_token = type->as.generic_inst.name_token;
         if (type->as.generic_inst.type_arg_count > 0 && type->as.generic_inst.type_args != NULL)
         {
             clone->as.generic_inst.type_args = arena_alloc(arena,
@@ -690,6 +694,7 @@ Type *ast_create_struct_type(Arena *arena, const char *name, StructField *fields
             type->as.struct_type.fields[i].default_value = fields[i].default_value;
             type->as.struct_type.fields[i].c_alias = fields[i].c_alias
                 ? arena_strdup(arena, fields[i].c_alias) : NULL;
+            type->as.struct_type.fields[i].min_alignment = fields[i].min_alignment;
         }
     }
     else
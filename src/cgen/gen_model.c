@@ -87,6 +87,31 @@ static json_object *topo_sort_structs(json_object *structs)
                     }
                 }
             }
+            /* Extra ordering edges (built-in containers: map<K, V> needs K and V) */
+            json_object *type_deps = NULL;
+            if (all_deps_met && st != NULL &&
+                json_object_object_get_ex(st, "type_deps", &type_deps) && type_deps != NULL)
+            {
+                int dc = (int)json_object_array_length(type_deps);
+                for (int d = 0; d < dc && all_deps_met; d++)
+                {
+                    const char *dep = json_object_get_string(json_object_array_get_idx(type_deps, d));
+                    for (int j = 0; j < n && dep != NULL; j++)
+                    {
+                        if (j == i || emitted[j])
+                            continue;
+                        json_object *other = json_object_array_get_idx(structs, j);
+                        json_object *other_name_obj = NULL;
+                        if (other != NULL &&
+                            json_object_object_get_ex(other, "name", &other_name_obj) &&
+                            strcmp(json_object_get_string(other_name_obj), dep) == 0)
+                        {
+                            all_deps_met = false;
+                            break;
+                        }
+                    }
+                }
+            }
             if (all_deps_met)
             {
                 chosen = i;
@@ -126,6 +151,10 @@ json_object *g_model_threads = NULL;
 int g_model_thread_count = 0;
 int g_model_lambda_count = 0;
 
+/* Global parallel for-loop collection */
+json_object *g_model_parallel_loops = NULL;
+int g_model_parallel_count = 0;
+
 /* Global captured-variable set */
 char **g_captured_vars = NULL;
 int g_captured_var_count = 0;
@@ -158,7 +187,7 @@ int g_closure_var_lambda_ids[MAX_CLOSURE_VAR_MAP];
 int g_closure_var_count = 0;
 
 /* Lock scope stack */
-const char *g_lock_var_names[MAX_LOCK_DEPTH];
+GenLockScope g_lock_scopes[MAX_LOCK_DEPTH];
 int g_lock_depth = 0;
 
 /* Global fn-wrapper collection for function-as-parameter wrapping */
@@ -209,6 +238,18 @@ static const char *canonical_name_from_path(Arena *arena, const char *path, int
     return name;
 }
 
+/* Non-constant initializers run in main.  For c-min, string globals with
+ * literal initializers are also deferred so they can be strdup'd in main
+ * (string literals can't be free'd). */
+bool gen_model_global_is_deferred(const VarDeclStmt *decl)
+{
+    if (decl->initializer == NULL)
+        return false;
+    if (decl->initializer->type != EXPR_LITERAL)
+        return true;
+    return decl->type != NULL && decl->type->kind == TYPE_STRING;
+}
+
 /* Check if name exists in emitted list */
 static bool already_emitted(const char *name, const char **emitted, int count)
 {
@@ -280,15 +321,7 @@ static void emit_ns_import_recursive(
                     json_object_object_add(gvar, "name", json_object_new_string(prefixed));
                     json_object_object_add(gvar, "is_global", json_object_new_boolean(true));
                     json_object_object_add(gvar, "is_static", json_object_new_boolean(true));
-                    bool is_deferred = false;
-                    if (s->as.var_decl.initializer)
-                    {
-                        if (s->as.var_decl.initializer->type != EXPR_LITERAL)
-                            is_deferred = true;
-                        else if (s->as.var_decl.type && s->as.var_decl.type->kind == TYPE_STRING)
-                            is_deferred = true;
-                    }
-                    if (is_deferred)
+                    if (gen_model_global_is_deferred(&s->as.var_decl))
                         json_object_object_add(gvar, "is_deferred", json_object_new_boolean(true));
                     json_object_array_add(globals, gvar);
                 }
@@ -307,15 +340,7 @@ static void emit_ns_import_recursive(
                     json_object *gvar = gen_model_stmt(arena, s, symbol_table, arithmetic_mode);
                     json_object_object_add(gvar, "name", json_object_new_string(prefixed));
                     json_object_object_add(gvar, "is_global", json_object_new_boolean(true));
-                    bool is_deferred = false;
-                    if (s->as.var_decl.initializer)
-                    {
-                        if (s->as.var_decl.initializer->type != EXPR_LITERAL)
-                            is_deferred = true;
-                        else if (s->as.var_decl.type && s->as.var_decl.type->kind == TYPE_STRING)
-                            is_deferred = true;
-                    }
-                    if (is_deferred)
+                    if (gen_model_global_is_deferred(&s->as.var_decl))
                         json_object_object_add(gvar, "is_deferred", json_object_new_boolean(true));
                     json_object_array_add(globals, gvar);
                 }
@@ -518,6 +543,10 @@ json_object *gen_model_build(Arena *arena, Module *module, SymbolTable *symbol_t
     g_model_thread_count = 0;
     g_model_lambda_count = 0;
 
+    /* Initialize global parallel for-loop collection */
+    g_model_parallel_loops = json_object_new_array();
+    g_model_parallel_count = 0;
+
     /* Initialize global fn-wrapper collection */
     g_model_fn_wrappers = json_object_new_array();
     g_model_fn_wrapper_count = 0;
@@ -631,19 +660,7 @@ json_object *gen_model_build(Arena *arena, Module *module, SymbolTable *symbol_t
                 /* Source file tracking for modular compilation */
                 if (stmt->as.var_decl.name.filename)
                     gen_model_add_source_file(gvar, stmt->as.var_decl.name.filename);
-                /* Check if initializer is non-constant (needs deferred init in main).
-                 * For c-min: string globals with literal initializers are also deferred
-                 * so they can be strdup'd in main (string literals can't be free'd). */
-                bool is_deferred = false;
-                if (stmt->as.var_decl.initializer)
-                {
-                    if (stmt->as.var_decl.initializer->type != EXPR_LITERAL)
-                        is_deferred = true;
-                    else if (stmt->as.var_decl.type &&
-                             stmt->as.var_decl.type->kind == TYPE_STRING)
-                        is_deferred = true;
-                }
-                if (is_deferred)
+                if (gen_model_global_is_deferred(&stmt->as.var_decl))
                     json_object_object_add(gvar, "is_deferred", json_object_new_boolean(true));
                 /* Mark as global for cleanup purposes (globals don't get cleanup attrs,
                  * but need explicit cleanup at program exit) */
@@ -788,6 +805,19 @@ json_object *gen_model_build(Arena *arena, Module *module, SymbolTable *symbol_t
     json_object_object_add(root, "pragmas", pragmas);
     json_object_object_add(root, "imports", imports);
     json_object_object_add(root, "type_decls", type_decls);
+    /* threadlocal copies that own memory are freed by a per-thread hook */
+    bool has_thread_local_cleanup = false;
+    for (size_t i = 0; i < json_object_array_length(globals); i++)
+    {
+        json_object *gvar = json_object_array_get_idx(globals, i);
+        json_object *flag = NULL;
+        if (json_object_object_get_ex(gvar, "is_thread_local", &flag) && json_object_get_boolean(flag) &&
+            json_object_object_get_ex(gvar, "needs_cleanup", &flag) && json_object_get_boolean(flag))
+            has_thread_local_cleanup = true;
+    }
+    if (has_thread_local_cleanup)
+        json_object_object_add(mod, "has_thread_local_cleanup", json_object_new_boolean(true));
+
     json_object_object_add(root, "structs", structs);
     json_object_object_add(root, "globals", globals);
     json_object_object_add(root, "functions", functions);
@@ -796,6 +826,8 @@ json_object *gen_model_build(Arena *arena, Module *module, SymbolTable *symbol_t
     g_model_lambdas = NULL;
     json_object_object_add(root, "threads", g_model_threads);
     g_model_threads = NULL;
+    json_object_object_add(root, "parallel_loops", g_model_parallel_loops);
+    g_model_parallel_loops = NULL;
     json_object_object_add(root, "fn_wrappers", g_model_fn_wrappers);
     g_model_fn_wrappers = NULL;
 
@@ -41,6 +41,12 @@ extern json_object *g_model_threads;
 extern int g_model_thread_count;
 extern int g_model_lambda_count;
 
+/* Global parallel for-loop collection - populated during model building.
+ * Entries share their node with the parallel_for statement, so passes that
+ * rewrite the statement body also rewrite the outlined body. */
+extern json_object *g_model_parallel_loops;
+extern int g_model_parallel_count;
+
 /* Scope depth at the time prescan_function_body runs (before it pushes its own scope).
  * Variables declared at this depth or below are module-level C globals and must
  * never be added to lambda closure captures. */
@@ -143,6 +149,25 @@ extern const char *g_model_canonical_prefix;
 /* Post-processing pass: flatten method chains into sequential statements */
 void gen_model_flatten_chains(json_object *model);
 
+/* Post-processing pass: turn last-use copies of owned locals (ref structs,
+ * strings, arrays, val structs) into moves.
+ * Returns the number of copy/cleanup operations removed. */
+int gen_model_elide_refcounts(json_object *model);
+
+/* Post-processing pass: put non-escaping as-ref struct literals assigned to
+ * locals in stack storage.  Returns the number of locals placed. */
+int gen_model_stack_alloc_refs(json_object *model);
+
+/* Post-processing pass: put inline lambdas passed to non-escaping closure
+ * parameters, and the locals only they capture by reference, in stack
+ * storage.  Returns the number of closures placed. */
+int gen_model_stack_alloc_closures(json_object *model);
+
+/* Post-processing pass: call known lambdas directly and specialize
+ * higher-order functions for known closure arguments.  Returns the number of
+ * closure calls made direct; *specialized gets the number of copies made. */
+int gen_model_devirtualize_closures(json_object *model, int *specialized);
+
 /* --- Internal functions (used across gen_model_*.c files) --- */
 
 /* Enum-to-string conversions (shared by stmt, func, struct) */
@@ -167,8 +192,15 @@ json_object *gen_model_type(Arena *arena, Type *type);
 const char *gen_model_type_kind_str(TypeKind kind);
 bool gen_model_type_has_heap_fields(Type *type);
 const char *gen_model_var_cleanup_kind(Type *type, bool suppress_local);
+void gen_model_elem_hooks(Arena *arena, Type *elem_type,
+                          const char **release_fn, const char **copy_fn);
+const char *gen_model_elem_tag(Type *type);
 void gen_model_emit_param_cleanup(json_object *param_obj, Parameter *param, bool callee_is_native);
 
+/* True when a module-level variable is initialized at the start of main
+ * (or, for a threadlocal, on first use) rather than in its C declaration */
+bool gen_model_global_is_deferred(const VarDeclStmt *decl);
+
 /* Statement emission */
 json_object *gen_model_stmt(Arena *arena, Stmt *stmt, SymbolTable *symbol_table,
                             ArithmeticMode arithmetic_mode);
@@ -176,6 +208,16 @@ json_object *gen_model_stmt(Arena *arena, Stmt *stmt, SymbolTable *symbol_table,
 /* Expression emission */
 json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
                             ArithmeticMode arithmetic_mode);
+void gen_model_fn_arg(Arena *arena, json_object *obj, Expr *fn_arg,
+                      const char *fn_var, const char *fn_slot,
+                      SymbolTable *symbol_table, ArithmeticMode arithmetic_mode);
+
+/* Lazy iterator pipelines, fused into one loop: collected into an array
+ * (iter_collect) or driving a for-each (for_each_pipeline) */
+void gen_model_iter_collect(Arena *arena, json_object *obj, Expr *expr,
+                            SymbolTable *symbol_table, ArithmeticMode arithmetic_mode);
+void gen_model_for_each_pipeline(Arena *arena, json_object *obj, Stmt *stmt,
+                                 SymbolTable *symbol_table, ArithmeticMode arithmetic_mode);
 
 /* Function emission */
 json_object *gen_model_function(Arena *arena, FunctionStmt *func, SymbolTable *symbol_table,
@@ -185,11 +227,24 @@ json_object *gen_model_function(Arena *arena, FunctionStmt *func, SymbolTable *s
 json_object *gen_model_struct(Arena *arena, StructDeclStmt *decl, SymbolTable *symbol_table,
                               ArithmeticMode arithmetic_mode);
 
-/* Lock scope stack — tracks active lock variable names so return statements
- * can emit pthread_mutex_unlock before returning.  Pushed/popped in STMT_LOCK,
- * read in STMT_RETURN. */
+/* Built-in container model (map<K, V>, MapIter<K, V>) — adds container keys to a struct model */
+void gen_model_container(Arena *arena, StructDeclStmt *decl, json_object *obj);
+
+/* Lock scope stack — tracks active lock blocks so return statements can
+ * release them before returning.  Pushed/popped in STMT_LOCK, read in
+ * STMT_RETURN and by sync variable updates. */
 #define MAX_LOCK_DEPTH 16
-extern const char *g_lock_var_names[MAX_LOCK_DEPTH];
+typedef struct {
+    const char *name;       /* the sync variable */
+    const char *release;    /* C function that releases the hold */
+    const char *stripe;     /* C local holding the element's stripe, NULL for whole-variable locks */
+    bool shared;            /* lock read(...) */
+} GenLockScope;
+extern GenLockScope g_lock_scopes[MAX_LOCK_DEPTH];
 extern int g_lock_depth;
 
+/* C functions that take and release a sync variable's lock exclusively */
+const char *gen_model_lock_acquire(SyncLockKind kind);
+const char *gen_model_lock_release(SyncLockKind kind);
+
 #endif
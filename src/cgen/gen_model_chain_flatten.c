@@ -209,7 +209,9 @@ static void extract_heap_producing_args(json_object *args, json_object *inserts)
         const char *akind = json_object_get_string(arg_kind);
         bool is_call_result = (strcmp(akind, "call") == 0 ||
                                strcmp(akind, "method_call") == 0 ||
-                               strcmp(akind, "static_call") == 0);
+                               strcmp(akind, "static_call") == 0 ||
+                               strcmp(akind, "array_hof") == 0 ||
+                               strcmp(akind, "iter_collect") == 0);
         bool is_lifted_member = false;
         if (!is_call_result && strcmp(akind, "member") == 0)
         {
@@ -378,6 +380,74 @@ static void extract_interp_string_args(json_object *args, json_object *inserts)
  * When found, extract the object into a var_decl and collect it in `inserts`.
  * Process innermost chains first (depth-first).
  */
+/* Move parent[key] into a chain temp declared before the statement, so it
+ * is released after it, if it is not an lvalue already */
+static void extract_chain_temp(json_object *parent, const char *key, json_object *inserts)
+{
+    json_object *object = NULL;
+    if (!json_object_object_get_ex(parent, key, &object) || !needs_temp_extraction(object))
+        return;
+
+    char tmp_name[64];
+    snprintf(tmp_name, sizeof(tmp_name), "__chain_tmp_%d", g_chain_tmp_count++);
+
+    json_object *obj_type = NULL;
+    json_object_object_get_ex(object, "type", &obj_type);
+
+    json_object *var_decl = json_object_new_object();
+    json_object_object_add(var_decl, "kind", json_object_new_string("var_decl"));
+    json_object_object_add(var_decl, "name", json_object_new_string(tmp_name));
+    if (obj_type)
+        json_object_object_add(var_decl, "type", json_object_get(obj_type));
+    json_object_object_add(var_decl, "initializer", json_object_get(object));
+    annotate_chain_temp(var_decl, obj_type);
+    json_object_array_add(inserts, var_decl);
+
+    json_object *var_ref = json_object_new_object();
+    json_object_object_add(var_ref, "kind", json_object_new_string("variable"));
+    json_object_object_add(var_ref, "name", json_object_new_string(tmp_name));
+    if (obj_type)
+        json_object_object_add(var_ref, "type", json_object_get(obj_type));
+    json_object_object_add(parent, key, var_ref);
+}
+
+static void flatten_expr(json_object *expr, json_object *inserts);
+
+/* An iterator pipeline (iter_collect, for_each_pipeline): the source and
+ * zip's arrays go into chain temps; the loop no longer owns them */
+static void flatten_pipeline(json_object *pipe, json_object *inserts)
+{
+    json_object *source = NULL;
+    if (json_object_object_get_ex(pipe, "source", &source))
+    {
+        flatten_expr(source, inserts);
+        extract_chain_temp(pipe, "source", inserts);
+        json_object_object_add(pipe, "source_is_temp", json_object_new_boolean(false));
+    }
+    json_object *bound = NULL;
+    if (json_object_object_get_ex(pipe, "start", &bound))
+        flatten_expr(bound, inserts);
+    if (json_object_object_get_ex(pipe, "end", &bound))
+        flatten_expr(bound, inserts);
+
+    json_object *stages = NULL;
+    if (!json_object_object_get_ex(pipe, "stages", &stages)) return;
+    int n = (int)json_object_array_length(stages);
+    for (int i = 0; i < n; i++)
+    {
+        json_object *st = json_object_array_get_idx(stages, i);
+        json_object *arg = NULL;
+        if (json_object_object_get_ex(st, "count", &arg))
+            flatten_expr(arg, inserts);
+        if (json_object_object_get_ex(st, "other", &arg))
+        {
+            flatten_expr(arg, inserts);
+            extract_chain_temp(st, "other", inserts);
+            json_object_object_add(st, "other_is_temp", json_object_new_boolean(false));
+        }
+    }
+}
+
 static void flatten_expr(json_object *expr, json_object *inserts)
 {
     if (!expr || !json_object_is_type(expr, json_type_object)) return;
@@ -386,6 +456,36 @@ static void flatten_expr(json_object *expr, json_object *inserts)
     if (!json_object_object_get_ex(expr, "kind", &kind_obj)) return;
     const char *kind = json_object_get_string(kind_obj);
 
+    /* Stores out of an arena block run with the region suspended.  Temps
+     * hoisted out of them must allocate from the system heap too, since the
+     * store may take ownership of them — wrap each initializer the same way. */
+    if (strcmp(kind, "region_suspend") == 0)
+    {
+        json_object *inner = NULL;
+        if (!json_object_object_get_ex(expr, "expr", &inner)) return;
+        json_object *local = json_object_new_array();
+        flatten_expr(inner, local);
+        int len = json_object_array_length(local);
+        for (int i = 0; i < len; i++)
+        {
+            json_object *decl = json_object_array_get_idx(local, i);
+            json_object *init = NULL;
+            if (json_object_object_get_ex(decl, "initializer", &init))
+            {
+                json_object *wrap = json_object_new_object();
+                json_object_object_add(wrap, "kind", json_object_new_string("region_suspend"));
+                json_object *init_type = NULL;
+                if (json_object_object_get_ex(decl, "type", &init_type))
+                    json_object_object_add(wrap, "type", json_object_get(init_type));
+                json_object_object_add(wrap, "expr", json_object_get(init));
+                json_object_object_add(decl, "initializer", wrap);
+            }
+            json_object_array_add(inserts, json_object_get(decl));
+        }
+        json_object_put(local);
+        return;
+    }
+
     /* Thread spawns contain a call — recurse into it but do NOT extract
      * interpolated string args, because the temp variable's sn_auto_str
      * cleanup would free the string before the thread copies the arg. */
@@ -409,6 +509,28 @@ static void flatten_expr(json_object *expr, json_object *inserts)
         return;
     }
 
+    /* arr.map(f) and friends: a temporary array (xs.map(f).filter(g)) goes
+     * into a chain temp so it is released after the loop */
+    if (strcmp(kind, "array_hof") == 0)
+    {
+        json_object *object = NULL;
+        if (json_object_object_get_ex(expr, "object", &object))
+        {
+            flatten_expr(object, inserts);
+            extract_chain_temp(expr, "object", inserts);
+        }
+        json_object *init = NULL;
+        if (json_object_object_get_ex(expr, "init", &init))
+            flatten_expr(init, inserts);
+        return;
+    }
+
+    if (strcmp(kind, "iter_collect") == 0)
+    {
+        flatten_pipeline(expr, inserts);
+        return;
+    }
+
     /* For call expressions with member callee, check the callee's object */
     if (strcmp(kind, "call") == 0)
     {
@@ -702,7 +824,8 @@ static void flatten_stmt_list(json_object *stmts)
                 }
                 else if (strcmp(kind, "while") == 0 || strcmp(kind, "for") == 0 ||
                          strcmp(kind, "for_each") == 0 || strcmp(kind, "for_each_iter") == 0 ||
-                         strcmp(kind, "lock") == 0)
+                         strcmp(kind, "for_each_pipeline") == 0 ||
+                         strcmp(kind, "parallel_for") == 0 || strcmp(kind, "lock") == 0)
                 {
                     if (json_object_object_get_ex(stmt, "body", &body))
                         flatten_body(body);
@@ -759,6 +882,24 @@ static void flatten_stmt_list(json_object *stmts)
                 if (json_object_object_get_ex(stmt, "iterable", &iter))
                     flatten_expr(iter, inserts);
             }
+            else if (skind && strcmp(skind, "for_each_pipeline") == 0)
+            {
+                /* Scan the pipeline's source and arguments, not body */
+                flatten_pipeline(stmt, inserts);
+            }
+            else if (skind && strcmp(skind, "parallel_for") == 0)
+            {
+                /* Scan bounds or iterable and chunk size, not body */
+                json_object *hdr = NULL;
+                if (json_object_object_get_ex(stmt, "iterable", &hdr))
+                    flatten_expr(hdr, inserts);
+                if (json_object_object_get_ex(stmt, "start", &hdr))
+                    flatten_expr(hdr, inserts);
+                if (json_object_object_get_ex(stmt, "end", &hdr))
+                    flatten_expr(hdr, inserts);
+                if (json_object_object_get_ex(stmt, "chunk", &hdr))
+                    flatten_expr(hdr, inserts);
+            }
             else if (skind && (strcmp(skind, "if") == 0))
             {
                 /* Scan condition and else-if conditions, not bodies */
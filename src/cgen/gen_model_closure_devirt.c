@@ -0,0 +1,567 @@
+/*
+ * gen_model_closure_devirt.c — Post-processing pass that turns closure calls
+ * with a statically known target into direct calls.
+ *
+ * A closure call loads the function pointer out of the closure box, which
+ * GCC cannot see through.  When the callee is known to be a particular lambda
+ * the call names __lambda_N__ directly (direct_fn on the call), so the C
+ * compiler can inline it.  The target is known when the callee is:
+ *   - a local closure variable initialized with a lambda literal, declared
+ *     once in the function, never reassigned or captured by reference, and
+ *     not also bound by a for-each loop
+ *   - a lambda literal invoked on the spot (only without captures, where the
+ *     closure argument can be NULL)
+ *   - inside a specialized copy (below), a parameter bound to a lambda or to
+ *     a named function's __fn_wrap_N__
+ *
+ * Example:
+ *   var sq: fn(int): int = fn(x: int): int => x * x
+ *   sq(4)
+ *   Before: ((long long (*)(void *, long long))((__Closure__ *)__sn__sq)->fn)(__sn__sq, 4LL)
+ *   After:  ((long long (*)(void *, long long))__lambda_0__)(__sn__sq, 4LL)
+ *
+ * Higher-order functions are specialized per known closure argument.  A call
+ * apply(sq, 2) whose parameter f is called inside apply is redirected to a
+ * copy apply__dvN with devirt_params = [{ name: "f", target: "__lambda_0__" }],
+ * and the copy's calls through f are made direct.  Named function arguments
+ * (apply(double, 2)) bind f to the function's __fn_wrap_N__.  Recursive calls
+ * that pass f along resolve to the same copy.  A lambda binding needs the
+ * copy in the lambda's own source file (lambdas are static to their module);
+ * functions with lambdas, threads or static locals are never copied.
+ */
+
+#include "gen_model_json_util.h"
+#include <json-c/json.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DV_MAX_KNOWN 64
+#define DV_MAX_SPECIALIZATIONS 8
+
+typedef struct {
+    const char *name;
+    char target[48];            /* __lambda_N__ or __fn_wrap_N__ */
+    const char *source_file;    /* module the target is static to, or NULL */
+} DevirtKnown;
+
+typedef struct {
+    DevirtKnown items[DV_MAX_KNOWN];
+    int count;
+} DevirtScope;
+
+typedef struct {
+    const char *name;
+    json_object *fn;
+    bool can_specialize;
+    int spec_count;
+} DevirtFunc;
+
+typedef struct {
+    char *key;
+    char *clone_name;
+} DevirtSpec;
+
+static DevirtFunc *g_dv_funcs = NULL;
+static int g_dv_func_count = 0;
+static DevirtSpec *g_dv_specs = NULL;
+static int g_dv_spec_count = 0;
+static int g_dv_clone_count = 0;
+
+static bool dv_streq(const char *a, const char *b)
+{
+    return a && b && strcmp(a, b) == 0;
+}
+
+static int dv_lambda_id(json_object *lambda)
+{
+    json_object *id = model_get(lambda, "lambda_id");
+    return id ? json_object_get_int(id) : -1;
+}
+
+static DevirtKnown *dv_scope_lookup(DevirtScope *scope, const char *name)
+{
+    for (int i = 0; i < scope->count; i++)
+        if (dv_streq(scope->items[i].name, name))
+            return &scope->items[i];
+    return NULL;
+}
+
+static void dv_scope_add(DevirtScope *scope, const char *name, const char *target,
+                         const char *source_file)
+{
+    if (scope->count < DV_MAX_KNOWN && name && target)
+    {
+        DevirtKnown *k = &scope->items[scope->count++];
+        k->name = name;
+        snprintf(k->target, sizeof(k->target), "%s", target);
+        k->source_file = source_file;
+    }
+}
+
+static const char *dv_lambda_source(json_object *model, int lambda_id)
+{
+    json_object *lambdas = model_get(model, "lambdas");
+    int n = lambdas ? (int)json_object_array_length(lambdas) : 0;
+    for (int i = 0; i < n; i++)
+    {
+        json_object *ldef = json_object_array_get_idx(lambdas, i);
+        if (dv_lambda_id(ldef) == lambda_id)
+            return model_str(ldef, "source_file");
+    }
+    return NULL;
+}
+
+/* Target of a closure-valued expression, if it is a lambda literal or a
+ * wrapped named function; `out` gets the name and source file. */
+static bool dv_literal_target(json_object *model, json_object *expr, DevirtKnown *out)
+{
+    json_object *wid = NULL;
+    if (model_kind_is(expr, "lambda") && dv_lambda_id(expr) >= 0)
+    {
+        snprintf(out->target, sizeof(out->target), "__lambda_%d__", dv_lambda_id(expr));
+        out->source_file = dv_lambda_source(model, dv_lambda_id(expr));
+        return out->source_file != NULL;
+    }
+    if (model_bool(expr, "is_fn_ref_arg") &&
+        json_object_object_get_ex(expr, "fn_wrapper_id", &wid))
+    {
+        snprintf(out->target, sizeof(out->target), "__fn_wrap_%d__", json_object_get_int(wid));
+        out->source_file = NULL;
+        return true;
+    }
+    return false;
+}
+
+/* Bindings of `name` in this function body: var_decls and for-each loop
+ * variables (iterator_name, on every for-each kind).  Names are the only key
+ * the pass has, so a name bound more than once is never treated as known.
+ * Nested lambdas render as their own functions and are not part of the scope. */
+static int dv_count_bindings(json_object *node, const char *name)
+{
+    if (!node) return 0;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node), c = 0;
+        for (int i = 0; i < n; i++)
+            c += dv_count_bindings(json_object_array_get_idx(node, i), name);
+        return c;
+    }
+    if (!json_object_is_type(node, json_type_object)) return 0;
+    if (model_kind_is(node, "lambda")) return 0;
+
+    int c = (model_kind_is(node, "var_decl") &&
+             dv_streq(model_str(node, "name"), name)) ? 1 : 0;
+    if (dv_streq(model_str(node, "iterator_name"), name))
+        c++;
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        c += dv_count_bindings(val, name);
+    }
+    return c;
+}
+
+/* Any assignment to `name`, including from nested lambdas */
+static bool dv_is_assigned(json_object *node, const char *name)
+{
+    if (!node) return false;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            if (dv_is_assigned(json_object_array_get_idx(node, i), name))
+                return true;
+        return false;
+    }
+    if (!json_object_is_type(node, json_type_object)) return false;
+
+    if (model_kind_is(node, "assign") && dv_streq(model_str(node, "target"), name))
+        return true;
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        if (dv_is_assigned(val, name))
+            return true;
+    }
+    return false;
+}
+
+static bool dv_is_param(json_object *params, const char *name)
+{
+    int n = params ? (int)json_object_array_length(params) : 0;
+    for (int i = 0; i < n; i++)
+        if (dv_streq(model_str(json_object_array_get_idx(params, i), "name"), name))
+            return true;
+    return false;
+}
+
+/* Local closure variables bound to a lambda literal for their whole life */
+static void dv_collect_known(json_object *model, json_object *node, json_object *body,
+                             json_object *params, DevirtScope *scope)
+{
+    if (!node) return;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            dv_collect_known(model, json_object_array_get_idx(node, i), body, params, scope);
+        return;
+    }
+    if (!json_object_is_type(node, json_type_object)) return;
+    if (model_kind_is(node, "lambda")) return;
+
+    if (model_kind_is(node, "var_decl"))
+    {
+        const char *name = model_str(node, "name");
+        json_object *init = model_get(node, "initializer");
+        const char *mq = model_str(node, "mem_qual");
+        DevirtKnown k;
+        if (name && model_kind_is(init, "lambda") &&
+            model_kind_is(model_get(node, "type"), "function") &&
+            !model_bool(node, "is_captured") && !model_bool(node, "is_static") &&
+            (!mq || strcmp(mq, "default") == 0) &&
+            !dv_is_param(params, name) && dv_count_bindings(body, name) == 1 &&
+            !dv_is_assigned(body, name) && dv_literal_target(model, init, &k))
+            dv_scope_add(scope, name, k.target, k.source_file);
+    }
+
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        dv_collect_known(model, val, body, params, scope);
+    }
+}
+
+/* Constructs a function copy must not duplicate */
+static bool dv_has_unclonable(json_object *node)
+{
+    if (!node) return false;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            if (dv_has_unclonable(json_object_array_get_idx(node, i)))
+                return true;
+        return false;
+    }
+    if (!json_object_is_type(node, json_type_object)) return false;
+
+    const char *kind = model_str(node, "kind");
+    if (kind && (strcmp(kind, "lambda") == 0 || strcmp(kind, "function") == 0 ||
+                 strncmp(kind, "thread_", 7) == 0 || strcmp(kind, "parallel_for") == 0))
+        return true;
+    /* parMap/parReduce own a parallel body keyed by par_id, like parallel for */
+    if (model_kind_is(node, "array_hof") && model_bool(node, "is_parallel"))
+        return true;
+    if (model_kind_is(node, "var_decl") && model_bool(node, "is_static"))
+        return true;
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        if (dv_has_unclonable(val))
+            return true;
+    }
+    return false;
+}
+
+/* Is `name` called, or passed on to another function, anywhere in `node`? */
+static bool dv_param_is_used(json_object *node, const char *name)
+{
+    if (!node) return false;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            if (dv_param_is_used(json_object_array_get_idx(node, i), name))
+                return true;
+        return false;
+    }
+    if (!json_object_is_type(node, json_type_object)) return false;
+
+    if (model_kind_is(node, "call"))
+    {
+        json_object *callee = model_get(node, "callee");
+        if (model_bool(node, "is_closure_call") && model_kind_is(callee, "variable") &&
+            dv_streq(model_str(callee, "name"), name))
+            return true;
+        json_object *args = model_get(node, "args");
+        int n = args ? (int)json_object_array_length(args) : 0;
+        for (int i = 0; i < n; i++)
+        {
+            json_object *arg = json_object_array_get_idx(args, i);
+            if (model_kind_is(arg, "variable") && dv_streq(model_str(arg, "name"), name))
+                return true;
+        }
+    }
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        if (dv_param_is_used(val, name))
+            return true;
+    }
+    return false;
+}
+
+static void dv_build_funcs(json_object *model)
+{
+    json_object *functions = model_get(model, "functions");
+    int fn_count = functions ? (int)json_object_array_length(functions) : 0;
+
+    g_dv_funcs = calloc(fn_count ? fn_count : 1, sizeof(DevirtFunc));
+    g_dv_func_count = 0;
+    for (int i = 0; i < fn_count; i++)
+    {
+        json_object *fn = json_object_array_get_idx(functions, i);
+        const char *name = model_str(fn, "name");
+        json_object *body = model_get(fn, "body");
+        if (!name || !body || !model_get(fn, "params") || model_bool(fn, "is_native")) continue;
+
+        DevirtFunc *f = &g_dv_funcs[g_dv_func_count++];
+        f->name = name;
+        f->fn = fn;
+        f->can_specialize = strcmp(name, "main") != 0 && !dv_has_unclonable(body);
+    }
+}
+
+static DevirtFunc *dv_find_func(const char *name)
+{
+    for (int i = 0; i < g_dv_func_count; i++)
+        if (dv_streq(g_dv_funcs[i].name, name))
+            return &g_dv_funcs[i];
+    return NULL;
+}
+
+/* Name of the copy of `f` with parameters bound to the targets in
+ * `known` (NULL entries are unbound), creating it on first use; NULL if no
+ * parameter can be bound. */
+static const char *dv_specialize(json_object *model, DevirtFunc *f, DevirtKnown **known)
+{
+    json_object *params = model_get(f->fn, "params");
+    json_object *body = model_get(f->fn, "body");
+    const char *source = model_str(f->fn, "source_file");
+    int n = (int)json_object_array_length(params);
+
+    char key[512];
+    int len = snprintf(key, sizeof(key), "%s", f->name);
+    bool *bind = calloc(n ? n : 1, sizeof(bool));
+    int bound = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (!known[i]) continue;
+        json_object *p = json_object_array_get_idx(params, i);
+        const char *pname = model_str(p, "name");
+        const char *mq = model_str(p, "mem_qual");
+        if (!pname || (mq && strcmp(mq, "default") != 0) ||
+            !model_kind_is(model_get(p, "type"), "function") ||
+            (known[i]->source_file && !dv_streq(source, known[i]->source_file)) ||
+            dv_count_bindings(body, pname) != 0 || dv_is_assigned(body, pname) ||
+            !dv_param_is_used(body, pname))
+            continue;
+        len += snprintf(key + len, sizeof(key) - len, " %d=%s", i, known[i]->target);
+        bind[i] = true;
+        bound++;
+    }
+    if (bound == 0 || len >= (int)sizeof(key))
+    {
+        free(bind);
+        return NULL;
+    }
+
+    for (int i = 0; i < g_dv_spec_count; i++)
+        if (strcmp(g_dv_specs[i].key, key) == 0)
+        {
+            free(bind);
+            return g_dv_specs[i].clone_name;
+        }
+
+    json_object *clone = NULL;
+    if (f->spec_count >= DV_MAX_SPECIALIZATIONS ||
+        json_object_deep_copy(f->fn, &clone, NULL) != 0 || !clone)
+    {
+        free(bind);
+        return NULL;
+    }
+
+    char clone_name[256];
+    snprintf(clone_name, sizeof(clone_name), "%s__dv%d", f->name, g_dv_clone_count++);
+    json_object_object_add(clone, "name", json_object_new_string(clone_name));
+
+    json_object *devirt_params = json_object_new_array();
+    for (int i = 0; i < n; i++)
+    {
+        if (!bind[i]) continue;
+        json_object *b = json_object_new_object();
+        json_object_object_add(b, "name", json_object_new_string(
+            model_str(json_object_array_get_idx(params, i), "name")));
+        json_object_object_add(b, "target", json_object_new_string(known[i]->target));
+        json_object_array_add(devirt_params, b);
+    }
+    free(bind);
+    json_object_object_add(clone, "devirt_params", devirt_params);
+    json_object_array_add(model_get(model, "functions"), clone);
+    f->spec_count++;
+
+    g_dv_specs = realloc(g_dv_specs, (g_dv_spec_count + 1) * sizeof(DevirtSpec));
+    g_dv_specs[g_dv_spec_count].key = strdup(key);
+    g_dv_specs[g_dv_spec_count].clone_name = strdup(clone_name);
+    return g_dv_specs[g_dv_spec_count++].clone_name;
+}
+
+
+/* Make known closure calls direct and redirect calls that pass known lambdas
+ * to specialized copies.  Thread spawns call through their own wrappers and
+ * nested lambdas are handled from the lambdas list, so neither is entered. */
+static int dv_rewrite(json_object *model, json_object *node, DevirtScope *scope, int *specialized)
+{
+    if (!node) return 0;
+    int direct = 0;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            direct += dv_rewrite(model, json_object_array_get_idx(node, i), scope, specialized);
+        return direct;
+    }
+    if (!json_object_is_type(node, json_type_object)) return 0;
+
+    const char *kind = model_str(node, "kind");
+    if (kind && (strcmp(kind, "lambda") == 0 || strncmp(kind, "thread_", 7) == 0))
+        return 0;
+
+    if (kind && strcmp(kind, "call") == 0 && !model_get(node, "direct_fn"))
+    {
+        json_object *callee = model_get(node, "callee");
+        json_object *args = model_get(node, "args");
+        DevirtKnown lit;
+        if (model_bool(node, "is_closure_call"))
+        {
+            DevirtKnown *k = NULL;
+            if (model_kind_is(callee, "variable") && !model_bool(callee, "is_captured"))
+                k = dv_scope_lookup(scope, model_str(callee, "name"));
+            if (k)
+            {
+                json_object_object_add(node, "direct_fn", json_object_new_string(k->target));
+                direct++;
+            }
+        }
+        else if (model_kind_is(callee, "lambda") && !model_bool(callee, "has_captures") &&
+                 dv_literal_target(model, callee, &lit))
+        {
+            json_object_object_add(node, "is_closure_call", json_object_new_boolean(true));
+            json_object_object_add(node, "direct_null_closure", json_object_new_boolean(true));
+            json_object_object_add(node, "direct_fn", json_object_new_string(lit.target));
+            direct++;
+        }
+        else if (model_kind_is(callee, "variable") && args && !model_bool(node, "is_fn_field_call"))
+        {
+            DevirtFunc *f = dv_find_func(model_str(callee, "name"));
+            int n = (int)json_object_array_length(args);
+            if (f && f->can_specialize &&
+                n == (int)json_object_array_length(model_get(f->fn, "params")))
+            {
+                DevirtKnown *lits = calloc(n ? n : 1, sizeof(DevirtKnown));
+                DevirtKnown **known = calloc(n ? n : 1, sizeof(DevirtKnown *));
+                bool any = false;
+                for (int i = 0; i < n; i++)
+                {
+                    json_object *arg = json_object_array_get_idx(args, i);
+                    if (dv_literal_target(model, arg, &lits[i]))
+                        known[i] = &lits[i];
+                    else if (model_kind_is(arg, "variable") && !model_bool(arg, "is_captured"))
+                        known[i] = dv_scope_lookup(scope, model_str(arg, "name"));
+                    any = any || known[i];
+                }
+                int before = g_dv_spec_count;
+                const char *clone = any ? dv_specialize(model, f, known) : NULL;
+                if (clone)
+                {
+                    json_object_object_add(callee, "name", json_object_new_string(clone));
+                    *specialized += g_dv_spec_count - before;
+                }
+                free(known);
+                free(lits);
+            }
+        }
+    }
+
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        direct += dv_rewrite(model, val, scope, specialized);
+    }
+    return direct;
+}
+
+static int dv_rewrite_body(json_object *model, json_object *body, json_object *params,
+                           json_object *bindings, int *specialized)
+{
+    if (!body) return 0;
+    DevirtScope scope;
+    scope.count = 0;
+    int n = bindings ? (int)json_object_array_length(bindings) : 0;
+    for (int i = 0; i < n; i++)
+    {
+        json_object *b = json_object_array_get_idx(bindings, i);
+        dv_scope_add(&scope, model_str(b, "name"), model_str(b, "target"), NULL);
+    }
+    dv_collect_known(model, body, body, params, &scope);
+    return dv_rewrite(model, body, &scope, specialized);
+}
+
+int gen_model_devirtualize_closures(json_object *model, int *specialized)
+{
+    int spec = 0, direct = 0;
+    dv_build_funcs(model);
+
+    /* Specialized copies are appended while iterating and processed in turn */
+    json_object *functions = model_get(model, "functions");
+    for (int i = 0; functions && i < (int)json_object_array_length(functions); i++)
+    {
+        json_object *fn = json_object_array_get_idx(functions, i);
+        if (model_bool(fn, "is_native")) continue;
+        direct += dv_rewrite_body(model, model_get(fn, "body"), model_get(fn, "params"),
+                                  model_get(fn, "devirt_params"), &spec);
+    }
+
+    json_object *structs = model_get(model, "structs");
+    int sn = structs ? (int)json_object_array_length(structs) : 0;
+    for (int i = 0; i < sn; i++)
+    {
+        json_object *methods = model_get(json_object_array_get_idx(structs, i), "methods");
+        int mn = methods ? (int)json_object_array_length(methods) : 0;
+        for (int j = 0; j < mn; j++)
+        {
+            json_object *m = json_object_array_get_idx(methods, j);
+            direct += dv_rewrite_body(model, model_get(m, "body"), model_get(m, "params"),
+                                      NULL, &spec);
+        }
+    }
+
+    json_object *lambdas = model_get(model, "lambdas");
+    int ln = lambdas ? (int)json_object_array_length(lambdas) : 0;
+    for (int i = 0; i < ln; i++)
+    {
+        json_object *ldef = json_object_array_get_idx(lambdas, i);
+        json_object *params = model_get(ldef, "params");
+        direct += dv_rewrite_body(model, model_get(ldef, "body_stmts"), params, NULL, &spec);
+        direct += dv_rewrite_body(model, model_get(ldef, "body"), params, NULL, &spec);
+    }
+
+    for (int i = 0; i < g_dv_spec_count; i++)
+    {
+        free(g_dv_specs[i].key);
+        free(g_dv_specs[i].clone_name);
+    }
+    free(g_dv_specs);
+    g_dv_specs = NULL;
+    g_dv_spec_count = 0;
+    g_dv_clone_count = 0;
+    free(g_dv_funcs);
+    g_dv_funcs = NULL;
+    g_dv_func_count = 0;
+
+    if (specialized) *specialized = spec;
+    return direct;
+}
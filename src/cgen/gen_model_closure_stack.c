@@ -0,0 +1,254 @@
+/*
+ * gen_model_closure_stack.c — Post-processing pass that places non-escaping
+ * closures and their by-reference captures in stack storage.
+ *
+ * A lambda passed inline to a function call normally mallocs a closure box
+ * that sn_auto_fn frees after the call.  If the callee only ever calls the
+ * parameter (or hands it to another such parameter), the box cannot outlive
+ * the call and is built in a stack slot instead (stack_storage on the lambda).
+ *
+ * Example:
+ *   var total: int = 0
+ *   each(arr, fn(v: int): void => total += v)
+ *   Before: sn_auto_capture long long *__sn__total = malloc(sizeof(long long)); ...
+ *           ({ sn_auto_fn void *__fn_tmp_1__ = ({ ... malloc(sizeof(__closure_0__)) ... }); ... })
+ *   After:  long long __sn__total__stk__; long long *__sn__total = &__sn__total__stk__; ...
+ *           ({ __closure_0__ __fn_tmp_1__stk__; void *__fn_tmp_1__ = ({ ... &__fn_tmp_1__stk__ ... }); ... })
+ *
+ * A closure parameter is non-escaping when every mention of it in the callee
+ * is one of:
+ *   - the callee of a closure call (f(x))
+ *   - an argument to a function whose matching parameter does not escape
+ *   - the function given to an array method such as arr.map(f)
+ * computed over all functions and iterated to a fixpoint so recursive callees
+ * are handled.  Callees with lambdas, nested functions or thread operations
+ * are left alone.  Lambdas whose captures need cleanup (strings, arrays,
+ * refcounted values) keep the heap box, since only its cleanup releases them.
+ *
+ * A captured variable is promoted to a heap box so closures can reach it.
+ * When every lambda that captures it by reference is stack-allocated, the box
+ * becomes a stack slot as well (stack_capture on the var_decl).
+ */
+
+#include "gen_model_json_util.h"
+#include <json-c/json.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+static ModelCalleeTable g_cl_callees;
+
+/* Callee of a plain function call whose parameters line up with args */
+static ModelCallee *cs_call_target(json_object *call)
+{
+    if (!model_kind_is(call, "call") || model_bool(call, "is_closure_call") ||
+        model_bool(call, "is_fn_field_call"))
+        return NULL;
+    json_object *callee = model_get(call, "callee");
+    json_object *args = model_get(call, "args");
+    if (!model_kind_is(callee, "variable") || !args) return NULL;
+    ModelCallee *f = model_callees_find_function(&g_cl_callees, model_str(callee, "name"));
+    if (!f || json_object_array_length(args) != json_object_array_length(f->params))
+        return NULL;
+    return f;
+}
+
+/* Count mentions of `name` that cannot let the closure escape */
+static int cs_count_safe(json_object *node, const char *name)
+{
+    if (!node) return 0;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node), c = 0;
+        for (int i = 0; i < n; i++)
+            c += cs_count_safe(json_object_array_get_idx(node, i), name);
+        return c;
+    }
+    if (!json_object_is_type(node, json_type_object)) return 0;
+
+    int c = 0;
+    if (model_kind_is(node, "call") && model_bool(node, "is_closure_call") &&
+        model_is_var(model_get(node, "callee"), name))
+        c++;
+    /* arr.map(f) and friends, and pipeline stages, only call f before they return */
+    if ((model_kind_is(node, "array_hof") || model_kind_is(node, "iter_stage")) &&
+        model_is_var(model_get(node, "fn"), name))
+        c++;
+
+    ModelCallee *f = cs_call_target(node);
+    if (f)
+    {
+        json_object *args = model_get(node, "args");
+        int n = (int)json_object_array_length(args);
+        for (int i = 0; i < n; i++)
+            if (f->param_safe[i] && model_is_var(json_object_array_get_idx(args, i), name))
+                c++;
+    }
+
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        c += cs_count_safe(val, name);
+    }
+    return c;
+}
+
+static bool cs_param_ok(json_object *param)
+{
+    return model_kind_is(model_get(param, "type"), "function");
+}
+
+/* Mark inline lambda arguments to non-escaping parameters.  Calls inside a
+ * thread spawn run on another thread's stack and are skipped. */
+static int cs_place_walk(json_object *node)
+{
+    if (!node) return 0;
+    int placed = 0;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            placed += cs_place_walk(json_object_array_get_idx(node, i));
+        return placed;
+    }
+    if (!json_object_is_type(node, json_type_object)) return 0;
+
+    const char *kind = model_str(node, "kind");
+    if (kind && strncmp(kind, "thread_", 7) == 0) return 0;
+
+    ModelCallee *f = cs_call_target(node);
+    if (f)
+    {
+        json_object *args = model_get(node, "args");
+        int n = (int)json_object_array_length(args);
+        for (int i = 0; i < n; i++)
+        {
+            json_object *arg = json_object_array_get_idx(args, i);
+            const char *tmp = model_str(arg, "fn_ref_tmp_var");
+            if (!f->param_safe[i] || !tmp || !model_kind_is(arg, "lambda") ||
+                model_bool(arg, "has_capture_cleanup") || model_get(arg, "stack_storage"))
+                continue;
+            char slot[96];
+            snprintf(slot, sizeof(slot), "%sstk__", tmp);
+            json_object_object_add(arg, "stack_storage", json_object_new_string(slot));
+            placed++;
+        }
+    }
+
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        placed += cs_place_walk(val);
+    }
+    return placed;
+}
+
+/* Does any heap-allocated lambda under `node` capture `name` by reference? */
+static bool cs_heap_ref_capture(json_object *node, const char *name)
+{
+    if (!node) return false;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            if (cs_heap_ref_capture(json_object_array_get_idx(node, i), name))
+                return true;
+        return false;
+    }
+    if (!json_object_is_type(node, json_type_object)) return false;
+
+    if (model_kind_is(node, "lambda") && !model_get(node, "stack_storage"))
+    {
+        json_object *caps = model_get(node, "captures");
+        int n = caps ? (int)json_object_array_length(caps) : 0;
+        for (int i = 0; i < n; i++)
+        {
+            json_object *cap = json_object_array_get_idx(caps, i);
+            const char *cn = model_str(cap, "name");
+            if (model_bool(cap, "is_ref") && cn && strcmp(cn, name) == 0)
+                return true;
+        }
+    }
+
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        if (cs_heap_ref_capture(val, name))
+            return true;
+    }
+    return false;
+}
+
+/* Captured locals of a function body, not descending into lambdas: their
+ * var_decls are emitted in the lambda's own function. */
+static int cs_place_captures(json_object *node, json_object *body)
+{
+    if (!node) return 0;
+    int placed = 0;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            placed += cs_place_captures(json_object_array_get_idx(node, i), body);
+        return placed;
+    }
+    if (!json_object_is_type(node, json_type_object)) return 0;
+    if (model_kind_is(node, "lambda")) return 0;
+
+    const char *name = model_str(node, "name");
+    if (model_kind_is(node, "var_decl") && model_bool(node, "is_captured") && name &&
+        !model_bool(node, "is_static") && !cs_heap_ref_capture(body, name))
+    {
+        json_object_object_add(node, "stack_capture", json_object_new_boolean(true));
+        placed++;
+    }
+
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        placed += cs_place_captures(val, body);
+    }
+    return placed;
+}
+
+static int cs_place_body(json_object *body)
+{
+    if (!body) return 0;
+    int placed = cs_place_walk(body);
+    cs_place_captures(body, body);
+    return placed;
+}
+
+int gen_model_stack_alloc_closures(json_object *model)
+{
+    model_callees_build(&g_cl_callees, model, false, cs_param_ok, cs_count_safe);
+
+    int placed = 0;
+    json_object *functions = model_get(model, "functions");
+    int fn_count = functions ? (int)json_object_array_length(functions) : 0;
+    for (int i = 0; i < fn_count; i++)
+        placed += cs_place_body(model_get(json_object_array_get_idx(functions, i), "body"));
+
+    json_object *structs = model_get(model, "structs");
+    int sn = structs ? (int)json_object_array_length(structs) : 0;
+    for (int i = 0; i < sn; i++)
+    {
+        json_object *methods = model_get(json_object_array_get_idx(structs, i), "methods");
+        int mn = methods ? (int)json_object_array_length(methods) : 0;
+        for (int j = 0; j < mn; j++)
+            placed += cs_place_body(model_get(json_object_array_get_idx(methods, j), "body"));
+    }
+
+    /* Lambda definitions render their own bodies; calls there qualify too */
+    json_object *lambdas = model_get(model, "lambdas");
+    int ln = lambdas ? (int)json_object_array_length(lambdas) : 0;
+    for (int i = 0; i < ln; i++)
+    {
+        json_object *ldef = json_object_array_get_idx(lambdas, i);
+        placed += cs_place_walk(model_get(ldef, "body_stmts"));
+        placed += cs_place_walk(model_get(ldef, "body"));
+    }
+
+    model_callees_free(&g_cl_callees);
+    return placed;
+}
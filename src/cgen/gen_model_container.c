@@ -0,0 +1,275 @@
+#include "cgen/gen_model.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Model keys for the built-in containers (map<K, V>, set<T>, deque<T>, bits,
+ * channel<T>, taskgroup<T> and their iterators).
+ *
+ * The container templates under partials/container/ emit the typedef, the
+ * SnMapOps/SnSetOps table with generated hash/equality functions (deque,
+ * channel and taskgroup only need the element hooks, bits nothing), and static inline
+ * bodies for the native methods.  Only container structs get these keys, so
+ * the model of ordinary structs is unchanged. */
+
+static Type *container_resolve(Type *type)
+{
+    if (type && type->kind == TYPE_GENERIC_INST && type->as.generic_inst.resolved)
+        return type->as.generic_inst.resolved;
+    return type;
+}
+
+/* Flatten a key type into the scalar/str leaves the generated hash and
+ * equality functions visit, e.g. Point { x, y } → ".__sn__x", ".__sn__y".
+ * Key types are validated by the type checker (primitives, str, val structs). */
+static void container_hash_parts(Arena *arena, Type *type, const char *access,
+                                 json_object *parts, int depth)
+{
+    type = container_resolve(type);
+    if (!type || depth > 32) return;
+
+    if (type->kind == TYPE_STRUCT)
+    {
+        for (int i = 0; i < type->as.struct_type.field_count; i++)
+        {
+            StructField *f = &type->as.struct_type.fields[i];
+            char buf[512];
+            snprintf(buf, sizeof(buf), "%s.__sn__%s", access, f->name);
+            container_hash_parts(arena, f->type, arena_strdup(arena, buf), parts, depth + 1);
+        }
+        return;
+    }
+
+    const char *kind = "int";
+    if (type->kind == TYPE_STRING) kind = "str";
+    else if (type->kind == TYPE_DOUBLE || type->kind == TYPE_FLOAT) kind = "float";
+
+    json_object *part = json_object_new_object();
+    json_object_object_add(part, "access", json_object_new_string(access));
+    json_object_object_add(part, "kind", json_object_new_string(kind));
+    json_object_array_add(parts, part);
+}
+
+/* How set<T> reads an element for its dense bitmap (see sn_set.h) */
+static const char *container_set_int_kind(Type *type)
+{
+    switch (type->kind)
+    {
+        case TYPE_INT:
+        case TYPE_LONG:
+        case TYPE_UINT:   return "SN_SET_INT_I64";
+        case TYPE_INT32:  return "SN_SET_INT_I32";
+        case TYPE_UINT32: return "SN_SET_INT_U32";
+        case TYPE_BOOL:
+        case TYPE_CHAR:
+        case TYPE_BYTE:   return "SN_SET_INT_U8";
+        default:          return "SN_SET_INT_NONE";
+    }
+}
+
+static json_object *container_elem_model(Arena *arena, Type *type, bool is_key)
+{
+    type = container_resolve(type);
+    json_object *obj = json_object_new_object();
+    json_object_object_add(obj, "type", gen_model_type(arena, type));
+    json_object_object_add(obj, "elem_tag", json_object_new_string(gen_model_elem_tag(type)));
+
+    const char *release_fn = NULL;
+    const char *copy_fn = NULL;
+    gen_model_elem_hooks(arena, type, &release_fn, &copy_fn);
+    if (release_fn)
+        json_object_object_add(obj, "release_fn", json_object_new_string(release_fn));
+    if (copy_fn)
+        json_object_object_add(obj, "copy_fn", json_object_new_string(copy_fn));
+
+    /* Native methods take ownership of composite val-struct arguments, so the
+     * generated method bodies release key/value args they do not store. */
+    if (type->kind == TYPE_STRUCT && gen_model_type_category(type) == TYPE_CAT_COMPOSITE)
+    {
+        char buf[256];
+        snprintf(buf, sizeof(buf), "__sn__%s_cleanup", type->as.struct_type.name);
+        json_object_object_add(obj, "arg_cleanup", json_object_new_string(arena_strdup(arena, buf)));
+    }
+
+    /* Non-native structs have a generated _to_string used by map toString */
+    if (type->kind == TYPE_STRUCT && !type->as.struct_type.is_native)
+    {
+        json_object_object_add(obj, "str_struct",
+            json_object_new_string(type->as.struct_type.name));
+        json_object_object_add(obj, "str_by_ref",
+            json_object_new_boolean(type->as.struct_type.pass_self_by_ref));
+    }
+
+    if (is_key)
+    {
+        json_object *parts = json_object_new_array();
+        container_hash_parts(arena, type, "", parts, 0);
+        json_object_object_add(obj, "hash_parts", parts);
+        json_object_object_add(obj, "int_kind",
+            json_object_new_string(container_set_int_kind(type)));
+    }
+    return obj;
+}
+
+static void container_add_dep(json_object *deps, Type *type)
+{
+    type = container_resolve(type);
+    if (type && type->kind == TYPE_STRUCT && type->as.struct_type.name)
+        json_object_array_add(deps, json_object_new_string(type->as.struct_type.name));
+}
+
+static const char *container_struct_name(Type *type)
+{
+    type = container_resolve(type);
+    return (type && type->kind == TYPE_STRUCT) ? type->as.struct_type.name : NULL;
+}
+
+void gen_model_container(Arena *arena, StructDeclStmt *decl, json_object *obj)
+{
+    if (!decl || decl->container_kind == CONTAINER_NONE)
+        return;
+
+    bool is_map = decl->container_kind == CONTAINER_MAP ||
+                  decl->container_kind == CONTAINER_MAP_ITER;
+    bool is_deque = decl->container_kind == CONTAINER_DEQUE ||
+                    decl->container_kind == CONTAINER_DEQUE_ITER;
+    bool is_bits = decl->container_kind == CONTAINER_BITS ||
+                   decl->container_kind == CONTAINER_BITS_ITER;
+    bool is_channel = decl->container_kind == CONTAINER_CHANNEL ||
+                      decl->container_kind == CONTAINER_CHANNEL_ITER;
+    bool is_task_group = decl->container_kind == CONTAINER_TASK_GROUP ||
+                         decl->container_kind == CONTAINER_TASK_GROUP_ITER;
+    bool has_elem = is_deque || is_channel || is_task_group;   /* sequences, not keyed */
+    if (decl->type_arg_count < (is_map ? 2 : is_bits ? 0 : 1))
+        return;
+
+    Type *key_type = is_bits ? NULL : decl->type_args[0];
+    json_object *container = json_object_new_object();
+    json_object *deps = json_object_new_array();
+
+    if (key_type)
+        json_object_object_add(container, has_elem ? "elem" : "key",
+            container_elem_model(arena, key_type, !has_elem));
+    if (is_map)
+        json_object_object_add(container, "value",
+            container_elem_model(arena, decl->type_args[1], false));
+
+    switch (decl->container_kind)
+    {
+        case CONTAINER_MAP:
+            json_object_object_add(obj, "container_kind", json_object_new_string("map"));
+            /* The ops table and method bodies use sizeof and hooks of K and V */
+            container_add_dep(deps, key_type);
+            container_add_dep(deps, decl->type_args[1]);
+            break;
+
+        case CONTAINER_MAP_ITER:
+        {
+            json_object_object_add(obj, "container_kind", json_object_new_string("map_iter"));
+            Type *entry_type = NULL;
+            for (int i = 0; i < decl->method_count; i++)
+            {
+                if (strcmp(decl->methods[i].name, "next") == 0)
+                    entry_type = decl->methods[i].return_type;
+            }
+            const char *map_name = container_struct_name(decl->fields[0].type);
+            const char *entry_name = container_struct_name(entry_type);
+            if (map_name)
+                json_object_object_add(container, "map_name", json_object_new_string(map_name));
+            if (entry_name)
+                json_object_object_add(container, "entry_name", json_object_new_string(entry_name));
+            /* next() returns the entry by value */
+            container_add_dep(deps, entry_type);
+            break;
+        }
+
+        case CONTAINER_SET:
+            json_object_object_add(obj, "container_kind", json_object_new_string("set"));
+            container_add_dep(deps, key_type);
+            break;
+
+        case CONTAINER_SET_ITER:
+        {
+            json_object_object_add(obj, "container_kind", json_object_new_string("set_iter"));
+            const char *set_name = container_struct_name(decl->fields[0].type);
+            if (set_name)
+                json_object_object_add(container, "set_name", json_object_new_string(set_name));
+            /* next() returns the element by value */
+            container_add_dep(deps, key_type);
+            break;
+        }
+
+        case CONTAINER_DEQUE:
+            json_object_object_add(obj, "container_kind", json_object_new_string("deque"));
+            container_add_dep(deps, key_type);
+            break;
+
+        case CONTAINER_DEQUE_ITER:
+        {
+            json_object_object_add(obj, "container_kind", json_object_new_string("deque_iter"));
+            const char *deque_name = container_struct_name(decl->fields[0].type);
+            if (deque_name)
+                json_object_object_add(container, "deque_name", json_object_new_string(deque_name));
+            container_add_dep(deps, key_type);
+            break;
+        }
+
+        case CONTAINER_BITS:
+            json_object_object_add(obj, "container_kind", json_object_new_string("bits"));
+            break;
+
+        case CONTAINER_BITS_ITER:
+        {
+            json_object_object_add(obj, "container_kind", json_object_new_string("bits_iter"));
+            const char *bits_name = container_struct_name(decl->fields[0].type);
+            if (bits_name)
+                json_object_object_add(container, "bits_name", json_object_new_string(bits_name));
+            break;
+        }
+
+        case CONTAINER_CHANNEL:
+            json_object_object_add(obj, "container_kind", json_object_new_string("channel"));
+            container_add_dep(deps, key_type);
+            break;
+
+        case CONTAINER_CHANNEL_ITER:
+        {
+            json_object_object_add(obj, "container_kind", json_object_new_string("channel_iter"));
+            const char *channel_name = container_struct_name(decl->fields[0].type);
+            if (channel_name)
+                json_object_object_add(container, "channel_name", json_object_new_string(channel_name));
+            container_add_dep(deps, key_type);
+            break;
+        }
+
+        case CONTAINER_TASK_GROUP:
+            json_object_object_add(obj, "container_kind", json_object_new_string("taskgroup"));
+            container_add_dep(deps, key_type);
+            break;
+
+        case CONTAINER_TASK_GROUP_ITER:
+        {
+            json_object_object_add(obj, "container_kind", json_object_new_string("taskgroup_iter"));
+            const char *group_name = container_struct_name(decl->fields[0].type);
+            if (group_name)
+                json_object_object_add(container, "group_name", json_object_new_string(group_name));
+            container_add_dep(deps, key_type);
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    json_object_object_add(obj, "container", container);
+    json_object_object_add(obj, "type_deps", deps);
+
+    /* Container method bodies are static inline — no extern forward decls */
+    json_object *methods = NULL;
+    if (json_object_object_get_ex(obj, "methods", &methods))
+    {
+        int n = (int)json_object_array_length(methods);
+        for (int i = 0; i < n; i++)
+            json_object_object_add(json_object_array_get_idx(methods, i),
+                "is_container_method", json_object_new_boolean(true));
+    }
+}
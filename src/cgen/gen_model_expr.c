@@ -98,13 +98,11 @@ static void hoist_borrow_temps(json_object *call_obj, json_object *args, Expr *c
     for (int i = 0; i < (int)json_object_array_length(args); i++)
     {
         json_object *arg = json_object_array_get_idx(args, i);
-        json_object *bt_flag, *al_flag, *fn_flag;
+        json_object *bt_flag, *al_flag;
         bool is_bt = json_object_object_get_ex(arg, "is_borrow_tmp", &bt_flag) &&
                      json_object_get_boolean(bt_flag);
         bool is_al = json_object_object_get_ex(arg, "is_arr_lit_borrow", &al_flag) &&
                      json_object_get_boolean(al_flag);
-        bool is_fn = json_object_object_get_ex(arg, "is_fn_ref_arg", &fn_flag) &&
-                     json_object_get_boolean(fn_flag);
         if (is_bt || is_al)
         {
             char var_name[64];
@@ -118,6 +116,8 @@ static void hoist_borrow_temps(json_object *call_obj, json_object *args, Expr *c
         }
         /* Also detect lambda expressions used as call args — these
          * malloc a __Closure__ that needs to be freed after the call.
+         * Named function references use their static __fn_closure_N__
+         * and need no temporary.
          *
          * CAVEAT: if the callee returns a struct, the closure may be
          * stored in a struct field (ownership transfer).  In that case,
@@ -138,7 +138,7 @@ static void hoist_borrow_temps(json_object *call_obj, json_object *args, Expr *c
             if (ret && ret->kind == TYPE_STRUCT)
                 callee_may_store = true;
         }
-        if ((is_fn || is_lambda) && !callee_may_store)
+        if (is_lambda && !callee_may_store)
         {
             char var_name[64];
             snprintf(var_name, sizeof(var_name), "__fn_tmp_%d__", i);
@@ -480,6 +480,155 @@ static const char *binary_op_str(SnTokenType op)
     }
 }
 
+/* ---- threadlocal variables ---- */
+
+/* A threadlocal with a deferred initializer is reached through the getter
+ * that runs it (thread_local.hbs): the use becomes __sn__x__get__() and is
+ * marked like a captured variable so the templates dereference it. */
+static void gen_model_thread_local_getter(json_object *obj, const char *key, Stmt *decl)
+{
+    if (decl == NULL || !gen_model_global_is_deferred(&decl->as.var_decl))
+        return;
+    json_object *name_obj = NULL;
+    if (!json_object_object_get_ex(obj, key, &name_obj))
+        return;
+    char getter[512];
+    snprintf(getter, sizeof(getter), "%s__get__()", json_object_get_string(name_obj));
+    json_object_object_add(obj, key, json_object_new_string(getter));
+    json_object_object_add(obj, "is_captured", json_object_new_boolean(true));
+}
+
+/* ---- sync variable updates ---- */
+
+/* Sync variables of these types are updated with atomic instructions */
+static bool sync_atomic_type(Type *t)
+{
+    if (t == NULL) return false;
+    switch (t->kind)
+    {
+        case TYPE_INT: case TYPE_INT32: case TYPE_UINT: case TYPE_UINT32:
+        case TYPE_LONG: case TYPE_CHAR: case TYPE_BYTE:
+        case TYPE_DOUBLE: case TYPE_FLOAT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool sync_integer_type(Type *t)
+{
+    return sync_atomic_type(t) && t->kind != TYPE_DOUBLE && t->kind != TYPE_FLOAT;
+}
+
+/* The atomic builtin for a compound operator, or "cas" when the update
+ * needs a compare-and-swap loop (and always for floating point) */
+static const char *sync_fetch_op(SnTokenType op, Type *t)
+{
+    if (!sync_integer_type(t)) return "cas";
+    switch (op)
+    {
+        case TOKEN_PLUS:      return "fetch_add";
+        case TOKEN_MINUS:     return "fetch_sub";
+        case TOKEN_AMPERSAND: return "fetch_and";
+        case TOKEN_PIPE:      return "fetch_or";
+        case TOKEN_CARET:     return "fetch_xor";
+        default:              return "cas";
+    }
+}
+
+/* Inside an exclusive lock block on the variable nothing else can update
+ * it, so its updates stay plain expressions */
+static bool sync_lock_held(const char *name)
+{
+    for (int i = 0; i < g_lock_depth; i++)
+    {
+        if (!g_lock_scopes[i].shared && g_lock_scopes[i].stripe == NULL &&
+            strcmp(g_lock_scopes[i].name, name) == 0)
+            return true;
+    }
+    return false;
+}
+
+/* Annotate an update of a sync variable with how it is lowered ("fetch_add"
+ * and friends, "cas" or "store") and the C memory orders its declaration
+ * asks for.  When a lock block names the variable, updates outside such a
+ * block also take its lock exclusively so they cannot land in the middle of
+ * one. */
+static void gen_model_sync_update(json_object *obj, const VarDeclStmt *decl,
+                                  const char *name, const char *how)
+{
+    static const char *const rmw_orders[] = {
+        "memory_order_seq_cst", "memory_order_acq_rel", "memory_order_relaxed" };
+    static const char *const store_orders[] = {
+        "memory_order_seq_cst", "memory_order_release", "memory_order_relaxed" };
+
+    json_object_object_add(obj, "sync_update", json_object_new_string(how));
+    json_object_object_add(obj, "sync_rmw_order",
+        json_object_new_string(rmw_orders[decl->sync_order]));
+    json_object_object_add(obj, "sync_store_order",
+        json_object_new_string(store_orders[decl->sync_order]));
+    if (decl->is_lock_target)
+    {
+        json_object_object_add(obj, "sync_var_name", json_object_new_string(name));
+        json_object_object_add(obj, "sync_lock",
+            json_object_new_string(gen_model_lock_acquire(decl->lock_kind)));
+        json_object_object_add(obj, "sync_unlock",
+            json_object_new_string(gen_model_lock_release(decl->lock_kind)));
+    }
+}
+
+/* x++, x-- and x op= v on a sync variable x */
+static void gen_model_sync_rmw(json_object *obj, Expr *target, json_object *target_obj, SnTokenType op)
+{
+    if (target->type != EXPR_VARIABLE || target->as.variable.sync_decl == NULL ||
+        !sync_atomic_type(target->expr_type))
+        return;
+    json_object *name_obj = NULL;
+    if (!json_object_object_get_ex(target_obj, "name", &name_obj))
+        return;
+    const char *name = json_object_get_string(name_obj);
+    if (sync_lock_held(name))
+        return;
+    gen_model_sync_update(obj, &target->as.variable.sync_decl->as.var_decl, name,
+                          sync_fetch_op(op, target->expr_type));
+}
+
+/* Point reads of the sync variable `name` inside an assignment's value at
+ * the compare-and-swap loop's snapshot (__sn__<name>__cur__).  Returns true
+ * if the value reads the variable at all. */
+static bool sync_snapshot_reads(json_object *node, const char *name)
+{
+    bool found = false;
+    if (json_object_is_type(node, json_type_array))
+    {
+        for (size_t i = 0; i < json_object_array_length(node); i++)
+            found |= sync_snapshot_reads(json_object_array_get_idx(node, i), name);
+        return found;
+    }
+    if (!json_object_is_type(node, json_type_object))
+        return false;
+
+    json_object *kind = NULL, *vname = NULL;
+    if (json_object_object_get_ex(node, "kind", &kind) &&
+        strcmp(json_object_get_string(kind), "variable") == 0 &&
+        json_object_object_get_ex(node, "name", &vname) &&
+        strcmp(json_object_get_string(vname), name) == 0)
+    {
+        char snap[300];
+        snprintf(snap, sizeof(snap), "%s__cur__", name);
+        json_object_object_add(node, "name", json_object_new_string(snap));
+        json_object_object_del(node, "is_captured");
+        json_object_object_del(node, "is_move");
+        return true;
+    }
+    json_object_object_foreach(node, key, child)
+    {
+        (void)key;
+        found |= sync_snapshot_reads(child, name);
+    }
+    return found;
+}
+
 static const char *unary_op_str(SnTokenType op)
 {
     switch (op)
@@ -597,13 +746,37 @@ static bool is_named_fn_str_call(Expr *expr, SymbolTable *symbol_table)
     return (sym && sym->is_function);
 }
 
-/* Wrap a bare top-level function reference into a __Closure__ at the call/
- * assignment site. fn_type must be the destination's TYPE_FUNCTION (the
- * parameter type, the field type, or the assignment target's type).
+/* wrapper_id of an already-emitted wrapper identical to `wrapper`, or -1 */
+static int find_fn_ref_wrapper(json_object *wrapper)
+{
+    static const char *keys[] = { "target_name", "return_type", "param_types",
+                                  "is_native", "has_borrow_cleanup" };
+    int n = (int)json_object_array_length(g_model_fn_wrappers);
+    for (int i = 0; i < n; i++)
+    {
+        json_object *w = json_object_array_get_idx(g_model_fn_wrappers, i);
+        bool same = true;
+        for (size_t k = 0; k < sizeof(keys) / sizeof(keys[0]) && same; k++)
+        {
+            json_object *a = NULL, *b = NULL;
+            json_object_object_get_ex(wrapper, keys[k], &a);
+            json_object_object_get_ex(w, keys[k], &b);
+            same = json_object_equal(a, b);
+        }
+        json_object *id = NULL;
+        if (same && json_object_object_get_ex(w, "wrapper_id", &id))
+            return json_object_get_int(id);
+    }
+    return -1;
+}
+
+/* Wrap a bare top-level function reference into its static __Closure__ at
+ * the call/assignment site. fn_type must be the destination's TYPE_FUNCTION
+ * (the parameter type, the field type, or the assignment target's type).
  *
- * Returns the wrapper_id appended to g_model_fn_wrappers if a wrap was
- * emitted, or -1 if the source expression is not a bare top-level function
- * reference (lambda, parameter reference, member access, call result, etc).
+ * Returns the wrapper_id in g_model_fn_wrappers (reusing an identical
+ * wrapper when one exists), or -1 if the source expression is not a bare
+ * top-level function reference (lambda, parameter reference, member access, call result, etc).
  *
  * Callers attach the returned id and a context-appropriate boolean flag to
  * their own JSON output:
@@ -631,9 +804,7 @@ static int maybe_emit_fn_ref_wrapper(Arena *arena, Expr *arg_expr,
         return -1;
     }
 
-    int wrap_id = g_model_fn_wrapper_count++;
     json_object *wrapper = json_object_new_object();
-    json_object_object_add(wrapper, "wrapper_id", json_object_new_int(wrap_id));
     json_object_object_add(wrapper, "target_name",
         json_object_new_string(arg_expr->as.variable.name.start));
     json_object_object_add(wrapper, "return_type",
@@ -668,10 +839,137 @@ static int maybe_emit_fn_ref_wrapper(Arena *arena, Expr *arg_expr,
         json_object_object_add(wrapper, "has_borrow_cleanup",
             json_object_new_boolean(true));
 
+    /* Each wrapper owns one static __fn_closure_N__, so every reference to
+     * the same function with the same signature shares a single wrapper. */
+    int existing = find_fn_ref_wrapper(wrapper);
+    if (existing >= 0)
+    {
+        json_object_put(wrapper);
+        return existing;
+    }
+
+    int wrap_id = g_model_fn_wrapper_count++;
+    json_object_object_add(wrapper, "wrapper_id", json_object_new_int(wrap_id));
     json_object_array_add(g_model_fn_wrappers, wrapper);
     return wrap_id;
 }
 
+/* A function argument that a generated loop calls in place (array_hof, the
+ * stages of an iterator pipeline).  Adds fn, fn_type and fn_setup to obj,
+ * plus fn_var/fn_slot, the C names the loop holds the closure in.
+ *
+ * f is called directly when it is a lambda written at the call or a named
+ * function, so the C compiler can inline it into the loop (fn_direct); any
+ * other closure goes through its function pointer.  A lambda without
+ * captures to clean up gets its closure in the fn_slot stack slot, as for
+ * non-escaping parameters. */
+void gen_model_fn_arg(Arena *arena, json_object *obj, Expr *fn_arg,
+                      const char *fn_var, const char *fn_slot,
+                      SymbolTable *symbol_table, ArithmeticMode arithmetic_mode)
+{
+    json_object *fn = gen_model_expr(arena, fn_arg, symbol_table, arithmetic_mode);
+    const char *fn_setup = "borrowed";
+    char direct[48] = "";
+    int wrap_id = -1;
+    if (fn_arg->type == EXPR_LAMBDA)
+    {
+        snprintf(direct, sizeof(direct), "__lambda_%d__", fn_arg->as.lambda.lambda_id);
+        json_object *cleanup = NULL;
+        if (json_object_object_get_ex(fn, "has_capture_cleanup", &cleanup) &&
+            json_object_get_boolean(cleanup))
+        {
+            fn_setup = "owned";
+        }
+        else
+        {
+            fn_setup = "stack";
+            json_object_object_add(fn, "stack_storage", json_object_new_string(fn_slot));
+        }
+    }
+    else if ((wrap_id = maybe_emit_fn_ref_wrapper(arena, fn_arg, fn_arg->expr_type, symbol_table)) >= 0)
+    {
+        fn_setup = "fn_ref";
+        snprintf(direct, sizeof(direct), "__fn_wrap_%d__", wrap_id);
+        json_object_object_add(obj, "fn_wrapper_id", json_object_new_int(wrap_id));
+    }
+    else if (fn_arg->type != EXPR_VARIABLE && fn_arg->type != EXPR_MEMBER &&
+             fn_arg->type != EXPR_ARRAY_ACCESS)
+    {
+        fn_setup = "owned";
+    }
+    json_object_object_add(obj, "fn", fn);
+    json_object_object_add(obj, "fn_type", gen_model_type(arena, fn_arg->expr_type));
+    json_object_object_add(obj, "fn_setup", json_object_new_string(fn_setup));
+    json_object_object_add(obj, "fn_var", json_object_new_string(fn_var));
+    json_object_object_add(obj, "fn_slot", json_object_new_string(fn_slot));
+    if (direct[0])
+        json_object_object_add(obj, "fn_direct", json_object_new_string(direct));
+}
+
+/* arr.map(f), filter, reduce, forEach, parMap and parReduce become a loop
+ * over the array (expr/array_hof.hbs) writing into an output presized to the
+ * input, calling f in place (see gen_model_fn_arg).
+ *
+ * parMap and parReduce outline the loop into __par_body_N__, which the
+ * runtime runs once per chunk like a parallel for body: each chunk writes
+ * its own range of the output (parMap) or its own partial result
+ * (parReduce), so workers never share a slot.  The node doubles as the
+ * module's parallel_loops entry for the context typedef and the body. */
+static void gen_model_array_hof(Arena *arena, json_object *obj, Expr *expr,
+                                SymbolTable *symbol_table, ArithmeticMode arithmetic_mode)
+{
+    static const char *const ops[] = { "", "map", "filter", "reduce", "forEach", "parMap", "parReduce" };
+    ArrayHof op = expr->as.call.array_hof;
+    Expr *object = expr->as.call.callee->as.member.object;
+    Type *elem_type = object->expr_type->as.array.element_type;
+    bool has_init = op == ARRAY_HOF_REDUCE || op == ARRAY_HOF_PAR_REDUCE;
+    Expr *fn_arg = expr->as.call.arguments[has_init ? 1 : 0];
+
+    json_object_object_add(obj, "kind", json_object_new_string("array_hof"));
+    json_object_object_add(obj, "op", json_object_new_string(ops[op]));
+    json_object_object_add(obj, "object",
+        gen_model_expr(arena, object, symbol_table, arithmetic_mode));
+    json_object_object_add(obj, "element_type", gen_model_type(arena, elem_type));
+    if (has_init)
+        json_object_object_add(obj, "init",
+            gen_model_expr(arena, expr->as.call.arguments[0], symbol_table, arithmetic_mode));
+
+    /* The element is f's last parameter; val structs with heap fields go by pointer */
+    gen_model_fn_arg(arena, obj, fn_arg, "__hof_fn__", "__hof_cl__", symbol_table, arithmetic_mode);
+    json_object *fn_type = NULL, *fn_params = NULL, *pass_by_ptr = NULL;
+    if (json_object_object_get_ex(obj, "fn_type", &fn_type) &&
+        json_object_object_get_ex(fn_type, "param_types", &fn_params) &&
+        json_object_object_get_ex(json_object_array_get_idx(fn_params, has_init ? 1 : 0),
+                                  "pass_by_ptr", &pass_by_ptr))
+        json_object_object_add(obj, "elem_by_ptr", json_object_get(pass_by_ptr));
+
+    /* map's result has f's return type; filter keeps (copies of) the elements */
+    if (op == ARRAY_HOF_MAP || op == ARRAY_HOF_PAR_MAP || op == ARRAY_HOF_FILTER)
+    {
+        Type *out_type = op == ARRAY_HOF_FILTER ? elem_type
+                                                : fn_arg->expr_type->as.function.return_type;
+        const char *release_fn = NULL;
+        const char *copy_fn = NULL;
+        gen_model_elem_hooks(arena, out_type, &release_fn, &copy_fn);
+        json_object_object_add(obj, "out_type", gen_model_type(arena, out_type));
+        json_object_object_add(obj, "out_tag", json_object_new_string(gen_model_elem_tag(out_type)));
+        if (release_fn)
+            json_object_object_add(obj, "elem_release_fn", json_object_new_string(release_fn));
+        if (copy_fn)
+            json_object_object_add(obj, "elem_copy_fn", json_object_new_string(copy_fn));
+    }
+
+    if (op == ARRAY_HOF_PAR_MAP || op == ARRAY_HOF_PAR_REDUCE)
+    {
+        json_object_object_add(obj, "is_parallel", json_object_new_boolean(true));
+        json_object_object_add(obj, "par_id", json_object_new_int(g_model_parallel_count++));
+        if (expr->token && expr->token->filename)
+            gen_model_add_source_file(obj, expr->token->filename);
+        if (g_model_parallel_loops != NULL)
+            json_object_array_add(g_model_parallel_loops, json_object_get(obj));
+    }
+}
+
 json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
                             ArithmeticMode arithmetic_mode)
 {
@@ -840,6 +1138,7 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
                 if (mark_captured)
                     json_object_object_add(obj, "is_captured", json_object_new_boolean(true));
             }
+            gen_model_thread_local_getter(obj, "name", expr->as.variable.thread_local_decl);
             break;
         }
 
@@ -878,8 +1177,18 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
                 }
             }
             json_object_object_add(obj, "target", json_object_new_string(aname));
-            json_object_object_add(obj, "value",
-                gen_model_expr(arena, expr->as.assign.value, symbol_table, arithmetic_mode));
+            json_object *assign_val = gen_model_expr(arena, expr->as.assign.value, symbol_table, arithmetic_mode);
+            json_object_object_add(obj, "value", assign_val);
+            /* Sync variable: a value that reads the variable (x = x * 3 + 1,
+             * x = max(x, v)) becomes a compare-and-swap loop, anything else
+             * an atomic store */
+            if (expr->as.assign.sync_decl != NULL && sync_atomic_type(expr->expr_type) &&
+                !sync_lock_held(aname))
+            {
+                bool reads_self = sync_snapshot_reads(assign_val, aname);
+                gen_model_sync_update(obj, &expr->as.assign.sync_decl->as.var_decl, aname,
+                                      reads_self ? "cas" : "store");
+            }
             /* Check if target is captured or is an 'as ref' param (C pointer needing *) */
             {
                 bool mark_captured = false;
@@ -900,6 +1209,7 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
                 if (mark_captured)
                     json_object_object_add(obj, "is_captured", json_object_new_boolean(true));
             }
+            gen_model_thread_local_getter(obj, "target", expr->as.assign.thread_local_decl);
             /* Assignment cleanup annotations for c-min codegen */
             if (expr->expr_type)
             {
@@ -990,8 +1300,10 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
             json_object_object_add(obj, "kind", json_object_new_string("compound_assign"));
             json_object_object_add(obj, "op",
                 json_object_new_string(binary_op_str(expr->as.compound_assign.operator)));
-            json_object_object_add(obj, "target",
-                gen_model_expr(arena, expr->as.compound_assign.target, symbol_table, arithmetic_mode));
+            json_object *ca_target = gen_model_expr(arena, expr->as.compound_assign.target, symbol_table, arithmetic_mode);
+            json_object_object_add(obj, "target", ca_target);
+            gen_model_sync_rmw(obj, expr->as.compound_assign.target, ca_target,
+                               expr->as.compound_assign.operator);
             json_object *ca_val = gen_model_expr(arena, expr->as.compound_assign.value, symbol_table, arithmetic_mode);
             /* For string +=, mark heap-producing value for temp cleanup */
             if (is_heap_producing_string_expr(expr->as.compound_assign.value))
@@ -1193,7 +1505,15 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
                 }
             }
 
-            if (is_len_builtin)
+            if (expr->as.call.iter_stage != ITER_STAGE_NONE)
+            {
+                gen_model_iter_collect(arena, obj, expr, symbol_table, arithmetic_mode);
+            }
+            else if (expr->as.call.array_hof != ARRAY_HOF_NONE)
+            {
+                gen_model_array_hof(arena, obj, expr, symbol_table, arithmetic_mode);
+            }
+            else if (is_len_builtin)
             {
                 /* len(x) maps to builtin_length with object field, same as x.length */
                 json_object_object_add(obj, "kind", json_object_new_string("builtin_length"));
@@ -1461,6 +1781,47 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
                             }
                         }
                     }
+
+                    /* Primitive array reductions (sum/min/max/count/fill) return the element
+                     * type, so the runtime exposes element-typed macros: __sn__arr_int_sum,
+                     * __sn__arr_double_max, ...  Checked int sums use __sn__arr_int_sum_checked. */
+                    if (expr->as.call.callee->type == EXPR_MEMBER &&
+                        !expr->as.call.callee->as.member.resolved_method)
+                    {
+                        Token mn = expr->as.call.callee->as.member.member_name;
+                        bool is_sum = mn.length == 3 && strncmp(mn.start, "sum", 3) == 0;
+                        if (is_sum ||
+                            (mn.length == 3 && strncmp(mn.start, "min", 3) == 0) ||
+                            (mn.length == 3 && strncmp(mn.start, "max", 3) == 0) ||
+                            (mn.length == 5 && strncmp(mn.start, "count", 5) == 0) ||
+                            (mn.length == 4 && strncmp(mn.start, "fill", 4) == 0))
+                        {
+                            Type *obj_type = expr->as.call.callee->as.member.object->expr_type;
+                            const char *tp = NULL;
+                            if (obj_type && obj_type->kind == TYPE_ARRAY && obj_type->as.array.element_type)
+                            {
+                                switch (obj_type->as.array.element_type->kind)
+                                {
+                                    case TYPE_INT:
+                                    case TYPE_LONG:   tp = "int"; break;
+                                    case TYPE_DOUBLE: tp = "double"; break;
+                                    case TYPE_BYTE:   tp = "byte"; break;
+                                    case TYPE_BOOL:   tp = "bool"; break;
+                                    default: break;
+                                }
+                            }
+                            if (tp)
+                            {
+                                bool checked = is_sum && strcmp(tp, "int") == 0 &&
+                                               arithmetic_mode == ARITH_CHECKED;
+                                char buf[256];
+                                snprintf(buf, sizeof(buf), "__sn__arr_%s_%.*s%s", tp, mn.length, mn.start,
+                                         checked ? "_checked" : "");
+                                json_object_object_add(callee_model, "has_c_alias", json_object_new_boolean(true));
+                                json_object_object_add(callee_model, "c_alias", json_object_new_string(buf));
+                            }
+                        }
+                    }
                 }
 
                 /* Get param mem quals from callee's function type */
@@ -1493,30 +1854,37 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
                     bool is_push_or_insert = is_push || is_insert;
                     if (is_insert && expr->as.call.arg_count == 2)
                         member_is_insert = true;
-                    if (is_push_or_insert)
-                    {
-                        Type *obj_type = expr->as.call.callee->as.member.object->expr_type;
-                        if (obj_type && obj_type->kind == TYPE_ARRAY &&
-                            obj_type->as.array.element_type)
+                    /* Channel sends take ownership of the value like a push */
+                    bool is_send = (mn.length == 4 && strncmp(mn.start, "send", 4) == 0) ||
+                                   (mn.length == 7 && strncmp(mn.start, "trySend", 7) == 0);
+                    Type *obj_type = expr->as.call.callee->as.member.object->expr_type;
+                    Type *et = NULL;
+                    if (is_push_or_insert && obj_type && obj_type->kind == TYPE_ARRAY)
+                        et = obj_type->as.array.element_type;
+                    else if (is_send && obj_type && obj_type->kind == TYPE_STRUCT &&
+                             obj_type->as.struct_type.container_kind == CONTAINER_CHANNEL &&
+                             expr->as.call.callee->expr_type &&
+                             expr->as.call.callee->expr_type->kind == TYPE_FUNCTION &&
+                             expr->as.call.callee->expr_type->as.function.param_count == 1)
+                        et = expr->as.call.callee->expr_type->as.function.param_types[0];
+                    if (et)
+                    {
+                        if (et->kind == TYPE_STRING)
+                            member_str_push = true;
+                        else if (et->kind == TYPE_ARRAY)
+                            member_arr_push = true;
+                        else if (et->kind == TYPE_STRUCT &&
+                                 !et->as.struct_type.pass_self_by_ref &&
+                                 gen_model_type_category(et) == TYPE_CAT_COMPOSITE)
                         {
-                            Type *et = obj_type->as.array.element_type;
-                            if (et->kind == TYPE_STRING)
-                                member_str_push = true;
-                            else if (et->kind == TYPE_ARRAY)
-                                member_arr_push = true;
-                            else if (et->kind == TYPE_STRUCT &&
-                                     !et->as.struct_type.pass_self_by_ref &&
-                                     gen_model_type_category(et) == TYPE_CAT_COMPOSITE)
-                            {
-                                member_struct_push = true;
-                                member_struct_push_name = et->as.struct_type.name;
-                            }
-                            else if (et->kind == TYPE_STRUCT &&
-                                     et->as.struct_type.pass_self_by_ref)
-                            {
-                                member_ref_push = true;
-                                member_ref_push_name = et->as.struct_type.name;
-                            }
+                            member_struct_push = true;
+                            member_struct_push_name = et->as.struct_type.name;
+                        }
+                        else if (et->kind == TYPE_STRUCT &&
+                                 et->as.struct_type.pass_self_by_ref)
+                        {
+                            member_ref_push = true;
+                            member_ref_push_name = et->as.struct_type.name;
                         }
                     }
                 }
@@ -2186,45 +2554,7 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
                 Type *et = expr->expr_type->as.array.element_type;
                 const char *elem_release_fn = NULL;
                 const char *elem_copy_fn = NULL;
-                switch (et->kind)
-                {
-                    case TYPE_STRING:
-                        elem_release_fn = "(void (*)(void *))sn_cleanup_str";
-                        elem_copy_fn = "sn_copy_str";
-                        break;
-                    case TYPE_ARRAY:
-                        elem_release_fn = "(void (*)(void *))sn_cleanup_array";
-                        elem_copy_fn = "sn_copy_array";
-                        break;
-                    case TYPE_STRUCT:
-                        if (et->as.struct_type.pass_self_by_ref)
-                        {
-                            char buf_r[256], buf_c[256];
-                            snprintf(buf_r, sizeof(buf_r),
-                                "__sn__%s_release_elem", et->as.struct_type.name);
-                            snprintf(buf_c, sizeof(buf_c),
-                                "__sn__%s_retain_into", et->as.struct_type.name);
-                            elem_release_fn = arena_strdup(arena, buf_r);
-                            elem_copy_fn = arena_strdup(arena, buf_c);
-                        }
-                        else
-                        {
-                            /* as val: check if composite (has heap fields) */
-                            if (gen_model_type_category(et) == TYPE_CAT_COMPOSITE)
-                            {
-                                char buf_r[256], buf_c[256];
-                                snprintf(buf_r, sizeof(buf_r),
-                                    "__sn__%s_cleanup_elem", et->as.struct_type.name);
-                                snprintf(buf_c, sizeof(buf_c),
-                                    "__sn__%s_copy_into", et->as.struct_type.name);
-                                elem_release_fn = arena_strdup(arena, buf_r);
-                                elem_copy_fn = arena_strdup(arena, buf_c);
-                            }
-                        }
-                        break;
-                    default:
-                        break;
-                }
+                gen_model_elem_hooks(arena, et, &elem_release_fn, &elem_copy_fn);
                 if (elem_release_fn)
                     json_object_object_add(obj, "elem_release_fn",
                         json_object_new_string(elem_release_fn));
@@ -2841,40 +3171,20 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
         case EXPR_INCREMENT:
         {
             json_object_object_add(obj, "kind", json_object_new_string("increment"));
-            json_object_object_add(obj, "operand",
-                gen_model_expr(arena, expr->as.operand, symbol_table, arithmetic_mode));
-            /* Sync variable: emit mutex name so template can wrap in lock/unlock */
-            if (expr->as.operand->type == EXPR_VARIABLE && symbol_table) {
-                Symbol *sym = symbol_table_lookup_symbol(symbol_table, expr->as.operand->as.variable.name);
-                if (sym && sym->sync_mod == SYNC_ATOMIC) {
-                    int nlen = expr->as.operand->as.variable.name.length;
-                    char vname[256];
-                    if (nlen >= (int)sizeof(vname)) nlen = (int)sizeof(vname) - 1;
-                    strncpy(vname, expr->as.operand->as.variable.name.start, nlen);
-                    vname[nlen] = '\0';
-                    json_object_object_add(obj, "sync_var_name", json_object_new_string(vname));
-                }
-            }
+            json_object *operand = gen_model_expr(arena, expr->as.operand, symbol_table, arithmetic_mode);
+            json_object_object_add(obj, "operand", operand);
+            /* Sync variable: lower to an atomic read-modify-write */
+            gen_model_sync_rmw(obj, expr->as.operand, operand, TOKEN_PLUS);
             break;
         }
 
         case EXPR_DECREMENT:
         {
             json_object_object_add(obj, "kind", json_object_new_string("decrement"));
-            json_object_object_add(obj, "operand",
-                gen_model_expr(arena, expr->as.operand, symbol_table, arithmetic_mode));
-            /* Sync variable: emit mutex name so template can wrap in lock/unlock */
-            if (expr->as.operand->type == EXPR_VARIABLE && symbol_table) {
-                Symbol *sym = symbol_table_lookup_symbol(symbol_table, expr->as.operand->as.variable.name);
-                if (sym && sym->sync_mod == SYNC_ATOMIC) {
-                    int nlen = expr->as.operand->as.variable.name.length;
-                    char vname[256];
-                    if (nlen >= (int)sizeof(vname)) nlen = (int)sizeof(vname) - 1;
-                    strncpy(vname, expr->as.operand->as.variable.name.start, nlen);
-                    vname[nlen] = '\0';
-                    json_object_object_add(obj, "sync_var_name", json_object_new_string(vname));
-                }
-            }
+            json_object *operand = gen_model_expr(arena, expr->as.operand, symbol_table, arithmetic_mode);
+            json_object_object_add(obj, "operand", operand);
+            /* Sync variable: lower to an atomic read-modify-write */
+            gen_model_sync_rmw(obj, expr->as.operand, operand, TOKEN_MINUS);
             break;
         }
 
@@ -3429,23 +3739,6 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
                             json_object_object_add(arg, "needs_str_cleanup",
                                 json_object_new_boolean(true));
                         }
-                        /* Check if corresponding call arg is a fn_ref_arg (bare function
-                         * reference wrapped in a heap-allocated __Closure__).  The thread
-                         * wrapper needs this flag to free the closure after the call. */
-                        json_object *call_args_arr = NULL;
-                        json_object_object_get_ex(call_obj, "args", &call_args_arr);
-                        if (call_args_arr)
-                        {
-                            json_object *call_arg = json_object_array_get_idx(call_args_arr, i);
-                            json_object *fn_ref = NULL;
-                            if (call_arg &&
-                                json_object_object_get_ex(call_arg, "is_fn_ref_arg", &fn_ref) &&
-                                json_object_get_boolean(fn_ref))
-                            {
-                                json_object_object_add(arg, "is_fn_ref_arg",
-                                    json_object_new_boolean(true));
-                            }
-                        }
                         json_object_array_add(args, arg);
                     }
                 }
@@ -3742,5 +4035,17 @@ json_object *gen_model_expr(Arena *arena, Expr *expr, SymbolTable *symbol_table,
         json_object_object_add(obj, "escape_info", esc);
     }
 
+    /* Stores into memory outside the innermost arena block run with the
+     * region suspended, so whatever they allocate lives on the system heap */
+    if (expr->escape_info.stores_outside_region)
+    {
+        json_object *wrap = json_object_new_object();
+        json_object_object_add(wrap, "kind", json_object_new_string("region_suspend"));
+        if (expr->expr_type)
+            json_object_object_add(wrap, "type", gen_model_type(arena, expr->expr_type));
+        json_object_object_add(wrap, "expr", obj);
+        return wrap;
+    }
+
     return obj;
 }
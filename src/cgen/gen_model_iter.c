@@ -0,0 +1,227 @@
+#include "cgen/gen_model.h"
+#include "type_checker/expr/call/type_checker_expr_call_iter.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Lazy iterator pipelines: arr.iter().filter(f).map(g).take(n) and friends.
+ *
+ * The type checker tags each call of the chain with its IterStage.  Here the
+ * chain is walked back to its source and laid out as one loop (partial
+ * expr/iter_loop.hbs): the source hands out one element per iteration in
+ * __it_v0__, and each stage reads the previous stage's variable and either
+ * skips the iteration (filter, skip), stops the loop (take, zip) or
+ * declares the next variable (map, zip, enumerate).  Nothing is allocated
+ * between stages; the consumer sees the last variable:
+ *
+ *   - a for-each over the pipeline binds the loop variable to it
+ *     (stmt/for_each_pipeline.hbs);
+ *   - collect(), or any other use of a pipeline as a value, pushes it into
+ *     the result array (expr/iter_collect.hbs).
+ *
+ * Arrays and ranges are read with an index, so only an iterator struct
+ * source pays for hasNext()/next() calls.  Array elements are borrowed and
+ * map results and next() results are owned; filter, take and skip pass
+ * their input through unchanged, while zip and enumerate pair it up in a
+ * val struct that borrows it. */
+
+/* Is the value a pointer the collector can move out and null? */
+static bool iter_cleanup_is_pointer(const char *kind)
+{
+    return strcmp(kind, "str") == 0 || strcmp(kind, "arr") == 0 ||
+           strcmp(kind, "release") == 0 || strcmp(kind, "fn") == 0;
+}
+
+static bool iter_expr_is_temp(Expr *expr)
+{
+    return expr->type != EXPR_VARIABLE && expr->type != EXPR_MEMBER &&
+           expr->type != EXPR_ARRAY_ACCESS;
+}
+
+static json_object *iter_var_name(int id)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "__it_v%d__", id);
+    return json_object_new_string(buf);
+}
+
+/* Fill obj with the loop for the pipeline ending at `last`.  The element
+ * the loop hands to its consumer is last_var, of type out_type; last_owned
+ * says whether it is cleaned up at the end of the iteration. */
+static void gen_model_iter_pipeline(Arena *arena, json_object *obj, Expr *last,
+                                    SymbolTable *symbol_table, ArithmeticMode arithmetic_mode)
+{
+    /* Calls from the source end: calls[0] is iter() or the first adapter */
+    int count = 0;
+    for (Expr *e = last; iter_is_pipeline(e); e = e->as.call.callee->as.member.object)
+        count++;
+    Expr **calls = arena_alloc(arena, sizeof(Expr *) * (size_t)count);
+    int k = count;
+    for (Expr *e = last; iter_is_pipeline(e); e = e->as.call.callee->as.member.object)
+        calls[--k] = e;
+
+    Expr *source = calls[0]->as.call.callee->as.member.object;
+    Type *elem_type;
+    const char *elem_cleanup = "none";
+    bool owned = false;
+    bool has_filter = false;
+    if (calls[0]->as.call.iter_stage == ITER_STAGE_SOURCE && source->type == EXPR_RANGE)
+    {
+        elem_type = source->expr_type->as.array.element_type;
+        json_object_object_add(obj, "source_kind", json_object_new_string("range"));
+        json_object_object_add(obj, "start",
+            gen_model_expr(arena, source->as.range.start, symbol_table, arithmetic_mode));
+        json_object_object_add(obj, "end",
+            gen_model_expr(arena, source->as.range.end, symbol_table, arithmetic_mode));
+    }
+    else if (calls[0]->as.call.iter_stage == ITER_STAGE_SOURCE)
+    {
+        elem_type = source->expr_type->as.array.element_type;
+        json_object_object_add(obj, "source_kind", json_object_new_string("array"));
+        json_object_object_add(obj, "source",
+            gen_model_expr(arena, source, symbol_table, arithmetic_mode));
+        json_object_object_add(obj, "source_is_temp",
+            json_object_new_boolean(iter_expr_is_temp(source)));
+    }
+    else
+    {
+        /* An iterator struct: next() hands out owned elements */
+        Type *iter_type = source->expr_type;
+        elem_type = iter_struct_element_type(iter_type);
+        elem_cleanup = gen_model_var_cleanup_kind(elem_type, false);
+        owned = true;
+        json_object_object_add(obj, "source_kind", json_object_new_string("iterator"));
+        json_object_object_add(obj, "source",
+            gen_model_expr(arena, source, symbol_table, arithmetic_mode));
+        json_object_object_add(obj, "source_is_temp",
+            json_object_new_boolean(iter_expr_is_temp(source)));
+        json_object_object_add(obj, "iter_type", gen_model_type(arena, iter_type));
+        json_object_object_add(obj, "iter_type_name",
+            json_object_new_string(iter_type->as.struct_type.name));
+        json_object_object_add(obj, "iter_pass_by_ref",
+            json_object_new_boolean(iter_type->as.struct_type.pass_self_by_ref));
+        json_object_object_add(obj, "iter_cleanup_kind",
+            json_object_new_string(gen_model_var_cleanup_kind(iter_type, false)));
+    }
+    json_object_object_add(obj, "element_type", gen_model_type(arena, elem_type));
+    json_object_object_add(obj, "element_cleanup_kind", json_object_new_string(elem_cleanup));
+
+    json_object *stages = json_object_new_array();
+    int var_id = 0;
+    for (int i = calls[0]->as.call.iter_stage == ITER_STAGE_SOURCE ? 1 : 0; i < count; i++)
+    {
+        static const char *const ops[] = { "", "", "map", "filter", "take", "skip",
+                                           "zip", "enumerate" };
+        Expr *call = calls[i];
+        IterStage stage = call->as.call.iter_stage;
+        Type *out_type = call->expr_type->as.array.element_type;
+        json_object *st = json_object_new_object();
+        json_object_object_add(st, "kind", json_object_new_string("iter_stage"));
+        json_object_object_add(st, "op", json_object_new_string(ops[stage]));
+        json_object_object_add(st, "id", json_object_new_int(i));
+        json_object_object_add(st, "in_var", iter_var_name(var_id));
+
+        if (stage == ITER_STAGE_MAP || stage == ITER_STAGE_FILTER)
+        {
+            has_filter = has_filter || stage == ITER_STAGE_FILTER;
+            char fn_var[32], fn_slot[32];
+            snprintf(fn_var, sizeof(fn_var), "__it_fn_%d__", i);
+            snprintf(fn_slot, sizeof(fn_slot), "__it_cl_%d__", i);
+            gen_model_fn_arg(arena, st, call->as.call.arguments[0],
+                             arena_strdup(arena, fn_var), arena_strdup(arena, fn_slot),
+                             symbol_table, arithmetic_mode);
+            json_object *fn_type = NULL, *fn_params = NULL, *pass_by_ptr = NULL;
+            if (json_object_object_get_ex(st, "fn_type", &fn_type) &&
+                json_object_object_get_ex(fn_type, "param_types", &fn_params) &&
+                json_object_object_get_ex(json_object_array_get_idx(fn_params, 0),
+                                          "pass_by_ptr", &pass_by_ptr))
+                json_object_object_add(st, "arg_by_ptr", json_object_get(pass_by_ptr));
+        }
+        else if (stage == ITER_STAGE_TAKE || stage == ITER_STAGE_SKIP)
+        {
+            json_object_object_add(st, "count",
+                gen_model_expr(arena, call->as.call.arguments[0], symbol_table, arithmetic_mode));
+        }
+        else if (stage == ITER_STAGE_ZIP)
+        {
+            Expr *other = call->as.call.arguments[0];
+            json_object_object_add(st, "other",
+                gen_model_expr(arena, other, symbol_table, arithmetic_mode));
+            json_object_object_add(st, "other_is_temp",
+                json_object_new_boolean(iter_expr_is_temp(other)));
+            json_object_object_add(st, "other_elem_type",
+                gen_model_type(arena, other->expr_type->as.array.element_type));
+        }
+
+        /* map, zip and enumerate declare the next variable */
+        if (stage == ITER_STAGE_MAP || stage == ITER_STAGE_ZIP || stage == ITER_STAGE_ENUMERATE)
+        {
+            var_id++;
+            json_object_object_add(st, "out_var", iter_var_name(var_id));
+            json_object_object_add(st, "out_type", gen_model_type(arena, out_type));
+            owned = stage == ITER_STAGE_MAP;
+            elem_cleanup = owned ? gen_model_var_cleanup_kind(out_type, false) : "none";
+            json_object_object_add(st, "out_cleanup_kind", json_object_new_string(elem_cleanup));
+        }
+        json_object_array_add(stages, st);
+    }
+    json_object_object_add(obj, "stages", stages);
+    json_object_object_add(obj, "last_var", iter_var_name(var_id));
+    /* The output length is known up front unless an iterator source or a
+     * filter decides it element by element */
+    json_object_object_add(obj, "presize", json_object_new_boolean(
+        !has_filter && calls[0]->as.call.iter_stage == ITER_STAGE_SOURCE));
+
+    Type *out_type = last->expr_type->as.array.element_type;
+    json_object_object_add(obj, "out_type", gen_model_type(arena, out_type));
+    json_object_object_add(obj, "last_owned", json_object_new_boolean(owned));
+    json_object_object_add(obj, "last_movable",
+        json_object_new_boolean(owned && iter_cleanup_is_pointer(elem_cleanup)));
+}
+
+void gen_model_iter_collect(Arena *arena, json_object *obj, Expr *expr,
+                            SymbolTable *symbol_table, ArithmeticMode arithmetic_mode)
+{
+    /* collect() ends the pipeline its object is; any other stage is
+     * collected because it is used as a value */
+    Expr *last = expr->as.call.iter_stage == ITER_STAGE_COLLECT
+        ? expr->as.call.callee->as.member.object : expr;
+    json_object_object_add(obj, "kind", json_object_new_string("iter_collect"));
+    gen_model_iter_pipeline(arena, obj, last, symbol_table, arithmetic_mode);
+
+    Type *out_type = last->expr_type->as.array.element_type;
+    const char *release_fn = NULL;
+    const char *copy_fn = NULL;
+    gen_model_elem_hooks(arena, out_type, &release_fn, &copy_fn);
+    json_object_object_add(obj, "out_tag", json_object_new_string(gen_model_elem_tag(out_type)));
+    if (release_fn)
+        json_object_object_add(obj, "elem_release_fn", json_object_new_string(release_fn));
+    if (copy_fn)
+        json_object_object_add(obj, "elem_copy_fn", json_object_new_string(copy_fn));
+}
+
+void gen_model_for_each_pipeline(Arena *arena, json_object *obj, Stmt *stmt,
+                                 SymbolTable *symbol_table, ArithmeticMode arithmetic_mode)
+{
+    ForEachStmt *loop = &stmt->as.for_each_stmt;
+    json_object_object_add(obj, "kind", json_object_new_string("for_each_pipeline"));
+    json_object_object_add(obj, "iterator_name", json_object_new_string(loop->var_name.start));
+    gen_model_iter_pipeline(arena, obj, loop->iterable, symbol_table, arithmetic_mode);
+
+    /* The loop variable aliases the last stage's value, which the loop
+     * still owns: a `return` of it in the body retains, as for arrays */
+    int nlen = loop->var_name.length;
+    char *ncopy = arena_alloc(arena, nlen + 1);
+    memcpy(ncopy, loop->var_name.start, nlen);
+    ncopy[nlen] = '\0';
+    if (g_iter_var_count % 8 == 0) {
+        char **nv = arena_alloc(arena, (g_iter_var_count + 8) * sizeof(char *));
+        for (int j = 0; j < g_iter_var_count; j++) nv[j] = g_iter_var_names[j];
+        g_iter_var_names = nv;
+    }
+    g_iter_var_names[g_iter_var_count++] = ncopy;
+
+    json_object_object_add(obj, "body",
+        gen_model_stmt(arena, loop->body, symbol_table, arithmetic_mode));
+
+    g_iter_var_count--;
+}
@@ -0,0 +1,237 @@
+/*
+ * gen_model_json_util.c — JSON model helpers shared by the post-processing
+ * passes (gen_model_rc_elide.c, gen_model_ref_stack.c,
+ * gen_model_closure_stack.c, gen_model_closure_devirt.c).
+ */
+
+#include "gen_model_json_util.h"
+#include <stdlib.h>
+#include <string.h>
+
+const char *model_str(json_object *obj, const char *key)
+{
+    json_object *v = NULL;
+    if (!obj || !json_object_object_get_ex(obj, key, &v)) return NULL;
+    return json_object_get_string(v);
+}
+
+bool model_bool(json_object *obj, const char *key)
+{
+    json_object *v = NULL;
+    if (!obj || !json_object_object_get_ex(obj, key, &v)) return false;
+    return json_object_get_boolean(v);
+}
+
+json_object *model_get(json_object *obj, const char *key)
+{
+    json_object *v = NULL;
+    if (!obj || !json_object_object_get_ex(obj, key, &v)) return NULL;
+    return v;
+}
+
+bool model_kind_is(json_object *obj, const char *kind)
+{
+    const char *k = model_str(obj, "kind");
+    return k && strcmp(k, kind) == 0;
+}
+
+bool model_is_type_key(const char *key)
+{
+    size_t len = strlen(key);
+    return len >= 4 && strcmp(key + len - 4, "type") == 0;
+}
+
+bool model_is_var(json_object *node, const char *name)
+{
+    if (!model_kind_is(node, "variable") || model_bool(node, "is_captured")) return false;
+    const char *n = model_str(node, "name");
+    return n && strcmp(n, name) == 0;
+}
+
+bool model_has_escaping_construct(json_object *node)
+{
+    if (!node) return false;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            if (model_has_escaping_construct(json_object_array_get_idx(node, i)))
+                return true;
+        return false;
+    }
+    if (!json_object_is_type(node, json_type_object)) return false;
+
+    const char *kind = model_str(node, "kind");
+    if (kind && (strcmp(kind, "lambda") == 0 || strcmp(kind, "function") == 0 ||
+                 strncmp(kind, "thread_", 7) == 0))
+        return true;
+    if (model_bool(node, "is_captured"))
+        return true;
+
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        if (model_has_escaping_construct(val))
+            return true;
+    }
+    return false;
+}
+
+int model_count_refs(json_object *node, const char *name)
+{
+    if (!node) return 0;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node), c = 0;
+        for (int i = 0; i < n; i++)
+            c += model_count_refs(json_object_array_get_idx(node, i), name);
+        return c;
+    }
+    if (!json_object_is_type(node, json_type_object)) return 0;
+
+    bool has_kind = model_get(node, "kind") != NULL;
+    int c = 0;
+    json_object_object_foreach(node, key, val)
+    {
+        if (json_object_is_type(val, json_type_string))
+        {
+            if (strcmp(key, "member_name") == 0 || strcmp(key, "field_name") == 0 ||
+                (strcmp(key, "name") == 0 && !has_kind))
+                continue;
+            if (strcmp(json_object_get_string(val), name) == 0)
+                c++;
+        }
+        else if (!model_is_type_key(key))
+        {
+            c += model_count_refs(val, name);
+        }
+    }
+    return c;
+}
+
+/* ---- Callee table ---- */
+
+static void model_callees_add(ModelCalleeTable *table, const char *fn_name,
+                              const char *struct_name, json_object *m,
+                              ModelParamFilter param_ok)
+{
+    json_object *body = model_get(m, "body");
+    json_object *params = model_get(m, "params");
+    if (!body || !params || model_bool(m, "is_native")) return;
+
+    ModelCallee *c = &table->items[table->count++];
+    memset(c, 0, sizeof(*c));
+    c->fn_name = fn_name;
+    c->struct_name = struct_name;
+    c->method_name = struct_name ? model_str(m, "name") : NULL;
+    c->params = params;
+    c->body = body;
+
+    int n = (int)json_object_array_length(params);
+    c->param_safe = calloc(n ? n : 1, sizeof(bool));
+    if (model_has_escaping_construct(body)) return;
+
+    /* Optimistic start; the fixpoint clears anything a use can leak */
+    for (int i = 0; i < n; i++)
+    {
+        json_object *p = json_object_array_get_idx(params, i);
+        const char *mq = model_str(p, "mem_qual");
+        c->param_safe[i] = model_str(p, "name") && (!mq || strcmp(mq, "default") == 0) &&
+                           param_ok(p);
+    }
+    c->self_safe = struct_name && !model_bool(m, "is_static");
+}
+
+static bool model_callee_name_is_local(json_object *body, const char *name,
+                                       ModelSafeCounter count_safe)
+{
+    return model_count_refs(body, name) == count_safe(body, name);
+}
+
+void model_callees_build(ModelCalleeTable *table, json_object *model, bool with_methods,
+                         ModelParamFilter param_ok, ModelSafeCounter count_safe)
+{
+    json_object *functions = model_get(model, "functions");
+    json_object *structs = with_methods ? model_get(model, "structs") : NULL;
+    int fn_count = functions ? (int)json_object_array_length(functions) : 0;
+    int sn = structs ? (int)json_object_array_length(structs) : 0;
+    int total = fn_count;
+    for (int i = 0; i < sn; i++)
+    {
+        json_object *methods = model_get(json_object_array_get_idx(structs, i), "methods");
+        if (methods) total += (int)json_object_array_length(methods);
+    }
+
+    table->items = calloc(total ? total : 1, sizeof(ModelCallee));
+    table->count = 0;
+    for (int i = 0; i < fn_count; i++)
+    {
+        json_object *fn = json_object_array_get_idx(functions, i);
+        const char *name = model_str(fn, "name");
+        if (name)
+            model_callees_add(table, name, NULL, fn, param_ok);
+    }
+    for (int i = 0; i < sn; i++)
+    {
+        json_object *s = json_object_array_get_idx(structs, i);
+        json_object *methods = model_get(s, "methods");
+        int mn = methods ? (int)json_object_array_length(methods) : 0;
+        for (int j = 0; j < mn; j++)
+            model_callees_add(table, NULL, model_str(s, "name"),
+                              json_object_array_get_idx(methods, j), param_ok);
+    }
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (int i = 0; i < table->count; i++)
+        {
+            ModelCallee *c = &table->items[i];
+            int n = (int)json_object_array_length(c->params);
+            for (int j = 0; j < n; j++)
+            {
+                if (!c->param_safe[j]) continue;
+                const char *pname = model_str(json_object_array_get_idx(c->params, j), "name");
+                if (!model_callee_name_is_local(c->body, pname, count_safe))
+                {
+                    c->param_safe[j] = false;
+                    changed = true;
+                }
+            }
+            if (c->self_safe && !model_callee_name_is_local(c->body, "self", count_safe))
+            {
+                c->self_safe = false;
+                changed = true;
+            }
+        }
+    }
+}
+
+ModelCallee *model_callees_find_function(ModelCalleeTable *table, const char *name)
+{
+    for (int i = 0; i < table->count; i++)
+        if (table->items[i].fn_name && name && strcmp(table->items[i].fn_name, name) == 0)
+            return &table->items[i];
+    return NULL;
+}
+
+ModelCallee *model_callees_find_method(ModelCalleeTable *table, const char *struct_name,
+                                       const char *method)
+{
+    for (int i = 0; i < table->count; i++)
+        if (table->items[i].struct_name && struct_name && method &&
+            strcmp(table->items[i].struct_name, struct_name) == 0 &&
+            strcmp(table->items[i].method_name, method) == 0)
+            return &table->items[i];
+    return NULL;
+}
+
+void model_callees_free(ModelCalleeTable *table)
+{
+    for (int i = 0; i < table->count; i++)
+        free(table->items[i].param_safe);
+    free(table->items);
+    table->items = NULL;
+    table->count = 0;
+}
@@ -0,0 +1,65 @@
+#ifndef GEN_MODEL_JSON_UTIL_H
+#define GEN_MODEL_JSON_UTIL_H
+
+#include <json-c/json.h>
+#include <stdbool.h>
+
+/* Helpers shared by the post-processing passes that read and annotate the
+ * JSON model (rc elision, stack refs, stack closures, devirtualization). */
+
+/* Field accessors; a missing object or key reads as NULL / false */
+const char *model_str(json_object *obj, const char *key);
+bool model_bool(json_object *obj, const char *key);
+json_object *model_get(json_object *obj, const char *key);
+bool model_kind_is(json_object *obj, const char *kind);
+
+/* Type descriptors (type, return_type, target_type, ...) reuse "kind" and
+ * "name" for type kinds and struct names; the passes never look inside them. */
+bool model_is_type_key(const char *key);
+
+/* A non-captured variable reference to `name` */
+bool model_is_var(json_object *node, const char *name);
+
+/* Does the subtree contain a construct that can read a local after its last
+ * textual use (closure capture, nested function, another thread)? */
+bool model_has_escaping_construct(json_object *node);
+
+/* Count references to `name`: every string value equal to it, except member
+ * and field names, and the "name" of keyless objects (struct literal fields). */
+int model_count_refs(json_object *node, const char *name);
+
+/* Functions (and optionally methods) of the model, with which of their
+ * parameters cannot escape the call. */
+typedef struct ModelCallee {
+    const char *fn_name;      /* function name, or NULL for a method */
+    const char *struct_name;  /* owning struct for methods */
+    const char *method_name;
+    json_object *params;
+    json_object *body;
+    bool *param_safe;         /* per parameter */
+    bool self_safe;           /* methods only */
+} ModelCallee;
+
+typedef struct ModelCalleeTable {
+    ModelCallee *items;
+    int count;
+} ModelCalleeTable;
+
+/* Parameters the pass tracks at all (e.g. closures, stack-sized structs) */
+typedef bool (*ModelParamFilter)(json_object *param);
+/* Mentions of `name` in `node` that cannot let it escape */
+typedef int (*ModelSafeCounter)(json_object *node, const char *name);
+
+/* Fill `table` and compute param_safe/self_safe: every filtered parameter
+ * (and self) starts safe, and any whose references are not all counted by
+ * count_safe is cleared, iterated to a fixpoint so recursive callees are
+ * handled.  count_safe may look up callees in `table` while it is built.
+ * Bodies with an escaping construct get no safe parameters. */
+void model_callees_build(ModelCalleeTable *table, json_object *model, bool with_methods,
+                         ModelParamFilter param_ok, ModelSafeCounter count_safe);
+ModelCallee *model_callees_find_function(ModelCalleeTable *table, const char *name);
+ModelCallee *model_callees_find_method(ModelCalleeTable *table, const char *struct_name,
+                                       const char *method);
+void model_callees_free(ModelCalleeTable *table);
+
+#endif
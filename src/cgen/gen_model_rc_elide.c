@@ -0,0 +1,225 @@
+/*
+ * gen_model_rc_elide.c — Post-processing pass that turns the last use of an
+ * owned local into a move.
+ *
+ * Wherever the model copies a BORROW source into an owning slot
+ * (source_is_borrow), the templates acquire a reference of their own:
+ * __sn__T_retain for as-ref structs, sn_strdup for strings, sn_array_copy for
+ * arrays and __sn__T_copy for val structs with heap fields.  When the source
+ * is an owned local whose scope ends without any further use, that copy is
+ * always paired with the local's own cleanup at the end of the block.  This
+ * pass cancels the pair: the copy becomes a move (is_move on the variable
+ * node — the source is read and cleared, so its scope-exit cleanup sees NULL
+ * or a zeroed struct).
+ *
+ * Example:
+ *   var s: str = $"item{i}"
+ *   out.push(s)                   // last use of s
+ *   Before: __sn__arr_push(&out, sn_strdup(s));   ... sn_cleanup_str(&s)
+ *   After:  __sn__arr_push(&out, ({ char * __mv__ = s; s = NULL; __mv__; }));
+ *
+ * Only straight-line cases are rewritten: the source must be declared in the
+ * same statement list as the copy, be referenced exactly once in that
+ * statement (outside any loop or arena block), and not at all afterwards.
+ * Functions with lambdas, nested functions or thread operations are left
+ * alone, since those can observe a local after its last textual use.  Copies
+ * made with the region suspended are what export arena memory, so they are
+ * never turned into moves either.
+ */
+
+#include "gen_model_json_util.h"
+#include <json-c/json.h>
+#include <stdbool.h>
+#include <string.h>
+
+static int g_rc_moves = 0;
+
+static bool rc_is_loop_kind(const char *kind)
+{
+    return kind && (strcmp(kind, "while") == 0 || strcmp(kind, "for") == 0 ||
+                    strcmp(kind, "for_each") == 0 || strcmp(kind, "for_each_iter") == 0 ||
+                    strcmp(kind, "for_each_pipeline") == 0 || strcmp(kind, "parallel_for") == 0);
+}
+
+static bool rc_str_in(const char *s, const char *const *set)
+{
+    if (!s) return false;
+    for (; *set; set++)
+        if (strcmp(s, *set) == 0) return true;
+    return false;
+}
+
+/* Cleanup keys of owning slots whose BORROW initializer or value is copied */
+static const char *const rc_owned_cleanups[] = { "release", "str", "arr", "val_cleanup", NULL };
+static const char *const rc_slot_cleanups[] = { "release_ref", "free_str", "cleanup_arr", "cleanup_val", NULL };
+
+/* If `node` copies a borrowed variable into an owning slot, return that
+ * variable node (the one the template would wrap in the copy). */
+static json_object *rc_borrowed_source(json_object *node)
+{
+    if (!model_bool(node, "source_is_borrow")) return NULL;
+
+    json_object *src = NULL;
+    const char *kind = model_str(node, "kind");
+    if (kind && strcmp(kind, "var_decl") == 0)
+    {
+        if (rc_str_in(model_str(node, "cleanup_kind"), rc_owned_cleanups))
+            src = model_get(node, "initializer");
+    }
+    else if (kind && strcmp(kind, "assign") == 0)
+    {
+        if (rc_str_in(model_str(node, "assign_cleanup"), rc_slot_cleanups))
+            src = model_get(node, "value");
+    }
+    else if (kind && strcmp(kind, "member_assign") == 0)
+    {
+        if (rc_str_in(model_str(node, "field_cleanup"), rc_slot_cleanups))
+            src = model_get(node, "value");
+    }
+    else if (kind && strcmp(kind, "index_assign") == 0)
+    {
+        const char *ec = model_str(node, "elem_cleanup");
+        if (ec && strcmp(ec, "free_str") == 0)
+            src = model_get(node, "value");
+    }
+    else if (!kind)
+    {
+        /* struct literal fields carry the flag on the field object */
+        src = model_get(node, "value");
+    }
+    else
+    {
+        /* push/insert and channel send args and array literal elements
+         * carry it on the variable itself */
+        src = node;
+    }
+
+    if (!src || !model_kind_is(src, "variable") || model_bool(src, "is_captured"))
+        return NULL;
+    return src;
+}
+
+/* Find the single copy site of `name` within a statement.  Returns the holder
+ * (the object carrying source_is_borrow) or NULL if the use sits inside a
+ * loop, an arena block or a region_suspend, or is not a copy. */
+static json_object *rc_find_copy(json_object *node, const char *name, bool in_loop)
+{
+    if (!node) return NULL;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+        {
+            json_object *h = rc_find_copy(json_object_array_get_idx(node, i), name, in_loop);
+            if (h) return h;
+        }
+        return NULL;
+    }
+    if (!json_object_is_type(node, json_type_object)) return NULL;
+
+    json_object *src = rc_borrowed_source(node);
+    if (src && !in_loop)
+    {
+        const char *sname = model_str(src, "name");
+        if (sname && strcmp(sname, name) == 0)
+            return node;
+    }
+
+    const char *kind = model_str(node, "kind");
+    if (kind && strcmp(kind, "region_suspend") == 0) return NULL;
+    bool loop = in_loop || rc_is_loop_kind(kind) || model_bool(node, "is_arena");
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        json_object *h = rc_find_copy(val, name, loop);
+        if (h) return h;
+    }
+    return NULL;
+}
+
+static bool rc_is_owned_local(json_object *stmt)
+{
+    if (!model_kind_is(stmt, "var_decl")) return false;
+    const char *ck = model_str(stmt, "cleanup_kind");
+    const char *mq = model_str(stmt, "mem_qual");
+    const char *sm = model_str(stmt, "sync_mod");
+    return rc_str_in(ck, rc_owned_cleanups) &&
+           (!mq || strcmp(mq, "default") == 0) &&
+           (!sm || strcmp(sm, "none") == 0) &&
+           !model_bool(stmt, "is_static");
+}
+
+static void rc_elide_list(json_object *stmts)
+{
+    int n = (int)json_object_array_length(stmts);
+    for (int d = 0; d < n; d++)
+    {
+        json_object *decl = json_object_array_get_idx(stmts, d);
+        if (!rc_is_owned_local(decl)) continue;
+        const char *name = model_str(decl, "name");
+        if (!name) continue;
+
+        /* Last statement of the list that mentions the local */
+        int last = -1;
+        for (int i = d + 1; i < n; i++)
+        {
+            if (model_count_refs(json_object_array_get_idx(stmts, i), name) > 0)
+                last = i;
+        }
+        if (last < 0) continue;
+
+        json_object *stmt = json_object_array_get_idx(stmts, last);
+        if (model_count_refs(stmt, name) != 1) continue;
+
+        json_object *holder = rc_find_copy(stmt, name, false);
+        if (!holder) continue;
+
+        json_object *src = rc_borrowed_source(holder);
+        json_object_object_add(holder, "source_is_borrow", json_object_new_boolean(false));
+        json_object_object_add(src, "is_move", json_object_new_boolean(true));
+        g_rc_moves++;
+    }
+}
+
+static void rc_elide_walk(json_object *node)
+{
+    if (!node) return;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            rc_elide_walk(json_object_array_get_idx(node, i));
+        return;
+    }
+    if (!json_object_is_type(node, json_type_object)) return;
+
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        if ((strcmp(key, "statements") == 0 || strcmp(key, "body") == 0) &&
+            json_object_is_type(val, json_type_array))
+            rc_elide_list(val);
+        rc_elide_walk(val);
+    }
+}
+
+int gen_model_elide_refcounts(json_object *model)
+{
+    g_rc_moves = 0;
+
+    json_object *functions = model_get(model, "functions");
+    if (!functions) return 0;
+
+    int n = (int)json_object_array_length(functions);
+    for (int i = 0; i < n; i++)
+    {
+        json_object *fn = json_object_array_get_idx(functions, i);
+        json_object *body = model_get(fn, "body");
+        if (!body || model_has_escaping_construct(body)) continue;
+        rc_elide_list(body);
+        rc_elide_walk(body);
+    }
+
+    /* Each move drops one copy and turns the matching cleanup into a no-op */
+    return g_rc_moves * 2;
+}
@@ -0,0 +1,227 @@
+/*
+ * gen_model_ref_stack.c — Post-processing pass that places non-escaping as-ref
+ * struct locals in stack storage.
+ *
+ * A local initialized from a struct literal normally gets __sn__T__new() and a
+ * scope-exit release.  If no pointer to it can outlive the block, the object
+ * lives in a stack slot instead and the scope exit only cleans up its fields
+ * (cleanup_kind "release_stack", stack_storage on the literal).
+ *
+ * Example:
+ *   var p: Point = Point { x: 1, y: 2 }
+ *   return p.x + area(p)
+ *   Before: sn_auto_Point __sn__Point * __sn__p = ({ ... __sn__Point__new(); ... });
+ *   After:  __sn__Point __sn__p__stk__;
+ *           sn_auto_stack_Point __sn__Point * __sn__p = ({ ... memset(&__sn__p__stk__, ...); ... });
+ *
+ * The local is non-escaping when every mention of it is one of:
+ *   - a field read (p.x) or field write (p.x = v)
+ *   - the receiver of a method whose self does not escape
+ *   - an argument to a function whose parameter does not escape
+ * Parameter and self escape is computed over the whole model with the same
+ * rule, iterated to a fixpoint so recursive callees are handled.  Functions
+ * with lambdas, nested functions or thread operations are left alone.
+ */
+
+#include "gen_model_json_util.h"
+#include <json-c/json.h>
+#include <stdbool.h>
+#include <string.h>
+
+/* Larger structs stay on the heap rather than growing every frame */
+#define STACK_REF_MAX_SIZE 1024
+
+static ModelCalleeTable g_callees;
+static json_object *g_structs = NULL;
+
+/* Struct name of a variable; self inside a method is typed as a pointer */
+static const char *sa_var_struct_name(json_object *var)
+{
+    json_object *type = model_get(var, "type");
+    if (model_kind_is(type, "pointer"))
+        type = model_get(type, "base_type");
+    return model_kind_is(type, "struct") ? model_str(type, "name") : NULL;
+}
+
+static json_object *sa_find_struct(const char *name)
+{
+    if (!g_structs || !name) return NULL;
+    int n = (int)json_object_array_length(g_structs);
+    for (int i = 0; i < n; i++)
+    {
+        json_object *s = json_object_array_get_idx(g_structs, i);
+        const char *sn = model_str(s, "name");
+        if (sn && strcmp(sn, name) == 0)
+            return s;
+    }
+    return NULL;
+}
+
+static bool sa_struct_has_field(const char *struct_name, const char *field)
+{
+    json_object *fields = model_get(sa_find_struct(struct_name), "fields");
+    if (!fields || !field) return false;
+    int n = (int)json_object_array_length(fields);
+    for (int i = 0; i < n; i++)
+    {
+        const char *fn = model_str(json_object_array_get_idx(fields, i), "name");
+        if (fn && strcmp(fn, field) == 0)
+            return true;
+    }
+    return false;
+}
+
+/* Count mentions of `name` that cannot let the pointer escape */
+static int sa_count_safe(json_object *node, const char *name)
+{
+    if (!node) return 0;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node), c = 0;
+        for (int i = 0; i < n; i++)
+            c += sa_count_safe(json_object_array_get_idx(node, i), name);
+        return c;
+    }
+    if (!json_object_is_type(node, json_type_object)) return 0;
+
+    int c = 0;
+    json_object *object = model_get(node, "object");
+    if (model_is_var(object, name))
+    {
+        if (model_kind_is(node, "member") &&
+            sa_struct_has_field(sa_var_struct_name(object), model_str(node, "member_name")))
+            c++;
+        else if (model_kind_is(node, "member_assign"))
+            c++;
+    }
+
+    if (model_kind_is(node, "call") && !model_bool(node, "is_closure_call") &&
+        !model_bool(node, "is_fn_field_call"))
+    {
+        json_object *callee = model_get(node, "callee");
+        json_object *args = model_get(node, "args");
+        json_object *recv = model_get(callee, "object");
+        if (model_kind_is(callee, "member") && model_is_var(recv, name))
+        {
+            ModelCallee *m = model_callees_find_method(&g_callees, sa_var_struct_name(recv),
+                                                       model_str(callee, "member_name"));
+            if (m && m->self_safe)
+                c++;
+        }
+        else if (model_kind_is(callee, "variable") && args)
+        {
+            ModelCallee *f = model_callees_find_function(&g_callees, model_str(callee, "name"));
+            int n = (int)json_object_array_length(args);
+            if (f && n == (int)json_object_array_length(f->params))
+            {
+                for (int i = 0; i < n; i++)
+                    if (f->param_safe[i] &&
+                        model_is_var(json_object_array_get_idx(args, i), name))
+                        c++;
+            }
+        }
+    }
+
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        c += sa_count_safe(val, name);
+    }
+    return c;
+}
+
+static bool sa_is_local(json_object *body, const char *name)
+{
+    return model_count_refs(body, name) == sa_count_safe(body, name);
+}
+
+static bool sa_is_stack_candidate_type(json_object *type)
+{
+    if (!type || !model_kind_is(type, "struct")) return false;
+    if (!model_bool(type, "pass_self_by_ref") || model_bool(type, "is_native")) return false;
+    json_object *s = sa_find_struct(model_str(type, "name"));
+    if (!s || model_bool(s, "has_dispose") || model_get(s, "container_kind")) return false;
+    json_object *size = model_get(type, "size");
+    return size && json_object_get_int(size) <= STACK_REF_MAX_SIZE;
+}
+
+static bool sa_param_ok(json_object *param)
+{
+    return sa_is_stack_candidate_type(model_get(param, "type"));
+}
+
+static int sa_place_list(json_object *stmts)
+{
+    int placed = 0;
+    int n = (int)json_object_array_length(stmts);
+    for (int d = 0; d < n; d++)
+    {
+        json_object *decl = json_object_array_get_idx(stmts, d);
+        if (!model_kind_is(decl, "var_decl")) continue;
+
+        const char *ck = model_str(decl, "cleanup_kind");
+        const char *mq = model_str(decl, "mem_qual");
+        const char *sm = model_str(decl, "sync_mod");
+        const char *name = model_str(decl, "name");
+        json_object *init = model_get(decl, "initializer");
+        if (!name || !ck || strcmp(ck, "release") != 0 ||
+            (mq && strcmp(mq, "default") != 0) || (sm && strcmp(sm, "none") != 0) ||
+            model_bool(decl, "is_static") || model_bool(decl, "is_captured") ||
+            !model_kind_is(init, "struct_literal") ||
+            !sa_is_stack_candidate_type(model_get(decl, "type")))
+            continue;
+
+        bool local = true;
+        for (int i = d + 1; i < n && local; i++)
+            local = sa_is_local(json_object_array_get_idx(stmts, i), name);
+        if (!local) continue;
+
+        json_object_object_add(decl, "cleanup_kind", json_object_new_string("release_stack"));
+        json_object_object_add(init, "stack_storage", json_object_new_string(name));
+        placed++;
+    }
+    return placed;
+}
+
+static int sa_place_walk(json_object *node)
+{
+    if (!node) return 0;
+    int placed = 0;
+    if (json_object_is_type(node, json_type_array))
+    {
+        int n = (int)json_object_array_length(node);
+        for (int i = 0; i < n; i++)
+            placed += sa_place_walk(json_object_array_get_idx(node, i));
+        return placed;
+    }
+    if (!json_object_is_type(node, json_type_object)) return 0;
+
+    json_object_object_foreach(node, key, val)
+    {
+        if (model_is_type_key(key)) continue;
+        if ((strcmp(key, "statements") == 0 || strcmp(key, "body") == 0) &&
+            json_object_is_type(val, json_type_array))
+            placed += sa_place_list(val);
+        placed += sa_place_walk(val);
+    }
+    return placed;
+}
+
+int gen_model_stack_alloc_refs(json_object *model)
+{
+    g_structs = model_get(model, "structs");
+    model_callees_build(&g_callees, model, true, sa_param_ok, sa_count_safe);
+
+    int placed = 0;
+    for (int i = 0; i < g_callees.count; i++)
+    {
+        json_object *body = g_callees.items[i].body;
+        if (model_has_escaping_construct(body)) continue;
+        placed += sa_place_list(body);
+        placed += sa_place_walk(body);
+    }
+
+    model_callees_free(&g_callees);
+    g_structs = NULL;
+    return placed;
+}
@@ -108,7 +108,7 @@ ModularModel *gen_model_split(json_object *model, const char *entry_file)
     /* Get arrays from model */
     json_object *functions = NULL, *globals = NULL, *structs = NULL;
     json_object *pragmas = NULL, *lambdas = NULL, *threads = NULL;
-    json_object *fn_wrappers = NULL, *module_obj = NULL;
+    json_object *fn_wrappers = NULL, *module_obj = NULL, *parallel_loops = NULL;
 
     json_object_object_get_ex(model, "functions", &functions);
     json_object_object_get_ex(model, "globals", &globals);
@@ -117,6 +117,7 @@ ModularModel *gen_model_split(json_object *model, const char *entry_file)
     json_object_object_get_ex(model, "lambdas", &lambdas);
     json_object_object_get_ex(model, "threads", &threads);
     json_object_object_get_ex(model, "fn_wrappers", &fn_wrappers);
+    json_object_object_get_ex(model, "parallel_loops", &parallel_loops);
     json_object_object_get_ex(model, "module", &module_obj);
 
     /* ---- Extract pragmas ---- */
@@ -293,6 +294,10 @@ ModularModel *gen_model_split(json_object *model, const char *entry_file)
     /* Thread arg structs */
     json_object_object_add(header, "threads", threads ? json_deep_copy(threads) : json_object_new_array());
 
+    /* Parallel loop context structs */
+    json_object_object_add(header, "parallel_loops",
+        parallel_loops ? json_deep_copy(parallel_loops) : json_object_new_array());
+
     /* Fn wrapper forward decls */
     json_object_object_add(header, "fn_wrappers", fn_wrappers ? json_deep_copy(fn_wrappers) : json_object_new_array());
 
@@ -357,6 +362,23 @@ ModularModel *gen_model_split(json_object *model, const char *entry_file)
         }
         json_object_object_add(impl, "lambdas", bucket_lambdas);
 
+        /* Outlined parallel loop bodies go with the function they came from */
+        json_object *bucket_parallel = json_object_new_array();
+        if (parallel_loops)
+        {
+            int pcount = (int)json_object_array_length(parallel_loops);
+            for (int pi = 0; pi < pcount; pi++)
+            {
+                json_object *pd = json_object_array_get_idx(parallel_loops, pi);
+                json_object *sf = NULL;
+                json_object_object_get_ex(pd, "source_file", &sf);
+                const char *sfile = sf ? json_object_get_string(sf) : entry_file;
+                if (strcmp(sfile, bucket_files[b]) == 0 || (is_main && !sf))
+                    json_object_array_add(bucket_parallel, json_deep_copy(pd));
+            }
+        }
+        json_object_object_add(impl, "parallel_loops", bucket_parallel);
+
         if (is_main)
         {
             /* Main module gets threads, fn_wrappers, module metadata, and ALL globals for deferred init */
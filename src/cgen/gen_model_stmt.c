@@ -1,10 +1,149 @@
 #include "cgen/gen_model.h"
 #include "cgen/ownership.h"
+#include "type_checker/expr/call/type_checker_expr_call_iter.h"
 #include <string.h>
 #include <stdlib.h>
 #include <limits.h>
 
 
+/* Locals the generated code holds through a pointer: variables promoted for
+ * lambda capture and 'as ref' parameters */
+static bool gen_model_is_pointer_local(const char *name)
+{
+    for (int i = 0; i < g_captured_var_count; i++)
+        if (strcmp(g_captured_vars[i], name) == 0) return true;
+    for (int i = 0; i < g_as_ref_param_count; i++)
+        if (strcmp(g_as_ref_param_names[i], name) == 0) return true;
+    return false;
+}
+
+/* Lock objects by SyncLockKind: C type, static initializer, and the calls
+ * that hold the whole variable exclusively */
+static const char *const lock_types[] = { "pthread_mutex_t", "SnRwLock", "SnStripedLock" };
+static const char *const lock_inits[] = {
+    "PTHREAD_MUTEX_INITIALIZER", "SN_RWLOCK_INITIALIZER", "SN_STRIPED_LOCK_INITIALIZER" };
+static const char *const lock_acquires[] = {
+    "pthread_mutex_lock", "sn_rwlock_write_lock", "sn_striped_lock_all" };
+static const char *const lock_releases[] = {
+    "pthread_mutex_unlock", "sn_rwlock_write_unlock", "sn_striped_unlock_all" };
+
+const char *gen_model_lock_acquire(SyncLockKind kind) { return lock_acquires[kind]; }
+const char *gen_model_lock_release(SyncLockKind kind) { return lock_releases[kind]; }
+
+/* Names the locals that hold lock(arr[i]) stripes apart */
+static int g_lock_stripe_count = 0;
+
+/* Marks a sync variable's model as needing a lock object of its kind */
+static void gen_model_lock_target(json_object *obj, const VarDeclStmt *decl)
+{
+    json_object_object_add(obj, "is_lock_target", json_object_new_boolean(true));
+    json_object_object_add(obj, "lock_type", json_object_new_string(lock_types[decl->lock_kind]));
+    json_object_object_add(obj, "lock_init", json_object_new_string(lock_inits[decl->lock_kind]));
+}
+
+static json_object *gen_model_parallel_var(Arena *arena, Token name, Type *type)
+{
+    char *cname = arena_strndup(arena, name.start, name.length);
+    json_object *var = json_object_new_object();
+    json_object_object_add(var, "name", json_object_new_string(cname));
+    json_object *type_obj = gen_model_type(arena, type);
+    /* self is always a pointer in methods (see EXPR_VARIABLE) */
+    if (name.length == 4 && strncmp(name.start, "self", 4) == 0)
+        json_object_object_add(type_obj, "pass_self_by_ref", json_object_new_boolean(true));
+    json_object_object_add(var, "type", type_obj);
+    json_object_object_add(var, "is_ref", json_object_new_boolean(gen_model_is_pointer_local(cname)));
+    return var;
+}
+
+/* parallel for: the body is outlined into __par_body_N__(ctx, lo, hi), which
+ * the runtime calls once per chunk (sn_parallel_for).  The statement builds
+ * the context from pointers to the captured locals; the same node goes into
+ * the module's parallel_loops list for the context typedef and the body. */
+static void gen_model_parallel_for(Arena *arena, json_object *obj, Stmt *stmt,
+                                   SymbolTable *symbol_table, ArithmeticMode arithmetic_mode)
+{
+    ForEachStmt *loop = &stmt->as.for_each_stmt;
+    ParallelClause *parallel = loop->parallel;
+
+    json_object_object_add(obj, "kind", json_object_new_string("parallel_for"));
+    json_object_object_add(obj, "par_id", json_object_new_int(g_model_parallel_count++));
+    json_object_object_add(obj, "iterator_name", json_object_new_string(loop->var_name.start));
+    json_object_object_add(obj, "element_type", gen_model_type(arena, loop->element_type));
+
+    Expr *iter_expr = loop->iterable;
+    if (iter_expr->type == EXPR_RANGE)
+    {
+        /* Ranges run over their bounds; no array is built */
+        json_object_object_add(obj, "is_range", json_object_new_boolean(true));
+        json_object_object_add(obj, "start",
+            gen_model_expr(arena, iter_expr->as.range.start, symbol_table, arithmetic_mode));
+        json_object_object_add(obj, "end",
+            gen_model_expr(arena, iter_expr->as.range.end, symbol_table, arithmetic_mode));
+    }
+    else
+    {
+        json_object_object_add(obj, "iterable",
+            gen_model_expr(arena, iter_expr, symbol_table, arithmetic_mode));
+        bool iter_is_temp = (iter_expr->type != EXPR_VARIABLE &&
+                             iter_expr->type != EXPR_MEMBER &&
+                             iter_expr->type != EXPR_ARRAY_ACCESS);
+        json_object_object_add(obj, "needs_iterable_cleanup", json_object_new_boolean(iter_is_temp));
+    }
+
+    json_object_object_add(obj, "schedule",
+        json_object_new_string(parallel->schedule == SCHEDULE_GUIDED ? "GUIDED" : "STATIC"));
+    if (parallel->chunk != NULL)
+        json_object_object_add(obj, "chunk",
+            gen_model_expr(arena, parallel->chunk, symbol_table, arithmetic_mode));
+
+    json_object *captures = json_object_new_array();
+    for (int i = 0; i < parallel->capture_count; i++)
+    {
+        json_object *cap = gen_model_parallel_var(arena, parallel->captured_vars[i], parallel->captured_types[i]);
+        json_object_object_add(cap, "is_sync", json_object_new_boolean(parallel->captured_sync[i]));
+        /* The body needs the variable's lock only if a lock block names it */
+        Stmt *decl = parallel->captured_decls[i];
+        if (parallel->captured_sync[i] && decl != NULL && decl->as.var_decl.is_lock_target)
+            gen_model_lock_target(cap, &decl->as.var_decl);
+        json_object_array_add(captures, cap);
+    }
+    json_object_object_add(obj, "captures", captures);
+
+    static const char *const reduce_ops[] = { "sum", "min", "max" };
+    json_object *reductions = json_object_new_array();
+    for (int i = 0; i < parallel->reduction_count; i++)
+    {
+        ParallelReduction *r = &parallel->reductions[i];
+        Symbol *sym = symbol_table_lookup_symbol(symbol_table, r->var_name);
+        json_object *red = gen_model_parallel_var(arena, r->var_name, sym ? sym->type : NULL);
+        json_object_object_add(red, "op", json_object_new_string(reduce_ops[r->op]));
+        json_object_array_add(reductions, red);
+    }
+    json_object_object_add(obj, "reductions", reductions);
+
+    /* Array elements are borrowed, as in for_each */
+    int nlen = loop->var_name.length;
+    char *ncopy = arena_alloc(arena, nlen + 1);
+    memcpy(ncopy, loop->var_name.start, nlen);
+    ncopy[nlen] = '\0';
+    if (g_iter_var_count % 8 == 0) {
+        char **nv = arena_alloc(arena, (g_iter_var_count + 8) * sizeof(char *));
+        for (int j = 0; j < g_iter_var_count; j++) nv[j] = g_iter_var_names[j];
+        g_iter_var_names = nv;
+    }
+    g_iter_var_names[g_iter_var_count++] = ncopy;
+
+    json_object_object_add(obj, "body",
+        gen_model_stmt(arena, loop->body, symbol_table, arithmetic_mode));
+
+    g_iter_var_count--;
+
+    if (stmt->token && stmt->token->filename)
+        gen_model_add_source_file(obj, stmt->token->filename);
+    if (g_model_parallel_loops != NULL)
+        json_object_array_add(g_model_parallel_loops, json_object_get(obj));
+}
+
 json_object *gen_model_stmt(Arena *arena, Stmt *stmt, SymbolTable *symbol_table,
                             ArithmeticMode arithmetic_mode)
 {
@@ -31,7 +170,8 @@ json_object *gen_model_stmt(Arena *arena, Stmt *stmt, SymbolTable *symbol_table,
             json_object_object_add(obj, "expr",
                 gen_model_expr(arena, stmt->as.expression.expression, symbol_table, arithmetic_mode));
             /* Fire-and-forget thread spawn: mark the thread def so the wrapper
-             * frees __th__, and mark the statement for pthread_detach. */
+             * frees __th__, the spawn so it gets its own OS thread instead of a
+             * pool task, and the statement for pthread_detach. */
             if (stmt->as.expression.expression->type == EXPR_THREAD_SPAWN)
             {
                 json_object *expr_obj = NULL;
@@ -53,6 +193,8 @@ json_object *gen_model_stmt(Arena *arena, Stmt *stmt, SymbolTable *symbol_table,
                             break;
                         }
                     }
+                    json_object_object_add(expr_obj, "is_fire_and_forget",
+                        json_object_new_boolean(true));
                     json_object_object_add(obj, "is_fire_and_forget_thread",
                         json_object_new_boolean(true));
                 }
@@ -142,8 +284,13 @@ json_object *gen_model_stmt(Arena *arena, Stmt *stmt, SymbolTable *symbol_table,
                 json_object_new_string(gen_model_mem_qual_str(stmt->as.var_decl.mem_qualifier)));
             json_object_object_add(obj, "sync_mod",
                 json_object_new_string(gen_model_sync_mod_str(stmt->as.var_decl.sync_modifier)));
+            /* A sync variable gets a lock only if some lock block names it */
+            if (stmt->as.var_decl.is_lock_target)
+                gen_model_lock_target(obj, &stmt->as.var_decl);
             json_object_object_add(obj, "is_static",
                 json_object_new_boolean(stmt->as.var_decl.is_static));
+            if (stmt->as.var_decl.is_thread_local)
+                json_object_object_add(obj, "is_thread_local", json_object_new_boolean(true));
             /* Check if this variable is captured by a lambda (needs promoted storage) */
             {
                 const char *vname = stmt->as.var_decl.name.start;
@@ -687,14 +834,23 @@ json_object *gen_model_stmt(Arena *arena, Stmt *stmt, SymbolTable *symbol_table,
                 json_object_object_add(obj, "is_main_void_return",
                     json_object_new_boolean(true));
             }
-            /* Lock cleanup: emit pthread_mutex_unlock for each enclosing lock scope
-             * (innermost first) so early returns don't leave mutexes held. */
+            /* Lock cleanup: release each enclosing lock scope (innermost
+             * first) so early returns don't leave locks held. */
             if (g_lock_depth > 0)
             {
                 json_object *cleanups = json_object_new_array();
                 for (int li = g_lock_depth - 1; li >= 0; li--)
-                    json_object_array_add(cleanups,
-                        json_object_new_string(g_lock_var_names[li]));
+                {
+                    json_object *cleanup = json_object_new_object();
+                    json_object_object_add(cleanup, "name",
+                        json_object_new_string(g_lock_scopes[li].name));
+                    json_object_object_add(cleanup, "release",
+                        json_object_new_string(g_lock_scopes[li].release));
+                    if (g_lock_scopes[li].stripe)
+                        json_object_object_add(cleanup, "stripe",
+                            json_object_new_string(g_lock_scopes[li].stripe));
+                    json_object_array_add(cleanups, cleanup);
+                }
                 json_object_object_add(obj, "lock_cleanups", cleanups);
             }
             break;
@@ -703,6 +859,8 @@ json_object *gen_model_stmt(Arena *arena, Stmt *stmt, SymbolTable *symbol_table,
         case STMT_BLOCK:
         {
             json_object_object_add(obj, "kind", json_object_new_string("block"));
+            if (stmt->as.block.modifier == BLOCK_ARENA)
+                json_object_object_add(obj, "is_arena", json_object_new_boolean(1));
             json_object *stmts = json_object_new_array();
             for (int i = 0; i < stmt->as.block.count; i++)
             {
@@ -791,7 +949,15 @@ json_object *gen_model_stmt(Arena *arena, Stmt *stmt, SymbolTable *symbol_table,
         case STMT_FOR_EACH:
         {
             Type *iter_type = stmt->as.for_each_stmt.iterator_type;
-            if (iter_type != NULL)
+            if (stmt->as.for_each_stmt.parallel != NULL)
+            {
+                gen_model_parallel_for(arena, obj, stmt, symbol_table, arithmetic_mode);
+            }
+            else if (iter_is_pipeline(stmt->as.for_each_stmt.iterable))
+            {
+                gen_model_for_each_pipeline(arena, obj, stmt, symbol_table, arithmetic_mode);
+            }
+            else if (iter_type != NULL)
             {
                 /* Iterator protocol: emit for_each_iter model */
                 json_object_object_add(obj, "kind", json_object_new_string("for_each_iter"));
@@ -1017,16 +1183,58 @@ json_object *gen_model_stmt(Arena *arena, Stmt *stmt, SymbolTable *symbol_table,
         case STMT_LOCK:
         {
             json_object_object_add(obj, "kind", json_object_new_string("lock"));
-            json_object *lock_expr = gen_model_expr(arena, stmt->as.lock_stmt.lock_expr, symbol_table, arithmetic_mode);
-            json_object_object_add(obj, "lock_expr", lock_expr);
+            Expr *lock_expr = stmt->as.lock_stmt.lock_expr;
+            LockMode mode = stmt->as.lock_stmt.mode;
+
+            /* lock(arr[i]) takes one stripe of the array's striped lock */
+            Expr *var_expr = lock_expr;
+            if (lock_expr->type == EXPR_ARRAY_ACCESS)
+            {
+                var_expr = lock_expr->as.array_access.array;
+                char stripe[48];
+                snprintf(stripe, sizeof(stripe), "__sn_stripe_%d__", g_lock_stripe_count++);
+                json_object_object_add(obj, "stripe", json_object_new_string(stripe));
+                json_object_object_add(obj, "stripe_index",
+                    gen_model_expr(arena, lock_expr->as.array_access.index, symbol_table, arithmetic_mode));
+            }
+            json_object *var_obj = gen_model_expr(arena, var_expr, symbol_table, arithmetic_mode);
+            json_object_object_add(obj, "lock_expr", var_obj);
 
-            /* Push lock variable name so return statements can emit unlock */
             const char *lock_name = NULL;
             json_object *name_obj;
-            if (json_object_object_get_ex(lock_expr, "name", &name_obj))
+            if (json_object_object_get_ex(var_obj, "name", &name_obj))
                 lock_name = json_object_get_string(name_obj);
+            if (lock_name)
+                json_object_object_add(obj, "lock_name", json_object_new_string(lock_name));
+
+            /* Plain lock(x) takes a reader-writer lock for writing and a
+             * striped lock's every stripe */
+            Stmt *decl = var_expr->type == EXPR_VARIABLE ? var_expr->as.variable.sync_decl : NULL;
+            SyncLockKind kind = decl ? decl->as.var_decl.lock_kind : SYNC_LOCK_MUTEX;
+            const char *acquire = gen_model_lock_acquire(kind);
+            const char *release = gen_model_lock_release(kind);
+            if (mode == LOCK_MODE_READ)
+            {
+                acquire = "sn_rwlock_read_lock";
+                release = "sn_rwlock_read_unlock";
+            }
+            json_object *stripe_obj = NULL;
+            if (json_object_object_get_ex(obj, "stripe", &stripe_obj))
+            {
+                acquire = "pthread_mutex_lock";
+                release = "pthread_mutex_unlock";
+            }
+            json_object_object_add(obj, "acquire", json_object_new_string(acquire));
+            json_object_object_add(obj, "release", json_object_new_string(release));
+
+            /* Push the lock scope so return statements can release it */
             if (lock_name && g_lock_depth < MAX_LOCK_DEPTH)
-                g_lock_var_names[g_lock_depth++] = lock_name;
+                g_lock_scopes[g_lock_depth++] = (GenLockScope){
+                    .name = lock_name,
+                    .release = release,
+                    .stripe = stripe_obj ? json_object_get_string(stripe_obj) : NULL,
+                    .shared = mode == LOCK_MODE_READ,
+                };
 
             json_object_object_add(obj, "body",
                 gen_model_stmt(arena, stmt->as.lock_stmt.body, symbol_table, arithmetic_mode));
@@ -1,4 +1,5 @@
 #include "cgen/gen_model.h"
+#include "type_checker/expr/type_checker_expr_thread.h"
 #include <string.h>
 
 
@@ -42,6 +43,26 @@ static const char *field_copy_action(Type *type)
     }
 }
 
+/* Largest @align(N)/@cacheline request that ends up inside a struct's storage:
+ * its own, its fields', and those of value structs embedded in it */
+static size_t struct_requested_alignment(size_t own, StructField *fields, int field_count)
+{
+    size_t align = own;
+    for (int i = 0; i < field_count; i++)
+    {
+        StructField *f = &fields[i];
+        if (f->min_alignment > align) align = f->min_alignment;
+        if (f->type && f->type->kind == TYPE_STRUCT && !f->type->as.struct_type.pass_self_by_ref)
+        {
+            size_t inner = struct_requested_alignment(f->type->as.struct_type.min_alignment,
+                                                      f->type->as.struct_type.fields,
+                                                      f->type->as.struct_type.field_count);
+            if (inner > align) align = inner;
+        }
+    }
+    return align;
+}
+
 json_object *gen_model_struct(Arena *arena, StructDeclStmt *decl, SymbolTable *symbol_table,
                               ArithmeticMode arithmetic_mode)
 {
@@ -55,6 +76,10 @@ json_object *gen_model_struct(Arena *arena, StructDeclStmt *decl, SymbolTable *s
     json_object_object_add(obj, "pass_self_by_ref", json_object_new_boolean(decl->pass_self_by_ref));
     json_object_object_add(obj, "is_serializable", json_object_new_boolean(decl->is_serializable));
 
+    /* Ref structs shared between threads get atomic retain/release */
+    if (decl->pass_self_by_ref && thread_shared_rc_contains(decl->name.start))
+        json_object_object_add(obj, "atomic_rc", json_object_new_boolean(true));
+
     /* Source file tracking for modular compilation */
     if (decl->name.filename)
         gen_model_add_source_file(obj, decl->name.filename);
@@ -68,6 +93,15 @@ json_object *gen_model_struct(Arena *arena, StructDeclStmt *decl, SymbolTable *s
         json_object_object_add(obj, "c_alias", json_object_new_string(decl->c_alias));
     }
 
+    /* @align(N)/@cacheline: ref structs carry the struct-level request on
+     * __rc__, value structs on their first field.  Instances that need more
+     * than the slab's 16 bytes are allocated with sn_ref_alloc_aligned. */
+    if (decl->min_alignment > 0)
+        json_object_object_add(obj, "align", json_object_new_int64((int64_t)decl->min_alignment));
+    size_t heap_align = struct_requested_alignment(decl->min_alignment, decl->fields, decl->field_count);
+    if (heap_align > 16)
+        json_object_object_add(obj, "heap_align", json_object_new_int64((int64_t)heap_align));
+
     /* Check if any field needs heap cleanup */
     bool has_heap = false;
 
@@ -80,6 +114,11 @@ json_object *gen_model_struct(Arena *arena, StructDeclStmt *decl, SymbolTable *s
         json_object_object_add(field, "name", json_object_new_string(f->name));
         json_object_object_add(field, "type", gen_model_type(arena, f->type));
         json_object_object_add(field, "offset", json_object_new_int64((int64_t)f->offset));
+        size_t field_align = f->min_alignment;
+        if (i == 0 && !decl->pass_self_by_ref && decl->min_alignment > field_align)
+            field_align = decl->min_alignment;
+        if (field_align > 0)
+            json_object_object_add(field, "align", json_object_new_int64((int64_t)field_align));
 
         /* Per-field cleanup and copy actions for c-min codegen */
         const char *ca = field_cleanup_action(f->type);
@@ -313,5 +352,8 @@ json_object *gen_model_struct(Arena *arena, StructDeclStmt *decl, SymbolTable *s
             json_object_object_add(obj, "has_user_copy_method", json_object_new_boolean(true));
     }
 
+    /* Built-in containers (map<K, V>, MapIter<K, V>) */
+    gen_model_container(arena, decl, obj);
+
     return obj;
 }
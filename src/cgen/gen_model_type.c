@@ -149,6 +149,72 @@ const char *gen_model_var_cleanup_kind(Type *type, bool suppress_local)
     }
 }
 
+/* Per-element release/copy hooks for a container element type (SnArray
+ * elem_release/elem_copy, SnMap key/value ops).  Both stay NULL for plain
+ * values, which the runtime frees/copies as raw bytes. */
+void gen_model_elem_hooks(Arena *arena, Type *elem_type,
+                          const char **release_fn, const char **copy_fn)
+{
+    *release_fn = NULL;
+    *copy_fn = NULL;
+    if (!elem_type) return;
+    switch (elem_type->kind)
+    {
+        case TYPE_STRING:
+            *release_fn = "(void (*)(void *))sn_cleanup_str";
+            *copy_fn = "sn_copy_str";
+            break;
+        case TYPE_ARRAY:
+            *release_fn = "(void (*)(void *))sn_cleanup_array";
+            *copy_fn = "sn_copy_array";
+            break;
+        case TYPE_STRUCT:
+            if (elem_type->as.struct_type.pass_self_by_ref)
+            {
+                char buf_r[256], buf_c[256];
+                snprintf(buf_r, sizeof(buf_r),
+                    "__sn__%s_release_elem", elem_type->as.struct_type.name);
+                snprintf(buf_c, sizeof(buf_c),
+                    "__sn__%s_retain_into", elem_type->as.struct_type.name);
+                *release_fn = arena_strdup(arena, buf_r);
+                *copy_fn = arena_strdup(arena, buf_c);
+            }
+            else if (gen_model_type_category(elem_type) == TYPE_CAT_COMPOSITE)
+            {
+                /* as val: only composite structs (heap fields) need hooks */
+                char buf_r[256], buf_c[256];
+                snprintf(buf_r, sizeof(buf_r),
+                    "__sn__%s_cleanup_elem", elem_type->as.struct_type.name);
+                snprintf(buf_c, sizeof(buf_c),
+                    "__sn__%s_copy_into", elem_type->as.struct_type.name);
+                *release_fn = arena_strdup(arena, buf_r);
+                *copy_fn = arena_strdup(arena, buf_c);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/* SnElemTag constant for an element type, used by join/toString */
+const char *gen_model_elem_tag(Type *type)
+{
+    switch (type->kind)
+    {
+        case TYPE_INT:
+        case TYPE_LONG:   return "SN_TAG_INT";
+        case TYPE_DOUBLE:
+        case TYPE_FLOAT:  return "SN_TAG_DOUBLE";
+        case TYPE_STRING: return "SN_TAG_STRING";
+        case TYPE_BOOL:   return "SN_TAG_BOOL";
+        case TYPE_CHAR:   return "SN_TAG_CHAR";
+        case TYPE_BYTE:   return "SN_TAG_BYTE";
+        case TYPE_STRUCT: return "SN_TAG_STRUCT";
+        case TYPE_ARRAY:  return "SN_TAG_ARRAY";
+        default:          return "SN_TAG_DEFAULT";
+    }
+}
+
 void gen_model_emit_param_cleanup(json_object *param_obj, Parameter *param, bool callee_is_native)
 {
     if (!param->type || param->type->kind != TYPE_STRUCT) return;
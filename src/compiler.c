@@ -31,6 +31,11 @@ void compiler_init(CompilerOptions *options, int argc, char **argv)
     options->emit_model = 0;
     options->keep_c = 0;
     options->debug_build = 0;
+    options->alloc_mode = ALLOC_SLAB;
+    options->alloc_mode_set = 0;
+    options->thread_mode = THREADS_POOL;
+    options->thread_mode_set = 0;
+    options->no_sync_padding = 0;
     options->do_init = 0;
     options->do_install = 0;
     options->install_target = NULL;
@@ -66,6 +71,30 @@ void compiler_cleanup(CompilerOptions *options)
     options->compiler_dir = NULL;
 }
 
+bool compiler_parse_alloc_mode(const char *name, AllocMode *mode)
+{
+    if (strcmp(name, "slab") == 0)
+        *mode = ALLOC_SLAB;
+    else if (strcmp(name, "tcache") == 0)
+        *mode = ALLOC_TCACHE;
+    else if (strcmp(name, "system") == 0)
+        *mode = ALLOC_SYSTEM;
+    else
+        return false;
+    return true;
+}
+
+bool compiler_parse_thread_mode(const char *name, ThreadMode *mode)
+{
+    if (strcmp(name, "pool") == 0)
+        *mode = THREADS_POOL;
+    else if (strcmp(name, "os") == 0)
+        *mode = THREADS_OS;
+    else
+        return false;
+    return true;
+}
+
 int compiler_parse_args(int argc, char **argv, CompilerOptions *options)
 {
     /* Check for standalone commands first */
@@ -137,6 +166,10 @@ int compiler_parse_args(int argc, char **argv, CompilerOptions *options)
                 "  -O0                No Sn optimization (for debugging)\n"
                 "  -O1                Basic Sn optimizations (dead code elimination, string merging)\n"
                 "  -O2                Full Sn optimizations (default: + tail call, unchecked arithmetic)\n"
+                "  --alloc=<mode>     Heap allocator: slab (default), tcache (thread-caching, for threaded programs)\n"
+                "                     or system (libc only, for ASAN/valgrind)\n"
+                "  --threads=<mode>   How & spawns run: pool (worker pool, default) or os (one OS thread each)\n"
+                "  --no-sync-padding  Pack module-level sync variables instead of giving each its own cache line\n"
                 "\n"
                 "Help:\n"
                 "  -h, --help         Show this help message\n"
@@ -252,6 +285,28 @@ int compiler_parse_args(int argc, char **argv, CompilerOptions *options)
         {
             options->no_install = 1;
         }
+        else if (strncmp(argv[i], "--alloc=", 8) == 0)
+        {
+            if (!compiler_parse_alloc_mode(argv[i] + 8, &options->alloc_mode))
+            {
+                DEBUG_ERROR("Unknown allocator: %s (expected slab, tcache or system)", argv[i] + 8);
+                return 0;
+            }
+            options->alloc_mode_set = 1;
+        }
+        else if (strcmp(argv[i], "--no-sync-padding") == 0)
+        {
+            options->no_sync_padding = 1;
+        }
+        else if (strncmp(argv[i], "--threads=", 10) == 0)
+        {
+            if (!compiler_parse_thread_mode(argv[i] + 10, &options->thread_mode))
+            {
+                DEBUG_ERROR("Unknown thread mode: %s (expected pool or os)", argv[i] + 10);
+                return 0;
+            }
+            options->thread_mode_set = 1;
+        }
         else if (argv[i][0] == '-')
         {
             DEBUG_ERROR("Unknown option: %s", argv[i]);
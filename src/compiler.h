@@ -14,6 +14,19 @@ typedef enum {
     ARITH_UNCHECKED    /* Use native C operators without overflow checking */
 } ArithmeticMode;
 
+/* Heap allocator for generated programs (--alloc=<mode> or "alloc:" in sn.yaml) */
+typedef enum {
+    ALLOC_SLAB,        /* As-ref structs from per-thread slabs, everything else from libc (default) */
+    ALLOC_TCACHE,      /* Slabs plus the runtime's thread-caching allocator for all other heap memory */
+    ALLOC_SYSTEM       /* libc for everything, arena blocks allocate normally (for ASAN/valgrind) */
+} AllocMode;
+
+/* How `&` spawns run (--threads=<mode> or "threads:" in sn.yaml) */
+typedef enum {
+    THREADS_POOL,      /* Tasks on the runtime's work-stealing pool (default) */
+    THREADS_OS         /* A dedicated OS thread per spawn, for long blocking work */
+} ThreadMode;
+
 /* Optimization levels */
 #define OPT_LEVEL_NONE  0  /* -O0: No optimization */
 #define OPT_LEVEL_BASIC 1  /* -O1: Basic optimizations */
@@ -37,6 +50,11 @@ typedef struct
     int keep_c;                      /* --keep-c: Keep generated C files after compilation */
     int debug_build;                 /* -g: Include debug symbols and sanitizers in GCC output */
     int profile_build;               /* -p: Profile build (optimized with frame pointers, no ASAN/LTO) */
+    AllocMode alloc_mode;            /* Heap allocator for the generated program */
+    int alloc_mode_set;              /* --alloc given on the command line (overrides sn.yaml) */
+    ThreadMode thread_mode;          /* How the generated program runs `&` spawns */
+    int thread_mode_set;             /* --threads given on the command line (overrides sn.yaml) */
+    int no_sync_padding;             /* --no-sync-padding: Don't give sync globals their own cache line */
     int do_init;                     /* --init: Initialize new package */
     int do_install;                  /* --install: Install packages */
     char *install_target;            /* Package URL@ref for --install */
@@ -50,6 +68,8 @@ typedef struct
 void compiler_init(CompilerOptions *options, int argc, char **argv);
 void compiler_cleanup(CompilerOptions *options);
 int compiler_parse_args(int argc, char **argv, CompilerOptions *options);
+bool compiler_parse_alloc_mode(const char *name, AllocMode *mode);
+bool compiler_parse_thread_mode(const char *name, ThreadMode *mode);
 Module* compiler_compile(CompilerOptions *options);
 
 #endif
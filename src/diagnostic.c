@@ -388,6 +388,19 @@ static const char *phase_names[] = {
     "Linking"
 };
 
+void diagnostic_verbose_note(const char *fmt, ...)
+{
+    if (!g_verbose)
+        return;
+
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "    ");
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+}
+
 void diagnostic_compile_start(const char *filename)
 {
     fprintf(stderr, "%sCompiling%s %s...\n", COLOR_BOLD, COLOR_RESET, filename);
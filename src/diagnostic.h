@@ -125,6 +125,11 @@ typedef enum {
  */
 void diagnostic_set_verbose(int verbose);
 
+/*
+ * Print an informational line under the current phase (verbose mode only)
+ */
+void diagnostic_verbose_note(const char *fmt, ...);
+
 /*
  * Report compilation start
  */
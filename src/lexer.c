@@ -590,6 +590,18 @@ skip_indent_processing:
                 DEBUG_VERBOSE("Line %d: Emitting PRAGMA_SERIALIZABLE", lexer->line);
                 return lexer_make_token(lexer, TOKEN_PRAGMA_SERIALIZABLE);
             }
+            else if (strncmp(lexer->current, "align", 5) == 0)
+            {
+                lexer->current += 5;
+                DEBUG_VERBOSE("Line %d: Emitting PRAGMA_ALIGN", lexer->line);
+                return lexer_make_token(lexer, TOKEN_PRAGMA_ALIGN);
+            }
+            else if (strncmp(lexer->current, "cacheline", 9) == 0)
+            {
+                lexer->current += 9;
+                DEBUG_VERBOSE("Line %d: Emitting PRAGMA_CACHELINE", lexer->line);
+                return lexer_make_token(lexer, TOKEN_PRAGMA_CACHELINE);
+            }
             else
             {
                 snprintf(error_buffer, sizeof(error_buffer), "Unknown pragma directive");
@@ -641,6 +653,18 @@ skip_indent_processing:
             DEBUG_VERBOSE("Line %d: Emitting PRAGMA_SERIALIZABLE (@ syntax)", lexer->line);
             return lexer_make_token(lexer, TOKEN_PRAGMA_SERIALIZABLE);
         }
+        else if (strncmp(lexer->current, "align", 5) == 0)
+        {
+            lexer->current += 5;
+            DEBUG_VERBOSE("Line %d: Emitting PRAGMA_ALIGN (@ syntax)", lexer->line);
+            return lexer_make_token(lexer, TOKEN_PRAGMA_ALIGN);
+        }
+        else if (strncmp(lexer->current, "cacheline", 9) == 0)
+        {
+            lexer->current += 9;
+            DEBUG_VERBOSE("Line %d: Emitting PRAGMA_CACHELINE (@ syntax)", lexer->line);
+            return lexer_make_token(lexer, TOKEN_PRAGMA_CACHELINE);
+        }
         snprintf(error_buffer, sizeof(error_buffer), "Unknown @ directive");
         return lexer_error_token(lexer, error_buffer);
     default:
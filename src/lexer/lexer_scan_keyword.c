@@ -21,6 +21,8 @@ SnTokenType lexer_identifier_type(Lexer *lexer)
         {
             switch (lexer->start[1])
             {
+            case 'r':
+                return lexer_check_keyword(lexer, 2, 3, "ena", TOKEN_ARENA);
             case 's':
                 return lexer_check_keyword(lexer, 2, 0, "", TOKEN_AS);
             }
@@ -185,6 +187,8 @@ SnTokenType lexer_identifier_type(Lexer *lexer)
         {
             switch (lexer->start[1])
             {
+            case 'h':
+                return lexer_check_keyword(lexer, 2, 9, "readlocal", TOKEN_THREADLOCAL);
             case 'r':
                 return lexer_check_keyword(lexer, 2, 2, "ue", TOKEN_BOOL_LITERAL);
             case 'y':
@@ -106,6 +106,11 @@ static int compile_to_executable(CompilerOptions *options, CCBackendConfig *cc_c
                                           &options->symbol_table,
                                           options->arithmetic_mode);
     gen_model_flatten_chains(model);
+    int specialized = 0;
+    int direct_calls = gen_model_devirtualize_closures(model, &specialized);
+    int stack_refs = gen_model_stack_alloc_refs(model);
+    int stack_closures = gen_model_stack_alloc_closures(model);
+    int rc_removed = gen_model_elide_refcounts(model);
 
     /* Split model into per-source-file modules */
     ModularModel *split = gen_model_split(model, options->source_file);
@@ -157,6 +162,15 @@ static int compile_to_executable(CompilerOptions *options, CCBackendConfig *cc_c
     }
 
     diagnostic_phase_done(PHASE_CODE_GEN, 0);
+    if (rc_removed > 0)
+        diagnostic_verbose_note("Last-use moves: removed %d copy/cleanup operations", rc_removed);
+    if (stack_refs > 0)
+        diagnostic_verbose_note("Escape analysis: %d as-ref locals placed on the stack", stack_refs);
+    if (stack_closures > 0)
+        diagnostic_verbose_note("Escape analysis: %d closures placed on the stack", stack_closures);
+    if (direct_calls > 0 || specialized > 0)
+        diagnostic_verbose_note("Devirtualization: %d closure calls made direct, %d functions specialized",
+                                direct_calls, specialized);
 
     /* Compile each .c → .o, then link all .o → executable */
     diagnostic_phase_start(PHASE_LINKING);
@@ -284,6 +298,60 @@ int main(int argc, char **argv)
     cc_backend_load_config(options.compiler_dir);
     cc_backend_init_config(&cc_config);
 
+    /* The allocator and thread mode can also be chosen in sn.yaml
+     * ("alloc: tcache", "threads: os"); the command line takes precedence */
+    if ((!options.alloc_mode_set || !options.thread_mode_set) && package_yaml_exists())
+    {
+        PackageConfig pkg;
+        if (package_yaml_parse("sn.yaml", &pkg))
+        {
+            if (!options.alloc_mode_set && pkg.alloc[0] != '\0' &&
+                !compiler_parse_alloc_mode(pkg.alloc, &options.alloc_mode))
+            {
+                fprintf(stderr, "Warning: Unknown allocator '%s' in sn.yaml (expected slab, tcache or system)\n",
+                        pkg.alloc);
+            }
+            if (!options.thread_mode_set && pkg.threads[0] != '\0' &&
+                !compiler_parse_thread_mode(pkg.threads, &options.thread_mode))
+            {
+                fprintf(stderr, "Warning: Unknown thread mode '%s' in sn.yaml (expected pool or os)\n",
+                        pkg.threads);
+            }
+        }
+    }
+
+    /* --alloc=system keeps as-ref structs on calloc/free and turns arena
+     * blocks into plain blocks (see sn_slab.h, sn_region.h); --alloc=tcache
+     * switches the runtime heap to its thread-caching allocator (sn_tcache.h) */
+    char alloc_cflags[1024];
+    if (options.alloc_mode != ALLOC_SLAB)
+    {
+        snprintf(alloc_cflags, sizeof(alloc_cflags), "%s %s",
+                 cc_config.cflags ? cc_config.cflags : "",
+                 options.alloc_mode == ALLOC_SYSTEM ? "-DSN_ALLOC_SYSTEM" : "-DSN_ALLOC_TCACHE");
+        cc_config.cflags = alloc_cflags;
+    }
+
+    /* --threads=os gives every & spawn its own OS thread instead of a task
+     * on the runtime pool (sn_thread.h) */
+    char thread_cflags[1024];
+    if (options.thread_mode == THREADS_OS)
+    {
+        snprintf(thread_cflags, sizeof(thread_cflags), "%s -DSN_THREADS_OS",
+                 cc_config.cflags ? cc_config.cflags : "");
+        cc_config.cflags = thread_cflags;
+    }
+
+    /* --no-sync-padding drops the cache-line placement of module-level sync
+     * variables (SN_SYNC_GLOBAL in sn_thread.h) for memory-tight targets */
+    char sync_cflags[1024];
+    if (options.no_sync_padding)
+    {
+        snprintf(sync_cflags, sizeof(sync_cflags), "%s -DSN_NO_SYNC_PADDING",
+                 cc_config.cflags ? cc_config.cflags : "");
+        cc_config.cflags = sync_cflags;
+    }
+
     if (!options.emit_model && !options.emit_c)
     {
         if (!gcc_check_available(&cc_config, options.verbose))
@@ -338,6 +406,11 @@ int main(int argc, char **argv)
         json_object *model = gen_model_build(&options.arena, module,
                                               &options.symbol_table, options.arithmetic_mode);
         gen_model_flatten_chains(model);
+        int specialized = 0;
+        int direct_calls = gen_model_devirtualize_closures(model, &specialized);
+        int stack_refs = gen_model_stack_alloc_refs(model);
+        int stack_closures = gen_model_stack_alloc_closures(model);
+        int rc_removed = gen_model_elide_refcounts(model);
         char td[1024];
         snprintf(td, sizeof(td), "%s/templates/c", options.compiler_dir);
         char *code = gen_model_render_min_c(model, td);
@@ -346,6 +419,15 @@ int main(int argc, char **argv)
         { free(code); diagnostic_phase_failed(PHASE_CODE_GEN); compiler_cleanup(&options); return 1; }
         free(code);
         diagnostic_phase_done(PHASE_CODE_GEN, 0);
+        if (rc_removed > 0)
+            diagnostic_verbose_note("Last-use moves: removed %d copy/cleanup operations", rc_removed);
+        if (stack_refs > 0)
+            diagnostic_verbose_note("Escape analysis: %d as-ref locals placed on the stack", stack_refs);
+        if (stack_closures > 0)
+            diagnostic_verbose_note("Escape analysis: %d closures placed on the stack", stack_closures);
+        if (direct_calls > 0 || specialized > 0)
+            diagnostic_verbose_note("Devirtualization: %d closure calls made direct, %d functions specialized",
+                                    direct_calls, specialized);
         report_success(options.output_file);
         compiler_cleanup(&options);
         return 0;
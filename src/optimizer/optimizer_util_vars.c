@@ -322,6 +322,15 @@ void collect_used_variables_stmt(Stmt *stmt, Token **used_vars, int *used_count,
 
     case STMT_FOR_EACH:
         collect_used_variables(stmt->as.for_each_stmt.iterable, used_vars, used_count, used_capacity, arena);
+        if (stmt->as.for_each_stmt.parallel != NULL)
+        {
+            ParallelClause *parallel = stmt->as.for_each_stmt.parallel;
+            collect_used_variables(parallel->chunk, used_vars, used_count, used_capacity, arena);
+            for (int i = 0; i < parallel->reduction_count; i++)
+            {
+                add_used_variable(used_vars, used_count, used_capacity, arena, parallel->reductions[i].var_name);
+            }
+        }
         collect_used_variables_stmt(stmt->as.for_each_stmt.body, used_vars, used_count, used_capacity, arena);
         break;
 
@@ -54,6 +54,8 @@ typedef struct {
     char author[PKG_MAX_NAME_LEN];
     char description[PKG_MAX_URL_LEN];
     char license[PKG_MAX_NAME_LEN];
+    char alloc[PKG_MAX_VERSION_LEN];   /* Heap allocator (--alloc), empty for the default */
+    char threads[PKG_MAX_VERSION_LEN]; /* Thread mode (--threads), empty for the default */
     PackageDependency dependencies[PKG_MAX_DEPS];
     int dependency_count;
 } PackageConfig;
@@ -145,6 +145,10 @@ bool package_yaml_parse(const char *path, PackageConfig *config)
                         safe_strncpy(config->description, value, sizeof(config->description));
                     } else if (strcmp(current_key, "license") == 0) {
                         safe_strncpy(config->license, value, sizeof(config->license));
+                    } else if (strcmp(current_key, "alloc") == 0) {
+                        safe_strncpy(config->alloc, value, sizeof(config->alloc));
+                    } else if (strcmp(current_key, "threads") == 0) {
+                        safe_strncpy(config->threads, value, sizeof(config->threads));
                     }
                     state = PARSE_ROOT_KEY;
                 } else if (state == PARSE_DEP_KEY) {
@@ -254,6 +258,12 @@ bool package_yaml_write(const char *path, const PackageConfig *config)
     if (config->license[0]) {
         if (!emit_key_value(&emitter, "license", config->license)) goto error;
     }
+    if (config->alloc[0]) {
+        if (!emit_key_value(&emitter, "alloc", config->alloc)) goto error;
+    }
+    if (config->threads[0]) {
+        if (!emit_key_value(&emitter, "threads", config->threads)) goto error;
+    }
 
     /* Dependencies */
     if (config->dependency_count > 0) {
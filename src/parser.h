@@ -28,6 +28,7 @@ typedef struct
     ImportContext *import_ctx; /* Context for import-first processing (NULL if not tracking imports) */
     const char *pending_alias; /* C alias from #pragma alias, applied to next declaration */
     bool pending_serializable; /* True when @serializable precedes a struct declaration */
+    size_t pending_alignment;  /* From @align(N)/@cacheline preceding a struct declaration, 0 if none */
     const char **pending_comments; /* Pending // comments to attach to next statement */
     int pending_comment_count;     /* Number of pending comments */
     int pending_comment_capacity;  /* Capacity of pending_comments array */
@@ -77,6 +78,7 @@ int parser_match(Parser *parser, SnTokenType type);
 Type *parser_type(Parser *parser);
 ParsedType parser_type_with_size(Parser *parser);
 MemoryQualifier parser_memory_qualifier(Parser *parser);
+SyncOrder parser_sync_order(Parser *parser);
 
 Expr *parser_expression(Parser *parser);
 Expr *parser_assignment(Parser *parser);
@@ -100,6 +102,8 @@ Stmt *parser_return_statement(Parser *parser);
 Stmt *parser_if_statement(Parser *parser);
 Stmt *parser_while_statement(Parser *parser);
 Stmt *parser_for_statement(Parser *parser);
+bool parser_at_parallel_for(Parser *parser);
+Stmt *parser_parallel_for_statement(Parser *parser);
 Stmt *parser_expression_statement(Parser *parser);
 Stmt *parser_import_statement(Parser *parser);
 
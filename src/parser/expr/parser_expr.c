@@ -521,6 +521,12 @@ Expr *parser_primary(Parser *parser)
         parser->current.type = TOKEN_IDENTIFIER;
     }
 
+    /* Allow 'arena' as an identifier in expression context (only 'arena =>' opens a block) */
+    if (parser_check(parser, TOKEN_ARENA))
+    {
+        parser->current.type = TOKEN_IDENTIFIER;
+    }
+
     /* Allow 'val' as an identifier in expression context (e.g. variable named val) */
     if (parser_check(parser, TOKEN_VAL))
     {
@@ -568,10 +574,12 @@ Expr *parser_primary(Parser *parser)
         /* Check for generic struct literal: Stack<int> { ... } */
         if (parser_check(parser, TOKEN_LESS))
         {
-            /* Only treat as generic instantiation if the identifier is a known struct type */
+            /* Only treat as generic instantiation if the identifier is a known struct type
+             * or a built-in container (map<K, V> { }) */
             Symbol *type_symbol = symbol_table_lookup_type(parser->symbol_table, var_token);
-            if (type_symbol != NULL && type_symbol->type != NULL &&
-                type_symbol->type->kind == TYPE_STRUCT)
+            if ((type_symbol != NULL && type_symbol->type != NULL &&
+                 type_symbol->type->kind == TYPE_STRUCT) ||
+                parser_is_container_type_name(var_token.start, var_token.length))
             {
                 /* Peek ahead: consume '<', parse type args, consume '>',
                  * then expect '{' for a struct literal */
@@ -659,6 +667,21 @@ Expr *parser_primary(Parser *parser)
             {
                 return parse_struct_literal(parser, &var_token);
             }
+
+            /* Built-in container without type arguments: bits {} */
+            if (type_symbol == NULL &&
+                parser_is_plain_container_type_name(var_token.start, var_token.length))
+            {
+                const char *template_name = arena_strndup(parser->arena,
+                    var_token.start, var_token.length);
+                Expr *lit = parse_struct_literal(parser, &var_token);
+                if (lit != NULL)
+                {
+                    lit->as.struct_literal.type_annotation = ast_create_generic_inst_type(
+                        parser->arena, template_name, NULL, 0);
+                }
+                return lit;
+            }
         }
 
         /* Check for static method call */
@@ -719,8 +742,12 @@ Expr *parser_primary(Parser *parser)
             name_token.filename = parser->current.filename;
 
             Symbol *type_symbol = symbol_table_lookup_type(parser->symbol_table, name_token);
-            if (type_symbol != NULL && type_symbol->type != NULL &&
-                type_symbol->type->kind == TYPE_STRUCT)
+            bool is_struct_type = (type_symbol != NULL && type_symbol->type != NULL &&
+                                   type_symbol->type->kind == TYPE_STRUCT);
+            /* Built-in containers (map<K, V>) have no parse-time symbol */
+            bool is_container = (inferred_type->kind == TYPE_GENERIC_INST &&
+                                 parser_is_container_type_name(name_token.start, name_token.length));
+            if (is_struct_type || is_container)
             {
                 Expr *lit = parse_struct_literal(parser, &name_token);
                 if (lit != NULL && inferred_type->kind == TYPE_GENERIC_INST)
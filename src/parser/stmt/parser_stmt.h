@@ -17,5 +17,6 @@ Stmt *parser_declaration(Parser *parser);
 Stmt *parser_expression_statement(Parser *parser);
 Stmt *parser_import_statement(Parser *parser);
 Stmt *parser_pragma_statement(Parser *parser, PragmaType pragma_type);
+size_t parser_alignment_directive(Parser *parser);
 
 #endif /* PARSER_STMT_H */
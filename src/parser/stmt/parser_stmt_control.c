@@ -357,3 +357,144 @@ Stmt *parser_for_statement(Parser *parser)
 
     return ast_create_for_stmt(parser->arena, initializer, condition, increment, body, &for_token);
 }
+
+static bool parser_ident_is(Token token, const char *word)
+{
+    size_t len = strlen(word);
+    return token.type == TOKEN_IDENTIFIER && (size_t)token.length == len &&
+           strncmp(token.start, word, len) == 0;
+}
+
+/* True when the current token starts a parallel for-loop:
+ *   parallel for ...
+ *   parallel(static ...) / parallel(guided ...) / parallel(reduce ...) for ...
+ * 'parallel' is not a keyword, so anything else is an ordinary identifier. */
+bool parser_at_parallel_for(Parser *parser)
+{
+    if (!parser_ident_is(parser->current, "parallel"))
+        return false;
+
+    Token ahead1 = parser_peek_token(parser);
+    if (ahead1.type == TOKEN_FOR)
+        return true;
+    if (ahead1.type != TOKEN_LEFT_PAREN)
+        return false;
+
+    Token ahead2 = parser_peek_token2(parser);
+    return ahead2.type == TOKEN_STATIC || parser_ident_is(ahead2, "guided") ||
+           parser_ident_is(ahead2, "reduce");
+}
+
+/* reduce name: op, where op is +, min or max */
+static bool parser_parallel_reduction(Parser *parser, ParallelReduction *out)
+{
+    parser_consume(parser, TOKEN_IDENTIFIER, "Expected variable name after 'reduce'");
+    Token name = parser->previous;
+    name.start = arena_strndup(parser->arena, name.start, name.length);
+    if (name.start == NULL)
+    {
+        parser_error_at_current(parser, "Out of memory");
+        return false;
+    }
+    parser_consume(parser, TOKEN_COLON, "Expected ':' after reduction variable");
+
+    if (parser_match(parser, TOKEN_PLUS))
+        out->op = REDUCE_SUM;
+    else if (parser_ident_is(parser->current, "min"))
+    {
+        parser_advance(parser);
+        out->op = REDUCE_MIN;
+    }
+    else if (parser_ident_is(parser->current, "max"))
+    {
+        parser_advance(parser);
+        out->op = REDUCE_MAX;
+    }
+    else
+    {
+        parser_error_at_current(parser, "Expected '+', 'min' or 'max' as reduction operator");
+        return false;
+    }
+    out->var_name = name;
+    return true;
+}
+
+/* parallel [(clause, ...)] for x in iterable => body
+ * Clauses: static[: chunk], guided[: chunk], reduce name: op */
+Stmt *parser_parallel_for_statement(Parser *parser)
+{
+    parser_advance(parser); /* 'parallel' */
+    Token parallel_token = parser->previous;
+
+    ParallelClause *clause = arena_alloc(parser->arena, sizeof(ParallelClause));
+    if (clause == NULL)
+    {
+        parser_error_at_current(parser, "Out of memory");
+        return NULL;
+    }
+    memset(clause, 0, sizeof(ParallelClause));
+    clause->schedule = SCHEDULE_STATIC;
+
+    if (parser_match(parser, TOKEN_LEFT_PAREN))
+    {
+        bool have_schedule = false;
+        int reduction_capacity = 0;
+        do
+        {
+            if (parser_check(parser, TOKEN_STATIC) ||
+                parser_ident_is(parser->current, "guided"))
+            {
+                bool guided = !parser_check(parser, TOKEN_STATIC);
+                parser_advance(parser);
+                if (have_schedule)
+                {
+                    parser_error(parser, "Parallel loop already has a schedule");
+                    return NULL;
+                }
+                have_schedule = true;
+                clause->schedule = guided ? SCHEDULE_GUIDED : SCHEDULE_STATIC;
+                if (parser_match(parser, TOKEN_COLON))
+                    clause->chunk = parser_expression(parser);
+            }
+            else if (parser_ident_is(parser->current, "reduce"))
+            {
+                parser_advance(parser);
+                if (clause->reduction_count >= reduction_capacity)
+                {
+                    int new_capacity = reduction_capacity == 0 ? 4 : reduction_capacity * 2;
+                    ParallelReduction *grown = arena_alloc(parser->arena, sizeof(ParallelReduction) * new_capacity);
+                    if (grown == NULL)
+                    {
+                        parser_error_at_current(parser, "Out of memory");
+                        return NULL;
+                    }
+                    if (clause->reduction_count > 0)
+                        memcpy(grown, clause->reductions, sizeof(ParallelReduction) * clause->reduction_count);
+                    clause->reductions = grown;
+                    reduction_capacity = new_capacity;
+                }
+                if (!parser_parallel_reduction(parser, &clause->reductions[clause->reduction_count]))
+                    return NULL;
+                clause->reduction_count++;
+            }
+            else
+            {
+                parser_error_at_current(parser, "Expected 'static', 'guided' or 'reduce' in parallel clause");
+                return NULL;
+            }
+        } while (parser_match(parser, TOKEN_COMMA));
+        parser_consume(parser, TOKEN_RIGHT_PAREN, "Expected ')' after parallel clauses");
+    }
+
+    parser_consume(parser, TOKEN_FOR, "Expected 'for' after 'parallel'");
+    Stmt *loop = parser_for_statement(parser);
+    if (loop == NULL)
+        return NULL;
+    if (loop->type != STMT_FOR_EACH)
+    {
+        parser_error_at(parser, &parallel_token, "Only for-each loops ('for x in ...') can be parallel");
+        return NULL;
+    }
+    loop->as.for_each_stmt.parallel = clause;
+    return loop;
+}
@@ -10,5 +10,7 @@ Stmt *parser_return_statement(Parser *parser);
 Stmt *parser_if_statement(Parser *parser);
 Stmt *parser_while_statement(Parser *parser);
 Stmt *parser_for_statement(Parser *parser);
+bool parser_at_parallel_for(Parser *parser);
+Stmt *parser_parallel_for_statement(Parser *parser);
 
 #endif /* PARSER_STMT_CONTROL_H */
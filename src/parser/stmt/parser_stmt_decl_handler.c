@@ -27,9 +27,11 @@ Stmt *parser_declaration(Parser *parser)
     {
         /* 'static var' or 'static sync var' at module level for static module variables */
         SyncModifier sync_mod = SYNC_NONE;
+        SyncOrder sync_order = SYNC_ORDER_SEQ_CST;
         if (parser_match(parser, TOKEN_SYNC))
         {
             sync_mod = SYNC_ATOMIC;
+            sync_order = parser_sync_order(parser);
         }
         if (parser_match(parser, TOKEN_VAR))
         {
@@ -37,6 +39,7 @@ Stmt *parser_declaration(Parser *parser)
             if (result != NULL && result->type == STMT_VAR_DECL)
             {
                 result->as.var_decl.is_static = true;
+                result->as.var_decl.sync_order = sync_order;
             }
             goto attach_comments;
         }
@@ -49,9 +52,30 @@ Stmt *parser_declaration(Parser *parser)
         }
     }
 
+    if (parser_match(parser, TOKEN_THREADLOCAL))
+    {
+        /* 'threadlocal var' at module level: every thread gets its own copy */
+        if (parser_match(parser, TOKEN_VAR))
+        {
+            result = parser_var_declaration(parser, SYNC_NONE);
+            if (result != NULL && result->type == STMT_VAR_DECL)
+            {
+                result->as.var_decl.is_thread_local = true;
+            }
+            goto attach_comments;
+        }
+        else
+        {
+            parser_error_at_current(parser,
+                "'threadlocal' can only be used with 'var'. Did you mean 'threadlocal var'?");
+            return NULL;
+        }
+    }
+
     if (parser_match(parser, TOKEN_SYNC))
     {
-        /* 'sync var' or 'sync static var' at module level */
+        /* 'sync var' or 'sync static var' at module level, optionally sync(order) */
+        SyncOrder sync_order = parser_sync_order(parser);
         bool is_static = false;
         if (parser_match(parser, TOKEN_STATIC))
         {
@@ -63,6 +87,7 @@ Stmt *parser_declaration(Parser *parser)
             if (result != NULL && result->type == STMT_VAR_DECL)
             {
                 result->as.var_decl.is_static = is_static;
+                result->as.var_decl.sync_order = sync_order;
             }
             goto attach_comments;
         }
@@ -147,6 +172,26 @@ Stmt *parser_declaration(Parser *parser)
         result = parser_declaration(parser);
         goto attach_comments;
     }
+    if (parser_match(parser, TOKEN_PRAGMA_ALIGN) || parser_match(parser, TOKEN_PRAGMA_CACHELINE))
+    {
+        Token directive = parser->previous;
+        size_t alignment = parser_alignment_directive(parser);
+        if (alignment == 0)
+        {
+            return NULL;
+        }
+        parser->pending_alignment = alignment;
+        /* Consume optional newline, then parse the next declaration (must be a struct) */
+        parser_match(parser, TOKEN_NEWLINE);
+        result = parser_declaration(parser);
+        if (result != NULL && result->type != STMT_STRUCT_DECL)
+        {
+            parser_error_at(parser, &directive,
+                "@align and @cacheline can only be applied to a struct or a struct field");
+        }
+        parser->pending_alignment = 0;
+        goto attach_comments;
+    }
     if (parser_match(parser, TOKEN_KEYWORD_TYPE))
     {
         result = parser_type_declaration(parser);
@@ -306,6 +306,10 @@ Stmt *parser_struct_declaration(Parser *parser, bool is_native)
     Token struct_token = parser->previous;
     Token name;
 
+    /* Alignment from a preceding @align(N) / @cacheline */
+    size_t min_alignment = parser->pending_alignment;
+    parser->pending_alignment = 0;
+
     /* Parse struct name */
     if (parser_check(parser, TOKEN_IDENTIFIER))
     {
@@ -476,6 +480,9 @@ Stmt *parser_struct_declaration(Parser *parser, bool is_native)
 
     /* Local pending alias for fields/methods inside struct body */
     const char *member_alias = NULL;
+    /* Local pending @align(N) / @cacheline for the next field */
+    size_t member_alignment = 0;
+    bool any_field_aligned = false;
 
     /* Check for indented block */
     if (parser_check(parser, TOKEN_INDENT))
@@ -513,9 +520,22 @@ Stmt *parser_struct_declaration(Parser *parser, bool is_native)
                 continue;
             }
 
+            /* Check for @align(N) / @cacheline before a field */
+            if (parser_match(parser, TOKEN_PRAGMA_ALIGN) || parser_match(parser, TOKEN_PRAGMA_CACHELINE))
+            {
+                member_alignment = parser_alignment_directive(parser);
+                parser_match(parser, TOKEN_NEWLINE);
+                continue;
+            }
+
             /* Check if this is a method declaration */
             if (parser_is_method_start(parser))
             {
+                if (member_alignment != 0)
+                {
+                    parser_error_at_current(parser, "@align and @cacheline apply to fields, not methods");
+                    member_alignment = 0;
+                }
                 /* Check for operator method: operator <op> (...): type => body */
                 bool is_operator_method = false;
                 SnTokenType operator_tok = TOKEN_EOF;
@@ -809,6 +829,12 @@ Stmt *parser_struct_declaration(Parser *parser, bool is_native)
                 {
                     fields[field_count].c_alias = NULL;
                 }
+                fields[field_count].min_alignment = member_alignment;
+                if (member_alignment != 0)
+                {
+                    any_field_aligned = true;
+                    member_alignment = 0;
+                }
                 field_count++;
 
                 /* Consume newline after field definition */
@@ -830,6 +856,13 @@ Stmt *parser_struct_declaration(Parser *parser, bool is_native)
     /* Check if this struct should be packed (from #pragma pack(1)) */
     bool is_packed = (parser->pack_alignment == 1);
 
+    /* Padding for alignment is exactly what #pragma pack(1) removes */
+    if (is_packed && (min_alignment != 0 || any_field_aligned))
+    {
+        parser_error_at(parser, &struct_token, "@align and @cacheline cannot be used in a packed struct");
+        return NULL;
+    }
+
     /* Check if this struct is @serializable */
     bool is_serializable = parser->pending_serializable;
     parser->pending_serializable = false;
@@ -1011,11 +1044,19 @@ Stmt *parser_struct_declaration(Parser *parser, bool is_native)
         return NULL;
     }
 
+    /* An aliased native struct is laid out by its C definition */
+    if (c_alias != NULL && (min_alignment != 0 || any_field_aligned))
+    {
+        parser_error_at(parser, &struct_token, "@align and @cacheline are not allowed on aliased native structs");
+        return NULL;
+    }
+
     /* Create the struct type for the symbol table */
     Type *struct_type = ast_create_struct_type(parser->arena, name.start, fields, field_count,
                                                 methods, method_count, is_native, is_packed,
                                                 pass_self_by_ref, c_alias);
     struct_type->as.struct_type.is_serializable = is_serializable;
+    struct_type->as.struct_type.min_alignment = min_alignment;
 
     /* Register the struct type in the symbol table so it can be used by later declarations */
     symbol_table_add_type(parser->symbol_table, name, struct_type);
@@ -1027,6 +1068,7 @@ Stmt *parser_struct_declaration(Parser *parser, bool is_native)
                                               is_native, is_packed,
                                               pass_self_by_ref, c_alias, &struct_token);
     stmt->as.struct_decl.is_serializable = is_serializable;
+    stmt->as.struct_decl.min_alignment = min_alignment;
     stmt->as.struct_decl.type_params = type_params;
     stmt->as.struct_decl.type_param_count = type_param_count;
     stmt->as.struct_decl.type_param_constraints = type_param_constraints;
@@ -19,9 +19,15 @@ Stmt *parser_statement(Parser *parser)
     }
     if (parser_match(parser, TOKEN_SYNC))
     {
+        SyncOrder sync_order = parser_sync_order(parser);
         if (parser_match(parser, TOKEN_VAR))
         {
-            return parser_var_declaration(parser, SYNC_ATOMIC);
+            Stmt *stmt = parser_var_declaration(parser, SYNC_ATOMIC);
+            if (stmt != NULL && stmt->type == STMT_VAR_DECL)
+            {
+                stmt->as.var_decl.sync_order = sync_order;
+            }
+            return stmt;
         }
         else
         {
@@ -65,6 +71,31 @@ Stmt *parser_statement(Parser *parser)
     {
         return parser_return_statement(parser);
     }
+    // Parse parallel [(clauses)] for x in iterable => block
+    if (parser_at_parallel_for(parser))
+    {
+        return parser_parallel_for_statement(parser);
+    }
+    // Parse arena => block. Anything else starting with 'arena' is an expression.
+    if (parser_check(parser, TOKEN_ARENA) && parser_peek_token(parser).type == TOKEN_ARROW)
+    {
+        parser_advance(parser);
+        Token arena_token = parser->previous;
+        parser_consume(parser, TOKEN_ARROW, "Expected '=>' after 'arena'");
+        skip_newlines(parser);
+
+        Stmt *body = parser_indented_block(parser);
+        if (body == NULL)
+        {
+            body = ast_create_block_stmt(parser->arena, NULL, 0, &arena_token);
+        }
+        body->as.block.modifier = BLOCK_ARENA;
+        return body;
+    }
+    if (parser_check(parser, TOKEN_ARENA))
+    {
+        goto parse_expression_stmt;
+    }
     // Parse using name = expr => block
     if (parser_match(parser, TOKEN_USING))
     {
@@ -92,7 +123,7 @@ Stmt *parser_statement(Parser *parser)
         return ast_create_using_stmt(parser->arena, name, initializer, body, &using_token);
     }
 
-    // Parse lock(expr) => block
+    // Parse lock [read|write](expr) => block
     // Disambiguate: lock() with empty args is a method call, not a lock statement.
     // A lock statement always has a non-empty expression: lock(syncVar) => body.
     {
@@ -114,6 +145,20 @@ Stmt *parser_statement(Parser *parser)
     {
         Token lock_token = parser->previous;
 
+        /* read/write are contextual: only special between 'lock' and '(' */
+        LockMode mode = LOCK_MODE_EXCLUSIVE;
+        if (parser_check(parser, TOKEN_IDENTIFIER) && parser_peek_token(parser).type == TOKEN_LEFT_PAREN)
+        {
+            Token word = parser->current;
+            if (word.length == 4 && strncmp(word.start, "read", 4) == 0)
+                mode = LOCK_MODE_READ;
+            else if (word.length == 5 && strncmp(word.start, "write", 5) == 0)
+                mode = LOCK_MODE_WRITE;
+            else
+                parser_error_at_current(parser, "Expected 'read' or 'write' after 'lock'");
+            parser_advance(parser);
+        }
+
         parser_consume(parser, TOKEN_LEFT_PAREN, "Expected '(' after 'lock'");
         Expr *lock_expr = parser_expression(parser);
         parser_consume(parser, TOKEN_RIGHT_PAREN, "Expected ')' after lock expression");
@@ -126,7 +171,7 @@ Stmt *parser_statement(Parser *parser)
             body = ast_create_block_stmt(parser->arena, NULL, 0, &lock_token);
         }
 
-        return ast_create_lock_stmt(parser->arena, lock_expr, body, &lock_token);
+        return ast_create_lock_stmt(parser->arena, lock_expr, body, mode, &lock_token);
     }
 
 parse_expression_stmt:
@@ -177,6 +177,32 @@ static Stmt *parser_pragma_pack_statement(Parser *parser)
     return ast_create_pragma_stmt(parser->arena, PRAGMA_PACK, value, &pragma_token);
 }
 
+/* Parse the rest of @align(N) or @cacheline, whose token has just been
+ * consumed, and return the requested alignment (0 after an error).
+ * @cacheline is @align(SN_CACHE_LINE_SIZE). */
+size_t parser_alignment_directive(Parser *parser)
+{
+    if (parser->previous.type == TOKEN_PRAGMA_CACHELINE)
+    {
+        return SN_CACHE_LINE_SIZE;
+    }
+
+    parser_consume(parser, TOKEN_LEFT_PAREN, "Expected '(' after 'align'");
+    if (!parser_match(parser, TOKEN_INT_LITERAL))
+    {
+        parser_error_at_current(parser, "Expected integer literal in @align(...)");
+        return 0;
+    }
+    long long alignment = parser->previous.literal.int_value;
+    if (alignment < 1 || alignment > 4096 || (alignment & (alignment - 1)) != 0)
+    {
+        parser_error(parser, "@align(N) requires a power of two between 1 and 4096");
+        return 0;
+    }
+    parser_consume(parser, TOKEN_RIGHT_PAREN, "Expected ')' after alignment");
+    return (size_t)alignment;
+}
+
 /* Parser for #pragma alias "c_name"
  * Sets pending_alias which will be applied to the next native struct, field, or method.
  * Returns a pragma statement to preserve the directive in the AST. */
@@ -22,6 +22,33 @@ MemoryQualifier parser_memory_qualifier(Parser *parser)
     return MEM_DEFAULT;
 }
 
+/* Parse the optional "(relaxed)", "(acq_rel)" or "(seq_cst)" after 'sync' */
+SyncOrder parser_sync_order(Parser *parser)
+{
+    if (!parser_match(parser, TOKEN_LEFT_PAREN))
+    {
+        return SYNC_ORDER_SEQ_CST;
+    }
+    SyncOrder order = SYNC_ORDER_SEQ_CST;
+    Token word = parser->current;
+    if (word.type == TOKEN_IDENTIFIER && word.length == 7 && strncmp(word.start, "relaxed", 7) == 0)
+    {
+        order = SYNC_ORDER_RELAXED;
+    }
+    else if (word.type == TOKEN_IDENTIFIER && word.length == 7 && strncmp(word.start, "acq_rel", 7) == 0)
+    {
+        order = SYNC_ORDER_ACQ_REL;
+    }
+    else if (!(word.type == TOKEN_IDENTIFIER && word.length == 7 && strncmp(word.start, "seq_cst", 7) == 0))
+    {
+        parser_error_at_current(parser, "Expected 'relaxed', 'acq_rel' or 'seq_cst' after 'sync('");
+        return order;
+    }
+    parser_advance(parser);
+    parser_consume(parser, TOKEN_RIGHT_PAREN, "Expected ')' after memory order");
+    return order;
+}
+
 int is_at_function_boundary(Parser *parser)
 {
     if (parser_check(parser, TOKEN_DEDENT))
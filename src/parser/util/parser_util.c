@@ -370,6 +370,7 @@ static Type *parser_function_type(Parser *parser)
 Type *parser_type(Parser *parser)
 {
     Type *type = NULL;
+    Token type_start = parser->current;
 
     /* Handle pointer types: *T, **T, *void */
     if (parser_match(parser, TOKEN_STAR))
@@ -502,6 +503,13 @@ Type *parser_type(Parser *parser)
                     char *self_name = arena_strndup(parser->arena, id.start, id.length);
                     type = ast_create_opaque_type(parser->arena, self_name);
                 }
+                else if (!parser_check(parser, TOKEN_LESS) &&
+                         parser_is_plain_container_type_name(id.start, id.length))
+                {
+                    char *type_name = arena_strndup(parser->arena, id.start, id.length);
+                    type = ast_create_generic_inst_type(parser->arena, type_name, NULL, 0);
+                    type->as.generic_inst.name_token = id;
+                }
                 else
                 {
                     /* Treat unknown identifier as potential struct type reference.
@@ -573,6 +581,7 @@ Type *parser_type(Parser *parser)
         }
 
         type = ast_create_generic_inst_type(parser->arena, template_name, type_args, type_arg_count);
+        type->as.generic_inst.name_token = type_start;
     }
 
     while (parser_check(parser, TOKEN_LEFT_BRACKET))
@@ -655,6 +664,51 @@ int parser_is_static_type_name(const char *name, int length)
     return 0;
 }
 
+/* Built-in generic container templates (registered by the type checker).
+ * `var m: map<K, V> = {}` (or `set<T>`, `deque<T>`, `bits`, `channel<T>`, `taskgroup<T>`) parses as an empty struct literal of these. */
+static const char *container_type_names[] = {
+    "map",
+    "set",
+    "deque",
+    "bits",
+    "channel",
+    "taskgroup",
+    NULL
+};
+
+/* Built-in containers without type parameters: a bare `bits` in a type
+ * position is a zero-argument instantiation of the built-in template. */
+static const char *plain_container_type_names[] = {
+    "bits",
+    NULL
+};
+
+int parser_is_container_type_name(const char *name, int length)
+{
+    for (int i = 0; container_type_names[i] != NULL; i++)
+    {
+        if (strlen(container_type_names[i]) == (size_t)length &&
+            strncmp(name, container_type_names[i], length) == 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int parser_is_plain_container_type_name(const char *name, int length)
+{
+    for (int i = 0; plain_container_type_names[i] != NULL; i++)
+    {
+        if (strlen(plain_container_type_names[i]) == (size_t)length &&
+            strncmp(name, plain_container_type_names[i], length) == 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 int parser_check_method_name(Parser *parser)
 {
     /* Allow identifiers as method names */
@@ -665,7 +719,8 @@ int parser_check_method_name(Parser *parser)
     /* Allow type keywords as method names (e.g., obj.int, obj.bool, obj.any, etc.) */
     SnTokenType type = parser->current.type;
     if (type == TOKEN_INT || type == TOKEN_LONG || type == TOKEN_DOUBLE ||
-        type == TOKEN_BOOL || type == TOKEN_BYTE || type == TOKEN_LOCK)
+        type == TOKEN_BOOL || type == TOKEN_BYTE || type == TOKEN_LOCK ||
+        type == TOKEN_ARENA)
     {
         return 1;
     }
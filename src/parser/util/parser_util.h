@@ -40,6 +40,12 @@ ParsedType parser_type_with_size(Parser *parser);
 /* Static type name checking - returns 1 if identifier could be a static type name */
 int parser_is_static_type_name(const char *name, int length);
 
+/* Built-in container template name checking (map, set, ...) - returns 1 on a match */
+int parser_is_container_type_name(const char *name, int length);
+
+/* Built-in containers that take no type arguments (bits) - returns 1 on a match */
+int parser_is_plain_container_type_name(const char *name, int length);
+
 /* Method name checking - returns 1 if current token can be a method name
  * (identifier or type keyword like int, long, double, bool, byte, any) */
 int parser_check_method_name(Parser *parser);
@@ -14,6 +14,7 @@ void parser_init(Arena *arena, Parser *parser, Lexer *lexer, SymbolTable *symbol
     parser->pack_alignment = 0;  /* 0 = default alignment, 1 = packed */
     parser->pending_alias = NULL;  /* No pending alias initially */
     parser->pending_serializable = false;  /* No pending @serializable initially */
+    parser->pending_alignment = 0;  /* No pending @align/@cacheline initially */
     parser->pending_comments = NULL;  /* No pending comments initially */
     parser->pending_comment_count = 0;
     parser->pending_comment_capacity = 0;
@@ -125,7 +125,7 @@ SnArray *sn_array_slice(const SnArray *arr, long long start, long long end)
 
 char *sn_array_join(const SnArray *arr, const char *sep)
 {
-    if (!arr || arr->len == 0) return strdup("");
+    if (!arr || arr->len == 0) return sn_strdup("");
     size_t sep_len = sep ? strlen(sep) : 0;
 
     enum SnElemTag tag = arr->elem_tag;
@@ -186,7 +186,7 @@ char *sn_array_join(const SnArray *arr, const char *sep)
 
 char *sn_array_to_string(const SnArray *arr)
 {
-    if (!arr || arr->len == 0) return strdup("[]");
+    if (!arr || arr->len == 0) return sn_strdup("[]");
 
     size_t buf_size = 256;
     char *result = sn_malloc(buf_size);
@@ -236,7 +236,7 @@ char *sn_array_to_string(const SnArray *arr)
         }
         memcpy(result + off, to_append, el);
         off += el;
-        if (heap_str) free(heap_str);
+        if (heap_str) sn_free(heap_str);
     }
 
     if (off + 2 >= buf_size) { buf_size = off + 2; result = sn_realloc(result, buf_size); }
@@ -244,3 +244,32 @@ char *sn_array_to_string(const SnArray *arr)
     result[off] = '\0';
     return result;
 }
+
+/* Formats one element the way sn_array_to_string does, for the containers
+ * that print like arrays.  Returns a heap string, or NULL after writing
+ * into buf. */
+char *sn_array_elem_str(const void *p, size_t size, enum SnElemTag tag,
+                        char *(*fmt)(const void *), char *buf, size_t buf_size)
+{
+    if (fmt) return fmt(p);
+    if (tag == SN_TAG_ARRAY) return sn_array_to_string(*(SnArray *const *)p);
+    if (tag == SN_TAG_STRING) {
+        const char *s = *(const char *const *)p;
+        size_t sl = s ? strlen(s) : 0;
+        char *out = sn_malloc(sl + 3);
+        out[0] = '"';
+        if (s) memcpy(out + 1, s, sl);
+        out[sl + 1] = '"';
+        out[sl + 2] = '\0';
+        return out;
+    }
+    if (tag == SN_TAG_CHAR) snprintf(buf, buf_size, "'%c'", *(const char *)p);
+    else if (tag == SN_TAG_BOOL) snprintf(buf, buf_size, "%s", *(const bool *)p ? "true" : "false");
+    else if (tag == SN_TAG_DOUBLE && size == 4) snprintf(buf, buf_size, "%g", (double)*(const float *)p);
+    else if (tag == SN_TAG_DOUBLE) snprintf(buf, buf_size, "%g", *(const double *)p);
+    else if (tag == SN_TAG_BYTE) snprintf(buf, buf_size, "0x%02X", (unsigned)*(const unsigned char *)p);
+    else if (tag == SN_TAG_STRUCT) snprintf(buf, buf_size, "<struct>");
+    else if (size == 4) snprintf(buf, buf_size, "%d", *(const int *)p);
+    else snprintf(buf, buf_size, "%lld", *(const long long *)p);
+    return NULL;
+}
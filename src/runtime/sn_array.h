@@ -30,8 +30,8 @@ static inline void sn_cleanup_array(SnArray **p)
                 (*p)->elem_release(elem);
             }
         }
-        free((*p)->data);
-        free(*p);
+        sn_free((*p)->data);
+        sn_free(*p);
     }
 }
 
@@ -44,7 +44,7 @@ static inline void sn_array_free(SnArray *a) { if (a) { sn_cleanup_array(&a); }
 static inline void sn_copy_str(const void *src, void *dst)
 {
     const char *s = *(const char **)src;
-    *(char **)dst = s ? strdup(s) : NULL;
+    *(char **)dst = s ? sn_strdup(s) : NULL;
 }
 
 /* ---- Element copy helper (eliminates repeated if-elem_copy-else-memcpy) ---- */
@@ -92,7 +92,7 @@ static inline void sn_copy_array(const void *src, void *dst)
 /* ---- Byte array to string (needed by __sn___toString) ---- */
 
 static inline char *sn_byte_array_to_string(const SnArray *arr) {
-    if (!arr || arr->len == 0) return strdup("");
+    if (!arr || arr->len == 0) return sn_strdup("");
     char *s = sn_malloc((size_t)arr->len + 1);
     memcpy(s, arr->data, (size_t)arr->len);
     s[arr->len] = '\0';
@@ -194,7 +194,7 @@ static inline void sn_array_reverse(SnArray *arr)
         memcpy(a, b, arr->elem_size);
         memcpy(b, tmp, arr->elem_size);
     }
-    if (tmp != stack_buf) free(tmp);
+    if (tmp != stack_buf) sn_free(tmp);
 }
 #define __sn___reverse(arr_ptr) sn_array_reverse(*(arr_ptr))
 
@@ -257,15 +257,35 @@ static inline void sn_array_insert(SnArray *arr, const void *elem, long long ind
 #define __sn__arr_join(arr_ptr, sep) __sn___join(arr_ptr, sep)
 #define __sn__arr_toString(arr_ptr) __sn___toString(arr_ptr)
 
+/* ---- Vectorized kernels (declared, defined in sn_array_simd.c) ---- */
+
+long long sn_simd_find_u8(const unsigned char *p, long long n, unsigned char v);
+long long sn_simd_find_u64(const uint64_t *p, long long n, uint64_t v);
+long long sn_simd_count_u8(const unsigned char *p, long long n, unsigned char v);
+long long sn_simd_count_u64(const uint64_t *p, long long n, uint64_t v);
+void sn_simd_fill_u64(uint64_t *p, long long n, uint64_t v);
+long long sn_simd_sum_i64(const long long *p, long long n);
+bool sn_simd_sum_i64_checked(const long long *p, long long n, long long *out);
+long long sn_simd_min_i64(const long long *p, long long n);
+long long sn_simd_max_i64(const long long *p, long long n);
+double sn_simd_sum_f64(const double *p, long long n);
+double sn_simd_min_f64(const double *p, long long n);
+double sn_simd_max_f64(const double *p, long long n);
+long long sn_simd_sum_u8(const unsigned char *p, long long n);
+unsigned char sn_simd_min_u8(const unsigned char *p, long long n);
+unsigned char sn_simd_max_u8(const unsigned char *p, long long n);
+long long sn_simd_popcount_u64(const uint64_t *p, long long n);
+void sn_simd_and_u64(uint64_t *d, const uint64_t *a, const uint64_t *b, long long n);
+void sn_simd_or_u64(uint64_t *d, const uint64_t *a, const uint64_t *b, long long n);
+void sn_simd_xor_u64(uint64_t *d, const uint64_t *a, const uint64_t *b, long long n);
+
 /* ---- Array contains / indexOf ---- */
 
+static inline long long sn_array_indexOf(const SnArray *arr, const void *elem);
+
 static inline bool sn_array_contains(const SnArray *arr, const void *elem)
 {
-    for (long long i = 0; i < arr->len; i++) {
-        if (memcmp((char *)arr->data + (size_t)i * arr->elem_size, elem, arr->elem_size) == 0)
-            return true;
-    }
-    return false;
+    return sn_array_indexOf(arr, elem) >= 0;
 }
 static inline bool sn_array_contains_string(const SnArray *arr, const char *s)
 {
@@ -292,6 +312,14 @@ static inline bool sn_array_contains_dispatch(const SnArray *arr, const void *va
 /* indexOf: arr.indexOf(value) */
 static inline long long sn_array_indexOf(const SnArray *arr, const void *elem)
 {
+    /* 8- and 1-byte elements compare bitwise exactly like memcmp */
+    if (arr->elem_size == sizeof(uint64_t)) {
+        uint64_t v;
+        memcpy(&v, elem, sizeof v);
+        return sn_simd_find_u64((const uint64_t *)arr->data, arr->len, v);
+    }
+    if (arr->elem_size == 1)
+        return sn_simd_find_u8((const unsigned char *)arr->data, arr->len, *(const unsigned char *)elem);
     for (long long i = 0; i < arr->len; i++) {
         if (memcmp((char *)arr->data + (size_t)i * arr->elem_size, elem, arr->elem_size) == 0)
             return i;
@@ -320,10 +348,76 @@ static inline long long sn_array_indexOf_dispatch(const SnArray *arr, const void
             default:      (const void *)&(__typeof__(val)){val}), \
         _Generic((val), char *: 1, const char *: 1, default: 0))
 
+/* ---- Primitive array reductions: sum / min / max / count / fill ----
+ * The compiler emits the element-typed macro, e.g. arr.sum() on an int[]
+ * becomes __sn__arr_int_sum(&arr).  min/max panic on an empty array. */
+
+long long sn_array_sum_int_checked(const SnArray *arr);
+long long sn_array_min_int(const SnArray *arr);
+long long sn_array_max_int(const SnArray *arr);
+double sn_array_min_double(const SnArray *arr);
+double sn_array_max_double(const SnArray *arr);
+unsigned char sn_array_min_byte(const SnArray *arr);
+unsigned char sn_array_max_byte(const SnArray *arr);
+
+static inline long long sn_array_count_u64(const SnArray *arr, uint64_t v)
+{
+    return arr ? sn_simd_count_u64((const uint64_t *)arr->data, arr->len, v) : 0;
+}
+static inline long long sn_array_count_u8(const SnArray *arr, unsigned char v)
+{
+    return arr ? sn_simd_count_u8((const unsigned char *)arr->data, arr->len, v) : 0;
+}
+static inline void sn_array_fill_u64(SnArray *arr, uint64_t v)
+{
+    if (arr) sn_simd_fill_u64((uint64_t *)arr->data, arr->len, v);
+}
+static inline void sn_array_fill_u8(SnArray *arr, unsigned char v)
+{
+    if (arr && arr->len > 0) memset(arr->data, v, (size_t)arr->len);
+}
+/* double count/fill compare bit patterns, not values: -0.0 does not match
+ * 0.0, and a NaN matches the same NaN, unlike ==. */
+static inline uint64_t sn_double_bits(double d)
+{
+    uint64_t v;
+    memcpy(&v, &d, sizeof v);
+    return v;
+}
+
+#define __sn__arr_int_sum(arr_ptr) ({ const SnArray *__sa__ = *(arr_ptr); \
+    __sa__ ? sn_simd_sum_i64((const long long *)__sa__->data, __sa__->len) : 0LL; })
+#define __sn__arr_int_sum_checked(arr_ptr) sn_array_sum_int_checked(*(arr_ptr))
+#define __sn__arr_int_min(arr_ptr) sn_array_min_int(*(arr_ptr))
+#define __sn__arr_int_max(arr_ptr) sn_array_max_int(*(arr_ptr))
+#define __sn__arr_int_count(arr_ptr, val) sn_array_count_u64(*(arr_ptr), (uint64_t)(long long)(val))
+#define __sn__arr_int_fill(arr_ptr, val) sn_array_fill_u64(*(arr_ptr), (uint64_t)(long long)(val))
+
+#define __sn__arr_double_sum(arr_ptr) ({ const SnArray *__sa__ = *(arr_ptr); \
+    __sa__ ? sn_simd_sum_f64((const double *)__sa__->data, __sa__->len) : 0.0; })
+#define __sn__arr_double_min(arr_ptr) sn_array_min_double(*(arr_ptr))
+#define __sn__arr_double_max(arr_ptr) sn_array_max_double(*(arr_ptr))
+#define __sn__arr_double_count(arr_ptr, val) sn_array_count_u64(*(arr_ptr), sn_double_bits(val))
+#define __sn__arr_double_fill(arr_ptr, val) sn_array_fill_u64(*(arr_ptr), sn_double_bits(val))
+
+#define __sn__arr_byte_sum(arr_ptr) ({ const SnArray *__sa__ = *(arr_ptr); \
+    __sa__ ? sn_simd_sum_u8((const unsigned char *)__sa__->data, __sa__->len) : 0LL; })
+#define __sn__arr_byte_min(arr_ptr) sn_array_min_byte(*(arr_ptr))
+#define __sn__arr_byte_max(arr_ptr) sn_array_max_byte(*(arr_ptr))
+#define __sn__arr_byte_count(arr_ptr, val) sn_array_count_u8(*(arr_ptr), (unsigned char)(val))
+#define __sn__arr_byte_fill(arr_ptr, val) sn_array_fill_u8(*(arr_ptr), (unsigned char)(val))
+
+#define __sn__arr_bool_count(arr_ptr, val) sn_array_count_u8(*(arr_ptr), (unsigned char)((val) ? 1 : 0))
+#define __sn__arr_bool_fill(arr_ptr, val) sn_array_fill_u8(*(arr_ptr), (unsigned char)((val) ? 1 : 0))
+
 /* ---- Array join / toString (declared, defined in sn_array.c) ---- */
 
 char *sn_array_join(const SnArray *arr, const char *sep);
 char *sn_array_to_string(const SnArray *arr);
+/* One element as sn_array_to_string prints it: a heap string, or NULL
+ * after writing into buf.  fmt, when set, formats struct elements. */
+char *sn_array_elem_str(const void *p, size_t size, enum SnElemTag tag,
+                        char *(*fmt)(const void *), char *buf, size_t buf_size);
 
 #define __sn___join(arr_ptr, sep) sn_array_join(*(arr_ptr), (sep))
 
@@ -334,6 +428,6 @@ char *sn_array_to_string(const SnArray *arr);
     size_t __jl__ = __j__ ? strlen(__j__) : 0; \
     char *__s__ = sn_malloc(__jl__ + 3); \
     __s__[0] = '['; if (__j__) memcpy(__s__ + 1, __j__, __jl__); \
-    __s__[__jl__ + 1] = ']'; __s__[__jl__ + 2] = '\0'; free(__j__); __s__; }); })
+    __s__[__jl__ + 1] = ']'; __s__[__jl__ + 2] = '\0'; sn_free(__j__); __s__; }); })
 
 #endif
@@ -0,0 +1,710 @@
+#include "sn_array.h"
+#include "sn_core.h"
+
+/*
+ * Vectorized kernels for primitive arrays (int/long, double, byte, bool).
+ *
+ * On x86-64 every kernel has an SSE2 body (always available) and, where it
+ * pays off, an AVX2 body compiled with a target attribute.  The AVX2 bodies
+ * are selected once at load time via __builtin_cpu_supports.  Other targets
+ * use the scalar bodies.
+ *
+ * Integer results are exact and therefore identical on every path.  Double
+ * reductions always use four lanes (lane j takes elements i % 4 == j) which
+ * are folded in a fixed order, so sum/min/max of a double[] give the same
+ * bits whichever path runs.
+ */
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SN_SIMD_X86 1
+#include <immintrin.h>
+#define SN_AVX2 __attribute__((target("avx2,popcnt")))
+#else
+#define SN_SIMD_X86 0
+#endif
+
+/* Elements per overflow check in the checked integer sum */
+#define SN_SIMD_SUM_BLOCK 256
+
+/* ---- CPU dispatch ---- */
+
+#if SN_SIMD_X86
+static bool sn_simd_avx2 = false;
+
+__attribute__((constructor))
+static void sn_simd_init(void)
+{
+    __builtin_cpu_init();
+    sn_simd_avx2 = __builtin_cpu_supports("avx2");
+}
+
+/* SSE2 has no 64-bit compare: AND each 32-bit half with its neighbour */
+static inline __m128i sn_sse2_cmpeq_epi64(__m128i a, __m128i b)
+{
+    __m128i eq = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+#endif
+
+/* ---- find ---- */
+
+long long sn_simd_find_u8(const unsigned char *p, long long n, unsigned char v)
+{
+    /* libc memchr is already vectorized and CPU-dispatched */
+    if (n <= 0) return -1;
+    const unsigned char *hit = memchr(p, v, (size_t)n);
+    return hit ? (long long)(hit - p) : -1;
+}
+
+#if SN_SIMD_X86
+SN_AVX2 static long long find_u64_avx2(const uint64_t *p, long long n, uint64_t v)
+{
+    __m256i needle = _mm256_set1_epi64x((long long)v);
+    long long i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i a = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(p + i)), needle);
+        __m256i b = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(p + i + 4)), needle);
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(a))
+                 | (_mm256_movemask_pd(_mm256_castsi256_pd(b)) << 4);
+        if (mask) return i + __builtin_ctz((unsigned)mask);
+    }
+    for (; i < n; i++)
+        if (p[i] == v) return i;
+    return -1;
+}
+
+static long long find_u64_sse2(const uint64_t *p, long long n, uint64_t v)
+{
+    __m128i needle = _mm_set1_epi64x((long long)v);
+    long long i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i a = sn_sse2_cmpeq_epi64(_mm_loadu_si128((const __m128i *)(p + i)), needle);
+        __m128i b = sn_sse2_cmpeq_epi64(_mm_loadu_si128((const __m128i *)(p + i + 2)), needle);
+        int mask = _mm_movemask_pd(_mm_castsi128_pd(a))
+                 | (_mm_movemask_pd(_mm_castsi128_pd(b)) << 2);
+        if (mask) return i + __builtin_ctz((unsigned)mask);
+    }
+    for (; i < n; i++)
+        if (p[i] == v) return i;
+    return -1;
+}
+#endif
+
+long long sn_simd_find_u64(const uint64_t *p, long long n, uint64_t v)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return find_u64_avx2(p, n, v);
+    return find_u64_sse2(p, n, v);
+#else
+    for (long long i = 0; i < n; i++)
+        if (p[i] == v) return i;
+    return -1;
+#endif
+}
+
+/* ---- count ---- */
+
+#if SN_SIMD_X86
+SN_AVX2 static long long count_u8_avx2(const unsigned char *p, long long n, unsigned char v)
+{
+    __m256i needle = _mm256_set1_epi8((char)v);
+    long long i = 0, count = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p + i)), needle);
+        count += __builtin_popcount((unsigned)_mm256_movemask_epi8(eq));
+    }
+    for (; i < n; i++)
+        count += p[i] == v;
+    return count;
+}
+
+static long long count_u8_sse2(const unsigned char *p, long long n, unsigned char v)
+{
+    __m128i needle = _mm_set1_epi8((char)v);
+    long long i = 0, count = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + i)), needle);
+        count += __builtin_popcount((unsigned)_mm_movemask_epi8(eq));
+    }
+    for (; i < n; i++)
+        count += p[i] == v;
+    return count;
+}
+
+SN_AVX2 static long long count_u64_avx2(const uint64_t *p, long long n, uint64_t v)
+{
+    /* Matching lanes compare to -1, so subtracting counts them */
+    __m256i needle = _mm256_set1_epi64x((long long)v);
+    __m256i acc = _mm256_setzero_si256();
+    long long i = 0;
+    for (; i + 4 <= n; i += 4)
+        acc = _mm256_sub_epi64(acc, _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(p + i)), needle));
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    long long count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; i++)
+        count += p[i] == v;
+    return count;
+}
+
+static long long count_u64_sse2(const uint64_t *p, long long n, uint64_t v)
+{
+    __m128i needle = _mm_set1_epi64x((long long)v);
+    __m128i acc = _mm_setzero_si128();
+    long long i = 0;
+    for (; i + 2 <= n; i += 2)
+        acc = _mm_sub_epi64(acc, sn_sse2_cmpeq_epi64(_mm_loadu_si128((const __m128i *)(p + i)), needle));
+    long long lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    long long count = lanes[0] + lanes[1];
+    for (; i < n; i++)
+        count += p[i] == v;
+    return count;
+}
+#endif
+
+long long sn_simd_count_u8(const unsigned char *p, long long n, unsigned char v)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return count_u8_avx2(p, n, v);
+    return count_u8_sse2(p, n, v);
+#else
+    long long count = 0;
+    for (long long i = 0; i < n; i++)
+        count += p[i] == v;
+    return count;
+#endif
+}
+
+long long sn_simd_count_u64(const uint64_t *p, long long n, uint64_t v)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return count_u64_avx2(p, n, v);
+    return count_u64_sse2(p, n, v);
+#else
+    long long count = 0;
+    for (long long i = 0; i < n; i++)
+        count += p[i] == v;
+    return count;
+#endif
+}
+
+/* ---- fill ---- */
+
+void sn_simd_fill_u64(uint64_t *p, long long n, uint64_t v)
+{
+    long long i = 0;
+#if SN_SIMD_X86
+    /* Store-bound: two SSE2 stores per iteration already saturate bandwidth */
+    __m128i x = _mm_set1_epi64x((long long)v);
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_si128((__m128i *)(p + i), x);
+        _mm_storeu_si128((__m128i *)(p + i + 2), x);
+    }
+#endif
+    for (; i < n; i++)
+        p[i] = v;
+}
+
+/* ---- bit words (bits type) ---- */
+
+#if SN_SIMD_X86
+/* Plain popcnt per word: four independent chains hide its 3-cycle latency */
+SN_AVX2 static long long popcount_u64_popcnt(const uint64_t *p, long long n)
+{
+    long long c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    long long i = 0;
+    for (; i + 4 <= n; i += 4) {
+        c0 += __builtin_popcountll(p[i]);
+        c1 += __builtin_popcountll(p[i + 1]);
+        c2 += __builtin_popcountll(p[i + 2]);
+        c3 += __builtin_popcountll(p[i + 3]);
+    }
+    for (; i < n; i++)
+        c0 += __builtin_popcountll(p[i]);
+    return c0 + c1 + c2 + c3;
+}
+#endif
+
+long long sn_simd_popcount_u64(const uint64_t *p, long long n)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return popcount_u64_popcnt(p, n);
+#endif
+    long long count = 0;
+    for (long long i = 0; i < n; i++)
+        count += __builtin_popcountll(p[i]);
+    return count;
+}
+
+#if SN_SIMD_X86
+#define SN_SIMD_BITOP(name, avx_op, sse_op, c_op)                                       \
+SN_AVX2 static void name##_u64_avx2(uint64_t *d, const uint64_t *a, const uint64_t *b,  \
+                                    long long n)                                        \
+{                                                                                       \
+    long long i = 0;                                                                    \
+    for (; i + 4 <= n; i += 4)                                                          \
+        _mm256_storeu_si256((__m256i *)(d + i),                                         \
+            avx_op(_mm256_loadu_si256((const __m256i *)(a + i)),                        \
+                   _mm256_loadu_si256((const __m256i *)(b + i))));                      \
+    for (; i < n; i++)                                                                  \
+        d[i] = a[i] c_op b[i];                                                          \
+}                                                                                       \
+static void name##_u64_sse2(uint64_t *d, const uint64_t *a, const uint64_t *b,          \
+                            long long n)                                                \
+{                                                                                       \
+    long long i = 0;                                                                    \
+    for (; i + 2 <= n; i += 2)                                                          \
+        _mm_storeu_si128((__m128i *)(d + i),                                            \
+            sse_op(_mm_loadu_si128((const __m128i *)(a + i)),                           \
+                   _mm_loadu_si128((const __m128i *)(b + i))));                         \
+    for (; i < n; i++)                                                                  \
+        d[i] = a[i] c_op b[i];                                                          \
+}                                                                                       \
+void sn_simd_##name##_u64(uint64_t *d, const uint64_t *a, const uint64_t *b, long long n) \
+{                                                                                       \
+    if (sn_simd_avx2) name##_u64_avx2(d, a, b, n);                                      \
+    else name##_u64_sse2(d, a, b, n);                                                   \
+}
+#else
+#define SN_SIMD_BITOP(name, avx_op, sse_op, c_op)                                       \
+void sn_simd_##name##_u64(uint64_t *d, const uint64_t *a, const uint64_t *b, long long n) \
+{                                                                                       \
+    for (long long i = 0; i < n; i++)                                                   \
+        d[i] = a[i] c_op b[i];                                                          \
+}
+#endif
+
+SN_SIMD_BITOP(and, _mm256_and_si256, _mm_and_si128, &)
+SN_SIMD_BITOP(or, _mm256_or_si256, _mm_or_si128, |)
+SN_SIMD_BITOP(xor, _mm256_xor_si256, _mm_xor_si128, ^)
+
+/* ---- int sum ---- */
+
+#if SN_SIMD_X86
+SN_AVX2 static long long sum_i64_avx2(const long long *p, long long n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    long long i = 0;
+    for (; i + 4 <= n; i += 4)
+        acc = _mm256_add_epi64(acc, _mm256_loadu_si256((const __m256i *)(p + i)));
+    unsigned long long lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    unsigned long long sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; i++)
+        sum += (unsigned long long)p[i];
+    return (long long)sum;
+}
+
+static long long sum_i64_sse2(const long long *p, long long n)
+{
+    __m128i acc0 = _mm_setzero_si128(), acc1 = _mm_setzero_si128();
+    long long i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc0 = _mm_add_epi64(acc0, _mm_loadu_si128((const __m128i *)(p + i)));
+        acc1 = _mm_add_epi64(acc1, _mm_loadu_si128((const __m128i *)(p + i + 2)));
+    }
+    unsigned long long lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(acc0, acc1));
+    unsigned long long sum = lanes[0] + lanes[1];
+    for (; i < n; i++)
+        sum += (unsigned long long)p[i];
+    return (long long)sum;
+}
+#endif
+
+long long sn_simd_sum_i64(const long long *p, long long n)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return sum_i64_avx2(p, n);
+    return sum_i64_sse2(p, n);
+#else
+    unsigned long long sum = 0;
+    for (long long i = 0; i < n; i++)
+        sum += (unsigned long long)p[i];
+    return (long long)sum;
+#endif
+}
+
+/*
+ * Checked sum.  Each block is summed in wrapping lanes while the lane
+ * overflow bits ((s ^ s') & (x ^ s')) are OR-ed together; the block is only
+ * folded into the running total when no lane overflowed.  Any overflow sends
+ * us to the exact path, so the caller only sees an error when the true
+ * mathematical sum does not fit in 64 bits.
+ */
+
+static bool sum_i64_exact(const long long *p, long long n, long long *out)
+{
+#ifdef __SIZEOF_INT128__
+    __int128 sum = 0;
+    for (long long i = 0; i < n; i++)
+        sum += p[i];
+    if (sum > INT64_MAX || sum < INT64_MIN) return false;
+    *out = (long long)sum;
+    return true;
+#else
+    long long sum = 0;
+    for (long long i = 0; i < n; i++)
+        if (__builtin_add_overflow(sum, p[i], &sum)) return false;
+    *out = sum;
+    return true;
+#endif
+}
+
+#if SN_SIMD_X86
+SN_AVX2 static bool sum_i64_checked_avx2(const long long *p, long long n, long long *out)
+{
+    long long total = 0, i = 0;
+    for (; i + SN_SIMD_SUM_BLOCK <= n; i += SN_SIMD_SUM_BLOCK) {
+        __m256i acc = _mm256_setzero_si256(), ovf = _mm256_setzero_si256();
+        for (long long j = i; j < i + SN_SIMD_SUM_BLOCK; j += 4) {
+            __m256i x = _mm256_loadu_si256((const __m256i *)(p + j));
+            __m256i s = _mm256_add_epi64(acc, x);
+            ovf = _mm256_or_si256(ovf, _mm256_and_si256(_mm256_xor_si256(acc, s), _mm256_xor_si256(x, s)));
+            acc = s;
+        }
+        if (_mm256_movemask_pd(_mm256_castsi256_pd(ovf))) return sum_i64_exact(p, n, out);
+        long long lanes[4], block;
+        _mm256_storeu_si256((__m256i *)lanes, acc);
+        if (__builtin_add_overflow(lanes[0], lanes[1], &block) ||
+            __builtin_add_overflow(block, lanes[2], &block) ||
+            __builtin_add_overflow(block, lanes[3], &block) ||
+            __builtin_add_overflow(total, block, &total))
+            return sum_i64_exact(p, n, out);
+    }
+    for (; i < n; i++)
+        if (__builtin_add_overflow(total, p[i], &total)) return sum_i64_exact(p, n, out);
+    *out = total;
+    return true;
+}
+
+static bool sum_i64_checked_sse2(const long long *p, long long n, long long *out)
+{
+    long long total = 0, i = 0;
+    for (; i + SN_SIMD_SUM_BLOCK <= n; i += SN_SIMD_SUM_BLOCK) {
+        __m128i acc = _mm_setzero_si128(), ovf = _mm_setzero_si128();
+        for (long long j = i; j < i + SN_SIMD_SUM_BLOCK; j += 2) {
+            __m128i x = _mm_loadu_si128((const __m128i *)(p + j));
+            __m128i s = _mm_add_epi64(acc, x);
+            ovf = _mm_or_si128(ovf, _mm_and_si128(_mm_xor_si128(acc, s), _mm_xor_si128(x, s)));
+            acc = s;
+        }
+        if (_mm_movemask_pd(_mm_castsi128_pd(ovf))) return sum_i64_exact(p, n, out);
+        long long lanes[2], block;
+        _mm_storeu_si128((__m128i *)lanes, acc);
+        if (__builtin_add_overflow(lanes[0], lanes[1], &block) ||
+            __builtin_add_overflow(total, block, &total))
+            return sum_i64_exact(p, n, out);
+    }
+    for (; i < n; i++)
+        if (__builtin_add_overflow(total, p[i], &total)) return sum_i64_exact(p, n, out);
+    *out = total;
+    return true;
+}
+#endif
+
+bool sn_simd_sum_i64_checked(const long long *p, long long n, long long *out)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return sum_i64_checked_avx2(p, n, out);
+    return sum_i64_checked_sse2(p, n, out);
+#else
+    return sum_i64_exact(p, n, out);
+#endif
+}
+
+/* ---- int min / max ---- */
+
+#if SN_SIMD_X86
+SN_AVX2 static long long minmax_i64_avx2(const long long *p, long long n, bool want_max)
+{
+    __m256i m = _mm256_set1_epi64x(p[0]);
+    long long i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(p + i));
+        __m256i take = want_max ? _mm256_cmpgt_epi64(x, m) : _mm256_cmpgt_epi64(m, x);
+        m = _mm256_blendv_epi8(m, x, take);
+    }
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, m);
+    long long r = lanes[0];
+    for (int k = 1; k < 4; k++)
+        if (want_max ? lanes[k] > r : lanes[k] < r) r = lanes[k];
+    for (; i < n; i++)
+        if (want_max ? p[i] > r : p[i] < r) r = p[i];
+    return r;
+}
+#endif
+
+/* SSE2 lacks a 64-bit signed compare; the scalar loop is what it would emulate */
+static long long minmax_i64_scalar(const long long *p, long long n, bool want_max)
+{
+    long long r = p[0];
+    for (long long i = 1; i < n; i++)
+        if (want_max ? p[i] > r : p[i] < r) r = p[i];
+    return r;
+}
+
+long long sn_simd_min_i64(const long long *p, long long n)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return minmax_i64_avx2(p, n, false);
+#endif
+    return minmax_i64_scalar(p, n, false);
+}
+
+long long sn_simd_max_i64(const long long *p, long long n)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return minmax_i64_avx2(p, n, true);
+#endif
+    return minmax_i64_scalar(p, n, true);
+}
+
+/* ---- double sum / min / max ----
+ * min/max follow the MINPD rule (x < m ? x : m), so a NaN element is
+ * skipped unless it is the first one. */
+
+#define SN_F64_MIN(x, m) ((x) < (m) ? (x) : (m))
+#define SN_F64_MAX(x, m) ((x) > (m) ? (x) : (m))
+
+static double fold_f64(const double lanes[4], const double *tail, long long tail_n, int op)
+{
+    double r;
+    if (op == 0) {
+        r = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        for (long long i = 0; i < tail_n; i++) r += tail[i];
+    } else {
+        r = lanes[0];
+        for (int k = 1; k < 4; k++) r = op < 0 ? SN_F64_MIN(lanes[k], r) : SN_F64_MAX(lanes[k], r);
+        for (long long i = 0; i < tail_n; i++) r = op < 0 ? SN_F64_MIN(tail[i], r) : SN_F64_MAX(tail[i], r);
+    }
+    return r;
+}
+
+/* op: 0 = sum, -1 = min, 1 = max */
+#if SN_SIMD_X86
+SN_AVX2 static double reduce_f64_avx2(const double *p, long long n, int op)
+{
+    __m256d acc = op == 0 ? _mm256_setzero_pd() : _mm256_set1_pd(p[0]);
+    long long i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(p + i);
+        acc = op == 0 ? _mm256_add_pd(acc, x) : op < 0 ? _mm256_min_pd(x, acc) : _mm256_max_pd(x, acc);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    return fold_f64(lanes, p + i, n - i, op);
+}
+
+static double reduce_f64_sse2(const double *p, long long n, int op)
+{
+    __m128d lo = op == 0 ? _mm_setzero_pd() : _mm_set1_pd(p[0]);
+    __m128d hi = lo;
+    long long i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128d a = _mm_loadu_pd(p + i), b = _mm_loadu_pd(p + i + 2);
+        if (op == 0)     { lo = _mm_add_pd(lo, a); hi = _mm_add_pd(hi, b); }
+        else if (op < 0) { lo = _mm_min_pd(a, lo); hi = _mm_min_pd(b, hi); }
+        else             { lo = _mm_max_pd(a, lo); hi = _mm_max_pd(b, hi); }
+    }
+    double lanes[4];
+    _mm_storeu_pd(lanes, lo);
+    _mm_storeu_pd(lanes + 2, hi);
+    return fold_f64(lanes, p + i, n - i, op);
+}
+#else
+static double reduce_f64_scalar(const double *p, long long n, int op)
+{
+    double lanes[4];
+    for (int k = 0; k < 4; k++) lanes[k] = op == 0 ? 0.0 : p[0];
+    long long i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (int k = 0; k < 4; k++) {
+            double x = p[i + k];
+            lanes[k] = op == 0 ? lanes[k] + x : op < 0 ? SN_F64_MIN(x, lanes[k]) : SN_F64_MAX(x, lanes[k]);
+        }
+    }
+    return fold_f64(lanes, p + i, n - i, op);
+}
+#endif
+
+static double reduce_f64(const double *p, long long n, int op)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return reduce_f64_avx2(p, n, op);
+    return reduce_f64_sse2(p, n, op);
+#else
+    return reduce_f64_scalar(p, n, op);
+#endif
+}
+
+double sn_simd_sum_f64(const double *p, long long n) { return reduce_f64(p, n, 0); }
+double sn_simd_min_f64(const double *p, long long n) { return reduce_f64(p, n, -1); }
+double sn_simd_max_f64(const double *p, long long n) { return reduce_f64(p, n, 1); }
+
+/* ---- byte sum / min / max ---- */
+
+#if SN_SIMD_X86
+SN_AVX2 static long long sum_u8_avx2(const unsigned char *p, long long n)
+{
+    /* SAD against zero adds each group of 8 bytes into a 64-bit lane */
+    __m256i acc = _mm256_setzero_si256(), zero = _mm256_setzero_si256();
+    long long i = 0;
+    for (; i + 32 <= n; i += 32)
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i *)(p + i)), zero));
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    long long sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; i++)
+        sum += p[i];
+    return sum;
+}
+
+static long long sum_u8_sse2(const unsigned char *p, long long n)
+{
+    __m128i acc = _mm_setzero_si128(), zero = _mm_setzero_si128();
+    long long i = 0;
+    for (; i + 16 <= n; i += 16)
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_loadu_si128((const __m128i *)(p + i)), zero));
+    long long lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    long long sum = lanes[0] + lanes[1];
+    for (; i < n; i++)
+        sum += p[i];
+    return sum;
+}
+
+SN_AVX2 static unsigned char minmax_u8_avx2(const unsigned char *p, long long n, bool want_max)
+{
+    __m256i m = _mm256_set1_epi8((char)p[0]);
+    long long i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(p + i));
+        m = want_max ? _mm256_max_epu8(m, x) : _mm256_min_epu8(m, x);
+    }
+    unsigned char lanes[32];
+    _mm256_storeu_si256((__m256i *)lanes, m);
+    unsigned char r = lanes[0];
+    for (int k = 1; k < 32; k++)
+        if (want_max ? lanes[k] > r : lanes[k] < r) r = lanes[k];
+    for (; i < n; i++)
+        if (want_max ? p[i] > r : p[i] < r) r = p[i];
+    return r;
+}
+
+static unsigned char minmax_u8_sse2(const unsigned char *p, long long n, bool want_max)
+{
+    __m128i m = _mm_set1_epi8((char)p[0]);
+    long long i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(p + i));
+        m = want_max ? _mm_max_epu8(m, x) : _mm_min_epu8(m, x);
+    }
+    unsigned char lanes[16];
+    _mm_storeu_si128((__m128i *)lanes, m);
+    unsigned char r = lanes[0];
+    for (int k = 1; k < 16; k++)
+        if (want_max ? lanes[k] > r : lanes[k] < r) r = lanes[k];
+    for (; i < n; i++)
+        if (want_max ? p[i] > r : p[i] < r) r = p[i];
+    return r;
+}
+#else
+static unsigned char minmax_u8_scalar(const unsigned char *p, long long n, bool want_max)
+{
+    unsigned char r = p[0];
+    for (long long i = 1; i < n; i++)
+        if (want_max ? p[i] > r : p[i] < r) r = p[i];
+    return r;
+}
+#endif
+
+long long sn_simd_sum_u8(const unsigned char *p, long long n)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return sum_u8_avx2(p, n);
+    return sum_u8_sse2(p, n);
+#else
+    long long sum = 0;
+    for (long long i = 0; i < n; i++)
+        sum += p[i];
+    return sum;
+#endif
+}
+
+unsigned char sn_simd_min_u8(const unsigned char *p, long long n)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return minmax_u8_avx2(p, n, false);
+    return minmax_u8_sse2(p, n, false);
+#else
+    return minmax_u8_scalar(p, n, false);
+#endif
+}
+
+unsigned char sn_simd_max_u8(const unsigned char *p, long long n)
+{
+#if SN_SIMD_X86
+    if (sn_simd_avx2) return minmax_u8_avx2(p, n, true);
+    return minmax_u8_sse2(p, n, true);
+#else
+    return minmax_u8_scalar(p, n, true);
+#endif
+}
+
+/* ---- Array-level reductions ---- */
+
+static void sn_array_require_nonempty(const SnArray *arr, const char *op)
+{
+    if (!arr || arr->len == 0) {
+        char what[64];
+        snprintf(what, sizeof what, "%s() of empty array", op);
+        sn_panic(what);
+    }
+}
+
+long long sn_array_sum_int_checked(const SnArray *arr)
+{
+    long long sum = 0;
+    if (arr && !sn_simd_sum_i64_checked((const long long *)arr->data, arr->len, &sum))
+        sn_panic("integer overflow in addition");
+    return sum;
+}
+
+long long sn_array_min_int(const SnArray *arr)
+{
+    sn_array_require_nonempty(arr, "min");
+    return sn_simd_min_i64((const long long *)arr->data, arr->len);
+}
+
+long long sn_array_max_int(const SnArray *arr)
+{
+    sn_array_require_nonempty(arr, "max");
+    return sn_simd_max_i64((const long long *)arr->data, arr->len);
+}
+
+double sn_array_min_double(const SnArray *arr)
+{
+    sn_array_require_nonempty(arr, "min");
+    return sn_simd_min_f64((const double *)arr->data, arr->len);
+}
+
+double sn_array_max_double(const SnArray *arr)
+{
+    sn_array_require_nonempty(arr, "max");
+    return sn_simd_max_f64((const double *)arr->data, arr->len);
+}
+
+unsigned char sn_array_min_byte(const SnArray *arr)
+{
+    sn_array_require_nonempty(arr, "min");
+    return sn_simd_min_u8((const unsigned char *)arr->data, arr->len);
+}
+
+unsigned char sn_array_max_byte(const SnArray *arr)
+{
+    sn_array_require_nonempty(arr, "max");
+    return sn_simd_max_u8((const unsigned char *)arr->data, arr->len);
+}
@@ -0,0 +1,138 @@
+#include "sn_bits.h"
+
+static inline long long sn_bits_words(long long len)
+{
+    return (len + 63) >> 6;
+}
+
+static void sn_bits_reserve(SnBits *b, long long words)
+{
+    if (words <= b->cap_words) return;
+    long long cap = b->cap_words ? b->cap_words * 2 : 1;
+    if (cap < words) cap = words;
+    b->words = sn_realloc(b->words, (size_t)cap * sizeof(uint64_t));
+    memset(b->words + b->cap_words, 0, (size_t)(cap - b->cap_words) * sizeof(uint64_t));
+    b->cap_words = cap;
+}
+
+/* Clear the bits past len in the last word (keeps the class invariant) */
+static void sn_bits_trim(SnBits *b)
+{
+    if (b->len & 63) b->words[b->len >> 6] &= (1ULL << (b->len & 63)) - 1;
+}
+
+void sn_bits_index_panic(long long index, long long len)
+{
+    fprintf(stderr, "panic: bits index %lld out of range (length %lld)\n", index, len);
+    exit(1);
+}
+
+SnBits *sn_bits_new(long long len)
+{
+    if (len < 0) len = 0;
+    SnBits *b = sn_calloc(1, sizeof(SnBits));
+    b->__rc__ = 1;
+    sn_bits_reserve(b, sn_bits_words(len));
+    b->len = len;
+    return b;
+}
+
+void sn_bits_free(SnBits *b)
+{
+    if (!b) return;
+    sn_free(b->words);
+    sn_free(b);
+}
+
+SnBits *sn_bits_clone(const SnBits *b)
+{
+    SnBits *c = sn_bits_new(b->len);
+    if (b->len) memcpy(c->words, b->words, (size_t)sn_bits_words(b->len) * sizeof(uint64_t));
+    return c;
+}
+
+void sn_bits_push(SnBits *b, bool value)
+{
+    sn_bits_reserve(b, sn_bits_words(b->len + 1));
+    if (value) b->words[b->len >> 6] |= 1ULL << (b->len & 63);
+    b->len++;
+}
+
+void sn_bits_resize(SnBits *b, long long len)
+{
+    if (len < 0) len = 0;
+    long long old_words = sn_bits_words(b->len);
+    long long words = sn_bits_words(len);
+    sn_bits_reserve(b, words);
+    if (len < b->len) {
+        /* Zero the dropped whole words; trim clears the partial one */
+        if (old_words > words)
+            memset(b->words + words, 0, (size_t)(old_words - words) * sizeof(uint64_t));
+        b->len = len;
+        sn_bits_trim(b);
+    } else {
+        b->len = len;
+    }
+}
+
+void sn_bits_fill(SnBits *b, bool value)
+{
+    long long n = sn_bits_words(b->len);
+    if (n == 0) return;
+    sn_simd_fill_u64(b->words, n, value ? ~0ULL : 0);
+    sn_bits_trim(b);
+}
+
+long long sn_bits_count(const SnBits *b)
+{
+    return sn_simd_popcount_u64(b->words, sn_bits_words(b->len));
+}
+
+static SnBits *sn_bits_combine(const SnBits *a, const SnBits *b,
+                               void (*op)(uint64_t *, const uint64_t *, const uint64_t *, long long),
+                               bool keep_tail)
+{
+    const SnBits *longer = a->len >= b->len ? a : b;
+    long long shared = sn_bits_words(a->len < b->len ? a->len : b->len);
+    long long total = sn_bits_words(longer->len);
+    SnBits *r = sn_bits_new(longer->len);
+    op(r->words, a->words, b->words, shared);
+    /* Past the shorter operand: x & 0 == 0, x | 0 == x ^ 0 == x */
+    if (keep_tail && total > shared)
+        memcpy(r->words + shared, longer->words + shared, (size_t)(total - shared) * sizeof(uint64_t));
+    return r;
+}
+
+SnBits *sn_bits_and(const SnBits *a, const SnBits *b) { return sn_bits_combine(a, b, sn_simd_and_u64, false); }
+SnBits *sn_bits_or(const SnBits *a, const SnBits *b) { return sn_bits_combine(a, b, sn_simd_or_u64, true); }
+SnBits *sn_bits_xor(const SnBits *a, const SnBits *b) { return sn_bits_combine(a, b, sn_simd_xor_u64, true); }
+
+SnArray *sn_bits_to_array(const SnBits *b)
+{
+    SnArray *arr = sn_array_new(sizeof(bool), b->len);
+    arr->elem_tag = SN_TAG_BOOL;
+    bool *out = arr->data;
+    for (long long i = 0; i < b->len; i++)
+        out[i] = (b->words[i >> 6] >> (i & 63)) & 1;
+    arr->len = b->len;
+    return arr;
+}
+
+char *sn_bits_to_string(const SnBits *b)
+{
+    if (!b || b->len == 0) return sn_strdup("[]");
+    /* "[" + "false, " per bit at most + "]" */
+    char *result = sn_malloc((size_t)b->len * 7 + 2);
+    size_t off = 0;
+    result[off++] = '[';
+    for (long long i = 0; i < b->len; i++) {
+        if (i > 0) { result[off++] = ','; result[off++] = ' '; }
+        const char *s = ((b->words[i >> 6] >> (i & 63)) & 1) ? "true" : "false";
+        size_t len = strlen(s);
+        memcpy(result + off, s, len);
+        off += len;
+    }
+    result[off++] = ']';
+    result[off] = '\0';
+    return result;
+}
@@ -0,0 +1,62 @@
+#ifndef SN_BITS_H
+#define SN_BITS_H
+
+#include "sn_array.h"
+
+/*
+ * Built-in bits: a growable bool sequence packed 64 per word.
+ *
+ * Bit i is (words[i >> 6] >> (i & 63)) & 1.  Bits at positions >= len in the
+ * last word are always zero, so count() is a plain popcount over the words
+ * and the word-wise and/or/xor never leak stale bits into the result.
+ */
+
+typedef struct {
+    int __rc__;                 /* must stay first: generated as-ref code reads it */
+    uint64_t *words;
+    long long len;              /* number of bits */
+    long long cap_words;
+} SnBits;
+
+SnBits *sn_bits_new(long long len);         /* len bits, all false */
+void sn_bits_free(SnBits *b);
+SnBits *sn_bits_clone(const SnBits *b);
+void sn_bits_push(SnBits *b, bool value);
+void sn_bits_resize(SnBits *b, long long len);   /* new bits are false */
+void sn_bits_fill(SnBits *b, bool value);
+long long sn_bits_count(const SnBits *b);
+
+/* Word-wise operations; the result is as long as the longer operand, with
+ * missing bits of the shorter one read as false. */
+SnBits *sn_bits_and(const SnBits *a, const SnBits *b);
+SnBits *sn_bits_or(const SnBits *a, const SnBits *b);
+SnBits *sn_bits_xor(const SnBits *a, const SnBits *b);
+
+SnArray *sn_bits_to_array(const SnBits *b);
+char *sn_bits_to_string(const SnBits *b);  /* same output as a bool[] */
+
+void sn_bits_index_panic(long long index, long long len);
+
+/* Negative indices count from the end, like arrays */
+static inline long long sn_bits_index(const SnBits *b, long long index)
+{
+    long long i = index < 0 ? index + b->len : index;
+    if (i < 0 || i >= b->len) sn_bits_index_panic(index, b->len);
+    return i;
+}
+
+static inline bool sn_bits_get(const SnBits *b, long long index)
+{
+    long long i = sn_bits_index(b, index);
+    return (b->words[i >> 6] >> (i & 63)) & 1;
+}
+
+static inline void sn_bits_set(SnBits *b, long long index, bool value)
+{
+    long long i = sn_bits_index(b, index);
+    uint64_t mask = 1ULL << (i & 63);
+    if (value) b->words[i >> 6] |= mask;
+    else b->words[i >> 6] &= ~mask;
+}
+
+#endif
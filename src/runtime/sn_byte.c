@@ -5,7 +5,7 @@
 char *sn_byte_array_to_hex(const SnArray *arr)
 {
     static const char hex_chars[] = "0123456789abcdef";
-    if (!arr || arr->len == 0) return strdup("");
+    if (!arr || arr->len == 0) return sn_strdup("");
     size_t len = (size_t)arr->len * 2;
     char *result = sn_malloc(len + 1);
     const unsigned char *data = (const unsigned char *)arr->data;
@@ -20,7 +20,7 @@ char *sn_byte_array_to_hex(const SnArray *arr)
 char *sn_byte_array_to_base64(const SnArray *arr)
 {
     static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-    if (!arr || arr->len == 0) return strdup("");
+    if (!arr || arr->len == 0) return sn_strdup("");
     const unsigned char *data = (const unsigned char *)arr->data;
     long long len = arr->len;
     size_t out_len = 4 * ((size_t)(len + 2) / 3);
@@ -29,7 +29,7 @@ char *sn_byte_array_to_base64(const SnArray *arr);
 /* ---- byte[].toStringLatin1() — Latin-1 to UTF-8 conversion ---- */
 
 static inline char *sn_byte_array_to_string_latin1(const SnArray *arr) {
-    if (!arr || arr->len == 0) return strdup("");
+    if (!arr || arr->len == 0) return sn_strdup("");
     /* Worst case: every byte is >127 and needs 2 UTF-8 bytes */
     char *s = sn_malloc((size_t)arr->len * 2 + 1);
     size_t out = 0;
@@ -0,0 +1,282 @@
+#include "sn_channel.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#define sn_channel_yield() SwitchToThread()
+#else
+#include <sched.h>
+#define sn_channel_yield() sched_yield()
+#endif
+
+/* A blocked send or receive retries this many times, yielding between tries
+ * after the first few, before it goes to sleep */
+#define SN_CHANNEL_SPINS 64
+#define SN_CHANNEL_PURE_SPINS 4
+
+/* Cells are aligned for any element type, as arena blocks are
+ * (SN_REGION_ALIGN); max_align_t would need C11 */
+#define SN_CHANNEL_ALIGN 16
+
+/* Elements start after the sequence number, at an offset that keeps them
+ * aligned */
+#define SN_CHANNEL_ELEM_OFFSET \
+    (sizeof(size_t) > SN_CHANNEL_ALIGN ? sizeof(size_t) : SN_CHANNEL_ALIGN)
+
+static inline char *sn_channel_cell(const SnChannel *c, size_t pos)
+{
+    return c->cells + (pos & c->mask) * c->stride;
+}
+
+static inline _Atomic size_t *sn_channel_seq(char *cell)
+{
+    return (_Atomic size_t *)cell;
+}
+
+static void sn_channel_alloc_cells(SnChannel *c, size_t cap)
+{
+    c->stride = (SN_CHANNEL_ELEM_OFFSET + c->elem_size + SN_CHANNEL_ALIGN - 1) &
+                ~(size_t)(SN_CHANNEL_ALIGN - 1);
+    c->mask = cap - 1;
+    c->cells = sn_malloc(cap * c->stride);
+    for (size_t i = 0; i < cap; i++)
+        atomic_init(sn_channel_seq(sn_channel_cell(c, i)), i);
+}
+
+SnChannel *sn_channel_new(size_t elem_size, enum SnElemTag tag,
+                          void (*elem_copy)(const void *, void *),
+                          void (*elem_release)(void *))
+{
+    SnChannel *c = sn_calloc(1, sizeof(SnChannel));
+    c->__rc__ = 1;
+    c->elem_size = elem_size;
+    c->elem_tag = tag;
+    c->elem_copy = elem_copy;
+    c->elem_release = elem_release;
+    atomic_init(&c->send_pos, 0);
+    atomic_init(&c->recv_pos, 0);
+    atomic_init(&c->closed, 0);
+    atomic_init(&c->send_waiters, 0);
+    atomic_init(&c->recv_waiters, 0);
+    pthread_mutex_init(&c->lock, NULL);
+    pthread_cond_init(&c->not_full, NULL);
+    pthread_cond_init(&c->not_empty, NULL);
+    sn_channel_alloc_cells(c, SN_CHANNEL_DEFAULT_CAPACITY);
+    return c;
+}
+
+/* Only the last reference frees the channel, so no other thread is using it */
+void sn_channel_free(SnChannel *c)
+{
+    if (!c) return;
+    if (c->elem_release) {
+        size_t end = atomic_load_explicit(&c->send_pos, memory_order_relaxed);
+        for (size_t pos = atomic_load_explicit(&c->recv_pos, memory_order_relaxed); pos != end; pos++) {
+            char *cell = sn_channel_cell(c, pos);
+            if (atomic_load_explicit(sn_channel_seq(cell), memory_order_acquire) == pos + 1)
+                c->elem_release(cell + SN_CHANNEL_ELEM_OFFSET);
+        }
+    }
+    pthread_mutex_destroy(&c->lock);
+    pthread_cond_destroy(&c->not_full);
+    pthread_cond_destroy(&c->not_empty);
+    sn_free(c->cells);
+    sn_free(c);
+}
+
+void sn_channel_set_capacity(SnChannel *c, long long capacity)
+{
+    if (atomic_load_explicit(&c->send_pos, memory_order_relaxed) != 0)
+        sn_panic("setCapacity on a channel that has already been sent to");
+    if (capacity < 1)
+        sn_panic("channel capacity must be positive");
+
+    /* The sequence numbers need at least two cells to tell full from empty */
+    size_t cap = 2;
+    while (cap < (size_t)capacity) cap <<= 1;
+    if (cap == c->mask + 1) return;
+    sn_free(c->cells);
+    sn_channel_alloc_cells(c, cap);
+}
+
+/* ---- Lock-free fast paths ---- */
+
+static bool sn_channel_push(SnChannel *c, const void *elem)
+{
+    size_t pos = atomic_load_explicit(&c->send_pos, memory_order_relaxed);
+    for (;;) {
+        char *cell = sn_channel_cell(c, pos);
+        size_t seq = atomic_load_explicit(sn_channel_seq(cell), memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+        if (dif == 0) {
+            if (atomic_compare_exchange_weak_explicit(&c->send_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                memcpy(cell + SN_CHANNEL_ELEM_OFFSET, elem, c->elem_size);
+                atomic_store_explicit(sn_channel_seq(cell), pos + 1, memory_order_release);
+                return true;
+            }
+        } else if (dif < 0) {
+            return false;       /* full: the cell still holds last lap's element */
+        } else {
+            pos = atomic_load_explicit(&c->send_pos, memory_order_relaxed);
+        }
+    }
+}
+
+static bool sn_channel_pop(SnChannel *c, void *dst)
+{
+    size_t pos = atomic_load_explicit(&c->recv_pos, memory_order_relaxed);
+    for (;;) {
+        char *cell = sn_channel_cell(c, pos);
+        size_t seq = atomic_load_explicit(sn_channel_seq(cell), memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (dif == 0) {
+            if (atomic_compare_exchange_weak_explicit(&c->recv_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                memcpy(dst, cell + SN_CHANNEL_ELEM_OFFSET, c->elem_size);
+                atomic_store_explicit(sn_channel_seq(cell), pos + c->mask + 1, memory_order_release);
+                return true;
+            }
+        } else if (dif < 0) {
+            return false;       /* empty, or the sender has not published yet */
+        } else {
+            pos = atomic_load_explicit(&c->recv_pos, memory_order_relaxed);
+        }
+    }
+}
+
+static bool sn_channel_full(SnChannel *c)
+{
+    size_t pos = atomic_load_explicit(&c->send_pos, memory_order_relaxed);
+    size_t seq = atomic_load_explicit(sn_channel_seq(sn_channel_cell(c, pos)), memory_order_acquire);
+    return (intptr_t)seq - (intptr_t)pos < 0;
+}
+
+static bool sn_channel_empty(SnChannel *c)
+{
+    size_t pos = atomic_load_explicit(&c->recv_pos, memory_order_relaxed);
+    size_t seq = atomic_load_explicit(sn_channel_seq(sn_channel_cell(c, pos)), memory_order_acquire);
+    return (intptr_t)seq - (intptr_t)(pos + 1) < 0;
+}
+
+/* ---- Sleeping ----
+ *
+ * A waiter registers itself, then re-checks the queue; the other side
+ * publishes its cell, then checks for waiters.  The fences order each store
+ * before the following load, so either the waiter sees the change or the
+ * waker sees the waiter.  The wakeup is sent under the mutex the waiter holds
+ * until it sleeps, so it cannot slip in between the check and the wait. */
+
+static void sn_channel_wake(SnChannel *c, _Atomic int *waiters, pthread_cond_t *cond)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiters, memory_order_relaxed) == 0) return;
+    pthread_mutex_lock(&c->lock);
+    pthread_cond_signal(cond);
+    pthread_mutex_unlock(&c->lock);
+}
+
+static void sn_channel_sleep(SnChannel *c, _Atomic int *waiters, pthread_cond_t *cond,
+                             bool (*blocked)(SnChannel *))
+{
+    pthread_mutex_lock(&c->lock);
+    atomic_fetch_add_explicit(waiters, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (blocked(c) && !sn_channel_is_closed(c))
+        pthread_cond_wait(cond, &c->lock);
+    atomic_fetch_sub_explicit(waiters, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&c->lock);
+}
+
+/* ---- Send ---- */
+
+void sn_channel_send(SnChannel *c, void *elem)
+{
+    for (int spin = 0;; spin++) {
+        if (sn_channel_is_closed(c)) {
+            if (c->elem_release) c->elem_release(elem);
+            sn_panic("send on closed channel");
+        }
+        if (sn_channel_push(c, elem)) {
+            sn_channel_wake(c, &c->recv_waiters, &c->not_empty);
+            return;
+        }
+        if (spin >= SN_CHANNEL_SPINS)
+            sn_channel_sleep(c, &c->send_waiters, &c->not_full, sn_channel_full);
+        else if (spin >= SN_CHANNEL_PURE_SPINS)
+            sn_channel_yield();
+    }
+}
+
+bool sn_channel_try_send(SnChannel *c, void *elem)
+{
+    if (!sn_channel_is_closed(c) && sn_channel_push(c, elem)) {
+        sn_channel_wake(c, &c->recv_waiters, &c->not_empty);
+        return true;
+    }
+    if (c->elem_release) c->elem_release(elem);
+    return false;
+}
+
+/* ---- Receive ---- */
+
+bool sn_channel_next(SnChannel *c, void *dst)
+{
+    for (int spin = 0;; spin++) {
+        if (sn_channel_pop(c, dst)) {
+            sn_channel_wake(c, &c->send_waiters, &c->not_full);
+            return true;
+        }
+        /* Drain whatever was sent before the close.  A sender may have
+         * claimed a cell and not published it yet: the channel is only
+         * drained once every claimed cell has been received. */
+        if (sn_channel_is_closed(c)) {
+            if (atomic_load_explicit(&c->recv_pos, memory_order_acquire) ==
+                atomic_load_explicit(&c->send_pos, memory_order_acquire))
+                return false;
+            if (spin >= SN_CHANNEL_PURE_SPINS)
+                sn_channel_yield();
+            continue;
+        }
+        if (spin >= SN_CHANNEL_SPINS)
+            sn_channel_sleep(c, &c->recv_waiters, &c->not_empty, sn_channel_empty);
+        else if (spin >= SN_CHANNEL_PURE_SPINS)
+            sn_channel_yield();
+    }
+}
+
+void sn_channel_receive(SnChannel *c, void *dst)
+{
+    if (!sn_channel_next(c, dst))
+        sn_panic("receive on closed channel");
+}
+
+bool sn_channel_try_receive(SnChannel *c, void *dst)
+{
+    if (!sn_channel_pop(c, dst)) return false;
+    sn_channel_wake(c, &c->send_waiters, &c->not_full);
+    return true;
+}
+
+void sn_channel_close(SnChannel *c)
+{
+    atomic_store_explicit(&c->closed, 1, memory_order_release);
+    pthread_mutex_lock(&c->lock);
+    pthread_cond_broadcast(&c->not_full);
+    pthread_cond_broadcast(&c->not_empty);
+    pthread_mutex_unlock(&c->lock);
+}
+
+long long sn_channel_length(SnChannel *c)
+{
+    size_t recv = atomic_load_explicit(&c->recv_pos, memory_order_acquire);
+    size_t send = atomic_load_explicit(&c->send_pos, memory_order_acquire);
+    return send > recv ? (long long)(send - recv) : 0;
+}
+
+char *sn_channel_to_string(SnChannel *c)
+{
+    char buf[96];
+    snprintf(buf, sizeof(buf), "channel(%lld/%lld%s)", sn_channel_length(c),
+             sn_channel_capacity(c), sn_channel_is_closed(c) ? ", closed" : "");
+    return sn_strdup(buf);
+}
@@ -0,0 +1,99 @@
+#ifndef SN_CHANNEL_H
+#define SN_CHANNEL_H
+
+#include "sn_thread.h"
+#include "sn_array.h"
+
+/*
+ * Built-in channel<T>: a bounded multi-producer multi-consumer queue.
+ *
+ * The buffer is a power-of-two ring of cells, each a sequence number followed
+ * by one element (D. Vyukov's bounded MPMC queue).  A sender claims the cell
+ * at send_pos with a CAS once its sequence equals the position, stores the
+ * element and publishes it by advancing the sequence; a receiver does the
+ * same at recv_pos and hands the cell back one lap ahead.  Neither side takes
+ * a lock, and senders and receivers only contend with their own kind.
+ *
+ * Blocking send/receive spin briefly and then sleep on a condition variable.
+ * The waiter counts let the other side skip the mutex entirely when nobody
+ * sleeps.
+ *
+ * Elements are moved in and out: send takes ownership of the value it is
+ * given and receive hands ownership to the caller, so nothing is copied on
+ * the way through.  Elements still queued when the channel is freed are
+ * released with elem_release.
+ */
+
+#define SN_CHANNEL_DEFAULT_CAPACITY 64
+
+typedef struct {
+    int __rc__;                 /* must stay first: generated as-ref code reads it */
+    char *cells;
+    size_t stride;              /* bytes per cell: sequence number, then the element */
+    size_t mask;                /* capacity - 1 */
+    size_t elem_size;
+    void (*elem_release)(void *);
+    void (*elem_copy)(const void *src, void *dst);
+    enum SnElemTag elem_tag;
+    char pad0[64];
+    _Atomic size_t send_pos;
+    char pad1[64 - sizeof(size_t)];
+    _Atomic size_t recv_pos;
+    char pad2[64 - sizeof(size_t)];
+    _Atomic int closed;
+    _Atomic int send_waiters;
+    _Atomic int recv_waiters;
+    pthread_mutex_t lock;
+    pthread_cond_t not_full;
+    pthread_cond_t not_empty;
+} SnChannel;
+
+SnChannel *sn_channel_new(size_t elem_size, enum SnElemTag tag,
+                          void (*elem_copy)(const void *, void *),
+                          void (*elem_release)(void *));
+void sn_channel_free(SnChannel *c);
+
+/* Rounds up to a power of two (at least 2).  Only allowed before the first
+ * send; panics afterwards. */
+void sn_channel_set_capacity(SnChannel *c, long long capacity);
+
+/* Sends move *elem into the channel.  send blocks while the channel is full
+ * and panics once it is closed.  try_send never blocks: when the channel is
+ * full or closed it releases the element and returns false. */
+void sn_channel_send(SnChannel *c, void *elem);
+bool sn_channel_try_send(SnChannel *c, void *elem);
+
+/* Receives move the oldest element out into dst.  receive blocks while the
+ * channel is empty and panics once it is closed and drained; next returns
+ * false instead (the for-each protocol).  try_receive never blocks. */
+void sn_channel_receive(SnChannel *c, void *dst);
+bool sn_channel_next(SnChannel *c, void *dst);
+bool sn_channel_try_receive(SnChannel *c, void *dst);
+
+/* Wakes every blocked sender and receiver.  Elements already sent can still
+ * be received. */
+void sn_channel_close(SnChannel *c);
+
+/* Number of queued elements; a snapshot while other threads are active */
+long long sn_channel_length(SnChannel *c);
+
+char *sn_channel_to_string(SnChannel *c);
+
+static inline bool sn_channel_is_closed(SnChannel *c)
+{
+    return atomic_load_explicit(&c->closed, memory_order_acquire) != 0;
+}
+
+static inline long long sn_channel_capacity(const SnChannel *c)
+{
+    return (long long)c->mask + 1;
+}
+
+/* Copies an element with the channel's hooks (for borrowed fallbacks) */
+static inline void sn_channel_copy_elem(const SnChannel *c, const void *src, void *dst)
+{
+    if (c->elem_copy) c->elem_copy(src, dst);
+    else memcpy(dst, src, c->elem_size);
+}
+
+#endif
@@ -10,7 +10,7 @@
 
 static inline char *sn_char_to_string(char c)
 {
-    char *s = malloc(2);
+    char *s = sn_malloc(2);
     s[0] = c; s[1] = '\0';
     return s;
 }
@@ -39,33 +39,117 @@ __attribute__((weak)) const char *__ubsan_default_options(void) {
 }
 #endif
 
-/* ---- OOM-safe allocation ---- */
-
-static inline void *sn_malloc(size_t size)
+/* ---- OOM-safe allocation ----
+ * sn_sys_* always use the process heap (libc, or the thread-caching
+ * allocator under --alloc=tcache, see sn_tcache.h); they back memory that
+ * must outlive any arena block (closures, slab heaps, thread state).
+ * sn_malloc / sn_calloc / sn_realloc / sn_strdup allocate from the innermost
+ * arena region when one is active, and sn_free releases either kind (see
+ * sn_region.h). */
+
+#include "sn_tcache.h"
+#include "sn_region.h"
+
+static inline void *sn_sys_malloc(size_t size)
 {
-    void *p = malloc(size);
+    void *p = sn_heap_malloc(size);
     if (!p) { fprintf(stderr, "fatal: out of memory (malloc %zu bytes)\n", size); exit(1); }
     return p;
 }
 
-static inline void *sn_calloc(size_t n, size_t size)
+static inline void *sn_sys_calloc(size_t n, size_t size)
 {
-    void *p = calloc(n, size);
+    void *p = sn_heap_calloc(n, size);
     if (!p) { fprintf(stderr, "fatal: out of memory (calloc %zu x %zu bytes)\n", n, size); exit(1); }
     return p;
 }
 
-static inline void *sn_realloc(void *ptr, size_t size)
+static inline void *sn_sys_realloc(void *ptr, size_t size)
 {
-    void *p = realloc(ptr, size);
+    void *p = sn_heap_realloc(ptr, size);
     if (!p && size > 0) { fprintf(stderr, "fatal: out of memory (realloc %zu bytes)\n", size); exit(1); }
     return p;
 }
 
+static inline void sn_sys_free(void *p)
+{
+    sn_heap_free(p);
+}
+
+static inline char *sn_sys_strdup(const char *s)
+{
+    if (!s) return NULL;
+    size_t n = strlen(s) + 1;
+    return memcpy(sn_sys_malloc(n), s, n);
+}
+
+static inline void *sn_malloc(size_t size)
+{
+#if SN_REGION_ENABLED
+    SnRegion *r = sn_region_tls;
+    if (__builtin_expect(r != NULL, 0) && !r->suspended)
+        return sn_region_alloc(r, size);
+#endif
+    return sn_sys_malloc(size);
+}
+
+static inline void *sn_calloc(size_t n, size_t size)
+{
+#if SN_REGION_ENABLED
+    SnRegion *r = sn_region_tls;
+    if (__builtin_expect(r != NULL, 0) && !r->suspended) {
+        size_t total;
+        if (__builtin_mul_overflow(n, size, &total)) {
+            fprintf(stderr, "fatal: out of memory (calloc %zu x %zu bytes)\n", n, size);
+            exit(1);
+        }
+        return memset(sn_region_alloc(r, total), 0, total);
+    }
+#endif
+    return sn_sys_calloc(n, size);
+}
+
+static inline void *sn_realloc(void *ptr, size_t size)
+{
+#if SN_REGION_ENABLED
+    if (__builtin_expect(sn_region_tls != NULL, 0) && ptr && sn_region_owns(ptr))
+        return sn_region_realloc(ptr, size);
+#endif
+    return sn_sys_realloc(ptr, size);
+}
+
+static inline void sn_free(void *p)
+{
+#if SN_REGION_ENABLED
+    if (__builtin_expect(sn_region_tls != NULL, 0) && sn_region_owns(p))
+        return;
+#endif
+    sn_heap_free(p);
+}
+
 /* ---- Scope-based cleanup ---- */
 
-static inline void sn_cleanup_str(char **p) { free(*p); }
-static inline void sn_cleanup_ptr(void **p) { free(*p); }
+static inline void sn_cleanup_str(char **p) { sn_free(*p); }
+static inline void sn_cleanup_ptr(void **p) { sn_free(*p); }
+
+/* ---- Panics ----
+ * Misuse of a built-in container or channel (pop from an empty deque, send
+ * on a closed channel, ...) ends the program with "panic: <what>". */
+
+static inline void sn_panic(const char *what)
+{
+    fprintf(stderr, "panic: %s\n", what);
+    exit(1);
+}
+
+/* ---- Shared refcounts ----
+ * As-ref structs the type checker finds crossing a thread boundary (spawn
+ * arguments, sync variables) use these instead of plain ++/--.  The increment
+ * can be relaxed; the decrement that reaches zero must see every other
+ * thread's writes before the object is torn down, hence acq_rel. */
+
+static inline void sn_rc_inc_atomic(int *rc) { __atomic_fetch_add(rc, 1, __ATOMIC_RELAXED); }
+static inline bool sn_rc_dec_atomic(int *rc) { return __atomic_sub_fetch(rc, 1, __ATOMIC_ACQ_REL) == 0; }
 
 /* Closures (and their per-lambda specialisations) all share this prefix.
  * The codegen emits matching __Closure__ / __closure_<id>__ typedefs whose
@@ -76,7 +160,11 @@ static inline void sn_cleanup_ptr(void **p) { free(*p); }
  * (capturing into another closure, copying into a struct field, etc.) must
  * call sn_closure_retain; every destruction path must call sn_closure_release,
  * which runs __cleanup__ exactly once when the count hits zero. __cleanup__
- * is responsible for releasing owned captures and freeing the box itself. */
+ * is responsible for releasing owned captures and freeing the box itself.
+ *
+ * Closures around named functions (__fn_closure_<id>__) are statically
+ * allocated and immortal: their __rc__ is SN_CLOSURE_STATIC_RC, which
+ * retain and release leave untouched. */
 typedef struct {
     void *fn;
     size_t size;
@@ -84,19 +172,22 @@ typedef struct {
     int __rc__;
 } __SnClosureHeader__;
 
+#define SN_CLOSURE_STATIC_RC (-1)
+
 static inline void *sn_closure_retain(void *p) {
-    if (p) ((__SnClosureHeader__ *)p)->__rc__++;
+    if (p && ((__SnClosureHeader__ *)p)->__rc__ != SN_CLOSURE_STATIC_RC)
+        ((__SnClosureHeader__ *)p)->__rc__++;
     return p;
 }
 
 static inline void sn_closure_release(void **p) {
     if (*p) {
         __SnClosureHeader__ *h = (__SnClosureHeader__ *)*p;
-        if (--h->__rc__ == 0) {
+        if (h->__rc__ != SN_CLOSURE_STATIC_RC && --h->__rc__ == 0) {
             if (h->__cleanup__)
                 h->__cleanup__(*p);
             else
-                free(*p);
+                sn_free(*p);
         }
     }
     *p = NULL;
@@ -108,14 +199,16 @@ static inline void sn_cleanup_fn(void **p) { sn_closure_release(p); }
 #define sn_auto_ptr __attribute__((cleanup(sn_cleanup_ptr)))
 #define sn_auto_fn __attribute__((cleanup(sn_cleanup_fn)))
 /* Generic cleanup for captured variables (any pointer type) */
-static inline void sn_cleanup_capture(void *p) { free(*(void **)p); *(void **)p = NULL; }
+static inline void sn_cleanup_capture(void *p) { sn_free(*(void **)p); *(void **)p = NULL; }
 #define sn_auto_capture __attribute__((cleanup(sn_cleanup_capture)))
 
 /* ---- Basic string helpers ---- */
 
 static inline char *sn_strdup(const char *s)
 {
-    return s ? strdup(s) : NULL;
+    if (!s) return NULL;
+    size_t n = strlen(s) + 1;
+    return memcpy(sn_malloc(n), s, n);
 }
 
 static inline long long sn_str_length(const char *s)
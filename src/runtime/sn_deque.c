@@ -0,0 +1,176 @@
+#include "sn_deque.h"
+
+#define SN_DEQUE_MIN_CAP 8
+
+static inline void *sn_deque_slot(const SnDeque *d, long long phys)
+{
+    return d->data + (size_t)(phys & (d->cap - 1)) * d->elem_size;
+}
+
+static inline void sn_deque_store(SnDeque *d, void *slot, const void *elem, bool take)
+{
+    if (!take && d->elem_copy) d->elem_copy(elem, slot);
+    else memcpy(slot, elem, d->elem_size);
+}
+
+static inline void sn_deque_copy_at(const SnDeque *d, long long index, void *dst)
+{
+    const void *src = sn_deque_slot(d, d->head + index);
+    if (d->elem_copy) d->elem_copy(src, dst);
+    else memcpy(dst, src, d->elem_size);
+}
+
+/* Double the ring and straighten it so element 0 is at slot 0 */
+static void sn_deque_grow(SnDeque *d)
+{
+    long long new_cap = d->cap ? d->cap * 2 : SN_DEQUE_MIN_CAP;
+    char *data = sn_malloc((size_t)new_cap * d->elem_size);
+    if (d->len) {
+        long long first = d->cap - d->head;
+        if (first > d->len) first = d->len;
+        memcpy(data, d->data + (size_t)d->head * d->elem_size, (size_t)first * d->elem_size);
+        memcpy(data + (size_t)first * d->elem_size, d->data, (size_t)(d->len - first) * d->elem_size);
+    }
+    sn_free(d->data);
+    d->data = data;
+    d->head = 0;
+    d->cap = new_cap;
+}
+
+SnDeque *sn_deque_new(size_t elem_size, enum SnElemTag tag,
+                      void (*elem_copy)(const void *, void *),
+                      void (*elem_release)(void *))
+{
+    SnDeque *d = sn_calloc(1, sizeof(SnDeque));
+    d->__rc__ = 1;
+    d->elem_size = elem_size;
+    d->elem_tag = tag;
+    d->elem_copy = elem_copy;
+    d->elem_release = elem_release;
+    return d;
+}
+
+void sn_deque_clear(SnDeque *d)
+{
+    if (d->elem_release) {
+        for (long long i = 0; i < d->len; i++)
+            d->elem_release(sn_deque_slot(d, d->head + i));
+    }
+    d->head = 0;
+    d->len = 0;
+}
+
+void sn_deque_free(SnDeque *d)
+{
+    if (!d) return;
+    sn_deque_clear(d);
+    sn_free(d->data);
+    sn_free(d);
+}
+
+SnDeque *sn_deque_clone(const SnDeque *d)
+{
+    SnDeque *c = sn_deque_new(d->elem_size, d->elem_tag, d->elem_copy, d->elem_release);
+    c->elem_str = d->elem_str;
+    if (d->len) {
+        c->cap = d->cap;
+        c->data = sn_malloc((size_t)c->cap * c->elem_size);
+        for (long long i = 0; i < d->len; i++)
+            sn_deque_copy_at(d, i, c->data + (size_t)i * c->elem_size);
+        c->len = d->len;
+    }
+    return c;
+}
+
+void sn_deque_push_back(SnDeque *d, const void *elem, bool take)
+{
+    if (d->len == d->cap) sn_deque_grow(d);
+    sn_deque_store(d, sn_deque_slot(d, d->head + d->len), elem, take);
+    d->len++;
+}
+
+void sn_deque_push_front(SnDeque *d, const void *elem, bool take)
+{
+    if (d->len == d->cap) sn_deque_grow(d);
+    d->head = (d->head - 1) & (d->cap - 1);
+    sn_deque_store(d, sn_deque_slot(d, d->head), elem, take);
+    d->len++;
+}
+
+void sn_deque_pop_back(SnDeque *d, void *dst)
+{
+    if (d->len == 0) sn_panic("popBack on empty deque");
+    d->len--;
+    memcpy(dst, sn_deque_slot(d, d->head + d->len), d->elem_size);
+}
+
+void sn_deque_pop_front(SnDeque *d, void *dst)
+{
+    if (d->len == 0) sn_panic("popFront on empty deque");
+    memcpy(dst, sn_deque_slot(d, d->head), d->elem_size);
+    d->head = (d->head + 1) & (d->cap - 1);
+    d->len--;
+}
+
+void *sn_deque_at(const SnDeque *d, long long index)
+{
+    if (index < 0) index += d->len;
+    if (index < 0 || index >= d->len) sn_panic("deque index out of range");
+    return sn_deque_slot(d, d->head + index);
+}
+
+void sn_deque_get(const SnDeque *d, long long index, void *dst)
+{
+    if (index < 0) index += d->len;
+    if (index < 0 || index >= d->len) sn_panic("deque index out of range");
+    sn_deque_copy_at(d, index, dst);
+}
+
+void sn_deque_set(SnDeque *d, long long index, const void *elem, bool take)
+{
+    void *slot = sn_deque_at(d, index);
+    if (d->elem_release) d->elem_release(slot);
+    sn_deque_store(d, slot, elem, take);
+}
+
+SnArray *sn_deque_to_array(const SnDeque *d)
+{
+    SnArray *arr = sn_array_new(d->elem_size, d->len);
+    arr->elem_tag = d->elem_tag;
+    arr->elem_copy = d->elem_copy;
+    arr->elem_release = d->elem_release;
+    for (long long i = 0; i < d->len; i++)
+        sn_deque_copy_at(d, i, (char *)arr->data + (size_t)i * d->elem_size);
+    arr->len = d->len;
+    return arr;
+}
+
+char *sn_deque_to_string(const SnDeque *d)
+{
+    if (!d || d->len == 0) return sn_strdup("[]");
+
+    size_t buf_size = 256;
+    size_t off = 0;
+    char *result = sn_malloc(buf_size);
+    result[off++] = '[';
+
+    for (long long i = 0; i < d->len; i++) {
+        char elem_buf[64];
+        char *heap = sn_array_elem_str(sn_deque_slot(d, d->head + i), d->elem_size, d->elem_tag,
+                                       d->elem_str, elem_buf, sizeof(elem_buf));
+        const char *str = heap ? heap : elem_buf;
+        size_t len = strlen(str);
+        if (off + len + 4 >= buf_size) {
+            buf_size = (off + len + 4) * 2;
+            result = sn_realloc(result, buf_size);
+        }
+        if (i > 0) { result[off++] = ','; result[off++] = ' '; }
+        memcpy(result + off, str, len);
+        off += len;
+        sn_free(heap);
+    }
+
+    result[off++] = ']';
+    result[off] = '\0';
+    return result;
+}
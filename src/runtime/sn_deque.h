@@ -0,0 +1,50 @@
+#ifndef SN_DEQUE_H
+#define SN_DEQUE_H
+
+#include "sn_array.h"
+
+/*
+ * Built-in deque<T>: a double-ended queue in a power-of-two ring buffer.
+ *
+ * Element i lives at physical slot (head + i) & (cap - 1), so pushes and pops
+ * at either end are O(1) (amortized over doubling), and indexed access is a
+ * mask instead of a bounds-wrapping division.  Elements use the same
+ * ownership hooks as SnArray (elem_copy / elem_release / elem_tag).
+ */
+
+typedef struct {
+    int __rc__;                 /* must stay first: generated as-ref code reads it */
+    char *data;
+    long long head;             /* physical slot of element 0 */
+    long long len;
+    long long cap;              /* 0 or a power of two */
+    size_t elem_size;
+    void (*elem_release)(void *);
+    void (*elem_copy)(const void *src, void *dst);
+    enum SnElemTag elem_tag;
+    char *(*elem_str)(const void *);    /* struct element formatter for toString (optional) */
+} SnDeque;
+
+SnDeque *sn_deque_new(size_t elem_size, enum SnElemTag tag,
+                      void (*elem_copy)(const void *, void *),
+                      void (*elem_release)(void *));
+void sn_deque_free(SnDeque *d);
+void sn_deque_clear(SnDeque *d);
+SnDeque *sn_deque_clone(const SnDeque *d);
+
+/* Pushes copy elem in, or move it in when take is set (the caller gives up
+ * ownership).  Pops move the element out into dst; they panic when empty. */
+void sn_deque_push_back(SnDeque *d, const void *elem, bool take);
+void sn_deque_push_front(SnDeque *d, const void *elem, bool take);
+void sn_deque_pop_back(SnDeque *d, void *dst);
+void sn_deque_pop_front(SnDeque *d, void *dst);
+
+/* Indexed access; negative indices count from the back.  Panics when out of range. */
+void *sn_deque_at(const SnDeque *d, long long index);
+void sn_deque_get(const SnDeque *d, long long index, void *dst);     /* copies */
+void sn_deque_set(SnDeque *d, long long index, const void *elem, bool take);
+
+SnArray *sn_deque_to_array(const SnDeque *d);
+char *sn_deque_to_string(const SnDeque *d);
+
+#endif
@@ -0,0 +1,82 @@
+#include "sn_lock.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#define sn_lock_yield() SwitchToThread()
+#else
+#include <sched.h>
+#define sn_lock_yield() sched_yield()
+#endif
+
+/* A writer spins this many times on a busy shard before it starts yielding */
+#define SN_RWLOCK_PURE_SPINS 64
+
+/* ---- Reader-writer lock ---- */
+
+/* Threads are dealt shards round-robin the first time they read-lock */
+static _Atomic unsigned sn_rwlock_next_slot;
+static _Thread_local int sn_rwlock_slot = -1;
+
+static inline _Atomic int *sn_rwlock_readers(SnRwLock *l)
+{
+    if (sn_rwlock_slot < 0)
+        sn_rwlock_slot = (int)(atomic_fetch_add_explicit(&sn_rwlock_next_slot, 1,
+                                                         memory_order_relaxed) % SN_RWLOCK_SHARDS);
+    return &l->shards[sn_rwlock_slot].readers;
+}
+
+/* The reader announces itself, then checks for a writer; the writer raises
+ * its flag, then checks for readers.  Both sides are seq_cst, so at least one
+ * of them sees the other. */
+void sn_rwlock_read_lock(SnRwLock *l)
+{
+    _Atomic int *readers = sn_rwlock_readers(l);
+    for (;;) {
+        atomic_fetch_add_explicit(readers, 1, memory_order_seq_cst);
+        if (atomic_load_explicit(&l->writer, memory_order_seq_cst) == 0)
+            return;
+        atomic_fetch_sub_explicit(readers, 1, memory_order_release);
+        /* Sleep until the writer is done rather than spin against it */
+        pthread_mutex_lock(&l->writer_lock);
+        pthread_mutex_unlock(&l->writer_lock);
+    }
+}
+
+void sn_rwlock_read_unlock(SnRwLock *l)
+{
+    atomic_fetch_sub_explicit(sn_rwlock_readers(l), 1, memory_order_release);
+}
+
+void sn_rwlock_write_lock(SnRwLock *l)
+{
+    pthread_mutex_lock(&l->writer_lock);
+    atomic_store_explicit(&l->writer, 1, memory_order_seq_cst);
+    for (int i = 0; i < SN_RWLOCK_SHARDS; i++) {
+        for (int spin = 0; atomic_load_explicit(&l->shards[i].readers, memory_order_seq_cst) != 0; spin++) {
+            if (spin >= SN_RWLOCK_PURE_SPINS)
+                sn_lock_yield();
+        }
+    }
+}
+
+void sn_rwlock_write_unlock(SnRwLock *l)
+{
+    atomic_store_explicit(&l->writer, 0, memory_order_release);
+    pthread_mutex_unlock(&l->writer_lock);
+}
+
+/* ---- Striped lock ---- */
+
+/* Stripes are always taken in ascending order, so two whole-array locks
+ * cannot deadlock against each other */
+void sn_striped_lock_all(SnStripedLock *l)
+{
+    for (int i = 0; i < SN_STRIPED_LOCK_STRIPES; i++)
+        pthread_mutex_lock(&l->stripes[i].mutex);
+}
+
+void sn_striped_unlock_all(SnStripedLock *l)
+{
+    for (int i = SN_STRIPED_LOCK_STRIPES - 1; i >= 0; i--)
+        pthread_mutex_unlock(&l->stripes[i].mutex);
+}
@@ -0,0 +1,81 @@
+#ifndef SN_LOCK_H
+#define SN_LOCK_H
+
+#include "sn_thread.h"
+
+/*
+ * Locks behind `lock` blocks.  A sync variable gets one of three kinds,
+ * picked by the compiler from the lock blocks that name it:
+ *
+ *   lock(x)                   pthread_mutex_t
+ *   lock read(x) / write(x)   SnRwLock
+ *   lock(arr[i])              SnStripedLock
+ *
+ * The generated lock object is always called __sn__<name>_mutex.
+ */
+
+/* ---- Reader-writer lock ----
+ *
+ * Reader-biased and sharded: each reader bumps the counter of its own
+ * cache line, so readers on different cores never write the same line.
+ * A writer takes writer_lock (which also orders writers), raises the
+ * writer flag and waits for every shard to drain.  A reader that sees the
+ * flag backs out and queues on writer_lock behind the writer, so writers
+ * are not starved by a steady stream of readers. */
+
+#define SN_RWLOCK_SHARDS 16
+
+typedef struct {
+    _Alignas(64) _Atomic int readers;
+} SnRwLockShard;
+
+typedef struct {
+    SnRwLockShard shards[SN_RWLOCK_SHARDS];
+    _Alignas(64) _Atomic int writer;
+    pthread_mutex_t writer_lock;
+} SnRwLock;
+
+#define SN_RWLOCK_INITIALIZER { .writer_lock = PTHREAD_MUTEX_INITIALIZER }
+
+void sn_rwlock_read_lock(SnRwLock *l);
+void sn_rwlock_read_unlock(SnRwLock *l);
+void sn_rwlock_write_lock(SnRwLock *l);
+void sn_rwlock_write_unlock(SnRwLock *l);
+
+/* ---- Striped lock ----
+ *
+ * One mutex per stripe for the elements of a sync array: lock(arr[i])
+ * takes stripe i % SN_STRIPED_LOCK_STRIPES, so neighbouring elements land
+ * on different stripes and updates to them do not contend.  A lock block
+ * on the whole array takes every stripe in order. */
+
+#define SN_STRIPED_LOCK_STRIPES 64
+
+typedef struct {
+    _Alignas(64) pthread_mutex_t mutex;
+} SnLockStripe;
+
+typedef struct {
+    SnLockStripe stripes[SN_STRIPED_LOCK_STRIPES];
+} SnStripedLock;
+
+#define SN_LOCK_STRIPE_INIT_1  { PTHREAD_MUTEX_INITIALIZER }
+#define SN_LOCK_STRIPE_INIT_4  SN_LOCK_STRIPE_INIT_1, SN_LOCK_STRIPE_INIT_1, \
+                               SN_LOCK_STRIPE_INIT_1, SN_LOCK_STRIPE_INIT_1
+#define SN_LOCK_STRIPE_INIT_16 SN_LOCK_STRIPE_INIT_4, SN_LOCK_STRIPE_INIT_4, \
+                               SN_LOCK_STRIPE_INIT_4, SN_LOCK_STRIPE_INIT_4
+#define SN_STRIPED_LOCK_INITIALIZER { { SN_LOCK_STRIPE_INIT_16, SN_LOCK_STRIPE_INIT_16, \
+                                        SN_LOCK_STRIPE_INIT_16, SN_LOCK_STRIPE_INIT_16 } }
+
+void sn_striped_lock_all(SnStripedLock *l);
+void sn_striped_unlock_all(SnStripedLock *l);
+
+/* The stripe guarding element `index` of an array of `len` elements;
+ * negative indices count from the end like array access does */
+static inline pthread_mutex_t *sn_striped_lock_at(SnStripedLock *l, long long index, long long len)
+{
+    if (index < 0) index += len;
+    return &l->stripes[(unsigned long long)index % SN_STRIPED_LOCK_STRIPES].mutex;
+}
+
+#endif
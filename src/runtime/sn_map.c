@@ -0,0 +1,366 @@
+#include "sn_map.h"
+
+/*
+ * Swiss-table probing.  The control array is split into groups of
+ * SN_MAP_GROUP bytes and probing visits whole groups in triangular order,
+ * which reaches every group because the group count is a power of two.
+ * The table is rehashed once fewer than 1/8 of the slots are EMPTY, so every
+ * probe sequence ends at a group that still has an EMPTY byte.
+ */
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SN_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define SN_SIMD_X86 0
+#endif
+
+#define SN_MAP_INLINE_BUF 128
+
+/* ---- Group matching ---- */
+
+static inline unsigned sn_group_match(const signed char *g, signed char tag)
+{
+#if SN_SIMD_X86
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)g);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(tag)));
+#else
+    unsigned bits = 0;
+    for (int i = 0; i < SN_MAP_GROUP; i++)
+        if (g[i] == tag) bits |= 1u << i;
+    return bits;
+#endif
+}
+
+/* EMPTY and DELETED both have the sign bit set; full slots never do */
+static inline unsigned sn_group_match_free(const signed char *g)
+{
+#if SN_SIMD_X86
+    return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)g));
+#else
+    unsigned bits = 0;
+    for (int i = 0; i < SN_MAP_GROUP; i++)
+        if (g[i] < 0) bits |= 1u << i;
+    return bits;
+#endif
+}
+
+static inline unsigned sn_group_match_full(const signed char *g)
+{
+    return ~sn_group_match_free(g) & 0xFFFFu;
+}
+
+static inline long long sn_map_growth(long long cap)
+{
+    return cap - cap / 8;
+}
+
+/* ---- Hashing ---- */
+
+uint64_t sn_hash_bytes(const void *data, size_t n)
+{
+    const unsigned char *p = data;
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ ((uint64_t)n * 0xC2B2AE3D27D4EB4FULL);
+    while (n >= 8) {
+        uint64_t w;
+        memcpy(&w, p, 8);
+        h = (h ^ sn_hash_u64(w)) * 0x9FB21C651E98DF25ULL;
+        p += 8;
+        n -= 8;
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, p, n);
+    return sn_hash_u64(h ^ tail);
+}
+
+/* ---- Lookup ---- */
+
+static long long sn_map_find_index(const SnMap *m, const void *key, uint64_t h)
+{
+    if (m->cap == 0) return -1;
+    signed char tag = (signed char)(h & 0x7F);
+    long long mask = m->cap / SN_MAP_GROUP - 1;
+    long long g = (long long)(h >> 7) & mask;
+    for (long long step = 1;; step++) {
+        long long base = g * SN_MAP_GROUP;
+        unsigned bits = sn_group_match(m->ctrl + base, tag);
+        while (bits) {
+            long long i = base + __builtin_ctz(bits);
+            if (m->ops->eq(key, sn_map_slot_key(m, i))) return i;
+            bits &= bits - 1;
+        }
+        if (sn_group_match(m->ctrl + base, SN_MAP_EMPTY)) return -1;
+        g = (g + step) & mask;
+    }
+}
+
+/* First EMPTY or DELETED slot on the probe sequence of hash h */
+static long long sn_map_find_free(const SnMap *m, uint64_t h)
+{
+    long long mask = m->cap / SN_MAP_GROUP - 1;
+    long long g = (long long)(h >> 7) & mask;
+    for (long long step = 1;; step++) {
+        long long base = g * SN_MAP_GROUP;
+        unsigned bits = sn_group_match_free(m->ctrl + base);
+        if (bits) return base + __builtin_ctz(bits);
+        g = (g + step) & mask;
+    }
+}
+
+void *sn_map_find(const SnMap *m, const void *key)
+{
+    long long i = sn_map_find_index(m, key, m->ops->hash(key));
+    return i < 0 ? NULL : sn_map_slot_val(m, i);
+}
+
+/* ---- Allocation / rehash ---- */
+
+void sn_map_init(SnMap *m, const SnMapOps *ops)
+{
+    size_t align = 1;
+    while (align < ops->val_size && align < 8) align <<= 1;
+    memset(m, 0, sizeof(SnMap));
+    m->__rc__ = 1;
+    m->ops = ops;
+    m->val_offset = (ops->key_size + align - 1) & ~(align - 1);
+    m->slot_size = (m->val_offset + ops->val_size + 7) & ~(size_t)7;
+}
+
+SnMap *sn_map_new(const SnMapOps *ops)
+{
+    SnMap *m = sn_malloc(sizeof(SnMap));
+    sn_map_init(m, ops);
+    return m;
+}
+
+static void sn_map_rehash(SnMap *m, long long new_cap)
+{
+    signed char *old_ctrl = m->ctrl;
+    unsigned char *old_slots = m->slots;
+    long long old_cap = m->cap;
+
+    m->ctrl = sn_malloc((size_t)new_cap);
+    memset(m->ctrl, SN_MAP_EMPTY, (size_t)new_cap);
+    m->slots = sn_malloc((size_t)new_cap * m->slot_size);
+    m->cap = new_cap;
+
+    /* Entries move by memcpy: ownership of keys and values transfers as-is */
+    for (long long i = 0; i < old_cap; i++) {
+        if (old_ctrl[i] < 0) continue;
+        unsigned char *slot = old_slots + (size_t)i * m->slot_size;
+        uint64_t h = m->ops->hash(slot);
+        long long j = sn_map_find_free(m, h);
+        m->ctrl[j] = (signed char)(h & 0x7F);
+        memcpy(sn_map_slot_key(m, j), slot, m->slot_size);
+    }
+    m->growth_left = sn_map_growth(new_cap) - m->len;
+
+    sn_free(old_ctrl);
+    sn_free(old_slots);
+}
+
+/* ---- Mutation ---- */
+
+/* Insert a key known to be absent */
+static void sn_map_insert_new(SnMap *m, const void *key, const void *val, uint64_t h)
+{
+    if (m->growth_left == 0) {
+        /* Grow when live entries fill more than 7/16 of the table; otherwise
+         * the EMPTY slots went to tombstones and a same-size rehash frees them */
+        long long cap = m->cap;
+        if (cap == 0) cap = SN_MAP_GROUP;
+        else if (m->len + 1 > cap * 7 / 16) cap *= 2;
+        sn_map_rehash(m, cap);
+    }
+
+    long long i = sn_map_find_free(m, h);
+    if (m->ctrl[i] == SN_MAP_EMPTY) m->growth_left--;
+    m->ctrl[i] = (signed char)(h & 0x7F);
+    sn_map_copy_key(m, key, sn_map_slot_key(m, i));
+    if (m->ops->val_size) sn_map_copy_val(m, val, sn_map_slot_val(m, i));
+    m->len++;
+}
+
+void sn_map_set(SnMap *m, const void *key, const void *val)
+{
+    uint64_t h = m->ops->hash(key);
+    long long i = sn_map_find_index(m, key, h);
+    if (i >= 0 && m->ops->val_size) {
+        /* Copy before releasing: val may alias the value being replaced */
+        unsigned char buf[SN_MAP_INLINE_BUF];
+        void *tmp = m->ops->val_size <= sizeof(buf) ? buf : sn_malloc(m->ops->val_size);
+        sn_map_copy_val(m, val, tmp);
+        if (m->ops->val_release) m->ops->val_release(sn_map_slot_val(m, i));
+        memcpy(sn_map_slot_val(m, i), tmp, m->ops->val_size);
+        if (tmp != buf) sn_free(tmp);
+        return;
+    }
+    if (i >= 0) return;
+
+    sn_map_insert_new(m, key, val, h);
+}
+
+bool sn_map_add(SnMap *m, const void *key, const void *val)
+{
+    uint64_t h = m->ops->hash(key);
+    if (sn_map_find_index(m, key, h) >= 0) return false;
+    sn_map_insert_new(m, key, val, h);
+    return true;
+}
+
+static void sn_map_release_slot(SnMap *m, long long i)
+{
+    if (m->ops->key_release) m->ops->key_release(sn_map_slot_key(m, i));
+    if (m->ops->val_release) m->ops->val_release(sn_map_slot_val(m, i));
+}
+
+bool sn_map_remove(SnMap *m, const void *key)
+{
+    long long i = sn_map_find_index(m, key, m->ops->hash(key));
+    if (i < 0) return false;
+    sn_map_release_slot(m, i);
+    m->len--;
+    /* A group that still holds an EMPTY byte has never been full since the
+     * last rehash, so no probe sequence continues past it and the slot can
+     * become EMPTY again instead of a tombstone. */
+    long long base = i & ~(long long)(SN_MAP_GROUP - 1);
+    if (sn_group_match(m->ctrl + base, SN_MAP_EMPTY)) {
+        m->ctrl[i] = SN_MAP_EMPTY;
+        m->growth_left++;
+    } else {
+        m->ctrl[i] = SN_MAP_DELETED;
+    }
+    return true;
+}
+
+void sn_map_clear(SnMap *m)
+{
+    if (m->ops->key_release || m->ops->val_release) {
+        for (long long i = sn_map_next(m, 0); i < m->cap; i = sn_map_next(m, i + 1))
+            sn_map_release_slot(m, i);
+    }
+    if (m->cap) memset(m->ctrl, SN_MAP_EMPTY, (size_t)m->cap);
+    m->len = 0;
+    m->growth_left = sn_map_growth(m->cap);
+}
+
+void sn_map_destroy(SnMap *m)
+{
+    sn_map_clear(m);
+    sn_free(m->ctrl);
+    sn_free(m->slots);
+    m->ctrl = NULL;
+    m->slots = NULL;
+    m->cap = 0;
+    m->growth_left = 0;
+}
+
+void sn_map_free(SnMap *m)
+{
+    if (!m) return;
+    sn_map_destroy(m);
+    sn_free(m);
+}
+
+void sn_map_clone_into(const SnMap *m, SnMap *c)
+{
+    sn_map_init(c, m->ops);
+    if (m->cap == 0) return;
+    c->cap = m->cap;
+    c->len = m->len;
+    c->growth_left = m->growth_left;
+    c->ctrl = sn_malloc((size_t)m->cap);
+    memcpy(c->ctrl, m->ctrl, (size_t)m->cap);
+    c->slots = sn_malloc((size_t)m->cap * m->slot_size);
+    if (!m->ops->key_copy && !m->ops->val_copy) {
+        memcpy(c->slots, m->slots, (size_t)m->cap * m->slot_size);
+        return;
+    }
+    for (long long i = sn_map_next(m, 0); i < m->cap; i = sn_map_next(m, i + 1)) {
+        sn_map_copy_key(m, sn_map_slot_key(m, i), sn_map_slot_key(c, i));
+        sn_map_copy_val(m, sn_map_slot_val(m, i), sn_map_slot_val(c, i));
+    }
+}
+
+SnMap *sn_map_clone(const SnMap *m)
+{
+    SnMap *c = sn_malloc(sizeof(SnMap));
+    sn_map_clone_into(m, c);
+    return c;
+}
+
+/* ---- Iteration ---- */
+
+long long sn_map_next(const SnMap *m, long long pos)
+{
+    if (pos < 0) pos = 0;
+    while (pos < m->cap) {
+        long long base = pos & ~(long long)(SN_MAP_GROUP - 1);
+        unsigned bits = sn_group_match_full(m->ctrl + base) >> (pos - base);
+        if (bits) return pos + __builtin_ctz(bits);
+        pos = base + SN_MAP_GROUP;
+    }
+    return m->cap;
+}
+
+static SnArray *sn_map_collect(const SnMap *m, bool values)
+{
+    size_t size = values ? m->ops->val_size : m->ops->key_size;
+    SnArray *arr = sn_array_new(size, m->len);
+    arr->elem_tag = values ? m->ops->val_tag : m->ops->key_tag;
+    arr->elem_copy = values ? m->ops->val_copy : m->ops->key_copy;
+    arr->elem_release = values ? m->ops->val_release : m->ops->key_release;
+    for (long long i = sn_map_next(m, 0); i < m->cap; i = sn_map_next(m, i + 1)) {
+        void *dst = (char *)arr->data + (size_t)arr->len * size;
+        if (values) sn_map_copy_val(m, sn_map_slot_val(m, i), dst);
+        else sn_map_copy_key(m, sn_map_slot_key(m, i), dst);
+        arr->len++;
+    }
+    return arr;
+}
+
+SnArray *sn_map_keys(const SnMap *m) { return sn_map_collect(m, false); }
+SnArray *sn_map_values(const SnMap *m) { return sn_map_collect(m, true); }
+
+/* ---- toString ---- */
+
+static void sn_map_append(char **result, size_t *off, size_t *buf_size, const char *s)
+{
+    size_t len = strlen(s);
+    if (*off + len + 2 >= *buf_size) {
+        *buf_size = (*off + len + 2) * 2;
+        *result = sn_realloc(*result, *buf_size);
+    }
+    memcpy(*result + *off, s, len);
+    *off += len;
+}
+
+char *sn_map_to_string(const SnMap *m)
+{
+    if (!m || m->len == 0) return sn_strdup("{}");
+
+    size_t buf_size = 256;
+    char *result = sn_malloc(buf_size);
+    size_t off = 0;
+    result[off++] = '{';
+
+    bool first = true;
+    for (long long i = sn_map_next(m, 0); i < m->cap; i = sn_map_next(m, i + 1)) {
+        char key_buf[64], val_buf[64];
+        char *key_heap = sn_array_elem_str(sn_map_slot_key(m, i), m->ops->key_size, m->ops->key_tag,
+                                           m->ops->key_str, key_buf, sizeof(key_buf));
+        char *val_heap = sn_array_elem_str(sn_map_slot_val(m, i), m->ops->val_size, m->ops->val_tag,
+                                           m->ops->val_str, val_buf, sizeof(val_buf));
+        if (!first) sn_map_append(&result, &off, &buf_size, ", ");
+        sn_map_append(&result, &off, &buf_size, key_heap ? key_heap : key_buf);
+        sn_map_append(&result, &off, &buf_size, ": ");
+        sn_map_append(&result, &off, &buf_size, val_heap ? val_heap : val_buf);
+        sn_free(key_heap);
+        sn_free(val_heap);
+        first = false;
+    }
+
+    result[off++] = '}';
+    result[off] = '\0';
+    return result;
+}
@@ -0,0 +1,132 @@
+#ifndef SN_MAP_H
+#define SN_MAP_H
+
+#include "sn_core.h"
+#include "sn_array.h"
+
+/*
+ * Built-in map<K, V> — Swiss-table style open addressing.
+ *
+ * Every slot has one control byte: SN_MAP_EMPTY, SN_MAP_DELETED, or the low
+ * 7 bits of the key's hash when the slot is full.  Slots are grouped in runs
+ * of SN_MAP_GROUP; a lookup compares a whole group of control bytes against
+ * the 7-bit tag at once (one SSE2 compare on x86-64) and only calls the key
+ * equality function for matching tags.  Keys and values are stored inline in
+ * one slot array.
+ *
+ * Each monomorphized map type supplies a static SnMapOps with the compiler-
+ * generated hash/equality functions and the same copy/release hooks SnArray
+ * uses for its elements.  The map owns copies of every key and value.
+ */
+
+#define SN_MAP_GROUP 16
+#define SN_MAP_EMPTY   ((signed char)-128)
+#define SN_MAP_DELETED ((signed char)-2)
+
+typedef struct {
+    size_t key_size;
+    size_t val_size;
+    uint64_t (*hash)(const void *key);
+    bool (*eq)(const void *a, const void *b);
+    void (*key_copy)(const void *src, void *dst);   /* NULL = memcpy */
+    void (*key_release)(void *);                    /* NULL = no-op */
+    void (*val_copy)(const void *src, void *dst);   /* NULL = memcpy */
+    void (*val_release)(void *);                    /* NULL = no-op */
+    enum SnElemTag key_tag;                         /* for keys() and toString */
+    enum SnElemTag val_tag;                         /* for values() and toString */
+    char *(*key_str)(const void *key);              /* struct formatter (NULL = by tag) */
+    char *(*val_str)(const void *val);              /* struct formatter (NULL = by tag) */
+} SnMapOps;
+
+typedef struct {
+    int __rc__;                 /* must stay first: generated as-ref code reads it */
+    long long len;
+    long long cap;              /* 0, or a power of two >= SN_MAP_GROUP */
+    long long growth_left;      /* inserts into EMPTY slots left before a rehash */
+    signed char *ctrl;          /* cap control bytes */
+    unsigned char *slots;       /* cap slots of slot_size bytes: key, then value */
+    size_t val_offset;
+    size_t slot_size;
+    const SnMapOps *ops;
+} SnMap;
+
+/* ---- Hashing (used by the generated per-type hash functions) ---- */
+
+static inline uint64_t sn_hash_u64(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+static inline uint64_t sn_hash_mix(uint64_t h, uint64_t v)
+{
+    return sn_hash_u64(h ^ (v + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2)));
+}
+
+static inline uint64_t sn_hash_f64(double d)
+{
+    uint64_t bits;
+    if (d == 0.0) d = 0.0;      /* -0.0 == 0.0, so they must hash alike */
+    memcpy(&bits, &d, sizeof(bits));
+    return bits;
+}
+
+uint64_t sn_hash_bytes(const void *data, size_t n);
+
+static inline uint64_t sn_hash_str(const char *s)
+{
+    return s ? sn_hash_bytes(s, strlen(s)) : 0;
+}
+
+static inline bool sn_map_str_eq(const char *a, const char *b)
+{
+    if (a == b) return true;
+    if (!a || !b) return false;
+    return strcmp(a, b) == 0;
+}
+
+/* ---- Map operations (defined in sn_map.c) ---- */
+
+SnMap *sn_map_new(const SnMapOps *ops);
+void sn_map_free(SnMap *m);
+void sn_map_init(SnMap *m, const SnMapOps *ops);    /* for maps embedded in other objects */
+void sn_map_destroy(SnMap *m);                       /* releases entries and storage, not m */
+void sn_map_clone_into(const SnMap *m, SnMap *dst);
+void *sn_map_find(const SnMap *m, const void *key);
+void sn_map_set(SnMap *m, const void *key, const void *val);
+bool sn_map_add(SnMap *m, const void *key, const void *val);  /* false if key present */
+bool sn_map_remove(SnMap *m, const void *key);
+void sn_map_clear(SnMap *m);
+SnMap *sn_map_clone(const SnMap *m);
+long long sn_map_next(const SnMap *m, long long pos);
+SnArray *sn_map_keys(const SnMap *m);
+SnArray *sn_map_values(const SnMap *m);
+char *sn_map_to_string(const SnMap *m);
+
+static inline void *sn_map_slot_key(const SnMap *m, long long i)
+{
+    return m->slots + (size_t)i * m->slot_size;
+}
+
+static inline void *sn_map_slot_val(const SnMap *m, long long i)
+{
+    return m->slots + (size_t)i * m->slot_size + m->val_offset;
+}
+
+static inline void sn_map_copy_key(const SnMap *m, const void *src, void *dst)
+{
+    if (m->ops->key_copy) m->ops->key_copy(src, dst);
+    else memcpy(dst, src, m->ops->key_size);
+}
+
+static inline void sn_map_copy_val(const SnMap *m, const void *src, void *dst)
+{
+    if (m->ops->val_copy) m->ops->val_copy(src, dst);
+    else memcpy(dst, src, m->ops->val_size);
+}
+
+#endif
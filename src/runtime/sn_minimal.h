@@ -10,9 +10,17 @@
 
 #include "sn_core.h"      /* includes, OOM wrappers, cleanup macros */
 #include "sn_thread.h"    /* SnThread, pthread helpers */
+#include "sn_slab.h"      /* per-thread slab allocator for as-ref structs */
 #include "sn_array.h"     /* SnArray, element operations, method macros */
 #include "sn_string.h"    /* string operations, split, method macros */
 #include "sn_byte.h"      /* byte array encoding (hex, base64, latin1) */
+#include "sn_map.h"       /* SnMap hash table for map<K, V> */
+#include "sn_set.h"       /* SnSet (map table + dense bitmap) for set<T> */
+#include "sn_deque.h"     /* SnDeque ring buffer for deque<T> */
+#include "sn_bits.h"      /* SnBits packed bool sequence for bits */
+#include "sn_channel.h"   /* SnChannel bounded MPMC queue for channel<T> */
+#include "sn_task_group.h" /* SnTaskGroup completion-order waits for taskgroup<T> */
+#include "sn_lock.h"      /* SnRwLock, SnStripedLock for lock blocks */
 #include "sn_arith.h"     /* checked/unchecked arithmetic */
 #include "sn_conv.h"      /* type conversions, comparisons, I/O */
 #include "sn_reflect.h"   /* TypeInfo, FieldInfo for typeOf() */
@@ -0,0 +1,105 @@
+#include "sn_core.h"
+
+/* Like the slab, regions are compiled into the runtime library whenever the
+ * compiler supports TLS; generated code decides per build whether to enter
+ * them (see sn_region.h). */
+
+#if SN_REGION_ENABLED
+
+__thread SnRegion *sn_region_tls = NULL;
+
+void sn_region_enter(SnRegion *r)
+{
+    r->bump = NULL;
+    r->limit = NULL;
+    r->chunks = NULL;
+    r->next_chunk = SN_REGION_CHUNK_SIZE;
+    r->suspended = 0;
+    r->outer = sn_region_tls;
+    sn_region_tls = r;
+}
+
+void sn_region_leave(SnRegion *r)
+{
+    SnRegionChunk *c = r->chunks;
+    while (c) {
+        SnRegionChunk *prev = c->prev;
+        free(c);
+        c = prev;
+    }
+    r->chunks = NULL;
+    r->bump = r->limit = NULL;
+    sn_region_tls = r->outer;
+}
+
+void *sn_region_alloc_slow(SnRegion *r, size_t size)
+{
+    size_t need = SN_REGION_ALIGN + ((size + SN_REGION_ALIGN - 1) & ~(size_t)(SN_REGION_ALIGN - 1));
+    if (need <= size) {
+        fprintf(stderr, "fatal: out of memory (region %zu bytes)\n", size);
+        exit(1);
+    }
+
+    size_t chunk_size = r->next_chunk;
+    if (chunk_size - sizeof(SnRegionChunk) < need) {
+        chunk_size = need + SN_REGION_ALIGN;
+    } else if (r->next_chunk < SN_REGION_CHUNK_MAX) {
+        r->next_chunk *= 2;
+    }
+
+    SnRegionChunk *c = malloc(chunk_size);
+    if (!c) {
+        fprintf(stderr, "fatal: out of memory (region chunk %zu bytes)\n", chunk_size);
+        exit(1);
+    }
+    c->prev = r->chunks;
+    c->end = (char *)c + chunk_size;
+    r->chunks = c;
+
+    /* A block bigger than the standard chunk gets a chunk of its own; keep
+     * bumping from the previous chunk if it still has room */
+    char *p = (char *)c + SN_REGION_ALIGN;
+    if (c->end - p - (ptrdiff_t)need < r->limit - r->bump) {
+        *(size_t *)p = size;
+        return p + SN_REGION_ALIGN;
+    }
+    r->bump = p + need;
+    r->limit = c->end;
+    *(size_t *)p = size;
+    return p + SN_REGION_ALIGN;
+}
+
+bool sn_region_owns(const void *p)
+{
+    const char *cp = p;
+    for (SnRegion *r = sn_region_tls; r; r = r->outer) {
+        for (SnRegionChunk *c = r->chunks; c; c = c->prev) {
+            if (cp > (const char *)c && cp < c->end) return true;
+        }
+    }
+    return false;
+}
+
+void *sn_region_realloc(void *p, size_t size)
+{
+    char *hdr = (char *)p - SN_REGION_ALIGN;
+    size_t old = *(size_t *)hdr;
+    SnRegion *r = sn_region_tls;
+
+    /* The newest block of the active region grows in place */
+    if (!r->suspended) {
+        size_t old_span = SN_REGION_ALIGN + ((old + SN_REGION_ALIGN - 1) & ~(size_t)(SN_REGION_ALIGN - 1));
+        size_t new_span = SN_REGION_ALIGN + ((size + SN_REGION_ALIGN - 1) & ~(size_t)(SN_REGION_ALIGN - 1));
+        if (hdr + old_span == r->bump && new_span > size && (size_t)(r->limit - hdr) >= new_span) {
+            r->bump = hdr + new_span;
+            *(size_t *)hdr = size;
+            return p;
+        }
+    }
+
+    void *q = sn_malloc(size);
+    memcpy(q, p, old < size ? old : size);
+    return q;
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef SN_REGION_H
+#define SN_REGION_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Region allocator behind `arena =>` blocks.
+ *
+ * Entering an arena block pushes an SnRegion (a local in the generated code)
+ * onto this thread's region stack.  While it is the innermost region,
+ * sn_malloc / sn_calloc / sn_strdup bump-allocate from its chunks instead of
+ * calling malloc, and sn_free on a pointer inside any active region is a
+ * no-op.  Leaving the block frees every chunk at once.
+ *
+ * Each allocation is preceded by a SN_REGION_ALIGN-byte header holding its
+ * size so sn_realloc can grow region blocks; the newest block grows in place.
+ * sn_realloc never moves a block between the region and the system heap
+ * unless the region is suspended, and a NULL pointer always goes to realloc.
+ *
+ * Code that stores into something living outside the block (the compiler
+ * marks these expressions) runs between sn_region_suspend and
+ * sn_region_resume, so anything it allocates comes from the system heap and
+ * survives the block.
+ *
+ * Builds with AddressSanitizer (sn -g), compilers without TLS support, and
+ * programs compiled with --alloc=system (SN_ALLOC_SYSTEM) make arena blocks
+ * a no-op, so every allocation stays visible to the usual tools.
+ */
+
+#define SN_REGION_ALIGN      16
+#define SN_REGION_CHUNK_SIZE (64 * 1024)
+#define SN_REGION_CHUNK_MAX  (4 * 1024 * 1024)
+
+#if defined(SN_ALLOC_SYSTEM) || defined(SN_ASAN_ACTIVE) || defined(__TINYC__) || defined(_MSC_VER)
+
+#define SN_REGION_ENABLED 0
+
+typedef struct {
+    char unused;
+} SnRegion;
+
+static inline void sn_region_enter(SnRegion *r) { (void)r; }
+static inline void sn_region_leave(SnRegion *r) { (void)r; }
+static inline void sn_region_suspend(void) {}
+static inline void sn_region_resume(void) {}
+
+#else
+
+#define SN_REGION_ENABLED 1
+
+/* Header at the start of every chunk; blocks begin SN_REGION_ALIGN bytes in */
+typedef struct SnRegionChunk {
+    struct SnRegionChunk *prev;
+    char *end;
+} SnRegionChunk;
+
+typedef struct SnRegion {
+    char *bump;                 /* next free byte in the newest chunk */
+    char *limit;
+    SnRegionChunk *chunks;      /* newest first */
+    size_t next_chunk;          /* size of the next chunk, doubles up to SN_REGION_CHUNK_MAX */
+    struct SnRegion *outer;
+    int suspended;              /* > 0 while storing into memory outside the block */
+} SnRegion;
+
+extern __thread SnRegion *sn_region_tls;
+
+void sn_region_enter(SnRegion *r);
+void sn_region_leave(SnRegion *r);
+void *sn_region_alloc_slow(SnRegion *r, size_t size);
+void *sn_region_realloc(void *p, size_t size);
+bool sn_region_owns(const void *p);
+
+static inline void *sn_region_alloc(SnRegion *r, size_t size)
+{
+    size_t need = SN_REGION_ALIGN + ((size + SN_REGION_ALIGN - 1) & ~(size_t)(SN_REGION_ALIGN - 1));
+    if (need > size && (size_t)(r->limit - r->bump) >= need) {
+        char *p = r->bump;
+        r->bump += need;
+        *(size_t *)p = size;
+        return p + SN_REGION_ALIGN;
+    }
+    return sn_region_alloc_slow(r, size);
+}
+
+static inline void sn_region_suspend(void)
+{
+    SnRegion *r = sn_region_tls;
+    if (r) r->suspended++;
+}
+
+static inline void sn_region_resume(void)
+{
+    SnRegion *r = sn_region_tls;
+    if (r) r->suspended--;
+}
+
+#endif
+
+#define sn_auto_region __attribute__((cleanup(sn_region_leave)))
+
+#endif
@@ -69,13 +69,13 @@ struct __sn__Decoder {
 /* ---- Encoder memory management (as ref / pointer semantics) ---- */
 
 static inline __sn__Encoder *__sn__Encoder_alloc(void) {
-    return (__sn__Encoder *)calloc(1, sizeof(__sn__Encoder));
+    return (__sn__Encoder *)sn_calloc(1, sizeof(__sn__Encoder));
 }
 
 static inline void __sn__Encoder_release(__sn__Encoder **p) {
     if (*p) {
         if ((*p)->__sn__cleanup) (*p)->__sn__cleanup(*p);
-        free(*p);
+        sn_free(*p);
     }
     *p = NULL;
 }
@@ -90,13 +90,13 @@ static inline void __sn__Encoder_release_elem(void *p) {
 /* ---- Decoder memory management (as ref / pointer semantics) ---- */
 
 static inline __sn__Decoder *__sn__Decoder_alloc(void) {
-    return (__sn__Decoder *)calloc(1, sizeof(__sn__Decoder));
+    return (__sn__Decoder *)sn_calloc(1, sizeof(__sn__Decoder));
 }
 
 static inline void __sn__Decoder_release(__sn__Decoder **p) {
     if (*p) {
         if ((*p)->__sn__cleanup) (*p)->__sn__cleanup(*p);
-        free(*p);
+        sn_free(*p);
     }
     *p = NULL;
 }
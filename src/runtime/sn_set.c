@@ -0,0 +1,325 @@
+#include "sn_set.h"
+
+/* The bitmap may grow to cover x only while it stays at least 1/128 full
+ * (<= 16 bytes per element, about the cost of a table slot); the first
+ * SN_SET_DENSE_MIN_WORDS words are always allowed. */
+#define SN_SET_DENSE_MIN_WORDS 4
+#define SN_SET_DENSE_MAX_WORDS (1LL << 18)
+
+/* ---- Integer element access ---- */
+
+static bool sn_set_int_of(const SnSet *s, const void *elem, long long *out)
+{
+    switch (s->ops->int_kind) {
+        case SN_SET_INT_I64: *out = *(const long long *)elem; return true;
+        case SN_SET_INT_I32: *out = *(const int32_t *)elem; return true;
+        case SN_SET_INT_U32: *out = *(const uint32_t *)elem; return true;
+        case SN_SET_INT_U8:  *out = *(const unsigned char *)elem; return true;
+        default: return false;
+    }
+}
+
+static void sn_set_store_int(const SnSet *s, long long v, void *dst)
+{
+    switch (s->ops->int_kind) {
+        case SN_SET_INT_I64: *(long long *)dst = v; break;
+        case SN_SET_INT_I32: *(int32_t *)dst = (int32_t)v; break;
+        case SN_SET_INT_U32: *(uint32_t *)dst = (uint32_t)v; break;
+        case SN_SET_INT_U8:  *(unsigned char *)dst = (unsigned char)v; break;
+        default: break;
+    }
+}
+
+static inline bool sn_set_in_bits(const SnSet *s, long long v)
+{
+    return v >= 0 && v < s->bit_words * 64;
+}
+
+static inline bool sn_set_bit(const SnSet *s, long long v)
+{
+    return (s->bits[v >> 6] >> (v & 63)) & 1;
+}
+
+/* Grow the bitmap to `words` words.  Table elements that fall into the new
+ * range move into the bitmap, so every x in range is always stored as a bit. */
+static void sn_set_grow_bits(SnSet *s, long long words)
+{
+    long long old_bits = s->bit_words * 64;
+    s->bits = sn_realloc(s->bits, (size_t)words * sizeof(uint64_t));
+    memset(s->bits + s->bit_words, 0, (size_t)(words - s->bit_words) * sizeof(uint64_t));
+    s->bit_words = words;
+
+    SnMap *t = &s->table;
+    for (long long i = sn_map_next(t, 0); i < t->cap; i = sn_map_next(t, i + 1)) {
+        long long v = -1;
+        sn_set_int_of(s, sn_map_slot_key(t, i), &v);
+        if (v >= old_bits && v < words * 64) {
+            s->bits[v >> 6] |= 1ULL << (v & 63);
+            s->bit_len++;
+            sn_map_remove(t, sn_map_slot_key(t, i));
+        }
+    }
+}
+
+/* Bitmap size (in words) that would cover v, or 0 if that would be too sparse */
+static long long sn_set_dense_words(const SnSet *s, long long v)
+{
+    long long need = v / 64 + 1;
+    if (need > SN_SET_DENSE_MAX_WORDS) return 0;
+    long long words = s->bit_words * 2;
+    if (words < need) words = need;
+    if (words < SN_SET_DENSE_MIN_WORDS) words = SN_SET_DENSE_MIN_WORDS;
+    if (words > SN_SET_DENSE_MAX_WORDS) words = need;
+    if (words <= SN_SET_DENSE_MIN_WORDS) return words;
+    return words * 64 <= 128 * (sn_set_len(s) + 1) ? words : 0;
+}
+
+/* ---- Lifetime ---- */
+
+SnSet *sn_set_new(const SnSetOps *ops)
+{
+    SnSet *s = sn_calloc(1, sizeof(SnSet));
+    sn_map_init(&s->table, &ops->map);
+    s->__rc__ = 1;
+    s->ops = ops;
+    return s;
+}
+
+void sn_set_free(SnSet *s)
+{
+    if (!s) return;
+    sn_map_destroy(&s->table);
+    sn_free(s->bits);
+    sn_free(s);
+}
+
+void sn_set_clear(SnSet *s)
+{
+    sn_map_clear(&s->table);
+    if (s->bit_words) memset(s->bits, 0, (size_t)s->bit_words * sizeof(uint64_t));
+    s->bit_len = 0;
+}
+
+SnSet *sn_set_clone(const SnSet *s)
+{
+    SnSet *c = sn_calloc(1, sizeof(SnSet));
+    sn_map_clone_into(&s->table, &c->table);
+    c->__rc__ = 1;
+    c->ops = s->ops;
+    if (s->bit_words) {
+        c->bits = sn_malloc((size_t)s->bit_words * sizeof(uint64_t));
+        memcpy(c->bits, s->bits, (size_t)s->bit_words * sizeof(uint64_t));
+        c->bit_words = s->bit_words;
+        c->bit_len = s->bit_len;
+    }
+    return c;
+}
+
+/* ---- Element operations ---- */
+
+bool sn_set_add(SnSet *s, const void *elem)
+{
+    long long v;
+    if (sn_set_int_of(s, elem, &v) && v >= 0) {
+        if (v >= s->bit_words * 64) {
+            long long words = sn_set_dense_words(s, v);
+            if (words) sn_set_grow_bits(s, words);
+        }
+        if (v < s->bit_words * 64) {
+            uint64_t mask = 1ULL << (v & 63);
+            if (s->bits[v >> 6] & mask) return false;
+            s->bits[v >> 6] |= mask;
+            s->bit_len++;
+            return true;
+        }
+    }
+    return sn_map_add(&s->table, elem, NULL);
+}
+
+bool sn_set_contains(const SnSet *s, const void *elem)
+{
+    long long v;
+    if (sn_set_int_of(s, elem, &v) && sn_set_in_bits(s, v))
+        return sn_set_bit(s, v);
+    return sn_map_find(&s->table, elem) != NULL;
+}
+
+bool sn_set_remove(SnSet *s, const void *elem)
+{
+    long long v;
+    if (sn_set_int_of(s, elem, &v) && sn_set_in_bits(s, v)) {
+        if (!sn_set_bit(s, v)) return false;
+        s->bits[v >> 6] &= ~(1ULL << (v & 63));
+        s->bit_len--;
+        return true;
+    }
+    return sn_map_remove(&s->table, elem);
+}
+
+/* ---- Iteration ---- */
+
+long long sn_set_next(const SnSet *s, long long pos)
+{
+    if (pos < 0) pos = 0;
+    long long nbits = s->bit_words * 64;
+    while (pos < nbits) {
+        uint64_t w = s->bits[pos >> 6] >> (pos & 63);
+        if (w) return pos + __builtin_ctzll(w);
+        pos = (pos | 63) + 1;
+    }
+    return nbits + sn_map_next(&s->table, pos - nbits);
+}
+
+void sn_set_copy_at(const SnSet *s, long long pos, void *dst)
+{
+    long long nbits = s->bit_words * 64;
+    if (pos < nbits) sn_set_store_int(s, pos, dst);
+    else sn_map_copy_key(&s->table, sn_map_slot_key(&s->table, pos - nbits), dst);
+}
+
+/* Visit every element in iteration order (elem points into the set or at a
+ * scratch integer; it is only valid during the call). */
+#define SN_SET_FOREACH(s, elem, body) do {                                   \
+    long long __end = sn_set_end(s);                                         \
+    long long __scratch;                                                     \
+    for (long long __p = sn_set_next(s, 0); __p < __end;                     \
+         __p = sn_set_next(s, __p + 1)) {                                    \
+        const void *elem;                                                    \
+        if (__p < (s)->bit_words * 64) {                                     \
+            sn_set_store_int(s, __p, &__scratch);                            \
+            elem = &__scratch;                                               \
+        } else {                                                             \
+            elem = sn_map_slot_key(&(s)->table, __p - (s)->bit_words * 64);  \
+        }                                                                    \
+        body                                                                 \
+    }                                                                        \
+} while (0)
+
+/* ---- Bulk operations ---- */
+
+static long long sn_popcount_words(const uint64_t *w, long long n)
+{
+    long long c = 0;
+    for (long long i = 0; i < n; i++) c += __builtin_popcountll(w[i]);
+    return c;
+}
+
+SnSet *sn_set_union(const SnSet *a, const SnSet *b)
+{
+    SnSet *c = sn_set_clone(a);
+    /* b's bitmap already met the density rule for b, and c holds all of b */
+    if (b->bit_words > c->bit_words) sn_set_grow_bits(c, b->bit_words);
+    for (long long i = 0; i < b->bit_words; i++) c->bits[i] |= b->bits[i];
+    if (b->bit_words) c->bit_len = sn_popcount_words(c->bits, c->bit_words);
+
+    const SnMap *t = &b->table;
+    for (long long i = sn_map_next(t, 0); i < t->cap; i = sn_map_next(t, i + 1))
+        sn_set_add(c, sn_map_slot_key(t, i));
+    return c;
+}
+
+SnSet *sn_set_intersect(const SnSet *a, const SnSet *b)
+{
+    SnSet *c = sn_set_new(a->ops);
+    long long words = a->bit_words < b->bit_words ? a->bit_words : b->bit_words;
+    if (words) {
+        c->bits = sn_malloc((size_t)words * sizeof(uint64_t));
+        c->bit_words = words;
+        for (long long i = 0; i < words; i++) c->bits[i] = a->bits[i] & b->bits[i];
+        c->bit_len = sn_popcount_words(c->bits, words);
+    }
+
+    /* a's elements outside the shared bitmap range: bits beyond it, then table */
+    long long scratch;
+    for (long long v = words * 64; v < a->bit_words * 64; v++) {
+        if (!sn_set_bit(a, v)) continue;
+        sn_set_store_int(a, v, &scratch);
+        if (sn_set_contains(b, &scratch)) sn_set_add(c, &scratch);
+    }
+    const SnMap *t = &a->table;
+    for (long long i = sn_map_next(t, 0); i < t->cap; i = sn_map_next(t, i + 1)) {
+        const void *elem = sn_map_slot_key(t, i);
+        if (sn_set_contains(b, elem)) sn_set_add(c, elem);
+    }
+    return c;
+}
+
+SnSet *sn_set_difference(const SnSet *a, const SnSet *b)
+{
+    SnSet *c = sn_set_new(a->ops);
+    if (a->bit_words) {
+        long long shared = a->bit_words < b->bit_words ? a->bit_words : b->bit_words;
+        c->bits = sn_malloc((size_t)a->bit_words * sizeof(uint64_t));
+        c->bit_words = a->bit_words;
+        for (long long i = 0; i < shared; i++) c->bits[i] = a->bits[i] & ~b->bits[i];
+        /* Beyond b's bitmap, b holds those values (if at all) in its table */
+        long long scratch;
+        for (long long i = shared; i < a->bit_words; i++) {
+            uint64_t w = a->bits[i];
+            for (uint64_t m = w; m; m &= m - 1) {
+                long long v = i * 64 + __builtin_ctzll(m);
+                sn_set_store_int(a, v, &scratch);
+                if (sn_map_find(&b->table, &scratch)) w &= ~(1ULL << (v & 63));
+            }
+            c->bits[i] = w;
+        }
+        c->bit_len = sn_popcount_words(c->bits, c->bit_words);
+    }
+
+    const SnMap *t = &a->table;
+    for (long long i = sn_map_next(t, 0); i < t->cap; i = sn_map_next(t, i + 1)) {
+        const void *elem = sn_map_slot_key(t, i);
+        if (!sn_set_contains(b, elem)) sn_set_add(c, elem);
+    }
+    return c;
+}
+
+/* ---- Conversion ---- */
+
+SnArray *sn_set_to_array(const SnSet *s)
+{
+    const SnMapOps *ops = &s->ops->map;
+    SnArray *arr = sn_array_new(ops->key_size, sn_set_len(s));
+    arr->elem_tag = ops->key_tag;
+    arr->elem_copy = ops->key_copy;
+    arr->elem_release = ops->key_release;
+    long long end = sn_set_end(s);
+    for (long long p = sn_set_next(s, 0); p < end; p = sn_set_next(s, p + 1)) {
+        sn_set_copy_at(s, p, (char *)arr->data + (size_t)arr->len * ops->key_size);
+        arr->len++;
+    }
+    return arr;
+}
+
+char *sn_set_to_string(const SnSet *s)
+{
+    if (!s || sn_set_len(s) == 0) return sn_strdup("{}");
+
+    const SnMapOps *ops = &s->ops->map;
+    size_t buf_size = 256;
+    size_t off = 0;
+    char *result = sn_malloc(buf_size);
+    result[off++] = '{';
+
+    bool first = true;
+    SN_SET_FOREACH(s, elem, {
+        char elem_buf[64];
+        char *heap = sn_array_elem_str(elem, ops->key_size, ops->key_tag, ops->key_str,
+                                       elem_buf, sizeof(elem_buf));
+        const char *str = heap ? heap : elem_buf;
+        size_t len = strlen(str);
+        if (off + len + 4 >= buf_size) {
+            buf_size = (off + len + 4) * 2;
+            result = sn_realloc(result, buf_size);
+        }
+        if (!first) { result[off++] = ','; result[off++] = ' '; }
+        memcpy(result + off, str, len);
+        off += len;
+        sn_free(heap);
+        first = false;
+    });
+
+    result[off++] = '}';
+    result[off] = '\0';
+    return result;
+}
@@ -0,0 +1,69 @@
+#ifndef SN_SET_H
+#define SN_SET_H
+
+#include "sn_map.h"
+
+/*
+ * Built-in set<T>.
+ *
+ * Elements live in an SnMap with zero-size values, so sets share the
+ * Swiss-table probing and the per-type hash/equality/copy/release hooks of
+ * map<K, V>.  Integer sets additionally keep a dense bitmap: an element x
+ * with 0 <= x < bit_words * 64 is stored as one bit instead of a table slot.
+ * The bitmap only grows while it stays at least 1/128 full, so sparse or
+ * negative values simply stay in the table.  Bitmap-to-bitmap union,
+ * intersect and difference run one word (64 elements) at a time.
+ */
+
+/* How an integer element is read for the bitmap (SN_SET_INT_NONE: no bitmap) */
+enum SnSetIntKind {
+    SN_SET_INT_NONE = 0,
+    SN_SET_INT_I64,             /* int, long, uint (reinterpreted) */
+    SN_SET_INT_I32,
+    SN_SET_INT_U32,
+    SN_SET_INT_U8               /* byte, char, bool */
+};
+
+typedef struct {
+    SnMapOps map;               /* val_size must be 0 */
+    enum SnSetIntKind int_kind;
+} SnSetOps;
+
+typedef struct {
+    int __rc__;                 /* must stay first: generated as-ref code reads it */
+    SnMap table;
+    uint64_t *bits;             /* dense part (integer sets only) */
+    long long bit_words;
+    long long bit_len;          /* elements stored in bits */
+    const SnSetOps *ops;
+} SnSet;
+
+SnSet *sn_set_new(const SnSetOps *ops);
+void sn_set_free(SnSet *s);
+bool sn_set_add(SnSet *s, const void *elem);        /* false if already present */
+bool sn_set_contains(const SnSet *s, const void *elem);
+bool sn_set_remove(SnSet *s, const void *elem);
+void sn_set_clear(SnSet *s);
+SnSet *sn_set_clone(const SnSet *s);
+SnSet *sn_set_union(const SnSet *a, const SnSet *b);
+SnSet *sn_set_intersect(const SnSet *a, const SnSet *b);
+SnSet *sn_set_difference(const SnSet *a, const SnSet *b);
+SnArray *sn_set_to_array(const SnSet *s);
+char *sn_set_to_string(const SnSet *s);
+
+/* Iteration: positions [0, bit_words * 64) walk the bitmap, the rest walk the
+ * table.  sn_set_next returns sn_set_end(s) when exhausted. */
+long long sn_set_next(const SnSet *s, long long pos);
+void sn_set_copy_at(const SnSet *s, long long pos, void *dst);
+
+static inline long long sn_set_len(const SnSet *s)
+{
+    return s->table.len + s->bit_len;
+}
+
+static inline long long sn_set_end(const SnSet *s)
+{
+    return s->bit_words * 64 + s->table.cap;
+}
+
+#endif
@@ -0,0 +1,107 @@
+#include "sn_slab.h"
+#include "sn_thread.h"
+
+/* The slab is compiled into the runtime library unconditionally; generated
+ * code decides per build whether to call it (see sn_slab.h). */
+
+#if !defined(__TINYC__) && !defined(_MSC_VER)
+
+__thread SnSlabHeap *sn_slab_tls = NULL;
+
+static pthread_once_t sn_slab_once = PTHREAD_ONCE_INIT;
+static pthread_key_t sn_slab_key;
+static pthread_mutex_t sn_slab_orphan_lock = PTHREAD_MUTEX_INITIALIZER;
+static SnSlabHeap *sn_slab_orphans = NULL;
+
+/* Thread exit: park the heap for the next thread.  Live objects in its chunks
+ * keep pointing at it, so it is never freed.  Any release that still runs on
+ * this thread afterwards sees a NULL heap and takes the remote path. */
+static void sn_slab_thread_exit(void *arg)
+{
+    SnSlabHeap *h = arg;
+    sn_slab_tls = NULL;
+    pthread_mutex_lock(&sn_slab_orphan_lock);
+    h->next_orphan = sn_slab_orphans;
+    sn_slab_orphans = h;
+    pthread_mutex_unlock(&sn_slab_orphan_lock);
+}
+
+static void sn_slab_init_key(void)
+{
+    pthread_key_create(&sn_slab_key, sn_slab_thread_exit);
+}
+
+static SnSlabHeap *sn_slab_heap(void)
+{
+    SnSlabHeap *h = sn_slab_tls;
+    if (h) return h;
+
+    pthread_once(&sn_slab_once, sn_slab_init_key);
+
+    pthread_mutex_lock(&sn_slab_orphan_lock);
+    h = sn_slab_orphans;
+    if (h) sn_slab_orphans = h->next_orphan;
+    pthread_mutex_unlock(&sn_slab_orphan_lock);
+
+    if (h) h->next_orphan = NULL;
+    else h = sn_sys_calloc(1, sizeof(SnSlabHeap));
+
+    sn_slab_tls = h;
+    pthread_setspecific(sn_slab_key, h);
+    return h;
+}
+
+static char *sn_slab_new_chunk(SnSlabHeap *h)
+{
+    void *mem = NULL;
+#ifdef _WIN32
+    mem = _aligned_malloc(SN_SLAB_CHUNK_SIZE, SN_SLAB_CHUNK_SIZE);
+    if (!mem) {
+#else
+    if (posix_memalign(&mem, SN_SLAB_CHUNK_SIZE, SN_SLAB_CHUNK_SIZE) != 0 || !mem) {
+#endif
+        fprintf(stderr, "fatal: out of memory (slab chunk %d bytes)\n", SN_SLAB_CHUNK_SIZE);
+        exit(1);
+    }
+    ((SnSlabChunk *)mem)->owner = h;
+    return mem;
+}
+
+void *sn_slab_alloc_slow(size_t size)
+{
+    SnSlabHeap *h = sn_slab_heap();
+    size_t cls = (size - 1) / SN_SLAB_GRAIN;
+    SnSlabFree *f = h->free[cls];
+
+    /* Reclaim everything other threads have released back to this heap */
+    if (!f)
+        f = __atomic_exchange_n(&h->remote[cls], NULL, __ATOMIC_ACQUIRE);
+
+    if (f) {
+        h->free[cls] = f->next;
+        memset(f, 0, size);
+        return f;
+    }
+
+    size_t slot = (cls + 1) * SN_SLAB_GRAIN;
+    if (!h->bump[cls] || h->bump[cls] + slot > h->bump_end[cls]) {
+        char *chunk = sn_slab_new_chunk(h);
+        h->bump[cls] = chunk + SN_SLAB_GRAIN;
+        h->bump_end[cls] = chunk + SN_SLAB_CHUNK_SIZE;
+    }
+    void *p = h->bump[cls];
+    h->bump[cls] += slot;
+    memset(p, 0, size);
+    return p;
+}
+
+void sn_slab_free_remote(SnSlabHeap *owner, void *p, size_t cls)
+{
+    SnSlabFree *f = p;
+    f->next = __atomic_load_n(&owner->remote[cls], __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&owner->remote[cls], &f->next, f, true,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+}
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef SN_SLAB_H
+#define SN_SLAB_H
+
+#include "sn_core.h"
+
+/*
+ * Slab allocator for as-ref struct instances.
+ *
+ * Generated __sn__T__new / _copy / _release go through sn_ref_alloc and
+ * sn_ref_free with sizeof(T).  Sizes up to SN_SLAB_MAX_SIZE are rounded to a
+ * 16-byte size class; each thread owns a heap with one freelist and one bump
+ * chunk per class, so a type's instances come from a slab of same-sized slots
+ * and a release is a single push.  Larger structs fall back to sn_sys_calloc.
+ *
+ * Chunks are SN_SLAB_CHUNK_SIZE-aligned and start with the owning heap, so a
+ * free finds the owner by masking the pointer.  Freeing on a thread that does
+ * not own the chunk pushes onto the owner's per-class remote stack (lock-free);
+ * the owner drains it when its local list runs dry.  When a thread exits its
+ * heap is parked on an orphan list and adopted by the next new thread, so
+ * objects that outlive their allocating thread can still be freed and reused.
+ *
+ * Builds with AddressSanitizer (sn -g), compilers without TLS support, and
+ * programs compiled with --alloc=system (SN_ALLOC_SYSTEM) use sn_sys_calloc
+ * and sn_sys_free directly so every object stays visible to the usual tools.
+ * Either way the memory comes from the process heap, never from an arena
+ * region.
+ */
+
+#define SN_SLAB_GRAIN       16
+#define SN_SLAB_MAX_SIZE    512
+#define SN_SLAB_CLASSES     (SN_SLAB_MAX_SIZE / SN_SLAB_GRAIN)
+#define SN_SLAB_CHUNK_SIZE  (64 * 1024)
+
+#if defined(SN_ALLOC_SYSTEM) || defined(SN_ASAN_ACTIVE) || defined(__TINYC__) || defined(_MSC_VER)
+
+#define sn_ref_alloc(size) sn_sys_calloc(1, (size))
+#define sn_ref_free(p, size) sn_sys_free(p)
+
+#else
+
+typedef struct SnSlabFree {
+    struct SnSlabFree *next;
+} SnSlabFree;
+
+typedef struct SnSlabHeap {
+    SnSlabFree *free[SN_SLAB_CLASSES];     /* owner-only */
+    char *bump[SN_SLAB_CLASSES];           /* next unused slot in the class chunk */
+    char *bump_end[SN_SLAB_CLASSES];
+    SnSlabFree *remote[SN_SLAB_CLASSES];   /* pushed by other threads, atomic */
+    struct SnSlabHeap *next_orphan;
+} SnSlabHeap;
+
+/* Header at the start of every chunk; slots begin SN_SLAB_GRAIN bytes in */
+typedef struct {
+    SnSlabHeap *owner;
+} SnSlabChunk;
+
+extern __thread SnSlabHeap *sn_slab_tls;
+
+void *sn_slab_alloc_slow(size_t size);
+void sn_slab_free_remote(SnSlabHeap *owner, void *p, size_t cls);
+
+/* size - 1 wraps for size 0, which (like oversized structs) goes to calloc */
+static inline void *sn_slab_alloc(size_t size)
+{
+    if (size - 1 < SN_SLAB_MAX_SIZE) {
+        SnSlabHeap *h = sn_slab_tls;
+        size_t cls = (size - 1) / SN_SLAB_GRAIN;
+        if (h && h->free[cls]) {
+            SnSlabFree *f = h->free[cls];
+            h->free[cls] = f->next;
+            memset(f, 0, size);
+            return f;
+        }
+        return sn_slab_alloc_slow(size);
+    }
+    return sn_sys_calloc(1, size);
+}
+
+static inline void sn_slab_free(void *p, size_t size)
+{
+    if (!p) return;
+    if (size - 1 < SN_SLAB_MAX_SIZE) {
+        SnSlabChunk *chunk = (SnSlabChunk *)((uintptr_t)p & ~(uintptr_t)(SN_SLAB_CHUNK_SIZE - 1));
+        size_t cls = (size - 1) / SN_SLAB_GRAIN;
+        SnSlabHeap *h = sn_slab_tls;
+        if (chunk->owner == h) {
+            SnSlabFree *f = p;
+            f->next = h->free[cls];
+            h->free[cls] = f;
+        } else {
+            sn_slab_free_remote(chunk->owner, p, cls);
+        }
+        return;
+    }
+    sn_sys_free(p);
+}
+
+#define sn_ref_alloc(size) sn_slab_alloc(size)
+#define sn_ref_free(p, size) sn_slab_free((p), (size))
+
+#endif
+
+/* Structs declared with @align(N) / @cacheline above the slab grain need a
+ * block on an N-byte boundary, which neither the size classes nor the heap
+ * wrappers promise.  They come straight from the C library instead and must
+ * go back through sn_ref_free_aligned. */
+static inline void *sn_ref_alloc_aligned(size_t size, size_t align)
+{
+    void *p = NULL;
+#ifdef _WIN32
+    p = _aligned_malloc(size, align);
+#else
+    if (posix_memalign(&p, align, size) != 0) p = NULL;
+#endif
+    if (!p) { fprintf(stderr, "fatal: out of memory (aligned alloc %zu bytes)\n", size); exit(1); }
+    return memset(p, 0, size);
+}
+
+static inline void sn_ref_free_aligned(void *p)
+{
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+#endif
@@ -85,7 +85,7 @@ SnArray *sn_str_split(const char *s, const char *delim)
     while (*p) {
         const char *found = strstr(p, delim);
         if (!found) {
-            char *part = strdup(p);
+            char *part = sn_strdup(p);
             sn_array_push(arr, &part);
             break;
         }
@@ -96,7 +96,7 @@ SnArray *sn_str_split(const char *s, const char *delim)
         sn_array_push(arr, &part);
         p = found + dlen;
         if (*p == '\0') {
-            char *empty = strdup("");
+            char *empty = sn_strdup("");
             sn_array_push(arr, &empty);
         }
     }
@@ -123,13 +123,13 @@ SnArray *sn_str_split_limit(const char *s, const char *delim, long long limit)
     const char *p = s;
     while (*p) {
         if ((long long)arr->len >= limit - 1) {
-            char *part = strdup(p);
+            char *part = sn_strdup(p);
             sn_array_push(arr, &part);
             return arr;
         }
         const char *found = strstr(p, delim);
         if (!found) {
-            char *part = strdup(p);
+            char *part = sn_strdup(p);
             sn_array_push(arr, &part);
             break;
         }
@@ -140,7 +140,7 @@ SnArray *sn_str_split_limit(const char *s, const char *delim, long long limit)
         sn_array_push(arr, &part);
         p = found + dlen;
         if (*p == '\0') {
-            char *empty = strdup("");
+            char *empty = sn_strdup("");
             sn_array_push(arr, &empty);
         }
     }
@@ -196,11 +196,11 @@ SnArray *sn_str_split_whitespace(const char *s)
 
 char *sn_str_substring(const char *s, long long start, long long end)
 {
-    if (!s) return strdup("");
+    if (!s) return sn_strdup("");
     long long slen = (long long)strlen(s);
     if (start < 0) start = 0;
     if (end > slen) end = slen;
-    if (start >= end) return strdup("");
+    if (start >= end) return sn_strdup("");
     size_t len = (size_t)(end - start);
     char *result = sn_malloc(len + 1);
     memcpy(result, s + start, len);
@@ -210,8 +210,8 @@ char *sn_str_substring(const char *s, long long start, long long end)
 
 char *sn_str_replace(const char *s, const char *old_s, const char *new_s)
 {
-    if (!s) return strdup("");
-    if (!old_s || old_s[0] == '\0') return strdup(s);
+    if (!s) return sn_strdup("");
+    if (!old_s || old_s[0] == '\0') return sn_strdup(s);
     if (!new_s) new_s = "";
     size_t olen = strlen(old_s);
     size_t nlen = strlen(new_s);
@@ -247,7 +247,7 @@ char *sn_str_replace(const char *s, const char *old_s, const char *new_s)
 
 char *sn_str_to_upper(const char *s)
 {
-    if (!s) return strdup("");
+    if (!s) return sn_strdup("");
     size_t len = strlen(s);
     char *result = sn_malloc(len + 1);
     for (size_t i = 0; i < len; i++) result[i] = (char)toupper((unsigned char)s[i]);
@@ -257,7 +257,7 @@ char *sn_str_to_upper(const char *s)
 
 char *sn_str_to_lower(const char *s)
 {
-    if (!s) return strdup("");
+    if (!s) return sn_strdup("");
     size_t len = strlen(s);
     char *result = sn_malloc(len + 1);
     for (size_t i = 0; i < len; i++) result[i] = (char)tolower((unsigned char)s[i]);
@@ -267,9 +267,9 @@ char *sn_str_to_lower(const char *s)
 
 char *sn_str_trim(const char *s)
 {
-    if (!s) return strdup("");
+    if (!s) return sn_strdup("");
     while (*s && isspace((unsigned char)*s)) s++;
-    if (*s == '\0') return strdup("");
+    if (*s == '\0') return sn_strdup("");
     const char *end = s + strlen(s) - 1;
     while (end > s && isspace((unsigned char)*end)) end--;
     size_t len = (size_t)(end - s + 1);
@@ -0,0 +1,219 @@
+#include "sn_task_group.h"
+#include <time.h>
+
+/* Stored in a task's group link once it has finished */
+static char sn_task_group_finished_mark;
+#define SN_TASK_GROUP_FINISHED ((void *)&sn_task_group_finished_mark)
+
+static long long sn_task_group_now_ms(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+SnTaskGroup *sn_task_group_new(size_t elem_size, enum SnElemTag tag,
+                               void (*elem_release)(void *))
+{
+    SnTaskGroup *g = sn_calloc(1, sizeof(SnTaskGroup));
+    g->__rc__ = 1;
+    g->elem_size = elem_size;
+    g->elem_tag = tag;
+    g->elem_release = elem_release;
+    atomic_init(&g->cancelled, 0);
+    atomic_init(&g->deadline, 0);
+    pthread_mutex_init(&g->lock, NULL);
+    pthread_cond_init(&g->done_cond, NULL);
+    return g;
+}
+
+/* Only the last reference frees the group, but tasks may still be running */
+void sn_task_group_free(SnTaskGroup *g)
+{
+    if (!g) return;
+    /* Cut the unfinished tasks loose first: they release their own results */
+    for (long long i = 0; i < g->task_count; i++) {
+        SnThread *t = g->tasks[i];
+        void *expected = g;
+        t->result_release = g->elem_release;
+        if (atomic_compare_exchange_strong(&t->group, &expected, NULL)) {
+            if (!t->pooled && !t->joined) pthread_detach(t->thread);
+            t->joined = 1;
+        } else {
+            t->result_release = NULL;
+        }
+    }
+    /* Joining the rest waits out their appends to the completion list, which
+     * write to whichever task was last on it */
+    for (long long i = 0; i < g->task_count; i++) {
+        if (!g->tasks[i]->joined) sn_thread_join(g->tasks[i]);
+    }
+    for (long long i = 0; i < g->task_count; i++) {
+        SnThread *t = g->tasks[i];
+        if (!t->result_release && g->elem_release && t->result) g->elem_release(t->result);
+        sn_thread_release(t);
+    }
+    pthread_mutex_destroy(&g->lock);
+    pthread_cond_destroy(&g->done_cond);
+    sn_sys_free(g->tasks);
+    sn_free(g);
+}
+
+/* Caller holds g->lock */
+static void sn_task_group_push_done(SnTaskGroup *g, SnThread *t)
+{
+    t->next_done = NULL;
+    if (g->done_tail) g->done_tail->next_done = t;
+    else g->done_head = t;
+    g->done_tail = t;
+    pthread_cond_broadcast(&g->done_cond);
+}
+
+void sn_task_group_finished(SnThread *t)
+{
+    SnTaskGroup *g = atomic_exchange(&t->group, SN_TASK_GROUP_FINISHED);
+    if (!g) return;
+    pthread_mutex_lock(&g->lock);
+    sn_task_group_push_done(g, t);
+    pthread_mutex_unlock(&g->lock);
+}
+
+void sn_task_group_add(SnTaskGroup *g, SnThread *t)
+{
+    pthread_mutex_lock(&g->lock);
+    if (g->task_count == g->task_cap) {
+        g->task_cap = g->task_cap ? g->task_cap * 2 : 8;
+        g->tasks = sn_sys_realloc(g->tasks, sizeof(SnThread *) * (size_t)g->task_cap);
+    }
+    g->tasks[g->task_count++] = t;
+    void *expected = NULL;
+    if (!atomic_compare_exchange_strong(&t->group, &expected, g))
+        sn_task_group_push_done(g, t);
+    pthread_mutex_unlock(&g->lock);
+}
+
+/* Caller holds g->lock */
+static void sn_task_group_forget(SnTaskGroup *g, SnThread *t)
+{
+    for (long long i = 0; i < g->task_count; i++) {
+        if (g->tasks[i] == t) {
+            g->tasks[i] = g->tasks[--g->task_count];
+            return;
+        }
+    }
+}
+
+/* Caller holds g->lock and nothing has finished.  When a single task is
+ * left the waiter needs exactly that one, so, as sn_pool_join does, it runs
+ * the task itself if no worker has started it (with the lock dropped
+ * meanwhile).  With several left it only sleeps: any of them may need
+ * something the waiter does after the wait returns (close a channel, leave
+ * a lock block), and running that one inline would never return.  Returns
+ * false if nothing was run. */
+static bool sn_task_group_help(SnTaskGroup *g)
+{
+#if SN_POOL_AVAILABLE
+    if (g->task_count != 1)
+        return false;
+    SnThread *t = g->tasks[0];
+    if (!t->pooled || atomic_load(&t->state) != SN_TASK_PENDING)
+        return false;
+    atomic_fetch_add(&t->refcount, 1);
+    pthread_mutex_unlock(&g->lock);
+    bool ran = sn_pool_try_run(t);
+    sn_thread_release(t);
+    pthread_mutex_lock(&g->lock);
+    return ran;
+#else
+    (void)g;
+#endif
+    return false;
+}
+
+bool sn_task_group_next(SnTaskGroup *g, void *dst)
+{
+    pthread_mutex_lock(&g->lock);
+    for (;;) {
+        SnThread *t = g->done_head;
+        if (t) {
+            g->done_head = t->next_done;
+            if (!g->done_head) g->done_tail = NULL;
+            sn_task_group_forget(g, t);
+            pthread_mutex_unlock(&g->lock);
+            /* Reaps an OS thread; a pool task is already past its wrapper */
+            sn_thread_join(t);
+            memcpy(dst, t->result, g->elem_size);
+            sn_sys_free(t->result);
+            t->result = NULL;
+            sn_thread_release(t);
+            return true;
+        }
+        if (g->task_count == 0 || sn_task_group_is_cancelled(g))
+            break;
+        if (sn_task_group_help(g))
+            continue;
+
+        long long deadline = atomic_load(&g->deadline);
+        if (deadline) {
+            struct timespec ts = { (time_t)(deadline / 1000), (long)(deadline % 1000) * 1000000L };
+            pthread_cond_timedwait(&g->done_cond, &g->lock, &ts);
+        } else {
+            pthread_cond_wait(&g->done_cond, &g->lock);
+        }
+    }
+    pthread_mutex_unlock(&g->lock);
+    return false;
+}
+
+void sn_task_group_wait_any(SnTaskGroup *g, void *dst)
+{
+    if (sn_task_group_next(g, dst)) return;
+    if (sn_task_group_is_cancelled(g))
+        sn_panic("waitAny on cancelled task group");
+    sn_panic("waitAny on task group with no tasks left");
+}
+
+void sn_task_group_cancel(SnTaskGroup *g)
+{
+    atomic_store(&g->cancelled, 1);
+    pthread_mutex_lock(&g->lock);
+    pthread_cond_broadcast(&g->done_cond);
+    pthread_mutex_unlock(&g->lock);
+}
+
+/* Waiters sleep no later than the deadline, so they notice it themselves
+ * and nobody needs to be woken when it passes */
+bool sn_task_group_is_cancelled(SnTaskGroup *g)
+{
+    if (atomic_load(&g->cancelled)) return true;
+    long long deadline = atomic_load(&g->deadline);
+    if (deadline && sn_task_group_now_ms() >= deadline) {
+        atomic_store(&g->cancelled, 1);
+        return true;
+    }
+    return false;
+}
+
+void sn_task_group_set_deadline(SnTaskGroup *g, long long ms)
+{
+    atomic_store(&g->deadline, sn_task_group_now_ms() + (ms > 0 ? ms : 0));
+    pthread_mutex_lock(&g->lock);
+    pthread_cond_broadcast(&g->done_cond);
+    pthread_mutex_unlock(&g->lock);
+}
+
+long long sn_task_group_pending(SnTaskGroup *g)
+{
+    pthread_mutex_lock(&g->lock);
+    long long n = g->task_count;
+    pthread_mutex_unlock(&g->lock);
+    return n;
+}
+
+char *sn_task_group_to_string(SnTaskGroup *g)
+{
+    char buf[96];
+    snprintf(buf, sizeof(buf), "taskgroup(%lld pending%s)", sn_task_group_pending(g),
+             sn_task_group_is_cancelled(g) ? ", cancelled" : "");
+    return sn_strdup(buf);
+}
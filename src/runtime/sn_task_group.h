@@ -0,0 +1,74 @@
+#ifndef SN_TASK_GROUP_H
+#define SN_TASK_GROUP_H
+
+#include "sn_thread.h"
+#include "sn_array.h"
+
+/*
+ * Built-in taskgroup<T>: spawned tasks collected in the order they finish.
+ *
+ * `g.add(&f())` hands the spawn's handle to the group.  When a task's wrapper
+ * has stored its result, the thread that ran it swaps the task's group link
+ * for a "finished" marker and, if a group was there, appends the task to the
+ * group's completion list and wakes its waiters.  add does the same swap the
+ * other way round, so a task that finishes before it is added goes straight
+ * onto the list.
+ *
+ * waitAny takes the oldest finished task, moves its result out and drops the
+ * handle.  With nothing finished it first runs a group task that no worker
+ * has picked up yet on the calling thread, and only then sleeps on the
+ * group's condition variable, so a waiter never idles while its own work
+ * sits in a queue.
+ *
+ * Cancellation is cooperative: cancel() only raises a flag that waits and
+ * tasks (which take the group as an argument) can check.  A deadline set
+ * with setDeadline cancels the group once it passes.  Waits still hand out
+ * results that finished before the cancel; after that they stop.
+ *
+ * Dropping the last reference does not wait: unfinished tasks are cut loose
+ * and release their own results, finished but uncollected results are
+ * released with elem_release.
+ */
+
+typedef struct {
+    int __rc__;                 /* must stay first: generated as-ref code reads it */
+    size_t elem_size;
+    void (*elem_release)(void *);
+    enum SnElemTag elem_tag;
+    pthread_mutex_t lock;
+    pthread_cond_t done_cond;
+    SnThread **tasks;           /* added and not yet collected */
+    long long task_count;
+    long long task_cap;
+    SnThread *done_head;        /* finished, oldest first */
+    SnThread *done_tail;
+    _Atomic int cancelled;
+    _Atomic long long deadline; /* TIME_UTC milliseconds, 0 for none */
+} SnTaskGroup;
+
+SnTaskGroup *sn_task_group_new(size_t elem_size, enum SnElemTag tag,
+                               void (*elem_release)(void *));
+void sn_task_group_free(SnTaskGroup *g);
+
+/* Takes over the caller's reference to t */
+void sn_task_group_add(SnTaskGroup *g, SnThread *t);
+
+/* Moves the result of the next task to finish into dst.  Returns false
+ * without blocking once nothing is left to wait for, and when the group is
+ * cancelled (or past its deadline) and nothing has finished yet.
+ * wait_any panics instead of returning false. */
+bool sn_task_group_next(SnTaskGroup *g, void *dst);
+void sn_task_group_wait_any(SnTaskGroup *g, void *dst);
+
+void sn_task_group_cancel(SnTaskGroup *g);
+bool sn_task_group_is_cancelled(SnTaskGroup *g);
+
+/* Cancels the group `ms` milliseconds from now */
+void sn_task_group_set_deadline(SnTaskGroup *g, long long ms);
+
+/* Tasks added and not yet collected; a snapshot while other threads are active */
+long long sn_task_group_pending(SnTaskGroup *g);
+
+char *sn_task_group_to_string(SnTaskGroup *g);
+
+#endif
@@ -0,0 +1,145 @@
+#include "sn_core.h"
+
+/* Like the slab, the allocator is compiled into the runtime library wherever
+ * it is available; programs decide at startup whether to enable it (see
+ * sn_tcache.h). */
+
+#if SN_TCACHE_AVAILABLE
+
+#include <pthread.h>
+#include <sys/mman.h>
+
+#if UINTPTR_MAX > 0xFFFFFFFFu
+#define SN_TCACHE_RESERVE ((size_t)64 << 30)
+#else
+#define SN_TCACHE_RESERVE ((size_t)256 << 20)
+#endif
+
+bool sn_tcache_on = false;
+uintptr_t sn_tcache_base = 0;
+size_t sn_tcache_reserved = 0;
+__thread SnTcacheHeap *sn_tcache_tls = NULL;
+
+static size_t sn_tcache_next_span = 0;    /* offset of the next unused span, atomic */
+static pthread_key_t sn_tcache_key;
+static pthread_mutex_t sn_tcache_orphan_lock = PTHREAD_MUTEX_INITIALIZER;
+static SnTcacheHeap *sn_tcache_orphans = NULL;
+
+/* Thread exit: park the heap for the next thread (see sn_slab_thread_exit) */
+static void sn_tcache_thread_exit(void *arg)
+{
+    SnTcacheHeap *h = arg;
+    sn_tcache_tls = NULL;
+    pthread_mutex_lock(&sn_tcache_orphan_lock);
+    h->next_orphan = sn_tcache_orphans;
+    sn_tcache_orphans = h;
+    pthread_mutex_unlock(&sn_tcache_orphan_lock);
+}
+
+/* Called from constructors before main, so there is only one thread.  The
+ * range is reserved without access rights; spans are committed as they are
+ * handed out.  If the reservation fails the program simply stays on libc. */
+void sn_tcache_enable(void)
+{
+    if (sn_tcache_on) return;
+
+    void *mem = mmap(NULL, SN_TCACHE_RESERVE + SN_TCACHE_SPAN_SIZE, PROT_NONE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mem == MAP_FAILED) return;
+    if (pthread_key_create(&sn_tcache_key, sn_tcache_thread_exit) != 0) {
+        munmap(mem, SN_TCACHE_RESERVE + SN_TCACHE_SPAN_SIZE);
+        return;
+    }
+
+    sn_tcache_base = ((uintptr_t)mem + SN_TCACHE_SPAN_SIZE - 1) & ~(uintptr_t)(SN_TCACHE_SPAN_SIZE - 1);
+    sn_tcache_reserved = SN_TCACHE_RESERVE;
+    sn_tcache_on = true;
+}
+
+/* The heaps themselves come from libc, since the allocator cannot serve its
+ * own bookkeeping */
+static SnTcacheHeap *sn_tcache_heap(void)
+{
+    SnTcacheHeap *h = sn_tcache_tls;
+    if (h) return h;
+
+    pthread_mutex_lock(&sn_tcache_orphan_lock);
+    h = sn_tcache_orphans;
+    if (h) sn_tcache_orphans = h->next_orphan;
+    pthread_mutex_unlock(&sn_tcache_orphan_lock);
+
+    if (h) h->next_orphan = NULL;
+    else if (!(h = calloc(1, sizeof(SnTcacheHeap)))) return NULL;
+
+    sn_tcache_tls = h;
+    pthread_setspecific(sn_tcache_key, h);
+    return h;
+}
+
+static char *sn_tcache_new_span(SnTcacheHeap *h, unsigned cls)
+{
+    size_t off = __atomic_fetch_add(&sn_tcache_next_span, SN_TCACHE_SPAN_SIZE, __ATOMIC_RELAXED);
+    if (off >= sn_tcache_reserved) return NULL;
+
+    char *span = (char *)(sn_tcache_base + off);
+    if (mprotect(span, SN_TCACHE_SPAN_SIZE, PROT_READ | PROT_WRITE) != 0) return NULL;
+    ((SnTcacheSpan *)span)->owner = h;
+    ((SnTcacheSpan *)span)->cls = cls;
+    return span;
+}
+
+/* NULL sends the caller to libc: no heap could be set up or the reserved
+ * range is exhausted */
+void *sn_tcache_alloc_slow(unsigned cls)
+{
+    SnTcacheHeap *h = sn_tcache_heap();
+    if (!h) return NULL;
+
+    /* Reclaim everything other threads have released back to this heap */
+    SnTcacheFree *f = h->free[cls];
+    if (!f)
+        f = __atomic_exchange_n(&h->remote[cls], NULL, __ATOMIC_ACQUIRE);
+    if (f) {
+        h->free[cls] = f->next;
+        return f;
+    }
+
+    size_t block = sn_tcache_class_size(cls);
+    if (!h->bump[cls] || h->bump[cls] + block > h->bump_end[cls]) {
+        char *span = sn_tcache_new_span(h, cls);
+        if (!span) return NULL;
+        h->bump[cls] = span + SN_TCACHE_GRAIN;
+        h->bump_end[cls] = span + SN_TCACHE_SPAN_SIZE;
+    }
+    void *p = h->bump[cls];
+    h->bump[cls] += block;
+    return p;
+}
+
+void sn_tcache_free_remote(SnTcacheHeap *owner, void *p, unsigned cls)
+{
+    SnTcacheFree *f = p;
+    f->next = __atomic_load_n(&owner->remote[cls], __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&owner->remote[cls], &f->next, f, true,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+}
+
+/* A block keeps its slot while the new size still fits its class */
+void *sn_tcache_realloc(void *p, size_t size)
+{
+    if (size == 0) {
+        sn_tcache_free(p);
+        return NULL;
+    }
+    size_t old = sn_tcache_class_size(sn_tcache_span(p)->cls);
+    if (size <= old) return p;
+
+    void *q = sn_tcache_malloc(size);
+    if (!q) return NULL;
+    memcpy(q, p, old);
+    sn_tcache_free(p);
+    return q;
+}
+
+#endif
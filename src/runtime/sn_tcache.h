@@ -0,0 +1,176 @@
+#ifndef SN_TCACHE_H
+#define SN_TCACHE_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Heap interface and the built-in thread-caching allocator (--alloc=tcache).
+ *
+ * Every heap allocation the runtime and generated code make ends up in
+ * sn_heap_malloc / sn_heap_calloc / sn_heap_realloc / sn_heap_free (through
+ * the OOM-checked wrappers in sn_core.h).  By default they are libc.
+ *
+ * With the allocator switched on, requests up to SN_TCACHE_MAX_SIZE bytes are
+ * rounded to one of SN_TCACHE_CLASSES size classes (16-byte steps up to 256,
+ * then four classes per power of two).  Each thread owns a heap with one
+ * freelist and one bump span per class, so a malloc/free pair on the same
+ * thread takes no lock and touches no shared cache line.  As in the as-ref
+ * slab (sn_slab.h), a free on another thread pushes onto the owning heap's
+ * per-class remote stack, and heaps of exited threads are adopted by new ones.
+ *
+ * Spans are SN_TCACHE_SPAN_SIZE-aligned slices of one address range reserved
+ * at startup, and begin with their owner and size class.  Telling an
+ * allocator block from a libc one is therefore a bounds check, so
+ * sn_heap_free and sn_heap_realloc accept pointers from either; memory a
+ * native library returns with malloc/strdup can still be released by the
+ * runtime.  Larger requests, and everything once the range is used up, go to
+ * libc.
+ *
+ * The runtime library always contains the allocator.  Programs compiled with
+ * --alloc=tcache (SN_ALLOC_TCACHE) turn it on from a constructor before main.
+ * AddressSanitizer builds (sn -g) and --alloc=system ignore the setting, and
+ * platforms without mmap and TLS never build it.
+ */
+
+#define SN_TCACHE_GRAIN      16
+#define SN_TCACHE_MAX_SIZE   (32 * 1024)
+#define SN_TCACHE_CLASSES    44
+#define SN_TCACHE_SPAN_SIZE  (256 * 1024)
+
+#if defined(_WIN32) || defined(__TINYC__) || defined(_MSC_VER)
+
+#define SN_TCACHE_AVAILABLE 0
+
+#define sn_heap_malloc(size) malloc(size)
+#define sn_heap_calloc(n, size) calloc((n), (size))
+#define sn_heap_realloc(p, size) realloc((p), (size))
+#define sn_heap_free(p) free(p)
+
+#else
+
+#define SN_TCACHE_AVAILABLE 1
+
+typedef struct SnTcacheFree {
+    struct SnTcacheFree *next;
+} SnTcacheFree;
+
+typedef struct SnTcacheHeap {
+    SnTcacheFree *free[SN_TCACHE_CLASSES];     /* owner-only */
+    char *bump[SN_TCACHE_CLASSES];             /* next unused block in the class span */
+    char *bump_end[SN_TCACHE_CLASSES];
+    SnTcacheFree *remote[SN_TCACHE_CLASSES];   /* pushed by other threads, atomic */
+    struct SnTcacheHeap *next_orphan;
+} SnTcacheHeap;
+
+/* Header at the start of every span; blocks begin SN_TCACHE_GRAIN bytes in */
+typedef struct {
+    SnTcacheHeap *owner;
+    unsigned cls;
+} SnTcacheSpan;
+
+extern bool sn_tcache_on;
+extern uintptr_t sn_tcache_base;           /* reserved range, 0 until enabled */
+extern size_t sn_tcache_reserved;
+extern __thread SnTcacheHeap *sn_tcache_tls;
+
+void sn_tcache_enable(void);
+void *sn_tcache_alloc_slow(unsigned cls);
+void sn_tcache_free_remote(SnTcacheHeap *owner, void *p, unsigned cls);
+void *sn_tcache_realloc(void *p, size_t size);
+
+/* size must be in 1..SN_TCACHE_MAX_SIZE */
+static inline unsigned sn_tcache_class(size_t size)
+{
+    if (size <= 256) return (unsigned)((size - 1) / SN_TCACHE_GRAIN);
+    size_t s = size - 1;
+    unsigned b = 63 - (unsigned)__builtin_clzll((unsigned long long)s);
+    return 16 + (b - 8) * 4 + (unsigned)((s >> (b - 2)) & 3);
+}
+
+static inline size_t sn_tcache_class_size(unsigned cls)
+{
+    if (cls < 16) return (size_t)(cls + 1) * SN_TCACHE_GRAIN;
+    unsigned b = 8 + (cls - 16) / 4;
+    return (size_t)(5 + (cls - 16) % 4) << (b - 2);
+}
+
+static inline bool sn_tcache_owns(const void *p)
+{
+    return (uintptr_t)p - sn_tcache_base < sn_tcache_reserved;
+}
+
+static inline SnTcacheSpan *sn_tcache_span(const void *p)
+{
+    return (SnTcacheSpan *)((uintptr_t)p & ~(uintptr_t)(SN_TCACHE_SPAN_SIZE - 1));
+}
+
+/* size - 1 wraps for size 0, which (like large requests) goes to malloc */
+static inline void *sn_tcache_malloc(size_t size)
+{
+    if (size - 1 < SN_TCACHE_MAX_SIZE) {
+        SnTcacheHeap *h = sn_tcache_tls;
+        unsigned cls = sn_tcache_class(size);
+        if (h && h->free[cls]) {
+            SnTcacheFree *f = h->free[cls];
+            h->free[cls] = f->next;
+            return f;
+        }
+        void *p = sn_tcache_alloc_slow(cls);
+        if (p) return p;
+    }
+    return malloc(size);
+}
+
+/* p must be owned by the allocator (sn_tcache_owns) */
+static inline void sn_tcache_free(void *p)
+{
+    SnTcacheSpan *span = sn_tcache_span(p);
+    SnTcacheHeap *h = sn_tcache_tls;
+    if (span->owner == h) {
+        SnTcacheFree *f = p;
+        f->next = h->free[span->cls];
+        h->free[span->cls] = f;
+    } else {
+        sn_tcache_free_remote(span->owner, p, span->cls);
+    }
+}
+
+static inline void *sn_heap_malloc(size_t size)
+{
+    return sn_tcache_on ? sn_tcache_malloc(size) : malloc(size);
+}
+
+static inline void *sn_heap_calloc(size_t n, size_t size)
+{
+    size_t total;
+    if (!sn_tcache_on || __builtin_mul_overflow(n, size, &total) || total > SN_TCACHE_MAX_SIZE)
+        return calloc(n, size);
+    void *p = sn_tcache_malloc(total);
+    return p ? memset(p, 0, total) : NULL;
+}
+
+static inline void *sn_heap_realloc(void *p, size_t size)
+{
+    if (sn_tcache_owns(p)) return sn_tcache_realloc(p, size);
+    if (!p && sn_tcache_on) return sn_tcache_malloc(size);
+    return realloc(p, size);
+}
+
+static inline void sn_heap_free(void *p)
+{
+    if (sn_tcache_owns(p)) sn_tcache_free(p);
+    else free(p);
+}
+
+#if defined(SN_ALLOC_TCACHE) && !defined(SN_ALLOC_SYSTEM) && !defined(SN_ASAN_ACTIVE)
+/* One copy per translation unit; sn_tcache_enable runs only once */
+__attribute__((constructor)) static void sn_tcache_select(void) { sn_tcache_enable(); }
+#endif
+
+#endif
+
+#endif
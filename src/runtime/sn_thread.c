@@ -0,0 +1,556 @@
+#include "sn_core.h"
+#include "sn_thread.h"
+
+/*
+ * Worker pool behind the `&` spawn operator.
+ *
+ * The pool starts with the first spawn: one worker per online CPU (at least
+ * two, or SN_POOL_THREADS), each owning a fixed-size Chase-Lev deque.  A task
+ * spawned on a worker is pushed onto that worker's deque and popped LIFO by
+ * its owner; idle workers steal FIFO from the other end.  Spawns from other
+ * threads, and pushes onto a full deque, go to a shared injection queue.
+ *
+ * Joining (`!` or scope exit) runs the task on the joining thread if nobody
+ * has started it yet, and otherwise helps with queued tasks until it is done,
+ * sleeping only when there is nothing to run.  The task state is claimed
+ * with a CAS, so a queue entry whose task was already run by its joiner (or
+ * moved to its own thread by `~`) is simply dropped.
+ *
+ * Tasks may block (locks, I/O, spinning on a sync variable), so a monitor
+ * thread adds a worker whenever tasks are queued, no worker is idle and no
+ * task has finished for SN_POOL_STALL_MS, up to SN_POOL_MAX_WORKERS.
+ *
+ * Tasks always start with no arena region active, like a fresh thread.
+ */
+
+/* ---- Thread-local cleanup ---- */
+
+/* Set by main before it can start any thread */
+static void (*sn_thread_local_cleanup)(void) = NULL;
+
+void sn_thread_local_hook(void (*cleanup)(void))
+{
+    sn_thread_local_cleanup = cleanup;
+}
+
+void sn_thread_local_exit(void)
+{
+    if (sn_thread_local_cleanup) sn_thread_local_cleanup();
+}
+
+static void *sn_thread_os_main(void *arg)
+{
+    SnThread *t = arg;
+    /* The wrapper drops its own reference to t; this thread keeps the one
+     * taken by sn_thread_spawn_os until the task group has seen it finish */
+    t->start(t);
+    sn_task_group_finished(t);
+    sn_thread_release(t);
+    sn_thread_local_exit();
+    return NULL;
+}
+
+void sn_thread_spawn_os(SnThread *t, void *(*start)(void *))
+{
+    t->start = start;
+    atomic_fetch_add(&t->refcount, 1);
+    if (pthread_create(&t->thread, NULL, sn_thread_os_main, t) != 0)
+        atomic_fetch_sub(&t->refcount, 1);
+}
+
+#if SN_POOL_AVAILABLE
+
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SN_POOL_DEQUE_SIZE   1024
+#define SN_POOL_MAX_WORKERS  256
+#define SN_POOL_STALL_MS     10
+
+typedef struct {
+    _Atomic long top;                       /* thieves take from here */
+    char pad0[64 - sizeof(long)];
+    _Atomic long bottom;                    /* owner pushes and pops here */
+    char pad1[64 - sizeof(long)];
+    _Atomic(SnThread *) slots[SN_POOL_DEQUE_SIZE];
+} SnPoolWorker;
+
+static SnPoolWorker *sn_pool_workers[SN_POOL_MAX_WORKERS];
+static _Atomic int sn_pool_nworkers = 0;
+static __thread SnPoolWorker *sn_pool_self = NULL;
+static __thread unsigned sn_pool_rng = 0;
+
+static pthread_once_t sn_pool_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t sn_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sn_pool_work_cond = PTHREAD_COND_INITIALIZER;     /* idle workers */
+static pthread_cond_t sn_pool_done_cond = PTHREAD_COND_INITIALIZER;     /* blocked joiners */
+static pthread_cond_t sn_pool_monitor_cond = PTHREAD_COND_INITIALIZER;
+
+static pthread_mutex_t sn_pool_inject_lock = PTHREAD_MUTEX_INITIALIZER;
+static SnThread *sn_pool_inject_head = NULL;
+static SnThread *sn_pool_inject_tail = NULL;
+
+static _Atomic long sn_pool_pending = 0;    /* queue entries, including already claimed ones */
+static _Atomic long sn_pool_completed = 0;
+static _Atomic int sn_pool_sleepers = 0;
+static _Atomic int sn_pool_joiners = 0;
+static _Atomic int sn_pool_monitor_idle = 0;
+
+/* ---- Deques ---- */
+
+static bool sn_pool_push(SnPoolWorker *w, SnThread *t)
+{
+    long b = atomic_load_explicit(&w->bottom, memory_order_relaxed);
+    long top = atomic_load_explicit(&w->top, memory_order_acquire);
+    if (b - top >= SN_POOL_DEQUE_SIZE) return false;
+    atomic_store_explicit(&w->slots[b & (SN_POOL_DEQUE_SIZE - 1)], t, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&w->bottom, b + 1, memory_order_relaxed);
+    return true;
+}
+
+static SnThread *sn_pool_take(SnPoolWorker *w)
+{
+    long b = atomic_load_explicit(&w->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&w->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long top = atomic_load_explicit(&w->top, memory_order_relaxed);
+    if (top > b) {
+        atomic_store_explicit(&w->bottom, b + 1, memory_order_relaxed);
+        return NULL;
+    }
+    SnThread *t = atomic_load_explicit(&w->slots[b & (SN_POOL_DEQUE_SIZE - 1)], memory_order_relaxed);
+    if (top == b) {
+        /* Last entry: race the thieves for it */
+        if (!atomic_compare_exchange_strong_explicit(&w->top, &top, top + 1,
+                                                     memory_order_seq_cst, memory_order_relaxed))
+            t = NULL;
+        atomic_store_explicit(&w->bottom, b + 1, memory_order_relaxed);
+    }
+    return t;
+}
+
+static SnThread *sn_pool_steal(SnPoolWorker *w)
+{
+    long top = atomic_load_explicit(&w->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long b = atomic_load_explicit(&w->bottom, memory_order_acquire);
+    if (top >= b) return NULL;
+    SnThread *t = atomic_load_explicit(&w->slots[top & (SN_POOL_DEQUE_SIZE - 1)], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&w->top, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed))
+        return NULL;
+    return t;
+}
+
+static void sn_pool_inject(SnThread *t)
+{
+    t->next_task = NULL;
+    pthread_mutex_lock(&sn_pool_inject_lock);
+    if (sn_pool_inject_tail) sn_pool_inject_tail->next_task = t;
+    else sn_pool_inject_head = t;
+    sn_pool_inject_tail = t;
+    pthread_mutex_unlock(&sn_pool_inject_lock);
+}
+
+static SnThread *sn_pool_uninject(void)
+{
+    pthread_mutex_lock(&sn_pool_inject_lock);
+    SnThread *t = sn_pool_inject_head;
+    if (t) {
+        sn_pool_inject_head = t->next_task;
+        if (!sn_pool_inject_head) sn_pool_inject_tail = NULL;
+    }
+    pthread_mutex_unlock(&sn_pool_inject_lock);
+    return t;
+}
+
+/* Own deque first, then the injection queue, then the other workers
+ * starting from a random one */
+static SnThread *sn_pool_find(void)
+{
+    SnThread *t;
+    if (sn_pool_self && (t = sn_pool_take(sn_pool_self))) return t;
+    if (atomic_load(&sn_pool_pending) <= 0) return NULL;
+    if ((t = sn_pool_uninject())) return t;
+
+    int n = atomic_load_explicit(&sn_pool_nworkers, memory_order_acquire);
+    if (n == 0) return NULL;
+    if (!sn_pool_rng) sn_pool_rng = (unsigned)(uintptr_t)&sn_pool_rng | 1u;
+    sn_pool_rng ^= sn_pool_rng << 13;
+    sn_pool_rng ^= sn_pool_rng >> 17;
+    sn_pool_rng ^= sn_pool_rng << 5;
+    for (int i = 0, start = (int)(sn_pool_rng % (unsigned)n); i < n; i++) {
+        SnPoolWorker *w = sn_pool_workers[(start + i) % n];
+        if (w != sn_pool_self && (t = sn_pool_steal(w))) return t;
+    }
+    return NULL;
+}
+
+/* ---- Running tasks ---- */
+
+static void sn_pool_run(SnThread *t)
+{
+#if SN_REGION_ENABLED
+    SnRegion *region = sn_region_tls;
+    sn_region_tls = NULL;
+#endif
+    t->start(t);
+#if SN_REGION_ENABLED
+    sn_region_tls = region;
+#endif
+    sn_task_group_finished(t);
+    atomic_store(&t->state, SN_TASK_DONE);
+    atomic_fetch_add(&sn_pool_completed, 1);
+    if (atomic_load(&sn_pool_joiners) > 0) {
+        pthread_mutex_lock(&sn_pool_lock);
+        pthread_cond_broadcast(&sn_pool_done_cond);
+        pthread_mutex_unlock(&sn_pool_lock);
+    }
+}
+
+/* Run a task taken off a queue unless someone claimed it first, then drop
+ * the queue's reference */
+static void sn_pool_exec(SnThread *t)
+{
+    atomic_fetch_sub(&sn_pool_pending, 1);
+    int expected = SN_TASK_PENDING;
+    if (atomic_compare_exchange_strong(&t->state, &expected, SN_TASK_RUNNING))
+        sn_pool_run(t);
+    sn_thread_release(t);
+}
+
+bool sn_pool_try_run(SnThread *t)
+{
+    int expected = SN_TASK_PENDING;
+    if (!t->pooled || !atomic_compare_exchange_strong(&t->state, &expected, SN_TASK_RUNNING))
+        return false;
+    sn_pool_run(t);
+    return true;
+}
+
+static void *sn_pool_worker_main(void *arg)
+{
+    sn_pool_self = arg;
+    for (;;) {
+        SnThread *t = sn_pool_find();
+        if (t) {
+            sn_pool_exec(t);
+            continue;
+        }
+        if (atomic_load(&sn_pool_pending) > 0) {
+            /* Entries exist but a steal lost a race; try again */
+            sched_yield();
+            continue;
+        }
+        pthread_mutex_lock(&sn_pool_lock);
+        atomic_fetch_add(&sn_pool_sleepers, 1);
+        while (atomic_load(&sn_pool_pending) <= 0)
+            pthread_cond_wait(&sn_pool_work_cond, &sn_pool_lock);
+        atomic_fetch_sub(&sn_pool_sleepers, 1);
+        pthread_mutex_unlock(&sn_pool_lock);
+    }
+    return NULL;
+}
+
+/* Workers are only added by sn_pool_start and the monitor, never
+ * concurrently */
+static void sn_pool_add_worker(void)
+{
+    int n = atomic_load(&sn_pool_nworkers);
+    if (n >= SN_POOL_MAX_WORKERS) return;
+    SnPoolWorker *w = calloc(1, sizeof(SnPoolWorker));
+    if (!w) return;
+
+    pthread_t th;
+    if (pthread_create(&th, NULL, sn_pool_worker_main, w) != 0) {
+        free(w);
+        return;
+    }
+    pthread_detach(th);
+    sn_pool_workers[n] = w;
+    atomic_store_explicit(&sn_pool_nworkers, n + 1, memory_order_release);
+}
+
+static void *sn_pool_monitor_main(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&sn_pool_lock);
+    for (;;) {
+        /* Announce idleness before the check so a concurrent submit either
+         * sees the flag or is seen here */
+        atomic_store(&sn_pool_monitor_idle, 1);
+        if (atomic_load(&sn_pool_pending) <= 0) {
+            pthread_cond_wait(&sn_pool_monitor_cond, &sn_pool_lock);
+            continue;
+        }
+        atomic_store(&sn_pool_monitor_idle, 0);
+        pthread_mutex_unlock(&sn_pool_lock);
+
+        long done = atomic_load(&sn_pool_completed);
+        struct timespec ts = { 0, SN_POOL_STALL_MS * 1000000L };
+        nanosleep(&ts, NULL);
+        if (atomic_load(&sn_pool_completed) == done && atomic_load(&sn_pool_pending) > 0 &&
+            atomic_load(&sn_pool_sleepers) == 0)
+            sn_pool_add_worker();
+
+        pthread_mutex_lock(&sn_pool_lock);
+    }
+    return NULL;
+}
+
+static void sn_pool_start(void)
+{
+    long n = 0;
+    const char *env = getenv("SN_POOL_THREADS");
+    if (env) n = strtol(env, NULL, 10);
+    if (n <= 0) n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 2) n = 2;
+    if (n > SN_POOL_MAX_WORKERS) n = SN_POOL_MAX_WORKERS;
+    for (long i = 0; i < n; i++)
+        sn_pool_add_worker();
+
+    pthread_t th;
+    if (pthread_create(&th, NULL, sn_pool_monitor_main, NULL) == 0)
+        pthread_detach(th);
+}
+
+/* ---- Spawn, join, detach ---- */
+
+void sn_pool_submit(SnThread *t)
+{
+    pthread_once(&sn_pool_once, sn_pool_start);
+    if (atomic_load(&sn_pool_nworkers) == 0) {
+        /* No worker could be started: fall back to a thread of its own */
+        t->pooled = 0;
+        sn_thread_spawn_os(t, t->start);
+        return;
+    }
+
+    atomic_store(&t->state, SN_TASK_PENDING);
+    atomic_fetch_add(&t->refcount, 1);          /* the queue's reference */
+    atomic_fetch_add(&sn_pool_pending, 1);
+    if (!sn_pool_self || !sn_pool_push(sn_pool_self, t))
+        sn_pool_inject(t);
+
+    if (atomic_load(&sn_pool_sleepers) > 0 || atomic_load(&sn_pool_monitor_idle)) {
+        pthread_mutex_lock(&sn_pool_lock);
+        pthread_cond_signal(&sn_pool_work_cond);
+        pthread_cond_signal(&sn_pool_monitor_cond);
+        pthread_mutex_unlock(&sn_pool_lock);
+    }
+}
+
+void sn_pool_join(SnThread *t)
+{
+    int expected = SN_TASK_PENDING;
+    if (atomic_compare_exchange_strong(&t->state, &expected, SN_TASK_RUNNING)) {
+        sn_pool_run(t);
+        return;
+    }
+
+    /* Someone else is running it: wait.  The joiner does not pick up other
+     * queued tasks meanwhile, since one of them may need something the
+     * joiner only does after the join (close a channel, leave a lock block)
+     * or may clobber its threadlocals.  A worker stuck here does not count
+     * as idle, so the monitor adds one if the queue stops moving. */
+    pthread_mutex_lock(&sn_pool_lock);
+    atomic_fetch_add(&sn_pool_joiners, 1);
+    while (atomic_load(&t->state) != SN_TASK_DONE)
+        pthread_cond_wait(&sn_pool_done_cond, &sn_pool_lock);
+    atomic_fetch_sub(&sn_pool_joiners, 1);
+    pthread_mutex_unlock(&sn_pool_lock);
+}
+
+static void *sn_pool_detached_main(void *arg)
+{
+    SnThread *t = arg;
+    sn_pool_run(t);
+    sn_thread_release(t);
+    sn_thread_local_exit();
+    return NULL;
+}
+
+void sn_pool_detach(SnThread *t)
+{
+    int expected = SN_TASK_PENDING;
+    if (!atomic_compare_exchange_strong(&t->state, &expected, SN_TASK_RUNNING))
+        return;
+
+    atomic_fetch_add(&t->refcount, 1);
+    pthread_t th;
+    if (pthread_create(&th, NULL, sn_pool_detached_main, t) == 0) {
+        pthread_detach(th);
+        return;
+    }
+    /* No thread to be had: queue it again, the new reference going to the
+     * queue (the old entry may already have been dropped) */
+    atomic_store(&t->state, SN_TASK_PENDING);
+    atomic_fetch_add(&sn_pool_pending, 1);
+    sn_pool_inject(t);
+}
+
+#endif
+
+/* ---- Parallel for-loops ---- */
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#define SN_PARALLEL_MAX_WIDTH 256
+
+typedef struct {
+    long long lo, hi;
+    long long chunk;
+    long long nchunks;              /* static schedule */
+    int schedule;
+    int width;
+    int parts;                      /* participants that get work */
+    SnParallelBody body;
+    void *ctx;
+    _Atomic int next_part;
+    _Atomic long long next;         /* guided: first unclaimed iteration */
+} SnParallelLoop;
+
+static int sn_parallel_width(int pooled)
+{
+    long n = 0;
+#if SN_POOL_AVAILABLE
+    if (pooled) {
+        pthread_once(&sn_pool_once, sn_pool_start);
+        n = atomic_load(&sn_pool_nworkers);
+    }
+#else
+    (void)pooled;
+#endif
+    if (n <= 0) {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        n = (long)info.dwNumberOfProcessors;
+#else
+        n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    }
+    if (n < 1) n = 1;
+    if (n > SN_PARALLEL_MAX_WIDTH) n = SN_PARALLEL_MAX_WIDTH;
+    return (int)n;
+}
+
+static void sn_parallel_part(SnParallelLoop *loop, int part)
+{
+    if (loop->schedule == SN_SCHEDULE_GUIDED) {
+        long long lo = atomic_load(&loop->next);
+        while (lo < loop->hi) {
+            long long size = (loop->hi - lo) / (2 * loop->width);
+            if (size < loop->chunk) size = loop->chunk;
+            if (size > loop->hi - lo) size = loop->hi - lo;
+            if (atomic_compare_exchange_weak(&loop->next, &lo, lo + size)) {
+                loop->body(loop->ctx, lo, lo + size);
+                lo = atomic_load(&loop->next);
+            }
+        }
+        return;
+    }
+    for (long long c = part; c < loop->nchunks; c += loop->parts) {
+        long long lo = loop->lo + c * loop->chunk;
+        long long hi = loop->hi - lo > loop->chunk ? lo + loop->chunk : loop->hi;
+        loop->body(loop->ctx, lo, hi);
+    }
+}
+
+/* Participants claim part numbers, so a helper that starts after the others
+ * have finished (or never starts) leaves nothing undone */
+static void sn_parallel_participate(SnParallelLoop *loop)
+{
+    int part;
+    while ((part = atomic_fetch_add(&loop->next_part, 1)) < loop->parts)
+        sn_parallel_part(loop, part);
+}
+
+/* Helper task; the loop lives on the caller's stack and is only borrowed
+ * through t->result */
+static void *sn_parallel_task(void *arg)
+{
+    SnThread *t = arg;
+    SnParallelLoop *loop = t->result;
+    int own_thread = !t->pooled;
+    t->result = NULL;
+    sn_parallel_participate(loop);
+    sn_thread_release(t);
+    if (own_thread) sn_thread_local_exit();
+    return NULL;
+}
+
+long long sn_parallel_grain(long long n, int pooled)
+{
+    if (n <= SN_PARALLEL_MIN_GRAIN) return SN_PARALLEL_MIN_GRAIN;
+    long long parts = (long long)sn_parallel_width(pooled) * 4;
+    long long chunk = n / parts + (n % parts != 0);
+    return chunk < SN_PARALLEL_MIN_GRAIN ? SN_PARALLEL_MIN_GRAIN : chunk;
+}
+
+void sn_parallel_run(long long lo, long long hi, int schedule, long long chunk,
+                     SnParallelBody body, void *ctx, int pooled)
+{
+    if (hi <= lo) return;
+    long long n = hi - lo;
+
+    SnParallelLoop loop;
+    loop.lo = lo;
+    loop.hi = hi;
+    loop.schedule = schedule;
+    loop.body = body;
+    loop.ctx = ctx;
+    atomic_init(&loop.next_part, 0);
+    atomic_init(&loop.next, lo);
+
+    /* A single participant just runs the whole range */
+    loop.width = n > 1 ? sn_parallel_width(pooled) : 1;
+    if (schedule == SN_SCHEDULE_GUIDED) {
+        loop.chunk = chunk > 0 ? chunk : 1;
+    } else {
+        loop.chunk = chunk > 0 ? chunk : n / loop.width + (n % loop.width != 0);
+    }
+    if (loop.chunk > n) loop.chunk = n;
+    loop.nchunks = n / loop.chunk + (n % loop.chunk != 0);
+    loop.parts = loop.nchunks < loop.width ? (int)loop.nchunks : loop.width;
+
+    if (loop.parts == 1) {
+        body(ctx, lo, hi);
+        return;
+    }
+
+    int helper_count = loop.parts - 1;
+    SnThread **helpers = sn_sys_malloc(sizeof(SnThread *) * helper_count);
+    for (int i = 0; i < helper_count; i++) {
+        SnThread *t = sn_thread_create();
+        t->result = &loop;
+#if SN_POOL_AVAILABLE
+        if (pooled) {
+            t->start = sn_parallel_task;
+            t->pooled = 1;
+            sn_pool_submit(t);
+        } else
+#endif
+        if (pthread_create(&t->thread, NULL, sn_parallel_task, t) != 0) {
+            /* The caller picks up the part instead */
+            t->result = NULL;
+            t->joined = 1;
+            sn_thread_release(t);
+        }
+        helpers[i] = t;
+    }
+
+    sn_parallel_participate(&loop);
+
+    for (int i = 0; i < helper_count; i++) {
+        sn_thread_join(helpers[i]);
+        sn_thread_release(helpers[i]);
+    }
+    sn_sys_free(helpers);
+}
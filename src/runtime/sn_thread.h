@@ -27,23 +27,68 @@
  *   wrapper read `detached` at exit and self-freed, while the caller wrote
  *   `detached` in a separate statement after pthread_create. If the wrapper
  *   finished before the caller's write, the struct was orphaned.
+ *
+ * Spawns run as tasks on the runtime's worker pool (sn_thread.c) unless the
+ * program was compiled with --threads=os (SN_THREADS_OS) or the platform has
+ * no pool.  A queued task holds one more reference until it is taken off its
+ * queue.  Fire-and-forget spawns always get their own OS thread.
  */
 
-typedef struct {
+#if defined(_WIN32) || defined(__TINYC__) || defined(_MSC_VER)
+#define SN_POOL_AVAILABLE 0
+#else
+#define SN_POOL_AVAILABLE 1
+#endif
+
+#if SN_POOL_AVAILABLE && !defined(SN_THREADS_OS)
+#define SN_POOL_ENABLED 1
+#else
+#define SN_POOL_ENABLED 0
+#endif
+
+enum { SN_TASK_PENDING, SN_TASK_RUNNING, SN_TASK_DONE };
+
+typedef struct SnThread {
     pthread_t thread;
     void *result;
     size_t result_size;
     int joined;
     int detached;
     _Atomic int refcount;
+    int pooled;                     /* runs on the pool rather than its own thread */
+    _Atomic int state;              /* SN_TASK_*, pool tasks only */
+    void *(*start)(void *);         /* thread wrapper */
+    struct SnThread *next_task;     /* injection queue link */
+    _Atomic(void *) group;          /* SnTaskGroup it belongs to, see sn_task_group.h */
+    struct SnThread *next_done;     /* the group's completion list link */
+    void (*result_release)(void *); /* set when its group dropped it unfinished */
 } SnThread;
 
 static inline void sn_thread_release(SnThread *t)
 {
     if (!t) return;
     if (atomic_fetch_sub(&t->refcount, 1) == 1) {
-        free(t->result);
-        free(t);
+        if (t->result_release && t->result) t->result_release(t->result);
+        sn_sys_free(t->result);
+        sn_sys_free(t);
+    }
+}
+
+#if SN_POOL_AVAILABLE
+void sn_pool_submit(SnThread *t);
+void sn_pool_join(SnThread *t);
+void sn_pool_detach(SnThread *t);
+#endif
+
+static inline void sn_thread_join(SnThread *t)
+{
+    if (t && !t->joined) {
+#if SN_POOL_AVAILABLE
+        if (t->pooled) sn_pool_join(t);
+        else
+#endif
+        pthread_join(t->thread, NULL);
+        t->joined = 1;
     }
 }
 
@@ -52,10 +97,8 @@ static inline void sn_cleanup_thread(SnThread **p)
     if (*p) {
         /* Only join if this ref still owns a joinable thread. Detached
          * threads are reaped by pthread; joined threads are already done. */
-        if (!(*p)->joined && !(*p)->detached) {
-            pthread_join((*p)->thread, NULL);
-            (*p)->joined = 1;
-        }
+        if (!(*p)->joined && !(*p)->detached)
+            sn_thread_join(*p);
         sn_thread_release(*p);
     }
 }
@@ -64,17 +107,112 @@ static inline void sn_cleanup_thread(SnThread **p)
 
 static inline SnThread *sn_thread_create(void)
 {
-    SnThread *t = sn_calloc(1, sizeof(SnThread));
+    SnThread *t = sn_sys_calloc(1, sizeof(SnThread));
     atomic_init(&t->refcount, 2);
     return t;
 }
 
-static inline void sn_thread_join(SnThread *t)
+/* ---- Sync globals ----
+ *
+ * A module-level `sync var` is written by every thread that touches it, so
+ * it must not share a cache line with anything else.  Definitions carry
+ * SN_SYNC_GLOBAL: each one starts a line of its own, and where the linker
+ * lets us, they all go into one section so their neighbours are other sync
+ * globals rather than unrelated hot data.  --no-sync-padding defines
+ * SN_NO_SYNC_PADDING and packs them like any other global. */
+
+#define SN_CACHE_LINE 64
+
+#if defined(SN_NO_SYNC_PADDING)
+#define SN_SYNC_GLOBAL
+#elif defined(__APPLE__) && defined(__GNUC__)
+#define SN_SYNC_GLOBAL __attribute__((section("__DATA,__sn_sync"), aligned(SN_CACHE_LINE)))
+#elif defined(__GNUC__) && !defined(_WIN32)
+#define SN_SYNC_GLOBAL __attribute__((section("sn_sync"), aligned(SN_CACHE_LINE)))
+#else
+#define SN_SYNC_GLOBAL _Alignas(SN_CACHE_LINE)
+#endif
+
+/* ---- Thread-local cleanup ----
+ *
+ * `threadlocal` variables get one copy per thread.  The program registers a
+ * hook that frees the calling thread's copies, and every thread the runtime
+ * starts for a spawn (OS-thread spawns, detached tasks, non-pooled
+ * parallel-for helpers) runs it just before it exits.  Pool workers live
+ * until the process exits and keep their copies until then; main frees its
+ * own copies at the end of main. */
+
+void sn_thread_local_hook(void (*cleanup)(void));
+void sn_thread_local_exit(void);
+
+/* Runs t->start on a thread of its own, then the thread-local hook */
+void sn_thread_spawn_os(SnThread *t, void *(*start)(void *));
+
+#if SN_POOL_AVAILABLE
+/* Runs a pool task on the calling thread if nobody has started it yet */
+bool sn_pool_try_run(SnThread *t);
+#endif
+
+/* Called once a task's wrapper has stored its result, before joiners see it
+ * finish: hands the task to its task group, if it has one */
+void sn_task_group_finished(SnThread *t);
+
+/* Start the wrapper for a `&` spawn */
+static inline void sn_thread_start(SnThread *t, void *(*start)(void *))
 {
-    if (t && !t->joined) {
-        pthread_join(t->thread, NULL);
-        t->joined = 1;
-    }
+#if SN_POOL_ENABLED
+    t->start = start;
+    t->pooled = 1;
+    sn_pool_submit(t);
+#else
+    sn_thread_spawn_os(t, start);
+#endif
 }
 
+/* `~`: a pool task that has not started yet moves to a thread of its own,
+ * so detached work never ties up a worker it was not already running on */
+static inline void sn_thread_detach(SnThread *t)
+{
+    t->detached = 1;
+#if SN_POOL_AVAILABLE
+    if (t->pooled) sn_pool_detach(t);
+    else
 #endif
+    pthread_detach(t->thread);
+}
+
+/* ---- Parallel for-loops ----
+ *
+ * `parallel for` bodies are outlined into an SnParallelBody that runs the
+ * iterations [lo, hi) of one chunk against a context struct holding the
+ * loop's captures.  sn_parallel_run splits [lo, hi) into chunks and runs them
+ * on the calling thread plus up to width - 1 helper tasks, where width is the
+ * number of pool workers (or of CPUs with --threads=os), and returns once
+ * every chunk has finished.
+ *
+ *   SN_SCHEDULE_STATIC  chunks of `chunk` iterations (default: one per
+ *                       participant) dealt out round-robin
+ *   SN_SCHEDULE_GUIDED  each participant claims max(chunk, remaining / 2W)
+ *                       iterations at a time (default chunk: 1)
+ */
+
+typedef void (*SnParallelBody)(void *ctx, long long lo, long long hi);
+
+enum { SN_SCHEDULE_STATIC, SN_SCHEDULE_GUIDED };
+
+void sn_parallel_run(long long lo, long long hi, int schedule, long long chunk,
+                     SnParallelBody body, void *ctx, int pooled);
+
+static inline void sn_parallel_for(long long lo, long long hi, int schedule, long long chunk,
+                                   SnParallelBody body, void *ctx)
+{
+    sn_parallel_run(lo, hi, schedule, chunk, body, ctx, SN_POOL_ENABLED);
+}
+
+/* Static chunk size for arr.parMap / arr.parReduce over n elements: about
+ * four chunks per participant, but never below SN_PARALLEL_MIN_GRAIN so a
+ * small array runs in one piece on the calling thread */
+#define SN_PARALLEL_MIN_GRAIN 256
+long long sn_parallel_grain(long long n, int pooled);
+
+#endif
\ No newline at end of file
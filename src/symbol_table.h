@@ -109,6 +109,8 @@ typedef struct {
     int scope_depth;            /* Current scope nesting depth (blocks, functions) */
     int loop_depth;             /* Current loop nesting depth (for break/continue validation) */
     Type *current_return_type;  /* Return type of the enclosing function (for match arm return validation) */
+    ParallelClause *parallel_loop; /* Innermost parallel for-loop whose body is being checked */
+    LambdaExpr *lambda;         /* Innermost lambda whose body is being checked */
     /* Import visibility tracking */
     FileImportMap import_map;       /* Per-file direct import tracking */
     const char *current_file;       /* File currently being type-checked (NULL = no filtering) */
@@ -264,6 +264,8 @@ void symbol_table_init(Arena *arena, SymbolTable *table)
     table->scope_depth = 0;
     table->loop_depth = 0;
     table->current_return_type = NULL;
+    table->parallel_loop = NULL;
+    table->lambda = NULL;
     table->import_map.entries = NULL;
     table->import_map.count = 0;
     table->import_map.capacity = 0;
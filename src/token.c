@@ -203,6 +203,8 @@ const char *token_type_to_string(SnTokenType type)
         return "SYNC";
     case TOKEN_LOCK:
         return "LOCK";
+    case TOKEN_THREADLOCAL:
+        return "THREADLOCAL";
     case TOKEN_USING:
         return "USING";
     case TOKEN_LEFT_PAREN:
@@ -251,6 +253,10 @@ const char *token_type_to_string(SnTokenType type)
         return "PRAGMA_ALIAS";
     case TOKEN_PRAGMA_SERIALIZABLE:
         return "PRAGMA_SERIALIZABLE";
+    case TOKEN_PRAGMA_ALIGN:
+        return "PRAGMA_ALIGN";
+    case TOKEN_PRAGMA_CACHELINE:
+        return "PRAGMA_CACHELINE";
     case TOKEN_COMMENT:
         return "COMMENT";
     case TOKEN_ERROR:
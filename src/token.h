@@ -107,6 +107,7 @@ typedef enum
     // Synchronization keywords
     TOKEN_SYNC,
     TOKEN_LOCK,
+    TOKEN_THREADLOCAL,
     // Resource management keyword
     TOKEN_USING,
     TOKEN_LEFT_PAREN,
@@ -129,6 +130,8 @@ typedef enum
     TOKEN_PRAGMA_PACK,        /* #pragma pack(1) or #pragma pack() */
     TOKEN_PRAGMA_ALIAS,       /* #pragma alias "c_name" for next declaration */
     TOKEN_PRAGMA_SERIALIZABLE, /* @serializable - marks struct for encode/decode generation */
+    TOKEN_PRAGMA_ALIGN,       /* @align(N) - minimum alignment of the next struct or field */
+    TOKEN_PRAGMA_CACHELINE,   /* @cacheline - @align(64): struct or field gets its own cache line */
     TOKEN_COMMENT,            /* // comment (preserved in code generation) */
     TOKEN_ERROR
 } SnTokenType;
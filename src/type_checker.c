@@ -2,6 +2,8 @@
 #include "type_checker/util/type_checker_util.h"
 #include "type_checker/stmt/type_checker_stmt.h"
 #include "type_checker/type_checker_generics.h"
+#include "type_checker/type_checker_containers.h"
+#include "type_checker/expr/type_checker_expr_thread.h"
 #include "debug.h"
 #include <stdio.h>
 #include <string.h>
@@ -68,6 +70,8 @@ int type_check_module(Module *module, SymbolTable *table)
     DEBUG_VERBOSE("Starting type checking for module with %d statements", module->count);
     type_checker_reset_error();
     generic_registry_clear();
+    thread_shared_rc_clear();
+    container_register_templates(table->arena);
 
     /* Pre-pass: catch cross-file struct name collisions before codegen would
      * otherwise emit conflicting __sn__<Name> definitions into sn_types.h. */
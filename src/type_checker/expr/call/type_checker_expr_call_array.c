@@ -7,7 +7,12 @@
  * ============================================================================ */
 
 #include "type_checker/expr/call/type_checker_expr_call_array.h"
+#include "type_checker/expr/type_checker_expr.h"
+#include "type_checker/expr/type_checker_expr_thread.h"
+#include "type_checker/util/type_checker_util.h"
+#include "symbol_table/symbol_table_thread.h"
 #include "debug.h"
+#include <stdio.h>
 #include <string.h>
 
 /* ============================================================================
@@ -137,6 +142,55 @@ Type *type_check_array_method(Expr *expr, Type *object_type, Token member_name,
         return ast_create_function_type(table->arena, element_type, param_types, 1);
     }
 
+    /* Primitive array reductions - int/long, double, byte and bool element types */
+    TypeKind elem_kind = object_type->as.array.element_type->kind;
+    bool is_numeric_elem = elem_kind == TYPE_INT || elem_kind == TYPE_LONG ||
+                           elem_kind == TYPE_DOUBLE || elem_kind == TYPE_BYTE;
+    if (is_numeric_elem || elem_kind == TYPE_BOOL)
+    {
+        Type *element_type = object_type->as.array.element_type;
+
+        /* array.count(elem) -> int */
+        if (strcmp(name, "count") == 0)
+        {
+            Type *int_type = ast_create_primitive_type(table->arena, TYPE_INT);
+            Type *param_types[1] = {element_type};
+            DEBUG_VERBOSE("Returning function type for array count method");
+            return ast_create_function_type(table->arena, int_type, param_types, 1);
+        }
+
+        /* array.fill(elem) -> void */
+        if (strcmp(name, "fill") == 0)
+        {
+            Type *void_type = ast_create_primitive_type(table->arena, TYPE_VOID);
+            Type *param_types[1] = {element_type};
+            DEBUG_VERBOSE("Returning function type for array fill method");
+            return ast_create_function_type(table->arena, void_type, param_types, 1);
+        }
+    }
+    if (is_numeric_elem)
+    {
+        Type *element_type = object_type->as.array.element_type;
+        Type *param_types[] = {NULL};
+
+        /* array.sum() -> element type (byte[] sums to int) */
+        if (strcmp(name, "sum") == 0)
+        {
+            Type *sum_type = elem_kind == TYPE_BYTE
+                ? ast_create_primitive_type(table->arena, TYPE_INT)
+                : element_type;
+            DEBUG_VERBOSE("Returning function type for array sum method");
+            return ast_create_function_type(table->arena, sum_type, param_types, 0);
+        }
+
+        /* array.min() / array.max() -> element type */
+        if (strcmp(name, "min") == 0 || strcmp(name, "max") == 0)
+        {
+            DEBUG_VERBOSE("Returning function type for array %s method", name);
+            return ast_create_function_type(table->arena, element_type, param_types, 0);
+        }
+    }
+
     /* Byte array extension methods - only available on byte[] */
     if (object_type->as.array.element_type->kind == TYPE_BYTE)
     {
@@ -180,3 +234,195 @@ Type *type_check_array_method(Expr *expr, Type *object_type, Token member_name,
     /* Not an array method */
     return NULL;
 }
+
+/* ============================================================================
+ * Higher-Order Array Methods
+ * ============================================================================ */
+
+static const struct
+{
+    const char *name;
+    ArrayHof op;
+} array_hof_names[] = {
+    {"map", ARRAY_HOF_MAP},
+    {"filter", ARRAY_HOF_FILTER},
+    {"reduce", ARRAY_HOF_REDUCE},
+    {"forEach", ARRAY_HOF_FOR_EACH},
+    {"parMap", ARRAY_HOF_PAR_MAP},
+    {"parReduce", ARRAY_HOF_PAR_REDUCE},
+};
+
+ArrayHof array_hof_from_name(Token member_name)
+{
+    for (size_t i = 0; i < sizeof(array_hof_names) / sizeof(array_hof_names[0]); i++)
+    {
+        if ((size_t)member_name.length == strlen(array_hof_names[i].name) &&
+            strncmp(member_name.start, array_hof_names[i].name, member_name.length) == 0)
+        {
+            return array_hof_names[i].op;
+        }
+    }
+    return ARRAY_HOF_NONE;
+}
+
+/* Fill in the parameter and return types a lambda argument left out */
+static void array_hof_infer_lambda(Expr *arg, Type **params, int param_count, Type *ret)
+{
+    if (arg->type != EXPR_LAMBDA) return;
+    LambdaExpr *lambda = &arg->as.lambda;
+    if (lambda->param_count != param_count) return;
+    for (int i = 0; i < lambda->param_count; i++)
+    {
+        if (lambda->params[i].type == NULL)
+            lambda->params[i].type = params[i];
+    }
+    if (lambda->return_type == NULL && ret != NULL)
+        lambda->return_type = ret;
+}
+
+Type *type_check_hof_function(Expr *expr, const char *name, int arg_index,
+                              Type **params, int param_count, Type *ret, SymbolTable *table)
+{
+    Expr *fn_arg = expr->as.call.arguments[arg_index];
+    array_hof_infer_lambda(fn_arg, params, param_count, ret);
+    if (ret == NULL && fn_arg->type == EXPR_LAMBDA && fn_arg->as.lambda.return_type == NULL)
+    {
+        char msg[256];
+        snprintf(msg, sizeof(msg),
+                 "%s() needs the function's return type, e.g. arr.%s(fn(x): str => ...)",
+                 name, name);
+        type_error(expr->token, msg);
+        return NULL;
+    }
+
+    Type *arg_type = type_check_expr(fn_arg, table);
+    if (arg_type == NULL)
+    {
+        type_error(expr->token, "Invalid argument in function call");
+        return NULL;
+    }
+    if (ret == NULL)
+    {
+        ret = arg_type->kind == TYPE_FUNCTION ? arg_type->as.function.return_type : NULL;
+        if (ret == NULL || ret->kind == TYPE_VOID)
+            ret = params[param_count - 1];
+    }
+    Type *fn_type = ast_create_function_type(table->arena, ret, params, param_count);
+    if (!ast_type_equals(arg_type, fn_type))
+    {
+        argument_type_error(expr->token, name, arg_index, fn_type, arg_type);
+        return NULL;
+    }
+    return fn_type;
+}
+
+Type *type_check_array_hof_call(Expr *expr, Type *object_type, SymbolTable *table)
+{
+    Expr *callee = expr->as.call.callee;
+    ArrayHof op = array_hof_from_name(callee->as.member.member_name);
+    char name[16];
+    snprintf(name, sizeof(name), "%.*s", callee->as.member.member_name.length,
+             callee->as.member.member_name.start);
+    char msg[256];
+
+    Type *elem_type = object_type->as.array.element_type;
+    bool has_init = op == ARRAY_HOF_REDUCE || op == ARRAY_HOF_PAR_REDUCE;
+    int expected_args = has_init ? 2 : 1;
+    if (expr->as.call.arg_count != expected_args)
+    {
+        argument_count_error(expr->token, name, expected_args, expr->as.call.arg_count);
+        return NULL;
+    }
+
+    /* Chunks run on pool threads, which cannot allocate from this thread's region */
+    if ((op == ARRAY_HOF_PAR_MAP || op == ARRAY_HOF_PAR_REDUCE) &&
+        symbol_table_get_arena_depth(table) > 0)
+    {
+        snprintf(msg, sizeof(msg), "Cannot call %s() inside an arena block", name);
+        type_error(expr->token, msg);
+        return NULL;
+    }
+
+    Type *bool_type = ast_create_primitive_type(table->arena, TYPE_BOOL);
+    Type *void_type = ast_create_primitive_type(table->arena, TYPE_VOID);
+    Type *acc_type = NULL;
+    if (has_init)
+    {
+        acc_type = type_check_expr(expr->as.call.arguments[0], table);
+        if (acc_type == NULL)
+        {
+            type_error(expr->token, "Invalid argument in function call");
+            return NULL;
+        }
+        if (op == ARRAY_HOF_PAR_REDUCE && !ast_type_equals(acc_type, elem_type))
+        {
+            argument_type_error(expr->token, name, 0, elem_type, acc_type);
+            return NULL;
+        }
+        /* The accumulator is overwritten on every step, so it must not own memory */
+        if (!is_primitive_type(acc_type) || acc_type->kind == TYPE_VOID)
+        {
+            snprintf(msg, sizeof(msg), "%s() accumulator must be a primitive type, got '%s'",
+                     name, type_name(acc_type));
+            type_error(expr->token, msg);
+            return NULL;
+        }
+    }
+
+    /* The function's type follows from the element type, except for map's result */
+    Type *fn_type;
+    if (op == ARRAY_HOF_MAP || op == ARRAY_HOF_PAR_MAP)
+    {
+        Type *params[1] = {elem_type};
+        fn_type = type_check_hof_function(expr, name, 0, params, 1, NULL, table);
+    }
+    else if (op == ARRAY_HOF_FILTER || op == ARRAY_HOF_FOR_EACH)
+    {
+        Type *params[1] = {elem_type};
+        fn_type = type_check_hof_function(expr, name, 0, params, 1,
+                                          op == ARRAY_HOF_FILTER ? bool_type : void_type, table);
+    }
+    else
+    {
+        Type *params[2] = {acc_type, elem_type};
+        fn_type = type_check_hof_function(expr, name, 1, params, 2, acc_type, table);
+    }
+    if (fn_type == NULL)
+        return NULL;
+
+    /* Chunks run on pool threads, which retain and release the elements,
+     * the function's results and whatever the function captures */
+    if (op == ARRAY_HOF_PAR_MAP || op == ARRAY_HOF_PAR_REDUCE)
+    {
+        thread_shared_rc_mark(elem_type);
+        thread_shared_rc_mark(fn_type->as.function.return_type);
+        thread_shared_rc_mark_value(expr->as.call.arguments[has_init ? 1 : 0], table);
+    }
+
+    Type *result_type;
+    switch (op)
+    {
+        case ARRAY_HOF_MAP:
+        case ARRAY_HOF_PAR_MAP:
+            result_type = ast_create_array_type(table->arena, fn_type->as.function.return_type);
+            break;
+        case ARRAY_HOF_FILTER:
+            result_type = object_type;
+            break;
+        case ARRAY_HOF_FOR_EACH:
+            result_type = void_type;
+            break;
+        default:
+            result_type = acc_type;
+            break;
+    }
+
+    /* Give the callee the method's signature, as for the other array methods */
+    Type *param_types[2] = {acc_type, fn_type};
+    callee->expr_type = has_init
+        ? ast_create_function_type(table->arena, result_type, param_types, 2)
+        : ast_create_function_type(table->arena, result_type, &param_types[1], 1);
+    expr->as.call.array_hof = op;
+    DEBUG_VERBOSE("Type checked array %s call", name);
+    return result_type;
+}
@@ -19,4 +19,18 @@
  */
 Type *type_check_array_method(Expr *expr, Type *object_type, Token member_name, SymbolTable *table);
 
+/* Higher-order methods: map, filter, reduce, forEach, parMap, parReduce.
+ * Their types come from the function argument, so the whole call is checked
+ * here: lambda parameter types are inferred from the element type, and the
+ * call is tagged with its ArrayHof for code generation. */
+ArrayHof array_hof_from_name(Token member_name);
+Type *type_check_array_hof_call(Expr *expr, Type *object_type, SymbolTable *table);
+
+/* Check argument arg_index of a higher-order call against fn(params): ret,
+ * filling in what a lambda left out.  With ret NULL the result type comes
+ * from the function itself, and a lambda must spell it.  Returns the
+ * function type, or NULL after reporting an error. */
+Type *type_check_hof_function(Expr *expr, const char *name, int arg_index,
+                              Type **params, int param_count, Type *ret, SymbolTable *table);
+
 #endif /* TYPE_CHECKER_EXPR_CALL_ARRAY_H */
@@ -14,6 +14,7 @@
 #include "type_checker/expr/call/type_checker_expr_call_core.h"
 #include "type_checker/expr/call/type_checker_expr_call.h"
 #include "type_checker/expr/call/type_checker_expr_call_array.h"
+#include "type_checker/expr/call/type_checker_expr_call_iter.h"
 #include "type_checker/expr/call/type_checker_expr_call_string.h"
 #include "type_checker/expr/type_checker_expr.h"
 #include "type_checker/util/type_checker_util.h"
@@ -288,6 +289,29 @@ Type *type_check_call_expression(Expr *expr, SymbolTable *table)
         }
     }
 
+    /* arr.iter().map(f).collect() and the other lazy pipeline stages; checked
+     * first so that map and filter on a pipeline are not the eager array methods */
+    if (callee->type == EXPR_MEMBER &&
+        iter_stage_from_name(callee->as.member.member_name) != ITER_STAGE_NONE &&
+        !(callee->as.member.object->type == EXPR_VARIABLE &&
+          symbol_table_is_namespace(table, callee->as.member.object->as.variable.name)))
+    {
+        Expr *object = callee->as.member.object;
+        Type *object_type = type_check_expr(object, table);
+        if (iter_stage_applies(object, object_type, callee->as.member.member_name))
+            return type_check_iter_stage(expr, object_type, table);
+    }
+
+    /* arr.map(f) and the other higher-order array methods take their types
+     * from the function argument */
+    if (callee->type == EXPR_MEMBER &&
+        array_hof_from_name(callee->as.member.member_name) != ARRAY_HOF_NONE)
+    {
+        Type *object_type = type_check_expr(callee->as.member.object, table);
+        if (object_type != NULL && object_type->kind == TYPE_ARRAY)
+            return type_check_array_hof_call(expr, object_type, table);
+    }
+
     // Standard function call handling
     Type *callee_type = type_check_expr(expr->as.call.callee, table);
 
@@ -547,6 +571,20 @@ Type *type_check_call_expression(Expr *expr, SymbolTable *table)
         }
     }
 
+    /* taskgroup.add() takes over a spawned task's handle, so its argument must
+     * be the spawn itself: g.add(&fn()) */
+    if (callee->type == EXPR_MEMBER &&
+        token_equals(callee->as.member.member_name, "add") &&
+        callee->as.member.object->expr_type != NULL &&
+        callee->as.member.object->expr_type->kind == TYPE_STRUCT &&
+        callee->as.member.object->expr_type->as.struct_type.container_kind == CONTAINER_TASK_GROUP &&
+        (expr->as.call.arg_count != 1 || expr->as.call.arguments[0] == NULL ||
+         expr->as.call.arguments[0]->type != EXPR_THREAD_SPAWN))
+    {
+        type_error(expr->token, "taskgroup.add() requires a thread spawn, e.g. g.add(&work(x))");
+        return NULL;
+    }
+
     /* Detect thread spawn pushed into array: arr.push(&fn())
      * If a spawn expression is pushed into an array variable, mark the array
      * symbol as having pending elements for thread sync support. */
@@ -0,0 +1,183 @@
+/* ============================================================================
+ * type_checker_expr_call_iter.c - Lazy Iterator Pipeline Type Checking
+ * ============================================================================
+ * Type checking for iter(), map, filter, take, skip, zip, enumerate and
+ * collect when they form a pipeline.  Each call is tagged with its IterStage;
+ * code generation walks the chain back to its source to build one loop.
+ * ============================================================================ */
+
+#include "type_checker/expr/call/type_checker_expr_call_iter.h"
+#include "type_checker/expr/call/type_checker_expr_call_array.h"
+#include "type_checker/expr/type_checker_expr.h"
+#include "type_checker/util/type_checker_util.h"
+#include "type_checker/type_checker_generics.h"
+#include "debug.h"
+#include <stdio.h>
+#include <string.h>
+
+static const struct
+{
+    const char *name;
+    IterStage stage;
+} iter_stage_names[] = {
+    {"iter", ITER_STAGE_SOURCE},
+    {"map", ITER_STAGE_MAP},
+    {"filter", ITER_STAGE_FILTER},
+    {"take", ITER_STAGE_TAKE},
+    {"skip", ITER_STAGE_SKIP},
+    {"zip", ITER_STAGE_ZIP},
+    {"enumerate", ITER_STAGE_ENUMERATE},
+    {"collect", ITER_STAGE_COLLECT},
+};
+
+IterStage iter_stage_from_name(Token member_name)
+{
+    for (size_t i = 0; i < sizeof(iter_stage_names) / sizeof(iter_stage_names[0]); i++)
+    {
+        if ((size_t)member_name.length == strlen(iter_stage_names[i].name) &&
+            strncmp(member_name.start, iter_stage_names[i].name, member_name.length) == 0)
+        {
+            return iter_stage_names[i].stage;
+        }
+    }
+    return ITER_STAGE_NONE;
+}
+
+bool iter_is_pipeline(Expr *expr)
+{
+    return expr != NULL && expr->type == EXPR_CALL &&
+           expr->as.call.iter_stage != ITER_STAGE_NONE &&
+           expr->as.call.iter_stage != ITER_STAGE_COLLECT;
+}
+
+Type *iter_struct_element_type(Type *type)
+{
+    if (type == NULL || type->kind != TYPE_STRUCT)
+        return NULL;
+    StructMethod *has_next = ast_struct_get_method(type, "hasNext");
+    StructMethod *next = ast_struct_get_method(type, "next");
+    if (has_next == NULL || has_next->param_count != 0 || has_next->is_static ||
+        has_next->return_type == NULL || has_next->return_type->kind != TYPE_BOOL)
+        return NULL;
+    if (next == NULL || next->param_count != 0 || next->is_static ||
+        next->return_type == NULL || next->return_type->kind == TYPE_VOID)
+        return NULL;
+    return next->return_type;
+}
+
+bool iter_stage_applies(Expr *object, Type *object_type, Token member_name)
+{
+    IterStage stage = iter_stage_from_name(member_name);
+    if (stage == ITER_STAGE_NONE || object_type == NULL)
+        return false;
+    /* iter() starts a pipeline on any array; the adapters only continue one,
+     * so arr.map(f) stays the eager array method */
+    if (stage == ITER_STAGE_SOURCE)
+        return object_type->kind == TYPE_ARRAY;
+    if (iter_is_pipeline(object))
+        return true;
+    if (iter_struct_element_type(object_type) == NULL)
+        return false;
+    /* An iterator's own method of the same name wins */
+    char name[16];
+    snprintf(name, sizeof(name), "%.*s", member_name.length, member_name.start);
+    return ast_struct_get_method(object_type, name) == NULL;
+}
+
+Type *type_check_iter_stage(Expr *expr, Type *object_type, SymbolTable *table)
+{
+    Expr *callee = expr->as.call.callee;
+    IterStage stage = iter_stage_from_name(callee->as.member.member_name);
+    char name[16];
+    snprintf(name, sizeof(name), "%.*s", callee->as.member.member_name.length,
+             callee->as.member.member_name.start);
+    char msg[256];
+
+    Type *elem_type = object_type->kind == TYPE_ARRAY
+        ? object_type->as.array.element_type
+        : iter_struct_element_type(object_type);
+
+    int expected_args = (stage == ITER_STAGE_SOURCE || stage == ITER_STAGE_ENUMERATE ||
+                         stage == ITER_STAGE_COLLECT) ? 0 : 1;
+    if (expr->as.call.arg_count != expected_args)
+    {
+        argument_count_error(expr->token, name, expected_args, expr->as.call.arg_count);
+        return NULL;
+    }
+
+    Type *param_type = NULL;
+    Type *out_elem = elem_type;
+    switch (stage)
+    {
+        case ITER_STAGE_MAP:
+        case ITER_STAGE_FILTER:
+        {
+            Type *params[1] = {elem_type};
+            Type *ret = stage == ITER_STAGE_FILTER
+                ? ast_create_primitive_type(table->arena, TYPE_BOOL) : NULL;
+            param_type = type_check_hof_function(expr, name, 0, params, 1, ret, table);
+            if (param_type == NULL)
+                return NULL;
+            if (stage == ITER_STAGE_MAP)
+                out_elem = param_type->as.function.return_type;
+            break;
+        }
+        case ITER_STAGE_TAKE:
+        case ITER_STAGE_SKIP:
+        {
+            param_type = type_check_expr(expr->as.call.arguments[0], table);
+            if (param_type == NULL)
+            {
+                type_error(expr->token, "Invalid argument in function call");
+                return NULL;
+            }
+            if (param_type->kind != TYPE_INT && param_type->kind != TYPE_LONG)
+            {
+                snprintf(msg, sizeof(msg), "%s() count must be an integer, got '%s'",
+                         name, type_name(param_type));
+                type_error(expr->token, msg);
+                return NULL;
+            }
+            break;
+        }
+        case ITER_STAGE_ZIP:
+        {
+            param_type = type_check_expr(expr->as.call.arguments[0], table);
+            if (param_type == NULL)
+            {
+                type_error(expr->token, "Invalid argument in function call");
+                return NULL;
+            }
+            if (param_type->kind != TYPE_ARRAY)
+            {
+                snprintf(msg, sizeof(msg), "zip() takes an array, got '%s'",
+                         type_name(param_type));
+                type_error(expr->token, msg);
+                return NULL;
+            }
+            Type *args[2] = {elem_type, param_type->as.array.element_type};
+            out_elem = resolve_generic_instantiation(table->arena,
+                ast_create_generic_inst_type(table->arena, "Zipped", args, 2), table);
+            break;
+        }
+        case ITER_STAGE_ENUMERATE:
+        {
+            Type *args[1] = {elem_type};
+            out_elem = resolve_generic_instantiation(table->arena,
+                ast_create_generic_inst_type(table->arena, "Enumerated", args, 1), table);
+            break;
+        }
+        default:
+            break;
+    }
+    if (out_elem == NULL)
+        return NULL;
+
+    Type *result_type = ast_create_array_type(table->arena, out_elem);
+    callee->expr_type = param_type != NULL
+        ? ast_create_function_type(table->arena, result_type, &param_type, 1)
+        : ast_create_function_type(table->arena, result_type, NULL, 0);
+    expr->as.call.iter_stage = stage;
+    DEBUG_VERBOSE("Type checked pipeline %s call", name);
+    return result_type;
+}
@@ -0,0 +1,32 @@
+#ifndef TYPE_CHECKER_EXPR_CALL_ITER_H
+#define TYPE_CHECKER_EXPR_CALL_ITER_H
+
+#include "ast.h"
+#include "symbol_table.h"
+
+/* ============================================================================
+ * Lazy Iterator Pipeline Type Checking
+ * ============================================================================
+ * arr.iter().filter(f).map(g).take(n).collect() builds a pipeline that code
+ * generation fuses into a single loop.  A pipeline starts with iter() on an
+ * array or range, or with an adapter called on an iterator struct (one with
+ * hasNext() and next()).  Every stage is typed as an array of the elements
+ * it yields, so a pipeline used as an ordinary value is simply collected.
+ * ============================================================================ */
+
+/* Stage named by a method, or ITER_STAGE_NONE */
+IterStage iter_stage_from_name(Token member_name);
+
+/* Is expr a call that is a (not yet collected) pipeline stage? */
+bool iter_is_pipeline(Expr *expr);
+
+/* Element type of an iterator struct, or NULL if the type is not one */
+Type *iter_struct_element_type(Type *type);
+
+/* Does calling `name` on an object of object_type start or extend a pipeline? */
+bool iter_stage_applies(Expr *object, Type *object_type, Token member_name);
+
+/* Type check one pipeline stage call and tag it with its IterStage */
+Type *type_check_iter_stage(Expr *expr, Type *object_type, SymbolTable *table);
+
+#endif /* TYPE_CHECKER_EXPR_CALL_ITER_H */
@@ -15,6 +15,8 @@
 #include "type_checker/expr/type_checker_expr_array.h"
 #include "type_checker/expr/type_checker_expr_lambda.h"
 #include "type_checker/util/type_checker_util.h"
+#include "type_checker/util/type_checker_util_escape.h"
+#include "type_checker/util/type_checker_util_parallel.h"
 #include "type_checker/stmt/type_checker_stmt.h"
 #include "symbol_table/symbol_table_thread.h"
 #include "debug.h"
@@ -148,6 +150,9 @@ Type *type_check_expr(Expr *expr, SymbolTable *table)
     expr->expr_type = t;
     if (t != NULL)
     {
+        type_check_region_escape(expr, table);
+        type_check_parallel_access(expr, table);
+        type_check_lambda_capture(expr, table);
         DEBUG_VERBOSE("Expression type check result: %d", t->kind);
     }
     else
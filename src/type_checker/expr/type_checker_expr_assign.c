@@ -1,6 +1,8 @@
 #include "type_checker/expr/type_checker_expr_assign.h"
 #include "type_checker/expr/type_checker_expr.h"
+#include "type_checker/stmt/type_checker_stmt.h"
 #include "type_checker/util/type_checker_util.h"
+#include "type_checker/util/type_checker_util_escape.h"
 #include "debug.h"
 #include <string.h>
 
@@ -85,6 +87,11 @@ Type *type_check_assign(Expr *expr, SymbolTable *table)
     /* Annotate the AST node with scope depth so codegen capture analysis
      * can distinguish module-level globals from true locals. */
     expr->as.assign.lhs_scope_depth = sym->declaration_scope_depth;
+    expr->as.assign.sync_decl = (sym->sync_mod == SYNC_ATOMIC) ? sym->var_decl_origin : NULL;
+    expr->as.assign.thread_local_decl =
+        (sym->var_decl_origin != NULL && sym->var_decl_origin->as.var_decl.is_thread_local)
+            ? sym->var_decl_origin : NULL;
+    type_check_sync_write(expr->as.assign.sync_decl, expr->token);
 
     /* Check if trying to assign to a namespace */
     if (sym->is_namespace)
@@ -192,21 +199,14 @@ Type *type_check_assign(Expr *expr, SymbolTable *table)
     }
     else if (current_arena_depth > sym->arena_depth && !can_escape_private(value_type))
     {
-        // Escaping from inner scope - cloning/promotion allowed for strings/arrays
-        if (value_type->kind == TYPE_STRING || value_type->kind == TYPE_ARRAY)
+        // Leaving an arena block: strings, arrays and value structs of them are
+        // rebuilt on the system heap (type_check_region_escape marks the store);
+        // anything that may still point into the region cannot leave.
+        const char *reason = get_region_export_block_reason(value_type);
+        if (reason != NULL)
         {
-            ast_expr_mark_escapes(value_expr);
-            DEBUG_VERBOSE("Arena escape (will promote): '%.*s' (arena_depth %d) assigned from depth %d",
-                          expr->as.assign.name.length, expr->as.assign.name.start,
-                          sym->arena_depth, current_arena_depth);
-        }
-        else
-        {
-            // Other non-escapable types (structs with heap fields, etc.): error
-            const char *reason = get_private_escape_block_reason(value_type);
             char msg[512];
-            snprintf(msg, sizeof(msg), "Cannot assign to variable declared outside private block: %s",
-                     reason ? reason : "type contains heap data");
+            snprintf(msg, sizeof(msg), "Cannot assign to variable declared outside arena block: %s", reason);
             type_error(&expr->as.assign.name, msg);
             return NULL;
         }
@@ -305,5 +305,7 @@ Type *type_check_increment_decrement(Expr *expr, SymbolTable *table)
         type_error(expr->token, "Increment/decrement on non-numeric type");
         return NULL;
     }
+    if (expr->as.operand->type == EXPR_VARIABLE)
+        type_check_sync_write(expr->as.operand->as.variable.sync_decl, expr->token);
     return operand_type;
 }
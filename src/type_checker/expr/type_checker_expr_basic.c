@@ -79,6 +79,13 @@ Type *type_check_variable(Expr *expr, SymbolTable *table)
      * can distinguish module-level globals from true locals. */
     expr->as.variable.declaration_scope_depth = sym->declaration_scope_depth;
     expr->as.variable.is_param_ref = (sym->kind == SYMBOL_PARAM);
+    /* Point sync variable uses at their declaration so codegen can lower
+     * updates to atomics with the declared memory order. */
+    expr->as.variable.sync_decl = (sym->sync_mod == SYNC_ATOMIC) ? sym->var_decl_origin : NULL;
+    /* Lazily initialized thread locals are reached through a getter */
+    expr->as.variable.thread_local_decl =
+        (sym->var_decl_origin != NULL && sym->var_decl_origin->as.var_decl.is_thread_local)
+            ? sym->var_decl_origin : NULL;
 
     DEBUG_VERBOSE("Variable type found: %d", result_type->kind);
     return result_type;
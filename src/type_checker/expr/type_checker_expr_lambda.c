@@ -8,8 +8,10 @@
 
 #include "type_checker/expr/type_checker_expr_lambda.h"
 #include "type_checker/expr/type_checker_expr.h"
+#include "type_checker/expr/type_checker_expr_thread.h"
 #include "type_checker/util/type_checker_util.h"
 #include "type_checker/stmt/type_checker_stmt.h"
+#include "symbol_table/symbol_table_core.h"
 #include "debug.h"
 #include <string.h>
 #include <stdio.h>
@@ -286,6 +288,85 @@ static bool check_native_lambda_captures_stmt(LambdaExpr *lambda, Stmt *stmt,
     }
 }
 
+/* ============================================================================
+ * Capture Recording
+ * ============================================================================ */
+
+static void lambda_add_capture(LambdaExpr *lambda, Symbol *sym, SymbolTable *table)
+{
+    for (int i = 0; i < lambda->capture_count; i++)
+    {
+        if (symbol_table_tokens_equal(lambda->captured_vars[i], sym->name))
+        {
+            return;
+        }
+    }
+
+    if (lambda->capture_count % 8 == 0)
+    {
+        int new_capacity = lambda->capture_count + 8;
+        Token *vars = arena_alloc(table->arena, sizeof(Token) * new_capacity);
+        Type **types = arena_alloc(table->arena, sizeof(Type *) * new_capacity);
+        if (vars == NULL || types == NULL)
+        {
+            DEBUG_ERROR("Out of memory recording lambda captures");
+            return;
+        }
+        if (lambda->capture_count > 0)
+        {
+            memcpy(vars, lambda->captured_vars, sizeof(Token) * lambda->capture_count);
+            memcpy(types, lambda->captured_types, sizeof(Type *) * lambda->capture_count);
+        }
+        lambda->captured_vars = vars;
+        lambda->captured_types = types;
+    }
+
+    /* Captured locals move to a heap box shared with the closure */
+    check_stored_type_alignment(sym->type, &sym->name, "a closure capture");
+
+    lambda->captured_vars[lambda->capture_count] = sym->name;
+    lambda->captured_types[lambda->capture_count] = sym->type;
+    lambda->capture_count++;
+}
+
+/* A local declared outside the innermost lambda is a capture of it and of
+ * every enclosing lambda it also predates. */
+static void lambda_note_use(Token name, SymbolTable *table)
+{
+    Symbol *sym = symbol_table_lookup_symbol(table, name);
+    if (sym == NULL || sym->is_function || sym->is_namespace ||
+        sym->kind == SYMBOL_TYPE || sym->kind == SYMBOL_NAMESPACE ||
+        sym->kind == SYMBOL_GLOBAL || sym->is_static)
+    {
+        return;
+    }
+    for (LambdaExpr *lambda = table->lambda; lambda != NULL; lambda = lambda->enclosing)
+    {
+        if (sym->declaration_scope_depth > lambda->outer_scope_depth)
+        {
+            return;
+        }
+        lambda_add_capture(lambda, sym, table);
+    }
+}
+
+void type_check_lambda_capture(Expr *expr, SymbolTable *table)
+{
+    if (table->lambda == NULL)
+    {
+        return;
+    }
+
+    if (expr->type == EXPR_VARIABLE)
+    {
+        lambda_note_use(expr->as.variable.name, table);
+    }
+    else if (expr->type == EXPR_ASSIGN)
+    {
+        lambda_note_use(expr->as.assign.name, table);
+    }
+}
+
 /* ============================================================================
  * Lambda Expression Type Checking
  * ============================================================================ */
@@ -378,6 +459,14 @@ Type *type_check_lambda(Expr *expr, SymbolTable *table)
         }
     }
 
+    /* Uses of outer locals are recorded against the lambda while its body
+     * is checked (see type_check_lambda_capture) */
+    LambdaExpr *enclosing_lambda = table->lambda;
+    lambda->outer_scope_depth = table->scope_depth;
+    lambda->enclosing = enclosing_lambda;
+    lambda->capture_count = 0;
+    table->lambda = lambda;
+
     /* Push new scope for lambda parameters */
     symbol_table_push_scope(table);
 
@@ -404,6 +493,7 @@ Type *type_check_lambda(Expr *expr, SymbolTable *table)
         if (body_type == NULL)
         {
             symbol_table_pop_scope(table);
+            table->lambda = enclosing_lambda;
             type_error(expr->token, "Lambda body type check failed");
             return NULL;
         }
@@ -414,12 +504,16 @@ Type *type_check_lambda(Expr *expr, SymbolTable *table)
             !ast_type_equals(body_type, lambda->return_type))
         {
             symbol_table_pop_scope(table);
+            table->lambda = enclosing_lambda;
             type_error(expr->token, "Lambda body type does not match declared return type");
             return NULL;
         }
     }
 
     symbol_table_pop_scope(table);
+    table->lambda = enclosing_lambda;
+    lambda->enclosing = NULL;
+    thread_shared_rc_note_closure(lambda);
 
     /* Build function type */
     Type **param_types = NULL;
@@ -18,4 +18,8 @@
  */
 Type *type_check_lambda(Expr *expr, SymbolTable *table);
 
+/* Record a use of an outer local inside the body of table->lambda (and of
+ * any enclosing lambda it predates) in the lambda's captured_vars/types. */
+void type_check_lambda_capture(Expr *expr, SymbolTable *table);
+
 #endif /* TYPE_CHECKER_EXPR_LAMBDA_H */
@@ -18,6 +18,8 @@ Type *type_check_compound_assign(Expr *expr, SymbolTable *table)
         type_error(expr->token, "Invalid target in compound assignment");
         return NULL;
     }
+    if (target->type == EXPR_VARIABLE)
+        type_check_sync_write(target->as.variable.sync_decl, expr->token);
 
     /* Type check the value */
     Type *value_type = type_check_expr(value_expr, table);
@@ -3,6 +3,187 @@
 #include "type_checker/util/type_checker_util.h"
 #include "symbol_table/symbol_table_thread.h"
 #include "debug.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * Shared refcount registry (static module-level state, like the generic
+ * template registry)
+ * ============================================================================ */
+
+static const char **g_shared_rc        = NULL;
+static int          g_shared_rc_count   = 0;
+static int          g_shared_rc_capacity = 0;
+
+/* Every closure checked so far, for when one of unknown origin is shared */
+static LambdaExpr **g_closures          = NULL;
+static int          g_closure_count     = 0;
+static int          g_closure_capacity  = 0;
+static bool         g_all_closures_shared = false;
+
+bool thread_shared_rc_contains(const char *struct_name)
+{
+    if (struct_name == NULL)
+        return false;
+    for (int i = 0; i < g_shared_rc_count; i++)
+    {
+        if (strcmp(g_shared_rc[i], struct_name) == 0)
+            return true;
+    }
+    return false;
+}
+
+void thread_shared_rc_clear(void)
+{
+    free(g_shared_rc);
+    g_shared_rc          = NULL;
+    g_shared_rc_count    = 0;
+    g_shared_rc_capacity = 0;
+    free(g_closures);
+    g_closures            = NULL;
+    g_closure_count       = 0;
+    g_closure_capacity    = 0;
+    g_all_closures_shared = false;
+}
+
+static void shared_rc_mark_captures(LambdaExpr *lambda)
+{
+    for (int i = 0; i < lambda->capture_count; i++)
+        thread_shared_rc_mark(lambda->captured_types[i]);
+}
+
+/* A closure value of unknown origin could be any lambda, now or later */
+static void shared_rc_mark_all_closures(void)
+{
+    if (g_all_closures_shared)
+        return;
+    g_all_closures_shared = true;
+    DEBUG_VERBOSE("Closure of unknown origin crosses a thread boundary: marking all captures");
+    for (int i = 0; i < g_closure_count; i++)
+        shared_rc_mark_captures(g_closures[i]);
+}
+
+static void shared_rc_mark(Type *type, int depth)
+{
+    if (type == NULL || depth > 32)
+        return;
+
+    switch (type->kind)
+    {
+        case TYPE_GENERIC_INST:
+            shared_rc_mark(type->as.generic_inst.resolved, depth + 1);
+            return;
+
+        case TYPE_ARRAY:
+            shared_rc_mark(type->as.array.element_type, depth + 1);
+            return;
+
+        case TYPE_FUNCTION:
+            shared_rc_mark_all_closures();
+            return;
+
+        case TYPE_STRUCT:
+            break;
+
+        default:
+            return;
+    }
+
+    const char *name = type->as.struct_type.name;
+    if (type->as.struct_type.pass_self_by_ref && name != NULL)
+    {
+        /* Already recorded — also stops recursion through self-referencing fields */
+        if (thread_shared_rc_contains(name))
+            return;
+        if (g_shared_rc_count >= g_shared_rc_capacity)
+        {
+            g_shared_rc_capacity = g_shared_rc_capacity == 0 ? 16 : g_shared_rc_capacity * 2;
+            g_shared_rc = realloc(g_shared_rc, sizeof(const char *) * g_shared_rc_capacity);
+        }
+        g_shared_rc[g_shared_rc_count++] = name;
+        DEBUG_VERBOSE("Struct '%s' crosses a thread boundary: atomic refcount", name);
+    }
+
+    for (int i = 0; i < type->as.struct_type.field_count; i++)
+        shared_rc_mark(type->as.struct_type.fields[i].type, depth + 1);
+
+    /* Container fields are opaque; their element types show up in the
+     * native method signatures (get returns V, iter returns the iterator). */
+    if (type->as.struct_type.container_kind != CONTAINER_NONE)
+    {
+        for (int i = 0; i < type->as.struct_type.method_count; i++)
+        {
+            StructMethod *m = &type->as.struct_type.methods[i];
+            shared_rc_mark(m->return_type, depth + 1);
+            for (int j = 0; j < m->param_count; j++)
+                shared_rc_mark(m->params[j].type, depth + 1);
+        }
+    }
+}
+
+void thread_shared_rc_mark(Type *type)
+{
+    shared_rc_mark(type, 0);
+}
+
+void thread_shared_rc_note_closure(LambdaExpr *lambda)
+{
+    if (g_all_closures_shared)
+    {
+        shared_rc_mark_captures(lambda);
+        return;
+    }
+    if (g_closure_count >= g_closure_capacity)
+    {
+        g_closure_capacity = g_closure_capacity == 0 ? 16 : g_closure_capacity * 2;
+        g_closures = realloc(g_closures, sizeof(LambdaExpr *) * g_closure_capacity);
+    }
+    g_closures[g_closure_count++] = lambda;
+}
+
+/* A lambda written in place is known and a named function captures nothing;
+ * any other function value is marked through its type. */
+void thread_shared_rc_mark_value(Expr *value, SymbolTable *table)
+{
+    if (value == NULL)
+        return;
+
+    if (value->type == EXPR_LAMBDA)
+    {
+        shared_rc_mark_captures(&value->as.lambda);
+        return;
+    }
+    if (value->type == EXPR_VARIABLE)
+    {
+        Symbol *sym = symbol_table_lookup_symbol(table, value->as.variable.name);
+        if (sym != NULL && sym->is_function)
+            return;
+    }
+    thread_shared_rc_mark(value->expr_type);
+}
+
+/* Everything a spawned thread can retain or release: its arguments, the
+ * receiver of a method spawn, what a spawned closure captures, and the
+ * result handed back at sync. */
+static void thread_spawn_mark_shared(Expr *call, Type *result_type, SymbolTable *table)
+{
+    Expr **args = call->type == EXPR_STATIC_CALL ? call->as.static_call.arguments
+                                                 : call->as.call.arguments;
+    int arg_count = call->type == EXPR_STATIC_CALL ? call->as.static_call.arg_count
+                                                   : call->as.call.arg_count;
+    for (int i = 0; i < arg_count; i++)
+    {
+        thread_shared_rc_mark_value(args[i], table);
+    }
+    if (call->type == EXPR_CALL && call->as.call.callee->type == EXPR_MEMBER &&
+        call->as.call.callee->as.member.object != NULL)
+    {
+        thread_shared_rc_mark(call->as.call.callee->as.member.object->expr_type);
+    }
+    if (call->type == EXPR_CALL && call->as.call.callee->type != EXPR_MEMBER)
+        thread_shared_rc_mark_value(call->as.call.callee, table);
+    thread_shared_rc_mark(result_type);
+}
 
 Type *type_check_thread_spawn(Expr *expr, SymbolTable *table)
 {
@@ -27,6 +208,7 @@ Type *type_check_thread_spawn(Expr *expr, SymbolTable *table)
 
         /* Static methods use default modifier (no shared/private support) */
         expr->as.thread_spawn.modifier = FUNC_DEFAULT;
+        thread_spawn_mark_shared(call, result_type, table);
 
         DEBUG_VERBOSE("Thread spawn static call type checked, return type: %d", result_type->kind);
         return result_type;
@@ -126,6 +308,7 @@ Type *type_check_thread_spawn(Expr *expr, SymbolTable *table)
 
     /* Extract return type from function type */
     Type *return_type = func_type->as.function.return_type;
+    thread_spawn_mark_shared(call, return_type, table);
 
     DEBUG_VERBOSE("Thread spawn type checked, return type: %d", return_type->kind);
 
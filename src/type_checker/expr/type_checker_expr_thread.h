@@ -29,4 +29,35 @@ Type *type_check_thread_sync(Expr *expr, SymbolTable *table);
  */
 Type *type_check_thread_detach(Expr *expr, SymbolTable *table);
 
+/* ============================================================================
+ * Shared Refcount Registry
+ * ============================================================================
+ * Names of as-ref struct types whose instances can be retained/released from
+ * more than one thread: everything reachable from a spawn's arguments, its
+ * receiver and result, what a spawned closure captures, or a sync variable.
+ * Code generation gives these types atomic retain/release; all other ref
+ * structs keep the plain int refcount.
+ * ============================================================================ */
+
+/* Record type and every ref struct reachable through its fields, array
+ * elements and container element types.  A function type stands for a
+ * closure of unknown origin: the captures of every lambda are recorded. */
+void thread_shared_rc_mark(Type *type);
+
+/* Register a type-checked lambda, whose captures are marked once a
+ * function value of unknown origin is marked (a closure variable, field or
+ * parameter could hold any lambda). */
+void thread_shared_rc_note_closure(LambdaExpr *lambda);
+
+/* Mark what value retains when it is handed to another thread: its type,
+ * or for a function value the captures of the closure it may be.  An
+ * in-place lambda marks only its own captures; named functions nothing. */
+void thread_shared_rc_mark_value(Expr *value, SymbolTable *table);
+
+/* True if the named struct was recorded by thread_shared_rc_mark */
+bool thread_shared_rc_contains(const char *struct_name);
+
+/* Reset the registry (start of each type-check run) */
+void thread_shared_rc_clear(void);
+
 #endif /* TYPE_CHECKER_EXPR_THREAD_H */
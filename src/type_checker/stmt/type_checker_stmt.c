@@ -70,38 +70,112 @@ static void type_check_using(Stmt *stmt, SymbolTable *table, Type *return_type)
     type_check_stmt(stmt->as.using_stmt.body, table, return_type);
 }
 
+/* Sync variables held by enclosing lock read(...) blocks, innermost last */
+#define MAX_READ_LOCK_DEPTH 16
+static Stmt *read_locked_decls[MAX_READ_LOCK_DEPTH];
+static int read_lock_depth = 0;
+
+void type_check_sync_write(Stmt *sync_decl, Token *token)
+{
+    for (int i = 0; sync_decl != NULL && i < read_lock_depth; i++)
+    {
+        if (read_locked_decls[i] == sync_decl)
+        {
+            type_error(token, "Cannot modify a sync variable inside 'lock read' on it; use 'lock write'");
+            return;
+        }
+    }
+}
+
+/* Record the kind of lock a lock block needs on a sync variable.  Plain
+ * lock(x) works with any kind; read/write and element locks cannot be mixed
+ * on one variable. */
+static void lock_mark_target(Stmt *decl, SyncLockKind kind, Token *token)
+{
+    VarDeclStmt *var_decl = &decl->as.var_decl;
+    var_decl->is_lock_target = true;
+    if (kind == SYNC_LOCK_MUTEX)
+        return;
+    if (var_decl->lock_kind != SYNC_LOCK_MUTEX && var_decl->lock_kind != kind)
+    {
+        type_error(token, "Cannot mix 'lock read'/'lock write' and element locks on one sync variable");
+        return;
+    }
+    var_decl->lock_kind = kind;
+}
+
+/* The sync variable a lock expression names, or NULL after reporting why not */
+static Symbol *lock_sync_symbol(Expr *var_expr, SymbolTable *table)
+{
+    Symbol *lock_sym = symbol_table_lookup_symbol(table, var_expr->as.variable.name);
+    if (lock_sym == NULL)
+    {
+        type_error(var_expr->token, "Undefined variable in lock expression");
+        return NULL;
+    }
+    if (lock_sym->sync_mod != SYNC_ATOMIC)
+    {
+        type_error(var_expr->token, "Lock expression must be a sync variable");
+        return NULL;
+    }
+    return lock_sym;
+}
+
 /* Type check a lock statement */
 static void type_check_lock(Stmt *stmt, SymbolTable *table, Type *return_type)
 {
     DEBUG_VERBOSE("Type checking lock statement");
 
+    Expr *lock_expr = stmt->as.lock_stmt.lock_expr;
+    LockMode mode = stmt->as.lock_stmt.mode;
+    Stmt *lock_decl = NULL;
+
     /* Type check the lock expression */
-    type_check_expr(stmt->as.lock_stmt.lock_expr, table);
+    type_check_expr(lock_expr, table);
 
-    /* Validate that the lock expression is a sync variable */
-    if (stmt->as.lock_stmt.lock_expr->type == EXPR_VARIABLE)
+    /* Validate that the lock expression is a sync variable, or an element
+     * of a sync array (which locks only that element's stripe) */
+    if (lock_expr->type == EXPR_VARIABLE)
     {
-        Symbol *lock_sym = symbol_table_lookup_symbol(table,
-                               stmt->as.lock_stmt.lock_expr->as.variable.name);
-        if (lock_sym == NULL)
+        Symbol *lock_sym = lock_sync_symbol(lock_expr, table);
+        if (lock_sym != NULL && lock_sym->var_decl_origin != NULL)
         {
-            type_error(stmt->as.lock_stmt.lock_expr->token,
-                       "Undefined variable in lock expression");
+            /* Only variables named by a lock block get a lock object */
+            lock_decl = lock_sym->var_decl_origin;
+            lock_mark_target(lock_decl, mode == LOCK_MODE_EXCLUSIVE ? SYNC_LOCK_MUTEX : SYNC_LOCK_RW,
+                             lock_expr->token);
         }
-        else if (lock_sym->sync_mod != SYNC_ATOMIC)
+    }
+    else if (lock_expr->type == EXPR_ARRAY_ACCESS &&
+             lock_expr->as.array_access.array->type == EXPR_VARIABLE)
+    {
+        Expr *array_expr = lock_expr->as.array_access.array;
+        Symbol *lock_sym = lock_sync_symbol(array_expr, table);
+        if (lock_sym != NULL && (lock_sym->type == NULL || lock_sym->type->kind != TYPE_ARRAY))
+        {
+            type_error(lock_expr->token, "Element locks need a sync array");
+        }
+        else if (lock_sym != NULL && mode != LOCK_MODE_EXCLUSIVE)
         {
-            type_error(stmt->as.lock_stmt.lock_expr->token,
-                       "Lock expression must be a sync variable");
+            type_error(lock_expr->token, "'lock read'/'lock write' must name a whole sync variable");
+        }
+        else if (lock_sym != NULL && lock_sym->var_decl_origin != NULL)
+        {
+            lock_mark_target(lock_sym->var_decl_origin, SYNC_LOCK_STRIPED, lock_expr->token);
         }
     }
     else
     {
-        type_error(stmt->as.lock_stmt.lock_expr->token,
-                   "Lock expression must be a sync variable");
+        type_error(lock_expr->token, "Lock expression must be a sync variable");
     }
 
-    /* Type check the body */
+    /* Type check the body, remembering shared holds so writes can be refused */
+    bool shared = mode == LOCK_MODE_READ && lock_decl != NULL && read_lock_depth < MAX_READ_LOCK_DEPTH;
+    if (shared)
+        read_locked_decls[read_lock_depth++] = lock_decl;
     type_check_stmt(stmt->as.lock_stmt.body, table, return_type);
+    if (shared)
+        read_lock_depth--;
 }
 
 /* Type check a type declaration statement */
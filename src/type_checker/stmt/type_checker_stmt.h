@@ -7,4 +7,8 @@
 /* Statement type checking */
 void type_check_stmt(Stmt *stmt, SymbolTable *table, Type *return_type);
 
+/* Reports an update of the sync variable declared by sync_decl made inside a
+ * lock read(...) block on it.  sync_decl may be NULL (not a sync variable). */
+void type_check_sync_write(Stmt *sync_decl, Token *token);
+
 #endif /* TYPE_CHECKER_STMT_H */
@@ -1,8 +1,11 @@
 #include "type_checker/stmt/type_checker_stmt_control.h"
 #include "type_checker/stmt/type_checker_stmt.h"
 #include "type_checker/util/type_checker_util.h"
+#include "type_checker/util/type_checker_util_parallel.h"
 #include "type_checker/expr/type_checker_expr.h"
+#include "type_checker/expr/type_checker_expr_thread.h"
 #include "symbol_table/symbol_table_core.h"
+#include "symbol_table/symbol_table_thread.h"
 #include "debug.h"
 #include <stdio.h>
 #include <string.h>
@@ -103,16 +106,77 @@ void type_check_return(Stmt *stmt, SymbolTable *table, Type *return_type)
     }
 }
 
+/* A value returned from inside an arena block would outlive the region it
+ * was allocated in.  Lambda bodies return to their caller, so they are not
+ * walked. */
+static void check_arena_returns(Stmt *stmt)
+{
+    if (stmt == NULL) return;
+    switch (stmt->type)
+    {
+    case STMT_RETURN:
+    {
+        Expr *value = stmt->as.return_stmt.value;
+        if (value != NULL && value->expr_type != NULL && !can_escape_private(value->expr_type))
+        {
+            type_error(stmt->token, "Cannot return a heap value from inside an arena block; "
+                                    "assign it to a variable declared outside the block");
+        }
+        break;
+    }
+    case STMT_BLOCK:
+        for (int i = 0; i < stmt->as.block.count; i++)
+        {
+            Stmt *inner = stmt->as.block.statements[i];
+            /* Nested arena blocks were checked when they closed */
+            if (inner->type != STMT_BLOCK || inner->as.block.modifier != BLOCK_ARENA)
+                check_arena_returns(inner);
+        }
+        break;
+    case STMT_IF:
+        check_arena_returns(stmt->as.if_stmt.then_branch);
+        check_arena_returns(stmt->as.if_stmt.else_branch);
+        break;
+    case STMT_WHILE:
+        check_arena_returns(stmt->as.while_stmt.body);
+        break;
+    case STMT_FOR:
+        check_arena_returns(stmt->as.for_stmt.body);
+        break;
+    case STMT_FOR_EACH:
+        check_arena_returns(stmt->as.for_each_stmt.body);
+        break;
+    case STMT_LOCK:
+        check_arena_returns(stmt->as.lock_stmt.body);
+        break;
+    case STMT_USING:
+        check_arena_returns(stmt->as.using_stmt.body);
+        break;
+    default:
+        break;
+    }
+}
+
 void type_check_block(Stmt *stmt, SymbolTable *table, Type *return_type)
 {
     DEBUG_VERBOSE("Type checking block with %d statements", stmt->as.block.count);
 
+    bool is_arena = stmt->as.block.modifier == BLOCK_ARENA;
+    if (is_arena)
+    {
+        symbol_table_enter_arena(table);
+    }
     symbol_table_push_scope(table);
     for (int i = 0; i < stmt->as.block.count; i++)
     {
         type_check_stmt(stmt->as.block.statements[i], table, return_type);
     }
     symbol_table_pop_scope(table);
+    if (is_arena)
+    {
+        symbol_table_exit_arena(table);
+        check_arena_returns(stmt);
+    }
 }
 
 void type_check_if(Stmt *stmt, SymbolTable *table, Type *return_type)
@@ -175,6 +239,125 @@ void type_check_for(Stmt *stmt, SymbolTable *table, Type *return_type)
     symbol_table_pop_scope(table);
 }
 
+/* Iterations of a parallel loop run as independent chunks, so nothing in the
+ * body may leave the loop early.  'break' inside a nested loop is fine. */
+static void check_parallel_body(Stmt *stmt, int loop_nesting)
+{
+    if (stmt == NULL) return;
+    switch (stmt->type)
+    {
+    case STMT_RETURN:
+        type_error(stmt->token, "Cannot return from inside a parallel loop");
+        break;
+    case STMT_BREAK:
+        if (loop_nesting == 0)
+            type_error(stmt->token, "Cannot break out of a parallel loop; use 'continue' to skip an iteration");
+        break;
+    case STMT_BLOCK:
+        for (int i = 0; i < stmt->as.block.count; i++)
+            check_parallel_body(stmt->as.block.statements[i], loop_nesting);
+        break;
+    case STMT_IF:
+        check_parallel_body(stmt->as.if_stmt.then_branch, loop_nesting);
+        check_parallel_body(stmt->as.if_stmt.else_branch, loop_nesting);
+        break;
+    case STMT_WHILE:
+        check_parallel_body(stmt->as.while_stmt.body, loop_nesting + 1);
+        break;
+    case STMT_FOR:
+        check_parallel_body(stmt->as.for_stmt.body, loop_nesting + 1);
+        break;
+    case STMT_FOR_EACH:
+        /* Nested parallel loops were checked when they closed */
+        if (stmt->as.for_each_stmt.parallel == NULL)
+            check_parallel_body(stmt->as.for_each_stmt.body, loop_nesting + 1);
+        break;
+    case STMT_LOCK:
+        check_parallel_body(stmt->as.lock_stmt.body, loop_nesting);
+        break;
+    case STMT_USING:
+        check_parallel_body(stmt->as.using_stmt.body, loop_nesting);
+        break;
+    default:
+        break;
+    }
+}
+
+/* Schedule and reduction clauses of a parallel for-loop.  They are evaluated
+ * once, before any iteration runs. */
+static bool type_check_parallel_clause(Stmt *stmt, Type *iterable_type, SymbolTable *table)
+{
+    ParallelClause *parallel = stmt->as.for_each_stmt.parallel;
+    char msg[512];
+
+    if (iterable_type->kind != TYPE_ARRAY)
+    {
+        type_error(stmt->as.for_each_stmt.iterable->token,
+                   "Parallel for-loops iterate over arrays and ranges");
+        return false;
+    }
+    if (symbol_table_get_arena_depth(table) > 0)
+    {
+        type_error(stmt->token, "Cannot run a parallel loop inside an arena block");
+        return false;
+    }
+
+    if (parallel->chunk != NULL)
+    {
+        Type *chunk_type = type_check_expr(parallel->chunk, table);
+        if (chunk_type != NULL && chunk_type->kind != TYPE_INT && chunk_type->kind != TYPE_LONG)
+        {
+            type_error(parallel->chunk->token, "Parallel chunk size must be an int or long");
+            return false;
+        }
+    }
+
+    for (int i = 0; i < parallel->reduction_count; i++)
+    {
+        Token name = parallel->reductions[i].var_name;
+        Symbol *sym = symbol_table_lookup_symbol(table, name);
+        if (sym == NULL)
+        {
+            snprintf(msg, sizeof(msg), "Undefined variable '%.*s' in reduce clause", name.length, name.start);
+            type_error(&parallel->reductions[i].var_name, msg);
+            return false;
+        }
+        if (sym->is_function || sym->kind == SYMBOL_GLOBAL || sym->is_static || sym->kind == SYMBOL_TYPE)
+        {
+            snprintf(msg, sizeof(msg), "Reduction variable '%.*s' must be a local variable", name.length, name.start);
+            type_error(&parallel->reductions[i].var_name, msg);
+            return false;
+        }
+        if (!is_numeric_type(sym->type))
+        {
+            snprintf(msg, sizeof(msg), "Reduction variable '%.*s' must be numeric, got %s",
+                     name.length, name.start, type_name(sym->type));
+            type_error(&parallel->reductions[i].var_name, msg);
+            return false;
+        }
+        if (sym->sync_mod == SYNC_ATOMIC)
+        {
+            snprintf(msg, sizeof(msg), "Reduction variable '%.*s' is 'sync'; drop the reduce clause or the 'sync'",
+                     name.length, name.start);
+            type_error(&parallel->reductions[i].var_name, msg);
+            return false;
+        }
+        for (int j = 0; j < i; j++)
+        {
+            if (symbol_table_tokens_equal(parallel->reductions[j].var_name, name))
+            {
+                snprintf(msg, sizeof(msg), "Variable '%.*s' appears in more than one reduce clause",
+                         name.length, name.start);
+                type_error(&parallel->reductions[i].var_name, msg);
+                return false;
+            }
+        }
+    }
+
+    stmt->as.for_each_stmt.element_type = iterable_type->as.array.element_type;
+    return true;
+}
+
 void type_check_for_each(Stmt *stmt, SymbolTable *table, Type *return_type)
 {
     DEBUG_VERBOSE("Type checking for-each statement");
@@ -186,6 +369,12 @@ void type_check_for_each(Stmt *stmt, SymbolTable *table, Type *return_type)
         return;
     }
 
+    ParallelClause *parallel = stmt->as.for_each_stmt.parallel;
+    if (parallel != NULL && !type_check_parallel_clause(stmt, iterable_type, table))
+    {
+        return;
+    }
+
     Type *element_type = NULL;
 
     if (iterable_type->kind == TYPE_ARRAY)
@@ -294,6 +483,19 @@ void type_check_for_each(Stmt *stmt, SymbolTable *table, Type *return_type)
         return;
     }
 
+    /* Uses of outer variables in a parallel body are recorded against the
+     * clause while the body is checked (see type_check_parallel_access) */
+    ParallelClause *enclosing_parallel = table->parallel_loop;
+    if (parallel != NULL)
+    {
+        parallel->outer_scope_depth = table->scope_depth;
+        parallel->enclosing = enclosing_parallel;
+        parallel->capture_count = 0;
+        table->parallel_loop = parallel;
+        /* Iterations run on worker threads, each holding its element */
+        thread_shared_rc_mark(element_type);
+    }
+
     /* Create a new scope and add the loop variable.
      * Use SYMBOL_PARAM so it's not freed - loop var is a reference to element. */
     symbol_table_push_scope(table);
@@ -305,4 +507,11 @@ void type_check_for_each(Stmt *stmt, SymbolTable *table, Type *return_type)
     symbol_table_exit_loop(table);
 
     symbol_table_pop_scope(table);
+
+    if (parallel != NULL)
+    {
+        table->parallel_loop = enclosing_parallel;
+        parallel->enclosing = NULL;
+        check_parallel_body(stmt->as.for_each_stmt.body, 0);
+    }
 }
@@ -169,6 +169,27 @@ void type_check_function(Stmt *stmt, SymbolTable *table)
 
     /* Create function type from declaration */
     Arena *arena = table->arena;
+
+    /* Resolve generic instantiations in the signature (e.g. fn f(m: map<str, int>))
+     * so parameters and the return type carry the monomorphized struct type. */
+    for (int i = 0; i < stmt->as.function.param_count; i++)
+    {
+        Type *pt = stmt->as.function.params[i].type;
+        if (pt != NULL && pt->kind == TYPE_GENERIC_INST)
+        {
+            Type *resolved = resolve_generic_instantiation(arena, pt, table);
+            if (resolved != NULL)
+                stmt->as.function.params[i].type = resolved;
+        }
+    }
+    if (stmt->as.function.return_type != NULL &&
+        stmt->as.function.return_type->kind == TYPE_GENERIC_INST)
+    {
+        Type *resolved = resolve_generic_instantiation(arena, stmt->as.function.return_type, table);
+        if (resolved != NULL)
+            stmt->as.function.return_type = resolved;
+    }
+
     Type **param_types = (Type **)arena_alloc(arena, sizeof(Type *) * stmt->as.function.param_count);
     for (int i = 0; i < stmt->as.function.param_count; i++) {
         Type *param_type = stmt->as.function.params[i].type;
@@ -284,6 +305,7 @@ void type_check_function(Stmt *stmt, SymbolTable *table)
                 type_error(&param.name, "'as ref' only applies to primitive or struct parameters");
             }
         }
+        check_array_alignment(param.type, &param.name);
 
         symbol_table_add_symbol_full(table, param.name, param.type, SYMBOL_PARAM, param.mem_qualifier);
 
@@ -79,6 +79,7 @@ void process_nested_imports_recursive(Stmt **stmts, int count, SymbolTable *tabl
                     struct_decl->methods, struct_decl->method_count,
                     struct_decl->is_native, struct_decl->is_packed,
                     struct_decl->pass_self_by_ref, struct_decl->c_alias);
+                struct_type->as.struct_type.min_alignment = struct_decl->min_alignment;
 
                 symbol_table_add_struct_to_namespace(table, nested_ns_token, struct_name,
                     struct_type, nested_stmt);
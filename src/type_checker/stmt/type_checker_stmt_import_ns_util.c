@@ -214,6 +214,7 @@ void register_vars_and_structs_in_namespace(ImportStmt *import, Token ns_token,
                 struct_decl->methods, struct_decl->method_count,
                 struct_decl->is_native, struct_decl->is_packed,
                 struct_decl->pass_self_by_ref, struct_decl->c_alias);
+            struct_type->as.struct_type.min_alignment = struct_decl->min_alignment;
 
             symbol_table_add_struct_to_namespace(table, ns_token, struct_name,
                 struct_type, imported_stmt);
@@ -102,6 +102,8 @@ void type_check_struct_decl(Stmt *stmt, SymbolTable *table)
             type_error(&struct_decl->name, msg);
         }
 
+        check_array_alignment(field_type, &struct_decl->name);
+
         /* Type check default value if present */
         if (field->default_value != NULL)
         {
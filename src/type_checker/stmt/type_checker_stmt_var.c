@@ -2,6 +2,7 @@
 #include "type_checker/stmt/type_checker_stmt_var_util.h"
 #include "type_checker/util/type_checker_util.h"
 #include "type_checker/expr/type_checker_expr.h"
+#include "type_checker/expr/type_checker_expr_thread.h"
 #include "type_checker/type_checker_generics.h"
 #include "symbol_table/symbol_table_core.h"
 #include "debug.h"
@@ -245,6 +246,8 @@ void type_check_var_decl(Stmt *stmt, SymbolTable *table, Type *return_type)
         }
     }
 
+    check_array_alignment(decl_type, &stmt->as.var_decl.name);
+
     /* Reject pointer variable declarations in non-native functions */
     if (decl_type && decl_type->kind == TYPE_POINTER && !native_context_is_active())
     {
@@ -297,7 +300,7 @@ void type_check_var_decl(Stmt *stmt, SymbolTable *table, Type *return_type)
         }
     }
 
-    /* Handle sync modifier — creates a mutex for the variable */
+    /* Handle sync modifier — updates are lowered to atomic instructions */
     if (stmt->as.var_decl.sync_modifier == SYNC_ATOMIC)
     {
         Symbol *symbol = symbol_table_lookup_symbol_current(table, stmt->as.var_decl.name);
@@ -305,6 +308,8 @@ void type_check_var_decl(Stmt *stmt, SymbolTable *table, Type *return_type)
         {
             symbol->sync_mod = SYNC_ATOMIC;
         }
+        /* Sync variables are meant to be reached from several threads */
+        thread_shared_rc_mark(decl_type);
     }
 
     /* Handle static modifier */
@@ -317,6 +322,13 @@ void type_check_var_decl(Stmt *stmt, SymbolTable *table, Type *return_type)
         }
     }
 
+    /* Thread-local storage only exists for module-level variables */
+    if (stmt->as.var_decl.is_thread_local && table->current != table->global_scope)
+    {
+        type_error(&stmt->as.var_decl.name,
+                   "'threadlocal' can only be used on module-level variables");
+    }
+
     /* Check: nil can only be assigned to reference/pointer types */
     if (init_type && init_type->kind == TYPE_NIL &&
         decl_type->kind != TYPE_POINTER &&
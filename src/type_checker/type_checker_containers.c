@@ -0,0 +1,538 @@
+/* type_checker_containers.c - Built-in generic container templates
+ *
+ * Builds the synthetic template declarations for map<K, V>, MapEntry<K, V>,
+ * MapIter<K, V>, set<T>, SetIter<T>, deque<T>, DequeIter<T>, bits,
+ * BitsIter, channel<T>, ChannelIter<T>, taskgroup<T>, TaskGroupIter<T> and the
+ * pipeline element structs Enumerated<T> and Zipped<A, B>, and registers them
+ * in the generic template registry (bits and BitsIter are templates with no
+ * type parameters).
+ * Type parameters are TYPE_OPAQUE placeholders, exactly what the parser
+ * produces for a user-declared `struct Name<K, V>` template.
+ */
+
+#include "type_checker/type_checker_containers.h"
+#include "type_checker/type_checker_generics.h"
+#include "type_checker/util/type_checker_util.h"
+#include "ast/ast_type.h"
+#include "debug.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* ============================================================================
+ * Declaration builders
+ * ============================================================================ */
+
+static Parameter container_param(const char *name, Type *type)
+{
+    return (Parameter){ .name = { .start = name, .length = (int)strlen(name) },
+        .type = type, .mem_qualifier = MEM_DEFAULT, .sync_modifier = SYNC_NONE };
+}
+
+static StructMethod container_method(const char *name, Parameter *params, int param_count,
+                                     Type *return_type)
+{
+    return (StructMethod){ .name = name, .params = params, .param_count = param_count,
+        .return_type = return_type, .is_native = true,
+        .name_token = { .start = name, .length = (int)strlen(name) } };
+}
+
+static StructDeclStmt *container_decl(Arena *arena, const char *name, ContainerKind kind,
+                                      bool pass_self_by_ref, const char **type_params,
+                                      int type_param_count)
+{
+    StructDeclStmt *decl = arena_alloc(arena, sizeof(StructDeclStmt));
+    memset(decl, 0, sizeof(StructDeclStmt));
+    decl->name.start = name;
+    decl->name.length = (int)strlen(name);
+    decl->name.type = TOKEN_IDENTIFIER;
+    decl->name.filename = "<built-in>";
+    decl->pass_self_by_ref = pass_self_by_ref;
+    decl->container_kind = kind;
+    decl->type_params = type_params;
+    decl->type_param_count = type_param_count;
+    return decl;
+}
+
+/* ============================================================================
+ * Registration
+ * ============================================================================ */
+
+void container_register_templates(Arena *arena)
+{
+    static const char *kv_params[] = { "K", "V" };
+
+    Type *k = ast_create_opaque_type(arena, "K");
+    Type *v = ast_create_opaque_type(arena, "V");
+    Type *t_void = ast_create_primitive_type(arena, TYPE_VOID);
+    Type *t_bool = ast_create_primitive_type(arena, TYPE_BOOL);
+    Type *t_int = ast_create_primitive_type(arena, TYPE_INT);
+
+    Type **kv = arena_alloc(arena, sizeof(Type *) * 2);
+    kv[0] = k;
+    kv[1] = v;
+
+    // map<K, V> — refcounted, no Sindarin-visible fields
+    {
+        StructDeclStmt *decl = container_decl(arena, "map", CONTAINER_MAP, true, kv_params, 2);
+
+        Parameter *p_key = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_key[0] = container_param("key", k);
+        Parameter *p_set = arena_alloc(arena, sizeof(Parameter) * 2);
+        p_set[0] = container_param("key", k);
+        p_set[1] = container_param("value", v);
+        Parameter *p_get_or = arena_alloc(arena, sizeof(Parameter) * 2);
+        p_get_or[0] = container_param("key", k);
+        p_get_or[1] = container_param("fallback", v);
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 11);
+        int n = 0;
+        methods[n++] = container_method("set", p_set, 2, t_void);
+        methods[n++] = container_method("get", p_key, 1, v);
+        methods[n++] = container_method("getOr", p_get_or, 2, v);
+        methods[n++] = container_method("has", p_key, 1, t_bool);
+        methods[n++] = container_method("remove", p_key, 1, t_bool);
+        methods[n++] = container_method("length", NULL, 0, t_int);
+        methods[n++] = container_method("clear", NULL, 0, t_void);
+        methods[n++] = container_method("keys", NULL, 0, ast_create_array_type(arena, k));
+        methods[n++] = container_method("values", NULL, 0, ast_create_array_type(arena, v));
+        methods[n++] = container_method("clone", NULL, 0,
+            ast_create_generic_inst_type(arena, "map", kv, 2));
+        methods[n++] = container_method("iter", NULL, 0,
+            ast_create_generic_inst_type(arena, "MapIter", kv, 2));
+        decl->methods = methods;
+        decl->method_count = n;
+
+        generic_registry_register_template("map", decl);
+    }
+
+    // MapEntry<K, V> — plain val struct yielded by map iteration
+    {
+        StructDeclStmt *decl = container_decl(arena, "MapEntry", CONTAINER_NONE, false, kv_params, 2);
+        StructField *fields = arena_alloc(arena, sizeof(StructField) * 2);
+        memset(fields, 0, sizeof(StructField) * 2);
+        fields[0].name = "key";
+        fields[0].type = k;
+        fields[1].name = "value";
+        fields[1].type = v;
+        decl->fields = fields;
+        decl->field_count = 2;
+
+        generic_registry_register_template("MapEntry", decl);
+    }
+
+    // MapIter<K, V> — val struct holding a reference to the map and a slot cursor
+    {
+        StructDeclStmt *decl = container_decl(arena, "MapIter", CONTAINER_MAP_ITER, false, kv_params, 2);
+        StructField *fields = arena_alloc(arena, sizeof(StructField) * 2);
+        memset(fields, 0, sizeof(StructField) * 2);
+        fields[0].name = "_map";
+        fields[0].type = ast_create_generic_inst_type(arena, "map", kv, 2);
+        fields[1].name = "_pos";
+        fields[1].type = t_int;
+        decl->fields = fields;
+        decl->field_count = 2;
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 2);
+        methods[0] = container_method("hasNext", NULL, 0, t_bool);
+        methods[1] = container_method("next", NULL, 0,
+            ast_create_generic_inst_type(arena, "MapEntry", kv, 2));
+        decl->methods = methods;
+        decl->method_count = 2;
+
+        generic_registry_register_template("MapIter", decl);
+    }
+
+    static const char *t_params[] = { "T" };
+    Type *t = ast_create_opaque_type(arena, "T");
+    Type **t_args = arena_alloc(arena, sizeof(Type *) * 1);
+    t_args[0] = t;
+
+    // set<T> — refcounted, no Sindarin-visible fields
+    {
+        StructDeclStmt *decl = container_decl(arena, "set", CONTAINER_SET, true, t_params, 1);
+        Type *t_set = ast_create_generic_inst_type(arena, "set", t_args, 1);
+
+        Parameter *p_value = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_value[0] = container_param("value", t);
+        Parameter *p_other = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_other[0] = container_param("other", t_set);
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 11);
+        int n = 0;
+        methods[n++] = container_method("add", p_value, 1, t_bool);
+        methods[n++] = container_method("contains", p_value, 1, t_bool);
+        methods[n++] = container_method("remove", p_value, 1, t_bool);
+        methods[n++] = container_method("length", NULL, 0, t_int);
+        methods[n++] = container_method("clear", NULL, 0, t_void);
+        methods[n++] = container_method("union", p_other, 1, t_set);
+        methods[n++] = container_method("intersect", p_other, 1, t_set);
+        methods[n++] = container_method("difference", p_other, 1, t_set);
+        methods[n++] = container_method("toArray", NULL, 0, ast_create_array_type(arena, t));
+        methods[n++] = container_method("clone", NULL, 0, t_set);
+        methods[n++] = container_method("iter", NULL, 0,
+            ast_create_generic_inst_type(arena, "SetIter", t_args, 1));
+        decl->methods = methods;
+        decl->method_count = n;
+
+        generic_registry_register_template("set", decl);
+    }
+
+    // SetIter<T> — val struct holding a reference to the set and a position
+    {
+        StructDeclStmt *decl = container_decl(arena, "SetIter", CONTAINER_SET_ITER, false, t_params, 1);
+        StructField *fields = arena_alloc(arena, sizeof(StructField) * 2);
+        memset(fields, 0, sizeof(StructField) * 2);
+        fields[0].name = "_set";
+        fields[0].type = ast_create_generic_inst_type(arena, "set", t_args, 1);
+        fields[1].name = "_pos";
+        fields[1].type = t_int;
+        decl->fields = fields;
+        decl->field_count = 2;
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 2);
+        methods[0] = container_method("hasNext", NULL, 0, t_bool);
+        methods[1] = container_method("next", NULL, 0, t);
+        decl->methods = methods;
+        decl->method_count = 2;
+
+        generic_registry_register_template("SetIter", decl);
+    }
+
+    // deque<T> — refcounted ring buffer, no Sindarin-visible fields
+    {
+        StructDeclStmt *decl = container_decl(arena, "deque", CONTAINER_DEQUE, true, t_params, 1);
+
+        Parameter *p_value = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_value[0] = container_param("value", t);
+        Parameter *p_index = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_index[0] = container_param("index", t_int);
+        Parameter *p_set = arena_alloc(arena, sizeof(Parameter) * 2);
+        p_set[0] = container_param("index", t_int);
+        p_set[1] = container_param("value", t);
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 13);
+        int n = 0;
+        methods[n++] = container_method("pushBack", p_value, 1, t_void);
+        methods[n++] = container_method("pushFront", p_value, 1, t_void);
+        methods[n++] = container_method("popBack", NULL, 0, t);
+        methods[n++] = container_method("popFront", NULL, 0, t);
+        methods[n++] = container_method("front", NULL, 0, t);
+        methods[n++] = container_method("back", NULL, 0, t);
+        methods[n++] = container_method("get", p_index, 1, t);
+        methods[n++] = container_method("set", p_set, 2, t_void);
+        methods[n++] = container_method("length", NULL, 0, t_int);
+        methods[n++] = container_method("clear", NULL, 0, t_void);
+        methods[n++] = container_method("toArray", NULL, 0, ast_create_array_type(arena, t));
+        methods[n++] = container_method("clone", NULL, 0,
+            ast_create_generic_inst_type(arena, "deque", t_args, 1));
+        methods[n++] = container_method("iter", NULL, 0,
+            ast_create_generic_inst_type(arena, "DequeIter", t_args, 1));
+        decl->methods = methods;
+        decl->method_count = n;
+
+        generic_registry_register_template("deque", decl);
+    }
+
+    // DequeIter<T> — val struct holding a reference to the deque and an index
+    {
+        StructDeclStmt *decl = container_decl(arena, "DequeIter", CONTAINER_DEQUE_ITER, false, t_params, 1);
+        StructField *fields = arena_alloc(arena, sizeof(StructField) * 2);
+        memset(fields, 0, sizeof(StructField) * 2);
+        fields[0].name = "_deque";
+        fields[0].type = ast_create_generic_inst_type(arena, "deque", t_args, 1);
+        fields[1].name = "_pos";
+        fields[1].type = t_int;
+        decl->fields = fields;
+        decl->field_count = 2;
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 2);
+        methods[0] = container_method("hasNext", NULL, 0, t_bool);
+        methods[1] = container_method("next", NULL, 0, t);
+        decl->methods = methods;
+        decl->method_count = 2;
+
+        generic_registry_register_template("DequeIter", decl);
+    }
+
+    // bits — refcounted packed bool sequence, no Sindarin-visible fields
+    {
+        StructDeclStmt *decl = container_decl(arena, "bits", CONTAINER_BITS, true, NULL, 0);
+        Type *t_bits = ast_create_generic_inst_type(arena, "bits", NULL, 0);
+
+        Parameter *p_len = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_len[0] = container_param("length", t_int);
+        Parameter *p_index = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_index[0] = container_param("index", t_int);
+        Parameter *p_set = arena_alloc(arena, sizeof(Parameter) * 2);
+        p_set[0] = container_param("index", t_int);
+        p_set[1] = container_param("value", t_bool);
+        Parameter *p_value = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_value[0] = container_param("value", t_bool);
+        Parameter *p_other = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_other[0] = container_param("other", t_bits);
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 13);
+        int n = 0;
+        methods[n++] = container_method("resize", p_len, 1, t_void);
+        methods[n++] = container_method("get", p_index, 1, t_bool);
+        methods[n++] = container_method("set", p_set, 2, t_void);
+        methods[n++] = container_method("push", p_value, 1, t_void);
+        methods[n++] = container_method("length", NULL, 0, t_int);
+        methods[n++] = container_method("count", NULL, 0, t_int);
+        methods[n++] = container_method("fill", p_value, 1, t_void);
+        methods[n++] = container_method("and", p_other, 1, t_bits);
+        methods[n++] = container_method("or", p_other, 1, t_bits);
+        methods[n++] = container_method("xor", p_other, 1, t_bits);
+        methods[n++] = container_method("toArray", NULL, 0, ast_create_array_type(arena, t_bool));
+        methods[n++] = container_method("clone", NULL, 0, t_bits);
+        methods[n++] = container_method("iter", NULL, 0,
+            ast_create_generic_inst_type(arena, "BitsIter", NULL, 0));
+        decl->methods = methods;
+        decl->method_count = n;
+
+        generic_registry_register_template("bits", decl);
+    }
+
+    // BitsIter — val struct holding a reference to the bits and an index
+    {
+        StructDeclStmt *decl = container_decl(arena, "BitsIter", CONTAINER_BITS_ITER, false, NULL, 0);
+        StructField *fields = arena_alloc(arena, sizeof(StructField) * 2);
+        memset(fields, 0, sizeof(StructField) * 2);
+        fields[0].name = "_bits";
+        fields[0].type = ast_create_generic_inst_type(arena, "bits", NULL, 0);
+        fields[1].name = "_pos";
+        fields[1].type = t_int;
+        decl->fields = fields;
+        decl->field_count = 2;
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 2);
+        methods[0] = container_method("hasNext", NULL, 0, t_bool);
+        methods[1] = container_method("next", NULL, 0, t_bool);
+        decl->methods = methods;
+        decl->method_count = 2;
+
+        generic_registry_register_template("BitsIter", decl);
+    }
+
+    // channel<T> — refcounted bounded MPMC queue shared between threads
+    {
+        StructDeclStmt *decl = container_decl(arena, "channel", CONTAINER_CHANNEL, true, t_params, 1);
+
+        Parameter *p_value = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_value[0] = container_param("value", t);
+        Parameter *p_fallback = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_fallback[0] = container_param("fallback", t);
+        Parameter *p_capacity = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_capacity[0] = container_param("capacity", t_int);
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 10);
+        int n = 0;
+        methods[n++] = container_method("send", p_value, 1, t_void);
+        methods[n++] = container_method("trySend", p_value, 1, t_bool);
+        methods[n++] = container_method("receive", NULL, 0, t);
+        methods[n++] = container_method("tryReceive", p_fallback, 1, t);
+        methods[n++] = container_method("close", NULL, 0, t_void);
+        methods[n++] = container_method("isClosed", NULL, 0, t_bool);
+        methods[n++] = container_method("length", NULL, 0, t_int);
+        methods[n++] = container_method("capacity", NULL, 0, t_int);
+        methods[n++] = container_method("setCapacity", p_capacity, 1, t_void);
+        methods[n++] = container_method("iter", NULL, 0,
+            ast_create_generic_inst_type(arena, "ChannelIter", t_args, 1));
+        decl->methods = methods;
+        decl->method_count = n;
+
+        generic_registry_register_template("channel", decl);
+    }
+
+    // ChannelIter<T> — val struct holding the channel and the element that
+    // hasNext() received for next() to hand out
+    {
+        StructDeclStmt *decl = container_decl(arena, "ChannelIter", CONTAINER_CHANNEL_ITER, false, t_params, 1);
+        StructField *fields = arena_alloc(arena, sizeof(StructField) * 2);
+        memset(fields, 0, sizeof(StructField) * 2);
+        fields[0].name = "_channel";
+        fields[0].type = ast_create_generic_inst_type(arena, "channel", t_args, 1);
+        fields[1].name = "_item";
+        fields[1].type = t;
+        decl->fields = fields;
+        decl->field_count = 2;
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 2);
+        methods[0] = container_method("hasNext", NULL, 0, t_bool);
+        methods[1] = container_method("next", NULL, 0, t);
+        decl->methods = methods;
+        decl->method_count = 2;
+
+        generic_registry_register_template("ChannelIter", decl);
+    }
+
+    // taskgroup<T> — refcounted set of spawned tasks, collected in the order
+    // they finish.  add() takes a `&` spawn expression (checked at the call).
+    {
+        StructDeclStmt *decl = container_decl(arena, "taskgroup", CONTAINER_TASK_GROUP, true, t_params, 1);
+
+        Parameter *p_task = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_task[0] = container_param("task", t);
+        Parameter *p_ms = arena_alloc(arena, sizeof(Parameter) * 1);
+        p_ms[0] = container_param("ms", t_int);
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 7);
+        int n = 0;
+        methods[n++] = container_method("add", p_task, 1, t_void);
+        methods[n++] = container_method("waitAny", NULL, 0, t);
+        methods[n++] = container_method("pending", NULL, 0, t_int);
+        methods[n++] = container_method("cancel", NULL, 0, t_void);
+        methods[n++] = container_method("isCancelled", NULL, 0, t_bool);
+        methods[n++] = container_method("setDeadline", p_ms, 1, t_void);
+        methods[n++] = container_method("iter", NULL, 0,
+            ast_create_generic_inst_type(arena, "TaskGroupIter", t_args, 1));
+        decl->methods = methods;
+        decl->method_count = n;
+
+        generic_registry_register_template("taskgroup", decl);
+    }
+
+    // TaskGroupIter<T> — val struct holding the group and the result that
+    // hasNext() collected for next() to hand out
+    {
+        StructDeclStmt *decl = container_decl(arena, "TaskGroupIter", CONTAINER_TASK_GROUP_ITER, false, t_params, 1);
+        StructField *fields = arena_alloc(arena, sizeof(StructField) * 2);
+        memset(fields, 0, sizeof(StructField) * 2);
+        fields[0].name = "_group";
+        fields[0].type = ast_create_generic_inst_type(arena, "taskgroup", t_args, 1);
+        fields[1].name = "_item";
+        fields[1].type = t;
+        decl->fields = fields;
+        decl->field_count = 2;
+
+        StructMethod *methods = arena_alloc(arena, sizeof(StructMethod) * 2);
+        methods[0] = container_method("hasNext", NULL, 0, t_bool);
+        methods[1] = container_method("next", NULL, 0, t);
+        decl->methods = methods;
+        decl->method_count = 2;
+
+        generic_registry_register_template("TaskGroupIter", decl);
+    }
+
+    // Enumerated<T> — plain val struct yielded by a pipeline's enumerate()
+    {
+        StructDeclStmt *decl = container_decl(arena, "Enumerated", CONTAINER_NONE, false, t_params, 1);
+        StructField *fields = arena_alloc(arena, sizeof(StructField) * 2);
+        memset(fields, 0, sizeof(StructField) * 2);
+        fields[0].name = "index";
+        fields[0].type = t_int;
+        fields[1].name = "value";
+        fields[1].type = t;
+        decl->fields = fields;
+        decl->field_count = 2;
+
+        generic_registry_register_template("Enumerated", decl);
+    }
+
+    // Zipped<A, B> — plain val struct yielded by a pipeline's zip(other)
+    {
+        static const char *ab_params[] = { "A", "B" };
+        StructDeclStmt *decl = container_decl(arena, "Zipped", CONTAINER_NONE, false, ab_params, 2);
+        StructField *fields = arena_alloc(arena, sizeof(StructField) * 2);
+        memset(fields, 0, sizeof(StructField) * 2);
+        fields[0].name = "first";
+        fields[0].type = ast_create_opaque_type(arena, "A");
+        fields[1].name = "second";
+        fields[1].type = ast_create_opaque_type(arena, "B");
+        decl->fields = fields;
+        decl->field_count = 2;
+
+        generic_registry_register_template("Zipped", decl);
+    }
+
+    DEBUG_VERBOSE("Registered built-in container templates");
+}
+
+/* ============================================================================
+ * Type argument validation
+ * ============================================================================ */
+
+/* Map keys and set elements are hashed and compared field by field, so they
+ * must be primitives, str, or val structs built from those. */
+static bool container_key_is_hashable(Type *type, int depth)
+{
+    if (type == NULL || depth > 32)
+        return false;
+    if (type->kind == TYPE_GENERIC_INST && type->as.generic_inst.resolved != NULL)
+        type = type->as.generic_inst.resolved;
+
+    switch (type->kind)
+    {
+        case TYPE_INT:
+        case TYPE_INT32:
+        case TYPE_UINT:
+        case TYPE_UINT32:
+        case TYPE_LONG:
+        case TYPE_DOUBLE:
+        case TYPE_FLOAT:
+        case TYPE_BOOL:
+        case TYPE_BYTE:
+        case TYPE_CHAR:
+        case TYPE_STRING:
+        case TYPE_OPAQUE:   /* unsubstituted type parameter — checked per instantiation */
+            return true;
+
+        case TYPE_STRUCT:
+            if (type->as.struct_type.pass_self_by_ref || type->as.struct_type.is_native)
+                return false;
+            for (int i = 0; i < type->as.struct_type.field_count; i++)
+            {
+                if (!container_key_is_hashable(type->as.struct_type.fields[i].type, depth + 1))
+                    return false;
+            }
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool container_check_type_args(Arena *arena, StructDeclStmt *tmpl_decl, Token *name_tok,
+                               Type **type_args, int type_arg_count)
+{
+    if (tmpl_decl == NULL || type_arg_count < 1)
+        return true;
+
+    /* Elements live in the container's own 16-byte aligned storage */
+    if (tmpl_decl->container_kind != CONTAINER_NONE)
+    {
+        for (int i = 0; i < type_arg_count; i++)
+        {
+            if (!check_stored_type_alignment(type_args[i], name_tok, "a container element"))
+                return false;
+        }
+    }
+
+    /* Groups hand out their tasks' results; void tasks have none to wait for */
+    if (tmpl_decl->container_kind == CONTAINER_TASK_GROUP)
+    {
+        if (type_args[0] == NULL || type_args[0]->kind != TYPE_VOID)
+            return true;
+        type_error(name_tok, "taskgroup element type cannot be void: spawn functions that "
+                              "return a value, or join void spawns with '!'");
+        return false;
+    }
+
+    if (tmpl_decl->container_kind != CONTAINER_MAP && tmpl_decl->container_kind != CONTAINER_SET)
+        return true;
+
+    if (container_key_is_hashable(type_args[0], 0))
+        return true;
+
+    bool is_set = tmpl_decl->container_kind == CONTAINER_SET;
+    char msg[512];
+    snprintf(msg, sizeof(msg),
+             "%s type '%s' is not hashable: %s must be primitives, str, "
+             "or 'as val' structs whose fields are hashable",
+             is_set ? "set element" : "map key",
+             ast_type_to_string(arena, type_args[0]),
+             is_set ? "elements" : "keys");
+    type_error(name_tok, msg);
+    return false;
+}
@@ -0,0 +1,28 @@
+/* type_checker_containers.h - Built-in generic container templates
+ *
+ * map<K, V> and its helper structs MapEntry<K, V> / MapIter<K, V> are
+ * registered as ordinary generic struct templates at the start of every
+ * type-check, so instantiations go through the normal monomorphization path.
+ * Their methods are native; codegen emits bodies backed by the runtime
+ * (sn_map.h).  A user-declared struct template with the same name replaces
+ * the built-in one.
+ */
+
+#ifndef TYPE_CHECKER_CONTAINERS_H
+#define TYPE_CHECKER_CONTAINERS_H
+
+#include "ast.h"
+#include "arena.h"
+#include <stdbool.h>
+
+/* Register the built-in container templates (call after generic_registry_clear). */
+void container_register_templates(Arena *arena);
+
+/* Validate the type arguments of a container instantiation.
+ * Returns false (with a type error reported) if a key type cannot be hashed
+ * or a taskgroup is given void; errors point at name_tok, the annotation's
+ * template name. */
+bool container_check_type_args(Arena *arena, StructDeclStmt *tmpl_decl, Token *name_tok,
+                               Type **type_args, int type_arg_count);
+
+#endif /* TYPE_CHECKER_CONTAINERS_H */
@@ -9,8 +9,10 @@
  */
 
 #include "type_checker/type_checker_generics.h"
+#include "type_checker/type_checker_containers.h"
 #include "type_checker/stmt/type_checker_stmt_struct.h"
 #include "type_checker/stmt/type_checker_stmt_interface.h"
+#include "type_checker/expr/type_checker_expr_thread.h"
 #include "type_checker/util/type_checker_util.h"
 #include "ast/ast_type.h"
 #include "symbol_table.h"
@@ -401,8 +403,10 @@ Type *substitute_type_params(Arena *arena, Type *type,
         if (!changed)
             return type;
         /* Return a new TYPE_GENERIC_INST with substituted args — resolution happens later */
-        return ast_create_generic_inst_type(arena, type->as.generic_inst.template_name,
-                                             new_args, argc);
+        Type *inst = ast_create_generic_inst_type(arena, type->as.generic_inst.template_name,
+                                                  new_args, argc);
+        inst->as.generic_inst.name_token = type->as.generic_inst.name_token;
+        return inst;
     }
 
     case TYPE_STRUCT:
@@ -462,6 +466,17 @@ static const char *mangle_type_name(Arena *arena, Type *type)
     /* For TYPE_STRUCT use the struct name directly */
     if (type->kind == TYPE_STRUCT && type->as.struct_type.name != NULL)
         return type->as.struct_type.name;
+    /* Arrays: int[] → "int_arr" (ast_type_to_string gives "array of int") */
+    if (type->kind == TYPE_ARRAY)
+    {
+        const char *elem = mangle_type_name(arena, type->as.array.element_type);
+        size_t len = strlen(elem) + sizeof("_arr");
+        char *buf = arena_alloc(arena, len);
+        if (buf == NULL)
+            return "unknown";
+        snprintf(buf, len, "%s_arr", elem);
+        return buf;
+    }
     /* Fall back to ast_type_to_string for all other types */
     const char *s = ast_type_to_string(arena, type);
     return s != NULL ? s : "unknown";
@@ -536,11 +551,21 @@ StructDeclStmt *monomorphize_struct(Arena *arena, GenericTemplate *tmpl,
     mono->is_packed        = src->is_packed;
     mono->pass_self_by_ref = src->pass_self_by_ref;
     mono->is_serializable  = src->is_serializable;
+    mono->min_alignment    = src->min_alignment;
+    mono->container_kind   = src->container_kind;
     mono->c_alias          = NULL; /* monomorphized structs don't have C aliases */
 
     /* Concrete — no type parameters */
     mono->type_params      = NULL;
     mono->type_param_count = 0;
+    mono->type_arg_count   = type_arg_count;
+    if (type_arg_count > 0)
+    {
+        /* Callers may pass a stack array — keep an arena copy */
+        mono->type_args = arena_alloc(arena, sizeof(Type *) * type_arg_count);
+        for (int i = 0; i < type_arg_count; i++)
+            mono->type_args[i] = type_args[i];
+    }
 
     /* Deep-copy and substitute fields */
     if (src->field_count > 0)
@@ -562,6 +587,7 @@ StructDeclStmt *monomorphize_struct(Arena *arena, GenericTemplate *tmpl,
             mf->offset        = 0;        /* will be recalculated after type-checking */
             mf->default_value = sf->default_value; /* shallow — no type substitution in exprs */
             mf->c_alias       = sf->c_alias;
+            mf->min_alignment = sf->min_alignment;
         }
         mono->field_count = src->field_count;
     }
@@ -921,6 +947,28 @@ Type *resolve_generic_instantiation(Arena *arena, Type *generic_inst, SymbolTabl
         return NULL; /* error already reported */
     }
 
+    /* Built-in containers: map keys must be hashable */
+    Token name_tok = generic_inst->as.generic_inst.name_token;
+    if (name_tok.start == NULL)
+    {
+        name_tok.start    = template_name;
+        name_tok.length   = (int)strlen(template_name);
+        name_tok.type     = TOKEN_IDENTIFIER;
+        name_tok.line     = 0;
+        name_tok.filename = NULL;
+    }
+    if (!container_check_type_args(arena, tmpl->decl, &name_tok, type_args, type_arg_count))
+    {
+        return NULL; /* error already reported */
+    }
+
+    /* A channel exists to hand its elements to other threads, which retain
+     * and release them */
+    if (tmpl->decl->container_kind == CONTAINER_CHANNEL)
+    {
+        thread_shared_rc_mark(type_args[0]);
+    }
+
     /* Monomorphize */
     Type *result = monomorphize_struct_type(arena, tmpl, type_args, type_arg_count, table);
     if (result != NULL)
@@ -968,6 +1016,8 @@ Type *monomorphize_struct_type(Arena *arena, GenericTemplate *tmpl,
                                               mono_decl->is_native, mono_decl->is_packed,
                                               mono_decl->pass_self_by_ref, mono_decl->c_alias);
     mono_type->as.struct_type.is_serializable = mono_decl->is_serializable;
+    mono_type->as.struct_type.min_alignment = mono_decl->min_alignment;
+    mono_type->as.struct_type.container_kind = mono_decl->container_kind;
 
     /* Register in the symbol table under the monomorphized name */
     Token mono_token;
@@ -1017,6 +1067,13 @@ Type *monomorphize_struct_type(Arena *arena, GenericTemplate *tmpl,
         }
     }
 
+    /* Same for field types: generic-instantiation fields (e.g. a map<K, V> field)
+     * are resolved on mono_decl, and cleanup analysis reads them from mono_type. */
+    for (int i = 0; i < mono_type->as.struct_type.field_count && i < mono_decl->field_count; i++)
+    {
+        mono_type->as.struct_type.fields[i].type = mono_decl->fields[i].type;
+    }
+
     DEBUG_VERBOSE("Completed monomorphization: '%s'", mono_name);
     return mono_type;
 }
@@ -1392,6 +1449,8 @@ static void clear_expr_types_in_stmts_impl(Stmt **stmts, int count)
             break;
         case STMT_FOR_EACH:
             clear_expr_types_in_expr(s->as.for_each_stmt.iterable);
+            if (s->as.for_each_stmt.parallel != NULL)
+                clear_expr_types_in_expr(s->as.for_each_stmt.parallel->chunk);
             clear_expr_types_in_stmts_impl(&s->as.for_each_stmt.body, 1);
             break;
         case STMT_FUNCTION:
@@ -167,4 +167,18 @@ size_t get_type_alignment(Type *type);
  */
 void calculate_struct_layout(Type *struct_type);
 
+/* Array, container and closure storage is allocated 16-byte aligned (the
+ * slab and arena granularity), so value structs aligned past that with
+ * @align(N)/@cacheline cannot be stored there.
+ *
+ * check_stored_type_alignment reports an error at loc if type is such a
+ * struct, `where` naming the storage ("a container element"), and then
+ * checks the element types of any arrays it is.
+ * check_array_alignment only checks array element types.
+ * Both return false if an error was reported.
+ */
+#define SN_STORAGE_ALIGN 16
+bool check_stored_type_alignment(Type *type, Token *loc, const char *where);
+bool check_array_alignment(Type *type, Token *loc);
+
 #endif /* TYPE_CHECKER_UTIL_H */
@@ -252,3 +252,350 @@ const char *get_private_escape_block_reason(Type *type)
             return "type cannot escape private block";
     }
 }
+
+const char *get_region_export_block_reason(Type *type)
+{
+    static char reason_buffer[512];
+
+    if (type == NULL) return "unknown type";
+    if (is_primitive_type(type) || type->kind == TYPE_STRING) return NULL;
+
+    switch (type->kind)
+    {
+        case TYPE_ARRAY:
+            return get_region_export_block_reason(type->as.array.element_type);
+        case TYPE_STRUCT:
+        {
+            const char *name = type->as.struct_type.name ? type->as.struct_type.name : "anonymous";
+            if (type->as.struct_type.container_kind != CONTAINER_NONE)
+            {
+                snprintf(reason_buffer, sizeof(reason_buffer), "'%s' is a container", name);
+                return reason_buffer;
+            }
+            if (type->as.struct_type.pass_self_by_ref)
+            {
+                snprintf(reason_buffer, sizeof(reason_buffer), "struct '%s' is a reference type (as ref)", name);
+                return reason_buffer;
+            }
+            if (type->as.struct_type.is_native)
+            {
+                snprintf(reason_buffer, sizeof(reason_buffer), "struct '%s' is a native struct (may contain pointers)", name);
+                return reason_buffer;
+            }
+            for (int i = 0; i < type->as.struct_type.field_count; i++)
+            {
+                StructField *field = &type->as.struct_type.fields[i];
+                if (get_region_export_block_reason(field->type) != NULL)
+                {
+                    snprintf(reason_buffer, sizeof(reason_buffer), "struct '%s' field '%s' may point into the arena",
+                             name, field->name ? field->name : "unknown");
+                    return reason_buffer;
+                }
+            }
+            return NULL;
+        }
+        case TYPE_FUNCTION:
+            return "function type (closure) may capture arena memory";
+        case TYPE_POINTER:
+            return "pointer type may point into the arena";
+        case TYPE_OPAQUE:
+            return "opaque type references external C memory";
+        default:
+            return "type may point into the arena";
+    }
+}
+
+/* Root variable of a receiver or lvalue chain: x, x.f, x[i], x.f[i].g */
+static Symbol *region_root_symbol(Expr *expr, SymbolTable *table)
+{
+    while (expr != NULL)
+    {
+        switch (expr->type)
+        {
+            case EXPR_VARIABLE:
+                return symbol_table_lookup_symbol(table, expr->as.variable.name);
+            case EXPR_MEMBER:
+                expr = expr->as.member.object;
+                break;
+            case EXPR_MEMBER_ACCESS:
+                expr = expr->as.member_access.object;
+                break;
+            case EXPR_ARRAY_ACCESS:
+                expr = expr->as.array_access.array;
+                break;
+            default:
+                return NULL;
+        }
+    }
+    return NULL;
+}
+
+/* True if expr is rooted at a variable that outlives the innermost arena
+ * block: declared outside it, or a global / static that outlives them all.
+ * A lambda bound with var is flagged is_function for recursion but is still
+ * a variable. */
+static bool region_rooted_outside(Expr *expr, SymbolTable *table)
+{
+    Symbol *sym = region_root_symbol(expr, table);
+    if (sym == NULL || (sym->is_function && sym->var_decl_origin == NULL) || sym->is_namespace ||
+        sym->kind == SYMBOL_NAMESPACE || sym->kind == SYMBOL_TYPE)
+    {
+        return false;
+    }
+    if (sym->kind == SYMBOL_GLOBAL || sym->is_static)
+    {
+        return true;
+    }
+    return sym->arena_depth < symbol_table_get_arena_depth(table);
+}
+
+/* Values a callee could store into: strings and primitive-only value
+ * structs are immutable from the callee's side. */
+static bool region_mutable_type(Type *type)
+{
+    if (type == NULL || is_primitive_type(type) || type->kind == TYPE_STRING)
+    {
+        return false;
+    }
+    if (type->kind == TYPE_STRUCT && type->as.struct_type.container_kind == CONTAINER_NONE &&
+        !type->as.struct_type.pass_self_by_ref && !type->as.struct_type.is_native)
+    {
+        for (int i = 0; i < type->as.struct_type.field_count; i++)
+        {
+            if (region_mutable_type(type->as.struct_type.fields[i].type))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    return true;
+}
+
+static void region_export_error(Token *token, const char *what, Type *value_type)
+{
+    const char *reason = get_region_export_block_reason(value_type);
+    if (reason == NULL) return;
+    char msg[640];
+    snprintf(msg, sizeof(msg), "Cannot %s declared outside arena block: %s", what, reason);
+    type_error(token, msg);
+}
+
+/* Built-in array and container methods that keep their arguments; the rest
+ * (lookups, iteration, map/filter and friends) only read them. */
+static bool region_builtin_method_stores(Type *receiver_type, Token *method)
+{
+    static const char *const array_stores[] = { "push", "insert", "fill", NULL };
+    static const char *const map_stores[] = { "set", NULL };
+    static const char *const set_stores[] = { "add", NULL };
+    static const char *const deque_stores[] = { "pushBack", "pushFront", "set", NULL };
+    static const char *const channel_stores[] = { "send", "trySend", NULL };
+
+    const char *const *stores = NULL;
+    if (receiver_type->kind == TYPE_ARRAY)
+    {
+        stores = array_stores;
+    }
+    else
+    {
+        switch (receiver_type->as.struct_type.container_kind)
+        {
+            case CONTAINER_MAP:     stores = map_stores; break;
+            case CONTAINER_SET:     stores = set_stores; break;
+            case CONTAINER_DEQUE:   stores = deque_stores; break;
+            case CONTAINER_CHANNEL: stores = channel_stores; break;
+            default:                return false;
+        }
+    }
+    for (; *stores != NULL; stores++)
+    {
+        if ((int)strlen(*stores) == method->length &&
+            strncmp(method->start, *stores, method->length) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void region_call_export_error(Token *token, Type *value_type)
+{
+    const char *reason = get_region_export_block_reason(value_type);
+    if (reason == NULL) return;
+    char msg[640];
+    snprintf(msg, sizeof(msg),
+             "Cannot pass a value from the arena block to a call that may store it outside: %s",
+             reason);
+    type_error(token, msg);
+}
+
+static bool region_is_outer_closure(Expr *expr, SymbolTable *table)
+{
+    return expr->expr_type != NULL && expr->expr_type->kind == TYPE_FUNCTION &&
+           region_rooted_outside(expr, table);
+}
+
+/* A call inside an arena block that may store outside it: every value it is
+ * handed from the block (arguments, and the receiver of a method) must be
+ * safe to keep once the region is freed.  Values rooted outside the block
+ * are where the store goes, not what is stored. */
+static void region_check_call_exports(Expr *expr, Expr *receiver, bool builtin_receiver,
+                                      SymbolTable *table)
+{
+    CallExpr *call = &expr->as.call;
+    Token *method = receiver != NULL ? &call->callee->as.member.member_name : NULL;
+
+    if (builtin_receiver)
+    {
+        Type *receiver_type = receiver->expr_type;
+        if (!region_rooted_outside(receiver, table))
+        {
+            /* A local container only hands its elements to closures */
+            for (int i = 0; i < call->arg_count; i++)
+            {
+                if (region_is_outer_closure(call->arguments[i], table))
+                    region_call_export_error(method, receiver_type);
+            }
+            return;
+        }
+        if (!region_builtin_method_stores(receiver_type, method))
+        {
+            return;
+        }
+        if (receiver_type->kind == TYPE_ARRAY)
+        {
+            region_export_error(method, "store into array", receiver_type->as.array.element_type);
+            return;
+        }
+        for (int i = 0; i < call->arg_count; i++)
+        {
+            region_export_error(method, "store into container", call->arguments[i]->expr_type);
+        }
+        return;
+    }
+
+    Token *token = method != NULL ? method : expr->token;
+    if (receiver != NULL && !region_rooted_outside(receiver, table))
+    {
+        region_call_export_error(token, receiver->expr_type);
+    }
+    for (int i = 0; i < call->arg_count; i++)
+    {
+        Expr *arg = call->arguments[i];
+        if (!region_rooted_outside(arg, table))
+        {
+            region_call_export_error(token, arg->expr_type);
+        }
+    }
+}
+
+void type_check_region_escape(Expr *expr, SymbolTable *table)
+{
+    bool in_arena = symbol_table_get_arena_depth(table) > 0;
+
+    switch (expr->type)
+    {
+        case EXPR_ASSIGN:
+        {
+            /* Arena-specific errors are reported by type_check_assign */
+            Type *value_type = expr->as.assign.value->expr_type;
+            if (!can_escape_private(value_type))
+            {
+                Symbol *sym = symbol_table_lookup_symbol(table, expr->as.assign.name);
+                if (sym != NULL && (sym->kind == SYMBOL_GLOBAL || sym->is_static ||
+                                    sym->arena_depth < symbol_table_get_arena_depth(table)))
+                {
+                    expr->escape_info.stores_outside_region = true;
+                }
+            }
+            break;
+        }
+
+        case EXPR_COMPOUND_ASSIGN:
+            if (expr->expr_type != NULL && expr->expr_type->kind == TYPE_STRING &&
+                region_rooted_outside(expr->as.compound_assign.target, table))
+            {
+                expr->escape_info.stores_outside_region = true;
+            }
+            break;
+
+        case EXPR_INDEX_ASSIGN:
+        {
+            Type *value_type = expr->as.index_assign.value->expr_type;
+            if (!can_escape_private(value_type) && region_rooted_outside(expr->as.index_assign.array, table))
+            {
+                expr->escape_info.stores_outside_region = true;
+                if (in_arena)
+                    region_export_error(expr->token, "store into array", value_type);
+            }
+            break;
+        }
+
+        case EXPR_MEMBER_ASSIGN:
+        {
+            Type *value_type = expr->as.member_assign.value->expr_type;
+            if (!can_escape_private(value_type) && region_rooted_outside(expr->as.member_assign.object, table))
+            {
+                expr->escape_info.stores_outside_region = true;
+                if (in_arena)
+                    region_export_error(&expr->as.member_assign.field_name, "store into struct", value_type);
+            }
+            break;
+        }
+
+        case EXPR_CALL:
+        {
+            CallExpr *call = &expr->as.call;
+            Expr *callee = call->callee;
+            Expr *receiver = callee->type == EXPR_MEMBER ? callee->as.member.object : NULL;
+            bool outside = false;
+            bool builtin_receiver = false;
+
+            if (receiver != NULL)
+            {
+                /* Method call: the receiver may keep what it is given */
+                Type *receiver_type = receiver->expr_type;
+                builtin_receiver = receiver_type != NULL &&
+                    (receiver_type->kind == TYPE_ARRAY ||
+                     (receiver_type->kind == TYPE_STRUCT &&
+                      receiver_type->as.struct_type.container_kind != CONTAINER_NONE));
+                if (receiver_type != NULL && region_mutable_type(receiver_type) &&
+                    region_rooted_outside(receiver, table))
+                {
+                    outside = true;
+                }
+            }
+            else if (callee->type == EXPR_VARIABLE && region_rooted_outside(callee, table))
+            {
+                /* A closure from outside the block may write to its captures */
+                outside = callee->expr_type != NULL && callee->expr_type->kind == TYPE_FUNCTION;
+            }
+
+            for (int i = 0; i < call->arg_count && !outside; i++)
+            {
+                Expr *arg = call->arguments[i];
+                if (region_mutable_type(arg->expr_type) && region_rooted_outside(arg, table))
+                {
+                    outside = true;
+                }
+            }
+            if (outside)
+            {
+                expr->escape_info.stores_outside_region = true;
+                if (in_arena)
+                    region_check_call_exports(expr, receiver, builtin_receiver, table);
+            }
+            break;
+        }
+
+        case EXPR_THREAD_SPAWN:
+            if (in_arena)
+            {
+                type_error(expr->token, "Cannot spawn a thread inside an arena block");
+            }
+            break;
+
+        default:
+            break;
+    }
+}
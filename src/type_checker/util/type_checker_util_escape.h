@@ -14,4 +14,16 @@ bool can_escape_private(Type *type);
  * Uses a static buffer for the return value. */
 const char *get_private_escape_block_reason(Type *type);
 
+/* Get a human-readable reason why a value of this type cannot be stored
+ * outside an arena block, or NULL if it can be rebuilt on the system heap
+ * (primitives, strings, arrays and value structs made of those). */
+const char *get_region_export_block_reason(Type *type);
+
+/* Check an expression against the innermost arena block (and against
+ * globals, which outlive every block).  Stores into variables declared
+ * outside it, method calls on such receivers, and calls handed mutable
+ * values from outside are marked to run with the region suspended; values
+ * that could keep pointing into the region are rejected. */
+void type_check_region_escape(Expr *expr, SymbolTable *table);
+
 #endif /* TYPE_CHECKER_UTIL_ESCAPE_H */
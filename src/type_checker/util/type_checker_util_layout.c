@@ -1,4 +1,5 @@
 #include "type_checker_util_layout.h"
+#include <stdio.h>
 
 size_t get_type_alignment(Type *type)
 {
@@ -87,6 +88,12 @@ void calculate_struct_layout(Type *struct_type)
         /* Ensure minimum alignment of 1 */
         if (field_alignment == 0) field_alignment = 1;
 
+        /* @align(N) / @cacheline on the field can only raise it */
+        if (field->min_alignment > field_alignment)
+        {
+            field_alignment = field->min_alignment;
+        }
+
         /* For packed structs, use alignment of 1 (no padding) */
         if (is_packed)
         {
@@ -109,6 +116,12 @@ void calculate_struct_layout(Type *struct_type)
         }
     }
 
+    /* @align(N) / @cacheline on the struct, rounding its size up to match */
+    if (struct_type->as.struct_type.min_alignment > max_alignment)
+    {
+        max_alignment = struct_type->as.struct_type.min_alignment;
+    }
+
     /* For packed structs, no trailing padding needed - alignment is 1 */
     size_t total_size;
     if (is_packed)
@@ -126,3 +139,33 @@ void calculate_struct_layout(Type *struct_type)
     struct_type->as.struct_type.size = total_size;
     struct_type->as.struct_type.alignment = max_alignment;
 }
+
+bool check_stored_type_alignment(Type *type, Token *loc, const char *where)
+{
+    if (type != NULL && type->kind == TYPE_GENERIC_INST && type->as.generic_inst.resolved != NULL)
+    {
+        type = type->as.generic_inst.resolved;
+    }
+    if (type != NULL && type->kind == TYPE_STRUCT && !type->as.struct_type.pass_self_by_ref &&
+        type->as.struct_type.alignment > SN_STORAGE_ALIGN)
+    {
+        char msg[512];
+        snprintf(msg, sizeof(msg),
+                 "Struct '%s' is aligned to %zu bytes and cannot be used as %s, whose storage "
+                 "is only %d-byte aligned; declare it 'as ref' to allocate each instance aligned",
+                 type->as.struct_type.name ? type->as.struct_type.name : "<anonymous>",
+                 type->as.struct_type.alignment, where, SN_STORAGE_ALIGN);
+        type_error(loc, msg);
+        return false;
+    }
+    return check_array_alignment(type, loc);
+}
+
+bool check_array_alignment(Type *type, Token *loc)
+{
+    if (type == NULL || type->kind != TYPE_ARRAY)
+    {
+        return true;
+    }
+    return check_stored_type_alignment(type->as.array.element_type, loc, "an array element");
+}
@@ -12,4 +12,9 @@ size_t get_type_alignment(Type *type);
  * Updates the struct_type in place with computed values. */
 void calculate_struct_layout(Type *struct_type);
 
+/* Reject value structs aligned past SN_STORAGE_ALIGN where they would be
+ * stored in 16-byte aligned storage (type_checker_util.h). */
+bool check_stored_type_alignment(Type *type, Token *loc, const char *where);
+bool check_array_alignment(Type *type, Token *loc);
+
 #endif /* TYPE_CHECKER_UTIL_LAYOUT_H */
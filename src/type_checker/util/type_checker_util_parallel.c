@@ -0,0 +1,491 @@
+#include "type_checker_util_parallel.h"
+#include "type_checker/expr/type_checker_expr_thread.h"
+#include "symbol_table/symbol_table_core.h"
+#include "debug.h"
+#include <stdio.h>
+#include <string.h>
+
+ParallelReduction *parallel_find_reduction(ParallelClause *loop, Token name)
+{
+    for (int i = 0; i < loop->reduction_count; i++)
+    {
+        if (symbol_table_tokens_equal(loop->reductions[i].var_name, name))
+        {
+            return &loop->reductions[i];
+        }
+    }
+    return NULL;
+}
+
+/* Variables of the enclosing function, declared before the loop.  Globals and
+ * statics are reached directly by the outlined body, not through captures. */
+static bool parallel_is_local(Symbol *sym)
+{
+    return sym != NULL && !sym->is_function && !sym->is_namespace &&
+           sym->kind != SYMBOL_TYPE && sym->kind != SYMBOL_NAMESPACE &&
+           sym->kind != SYMBOL_GLOBAL && !sym->is_static;
+}
+
+static bool parallel_is_outer(Symbol *sym, ParallelClause *loop)
+{
+    return sym->declaration_scope_depth <= loop->outer_scope_depth;
+}
+
+static void parallel_add_capture(ParallelClause *loop, Symbol *sym, SymbolTable *table)
+{
+    for (int i = 0; i < loop->capture_count; i++)
+    {
+        if (symbol_table_tokens_equal(loop->captured_vars[i], sym->name))
+        {
+            return;
+        }
+    }
+
+    if (loop->capture_count >= loop->capture_capacity)
+    {
+        int new_capacity = loop->capture_capacity == 0 ? 8 : loop->capture_capacity * 2;
+        Token *vars = arena_alloc(table->arena, sizeof(Token) * new_capacity);
+        Type **types = arena_alloc(table->arena, sizeof(Type *) * new_capacity);
+        bool *sync = arena_alloc(table->arena, sizeof(bool) * new_capacity);
+        Stmt **decls = arena_alloc(table->arena, sizeof(Stmt *) * new_capacity);
+        if (vars == NULL || types == NULL || sync == NULL || decls == NULL)
+        {
+            DEBUG_ERROR("Out of memory recording parallel loop captures");
+            return;
+        }
+        if (loop->capture_count > 0)
+        {
+            memcpy(vars, loop->captured_vars, sizeof(Token) * loop->capture_count);
+            memcpy(types, loop->captured_types, sizeof(Type *) * loop->capture_count);
+            memcpy(sync, loop->captured_sync, sizeof(bool) * loop->capture_count);
+            memcpy(decls, loop->captured_decls, sizeof(Stmt *) * loop->capture_count);
+        }
+        loop->captured_vars = vars;
+        loop->captured_types = types;
+        loop->captured_sync = sync;
+        loop->captured_decls = decls;
+        loop->capture_capacity = new_capacity;
+    }
+
+    loop->captured_vars[loop->capture_count] = sym->name;
+    loop->captured_types[loop->capture_count] = sym->type;
+    loop->captured_sync[loop->capture_count] = sym->sync_mod == SYNC_ATOMIC;
+    loop->captured_decls[loop->capture_count] = sym->var_decl_origin;
+    loop->capture_count++;
+
+    /* Every worker thread retains and releases what it captures */
+    thread_shared_rc_mark(sym->type);
+}
+
+/* A use of a local from outside the innermost parallel loop is a capture of
+ * that loop and of every enclosing parallel loop it also predates.  A
+ * reduction variable is private to the loop that reduces it, which captures
+ * its own accumulator from there on. */
+static void parallel_note_use(Token name, SymbolTable *table)
+{
+    Symbol *sym = symbol_table_lookup_symbol(table, name);
+    if (!parallel_is_local(sym))
+    {
+        return;
+    }
+    for (ParallelClause *loop = table->parallel_loop; loop != NULL; loop = loop->enclosing)
+    {
+        if (!parallel_is_outer(sym, loop) || parallel_find_reduction(loop, name) != NULL)
+        {
+            return;
+        }
+        parallel_add_capture(loop, sym, table);
+    }
+}
+
+static void parallel_check_write(Token name, Token *loc, SymbolTable *table)
+{
+    ParallelClause *loop = table->parallel_loop;
+    Symbol *sym = symbol_table_lookup_symbol(table, name);
+    if (sym == NULL || sym->is_function || sym->is_namespace || sym->kind == SYMBOL_TYPE)
+    {
+        return;
+    }
+
+    bool shared = sym->kind == SYMBOL_GLOBAL || sym->is_static || parallel_is_outer(sym, loop);
+    if (!shared || sym->sync_mod == SYNC_ATOMIC || parallel_find_reduction(loop, name) != NULL)
+    {
+        parallel_note_use(name, table);
+        return;
+    }
+
+    char msg[512];
+    snprintf(msg, sizeof(msg),
+             "Cannot write to '%.*s' inside a parallel loop: it is shared by all iterations. "
+             "Declare it 'sync' or add a 'reduce %.*s: ...' clause",
+             name.length, name.start, name.length, name.start);
+    type_error(loc, msg);
+}
+
+/* Walk member accesses down to the variable they start from.  Stops at array
+ * elements, which belong to the iteration that indexes them. */
+static Expr *parallel_field_root(Expr *expr)
+{
+    while (expr != NULL)
+    {
+        switch (expr->type)
+        {
+            case EXPR_VARIABLE:
+                return expr;
+            case EXPR_MEMBER:
+                expr = expr->as.member.object;
+                break;
+            case EXPR_MEMBER_ACCESS:
+                expr = expr->as.member_access.object;
+                break;
+            default:
+                return NULL;
+        }
+    }
+    return NULL;
+}
+
+/* Writes through a variable (x = ..., x += ..., x++) and through its fields */
+static void parallel_check_target(Expr *target, Token *loc, SymbolTable *table)
+{
+    if (target->type == EXPR_VARIABLE)
+    {
+        parallel_check_write(target->as.variable.name, loc, table);
+        return;
+    }
+    Expr *root = parallel_field_root(target);
+    if (root != NULL)
+    {
+        parallel_check_write(root->as.variable.name, loc, table);
+    }
+}
+
+static bool parallel_name_in(Token name, const char *const *names)
+{
+    for (; *names != NULL; names++)
+    {
+        size_t len = strlen(*names);
+        if ((size_t)name.length == len && strncmp(name.start, *names, len) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Built-in methods that change the array or container they are called on.
+ * Channels and task groups synchronize internally and are never a write. */
+static bool parallel_is_mutating_builtin(Type *receiver_type, Token name)
+{
+    static const char *const array_methods[] = { "push", "pop", "clear", "reverse", "insert",
+                                                  "remove", "fill", NULL };
+    static const char *const map_methods[] = { "set", "remove", "clear", NULL };
+    static const char *const set_methods[] = { "add", "remove", "clear", NULL };
+    static const char *const deque_methods[] = { "pushBack", "pushFront", "popBack", "popFront",
+                                                 "set", "clear", NULL };
+    static const char *const bits_methods[] = { "resize", "set", "push", "fill", NULL };
+
+    if (receiver_type->kind == TYPE_ARRAY)
+    {
+        return parallel_name_in(name, array_methods);
+    }
+    if (receiver_type->kind != TYPE_STRUCT)
+    {
+        return false;
+    }
+    switch (receiver_type->as.struct_type.container_kind)
+    {
+        case CONTAINER_MAP:   return parallel_name_in(name, map_methods);
+        case CONTAINER_SET:   return parallel_name_in(name, set_methods);
+        case CONTAINER_DEQUE: return parallel_name_in(name, deque_methods);
+        case CONTAINER_BITS:  return parallel_name_in(name, bits_methods);
+        default:              return false;
+    }
+}
+
+/* Methods being scanned for writes to self, so recursion terminates */
+#define PARALLEL_METHOD_DEPTH 16
+
+typedef struct
+{
+    StructMethod *methods[PARALLEL_METHOD_DEPTH];
+    int count;
+} ParallelMethodWalk;
+
+static bool parallel_call_mutates(Expr *call, ParallelMethodWalk *walk);
+static bool parallel_stmt_writes_self(Stmt *stmt, ParallelMethodWalk *walk);
+
+static bool parallel_is_self(Expr *expr)
+{
+    Expr *root = parallel_field_root(expr);
+    return root != NULL && root->as.variable.name.length == 4 &&
+           strncmp(root->as.variable.name.start, "self", 4) == 0;
+}
+
+static bool parallel_exprs_write_self(Expr **exprs, int count, ParallelMethodWalk *walk);
+
+/* Does a method body write a field of self, resize a container reached
+ * through self, or call a method of self that does?  Lambdas are not
+ * entered: they run when called, not when defined. */
+static bool parallel_expr_writes_self(Expr *expr, ParallelMethodWalk *walk)
+{
+    if (expr == NULL)
+    {
+        return false;
+    }
+    switch (expr->type)
+    {
+        case EXPR_MEMBER_ASSIGN:
+            return parallel_is_self(expr->as.member_assign.object) ||
+                   parallel_expr_writes_self(expr->as.member_assign.value, walk);
+        case EXPR_COMPOUND_ASSIGN:
+            return (expr->as.compound_assign.target->type != EXPR_VARIABLE &&
+                    parallel_is_self(expr->as.compound_assign.target)) ||
+                   parallel_expr_writes_self(expr->as.compound_assign.value, walk);
+        case EXPR_INCREMENT:
+        case EXPR_DECREMENT:
+            return expr->as.operand->type != EXPR_VARIABLE && parallel_is_self(expr->as.operand);
+        case EXPR_CALL:
+            return parallel_call_mutates(expr, walk) ||
+                   parallel_expr_writes_self(expr->as.call.callee, walk) ||
+                   parallel_exprs_write_self(expr->as.call.arguments, expr->as.call.arg_count, walk);
+        case EXPR_ASSIGN:
+            return parallel_expr_writes_self(expr->as.assign.value, walk);
+        case EXPR_INDEX_ASSIGN:
+            return parallel_expr_writes_self(expr->as.index_assign.array, walk) ||
+                   parallel_expr_writes_self(expr->as.index_assign.index, walk) ||
+                   parallel_expr_writes_self(expr->as.index_assign.value, walk);
+        case EXPR_BINARY:
+            return parallel_expr_writes_self(expr->as.binary.left, walk) ||
+                   parallel_expr_writes_self(expr->as.binary.right, walk);
+        case EXPR_UNARY:
+            return parallel_expr_writes_self(expr->as.unary.operand, walk);
+        case EXPR_ARRAY:
+            return parallel_exprs_write_self(expr->as.array.elements, expr->as.array.element_count, walk);
+        case EXPR_ARRAY_ACCESS:
+            return parallel_expr_writes_self(expr->as.array_access.array, walk) ||
+                   parallel_expr_writes_self(expr->as.array_access.index, walk);
+        case EXPR_ARRAY_SLICE:
+            return parallel_expr_writes_self(expr->as.array_slice.array, walk) ||
+                   parallel_expr_writes_self(expr->as.array_slice.start, walk) ||
+                   parallel_expr_writes_self(expr->as.array_slice.end, walk) ||
+                   parallel_expr_writes_self(expr->as.array_slice.step, walk);
+        case EXPR_RANGE:
+            return parallel_expr_writes_self(expr->as.range.start, walk) ||
+                   parallel_expr_writes_self(expr->as.range.end, walk);
+        case EXPR_SPREAD:
+            return parallel_expr_writes_self(expr->as.spread.array, walk);
+        case EXPR_INTERPOLATED:
+            return parallel_exprs_write_self(expr->as.interpol.parts, expr->as.interpol.part_count, walk);
+        case EXPR_MEMBER:
+            return parallel_expr_writes_self(expr->as.member.object, walk);
+        case EXPR_MEMBER_ACCESS:
+            return parallel_expr_writes_self(expr->as.member_access.object, walk);
+        case EXPR_STATIC_CALL:
+            return parallel_exprs_write_self(expr->as.static_call.arguments,
+                                             expr->as.static_call.arg_count, walk);
+        case EXPR_SIZED_ARRAY_ALLOC:
+            return parallel_expr_writes_self(expr->as.sized_array_alloc.size_expr, walk) ||
+                   parallel_expr_writes_self(expr->as.sized_array_alloc.default_value, walk);
+        case EXPR_THREAD_SPAWN:
+            return parallel_expr_writes_self(expr->as.thread_spawn.call, walk);
+        case EXPR_COPY_OF:
+            return parallel_expr_writes_self(expr->as.copy_of.operand, walk);
+        case EXPR_STRUCT_LITERAL:
+            for (int i = 0; i < expr->as.struct_literal.field_count; i++)
+            {
+                if (parallel_expr_writes_self(expr->as.struct_literal.fields[i].value, walk))
+                {
+                    return true;
+                }
+            }
+            return false;
+        case EXPR_MATCH:
+            if (parallel_expr_writes_self(expr->as.match_expr.subject, walk))
+            {
+                return true;
+            }
+            for (int i = 0; i < expr->as.match_expr.arm_count; i++)
+            {
+                if (parallel_stmt_writes_self(expr->as.match_expr.arms[i].body, walk))
+                {
+                    return true;
+                }
+            }
+            return false;
+        default:
+            return false;
+    }
+}
+
+static bool parallel_exprs_write_self(Expr **exprs, int count, ParallelMethodWalk *walk)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (parallel_expr_writes_self(exprs[i], walk))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parallel_stmts_write_self(Stmt **stmts, int count, ParallelMethodWalk *walk)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (parallel_stmt_writes_self(stmts[i], walk))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parallel_stmt_writes_self(Stmt *stmt, ParallelMethodWalk *walk)
+{
+    if (stmt == NULL)
+    {
+        return false;
+    }
+    switch (stmt->type)
+    {
+        case STMT_EXPR:
+            return parallel_expr_writes_self(stmt->as.expression.expression, walk);
+        case STMT_VAR_DECL:
+            return parallel_expr_writes_self(stmt->as.var_decl.initializer, walk);
+        case STMT_RETURN:
+            return parallel_expr_writes_self(stmt->as.return_stmt.value, walk);
+        case STMT_BLOCK:
+            return parallel_stmts_write_self(stmt->as.block.statements, stmt->as.block.count, walk);
+        case STMT_IF:
+            return parallel_expr_writes_self(stmt->as.if_stmt.condition, walk) ||
+                   parallel_stmt_writes_self(stmt->as.if_stmt.then_branch, walk) ||
+                   parallel_stmt_writes_self(stmt->as.if_stmt.else_branch, walk);
+        case STMT_WHILE:
+            return parallel_expr_writes_self(stmt->as.while_stmt.condition, walk) ||
+                   parallel_stmt_writes_self(stmt->as.while_stmt.body, walk);
+        case STMT_FOR:
+            return parallel_stmt_writes_self(stmt->as.for_stmt.initializer, walk) ||
+                   parallel_expr_writes_self(stmt->as.for_stmt.condition, walk) ||
+                   parallel_expr_writes_self(stmt->as.for_stmt.increment, walk) ||
+                   parallel_stmt_writes_self(stmt->as.for_stmt.body, walk);
+        case STMT_FOR_EACH:
+            return parallel_expr_writes_self(stmt->as.for_each_stmt.iterable, walk) ||
+                   parallel_stmt_writes_self(stmt->as.for_each_stmt.body, walk);
+        case STMT_LOCK:
+            return parallel_stmt_writes_self(stmt->as.lock_stmt.body, walk);
+        case STMT_USING:
+            return parallel_expr_writes_self(stmt->as.using_stmt.initializer, walk) ||
+                   parallel_stmt_writes_self(stmt->as.using_stmt.body, walk);
+        default:
+            return false;
+    }
+}
+
+static bool parallel_method_writes_self(StructMethod *method, ParallelMethodWalk *walk)
+{
+    if (method->is_static || method->is_native || method->body == NULL)
+    {
+        return false;
+    }
+    for (int i = 0; i < walk->count; i++)
+    {
+        if (walk->methods[i] == method)
+        {
+            /* Already being scanned: any write is found there */
+            return false;
+        }
+    }
+    if (walk->count == PARALLEL_METHOD_DEPTH)
+    {
+        return true;
+    }
+    walk->methods[walk->count++] = method;
+    bool writes = parallel_stmts_write_self(method->body, method->body_count, walk);
+    walk->count--;
+    return writes;
+}
+
+/* A method call that changes its receiver: a mutating built-in on an array or
+ * container, or a struct method whose body writes to self.  Within a method
+ * body only receivers reached through self count. */
+static bool parallel_call_mutates(Expr *call, ParallelMethodWalk *walk)
+{
+    Expr *callee = call->as.call.callee;
+    if (callee->type != EXPR_MEMBER)
+    {
+        return false;
+    }
+    Expr *receiver = callee->as.member.object;
+    Type *receiver_type = receiver->expr_type;
+    if (receiver_type == NULL || (walk->count > 0 && !parallel_is_self(receiver)))
+    {
+        return false;
+    }
+    if (parallel_is_mutating_builtin(receiver_type, callee->as.member.member_name))
+    {
+        return true;
+    }
+    StructMethod *method = callee->as.member.resolved_method;
+    return receiver_type->kind == TYPE_STRUCT &&
+           receiver_type->as.struct_type.container_kind == CONTAINER_NONE &&
+           method != NULL && parallel_method_writes_self(method, walk);
+}
+
+void type_check_parallel_access(Expr *expr, SymbolTable *table)
+{
+    if (table->parallel_loop == NULL)
+    {
+        return;
+    }
+
+    switch (expr->type)
+    {
+        case EXPR_VARIABLE:
+            parallel_note_use(expr->as.variable.name, table);
+            break;
+
+        case EXPR_ASSIGN:
+            parallel_check_write(expr->as.assign.name, expr->token, table);
+            break;
+
+        case EXPR_COMPOUND_ASSIGN:
+            parallel_check_target(expr->as.compound_assign.target, expr->token, table);
+            break;
+
+        case EXPR_INCREMENT:
+        case EXPR_DECREMENT:
+            parallel_check_target(expr->as.operand, expr->token, table);
+            break;
+
+        case EXPR_MEMBER_ASSIGN:
+        {
+            Expr *root = parallel_field_root(expr->as.member_assign.object);
+            if (root != NULL)
+            {
+                parallel_check_write(root->as.variable.name, &expr->as.member_assign.field_name, table);
+            }
+            break;
+        }
+
+        case EXPR_CALL:
+        {
+            Expr *callee = expr->as.call.callee;
+            if (callee->type != EXPR_MEMBER)
+            {
+                break;
+            }
+            Expr *root = parallel_field_root(callee->as.member.object);
+            ParallelMethodWalk walk = { .count = 0 };
+            if (root != NULL && parallel_call_mutates(expr, &walk))
+            {
+                parallel_check_write(root->as.variable.name, &callee->as.member.member_name, table);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef TYPE_CHECKER_UTIL_PARALLEL_H
+#define TYPE_CHECKER_UTIL_PARALLEL_H
+
+#include "type_checker_util.h"
+
+/* Find the reduction clause for a variable name, or NULL */
+ParallelReduction *parallel_find_reduction(ParallelClause *loop, Token name);
+
+/* Check an expression inside the body of a parallel for-loop
+ * (table->parallel_loop).  Locals of the enclosing function that the body
+ * reads are recorded as captures, so code generation can hand them to the
+ * worker threads.  Writes to variables declared outside the loop must go
+ * through a 'sync' variable or a reduction clause; writes to their fields,
+ * mutating calls on their arrays and containers, and calls of their struct
+ * methods that write to self are rejected.  Stores into array elements are
+ * allowed: each iteration is expected to own its index. */
+void type_check_parallel_access(Expr *expr, SymbolTable *table);
+
+#endif /* TYPE_CHECKER_UTIL_PARALLEL_H */
@@ -114,6 +114,7 @@ const char *find_similar_symbol(SymbolTable *table, const char *name, int name_l
 static const char *array_methods[] = {
     "push", "pop", "clear", "concat", "indexOf", "contains",
     "clone", "join", "reverse", "insert", "remove", "length",
+    "sum", "min", "max", "count", "fill",
     NULL
 };
 
@@ -14,7 +14,7 @@ typedef struct __Closure__ {
 } __Closure__;
 
 int main() {
-    sn_auto_str char * __sn__s = strdup("hello");
+    sn_auto_str char * __sn__s = sn_strdup("hello");
     long long __sn__n = sn_str_length(__sn__s);
     sn_assert((__sn__n == 5LL), "expected string length to be 5");
     
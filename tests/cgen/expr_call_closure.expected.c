@@ -23,7 +23,7 @@ long long __sn__apply(void * __sn__f, long long __sn__x) {
 
 int main() {
     sn_auto_fn void * __sn__double_it = ({
-        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __Closure__ *__cl__ = sn_sys_malloc(sizeof(__Closure__));
         __cl__->fn = (void *)__lambda_0__;
         __cl__->size = sizeof(__Closure__);
         __cl__->__cleanup__ = NULL;
@@ -33,7 +33,7 @@ static inline __sn__Counter *__sn__Counter_alloc(void) {
 
 static inline void __sn__Counter_release(__sn__Counter **p) {
     if (*p) {
-        free(*p);
+        sn_free(*p);
     }
     *p = NULL;
 }
@@ -50,7 +50,7 @@ static inline char *__sn__Counter_to_string(const __sn__Counter *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "value: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 
@@ -14,7 +14,7 @@ typedef struct __Closure__ {
 } __Closure__;
 
 int main() {
-    sn_auto_str char * __sn__name = strdup("world");
+    sn_auto_str char * __sn__name = sn_strdup("world");
     sn_auto_str char * __sn__msg = ({
             sn_auto_str char *__is_p0__ = sn_strdup("Hello ");
             sn_auto_str char *__is_p1__ = sn_strdup(__sn__name);
@@ -17,7 +17,7 @@ static long long __lambda_0__(void *__closure__, long long __sn__a, long long __
 
 int main() {
     sn_auto_fn void * __sn__add = ({
-        __Closure__ *__cl__ = malloc(sizeof(__Closure__));
+        __Closure__ *__cl__ = sn_sys_malloc(sizeof(__Closure__));
         __cl__->fn = (void *)__lambda_0__;
         __cl__->size = sizeof(__Closure__);
         __cl__->__cleanup__ = NULL;
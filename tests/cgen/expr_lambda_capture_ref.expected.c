@@ -22,12 +22,12 @@ typedef struct __closure_0__ {
 } __closure_0__;
 static void __closure_0_free__(void *p) {
     __closure_0__ *cl = (__closure_0__ *)p;
-    free(cl->x);
-    free(cl);
+    sn_free(cl->x);
+    sn_free(cl);
 }
 static void __closure_0_cleanup__(void **p) {
     if (*p) {
-        free(*p);
+        sn_free(*p);
     }
     *p = NULL;
 }
@@ -35,9 +35,9 @@ static void __closure_0_cleanup__(void **p) {
 static void __lambda_0__(void *__closure__);
 
 int main() {
-    sn_auto_capture long long *__sn__x = malloc(sizeof(long long)); *__sn__x = 10LL;
+    sn_auto_capture long long *__sn__x = sn_sys_malloc(sizeof(long long)); *__sn__x = 10LL;
     sn_auto_closure_0 void * __sn__inc = ({
-        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __closure_0__ *__cl__ = sn_sys_malloc(sizeof(__closure_0__));
         __cl__->fn = (void *)__lambda_0__;
         __cl__->size = sizeof(__closure_0__);
         __cl__->__cleanup__ = NULL;
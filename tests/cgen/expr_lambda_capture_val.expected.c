@@ -25,7 +25,7 @@ static long long __lambda_0__(void *__closure__, long long __sn__n);
 int main() {
     long long __sn__x = 10LL;
     sn_auto_fn void * __sn__addX = ({
-        __closure_0__ *__cl__ = malloc(sizeof(__closure_0__));
+        __closure_0__ *__cl__ = sn_sys_malloc(sizeof(__closure_0__));
         __cl__->fn = (void *)__lambda_0__;
         __cl__->size = sizeof(__closure_0__);
         __cl__->__cleanup__ = NULL;
@@ -14,6 +14,6 @@ typedef struct __Closure__ {
 } __Closure__;
 
 int main() {
-    sn_auto_str char * __sn__s = strdup("hello");
+    sn_auto_str char * __sn__s = sn_strdup("hello");
     return 0LL;    fflush(stdout);
 }
@@ -14,14 +14,14 @@ typedef struct {
 /* Value operations */
 static inline __sn__Entry __sn__Entry_copy(const __sn__Entry *src) {
     __sn__Entry dst;
-    dst.__sn__key = src->__sn__key ? strdup(src->__sn__key) : NULL;
-    dst.__sn__value = src->__sn__value ? strdup(src->__sn__value) : NULL;
+    dst.__sn__key = src->__sn__key ? sn_strdup(src->__sn__key) : NULL;
+    dst.__sn__value = src->__sn__value ? sn_strdup(src->__sn__value) : NULL;
     return dst;
 }
 
 static inline void __sn__Entry_cleanup(__sn__Entry *p) {
-    free(p->__sn__key);
-    free(p->__sn__value);
+    sn_free(p->__sn__key);
+    sn_free(p->__sn__value);
 
 }
 
@@ -37,9 +37,9 @@ static inline __sn__Entry *__sn__Entry_alloc(void) {
 
 static inline void __sn__Entry_release(__sn__Entry **p) {
     if (*p) {
-        free((*p)->__sn__key);
-        free((*p)->__sn__value);
-        free(*p);
+        sn_free((*p)->__sn__key);
+        sn_free((*p)->__sn__value);
+        sn_free(*p);
     }
     *p = NULL;
 }
@@ -59,7 +59,7 @@ static inline char *__sn__Entry_to_string(const __sn__Entry *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "value: ");
     off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__value ? p->__sn__value : "nil");
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 
@@ -73,6 +73,6 @@ typedef struct __Closure__ {
 
 
 int main() {
-    sn_auto_Entry __sn__Entry __sn__e = (__sn__Entry){ .__sn__key = strdup("name"), .__sn__value = strdup("Alice") };
+    sn_auto_Entry __sn__Entry __sn__e = (__sn__Entry){ .__sn__key = sn_strdup("name"), .__sn__value = sn_strdup("Alice") };
     return 0LL;    fflush(stdout);
 }
@@ -36,9 +36,9 @@ int main() {
         SnThread *__th__ = sn_thread_create();
     
         __th__->result_size = sizeof(void);
-        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        sn_thread_spawn_os(__th__, __thread_wrapper_0__);
         __th__;
-    }); __ff__->detached = 1; pthread_detach(__ff__->thread); sn_thread_release(__ff__); }
+    }); sn_thread_detach(__ff__); sn_thread_release(__ff__); }
     
     return 0LL;    fflush(stdout);
 }
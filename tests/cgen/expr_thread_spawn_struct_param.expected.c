@@ -14,13 +14,13 @@ typedef struct {
 /* Value operations */
 static inline __sn__Config __sn__Config_copy(const __sn__Config *src) {
     __sn__Config dst;
-    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__name = src->__sn__name ? sn_strdup(src->__sn__name) : NULL;
     dst.__sn__value = src->__sn__value;
     return dst;
 }
 
 static inline void __sn__Config_cleanup(__sn__Config *p) {
-    free(p->__sn__name);
+    sn_free(p->__sn__name);
 
 }
 
@@ -36,8 +36,8 @@ static inline __sn__Config *__sn__Config_alloc(void) {
 
 static inline void __sn__Config_release(__sn__Config **p) {
     if (*p) {
-        free((*p)->__sn__name);
-        free(*p);
+        sn_free((*p)->__sn__name);
+        sn_free(*p);
     }
     *p = NULL;
 }
@@ -57,7 +57,7 @@ static inline char *__sn__Config_to_string(const __sn__Config *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "value: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 
@@ -77,8 +77,8 @@ static void *__thread_wrapper_0__(void *arg) {
 
     long long __result__ = __sn__processConfig(&args->arg0);
     __sn__Config_cleanup(&args->arg0);
-    free(__th__->result); __th__->result = NULL;
-    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    sn_free(__th__->result); __th__->result = NULL;
+    if (!__th__->result) __th__->result = sn_sys_calloc(1, sizeof(long long));
     *(long long *)__th__->result = __result__;
     sn_thread_release(__th__);
     return NULL;
@@ -97,15 +97,15 @@ long long __sn__processConfig(__sn__Config *__sn__config) {
 
 
 int main() {
-    sn_auto_Config __sn__Config __sn__c = (__sn__Config){ .__sn__name = strdup("test"), .__sn__value = 42LL };
+    sn_auto_Config __sn__Config __sn__c = (__sn__Config){ .__sn__name = sn_strdup("test"), .__sn__value = 42LL };
     long long __sn__handle = 0; sn_auto_thread SnThread * __sn__handle__th__ = ({
         SnThread *__th__ = sn_thread_create();
     
-        __ThreadArgs_0__ *__args__ = malloc(sizeof(__ThreadArgs_0__));
+        __ThreadArgs_0__ *__args__ = sn_sys_malloc(sizeof(__ThreadArgs_0__));
         __args__->arg0 = __sn__Config_copy(&(__sn__c));
         __th__->result = __args__;
         __th__->result_size = sizeof(long long);
-        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        sn_thread_start(__th__, __thread_wrapper_0__);
         __th__;
     });
     long long __sn__result = ({
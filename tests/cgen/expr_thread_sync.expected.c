@@ -16,7 +16,7 @@ static void *__thread_wrapper_0__(void *arg) {
     SnThread *__th__ = (SnThread *)arg;
 
     long long __result__ = __sn__compute();
-    if (!__th__->result) __th__->result = calloc(1, sizeof(long long));
+    if (!__th__->result) __th__->result = sn_sys_calloc(1, sizeof(long long));
     *(long long *)__th__->result = __result__;
     sn_thread_release(__th__);
     return NULL;
@@ -39,7 +39,7 @@ int main() {
         SnThread *__th__ = sn_thread_create();
     
         __th__->result_size = sizeof(long long);
-        pthread_create(&__th__->thread, NULL, __thread_wrapper_0__, __th__);
+        sn_thread_start(__th__, __thread_wrapper_0__);
         __th__;
     });
         sn_thread_join(__sync_th__);
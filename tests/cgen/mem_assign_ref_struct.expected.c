@@ -15,7 +15,7 @@ typedef struct {
 
 
 static inline __sn__Node *__sn__Node__new(void) {
-    __sn__Node *p = calloc(1, sizeof(__sn__Node));
+    __sn__Node *p = sn_ref_alloc(sizeof(__sn__Node));
     p->__rc__ = 1;
     return p;
 }
@@ -25,15 +25,27 @@ static inline __sn__Node *__sn__Node_retain(__sn__Node *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Node__drop_fields(__sn__Node *p) {
+    (void)p;
+}
+
 static inline void __sn__Node_release(__sn__Node **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free(*p);
+        __sn__Node__drop_fields(*p);
+        sn_ref_free(*p, sizeof(__sn__Node));
     }
     *p = NULL;
 }
 
+/* Scope exit of a stack-allocated instance (see gen_model_ref_stack.c) */
+static inline void __sn__Node_release_stack(__sn__Node **p) {
+    if (*p) __sn__Node__drop_fields(*p);
+    *p = NULL;
+}
+
 static inline __sn__Node *__sn__Node_copy(const __sn__Node *src) {
-    __sn__Node *dst = calloc(1, sizeof(__sn__Node));
+    __sn__Node *dst = sn_ref_alloc(sizeof(__sn__Node));
     dst->__rc__ = 1;
     dst->__sn__value = src->__sn__value;
     return dst;
@@ -41,6 +53,7 @@ static inline __sn__Node *__sn__Node_copy(const __sn__Node *src) {
 
 #define sn_auto_Node __attribute__((cleanup(__sn__Node_release)))
 #define sn_auto_ref_Node __attribute__((cleanup(__sn__Node_release)))
+#define sn_auto_stack_Node __attribute__((cleanup(__sn__Node_release_stack)))
 
 static inline void __sn__Node_release_elem(void *p) { __sn__Node_release((__sn__Node **)p); }
 static inline void __sn__Node_retain_into(const void *src, void *dst) { *(__sn__Node **)dst = __sn__Node_retain(*(__sn__Node *const *)src); }
@@ -53,7 +66,7 @@ static inline char *__sn__Node_to_string(const __sn__Node *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "value: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 __sn__Node * __sn__make_node(long long);
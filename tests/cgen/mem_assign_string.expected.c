@@ -14,10 +14,10 @@ typedef struct __Closure__ {
 } __Closure__;
 
 int main() {
-    sn_auto_str char * __sn__s = strdup("hello");
+    sn_auto_str char * __sn__s = sn_strdup("hello");
     ({
-        char *__sn_tmp__ = strdup("world");
-        free(__sn__s);
+        char *__sn_tmp__ = sn_strdup("world");
+        sn_free(__sn__s);
         __sn__s = __sn_tmp__;
         __sn__s;
     });
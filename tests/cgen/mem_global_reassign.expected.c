@@ -16,17 +16,17 @@ typedef struct __Closure__ {
 } __Closure__;
 
 int main() {
-    __sn__name = strdup("hello");
+    __sn__name = sn_strdup("hello");
     ({
-        char *__sn_tmp__ = strdup("world");
-        free(__sn__name);
+        char *__sn_tmp__ = sn_strdup("world");
+        sn_free(__sn__name);
         __sn__name = __sn_tmp__;
         __sn__name;
     });
     
     sn_assert((sn_str_length(__sn__name) == 5LL), "name should be world");
     
-    free(__sn__name);
+    sn_free(__sn__name);
     fflush(stdout);
     return 0;
 }
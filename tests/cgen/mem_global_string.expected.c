@@ -16,10 +16,10 @@ typedef struct __Closure__ {
 } __Closure__;
 
 int main() {
-    __sn__greeting = strdup("hello");
+    __sn__greeting = sn_strdup("hello");
     sn_assert((sn_str_length(__sn__greeting) == 5LL), "greeting should be 5 chars");
     
-    free(__sn__greeting);
+    sn_free(__sn__greeting);
     fflush(stdout);
     return 0;
 }
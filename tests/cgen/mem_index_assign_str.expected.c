@@ -22,15 +22,15 @@ int main() {
     
             __al__->elem_copy = sn_copy_str;
     
-            sn_array_push(__al__, &(char *){ strdup("Alice") });
+            sn_array_push(__al__, &(char *){ sn_strdup("Alice") });
     
-            sn_array_push(__al__, &(char *){ strdup("Bob") });
+            sn_array_push(__al__, &(char *){ sn_strdup("Bob") });
             __al__;
         });
     ({
         long long __ai__ = 0LL; if (__ai__ < 0) __ai__ += __sn__names->len;
-        char * __new__ = strdup("Charlie");
-        free(((char * *)__sn__names->data)[__ai__]);
+        char * __new__ = sn_strdup("Charlie");
+        sn_free(((char * *)__sn__names->data)[__ai__]);
         ((char * *)__sn__names->data)[__ai__] = __new__;
     });
     
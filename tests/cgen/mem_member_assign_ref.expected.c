@@ -15,7 +15,7 @@ typedef struct {
 
 
 static inline __sn__Inner *__sn__Inner__new(void) {
-    __sn__Inner *p = calloc(1, sizeof(__sn__Inner));
+    __sn__Inner *p = sn_ref_alloc(sizeof(__sn__Inner));
     p->__rc__ = 1;
     return p;
 }
@@ -25,15 +25,27 @@ static inline __sn__Inner *__sn__Inner_retain(__sn__Inner *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Inner__drop_fields(__sn__Inner *p) {
+    (void)p;
+}
+
 static inline void __sn__Inner_release(__sn__Inner **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free(*p);
+        __sn__Inner__drop_fields(*p);
+        sn_ref_free(*p, sizeof(__sn__Inner));
     }
     *p = NULL;
 }
 
+/* Scope exit of a stack-allocated instance (see gen_model_ref_stack.c) */
+static inline void __sn__Inner_release_stack(__sn__Inner **p) {
+    if (*p) __sn__Inner__drop_fields(*p);
+    *p = NULL;
+}
+
 static inline __sn__Inner *__sn__Inner_copy(const __sn__Inner *src) {
-    __sn__Inner *dst = calloc(1, sizeof(__sn__Inner));
+    __sn__Inner *dst = sn_ref_alloc(sizeof(__sn__Inner));
     dst->__rc__ = 1;
     dst->__sn__value = src->__sn__value;
     return dst;
@@ -41,6 +53,7 @@ static inline __sn__Inner *__sn__Inner_copy(const __sn__Inner *src) {
 
 #define sn_auto_Inner __attribute__((cleanup(__sn__Inner_release)))
 #define sn_auto_ref_Inner __attribute__((cleanup(__sn__Inner_release)))
+#define sn_auto_stack_Inner __attribute__((cleanup(__sn__Inner_release_stack)))
 
 static inline void __sn__Inner_release_elem(void *p) { __sn__Inner_release((__sn__Inner **)p); }
 static inline void __sn__Inner_retain_into(const void *src, void *dst) { *(__sn__Inner **)dst = __sn__Inner_retain(*(__sn__Inner *const *)src); }
@@ -53,7 +66,7 @@ static inline char *__sn__Inner_to_string(const __sn__Inner *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "value: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 /* Struct: Outer (as ref — refcounted) */
@@ -65,7 +78,7 @@ typedef struct {
 
 
 static inline __sn__Outer *__sn__Outer__new(void) {
-    __sn__Outer *p = calloc(1, sizeof(__sn__Outer));
+    __sn__Outer *p = sn_ref_alloc(sizeof(__sn__Outer));
     p->__rc__ = 1;
     return p;
 }
@@ -75,16 +88,28 @@ static inline __sn__Outer *__sn__Outer_retain(__sn__Outer *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Outer__drop_fields(__sn__Outer *p) {
+    __sn__Inner_release(&p->__sn__child);
+    (void)p;
+}
+
 static inline void __sn__Outer_release(__sn__Outer **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        __sn__Inner_release(&(*p)->__sn__child);
-        free(*p);
+        __sn__Outer__drop_fields(*p);
+        sn_ref_free(*p, sizeof(__sn__Outer));
     }
     *p = NULL;
 }
 
+/* Scope exit of a stack-allocated instance (see gen_model_ref_stack.c) */
+static inline void __sn__Outer_release_stack(__sn__Outer **p) {
+    if (*p) __sn__Outer__drop_fields(*p);
+    *p = NULL;
+}
+
 static inline __sn__Outer *__sn__Outer_copy(const __sn__Outer *src) {
-    __sn__Outer *dst = calloc(1, sizeof(__sn__Outer));
+    __sn__Outer *dst = sn_ref_alloc(sizeof(__sn__Outer));
     dst->__rc__ = 1;
     dst->__sn__child = __sn__Inner_retain(src->__sn__child);
     return dst;
@@ -92,6 +117,7 @@ static inline __sn__Outer *__sn__Outer_copy(const __sn__Outer *src) {
 
 #define sn_auto_Outer __attribute__((cleanup(__sn__Outer_release)))
 #define sn_auto_ref_Outer __attribute__((cleanup(__sn__Outer_release)))
+#define sn_auto_stack_Outer __attribute__((cleanup(__sn__Outer_release_stack)))
 
 static inline void __sn__Outer_release_elem(void *p) { __sn__Outer_release((__sn__Outer **)p); }
 static inline void __sn__Outer_retain_into(const void *src, void *dst) { *(__sn__Outer **)dst = __sn__Outer_retain(*(__sn__Outer *const *)src); }
@@ -102,9 +128,9 @@ static inline char *__sn__Outer_to_string(const __sn__Outer *p) {
     int off = 0;
     off += snprintf(buf + off, sizeof(buf) - off, "Outer { ");
     off += snprintf(buf + off, sizeof(buf) - off, "child: ");
-    { char *__fs__ = __sn__Inner_to_string(p->__sn__child); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    { char *__fs__ = __sn__Inner_to_string(p->__sn__child); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); sn_free(__fs__); }
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 typedef struct __Closure__ {
@@ -127,14 +153,15 @@ int main() {
         __tmp__->__sn__value = 2LL;
         __tmp__;
     });
-    sn_auto_Outer __sn__Outer * __sn__o = ({
-        __sn__Outer *__tmp__ = __sn__Outer__new();
-        __tmp__->__sn__child = __sn__Inner_retain(__sn__a);
+    __sn__Outer __sn__o__stk__; sn_auto_stack_Outer __sn__Outer * __sn__o = ({
+        __sn__Outer *__tmp__ = memset(&__sn__o__stk__, 0, sizeof(__sn__Outer));
+        __tmp__->__rc__ = 1;
+        __tmp__->__sn__child = ({ __sn__Inner * __mv__ = __sn__a; __sn__a = NULL; __mv__; });
         __tmp__;
     });
     ({
         __sn__Inner *__old__ = __sn__o->__sn__child;
-        __sn__o->__sn__child = __sn__Inner_retain(__sn__b);
+        __sn__o->__sn__child = ({ __sn__Inner * __mv__ = __sn__b; __sn__b = NULL; __mv__; });
         __sn__Inner_release(&__old__);
         __sn__o->__sn__child;
     });
@@ -16,7 +16,7 @@ typedef struct {
 
 
 static inline __sn__Person *__sn__Person__new(void) {
-    __sn__Person *p = calloc(1, sizeof(__sn__Person));
+    __sn__Person *p = sn_ref_alloc(sizeof(__sn__Person));
     p->__rc__ = 1;
     return p;
 }
@@ -26,24 +26,37 @@ static inline __sn__Person *__sn__Person_retain(__sn__Person *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Person__drop_fields(__sn__Person *p) {
+    sn_free(p->__sn__name);
+    (void)p;
+}
+
 static inline void __sn__Person_release(__sn__Person **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free((*p)->__sn__name);
-        free(*p);
+        __sn__Person__drop_fields(*p);
+        sn_ref_free(*p, sizeof(__sn__Person));
     }
     *p = NULL;
 }
 
+/* Scope exit of a stack-allocated instance (see gen_model_ref_stack.c) */
+static inline void __sn__Person_release_stack(__sn__Person **p) {
+    if (*p) __sn__Person__drop_fields(*p);
+    *p = NULL;
+}
+
 static inline __sn__Person *__sn__Person_copy(const __sn__Person *src) {
-    __sn__Person *dst = calloc(1, sizeof(__sn__Person));
+    __sn__Person *dst = sn_ref_alloc(sizeof(__sn__Person));
     dst->__rc__ = 1;
-    dst->__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst->__sn__name = src->__sn__name ? sn_strdup(src->__sn__name) : NULL;
     dst->__sn__age = src->__sn__age;
     return dst;
 }
 
 #define sn_auto_Person __attribute__((cleanup(__sn__Person_release)))
 #define sn_auto_ref_Person __attribute__((cleanup(__sn__Person_release)))
+#define sn_auto_stack_Person __attribute__((cleanup(__sn__Person_release_stack)))
 
 static inline void __sn__Person_release_elem(void *p) { __sn__Person_release((__sn__Person **)p); }
 static inline void __sn__Person_retain_into(const void *src, void *dst) { *(__sn__Person **)dst = __sn__Person_retain(*(__sn__Person *const *)src); }
@@ -59,7 +72,7 @@ static inline char *__sn__Person_to_string(const __sn__Person *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "age: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__age);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 typedef struct __Closure__ {
@@ -71,15 +84,16 @@ typedef struct __Closure__ {
 
 
 int main() {
-    sn_auto_Person __sn__Person * __sn__p = ({
-        __sn__Person *__tmp__ = __sn__Person__new();
-        __tmp__->__sn__name = strdup("Alice");
+    __sn__Person __sn__p__stk__; sn_auto_stack_Person __sn__Person * __sn__p = ({
+        __sn__Person *__tmp__ = memset(&__sn__p__stk__, 0, sizeof(__sn__Person));
+        __tmp__->__rc__ = 1;
+        __tmp__->__sn__name = sn_strdup("Alice");
         __tmp__->__sn__age = 30LL;
         __tmp__;
     });
     ({
-        char *__ma_str_tmp__ = strdup("Bob");
-        free(__sn__p->__sn__name);
+        char *__ma_str_tmp__ = sn_strdup("Bob");
+        sn_free(__sn__p->__sn__name);
         __sn__p->__sn__name = __ma_str_tmp__;
         __sn__p->__sn__name;
     });
@@ -15,7 +15,7 @@ typedef struct {
 
 
 static inline __sn__Address *__sn__Address__new(void) {
-    __sn__Address *p = calloc(1, sizeof(__sn__Address));
+    __sn__Address *p = sn_ref_alloc(sizeof(__sn__Address));
     p->__rc__ = 1;
     return p;
 }
@@ -25,23 +25,36 @@ static inline __sn__Address *__sn__Address_retain(__sn__Address *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Address__drop_fields(__sn__Address *p) {
+    sn_free(p->__sn__city);
+    (void)p;
+}
+
 static inline void __sn__Address_release(__sn__Address **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free((*p)->__sn__city);
-        free(*p);
+        __sn__Address__drop_fields(*p);
+        sn_ref_free(*p, sizeof(__sn__Address));
     }
     *p = NULL;
 }
 
+/* Scope exit of a stack-allocated instance (see gen_model_ref_stack.c) */
+static inline void __sn__Address_release_stack(__sn__Address **p) {
+    if (*p) __sn__Address__drop_fields(*p);
+    *p = NULL;
+}
+
 static inline __sn__Address *__sn__Address_copy(const __sn__Address *src) {
-    __sn__Address *dst = calloc(1, sizeof(__sn__Address));
+    __sn__Address *dst = sn_ref_alloc(sizeof(__sn__Address));
     dst->__rc__ = 1;
-    dst->__sn__city = src->__sn__city ? strdup(src->__sn__city) : NULL;
+    dst->__sn__city = src->__sn__city ? sn_strdup(src->__sn__city) : NULL;
     return dst;
 }
 
 #define sn_auto_Address __attribute__((cleanup(__sn__Address_release)))
 #define sn_auto_ref_Address __attribute__((cleanup(__sn__Address_release)))
+#define sn_auto_stack_Address __attribute__((cleanup(__sn__Address_release_stack)))
 
 static inline void __sn__Address_release_elem(void *p) { __sn__Address_release((__sn__Address **)p); }
 static inline void __sn__Address_retain_into(const void *src, void *dst) { *(__sn__Address **)dst = __sn__Address_retain(*(__sn__Address *const *)src); }
@@ -54,7 +67,7 @@ static inline char *__sn__Address_to_string(const __sn__Address *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "city: ");
     off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__city ? p->__sn__city : "nil");
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 /* Struct: Person (as ref — refcounted) */
@@ -67,7 +80,7 @@ typedef struct {
 
 
 static inline __sn__Person *__sn__Person__new(void) {
-    __sn__Person *p = calloc(1, sizeof(__sn__Person));
+    __sn__Person *p = sn_ref_alloc(sizeof(__sn__Person));
     p->__rc__ = 1;
     return p;
 }
@@ -77,25 +90,38 @@ static inline __sn__Person *__sn__Person_retain(__sn__Person *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Person__drop_fields(__sn__Person *p) {
+    sn_free(p->__sn__name);
+    __sn__Address_release(&p->__sn__addr);
+    (void)p;
+}
+
 static inline void __sn__Person_release(__sn__Person **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free((*p)->__sn__name);
-        __sn__Address_release(&(*p)->__sn__addr);
-        free(*p);
+        __sn__Person__drop_fields(*p);
+        sn_ref_free(*p, sizeof(__sn__Person));
     }
     *p = NULL;
 }
 
+/* Scope exit of a stack-allocated instance (see gen_model_ref_stack.c) */
+static inline void __sn__Person_release_stack(__sn__Person **p) {
+    if (*p) __sn__Person__drop_fields(*p);
+    *p = NULL;
+}
+
 static inline __sn__Person *__sn__Person_copy(const __sn__Person *src) {
-    __sn__Person *dst = calloc(1, sizeof(__sn__Person));
+    __sn__Person *dst = sn_ref_alloc(sizeof(__sn__Person));
     dst->__rc__ = 1;
-    dst->__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst->__sn__name = src->__sn__name ? sn_strdup(src->__sn__name) : NULL;
     dst->__sn__addr = __sn__Address_retain(src->__sn__addr);
     return dst;
 }
 
 #define sn_auto_Person __attribute__((cleanup(__sn__Person_release)))
 #define sn_auto_ref_Person __attribute__((cleanup(__sn__Person_release)))
+#define sn_auto_stack_Person __attribute__((cleanup(__sn__Person_release_stack)))
 
 static inline void __sn__Person_release_elem(void *p) { __sn__Person_release((__sn__Person **)p); }
 static inline void __sn__Person_retain_into(const void *src, void *dst) { *(__sn__Person **)dst = __sn__Person_retain(*(__sn__Person *const *)src); }
@@ -109,9 +135,9 @@ static inline char *__sn__Person_to_string(const __sn__Person *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
     off += snprintf(buf + off, sizeof(buf) - off, ", ");
     off += snprintf(buf + off, sizeof(buf) - off, "addr: ");
-    { char *__fs__ = __sn__Address_to_string(p->__sn__addr); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); free(__fs__); }
+    { char *__fs__ = __sn__Address_to_string(p->__sn__addr); off += snprintf(buf + off, sizeof(buf) - off, "%s", __fs__); sn_free(__fs__); }
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 typedef struct __Closure__ {
@@ -126,13 +152,14 @@ typedef struct __Closure__ {
 int main() {
     sn_auto_Address __sn__Address * __sn__a = ({
         __sn__Address *__tmp__ = __sn__Address__new();
-        __tmp__->__sn__city = strdup("NYC");
+        __tmp__->__sn__city = sn_strdup("NYC");
         __tmp__;
     });
-    sn_auto_Person __sn__Person * __sn__p = ({
-        __sn__Person *__tmp__ = __sn__Person__new();
-        __tmp__->__sn__name = strdup("Alice");
-        __tmp__->__sn__addr = __sn__Address_retain(__sn__a);
+    __sn__Person __sn__p__stk__; sn_auto_stack_Person __sn__Person * __sn__p = ({
+        __sn__Person *__tmp__ = memset(&__sn__p__stk__, 0, sizeof(__sn__Person));
+        __tmp__->__rc__ = 1;
+        __tmp__->__sn__name = sn_strdup("Alice");
+        __tmp__->__sn__addr = ({ __sn__Address * __mv__ = __sn__a; __sn__a = NULL; __mv__; });
         __tmp__;
     });
     sn_assert((sn_str_length(__sn__p->__sn__name) == 5LL), "name should be Alice");
@@ -22,7 +22,7 @@ void __sn__print_name(char * __sn__name) {
 }
 
 int main() {
-    sn_auto_str char * __sn__s = strdup("Alice");
+    sn_auto_str char * __sn__s = sn_strdup("Alice");
     __sn__print_name(__sn__s);
     
     fflush(stdout);
@@ -15,7 +15,7 @@ typedef struct {
 
 
 static inline __sn__Box *__sn__Box__new(void) {
-    __sn__Box *p = calloc(1, sizeof(__sn__Box));
+    __sn__Box *p = sn_ref_alloc(sizeof(__sn__Box));
     p->__rc__ = 1;
     return p;
 }
@@ -25,15 +25,27 @@ static inline __sn__Box *__sn__Box_retain(__sn__Box *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Box__drop_fields(__sn__Box *p) {
+    (void)p;
+}
+
 static inline void __sn__Box_release(__sn__Box **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free(*p);
+        __sn__Box__drop_fields(*p);
+        sn_ref_free(*p, sizeof(__sn__Box));
     }
     *p = NULL;
 }
 
+/* Scope exit of a stack-allocated instance (see gen_model_ref_stack.c) */
+static inline void __sn__Box_release_stack(__sn__Box **p) {
+    if (*p) __sn__Box__drop_fields(*p);
+    *p = NULL;
+}
+
 static inline __sn__Box *__sn__Box_copy(const __sn__Box *src) {
-    __sn__Box *dst = calloc(1, sizeof(__sn__Box));
+    __sn__Box *dst = sn_ref_alloc(sizeof(__sn__Box));
     dst->__rc__ = 1;
     dst->__sn__value = src->__sn__value;
     return dst;
@@ -41,6 +53,7 @@ static inline __sn__Box *__sn__Box_copy(const __sn__Box *src) {
 
 #define sn_auto_Box __attribute__((cleanup(__sn__Box_release)))
 #define sn_auto_ref_Box __attribute__((cleanup(__sn__Box_release)))
+#define sn_auto_stack_Box __attribute__((cleanup(__sn__Box_release_stack)))
 
 static inline void __sn__Box_release_elem(void *p) { __sn__Box_release((__sn__Box **)p); }
 static inline void __sn__Box_retain_into(const void *src, void *dst) { *(__sn__Box **)dst = __sn__Box_retain(*(__sn__Box *const *)src); }
@@ -53,7 +66,7 @@ static inline char *__sn__Box_to_string(const __sn__Box *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "value: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 __sn__Box * __sn__make_box(long long);
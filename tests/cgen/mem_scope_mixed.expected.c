@@ -15,7 +15,7 @@ typedef struct {
 
 
 static inline __sn__Tag *__sn__Tag__new(void) {
-    __sn__Tag *p = calloc(1, sizeof(__sn__Tag));
+    __sn__Tag *p = sn_ref_alloc(sizeof(__sn__Tag));
     p->__rc__ = 1;
     return p;
 }
@@ -25,23 +25,36 @@ static inline __sn__Tag *__sn__Tag_retain(__sn__Tag *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Tag__drop_fields(__sn__Tag *p) {
+    sn_free(p->__sn__label);
+    (void)p;
+}
+
 static inline void __sn__Tag_release(__sn__Tag **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free((*p)->__sn__label);
-        free(*p);
+        __sn__Tag__drop_fields(*p);
+        sn_ref_free(*p, sizeof(__sn__Tag));
     }
     *p = NULL;
 }
 
+/* Scope exit of a stack-allocated instance (see gen_model_ref_stack.c) */
+static inline void __sn__Tag_release_stack(__sn__Tag **p) {
+    if (*p) __sn__Tag__drop_fields(*p);
+    *p = NULL;
+}
+
 static inline __sn__Tag *__sn__Tag_copy(const __sn__Tag *src) {
-    __sn__Tag *dst = calloc(1, sizeof(__sn__Tag));
+    __sn__Tag *dst = sn_ref_alloc(sizeof(__sn__Tag));
     dst->__rc__ = 1;
-    dst->__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    dst->__sn__label = src->__sn__label ? sn_strdup(src->__sn__label) : NULL;
     return dst;
 }
 
 #define sn_auto_Tag __attribute__((cleanup(__sn__Tag_release)))
 #define sn_auto_ref_Tag __attribute__((cleanup(__sn__Tag_release)))
+#define sn_auto_stack_Tag __attribute__((cleanup(__sn__Tag_release_stack)))
 
 static inline void __sn__Tag_release_elem(void *p) { __sn__Tag_release((__sn__Tag **)p); }
 static inline void __sn__Tag_retain_into(const void *src, void *dst) { *(__sn__Tag **)dst = __sn__Tag_retain(*(__sn__Tag *const *)src); }
@@ -54,7 +67,7 @@ static inline char *__sn__Tag_to_string(const __sn__Tag *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "label: ");
     off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 typedef struct __Closure__ {
@@ -66,10 +79,11 @@ typedef struct __Closure__ {
 
 
 int main() {
-    sn_auto_str char * __sn__s = strdup("hello");
-    sn_auto_Tag __sn__Tag * __sn__t = ({
-        __sn__Tag *__tmp__ = __sn__Tag__new();
-        __tmp__->__sn__label = strdup("tag1");
+    sn_auto_str char * __sn__s = sn_strdup("hello");
+    __sn__Tag __sn__t__stk__; sn_auto_stack_Tag __sn__Tag * __sn__t = ({
+        __sn__Tag *__tmp__ = memset(&__sn__t__stk__, 0, sizeof(__sn__Tag));
+        __tmp__->__rc__ = 1;
+        __tmp__->__sn__label = sn_strdup("tag1");
         __tmp__;
     });
     long long __sn__n = 42LL;
@@ -14,8 +14,8 @@ typedef struct __Closure__ {
 } __Closure__;
 
 int main() {
-    sn_auto_str char * __sn__a = strdup("hello");
-    sn_auto_str char * __sn__b = strdup(__sn__a);
+    sn_auto_str char * __sn__a = sn_strdup("hello");
+    sn_auto_str char * __sn__b = sn_strdup(__sn__a);
     sn_auto_str char * __sn__c = ({
             sn_auto_str char *__is_p0__ = sn_strdup("value: ");
             sn_auto_str char *__is_p1__ = sn_strdup(__sn__a);
@@ -16,7 +16,7 @@ typedef struct {
 
 
 static inline __sn__Node *__sn__Node__new(void) {
-    __sn__Node *p = calloc(1, sizeof(__sn__Node));
+    __sn__Node *p = sn_ref_alloc(sizeof(__sn__Node));
     p->__rc__ = 1;
     return p;
 }
@@ -26,24 +26,37 @@ static inline __sn__Node *__sn__Node_retain(__sn__Node *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Node__drop_fields(__sn__Node *p) {
+    sn_free(p->__sn__label);
+    (void)p;
+}
+
 static inline void __sn__Node_release(__sn__Node **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free((*p)->__sn__label);
-        free(*p);
+        __sn__Node__drop_fields(*p);
+        sn_ref_free(*p, sizeof(__sn__Node));
     }
     *p = NULL;
 }
 
+/* Scope exit of a stack-allocated instance (see gen_model_ref_stack.c) */
+static inline void __sn__Node_release_stack(__sn__Node **p) {
+    if (*p) __sn__Node__drop_fields(*p);
+    *p = NULL;
+}
+
 static inline __sn__Node *__sn__Node_copy(const __sn__Node *src) {
-    __sn__Node *dst = calloc(1, sizeof(__sn__Node));
+    __sn__Node *dst = sn_ref_alloc(sizeof(__sn__Node));
     dst->__rc__ = 1;
     dst->__sn__value = src->__sn__value;
-    dst->__sn__label = src->__sn__label ? strdup(src->__sn__label) : NULL;
+    dst->__sn__label = src->__sn__label ? sn_strdup(src->__sn__label) : NULL;
     return dst;
 }
 
 #define sn_auto_Node __attribute__((cleanup(__sn__Node_release)))
 #define sn_auto_ref_Node __attribute__((cleanup(__sn__Node_release)))
+#define sn_auto_stack_Node __attribute__((cleanup(__sn__Node_release_stack)))
 
 static inline void __sn__Node_release_elem(void *p) { __sn__Node_release((__sn__Node **)p); }
 static inline void __sn__Node_retain_into(const void *src, void *dst) { *(__sn__Node **)dst = __sn__Node_retain(*(__sn__Node *const *)src); }
@@ -59,7 +72,7 @@ static inline char *__sn__Node_to_string(const __sn__Node *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "label: ");
     off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__label ? p->__sn__label : "nil");
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 typedef struct __Closure__ {
@@ -71,10 +84,11 @@ typedef struct __Closure__ {
 
 
 int main() {
-    sn_auto_Node __sn__Node * __sn__n = ({
-        __sn__Node *__tmp__ = __sn__Node__new();
+    __sn__Node __sn__n__stk__; sn_auto_stack_Node __sn__Node * __sn__n = ({
+        __sn__Node *__tmp__ = memset(&__sn__n__stk__, 0, sizeof(__sn__Node));
+        __tmp__->__rc__ = 1;
         __tmp__->__sn__value = 42LL;
-        __tmp__->__sn__label = strdup("root");
+        __tmp__->__sn__label = sn_strdup("root");
         __tmp__;
     });
     sn_assert((__sn__n->__sn__value == 42LL), "value should be 42");
@@ -14,13 +14,13 @@ typedef struct {
 /* Value operations */
 static inline __sn__Person __sn__Person_copy(const __sn__Person *src) {
     __sn__Person dst;
-    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__name = src->__sn__name ? sn_strdup(src->__sn__name) : NULL;
     dst.__sn__age = src->__sn__age;
     return dst;
 }
 
 static inline void __sn__Person_cleanup(__sn__Person *p) {
-    free(p->__sn__name);
+    sn_free(p->__sn__name);
 
 }
 
@@ -36,8 +36,8 @@ static inline __sn__Person *__sn__Person_alloc(void) {
 
 static inline void __sn__Person_release(__sn__Person **p) {
     if (*p) {
-        free((*p)->__sn__name);
-        free(*p);
+        sn_free((*p)->__sn__name);
+        sn_free(*p);
     }
     *p = NULL;
 }
@@ -57,7 +57,7 @@ static inline char *__sn__Person_to_string(const __sn__Person *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "age: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__age);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 
@@ -71,7 +71,7 @@ typedef struct __Closure__ {
 
 
 int main() {
-    sn_auto_Person __sn__Person __sn__a = (__sn__Person){ .__sn__name = strdup("Alice"), .__sn__age = 30LL };
+    sn_auto_Person __sn__Person __sn__a = (__sn__Person){ .__sn__name = sn_strdup("Alice"), .__sn__age = 30LL };
     sn_auto_Person __sn__Person __sn__b = __sn__Person_copy(&__sn__a);
     (__sn__b.__sn__age = 99LL);
     
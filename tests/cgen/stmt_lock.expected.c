@@ -18,13 +18,13 @@ int main() {
     
     pthread_mutex_t __sn__x_mutex = PTHREAD_MUTEX_INITIALIZER;
     _Atomic long long __sn__y = 0LL;
-    
-    pthread_mutex_t __sn__y_mutex = PTHREAD_MUTEX_INITIALIZER;
     pthread_mutex_lock(&__sn__x_mutex);
     {
+    
         (__sn__x = sn_add_long(__sn__x, 1LL));
         
-        (__sn__y = __sn__x);
+    
+        ({ long long __sn_new__ = __sn__x; atomic_store_explicit(&__sn__y, __sn_new__, memory_order_seq_cst); __sn_new__; });
         
     }
     pthread_mutex_unlock(&__sn__x_mutex);
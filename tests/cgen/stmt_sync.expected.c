@@ -19,6 +19,7 @@ int main() {
     pthread_mutex_t __sn__counter_mutex = PTHREAD_MUTEX_INITIALIZER;
     pthread_mutex_lock(&__sn__counter_mutex);
     {
+    
         (__sn__counter = sn_add_long(__sn__counter, 1LL));
         
     }
@@ -13,12 +13,12 @@ typedef struct {
 /* Value operations */
 static inline __sn__Resource __sn__Resource_copy(const __sn__Resource *src) {
     __sn__Resource dst;
-    dst.__sn__name = src->__sn__name ? strdup(src->__sn__name) : NULL;
+    dst.__sn__name = src->__sn__name ? sn_strdup(src->__sn__name) : NULL;
     return dst;
 }
 
 static inline void __sn__Resource_cleanup(__sn__Resource *p) {
-    free(p->__sn__name);
+    sn_free(p->__sn__name);
 
 }
 
@@ -34,8 +34,8 @@ static inline __sn__Resource *__sn__Resource_alloc(void) {
 
 static inline void __sn__Resource_release(__sn__Resource **p) {
     if (*p) {
-        free((*p)->__sn__name);
-        free(*p);
+        sn_free((*p)->__sn__name);
+        sn_free(*p);
     }
     *p = NULL;
 }
@@ -52,7 +52,7 @@ static inline char *__sn__Resource_to_string(const __sn__Resource *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "name: ");
     off += snprintf(buf + off, sizeof(buf) - off, "\"%s\"", p->__sn__name ? p->__sn__name : "nil");
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 
@@ -76,8 +76,9 @@ void __sn__Resource_dispose(__sn__Resource *__sn__self) {
 
 int main() {
     {
-        sn_auto_Resource __sn__Resource __sn__r = (__sn__Resource){ .__sn__name = strdup("test") };
+        sn_auto_Resource __sn__Resource __sn__r = (__sn__Resource){ .__sn__name = sn_strdup("test") };
     {
+    
         sn_assert((strcmp(__sn__r.__sn__name, "test") == 0), "expected resource name to be test");
         
     }
@@ -25,14 +25,21 @@ static inline __sn__Stmt *__sn__Stmt_retain(__sn__Stmt *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Stmt__drop_fields(__sn__Stmt *p) {
+    (void)p;
+}
+
 static inline void __sn__Stmt_release(__sn__Stmt **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free(*p);
+        __sn__Stmt__drop_fields(*p);
+        sn_free(*p);
     }
     *p = NULL;
 }
 
 
+
 #define sn_auto_Stmt __attribute__((cleanup(__sn__Stmt_release)))
 #define sn_auto_ref_Stmt __attribute__((cleanup(__sn__Stmt_release)))
 
@@ -26,14 +26,21 @@ static inline __sn__Vec2 *__sn__Vec2_retain(__sn__Vec2 *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Vec2__drop_fields(__sn__Vec2 *p) {
+    (void)p;
+}
+
 static inline void __sn__Vec2_release(__sn__Vec2 **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free(*p);
+        __sn__Vec2__drop_fields(*p);
+        sn_free(*p);
     }
     *p = NULL;
 }
 
 
+
 #define sn_auto_Vec2 __attribute__((cleanup(__sn__Vec2_release)))
 #define sn_auto_ref_Vec2 __attribute__((cleanup(__sn__Vec2_release)))
 
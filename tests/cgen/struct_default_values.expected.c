@@ -37,7 +37,7 @@ static inline __sn__Config *__sn__Config_alloc(void) {
 
 static inline void __sn__Config_release(__sn__Config **p) {
     if (*p) {
-        free(*p);
+        sn_free(*p);
     }
     *p = NULL;
 }
@@ -60,7 +60,7 @@ static inline char *__sn__Config_to_string(const __sn__Config *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "scale: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%.5f", (double)p->__sn__scale);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 
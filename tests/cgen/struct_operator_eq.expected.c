@@ -35,7 +35,7 @@ static inline __sn__Point *__sn__Point_alloc(void) {
 
 static inline void __sn__Point_release(__sn__Point **p) {
     if (*p) {
-        free(*p);
+        sn_free(*p);
     }
     *p = NULL;
 }
@@ -55,7 +55,7 @@ static inline char *__sn__Point_to_string(const __sn__Point *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "y: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__y);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 
@@ -37,7 +37,7 @@ static inline __sn__PackedData *__sn__PackedData_alloc(void) {
 
 static inline void __sn__PackedData_release(__sn__PackedData **p) {
     if (*p) {
-        free(*p);
+        sn_free(*p);
     }
     *p = NULL;
 }
@@ -57,7 +57,7 @@ static inline char *__sn__PackedData_to_string(const __sn__PackedData *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "value: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 
@@ -15,7 +15,7 @@ typedef struct {
 
 
 static inline __sn__Builder *__sn__Builder__new(void) {
-    __sn__Builder *p = calloc(1, sizeof(__sn__Builder));
+    __sn__Builder *p = sn_ref_alloc(sizeof(__sn__Builder));
     p->__rc__ = 1;
     return p;
 }
@@ -25,15 +25,27 @@ static inline __sn__Builder *__sn__Builder_retain(__sn__Builder *p) {
     return p;
 }
 
+/* Release what the fields own; the instance itself is freed by the caller */
+static inline void __sn__Builder__drop_fields(__sn__Builder *p) {
+    (void)p;
+}
+
 static inline void __sn__Builder_release(__sn__Builder **p) {
     if (*p && --(*p)->__rc__ == 0) {
-        free(*p);
+        __sn__Builder__drop_fields(*p);
+        sn_ref_free(*p, sizeof(__sn__Builder));
     }
     *p = NULL;
 }
 
+/* Scope exit of a stack-allocated instance (see gen_model_ref_stack.c) */
+static inline void __sn__Builder_release_stack(__sn__Builder **p) {
+    if (*p) __sn__Builder__drop_fields(*p);
+    *p = NULL;
+}
+
 static inline __sn__Builder *__sn__Builder_copy(const __sn__Builder *src) {
-    __sn__Builder *dst = calloc(1, sizeof(__sn__Builder));
+    __sn__Builder *dst = sn_ref_alloc(sizeof(__sn__Builder));
     dst->__rc__ = 1;
     dst->__sn__value = src->__sn__value;
     return dst;
@@ -41,6 +53,7 @@ static inline __sn__Builder *__sn__Builder_copy(const __sn__Builder *src) {
 
 #define sn_auto_Builder __attribute__((cleanup(__sn__Builder_release)))
 #define sn_auto_ref_Builder __attribute__((cleanup(__sn__Builder_release)))
+#define sn_auto_stack_Builder __attribute__((cleanup(__sn__Builder_release_stack)))
 
 static inline void __sn__Builder_release_elem(void *p) { __sn__Builder_release((__sn__Builder **)p); }
 static inline void __sn__Builder_retain_into(const void *src, void *dst) { *(__sn__Builder **)dst = __sn__Builder_retain(*(__sn__Builder *const *)src); }
@@ -53,7 +66,7 @@ static inline char *__sn__Builder_to_string(const __sn__Builder *p) {
     off += snprintf(buf + off, sizeof(buf) - off, "value: ");
     off += snprintf(buf + off, sizeof(buf) - off, "%lld", (long long)p->__sn__value);
     off += snprintf(buf + off, sizeof(buf) - off, " }");
-    return strdup(buf);
+    return sn_strdup(buf);
 }
 
 __sn__Builder * __sn__Builder_setValue(__sn__Builder *, long long);
@@ -17,7 +17,7 @@ typedef struct __Closure__ {
 
 char * __sn__make_str() {
 
-    sn_auto_str char * __sn__s = strdup("hello");
+    sn_auto_str char * __sn__s = sn_strdup("hello");
 
     {
         char * __ret__ = __sn__s;
@@ -14,7 +14,7 @@ typedef struct __Closure__ {
 } __Closure__;
 
 int main() {
-    sn_auto_str char * __sn__s = strdup("hello");
-    sn_auto_str char * __sn__t = strdup("world");
+    sn_auto_str char * __sn__s = sn_strdup("hello");
+    sn_auto_str char * __sn__t = sn_strdup("world");
     return 0LL;    fflush(stdout);
 }
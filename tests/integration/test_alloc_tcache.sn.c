@@ -0,0 +1,18 @@
+/* Native helpers for the tcache allocator test */
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern bool sn_tcache_on;
+
+bool sn_test_tcache_active(void) {
+    return sn_tcache_on;
+}
+
+/* A string the runtime did not allocate; it frees it when the value dies */
+char *sn_test_libc_string(long long n) {
+    char *s = malloc((size_t)n + 1);
+    memset(s, 'x', (size_t)n);
+    s[n] = '\0';
+    return s;
+}
@@ -0,0 +1,10 @@
+/* Native helpers for the move-on-last-use identity test */
+#include <stdint.h>
+
+long long sn_test_str_id(const char *s) {
+    return (long long)(intptr_t)s;
+}
+
+long long sn_test_array_id(void *a) {
+    return (long long)(intptr_t)a;
+}
@@ -255,6 +255,16 @@ static void test_lexer_keyword_lock(void)
     cleanup_lexer_test(&arena, &lexer);
 }
 
+static void test_lexer_keyword_threadlocal(void)
+{
+    Arena arena;
+    Lexer lexer;
+    init_lexer_test(&arena, &lexer, "threadlocal");
+    Token tok = lexer_scan_token(&lexer);
+    assert(tok.type == TOKEN_THREADLOCAL);
+    cleanup_lexer_test(&arena, &lexer);
+}
+
 /* ============================================================================
  * Type Keyword Tests
  * ============================================================================ */
@@ -657,6 +667,7 @@ void test_lexer_keywords_main(void)
     TEST_RUN("keyword_private_is_identifier", test_lexer_kw_private_is_identifier);
     TEST_RUN("keyword_sync", test_lexer_keyword_sync);
     TEST_RUN("keyword_lock", test_lexer_keyword_lock);
+    TEST_RUN("keyword_threadlocal", test_lexer_keyword_threadlocal);
 
     // Type keywords
     TEST_RUN("type_int", test_lexer_type_int);
@@ -576,6 +576,36 @@ static void test_lexer_pragma_link(void)
     DEBUG_INFO("Finished test_lexer_pragma_link");
 }
 
+static void test_lexer_pragma_align(void)
+{
+    DEBUG_INFO("Starting test_lexer_pragma_align");
+
+    const char *source = "@align(128) @cacheline #pragma align(16)\n";
+    Arena arena;
+    arena_init(&arena, 1024);
+    Lexer lexer;
+    lexer_init(&arena, &lexer, source, "test.sn");
+
+    Token t1 = lexer_scan_token(&lexer);
+    assert(t1.type == TOKEN_PRAGMA_ALIGN);
+    assert(lexer_scan_token(&lexer).type == TOKEN_LEFT_PAREN);
+    Token t2 = lexer_scan_token(&lexer);
+    assert(t2.type == TOKEN_INT_LITERAL);
+    assert(t2.literal.int_value == 128);
+    assert(lexer_scan_token(&lexer).type == TOKEN_RIGHT_PAREN);
+
+    Token t3 = lexer_scan_token(&lexer);
+    assert(t3.type == TOKEN_PRAGMA_CACHELINE);
+
+    Token t4 = lexer_scan_token(&lexer);
+    assert(t4.type == TOKEN_PRAGMA_ALIGN);
+
+    lexer_cleanup(&lexer);
+    arena_free(&arena);
+
+    DEBUG_INFO("Finished test_lexer_pragma_align");
+}
+
 static void test_lexer_val_ref_keywords(void)
 {
     DEBUG_INFO("Starting test_lexer_val_ref_keywords");
@@ -815,6 +845,7 @@ void test_lexer_literal_main(void)
     // Pragma tests
     TEST_RUN("lexer_pragma_include", test_lexer_pragma_include);
     TEST_RUN("lexer_pragma_link", test_lexer_pragma_link);
+    TEST_RUN("lexer_pragma_align", test_lexer_pragma_align);
     // Interop keyword tests
     TEST_RUN("lexer_val_ref_keywords", test_lexer_val_ref_keywords);
     TEST_RUN("lexer_ampersand_operator", test_lexer_ampersand_operator);
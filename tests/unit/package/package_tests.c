@@ -172,6 +172,8 @@ static void test_yaml_write_and_parse(void)
     strncpy(config.author, "Test Author", sizeof(config.author) - 1);
     strncpy(config.description, "A test project", sizeof(config.description) - 1);
     strncpy(config.license, "MIT", sizeof(config.license) - 1);
+    strncpy(config.alloc, "tcache", sizeof(config.alloc) - 1);
+    strncpy(config.threads, "os", sizeof(config.threads) - 1);
 
     bool write_success = package_yaml_write(TEST_YAML_PATH, &config);
     assert(write_success == true);
@@ -187,6 +189,8 @@ static void test_yaml_write_and_parse(void)
     assert(strcmp(parsed.author, "Test Author") == 0);
     assert(strcmp(parsed.description, "A test project") == 0);
     assert(strcmp(parsed.license, "MIT") == 0);
+    assert(strcmp(parsed.alloc, "tcache") == 0);
+    assert(strcmp(parsed.threads, "os") == 0);
     assert(parsed.dependency_count == 0);
 
     cleanup_test_yaml();
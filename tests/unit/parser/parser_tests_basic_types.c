@@ -284,6 +284,54 @@ static void test_pointer_type_function_parsing()
     }
 }
 
+static void test_generic_inst_type_name_token()
+{
+    // map<K, V> keeps the token of its template name for error reporting
+    {
+        Arena arena;
+        Lexer lexer;
+        Parser parser;
+        SymbolTable symbol_table;
+        const char *source = "var x: int = 0\nvar m: map<str, int> = {}\n";
+        setup_parser(&arena, &lexer, &parser, &symbol_table, source);
+
+        Module *module = parser_execute(&parser, "test.sn");
+        assert(module != NULL);
+        assert(module->count == 2);
+        Stmt *stmt = module->statements[1];
+        assert(stmt->type == STMT_VAR_DECL);
+        Type *type = stmt->as.var_decl.type;
+        assert(type->kind == TYPE_GENERIC_INST);
+        assert(type->as.generic_inst.name_token.line == 2);
+        assert(type->as.generic_inst.name_token.length == 3);
+        assert(strncmp(type->as.generic_inst.name_token.start, "map", 3) == 0);
+
+        cleanup_parser(&arena, &lexer, &parser, &symbol_table);
+    }
+
+    // A plain container name without type arguments keeps its token too
+    {
+        Arena arena;
+        Lexer lexer;
+        Parser parser;
+        SymbolTable symbol_table;
+        const char *source = "fn f(b: bits): void =>\n  return\n";
+        setup_parser(&arena, &lexer, &parser, &symbol_table, source);
+
+        Module *module = parser_execute(&parser, "test.sn");
+        assert(module != NULL);
+        assert(module->count == 1);
+        Stmt *stmt = module->statements[0];
+        assert(stmt->type == STMT_FUNCTION);
+        Type *type = stmt->as.function.params[0].type;
+        assert(type->kind == TYPE_GENERIC_INST);
+        assert(type->as.generic_inst.name_token.line == 1);
+        assert(strncmp(type->as.generic_inst.name_token.start, "bits", 4) == 0);
+
+        cleanup_parser(&arena, &lexer, &parser, &symbol_table);
+    }
+}
+
 static void test_parser_basic_types_main()
 {
     TEST_SECTION("Parser Basic Types Tests");
@@ -291,4 +339,5 @@ static void test_parser_basic_types_main()
     TEST_RUN("interop_type_function_parsing", test_interop_type_function_parsing);
     TEST_RUN("pointer_type_var_decl_parsing", test_pointer_type_var_decl_parsing);
     TEST_RUN("pointer_type_function_parsing", test_pointer_type_function_parsing);
+    TEST_RUN("generic_inst_type_name_token", test_generic_inst_type_name_token);
 }
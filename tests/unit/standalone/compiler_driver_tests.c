@@ -306,6 +306,52 @@ static void test_debug_flag(void)
     arena_free(&options.arena);
 }
 
+static void test_alloc_mode_flag(void)
+{
+    CompilerOptions options;
+    memset(&options, 0, sizeof(options));
+    const char *args[] = {"sn", "test.sn", "--alloc=tcache"};
+    int argc;
+    char **argv;
+    make_args(&argc, &argv, args, 3);
+
+    arena_init(&options.arena, 1024);
+
+    int result = compiler_parse_args(argc, argv, &options);
+    assert(result == 1);
+    assert(options.alloc_mode == ALLOC_TCACHE);
+    assert(options.alloc_mode_set == 1);
+
+    AllocMode mode = ALLOC_SLAB;
+    assert(compiler_parse_alloc_mode("system", &mode) && mode == ALLOC_SYSTEM);
+    assert(!compiler_parse_alloc_mode("jemalloc", &mode) && mode == ALLOC_SYSTEM);
+
+    arena_free(&options.arena);
+}
+
+static void test_thread_mode_flag(void)
+{
+    CompilerOptions options;
+    memset(&options, 0, sizeof(options));
+    const char *args[] = {"sn", "test.sn", "--threads=os"};
+    int argc;
+    char **argv;
+    make_args(&argc, &argv, args, 3);
+
+    arena_init(&options.arena, 1024);
+
+    int result = compiler_parse_args(argc, argv, &options);
+    assert(result == 1);
+    assert(options.thread_mode == THREADS_OS);
+    assert(options.thread_mode_set == 1);
+
+    ThreadMode mode = THREADS_OS;
+    assert(compiler_parse_thread_mode("pool", &mode) && mode == THREADS_POOL);
+    assert(!compiler_parse_thread_mode("fibers", &mode) && mode == THREADS_POOL);
+
+    arena_free(&options.arena);
+}
+
 static void test_log_level_flag(void)
 {
     CompilerOptions options;
@@ -706,6 +752,8 @@ void test_compiler_driver_main(void)
     TEST_SECTION("Compiler Driver - Debug Options");
     TEST_RUN("verbose_flag", test_verbose_flag);
     TEST_RUN("debug_flag", test_debug_flag);
+    TEST_RUN("alloc_mode_flag", test_alloc_mode_flag);
+    TEST_RUN("thread_mode_flag", test_thread_mode_flag);
     TEST_RUN("log_level_flag", test_log_level_flag);
     TEST_RUN("log_level_verbose", test_log_level_verbose);
 
@@ -434,6 +434,72 @@ static void test_struct_layout_nested()
     DEBUG_INFO("Finished test_struct_layout_nested");
 }
 
+/* Test: @cacheline on a field and @align(N) on the struct */
+static void test_struct_layout_min_alignment()
+{
+    DEBUG_INFO("Starting test_struct_layout_min_alignment");
+
+    Arena arena;
+    arena_init(&arena, 4096);
+
+    /* C equivalent:
+     * struct Counters { int64_t a; _Alignas(64) int64_t b; };
+     * Expected: a at 0, b at 64 (own cache line)
+     * Size: 128, Alignment: 64
+     */
+    Type *int_type = ast_create_primitive_type(&arena, TYPE_INT);
+    Type *byte_type = ast_create_primitive_type(&arena, TYPE_BYTE);
+
+    Type *struct_type = arena_alloc(&arena, sizeof(Type));
+    memset(struct_type, 0, sizeof(Type));
+    struct_type->kind = TYPE_STRUCT;
+    struct_type->as.struct_type.name = "Counters";
+    struct_type->as.struct_type.field_count = 2;
+    struct_type->as.struct_type.is_native = true;
+    struct_type->as.struct_type.fields = arena_alloc(&arena, sizeof(StructField) * 2);
+    memset(struct_type->as.struct_type.fields, 0, sizeof(StructField) * 2);
+
+    struct_type->as.struct_type.fields[0].name = "a";
+    struct_type->as.struct_type.fields[0].type = int_type;
+    struct_type->as.struct_type.fields[1].name = "b";
+    struct_type->as.struct_type.fields[1].type = int_type;
+    struct_type->as.struct_type.fields[1].min_alignment = SN_CACHE_LINE_SIZE;
+
+    calculate_struct_layout(struct_type);
+
+    assert(struct_type->as.struct_type.fields[0].offset == 0);
+    assert(struct_type->as.struct_type.fields[1].offset == 64);
+    assert(struct_type->as.struct_type.size == 128);
+    assert(struct_type->as.struct_type.alignment == 64);
+
+    /* C equivalent:
+     * struct Flag { _Alignas(32) char set; };
+     * Expected: trailing padding up to the requested alignment
+     * Size: 32, Alignment: 32
+     */
+    Type *flag_type = arena_alloc(&arena, sizeof(Type));
+    memset(flag_type, 0, sizeof(Type));
+    flag_type->kind = TYPE_STRUCT;
+    flag_type->as.struct_type.name = "Flag";
+    flag_type->as.struct_type.field_count = 1;
+    flag_type->as.struct_type.is_native = true;
+    flag_type->as.struct_type.min_alignment = 32;
+    flag_type->as.struct_type.fields = arena_alloc(&arena, sizeof(StructField));
+    memset(flag_type->as.struct_type.fields, 0, sizeof(StructField));
+
+    flag_type->as.struct_type.fields[0].name = "set";
+    flag_type->as.struct_type.fields[0].type = byte_type;
+
+    calculate_struct_layout(flag_type);
+
+    assert(flag_type->as.struct_type.fields[0].offset == 0);
+    assert(flag_type->as.struct_type.size == 32);
+    assert(flag_type->as.struct_type.alignment == 32);
+
+    arena_free(&arena);
+    DEBUG_INFO("Finished test_struct_layout_min_alignment");
+}
+
 void test_type_checker_struct_layout_main(void)
 {
     TEST_SECTION("Struct Type Checker - Layout");
@@ -446,4 +512,5 @@ void test_type_checker_struct_layout_main(void)
     TEST_RUN("struct_layout_all_1byte_fields", test_struct_layout_all_1byte_fields);
     TEST_RUN("struct_layout_empty", test_struct_layout_empty);
     TEST_RUN("struct_layout_nested", test_struct_layout_nested);
+    TEST_RUN("struct_layout_min_alignment", test_struct_layout_min_alignment);
 }
@@ -5,6 +5,7 @@
 #include <string.h>
 #include "type_checker/expr/type_checker_expr.h"
 #include "type_checker/stmt/type_checker_stmt.h"
+#include "type_checker/expr/type_checker_expr_thread.h"
 #include "../ast/ast_expr.h"
 #include "../test_harness.h"
 
@@ -247,6 +248,95 @@ static void test_spawn_type_mismatch_error(void)
     arena_free(&arena);
 }
 
+/* A ref struct local captured by a spawned lambda, and one that is not */
+static Expr *make_capturing_lambda(Arena *arena, SymbolTable *table, Type **counter_out)
+{
+    Type *counter_type = ast_create_struct_type(arena, "Counter", NULL, 0, NULL, 0, false, false, true, NULL);
+    Type *other_type = ast_create_struct_type(arena, "Other", NULL, 0, NULL, 0, false, false, true, NULL);
+
+    Token c_tok, o_tok;
+    setup_token(&c_tok, TOKEN_IDENTIFIER, "c", 1, "test.sn", arena);
+    setup_token(&o_tok, TOKEN_IDENTIFIER, "o", 1, "test.sn", arena);
+    symbol_table_add_symbol(table, c_tok, counter_type);
+    symbol_table_add_symbol(table, o_tok, other_type);
+
+    /* fn(): Counter => c */
+    Expr *body = ast_create_variable_expr(arena, c_tok, &c_tok);
+    *counter_out = counter_type;
+    return ast_create_lambda_expr(arena, NULL, 0, counter_type, body, FUNC_DEFAULT, false, &c_tok);
+}
+
+/* Test spawning a lambda marks the ref structs it captures as shared */
+static void test_spawn_lambda_marks_captures(void)
+{
+    Arena arena;
+    arena_init(&arena, 4096);
+    SymbolTable table;
+    symbol_table_init(&arena, &table);
+    thread_shared_rc_clear();
+    symbol_table_push_scope(&table);
+
+    Type *counter_type = NULL;
+    Expr *lambda = make_capturing_lambda(&arena, &table, &counter_type);
+    Expr *call_expr = ast_create_call_expr(&arena, lambda, NULL, 0, lambda->token);
+
+    Token spawn_tok;
+    setup_token(&spawn_tok, TOKEN_AMPERSAND, "&", 2, "test.sn", &arena);
+    Expr *spawn_expr = ast_create_thread_spawn_expr(&arena, call_expr, FUNC_DEFAULT, &spawn_tok);
+
+    type_checker_reset_error();
+    Type *result = type_check_expr(spawn_expr, &table);
+    assert(result == counter_type);
+    assert(lambda->as.lambda.capture_count == 1);
+    assert(thread_shared_rc_contains("Counter"));
+    assert(!thread_shared_rc_contains("Other"));
+
+    thread_shared_rc_clear();
+    symbol_table_cleanup(&table);
+    arena_free(&arena);
+}
+
+/* Test spawning a closure variable marks what every lambda captures */
+static void test_spawn_closure_variable_marks_captures(void)
+{
+    Arena arena;
+    arena_init(&arena, 4096);
+    SymbolTable table;
+    symbol_table_init(&arena, &table);
+    thread_shared_rc_clear();
+    symbol_table_push_scope(&table);
+
+    Type *counter_type = NULL;
+    Expr *lambda = make_capturing_lambda(&arena, &table, &counter_type);
+    Type *fn_type = ast_create_function_type(&arena, counter_type, NULL, 0);
+
+    /* var f: fn(): Counter = fn(): Counter => c */
+    Token f_tok;
+    setup_token(&f_tok, TOKEN_IDENTIFIER, "f", 2, "test.sn", &arena);
+    Stmt *f_decl = ast_create_var_decl_stmt(&arena, f_tok, fn_type, lambda, &f_tok);
+    Type *void_type = ast_create_primitive_type(&arena, TYPE_VOID);
+    type_checker_reset_error();
+    type_check_stmt(f_decl, &table, void_type);
+    assert(!type_checker_had_error());
+    assert(!thread_shared_rc_contains("Counter"));
+
+    /* &f() */
+    Expr *callee = ast_create_variable_expr(&arena, f_tok, &f_tok);
+    Expr *call_expr = ast_create_call_expr(&arena, callee, NULL, 0, &f_tok);
+    Token spawn_tok;
+    setup_token(&spawn_tok, TOKEN_AMPERSAND, "&", 3, "test.sn", &arena);
+    Expr *spawn_expr = ast_create_thread_spawn_expr(&arena, call_expr, FUNC_DEFAULT, &spawn_tok);
+
+    Type *result = type_check_expr(spawn_expr, &table);
+    assert(result == counter_type);
+    assert(thread_shared_rc_contains("Counter"));
+    assert(!thread_shared_rc_contains("Other"));
+
+    thread_shared_rc_clear();
+    symbol_table_cleanup(&table);
+    arena_free(&arena);
+}
+
 void test_type_checker_thread_spawn_main(void)
 {
     TEST_SECTION("Thread Spawn Type Checker");
@@ -257,4 +347,6 @@ void test_type_checker_thread_spawn_main(void)
     TEST_RUN("valid_spawn_returns_correct_type", test_valid_spawn_returns_correct_type);
     TEST_RUN("pending_state_marked_on_spawn_assignment", test_pending_state_marked_on_spawn_assignment);
     TEST_RUN("spawn_type_mismatch_error", test_spawn_type_mismatch_error);
+    TEST_RUN("spawn_lambda_marks_captures", test_spawn_lambda_marks_captures);
+    TEST_RUN("spawn_closure_variable_marks_captures", test_spawn_closure_variable_marks_captures);
 }